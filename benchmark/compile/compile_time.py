@@ -0,0 +1,153 @@
+# Copyright 2026 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Compile-time benchmarks of the Catalyst pipelines on a corpus of large MLIR programs, with the
+time of each pass and the peak memory recorded under a tag, e.g. a release, and compared across
+tags"""
+
+import json
+import os
+import subprocess
+import sys
+from argparse import ArgumentParser
+from collections import defaultdict
+from math import log
+from os.path import dirname, join
+from tempfile import TemporaryDirectory
+
+sys.path.insert(0, dirname(__file__))
+
+from corpus import CASES  # pylint: disable=wrong-import-position
+
+
+def compile_once(catalyst, text, pipeline, workdir):
+    """Compile `text` with `pipeline` and return the total time and the time of each pass in ms,
+    and the peak resident memory in MB, from the telemetry of the driver"""
+    source = join(workdir, "input.mlir")
+    telemetry = join(workdir, "telemetry.json")
+    with open(source, "w", encoding="utf-8") as f:
+        f.write(text)
+    cmd = [
+        catalyst,
+        "--tool=opt",
+        source,
+        f"--catalyst-pipeline={pipeline}",
+        f"--telemetry={telemetry}",
+        "-o",
+        os.devnull,
+    ]
+    subprocess.run(cmd, check=True, capture_output=True)
+    with open(telemetry, encoding="utf-8") as f:
+        events = json.load(f)["traceEvents"]
+
+    # A pass runs once for each of its anchors, e.g. each function, which are summed up
+    passes = defaultdict(float)
+    for event in events:
+        passes[event["name"]] += event["dur"] / 1000
+    end = max((e["ts"] + e["dur"] for e in events), default=0)
+    peak = max((e["args"]["peak_rss"] for e in events), default=0)
+    return {"total": end / 1000, "peak_mb": peak / 2**20, "passes": dict(passes)}
+
+
+def run(a):
+    """Measure the cases and append the records to the results file under the tag"""
+    results = load(a.results)
+    with TemporaryDirectory() as workdir:
+        for name in a.cases or CASES:
+            generate, sizes = CASES[name]
+            for size in a.sizes or sizes:
+                text, pipeline = generate(size)
+                trials = [
+                    compile_once(a.catalyst, text, pipeline, workdir) for _ in range(a.repeat)
+                ]
+                best = min(trials, key=lambda t: t["total"])
+                results.setdefault(a.tag, {}).setdefault(name, {})[str(size)] = best
+                print(f"{name:<18}{size:>8}{best['total']:>12.1f} ms{best['peak_mb']:>10.1f} MB")
+        report_scaling(results[a.tag])
+    with open(a.results, "w", encoding="utf-8") as f:
+        json.dump(results, f, indent=2)
+
+
+def report_scaling(records):
+    """Print the empirical order of growth of each pass between the smallest and the largest size
+    of each case, e.g. 1 for passes that are linear in the size parameter of the case"""
+    print("\nGrowth of the pass times with the size of the programs:")
+    for name, by_size in records.items():
+        sizes = sorted(by_size, key=int)
+        if len(sizes) < 2:
+            continue
+        lo, hi = by_size[sizes[0]]["passes"], by_size[sizes[-1]]["passes"]
+        for pass_name in hi:
+            if lo.get(pass_name, 0) > 0 and hi[pass_name] > 0:
+                order = log(hi[pass_name] / lo[pass_name]) / log(int(sizes[-1]) / int(sizes[0]))
+                print(f"  {name:<18}{pass_name:<32}O(n^{order:.2f})")
+
+
+def compare(a):
+    """Compare the pass times and peak memory of two tags and flag the regressions"""
+    results = load(a.results)
+    base, new = results[a.base], results[a.tag]
+    regressions = 0
+    for name in sorted(set(base) & set(new)):
+        for size in sorted(set(base[name]) & set(new[name]), key=int):
+            old_rec, new_rec = base[name][size], new[name][size]
+            rows = [("total", old_rec["total"], new_rec["total"])]
+            rows += [
+                (p, old_rec["passes"][p], t)
+                for p, t in new_rec["passes"].items()
+                if p in old_rec["passes"]
+            ]
+            rows.append(("peak memory (MB)", old_rec["peak_mb"], new_rec["peak_mb"]))
+            for what, old, cur in rows:
+                ratio = cur / old if old > 0 else 1
+                # Tiny passes are too noisy to be flagged on their ratio alone
+                noticeable = what == "peak memory (MB)" or cur - old > a.min_ms
+                flag = "  REGRESSION" if ratio > a.threshold and noticeable else ""
+                regressions += bool(flag)
+                values = f"{old:>10.1f}{cur:>10.1f}{ratio:>7.2f}x"
+                print(f"{name:<18}{size:>6}  {what:<32}{values}{flag}")
+    return 1 if regressions else 0
+
+
+def load(path):
+    """The records of the results file, by tag, case and size"""
+    if not os.path.exists(path):
+        return {}
+    with open(path, encoding="utf-8") as f:
+        return json.load(f)
+
+
+def main():
+    ap = ArgumentParser(description=__doc__)
+    ap.add_argument("action", choices=["run", "compare"])
+    ap.add_argument("-t", "--tag", required=True, help="Tag of the measurements, e.g. a release")
+    ap.add_argument("-b", "--base", help="Tag to compare the measurements of --tag against")
+    ap.add_argument("-c", "--cases", nargs="*", choices=list(CASES), help="Cases to measure")
+    ap.add_argument("-s", "--sizes", type=int, nargs="*", help="Sizes of the programs")
+    ap.add_argument("-r", "--repeat", type=int, default=3, help="Compilations per measurement")
+    ap.add_argument("--results", default="compile_times.json", help="File of the records")
+    ap.add_argument("--catalyst", default=os.environ.get("CATALYST", "catalyst"))
+    ap.add_argument("--threshold", type=float, default=1.2, help="Slowdown ratio to flag")
+    ap.add_argument("--min-ms", type=float, default=5.0, help="Slowdown in ms to flag")
+    a = ap.parse_args()
+
+    if a.action == "run":
+        run(a)
+        return 0
+    if a.base is None:
+        ap.error("compare requires --base")
+    return compare(a)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,168 @@
+# Copyright 2026 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Generators of large MLIR programs for the compile-time benchmarks. Each generator takes the
+size of the program and returns its text, together with the Catalyst pipeline it is compiled with.
+"""
+
+import random
+from math import pi
+
+
+class Circuit:
+    """Straight-line gates on the qubits of a register, which keep track of the current value of
+    each wire"""
+
+    def __init__(self, name, n, result="f64", params=""):
+        self.lines = [
+            f"func.func public @{name}({params}) -> {result} attributes {{quantum.node}} {{\n",
+            "    %shots = arith.constant 0 : i64\n",
+            '    quantum.device shots(%shots) ["rtd_lightning.so", "LightningQubit", "{}"]\n',
+            f"    %r = quantum.alloc({n}) : !quantum.reg\n",
+        ]
+        self.wires = []
+        self.count = 0
+        for i in range(n):
+            self.emit(f"%q{i} = quantum.extract %r[{i}] : !quantum.reg -> !quantum.bit")
+            self.wires.append(f"%q{i}")
+
+    def emit(self, line):
+        self.lines.append(f"    {line}\n")
+
+    def gate(self, name, wires, params=()):
+        """Apply the gate `name` to `wires`, with the SSA values `params` as parameters"""
+        res = f"%g{self.count}"
+        self.count += 1
+        ins = ", ".join(self.wires[w] for w in wires)
+        types = ", ".join(["!quantum.bit"] * len(wires))
+        arity = f":{len(wires)}" if len(wires) > 1 else ""
+        self.emit(f'{res}{arity} = quantum.custom "{name}"({", ".join(params)}) {ins} : {types}')
+        for i, w in enumerate(wires):
+            self.wires[w] = f"{res}#{i}" if len(wires) > 1 else res
+
+    def finish(self, results):
+        """Release the device and return `results`, which are typed by the function signature"""
+        self.emit("quantum.device_release")
+        self.emit(f"func.return {results}")
+        self.lines.append("}\n")
+        return "".join(self.lines)
+
+
+def qft(n):
+    """A quantum Fourier transform on `n` qubits, followed by its inverse, whose gates cancel"""
+    c = Circuit("qft", n)
+    for m in range(2, n + 1):
+        c.emit(f"%theta{m} = arith.constant {pi / 2 ** (m - 1)} : f64")
+        c.emit(f"%ntheta{m} = arith.negf %theta{m} : f64")
+
+    for j in range(n):
+        c.gate("Hadamard", [j])
+        for k in range(j + 1, n):
+            c.gate("ControlledPhaseShift", [k, j], [f"%theta{k - j + 1}"])
+    for j in reversed(range(n)):
+        for k in reversed(range(j + 1, n)):
+            c.gate("ControlledPhaseShift", [k, j], [f"%ntheta{k - j + 1}"])
+        c.gate("Hadamard", [j])
+
+    c.emit(f"%obs = quantum.namedobs {c.wires[0]}[PauliZ] : !quantum.obs")
+    c.emit("%expval = quantum.expval %obs : f64")
+    return c.finish("%expval : f64"), "quantum(cancel-inverses;merge-rotations)"
+
+
+def hamiltonian(terms, n=20, rng=None):
+    """The expectation value of a Hamiltonian of `terms` random Pauli words of weight up to 4 on
+    `n` qubits, after a layer of rotations"""
+    rng = rng or random.Random(1)
+    c = Circuit("hamiltonian", n, result="f64", params="%arg0: f64")
+    for w in range(n):
+        c.gate("RY", [w], ["%arg0"])
+
+    obs = []
+    for t in range(terms):
+        factors = []
+        for w in sorted(rng.sample(range(n), rng.randint(1, 4))):
+            pauli = rng.choice(["PauliX", "PauliY", "PauliZ"])
+            c.emit(f"%o{t}_{w} = quantum.namedobs {c.wires[w]}[{pauli}] : !quantum.obs")
+            factors.append(f"%o{t}_{w}")
+        if len(factors) > 1:
+            c.emit(f"%t{t} = quantum.tensor {', '.join(factors)} : !quantum.obs")
+            obs.append(f"%t{t}")
+        else:
+            obs.append(factors[0])
+
+    coeffs = ", ".join(f"{rng.uniform(-1, 1):e}" for _ in range(terms))
+    c.emit(f"%coeffs = arith.constant dense<[{coeffs}]> : tensor<{terms}xf64>")
+    c.emit(
+        f"%ham = quantum.hamiltonian(%coeffs : tensor<{terms}xf64>) {', '.join(obs)} : !quantum.obs"
+    )
+    c.emit("%expval = quantum.expval %ham : f64")
+    return c.finish("%expval : f64"), "quantum(split-non-commuting)"
+
+
+def pbc(depth, n=1000, rng=None):
+    """`depth` rounds of non-Clifford Pauli rotations on neighbouring pairs of `n` qubits,
+    followed by a Pauli measurement of each qubit"""
+    rng = rng or random.Random(1)
+    args = ", ".join(f"%a{i}: !quantum.bit" for i in range(n))
+    lines = [f"func.func @pbc({args}) {{\n"]
+    wires = [f"%a{i}" for i in range(n)]
+    k = 0
+    for r in range(depth):
+        for i in range(r % 2, n - 1, 2):
+            p0 = rng.choice("IXYZ")
+            p1 = rng.choice("XYZ")
+            lines.append(
+                f'    %r{k}:2 = pbc.ppr ["{p0}", "{p1}"](8) {wires[i]}, {wires[i + 1]}'
+                " : !quantum.bit, !quantum.bit\n"
+            )
+            wires[i], wires[i + 1] = f"%r{k}#0", f"%r{k}#1"
+            k += 1
+    for i in range(n):
+        lines.append(f'    %m{i}, %mq{i} = pbc.ppm ["Z"] {wires[i]} : i1, !quantum.bit\n')
+    lines.append("    return\n}\n")
+    return "".join(lines), "pbc(reduce-t-depth;merge-ppr-ppm)"
+
+
+def nested_gradients(depth, n=8):
+    """Gradients nested `depth` times of a parameter-shift circuit of `n` layers of rotations,
+    differentiated with the parameter-shift rule first and with finite differences above"""
+    c = Circuit("circuit", n, params="%arg0: f64")
+    for layer in range(n):
+        for w in range(n):
+            c.gate("RX", [w], ["%arg0"])
+        for w in range(layer % 2, n - 1, 2):
+            c.gate("CNOT", [w, w + 1])
+    c.emit(f"%obs = quantum.namedobs {c.wires[0]}[PauliZ] : !quantum.obs")
+    c.emit("%expval = quantum.expval %obs : f64")
+    text = c.finish("%expval : f64")
+    text = text.replace("{quantum.node}", '{qnode, diff_method = "parameter-shift"}', 1)
+
+    callee = "circuit"
+    for d in range(1, depth + 1):
+        method = '"auto"' if d == 1 else '"fd"'
+        attrs = "" if d == 1 else " { finiteDiffParam = 1.000000e-03 : f64 }"
+        text += (
+            f"\nfunc.func @grad{d}(%arg0: f64) -> f64 {{\n"
+            f"    %0 = gradient.grad {method} @{callee}(%arg0){attrs} : (f64) -> f64\n"
+            "    func.return %0 : f64\n}\n"
+        )
+        callee = f"grad{d}"
+    return text, "gradient(lower-gradients)"
+
+
+CASES = {
+    "qft": (qft, [16, 32, 64]),
+    "hamiltonian": (hamiltonian, [250, 500, 1000]),
+    "pbc": (pbc, [10, 20, 40]),
+    "nested_gradients": (nested_gradients, [1, 2, 3]),
+}
@@ -0,0 +1,86 @@
+# Copyright 2026 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Scatter microbenchmark: runtime of scatter-heavy JAX functions compiled with qjit and jax.jit"""
+
+from argparse import ArgumentParser
+from timeit import repeat
+
+import jax
+import jax.numpy as jnp
+import numpy as np
+
+from catalyst import qjit
+
+
+def one_hot(indices, n):
+    """One-hot encodings of the indices, one update per row"""
+    return jnp.zeros((indices.shape[0], n)).at[jnp.arange(indices.shape[0]), indices].set(1.0)
+
+
+def point_updates(x, indices, values):
+    """Sequence of `x.at[i].add(v)` updates"""
+    for k in range(indices.shape[0]):
+        x = x.at[indices[k]].add(values[k])
+    return x
+
+
+def segment_sum(data, segment_ids, num_segments):
+    """Sums of the rows of `data` over unsorted segments"""
+    return jax.ops.segment_sum(data, segment_ids, num_segments=num_segments)
+
+
+def problems(n, rng):
+    """The benchmarked functions, with arguments of size `n`"""
+    indices = jnp.array(rng.integers(0, n, n))
+    values = jnp.array(rng.uniform(size=n))
+    data = jnp.array(rng.uniform(size=(n, 64)))
+
+    def one_hot_n(indices):
+        return one_hot(indices, n)
+
+    def segment_sum_n(data, segment_ids):
+        return segment_sum(data, segment_ids, n // 8)
+
+    return {
+        "one_hot": (one_hot_n, (indices,)),
+        "point_updates": (point_updates, (jnp.zeros(n), indices[:32], values[:32])),
+        "segment_sum": (segment_sum_n, (data, indices // 8)),
+    }
+
+
+def measure(fn, args, nrepeat):
+    """The fastest runtime of `fn(*args)`, in microseconds, after a first call compiling it"""
+    jax.block_until_ready(fn(*args))
+    times = repeat(lambda: jax.block_until_ready(fn(*args)), number=1, repeat=nrepeat)
+    return min(times) * 1e6
+
+
+def main():
+    ap = ArgumentParser(description=__doc__)
+    ap.add_argument("sizes", type=int, nargs="*", default=[256, 4096, 65536])
+    ap.add_argument("-r", "--repeat", type=int, default=20, help="Number of timed calls")
+    a = ap.parse_args()
+
+    print(f"{'problem':<16}{'size':>8}{'qjit (us)':>14}{'jax.jit (us)':>14}")
+    for n in a.sizes:
+        for name, (fn, args) in problems(n, np.random.default_rng(42)).items():
+            compiled, reference = qjit(fn), jax.jit(fn)
+            assert np.allclose(compiled(*args), reference(*args)), name
+            t_qjit = measure(compiled, args, a.repeat)
+            t_jax = measure(reference, args, a.repeat)
+            print(f"{name:<16}{n:>8}{t_qjit:>14.1f}{t_jax:>14.1f}")
+
+
+if __name__ == "__main__":
+    main()
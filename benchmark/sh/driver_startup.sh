@@ -0,0 +1,30 @@
+#!/bin/sh
+# Measure the average time the compiler driver takes to lower a trivial module, which is dominated
+# by its startup. The driver is taken from the CATALYST variable, `catalyst` from the PATH by
+# default.
+#
+# Usage: driver_startup.sh [NRUNS]
+
+set -e
+
+CATALYST=${CATALYST:-catalyst}
+NRUNS=${1:-20}
+
+D=$(mktemp -d)
+trap "rm -rf $D" 0 1 2 3
+
+cat > $D/trivial.mlir <<MLIR
+func.func @trivial() {
+    return
+}
+MLIR
+
+B=$(date +%s%N)
+i=0
+while [ $i -lt $NRUNS ]; do
+  $CATALYST --tool=opt $D/trivial.mlir -o $D/trivial.opt.mlir
+  i=$((i + 1))
+done
+E=$(date +%s%N)
+
+echo "$CATALYST: $(( (E - B) / NRUNS / 1000000 )) ms per run, $NRUNS runs"
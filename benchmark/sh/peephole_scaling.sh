@@ -0,0 +1,50 @@
+#!/bin/sh
+# Measure how the time of the cancel-inverses and merge-rotations passes grows with the length of
+# the gate chain on a single wire, which should be linear. `quantum-opt` is taken from the
+# QUANTUM_OPT variable, from the PATH by default.
+#
+# Usage: peephole_scaling.sh [LENGTH...]
+
+set -e
+
+QUANTUM_OPT=${QUANTUM_OPT:-quantum-opt}
+LENGTHS=${*:-1000 10000 100000}
+
+D=$(mktemp -d)
+trap "rm -rf $D" 0 1 2 3
+
+# Write a function applying a chain of N gates to one qubit. The "inverses" chain nests PauliX and
+# PauliY gates around its middle, so that they all cancel from the middle outwards, while the
+# "rotations" chain only has RZ gates to merge.
+chain() {
+  awk -v n=$1 -v kind=$2 'BEGIN {
+    print "func.func @chain(%q: !quantum.bit, %theta: f64) -> !quantum.bit {"
+    print "    %v0 = quantum.custom \"Hadamard\"() %q : !quantum.bit"
+    for (i = 1; i <= n; i++) {
+      if (kind == "inverses") {
+        j = (2 * i > n) ? n + 1 - i : i
+        gate = (j % 2 == 0) ? "quantum.custom \"PauliX\"()" : "quantum.custom \"PauliY\"()"
+      } else {
+        gate = "quantum.custom \"RZ\"(%theta)"
+      }
+      printf "    %%v%d = %s %%v%d : !quantum.bit\n", i, gate, i - 1
+    }
+    printf "    return %%v%d : !quantum.bit\n}\n", n
+  }'
+}
+
+run() {
+  PASS=$1
+  FILE=$2
+  B=$(date +%s%N)
+  $QUANTUM_OPT --pass-pipeline="builtin.module($PASS)" $FILE -o $D/out.mlir
+  E=$(date +%s%N)
+  echo "$PASS: $(wc -l < $FILE) lines, $(( (E - B) / 1000000 )) ms"
+}
+
+for N in $LENGTHS; do
+  chain $N inverses > $D/inverses.mlir
+  run cancel-inverses $D/inverses.mlir
+  chain $N rotations > $D/rotations.mlir
+  run merge-rotations $D/rotations.mlir
+done
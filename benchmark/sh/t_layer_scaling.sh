@@ -0,0 +1,58 @@
+#!/bin/sh
+# Measure how the time of the reduce-t-depth pass grows with the depth of a synthetic PBC program
+# on a wide register, which should be close to linear in the number of rotations. `quantum-opt` is
+# taken from the QUANTUM_OPT variable, from the PATH by default, and the number of qubits from the
+# QUBITS variable, 1000 by default.
+#
+# Usage: t_layer_scaling.sh [DEPTH...]
+
+set -e
+
+QUANTUM_OPT=${QUANTUM_OPT:-quantum-opt}
+QUBITS=${QUBITS:-1000}
+DEPTHS=${*:-10 20 40 80}
+
+D=$(mktemp -d)
+trap "rm -rf $D" 0 1 2 3
+
+# Write a function applying D rounds of non-Clifford rotations to N qubits. Each round acts on
+# neighbouring pairs of qubits with random Pauli words, shifted by one qubit every other round, so
+# that the rotations of a wire mostly anti-commute across rounds but rarely within them.
+program() {
+  awk -v n=$1 -v d=$2 'BEGIN {
+    srand(1)
+    split("I X Y Z", paulis, " ")
+    printf "func.func @pbc("
+    for (i = 0; i < n; i++) {
+      printf "%s%%a%d: !quantum.bit", (i ? ", " : ""), i
+      q[i] = "%a" i
+    }
+    print ") {"
+    k = 0
+    for (r = 0; r < d; r++) {
+      for (i = r % 2; i + 1 < n; i += 2) {
+        p0 = paulis[1 + int(rand() * 4)]
+        p1 = paulis[2 + int(rand() * 3)]
+        printf "    %%r%d:2 = pbc.ppr [\"%s\", \"%s\"](8) %s, %s : !quantum.bit, !quantum.bit\n",
+               k, p0, p1, q[i], q[i + 1]
+        q[i] = "%r" k "#0"
+        q[i + 1] = "%r" k "#1"
+        k++
+      }
+    }
+    print "    return\n}"
+  }'
+}
+
+run() {
+  FILE=$1
+  B=$(date +%s%N)
+  $QUANTUM_OPT --pass-pipeline="builtin.module(reduce-t-depth)" $FILE -o $D/out.mlir
+  E=$(date +%s%N)
+  echo "reduce-t-depth: $(grep -c pbc.ppr $FILE) rotations, $(( (E - B) / 1000000 )) ms"
+}
+
+for DEPTH in $DEPTHS; do
+  program $QUBITS $DEPTH > $D/pbc.mlir
+  run $D/pbc.mlir
+done
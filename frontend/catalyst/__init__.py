@@ -71,6 +71,7 @@ sys.modules["mlir_quantum._mlir_libs"] = __import__("jaxlib.mlir._mlir_libs").ml
 from catalyst import debug, logging, passes
 from catalyst.api_extensions import *
 from catalyst.api_extensions import __all__ as _api_extension_list
+from catalyst.archive import load_archive, save_archive
 from catalyst.autograph import *
 from catalyst.autograph import __all__ as _autograph_functions
 from catalyst.compiler import CompileOptions
@@ -197,8 +198,10 @@ __all__ = (
     "CompileOptions",
     "debug",
     "draw_graph",
+    "load_archive",
     "passes",
     "pipeline",
+    "save_archive",
     *_api_extension_list,
     *_autograph_functions,
 )
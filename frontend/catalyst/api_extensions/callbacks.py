@@ -162,6 +162,14 @@ def pure_callback(callback_fn, result_type=None):
             * the return type and shape is deterministic and known ahead of time.
         result_type (type): The type returned by the function.
 
+    .. note::
+
+        ``callback_fn`` may also be a C function pointer created with :mod:`ctypes`, taking the
+        number of arguments, an array of pointers to the memref descriptors of the arguments, the
+        number of results and an array of pointers to the memref descriptors of the result buffers
+        to write to. Such callbacks are called by the compiled program without acquiring the
+        Python GIL, and must be given a ``result_type``.
+
     .. seealso:: :func:`accelerate`, :func:`.debug.print`, :func:`.debug.callback`.
 
     **Example**
@@ -290,6 +298,9 @@ class AnnotatedFunctionImpl(AnnotatedFunction):
 
     def __init__(self, func, result_type):
         functools.update_wrapper(self, func, assigned=WRAPPER_ASSIGNMENTS)
+        # C function pointers, such as ctypes functions, have no name of their own
+        if not hasattr(self, "__name__"):
+            self.__name__ = type(func).__name__
         self.func = func
         self.result_type = result_type
 
@@ -623,6 +634,13 @@ class MemrefCallable(FlatCallable):
         array = ranked_memref_to_numpy(ptr_to_memref_descriptor)
         return jnp.asarray(array)
 
+    def getNativeCallback(self):
+        """Get the C function pointer wrapped by this callable, if any. It is called directly by
+        the runtime, without acquiring the GIL."""
+        func = getattr(self.func, "func", None)
+        # pylint: disable-next=protected-access
+        return func if isinstance(func, ctypes._CFuncPtr) else None
+
     def getOperand(self, i):
         """Get operand at position i"""
         array = super().getOperand(i)
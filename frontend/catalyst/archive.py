@@ -0,0 +1,260 @@
+# Copyright 2026 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""This module contains functions to save compiled functions to ahead-of-time archives, and to load
+them back without compiling them.
+
+An archive is a single file with the following layout, in little-endian byte order:
+
+- a header with the magic bytes ``CATALYST``, the format version, and the offset and size of the
+  two sections below,
+- the metadata of the entry point: its name, the element type and rank of its results, the PyTree
+  and signature of its arguments and results, and the values of its static arguments,
+- the shared object produced by the compiler, aligned to a page boundary. It holds the compiled
+  program as well as its constant buffers.
+
+Archives are loaded by memory-mapping them. Only the header and the metadata are parsed, and the
+shared object is copied from the mapping to a temporary file for the dynamic loader, which is
+removed once loaded. No MLIR or LLVM context is created.
+"""
+
+import mmap
+import os
+import pickle
+import struct
+import tempfile
+from types import SimpleNamespace
+
+import numpy as np
+from jax.core import ShapedArray
+from jax.tree_util import tree_flatten, tree_unflatten
+
+from catalyst.compiled_functions import CacheEntry, CacheKey, CompilationCache, CompiledFunction
+from catalyst.logging import debug_logger
+from catalyst.tracing.contexts import EvaluationContext
+from catalyst.tracing.type_signatures import filter_static_args, promote_arguments
+
+ARCHIVE_MAGIC = b"CATALYST"
+ARCHIVE_VERSION = 1
+# Magic bytes, version, padding, then the offset and size of the metadata and of the shared object
+ARCHIVE_HEADER = struct.Struct("<8sII4Q")
+
+
+class ArchivedCompiledFunction(CompiledFunction):
+    """A compiled function loaded from an archive, whose results are described by their NumPy
+    element type and rank instead of their MLIR types.
+
+    Args:
+        shared_object_file (str): path to shared object containing compiled function
+        func_name (str): name of compiled function
+        restype (Iterable[Tuple[numpy.dtype, int]]): element type and rank of each result
+        out_type (Iterable | None): pairs whose second element indicates whether a result is kept
+        compile_options (SimpleNamespace): the static argument indices and abstracted axes
+    """
+
+    def getCompiledReturnValueType(self, mlir_tensor_types):
+        if self.return_type_c_abi is None:
+            etypes = [etype for etype, _ in self.restype]
+            ranks = [rank for _, rank in self.restype]
+            self.return_type_c_abi = CompiledFunction.make_return_value_pointer(etypes, ranks)
+        return self.return_type_c_abi
+
+
+class ArchivedFunction:
+    """A function loaded from an ahead-of-time archive with :func:`~.load_archive`.
+
+    It can be called with arguments matching the signature it was compiled for, up to the type
+    promotion and abstracted axes that a :func:`~.qjit` function would accept without recompiling.
+    The static arguments must have the values it was compiled with.
+    """
+
+    def __init__(self, compiled_function, metadata):
+        self.__name__ = metadata["name"]
+        self.compiled_function = compiled_function
+        self.out_treedef = metadata["out_treedef"]
+        self.static_argnums = metadata["static_argnums"]
+
+        treedef = metadata["treedef"]
+        signature = tree_unflatten(
+            treedef,
+            [
+                ShapedArray(shape, np.dtype(dtype), weak_type=weak_type)
+                for shape, dtype, weak_type in metadata["signature"]
+            ],
+        )
+        key = CacheKey(treedef, metadata["static_args"])
+        self.fn_cache = CompilationCache(self.static_argnums, metadata["abstracted_axes"])
+        self.fn_cache.cache[key] = CacheEntry(compiled_function, signature, self.out_treedef, None)
+
+    def __call__(self, *args, **kwargs):
+        cached_fn, requires_promotion = self.fn_cache.lookup(args)
+        if cached_fn is None:
+            raise TypeError(
+                f"The arguments of '{self.__name__}' do not match the signature or the static "
+                "arguments it was compiled with."
+            )
+
+        if requires_promotion:
+            dynamic_args = filter_static_args(args, self.static_argnums)
+            promoted_args = iter(promote_arguments(cached_fn.signature, dynamic_args))
+            args = tuple(
+                arg if idx in self.static_argnums else next(promoted_args)
+                for idx, arg in enumerate(args)
+            )
+
+        results = self.compiled_function(*args, **kwargs)
+        return tree_unflatten(self.out_treedef, results)
+
+
+@debug_logger
+def save_archive(fn, path, *args):
+    """Save a :func:`~.qjit` decorated function, compiled for the provided arguments, to an
+    ahead-of-time archive.
+
+    The archive can be loaded with :func:`~.load_archive` to call the compiled function without
+    tracing or compiling it again. It is specific to the host architecture, and links against the
+    Catalyst runtime and device libraries of the installation it was compiled with.
+
+    Args:
+        fn (QJIT): a qjit-decorated function
+        path (str | os.PathLike): the path of the archive to write
+        *args: argument values to compile ``fn`` for, or none to save its current compilation
+
+    **Example**
+
+    .. code-block:: python
+
+        @qjit
+        @qml.qnode(qml.device("lightning.qubit", wires=1))
+        def circuit(x):
+            qml.RX(x, wires=0)
+            return qml.expval(qml.PauliZ(0))
+
+    >>> from catalyst import save_archive, load_archive
+    >>> save_archive(circuit, "circuit.qjit", 0.5)
+    >>> loaded = load_archive("circuit.qjit")
+    >>> loaded(0.5)
+    Array(0.87758256, dtype=float64)
+    """
+    EvaluationContext.check_is_not_tracing("Archives cannot be saved from a tracing context.")
+
+    if args or not fn.compiled_function:
+        fn.jit_compile(args)
+
+    compiled_function = fn.compiled_function
+    # The cache key holds the argument PyTree and static arguments of the current function
+    key, entry = next(
+        (key, entry)
+        for key, entry in fn.fn_cache.cache.items()
+        if entry.compiled_fn is compiled_function
+    )
+
+    restype = [
+        (CompiledFunction.get_etypes(res), CompiledFunction.get_ranks(res))
+        for res in compiled_function.restype
+    ]
+    out_type = compiled_function.out_type
+    metadata = {
+        "name": str(fn.__name__),
+        "func_name": compiled_function.func_name,
+        "restype": restype,
+        "keep_outputs": None if out_type is None else [k for _, k in out_type],
+        "out_treedef": fn.out_treedef,
+        "treedef": key.treedef,
+        # Abstract values are stored by their shape and dtype, which are picklable
+        "signature": [
+            (tuple(aval.shape), np.dtype(aval.dtype).name, aval.weak_type)
+            for aval in tree_flatten(entry.signature)[0]
+        ],
+        "static_argnums": fn.compile_options.static_argnums,
+        "static_args": key.static_args,
+        "abstracted_axes": fn.compile_options.abstracted_axes,
+    }
+    metadata_bytes = pickle.dumps(metadata)
+
+    with open(compiled_function.shared_object.shared_object_file, "rb") as file:
+        shared_object_bytes = file.read()
+
+    metadata_offset = ARCHIVE_HEADER.size
+    object_offset = -(-(metadata_offset + len(metadata_bytes)) // mmap.PAGESIZE) * mmap.PAGESIZE
+    header = ARCHIVE_HEADER.pack(
+        ARCHIVE_MAGIC,
+        ARCHIVE_VERSION,
+        0,
+        metadata_offset,
+        len(metadata_bytes),
+        object_offset,
+        len(shared_object_bytes),
+    )
+
+    with open(path, "wb") as file:
+        file.write(header)
+        file.write(metadata_bytes)
+        file.write(bytes(object_offset - metadata_offset - len(metadata_bytes)))
+        file.write(shared_object_bytes)
+
+
+@debug_logger
+def load_archive(path):
+    """Load a function from an ahead-of-time archive written by :func:`~.save_archive`.
+
+    The archive is memory-mapped and its shared object is loaded directly, without tracing,
+    compiling, or creating an MLIR context, so loading takes milliseconds.
+
+    .. warning::
+
+        Loading an archive runs the native code it contains. Only load archives from trusted
+        sources.
+
+    Args:
+        path (str | os.PathLike): the path of the archive
+
+    Returns:
+        ArchivedFunction: a callable running the compiled function
+    """
+    with open(path, "rb") as file, mmap.mmap(file.fileno(), 0, access=mmap.ACCESS_READ) as view:
+        if len(view) < ARCHIVE_HEADER.size:
+            raise ValueError(f"'{path}' is not a Catalyst archive.")
+        magic, version, _, metadata_offset, metadata_size, object_offset, object_size = (
+            ARCHIVE_HEADER.unpack_from(view)
+        )
+        if magic != ARCHIVE_MAGIC:
+            raise ValueError(f"'{path}' is not a Catalyst archive.")
+        if version != ARCHIVE_VERSION:
+            raise ValueError(f"Unsupported version {version} of the Catalyst archive '{path}'.")
+
+        metadata = pickle.loads(view[metadata_offset : metadata_offset + metadata_size])
+
+        # The dynamic loader only opens files, so the shared object is written to a file that is
+        # removed as soon as it is loaded
+        fd, shared_object_file = tempfile.mkstemp(prefix=metadata["name"], suffix=".so")
+        try:
+            with memoryview(view) as buffer, open(fd, "wb") as shared_object:
+                shared_object.write(buffer[object_offset : object_offset + object_size])
+
+            keep_outputs = metadata["keep_outputs"]
+            compiled_function = ArchivedCompiledFunction(
+                shared_object_file,
+                metadata["func_name"],
+                metadata["restype"],
+                None if keep_outputs is None else [(None, k) for k in keep_outputs],
+                SimpleNamespace(
+                    static_argnums=metadata["static_argnums"],
+                    abstracted_axes=metadata["abstracted_axes"],
+                ),
+            )
+        finally:
+            os.remove(shared_object_file)
+
+    return ArchivedFunction(compiled_function, metadata)
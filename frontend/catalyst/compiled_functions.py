@@ -41,6 +41,35 @@ from catalyst.utils.jnp_to_memref import get_ranked_memref_descriptor
 logger = logging.getLogger(__name__)
 logger.addHandler(logging.NullHandler())
 
+# Raised by DLPack exports and imports that are not supported for a buffer, e.g. of a read-only
+# array or of a device that is not the host.
+DLPACK_ERRORS = (BufferError, RuntimeError, TypeError, ValueError)
+
+
+def as_numpy_array(arg):
+    """Convert an argument of a compiled function to a NumPy array. Host buffers of other frameworks
+    that support DLPack, such as JAX arrays, are shared rather than copied.
+    """
+    if not isinstance(arg, np.ndarray) and hasattr(arg, "__dlpack__"):
+        try:
+            return np.from_dlpack(arg)
+        except DLPACK_ERRORS:
+            pass
+    return np.asarray(arg)
+
+
+def as_jax_array(array, owned):
+    """Convert a result of a compiled function to a JAX array. The buffers transferred from the
+    runtime to the results are shared with JAX through DLPack, while results aliasing an argument
+    or another result are copied, as JAX arrays are immutable.
+    """
+    if owned:
+        try:
+            return jnp.from_dlpack(array)
+        except DLPACK_ERRORS:
+            pass
+    return jnp.asarray(array)
+
 
 class SharedObjectManager:
     """Shared object manager.
@@ -143,29 +172,41 @@ class CompiledFunction:
         self.out_type = out_type
 
     @staticmethod
-    def _exec(shared_object, has_return, out_type, numpy_dict, *args):
-        """Execute the compiled function with arguments ``*args``.
+    def _exec(
+        shared_object, has_return, out_type, numpy_dict, return_value_pointer, numpy_args
+    ):  # pylint: disable=too-many-arguments
+        """Execute the compiled function with arguments ``numpy_args``.
 
         Args:
             lib: Shared object
             has_return: whether the function returns a value or not
             out_type: Jaxpr output type holding information about implicit outputs
             numpy_dict: dictionary of numpy arrays of buffers from the runtime
-            *args: arguments to the function
+            return_value_pointer: pointer to the structure receiving the return values
+            numpy_args: the flattened arguments to the function, as numpy arrays. Their memref
+                descriptors are filled by the wrapper, without creating ctypes structures.
 
         Returns:
             the return values computed by the function or None if the function has no results
         """
 
         with shared_object as lib:
-            result_desc = type(args[0].contents) if has_return else None
-            retval = wrapper.wrap(lib.function, args, result_desc, lib.mem_transfer, numpy_dict)
+            result_desc = type(return_value_pointer.contents) if has_return else None
+            retval, owned = wrapper.wrap(
+                lib.function,
+                return_value_pointer,
+                numpy_args,
+                result_desc,
+                lib.mem_transfer,
+                numpy_dict,
+            )
 
         if out_type is not None:
             keep_outputs = [k for _, k in out_type]
             retval = [r for (k, r) in zip(keep_outputs, retval) if k]
+            owned = [o for (k, o) in zip(keep_outputs, owned) if k]
 
-        retval = [jnp.asarray(arr) for arr in retval]
+        retval = [as_jax_array(arr, o) for arr, o in zip(retval, owned)]
         return retval
 
     @staticmethod
@@ -226,8 +267,6 @@ class CompiledFunction:
 
         error_msg = """This function must be called with a non-zero length list as an argument."""
         assert mlir_tensor_types, error_msg
-        _get_rmd = CompiledFunction.get_ranked_memref_descriptor_from_mlir_tensor_type
-        return_fields_types = [_get_rmd(mlir_tensor_type) for mlir_tensor_type in mlir_tensor_types]
         ranks = [
             CompiledFunction.get_ranks(mlir_tensor_type) for mlir_tensor_type in mlir_tensor_types
         ]
@@ -236,9 +275,30 @@ class CompiledFunction:
             CompiledFunction.get_etypes(mlir_tensor_type) for mlir_tensor_type in mlir_tensor_types
         ]
 
-        sizes = [
-            CompiledFunction.get_sizes(mlir_tensor_type) for mlir_tensor_type in mlir_tensor_types
-        ]
+        self.return_type_c_abi = CompiledFunction.make_return_value_pointer(etypes, ranks)
+        return self.return_type_c_abi
+
+    @staticmethod
+    def make_return_value_pointer(etypes, ranks):
+        """Create the structure receiving the return values of a compiled function, without
+        requiring the MLIR types of the results.
+
+        Args:
+            etypes: the NumPy element type of each result
+            ranks: the rank of each result
+        Returns:
+            a pointer to a CompiledFunctionReturnValue
+        """
+
+        return_fields_types = []
+        for etype, rank in zip(etypes, ranks):
+            ctp = as_ctype(etype)
+            if rank:
+                return_fields_types.append(make_nd_memref_descriptor(rank, ctp)())
+            else:
+                return_fields_types.append(make_zero_d_memref_descriptor(ctp)())
+
+        sizes = [np.dtype(etype).itemsize for etype in etypes]
 
         class CompiledFunctionReturnValue(ctypes.Structure):
             """Programmatically create a structure which holds tensors of varying base types."""
@@ -249,9 +309,7 @@ class CompiledFunction:
             _sizes_ = sizes
 
         return_value = CompiledFunctionReturnValue()
-        return_value_pointer = ctypes.pointer(return_value)
-        self.return_type_c_abi = return_value_pointer
-        return self.return_type_c_abi
+        return ctypes.pointer(return_value)
 
     def restype_to_memref_descs(self, mlir_tensor_types):
         """Converts the return type to a compatible type for the expected ABI.
@@ -334,16 +392,23 @@ class CompiledFunction:
                 abstracted_axes, *dynamic_args, **kwargs
             )
 
-        abi_args, _buffer = self.args_to_memref_descs(self.restype, dynamic_args, **kwargs)
+        return_value_pointer = ctypes.POINTER(ctypes.c_int)()  # This is the null pointer
+        if self.restype:
+            return_value_pointer = self.restype_to_memref_descs(self.restype)
+
+        args_data, _ = tree_flatten((dynamic_args, kwargs))
+        numpy_args = [as_numpy_array(arg) for arg in args_data]
 
-        numpy_dict = {nparr.ctypes.data: nparr for nparr in _buffer}
+        # Filled by the wrapper with the arguments, then with the results, by address
+        numpy_dict = {}
 
         result = CompiledFunction._exec(
             self.shared_object,
             self.restype,
             self.out_type,
             numpy_dict,
-            *abi_args,
+            return_value_pointer,
+            numpy_args,
         )
 
         return result
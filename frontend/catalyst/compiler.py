@@ -28,7 +28,7 @@ import sys
 import tempfile
 import warnings
 from os import path
-from typing import List, Optional
+from typing import List, Optional, Union
 
 from catalyst.logging import debug_logger, debug_logger_init
 from catalyst.pipelines import CompileOptions, KeepIntermediateLevel
@@ -175,6 +175,11 @@ class LinkerDriver:
             "-lrt_rsdecomp",
         ]
 
+        # Instrumented programs write their profiles with the profile runtime of the compiler,
+        # which only Clang provides
+        if os.environ.get("CATALYST_PROFILE_GENERATE", None):
+            default_flags.append("-fprofile-instr-generate")
+
         # If OQD runtime capi is built, link to it as well
         # TODO: This is not ideal and should be replaced when the compiler is device aware
         if os.path.isfile(os.path.join(rt_lib_path, "librt_OQD_capi" + file_extension)):
@@ -352,6 +357,41 @@ def _options_to_cli_flags(options):
 
     if not options.lower_to_llvm:
         extra_args += [("--tool", "opt")]
+    else:
+        # Inline the runtime C-API into the program when its bitcode has been built
+        rt_bitcode = os.path.join(get_lib_path("runtime", "RUNTIME_LIB_DIR"), "rt_capi.bc")
+        if os.path.isfile(rt_bitcode):
+            extra_args += [("--runtime-bitcode", rt_bitcode)]
+
+        # The cache entries also depend on the contents of the loaded plugins
+        cache_dir = os.environ.get("CATALYST_CACHE_DIR", None)
+        if cache_dir:
+            extra_args += [("--cache-dir", cache_dir), "--incremental"]
+
+        codegen_threads = os.environ.get("CATALYST_CODEGEN_THREADS", None)
+        if codegen_threads:
+            extra_args += [("--codegen-threads", codegen_threads)]
+
+        # Code generation for a specific CPU, e.g. `native`, with additional target features
+        target_cpu = os.environ.get("CATALYST_TARGET_CPU", None)
+        if target_cpu:
+            extra_args += [("--target-cpu", target_cpu)]
+        target_features = os.environ.get("CATALYST_TARGET_FEATURES", None)
+        if target_features:
+            extra_args += [("--target-features", target_features)]
+
+        # Hardware performance counters of the qnodes and entry points, written by the program
+        perf_counters = os.environ.get("CATALYST_PERF_COUNTERS", None)
+        if perf_counters:
+            extra_args += [("--perf-counters", os.path.abspath(perf_counters))]
+
+        # Profile-guided optimization: instrument the program, or optimize it with a profile
+        profile_generate = os.environ.get("CATALYST_PROFILE_GENERATE", None)
+        profile_use = os.environ.get("CATALYST_PROFILE_USE", None)
+        if profile_generate:
+            extra_args += [("--profile-generate", profile_generate)]
+        elif profile_use:
+            extra_args += [("--profile-use", profile_use)]
 
     if options.keep_intermediate:
         extra_args += ["--keep-intermediate"]
@@ -437,11 +477,11 @@ class Compiler:
 
     # pylint: disable=too-many-branches
     @debug_logger
-    def run_from_ir(self, ir: str, module_name: str, workspace: Directory):
-        """Compile a shared object from a textual IR (MLIR or LLVM).
+    def run_from_ir(self, ir: Union[str, bytes], module_name: str, workspace: Directory):
+        """Compile a shared object from a textual IR (MLIR or LLVM), or from MLIR bytecode.
 
         Args:
-            ir (str): Textual MLIR to be compiled
+            ir (str | bytes): Textual IR, or MLIR bytecode, to be compiled
             module_name (str): Module name to use for naming
             workspace (Directory): directory that holds output files and/or debug dumps.
 
@@ -459,8 +499,12 @@ class Compiler:
         if self.options.verbose:
             print(f"[LIB] Running compiler driver in {workspace}", file=self.options.logfile)
 
+        is_bytecode = isinstance(ir, bytes)
         with tempfile.NamedTemporaryFile(
-            mode="w", suffix=".mlir", dir=str(workspace), delete=False
+            mode="wb" if is_bytecode else "w",
+            suffix=".mlirbc" if is_bytecode else ".mlir",
+            dir=str(workspace),
+            delete=False,
         ) as tmp_infile:
             tmp_infile_name = tmp_infile.name
             tmp_infile.write(ir)
@@ -488,7 +532,10 @@ class Compiler:
             out_IR = None
 
         if self.options.link:
-            output = LinkerDriver.run(output_object_name, options=self.options)
+            # Parallel code generation emits the program to additional object files
+            partitions = sorted(glob.glob(os.path.join(str(workspace), f"{module_name}.part*.o")))
+            flags = LinkerDriver.get_default_flags(self.options) + partitions
+            output = LinkerDriver.run(output_object_name, flags=flags, options=self.options)
             output = str(pathlib.Path(output).absolute())
         else:
             output = None
@@ -659,12 +706,14 @@ class Compiler:
         using_python_compiler = self.is_using_python_compiler(mlir_module)
         workspace = args[0] if args else kwargs.get("workspace")
         module_name = str(mlir_module.operation.attributes["sym_name"]).replace('"', "")
-        ir = mlir_module.operation.get_asm(
-            binary=False, print_generic_op_form=using_python_compiler, assume_verified=True
-        )
+        save_initial_ir = workspace and self.options.keep_intermediate
+        if using_python_compiler or save_initial_ir:
+            ir = mlir_module.operation.get_asm(
+                binary=False, print_generic_op_form=using_python_compiler, assume_verified=True
+            )
 
         # Save intermediate IR before any compiler transformation is applied
-        if workspace and self.options.keep_intermediate:
+        if save_initial_ir:
             initial_ir_file = os.path.join(str(workspace), f"0_{module_name}.mlir")
             with open(initial_ir_file, "w", encoding="utf-8") as f:
                 # We need to canonicalize the IR to get the pretty format
@@ -679,6 +728,11 @@ class Compiler:
             callback = self._create_xdsl_pass_save_callback(workspace)
             compiler = UnifiedCompiler()
             ir = compiler.run(ir, callback=callback)
+        else:
+            # The compiler driver parses MLIR bytecode much faster than text for large modules
+            bytecode = io.BytesIO()
+            mlir_module.operation.write_bytecode(bytecode)
+            ir = bytecode.getvalue()
 
         return self.run_from_ir(
             ir,
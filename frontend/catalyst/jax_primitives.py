@@ -15,6 +15,7 @@
 of quantum operations, measurements, and observables to JAXPR.
 """
 
+import ctypes
 import functools
 import sys
 from dataclasses import dataclass
@@ -486,7 +487,11 @@ def _python_callback_lowering(
     # pylint: disable=import-outside-toplevel
     import catalyst_callback_registry as registry  # type: ignore[import-not-found]
 
-    callback_id = registry.register(callback)
+    if native_callback := callback.getNativeCallback():
+        address = ctypes.cast(native_callback, ctypes.c_void_p).value
+        callback_id = registry.register_native(address, native_callback)
+    else:
+        callback_id = registry.register(callback)
 
     params_ty = [arg.type for arg in args]
     results_ty = list(convert_shaped_arrays_to_tensors(results_aval))
@@ -1068,6 +1068,82 @@ def pauli_word_to_tensor_obs(obs, qrp: QRegPromise) -> List[DynamicJaxprTracer]:
     return tensorobs_p.bind(*nested_obs)
 
 
+def _is_diagonal_pauli_sum(obs: Optional[Operator]) -> bool:
+    """Whether ``obs`` is a sum of products of Pauli Z operators, which is diagonal in the
+    computational basis."""
+    pauli_rep = obs.pauli_rep if obs is not None else None
+    if pauli_rep is None:
+        return False
+    return all(pauli == "Z" for word in pauli_rep for pauli in word.values())
+
+
+@debug_logger
+def trace_shot_vector_measurement(
+    output: MeasurementProcess, qrp: QRegPromise, d_wires, shot_vector
+) -> Tuple[DynamicJaxprTracer, ...]:
+    """Trace an expectation value, variance or probability measurement over a shot vector.
+
+    The measured qubits are sampled once for all the shots of the shot vector, and the samples are
+    sliced into the shots of each entry, from which the result of the entry is computed. The device
+    thus executes a single sampling pass instead of one per entry.
+
+    Args:
+        output (MeasurementProcess): the measurement process
+        qrp (QRegPromise): Quantum register tracer with cached qubits
+        d_wires: the number of device wires
+        shot_vector: the shot vector, as pairs of shots and copies
+
+    Returns:
+        The results of the measurement for each entry of the shot vector.
+    """
+    if type(output) in (ExpectationMP, VarianceMP) and _is_diagonal_pauli_sum(output.obs):
+        wires = output.obs.wires
+    elif type(output) is ProbabilityMP and output.mv is None:
+        wires = output.wires if output.wires else None
+    else:
+        raise NotImplementedError(
+            f"The {type(output).__name__} measurement process does not support shot-vectors. "
+            "Please consider using qml.sample() instead."
+        )
+
+    obs_tracers, nqubits = trace_observables(None, qrp, wires)
+    nqubits = d_wires if nqubits is None else nqubits
+    if isinstance(nqubits, DynamicJaxprTracer):
+        raise NotImplementedError(
+            "Shot-vectors are not supported for probabilities on a dynamic number of wires."
+        )
+
+    total_shots = sum(shots * copies for shots, copies in shot_vector)
+    samples = sample_p.bind(obs_tracers, static_shape=(total_shots, nqubits))
+    bits = jnp.astype(samples, jnp.int64)
+
+    if type(output) is ProbabilityMP:
+        # Index of the basis state of each shot, with the first wire as the most significant bit
+        values = bits @ jnp.left_shift(1, jnp.arange(nqubits - 1, -1, -1, dtype=jnp.int64))
+    else:
+        # Eigenvalue of the observable at each shot
+        values = jnp.zeros(total_shots)
+        for word, coeff in output.obs.pauli_rep.items():
+            parity = jnp.zeros(total_shots, dtype=jnp.int64)
+            for wire in word:
+                parity = parity ^ bits[:, wires.index(wire)]
+            values = values + jnp.real(coeff) * (1 - 2 * parity)
+
+    results = ()
+    start_idx = 0
+    for shots, copies in shot_vector:
+        for _ in range(copies):
+            entry = values[start_idx : start_idx + shots]
+            if type(output) is ProbabilityMP:
+                results += (jnp.bincount(entry, length=2**nqubits) / shots,)
+            elif type(output) is ExpectationMP:
+                results += (jnp.mean(entry),)
+            else:
+                results += (jnp.var(entry),)
+            start_idx += shots
+    return results
+
+
 # pylint: disable=too-many-statements,too-many-branches, too-many-positional-arguments
 @debug_logger
 def trace_quantum_measurements(
@@ -1100,13 +1176,6 @@ def trace_quantum_measurements(
     for i, output in enumerate(outputs):
         if isinstance(output, MeasurementProcess):
 
-            # Check if the measurement is supported shot-vector where num_of_total_copies > 1
-            if shots_obj.has_partitioned_shots and not isinstance(output, SampleMP):
-                raise NotImplementedError(
-                    f"The {type(output).__name__} measurement process does not support "
-                    "shot-vectors. Please consider using qml.sample() instead."
-                )
-
             if device.wires is None:
                 d_wires = num_qubits_p.bind()
             elif catalyst.device.qjit_device.is_dynamic_wires(device.wires):
@@ -1114,6 +1183,14 @@ def trace_quantum_measurements(
             else:
                 d_wires = len(device.wires)
 
+            # Measurements other than samples over a shot-vector where num_of_total_copies > 1 are
+            # computed from the samples of a single sampling pass
+            if shots_obj.has_partitioned_shots and not isinstance(output, SampleMP):
+                out_classical_tracers.append(
+                    trace_shot_vector_measurement(output, qrp, d_wires, shots_obj.shot_vector)
+                )
+                continue
+
             m_wires = output.wires if output.wires else None
             obs_tracers, nqubits = trace_observables(output.obs, qrp, m_wires)
             nqubits = d_wires if nqubits is None else nqubits
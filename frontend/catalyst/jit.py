@@ -116,7 +116,10 @@ def qjit(
             :doc:`AutoGraph guide </dev/autograph>`.
         autograph_include: A list of (sub)modules to be allow-listed for autograph conversion.
         async_qnodes (bool): Experimental support for automatically executing
-            QNodes asynchronously, if supported by the device runtime.
+            QNodes asynchronously, if supported by the device runtime. The number of worker
+            threads, core pinning, and the maximum number of device instances per device can be
+            set with the ``CATALYST_ASYNC_NUM_WORKERS``, ``CATALYST_ASYNC_PIN_WORKERS`` and
+            ``CATALYST_ASYNC_MAX_DEVICES`` environment variables.
         target (str): The compilation target.
         keep_intermediate (Union[str, int, bool]): Level controlling intermediate file generation.
 
@@ -587,7 +587,10 @@ def gridsynth(qnode=None, *, epsilon=1e-4, ppr_basis=False):
 
     .. note::
 
-        The actual discretization is only performed during execution time.
+        The actual discretization is only performed during execution time, except for
+        constant angles :math:`\pm \pi / 2^k` and :math:`\pm 3 \pi / 2^k` (:math:`3 \leq k \leq 16`)
+        at the precisions ``1e-2`` to ``1e-6``, whose precomputed decompositions are inserted at
+        compile time.
 
     Args:
         qnode (QNode): the QNode to apply the gridsynth compiler pass to
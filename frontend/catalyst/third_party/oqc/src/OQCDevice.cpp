@@ -48,6 +48,26 @@ void OQCDevice::ReleaseQubits(const std::vector<QubitIdType> &qubits)
     builder = std::make_unique<OpenQASM2Builder>();
 }
 
+auto OQCDevice::getCircuit() -> std::string
+{
+    const size_t key = builder->getStructureHash();
+    auto it = program_cache.find(key);
+    if (it != program_cache.end() && !builder->hasSameStructure(it->second.circuit)) {
+        // A circuit of another structure with the same hash, which the new one replaces
+        program_cache.erase(it);
+        it = program_cache.end();
+    }
+    if (it == program_cache.end()) {
+        if (program_cache.size() == max_cached_programs) {
+            program_cache.clear();
+        }
+        it = program_cache
+                 .emplace(key, CachedProgram{*builder, builder->toOpenQASM2Template()})
+                 .first;
+    }
+    return it->second.program.bind(builder->getParams());
+}
+
 auto OQCDevice::GetNumQubits() const -> size_t { return builder->getNumQubits(); }
 
 void OQCDevice::SetDeviceShots(size_t shots) { device_shots = shots; }
@@ -88,7 +108,7 @@ void OQCDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1>
     }
     std::iota(eigvals.begin(), eigvals.end(), 0);
 
-    auto &&results = runner->Counts(builder->toOpenQASM2(), qpu_id, device_shots, GetNumQubits());
+    auto &&results = runner->Counts(getCircuit(), qpu_id, device_shots, GetNumQubits());
     int i = 0;
     for (auto r : results) {
         counts(i) = r;
@@ -41,6 +41,16 @@ class OQCDevice final : public Catalyst::Runtime::QuantumDevice {
     std::set<QubitIdType> initial_allocated_QubitIds;
     std::unordered_map<std::string, std::string> device_kwargs;
 
+    // Serialised programs by circuit structure hash, so that re-running a circuit with new gate
+    // parameters only re-binds them. Each program keeps the circuit it was built from, against
+    // which the structure of a circuit with the same hash is checked.
+    struct CachedProgram {
+        OpenQASM2Builder circuit;
+        QASMProgramTemplate program;
+    };
+    static constexpr size_t max_cached_programs = 64;
+    std::unordered_map<size_t, CachedProgram> program_cache;
+
     std::string qpu_id;
     inline static const std::unordered_map<std::string, std::string> qpu_map = {
         {"lucy", "qpu:uk:2:d865b5a184"}, {"toshiko", "qpu:jp:3:673b1ad43c"}};
@@ -54,6 +64,8 @@ class OQCDevice final : public Catalyst::Runtime::QuantumDevice {
         return res;
     }
 
+    auto getCircuit() -> std::string;
+
   public:
     explicit OQCDevice(const std::string &kwargs = "{device_type : oqc, backend : default}")
     {
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <iomanip>
 #include <sstream>
@@ -22,6 +23,7 @@
 #include <vector>
 
 #include "Exception.hpp"
+#include "ProgramTemplate.hpp"
 
 namespace Catalyst::Runtime::OpenQASM2 {
 
@@ -147,6 +149,8 @@ class QASMRegister {
     }
 };
 
+using QASMProgramTemplate = Catalyst::Runtime::ProgramTemplate;
+
 /**
  * The OpenQasm gate type.
  *
@@ -171,33 +175,43 @@ class QASMGate {
     ~QASMGate() = default;
 
     [[nodiscard]] auto getName() const -> std::string { return name; }
-    [[nodiscard]] auto getParams() const -> std::vector<double> { return params_val; }
+    [[nodiscard]] auto getParams() const -> const std::vector<double> & { return params_val; }
     [[nodiscard]] auto getWires() const -> std::vector<size_t> { return wires; }
 
-    [[nodiscard]] auto toOpenQASM2(const QASMRegister &qregister, size_t precision = 5) const
-        -> std::string
+    /**
+     * @brief Append the gate to `program`, with a placeholder for each parameter value.
+     */
+    void toOpenQASM2(QASMProgramTemplate &program, const QASMRegister &qregister) const
     {
-        std::ostringstream oss;
         // name(param_1, ..., param_n) qubit_1, ..., qubit_m
-        oss << name;
+        program.append(name);
         if (!params_val.empty()) {
-            oss << "(";
-            auto iter = params_val.begin();
-            for (; iter != params_val.end() - 1; iter++) {
-                oss << std::setprecision(precision) << *iter << ", ";
+            program.append("(");
+            for (size_t idx = 0; idx < params_val.size(); idx++) {
+                program.append(idx ? ", " : "");
+                program.appendParam();
             }
-            oss << std::setprecision(precision) << *iter << ") ";
+            program.append(") ");
         }
         else {
-            oss << " ";
+            program.append(" ");
         }
+        std::ostringstream oss;
         auto iter = wires.begin();
         for (; iter != wires.end() - 1; iter++) {
             oss << qregister.getName() << "[" << *iter << "], ";
         }
         oss << qregister.getName() << "[" << *iter << "]"
             << ";\n";
-        return oss.str();
+        program.append(oss.str());
+    }
+
+    [[nodiscard]] auto toOpenQASM2(const QASMRegister &qregister, size_t precision = 5) const
+        -> std::string
+    {
+        QASMProgramTemplate program(precision);
+        toOpenQASM2(program, qregister);
+        return program.bind(params_val);
     }
 };
 
@@ -217,7 +231,7 @@ class QASMMeasure {
     ~QASMMeasure() = default;
 
     [[nodiscard]] auto getQubit() const -> size_t { return qubit; }
-    [[nodiscard]] auto getBit() const -> size_t { return qubit; }
+    [[nodiscard]] auto getBit() const -> size_t { return bit; }
 
     [[nodiscard]] auto toOpenQASM2(const QASMRegister &qregister,
                                    const QASMRegister &cregister) const -> std::string
@@ -267,37 +281,119 @@ class OpenQASM2Builder {
     void AddMeasurement(size_t bit, size_t qubit) { measurements.emplace_back(bit, qubit); }
     void AddMeasurements() { measure_all = true; }
     size_t getNumQubits() { return num_qubits; }
-    [[nodiscard]] virtual auto toOpenQASM2(size_t precision = 5) const -> std::string
+
+    /**
+     * @brief Get the parameters of all gates, in the order of `toOpenQASM2Template`.
+     */
+    [[nodiscard]] auto getParams() const -> std::vector<double>
     {
-        std::ostringstream oss;
+        std::vector<double> params;
+        for (auto &gate : gates) {
+            const auto &gate_params = gate.getParams();
+            params.insert(params.end(), gate_params.begin(), gate_params.end());
+        }
+        return params;
+    }
+
+    /**
+     * @brief Hash everything but the gate parameter values, so that circuits that only differ in
+     * their angles share the same hash and `toOpenQASM2Template`.
+     */
+    [[nodiscard]] auto getStructureHash() const -> size_t
+    {
+        size_t seed = 0;
+        auto combine = [&seed](const auto &value) { hashCombine(seed, value); };
+
+        for (auto *regs : {&qregs, &cregs}) {
+            for (auto &reg : *regs) {
+                combine(reg.getName());
+                combine(reg.getSize());
+            }
+        }
+        for (auto &gate : gates) {
+            combine(gate.getName());
+            combine(gate.getParams().size());
+            for (auto wire : gate.getWires()) {
+                combine(wire);
+            }
+        }
+        combine(measure_all);
+        for (auto &m : measurements) {
+            combine(m.getQubit());
+            combine(m.getBit());
+        }
+        return seed;
+    }
+
+    /**
+     * @brief Check whether the circuits only differ in the values of their gate parameters, in
+     * which case they share the same `getStructureHash` and `toOpenQASM2Template`.
+     */
+    [[nodiscard]] auto hasSameStructure(const OpenQASM2Builder &other) const -> bool
+    {
+        auto same_reg = [](const QASMRegister &lhs, const QASMRegister &rhs) {
+            return lhs.getType() == rhs.getType() && lhs.getName() == rhs.getName() &&
+                   lhs.getSize() == rhs.getSize();
+        };
+        auto same_gate = [](const QASMGate &lhs, const QASMGate &rhs) {
+            return lhs.getName() == rhs.getName() &&
+                   lhs.getParams().size() == rhs.getParams().size() &&
+                   lhs.getWires() == rhs.getWires();
+        };
+        auto same_measure = [](const QASMMeasure &lhs, const QASMMeasure &rhs) {
+            return lhs.getQubit() == rhs.getQubit() && lhs.getBit() == rhs.getBit();
+        };
+
+        return measure_all == other.measure_all &&
+               std::equal(qregs.begin(), qregs.end(), other.qregs.begin(), other.qregs.end(),
+                          same_reg) &&
+               std::equal(cregs.begin(), cregs.end(), other.cregs.begin(), other.cregs.end(),
+                          same_reg) &&
+               std::equal(gates.begin(), gates.end(), other.gates.begin(), other.gates.end(),
+                          same_gate) &&
+               std::equal(measurements.begin(), measurements.end(), other.measurements.begin(),
+                          other.measurements.end(), same_measure);
+    }
+
+    [[nodiscard]] auto toOpenQASM2(size_t precision = 5) const -> std::string
+    {
+        return toOpenQASM2Template(precision).bind(getParams());
+    }
+
+    /**
+     * @brief Serialise the circuit with a placeholder for each gate parameter.
+     */
+    [[nodiscard]] virtual auto toOpenQASM2Template(size_t precision = 5) const
+        -> QASMProgramTemplate
+    {
+        QASMProgramTemplate program(precision);
 
         // header
-        oss << "OPENQASM 2.0"
-            << ";\n";
-        oss << "include \"qelib1.inc\""
-            << ";\n";
+        program.append("OPENQASM 2.0;\n");
+        program.append("include \"qelib1.inc\";\n");
+
         // quantum registers
-        oss << qregs[0].toOpenQASM2(RegisterMode::Alloc);
+        program.append(qregs[0].toOpenQASM2(RegisterMode::Alloc));
 
         // measurement results registers
-        oss << cregs[0].toOpenQASM2(RegisterMode::Alloc);
+        program.append(cregs[0].toOpenQASM2(RegisterMode::Alloc));
 
         // quantum gates assuming qregs.size() == 1
         for (auto &gate : gates) {
-            oss << gate.toOpenQASM2(qregs[0], precision);
+            gate.toOpenQASM2(program, qregs[0]);
         }
 
         // quantum measures assuming qregs.size() == 1, cregs.size() <= 1
         if (!measure_all) {
             for (auto &m : measurements) {
-                oss << m.toOpenQASM2(qregs[0], cregs[0]);
+                program.append(m.toOpenQASM2(qregs[0], cregs[0]));
             }
         }
         else {
-            oss << "measure " << qregs[0].getName() << " -> " << cregs[0].getName() << ";\n";
+            program.append("measure " + qregs[0].getName() + " -> " + cregs[0].getName() + ";\n");
         }
 
-        return oss.str();
+        return program;
     }
 };
 
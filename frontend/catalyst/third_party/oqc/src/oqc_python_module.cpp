@@ -18,12 +18,16 @@
 #include <vector>
 
 #include "pybind11/eval.h"
+#include "pybind11/gil_safe_call_once.h"
 #include "pybind11/pybind11.h"
 
 std::string program = R"(
+import os
 
-try:
-    import os
+# Authenticated clients by (url, email), reused across circuit executions
+_client_cache = {}
+
+def py_get_client():
     email = os.environ.get("OQC_EMAIL")
     password = os.environ.get("OQC_PASSWORD")
     url = os.environ.get("OQC_URL")
@@ -34,46 +38,76 @@ try:
             Please set the environment variables `OQC_EMAIL`, `OQC_PASSWORD` and `OQC_URL`.
             """
         )
-    import qcaas_client
-    from qcaas_client.client import OQCClient, QPUTask, CompilerConfig, QuantumResultsFormat
-    from qcaas_client.compiler_config import Tket, TketOptimizations
-    optimisations = Tket()
-    optimisations.tket_optimizations = TketOptimizations.DefaultMappingPass
-    RES_FORMAT = QuantumResultsFormat().binary_count()
-    client = OQCClient(url=url, email=email, password=password)
-    client.authenticate()
-    oqc_config = CompilerConfig(repeats=shots, results_format=RES_FORMAT, optimizations=optimisations)
-    oqc_task = QPUTask(program=circuit, config=oqc_config, qpu_id=qpu_id)
-    res = client.execute_tasks(oqc_task, qpu_id=qpu_id)
-    counts = res[0].result["cbits"]
-except Exception as e:
-    print(f"circuit: {circuit}")
-    msg = str(e)
+
+    client = _client_cache.get((url, email))
+    if client is None:
+        from qcaas_client.client import OQCClient
+        client = OQCClient(url=url, email=email, password=password)
+        client.authenticate()
+        _client_cache[(url, email)] = client
+    return client
+
+def py_counts(circuit, qpu_id, shots):
+    try:
+        client = py_get_client()
+        from qcaas_client.client import QPUTask, CompilerConfig, QuantumResultsFormat
+        from qcaas_client.compiler_config import Tket, TketOptimizations
+        optimisations = Tket()
+        optimisations.tket_optimizations = TketOptimizations.DefaultMappingPass
+        RES_FORMAT = QuantumResultsFormat().binary_count()
+        oqc_config = CompilerConfig(
+            repeats=shots, results_format=RES_FORMAT, optimizations=optimisations
+        )
+        oqc_task = QPUTask(program=circuit, config=oqc_config, qpu_id=qpu_id)
+        res = client.execute_tasks(oqc_task, qpu_id=qpu_id)
+        return res[0].result["cbits"], ""
+    except Exception as e:
+        # Re-authenticate on the next execution, e.g. after the session expired
+        _client_cache.clear()
+        print(f"circuit: {circuit}")
+        return {}, str(e)
 )";
 
+/**
+ * @brief Get the namespace in which `program` has been executed.
+ *
+ * The program is executed once per process in a dedicated namespace, so that the OQC client is
+ * authenticated once and reused across circuit executions. The namespace is intentionally leaked,
+ * as it may otherwise be destroyed after the interpreter is finalized. Must be called with the
+ * GIL held.
+ *
+ * Unlike a function-local static, whose guard would be held while the program runs, the storage
+ * releases the GIL while another thread initializes it. A thread that waits for the namespace
+ * therefore cannot block the initializing thread when the program gives up the GIL.
+ */
+static auto getProgramScope() -> pybind11::dict &
+{
+    namespace py = pybind11;
+    PYBIND11_CONSTINIT static py::gil_safe_call_once_and_store<py::dict> scope;
+    return scope
+        .call_once_and_store_result([] {
+            py::dict dict;
+            dict["__builtins__"] = py::module_::import("builtins");
+            py::exec(py::str(program.c_str()), dict);
+            return dict;
+        })
+        .get_stored();
+}
+
 extern "C" {
 [[gnu::visibility("default")]] int counts(const char *_circuit, const char *_qpu_id, size_t shots,
-                                          size_t num_qubits, const char *_kwargs, void *_vector,
+                                          [[maybe_unused]] size_t num_qubits,
+                                          [[maybe_unused]] const char *_kwargs, void *_vector,
                                           char *error_msg, size_t error_msg_size)
 {
     namespace py = pybind11;
-    using namespace py::literals;
 
     py::gil_scoped_acquire lock;
 
-    py::dict locals;
-    locals["circuit"] = _circuit;
-    locals["qpu_id"] = _qpu_id;
-    locals["kwargs"] = _kwargs;
-    locals["shots"] = shots;
-    locals["num_qubits"] = num_qubits;
-    locals["msg"] = "";
-
-    // Evaluate in scope of main module
-    py::object scope = py::module_::import("__main__").attr("__dict__");
-    py::exec(py::str(program.c_str()), scope, locals);
+    py::dict &scope = getProgramScope();
+    py::tuple output = scope["py_counts"](_circuit, _qpu_id, shots);
 
-    auto msg = py::cast<std::string>(locals["msg"]);
+    auto msg = py::cast<std::string>(output[1]);
 
     if (!msg.empty()) {
         size_t copy_len = std::min(msg.length(), error_msg_size - 1);
@@ -83,11 +117,10 @@ extern "C" {
     }
 
     // Process counts only if we didn't have credential issues
-    py::dict results = locals["counts"];
+    py::dict results = output[0];
 
     std::vector<size_t> *counts_value = reinterpret_cast<std::vector<size_t> *>(_vector);
     for (auto item : results) {
-        auto key = item.first;
         auto value = item.second;
         counts_value->push_back(py::cast<size_t>(value));
     }
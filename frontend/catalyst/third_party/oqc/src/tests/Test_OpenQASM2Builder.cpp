@@ -233,3 +233,36 @@ TEST_CASE("Test OpenQasmBuilder with dumping the circuit header, gates, and meas
 
     CHECK(builder.toOpenQASM2() == toqasm);
 }
+
+TEST_CASE("Test OpenQasmBuilder with re-binding the circuit parameters", "[openqasm]")
+{
+    auto build = [](double theta, double phi, size_t wire) {
+        auto builder = OpenQASM2Builder();
+        builder.AddRegisters("q", 2, "c", 2);
+        builder.AddGate("RX", {theta}, {wire});
+        builder.AddGate("CNOT", {}, {0, 1});
+        builder.AddGate("U2", {phi, theta}, {1});
+        builder.AddMeasurements();
+        return builder;
+    };
+
+    auto builder = build(0.1, 0.2, 0);
+    auto program = builder.toOpenQASM2Template();
+    CHECK(program.getNumParams() == 3);
+    CHECK(builder.getParams() == std::vector<double>{0.1, 0.2, 0.1});
+    CHECK(program.bind(builder.getParams()) == builder.toOpenQASM2());
+
+    // Circuits that only differ in their parameter values share the same template
+    auto other = build(1.5, -3.14159265, 0);
+    CHECK(other.getStructureHash() == builder.getStructureHash());
+    CHECK(other.hasSameStructure(builder));
+    CHECK(program.bind(other.getParams()) == other.toOpenQASM2());
+    CHECK(program.bind(other.getParams()).find("u2(-3.1416, 1.5) q[1];\n") != std::string::npos);
+
+    CHECK(build(0.1, 0.2, 1).getStructureHash() != builder.getStructureHash());
+    CHECK_FALSE(build(0.1, 0.2, 1).hasSameStructure(builder));
+
+    REQUIRE_THROWS_WITH(program.bind({0.1}),
+                        Catch::Matchers::ContainsSubstring(
+                            "Invalid number of parameters for the program template"));
+}
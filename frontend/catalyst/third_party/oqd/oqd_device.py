@@ -62,7 +62,7 @@ def OQDDevicePipeline(device, qubit, gate, device_db=None):
     # Build OQD pipeline based on whether device_db is provided
     if device_db is not None:
         oqd_passes = [
-            "func.func(ions-decomposition)",
+            "func.func(ions-decomposition{merge-rotations=true})",
             gates_to_pulses_pass,
             "convert-ion-to-rtio{" + "device_db=" + device_db + "}",
             "convert-rtio-event-to-artiq",
@@ -74,7 +74,7 @@ def OQDDevicePipeline(device, qubit, gate, device_db=None):
     else:
         # Standard LLVM lowering route (legacy OQD pipeline)
         oqd_passes = [
-            "func.func(ions-decomposition)",
+            "func.func(ions-decomposition{merge-rotations=true})",
             gates_to_pulses_pass,
             "convert-ion-to-llvm",
         ]
@@ -48,14 +48,25 @@
  *     since they are not needed for Catalyst.
  *  3. Opportunistically improved const-correctness.
  *  4. Applied Catalyst C++ code formatting.
+ *  5. Partitioned the batch dimension of the kernels across threads (see
+ *     `ParallelForBatch`), and removed the redundant LAPACK calls on the first
+ *     batch element that preceded the batch loops of Geev and Gees.
+ *  6. Reused the work arrays of the kernels across calls on the same thread
+ *     (see `Workspace`).
  */
 
 #include "lapack_kernels.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #ifdef USE_ABSEIL_LIB
 #include "absl/base/dynamic_annotations.h"
@@ -63,6 +74,141 @@
 
 namespace jax {
 
+// Batch Parallelism
+// ~~~~~
+
+// The maximum number of threads the batch of a kernel is partitioned across. It defaults to the
+// hardware concurrency, and is set with the `CATALYST_LAPACK_NUM_THREADS` environment variable,
+// e.g. to 1 when the underlying LAPACK library is itself multi-threaded.
+static int MaxBatchThreads()
+{
+    static const int max_threads = [] {
+        const char *value = std::getenv("CATALYST_LAPACK_NUM_THREADS");
+        const int parsed = value != nullptr ? std::atoi(value) : 0;
+        if (parsed > 0) {
+            return parsed;
+        }
+        return static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }();
+    return max_threads;
+}
+
+// The number of matrix elements below which a thread is not worth starting.
+constexpr int64_t kMinElementsPerThread = 1 << 14;
+
+// The number of contiguous chunks a batch is partitioned into, each run on its own thread. It is at
+// least 1, and only greater when the batch holds enough work. `elements` is the size of each matrix
+// of the batch.
+static int NumBatchChunks(int batch, int64_t elements)
+{
+    const int64_t work_threads = static_cast<int64_t>(batch) * elements / kMinElementsPerThread;
+    return static_cast<int>(std::max<int64_t>(
+        std::min<int64_t>({MaxBatchThreads(), batch, std::max<int64_t>(work_threads, 1)}), 1));
+}
+
+// Call `body(chunk, begin, end)` on `num_chunks` contiguous ranges of batch indices that partition
+// [0, batch), in parallel. The first chunk runs on the calling thread.
+template <typename F> static void ParallelForBatchChunks(int batch, int num_chunks, F body)
+{
+    if (num_chunks <= 1) {
+        body(0, 0, batch);
+        return;
+    }
+
+    auto chunk_begin = [&](int t) {
+        return static_cast<int>(static_cast<int64_t>(batch) * t / num_chunks);
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(num_chunks - 1);
+    for (int t = 1; t < num_chunks; ++t) {
+        workers.emplace_back(body, t, chunk_begin(t), chunk_begin(t + 1));
+    }
+    body(0, 0, chunk_begin(1));
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+// Call `body(begin, end)` on contiguous ranges of batch indices that partition [0, batch), in
+// parallel when the batch holds enough work. `elements` is the size of each matrix of the batch.
+template <typename F> static void ParallelForBatch(int batch, int64_t elements, F body)
+{
+    ParallelForBatchChunks(batch, NumBatchChunks(batch, elements),
+                           [&body](int, int begin, int end) { body(begin, end); });
+}
+
+// Workspaces
+// ~~~~~
+
+// The maximum total size of the buffers kept by the workspace cache of each thread.
+constexpr size_t kMaxCachedWorkspaceBytes = size_t{64} << 20;
+
+// A cache of released work arrays keyed by their size in bytes, from which kernels called
+// repeatedly on matrices of the same shapes take their work arrays instead of reallocating them.
+class WorkspaceCache {
+  public:
+    static std::unique_ptr<std::byte[]> Acquire(size_t bytes)
+    {
+        WorkspaceCache &cache = Get();
+        auto it = cache.buffers_.find(bytes);
+        if (it == cache.buffers_.end()) {
+            return std::unique_ptr<std::byte[]>(new std::byte[bytes]);
+        }
+        std::unique_ptr<std::byte[]> buffer = std::move(it->second);
+        cache.buffers_.erase(it);
+        cache.cached_bytes_ -= bytes;
+        return buffer;
+    }
+
+    // Buffers that would grow the cache past its bound are freed instead.
+    static void Release(size_t bytes, std::unique_ptr<std::byte[]> buffer)
+    {
+        WorkspaceCache &cache = Get();
+        if (cache.cached_bytes_ + bytes <= kMaxCachedWorkspaceBytes) {
+            cache.buffers_.emplace(bytes, std::move(buffer));
+            cache.cached_bytes_ += bytes;
+        }
+    }
+
+  private:
+    static WorkspaceCache &Get()
+    {
+        thread_local WorkspaceCache cache;
+        return cache;
+    }
+
+    std::unordered_multimap<size_t, std::unique_ptr<std::byte[]>> buffers_;
+    size_t cached_bytes_ = 0;
+};
+
+// Uninitialized work arrays of `count` elements of type T, one for each chunk of a batch. They are
+// taken from the workspace cache of the calling thread and returned to it on destruction, as the
+// other chunks run on threads started for a single call, whose own caches would not outlive it.
+template <typename T> class ChunkWorkspaces {
+  public:
+    ChunkWorkspaces(int num_chunks, int64_t count) : bytes_(static_cast<size_t>(count) * sizeof(T))
+    {
+        buffers_.reserve(num_chunks);
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            buffers_.push_back(WorkspaceCache::Acquire(bytes_));
+        }
+    }
+    ~ChunkWorkspaces()
+    {
+        for (std::unique_ptr<std::byte[]> &buffer : buffers_) {
+            WorkspaceCache::Release(bytes_, std::move(buffer));
+        }
+    }
+    ChunkWorkspaces(const ChunkWorkspaces &) = delete;
+    ChunkWorkspaces &operator=(const ChunkWorkspaces &) = delete;
+
+    T *data(int chunk) { return reinterpret_cast<T *>(buffers_[chunk].get()); }
+
+  private:
+    size_t bytes_;
+    std::vector<std::unique_ptr<std::byte[]>> buffers_;
+};
+
 // Trsm (Triangular System Solver)
 // ~~~~
 
@@ -105,11 +251,12 @@ template <typename T> void RealTrsm<T>::Kernel(void *out, void **data, XlaCustom
     const int64_t x_plus = static_cast<int64_t>(m) * static_cast<int64_t>(n);
     const int64_t a_plus = static_cast<int64_t>(lda) * static_cast<int64_t>(lda);
 
-    for (int i = 0; i < batch; ++i) {
-        fn(CblasRowMajor, cside, cuplo, ctransa, cdiag, m, n, alpha, a, lda, x, ldb);
-        x += x_plus;
-        a += a_plus;
-    }
+    ParallelForBatch(batch, x_plus + a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            fn(CblasRowMajor, cside, cuplo, ctransa, cdiag, m, n, alpha, a + i * a_plus, lda,
+               x + i * x_plus, ldb);
+        }
+    });
 }
 
 template <typename T> typename ComplexTrsm<T>::FnType *ComplexTrsm<T>::fn = nullptr;
@@ -151,11 +298,12 @@ template <typename T> void ComplexTrsm<T>::Kernel(void *out, void **data, XlaCus
     const int64_t x_plus = static_cast<int64_t>(m) * static_cast<int64_t>(n);
     const int64_t a_plus = static_cast<int64_t>(lda) * static_cast<int64_t>(lda);
 
-    for (int i = 0; i < batch; ++i) {
-        fn(CblasRowMajor, cside, cuplo, ctransa, cdiag, m, n, &alpha, a, lda, x, ldb);
-        x += x_plus;
-        a += a_plus;
-    }
+    ParallelForBatch(batch, x_plus + a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            fn(CblasRowMajor, cside, cuplo, ctransa, cdiag, m, n, &alpha, a + i * a_plus, lda,
+               x + i * x_plus, ldb);
+        }
+    });
 }
 
 template struct RealTrsm<float>;
@@ -188,12 +336,13 @@ template <typename T> void Getrf<T>::Kernel(void *out_tuple, void **data, XlaCus
     constexpr int corder = LAPACK_ROW_MAJOR;
     const int lda = (corder == LAPACK_ROW_MAJOR) ? n : m;
 
-    for (int i = 0; i < b; ++i) {
-        *info = fn(corder, m, n, a_out, lda, ipiv);
-        a_out += static_cast<int64_t>(m) * static_cast<int64_t>(n);
-        ipiv += std::min(m, n);
-        ++info;
-    }
+    const int64_t a_plus = static_cast<int64_t>(m) * static_cast<int64_t>(n);
+    const int64_t ipiv_plus = std::min(m, n);
+    ParallelForBatch(b, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            info[i] = fn(corder, m, n, a_out + i * a_plus, lda, ipiv + i * ipiv_plus);
+        }
+    });
 }
 
 template struct Getrf<float>;
@@ -225,11 +374,13 @@ template <typename T> void Geqrf<T>::Kernel(void *out_tuple, void **data, XlaCus
     constexpr int corder = LAPACK_ROW_MAJOR;
     const int lda = (corder == LAPACK_ROW_MAJOR) ? n : m;
 
-    for (int i = 0; i < b; ++i) {
-        fn(LAPACK_ROW_MAJOR, m, n, a_out, lda, tau);
-        a_out += static_cast<int64_t>(m) * static_cast<int64_t>(n);
-        tau += std::min(m, n);
-    }
+    const int64_t a_plus = static_cast<int64_t>(m) * static_cast<int64_t>(n);
+    const int64_t tau_plus = std::min(m, n);
+    ParallelForBatch(b, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            fn(LAPACK_ROW_MAJOR, m, n, a_out + i * a_plus, lda, tau + i * tau_plus);
+        }
+    });
 }
 
 template struct Geqrf<float>;
@@ -262,11 +413,13 @@ template <typename T> void Orgqr<T>::Kernel(void *out_tuple, void **data, XlaCus
     constexpr int corder = LAPACK_ROW_MAJOR;
     const int lda = (corder == LAPACK_ROW_MAJOR) ? n : m;
 
-    for (int i = 0; i < b; ++i) {
-        fn(LAPACK_ROW_MAJOR, m, n, k, a_out, lda, tau);
-        a_out += static_cast<int64_t>(m) * static_cast<int64_t>(n);
-        tau += k;
-    }
+    const int64_t a_plus = static_cast<int64_t>(m) * static_cast<int64_t>(n);
+    ParallelForBatch(b, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            fn(LAPACK_ROW_MAJOR, m, n, k, a_out + i * a_plus, lda,
+               tau + static_cast<int64_t>(i) * k);
+        }
+    });
 }
 
 template struct Orgqr<float>;
@@ -299,11 +452,12 @@ template <typename T> void Potrf<T>::Kernel(void *out_tuple, void **data, XlaCus
 
     constexpr int corder = LAPACK_ROW_MAJOR;
 
-    for (int i = 0; i < b; ++i) {
-        *info = fn(corder, uplo, n_col, a_out, n_col);
-        a_out += static_cast<int64_t>(n_row) * static_cast<int64_t>(n_col);
-        ++info;
-    }
+    const int64_t a_plus = static_cast<int64_t>(n_row) * static_cast<int64_t>(n_col);
+    ParallelForBatch(b, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            info[i] = fn(corder, uplo, n_col, a_out + i * a_plus, n_col);
+        }
+    });
 }
 
 template struct Potrf<float>;
@@ -396,14 +550,16 @@ template <typename T> void RealGesdd<T>::Kernel(void *out_tuple, void **data, Xl
     const int tdu = ldu;
     const int ldvt = Gesdd_ldvt(corder, jobz, m, n);
 
-    for (int i = 0; i < b; ++i) {
-        *info = fn(corder, jobz, m, n, a_out, lda, s, u, ldu, vt, ldvt);
-        a_out += static_cast<int64_t>(m) * n;
-        s += std::min(m, n);
-        u += static_cast<int64_t>(m) * tdu;
-        vt += static_cast<int64_t>(ldvt) * n;
-        ++info;
-    }
+    const int64_t a_plus = static_cast<int64_t>(m) * n;
+    const int64_t s_plus = std::min(m, n);
+    const int64_t u_plus = static_cast<int64_t>(m) * tdu;
+    const int64_t vt_plus = static_cast<int64_t>(ldvt) * n;
+    ParallelForBatch(b, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            info[i] = fn(corder, jobz, m, n, a_out + i * a_plus, lda, s + i * s_plus,
+                         u + i * u_plus, ldu, vt + i * vt_plus, ldvt);
+        }
+    });
 }
 
 template <typename T> typename ComplexGesdd<T>::FnType *ComplexGesdd<T>::fn = nullptr;
@@ -437,14 +593,16 @@ void ComplexGesdd<T>::Kernel(void *out_tuple, void **data, XlaCustomCallStatus *
     const int tdu = ldu;
     const int ldvt = Gesdd_ldvt(corder, jobz, m, n);
 
-    for (int i = 0; i < b; ++i) {
-        *info = fn(LAPACK_ROW_MAJOR, jobz, m, n, a_out, lda, s, u, ldu, vt, ldvt);
-        a_out += static_cast<int64_t>(m) * n;
-        s += std::min(m, n);
-        u += static_cast<int64_t>(m) * tdu;
-        vt += static_cast<int64_t>(ldvt) * n;
-        ++info;
-    }
+    const int64_t a_plus = static_cast<int64_t>(m) * n;
+    const int64_t s_plus = std::min(m, n);
+    const int64_t u_plus = static_cast<int64_t>(m) * tdu;
+    const int64_t vt_plus = static_cast<int64_t>(ldvt) * n;
+    ParallelForBatch(b, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            info[i] = fn(LAPACK_ROW_MAJOR, jobz, m, n, a_out + i * a_plus, lda, s + i * s_plus,
+                         u + i * u_plus, ldu, vt + i * vt_plus, ldvt);
+        }
+    });
 }
 
 template struct RealGesdd<float>;
@@ -481,12 +639,13 @@ template <typename T> void RealSyevd<T>::Kernel(void *out_tuple, void **data, Xl
 
     constexpr int corder = LAPACK_ROW_MAJOR;
 
-    for (int i = 0; i < b; ++i) {
-        *info = fn(corder, jobz, uplo, n, a_out, n, w_out);
-        a_out += static_cast<int64_t>(n) * n;
-        w_out += n;
-        ++info;
-    }
+    const int64_t a_plus = static_cast<int64_t>(n) * n;
+    ParallelForBatch(b, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            info[i] = fn(corder, jobz, uplo, n, a_out + i * a_plus, n,
+                         w_out + static_cast<int64_t>(i) * n);
+        }
+    });
 }
 
 template <typename T> typename ComplexHeevd<T>::FnType *ComplexHeevd<T>::fn = nullptr;
@@ -516,12 +675,13 @@ void ComplexHeevd<T>::Kernel(void *out_tuple, void **data, XlaCustomCallStatus *
 
     constexpr int corder = LAPACK_ROW_MAJOR;
 
-    for (int i = 0; i < b; ++i) {
-        *info = fn(corder, jobz, uplo, n, a_out, n, w_out);
-        a_out += static_cast<int64_t>(n) * n;
-        w_out += n;
-        ++info;
-    }
+    const int64_t a_plus = static_cast<int64_t>(n) * n;
+    ParallelForBatch(b, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            info[i] = fn(corder, jobz, uplo, n, a_out + i * a_plus, n,
+                         w_out + static_cast<int64_t>(i) * n);
+        }
+    });
 }
 
 template struct RealSyevd<float>;
@@ -582,17 +742,8 @@ template <typename T> void RealGeev<T>::Kernel(void *out_tuple, void **data, Xla
     std::complex<T> *vr_out = reinterpret_cast<std::complex<T> *>(out[3]);
     int *info = reinterpret_cast<int *>(out[4]);
 
-    T *a_work = new T[n * n];
-    std::memcpy(a_work, a_in, n * n * sizeof(T));
-    T *vl_work = new T[n * n];
-    T *vr_work = new T[n * n];
-
     constexpr int corder = LAPACK_ROW_MAJOR;
 
-    // TODO(phawkins): preallocate workspace using XLA.
-    *info = fn(corder, jobvl, jobvr, n_int, a_work, n_int, wr_out, wi_out, vl_work, n_int, vr_work,
-               n_int);
-
     auto is_finite = [](T *a_work, int64_t n) {
         for (int64_t j = 0; j < n; ++j) {
             for (int64_t k = 0; k < n; ++k) {
@@ -603,35 +754,41 @@ template <typename T> void RealGeev<T>::Kernel(void *out_tuple, void **data, Xla
         }
         return true;
     };
-    for (int i = 0; i < b; ++i) {
-        size_t a_size = n * n * sizeof(T);
-        std::memcpy(a_work, a_in, a_size);
-        if (is_finite(a_work, n)) {
-            *info = fn(corder, jobvl, jobvr, n_int, a_work, n_int, wr_out, wi_out, vl_work, n_int,
-                       vr_work, n_int);
+    // Each chunk works on its own copy of the matrices, since LAPACK overwrites them
+    const int num_chunks = NumBatchChunks(b, n * n);
+    ChunkWorkspaces<T> a_works(num_chunks, n * n);
+    ChunkWorkspaces<T> vl_works(num_chunks, n * n);
+    ChunkWorkspaces<T> vr_works(num_chunks, n * n);
+    ParallelForBatchChunks(b, num_chunks, [&](int chunk, int begin, int end) {
+        T *a_work = a_works.data(chunk);
+        T *vl_work = vl_works.data(chunk);
+        T *vr_work = vr_works.data(chunk);
+        for (int i = begin; i < end; ++i) {
+            size_t a_size = n * n * sizeof(T);
+            std::memcpy(a_work, a_in + i * n * n, a_size);
+            T *wr = wr_out + i * n;
+            T *wi = wi_out + i * n;
+            if (is_finite(a_work, n)) {
+                info[i] = fn(corder, jobvl, jobvr, n_int, a_work, n_int, wr, wi, vl_work, n_int,
+                             vr_work, n_int);
 #ifdef USE_ABSEIL_LIB
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(a_work, a_size);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(wr_out, sizeof(T) * n);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(wi_out, sizeof(T) * n);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vl_work, sizeof(T) * n * n);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vr_work, sizeof(T) * n * n);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(info, sizeof(int));
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(a_work, a_size);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(wr, sizeof(T) * n);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(wi, sizeof(T) * n);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vl_work, sizeof(T) * n * n);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vr_work, sizeof(T) * n * n);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(info + i, sizeof(int));
 #endif
-            if (info[0] == 0) {
-                UnpackEigenvectors(n, wi_out, vl_work, vl_out);
-                UnpackEigenvectors(n, wi_out, vr_work, vr_out);
+                if (info[i] == 0) {
+                    UnpackEigenvectors(n, wi, vl_work, vl_out + i * n * n);
+                    UnpackEigenvectors(n, wi, vr_work, vr_out + i * n * n);
+                }
+            }
+            else {
+                info[i] = -4;
             }
         }
-        else {
-            *info = -4;
-        }
-        a_in += n * n;
-        wr_out += n;
-        wi_out += n;
-        vl_out += n * n;
-        vr_out += n * n;
-        ++info;
-    }
+    });
 }
 
 template <typename T> typename ComplexGeev<T>::FnType *ComplexGeev<T>::fn = nullptr;
@@ -655,14 +812,8 @@ void ComplexGeev<T>::Kernel(void *out_tuple, void **data, XlaCustomCallStatus *)
     T *vr_out = reinterpret_cast<T *>(out[2]);
     int *info = reinterpret_cast<int *>(out[3]);
 
-    T *a_work = new T[n * n];
-    std::memcpy(a_work, a_in, n * n * sizeof(T));
-
     constexpr int corder = LAPACK_ROW_MAJOR;
 
-    // TODO(phawkins): preallocate workspace using XLA.
-    *info = fn(corder, jobvl, jobvr, n_int, a_work, n_int, w_out, vl_out, n_int, vr_out, n_int);
-
     auto is_finite = [](T *a_work, int64_t n) {
         for (int64_t j = 0; j < n; ++j) {
             for (int64_t k = 0; k < n; ++k) {
@@ -675,29 +826,32 @@ void ComplexGeev<T>::Kernel(void *out_tuple, void **data, XlaCustomCallStatus *)
         return true;
     };
 
-    for (int i = 0; i < b; ++i) {
-        size_t a_size = n * n * sizeof(T);
-        std::memcpy(a_work, a_in, a_size);
-        if (is_finite(a_work, n)) {
-            *info =
-                fn(corder, jobvl, jobvr, n_int, a_work, n_int, w_out, vl_out, n_int, vr_out, n_int);
+    // Each chunk works on its own copy of the matrices, since LAPACK overwrites them
+    const int num_chunks = NumBatchChunks(b, n * n);
+    ChunkWorkspaces<T> a_works(num_chunks, n * n);
+    ParallelForBatchChunks(b, num_chunks, [&](int chunk, int begin, int end) {
+        T *a_work = a_works.data(chunk);
+        for (int i = begin; i < end; ++i) {
+            size_t a_size = n * n * sizeof(T);
+            std::memcpy(a_work, a_in + i * n * n, a_size);
+            T *w = w_out + i * n;
+            T *vl = vl_out + i * n * n;
+            T *vr = vr_out + i * n * n;
+            if (is_finite(a_work, n)) {
+                info[i] = fn(corder, jobvl, jobvr, n_int, a_work, n_int, w, vl, n_int, vr, n_int);
 #ifdef USE_ABSEIL_LIB
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(a_work, a_size);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(w_out, sizeof(T) * n);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vl_out, sizeof(T) * n * n);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vr_out, sizeof(T) * n * n);
-            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(info_out, sizeof(int));
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(a_work, a_size);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(w, sizeof(T) * n);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vl, sizeof(T) * n * n);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vr, sizeof(T) * n * n);
+                ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(info + i, sizeof(int));
 #endif
+            }
+            else {
+                info[i] = -4;
+            }
         }
-        else {
-            *info = -4;
-        }
-        a_in += n * n;
-        w_out += n;
-        vl_out += n * n;
-        vr_out += n * n;
-        info += 1;
-    }
+    });
 }
 
 template struct RealGeev<float>;
@@ -732,34 +886,29 @@ template <typename T> void RealGees<T>::Kernel(void *out_tuple, void **data, Xla
 
     constexpr int corder = LAPACK_ROW_MAJOR;
 
-    *info = fn(corder, jobvs, sort, select, n_int, a_out, n_int, sdim_out, wr_out, wi_out, vs_out,
-               n_int);
-
     size_t a_size = static_cast<int64_t>(n) * static_cast<int64_t>(n) * sizeof(T);
     if (a_out != a_in) {
         std::memcpy(a_out, a_in, static_cast<int64_t>(b) * a_size);
     }
 
-    for (int i = 0; i < b; ++i) {
-        *info = fn(corder, jobvs, sort, select, n_int, a_out, n_int, sdim_out, wr_out, wi_out,
-                   vs_out, n_int);
+    ParallelForBatch(b, n * n, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            T *a = a_out + i * n * n;
+            T *vs = vs_out + i * n * n;
+            T *wr = wr_out + i * n;
+            T *wi = wi_out + i * n;
+            info[i] = fn(corder, jobvs, sort, select, n_int, a, n_int, sdim_out + i, wr, wi, vs,
+                         n_int);
 #ifdef USE_ABSEIL_LIB
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(a_out, a_size);
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(sdim_out, sizeof(int));
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(wr_out, sizeof(T) * n);
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(wi_out, sizeof(T) * n);
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vs_out, sizeof(T) * n * n);
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(info, sizeof(int));
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(a, a_size);
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(sdim_out + i, sizeof(int));
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(wr, sizeof(T) * n);
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(wi, sizeof(T) * n);
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vs, sizeof(T) * n * n);
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(info + i, sizeof(int));
 #endif
-
-        a_in += n * n;
-        a_out += n * n;
-        wr_out += n;
-        wi_out += n;
-        vs_out += n * n;
-        ++info;
-        ++sdim_out;
-    }
+        }
+    });
 }
 
 template <typename T> typename ComplexGees<T>::FnType *ComplexGees<T>::fn = nullptr;
@@ -789,31 +938,26 @@ void ComplexGees<T>::Kernel(void *out_tuple, void **data, XlaCustomCallStatus *)
 
     constexpr int corder = LAPACK_ROW_MAJOR;
 
-    *info = fn(corder, jobvs, sort, select, n_int, a_out, n_int, sdim_out, w_out, vs_out, n_int);
-
     if (a_out != a_in) {
         std::memcpy(a_out, a_in,
                     static_cast<int64_t>(b) * static_cast<int64_t>(n) * static_cast<int64_t>(n) *
                         sizeof(T));
     }
 
-    for (int i = 0; i < b; ++i) {
-        *info =
-            fn(corder, jobvs, sort, select, n_int, a_out, n_int, sdim_out, w_out, vs_out, n_int);
+    ParallelForBatch(b, n * n, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            T *w = w_out + i * n;
+            T *vs = vs_out + i * n * n;
+            info[i] = fn(corder, jobvs, sort, select, n_int, a_out + i * n * n, n_int,
+                         sdim_out + i, w, vs, n_int);
 #ifdef USE_ABSEIL_LIB
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(w_out, sizeof(T) * n);
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vs_out, sizeof(T) * n * n);
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(info_out, sizeof(int));
-        ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(sdim_out, sizeof(int));
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(w, sizeof(T) * n);
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(vs, sizeof(T) * n * n);
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(info + i, sizeof(int));
+            ABSL_ANNOTATE_MEMORY_IS_INITIALIZED(sdim_out + i, sizeof(int));
 #endif
-
-        a_in += n * n;
-        a_out += n * n;
-        w_out += n;
-        vs_out += n * n;
-        ++info;
-        ++sdim_out;
-    }
+        }
+    });
 }
 
 template struct RealGees<float>;
@@ -849,12 +993,12 @@ template <typename T> void Gehrd<T>::Kernel(void *out_tuple, void **data, XlaCus
 
     constexpr int corder = LAPACK_ROW_MAJOR;
 
-    for (int i = 0; i < batch; ++i) {
-        *info = fn(corder, n, ilo, ihi, a_out, lda, tau);
-        a_out += a_plus;
-        tau += n - 1;
-        ++info;
-    }
+    ParallelForBatch(batch, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            info[i] = fn(corder, n, ilo, ihi, a_out + i * a_plus, lda,
+                         tau + static_cast<int64_t>(i) * (n - 1));
+        }
+    });
 }
 
 template struct Gehrd<float>;
@@ -895,14 +1039,13 @@ template <typename T> void Sytrd<T>::Kernel(void *out_tuple, void **data, XlaCus
 
     const int64_t a_plus = static_cast<int64_t>(lda) * static_cast<int64_t>(n);
 
-    for (int i = 0; i < batch; ++i) {
-        *info = fn(corder, cuplo, n, a_out, lda, d, e, tau);
-        a_out += a_plus;
-        d += n;
-        e += n - 1;
-        tau += n - 1;
-        ++info;
-    }
+    ParallelForBatch(batch, a_plus, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            const int64_t offset = static_cast<int64_t>(i) * (n - 1);
+            info[i] = fn(corder, cuplo, n, a_out + i * a_plus, lda, d + static_cast<int64_t>(i) * n,
+                         e + offset, tau + offset);
+        }
+    });
 }
 
 template struct Sytrd<float>;
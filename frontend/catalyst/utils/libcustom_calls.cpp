@@ -15,6 +15,8 @@
 #include <complex>
 
 #include "jax_cpu_lapack_kernels/lapack_kernels.hpp"
+#include "sample_kernels.hpp"
+#include "sort_kernels.hpp"
 
 #ifdef DEBUG
 #include <iostream>
@@ -110,3 +112,119 @@ DEFINE_LAPACK_FUNC(lapack_ssytrd_ffi, 5, 5, jax::Sytrd<float>)
 DEFINE_LAPACK_FUNC(lapack_dsytrd_ffi, 5, 5, jax::Sytrd<double>)
 DEFINE_LAPACK_FUNC(lapack_chetrd_ffi, 5, 5, jax::Sytrd<std::complex<float>>)
 DEFINE_LAPACK_FUNC(lapack_zhetrd_ffi, 5, 5, jax::Sytrd<std::complex<double>>)
+
+// The sort kernels take the batch size, the row size `n`, the number `k` of sorted elements to
+// return per row, whether to sort in descending order, whether the keys are in total order
+// (floats) or unsigned (integers), the keys and optionally a payload permuted with the keys.
+template <typename T, typename P> void SortKernel(void **dataEncoded, void **resultsEncoded)
+{
+    constexpr size_t numData = std::is_void_v<P> ? 6 : 7;
+    void *data[numData];
+    for (size_t i = 0; i < numData; ++i) {
+        data[i] = reinterpret_cast<EncodedMemref *>(dataEncoded[i])->data_aligned;
+    }
+    void *keysOut = reinterpret_cast<EncodedMemref *>(resultsEncoded[0])->data_aligned;
+
+    auto scalar = [&](size_t i) { return static_cast<int64_t>(*static_cast<int32_t *>(data[i])); };
+    int64_t batch = scalar(0), n = scalar(1), k = scalar(2);
+    bool descending = scalar(3) != 0;
+    bool alternateOrder = scalar(4) != 0;
+    const T *keys = static_cast<const T *>(data[5]);
+    if constexpr (std::is_void_v<P>) {
+        catalyst::sort::Sort<T, int32_t>(batch, n, k, descending, alternateOrder, alternateOrder,
+                                         keys, nullptr, static_cast<T *>(keysOut), nullptr);
+    }
+    else {
+        void *payloadOut = reinterpret_cast<EncodedMemref *>(resultsEncoded[1])->data_aligned;
+        catalyst::sort::Sort<T, P>(batch, n, k, descending, alternateOrder, alternateOrder, keys,
+                                   static_cast<const P *>(data[6]), static_cast<T *>(keysOut),
+                                   static_cast<P *>(payloadOut));
+    }
+}
+
+#define DEFINE_SORT_FUNC(FUNC_NAME, KEY_TYPE, PAYLOAD_TYPE)                                        \
+    extern "C" {                                                                                   \
+    void FUNC_NAME(void **dataEncoded, void **resultsEncoded)                                      \
+    {                                                                                              \
+        DEBUG_MSG(#FUNC_NAME);                                                                     \
+        SortKernel<KEY_TYPE, PAYLOAD_TYPE>(dataEncoded, resultsEncoded);                           \
+    }                                                                                              \
+    }
+
+DEFINE_SORT_FUNC(catalyst_sort_f32, float, void)
+DEFINE_SORT_FUNC(catalyst_sort_f64, double, void)
+DEFINE_SORT_FUNC(catalyst_sort_i32, int32_t, void)
+DEFINE_SORT_FUNC(catalyst_sort_i64, int64_t, void)
+
+DEFINE_SORT_FUNC(catalyst_sort_f32_i32, float, int32_t)
+DEFINE_SORT_FUNC(catalyst_sort_f64_i32, double, int32_t)
+DEFINE_SORT_FUNC(catalyst_sort_i32_i32, int32_t, int32_t)
+DEFINE_SORT_FUNC(catalyst_sort_i64_i32, int64_t, int32_t)
+
+DEFINE_SORT_FUNC(catalyst_sort_f32_i64, float, int64_t)
+DEFINE_SORT_FUNC(catalyst_sort_f64_i64, double, int64_t)
+DEFINE_SORT_FUNC(catalyst_sort_i32_i64, int32_t, int64_t)
+DEFINE_SORT_FUNC(catalyst_sort_i64_i64, int64_t, int64_t)
+
+// The sample kernels take the number of shots and columns of the samples, then the number of bins
+// and the weights of the columns of the counts, or the first and last columns of the parity.
+template <typename T> void SampleCountsKernel(void **dataEncoded, void **resultsEncoded)
+{
+    void *data[5];
+    for (size_t i = 0; i < 5; ++i) {
+        data[i] = reinterpret_cast<EncodedMemref *>(dataEncoded[i])->data_aligned;
+    }
+    void *countsOut = reinterpret_cast<EncodedMemref *>(resultsEncoded[0])->data_aligned;
+
+    auto scalar = [&](size_t i) { return static_cast<int64_t>(*static_cast<int32_t *>(data[i])); };
+    catalyst::samples::Counts<T>(scalar(0), scalar(1), scalar(2),
+                                 static_cast<const int64_t *>(data[3]),
+                                 static_cast<const double *>(data[4]), static_cast<T *>(countsOut));
+}
+
+#define DEFINE_SAMPLE_COUNTS_FUNC(FUNC_NAME, COUNT_TYPE)                                           \
+    extern "C" {                                                                                   \
+    void FUNC_NAME(void **dataEncoded, void **resultsEncoded)                                      \
+    {                                                                                              \
+        DEBUG_MSG(#FUNC_NAME);                                                                     \
+        SampleCountsKernel<COUNT_TYPE>(dataEncoded, resultsEncoded);                               \
+    }                                                                                              \
+    }
+
+DEFINE_SAMPLE_COUNTS_FUNC(catalyst_sample_counts_f32, float)
+DEFINE_SAMPLE_COUNTS_FUNC(catalyst_sample_counts_f64, double)
+DEFINE_SAMPLE_COUNTS_FUNC(catalyst_sample_counts_i32, int32_t)
+DEFINE_SAMPLE_COUNTS_FUNC(catalyst_sample_counts_i64, int64_t)
+
+extern "C" {
+
+void catalyst_sample_parity_f64(void **dataEncoded, void **resultsEncoded)
+{
+    DEBUG_MSG("catalyst_sample_parity_f64");
+    void *data[5];
+    for (size_t i = 0; i < 5; ++i) {
+        data[i] = reinterpret_cast<EncodedMemref *>(dataEncoded[i])->data_aligned;
+    }
+    void *eigenvaluesOut = reinterpret_cast<EncodedMemref *>(resultsEncoded[0])->data_aligned;
+
+    auto scalar = [&](size_t i) { return static_cast<int64_t>(*static_cast<int32_t *>(data[i])); };
+    catalyst::samples::Parities(scalar(0), scalar(1), scalar(2), scalar(3),
+                                static_cast<const double *>(data[4]),
+                                static_cast<double *>(eigenvaluesOut));
+}
+
+void catalyst_sample_parity_sum_f64(void **dataEncoded, void **resultsEncoded)
+{
+    DEBUG_MSG("catalyst_sample_parity_sum_f64");
+    void *data[5];
+    for (size_t i = 0; i < 5; ++i) {
+        data[i] = reinterpret_cast<EncodedMemref *>(dataEncoded[i])->data_aligned;
+    }
+    void *sumOut = reinterpret_cast<EncodedMemref *>(resultsEncoded[0])->data_aligned;
+
+    auto scalar = [&](size_t i) { return static_cast<int64_t>(*static_cast<int32_t *>(data[i])); };
+    *static_cast<double *>(sumOut) = catalyst::samples::ParitySum(
+        scalar(0), scalar(1), scalar(2), scalar(3), static_cast<const double *>(data[4]));
+}
+
+} // extern "C"
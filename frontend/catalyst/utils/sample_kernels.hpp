@@ -0,0 +1,133 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Post-processing kernels for the computational basis samples of `quantum.sample`, whose
+// bitstring histograms, marginal counts and parity statistics the lower-sample-postprocessing
+// pass lowers to custom calls.
+//
+// The samples, of shape (shots, columns), are processed in blocks of shots that stay in the L1
+// cache. Within a block, the bits of each column are combined across the shots of the block by
+// branchless loops without dependencies between shots, which the compiler vectorizes.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace catalyst::samples {
+
+// The number of shots of a block
+constexpr int64_t kBlockSize = 256;
+
+// Histograms of up to this number of bins are accumulated into interleaved copies, so that the
+// increments of consecutive shots with the same bitstring do not wait for each other
+constexpr int64_t kInterleavedMaxBins = 1 << 14;
+constexpr int64_t kNumCopies = 4;
+
+// Count the bitstrings of the `shots` rows of `columns` bits of `samples` into the `bins` entries
+// of `counts`. The bitstring of a shot is the index sum of the `weights` of the columns whose
+// bit is set, e.g. powers of two for the bitstrings of all columns with the first column as the
+// most significant bit, or zero for the columns left out of marginal counts. Bitstrings outside
+// of the bins are not counted.
+template <typename T>
+void Counts(int64_t shots, int64_t columns, int64_t bins, const int64_t *weights,
+            const double *samples, T *counts)
+{
+    const int64_t numCopies = bins <= kInterleavedMaxBins ? kNumCopies : 1;
+    std::vector<int64_t> histogram(numCopies * bins, 0);
+    std::array<int64_t, kBlockSize> indices;
+
+    for (int64_t begin = 0; begin < shots; begin += kBlockSize) {
+        const int64_t size = std::min(kBlockSize, shots - begin);
+        const double *block = samples + begin * columns;
+
+        std::fill_n(indices.begin(), size, 0);
+        for (int64_t c = 0; c < columns; c++) {
+            const int64_t weight = weights[c];
+            if (weight == 0) {
+                continue;
+            }
+            for (int64_t i = 0; i < size; i++) {
+                indices[i] += weight & -static_cast<int64_t>(block[i * columns + c] != 0);
+            }
+        }
+
+        for (int64_t i = 0; i < size; i++) {
+            if (indices[i] < bins) {
+                histogram[(i % numCopies) * bins + indices[i]]++;
+            }
+        }
+    }
+
+    for (int64_t b = 0; b < bins; b++) {
+        int64_t count = 0;
+        for (int64_t copy = 0; copy < numCopies; copy++) {
+            count += histogram[copy * bins + b];
+        }
+        counts[b] = static_cast<T>(count);
+    }
+}
+
+// Compute the parity of the bits of columns [first, last) of each block of shots of `samples`,
+// and pass the start of the block, its size and the parities, 0 for even and 1 for odd, to `fn`.
+template <typename Fn>
+void ForEachParityBlock(int64_t shots, int64_t columns, int64_t first, int64_t last,
+                        const double *samples, Fn &&fn)
+{
+    std::array<uint8_t, kBlockSize> parities;
+    for (int64_t begin = 0; begin < shots; begin += kBlockSize) {
+        const int64_t size = std::min(kBlockSize, shots - begin);
+        const double *block = samples + begin * columns;
+
+        std::fill_n(parities.begin(), size, 0);
+        for (int64_t c = first; c < last; c++) {
+            for (int64_t i = 0; i < size; i++) {
+                parities[i] ^= static_cast<uint8_t>(block[i * columns + c] != 0);
+            }
+        }
+        fn(begin, size, parities.data());
+    }
+}
+
+// Write the eigenvalue of the parity observable of columns [first, last) at each shot of
+// `samples` to `eigenvalues`, i.e. 1 for an even and -1 for an odd number of set bits.
+inline void Parities(int64_t shots, int64_t columns, int64_t first, int64_t last,
+                     const double *samples, double *eigenvalues)
+{
+    ForEachParityBlock(shots, columns, first, last, samples,
+                       [&](int64_t begin, int64_t size, const uint8_t *parities) {
+                           for (int64_t i = 0; i < size; i++) {
+                               eigenvalues[begin + i] = 1.0 - 2.0 * parities[i];
+                           }
+                       });
+}
+
+// The sum over the shots of `samples` of the eigenvalues of the parity observable of columns
+// [first, last), whose mean is the expectation value of the observable.
+inline double ParitySum(int64_t shots, int64_t columns, int64_t first, int64_t last,
+                        const double *samples)
+{
+    int64_t odd = 0;
+    ForEachParityBlock(shots, columns, first, last, samples,
+                       [&](int64_t, int64_t size, const uint8_t *parities) {
+                           for (int64_t i = 0; i < size; i++) {
+                               odd += parities[i];
+                           }
+                       });
+    return static_cast<double>(shots - 2 * odd);
+}
+
+} // namespace catalyst::samples
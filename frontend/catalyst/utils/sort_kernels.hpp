@@ -0,0 +1,145 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Sort kernels for the single-key numeric sorts of `stablehlo.sort`, e.g. `jnp.sort`,
+// `jnp.argsort` and `lax.top_k`, which the stablehlo-legalize-sort pass lowers to custom calls.
+//
+// The keys are mapped to unsigned integers with the same order, which are sorted with a stable
+// least-significant-digit radix sort, or partially sorted when only the first `k` elements of
+// each row are needed.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace catalyst::sort {
+
+// Below this size, rows are sorted by comparison
+constexpr int64_t kRadixSortMinSize = 256;
+
+// The unsigned integer of the same size as T
+template <typename T>
+using RadixKey = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+
+// Map `value` to an unsigned integer in the same order. Floats are ordered by their total order,
+// or by their numeric order if `totalOrder` is false, in which case -0.0 and +0.0 are equal and
+// all NaNs are equal and greater than the other values, as in `jnp.sort`. Integers are signed,
+// or unsigned if `isUnsigned` is true.
+template <typename T> RadixKey<T> ToRadixKey(T value, bool totalOrder, bool isUnsigned)
+{
+    using U = RadixKey<T>;
+    constexpr U signBit = U{1} << (8 * sizeof(T) - 1);
+    if constexpr (std::is_floating_point_v<T>) {
+        if (!totalOrder && value == T{0}) {
+            value = T{0};
+        }
+        else if (!totalOrder && std::isnan(value)) {
+            value = std::numeric_limits<T>::quiet_NaN();
+        }
+        U bits = std::bit_cast<U>(value);
+        return (bits & signBit) ? ~bits : bits | signBit;
+    }
+    else {
+        U bits = static_cast<U>(value);
+        return isUnsigned ? bits : bits ^ signBit;
+    }
+}
+
+// Sort `keys` stably and permute `indices` accordingly, using `keysTmp` and `indicesTmp` of the
+// same size as scratch space.
+template <typename U>
+void RadixSort(std::vector<U> &keys, std::vector<uint32_t> &indices, std::vector<U> &keysTmp,
+               std::vector<uint32_t> &indicesTmp)
+{
+    const size_t n = keys.size();
+    for (unsigned shift = 0; shift < 8 * sizeof(U); shift += 8) {
+        std::array<size_t, 256> counts{};
+        for (U key : keys) {
+            counts[(key >> shift) & 0xff]++;
+        }
+        // All keys share this digit
+        if (counts[(keys[0] >> shift) & 0xff] == n) {
+            continue;
+        }
+        size_t offset = 0;
+        for (size_t &count : counts) {
+            offset += std::exchange(count, offset);
+        }
+        for (size_t i = 0; i < n; i++) {
+            size_t dst = counts[(keys[i] >> shift) & 0xff]++;
+            keysTmp[dst] = keys[i];
+            indicesTmp[dst] = indices[i];
+        }
+        keys.swap(keysTmp);
+        indices.swap(indicesTmp);
+    }
+}
+
+// Sort the `batch` rows of `n` elements of `keys`, and permute the rows of `payload` accordingly
+// if not null, writing the first `k` elements of each sorted row to `keysOut` and `payloadOut`.
+// The sort is stable, in ascending order or descending order if `descending` is true.
+template <typename T, typename P>
+void Sort(int64_t batch, int64_t n, int64_t k, bool descending, bool totalOrder, bool isUnsigned,
+          const T *keys, const P *payload, T *keysOut, P *payloadOut)
+{
+    using U = RadixKey<T>;
+    std::vector<U> radixKeys(n), radixKeysTmp;
+    std::vector<uint32_t> indices(n), indicesTmp;
+
+    for (int64_t b = 0; b < batch; b++) {
+        const T *rowKeys = keys + b * n;
+        for (int64_t i = 0; i < n; i++) {
+            U key = ToRadixKey(rowKeys[i], totalOrder, isUnsigned);
+            radixKeys[i] = descending ? ~key : key;
+        }
+        std::iota(indices.begin(), indices.end(), 0);
+
+        // Comparing the indices of equal keys keeps the sort stable
+        auto less = [&](uint32_t lhs, uint32_t rhs) {
+            return radixKeys[lhs] < radixKeys[rhs] ||
+                   (radixKeys[lhs] == radixKeys[rhs] && lhs < rhs);
+        };
+        if (k < n && k * 8 < n) {
+            std::partial_sort(indices.begin(), indices.begin() + k, indices.end(), less);
+        }
+        else if (n < kRadixSortMinSize) {
+            std::sort(indices.begin(), indices.end(), less);
+        }
+        else {
+            radixKeysTmp.resize(n);
+            indicesTmp.resize(n);
+            RadixSort(radixKeys, indices, radixKeysTmp, indicesTmp);
+        }
+
+        for (int64_t i = 0; i < k; i++) {
+            keysOut[b * k + i] = rowKeys[indices[i]];
+        }
+        if (payload != nullptr) {
+            for (int64_t i = 0; i < k; i++) {
+                payloadOut[b * k + i] = payload[b * n + indices[i]];
+            }
+        }
+    }
+}
+
+} // namespace catalyst::sort
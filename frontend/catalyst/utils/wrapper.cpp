@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <csignal>
+#include <vector>
 
 #include "nanobind/nanobind.h"
 
@@ -94,12 +95,18 @@ const npy_intp *npy_get_strides(char *memref, size_t element_size, size_t rank)
     return npy_strides;
 }
 
-nb::list move_returns(void *memref_array_ptr, nb::object result_desc, nb::object transfer,
-                      nb::dict numpy_arrays)
+/**
+ * Return the results of a compiled function as NumPy arrays, along with whether each of them owns
+ * its buffer, which the runtime transferred to it, as opposed to aliasing an argument or another
+ * result. Owned buffers can be shared with other frameworks without copies, e.g. through DLPack.
+ */
+nb::tuple move_returns(void *memref_array_ptr, nb::object result_desc, nb::object transfer,
+                       nb::dict numpy_arrays)
 {
     nb::list returns;
+    nb::list owned;
     if (result_desc.is_none()) {
-        return returns;
+        return nb::make_tuple(returns, owned);
     }
 
     auto ctypes = nb::module_::import_("ctypes");
@@ -138,6 +145,7 @@ nb::list move_returns(void *memref_array_ptr, nb::object result_desc, nb::object
             auto array_object =
                 numpy_arrays.attr("__getitem__")(reinterpret_cast<size_t>(memref->allocated));
             returns.append(array_object);
+            owned.append(false);
             continue;
         }
 
@@ -172,6 +180,7 @@ nb::list move_returns(void *memref_array_ptr, nb::object result_desc, nb::object
         }
 
         returns.append(nb::borrow(new_array)); // nb::borrow increments ref count by 1
+        owned.append(true);
 
         // Now we insert the array into the dictionary.
         // This dictionary is a map of the type:
@@ -194,40 +203,83 @@ nb::list move_returns(void *memref_array_ptr, nb::object result_desc, nb::object
         Py_DecRef(pyLong);
         Py_DecRef(new_array);
     }
-    return returns;
+    return nb::make_tuple(returns, owned);
 }
 
-nb::list wrap(nb::object func, nb::tuple py_args, nb::object result_desc, nb::object transfer,
-              nb::dict numpy_arrays)
+/**
+ * Fill the memref descriptors of the NumPy array arguments of a compiled function, without
+ * creating ctypes structures for them. The descriptors are stored contiguously in `descriptors`,
+ * and `pointers` holds the address of each one, which is the layout of the arguments expected by
+ * the C interface of the function. The arrays are also recorded in `numpy_arrays`, by address.
+ */
+void fill_descriptors(nb::list arrays, nb::dict numpy_arrays, std::vector<size_t> &descriptors,
+                      std::vector<void *> &pointers)
 {
-    // Install signal handler to catch user interrupts (e.g. CTRL-C).
-    signal(SIGINT, [](int code) { throw std::runtime_error("KeyboardInterrupt (SIGINT)"); });
+    size_t length = nb::len(arrays);
+    std::vector<size_t> offsets(length);
+    size_t total_size = 0;
+    for (size_t idx = 0; idx < length; idx++) {
+        nb::object array = arrays[idx];
+        if (!PyArray_Check(array.ptr())) {
+            throw std::invalid_argument("Arguments must be NumPy arrays.");
+        }
+        size_t rank = PyArray_NDIM(reinterpret_cast<PyArrayObject *>(array.ptr()));
+        offsets[idx] = total_size;
+        total_size += memref_size_based_on_rank(rank) / sizeof(size_t);
+    }
 
-    nb::list returns;
+    descriptors.assign(total_size, 0);
+    pointers.resize(length);
+    for (size_t idx = 0; idx < length; idx++) {
+        nb::object array = arrays[idx];
+        auto *nparray = reinterpret_cast<PyArrayObject *>(array.ptr());
+        char *memref_i_beginning = reinterpret_cast<char *>(descriptors.data() + offsets[idx]);
+
+        struct memref_beginning_t *memref =
+            reinterpret_cast<struct memref_beginning_t *>(memref_i_beginning);
+        memref->allocated = PyArray_BYTES(nparray);
+        memref->aligned = PyArray_BYTES(nparray);
+        memref->offset = 0;
+
+        size_t rank = PyArray_NDIM(nparray);
+        size_t *sizes = to_sizes(memref_i_beginning, rank);
+        size_t *strides = to_strides(memref_i_beginning, rank);
+        npy_intp element_size = PyArray_ITEMSIZE(nparray);
+        for (size_t dim = 0; dim < rank; dim++) {
+            sizes[dim] = PyArray_DIM(nparray, dim);
+            // numpy strides are in terms of bytes.
+            // memref strides are in terms of elements.
+            strides[dim] = PyArray_STRIDE(nparray, dim) / element_size;
+        }
+        pointers[idx] = memref_i_beginning;
 
-    size_t length = nb::cast<size_t>(py_args.attr("__len__")());
-    if (length != 2) {
-        throw std::invalid_argument("Invalid number of arguments.");
+        numpy_arrays[nb::int_(reinterpret_cast<size_t>(memref->allocated))] = array;
     }
+}
+
+nb::tuple wrap(nb::object func, nb::object result, nb::list arrays, nb::object result_desc,
+               nb::object transfer, nb::dict numpy_arrays)
+{
+    // Install signal handler to catch user interrupts (e.g. CTRL-C).
+    signal(SIGINT, [](int code) { throw std::runtime_error("KeyboardInterrupt (SIGINT)"); });
 
     auto ctypes = nb::module_::import_("ctypes");
     using f_ptr_t = void (*)(void *, void *);
     f_ptr_t f_ptr = *reinterpret_cast<f_ptr_t *>(nb::cast<size_t>(ctypes.attr("addressof")(func)));
 
-    auto value0 = py_args.attr("__getitem__")(0);
-    void *value0_ptr =
-        *reinterpret_cast<void **>(nb::cast<size_t>(ctypes.attr("addressof")(value0)));
-    auto value1 = py_args.attr("__getitem__")(1);
-    void *value1_ptr =
-        *reinterpret_cast<void **>(nb::cast<size_t>(ctypes.attr("addressof")(value1)));
+    void *result_ptr =
+        *reinterpret_cast<void **>(nb::cast<size_t>(ctypes.attr("addressof")(result)));
+
+    std::vector<size_t> descriptors;
+    std::vector<void *> pointers;
+    fill_descriptors(arrays, numpy_arrays, descriptors, pointers);
+    void *args_ptr = pointers.empty() ? nullptr : pointers.data();
 
     {
         nb::gil_scoped_release lock;
-        f_ptr(value0_ptr, value1_ptr);
+        f_ptr(result_ptr, args_ptr);
     }
-    returns = move_returns(value0_ptr, result_desc, transfer, numpy_arrays);
-
-    return returns;
+    return move_returns(result_ptr, result_desc, transfer, numpy_arrays);
 }
 
 NB_MODULE(wrapper, m)
@@ -235,8 +287,9 @@ NB_MODULE(wrapper, m)
     m.doc() = "wrapper module";
     // We have to annotate all the arguments to `wrap` to allow `result_desc` to be None
     // See https://nanobind.readthedocs.io/en/latest/functions.html#none-arguments
-    m.def("wrap", &wrap, "A wrapper function.", nb::arg("func"), nb::arg("py_args"),
-          nb::arg("result_desc").none(), nb::arg("transfer"), nb::arg("numpy_arrays"));
+    m.def("wrap", &wrap, "A wrapper function.", nb::arg("func"), nb::arg("result"),
+          nb::arg("arrays"), nb::arg("result_desc").none(), nb::arg("transfer"),
+          nb::arg("numpy_arrays"));
     int retval = _import_array();
     bool success = retval >= 0;
     if (!success) {
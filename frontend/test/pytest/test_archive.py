@@ -0,0 +1,99 @@
+# Copyright 2026 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Test saving compiled functions to ahead-of-time archives and loading them back."""
+
+import jax.numpy as jnp
+import numpy as np
+import pennylane as qml
+import pytest
+
+from catalyst import load_archive, qjit, save_archive
+
+
+class TestArchive:
+    """Test ahead-of-time archives of compiled functions."""
+
+    def test_circuit(self, backend, tmp_path):
+        """Test that a loaded circuit computes the same results as the compiled one."""
+
+        @qjit
+        @qml.qnode(qml.device(backend, wires=2))
+        def circuit(x):
+            qml.RX(x, wires=0)
+            qml.CNOT(wires=[0, 1])
+            return qml.expval(qml.PauliZ(1)), qml.probs()
+
+        path = tmp_path / "circuit.qjit"
+        save_archive(circuit, path, 0.5)
+        loaded = load_archive(path)
+
+        expval, probs = loaded(0.5)
+        expected_expval, expected_probs = circuit(0.5)
+        assert np.allclose(expval, expected_expval)
+        assert np.allclose(probs, expected_probs)
+
+    def test_pytrees_and_promotion(self, tmp_path):
+        """Test that PyTrees are restored and that arguments are promoted to the signature."""
+
+        @qjit
+        def f(x, y):
+            return {"sum": x + y["a"], "prod": x * y["b"]}
+
+        path = tmp_path / "f.qjit"
+        save_archive(f, path, jnp.array([1.0, 2.0]), {"a": 1.0, "b": 2.0})
+        loaded = load_archive(path)
+
+        result = loaded(jnp.array([1, 2]), {"a": 1, "b": 2})
+        assert np.allclose(result["sum"], [2.0, 3.0])
+        assert np.allclose(result["prod"], [2.0, 4.0])
+
+        with pytest.raises(TypeError, match="do not match the signature"):
+            loaded(jnp.array([1.0, 2.0, 3.0]), {"a": 1.0, "b": 2.0})
+
+    def test_static_arguments(self, tmp_path):
+        """Test that an archive only accepts the static arguments it was compiled with."""
+
+        @qjit(static_argnums=1)
+        def f(x, n):
+            return x * n
+
+        path = tmp_path / "f.qjit"
+        save_archive(f, path, 2.0, 3)
+        loaded = load_archive(path)
+
+        assert loaded(2.0, 3) == 6.0
+        with pytest.raises(TypeError, match="do not match the signature"):
+            loaded(2.0, 4)
+
+    def test_current_compilation(self, tmp_path):
+        """Test saving the current compilation of a function without arguments."""
+
+        @qjit
+        def f(x: float):
+            return x**2
+
+        path = tmp_path / "f.qjit"
+        save_archive(f, path)
+
+        assert load_archive(path)(3.0) == 9.0
+
+    def test_invalid_archive(self, tmp_path):
+        """Test that loading a file that is not an archive fails."""
+
+        path = tmp_path / "invalid.qjit"
+        path.write_bytes(b"not an archive" * 10)
+
+        with pytest.raises(ValueError, match="is not a Catalyst archive"):
+            load_archive(path)
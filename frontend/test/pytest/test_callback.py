@@ -13,6 +13,7 @@
 # limitations under the License.
 """Test callbacks"""
 
+import ctypes
 from collections.abc import Sequence
 from functools import partial
 
@@ -22,7 +23,7 @@ import numpy as np
 import pennylane as qml
 import pytest
 
-from catalyst import accelerate, debug, grad, jacobian, pure_callback, qjit
+from catalyst import accelerate, debug, for_loop, grad, jacobian, pure_callback, qjit
 from catalyst.api_extensions.callbacks import base_callback
 from catalyst.utils.exceptions import DifferentiableCompileError
 from catalyst.utils.patching import Patcher
@@ -1295,6 +1296,76 @@ def test_different_shapes():
     assert np.allclose(wrapper(arg), wrapper_jax(arg))
 
 
+@pytest.mark.parametrize("order", ["C", "F"])
+def test_strided_array_out(order):
+    """Test results that are or are not laid out contiguously in row-major order."""
+
+    @pure_callback
+    def transpose(x) -> jax.ShapeDtypeStruct((3, 2), jnp.float64):
+        return np.asarray(x).T.copy(order=order)
+
+    @qjit
+    def f(x):
+        return transpose(x)
+
+    x = jnp.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]])
+    assert np.allclose(f(x), x.T)
+
+
+def test_native_callback():
+    """Test a pure callback implemented by a C function pointer."""
+
+    class ScalarMemref(ctypes.Structure):
+        """Descriptor of a rank 0 memref of doubles."""
+
+        _fields_ = [
+            ("allocated", ctypes.POINTER(ctypes.c_double)),
+            ("aligned", ctypes.POINTER(ctypes.c_double)),
+            ("offset", ctypes.c_int64),
+        ]
+
+    signature = ctypes.CFUNCTYPE(
+        None,
+        ctypes.c_int64,
+        ctypes.POINTER(ctypes.c_void_p),
+        ctypes.c_int64,
+        ctypes.POINTER(ctypes.c_void_p),
+    )
+
+    @signature
+    def double(argc, args, retc, results):
+        assert argc == 1 and retc == 1
+        x = ctypes.cast(args[0], ctypes.POINTER(ScalarMemref)).contents
+        y = ctypes.cast(results[0], ctypes.POINTER(ScalarMemref)).contents
+        y.aligned[y.offset] = 2 * x.aligned[x.offset]
+
+    @qjit
+    def f(x):
+        return pure_callback(double, float)(x)
+
+    assert np.allclose(f(0.25), 0.5)
+
+
+def test_callback_in_for_loop():
+    """Test a callback called in every iteration of a loop, which may be batched."""
+
+    @pure_callback
+    def powers(x) -> jax.ShapeDtypeStruct((2,), jnp.float64):
+        return np.array([x, x**2])
+
+    @qjit
+    def f(x):
+        @for_loop(0, 4, 1)
+        def loop(i, acc):
+            return acc + powers(x + i)
+
+        return loop(jnp.zeros(2))
+
+    x = 0.5
+    expected = sum(np.array([x + i, (x + i) ** 2]) for i in range(4))
+    assert np.allclose(f(x), expected)
+
+
 def test_multiply_two_matrices_to_get_something_with_different_dimensions():
     """matrix multiplication with constant"""
 
@@ -153,6 +153,75 @@ class TestCompilerOptions:
         assert "--keep-intermediate" in flags
         assert "--save-ir-after-each=pass" in flags
 
+    def test_options_to_cli_flags_runtime_bitcode(self, tmp_path, monkeypatch):
+        """Test that _options_to_cli_flags links the runtime bitcode when it is available."""
+        monkeypatch.setattr("catalyst.compiler.get_lib_path", lambda *_: str(tmp_path))
+        rt_bitcode = str(tmp_path / "rt_capi.bc")
+
+        assert ("--runtime-bitcode", rt_bitcode) not in _options_to_cli_flags(CompileOptions())
+
+        (tmp_path / "rt_capi.bc").touch()
+        assert ("--runtime-bitcode", rt_bitcode) in _options_to_cli_flags(CompileOptions())
+        flags = _options_to_cli_flags(CompileOptions(lower_to_llvm=False))
+        assert ("--runtime-bitcode", rt_bitcode) not in flags
+
+    def test_options_to_cli_flags_cache_dir(self, tmp_path, monkeypatch):
+        """Test that _options_to_cli_flags enables the compilation cache from the environment."""
+        cache_dir = str(tmp_path)
+
+        monkeypatch.delenv("CATALYST_CACHE_DIR", raising=False)
+        assert ("--cache-dir", cache_dir) not in _options_to_cli_flags(CompileOptions())
+
+        monkeypatch.setenv("CATALYST_CACHE_DIR", cache_dir)
+        flags = _options_to_cli_flags(CompileOptions())
+        assert ("--cache-dir", cache_dir) in flags
+        assert "--incremental" in flags
+        flags = _options_to_cli_flags(CompileOptions(pass_plugins={"plugin.so"}))
+        assert ("--cache-dir", cache_dir) in flags
+        assert "--incremental" in flags
+
+    def test_options_to_cli_flags_codegen_threads(self, monkeypatch):
+        """Test that _options_to_cli_flags enables parallel code generation from the environment."""
+        monkeypatch.delenv("CATALYST_CODEGEN_THREADS", raising=False)
+        flags = _options_to_cli_flags(CompileOptions())
+        assert "--codegen-threads" not in [flag[0] for flag in flags if isinstance(flag, tuple)]
+
+        monkeypatch.setenv("CATALYST_CODEGEN_THREADS", "8")
+        assert ("--codegen-threads", "8") in _options_to_cli_flags(CompileOptions())
+
+    def test_options_to_cli_flags_target_cpu(self, monkeypatch):
+        """Test that _options_to_cli_flags sets the target CPU and features from the environment."""
+        monkeypatch.delenv("CATALYST_TARGET_CPU", raising=False)
+        monkeypatch.delenv("CATALYST_TARGET_FEATURES", raising=False)
+        flag_names = [flag[0] for flag in _options_to_cli_flags(CompileOptions())]
+        assert "--target-cpu" not in flag_names
+        assert "--target-features" not in flag_names
+
+        monkeypatch.setenv("CATALYST_TARGET_CPU", "native")
+        monkeypatch.setenv("CATALYST_TARGET_FEATURES", "-avx512f")
+        flags = _options_to_cli_flags(CompileOptions())
+        assert ("--target-cpu", "native") in flags
+        assert ("--target-features", "-avx512f") in flags
+
+    def test_options_to_cli_flags_profile(self, tmp_path, monkeypatch):
+        """Test that _options_to_cli_flags enables profile-guided optimization from the
+        environment, with instrumentation taking precedence over the use of a profile."""
+        profile_dir = str(tmp_path)
+        profile = str(tmp_path / "catalyst.profdata")
+        monkeypatch.delenv("CATALYST_PROFILE_GENERATE", raising=False)
+        monkeypatch.delenv("CATALYST_PROFILE_USE", raising=False)
+        flag_names = [flag[0] for flag in _options_to_cli_flags(CompileOptions())]
+        assert "--profile-generate" not in flag_names
+        assert "--profile-use" not in flag_names
+
+        monkeypatch.setenv("CATALYST_PROFILE_USE", profile)
+        assert ("--profile-use", profile) in _options_to_cli_flags(CompileOptions())
+
+        monkeypatch.setenv("CATALYST_PROFILE_GENERATE", profile_dir)
+        flags = _options_to_cli_flags(CompileOptions())
+        assert ("--profile-generate", profile_dir) in flags
+        assert ("--profile-use", profile) not in flags
+
 
 class TestCompilerWarnings:
     """Test compiler's warning messages."""
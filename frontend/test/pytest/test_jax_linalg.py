@@ -391,6 +391,49 @@ class TestCholesky:
         assert jnp.allclose(U_obs, U_exp)
 
 
+class TestEigh:
+    """Test results of jax.numpy.linalg.eigh are numerically correct when qjit compiled.
+
+    See: https://jax.readthedocs.io/en/latest/_autosummary/jax.numpy.linalg.eigh.html
+
+    The eigendecomposition of a real symmetric matrix S is a factorization of the form
+
+        S = V diag(w) V^T,
+
+    where w are the eigenvalues of S in ascending order and V is an orthogonal matrix whose
+    columns are the corresponding eigenvectors. Small matrices are decomposed inline by the
+    compiler, and larger ones by LAPACK.
+    """
+
+    @pytest.mark.parametrize(
+        "A",
+        [
+            jnp.array(MatrixGenerator.random_real_symmetric_matrix(2, seed=11)),
+            jnp.array(MatrixGenerator.random_real_symmetric_matrix(3, seed=12)),
+            jnp.array(MatrixGenerator.random_real_symmetric_matrix(8, seed=13)),
+            jnp.array(MatrixGenerator.random_real_symmetric_matrix(9, seed=14)),
+            jnp.array(
+                [MatrixGenerator.random_real_symmetric_matrix(3, seed=seed) for seed in range(4)]
+            ),
+        ],
+    )
+    def test_eigh_numerical(self, A):
+        """Test basic numerical correctness of jax.numpy.linalg.eigh for real symmetric
+        matrices of various sizes, and for a batch of matrices.
+        """
+
+        @qjit
+        def f(X):
+            return jnp.linalg.eigh(X)
+
+        w_obs, V_obs = f(A)
+        w_exp, _ = jnp.linalg.eigh(A)
+
+        A_obs = (V_obs * w_obs[..., None, :]) @ jnp.swapaxes(V_obs, -1, -2)
+        assert jnp.allclose(w_obs, w_exp)
+        assert jnp.allclose(A_obs, A)
+
+
 class TestExpm:
     """Test results of jax.scipy.linalg.expm are numerically correct when qjit compiled.
 
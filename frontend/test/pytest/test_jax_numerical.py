@@ -14,6 +14,7 @@
 
 """Test that numerical jax functions produce correct results when compiled with catalyst.qjit"""
 
+import jax
 import numpy as np
 import pennylane as qml
 import pytest
@@ -79,5 +80,52 @@ class TestArgsortNumerical:
         assert np.allclose(observed, expected)
 
 
+class TestSortNumerical:
+    """Test that single-key numeric sorts, which are lowered to the sort kernels of the custom
+    calls library, are correct when qjit compiled"""
+
+    @pytest.mark.parametrize("dtype", [jnp.float32, jnp.float64, jnp.int32, jnp.int64])
+    @pytest.mark.parametrize("shape", [(7,), (1000,), (3, 300)])
+    def test_sort(self, dtype, shape):
+        """Test jnp.sort and jnp.argsort on small rows, sorted by comparison, and large rows,
+        sorted by a radix sort"""
+        inp = jnp.array(np.random.default_rng(0).integers(-50, 50, shape), dtype=dtype)
+
+        @qjit
+        def f(x):
+            return jnp.sort(x), jnp.argsort(x, stable=True)
+
+        observed = f(inp)
+        expected = (jnp.sort(inp), jnp.argsort(inp, stable=True))
+
+        assert np.array_equal(observed[0], expected[0])
+        assert np.array_equal(observed[1], expected[1])
+
+    def test_sort_negative_zeros(self):
+        """Test that -0.0 and 0.0 sort as equal values, keeping their order"""
+        inp = jnp.array([0.0, -1.0, -0.0, 0.0, -0.0] * 100)
+
+        @qjit
+        def f(x):
+            return jnp.argsort(x, stable=True)
+
+        assert np.array_equal(f(inp), jnp.argsort(inp, stable=True))
+
+    @pytest.mark.parametrize("k", [1, 5, 500])
+    def test_top_k(self, k):
+        """Test lax.top_k, for which only the first k elements of the rows are sorted"""
+        inp = jnp.array(np.random.default_rng(0).normal(size=(4, 1000)))
+
+        @qjit
+        def f(x):
+            return jax.lax.top_k(x, k)
+
+        observed = f(inp)
+        expected = jax.lax.top_k(inp, k)
+
+        assert np.allclose(observed[0], expected[0])
+        assert np.array_equal(observed[1], expected[1])
+
+
 if __name__ == "__main__":
     pytest.main(["-x", __file__])
@@ -616,6 +616,30 @@ class TestClassicalCompilation:
         assert addc.mlir
         assert addi(a, b) == addc(a, b)
 
+    def test_strided_array_arguments(self):
+        """Test arguments that are not laid out contiguously in row-major order."""
+
+        @qjit
+        def f(x, y):
+            return x @ y
+
+        x = np.arange(6.0).reshape(2, 3)
+        y = np.arange(12.0).reshape(4, 3)[::-1].T
+        assert np.allclose(f(x, y), x @ y)
+
+    def test_dlpack_arguments_and_results(self):
+        """Test JAX arrays passed through DLPack, and results that alias an argument or not."""
+
+        @qjit
+        def f(x):
+            return x, 2 * x
+
+        x = jnp.arange(4.0)
+        same, doubled = f(x)
+        assert isinstance(same, jax.Array) and isinstance(doubled, jax.Array)
+        assert np.allclose(same, x)
+        assert np.allclose(doubled, 2 * x)
+
 
 class TestArraysInHamiltonian:
     """Test arrays in ``qml.Hamiltonian``."""
@@ -84,6 +84,50 @@ class TestDefaultPipeline:
         angle = 0.5
         assert np.allclose(circuit_ref(angle), circuit_default_pipeline(angle))
 
+    def test_function_local_passes_are_nested(self):
+        """Test that the function-local passes of the default pipeline are nested on functions, so
+        that they run on all functions in parallel, and that disable-assertion is only run when
+        assertions are disabled."""
+        stages = dict(CompileOptions().get_stages())
+        assert "func.func(lower-pbc-init-ops)" in stages["QuantumCompilationStage"]
+        assert "func.func(disable-assertion)" in stages["QuantumCompilationStage"]
+        assert "func.func(detensorize-scf)" in stages["HLOLoweringStage"]
+
+        stages = dict(CompileOptions(disable_assertions=False).get_stages())
+        assert not any("disable-assertion" in p for p in stages["QuantumCompilationStage"])
+
+    def test_multithreaded_compilation(self):
+        """Test that a program of several functions gives the same results when its function-local
+        passes run in parallel, and when they run on a single thread because the intermediate
+        files are kept."""
+        dev = qml.device("lightning.qubit", wires=2)
+
+        @qml.qnode(dev)
+        def first(angle: float):
+            qml.RX(angle, wires=0)
+            return qml.expval(qml.PauliZ(0))
+
+        @qml.qnode(dev)
+        def second(angle: float):
+            qml.RY(angle, wires=1)
+            return qml.expval(qml.PauliZ(1))
+
+        def workflow(angle: float):
+            @qml.for_loop(0, 3, 1)
+            def loop(i, total):
+                return total + first(angle * i) * second(angle + i)
+
+            return loop(0.0)
+
+        parallel = qjit(workflow)
+        sequential = qjit(workflow, keep_intermediate=True)
+        # Create tmp workspaces for intermediates to avoid CI race conditions
+        sequential.use_cwd_for_workspace = False
+
+        angle = 0.3
+        assert np.allclose(parallel(angle), sequential(angle))
+        sequential.workspace.cleanup()
+
 
 class TestPassInsertion:
     """Test insertion of a pass into an existing pass pipeline."""
@@ -85,6 +85,41 @@ def test_matrix_list_index_left():
     assert np.allclose(res, jnp.array([[1, 1, 2], [1, 1, 2], [1, 1, 2]]))
 
 
+def test_one_hot():
+    """Test one-hot updates of a zero vector."""
+
+    @qjit
+    def one_hot(i: int):
+        return jnp.zeros(5).at[i].set(1.0)
+
+    assert np.allclose(one_hot(3), [0, 0, 0, 1, 0])
+
+
+def test_segment_sum():
+    """Test sums of the rows of a matrix over segments given by indices which are neither unique
+    nor sorted."""
+
+    data = jnp.arange(12, dtype=float).reshape(6, 2)
+    segment_ids = jnp.array([2, 0, 2, 1, 0, 2])
+
+    def segment_sum(data, segment_ids):
+        return jax.ops.segment_sum(data, segment_ids, num_segments=3)
+
+    res = qjit(segment_sum)(data, segment_ids)
+    assert np.allclose(res, segment_sum(data, segment_ids))
+
+
+def test_add_out_of_bounds():
+    """Test that updates of indices which are out of bounds are dropped, like in JAX."""
+
+    def add(x, indices):
+        return x.at[indices].add(1.0, mode="drop")
+
+    x = jnp.zeros(4)
+    indices = jnp.array([1, 7, 1, 3])
+    assert np.allclose(qjit(add)(x, indices), add(x, indices))
+
+
 def test_gather_derivative():
     """Test the derivative of indexing."""
 
@@ -99,19 +99,19 @@ class TestShotVector:
             (lambda wires: qml.probs(wires=wires), "ProbabilityMP"),
         ],
     )
-    @pytest.mark.parametrize("mcm_method", ["single-branch-statistics", "one-shot"])
-    def test_shot_vector_with_different_measurement(self, measurement, mcm_method):
-        """Test a NotImplementedError is raised when using a shot-vector with a measurement that is not qml.sample()"""
+    def test_shot_vector_with_different_measurement(self, measurement):
+        """Test a NotImplementedError is raised when using a shot-vector with the one-shot method
+        and a measurement that is not qml.sample()"""
 
         dev = qml.device("lightning.qubit", wires=1)
 
         @qml.set_shots(((3, 4)))
-        @qml.qnode(dev, mcm_method=mcm_method)
+        @qml.qnode(dev, mcm_method="one-shot")
         def circuit():
             qml.Hadamard(0)
             return measurement[0](0)
 
-        if measurement[1] == "VarianceMP" and mcm_method == "one-shot":
+        if measurement[1] == "VarianceMP":
             with pytest.raises(
                 NotImplementedError, match=r"qml.var\(\) cannot be used on observables"
             ):
@@ -122,6 +122,51 @@ class TestShotVector:
             ):
                 qjit(circuit)()
 
+    @pytest.mark.parametrize(
+        "measurement, expected",
+        [
+            (lambda: qml.expval(qml.Z(0)), -1.0),
+            (lambda: qml.expval(qml.Z(0) @ qml.Z(1) + 0.5 * qml.Z(1)), -0.5),
+            (lambda: qml.var(qml.Z(0)), 0.0),
+            (lambda: qml.probs(wires=[0, 1]), [0.0, 0.0, 1.0, 0.0]),
+        ],
+    )
+    def test_shot_vector_with_sampled_measurement(self, measurement, expected):
+        """Test expectation values, variances and probabilities over a shot-vector, which are
+        computed from the samples of a single sampling pass"""
+
+        dev = qml.device("lightning.qubit", wires=2)
+
+        @qjit
+        @qml.set_shots(((3, 4), 10))
+        @qml.qnode(dev, mcm_method="single-branch-statistics")
+        def circuit():
+            qml.X(0)
+            return measurement()
+
+        res = circuit()
+        assert type(res) == tuple
+        assert len(res) == 5
+        for entry in res:
+            assert jnp.allclose(entry, jnp.array(expected))
+
+    def test_shot_vector_with_non_diagonal_observable(self):
+        """Test a NotImplementedError is raised for the expectation value over a shot-vector of
+        an observable that is not diagonal in the computational basis"""
+
+        dev = qml.device("lightning.qubit", wires=1)
+
+        @qml.set_shots(((3, 4)))
+        @qml.qnode(dev, mcm_method="single-branch-statistics")
+        def circuit():
+            qml.Hadamard(0)
+            return qml.expval(qml.X(0))
+
+        with pytest.raises(
+            NotImplementedError, match="measurement process does not support shot-vectors"
+        ):
+            qjit(circuit)()
+
     def test_shot_vector_with_complex_container_sample(self):
         """Test shot-vector with complex container sample"""
 
@@ -0,0 +1,64 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/JSON.h"
+
+#include "Catalyst/Analysis/ResourceResult.h"
+
+namespace catalyst {
+
+// GateDurationTable holds the duration of each gate of a device, in arbitrary but consistent
+// units (e.g. ns). Gates without an entry take the default duration.
+struct GateDurationTable {
+    llvm::StringMap<double> durations;
+
+    double defaultDuration = 1.0;
+
+    // duration of the gate `name`
+    double lookup(llvm::StringRef name) const;
+
+    // parse entries of the form "NAME=DURATION"
+    static llvm::Expected<GateDurationTable> parse(llvm::ArrayRef<std::string> entries,
+                                                   double defaultDuration = 1.0);
+};
+
+// CostEstimate holds the estimated cost of executing a function on a device.
+struct CostEstimate {
+    // duration of a single shot, assuming the gates are executed one after the other
+    double shotDuration = 0;
+
+    // number of shots, 0 for an analytic execution
+    int64_t shots = 0;
+
+    // duration of all shots (an analytic execution costs a single shot)
+    double totalDuration = 0;
+
+    // memory of a complex128 state vector over all qubits, saturated at INT64_MAX
+    int64_t stateVectorBytes = 0;
+
+    llvm::json::Object toJson() const;
+};
+
+// estimate the cost of a function from its resource counts and the gate durations of a device
+CostEstimate estimateCost(const ResourceResult &result, const GateDurationTable &table,
+                          int64_t shots = 0);
+
+} // namespace catalyst
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/StringMap.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/IR/Operation.h"
@@ -52,10 +53,17 @@ class ResourceAnalysis {
     // name of the entry function (first function pass detects), empty if none
     std::string entryFuncName;
 
+    // values of the induction variables of the loops being enumerated
+    llvm::DenseMap<Value, int64_t> inductionValues;
+
+    // remaining number of loop iterations that may be enumerated
+    int64_t enumerationBudget = 1 << 16;
+
     // analyze a region and accumulate results
     void analyzeRegion(Region &region, ResourceResult &result, bool isAdjoint);
 
     void analyzeForLoop(scf::ForOp forOp, ResourceResult &result, bool isAdjoint);
+    bool bodyDependsOnInductionVar(scf::ForOp forOp);
     void analyzeWhileLoop(scf::WhileOp whileOp, ResourceResult &result, bool isAdjoint);
     void analyzeIfOp(scf::IfOp ifOp, ResourceResult &result, bool isAdjoint);
     void analyzeIndexSwitchOp(scf::IndexSwitchOp switchOp, ResourceResult &result, bool isAdjoint);
@@ -52,6 +52,7 @@ bool isMlirAsyncRuntimeCreateValue(LLVM::LLVMFuncOp funcOp);
 bool isMlirAsyncRuntimeCreateToken(LLVM::LLVMFuncOp funcOp);
 bool isMlirAsyncRuntimeIsTokenError(LLVM::LLVMFuncOp funcOp);
 bool isMlirAsyncRuntimeIsValueError(LLVM::LLVMFuncOp funcOp);
+bool isMlirAsyncRuntimeExecute(LLVM::LLVMFuncOp funcOp);
 bool callsMlirAsyncRuntimeCreateValue(LLVM::CallOp callOp);
 bool callsMlirAsyncRuntimeCreateToken(LLVM::CallOp callOp);
 bool callsMlirAsyncRuntimeCreateToken(Operation *possibleCall);
@@ -59,6 +60,7 @@ bool callsMlirAsyncRuntimeIsTokenError(LLVM::CallOp callOp);
 bool callsMlirAsyncRuntimeIsValueError(LLVM::CallOp callOp);
 bool callsMlirAsyncRuntimeIsTokenError(Operation *possibleCall);
 bool callsMlirAsyncRuntimeIsValueError(Operation *possibleCall);
+bool callsMlirAsyncRuntimeExecute(LLVM::CallOp callOp);
 bool hasAbortInBlock(Block *block);
 bool hasPutsInBlock(Block *block);
 
@@ -71,5 +73,6 @@ LLVM::LLVMFuncOp lookupOrCreateUnrecoverableError(OpBuilder &b, ModuleOp moduleO
 LLVM::LLVMFuncOp lookupOrCreateAwaitTokenName(OpBuilder &b, ModuleOp);
 LLVM::LLVMFuncOp lookupOrCreateAwaitValueName(OpBuilder &b, ModuleOp);
 LLVM::LLVMFuncOp lookupOrCreateDropRef(OpBuilder &b, ModuleOp);
+LLVM::LLVMFuncOp lookupOrCreateAsyncExecute(OpBuilder &b, ModuleOp);
 
 }; // namespace AsyncUtils
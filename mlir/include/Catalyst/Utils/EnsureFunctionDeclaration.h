@@ -14,9 +14,15 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/SymbolTable.h"
+
+#include "Catalyst/Utils/RuntimeFunctionAttributes.h"
+
 using namespace mlir;
 
 namespace catalyst {
@@ -48,6 +54,10 @@ OpT ensureFunctionDeclaration(PatternRewriter &rewriter, Operation *op, StringRe
         if (isa<func::FuncOp>(newFunc)) {
             newFunc.setPrivate();
         }
+        // LLVM declarations of the runtime ABI carry its attributes from the start.
+        if constexpr (std::is_same_v<OpT, LLVM::LLVMFuncOp>) {
+            annotateRuntimeFunction(newFunc);
+        }
 
         fnDecl = newFunc;
     }
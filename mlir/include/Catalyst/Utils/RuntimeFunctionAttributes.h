@@ -0,0 +1,244 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringRef.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/IR/Builders.h"
+
+namespace catalyst {
+
+namespace RuntimeFunctionAttributes {
+
+// Bit of an argument mask that selects the last parameter of the function, which is where the
+// gates of the runtime receive their modifiers.
+static constexpr uint32_t lastArg = 1u << 31;
+
+struct Entry {
+    llvm::StringLiteral name;
+    // The function does not free memory that is visible to the program.
+    bool nofree;
+    // The pointer arguments that the function only reads from, and does not retain.
+    uint32_t readonlyArgs;
+    // The pointer arguments that the function writes results to, and does not retain.
+    uint32_t nocaptureArgs;
+};
+
+constexpr uint32_t argMask(std::initializer_list<unsigned> indices)
+{
+    uint32_t mask = 0;
+    for (unsigned index : indices) {
+        mask |= 1u << index;
+    }
+    return mask;
+}
+
+// The attributes of the runtime ABI declared in `runtime/include/RuntimeCAPI.h`. The device
+// handles (QUBIT *, RESULT *, QirArray *) are runtime-owned and left unannotated, except where
+// they are only read. Functions that release runtime memory, abort, or call back into the program
+// are not `nofree`.
+static constexpr Entry table[] = {
+    // clang-format off
+    {"__catalyst__rt__fail_cstr",                    false, argMask({0}),            0},
+    {"__catalyst__rt__initialize",                   true,  argMask({0}),            0},
+    {"__catalyst__rt__device_init",                  false, argMask({0, 1, 2}),      0},
+    {"__catalyst__rt__device_release",               false, 0,                       0},
+    {"__catalyst__rt__device_start_batch",           true,  0,                       0},
+    {"__catalyst__rt__device_end_batch",             true,  0,                       0},
+    {"__catalyst__rt__finalize",                     false, 0,                       0},
+    {"__catalyst__rt__toggle_recorder",              true,  0,                       0},
+    {"__catalyst__rt__toggle_measurement_tree",      true,  0,                       0},
+    {"__catalyst__rt__toggle_shot_rejection",        true,  0,                       0},
+    {"__catalyst__rt__shot_accepted",                true,  0,                       0},
+    {"__catalyst__rt__shot_acceptance_rate",         true,  0,                       0},
+    {"__catalyst__rt__set_tape_checkpoint_interval", true,  0,                       0},
+    {"__catalyst__rt__set_prng_stream",              true,  0,                       0},
+    {"__catalyst__rt__print_state",                  true,  0,                       0},
+    {"__catalyst__rt__print_tensor",                 true,  argMask({0}),            0},
+    {"__catalyst__rt__print_string",                 true,  argMask({0}),            0},
+    {"__catalyst__rt__assert_bool",                  false, argMask({1}),            0},
+    {"__catalyst__rt__perf_counters_begin",          true,  argMask({0}),            0},
+    {"__catalyst__rt__perf_counters_end",            true,  argMask({0}),            0},
+    {"__catalyst__rt__perf_counters_write",          true,  argMask({0}),            0},
+    {"__catalyst__rt__array_get_size_1d",            true,  argMask({0}),            0},
+    {"__catalyst__rt__array_get_element_ptr_1d",     true,  0,                       0},
+    {"__catalyst__rt__array_update_element_1d",      true,  0,                       0},
+    {"__catalyst__rt__qubit_allocate",               true,  0,                       0},
+    {"__catalyst__rt__qubit_allocate_array",         true,  0,                       0},
+    {"__catalyst__rt__qubit_release",                false, 0,                       0},
+    {"__catalyst__rt__qubit_release_array",          false, 0,                       0},
+    {"__catalyst__rt__num_qubits",                   true,  0,                       0},
+    {"__catalyst__rt__result_equal",                 true,  argMask({0, 1}),         0},
+    {"__catalyst__rt__result_get_one",               true,  0,                       0},
+    {"__catalyst__rt__result_get_zero",              true,  0,                       0},
+
+    {"__catalyst__qis__SetState",                    true,  argMask({0}),            0},
+    {"__catalyst__qis__SetBasisState",               true,  argMask({0}),            0},
+    {"__catalyst__qis__SetSparseState",              true,  argMask({0, 1}),         0},
+    {"__catalyst__qis__SetBasisStateIndex",          true,  0,                       0},
+    // Identity takes its modifiers first, followed by its variadic qubits
+    {"__catalyst__qis__Identity",                    true,  argMask({0}),            0},
+    {"__catalyst__qis__PauliX",                      true,  lastArg,                 0},
+    {"__catalyst__qis__PauliY",                      true,  lastArg,                 0},
+    {"__catalyst__qis__PauliZ",                      true,  lastArg,                 0},
+    {"__catalyst__qis__Hadamard",                    true,  lastArg,                 0},
+    {"__catalyst__qis__S",                           true,  lastArg,                 0},
+    {"__catalyst__qis__T",                           true,  lastArg,                 0},
+    {"__catalyst__qis__PhaseShift",                  true,  lastArg,                 0},
+    {"__catalyst__qis__RX",                          true,  lastArg,                 0},
+    {"__catalyst__qis__RY",                          true,  lastArg,                 0},
+    {"__catalyst__qis__RZ",                          true,  lastArg,                 0},
+    {"__catalyst__qis__Rot",                         true,  lastArg,                 0},
+    {"__catalyst__qis__CNOT",                        true,  lastArg,                 0},
+    {"__catalyst__qis__CY",                          true,  lastArg,                 0},
+    {"__catalyst__qis__CZ",                          true,  lastArg,                 0},
+    {"__catalyst__qis__SWAP",                        true,  lastArg,                 0},
+    {"__catalyst__qis__IsingXX",                     true,  lastArg,                 0},
+    {"__catalyst__qis__IsingYY",                     true,  lastArg,                 0},
+    {"__catalyst__qis__IsingXY",                     true,  lastArg,                 0},
+    {"__catalyst__qis__IsingZZ",                     true,  lastArg,                 0},
+    {"__catalyst__qis__SingleExcitation",            true,  lastArg,                 0},
+    {"__catalyst__qis__DoubleExcitation",            true,  lastArg,                 0},
+    {"__catalyst__qis__ControlledPhaseShift",        true,  lastArg,                 0},
+    {"__catalyst__qis__CRX",                         true,  lastArg,                 0},
+    {"__catalyst__qis__CRY",                         true,  lastArg,                 0},
+    {"__catalyst__qis__CRZ",                         true,  lastArg,                 0},
+    {"__catalyst__qis__MS",                          true,  lastArg,                 0},
+    {"__catalyst__qis__CRot",                        true,  lastArg,                 0},
+    {"__catalyst__qis__CSWAP",                       true,  lastArg,                 0},
+    {"__catalyst__qis__Toffoli",                     true,  lastArg,                 0},
+    {"__catalyst__qis__ISWAP",                       true,  lastArg,                 0},
+    {"__catalyst__qis__PSWAP",                       true,  lastArg,                 0},
+    {"__catalyst__qis__GlobalPhase",                 true,  argMask({1}),            0},
+    {"__catalyst__qis__MultiRZ",                     true,  argMask({1}),            0},
+    {"__catalyst__qis__MultiRZ_array",               true,  argMask({1, 3}),         0},
+    {"__catalyst__qis__PCPhase",                     true,  argMask({2}),            0},
+    {"__catalyst__qis__PCPhase_array",               true,  argMask({2, 4}),         0},
+    {"__catalyst__qis__ApplyBatch",                  true,  argMask({1, 3, 5}),      0},
+    {"__catalyst__qis__PauliRot",                    true,  argMask({0, 2}),         0},
+    {"__catalyst__qis__PauliRot_array",              true,  argMask({0, 2, 5}),      0},
+    {"__catalyst__qis__PackedPauliRot_array",        true,  argMask({0, 2, 5}),      0},
+    {"__catalyst__qis__QubitUnitary",                true,  argMask({0, 1}),         0},
+    {"__catalyst__qis__QubitUnitary_array",          true,  argMask({0, 1, 3}),      0},
+    {"__catalyst__qis__NamedObs",                    true,  0,                       0},
+    {"__catalyst__qis__HermitianObs",                true,  argMask({0}),            0},
+    {"__catalyst__qis__TensorObs",                   true,  0,                       0},
+    {"__catalyst__qis__HamiltonianObs",              true,  argMask({0}),            0},
+    {"__catalyst__qis__Measure",                     true,  0,                       0},
+    {"__catalyst__qis__MeasureBit",                  true,  0,                       0},
+    {"__catalyst__qis__MeasureBits",                 true,  argMask({1, 2}),         argMask({3})},
+    {"__catalyst__qis__PauliMeasure",                true,  argMask({0, 2}),         0},
+    {"__catalyst__qis__PackedPauliMeasure",          true,  argMask({0, 2}),         0},
+    {"__catalyst__qis__Expval",                      true,  0,                       0},
+    {"__catalyst__qis__Variance",                    true,  0,                       0},
+    {"__catalyst__qis__ExpvalVar",                   true,  0,                       argMask({0})},
+    {"__catalyst__qis__Expvals",                     true,  0,                       argMask({0})},
+    {"__catalyst__qis__Probs",                       true,  0,                       argMask({0})},
+    {"__catalyst__qis__Probs_array",                 true,  argMask({2}),            argMask({0})},
+    {"__catalyst__qis__Sample",                      true,  0,                       argMask({0})},
+    {"__catalyst__qis__Sample_array",                true,  argMask({2}),            argMask({0})},
+    {"__catalyst__qis__PackedSample",                true,  0,                       argMask({0})},
+    {"__catalyst__qis__SubmitSample",                true,  0,                       0},
+    {"__catalyst__qis__AwaitSample",                 true,  0,                       argMask({0})},
+    {"__catalyst__qis__Counts",                      true,  0,                       argMask({0})},
+    {"__catalyst__qis__Counts_array",                true,  argMask({2}),            argMask({0})},
+    {"__catalyst__qis__State",                       true,  0,                       argMask({0})},
+    {"__catalyst__qis__State_array",                 true,  argMask({2}),            argMask({0})},
+    {"__catalyst__qis__StateView",                   true,  0,                       argMask({0})},
+    {"__catalyst__qis__Gradient",                    true,  0,                       0},
+    {"__catalyst__qis__Gradient_params",             true,  argMask({0}),            0},
+
+    {"__catalyst__mbqc__measure_in_basis",           true,  0,                       0},
+    {"__catalyst__mbqc__measure_in_basis_array",     true,  argMask({1, 2, 3, 4}),   argMask({5})},
+
+    {"__catalyst__qecp__decoder_create",             true,  argMask({0, 2}),         0},
+    {"__catalyst__qecp__decode_esm",                 true,  argMask({1}),            argMask({3})},
+    // clang-format on
+};
+
+inline const Entry *lookup(llvm::StringRef name)
+{
+    for (const Entry &entry : table) {
+        if (entry.name == name) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace RuntimeFunctionAttributes
+
+// Annotate the declaration of a runtime function with what the runtime ABI guarantees about it.
+//
+// All functions of the runtime are `enzyme_inactive`: the derivatives of quantum programs are
+// registered as custom gradients, so that Enzyme never differentiates through the runtime, and
+// needs no tape or shadow memory for its calls. The `nofree` functions, and the `readonly` and
+// `nocapture` pointer arguments, further let Enzyme and LLVM keep the program memory around the
+// calls without caching it.
+inline void annotateRuntimeFunction(mlir::LLVM::LLVMFuncOp fnDecl)
+{
+    llvm::StringRef name = fnDecl.getSymName();
+    if (!name.starts_with("__catalyst__")) {
+        return;
+    }
+
+    mlir::MLIRContext *ctx = fnDecl.getContext();
+    mlir::Builder builder(ctx);
+    llvm::SmallVector<mlir::Attribute> passthrough;
+    if (auto existing = fnDecl.getPassthroughAttr()) {
+        passthrough.append(existing.begin(), existing.end());
+    }
+    auto addPassthrough = [&](llvm::StringRef key) {
+        auto attr = builder.getStringAttr(key);
+        if (!llvm::is_contained(passthrough, attr)) {
+            passthrough.push_back(attr);
+        }
+    };
+    addPassthrough("enzyme_inactive");
+
+    if (const auto *entry = RuntimeFunctionAttributes::lookup(name)) {
+        if (entry->nofree) {
+            addPassthrough("nofree");
+        }
+
+        unsigned numArgs = fnDecl.getNumArguments();
+        for (unsigned index = 0; index < numArgs; index++) {
+            bool isLast = index + 1 == numArgs;
+            auto selected = [&](uint32_t mask) {
+                return (index < 31 && (mask & (1u << index))) ||
+                       (isLast && (mask & RuntimeFunctionAttributes::lastArg));
+            };
+            if (!mlir::isa<mlir::LLVM::LLVMPointerType>(fnDecl.getArgumentTypes()[index])) {
+                continue;
+            }
+            if (selected(entry->readonlyArgs)) {
+                fnDecl.setArgAttr(index, mlir::LLVM::LLVMDialect::getReadonlyAttrName(),
+                                  builder.getUnitAttr());
+            }
+            if (selected(entry->readonlyArgs) || selected(entry->nocaptureArgs)) {
+                fnDecl.setArgAttr(index, mlir::LLVM::LLVMDialect::getNoCaptureAttrName(),
+                                  builder.getUnitAttr());
+            }
+        }
+    }
+
+    fnDecl.setPassthroughAttr(mlir::ArrayAttr::get(ctx, passthrough));
+}
+
+} // namespace catalyst
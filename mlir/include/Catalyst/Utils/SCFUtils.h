@@ -12,6 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <optional>
+
+#include "llvm/ADT/DenseMap.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/IR/Operation.h"
 
 using namespace mlir;
@@ -24,12 +28,30 @@ bool isOpInIfOp(Operation *op);
 // Returns true if an operation is nested in a scf.while operation at any depth.
 bool isOpInWhileOp(Operation *op);
 
-// Given an op in a for loop body with a static number of start, end and step,
-// compute the number of iterations that will be executed by the for loop.
-// Returns -1 if any of the above for loop information is not static.
+// Evaluate an integer, index or i1 value computed from constants and the induction variables
+// bound in `ivValues` by integer arith operations (add, sub, mul, div, rem, min, max, casts,
+// comparisons and selects). Returns std::nullopt if the value is not static.
+std::optional<int64_t> evaluateStaticInt(Value value,
+                                         const llvm::DenseMap<Value, int64_t> &ivValues = {});
+
+// Returns true if `value` is computed from `iv` through arith operations.
+bool dependsOnValue(Value value, Value iv);
+
+// Compute the number of iterations of a for loop whose bounds and step can be evaluated with
+// `evaluateStaticInt`. Returns std::nullopt if they cannot.
+std::optional<int64_t> getStaticTripCount(scf::ForOp forOp,
+                                          const llvm::DenseMap<Value, int64_t> &ivValues = {});
+
+// Given an op nested in for loops and conditionals, compute the number of times it is executed
+// within its function. Loop bounds may depend on the induction variables of enclosing loops
+// (e.g. triangular loop nests), and scf.if / scf.index_switch conditions may depend on them too;
+// loops whose body depends on their induction variable are enumerated, up to a total of
+// `maxEnumeratedIterations` iterations. Returns std::nullopt if the count is not static, or if the
+// op is nested in a while loop.
 //
 // Note: if the input op is not inside any for loop operations,
 // this method returns 1, since there would be just one "iteration".
-int64_t countStaticForloopIterations(Operation *op);
+std::optional<int64_t> countStaticExecutions(Operation *op,
+                                             int64_t maxEnumeratedIterations = 1 << 20);
 
 } // namespace catalyst
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <string>
+#include <utility>
+
 #include "llvm/ADT/StringRef.h"
 #include "llvm/IR/Module.h"
 #include "llvm/Target/TargetMachine.h"
@@ -28,9 +31,26 @@ namespace driver {
 /// Register the translations needed to convert to LLVM IR.
 void registerLLVMTranslations(mlir::DialectRegistry &registry);
 
+/// The CPU and the target features to generate code for, as given by `options.targetCPU` and
+/// `options.targetFeatures`, with the `native` CPU resolved to the host CPU and its features.
+std::pair<std::string, std::string> getTargetCPUAndFeatures(const CompilerOptions &options);
+
+/// Emit the object code of the module to `filename`. If `options.codegenThreads` allows it, the
+/// module is split and the partitions are emitted in parallel to separate object files, named as
+/// given by `getPartitionObjectFile`, which must all be linked into the program.
 mlir::LogicalResult compileObjectFile(const CompilerOptions &options,
                                       std::shared_ptr<llvm::Module> module,
                                       llvm::TargetMachine *targetMachine, llvm::StringRef filename);
 
+/// Split the module into `numPartitions` modules and emit their object code in parallel.
+mlir::LogicalResult compilePartitionedObjectFiles(const CompilerOptions &options,
+                                                  std::shared_ptr<llvm::Module> module,
+                                                  llvm::TargetMachine *targetMachine,
+                                                  llvm::StringRef filename, size_t numPartitions);
+
+/// Get the object file of a partition of the module, with the first partition in `filename` and
+/// the others in `<stem>.part<N>.o`.
+std::string getPartitionObjectFile(llvm::StringRef filename, size_t partition);
+
 } // namespace driver
 } // namespace catalyst
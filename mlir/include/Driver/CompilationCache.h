@@ -0,0 +1,104 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "mlir/IR/BuiltinOps.h"
+
+#include "CompilerDriver.h"
+
+namespace catalyst {
+namespace driver {
+
+/**
+ * @brief Compute the key of the on-disk compilation cache entry for a compilation.
+ * @details The key is a SHA-256 digest of the source program, the compiler options that affect the
+ * generated code, the pipelines, the contents of the runtime bitcode and of the loaded plugins, and
+ * the compiler version. Entries are only used for complete compilations to an object file, without intermediate files.
+ *
+ * @param options Compiler configuration options.
+ * @param output
+ * @return The key of the cache entry, or `std::nullopt` if the compilation is not cacheable.
+ */
+std::optional<std::string> getCompilationCacheKey(const CompilerOptions &options,
+                                                  const CompilerOutput &output);
+
+/**
+ * @brief Copy the cached object file of the given key, if any, to the output object file.
+ *
+ * @return True if the cache contains an entry for the key.
+ */
+bool restoreCachedObjectFile(const CompilerOptions &options, llvm::StringRef key);
+
+/**
+ * @brief Store the output object file in the cache under the given key.
+ * @details Entries are written to a temporary file first and then renamed, so that concurrent
+ * compilations never observe a partially written entry. Failures to populate the cache are not
+ * fatal to the compilation.
+ */
+void storeCachedObjectFile(const CompilerOptions &options, llvm::StringRef key);
+
+/**
+ * @brief Whether compilations with the given options cache the module before their last pipeline.
+ * @details Snapshots are only taken in incremental mode, for complete pipelines without
+ * checkpoints or intermediate files.
+ */
+bool hasStageSnapshots(const CompilerOptions &options);
+
+/**
+ * @brief Replace the kwargs of every `quantum.device` operation in the module with a placeholder.
+ * @details Device kwargs are only read when lowering to the LLVM dialect, so that the module
+ * lowered up to that point can be shared by programs that only differ in their device kwargs.
+ *
+ * @return The original kwargs, indexed by the placeholders.
+ */
+std::vector<std::string> detachDeviceKwargs(mlir::ModuleOp moduleOp);
+
+/**
+ * @brief Substitute the device kwargs back for the placeholders left by `detachDeviceKwargs`.
+ * @details Passes may have copied the device operations or appended to their kwargs in between.
+ */
+mlir::LogicalResult attachDeviceKwargs(mlir::ModuleOp moduleOp,
+                                       llvm::ArrayRef<std::string> deviceKwargs);
+
+/**
+ * @brief Compute the key of the snapshot of a module after the given pipelines.
+ * @details The key is a SHA-256 digest of the module, with its device kwargs detached, of the
+ * pipelines and of the compiler version.
+ */
+std::string getStageSnapshotKey(const CompilerOptions &options, mlir::ModuleOp moduleOp,
+                                llvm::ArrayRef<Pipeline> pipelines);
+
+/**
+ * @brief Replace the contents of the module with the snapshot of the given key, if any.
+ *
+ * @return True if the cache contains a snapshot for the key.
+ */
+bool restoreStageSnapshot(const CompilerOptions &options, mlir::ModuleOp moduleOp,
+                          llvm::StringRef key);
+
+/**
+ * @brief Store the module in the cache as MLIR bytecode under the given key.
+ */
+void storeStageSnapshot(const CompilerOptions &options, mlir::ModuleOp moduleOp,
+                        llvm::StringRef key);
+
+} // namespace driver
+} // namespace catalyst
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 #include <unordered_map>
@@ -96,6 +98,14 @@ struct CompilerOptions {
     SaveTemps keepIntermediate;
     /// If true, the compiler will dump the module scope when saving intermediate files.
     bool dumpModuleScope;
+    /// If true, the intermediate MLIR files are saved as bytecode (`.mlirbc`) rather than text,
+    /// which is faster to write and to parse back for large modules.
+    bool dumpBytecode;
+    /// If true, the private functions that the program can never call are erased after parsing.
+    bool pruneFunctions;
+    /// If true, the qnode-local passes of the pipelines also run on each qnode module before the
+    /// modules are inlined, where the pass manager runs them on the qnodes in parallel.
+    bool parallelQnodes;
     /// Print SSA IDs using their name location, if provided, as prefix.
     bool useNameLocAsPrefix;
     /// If true, the llvm.coroutine will be lowered.
@@ -113,11 +123,61 @@ struct CompilerOptions {
     bool dumpPassPipeline;
     /// If true, the compiler will write bytecode rather than text.
     bool shouldEmitBytecode;
+    /// Path to the LLVM bitcode of the runtime C-API to link into the program, if not empty.
+    std::string runtimeBitcode;
+    /// Directory of the on-disk cache of compiled object files, disabled if empty.
+    std::string cacheDir;
+    /// Number of threads for the parallel emission of object code, 0 to use all the hardware
+    /// threads. With more than one thread, the program is emitted to several object files.
+    unsigned codegenThreads;
+    /// File to write the compile-time telemetry of each pass to, in the Chrome trace event format,
+    /// disabled if empty.
+    std::string telemetryFile;
+    /// File to which the program writes the hardware performance counters of each qnode and entry
+    /// point, in the Chrome trace event format of the telemetry, disabled if empty.
+    std::string perfCounters;
+    /// If true, the module before the last pipeline is cached in `cacheDir`, so that programs that
+    /// only differ in their device kwargs resume from the last pipeline.
+    bool incremental;
+    /// Directory to which the program, instrumented for profile-guided optimization, writes its
+    /// raw LLVM profiles, disabled if empty.
+    std::string profileGenerate;
+    /// Indexed LLVM profile (`.profdata`) merged from the raw profiles of instrumented programs,
+    /// with which the program is optimized, disabled if empty.
+    std::string profileUse;
+    /// CPU to generate code for, `native` for the host CPU, or the generic CPU of the target if
+    /// empty.
+    std::string targetCPU;
+    /// Comma-separated target features enabled (`+feature`) or disabled (`-feature`) on top of the
+    /// features of `targetCPU`, e.g. `+avx2,-avx512f`.
+    std::string targetFeatures;
+    /// SHA-256 digests of the files of the loaded pass and dialect plugins, which can change the
+    /// generated code without changing the program or the options.
+    std::vector<std::string> pluginDigests;
 
     /// Get the destination of the object file at the end of compilation.
     std::string getObjectFile() const;
 };
 
+/**
+ * @brief Compile-time telemetry of one execution of a pass on an operation.
+ */
+struct PassTelemetry {
+    /// The pass argument, or its name if the pass has no argument.
+    std::string pass;
+    /// The operation the pass ran on, with its symbol name if it has one.
+    std::string anchor;
+    uint64_t threadId;
+    /// Time at which the pass started, since the start of the compilation.
+    std::chrono::microseconds start;
+    std::chrono::microseconds duration;
+    size_t opsBefore;
+    size_t opsAfter;
+    /// Peak resident set size of the compiler process at the end of the pass, in bytes.
+    size_t peakRSS;
+    bool failed;
+};
+
 /**
  * @brief Holds the output from the compiler, providing access to pass stage data during
  * compilation.
@@ -134,6 +194,10 @@ struct CompilerOutput {
     std::string currentStage = ".";   // Current compilation stage subdirectory
     /// if the compiler reach the pass specified by startAfterPass.
     bool isCheckpointFound;
+    /// Telemetry of the passes run, if enabled by `CompilerOptions::telemetryFile`.
+    std::vector<PassTelemetry> passTelemetry;
+    /// Start of the compilation, from which telemetry times are measured.
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 
     // Gets the next pass dump file name within a pipeline folder
     std::string nextPassDumpFilename(const std::string &pipelineName,
@@ -145,15 +209,22 @@ struct CompilerOutput {
 
     // Set the current compilation stage for organizing output files
     void setStage(const std::string &stageName);
+
+    // Write the pass telemetry as a JSON document in the Chrome trace event format
+    void writeTelemetry(llvm::raw_ostream &os) const;
 };
 
 /**
- * @brief Parse an MLIR module given in textual ASM representation. Any errors during parsing will
- * be output to diagnosticStream.
+ * @brief Parse an MLIR module given in textual ASM or bytecode representation. Any errors during
+ * parsing will be output to diagnosticStream.
  *
+ * @param pruneFunctions If true, the private functions that are not reachable from the public
+ * functions and the decomposition rules are erased right after parsing. The bodies of these
+ * functions are never materialized from bytecode.
  */
 mlir::OwningOpRef<mlir::ModuleOp> parseMLIRSource(mlir::MLIRContext *ctx,
-                                                  const llvm::SourceMgr &sourceMgr);
+                                                  const llvm::SourceMgr &sourceMgr,
+                                                  bool pruneFunctions = false);
 
 /**
  * @brief Checks if the program contains gradient operations in the input MLIR module. Used to
@@ -187,6 +258,17 @@ std::shared_ptr<llvm::Module> parseLLVMSource(llvm::LLVMContext &context, llvm::
  */
 void registerAllCatalystDialects(mlir::DialectRegistry &registry);
 
+/**
+ * @brief Load the dialects of the registry that the Catalyst pipelines create operations of.
+ * @details Other dialects are loaded on demand, when the parser or a pass needs them, rather than
+ * all at startup. All the dialects are loaded if the module contains operations of the transform
+ * dialect, as the passes applied by the transform interpreter don't load their dependencies.
+ *
+ * @param ctx The MLIR context, whose registry contains the Catalyst dialects.
+ * @param moduleOp The parsed input module.
+ */
+void loadCatalystDialects(mlir::MLIRContext *ctx, mlir::ModuleOp moduleOp);
+
 /**
  * @brief Determines if the compilation stage should be executed if a checkpointStage is provided to
  * the compiler options. This will ensure the compiler will execute only after reaching the given
@@ -323,17 +405,46 @@ llvm::LogicalResult runEnzymePasses(const CompilerOptions &options,
                                     std::shared_ptr<llvm::Module> llvmModule,
                                     CompilerOutput &output);
 
+/**
+ * @brief Instrument each qnode and each entry point of the program in the LLVM dialect with the
+ * hardware performance counters of the runtime.
+ * @details The body of each function is wrapped by calls to `__catalyst__rt__perf_counters_begin`
+ * and `__catalyst__rt__perf_counters_end` with the name of the function, and the entry points
+ * write the counters accumulated so far to `perfCounters` before returning.
+ *
+ * @param options Compiler configuration options.
+ * @param module The program, lowered to the LLVM dialect.
+ */
+void instrumentPerfCounters(const CompilerOptions &options, mlir::ModuleOp module);
+
+/**
+ * @brief Link the LLVM bitcode of the runtime C-API into the program.
+ * @details Only the quantum instruction entry points (`__catalyst__qis__*`) used by the program
+ * are linked in, and are internalized so that the subsequent optimization passes can inline them.
+ * The runtime state they refer to remains owned by the rt_capi library. A bitcode file that cannot
+ * be loaded, e.g. produced by an incompatible LLVM version, is skipped.
+ *
+ * @param options Compiler configuration options.
+ * @param llvmModule
+ * @param output
+ * @return llvm::LogicalResult
+ */
+llvm::LogicalResult linkRuntimeBitcode(const CompilerOptions &options,
+                                       std::shared_ptr<llvm::Module> llvmModule,
+                                       CompilerOutput &output);
+
 /**
  * @brief Run optimization passes at the -O2 level on the program representation.
  *
  * @param options Compiler configuration options.
  * @param llvmModule
+ * @param targetMachine The target machine whose CPU the passes optimize for.
  * @param output
  * @return llvm::LogicalResult
  */
 llvm::LogicalResult runO2LLVMPasses(const CompilerOptions &options,
                                     std::shared_ptr<llvm::Module> llvmModule,
-                                    CompilerOutput &output);
+                                    llvm::TargetMachine *targetMachine, CompilerOutput &output);
 
 }; // namespace catalyst::driver
 
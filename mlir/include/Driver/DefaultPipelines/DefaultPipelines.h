@@ -38,6 +38,10 @@ const PipelineList pipelineList{
       // tapes will generate multiple qnodes. One for each tape.
       // Split multiple tapes enforces that invariant.
       "split-multiple-tapes",
+      // Must be after split-multiple-tapes, so that the unused tapes are removed too.
+      "prune-qnode-results",
+      "merge-qnode-calls",
+      "specialize-qnode-constants",
       // Run the transform sequence defined in the MLIR module
       "builtin.module(apply-transform-sequence)",
       // Nested modules are something that will be used in the future
@@ -51,15 +55,17 @@ const PipelineList pipelineList{
       "inline-nested-module",
       "lower-mitigation",
       "adjoint-lowering",
+      // Function-local passes are nested on functions, which the pass manager runs in parallel.
       // TODO: we can remove the following 2 passes once PBC has its own pipeline.
-      "lower-pbc-init-ops",
-      "disable-assertion",
+      "func.func(lower-pbc-init-ops)",
+      "func.func(disable-assertion)",
       "symbol-dce"}},  // to remove user decomposition rules after all graph-decomposition passes
     {"hlo-lowering-pipeline",
      {"canonicalize",
       "func.func(chlo-legalize-to-stablehlo)",
       "func.func(stablehlo-legalize-control-flow)",
       "func.func(stablehlo-aggressive-simplification)",
+      "func.func(lower-sample-postprocessing)",
       "stablehlo-legalize-to-linalg",
       "func.func(stablehlo-legalize-to-std)",
       "func.func(stablehlo-legalize-sort)",
@@ -69,7 +75,7 @@ const PipelineList pipelineList{
       "hlo-custom-call-lowering",
       "cse",
       "func.func(linalg-detensorize{aggressive-mode})",
-      "detensorize-scf",
+      "func.func(detensorize-scf)",
       "detensorize-function-boundary",
       "canonicalize",
       "symbol-dce"}},
@@ -77,10 +83,14 @@ const PipelineList pipelineList{
      {"annotate-invalid-gradient-functions",
       "lower-gradients"}},
     {"bufferization-pipeline",
-     {// tensor.pad
+     {// Batches callbacks in loops, on tensors
+      "batch-callbacks",
+      // tensor.pad
       "convert-tensor-to-linalg",
       // Must be run before --one-shot-bufferize.
       "convert-elementwise-to-linalg",
+      // Must be run after the elementwise operations are linalg operations, which it updates.
+      "func.func(loop-carried-in-place)",
       "gradient-preprocess",
       /* [DISABLED PASS]
        * Keep eliminate-empty-tensors commented out until benchmarks use more structure
@@ -109,12 +119,26 @@ const PipelineList pipelineList{
       // Must be after convert-bufferization-to-memref.
       // Otherwise, there are issues in the lowering of dynamic tensors.
       "canonicalize",
+      // Must be after convert-bufferization-to-memref, which lowers clones to copies.
+      "func.func(elide-memref-copies)",
+      // Must be after convert-bufferization-to-memref, so that it sees the allocations of clones.
+      "func.func(reuse-buffers)",
+      // Must be after reuse-buffers, which lets the allocations it hoists be reused first.
+      "func.func(promote-static-allocs)",
       /* [DISABLED PASS]
        * "cse",
        */
       "cp-global-memref"}},
     {"llvm-dialect-lowering-pipeline",
-     {"qnode-to-async-lowering",
+     {// Must be run before the qnode calls are lowered to async calls. It is skipped with async
+      // qnodes, whose calls run concurrently on devices of their own.
+      "batch-qnode-loops",
+      "qnode-to-async-lowering{coarsen}",
+      // Must be run before the calls are outlined into coroutines by the async lowering.
+      "noalias-memref-args",
+      // Run the parallel shot loops of dynamic-one-shot on the async runtime.
+      "scf-forall-to-parallel",
+      "async-parallel-for",
       "async-func-to-async-runtime",
       "async-to-async-runtime",
       "convert-async-to-llvm",
@@ -179,7 +203,7 @@ PassNames getQuantumCompilationStage(bool disableAssertion = true)
 {
     auto &&ret =
         pipelineList[0].passNames | std::views::filter([&disableAssertion](const auto &passName) {
-            return (!disableAssertion && (passName == "disable-assertion")) ? false : true;
+            return disableAssertion || passName != "func.func(disable-assertion)";
         });
     return PassNames{ret.begin(), ret.end()};
 }
@@ -208,8 +232,12 @@ PassNames getLLVMDialectLoweringStage(bool asyncQNodes = false)
 {
     auto &&ret =
         pipelineList[4].passNames | std::views::filter([&asyncQNodes](const auto &passName) {
+            if (asyncQNodes && passName == "batch-qnode-loops") {
+                return false;
+            }
             return (!asyncQNodes &&
-                    (passName == "qnode-to-async-lowering" ||
+                    (passName.starts_with("qnode-to-async-lowering") ||
+                     passName == "scf-forall-to-parallel" || passName == "async-parallel-for" ||
                      passName == "async-func-to-async-runtime" ||
                      passName == "async-to-async-runtime" || passName == "convert-async-to-llvm" ||
                      passName == "add-exception-handling"))
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <mutex>
+#include <utility>
+
 #include "mlir/Pass/PassInstrumentation.h"
 
 #include "Driver/CompilerDriver.h"
@@ -34,11 +38,20 @@ class CatalystPassInstrumentation : public mlir::PassInstrumentation {
   private:
     void dumpIRAfterPass(mlir::Pass *pass, mlir::Operation *op);
 
+    // Pass telemetry may be recorded from several threads
+    void beginTelemetry(mlir::Pass *pass, mlir::Operation *operation);
+    void endTelemetry(mlir::Pass *pass, mlir::Operation *operation, bool failed);
+
     const driver::CompilerOptions &options;
     driver::CompilerOutput &output;
     catalyst::utils::Timer<> &timer;
     // Store fingerprints before each pass to detect changes
     llvm::DenseMap<mlir::Pass *, std::optional<mlir::OperationFingerPrint>> beforePassFingerprints;
+    // Start time and op count of the passes in progress
+    llvm::DenseMap<std::pair<mlir::Pass *, mlir::Operation *>,
+                   std::pair<std::chrono::steady_clock::time_point, size_t>>
+        runningPasses;
+    std::mutex telemetryMutex;
 };
 
 } // namespace catalyst
@@ -69,7 +69,23 @@ class Pipeline {
     PipelineFunc registerFunc;
 };
 
-std::vector<Pipeline> getDefaultPipeline();
+/**
+ * @brief Get the stages of the default pipeline.
+ *
+ * @param parallelQnodes Whether the qnode-local passes of the quantum compilation stage also run
+ * on each qnode module before they are inlined, see `nestQnodePasses`.
+ */
+std::vector<Pipeline> getDefaultPipeline(bool parallelQnodes = false);
+
+/**
+ * @brief Also run the qnode-local passes of a stage, such as `adjoint-lowering`, in the
+ * `builtin.module(...)` pipeline that runs on each qnode module before `inline-nested-module`.
+ *
+ * The pass manager runs a pipeline nested on the modules in parallel on the MLIR thread pool,
+ * whereas a pass on the whole program processes all the qnodes in sequence. The stage is unchanged
+ * if it does not inline the nested modules.
+ */
+llvm::SmallVector<std::string> nestQnodePasses(llvm::ArrayRef<std::string> passes);
 
 } // namespace driver
 } // namespace catalyst
@@ -0,0 +1,46 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/IR/DialectRegistry.h"
+#include "mlir/Support/LogicalResult.h"
+
+namespace catalyst {
+namespace driver {
+
+/**
+ * @brief Load the plugins of the `--load-pass-plugin` and `--load-dialect-plugin` options of a
+ * command line, and remove these options from it.
+ * @details Each plugin is loaded and registered once per process, so that the compilations served
+ * by `--server` share the passes and dialects of their plugins instead of loading them again. A
+ * plugin is identified by the SHA-256 digest of its file. The library of a plugin cannot be
+ * replaced once loaded, so requesting a plugin whose file changed since then fails.
+ *
+ * @param args The command-line arguments, starting with the program name.
+ * @param registry The dialect registry of the compilations, extended by the dialect plugins.
+ * @param pluginDigests Set to the digests of the requested plugins, in order of appearance.
+ * @return Failure if a plugin cannot be read or loaded, or changed since it was loaded.
+ */
+mlir::LogicalResult loadPlugins(llvm::SmallVectorImpl<const char *> &args,
+                                mlir::DialectRegistry &registry,
+                                std::vector<std::string> &pluginDigests);
+
+} // namespace driver
+} // namespace catalyst
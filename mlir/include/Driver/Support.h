@@ -18,6 +18,8 @@
 #include <string>
 
 #include "llvm/Support/raw_ostream.h"
+#include "mlir/Bytecode/BytecodeWriter.h"
+#include "mlir/IR/Operation.h"
 #include "mlir/Support/LogicalResult.h"
 
 #include "CompilerDriver.h"
@@ -25,6 +27,18 @@
 namespace catalyst {
 namespace driver {
 
+/// Print `op` to `os` for an intermediate file, as bytecode if `CompilerOptions::dumpBytecode` is
+/// set and as text otherwise, and return the extension of that file.
+inline mlir::StringRef printForDump(const CompilerOptions &options, mlir::Operation *op,
+                                    llvm::raw_ostream &os)
+{
+    if (options.dumpBytecode && mlir::succeeded(mlir::writeBytecodeToFile(op, os))) {
+        return ".mlirbc";
+    }
+    os << *op;
+    return ".mlir";
+}
+
 template <typename Obj>
 void dumpToFile(const CompilerOptions &options, mlir::StringRef fileName, const Obj &obj)
 {
@@ -23,8 +23,18 @@ namespace gradient {
 
 void populatePreprocessingPatterns(mlir::RewritePatternSet &);
 void populatePostprocessingPatterns(mlir::RewritePatternSet &);
-void populateLoweringPatterns(mlir::RewritePatternSet &);
-void populateConversionPatterns(mlir::LLVMTypeConverter &, mlir::RewritePatternSet &);
+/// With `batchParameterShift`, the parameter-shift gradients issue all shifted evaluations of a
+/// block before combining any of them, so that they can be dispatched together. With
+/// `pruneInactiveParams`, the parameter-shift gradients skip the gate parameters that cannot
+/// affect the differentiated output. With `batchFiniteDiff`, the finite-difference gradients
+/// evaluate all perturbations of a tensor argument in a single batched call.
+void populateLoweringPatterns(mlir::RewritePatternSet &, bool batchParameterShift = false,
+                              bool pruneInactiveParams = false, bool batchFiniteDiff = false,
+                              bool vjpParameterShift = false);
+/// With a non-zero `adjointCheckpointInterval`, adjoint gradients ask the device to checkpoint
+/// its state every `adjointCheckpointInterval` operations of the recorded tape.
+void populateConversionPatterns(mlir::LLVMTypeConverter &, mlir::RewritePatternSet &,
+                                uint64_t adjointCheckpointInterval = 0);
 
 } // namespace gradient
 } // namespace catalyst
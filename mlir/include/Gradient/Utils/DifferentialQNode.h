@@ -34,8 +34,11 @@ void setRequiresCustomGradient(mlir::func::FuncOp funcOp, mlir::FlatSymbolRefAtt
 /// Check if this `funcOp` requires the generation and registration of a custom gradient.
 bool requiresCustomGradient(mlir::func::FuncOp funcOp);
 
-/// Register a custom quantum gradient for the given QNode.
-void registerCustomGradient(mlir::func::FuncOp qnode, mlir::FlatSymbolRefAttr qgradFn);
+/// Register a custom quantum gradient for the given QNode. With `isVJP`, the quantum gradient
+/// takes the cotangents of the QNode results and returns their vector-Jacobian product with
+/// respect to the gate parameters, instead of the Jacobian itself.
+void registerCustomGradient(mlir::func::FuncOp qnode, mlir::FlatSymbolRefAttr qgradFn,
+                            bool isVJP = false);
 
 } // namespace gradient
 } // namespace catalyst
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <tuple>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLFunctionalExtras.h"
 #include "mlir/Conversion/LLVMCommon/TypeConverter.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/Transforms/DialectConversion.h"
@@ -23,8 +27,34 @@
 
 namespace catalyst {
 namespace ion {
+
+/// Memoizes the beam attributes of the pulses that gates lower to, so that they are built once per
+/// pass run for each gate kind and set of qubits, rather than once per gate. Attributes are uniqued
+/// in the context, so the cache can be shared by all the QNodes lowered by a pass.
+class GatePulseCache {
+  public:
+    /// Number of qubits of the QNode (0 for single-qubit gates) and indices of the gate qubits (-1
+    /// for the second qubit of single-qubit gates).
+    using Key = std::tuple<int64_t, int64_t, int64_t>;
+
+    /// Get the beams of the gate with the given key, building them on the first query.
+    llvm::ArrayRef<mlir::Attribute>
+    getBeams(Key key, llvm::function_ref<llvm::SmallVector<mlir::Attribute>()> build)
+    {
+        auto [it, inserted] = beams.try_emplace(key);
+        if (inserted) {
+            it->second = build();
+        }
+        return it->second;
+    }
+
+  private:
+    llvm::DenseMap<Key, llvm::SmallVector<mlir::Attribute>> beams;
+};
+
 // Gates to pulses conversion patterns
-void populateGatesToPulsesPatterns(mlir::RewritePatternSet &, const OQDDatabaseManager &);
+void populateGatesToPulsesPatterns(mlir::RewritePatternSet &, const OQDDatabaseManager &,
+                                   int64_t nQubits, GatePulseCache &);
 void populateMeasureToPulsesPatterns(mlir::RewritePatternSet &, const OQDDatabaseManager &);
 void populateConversionPatterns(mlir::LLVMTypeConverter &typeConverter,
                                 mlir::RewritePatternSet &patterns);
@@ -23,5 +23,10 @@ namespace mbqc {
 void populateConversionPatterns(mlir::LLVMTypeConverter &typeConverter,
                                 mlir::RewritePatternSet &patterns);
 
+/// Replace straight-line runs of `__catalyst__mbqc__measure_in_basis` calls, none of whose bases
+/// depend on the results of the others, by a single call to
+/// `__catalyst__mbqc__measure_in_basis_array`. Must run after the conversion to the LLVM dialect.
+void batchMeasureInBasisCalls(mlir::Operation *root);
+
 } // namespace mbqc
 } // namespace catalyst
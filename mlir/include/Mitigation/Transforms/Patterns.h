@@ -21,7 +21,7 @@
 namespace catalyst {
 namespace mitigation {
 
-void populateLoweringPatterns(mlir::RewritePatternSet &);
+void populateLoweringPatterns(mlir::RewritePatternSet &, bool parallelScaleFactors = false);
 
 } // namespace mitigation
 } // namespace catalyst
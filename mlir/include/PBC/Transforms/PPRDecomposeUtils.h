@@ -15,6 +15,9 @@
 #ifndef PBC_TRANSFORMS_DECOMPOSE_UTILS_H
 #define PBC_TRANSFORMS_DECOMPOSE_UTILS_H
 
+#include "llvm/ADT/STLFunctionalExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/IR/BuiltinAttributes.h"
 #include "mlir/IR/Location.h"
 #include "mlir/IR/PatternMatch.h"
 
@@ -29,7 +32,29 @@ std::pair<mlir::StringRef, bool> determinePauliAndSignOfMeasurement(bool avoidPa
 
 /// Initialize |0⟩ or Fabricate|Y⟩ based on avoidPauliYMeasure
 mlir::OpResult initializeZeroOrPlusI(bool avoidPauliYMeasure, mlir::Location loc,
-                                     mlir::PatternRewriter &rewriter);
+                                     mlir::RewriterBase &rewriter);
+
+/// The Pauli words of the ops emitted by the decomposition of a PPR. They only depend on the Pauli
+/// product of the PPR, not on its angle or qubits, so PPRs with the same Pauli product share a
+/// plan.
+struct PPRDecompositionPlan {
+    /// The Pauli word P of the PPR
+    llvm::SmallVector<mlir::StringRef> pauli;
+    /// P⊗Z, measured on the input qubits and the axillary qubit
+    llvm::SmallVector<mlir::StringRef> extendedPauli;
+};
+
+PPRDecompositionPlan planPPRDecomposition(mlir::ArrayAttr pauliProduct);
+
+using PPRDecompositionFn = llvm::function_ref<void(
+    mlir::Operation *, const PPRDecompositionPlan &, mlir::RewriterBase &)>;
+
+/// Decompose a batch of PPRs, in three phases:
+/// 1. The distinct Pauli products of `ops` are collected.
+/// 2. A plan is computed once for each of them.
+/// 3. Each op is rewritten by `decompose` in order, with the insertion point set before the op.
+void decomposePPRBatch(mlir::MLIRContext *ctx, llvm::ArrayRef<mlir::Operation *> ops,
+                       PPRDecompositionFn decompose);
 
 } // namespace pbc
 } // namespace catalyst
@@ -38,5 +38,12 @@ void populateUnrollConditionalPPRPPMPatterns(mlir::RewritePatternSet &);
 void populateLowerPBCInitOpsPatterns(mlir::RewritePatternSet &);
 void populateConversionPatterns(mlir::LLVMTypeConverter &typeConverter,
                                 mlir::RewritePatternSet &patterns);
+
+// Batched counterparts of the decomposition patterns, which collect the decomposable PPRs under
+// `root`, plan their decompositions once per Pauli product and rewrite them in one pass over the
+// ops.
+void decomposeNonCliffordPPRBatch(mlir::Operation *root, DecomposeMethod decomposeMethod,
+                                  bool avoidYMeasure);
+void decomposeArbitraryPPRBatch(mlir::Operation *root);
 } // namespace pbc
 } // namespace catalyst
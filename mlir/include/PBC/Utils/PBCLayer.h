@@ -19,6 +19,7 @@
 #include "PBC/IR/PBCDialect.h"
 #include "PBC/IR/PBCOpInterfaces.h"
 #include "PBC/IR/PBCOps.h"
+#include "PBC/Utils/PackedPauliString.h"
 #include "Quantum/IR/QuantumDialect.h"
 
 namespace catalyst {
@@ -31,8 +32,15 @@ class PBCLayerContext {
   public:
     llvm::MapVector<LayerOp, std::unique_ptr<PBCLayer>> layers;
 
+    // Symplectic codes of the Pauli products seen by the pass, for the commutation checks
+    PauliProductCache pauliProductCache;
+
     // Clear all per-pass cached layer objects.
-    void clear() { layers.clear(); }
+    void clear()
+    {
+        layers.clear();
+        pauliProductCache.clear();
+    }
 
     PBCLayerContext() = default;
     ~PBCLayerContext() = default;
@@ -63,6 +71,18 @@ class PBCLayer {
     llvm::SetVector<mlir::Value> operands;
     llvm::SetVector<mlir::Value> results;
 
+    // Ops of the layer acting on each entry qubit, and the entry qubits of each op, so that the
+    // commutation checks of a new op only visit the ops with which it shares qubits
+    llvm::DenseMap<mlir::Value, llvm::SmallVector<mlir::Operation *>> entryQubitOps;
+    llvm::DenseMap<mlir::Operation *, std::vector<mlir::Value>> opEntryQubits;
+
+    // Earliest and latest ops of the layer in their block, recomputed lazily after an erasure
+    mutable PBCOpInterface firstOp = nullptr;
+    mutable PBCOpInterface lastOp = nullptr;
+    mutable bool boundsStale = false;
+
+    void updateBounds() const;
+
     // Resolve the canonical entry for a given qubit value by chasing
     // local and result->operand mappings deterministically.
     mlir::Value resolveEntry(mlir::Value v) const;
@@ -93,6 +113,13 @@ class PBCLayer {
     const llvm::SetVector<mlir::Value> &getOperands() const { return operands; }
     const llvm::SetVector<mlir::Value> &getResults() const { return results; }
 
+    // Get the op of the layer that comes first in its block
+    PBCOpInterface getFirstOp() const
+    {
+        updateBounds();
+        return firstOp;
+    }
+
     // Mutator for removing an op record from the layer bookkeeping
     void eraseOp(PBCOpInterface op);
 
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "PBC/IR/PBCOpInterfaces.h"
+#include "PBC/Utils/PackedPauliString.h"
 
 namespace catalyst {
 namespace pbc {
@@ -31,7 +32,7 @@ std::vector<mlir::Value> getInQubitReachingValuesAt(PBCOpInterface srcOp, PBCOpI
 
 // Check if `rhsOp` commutes with `lhsOp` at the program point of `lhsOp`.
 // This checks commutativity of the normalized ops with the same block.
-bool commutes(PBCOpInterface rhsOp, PBCOpInterface lhsOp);
+bool commutes(PBCOpInterface rhsOp, PBCOpInterface lhsOp, PauliProductCache &cache);
 
 // Recursively resolve the constant parameter of a value and returns std::nullopt if not a constant.
 std::optional<double> resolveConstantValue(mlir::Value value);
@@ -0,0 +1,95 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/IR/BuiltinAttributes.h"
+
+#include "PBC/IR/PBCOpInterfaces.h"
+
+namespace catalyst {
+namespace pbc {
+
+/// A Pauli string in the symplectic representation: the Pauli operator on qubit i is encoded by
+/// its X and Z bits, stored at bit i % 64 of the words xBits[i / 64] and zBits[i / 64]. Unlike
+/// PauliStringWrapper, it carries no phase beyond the sign, and is meant for the commutation and
+/// equality queries that dominate the PBC passes.
+class PackedPauliString {
+  private:
+    size_t numQubits;
+    llvm::SmallVector<uint64_t, 1> xBits;
+    llvm::SmallVector<uint64_t, 1> zBits;
+    bool negative = false;
+
+  public:
+    explicit PackedPauliString(size_t numQubits);
+
+    /// Set the operator on `qubit` from its symplectic code, with the X bit in bit 0 and the Z
+    /// bit in bit 1.
+    void setPauli(size_t qubit, uint8_t code);
+
+    size_t size() const { return numQubits; }
+
+    void setNegative(bool sign) { negative = sign; }
+    bool isNegative() const { return negative; }
+
+    /// Two Pauli strings commute iff their symplectic product, the parity of the number of qubits
+    /// on which they act with anti-commuting operators, is zero.
+    bool commutes(const PackedPauliString &other) const;
+
+    bool operator==(const PackedPauliString &rhs) const;
+    bool operator!=(const PackedPauliString &rhs) const { return !(*this == rhs); }
+};
+
+/// Caches the symplectic codes of Pauli product attributes, so that the strings of each Pauli word
+/// are parsed once per pass instead of once per commutation query. Attributes are uniqued in the
+/// context, which keeps the cache valid when ops are rewritten, cloned or have their Pauli product
+/// replaced.
+class PauliProductCache {
+  private:
+    llvm::DenseMap<mlir::ArrayAttr, llvm::SmallVector<uint8_t>> codes;
+
+  public:
+    /// Get the symplectic code of each Pauli operator of `pauliProduct`, with the X bit in bit 0
+    /// and the Z bit in bit 1.
+    llvm::ArrayRef<uint8_t> getCodes(mlir::ArrayAttr pauliProduct);
+
+    void clear() { codes.clear(); }
+};
+
+/// Pair of Pauli strings normalized to the same dense qubit numbering.
+using PackedPauliPair = std::pair<PackedPauliString, PackedPauliString>;
+
+/**
+ * @brief Pack the Pauli words of two ops over the union of their qubits, as in normalizePPROps.
+ *        Qubits are numbered densely in order of first appearance in `lhsQubits` then
+ *        `rhsQubits`, and the signs are taken from the rotation kind of PPRs and the negation of
+ *        PPMs.
+ *
+ * @param lhs PBCOpInterface of the left hand side
+ * @param rhs PBCOpInterface of the right hand side
+ * @param lhsQubits qubits on which the Pauli word of lhs acts, in order
+ * @param rhsQubits qubits on which the Pauli word of rhs acts, in order
+ * @param cache cache of the symplectic codes of the Pauli products
+ * @return PackedPauliPair of the normalized pair of Pauli strings
+ */
+PackedPauliPair packPPROps(PBCOpInterface lhs, PBCOpInterface rhs, mlir::ValueRange lhsQubits,
+                           mlir::ValueRange rhsQubits, PauliProductCache &cache);
+
+} // namespace pbc
+} // namespace catalyst
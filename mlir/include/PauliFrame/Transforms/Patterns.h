@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "mlir/Conversion/LLVMCommon/TypeConverter.h"
 #include "mlir/IR/PatternMatch.h"
 
 namespace catalyst {
@@ -21,5 +22,8 @@ namespace pauli_frame {
 
 void populateCliffordTToPauliFramePatterns(mlir::RewritePatternSet &patterns);
 
+void populateConversionPatterns(mlir::LLVMTypeConverter &typeConverter,
+                                mlir::RewritePatternSet &patterns);
+
 } // namespace pauli_frame
 } // namespace catalyst
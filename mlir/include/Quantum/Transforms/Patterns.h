@@ -21,6 +21,7 @@
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/PatternMatch.h"
+#include "mlir/Rewrite/FrozenRewritePatternSet.h"
 #include "mlir/Transforms/DialectConversion.h"
 
 namespace catalyst {
@@ -32,15 +33,37 @@ mlir::Value getGlobalString(mlir::Location loc, mlir::OpBuilder &rewriter, mlir:
                             mlir::StringRef value, mlir::ModuleOp mod);
 
 void populateGridsynthPatterns(mlir::RewritePatternSet &patterns, double epsilon, bool pprBasis);
+
+/// Solve the decompositions of the rotations of each block that the Gridsynth patterns rewrite
+/// with a single call to `rs_decomposition_solve_batch`, before the first one, when the angles
+/// of several of them are available there. Must run before the Gridsynth patterns.
+void batchGridsynthAngles(mlir::Operation *root, double epsilon, bool pprBasis);
 void populateQIRConversionPatterns(mlir::TypeConverter &, mlir::RewritePatternSet &, bool);
+
+/// Replace straight-line runs of QIR gate calls without modifiers by a single call to
+/// `__catalyst__qis__ApplyBatch`. Must run after the conversion to the LLVM dialect.
+void batchQIRGateCalls(mlir::Operation *root);
+
+/// Replace straight-line runs of independent QIR measurements by a single call to
+/// `__catalyst__qis__MeasureBits`. Must run after the conversion to the LLVM dialect.
+void batchQIRMeasureCalls(mlir::Operation *root);
 void populateAdjointPatterns(mlir::RewritePatternSet &);
 void populateCancelInversesPatterns(mlir::RewritePatternSet &);
+void populateCommutationCancellationPatterns(mlir::RewritePatternSet &);
 void populateMergeRotationsPatterns(mlir::RewritePatternSet &);
 void populateIonsDecompositionPatterns(mlir::RewritePatternSet &);
 void populateDecomposeLoweringPatterns(mlir::RewritePatternSet &,
                                        const llvm::StringMap<mlir::func::FuncOp> &,
                                        const llvm::StringSet<llvm::MallocAllocator> &);
 void populateLoopBoundaryPatterns(mlir::RewritePatternSet &, unsigned int mode);
+void populateLoopRotationFoldingPatterns(mlir::RewritePatternSet &);
+
+/// Apply the patterns to every op nested in the root once, in program order, erasing the gates
+/// that a rewrite leaves dead. Peephole patterns that rewrite a gate with its parent gate thus
+/// reduce each wire in a single pass, in time linear in the number of gates, leaving only the
+/// rewrites that the order does not expose to a greedy run.
+void applyPatternsInSingleSweep(mlir::Operation *root,
+                               const mlir::FrozenRewritePatternSet &patterns);
 
 } // namespace quantum
 } // namespace catalyst
@@ -21,13 +21,14 @@
 namespace catalyst {
 namespace quantum {
 
-// Create a Pauli product string ptr holding the Pauli word.
-mlir::Value getPauliProductPtr(mlir::Location loc, mlir::OpBuilder &rewriter, mlir::ModuleOp mod,
-                               mlir::ArrayAttr pauliProduct);
+// Create a ptr to the Pauli word packed into X and Z bit masks, shared by all the uses of the
+// same Pauli word in the module.
+mlir::Value getPackedPauliWordPtr(mlir::Location loc, mlir::OpBuilder &rewriter,
+                                  mlir::ModuleOp mod, mlir::ArrayAttr pauliProduct);
 
-// Helper for creating a call to `__catalyst__qis__PauliRot`.
+// Helper for creating a call to `__catalyst__qis__PackedPauliRot_array`.
 void createPauliRotCall(mlir::Location loc, mlir::ConversionPatternRewriter &rewriter,
-                        mlir::Operation *opForDecl, mlir::Value pauliWordPtr,
+                        mlir::Operation *opForDecl, mlir::Value pauliMasksPtr,
                         mlir::Value thetaValue, mlir::Value modifiersPtr, mlir::Value cond,
                         mlir::ValueRange inQubits);
 
@@ -0,0 +1,51 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/Interfaces/CallInterfaces.h"
+
+namespace catalyst {
+namespace quantum {
+
+/// Get the qnodes of `mod` and of its nested modules, in which the frontend lowers each qnode,
+/// e.g. `module_<name>`.
+llvm::SmallVector<mlir::func::FuncOp> getQnodes(mlir::ModuleOp mod);
+
+/// Get the calls of a qnode of `mod`, if they are its only uses: the `func.call` of a private qnode,
+/// or the `func.call` and `catalyst.launch_kernel` of a qnode of a nested module.
+std::optional<llvm::SmallVector<mlir::CallOpInterface>> getQnodeCalls(mlir::func::FuncOp funcOp,
+                                                                       mlir::ModuleOp mod);
+
+/// Create a call of `funcOp` with `operands` of the same kind as the qnode call `callOp`, with its
+/// discardable attributes.
+mlir::CallOpInterface createQnodeCall(mlir::OpBuilder &builder, mlir::CallOpInterface callOp,
+                                      mlir::func::FuncOp funcOp, mlir::ValueRange operands);
+
+/// Whether the only side effects of a qnode, in the functions it calls too, are those of quantum
+/// operations, so that it has no observable effect besides its results.
+bool hasOnlyQuantumEffects(mlir::func::FuncOp funcOp);
+
+/// Whether a qnode, in the functions it calls too, only runs analytic executions without
+/// mid-circuit measurements, so that its results only depend on its arguments.
+bool isDeterministicQnode(mlir::func::FuncOp funcOp);
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,86 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <complex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace catalyst {
+namespace quantum {
+
+using Complex = std::complex<double>;
+
+// Row-major 2x2 and 4x4 complex matrices. Two-qubit matrices act on the basis |q0 q1>, with the
+// first qubit as the most significant one.
+using Matrix2 = std::array<Complex, 4>;
+using Matrix4 = std::array<Complex, 16>;
+
+// Returns the matrix of a single-qubit gate with the given name and parameters, or std::nullopt if
+// the gate is not supported.
+std::optional<Matrix2> getSingleQubitGateMatrix(std::string_view name,
+                                                const std::vector<double> &params, bool adjoint);
+
+// Returns the matrix of a two-qubit gate with the given name and parameters, or std::nullopt if
+// the gate is not supported. Controlled gates are controlled by the first qubit.
+std::optional<Matrix4> getTwoQubitGateMatrix(std::string_view name,
+                                             const std::vector<double> &params, bool adjoint);
+
+// Returns the number of CNOTs needed to implement a supported two-qubit gate on its own.
+unsigned getTwoQubitGateCNOTCount(std::string_view name);
+
+// Returns the matrix of a single-qubit gate acting on one of the two qubits.
+Matrix4 embedSingleQubitGate(const Matrix2 &gate, unsigned wire);
+
+// Returns the product lhs * rhs.
+Matrix4 multiply(const Matrix4 &lhs, const Matrix4 &rhs);
+
+// A gate of a synthesized two-qubit circuit.
+struct SynthesizedGate {
+    enum class Kind { RZ, RY, CNOT };
+
+    Kind kind;
+    // The qubit a rotation acts on, or the control qubit of a CNOT
+    unsigned wire;
+    double angle;
+};
+
+// A two-qubit circuit of RZ, RY and CNOT gates, in time order, and a global phase `phase` such
+// that the unitary of the circuit is exp(i * phase) times the product of its gates.
+struct TwoQubitCircuit {
+    std::vector<SynthesizedGate> gates;
+    double phase = 0;
+    unsigned numCNOTs = 0;
+};
+
+// Synthesizes a circuit of RZ RY RZ rotations on the first qubit for a single-qubit unitary, with
+// the ZYZ decomposition. Returns std::nullopt if the matrix is not unitary.
+std::optional<TwoQubitCircuit> synthesizeSingleQubitUnitary(const Matrix2 &unitary,
+                                                            double tolerance = 1e-7);
+
+// Synthesizes a circuit for a two-qubit unitary with the minimal number of CNOTs (at most 3), using
+// the KAK (Cartan) decomposition U = K1 exp(i(a XX + b YY + c ZZ)) K2. The single-qubit layers are
+// decomposed into RZ RY RZ rotations.
+//
+// Coordinates and rotation angles within `tolerance` of a special value are snapped to it. Returns
+// std::nullopt if the matrix is not unitary, or if the synthesized circuit does not reproduce it
+// within `tolerance` in Frobenius norm.
+std::optional<TwoQubitCircuit> synthesizeTwoQubitUnitary(const Matrix4 &unitary,
+                                                         double tolerance = 1e-7);
+
+} // namespace quantum
+} // namespace catalyst
@@ -22,6 +22,7 @@
 #include "PBC/Transforms/Passes.h"
 #include "PauliFrame/Transforms/Passes.h"
 #include "QRef/Transforms/Passes.h"
+#include "QecPhysical/Transforms/Passes.h"
 #include "Quantum/Transforms/Passes.h"
 #include "RTIO/Transforms/Passes.h"
 #include "Test/Transforms/Passes.h"
@@ -39,6 +40,7 @@ inline void registerAllPasses()
     mitigation::registerMitigationPasses();
     pauli_frame::registerPauliFramePasses();
     pbc::registerPBCPasses();
+    qecp::registerQecPhysicalPasses();
     qref::registerQRefPasses();
     quantum::registerQuantumPasses();
     rtio::registerRTIOPasses();
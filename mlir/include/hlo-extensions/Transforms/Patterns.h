@@ -21,9 +21,11 @@
 namespace catalyst {
 namespace hlo_extensions {
 
-void populateScatterPatterns(mlir::RewritePatternSet &);
+void populateScatterPatterns(mlir::RewritePatternSet &, bool specializeUpdates);
 
 void populateHloCustomCallPatterns(mlir::RewritePatternSet &);
 
+void populateSmallLinalgPatterns(mlir::RewritePatternSet &, int64_t maxSize);
+
 } // namespace hlo_extensions
 } // namespace catalyst
@@ -0,0 +1,85 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Catalyst/Analysis/CostModel.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace llvm;
+
+namespace catalyst {
+
+double GateDurationTable::lookup(StringRef name) const
+{
+    auto it = durations.find(name);
+    return it != durations.end() ? it->getValue() : defaultDuration;
+}
+
+Expected<GateDurationTable> GateDurationTable::parse(ArrayRef<std::string> entries,
+                                                     double defaultDuration)
+{
+    GateDurationTable table;
+    table.defaultDuration = defaultDuration;
+
+    for (StringRef entry : entries) {
+        auto [name, value] = entry.split('=');
+        double duration = 0;
+        if (name.empty() || value.empty() || value.trim().getAsDouble(duration) || duration < 0) {
+            return createStringError(inconvertibleErrorCode(),
+                                     "invalid gate duration entry '%s', expected NAME=DURATION",
+                                     entry.str().c_str());
+        }
+        table.durations[name.trim()] = duration;
+    }
+    return table;
+}
+
+json::Object CostEstimate::toJson() const
+{
+    json::Object obj;
+    obj["shot_duration"] = shotDuration;
+    obj["shots"] = shots;
+    obj["total_duration"] = totalDuration;
+    obj["state_vector_bytes"] = stateVectorBytes;
+    return obj;
+}
+
+CostEstimate estimateCost(const ResourceResult &result, const GateDurationTable &table,
+                          int64_t shots)
+{
+    CostEstimate estimate;
+
+    // The resource counts carry no scheduling information, so the gates are assumed to be
+    // executed one after the other. This is an upper bound on the duration of a shot.
+    for (const auto &opEntry : result.operations) {
+        double duration = table.lookup(opEntry.getKey());
+        for (const auto &sizeEntry : opEntry.getValue()) {
+            estimate.shotDuration += duration * static_cast<double>(sizeEntry.second);
+        }
+    }
+
+    estimate.shots = shots;
+    estimate.totalDuration =
+        estimate.shotDuration * static_cast<double>(std::max<int64_t>(shots, 1));
+
+    constexpr int64_t amplitudeBytes = 16;
+    constexpr int64_t maxQubits = std::numeric_limits<int64_t>::digits - 5;
+    int64_t numQubits = result.numQubits();
+    estimate.stateVectorBytes = numQubits > maxQubits ? std::numeric_limits<int64_t>::max()
+                                                      : amplitudeBytes << numQubits;
+    return estimate;
+}
+
+} // namespace catalyst
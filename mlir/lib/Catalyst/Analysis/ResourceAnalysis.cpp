@@ -24,6 +24,7 @@
 #include "mlir/IR/Operation.h"
 
 #include "Catalyst/Analysis/ResourceResult.h"
+#include "Catalyst/Utils/SCFUtils.h"
 #include "MBQC/IR/MBQCOps.h"
 #include "PBC/IR/PBCOps.h"
 #include "Quantum/IR/QuantumOps.h"
@@ -182,18 +183,68 @@ ResourceAnalysis::ResourceAnalysis(Operation *op)
     entryFuncName = entryFunc.str();
 }
 
-void ResourceAnalysis::analyzeForLoop(scf::ForOp forOp, ResourceResult &result, bool isAdjoint)
+/// Check whether the bounds of a nested loop or the condition of a nested conditional depend on
+/// the induction variable of a loop, in which case the loop body must be analyzed per iteration.
+bool ResourceAnalysis::bodyDependsOnInductionVar(scf::ForOp forOp)
 {
-    ResourceResult bodyResult;
-    analyzeRegion(forOp.getBodyRegion(), bodyResult, isAdjoint);
+    Value iv = forOp.getInductionVar();
+    WalkResult walkResult = forOp.getBodyRegion().walk([&](Operation *op) {
+        SmallVector<Value, 3> controlValues;
+        if (auto nestedForOp = dyn_cast<scf::ForOp>(op)) {
+            controlValues = {nestedForOp.getLowerBound(), nestedForOp.getUpperBound(),
+                             nestedForOp.getStep()};
+        }
+        else if (auto ifOp = dyn_cast<scf::IfOp>(op)) {
+            controlValues = {ifOp.getCondition()};
+        }
+        else if (auto switchOp = dyn_cast<scf::IndexSwitchOp>(op)) {
+            controlValues = {switchOp.getArg()};
+        }
 
+        for (Value value : controlValues) {
+            if (dependsOnValue(value, iv)) {
+                return WalkResult::interrupt();
+            }
+        }
+        return WalkResult::advance();
+    });
+    return walkResult.wasInterrupted();
+}
+
+void ResourceAnalysis::analyzeForLoop(scf::ForOp forOp, ResourceResult &result, bool isAdjoint)
+{
     // estimated_iterations attribute
     if (auto estAttr = forOp->getAttrOfType<IntegerAttr>("estimated_iterations")) {
+        ResourceResult bodyResult;
+        analyzeRegion(forOp.getBodyRegion(), bodyResult, isAdjoint);
         int64_t iters = estAttr.getValue().getSExtValue();
         bodyResult.multiplyByScalar(iters);
+        result.mergeWith(bodyResult);
+        return;
     }
-    else if (auto tripCount = forOp.getStaticTripCount()) {
-        bodyResult.multiplyByScalar(tripCount->getSExtValue());
+
+    // The bounds may depend on the induction variables of the enclosing loops being enumerated
+    std::optional<int64_t> tripCount = getStaticTripCount(forOp, inductionValues);
+
+    // When nested bounds or conditions depend on the induction variable, analyze the body once
+    // per iteration (within a budget) so that triangular nests and conditionals are exact.
+    if (tripCount && *tripCount <= enumerationBudget && bodyDependsOnInductionVar(forOp)) {
+        enumerationBudget -= *tripCount;
+        Value iv = forOp.getInductionVar();
+        int64_t lowerBound = *evaluateStaticInt(forOp.getLowerBound(), inductionValues);
+        int64_t step = *evaluateStaticInt(forOp.getStep(), inductionValues);
+        for (int64_t i = 0; i < *tripCount; i++) {
+            inductionValues[iv] = lowerBound + i * step;
+            analyzeRegion(forOp.getBodyRegion(), result, isAdjoint);
+        }
+        inductionValues.erase(iv);
+        return;
+    }
+
+    ResourceResult bodyResult;
+    analyzeRegion(forOp.getBodyRegion(), bodyResult, isAdjoint);
+    if (tripCount) {
+        bodyResult.multiplyByScalar(*tripCount);
     }
     result.mergeWith(bodyResult);
 }
@@ -214,6 +265,12 @@ void ResourceAnalysis::analyzeWhileLoop(scf::WhileOp whileOp, ResourceResult &re
 
 void ResourceAnalysis::analyzeIfOp(scf::IfOp ifOp, ResourceResult &result, bool isAdjoint)
 {
+    // Only count the branch that is taken when the condition is static
+    if (auto condition = evaluateStaticInt(ifOp.getCondition(), inductionValues)) {
+        analyzeRegion(*condition ? ifOp.getThenRegion() : ifOp.getElseRegion(), result, isAdjoint);
+        return;
+    }
+
     ResourceResult thenResult;
     analyzeRegion(ifOp.getThenRegion(), thenResult, isAdjoint);
 
@@ -228,6 +285,20 @@ void ResourceAnalysis::analyzeIfOp(scf::IfOp ifOp, ResourceResult &result, bool
 void ResourceAnalysis::analyzeIndexSwitchOp(scf::IndexSwitchOp switchOp, ResourceResult &result,
                                             bool isAdjoint)
 {
+    // Only count the case that is taken when the argument is static
+    if (auto arg = evaluateStaticInt(switchOp.getArg(), inductionValues)) {
+        Region *takenRegion = &switchOp.getDefaultRegion();
+        for (auto [caseValue, caseRegion] :
+             llvm::zip(switchOp.getCases(), switchOp.getCaseRegions())) {
+            if (caseValue == *arg) {
+                takenRegion = &caseRegion;
+                break;
+            }
+        }
+        analyzeRegion(*takenRegion, result, isAdjoint);
+        return;
+    }
+
     ResourceResult maxResult;
     bool first = true;
 
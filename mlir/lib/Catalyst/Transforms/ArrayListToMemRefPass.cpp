@@ -1,7 +1,13 @@
+#include <algorithm>
+#include <optional>
+
+#include "llvm/Support/MathExtras.h"
+
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Transforms/DialectConversion.h"
 
@@ -17,6 +23,66 @@ namespace catalyst {
 
 namespace {
 
+/// The initial capacity of lists whose number of pushes is not known statically.
+constexpr int64_t defaultCapacity = 32;
+
+/**
+ * @brief Get the number of times that `op` is executed per execution of `ancestor`, or an upper
+ * bound on it, if all the loops between them have static trip counts.
+ */
+std::optional<int64_t> getStaticExecutionCount(Operation *op, Operation *ancestor)
+{
+    int64_t count = 1;
+    for (Operation *parent = op->getParentOp(); parent != ancestor;
+         parent = parent->getParentOp()) {
+        if (!parent) {
+            return std::nullopt;
+        }
+        if (isa<scf::IfOp, scf::IndexSwitchOp, scf::ExecuteRegionOp>(parent)) {
+            continue;
+        }
+        auto forOp = dyn_cast<scf::ForOp>(parent);
+        if (!forOp) {
+            return std::nullopt;
+        }
+        std::optional<int64_t> lb = getConstantIntValue(forOp.getLowerBound());
+        std::optional<int64_t> ub = getConstantIntValue(forOp.getUpperBound());
+        std::optional<int64_t> step = getConstantIntValue(forOp.getStep());
+        if (!lb || !ub || !step || *step <= 0) {
+            return std::nullopt;
+        }
+        int64_t tripCount = *ub > *lb ? llvm::divideCeil(*ub - *lb, *step) : 0;
+        if (llvm::MulOverflow(count, tripCount, count)) {
+            return std::nullopt;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Get the initial capacity of a list from the number of pushes to it, if the list does not
+ * escape and all of its pushes are in loops with static trip counts. Branches are assumed to be
+ * taken, so that the capacity may be larger than the final size but the list is never reallocated.
+ */
+int64_t getCapacityHint(ListInitOp op)
+{
+    int64_t numPushes = 0;
+    for (Operation *user : op.getList().getUsers()) {
+        if (isa<ListPopOp, ListLoadDataOp, ListDeallocOp>(user)) {
+            continue;
+        }
+        if (!isa<ListPushOp>(user)) {
+            return defaultCapacity;
+        }
+        std::optional<int64_t> count = getStaticExecutionCount(user, op->getParentOp());
+        if (!count || llvm::AddOverflow(numPushes, *count, numPushes)) {
+            return defaultCapacity;
+        }
+    }
+    // The capacity is doubled on growth, which must not stay empty
+    return std::max<int64_t>(numPushes, 1);
+}
+
 /**
  * A utility builder that aids in lowering dynamically-resizable array lists.
  *
@@ -166,7 +232,8 @@ struct LowerListInit : public OpConversionPattern<ListInitOp> {
             op.emitError() << "Failed to convert type " << op.getType();
             return failure();
         }
-        Value capacity = arith::ConstantIndexOp::create(rewriter, op.getLoc(), 32);
+        Value capacity =
+            arith::ConstantIndexOp::create(rewriter, op.getLoc(), getCapacityHint(op));
         Value initialSize = arith::ConstantIndexOp::create(rewriter, op.getLoc(), 0);
         auto dataType = cast<MemRefType>(resultTypes[0]);
         auto sizeType = cast<MemRefType>(resultTypes[1]);
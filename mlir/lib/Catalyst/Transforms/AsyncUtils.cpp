@@ -45,6 +45,8 @@ static constexpr llvm::StringRef mlirAsyncRuntimeIsValueErrorName = "mlirAsyncRu
 static constexpr llvm::StringRef mlirAsyncRuntimeAwaitTokenName = "mlirAsyncRuntimeAwaitToken";
 static constexpr llvm::StringRef mlirAsyncRuntimeAwaitValueName = "mlirAsyncRuntimeAwaitValue";
 static constexpr llvm::StringRef mlirAsyncRuntimeDropRefName = "mlirAsyncRuntimeDropRef";
+static constexpr llvm::StringRef mlirAsyncRuntimeExecuteName = "mlirAsyncRuntimeExecute";
+static constexpr llvm::StringRef asyncExecuteName = "__catalyst__rt__async_execute";
 
 }; // namespace AsyncUtilsConstants
 
@@ -166,6 +168,16 @@ LLVM::LLVMFuncOp AsyncUtils::lookupOrCreateAwaitValueName(OpBuilder &b, ModuleOp
         .value();
 }
 
+LLVM::LLVMFuncOp AsyncUtils::lookupOrCreateAsyncExecute(OpBuilder &b, ModuleOp moduleOp)
+{
+    MLIRContext *ctx = moduleOp.getContext();
+    Type ptrTy = LLVM::LLVMPointerType::get(moduleOp.getContext());
+    auto voidTy = LLVM::LLVMVoidType::get(ctx);
+    return mlir::LLVM::lookupOrCreateFn(b, moduleOp, AsyncUtilsConstants::asyncExecuteName,
+                                        {ptrTy, ptrTy}, voidTy)
+        .value();
+}
+
 LLVM::LLVMFuncOp AsyncUtils::lookupOrCreateDropRef(OpBuilder &b, ModuleOp moduleOp)
 {
     MLIRContext *ctx = moduleOp.getContext();
@@ -235,6 +247,11 @@ bool AsyncUtils::isMlirAsyncRuntimeCreateValue(LLVM::LLVMFuncOp funcOp)
                                        AsyncUtilsConstants::mlirAsyncRuntimeCreateValueName);
 }
 
+bool AsyncUtils::isMlirAsyncRuntimeExecute(LLVM::LLVMFuncOp funcOp)
+{
+    return AsyncUtils::isFunctionNamed(funcOp, AsyncUtilsConstants::mlirAsyncRuntimeExecuteName);
+}
+
 bool AsyncUtils::isMlirAsyncRuntimeCreateToken(LLVM::LLVMFuncOp funcOp)
 {
     return AsyncUtils::isFunctionNamed(funcOp,
@@ -277,6 +294,16 @@ bool AsyncUtils::callsMlirAsyncRuntimeCreateToken(LLVM::CallOp callOp)
     return AsyncUtils::isMlirAsyncRuntimeCreateToken(callee);
 }
 
+bool AsyncUtils::callsMlirAsyncRuntimeExecute(LLVM::CallOp callOp)
+{
+    auto maybeCallee = AsyncUtils::getCalleeSafe(callOp);
+    if (!maybeCallee)
+        return false;
+
+    auto callee = maybeCallee.value();
+    return AsyncUtils::isMlirAsyncRuntimeExecute(callee);
+}
+
 bool AsyncUtils::callsMlirAsyncRuntimeCreateValue(LLVM::CallOp callOp)
 {
     auto maybeCallee = AsyncUtils::getCalleeSafe(callOp);
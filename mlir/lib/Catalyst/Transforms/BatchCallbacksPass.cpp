@@ -0,0 +1,288 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "batch-callbacks"
+
+#include <optional>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/FormatVariadic.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Transforms/RegionUtils.h"
+
+#include "Catalyst/IR/CatalystOps.h"
+#include "Catalyst/Transforms/Passes.h"
+
+using namespace mlir;
+using namespace catalyst;
+
+namespace {
+
+/// The number of iterations of a loop with constant bounds.
+std::optional<int64_t> getConstantTripCount(scf::ForOp forOp)
+{
+    std::optional<int64_t> lb = getConstantIntValue(forOp.getLowerBound());
+    std::optional<int64_t> ub = getConstantIntValue(forOp.getUpperBound());
+    std::optional<int64_t> step = getConstantIntValue(forOp.getStep());
+    if (!lb || !ub || !step || *step <= 0) {
+        return std::nullopt;
+    }
+    return *ub > *lb ? (*ub - *lb + *step - 1) / *step : 0;
+}
+
+/// The position of the iteration `iv` of a loop, counting from 0.
+Value getIterationIndex(OpBuilder &builder, Location loc, scf::ForOp forOp, Value iv)
+{
+    Value offset = arith::SubIOp::create(builder, loc, iv, forOp.getLowerBound());
+    return arith::DivUIOp::create(builder, loc, offset, forOp.getStep());
+}
+
+RankedTensorType getStackedType(RankedTensorType type, int64_t batchSize)
+{
+    SmallVector<int64_t> shape = {batchSize};
+    llvm::append_range(shape, type.getShape());
+    return RankedTensorType::get(shape, type.getElementType());
+}
+
+/// The offsets, sizes and strides of the `index`-th slice of a stacked tensor of slices of
+/// type `type`.
+void getSliceParameters(OpBuilder &builder, Value index, RankedTensorType type,
+                        SmallVectorImpl<OpFoldResult> &offsets,
+                        SmallVectorImpl<OpFoldResult> &sizes,
+                        SmallVectorImpl<OpFoldResult> &strides)
+{
+    offsets.assign(type.getRank() + 1, builder.getIndexAttr(0));
+    offsets[0] = index;
+    sizes.assign({builder.getIndexAttr(1)});
+    for (int64_t dim : type.getShape()) {
+        sizes.push_back(builder.getIndexAttr(dim));
+    }
+    strides.assign(type.getRank() + 1, builder.getIndexAttr(1));
+}
+
+/// A callback can be batched if all its arguments and results are statically shaped tensors, and
+/// it is only ever called, as opposed to e.g. differentiated with a custom gradient.
+bool isBatchable(CallbackOp callbackOp, ModuleOp mod)
+{
+    if (callbackOp.getBatched() || callbackOp.getResultTypes().empty()) {
+        return false;
+    }
+    auto isStaticTensor = [](Type type) {
+        auto tensorType = dyn_cast<RankedTensorType>(type);
+        return tensorType && tensorType.hasStaticShape();
+    };
+    if (!llvm::all_of(callbackOp.getArgumentTypes(), isStaticTensor) ||
+        !llvm::all_of(callbackOp.getResultTypes(), isStaticTensor)) {
+        return false;
+    }
+    std::optional<SymbolTable::UseRange> uses = SymbolTable::getSymbolUses(callbackOp, mod);
+    return uses && llvm::all_of(*uses, [](const SymbolTable::SymbolUse &use) {
+               return isa<CallbackCallOp>(use.getUser());
+           });
+}
+
+/// Collect, in order, the operations of the loop body computing the arguments of `callOp`. They
+/// must be pure, and may only depend on the induction variable and on values defined above the
+/// loop, so that they can be computed for all iterations ahead of the loop.
+LogicalResult collectArgumentSlice(scf::ForOp forOp, CallbackCallOp callOp,
+                                   SmallVectorImpl<Operation *> &slice)
+{
+    Block *body = forOp.getBody();
+    llvm::SmallPtrSet<Operation *, 8> visited;
+    SmallVector<Value> worklist(callOp.getInputs());
+    while (!worklist.empty()) {
+        Value value = worklist.pop_back_val();
+        if (auto arg = dyn_cast<BlockArgument>(value)) {
+            if (arg.getOwner() == body && arg != forOp.getInductionVar()) {
+                return failure();
+            }
+            continue;
+        }
+        Operation *op = value.getDefiningOp();
+        if (op->getBlock() != body || !visited.insert(op).second) {
+            continue;
+        }
+        if (!isMemoryEffectFree(op)) {
+            return failure();
+        }
+        llvm::append_range(worklist, op->getOperands());
+
+        // The regions of the operation, e.g. of a linalg.generic, may use values of the loop body
+        llvm::SetVector<Value> capturedValues;
+        getUsedValuesDefinedAbove(op->getRegions(), capturedValues);
+        llvm::append_range(worklist, capturedValues);
+    }
+
+    for (Operation &op : *body) {
+        if (visited.contains(&op)) {
+            slice.push_back(&op);
+        }
+    }
+    return success();
+}
+
+CallbackOp getOrCreateBatchedCallback(IRRewriter &rewriter, SymbolTable &symbolTable,
+                                      CallbackOp callbackOp, int64_t batchSize)
+{
+    std::string name = llvm::formatv("{0}_batch_{1}", callbackOp.getSymName(), batchSize).str();
+    if (auto batched = symbolTable.lookup<CallbackOp>(name)) {
+        return batched;
+    }
+
+    SmallVector<Type> inputs, results;
+    for (Type type : callbackOp.getArgumentTypes()) {
+        inputs.push_back(getStackedType(cast<RankedTensorType>(type), batchSize));
+    }
+    for (Type type : callbackOp.getResultTypes()) {
+        results.push_back(getStackedType(cast<RankedTensorType>(type), batchSize));
+    }
+
+    OpBuilder::InsertionGuard guard(rewriter);
+    rewriter.setInsertionPointAfter(callbackOp);
+    auto batched = CallbackOp::create(rewriter, callbackOp.getLoc(), name,
+                                      rewriter.getFunctionType(inputs, results));
+    batched.setId(callbackOp.getId());
+    batched.setBatched(true);
+    symbolTable.insert(batched);
+    return batched;
+}
+
+/**
+ * @brief Replace a callback call in a loop by a single batched call ahead of the loop.
+ *
+ * The arguments of every iteration are computed by a new loop and stacked, and each iteration of
+ * the original loop extracts its results from the stacked results of the batched call.
+ */
+void batchCallbackCall(IRRewriter &rewriter, SymbolTable &symbolTable, scf::ForOp forOp,
+                       CallbackCallOp callOp, CallbackOp callbackOp, int64_t batchSize)
+{
+    SmallVector<Operation *> slice;
+    if (failed(collectArgumentSlice(forOp, callOp, slice))) {
+        return;
+    }
+
+    CallbackOp batched = getOrCreateBatchedCallback(rewriter, symbolTable, callbackOp, batchSize);
+    Location loc = callOp.getLoc();
+
+    rewriter.setInsertionPoint(forOp);
+    SmallVector<Value> inits;
+    for (Type type : batched.getArgumentTypes()) {
+        auto stackedType = cast<RankedTensorType>(type);
+        inits.push_back(tensor::EmptyOp::create(rewriter, loc, stackedType.getShape(),
+                                                stackedType.getElementType()));
+    }
+    auto stackArgs = [&](OpBuilder &builder, Location bodyLoc, Value iv, ValueRange stacked) {
+        IRMapping mapping;
+        mapping.map(forOp.getInductionVar(), iv);
+        for (Operation *op : slice) {
+            builder.clone(*op, mapping);
+        }
+
+        Value index = getIterationIndex(builder, bodyLoc, forOp, iv);
+        SmallVector<Value> updated;
+        for (auto [input, dest] : llvm::zip_equal(callOp.getInputs(), stacked)) {
+            SmallVector<OpFoldResult> offsets, sizes, strides;
+            getSliceParameters(builder, index, cast<RankedTensorType>(input.getType()), offsets,
+                               sizes, strides);
+            Value source = mapping.lookupOrDefault(input);
+            updated.push_back(tensor::InsertSliceOp::create(builder, bodyLoc, source, dest, offsets,
+                                                            sizes, strides)
+                                  .getResult());
+        }
+        scf::YieldOp::create(builder, bodyLoc, updated);
+    };
+    auto stackLoop = scf::ForOp::create(rewriter, loc, forOp.getLowerBound(),
+                                        forOp.getUpperBound(), forOp.getStep(), inits, stackArgs);
+    auto batchedCall = CallbackCallOp::create(
+        rewriter, loc, batched.getResultTypes(), FlatSymbolRefAttr::get(batched.getSymNameAttr()),
+        stackLoop.getResults(), /*arg_attrs=*/nullptr, /*res_attrs=*/nullptr);
+
+    rewriter.setInsertionPoint(callOp);
+    Value index = getIterationIndex(rewriter, loc, forOp, forOp.getInductionVar());
+    SmallVector<Value> results;
+    for (auto [result, stacked] : llvm::zip_equal(callOp.getResults(), batchedCall.getResults())) {
+        auto type = cast<RankedTensorType>(result.getType());
+        SmallVector<OpFoldResult> offsets, sizes, strides;
+        getSliceParameters(rewriter, index, type, offsets, sizes, strides);
+        results.push_back(
+            tensor::ExtractSliceOp::create(rewriter, loc, type, stacked, offsets, sizes, strides)
+                .getResult());
+    }
+    rewriter.replaceOp(callOp, results);
+
+    // The arguments are now only computed ahead of the loop, unless the loop uses them otherwise
+    for (Operation *op : llvm::reverse(slice)) {
+        if (op->use_empty()) {
+            rewriter.eraseOp(op);
+        }
+    }
+}
+
+} // namespace
+
+namespace catalyst {
+
+#define GEN_PASS_DEF_BATCHCALLBACKSPASS
+#include "Catalyst/Transforms/Passes.h.inc"
+
+struct BatchCallbacksPass : impl::BatchCallbacksPassBase<BatchCallbacksPass> {
+    using BatchCallbacksPassBase::BatchCallbacksPassBase;
+
+    void runOnOperation() final
+    {
+        ModuleOp mod = getOperation();
+        SymbolTable symbolTable(mod);
+
+        SmallVector<CallbackCallOp> calls;
+        mod.walk([&](CallbackCallOp callOp) {
+            if (isa<scf::ForOp>(callOp->getParentOp())) {
+                calls.push_back(callOp);
+            }
+        });
+
+        llvm::DenseMap<Operation *, bool> batchable;
+        IRRewriter rewriter(&getContext());
+        for (CallbackCallOp callOp : calls) {
+            auto callbackOp = symbolTable.lookup<CallbackOp>(callOp.getCallee());
+            if (!callbackOp) {
+                continue;
+            }
+            auto [it, inserted] = batchable.try_emplace(callbackOp.getOperation(), false);
+            if (inserted) {
+                it->second = isBatchable(callbackOp, mod);
+            }
+            auto forOp = cast<scf::ForOp>(callOp->getParentOp());
+            std::optional<int64_t> batchSize = getConstantTripCount(forOp);
+            if (!it->second || !batchSize || *batchSize < 2) {
+                continue;
+            }
+            batchCallbackCall(rewriter, symbolTable, forOp, callOp, callbackOp, *batchSize);
+        }
+    }
+};
+
+} // namespace catalyst
@@ -658,6 +658,91 @@ class BufferDeallocation : public BufferPlacementTransformationBase {
     AliasAllocationMapT aliasToAllocations;
 };
 
+//===----------------------------------------------------------------------===//
+// Straight-line buffer deallocation
+//===----------------------------------------------------------------------===//
+
+/// Checks whether the buffers of the given function can be deallocated without
+/// the dominance and liveness analyses. This is the case if the function body
+/// is a single block holding all allocations, nested regions have a single
+/// block, and no buffer flows into a block argument or out of a region. Then no
+/// clone is required, and each dealloc directly follows the last use of the
+/// aliases of its allocation in the body.
+bool isStraightLine(func::FuncOp funcOp, BufferPlacementAllocs &allocs,
+                    BufferViewFlowAnalysis &aliases)
+{
+    Block *body = &funcOp.getBody().front();
+    if (!funcOp.getBody().hasOneBlock())
+        return false;
+
+    WalkResult result = funcOp.walk([&](Operation *op) {
+        if (op == funcOp || op->getNumRegions() == 0)
+            return WalkResult::advance();
+        bool singleBlockRegions = llvm::all_of(op->getRegions(), [](Region &region) {
+            return region.empty() || region.hasOneBlock();
+        });
+        bool memrefResults = llvm::any_of(op->getResultTypes(), llvm::IsaPred<BaseMemRefType>);
+        if (!singleBlockRegions || memrefResults)
+            return WalkResult::interrupt();
+        return WalkResult::advance();
+    });
+    if (result.wasInterrupted())
+        return false;
+
+    return llvm::all_of(allocs, [&](const BufferPlacementAllocs::AllocEntry &entry) {
+        Value alloc = std::get<0>(entry);
+        return alloc.getParentBlock() == body &&
+               llvm::none_of(aliases.resolve(alloc), llvm::IsaPred<BlockArgument>);
+    });
+}
+
+/// Places the deallocs of a function accepted by `isStraightLine` in a single
+/// sweep over the uses of the aliases of each allocation.
+LogicalResult placeStraightLineDeallocs(func::FuncOp funcOp, BufferPlacementAllocs &allocs,
+                                        BufferViewFlowAnalysis &aliases)
+{
+    Block *body = &funcOp.getBody().front();
+    for (const BufferPlacementAllocs::AllocEntry &entry : allocs) {
+        Value alloc = std::get<0>(entry);
+        Operation *deallocOperation = std::get<1>(entry);
+        auto allocationInterface = alloc.getDefiningOp<bufferization::AllocationOpInterface>();
+        if (!deallocOperation && !allocationInterface) {
+            return alloc.getDefiningOp()->emitError(
+                "Allocation is not deallocated explicitly nor does the operation "
+                "implement the AllocationOpInterface.");
+        }
+
+        // The dealloc follows the definitions and the uses of all aliases, or
+        // rather the operations of the body that hold them.
+        Operation *endOperation = alloc.getDefiningOp();
+        auto extendTo = [&](Operation *op) {
+            Operation *ancestor = body->findAncestorOpInBlock(*op);
+            if (ancestor && endOperation->isBeforeInBlock(ancestor))
+                endOperation = ancestor;
+        };
+        for (Value alias : aliases.resolve(alloc)) {
+            extendTo(alias.getDefiningOp());
+            for (Operation *user : alias.getUsers())
+                extendTo(user);
+        }
+
+        if (deallocOperation) {
+            deallocOperation->moveAfter(endOperation);
+            continue;
+        }
+
+        // If the last use is the terminator, the buffer escapes the function.
+        Operation *nextOp = endOperation->getNextNode();
+        if (!nextOp)
+            continue;
+        OpBuilder builder(nextOp);
+        if (!allocationInterface.buildDealloc(builder, alloc))
+            return nextOp->emitError() << "allocations without compatible deallocations are "
+                                          "not supported";
+    }
+    return success();
+}
+
 //===----------------------------------------------------------------------===//
 // BufferDeallocationPass
 //===----------------------------------------------------------------------===//
@@ -684,6 +769,18 @@ struct BufferDeallocationPass
             return success(!result.wasInterrupted());
         }
 
+        // Most functions are straight-line code, for which the deallocs can be
+        // placed without the dominance and liveness analyses below.
+        if (auto funcOp = dyn_cast<func::FuncOp>(op)) {
+            BufferPlacementAllocs allocs(funcOp);
+            BufferViewFlowAnalysis aliases(funcOp);
+            if (isStraightLine(funcOp, allocs, aliases)) {
+                if (!validateSupportedControlFlow(op))
+                    return failure();
+                return placeStraightLineDeallocs(funcOp, allocs, aliases);
+            }
+        }
+
         // Ensure that there are supported loops only.
         Backedges backedges(op);
         if (backedges.size()) {
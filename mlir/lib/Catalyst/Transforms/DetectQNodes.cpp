@@ -34,6 +34,8 @@ void collectResultsForMlirAsyncRuntimeErrorFunctions(SmallVector<Value> &values,
 void collectPotentialConditions(SmallVector<Value> &values, SmallVector<Value> &conditions);
 void collectSuccessorBlocks(SmallVector<Value> &conditions, SmallVector<Block *> &aborts,
                             SmallVector<Block *> &success);
+void setUnlikelyAbortBranchWeights(SmallVector<Value> &conditions, PatternRewriter &rewriter);
+void markFunctionCold(LLVM::LLVMFuncOp funcOp, PatternRewriter &rewriter);
 void collectPutsBlocks(SmallVector<Value> &conditions, SmallVector<Block *> &puts);
 void collectCallsToAbortInBlocks(SmallVector<Block *> &blocks, SmallVector<LLVM::CallOp> &calls);
 void removeCallsToPutsInBlocks(SmallVector<Block *> &blocks, PatternRewriter &rewriter);
@@ -261,9 +263,17 @@ LogicalResult AddExceptionHandlingTransform::matchAndRewrite(LLVM::CallOp callOp
  * catalyst.preHandleError }
  */
 struct RemoveAbortAndPutsInsertCallTransform : public OpRewritePattern<LLVM::CallOp> {
-    using OpRewritePattern<LLVM::CallOp>::OpRewritePattern;
+    RemoveAbortAndPutsInsertCallTransform(MLIRContext *context, bool coldErrorPaths)
+        : OpRewritePattern<LLVM::CallOp>(context), coldErrorPaths(coldErrorPaths)
+    {
+    }
 
     LogicalResult matchAndRewrite(LLVM::CallOp op, PatternRewriter &rewriter) const override;
+
+  private:
+    // Whether the branches into the abort blocks are weighted as unlikely, and the runtime error
+    // function is marked cold.
+    bool coldErrorPaths;
 };
 
 // In this pattern we are looking for function calls to functions annotated
@@ -359,6 +369,16 @@ RemoveAbortAndPutsInsertCallTransform::matchAndRewrite(LLVM::CallOp callOp,
     SmallVector<Block *> successBlocks;
     collectSuccessorBlocks(potentialConditions, abortBlocks, successBlocks);
 
+    // An error is the exception. With cold error paths, the branches into the abort blocks are
+    // weighted as unlikely, so that the awaits of the asynchronous qnodes only pay for a
+    // predicted branch when no qnode fails, and the error handling is moved out of the way.
+    //
+    //     llvm.cond_br %5 weights([1, 2000]), ^bb0, ^bb1
+    if (coldErrorPaths) {
+        setUnlikelyAbortBranchWeights(potentialConditions, rewriter);
+        markFunctionCold(unrecoverableError, rewriter);
+    }
+
     // We now collect the aborts from the abort blocks.
     // aborts = { llvm.call @llvm.abort, ..., ..., ... }
     SmallVector<LLVM::CallOp> aborts;
@@ -587,6 +607,32 @@ LogicalResult BranchToUnreachableTransform::matchAndRewrite(LLVM::BrOp candidate
     return success();
 }
 
+// Finally, async.execute regions are scheduled on the Catalyst runtime executor instead of the
+// default MLIR async runtime thread pool. The executor bounds the number of worker threads and
+// the number of device instances that the concurrently executing QNodes may hold.
+//
+//     llvm.call @mlirAsyncRuntimeExecute(%handle, %resume) : (!llvm.ptr, !llvm.ptr) -> ()
+//
+// becomes
+//
+//     llvm.call @__catalyst__rt__async_execute(%handle, %resume) : (!llvm.ptr, !llvm.ptr) -> ()
+struct RedirectAsyncExecuteTransform : public OpRewritePattern<LLVM::CallOp> {
+    using OpRewritePattern<LLVM::CallOp>::OpRewritePattern;
+    LogicalResult matchAndRewrite(LLVM::CallOp op, PatternRewriter &rewriter) const override;
+};
+
+LogicalResult RedirectAsyncExecuteTransform::matchAndRewrite(LLVM::CallOp candidate,
+                                                             PatternRewriter &rewriter) const
+{
+    if (!AsyncUtils::callsMlirAsyncRuntimeExecute(candidate))
+        return failure();
+
+    auto moduleOp = candidate->getParentOfType<ModuleOp>();
+    auto executeFn = AsyncUtils::lookupOrCreateAsyncExecute(rewriter, moduleOp);
+    rewriter.replaceOpWithNewOp<LLVM::CallOp>(candidate, executeFn, candidate.getArgOperands());
+    return success();
+}
+
 // TODO:
 // This is not over yet though.
 // Because we can have the following situation.
@@ -670,6 +716,42 @@ void collectSuccessorBlocks(SmallVector<Value> &conditions, SmallVector<Block *>
     }
 }
 
+void setUnlikelyAbortBranchWeights(SmallVector<Value> &conditions, PatternRewriter &rewriter)
+{
+    // The weights of llvm.expect, with which LLVM marks a branch as (un)likely.
+    constexpr int32_t unlikelyWeight = 1;
+    constexpr int32_t likelyWeight = 2000;
+    for (auto condition : conditions) {
+        for (Operation *user : condition.getUsers()) {
+            if (isa<LLVM::CondBrOp>(user)) {
+                LLVM::CondBrOp brOp = cast<LLVM::CondBrOp>(user);
+                bool abortIsTrueDest = AsyncUtils::hasAbortInBlock(brOp.getTrueDest());
+                SmallVector<int32_t, 2> weights =
+                    abortIsTrueDest ? SmallVector<int32_t, 2>{unlikelyWeight, likelyWeight}
+                                    : SmallVector<int32_t, 2>{likelyWeight, unlikelyWeight};
+                rewriter.modifyOpInPlace(brOp, [&] {
+                    brOp.setBranchWeightsAttr(rewriter.getDenseI32ArrayAttr(weights));
+                });
+            }
+        }
+    }
+}
+
+void markFunctionCold(LLVM::LLVMFuncOp funcOp, PatternRewriter &rewriter)
+{
+    SmallVector<Attribute> passthroughs;
+    if (auto passthroughAttr = funcOp.getPassthroughAttr()) {
+        passthroughs.append(passthroughAttr.begin(), passthroughAttr.end());
+    }
+    auto coldAttr = rewriter.getStringAttr("cold");
+    if (llvm::is_contained(passthroughs, coldAttr)) {
+        return;
+    }
+    passthroughs.push_back(coldAttr);
+    rewriter.modifyOpInPlace(
+        funcOp, [&] { funcOp.setPassthroughAttr(rewriter.getArrayAttr(passthroughs)); });
+}
+
 void collectPutsBlocks(SmallVector<Value> &conditions, SmallVector<Block *> &puts)
 {
     for (auto condition : conditions) {
@@ -939,7 +1021,7 @@ struct AddExceptionHandlingPass : impl::AddExceptionHandlingPassBase<AddExceptio
         }
 
         RewritePatternSet patterns3(context);
-        patterns3.add<RemoveAbortAndPutsInsertCallTransform>(context);
+        patterns3.add<RemoveAbortAndPutsInsertCallTransform>(context, coldErrorPaths);
         if (failed(applyPatternsGreedily(getOperation(), std::move(patterns3), config))) {
             signalPassFailure();
         }
@@ -963,6 +1045,16 @@ struct AddExceptionHandlingPass : impl::AddExceptionHandlingPassBase<AddExceptio
         if (failed(applyPatternsGreedily(getOperation(), std::move(patterns5), config))) {
             signalPassFailure();
         }
+
+        if (stopAfterStep == 5) {
+            return;
+        }
+
+        RewritePatternSet patterns6(context);
+        patterns6.add<RedirectAsyncExecuteTransform>(context);
+        if (failed(applyPatternsGreedily(getOperation(), std::move(patterns6), config))) {
+            signalPassFailure();
+        }
     }
 };
 
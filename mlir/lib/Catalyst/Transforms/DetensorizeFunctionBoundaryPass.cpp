@@ -8,6 +8,7 @@
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 
 #include "Catalyst/IR/CatalystDialect.h"
+#include "Catalyst/Utils/CallGraph.h"
 
 using namespace llvm;
 using namespace mlir;
@@ -47,8 +48,37 @@ bool hasScalarTensorSignature(func::FuncOp funcOp)
     return false;
 }
 
+/// Get the functions that are reachable from the functions referenced by other ops than calls,
+/// such as the gradient ops, whose lowering relies on the tensor signatures of the QNodes.
+DenseSet<Operation *> getOpaquelyReachedFunctions(Operation *root)
+{
+    SymbolTableCollection symbolTable;
+    DenseSet<Operation *> reached;
+    std::optional<SymbolTable::UseRange> uses = SymbolTable::getSymbolUses(root);
+    if (!uses) {
+        return reached;
+    }
+    for (const SymbolTable::SymbolUse &use : *uses) {
+        if (isa<func::CallOp>(use.getUser())) {
+            continue;
+        }
+        auto funcOp =
+            symbolTable.lookupNearestSymbolFrom<func::FuncOp>(use.getUser(), use.getSymbolRef());
+        if (funcOp && !reached.contains(funcOp)) {
+            traverseCallGraph(funcOp, &symbolTable,
+                              [&](func::FuncOp reachedOp) { reached.insert(reachedOp); });
+        }
+    }
+    return reached;
+}
+
 struct DetensorizeCallSitePattern : public OpRewritePattern<func::CallOp> {
-    using OpRewritePattern<func::CallOp>::OpRewritePattern;
+    const DenseSet<Operation *> &opaquelyReached;
+
+    DetensorizeCallSitePattern(MLIRContext *context, const DenseSet<Operation *> &opaquelyReached)
+        : OpRewritePattern<func::CallOp>(context), opaquelyReached(opaquelyReached)
+    {
+    }
 
     LogicalResult matchAndRewrite(func::CallOp callOp, PatternRewriter &rewriter) const override
     {
@@ -64,10 +94,10 @@ struct DetensorizeCallSitePattern : public OpRewritePattern<func::CallOp> {
             return failure();
         }
 
-        // Skip for QNodes
+        // Skip for QNodes that may be differentiated
         // Some Gradient boundaries only work for Tensor signatures
         // and not scalar ones, hence we skip them here.
-        if (funcOp->hasAttr("qnode")) {
+        if (funcOp->hasAttr("qnode") && opaquelyReached.contains(funcOp)) {
             return failure();
         }
 
@@ -223,7 +253,8 @@ struct DetensorizeFunctionBoundaryPass
         MLIRContext *context = &getContext();
         RewritePatternSet patterns(context);
 
-        patterns.add<DetensorizeCallSitePattern>(context);
+        DenseSet<Operation *> opaquelyReached = getOpaquelyReachedFunctions(getOperation());
+        patterns.add<DetensorizeCallSitePattern>(context, opaquelyReached);
 
         GreedyRewriteConfig config;
         if (failed(applyPatternsGreedily(getOperation(), std::move(patterns), config))) {
@@ -199,6 +199,74 @@ struct DetensorizeIfOp : public OpRewritePattern<scf::IfOp> {
     }
 };
 
+struct DetensorizeIndexSwitchOp : public OpRewritePattern<scf::IndexSwitchOp> {
+    using OpRewritePattern<scf::IndexSwitchOp>::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(scf::IndexSwitchOp switchOp,
+                                  PatternRewriter &rewriter) const override
+    {
+        // Early exit if there are no results that could be replaced.
+        if (!hasScalarTensorResult(switchOp)) {
+            return failure();
+        }
+
+        // 1. Extract tensor elements before the yield op of each case
+        for (Region &region : switchOp->getRegions()) {
+            auto yieldOp = cast<scf::YieldOp>(region.front().getTerminator());
+            OpBuilder::InsertionGuard g(rewriter);
+            rewriter.setInsertionPoint(yieldOp);
+            for (const auto &it : llvm::enumerate(yieldOp.getOperands())) {
+                Value operand = it.value();
+                if (isScalarTensor(operand)) {
+                    Value value = tensor::ExtractOp::create(rewriter, yieldOp->getLoc(), operand,
+                                                            ValueRange{});
+                    yieldOp.setOperand(it.index(), value);
+                }
+            }
+        }
+
+        // Collect the types for the new IndexSwitchOp
+        SmallVector<Type> newResultTypes;
+        for (auto result : switchOp->getResults()) {
+            if (isScalarTensor(result)) {
+                newResultTypes.push_back(cast<TensorType>(result.getType()).getElementType());
+                continue;
+            }
+            newResultTypes.push_back(result.getType());
+        }
+
+        // 2. Create the new IndexSwitchOp
+        OpBuilder::InsertionGuard switchOpInsertionGuard(rewriter);
+        rewriter.setInsertionPoint(switchOp);
+        auto newSwitchOp = scf::IndexSwitchOp::create(
+            rewriter, switchOp.getLoc(), newResultTypes, switchOp.getArg(), switchOp.getCases(),
+            switchOp.getNumCases());
+        for (auto regions : llvm::zip(newSwitchOp->getRegions(), switchOp->getRegions())) {
+            std::get<0>(regions).takeBody(std::get<1>(regions));
+        }
+
+        // 3. Retensorize results after switch op
+        {
+            OpBuilder::InsertionGuard g(rewriter);
+            rewriter.setInsertionPointAfter(newSwitchOp);
+            for (auto results : llvm::zip(switchOp->getResults(), newSwitchOp->getResults())) {
+                auto oldResult = std::get<0>(results);
+                auto newResult = std::get<1>(results);
+                if (isScalarTensor(oldResult)) {
+                    Value value = tensor::FromElementsOp::create(
+                        rewriter, switchOp->getLoc(),
+                        RankedTensorType::get({}, newResult.getType()), newResult);
+                    rewriter.replaceAllUsesWith(oldResult, value);
+                }
+            }
+        }
+
+        // 4. Replace switch op with new switch op
+        rewriter.replaceOp(switchOp, newSwitchOp);
+        return success();
+    }
+};
+
 struct DetensorizeWhileOp : public OpRewritePattern<scf::WhileOp> {
     using OpRewritePattern<scf::WhileOp>::OpRewritePattern;
 
@@ -355,6 +423,7 @@ struct DetensorizeSCFPass : public impl::DetensorizeSCFPassBase<DetensorizeSCFPa
         RewritePatternSet patterns(context);
         patterns.add<DetensorizeForOp>(context);
         patterns.add<DetensorizeIfOp>(context);
+        patterns.add<DetensorizeIndexSwitchOp>(context);
         patterns.add<DetensorizeWhileOp>(context);
         if (failed(applyPatternsGreedily(getOperation(), std::move(patterns))))
             signalPassFailure();
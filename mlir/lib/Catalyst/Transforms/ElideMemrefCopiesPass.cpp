@@ -0,0 +1,236 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "elide-memref-copies"
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Catalyst/Transforms/Passes.h"
+
+using namespace mlir;
+
+namespace {
+
+// Whether `op`, or the operation that contains it, comes after `anchor` in the block of `anchor`
+bool isAfterInBlock(Operation *op, Operation *anchor)
+{
+    Operation *ancestor = anchor->getBlock()->findAncestorOpInBlock(*op);
+    return ancestor && ancestor != anchor && anchor->isBeforeInBlock(ancestor);
+}
+
+// Whether `op`, or the operation that contains it, comes before `anchor` in the block of `anchor`
+bool isBeforeInBlock(Operation *op, Operation *anchor)
+{
+    Operation *ancestor = anchor->getBlock()->findAncestorOpInBlock(*op);
+    return ancestor && ancestor != anchor && ancestor->isBeforeInBlock(anchor);
+}
+
+bool createsAlias(Operation *op)
+{
+    return llvm::any_of(op->getResultTypes(), llvm::IsaPred<BaseMemRefType>);
+}
+
+/**
+ * @brief Whether `op` only reads the buffer `value`, without aliasing it or letting it escape.
+ *
+ * Effects on unspecified values may be on any buffer, so they count as effects on `value`.
+ */
+bool onlyReads(Operation *op, Value value)
+{
+    auto effectsOp = dyn_cast<MemoryEffectOpInterface>(op);
+    if (!effectsOp || createsAlias(op) || op->hasTrait<OpTrait::IsTerminator>()) {
+        return false;
+    }
+    SmallVector<MemoryEffects::EffectInstance> effects;
+    effectsOp.getEffects(effects);
+    return llvm::none_of(effects, [&](const MemoryEffects::EffectInstance &effect) {
+        const bool onValue = !effect.getValue() || effect.getValue() == value;
+        return onValue && !isa<MemoryEffects::Read>(effect.getEffect());
+    });
+}
+
+// The allocation of the target of `copyOp`, if it is a fresh buffer of the same type as the source
+memref::AllocOp getFreshTarget(memref::CopyOp copyOp)
+{
+    auto allocOp = copyOp.getTarget().getDefiningOp<memref::AllocOp>();
+    if (!allocOp || allocOp->getBlock() != copyOp->getBlock() ||
+        allocOp.getType() != copyOp.getSource().getType()) {
+        return nullptr;
+    }
+    return allocOp;
+}
+
+bool hasCompatibleAlignment(memref::AllocOp targetAlloc, Value source)
+{
+    if (!targetAlloc.getAlignment()) {
+        return true;
+    }
+    auto sourceAlloc = source.getDefiningOp<memref::AllocOp>();
+    return sourceAlloc && sourceAlloc.getAlignment() == targetAlloc.getAlignment();
+}
+
+// Replace the target of `copyOp` by its source, and erase the copy and the target allocation
+void forwardSource(memref::CopyOp copyOp, memref::AllocOp targetAlloc)
+{
+    Value source = copyOp.getSource();
+    copyOp.erase();
+    targetAlloc.getResult().replaceAllUsesWith(source);
+    targetAlloc.erase();
+}
+
+/**
+ * @brief Elide a copy whose source buffer is only freed after it, by letting the target take
+ * over the source buffer.
+ */
+bool elideCopyOfDeadSource(memref::CopyOp copyOp)
+{
+    memref::AllocOp targetAlloc = getFreshTarget(copyOp);
+    auto sourceAlloc = copyOp.getSource().getDefiningOp<memref::AllocOp>();
+    if (!targetAlloc || !sourceAlloc || sourceAlloc->getBlock() != copyOp->getBlock() ||
+        !hasCompatibleAlignment(targetAlloc, sourceAlloc.getResult())) {
+        return false;
+    }
+
+    SmallVector<memref::DeallocOp> sourceDeallocs;
+    for (Operation *user : sourceAlloc->getUsers()) {
+        if (user == copyOp) {
+            continue;
+        }
+        if (createsAlias(user)) {
+            return false;
+        }
+        auto deallocOp = dyn_cast<memref::DeallocOp>(user);
+        if (deallocOp && isAfterInBlock(user, copyOp)) {
+            sourceDeallocs.push_back(deallocOp);
+        }
+        else if (!isBeforeInBlock(user, copyOp)) {
+            return false;
+        }
+    }
+
+    // The target must not be used before it holds the copy
+    for (Operation *user : targetAlloc->getUsers()) {
+        if (user != copyOp && !isAfterInBlock(user, copyOp)) {
+            return false;
+        }
+    }
+
+    // The deallocation of the target now frees the source
+    for (memref::DeallocOp deallocOp : sourceDeallocs) {
+        deallocOp.erase();
+    }
+    forwardSource(copyOp, targetAlloc);
+    return true;
+}
+
+/**
+ * @brief Elide a copy that is only read, while its source is not written or freed.
+ */
+bool elideReadOnlyCopy(memref::CopyOp copyOp)
+{
+    memref::AllocOp targetAlloc = getFreshTarget(copyOp);
+    Value source = copyOp.getSource();
+    if (!targetAlloc || !hasCompatibleAlignment(targetAlloc, source)) {
+        return false;
+    }
+
+    // The deallocation of the source, after which the copy must no longer be read
+    Operation *sourceEnd = nullptr;
+    if (auto getGlobalOp = source.getDefiningOp<memref::GetGlobalOp>()) {
+        auto globalOp = SymbolTable::lookupNearestSymbolFrom<memref::GlobalOp>(
+            getGlobalOp, getGlobalOp.getNameAttr());
+        if (!globalOp || !globalOp.getConstant()) {
+            return false;
+        }
+    }
+    else if (auto sourceAlloc = source.getDefiningOp<memref::AllocOp>();
+             sourceAlloc && sourceAlloc->getBlock() == copyOp->getBlock()) {
+        for (Operation *user : sourceAlloc->getUsers()) {
+            if (user == copyOp) {
+                continue;
+            }
+            if (createsAlias(user)) {
+                return false;
+            }
+            if (isa<memref::DeallocOp>(user) && user->getBlock() == copyOp->getBlock() &&
+                copyOp->isBeforeInBlock(user)) {
+                if (sourceEnd) {
+                    return false;
+                }
+                sourceEnd = user;
+            }
+            else if (!isBeforeInBlock(user, copyOp) &&
+                     !(isAfterInBlock(user, copyOp) && onlyReads(user, source))) {
+                return false;
+            }
+        }
+    }
+    else {
+        return false;
+    }
+
+    SmallVector<memref::DeallocOp> targetDeallocs;
+    for (Operation *user : targetAlloc->getUsers()) {
+        if (user == copyOp) {
+            continue;
+        }
+        if (auto deallocOp = dyn_cast<memref::DeallocOp>(user)) {
+            targetDeallocs.push_back(deallocOp);
+            continue;
+        }
+        if (!isAfterInBlock(user, copyOp) || !onlyReads(user, targetAlloc.getResult()) ||
+            (sourceEnd && !isBeforeInBlock(user, sourceEnd))) {
+            return false;
+        }
+    }
+
+    // The source is freed on its own, if at all
+    for (memref::DeallocOp deallocOp : targetDeallocs) {
+        deallocOp.erase();
+    }
+    forwardSource(copyOp, targetAlloc);
+    return true;
+}
+
+} // namespace
+
+namespace catalyst {
+
+#define GEN_PASS_DEF_ELIDEMEMREFCOPIESPASS
+#include "Catalyst/Transforms/Passes.h.inc"
+
+struct ElideMemrefCopiesPass : impl::ElideMemrefCopiesPassBase<ElideMemrefCopiesPass> {
+    using ElideMemrefCopiesPassBase::ElideMemrefCopiesPassBase;
+
+    void runOnOperation() final
+    {
+        SmallVector<memref::CopyOp> copyOps;
+        getOperation().walk([&](memref::CopyOp copyOp) { copyOps.push_back(copyOp); });
+
+        // Only the copy being elided is erased, so the remaining ones stay valid
+        for (memref::CopyOp copyOp : copyOps) {
+            if (!elideCopyOfDeadSource(copyOp)) {
+                elideReadOnlyCopy(copyOp);
+            }
+        }
+    }
+};
+
+} // namespace catalyst
@@ -61,18 +61,22 @@
  *     ```
  * 5. Cleanup: remove the catalyst.fully_qualified_name attribute
  *
+ * Each phase is a single walk over the IR, and the uniqueness of the new names is checked against
+ * one count of the names of all symbol tables, rather than against a symbol table built for each
+ * symbol table, so that programs with many qnodes, each a nested module, are inlined quickly.
  */
 
+#include <algorithm>
 #include <deque>
 
 #include "llvm/ADT/SmallSet.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/AttrTypeSubElements.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/IR/SymbolTable.h"
 #include "mlir/Pass/Pass.h"
-#include "mlir/Pass/PassManager.h"
-#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 
 #include "Catalyst/IR/CatalystOps.h"
-#include "Catalyst/Transforms/Patterns.h"
 #include "Gradient/IR/GradientInterfaces.h"
 #include "Mitigation/IR/MitigationOps.h"
 
@@ -157,419 +161,236 @@ static constexpr llvm::StringRef fullyQualifiedNameAttr = "catalyst.fully_qualif
 static constexpr llvm::StringRef quantumNodeAttr = "quantum.node";
 static constexpr llvm::StringRef legacyQNodeAttr = "qnode";
 
-struct AnnotateWithFullyQualifiedName : public OpInterfaceRewritePattern<SymbolOpInterface> {
-    using OpInterfaceRewritePattern<SymbolOpInterface>::OpInterfaceRewritePattern;
-
-    /// This overload constructs a pattern that matches any operation type.
-    AnnotateWithFullyQualifiedName(MLIRContext *context, Operation *root)
-        : OpInterfaceRewritePattern<SymbolOpInterface>::OpInterfaceRewritePattern(context),
-          _root(root)
-    {
-    }
-
-    LogicalResult matchAndRewrite(SymbolOpInterface symbol,
-                                  PatternRewriter &rewriter) const override
-    {
-        auto hasQualifiedName = symbol->hasAttr(fullyQualifiedNameAttr);
-        if (hasQualifiedName) {
-            return failure();
-        }
-
-        auto fullyQualifiedName = getFullyQualifiedNameUntil(symbol, _root);
-        rewriter.modifyOpInPlace(
-            symbol, [&] { symbol->setAttr(fullyQualifiedNameAttr, fullyQualifiedName); });
-        return success();
-    }
-
-    const Operation *_root;
-};
-
-struct RenameFunctionsPattern : public RewritePattern {
-    /// This overload constructs a pattern that matches any operation type.
-    RenameFunctionsPattern(MLIRContext *context, SmallVector<Operation *> *symbolTables,
-                           llvm::SmallSet<StringRef, 8> *externalFuncDeclNames)
-        : RewritePattern(MatchAnyOpTypeTag(), 1, context), _symbolTables(symbolTables),
-          _externalFuncDeclNames(externalFuncDeclNames)
-    {
-    }
-
-    LogicalResult matchAndRewrite(Operation *op, PatternRewriter &rewriter) const override;
-
-    SmallVector<Operation *> *_symbolTables;
-    llvm::SmallSet<StringRef, 8> *_externalFuncDeclNames;
-};
-
-static constexpr llvm::StringRef hasBeenRenamedAttrName = "catalyst.unique_names";
-
-LogicalResult RenameFunctionsPattern::matchAndRewrite(Operation *child,
-                                                      PatternRewriter &rewriter) const
+/// Annotate the symbols nested in each symbol table of `root` with their fully qualified name, as
+/// reached from `root`, unless they already have one.
+void annotateWithFullyQualifiedNames(Operation *root)
 {
-    bool isSymbolTable = child->hasTrait<OpTrait::SymbolTable>();
-    bool hasBeenRenamed = child->hasAttr(hasBeenRenamedAttrName);
-    // TODO: isQnode
-    bool mustRename = isSymbolTable && !hasBeenRenamed;
-    if (!mustRename) {
-        return failure();
-    }
-
-    assert(child->hasTrait<OpTrait::SymbolTable>() && "child must be symbol table");
-    auto parent = child->getParentOp();
-    assert(parent && "parent must exist");
-    assert(parent->hasTrait<OpTrait::SymbolTable>() && "parent must be a symbol table");
-
-    SymbolTable childSymTab(child);
-    SmallVector<std::shared_ptr<SymbolTable>> tables;
-    SmallVector<SymbolTable *> raw_tables;
-    for (auto operation : *_symbolTables) {
-        std::shared_ptr<SymbolTable> sym(new SymbolTable(operation));
-        tables.push_back(sym);
-        raw_tables.push_back(sym.get());
-    }
-
-    // Yes, this is a triple nested loop, but it is faster
-    // than doing a post-order walk because we are not interested in
-    // nested regions nor blocks. Also, since child is expected to be a module
-    // then the number of regions is guaranteed to be one and the number of blocks
-    // is also guaranteed to be one.
-    for (auto &region : child->getRegions()) {
-        for (auto &block : region.getBlocks()) {
-            for (auto &op : block) {
-                if (!isa<SymbolOpInterface>(op)) {
+    for (Region &region : root->getRegions()) {
+        for (Block &block : region) {
+            for (Operation &child : block) {
+                if (!child.hasTrait<OpTrait::SymbolTable>()) {
                     continue;
                 }
-
-                // We should not rename external function declarations, as they can be
-                // names required by other APIs.
-                // We record these external func decls during the rename pattern.
-                // Then during the actual inlining stage, only the first occurrence of the
-                // per-module func decls of these external decls should be inlined.
-                if (auto f = dyn_cast<func::FuncOp>(op)) {
-                    if (f.isExternal()) {
-                        _externalFuncDeclNames->insert(f.getName());
-                        continue;
+                child.walk([&](SymbolOpInterface symbol) {
+                    bool hasQualifiedName = symbol->hasAttr(fullyQualifiedNameAttr);
+                    if (symbol.getOperation() != &child && !hasQualifiedName) {
+                        symbol->setAttr(fullyQualifiedNameAttr,
+                                        getFullyQualifiedNameUntil(symbol, root));
                     }
-                }
-
-                if (failed(childSymTab.renameToUnique(&op, raw_tables))) {
-                    // TODO: Check for error in one of the tests.
-                    // The only case I've seen this is fail is when an operation which is not
-                    // a symbol is passed to the function renameToUnique.
-                    op.emitError() << "Cannot rename operation";
-                    return failure();
-                }
+                });
             }
         }
     }
-
-    rewriter.modifyOpInPlace(
-        child, [&] { child->setAttr(hasBeenRenamedAttrName, rewriter.getUnitAttr()); });
-    return success();
 }
 
-struct InlineNestedModule : public RewritePattern {
-    /// This overload constructs a pattern that matches any operation type.
-    InlineNestedModule(MLIRContext *context,
-                       const llvm::SmallSet<StringRef, 8> &externalFuncDeclNames)
-        : RewritePattern(MatchAnyOpTypeTag(), 1, context),
-          _externalFuncDeclNames(externalFuncDeclNames)
-    {
-    }
-
-    const llvm::SmallSet<StringRef, 8> &_externalFuncDeclNames;
-
-    // Note: mlir expects pattern objects to be const.
-    // In other words, repeated applications of a rewrite pattern should not have dependency on each
-    // other.
-    // This --inline-nested-module pass is breaking this assumption.
-    //
-    // TODO: refactor this pass to not use the pattern rewriter, but just raw logic in a
-    // `runOnOperation()`
-    mutable llvm::SmallSet<StringRef, 8> alreadyInlinedFuncDeclNames;
-
-    LogicalResult matchAndRewrite(Operation *op, PatternRewriter &rewriter) const override
-    {
-        bool isSymbolTable = op->hasTrait<OpTrait::SymbolTable>();
-        // TODO: isQnode
-        bool mustInline = isSymbolTable;
-        if (!mustInline) {
-            return failure();
+/// Rename the symbols of the nested symbol tables `tables`, in that order, so that they are unique
+/// across all symbol tables and `root`, and update their uses in a single walk of each table.
+///
+/// We should not rename external function declarations, as they can be names required by other
+/// APIs. They are recorded in `externalFuncDeclNames` instead, so that only the first occurrence
+/// of each declaration is inlined.
+void renameNestedSymbols(Operation *root, ArrayRef<Operation *> tables,
+                         llvm::SmallSet<StringRef, 8> &externalFuncDeclNames)
+{
+    MLIRContext *ctx = root->getContext();
+
+    // The number of symbol tables that define each name. As in `SymbolTable::renameToUnique`, the
+    // old names of a table stay taken until all its symbols are renamed.
+    DenseMap<StringAttr, unsigned> takenNames;
+    auto countNames = [&](Operation *table) {
+        for (Operation &op : table->getRegion(0).front()) {
+            if (auto name = op.getAttrOfType<StringAttr>(SymbolTable::getSymbolAttrName())) {
+                takenNames[name]++;
+            }
         }
-
-        auto parent = op->getParentOp();
-        assert(parent->hasTrait<OpTrait::SymbolTable>() &&
-               "the direct parent of a qnode module must be a module op");
-
-        // Look for the func decls in the current qnode module
-        // If it is a recorded external func decl, erase it if it already has been inlined.
-        SmallVector<Operation *> _erasureWorklist;
-        for (auto &region : op->getRegions()) {
-            auto funcOps = region.getOps<func::FuncOp>();
-            for (auto f : funcOps) {
-                StringRef funcName = f.getName();
-                if (f.isExternal() && _externalFuncDeclNames.contains(funcName)) {
-                    if (alreadyInlinedFuncDeclNames.contains(funcName)) {
-                        _erasureWorklist.push_back(f);
+    };
+    countNames(root);
+    llvm::for_each(tables, countNames);
+
+    for (Operation *table : tables) {
+        DenseMap<StringAttr, StringAttr> renames;
+        for (Region &region : table->getRegions()) {
+            for (Block &block : region) {
+                for (Operation &op : block) {
+                    if (!isa<SymbolOpInterface>(op)) {
+                        continue;
                     }
-                    else {
-                        alreadyInlinedFuncDeclNames.insert(funcName);
+                    if (auto f = dyn_cast<func::FuncOp>(op); f && f.isExternal()) {
+                        externalFuncDeclNames.insert(f.getName());
+                        continue;
                     }
+
+                    StringAttr oldName = SymbolTable::getSymbolName(&op);
+                    StringAttr newName;
+                    unsigned uniqueId = 0;
+                    do {
+                        newName = StringAttr::get(ctx, oldName.strref() + "_" + Twine(uniqueId++));
+                    } while (takenNames.lookup(newName) > 0);
+                    takenNames[newName]++;
+                    renames[oldName] = newName;
+                    SymbolTable::setSymbolName(&op, newName);
                 }
             }
         }
-
-        for (auto _op : _erasureWorklist) {
-            rewriter.eraseOp(_op);
+        if (renames.empty()) {
+            continue;
         }
 
-        // Can't generalize getting a region other than the zero-th one.
-        rewriter.inlineRegionBefore(op->getRegion(0), &parent->getRegion(0).back());
-        Block *inlinedBlock = &parent->getRegion(0).front();
-        Block *originalBlock = &parent->getRegion(0).back();
-        Block *after = rewriter.splitBlock(originalBlock, rewriter.getInsertionPoint());
-        rewriter.mergeBlocks(inlinedBlock, originalBlock);
-        rewriter.mergeBlocks(after, originalBlock);
-        rewriter.eraseOp(op);
-
-        return success();
-    }
-};
-
-struct SymbolReplacerPattern
-    : public OpInterfaceRewritePattern<catalyst::gradient::GradientOpInterface> {
-    using OpInterfaceRewritePattern<
-        catalyst::gradient::GradientOpInterface>::OpInterfaceRewritePattern;
-
-    SymbolReplacerPattern(MLIRContext *context, const DenseMap<SymbolRefAttr, SymbolRefAttr> *map)
-        : OpInterfaceRewritePattern<
-              catalyst::gradient::GradientOpInterface>::OpInterfaceRewritePattern(context),
-          _map(map)
-    {
-    }
-
-    LogicalResult matchAndRewrite(catalyst::gradient::GradientOpInterface user,
-                                  PatternRewriter &rewriter) const override
-    {
-        auto found = _map->find(user.getCallee()) != _map->end();
-        if (!found) {
-            return failure();
+        // Replace the references rooted at the renamed symbols, in the table but not in the nested
+        // symbol tables, in which they would refer to other symbols
+        AttrTypeReplacer replacer;
+        replacer.addReplacement([&](SymbolRefAttr attr) -> std::pair<Attribute, WalkResult> {
+            auto it = renames.find(attr.getRootReference());
+            if (it == renames.end()) {
+                return {attr, WalkResult::skip()};
+            }
+            return {SymbolRefAttr::get(it->second, attr.getNestedReferences()),
+                    WalkResult::skip()};
+        });
+        for (Region &region : table->getRegions()) {
+            region.walk<WalkOrder::PreOrder>([&](Operation *op) {
+                replacer.replaceElementsIn(op);
+                return op->hasTrait<OpTrait::SymbolTable>() ? WalkResult::skip()
+                                                            : WalkResult::advance();
+            });
+        }
+        for (auto [oldName, newName] : renames) {
+            takenNames[oldName]--;
         }
-        auto newSymbolRefAttr = _map->find(user.getCallee())->getSecond();
-        rewriter.modifyOpInPlace(user, [&] { user->setAttr("callee", newSymbolRefAttr); });
-        return success();
     }
+}
 
-    const DenseMap<SymbolRefAttr, SymbolRefAttr> *_map;
-};
-
-struct ZNEReplacerPattern : public OpRewritePattern<catalyst::mitigation::ZneOp> {
-    using OpRewritePattern<catalyst::mitigation::ZneOp>::OpRewritePattern;
-
-    ZNEReplacerPattern(MLIRContext *context, const DenseMap<SymbolRefAttr, SymbolRefAttr> *map)
-        : OpRewritePattern<catalyst::mitigation::ZneOp>::OpRewritePattern(context), _map(map)
-    {
-    }
+/// Move the bodies of the nested symbol tables `tables`, in that order, into their parents. Of the
+/// external function declarations recorded in `externalFuncDeclNames`, only the first occurrence
+/// is inlined.
+void inlineNestedSymbolTables(ArrayRef<Operation *> tables,
+                              const llvm::SmallSet<StringRef, 8> &externalFuncDeclNames)
+{
+    llvm::SmallSet<StringRef, 8> alreadyInlinedFuncDeclNames;
+    for (Operation *table : tables) {
+        assert(table->getParentOp()->hasTrait<OpTrait::SymbolTable>() &&
+               "the direct parent of a qnode module must be a module op");
 
-    LogicalResult matchAndRewrite(catalyst::mitigation::ZneOp op,
-                                  PatternRewriter &rewriter) const override
-    {
-        auto found = _map->find(op.getCallee()) != _map->end();
-        if (!found) {
-            return failure();
+        for (Region &region : table->getRegions()) {
+            for (auto f : llvm::make_early_inc_range(region.getOps<func::FuncOp>())) {
+                StringRef funcName = f.getName();
+                if (f.isExternal() && externalFuncDeclNames.contains(funcName) &&
+                    !alreadyInlinedFuncDeclNames.insert(funcName).second) {
+                    f.erase();
+                }
+            }
         }
-        auto newSymbolRefAttr = _map->find(op.getCallee())->getSecond();
-        rewriter.modifyOpInPlace(op, [&] { op->setAttr("callee", newSymbolRefAttr); });
-        return success();
-    }
-
-    const DenseMap<SymbolRefAttr, SymbolRefAttr> *_map;
-};
 
-struct NestedToFlatCallPattern : public OpRewritePattern<catalyst::LaunchKernelOp> {
-    using OpRewritePattern<catalyst::LaunchKernelOp>::OpRewritePattern;
-    /// This overload constructs a pattern that matches any operation type.
-    NestedToFlatCallPattern(MLIRContext *context, const DenseMap<SymbolRefAttr, SymbolRefAttr> *map)
-        : OpRewritePattern<catalyst::LaunchKernelOp>::OpRewritePattern(context), _map(map)
-    {
+        // Can't generalize getting a region other than the zero-th one.
+        Block &body = table->getRegion(0).front();
+        table->getBlock()->getOperations().splice(Block::iterator(table), body.getOperations());
+        table->erase();
     }
+}
 
-    LogicalResult matchAndRewrite(catalyst::LaunchKernelOp op,
-                                  PatternRewriter &rewriter) const override
-    {
-        auto found = _map->find(op.getCallee()) != _map->end();
-        if (!found) {
-            return failure();
+/// Replace the references to the inlined symbols by their fully qualified name with references to
+/// their new name, and the kernel launches of inlined functions with calls.
+void replaceNestedReferences(Operation *root)
+{
+    DenseMap<SymbolRefAttr, SymbolRefAttr> oldToNew;
+    for (Region &region : root->getRegions()) {
+        for (Block &block : region) {
+            for (Operation &op : block) {
+                auto symbol = dyn_cast<SymbolOpInterface>(op);
+                auto qualifiedName = op.getAttrOfType<SymbolRefAttr>(fullyQualifiedNameAttr);
+                if (symbol && qualifiedName) {
+                    oldToNew.insert({qualifiedName, SymbolRefAttr::get(symbol)});
+                }
+            }
         }
-
-        auto newSymbolRefAttr = _map->find(op.getCallee())->getSecond();
-        rewriter.replaceOpWithNewOp<func::CallOp>(op, newSymbolRefAttr, op.getResultTypes(),
-                                                  op.getOperands());
-        return success();
     }
 
-    const DenseMap<SymbolRefAttr, SymbolRefAttr> *_map;
-};
-
-struct CleanupPattern : public RewritePattern {
-    /// This overload constructs a pattern that matches any operation type.
-    CleanupPattern(MLIRContext *context) : RewritePattern(MatchAnyOpTypeTag(), 1, context) {}
-
-    LogicalResult matchAndRewrite(Operation *op, PatternRewriter &rewriter) const override
-    {
-        bool hasQualifiedName = op->hasAttr(fullyQualifiedNameAttr);
-        bool hasQNodeAttr = op->hasAttr(quantumNodeAttr);
-        if (!hasQualifiedName && !hasQNodeAttr) {
-            return failure();
+    SmallVector<catalyst::LaunchKernelOp> launches;
+    root->walk([&](Operation *op) {
+        if (auto launch = dyn_cast<catalyst::LaunchKernelOp>(op)) {
+            if (oldToNew.contains(launch.getCallee())) {
+                launches.push_back(launch);
+            }
         }
-
-        rewriter.modifyOpInPlace(op, [&] {
-            if (hasQNodeAttr) {
-                op->removeAttr(quantumNodeAttr);
-                op->setAttr(legacyQNodeAttr, UnitAttr::get(op->getContext()));
+        else if (auto user = dyn_cast<catalyst::gradient::GradientOpInterface>(op)) {
+            if (auto it = oldToNew.find(user.getCallee()); it != oldToNew.end()) {
+                user->setAttr("callee", it->second);
             }
-            if (hasQualifiedName) {
-                op->removeAttr(fullyQualifiedNameAttr);
+        }
+        else if (auto zne = dyn_cast<catalyst::mitigation::ZneOp>(op)) {
+            if (auto it = oldToNew.find(zne.getCallee()); it != oldToNew.end()) {
+                zne->setAttr("callee", it->second);
             }
-        });
+        }
+    });
 
-        return success();
+    IRRewriter rewriter(root->getContext());
+    for (catalyst::LaunchKernelOp launch : launches) {
+        rewriter.setInsertionPoint(launch);
+        rewriter.replaceOpWithNewOp<func::CallOp>(launch, oldToNew.lookup(launch.getCallee()),
+                                                  launch.getResultTypes(), launch.getOperands());
     }
-};
+}
+
+/// Remove the temporary annotations, and mark the qnodes with the legacy qnode attribute.
+void removeAnnotations(Operation *root)
+{
+    root->walk([&](Operation *op) {
+        if (op == root) {
+            return;
+        }
+        if (op->removeAttr(quantumNodeAttr)) {
+            op->setAttr(legacyQNodeAttr, UnitAttr::get(op->getContext()));
+        }
+        op->removeAttr(fullyQualifiedNameAttr);
+    });
+}
 
 } // namespace
 
 namespace catalyst {
 
-struct AnnotateWithFullyQualifiedNamePass
-    : PassWrapper<AnnotateWithFullyQualifiedNamePass, OperationPass<>> {
-
-    bool canScheduleOn(RegisteredOperationName opInfo) const override
-    {
-        return opInfo.hasTrait<OpTrait::SymbolTable>();
-    }
+#define GEN_PASS_DECL_INLINENESTEDMODULEPASS
+#define GEN_PASS_DEF_INLINENESTEDMODULEPASS
+#include "Catalyst/Transforms/Passes.h.inc"
 
-    void runOnOperation() override
-    {
-        MLIRContext *context = &getContext();
-        GreedyRewriteConfig config;
-        config.setStrictness(GreedyRewriteStrictness::ExistingOps);
-        config.setRegionSimplificationLevel(mlir::GreedySimplifyRegionLevel::Disabled);
-
-        RewritePatternSet annotate(context);
-        auto root = getOperation();
-        auto parent = root->getParentOp();
-        annotate.add<AnnotateWithFullyQualifiedName>(context, parent);
-
-        if (failed(applyPatternsGreedily(getOperation(), std::move(annotate), config))) {
-            signalPassFailure();
-        }
-    }
-};
+struct InlineNestedModulePass : impl::InlineNestedModulePassBase<InlineNestedModulePass> {
+    using InlineNestedModulePassBase::InlineNestedModulePassBase;
 
-struct InlineNestedSymbolTablePass : PassWrapper<InlineNestedSymbolTablePass, OperationPass<>> {
-    int _stopAfterStep;
-    InlineNestedSymbolTablePass(int stopAfter) : _stopAfterStep(stopAfter) {}
+    bool shouldRunStep(int step) const { return stopAfterStep >= step || stopAfterStep == 0; }
 
-    void runOnOperation() override
+    void runOnOperation() final
     {
         // Here we are in a root module/symbol table
         // that contains other nested modules/symbol tables.
+        Operation *root = getOperation();
+        assert(root->hasTrait<OpTrait::SymbolTable>() && "operation must be a symbol table");
 
-        MLIRContext *context = &getContext();
-
-        GreedyRewriteConfig config;
-        config.setStrictness(GreedyRewriteStrictness::ExistingOps);
-        config.setRegionSimplificationLevel(mlir::GreedySimplifyRegionLevel::Disabled);
-        RewritePatternSet renameFunctions(context);
-
-        // Get all symbol tables in current symbol table. Will be useful for making sure that
-        // the symbol being rewritten is unique among all symbol tables.
-        auto symbolTable = getOperation();
-        assert(symbolTable->hasTrait<OpTrait::SymbolTable>() && "operation must be a symbol table");
-
-        // TODO: upstream change to renameToUnique API to take a set
-        SmallVector<Operation *> symbolTables;
+        if (shouldRunStep(1)) {
+            annotateWithFullyQualifiedNames(root);
+        }
 
-        symbolTable->walk([&](Operation *op) {
-            if (!op->hasTrait<OpTrait::SymbolTable>()) {
-                return WalkResult::skip();
+        // The nested symbol tables are processed parents first, and the later siblings first
+        SmallVector<Operation *> tables;
+        root->walk([&](Operation *op) {
+            if (op != root && op->hasTrait<OpTrait::SymbolTable>()) {
+                tables.push_back(op);
             }
-            symbolTables.push_back(op);
-            return WalkResult::skip();
         });
+        std::reverse(tables.begin(), tables.end());
 
         llvm::SmallSet<StringRef, 8> externalFuncDeclNames;
-        renameFunctions.add<RenameFunctionsPattern>(context, &symbolTables, &externalFuncDeclNames);
-
-        bool run = _stopAfterStep >= 2 || _stopAfterStep == 0;
-        if (run && failed(applyPatternsGreedily(symbolTable, std::move(renameFunctions), config))) {
-            signalPassFailure();
-        }
-
-        RewritePatternSet inlineNested(context);
-        inlineNested.add<InlineNestedModule>(context, externalFuncDeclNames);
-        run = _stopAfterStep >= 3 || _stopAfterStep == 0;
-        if (run && failed(applyPatternsGreedily(symbolTable, std::move(inlineNested), config))) {
-            signalPassFailure();
+        if (shouldRunStep(2)) {
+            renameNestedSymbols(root, tables, externalFuncDeclNames);
         }
-
-        mlir::DenseMap<SymbolRefAttr, SymbolRefAttr> old_to_new;
-        for (auto &region : symbolTable->getRegions()) {
-            for (auto &block : region.getBlocks()) {
-                for (auto &op : block) {
-                    if (!isa<SymbolOpInterface>(op))
-                        continue;
-                    auto hasQualifiedName = op.hasAttr(fullyQualifiedNameAttr);
-                    if (!hasQualifiedName)
-                        continue;
-
-                    SymbolRefAttr old = op.getAttrOfType<SymbolRefAttr>(fullyQualifiedNameAttr);
-                    auto symbol = cast<SymbolOpInterface>(op);
-                    SymbolRefAttr _new = SymbolRefAttr::get(symbol);
-                    old_to_new.insert({old, _new});
-                }
-            }
+        if (shouldRunStep(3)) {
+            inlineNestedSymbolTables(tables, externalFuncDeclNames);
         }
-
-        RewritePatternSet nestedToFlat(context);
-        nestedToFlat.add<NestedToFlatCallPattern, SymbolReplacerPattern, ZNEReplacerPattern>(
-            context, &old_to_new);
-        run = _stopAfterStep >= 4 || _stopAfterStep == 0;
-        if (run && failed(applyPatternsGreedily(symbolTable, std::move(nestedToFlat), config))) {
-            signalPassFailure();
+        if (shouldRunStep(4)) {
+            replaceNestedReferences(root);
         }
-
-        RewritePatternSet cleanup(context);
-        cleanup.add<CleanupPattern>(context);
-        run = _stopAfterStep >= 5 || _stopAfterStep == 0;
-        if (run && failed(applyPatternsGreedily(symbolTable, std::move(cleanup), config))) {
-            signalPassFailure();
-        }
-    }
-};
-
-#define GEN_PASS_DECL_INLINENESTEDMODULEPASS
-#define GEN_PASS_DEF_INLINENESTEDMODULEPASS
-#include "Catalyst/Transforms/Passes.h.inc"
-
-struct InlineNestedModulePass : impl::InlineNestedModulePassBase<InlineNestedModulePass> {
-    using InlineNestedModulePassBase::InlineNestedModulePassBase;
-
-    void runOnOperation() final
-    {
-        MLIRContext *ctx = &getContext();
-        auto op = getOperation();
-        auto pm = PassManager::on<ModuleOp>(ctx);
-        if (stopAfterStep >= 1 || stopAfterStep == 0) {
-            OpPassManager &nestedModulePM = pm.nestAny();
-            nestedModulePM.addPass(std::make_unique<AnnotateWithFullyQualifiedNamePass>());
-        }
-
-        if (stopAfterStep >= 2 || stopAfterStep == 0) {
-            pm.addPass(std::make_unique<InlineNestedSymbolTablePass>(stopAfterStep));
-        }
-
-        if (failed(pm.run(op))) {
-            signalPassFailure();
+        if (shouldRunStep(5)) {
+            removeAnnotations(root);
         }
     }
 };
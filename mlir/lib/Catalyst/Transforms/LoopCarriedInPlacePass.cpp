@@ -0,0 +1,149 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "loop-carried-in-place"
+
+#include <optional>
+
+#include "llvm/ADT/STLExtras.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/Interfaces/DestinationStyleOpInterface.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Catalyst/Transforms/Passes.h"
+
+using namespace mlir;
+
+namespace {
+
+/// A use only reads a tensor, without creating an alias of it, if the user is not a terminator and
+/// has no tensor results, or only reads the tensor as an input of a destination-style operation,
+/// whose results alias its inits.
+bool isReadOnlyUse(OpOperand &use)
+{
+    Operation *user = use.getOwner();
+    if (user->hasTrait<OpTrait::IsTerminator>()) {
+        return false;
+    }
+    if (llvm::none_of(user->getResultTypes(), llvm::IsaPred<TensorType>)) {
+        return true;
+    }
+    auto dpsOp = dyn_cast<DestinationStyleOpInterface>(user);
+    return dpsOp && dpsOp.isDpsInput(&use);
+}
+
+/**
+ * @brief Let the operation computing the next value of a loop-carried tensor write into the
+ * carried tensor instead of into a new tensor.
+ *
+ * The operation must be a linalg operation of the loop body writing into a `tensor.empty`, and
+ * the carried tensor must only be read before it, or read by it at the position it writes to.
+ * The buffer of the carried tensor is then dead when the operation writes to it, so that it is
+ * updated in place by one-shot bufferization instead of being replaced by a new buffer in every
+ * iteration.
+ */
+bool updateInPlace(Block &body, BlockArgument carried, Value next)
+{
+    auto linalgOp = next.getDefiningOp<linalg::LinalgOp>();
+    if (!linalgOp || linalgOp->getBlock() != &body || carried.getType() != next.getType()) {
+        return false;
+    }
+    OpOperand *init = linalgOp.getDpsInitOperand(cast<OpResult>(next).getResultNumber());
+    AffineMap initMap = linalgOp.getMatchingIndexingMap(init);
+    if (!init->get().getDefiningOp<tensor::EmptyOp>() ||
+        linalgOp.payloadUsesValueFromOperand(init) || !initMap.isPermutation()) {
+        return false;
+    }
+
+    for (OpOperand &use : carried.getUses()) {
+        Operation *ancestor = body.findAncestorOpInBlock(*use.getOwner());
+        if (ancestor == linalgOp.getOperation()) {
+            // Each element is read by the iteration overwriting it
+            if (use.getOwner() != ancestor || linalgOp.getMatchingIndexingMap(&use) != initMap) {
+                return false;
+            }
+        }
+        else if (!ancestor || !ancestor->isBeforeInBlock(linalgOp) || !isReadOnlyUse(use)) {
+            return false;
+        }
+    }
+    init->set(carried);
+    return true;
+}
+
+void updateInPlace(scf::ForOp forOp)
+{
+    auto yieldOp = cast<scf::YieldOp>(forOp.getBody()->getTerminator());
+    for (auto [carried, next] : llvm::zip(forOp.getRegionIterArgs(), yieldOp.getResults())) {
+        if (isa<RankedTensorType>(carried.getType())) {
+            updateInPlace(*forOp.getBody(), carried, next);
+        }
+    }
+}
+
+/// The tensors carried by a while loop are those that its condition region forwards unchanged to
+/// its body, in which they must be computed again before being yielded at the same position.
+void updateInPlace(scf::WhileOp whileOp)
+{
+    scf::ConditionOp conditionOp = whileOp.getConditionOp();
+    Block &body = whileOp.getAfter().front();
+    auto yieldOp = cast<scf::YieldOp>(body.getTerminator());
+    for (auto [arg, next] : llvm::zip(whileOp.getBeforeArguments(), yieldOp.getResults())) {
+        if (!isa<RankedTensorType>(arg.getType())) {
+            continue;
+        }
+        std::optional<unsigned> forwardedIndex;
+        bool readOnly = llvm::all_of(arg.getUses(), [&](OpOperand &use) {
+            if (use.getOwner() != conditionOp) {
+                return isReadOnlyUse(use);
+            }
+            if (forwardedIndex) {
+                return false;
+            }
+            forwardedIndex = use.getOperandNumber() - conditionOp.getArgs().getBeginOperandIndex();
+            return true;
+        });
+        if (readOnly && forwardedIndex) {
+            updateInPlace(body, whileOp.getAfterArguments()[*forwardedIndex], next);
+        }
+    }
+}
+
+} // namespace
+
+namespace catalyst {
+
+#define GEN_PASS_DEF_LOOPCARRIEDINPLACEPASS
+#include "Catalyst/Transforms/Passes.h.inc"
+
+struct LoopCarriedInPlacePass : impl::LoopCarriedInPlacePassBase<LoopCarriedInPlacePass> {
+    using LoopCarriedInPlacePassBase::LoopCarriedInPlacePassBase;
+
+    void runOnOperation() final
+    {
+        getOperation().walk([](Operation *op) {
+            if (auto forOp = dyn_cast<scf::ForOp>(op)) {
+                updateInPlace(forOp);
+            }
+            else if (auto whileOp = dyn_cast<scf::WhileOp>(op)) {
+                updateInPlace(whileOp);
+            }
+        });
+    }
+};
+
+} // namespace catalyst
@@ -0,0 +1,127 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "noalias-memref-args"
+
+#include <optional>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Interfaces/ViewLikeInterface.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Catalyst/Transforms/Passes.h"
+
+using namespace mlir;
+
+namespace {
+
+bool isNoAliasArg(func::FuncOp funcOp, unsigned index)
+{
+    return funcOp.getArgAttr(index, LLVM::LLVMDialect::getNoAliasAttrName()) != nullptr;
+}
+
+/// The buffer that a memref is a view of, if it is known to be distinct from the other known
+/// buffers: a buffer allocated by the function, or a noalias argument of the function.
+Value getDistinctBuffer(Value memref)
+{
+    while (auto viewOp = memref.getDefiningOp<ViewLikeOpInterface>()) {
+        memref = viewOp.getViewSource();
+    }
+    if (memref.getDefiningOp<memref::AllocOp>() || memref.getDefiningOp<memref::AllocaOp>()) {
+        return memref;
+    }
+    auto arg = dyn_cast<BlockArgument>(memref);
+    auto funcOp = arg ? dyn_cast<func::FuncOp>(arg.getOwner()->getParentOp()) : nullptr;
+    if (funcOp && arg.getOwner()->isEntryBlock() && isNoAliasArg(funcOp, arg.getArgNumber())) {
+        return memref;
+    }
+    return nullptr;
+}
+
+/// The memref arguments of a private function that are distinct buffers at all of its calls, and
+/// hence do not alias any other memory accessed by the function.
+SmallVector<unsigned> getNoAliasArgs(func::FuncOp funcOp, ModuleOp mod)
+{
+    if (funcOp.isPublic() || funcOp.isExternal() ||
+        llvm::any_of(funcOp.getArgumentTypes(), llvm::IsaPred<LLVM::LLVMPointerType>)) {
+        return {};
+    }
+    std::optional<SymbolTable::UseRange> uses = SymbolTable::getSymbolUses(funcOp, mod);
+    if (!uses || llvm::any_of(*uses, [](const SymbolTable::SymbolUse &use) {
+            return !isa<func::CallOp>(use.getUser());
+        })) {
+        return {};
+    }
+
+    SmallVector<unsigned> candidates;
+    for (auto [index, type] : llvm::enumerate(funcOp.getArgumentTypes())) {
+        if (isa<MemRefType>(type) && !isNoAliasArg(funcOp, index)) {
+            candidates.push_back(index);
+        }
+    }
+    for (const SymbolTable::SymbolUse &use : *uses) {
+        auto callOp = cast<func::CallOp>(use.getUser());
+        SmallVector<Value> buffers;
+        for (Value operand : callOp.getOperands()) {
+            if (isa<BaseMemRefType>(operand.getType())) {
+                buffers.push_back(getDistinctBuffer(operand));
+            }
+        }
+        // An unknown buffer may be any of the others
+        if (llvm::is_contained(buffers, nullptr)) {
+            return {};
+        }
+        llvm::erase_if(candidates, [&](unsigned index) {
+            return llvm::count(buffers, getDistinctBuffer(callOp.getOperand(index))) != 1;
+        });
+    }
+    return candidates;
+}
+
+} // namespace
+
+namespace catalyst {
+
+#define GEN_PASS_DEF_NOALIASMEMREFARGSPASS
+#include "Catalyst/Transforms/Passes.h.inc"
+
+struct NoAliasMemrefArgsPass : impl::NoAliasMemrefArgsPassBase<NoAliasMemrefArgsPass> {
+    using NoAliasMemrefArgsPassBase::NoAliasMemrefArgsPassBase;
+
+    void runOnOperation() final
+    {
+        ModuleOp mod = getOperation();
+        auto noAlias = UnitAttr::get(&getContext());
+
+        // The noalias arguments of a function are distinct buffers at the calls it makes in turn
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto funcOp : mod.getOps<func::FuncOp>()) {
+                for (unsigned index : getNoAliasArgs(funcOp, mod)) {
+                    funcOp.setArgAttr(index, LLVM::LLVMDialect::getNoAliasAttrName(), noAlias);
+                    changed = true;
+                }
+            }
+        }
+    }
+};
+
+} // namespace catalyst
@@ -0,0 +1,171 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "promote-static-allocs"
+
+#include <optional>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/MathExtras.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/LLVMIR/LLVMTypes.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Interfaces/CallInterfaces.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Interfaces/ViewLikeInterface.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Catalyst/Transforms/Passes.h"
+#include "Catalyst/Utils/StaticAllocas.h"
+
+using namespace mlir;
+
+namespace {
+
+std::optional<uint64_t> getStaticSizeInBytes(memref::AllocOp allocOp)
+{
+    MemRefType type = allocOp.getType();
+    if (!type.hasStaticShape() || !allocOp.getSymbolOperands().empty()) {
+        return std::nullopt;
+    }
+    Type elementType = type.getElementType();
+    uint64_t elementBits;
+    if (auto complexType = dyn_cast<ComplexType>(elementType)) {
+        if (!complexType.getElementType().isIntOrFloat()) {
+            return std::nullopt;
+        }
+        elementBits = 2 * complexType.getElementType().getIntOrFloatBitWidth();
+    }
+    else if (elementType.isIntOrFloat()) {
+        elementBits = elementType.getIntOrFloatBitWidth();
+    }
+    else if (elementType.isIndex()) {
+        elementBits = 64;
+    }
+    else {
+        return std::nullopt;
+    }
+    return type.getNumElements() * llvm::divideCeil(elementBits, 8);
+}
+
+/**
+ * @brief Whether a buffer is only nested in the function through ops that run their regions
+ * sequentially, so that a single buffer for the whole function can stand in for it.
+ */
+bool isSequentiallyNested(memref::AllocOp allocOp, func::FuncOp func)
+{
+    for (Operation *parent = allocOp->getParentOp(); parent != func;
+         parent = parent->getParentOp()) {
+        if (!isa<scf::ForOp, scf::WhileOp, scf::IfOp, scf::IndexSwitchOp, scf::ExecuteRegionOp>(
+                parent)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Get the deallocations of a buffer, if the buffer and its views are only accessed in the
+ * function.
+ *
+ * Terminators and calls may hand the buffer over beyond its stack frame, ops other than views
+ * whose results are buffers or pointers may alias it, and only `memref.dealloc` is known to free
+ * it.
+ */
+std::optional<SmallVector<memref::DeallocOp>> getLocalDeallocs(memref::AllocOp allocOp)
+{
+    SmallVector<memref::DeallocOp> deallocs;
+    SmallVector<Value> aliases{allocOp.getResult()};
+    while (!aliases.empty()) {
+        Value alias = aliases.pop_back_val();
+        for (OpOperand &use : alias.getUses()) {
+            Operation *user = use.getOwner();
+            if (auto deallocOp = dyn_cast<memref::DeallocOp>(user)) {
+                deallocs.push_back(deallocOp);
+                continue;
+            }
+            if (auto viewOp = dyn_cast<ViewLikeOpInterface>(user)) {
+                if (viewOp.getViewSource() == alias) {
+                    aliases.append(user->result_begin(), user->result_end());
+                    continue;
+                }
+            }
+            if (user->hasTrait<OpTrait::IsTerminator>() || isa<CallOpInterface>(user) ||
+                isa<memref::ExtractAlignedPointerAsIndexOp>(user) ||
+                hasEffect<MemoryEffects::Free>(user, alias)) {
+                return std::nullopt;
+            }
+            if (auto storeOp = dyn_cast<memref::StoreOp>(user);
+                storeOp && storeOp.getValueToStore() == alias) {
+                return std::nullopt;
+            }
+            if (llvm::any_of(user->getResultTypes(), [](Type type) {
+                    return isa<BaseMemRefType, TensorType, LLVM::LLVMPointerType>(type);
+                })) {
+                return std::nullopt;
+            }
+        }
+    }
+    return deallocs;
+}
+
+} // namespace
+
+namespace catalyst {
+
+#define GEN_PASS_DEF_PROMOTESTATICALLOCSPASS
+#include "Catalyst/Transforms/Passes.h.inc"
+
+struct PromoteStaticAllocsPass : impl::PromoteStaticAllocsPassBase<PromoteStaticAllocsPass> {
+    using PromoteStaticAllocsPassBase::PromoteStaticAllocsPassBase;
+
+    void runOnOperation() final
+    {
+        func::FuncOp func = getOperation();
+        if (func.isExternal()) {
+            return;
+        }
+
+        IRRewriter rewriter(&getContext());
+        uint64_t totalSize = 0;
+        SmallVector<memref::AllocOp> allocOps;
+        func.walk([&](memref::AllocOp allocOp) { allocOps.push_back(allocOp); });
+        for (memref::AllocOp allocOp : allocOps) {
+            std::optional<uint64_t> size = getStaticSizeInBytes(allocOp);
+            if (!size || *size > maxAllocSize || totalSize + *size > maxTotalSize ||
+                !isSequentiallyNested(allocOp, func)) {
+                continue;
+            }
+            std::optional<SmallVector<memref::DeallocOp>> deallocs = getLocalDeallocs(allocOp);
+            if (!deallocs) {
+                continue;
+            }
+
+            totalSize += *size;
+            Location loc = allocOp.getLoc();
+            rewriter.setInsertionPointToStart(&func.front());
+            memref::AllocaOp allocaOp = getStaticMemrefAlloca(loc, rewriter, allocOp.getType());
+            allocaOp.setAlignmentAttr(allocOp.getAlignmentAttr());
+            for (memref::DeallocOp deallocOp : *deallocs) {
+                rewriter.eraseOp(deallocOp);
+            }
+            rewriter.replaceOp(allocOp, allocaOp);
+        }
+    }
+};
+
+} // namespace catalyst
@@ -64,8 +64,7 @@ struct CallOpToAsyncOPRewritePattern : public mlir::OpRewritePattern<func::CallO
         }
     }
 
-    void insertAwaitOps(func::CallOp op, async::ExecuteOp executeOp,
-                        PatternRewriter &rewriter) const
+    void insertAwaitOps(func::CallOp op, ValueRange bodyReturns, PatternRewriter &rewriter) const
     {
         // If there are no results for the call, just return
         if (op.getResults().size() == 0) {
@@ -136,10 +135,6 @@ struct CallOpToAsyncOPRewritePattern : public mlir::OpRewritePattern<func::CallO
         //  in run time. Removing the awaits involves using the dominator analysis, which we need
         //  some time to investigate how to use. Not much, but sufficient enough for a future
         //  improvement. See TODO inside replaceUsesWithIf.
-        auto results = executeOp.getResults();
-        // The first value is just a token.
-        std::vector<Value> bodyReturns(results.begin() + 1, results.end());
-
         // It is guaranteed that op.getResults().size() and bodyReturns.size() are equal.
         for (auto &&[oldVal, newVal] : llvm::zip(op.getResults(), bodyReturns)) {
             auto _users = oldVal.getUsers();
@@ -184,28 +179,56 @@ struct CallOpToAsyncOPRewritePattern : public mlir::OpRewritePattern<func::CallO
             return failure();
         }
 
-        TypeRange retTy = op.getResultTypes();
+        // The calls merged into a single task by the coarsening of the pass
+        SmallVector<func::CallOp> unit{op};
+        if (auto unitId = op->getAttrOfType<IntegerAttr>("async_unit")) {
+            unit.clear();
+            for (auto callOp : op->getBlock()->getOps<func::CallOp>()) {
+                if (callOp->getAttr("async_unit") == unitId) {
+                    unit.push_back(callOp);
+                }
+            }
+        }
+
+        SmallVector<Type> retTy;
+        for (func::CallOp callOp : unit) {
+            llvm::append_range(retTy, callOp.getResultTypes());
+        }
         SmallVector<Value> dependencies; /* = empty */
         SmallVector<Value> operands;     /* = empty */
         auto noopExec = [&](OpBuilder &executeBuilder, Location executeLoc,
                             ValueRange executeArgs) {};
 
-        rewriter.modifyOpInPlace(op, [&] { op->setAttr("transformed", rewriter.getUnitAttr()); });
+        for (func::CallOp callOp : unit) {
+            rewriter.modifyOpInPlace(callOp, [&] {
+                callOp->removeAttr("async_unit");
+                callOp->setAttr("transformed", rewriter.getUnitAttr());
+            });
+        }
         IRMapping map;
+        rewriter.setInsertionPoint(unit.front());
         auto executeOp = async::ExecuteOp::create(rewriter, op.getLoc(), retTy, dependencies,
                                                   operands, noopExec);
+        SmallVector<Value> yieldValues;
         {
             PatternRewriter::InsertionGuard insertGuard(rewriter);
             rewriter.setInsertionPoint(executeOp.getBody(), executeOp.getBody()->end());
-            Operation *cloneOp = op->clone(map);
-            rewriter.insert(cloneOp);
-            async::YieldOp::create(rewriter, op.getLoc(), cloneOp->getResults());
+            for (func::CallOp callOp : unit) {
+                Operation *cloneOp = callOp->clone(map);
+                rewriter.insert(cloneOp);
+                llvm::append_range(yieldValues, cloneOp->getResults());
+            }
+            async::YieldOp::create(rewriter, op.getLoc(), yieldValues);
         }
 
-        insertDropRefOps(op, executeOp, rewriter);
-        insertAwaitOps(op, executeOp, rewriter);
-
-        rewriter.eraseOp(op);
+        insertDropRefOps(unit.front(), executeOp, rewriter);
+        // The first value is just a token.
+        ValueRange bodyReturns = executeOp.getResults().drop_front();
+        for (func::CallOp callOp : unit) {
+            insertAwaitOps(callOp, bodyReturns.take_front(callOp.getNumResults()), rewriter);
+            bodyReturns = bodyReturns.drop_front(callOp.getNumResults());
+            rewriter.eraseOp(callOp);
+        }
 
         return success();
     }
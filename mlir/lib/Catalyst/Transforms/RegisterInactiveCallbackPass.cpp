@@ -32,16 +32,21 @@ struct RegisterInactiveCallbackPass
     void runOnOperation() final
     {
         auto mod = getOperation();
-        StringRef inactive_callbackFnName = "__catalyst_inactive_callback";
-        auto fnDecl = mod.lookupSymbol<LLVM::LLVMFuncOp>(inactive_callbackFnName);
-        if (!fnDecl) {
+        SmallVector<StringRef> inactiveFnNames;
+        for (StringRef fnName :
+             {"__catalyst_inactive_callback", "__catalyst_inactive_batched_callback"}) {
+            if (mod.lookupSymbol<LLVM::LLVMFuncOp>(fnName)) {
+                inactiveFnNames.push_back(fnName);
+            }
+        }
+        if (inactiveFnNames.empty()) {
             return;
         }
         MLIRContext *context = &getContext();
         auto builder = OpBuilder(context);
         builder.setInsertionPointToStart(mod.getBody());
         auto ptrTy = LLVM::LLVMPointerType::get(context);
-        auto arrTy = LLVM::LLVMArrayType::get(ptrTy, 1);
+        auto arrTy = LLVM::LLVMArrayType::get(ptrTy, inactiveFnNames.size());
         auto loc = mod.getLoc();
         auto isConstant = false;
         auto linkage = LLVM::Linkage::External;
@@ -51,11 +56,13 @@ struct RegisterInactiveCallbackPass
         Block *block = new Block();
         glb.getInitializerRegion().push_back(block);
         builder.setInsertionPointToStart(block);
-        auto undef = LLVM::UndefOp::create(builder, glb.getLoc(), arrTy);
-        auto fnSym = SymbolRefAttr::get(context, inactive_callbackFnName);
-        auto fnPtr = LLVM::AddressOfOp::create(builder, glb.getLoc(), ptrTy, fnSym);
-        auto filledInArray = LLVM::InsertValueOp::create(builder, glb.getLoc(), undef, fnPtr,
-                                                         SmallVector<int64_t>{0});
+        Value filledInArray = LLVM::UndefOp::create(builder, glb.getLoc(), arrTy);
+        for (auto [idx, fnName] : llvm::enumerate(inactiveFnNames)) {
+            auto fnSym = SymbolRefAttr::get(context, fnName);
+            auto fnPtr = LLVM::AddressOfOp::create(builder, glb.getLoc(), ptrTy, fnSym);
+            filledInArray = LLVM::InsertValueOp::create(builder, glb.getLoc(), filledInArray, fnPtr,
+                                                        SmallVector<int64_t>{(int64_t)idx});
+        }
         LLVM::ReturnOp::create(builder, glb.getLoc(), filledInArray);
     }
 };
@@ -14,9 +14,12 @@
 
 #define DEBUG_TYPE "resource-tracker"
 
+#include <optional>
+
 #include "llvm/Support/JSON.h"
 #include "mlir/Pass/Pass.h"
 
+#include "Catalyst/Analysis/CostModel.h"
 #include "Catalyst/Analysis/ResourceAnalysis.h"
 #include "Catalyst/Analysis/ResourceResult.h"
 
@@ -69,8 +72,20 @@ struct ResourceTrackerPass : public impl::ResourceTrackerPassBase<ResourceTracke
             }
         }
 
+        std::optional<GateDurationTable> gateDurationTable;
+        if (estimateCost) {
+            SmallVector<std::string> entries(gateDurations.begin(), gateDurations.end());
+            Expected<GateDurationTable> table =
+                GateDurationTable::parse(entries, defaultGateDuration);
+            if (!table) {
+                getOperation()->emitError() << toString(table.takeError());
+                return signalPassFailure();
+            }
+            gateDurationTable = std::move(*table);
+        }
+
         if (outputJson) {
-            printJsonOutput(results);
+            printJsonOutput(results, gateDurationTable);
         }
 
         markAllAnalysesPreserved();
@@ -113,8 +128,11 @@ struct ResourceTrackerPass : public impl::ResourceTrackerPassBase<ResourceTracke
      * @brief Print the resource results as JSON to stdout.
      *
      * @param results The map of function names to ResourceResults to print.
+     * @param gateDurationTable The gate durations to estimate the cost of the functions with, if
+     * the cost is estimated.
      */
-    void printJsonOutput(const llvm::StringMap<ResourceResult> &results) const
+    void printJsonOutput(const llvm::StringMap<ResourceResult> &results,
+                         const std::optional<GateDurationTable> &gateDurationTable) const
     {
         llvm::json::Object root;
 
@@ -161,6 +179,11 @@ struct ResourceTrackerPass : public impl::ResourceTrackerPassBase<ResourceTracke
             funcObj["num_arg_qubits"] = static_cast<int64_t>(result.numArgQubits);
             funcObj["device_name"] = result.deviceName;
 
+            if (gateDurationTable) {
+                funcObj["cost_estimate"] =
+                    catalyst::estimateCost(result, *gateDurationTable, shots).toJson();
+            }
+
             root[funcEntry.getKey()] = std::move(funcObj);
         }
 
@@ -0,0 +1,137 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "reuse-buffers"
+
+#include <optional>
+#include <utility>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Catalyst/Transforms/Passes.h"
+
+using namespace mlir;
+
+namespace {
+
+// A buffer can stand in for another one if they have the same type and alignment
+using BufferKey = std::pair<Type, uint64_t>;
+
+std::optional<BufferKey> getReusableBufferKey(memref::AllocOp allocOp)
+{
+    if (!allocOp.getDynamicSizes().empty() || !allocOp.getSymbolOperands().empty()) {
+        return std::nullopt;
+    }
+    return BufferKey(allocOp.getType(), allocOp.getAlignment().value_or(0));
+}
+
+memref::DeallocOp getSingleDealloc(memref::AllocOp allocOp)
+{
+    memref::DeallocOp deallocOp;
+    for (Operation *user : allocOp->getUsers()) {
+        if (auto userDealloc = dyn_cast<memref::DeallocOp>(user)) {
+            if (deallocOp) {
+                return nullptr;
+            }
+            deallocOp = userDealloc;
+        }
+    }
+    return deallocOp;
+}
+
+/**
+ * @brief Allocate the buffers that a loop frees in the same iteration once for all iterations.
+ *
+ * The contents of a fresh allocation are undefined, so carrying the buffer over from the previous
+ * iteration is a valid refinement.
+ */
+void hoistLoopAllocations(scf::ForOp forOp)
+{
+    Block *body = forOp.getBody();
+    for (auto allocOp : llvm::make_early_inc_range(body->getOps<memref::AllocOp>())) {
+        memref::DeallocOp deallocOp = getSingleDealloc(allocOp);
+        if (!getReusableBufferKey(allocOp) || !deallocOp || deallocOp->getBlock() != body) {
+            continue;
+        }
+        allocOp->moveBefore(forOp);
+        deallocOp->moveAfter(forOp);
+    }
+}
+
+/**
+ * @brief Replace the allocations of a block by buffers of the same type freed earlier in the block.
+ *
+ * A buffer freed earlier in the block is defined before it, hence dominates the uses of any later
+ * allocation of the block. The most recently freed buffer is reused first, as it is the most likely
+ * to still be in cache.
+ */
+void reuseFreedBuffers(Block &block)
+{
+    DenseMap<BufferKey, SmallVector<memref::DeallocOp>> freedBuffers;
+    for (Operation &op : llvm::make_early_inc_range(block)) {
+        if (auto deallocOp = dyn_cast<memref::DeallocOp>(op)) {
+            auto freedAllocOp = deallocOp.getMemref().getDefiningOp<memref::AllocOp>();
+            if (!freedAllocOp) {
+                continue;
+            }
+            if (std::optional<BufferKey> key = getReusableBufferKey(freedAllocOp)) {
+                freedBuffers[*key].push_back(deallocOp);
+            }
+        }
+        else if (auto allocOp = dyn_cast<memref::AllocOp>(op)) {
+            std::optional<BufferKey> key = getReusableBufferKey(allocOp);
+            if (!key) {
+                continue;
+            }
+            auto it = freedBuffers.find(*key);
+            if (it == freedBuffers.end() || it->second.empty()) {
+                continue;
+            }
+
+            // The dealloc of the new buffer now frees the reused one, and may be reused in turn
+            memref::DeallocOp deallocOp = it->second.pop_back_val();
+            allocOp.getResult().replaceAllUsesWith(deallocOp.getMemref());
+            deallocOp.erase();
+            allocOp.erase();
+        }
+    }
+}
+
+} // namespace
+
+namespace catalyst {
+
+#define GEN_PASS_DEF_REUSEBUFFERSPASS
+#include "Catalyst/Transforms/Passes.h.inc"
+
+struct ReuseBuffersPass : impl::ReuseBuffersPassBase<ReuseBuffersPass> {
+    using ReuseBuffersPassBase::ReuseBuffersPassBase;
+
+    void runOnOperation() final
+    {
+        func::FuncOp func = getOperation();
+
+        // Inner loops come first, so that buffers can be hoisted out of a whole loop nest
+        func.walk([](scf::ForOp forOp) { hoistLoopAllocations(forOp); });
+        func.walk([](Block *block) { reuseFreedBuffers(*block); });
+    }
+};
+
+} // namespace catalyst
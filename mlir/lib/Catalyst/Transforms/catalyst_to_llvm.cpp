@@ -467,9 +467,28 @@ struct DefineCallbackOpPattern : public OpConversionPattern<CallbackOp> {
         bool isVarArg = true;
         ModuleOp mod = op->getParentOfType<ModuleOp>();
         auto typeConverter = getTypeConverter();
+        StringRef fnName = "__catalyst_inactive_callback";
+        SmallVector<Type> fnArgTypes = {i64, i64, i64};
+        if (op.getBatched()) {
+            // The runtime slices the stacked arguments and results, for which it needs their ranks
+            Type ptrType = LLVM::LLVMPointerType::get(ctx);
+            Value ranks = getStaticAlloca(loc, rewriter, i64, op.getNumArguments()).getResult();
+            for (auto [idx, arg] : llvm::enumerate(op.getArguments())) {
+                int64_t argRank = cast<MemRefType>(arg.getType()).getRank();
+                auto rank =
+                    LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(argRank));
+                int32_t position = idx;
+                auto rankPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, i64, ranks,
+                                                   ArrayRef<LLVM::GEPArg>{position},
+                                                   LLVM::GEPNoWrapFlags::inbounds);
+                LLVM::StoreOp::create(rewriter, loc, rank, rankPtr);
+            }
+            fnName = "__catalyst_inactive_batched_callback";
+            fnArgTypes.push_back(ptrType);
+            callArgs.push_back(ranks);
+        }
         LLVM::LLVMFuncOp customCallFnOp =
-            mlir::LLVM::lookupOrCreateFn(rewriter, mod, "__catalyst_inactive_callback",
-                                         {/*args=*/i64, i64, i64},
+            mlir::LLVM::lookupOrCreateFn(rewriter, mod, fnName, fnArgTypes,
                                          /*ret_type=*/voidType, isVarArg)
                 .value();
         SmallVector<Attribute> passthroughs;
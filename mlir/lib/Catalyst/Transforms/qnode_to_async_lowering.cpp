@@ -19,6 +19,7 @@
 #include "llvm/Support/Debug.h"
 #include "mlir/Dialect/Async/IR/Async.h"
 #include "mlir/Dialect/Bufferization/IR/Bufferization.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/Index/IR/IndexDialect.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
@@ -31,6 +32,86 @@ using namespace llvm;
 using namespace mlir;
 using namespace catalyst;
 
+namespace {
+
+func::FuncOp getQnode(func::CallOp callOp)
+{
+    auto funcOp =
+        SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(callOp, callOp.getCalleeAttr());
+    if (!funcOp || !funcOp->hasAttrOfType<UnitAttr>("qnode") ||
+        callOp->hasAttrOfType<UnitAttr>("transformed")) {
+        return nullptr;
+    }
+    return funcOp;
+}
+
+bool containsQnodeCall(Operation *op)
+{
+    return op
+        ->walk([](func::CallOp callOp) {
+            return getQnode(callOp) ? WalkResult::interrupt() : WalkResult::advance();
+        })
+        .wasInterrupted();
+}
+
+/// Group the qnode calls of a block into the units run by a single task: consecutive calls to
+/// small qnodes, none of which uses the results of the others.
+SmallVector<SmallVector<func::CallOp>> getQnodeUnits(Block &block, unsigned maxMergedSize)
+{
+    auto isSmall = [&](func::FuncOp funcOp) {
+        unsigned size = 0;
+        funcOp.walk([&](Operation *) { size++; });
+        return size <= maxMergedSize;
+    };
+
+    SmallVector<SmallVector<func::CallOp>> units;
+    bool mergeable = false;
+    for (Operation &op : block) {
+        auto callOp = dyn_cast<func::CallOp>(op);
+        func::FuncOp funcOp = callOp ? getQnode(callOp) : nullptr;
+        if (!funcOp) {
+            mergeable = false;
+            continue;
+        }
+        bool small = isSmall(funcOp);
+        if (mergeable && small && llvm::none_of(callOp.getOperands(), [&](Value operand) {
+                return llvm::is_contained(units.back(), operand.getDefiningOp<func::CallOp>());
+            })) {
+            units.back().push_back(callOp);
+        }
+        else {
+            units.push_back({callOp});
+            mergeable = small;
+        }
+    }
+    return units;
+}
+
+/// A unit is the only task in flight if no other qnode is called before its results are first
+/// used in its block, or before the end of the block if they are not used. The first use may
+/// call a qnode itself, which then waits for the results.
+bool isOnlyTaskInFlight(ArrayRef<func::CallOp> unit)
+{
+    Block *block = unit.front()->getBlock();
+    Operation *firstUse = nullptr;
+    for (func::CallOp callOp : unit) {
+        for (Operation *user : callOp->getUsers()) {
+            Operation *ancestor = block->findAncestorOpInBlock(*user);
+            if (ancestor && (!firstUse || ancestor->isBeforeInBlock(firstUse))) {
+                firstUse = ancestor;
+            }
+        }
+    }
+    if (firstUse && firstUse->getNumRegions() != 0 && containsQnodeCall(firstUse)) {
+        return false;
+    }
+    auto end = firstUse ? firstUse->getIterator() : block->end();
+    return llvm::none_of(llvm::make_range(std::next(unit.back()->getIterator()), end),
+                         [](Operation &op) { return containsQnodeCall(&op); });
+}
+
+} // namespace
+
 namespace catalyst {
 #define GEN_PASS_DEF_QNODETOASYNCLOWERINGPASS
 #include "Catalyst/Transforms/Passes.h.inc"
@@ -38,11 +119,41 @@ namespace catalyst {
 struct QnodeToAsyncLoweringPass : impl::QnodeToAsyncLoweringPassBase<QnodeToAsyncLoweringPass> {
     using QnodeToAsyncLoweringPassBase::QnodeToAsyncLoweringPassBase;
 
+    /// Reduce the number of tasks, each of which allocates a coroutine frame and runtime values
+    /// that may cost more than small qnodes: calls to small independent qnodes are merged into a
+    /// single task, and qnodes are called synchronously when no other task would run meanwhile.
+    void coarsenQnodeCalls()
+    {
+        SmallVector<SmallVector<func::CallOp>> units;
+        getOperation()->walk([&](Block *block) {
+            llvm::append_range(units, getQnodeUnits(*block, maxMergedSize));
+        });
+
+        // Decide for all units before marking the calls that no longer need a task
+        SmallVector<bool> synchronous = llvm::map_to_vector(units, isOnlyTaskInFlight);
+
+        Builder builder(&getContext());
+        for (auto [unitId, unit] : llvm::enumerate(units)) {
+            for (func::CallOp callOp : unit) {
+                if (synchronous[unitId]) {
+                    callOp->setAttr("transformed", builder.getUnitAttr());
+                }
+                else if (unit.size() > 1) {
+                    callOp->setAttr("async_unit", builder.getI64IntegerAttr(unitId));
+                }
+            }
+        }
+    }
+
     void runOnOperation() final
     {
         LLVM_DEBUG(dbgs() << "qnode to async lowering pass"
                           << "\n");
 
+        if (coarsen) {
+            coarsenQnodeCalls();
+        }
+
         RewritePatternSet patterns(&getContext());
         populateQnodeToAsyncPatterns(patterns);
         if (failed(applyPatternsGreedily(getOperation(), std::move(patterns)))) {
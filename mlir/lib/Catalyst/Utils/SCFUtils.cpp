@@ -12,8 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <cmath> // std::ceil()
+#include <algorithm>
+#include <limits>
 
+#include "Catalyst/Utils/SCFUtils.h"
+
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/TypeSwitch.h"
+#include "llvm/Support/MathExtras.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/Operation.h"
@@ -22,19 +30,6 @@ using namespace mlir;
 
 namespace catalyst {
 
-static int64_t getNumIterations(double lowerBound, double upperBound, double step)
-{
-    assert(upperBound >= lowerBound && step > 0);
-    return std::ceil((upperBound - lowerBound) / step);
-}
-
-static int64_t getIntFromArithConstantOp(arith::ConstantOp op)
-{
-    // The magical incantation to get a cpp integer from an arith.constant op
-    assert(isa<IntegerAttr>(op.getValue()));
-    return cast<IntegerAttr>(op.getValue()).getValue().getSExtValue();
-}
-
 template <typename OpTy> static bool hasAncestorOfType(Operation *op)
 {
     return op->getParentOfType<OpTy>() != nullptr;
@@ -46,50 +41,274 @@ bool isOpInIfOp(Operation *op) { return hasAncestorOfType<scf::IfOp>(op); }
 // Returns true if an operation is nested in a scf.while operation at any depth.
 bool isOpInWhileOp(Operation *op) { return hasAncestorOfType<scf::WhileOp>(op); }
 
-// Given an op in a for loop body with a static number of start, end and step,
-// compute the number of iterations that will be executed by the for loop.
-// Returns -1 if any of the above for loop information is not static.
-//
-// Note: if the input op is not inside any for loop operations,
-// this method returns 1, since there would be just one "iteration".
-int64_t countStaticForloopIterations(Operation *op)
+static std::optional<int64_t> evaluateCmpI(arith::CmpIPredicate predicate, int64_t lhs,
+                                           int64_t rhs)
 {
-    assert(!isa<scf::ForOp>(op));
+    auto ulhs = static_cast<uint64_t>(lhs);
+    auto urhs = static_cast<uint64_t>(rhs);
+    switch (predicate) {
+    case arith::CmpIPredicate::eq:
+        return lhs == rhs;
+    case arith::CmpIPredicate::ne:
+        return lhs != rhs;
+    case arith::CmpIPredicate::slt:
+        return lhs < rhs;
+    case arith::CmpIPredicate::sle:
+        return lhs <= rhs;
+    case arith::CmpIPredicate::sgt:
+        return lhs > rhs;
+    case arith::CmpIPredicate::sge:
+        return lhs >= rhs;
+    case arith::CmpIPredicate::ult:
+        return ulhs < urhs;
+    case arith::CmpIPredicate::ule:
+        return ulhs <= urhs;
+    case arith::CmpIPredicate::ugt:
+        return ulhs > urhs;
+    case arith::CmpIPredicate::uge:
+        return ulhs >= urhs;
+    }
+    return std::nullopt;
+}
 
-    int64_t count = 1;
+std::optional<int64_t> evaluateStaticInt(Value value,
+                                         const llvm::DenseMap<Value, int64_t> &ivValues)
+{
+    if (auto it = ivValues.find(value); it != ivValues.end()) {
+        return it->second;
+    }
 
-    Operation *parent = op->getParentOp();
-    while (parent) {
-        if (isa<scf::ForOp>(parent)) {
-            scf::ForOp forOp = cast<scf::ForOp>(parent);
+    Operation *defOp = value.getDefiningOp();
+    if (!defOp) {
+        return std::nullopt;
+    }
 
-            Operation *lowerBoundOp = forOp.getLowerBound().getDefiningOp();
-            if (!lowerBoundOp || !isa<arith::ConstantOp>(lowerBoundOp)) {
-                // Dynamic
-                return -1;
-            }
-            int64_t l = getIntFromArithConstantOp(cast<arith::ConstantOp>(lowerBoundOp));
+    using Result = std::optional<int64_t>;
+    auto binary = [&](Operation *op, auto fn) -> Result {
+        Result lhs = evaluateStaticInt(op->getOperand(0), ivValues);
+        Result rhs = lhs ? evaluateStaticInt(op->getOperand(1), ivValues) : std::nullopt;
+        if (!rhs) {
+            return std::nullopt;
+        }
+        return fn(*lhs, *rhs);
+    };
+    // Division by zero and overflowing divisions are not static
+    auto isDivisible = [](int64_t lhs, int64_t rhs) {
+        return rhs != 0 && !(lhs == std::numeric_limits<int64_t>::min() && rhs == -1);
+    };
 
-            Operation *upperBoundOp = forOp.getUpperBound().getDefiningOp();
-            if (!upperBoundOp || !isa<arith::ConstantOp>(upperBoundOp)) {
-                // Dynamic
-                return -1;
+    return llvm::TypeSwitch<Operation *, Result>(defOp)
+        .Case([](arith::ConstantOp op) -> Result {
+            auto intAttr = dyn_cast<IntegerAttr>(op.getValue());
+            if (!intAttr) {
+                return std::nullopt;
             }
-            int64_t u = getIntFromArithConstantOp(cast<arith::ConstantOp>(upperBoundOp));
+            const APInt &intValue = intAttr.getValue();
+            if (intValue.getBitWidth() == 1) {
+                return intValue.getZExtValue();
+            }
+            return intValue.getSExtValue();
+        })
+        .Case<arith::IndexCastOp, arith::ExtSIOp>(
+            [&](auto op) { return evaluateStaticInt(op.getIn(), ivValues); })
+        .Case([&](arith::AddIOp op) {
+            return binary(op, [](int64_t a, int64_t b) { return llvm::checkedAdd(a, b); });
+        })
+        .Case([&](arith::SubIOp op) {
+            return binary(op, [](int64_t a, int64_t b) { return llvm::checkedSub(a, b); });
+        })
+        .Case([&](arith::MulIOp op) {
+            return binary(op, [](int64_t a, int64_t b) { return llvm::checkedMul(a, b); });
+        })
+        .Case([&](arith::DivSIOp op) {
+            return binary(op, [&](int64_t a, int64_t b) -> Result {
+                return isDivisible(a, b) ? Result(a / b) : std::nullopt;
+            });
+        })
+        .Case([&](arith::FloorDivSIOp op) {
+            return binary(op, [&](int64_t a, int64_t b) -> Result {
+                return isDivisible(a, b) ? Result(llvm::divideFloorSigned(a, b)) : std::nullopt;
+            });
+        })
+        .Case([&](arith::CeilDivSIOp op) {
+            return binary(op, [&](int64_t a, int64_t b) -> Result {
+                return isDivisible(a, b) ? Result(llvm::divideCeilSigned(a, b)) : std::nullopt;
+            });
+        })
+        .Case([&](arith::RemSIOp op) {
+            return binary(op, [&](int64_t a, int64_t b) -> Result {
+                return isDivisible(a, b) ? Result(a % b) : std::nullopt;
+            });
+        })
+        .Case([&](arith::MinSIOp op) {
+            return binary(op, [](int64_t a, int64_t b) -> Result { return std::min(a, b); });
+        })
+        .Case([&](arith::MaxSIOp op) {
+            return binary(op, [](int64_t a, int64_t b) -> Result { return std::max(a, b); });
+        })
+        .Case([&](arith::AndIOp op) {
+            return binary(op, [](int64_t a, int64_t b) -> Result { return a & b; });
+        })
+        .Case([&](arith::OrIOp op) {
+            return binary(op, [](int64_t a, int64_t b) -> Result { return a | b; });
+        })
+        .Case([&](arith::XOrIOp op) {
+            return binary(op, [](int64_t a, int64_t b) -> Result { return a ^ b; });
+        })
+        .Case([&](arith::CmpIOp op) {
+            return binary(op, [&](int64_t a, int64_t b) {
+                return evaluateCmpI(op.getPredicate(), a, b);
+            });
+        })
+        .Case([&](arith::SelectOp op) -> Result {
+            Result condition = evaluateStaticInt(op.getCondition(), ivValues);
+            if (!condition) {
+                return std::nullopt;
+            }
+            return evaluateStaticInt(*condition ? op.getTrueValue() : op.getFalseValue(),
+                                     ivValues);
+        })
+        .Default([](Operation *) -> Result { return std::nullopt; });
+}
+
+bool dependsOnValue(Value value, Value iv)
+{
+    SmallVector<Value> worklist{value};
+    llvm::SmallPtrSet<Operation *, 8> visited;
+    while (!worklist.empty()) {
+        Value current = worklist.pop_back_val();
+        if (current == iv) {
+            return true;
+        }
+        Operation *defOp = current.getDefiningOp();
+        if (!defOp || !isa<arith::ArithDialect>(defOp->getDialect()) ||
+            !visited.insert(defOp).second) {
+            continue;
+        }
+        llvm::append_range(worklist, defOp->getOperands());
+    }
+    return false;
+}
+
+std::optional<int64_t> getStaticTripCount(scf::ForOp forOp,
+                                          const llvm::DenseMap<Value, int64_t> &ivValues)
+{
+    std::optional<int64_t> lowerBound = evaluateStaticInt(forOp.getLowerBound(), ivValues);
+    std::optional<int64_t> upperBound = evaluateStaticInt(forOp.getUpperBound(), ivValues);
+    std::optional<int64_t> step = evaluateStaticInt(forOp.getStep(), ivValues);
+    if (!lowerBound || !upperBound || !step || *step <= 0) {
+        return std::nullopt;
+    }
+    if (*upperBound <= *lowerBound) {
+        return 0;
+    }
+
+    std::optional<int64_t> range = llvm::checkedSub(*upperBound, *lowerBound);
+    if (!range) {
+        return std::nullopt;
+    }
+    return llvm::divideCeilSigned(*range, *step);
+}
+
+// Count the executions of the innermost of `regions` (outermost first), given the values of the
+// induction variables of the loops that have been enumerated so far.
+static std::optional<int64_t> countRegionExecutions(ArrayRef<Region *> regions,
+                                                    llvm::DenseMap<Value, int64_t> &ivValues,
+                                                    int64_t &budget)
+{
+    if (regions.empty()) {
+        return 1;
+    }
+
+    Region *region = regions.front();
+    ArrayRef<Region *> innerRegions = regions.drop_front();
+    Operation *parent = region->getParentOp();
+
+    if (auto forOp = dyn_cast<scf::ForOp>(parent)) {
+        std::optional<int64_t> tripCount = getStaticTripCount(forOp, ivValues);
+        if (!tripCount || *tripCount == 0) {
+            return tripCount;
+        }
 
-            Operation *stepOp = forOp.getStep().getDefiningOp();
-            if (!stepOp || !isa<arith::ConstantOp>(stepOp)) {
-                // Dynamic
-                return -1;
+        // The inner regions only fail to count without the induction variable if their bounds or
+        // conditions depend on it (or are not static at all), in which case the loop is enumerated.
+        if (std::optional<int64_t> innerCount =
+                countRegionExecutions(innerRegions, ivValues, budget)) {
+            return llvm::checkedMul(*tripCount, *innerCount);
+        }
+        if (*tripCount > budget) {
+            return std::nullopt;
+        }
+        budget -= *tripCount;
+
+        Value iv = forOp.getInductionVar();
+        int64_t lowerBound = *evaluateStaticInt(forOp.getLowerBound(), ivValues);
+        int64_t step = *evaluateStaticInt(forOp.getStep(), ivValues);
+        std::optional<int64_t> total = 0;
+        for (int64_t i = 0; i < *tripCount && total; i++) {
+            ivValues[iv] = lowerBound + i * step;
+            std::optional<int64_t> innerCount =
+                countRegionExecutions(innerRegions, ivValues, budget);
+            total = innerCount ? llvm::checkedAdd(*total, *innerCount) : std::nullopt;
+        }
+        ivValues.erase(iv);
+        return total;
+    }
+
+    if (auto ifOp = dyn_cast<scf::IfOp>(parent)) {
+        std::optional<int64_t> condition = evaluateStaticInt(ifOp.getCondition(), ivValues);
+        if (!condition) {
+            return std::nullopt;
+        }
+        bool inThenRegion = region == &ifOp.getThenRegion();
+        if ((*condition != 0) != inThenRegion) {
+            return 0;
+        }
+        return countRegionExecutions(innerRegions, ivValues, budget);
+    }
+
+    if (auto switchOp = dyn_cast<scf::IndexSwitchOp>(parent)) {
+        std::optional<int64_t> arg = evaluateStaticInt(switchOp.getArg(), ivValues);
+        if (!arg) {
+            return std::nullopt;
+        }
+        Region *takenRegion = &switchOp.getDefaultRegion();
+        for (auto [caseValue, caseRegion] :
+             llvm::zip(switchOp.getCases(), switchOp.getCaseRegions())) {
+            if (caseValue == *arg) {
+                takenRegion = &caseRegion;
+                break;
             }
-            int64_t s = getIntFromArithConstantOp(cast<arith::ConstantOp>(stepOp));
+        }
+        if (region != takenRegion) {
+            return 0;
+        }
+        return countRegionExecutions(innerRegions, ivValues, budget);
+    }
+
+    if (isa<scf::WhileOp>(parent)) {
+        return std::nullopt;
+    }
+
+    // Other region ops (e.g. quantum.adjoint) execute their region once
+    return countRegionExecutions(innerRegions, ivValues, budget);
+}
+
+std::optional<int64_t> countStaticExecutions(Operation *op, int64_t maxEnumeratedIterations)
+{
+    assert(!isa<scf::ForOp>(op));
 
-            count *= getNumIterations(l, u, s);
+    SmallVector<Region *> regions;
+    for (Region *region = op->getParentRegion(); region; region = region->getParentRegion()) {
+        if (isa<func::FuncOp>(region->getParentOp())) {
+            break;
         }
-        parent = parent->getParentOp();
+        regions.push_back(region);
     }
+    std::reverse(regions.begin(), regions.end());
 
-    return count;
+    llvm::DenseMap<Value, int64_t> ivValues;
+    return countRegionExecutions(regions, ivValues, maxEnumeratedIterations);
 }
 
 } // namespace catalyst
@@ -14,13 +14,24 @@
 
 #include "Driver/CatalystLLVMTarget.h"
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/CodeGen/ParallelCG.h"
 #include "llvm/IR/LegacyPassManager.h"
 #include "llvm/MC/TargetRegistry.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
 #include "llvm/TargetParser/Host.h"
+#include "llvm/TargetParser/SubtargetFeature.h"
 #include "mlir/Interfaces/FunctionInterfaces.h"
 #include "mlir/Target/LLVMIR/Dialect/Builtin/BuiltinToLLVMIRTranslation.h"
 #include "mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h"
@@ -38,6 +49,66 @@ void catalyst::driver::registerLLVMTranslations(DialectRegistry &registry)
     registerBuiltinDialectTranslation(registry);
 }
 
+std::pair<std::string, std::string>
+catalyst::driver::getTargetCPUAndFeatures(const CompilerOptions &options)
+{
+    std::string cpu = options.targetCPU.empty() ? "generic" : options.targetCPU;
+    llvm::SubtargetFeatures features;
+    if (cpu == "native") {
+        cpu = llvm::sys::getHostCPUName().str();
+        for (const auto &[feature, enabled] : llvm::sys::getHostCPUFeatures()) {
+            features.AddFeature(feature, enabled);
+        }
+    }
+    // Explicit features come last, so that they override the features of the host
+    for (StringRef feature : llvm::split(options.targetFeatures, ',')) {
+        if (!feature.trim().empty()) {
+            features.AddFeature(feature.trim());
+        }
+    }
+    return {cpu, features.getString()};
+}
+
+std::string catalyst::driver::getPartitionObjectFile(StringRef filename, size_t partition)
+{
+    if (partition == 0) {
+        return filename.str();
+    }
+    llvm::SmallString<256> partitionFile(filename);
+    llvm::sys::path::replace_extension(partitionFile, "part" + std::to_string(partition) + ".o");
+    return partitionFile.str().str();
+}
+
+namespace {
+
+/// Remove the partitions left over from an earlier compilation to the same object file, which
+/// would otherwise be linked together with the new ones.
+void removeStalePartitions(StringRef filename)
+{
+    for (size_t partition = 1;; partition++) {
+        std::string partitionFile = catalyst::driver::getPartitionObjectFile(filename, partition);
+        if (!llvm::sys::fs::exists(partitionFile)) {
+            break;
+        }
+        llvm::sys::fs::remove(partitionFile);
+    }
+}
+
+/// Number of partitions to emit in parallel, at most one per function definition.
+size_t getNumPartitions(const catalyst::driver::CompilerOptions &options,
+                        const llvm::Module &llvmModule)
+{
+    size_t numThreads = options.codegenThreads;
+    if (numThreads == 0) {
+        numThreads = llvm::hardware_concurrency().compute_thread_count();
+    }
+    size_t numDefinitions = llvm::count_if(
+        llvmModule.functions(), [](const llvm::Function &func) { return !func.isDeclaration(); });
+    return std::max<size_t>(1, std::min(numThreads, numDefinitions));
+}
+
+} // namespace
+
 LogicalResult catalyst::driver::compileObjectFile(const CompilerOptions &options,
                                                   std::shared_ptr<llvm::Module> llvmModule,
                                                   llvm::TargetMachine *targetMachine,
@@ -45,6 +116,13 @@ LogicalResult catalyst::driver::compileObjectFile(const CompilerOptions &options
 {
     using namespace llvm;
 
+    removeStalePartitions(filename);
+    size_t numPartitions = getNumPartitions(options, *llvmModule);
+    if (numPartitions > 1) {
+        return compilePartitionedObjectFiles(options, llvmModule, targetMachine, filename,
+                                             numPartitions);
+    }
+
     std::error_code errCode;
     raw_fd_ostream dest(filename, errCode, sys::fs::OF_None);
 
@@ -63,3 +141,44 @@ LogicalResult catalyst::driver::compileObjectFile(const CompilerOptions &options
     dest.flush();
     return success();
 }
+
+LogicalResult catalyst::driver::compilePartitionedObjectFiles(
+    const CompilerOptions &options, std::shared_ptr<llvm::Module> llvmModule,
+    llvm::TargetMachine *targetMachine, StringRef filename, size_t numPartitions)
+{
+    using namespace llvm;
+
+    std::vector<std::unique_ptr<raw_fd_ostream>> dests;
+    SmallVector<raw_pwrite_stream *> destPtrs;
+    for (size_t partition = 0; partition < numPartitions; partition++) {
+        std::error_code errCode;
+        std::string partitionFile = getPartitionObjectFile(filename, partition);
+        dests.push_back(std::make_unique<raw_fd_ostream>(partitionFile, errCode, sys::fs::OF_None));
+        if (errCode) {
+            CO_MSG(options, Verbosity::Urgent,
+                   "could not open file: " << errCode.message() << "\n");
+            return failure();
+        }
+        destPtrs.push_back(dests.back().get());
+    }
+
+    // Each partition is emitted on its own thread, which requires its own target machine
+    auto createTargetMachine = [targetMachine]() {
+        return std::unique_ptr<TargetMachine>(targetMachine->getTarget().createTargetMachine(
+            targetMachine->getTargetTriple(), targetMachine->getTargetCPU(),
+            targetMachine->getTargetFeatureString(), targetMachine->Options,
+            targetMachine->getRelocationModel(), targetMachine->getCodeModel(),
+            targetMachine->getOptLevel()));
+    };
+
+    // Local symbols referenced across partitions are promoted to hidden symbols, so that the
+    // partitions link into the same program as the unsplit module.
+    splitCodeGen(*llvmModule, destPtrs, /* BCOSs */ {}, createTargetMachine,
+                 CodeGenFileType::ObjectFile, /* PreserveLocals */ false);
+
+    for (auto &dest : dests) {
+        dest->flush();
+    }
+    CO_MSG(options, Verbosity::Debug, "Emitted " << numPartitions << " object files in parallel\n");
+    return success();
+}
@@ -0,0 +1,271 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Driver/CompilationCache.h"
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/Twine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/Process.h"
+#include "llvm/Support/SHA256.h"
+#include "llvm/TargetParser/Host.h"
+#include "mlir/Bytecode/BytecodeWriter.h"
+#include "mlir/Parser/Parser.h"
+
+#include "Catalyst/Utils/frontend_catalyst_version_py.h" // CATALYST_VERSION
+#include "Driver/CatalystLLVMTarget.h"
+#include "Quantum/IR/QuantumOps.h"
+
+using namespace catalyst::driver;
+
+namespace {
+
+constexpr llvm::StringLiteral deviceKwargsPlaceholder = "catalyst.device_kwargs.";
+
+std::string getCacheEntryPath(const CompilerOptions &options, llvm::StringRef key,
+                              llvm::StringRef extension)
+{
+    llvm::SmallString<256> entryPath(options.cacheDir);
+    llvm::sys::path::append(entryPath, key + extension);
+    return entryPath.str().str();
+}
+
+// Separate the fields so that different fields cannot produce the same stream of bytes
+void updateKey(llvm::SHA256 &hasher, llvm::StringRef field)
+{
+    hasher.update(field);
+    hasher.update(llvm::StringRef("\0", 1));
+}
+
+void updateKey(llvm::SHA256 &hasher, llvm::ArrayRef<Pipeline> pipelines)
+{
+    for (const Pipeline &pipeline : pipelines) {
+        updateKey(hasher, pipeline.getName());
+        for (const std::string &pass : pipeline.getPasses()) {
+            updateKey(hasher, pass);
+        }
+    }
+}
+
+/// Write a cache entry through a temporary file, renamed once complete
+void writeCacheEntry(const CompilerOptions &options, llvm::StringRef key,
+                     llvm::StringRef entryPath,
+                     llvm::function_ref<std::error_code(llvm::StringRef)> write)
+{
+    if (std::error_code errCode = llvm::sys::fs::create_directories(options.cacheDir)) {
+        CO_MSG(options, Verbosity::Urgent,
+               "Unable to create cache directory: " << errCode.message() << "\n");
+        return;
+    }
+
+    llvm::SmallString<256> tmpModel(options.cacheDir);
+    llvm::sys::path::append(tmpModel, key + "-%%%%%%.tmp");
+    llvm::SmallString<256> tmpPath;
+    int tmpFD;
+    if (std::error_code errCode = llvm::sys::fs::createUniqueFile(tmpModel, tmpFD, tmpPath)) {
+        CO_MSG(options, Verbosity::Urgent,
+               "Unable to create cache entry: " << errCode.message() << "\n");
+        return;
+    }
+    llvm::sys::Process::SafelyCloseFileDescriptor(tmpFD);
+
+    std::error_code errCode = write(tmpPath);
+    if (!errCode) {
+        errCode = llvm::sys::fs::rename(tmpPath, entryPath);
+    }
+    if (errCode) {
+        llvm::sys::fs::remove(tmpPath);
+        CO_MSG(options, Verbosity::Urgent,
+               "Unable to store cache entry: " << errCode.message() << "\n");
+    }
+}
+
+} // namespace
+
+std::optional<std::string> catalyst::driver::getCompilationCacheKey(const CompilerOptions &options,
+                                                                    const CompilerOutput &output)
+{
+    if (options.cacheDir.empty() || options.loweringAction != Action::All ||
+        options.keepIntermediate || !options.checkpointStage.empty() ||
+        options.dumpPassPipeline || options.codegenThreads != 1 || output.outputFilename == "-") {
+        return std::nullopt;
+    }
+
+    llvm::SHA256 hasher;
+    updateKey(hasher, CATALYST_VERSION);
+    updateKey(hasher, llvm::sys::getDefaultTargetTriple());
+    // The native CPU is resolved, so that hosts with different features do not share entries
+    auto [cpu, features] = getTargetCPUAndFeatures(options);
+    updateKey(hasher, cpu);
+    updateKey(hasher, features);
+    updateKey(hasher, options.moduleName);
+    updateKey(hasher, options.asyncQnodes ? "async" : "sync");
+    updateKey(hasher, options.pruneFunctions ? "prune" : "keep");
+    updateKey(hasher, options.parallelQnodes ? "parallel" : "inline");
+    updateKey(hasher, options.pipelinesCfg);
+
+    // The runtime bitcode is linked into the generated code, and changes with the runtime build
+    updateKey(hasher, options.runtimeBitcode);
+    if (!options.runtimeBitcode.empty()) {
+        auto bitcode = llvm::MemoryBuffer::getFile(options.runtimeBitcode);
+        updateKey(hasher, bitcode ? (*bitcode)->getBuffer() : "");
+    }
+
+    // Instrumented programs write their counters to the file
+    updateKey(hasher, options.perfCounters);
+
+    // Instrumented programs write their profiles to the directory, and the profile changes the code
+    updateKey(hasher, options.profileGenerate);
+    updateKey(hasher, options.profileUse);
+    if (!options.profileUse.empty()) {
+        auto profile = llvm::MemoryBuffer::getFile(options.profileUse);
+        updateKey(hasher, profile ? (*profile)->getBuffer() : "");
+    }
+
+    for (const std::string &digest : options.pluginDigests) {
+        updateKey(hasher, digest);
+    }
+
+    updateKey(hasher, options.source);
+
+    return llvm::toHex(hasher.final(), /* LowerCase */ true);
+}
+
+bool catalyst::driver::restoreCachedObjectFile(const CompilerOptions &options, llvm::StringRef key)
+{
+    std::string entryPath = getCacheEntryPath(options, key, ".o");
+    if (!llvm::sys::fs::exists(entryPath)) {
+        return false;
+    }
+
+    if (std::error_code errCode = llvm::sys::fs::copy_file(entryPath, options.getObjectFile())) {
+        CO_MSG(options, Verbosity::Debug,
+               "Unable to restore cached object file: " << errCode.message() << "\n");
+        return false;
+    }
+
+    CO_MSG(options, Verbosity::Debug, "Using cached object file '" << entryPath << "'\n");
+    return true;
+}
+
+void catalyst::driver::storeCachedObjectFile(const CompilerOptions &options, llvm::StringRef key)
+{
+    writeCacheEntry(options, key, getCacheEntryPath(options, key, ".o"),
+                    [&](llvm::StringRef tmpPath) {
+                        return llvm::sys::fs::copy_file(options.getObjectFile(), tmpPath);
+                    });
+}
+
+bool catalyst::driver::hasStageSnapshots(const CompilerOptions &options)
+{
+    return options.incremental && !options.cacheDir.empty() && !options.keepIntermediate &&
+           options.checkpointStage.empty() && !options.dumpPassPipeline;
+}
+
+std::vector<std::string> catalyst::driver::detachDeviceKwargs(mlir::ModuleOp moduleOp)
+{
+    std::vector<std::string> deviceKwargs;
+    moduleOp.walk([&](catalyst::quantum::DeviceInitOp deviceOp) {
+        std::string placeholder =
+            (deviceKwargsPlaceholder + llvm::Twine(deviceKwargs.size()) + ";").str();
+        deviceKwargs.push_back(deviceOp.getKwargs().str());
+        deviceOp.setKwargs(placeholder);
+    });
+    return deviceKwargs;
+}
+
+mlir::LogicalResult catalyst::driver::attachDeviceKwargs(mlir::ModuleOp moduleOp,
+                                                         llvm::ArrayRef<std::string> deviceKwargs)
+{
+    mlir::WalkResult result = moduleOp.walk([&](catalyst::quantum::DeviceInitOp deviceOp) {
+        llvm::StringRef kwargs = deviceOp.getKwargs();
+        if (!kwargs.consume_front(deviceKwargsPlaceholder)) {
+            return mlir::WalkResult::advance();
+        }
+
+        // Passes may append to the kwargs, after the placeholder
+        auto [index, suffix] = kwargs.split(';');
+        size_t deviceIdx;
+        if (index.getAsInteger(10, deviceIdx) || deviceIdx >= deviceKwargs.size()) {
+            deviceOp.emitOpError("has an invalid device kwargs placeholder");
+            return mlir::WalkResult::interrupt();
+        }
+        deviceOp.setKwargs(deviceKwargs[deviceIdx] + suffix.str());
+        return mlir::WalkResult::advance();
+    });
+    return mlir::failure(result.wasInterrupted());
+}
+
+std::string catalyst::driver::getStageSnapshotKey(const CompilerOptions &options,
+                                                  mlir::ModuleOp moduleOp,
+                                                  llvm::ArrayRef<Pipeline> pipelines)
+{
+    std::string module;
+    llvm::raw_string_ostream moduleStream(module);
+    moduleOp->print(moduleStream);
+
+    llvm::SHA256 hasher;
+    updateKey(hasher, CATALYST_VERSION);
+    updateKey(hasher, options.asyncQnodes ? "async" : "sync");
+    updateKey(hasher, options.pruneFunctions ? "prune" : "keep");
+    updateKey(hasher, options.parallelQnodes ? "parallel" : "inline");
+    updateKey(hasher, pipelines);
+    updateKey(hasher, module);
+
+    return llvm::toHex(hasher.final(), /* LowerCase */ true);
+}
+
+bool catalyst::driver::restoreStageSnapshot(const CompilerOptions &options,
+                                            mlir::ModuleOp moduleOp, llvm::StringRef key)
+{
+    std::string entryPath = getCacheEntryPath(options, key, ".mlirbc");
+    if (!llvm::sys::fs::exists(entryPath)) {
+        return false;
+    }
+
+    mlir::ParserConfig parserConfig(moduleOp.getContext());
+    mlir::OwningOpRef<mlir::ModuleOp> snapshot =
+        mlir::parseSourceFile<mlir::ModuleOp>(entryPath, parserConfig);
+    if (!snapshot) {
+        CO_MSG(options, Verbosity::Debug, "Unable to parse snapshot '" << entryPath << "'\n");
+        return false;
+    }
+
+    moduleOp.getBodyRegion().takeBody(snapshot->getBodyRegion());
+    moduleOp->setAttrs(snapshot.get()->getAttrDictionary());
+
+    CO_MSG(options, Verbosity::Debug, "Resuming from snapshot '" << entryPath << "'\n");
+    return true;
+}
+
+void catalyst::driver::storeStageSnapshot(const CompilerOptions &options, mlir::ModuleOp moduleOp,
+                                          llvm::StringRef key)
+{
+    writeCacheEntry(options, key, getCacheEntryPath(options, key, ".mlirbc"),
+                    [&](llvm::StringRef tmpPath) {
+                        std::error_code errCode;
+                        llvm::raw_fd_ostream snapshotStream(tmpPath, errCode);
+                        if (errCode) {
+                            return errCode;
+                        }
+                        if (mlir::failed(mlir::writeBytecodeToFile(moduleOp, snapshotStream))) {
+                            return std::make_error_code(std::errc::io_error);
+                        }
+                        snapshotStream.close();
+                        return snapshotStream.error();
+                    });
+}
@@ -30,13 +30,19 @@
 #include "llvm/Analysis/LoopAnalysisManager.h"
 #include "llvm/IR/LegacyPassManager.h"
 #include "llvm/IRReader/IRReader.h"
+#include "llvm/Linker/Linker.h"
 #include "llvm/MC/TargetRegistry.h"
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/PGOOptions.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/ToolOutputFile.h"
+#include "llvm/Support/VirtualFileSystem.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
 #include "llvm/TargetParser/Host.h"
@@ -45,9 +51,12 @@
 #include "llvm/Transforms/Coroutines/CoroEarly.h"
 #include "llvm/Transforms/Coroutines/CoroSplit.h"
 #include "llvm/Transforms/IPO/GlobalDCE.h"
+#include "llvm/Transforms/IPO/Internalize.h"
+#include "mlir/Bytecode/BytecodeReader.h"
 #include "mlir/Bytecode/BytecodeWriter.h"
 #include "mlir/Dialect/LLVMIR/LLVMDialect.h"
 #include "mlir/IR/DialectRegistry.h"
+#include "mlir/IR/Verifier.h"
 #include "mlir/InitAllDialects.h"
 #include "mlir/InitAllExtensions.h"
 #include "mlir/InitAllPasses.h"
@@ -64,7 +73,9 @@
 
 #include "Catalyst/IR/CatalystDialect.h"
 #include "Catalyst/Transforms/BufferizableOpInterfaceImpl.h"
+#include "Catalyst/Utils/CallGraph.h"
 #include "Driver/CatalystLLVMTarget.h"
+#include "Driver/CompilationCache.h"
 #include "Driver/HighResolutionOutputStrategy.h"
 #include "Driver/LineUtils.h"
 #include "Driver/PassInstrumentation.h"
@@ -84,6 +95,7 @@
 #include "QecPhysical/IR/QecPhysicalDialect.h"
 #include "Quantum/IR/QuantumDialect.h"
 #include "Quantum/Transforms/BufferizableOpInterfaceImpl.h"
+#include "Quantum/Transforms/Patterns.h"
 #include "RTIO/IR/RTIODialect.h"
 
 #include "RegisterAllPasses.h"
@@ -130,14 +142,121 @@ void registerTestDialect(mlir::DialectRegistry &);
 } // namespace test
 
 namespace catalyst::driver {
-/// Parse an MLIR module given in textual ASM representation. Any errors during parsing will be
-/// output to diagnosticStream.
-OwningOpRef<ModuleOp> parseMLIRSource(MLIRContext *ctx, const llvm::SourceMgr &sourceMgr)
+/// Collect the functions of the module that are reachable from its roots: the non-private
+/// functions, and the decomposition rules, which graph decomposition selects by their `target_gate`
+/// attribute rather than by a call. The call graph is traversed from the roots, and the functions
+/// referenced other than by a call, e.g. by gradient or mitigation ops, are traversed as well.
+/// Each function is passed to `materialize` before its body is traversed, so that lazily loaded
+/// bodies are only read once their function is reached.
+///
+/// Returns std::nullopt if the symbol uses of a function cannot be known, in which case every
+/// function must be kept.
+static std::optional<DenseSet<Operation *>>
+collectReachableFunctions(ModuleOp module, function_ref<void(func::FuncOp)> materialize)
+{
+    SymbolTableCollection symbolTable;
+    DenseSet<Operation *> reachable;
+    SmallVector<func::FuncOp> roots;
+    bool unknownUses = false;
+
+    auto collectReferences = [&](Operation *op) {
+        auto uses = SymbolTable::getSymbolUses(op);
+        if (!uses) {
+            unknownUses = true;
+            return;
+        }
+        for (const SymbolTable::SymbolUse &use : *uses) {
+            if (auto func = dyn_cast_or_null<func::FuncOp>(
+                    symbolTable.lookupSymbolIn(module, use.getSymbolRef()))) {
+                roots.push_back(func);
+            }
+        }
+    };
+
+    for (Operation &op : module.getBody()->getOperations()) {
+        auto func = dyn_cast<func::FuncOp>(op);
+        if (!func) {
+            collectReferences(&op);
+        }
+        else if (!func.isPrivate() || func->hasAttr("target_gate")) {
+            roots.push_back(func);
+        }
+    }
+
+    while (!roots.empty() && !unknownUses) {
+        func::FuncOp root = roots.pop_back_val();
+        if (reachable.contains(root)) {
+            continue;
+        }
+        traverseCallGraph(root, &symbolTable, [&](func::FuncOp func) {
+            if (reachable.insert(func).second) {
+                materialize(func);
+                collectReferences(func);
+            }
+        });
+    }
+
+    if (unknownUses) {
+        return std::nullopt;
+    }
+    return reachable;
+}
+
+/// Parse an MLIR module given in textual ASM or bytecode representation. Any errors during parsing
+/// will be output to diagnosticStream.
+OwningOpRef<ModuleOp> parseMLIRSource(MLIRContext *ctx, const llvm::SourceMgr &sourceMgr,
+                                      bool pruneFunctions)
 {
     FallbackAsmResourceMap fallbackResourceMap;
-    ParserConfig parserConfig{ctx, /*verifyAfterParse=*/true, &fallbackResourceMap};
+    const llvm::MemoryBuffer *buffer = sourceMgr.getMemoryBuffer(sourceMgr.getMainFileID());
 
-    return parseSourceFile<ModuleOp>(sourceMgr, parserConfig);
+    if (!pruneFunctions || !isBytecode(buffer->getMemBufferRef())) {
+        ParserConfig parserConfig{ctx, /*verifyAfterParse=*/true, &fallbackResourceMap};
+        OwningOpRef<ModuleOp> module = parseSourceFile<ModuleOp>(sourceMgr, parserConfig);
+        if (!module || !pruneFunctions) {
+            return module;
+        }
+        if (auto reachable = collectReachableFunctions(*module, [](func::FuncOp) {})) {
+            for (auto func : llvm::make_early_inc_range(module->getOps<func::FuncOp>())) {
+                if (!reachable->contains(func)) {
+                    func.erase();
+                }
+            }
+        }
+        return module;
+    }
+
+    // The functions of bytecode are loaded lazily, so that the bodies of the unreachable functions
+    // are never materialized, and are only verified once the module is complete
+    ParserConfig parserConfig{ctx, /*verifyAfterParse=*/false, &fallbackResourceMap};
+    BytecodeReader reader(buffer->getMemBufferRef(), parserConfig, /*lazyLoad=*/true);
+    Block block;
+    if (failed(reader.readTopLevel(&block, [](Operation *op) { return !isa<func::FuncOp>(op); }))) {
+        return nullptr;
+    }
+    auto sourceLoc = FileLineColLoc::get(ctx, buffer->getBufferIdentifier(), 0, 0);
+    OwningOpRef<ModuleOp> module =
+        mlir::detail::constructContainerOpForParserIfNecessary<ModuleOp>(&block, ctx, sourceLoc);
+    if (!module) {
+        return nullptr;
+    }
+
+    bool materialized = true;
+    auto reachable = collectReachableFunctions(*module, [&](func::FuncOp func) {
+        if (reader.isMaterializable(func)) {
+            materialized &= succeeded(reader.materialize(func));
+        }
+    });
+    auto shouldMaterialize = [&](Operation *op) {
+        auto func = dyn_cast<func::FuncOp>(op);
+        return !reachable || !func || func->getParentOp() != module->getOperation() ||
+               reachable->contains(op);
+    };
+    if (!materialized || failed(reader.finalize(shouldMaterialize)) ||
+        failed(mlir::verify(*module))) {
+        return nullptr;
+    }
+    return module;
 }
 
 /// Detect whether Enzyme differentiation is needed for the module.
@@ -185,6 +304,33 @@ void registerAllCatalystDialects(DialectRegistry &registry)
     registry.insert<qecl::QecLogicalDialect>();
     registry.insert<qecp::QecPhysicalDialect>();
 }
+
+/// Load the dialects that the Catalyst pipelines create operations of.
+void loadCatalystDialects(MLIRContext *ctx, ModuleOp moduleOp)
+{
+    // Passes run by the transform interpreter don't load the dialects they depend on, which
+    // is not allowed once the pass manager is running.
+    auto isTransformOp = [](Operation *op) {
+        return isa_and_present<transform::TransformDialect>(op->getDialect())
+                   ? WalkResult::interrupt()
+                   : WalkResult::advance();
+    };
+    if (moduleOp.walk(isTransformOp).wasInterrupted()) {
+        ctx->loadAllAvailableDialects();
+        return;
+    }
+
+    ctx->loadDialect<affine::AffineDialect, arith::ArithDialect, async::AsyncDialect,
+                     bufferization::BufferizationDialect, cf::ControlFlowDialect,
+                     complex::ComplexDialect, func::FuncDialect, index::IndexDialect,
+                     linalg::LinalgDialect, LLVM::LLVMDialect, math::MathDialect,
+                     memref::MemRefDialect, scf::SCFDialect, tensor::TensorDialect>();
+    ctx->loadDialect<CatalystDialect, quantum::QuantumDialect, pbc::PBCDialect,
+                     mbqc::MBQCDialect, ion::IonDialect, rtio::RTIODialect,
+                     gradient::GradientDialect, mitigation::MitigationDialect,
+                     pauli_frame::PauliFrameDialect, qecl::QecLogicalDialect,
+                     qecp::QecPhysicalDialect>();
+}
 } // namespace catalyst::driver
 
 // Determines if the compilation stage should be executed if a checkpointStage is given
@@ -201,6 +347,69 @@ bool catalyst::driver::shouldRunStage(const CompilerOptions &options, CompilerOu
     return true;
 }
 
+void catalyst::driver::instrumentPerfCounters(const CompilerOptions &options, ModuleOp module)
+{
+    // The Python wrapper `_catalyst_pyface_<name>` is the entry point of the function `<name>`
+    constexpr llvm::StringLiteral pyfacePrefix = "_catalyst_pyface_";
+    struct Target {
+        LLVM::LLVMFuncOp func;
+        std::string name;
+        bool isEntryPoint;
+    };
+    SmallVector<Target> targets;
+    for (auto func : module.getOps<LLVM::LLVMFuncOp>()) {
+        StringRef name = func.getSymName();
+        bool isEntryPoint = name.consume_front(pyfacePrefix);
+        bool isQnode = func->hasAttr("quantum.node") || func->hasAttr("qnode");
+        if (!func.isExternal() && (isEntryPoint || isQnode)) {
+            targets.push_back({func, name.str(), isEntryPoint});
+        }
+    }
+
+    MLIRContext *ctx = module.getContext();
+    OpBuilder builder(ctx);
+    auto calleeType = LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
+                                                  {LLVM::LLVMPointerType::get(ctx)});
+    auto getCallee = [&](StringRef name) {
+        if (auto callee = module.lookupSymbol<LLVM::LLVMFuncOp>(name)) {
+            return callee;
+        }
+        OpBuilder::InsertionGuard guard(builder);
+        builder.setInsertionPointToStart(module.getBody());
+        return LLVM::LLVMFuncOp::create(builder, module.getLoc(), name, calleeType);
+    };
+    auto beginFn = getCallee("__catalyst__rt__perf_counters_begin");
+    auto endFn = getCallee("__catalyst__rt__perf_counters_end");
+    auto writeFn = getCallee("__catalyst__rt__perf_counters_write");
+
+    for (Target &target : targets) {
+        Location loc = target.func.getLoc();
+        builder.setInsertionPointToStart(&target.func.getBody().front());
+        // The strings are materialized in the entry block, which dominates all the returns
+        Value name = quantum::getGlobalString(
+            loc, builder, "__catalyst_perf_counters_" + target.name,
+            StringRef(target.name.c_str(), target.name.length() + 1), module);
+        Value path;
+        if (target.isEntryPoint) {
+            path = quantum::getGlobalString(
+                loc, builder, "__catalyst_perf_counters_file",
+                StringRef(options.perfCounters.c_str(), options.perfCounters.length() + 1),
+                module);
+        }
+        LLVM::CallOp::create(builder, loc, beginFn, ValueRange{name});
+
+        SmallVector<LLVM::ReturnOp> returns;
+        target.func.walk([&](LLVM::ReturnOp returnOp) { returns.push_back(returnOp); });
+        for (LLVM::ReturnOp returnOp : returns) {
+            builder.setInsertionPoint(returnOp);
+            LLVM::CallOp::create(builder, loc, endFn, ValueRange{name});
+            if (path) {
+                LLVM::CallOp::create(builder, loc, writeFn, ValueRange{path});
+            }
+        }
+    }
+}
+
 llvm::LogicalResult catalyst::driver::runCoroLLVMPasses(const CompilerOptions &options,
                                                         std::shared_ptr<llvm::Module> llvmModule,
                                                         CompilerOutput &output)
@@ -246,8 +455,90 @@ llvm::LogicalResult catalyst::driver::runCoroLLVMPasses(const CompilerOptions &o
     return success();
 }
 
+llvm::LogicalResult catalyst::driver::linkRuntimeBitcode(const CompilerOptions &options,
+                                                         std::shared_ptr<llvm::Module> llvmModule,
+                                                         CompilerOutput &output)
+{
+    if (!catalyst::driver::shouldRunStage(options, output, "RuntimeLink")) {
+        return success();
+    }
+
+    llvm::SMDiagnostic err;
+    std::unique_ptr<llvm::Module> runtimeModule =
+        llvm::parseIRFile(options.runtimeBitcode, err, llvmModule->getContext());
+    if (!runtimeModule) {
+        CO_MSG(options, Verbosity::Debug,
+               "Skipping the runtime bitcode " << options.runtimeBitcode << ": "
+                                               << err.getMessage() << "\n");
+        return success();
+    }
+
+    // Functions that manage the runtime state, and any other helpers with external linkage, are
+    // resolved against the rt_capi library rather than duplicated into the program.
+    for (llvm::Function &func : runtimeModule->functions()) {
+        if (!func.isDeclaration() && func.hasExternalLinkage() &&
+            !func.getName().starts_with("__catalyst__qis__")) {
+            func.deleteBody();
+        }
+    }
+    runtimeModule->setDataLayout(llvmModule->getDataLayout());
+    runtimeModule->setTargetTriple(llvmModule->getTargetTriple());
+
+    bool linkFailed = llvm::Linker::linkModules(
+        *llvmModule, std::move(runtimeModule), llvm::Linker::LinkOnlyNeeded,
+        [](llvm::Module &module, const llvm::StringSet<> &linkedValues) {
+            llvm::internalizeModule(module, [&linkedValues](const llvm::GlobalValue &value) {
+                return !value.hasName() || !linkedValues.contains(value.getName());
+            });
+        });
+    if (linkFailed) {
+        CO_MSG(options, Verbosity::Urgent, "Failed to link the runtime bitcode\n");
+        return failure();
+    }
+
+    if (options.keepIntermediate) {
+        output.setStage("RuntimeLink");
+        std::string tmp;
+        llvm::raw_string_ostream rawStringOstream{tmp};
+        llvmModule->print(rawStringOstream, nullptr);
+        auto outFile = output.nextPipelineSummaryFilename("RuntimeLink", ".ll");
+        dumpToFile(options, outFile, tmp);
+    }
+
+    return success();
+}
+
+namespace {
+
+/// The profile-guided optimization of the O2 pipeline: either instrument the program to write raw
+/// profiles to `profileGenerate`, or optimize it with the indexed profile `profileUse`.
+std::optional<llvm::PGOOptions> getPGOOptions(const CompilerOptions &options)
+{
+    if (!options.profileGenerate.empty()) {
+        // %m distinguishes the profiles of different programs loaded in the same process
+        llvm::SmallString<256> profileFile(options.profileGenerate);
+        llvm::sys::path::append(profileFile, "catalyst-%m.profraw");
+        return llvm::PGOOptions(profileFile.str().str(), "", "", "", llvm::vfs::getRealFileSystem(),
+                                llvm::PGOOptions::IRInstr);
+    }
+    if (!options.profileUse.empty()) {
+        // A missing profile would be a hard error of the profile reader
+        if (!llvm::sys::fs::exists(options.profileUse)) {
+            CO_MSG(options, Verbosity::Debug,
+                   "Skipping the missing profile " << options.profileUse << "\n");
+            return std::nullopt;
+        }
+        return llvm::PGOOptions(options.profileUse, "", "", "", llvm::vfs::getRealFileSystem(),
+                                llvm::PGOOptions::IRUse);
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
 llvm::LogicalResult catalyst::driver::runO2LLVMPasses(const CompilerOptions &options,
                                                       std::shared_ptr<llvm::Module> llvmModule,
+                                                      llvm::TargetMachine *targetMachine,
                                                       CompilerOutput &output)
 {
     // opt -O2
@@ -273,7 +564,9 @@ llvm::LogicalResult catalyst::driver::runO2LLVMPasses(const CompilerOptions &opt
         }
         return true;
     });
-    llvm::PassBuilder PB(nullptr, llvm::PipelineTuningOptions(), std::nullopt, &PIC);
+    // The target machine lets the vectorizers use the vector registers of the target CPU
+    llvm::PassBuilder PB(targetMachine, llvm::PipelineTuningOptions(), getPGOOptions(options),
+                         &PIC);
     // Register all the basic analyses with the managers.
     PB.registerModuleAnalyses(MAM);
     PB.registerCGSCCAnalyses(CGAM);
@@ -361,7 +654,8 @@ std::string catalyst::driver::readInputFile(const std::string &filename)
         buffer << std::string(begin, end);
         return buffer.str();
     }
-    std::ifstream file(filename);
+    // The input may be MLIR bytecode, which must be read verbatim
+    std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         return "";
     }
@@ -397,9 +691,13 @@ catalyst::driver::configurePipeline(PassManager &pm, const CompilerOptions &opti
         llvm::errs() << "Pipeline creation function not found: " << pipeline.getName() << "\n";
         return failure();
     }
-    if (clHasManualPipeline &&
-        failed(parsePassPipeline(joinPasses(pipeline.getPasses()), pm, options.diagnosticStream))) {
-        return failure();
+    if (clHasManualPipeline) {
+        std::string passes = joinPasses(options.parallelQnodes
+                                            ? nestQnodePasses(pipeline.getPasses())
+                                            : pipeline.getPasses());
+        if (failed(parsePassPipeline(passes, pm, options.diagnosticStream))) {
+            return failure();
+        }
     }
     if (options.dumpPassPipeline) {
         pm.dump();
@@ -430,8 +728,8 @@ llvm::LogicalResult catalyst::driver::runPipeline(PassManager &pm, const Compile
     if (options.keepIntermediate && (options.checkpointStage.empty() || output.isCheckpointFound)) {
         std::string tmp;
         llvm::raw_string_ostream s{tmp};
-        s << moduleOp;
-        dumpToFile(options, output.nextPipelineSummaryFilename(pipeline.getName(), ".mlir"), tmp);
+        StringRef ext = printForDump(options, moduleOp, s);
+        dumpToFile(options, output.nextPipelineSummaryFilename(pipeline.getName(), ext.str()), tmp);
     }
     return success();
 }
@@ -469,8 +767,31 @@ llvm::LogicalResult catalyst::driver::runPipeline(PassManager &pm, const Compile
 
     // If pipelines are not configured explicitly, use the catalyst default pipeline
     std::vector<Pipeline> UserPipeline =
-        clHasManualPipeline ? options.pipelinesCfg : getDefaultPipeline();
-    for (auto &pipeline : UserPipeline) {
+        clHasManualPipeline ? options.pipelinesCfg : getDefaultPipeline(options.parallelQnodes);
+
+    // In incremental mode, the pipelines before the last one, which lowers to the LLVM dialect,
+    // run with the device kwargs detached, and their result is cached across compilations.
+    size_t firstPipeline = 0;
+    std::optional<std::string> snapshotKey;
+    std::vector<std::string> deviceKwargs;
+    if (hasStageSnapshots(options) && UserPipeline.size() > 1) {
+        deviceKwargs = detachDeviceKwargs(moduleOp);
+        snapshotKey = getStageSnapshotKey(options, moduleOp, ArrayRef(UserPipeline).drop_back());
+        if (restoreStageSnapshot(options, moduleOp, *snapshotKey)) {
+            firstPipeline = UserPipeline.size() - 1;
+        }
+    }
+
+    for (size_t i = firstPipeline; i < UserPipeline.size(); i++) {
+        Pipeline &pipeline = UserPipeline[i];
+        if (snapshotKey && i == UserPipeline.size() - 1) {
+            if (firstPipeline == 0) {
+                storeStageSnapshot(options, moduleOp, *snapshotKey);
+            }
+            if (failed(attachDeviceKwargs(moduleOp, deviceKwargs))) {
+                return failure();
+            }
+        }
         if (failed(catalyst::utils::Timer<>::timer(catalyst::driver::runPipeline,
                                                    pipeline.getName(),
                                                    /* add_endl */ false, pm, options, output,
@@ -584,3 +905,28 @@ void CompilerOutput::setStage(const std::string &stageName)
     currentStage = std::to_string(globalPipelineCounter) + "_" + stageName;
     passCounter = 1;
 }
+
+void CompilerOutput::writeTelemetry(llvm::raw_ostream &os) const
+{
+    // Each pass is a complete event ("ph": "X"), which trace viewers nest by time on each thread
+    llvm::json::Array events;
+    for (const PassTelemetry &record : passTelemetry) {
+        events.push_back(llvm::json::Object{
+            {"name", record.pass},
+            {"cat", "pass"},
+            {"ph", "X"},
+            {"pid", 0},
+            {"tid", static_cast<int64_t>(record.threadId)},
+            {"ts", static_cast<int64_t>(record.start.count())},
+            {"dur", static_cast<int64_t>(record.duration.count())},
+            {"args", llvm::json::Object{{"anchor", record.anchor},
+                                        {"ops_before", static_cast<int64_t>(record.opsBefore)},
+                                        {"ops_after", static_cast<int64_t>(record.opsAfter)},
+                                        {"peak_rss", static_cast<int64_t>(record.peakRSS)},
+                                        {"failed", record.failed}}}});
+    }
+    os << llvm::formatv("{0:2}", llvm::json::Value(llvm::json::Object{
+                                     {"traceEvents", std::move(events)},
+                                     {"displayTimeUnit", "ms"}}))
+       << "\n";
+}
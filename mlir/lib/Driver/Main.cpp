@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <iostream>
+
 #include "llvm/ADT/STLForwardCompat.h"
 #include "llvm/IR/LLVMContext.h" // llvm::LLVMContext
 #include "llvm/MC/TargetRegistry.h"
@@ -20,6 +22,7 @@
 #include "llvm/Support/MemoryBuffer.h"  // llvm::MemoryBuffer
 #include "llvm/Support/SMLoc.h"         // llvm::SMLoc
 #include "llvm/Support/SourceMgr.h"     // llvm::SourceMgr
+#include "llvm/Support/StringSaver.h"   // llvm::StringSaver
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Target/TargetMachine.h"
@@ -39,9 +42,11 @@
 
 #include "Catalyst/Transforms/BufferizableOpInterfaceImpl.h"
 #include "Driver/CatalystLLVMTarget.h"
+#include "Driver/CompilationCache.h"
 #include "Driver/CompilerDriver.h"
 #include "Driver/HighResolutionOutputStrategy.h"
 #include "Driver/LineUtils.h"
+#include "Driver/PluginCache.h"
 #include "Driver/Support.h"
 #include "Driver/Timer.h"
 #include "Gradient/Transforms/BufferizableOpInterfaceImpl.h"
@@ -57,6 +62,12 @@ llvm::LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOu
 {
     using timer = catalyst::utils::Timer<>;
 
+    // Skip straight to the object file of an identical earlier compilation
+    std::optional<std::string> cacheKey = getCompilationCacheKey(options, output);
+    if (cacheKey && restoreCachedObjectFile(options, *cacheKey)) {
+        return llvm::success();
+    }
+
     mlir::OpPrintingFlags opPrintingFlags{};
     if (options.useNameLocAsPrefix) {
         opPrintingFlags.printNameLocAsPrefix();
@@ -65,12 +76,12 @@ llvm::LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOu
     mlir::MLIRContext ctx(registry);
     ctx.printOpOnDiagnostic(true);
     ctx.printStackTraceOnDiagnostic(options.verbosity >= Verbosity::Debug);
-    // TODO: FIXME:
-    // Let's try to enable multithreading. Do not forget to protect the printing.
-    ctx.disableMultithreading();
-    // The transform dialect doesn't appear to load dependent dialects
-    // fpr named passes.
-    ctx.loadAllAvailableDialects();
+    // Passes nested on functions run in parallel, except while the pass instrumentation logs or
+    // dumps the IR after each pass, as it is not thread-safe.
+    if (options.keepIntermediate || options.verbosity >= Verbosity::Debug) {
+        ctx.disableMultithreading();
+    }
+    // Dialects are loaded on demand, see `loadCatalystDialects`.
 
     mlir::ScopedDiagnosticHandler scopedHandler(
         &ctx, [&](mlir::Diagnostic &diag) { diag.print(options.diagnosticStream); });
@@ -95,11 +106,13 @@ llvm::LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOu
 
     mlir::TimingScope parserTiming = timing.nest("Parser");
     mlir::OwningOpRef<mlir::ModuleOp> mlirModule =
-        timer::timer(parseMLIRSource, "parseMLIRSource", /* add_endl */ false, &ctx, *sourceMgr);
+        timer::timer(parseMLIRSource, "parseMLIRSource", /* add_endl */ false, &ctx, *sourceMgr,
+                     options.pruneFunctions);
 
     enum InputType inType = InputType::OTHER;
     if (mlirModule) {
         inType = InputType::MLIR;
+        loadCatalystDialects(&ctx, *mlirModule);
         catalyst::utils::LinesCount::call(*mlirModule);
         output.isCheckpointFound = options.checkpointStage == "mlir";
 
@@ -152,6 +165,9 @@ llvm::LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOu
 
     if (runTranslate && (inType == InputType::MLIR)) {
         mlir::TimingScope translateTiming = timing.nest("Translate");
+        if (!options.perfCounters.empty()) {
+            instrumentPerfCounters(options, *mlirModule);
+        }
         llvmModule =
             timer::timer(mlir::translateModuleToLLVMIR, "translateModuleToLLVMIR",
                          /* add_endl */ false, *mlirModule, llvmContext, "LLVMDialectModule",
@@ -197,8 +213,7 @@ llvm::LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOu
         std::string err;
         auto target = llvm::TargetRegistry::lookupTarget(targetTriple, err);
         llvm::TargetOptions opt;
-        const char *cpu = "generic";
-        const char *features = "";
+        auto [cpu, features] = catalyst::driver::getTargetCPUAndFeatures(options);
         auto targetMachine =
             target->createTargetMachine(targetTriple, cpu, features, opt, llvm::Reloc::Model::PIC_);
         targetMachine->setOptLevel(llvm::CodeGenOptLevel::None);
@@ -216,15 +231,30 @@ llvm::LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOu
         }
 
         bool enzymeRun = catalyst::driver::containsGradients(*llvmModule);
-        if (enzymeRun) {
+        // Enzyme would have to analyze the device calls of the inlined runtime, so programs with
+        // gradients keep calling into the rt_capi library.
+        bool runtimeLink = !enzymeRun && !options.runtimeBitcode.empty();
+        if (runtimeLink) {
+            mlir::TimingScope runtimeLinkTiming = llcTiming.nest("Link runtime bitcode");
+            if (failed(timer::timer(linkRuntimeBitcode, "linkRuntimeBitcode", /* add_endl */ false,
+                                    options, llvmModule, output))) {
+                return llvm::failure();
+            }
+            runtimeLinkTiming.stop();
+            catalyst::utils::LinesCount::call(*llvmModule.get());
+        }
+
+        if (enzymeRun || runtimeLink) {
             mlir::TimingScope o2PassesTiming = llcTiming.nest("LLVM O2 passes");
             if (failed(timer::timer(runO2LLVMPasses, "runO2LLVMPasses", /* add_endl */ false,
-                                    options, llvmModule, output))) {
+                                    options, llvmModule, targetMachine, output))) {
                 return llvm::failure();
             }
             o2PassesTiming.stop();
             catalyst::utils::LinesCount::call(*llvmModule.get());
+        }
 
+        if (enzymeRun) {
             mlir::TimingScope enzymePassesTiming = llcTiming.nest("Enzyme passes");
             if (failed(timer::timer(runEnzymePasses, "runEnzymePasses", /* add_endl */ false,
                                     options, llvmModule, output))) {
@@ -255,6 +285,9 @@ llvm::LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOu
                                 options.getObjectFile()))) {
             return llvm::failure();
         }
+        if (cacheKey) {
+            storeCachedObjectFile(options, *cacheKey);
+        }
         outputTiming.stop();
         llcTiming.stop();
 
@@ -322,6 +355,43 @@ int QuantumDriverMainFromCL(int argc, char **argv)
                                      cl::cat(CatalystCat));
     cl::opt<bool> AsyncQNodes("async-qnodes", cl::desc("Enable asynchronous QNodes"),
                               cl::init(false), cl::cat(CatalystCat));
+    cl::opt<std::string> RuntimeBitcode(
+        "runtime-bitcode", cl::desc("LLVM bitcode of the runtime C-API to link into the program"),
+        cl::init(""), cl::cat(CatalystCat));
+    cl::opt<std::string> CacheDir("cache-dir",
+                                  cl::desc("Directory of the cache of compiled object files"),
+                                  cl::init(""), cl::cat(CatalystCat));
+    cl::opt<unsigned> CodegenThreads(
+        "codegen-threads",
+        cl::desc("Number of threads for object code emission (0 for all hardware threads)"),
+        cl::init(1), cl::cat(CatalystCat));
+    cl::opt<std::string> TelemetryFile(
+        "telemetry", cl::desc("Write the compile-time telemetry of each pass to a JSON file"),
+        cl::init(""), cl::cat(CatalystCat));
+    cl::opt<std::string> PerfCounters(
+        "perf-counters",
+        cl::desc("Instrument the program to write the hardware performance counters of each qnode "
+                 "and entry point to a JSON file"),
+        cl::init(""), cl::cat(CatalystCat));
+    cl::opt<bool> Incremental(
+        "incremental",
+        cl::desc("Resume from the last pipeline when only the device kwargs change (requires "
+                 "--cache-dir)"),
+        cl::init(false), cl::cat(CatalystCat));
+    cl::opt<std::string> ProfileGenerate(
+        "profile-generate",
+        cl::desc("Instrument the program to write raw LLVM profiles to the given directory"),
+        cl::init(""), cl::cat(CatalystCat));
+    cl::opt<std::string> ProfileUse(
+        "profile-use", cl::desc("Optimize the program with the given indexed LLVM profile"),
+        cl::init(""), cl::cat(CatalystCat));
+    cl::opt<std::string> TargetCPU(
+        "target-cpu", cl::desc("CPU to generate code for, or native for the host CPU"),
+        cl::init(""), cl::cat(CatalystCat));
+    cl::opt<std::string> TargetFeatures(
+        "target-features",
+        cl::desc("Comma-separated target features to enable (+feature) or disable (-feature)"),
+        cl::init(""), cl::cat(CatalystCat));
     cl::opt<bool> Verbose("verbose", cl::desc("Set verbose"), cl::init(false),
                           cl::cat(CatalystCat));
     cl::list<std::string> CatalystPipeline(
@@ -344,6 +414,21 @@ int QuantumDriverMainFromCL(int argc, char **argv)
     cl::opt<bool> DumpModuleScope("dump-module-scope",
                                   cl::desc("Print the whole module in intermediate files"),
                                   cl::init(true), cl::cat(CatalystCat));
+    cl::opt<bool> DumpBytecode("dump-bytecode",
+                               cl::desc("Save the intermediate MLIR files as bytecode"),
+                               cl::init(false), cl::cat(CatalystCat));
+    cl::opt<bool> PruneFunctions(
+        "prune-unreachable-functions",
+        cl::desc("Erase the private functions that are never called after parsing"),
+        cl::init(true), cl::cat(CatalystCat));
+    cl::opt<bool> ParallelQnodes(
+        "parallel-qnodes",
+        cl::desc("Run the qnode-local passes on each qnode module in parallel before inlining"),
+        cl::init(false), cl::cat(CatalystCat));
+    cl::opt<bool> Server(
+        "server",
+        cl::desc("Serve the compilations whose arguments are read from each line of stdin"),
+        cl::init(false), cl::cat(CatalystCat));
 
     // Create dialect registry
     mlir::DialectRegistry registry;
@@ -367,8 +452,16 @@ int QuantumDriverMainFromCL(int argc, char **argv)
                           "In the first section, you can find the options that are used to"
                           "configure the Catalyst compiler. Next, you can find the options"
                           "specific to the mlir-opt tool.\n";
-    std::tie(inputFilename, outputFilename) =
-        registerAndParseCLIOptions(argc, argv, helpStr, registry);
+
+    // Plugins are loaded by the driver rather than by the MLIR options, so that they are loaded
+    // once for all the compilations of a server
+    llvm::SmallVector<const char *> cliArgs(argv, argv + argc);
+    std::vector<std::string> pluginDigests;
+    if (mlir::failed(loadPlugins(cliArgs, registry, pluginDigests))) {
+        return llvm::to_underlying(ErrorCode::Failure);
+    }
+    std::tie(inputFilename, outputFilename) = registerAndParseCLIOptions(
+        cliArgs.size(), const_cast<char **>(cliArgs.data()), helpStr, registry);
     llvm::InitLLVM y(argc, argv);
     MlirOptMainConfig config = MlirOptMainConfig::createFromCLOptions();
 
@@ -384,43 +477,114 @@ int QuantumDriverMainFromCL(int argc, char **argv)
         return 0;
     }
 
-    std::unique_ptr<CompilerOutput> output(new CompilerOutput());
-    assert(output);
-    output->outputFilename = outputFilename;
-    llvm::raw_string_ostream errStream{output->diagnosticMessages};
+    auto compile = [&](const std::string &inputFile, const std::string &outputFile) -> int {
+        std::unique_ptr<CompilerOutput> output(new CompilerOutput());
+        assert(output);
+        output->outputFilename = outputFile;
+        llvm::raw_string_ostream errStream{output->diagnosticMessages};
+
+        // Read the input IR file
+        std::string source = readInputFile(inputFile);
+        if (source.empty()) {
+            llvm::errs() << "Error: Unable to read input file: " << inputFile << "\n";
+            return 1;
+        }
 
-    // Read the input IR file
-    std::string source = readInputFile(inputFilename);
-    if (source.empty()) {
-        llvm::errs() << "Error: Unable to read input file: " << inputFilename << "\n";
-        return 1;
-    }
+        CompilerOptions options{.source = source,
+                                .workspace = WorkspaceDir,
+                                .moduleName = ModuleName,
+                                .diagnosticStream = errStream,
+                                .keepIntermediate = SaveAfterEach,
+                                .dumpModuleScope = DumpModuleScope,
+                                .dumpBytecode = DumpBytecode,
+                                .pruneFunctions = PruneFunctions,
+                                .parallelQnodes = ParallelQnodes,
+                                .useNameLocAsPrefix = UseNameLocAsPrefix,
+                                .asyncQnodes = AsyncQNodes,
+                                .verbosity = Verbose ? Verbosity::All : Verbosity::Urgent,
+                                .pipelinesCfg = parsePipelines(CatalystPipeline),
+                                .checkpointStage = CheckpointStage,
+                                .loweringAction = LoweringAction,
+                                .dumpPassPipeline = DumpPassPipeline,
+                                .shouldEmitBytecode = config.shouldEmitBytecode(),
+                                .runtimeBitcode = RuntimeBitcode,
+                                .cacheDir = CacheDir,
+                                .codegenThreads = CodegenThreads,
+                                .telemetryFile = TelemetryFile,
+                                .perfCounters = PerfCounters,
+                                .incremental = Incremental,
+                                .profileGenerate = ProfileGenerate,
+                                .profileUse = ProfileUse,
+                                .targetCPU = TargetCPU,
+                                .targetFeatures = TargetFeatures,
+                                .pluginDigests = pluginDigests};
+
+        mlir::LogicalResult result = QuantumDriverMain(options, *output, registry);
+
+        // Telemetry is also written for failed compilations, up to the failing pass
+        if (!options.telemetryFile.empty()) {
+            std::error_code errCode;
+            llvm::raw_fd_ostream telemetryStream(options.telemetryFile, errCode);
+            if (errCode) {
+                errStream << "Unable to open the telemetry file: " << errCode.message() << "\n";
+            }
+            else {
+                output->writeTelemetry(telemetryStream);
+            }
+        }
 
-    CompilerOptions options{.source = source,
-                            .workspace = WorkspaceDir,
-                            .moduleName = ModuleName,
-                            .diagnosticStream = errStream,
-                            .keepIntermediate = SaveAfterEach,
-                            .dumpModuleScope = DumpModuleScope,
-                            .useNameLocAsPrefix = UseNameLocAsPrefix,
-                            .asyncQnodes = AsyncQNodes,
-                            .verbosity = Verbose ? Verbosity::All : Verbosity::Urgent,
-                            .pipelinesCfg = parsePipelines(CatalystPipeline),
-                            .checkpointStage = CheckpointStage,
-                            .loweringAction = LoweringAction,
-                            .dumpPassPipeline = DumpPassPipeline,
-                            .shouldEmitBytecode = config.shouldEmitBytecode()};
-
-    mlir::LogicalResult result = QuantumDriverMain(options, *output, registry);
-
-    errStream.flush();
-
-    if (mlir::failed(result)) {
-        llvm::errs() << "Compilation failed:\n" << output->diagnosticMessages << "\n";
-        return llvm::to_underlying(ErrorCode::Failure);
+        errStream.flush();
+
+        if (mlir::failed(result)) {
+            llvm::errs() << "Compilation failed:\n" << output->diagnosticMessages << "\n";
+            return llvm::to_underlying(ErrorCode::Failure);
+        }
+
+        // The standard output of the server only holds the exit codes of the compilations
+        if (Verbose)
+            (Server ? llvm::errs() : llvm::outs())
+                << "Compilation successful:\n" << output->diagnosticMessages << "\n";
+        return llvm::to_underlying(ErrorCode::Success);
+    };
+
+    if (!Server) {
+        return compile(inputFilename, outputFilename);
     }
 
-    if (Verbose)
-        llvm::outs() << "Compilation successful:\n" << output->diagnosticMessages << "\n";
+    // In server mode, each line of the standard input holds the arguments of a compilation, as on
+    // the command line, and its exit code is written to a line of the standard output once it is
+    // done. The standard output only holds the exit codes, so the compilations write their output
+    // to a file. The dialects, passes, pipelines and plugins are only registered once for all the
+    // compilations.
+    std::string request;
+    while (std::getline(std::cin, request)) {
+        llvm::BumpPtrAllocator allocator;
+        llvm::StringSaver saver(allocator);
+        llvm::SmallVector<const char *> args{argv[0]};
+        cl::TokenizeGNUCommandLine(request, saver, args);
+
+        // The options are validated first, as the parsing of `registerAndParseCLIOptions` exits
+        // the process on invalid options.
+        int exitCode = llvm::to_underlying(ErrorCode::Failure);
+        cl::ResetAllOptionOccurrences();
+        if (mlir::succeeded(loadPlugins(args, registry, pluginDigests)) &&
+            cl::ParseCommandLineOptions(args.size(), args.data(), helpStr, &llvm::errs())) {
+            cl::ResetAllOptionOccurrences();
+            std::tie(inputFilename, outputFilename) = registerAndParseCLIOptions(
+                args.size(), const_cast<char **>(args.data()), helpStr, registry);
+            config = MlirOptMainConfig::createFromCLOptions();
+            if (inputFilename == "-") {
+                llvm::errs() << "Error: The input of a served compilation must be a file\n";
+            }
+            else if (outputFilename == "-") {
+                llvm::errs() << "Error: The output of a served compilation must be a file\n";
+            }
+            else {
+                exitCode = compile(inputFilename, outputFilename);
+            }
+        }
+        llvm::outs() << exitCode << "\n";
+        llvm::outs().flush();
+    }
     return llvm::to_underlying(ErrorCode::Success);
 }
@@ -14,8 +14,12 @@
 
 #include "Driver/PassInstrumentation.h"
 
+#include <sys/resource.h>
+
+#include "llvm/Support/Threading.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/SymbolTable.h"
 #include "mlir/Pass/Pass.h"
 
 #include "Driver/CompilerDriver.h"
@@ -23,6 +27,31 @@
 #include "Driver/Support.h"
 #include "Driver/Timer.h"
 
+namespace {
+
+size_t countOperations(mlir::Operation *operation)
+{
+    size_t count = 0;
+    operation->walk([&count](mlir::Operation *) { count++; });
+    return count;
+}
+
+size_t getPeakRSS()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss;
+#else
+    // Reported in kilobytes on Linux
+    return usage.ru_maxrss * 1024;
+#endif
+}
+
+} // namespace
+
 namespace catalyst {
 
 CatalystPassInstrumentation::CatalystPassInstrumentation(const driver::CompilerOptions &options,
@@ -40,10 +69,17 @@ void CatalystPassInstrumentation::runBeforePass(mlir::Pass *pass, mlir::Operatio
     if (this->options.keepIntermediate == driver::SaveTemps::AfterPassChanged) {
         this->beforePassFingerprints[pass] = mlir::OperationFingerPrint(operation);
     }
+    if (!this->options.telemetryFile.empty()) {
+        this->beginTelemetry(pass, operation);
+    }
 }
 
 void CatalystPassInstrumentation::runAfterPass(mlir::Pass *pass, mlir::Operation *operation)
 {
+    if (!this->options.telemetryFile.empty()) {
+        this->endTelemetry(pass, operation, /* failed */ false);
+    }
+
     // Handle verbosity logging
     if (this->options.verbosity >= driver::Verbosity::Debug) {
         auto pipelineName = pass->getName();
@@ -77,6 +113,10 @@ void CatalystPassInstrumentation::runAfterPass(mlir::Pass *pass, mlir::Operation
 
 void CatalystPassInstrumentation::runAfterPassFailed(mlir::Pass *pass, mlir::Operation *operation)
 {
+    if (!this->options.telemetryFile.empty()) {
+        this->endTelemetry(pass, operation, /* failed */ true);
+    }
+
     // Always dump on failure for debugging
     this->options.diagnosticStream << "While processing '" << pass->getName().str() << "' pass ";
     std::string tmp;
@@ -101,21 +141,61 @@ void CatalystPassInstrumentation::dumpIRAfterPass(mlir::Pass *pass, mlir::Operat
     // Save IR after pass
     std::string tmp;
     llvm::raw_string_ostream s{tmp};
+    mlir::Operation *dumped = op;
     if (this->options.dumpModuleScope) {
-        mlir::ModuleOp mod = isa<mlir::ModuleOp>(op) ? cast<mlir::ModuleOp>(op)
-                                                     : op->getParentOfType<mlir::ModuleOp>();
-        s << mod;
-    }
-    else {
-        s << *op;
+        dumped = isa<mlir::ModuleOp>(op) ? op : op->getParentOfType<mlir::ModuleOp>();
     }
+    mlir::StringRef ext = printForDump(this->options, dumped, s);
     std::string fileName;
     llvm::raw_string_ostream os(fileName);
     os << pipelineName;
     if (auto funcOp = dyn_cast<mlir::func::FuncOp>(op)) {
         os << '_' << funcOp.getName();
     }
-    dumpToFile(this->options, this->output.nextPassDumpFilename(fileName), tmp);
+    dumpToFile(this->options, this->output.nextPassDumpFilename(fileName, ext.str()), tmp);
+}
+
+void CatalystPassInstrumentation::beginTelemetry(mlir::Pass *pass, mlir::Operation *operation)
+{
+    size_t opsBefore = countOperations(operation);
+    std::lock_guard<std::mutex> lock(this->telemetryMutex);
+    this->runningPasses[{pass, operation}] = {std::chrono::steady_clock::now(), opsBefore};
+}
+
+void CatalystPassInstrumentation::endTelemetry(mlir::Pass *pass, mlir::Operation *operation,
+                                               bool failed)
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    auto end = std::chrono::steady_clock::now();
+    size_t opsAfter = countOperations(operation);
+
+    std::string anchor = operation->getName().getStringRef().str();
+    if (auto symbolName = operation->getAttrOfType<mlir::StringAttr>(
+            mlir::SymbolTable::getSymbolAttrName())) {
+        anchor += " @" + symbolName.str();
+    }
+    llvm::StringRef passArgument = pass->getArgument();
+
+    std::lock_guard<std::mutex> lock(this->telemetryMutex);
+    auto it = this->runningPasses.find({pass, operation});
+    if (it == this->runningPasses.end()) {
+        return;
+    }
+    auto [start, opsBefore] = it->second;
+    this->runningPasses.erase(it);
+
+    this->output.passTelemetry.push_back(driver::PassTelemetry{
+        .pass = passArgument.empty() ? pass->getName().str() : passArgument.str(),
+        .anchor = std::move(anchor),
+        .threadId = llvm::get_threadid(),
+        .start = duration_cast<microseconds>(start - this->output.startTime),
+        .duration = duration_cast<microseconds>(end - start),
+        .opsBefore = opsBefore,
+        .opsAfter = opsAfter,
+        .peakRSS = getPeakRSS(),
+        .failed = failed});
 }
 
 } // namespace catalyst
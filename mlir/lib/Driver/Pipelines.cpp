@@ -59,6 +59,41 @@ using namespace mlir;
 namespace catalyst {
 namespace driver {
 
+llvm::SmallVector<std::string> nestQnodePasses(llvm::ArrayRef<std::string> passes)
+{
+    // The passes that only rewrite the inside of a qnode, and only create functions in the module
+    // of the qnode, so that they are correct on each qnode module separately.
+    static constexpr llvm::StringLiteral qnodeLocalPasses[] = {"adjoint-lowering"};
+
+    llvm::SmallVector<std::string> nested(passes.begin(), passes.end());
+    auto *inlineIt = llvm::find(nested, "inline-nested-module");
+    if (inlineIt == nested.end()) {
+        return nested;
+    }
+    llvm::SmallVector<std::string> localPasses;
+    for (const std::string &pass : llvm::make_range(std::next(inlineIt), nested.end())) {
+        if (llvm::is_contained(qnodeLocalPasses, pass)) {
+            localPasses.push_back(pass);
+        }
+    }
+    if (localPasses.empty()) {
+        return nested;
+    }
+
+    // The local passes stay after the inlining too, for the qnodes that are not in a nested module
+    // and the ops that the passes in between create, where they find little left to do.
+    std::string joined = fmt::format("{}", fmt::join(localPasses, ","));
+    if (inlineIt != nested.begin()) {
+        llvm::StringRef previous = *std::prev(inlineIt);
+        if (previous.starts_with("builtin.module(") && previous.ends_with(")")) {
+            std::prev(inlineIt)->insert(previous.size() - 1, "," + joined);
+            return nested;
+        }
+    }
+    nested.insert(inlineIt, fmt::format("builtin.module({})", joined));
+    return nested;
+}
+
 void parsePassPipeline(const PassNames &passNames, OpPassManager &pm)
 {
     std::string passNamesStr = fmt::format("{}", fmt::join(passNames, ","));
@@ -72,6 +107,13 @@ void createQuantumCompilationStage(OpPassManager &pm)
     parsePassPipeline(getQuantumCompilationStage(), pm);
 }
 
+void createParallelQuantumCompilationStage(OpPassManager &pm)
+{
+    PassNames passNames = getQuantumCompilationStage();
+    auto nested = nestQnodePasses(passNames);
+    parsePassPipeline(PassNames{nested.begin(), nested.end()}, pm);
+}
+
 void createHLOLoweringStage(OpPassManager &pm) { parsePassPipeline(getHLOLoweringStage(), pm); }
 
 void createGradientLoweringStage(OpPassManager &pm)
@@ -145,12 +187,13 @@ void registerAllCatalystPipelines()
     registerDefaultCatalystPipeline();
 }
 
-std::vector<Pipeline> getDefaultPipeline()
+std::vector<Pipeline> getDefaultPipeline(bool parallelQnodes)
 {
     using PipelineFunc = void (*)(mlir::OpPassManager &);
     std::vector<PipelineFunc> pipelineFuncs = {
-        &createQuantumCompilationStage, &createHLOLoweringStage, &createGradientLoweringStage,
-        &createBufferizationStage, &createLLVMDialectLoweringStage};
+        parallelQnodes ? &createParallelQuantumCompilationStage : &createQuantumCompilationStage,
+        &createHLOLoweringStage, &createGradientLoweringStage, &createBufferizationStage,
+        &createLLVMDialectLoweringStage};
 
     llvm::SmallVector<std::string> defaultPipelineNames = {
         "QuantumCompilationStage", "HLOLoweringStage", "GradientLoweringStage",
@@ -0,0 +1,144 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Driver/PluginCache.h"
+
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/SHA256.h"
+#include "llvm/Support/raw_ostream.h"
+#include "mlir/Tools/Plugins/DialectPlugin.h"
+#include "mlir/Tools/Plugins/PassPlugin.h"
+
+using namespace mlir;
+
+namespace {
+
+enum class PluginKind { Pass, Dialect };
+
+constexpr llvm::StringLiteral passPluginOption = "load-pass-plugin";
+constexpr llvm::StringLiteral dialectPluginOption = "load-dialect-plugin";
+
+/// The digests of the plugin files loaded by the process, by path
+llvm::StringMap<std::string> &getLoadedFiles()
+{
+    static llvm::StringMap<std::string> loadedFiles;
+    return loadedFiles;
+}
+
+/// The plugins registered by the process, by kind and digest. Plugins with the same contents are
+/// only registered once, as their passes would otherwise be registered again with another TypeID.
+llvm::StringSet<> &getRegisteredPlugins()
+{
+    static llvm::StringSet<> registeredPlugins;
+    return registeredPlugins;
+}
+
+LogicalResult loadPlugin(PluginKind kind, llvm::StringRef path, DialectRegistry &registry,
+                         std::string &digest)
+{
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!buffer) {
+        llvm::errs() << "Unable to read plugin '" << path << "': " << buffer.getError().message()
+                     << "\n";
+        return failure();
+    }
+    digest = llvm::toHex(llvm::SHA256::hash(llvm::arrayRefFromStringRef((*buffer)->getBuffer())),
+                         /* LowerCase */ true);
+
+    auto [loadedFile, isNewFile] = getLoadedFiles().try_emplace(path, digest);
+    if (!isNewFile && loadedFile->second != digest) {
+        llvm::errs() << "Plugin '" << path
+                     << "' changed since it was loaded; restart the compiler to use it\n";
+        return failure();
+    }
+
+    std::string pluginKey = (kind == PluginKind::Pass ? "pass:" : "dialect:") + digest;
+    if (getRegisteredPlugins().contains(pluginKey)) {
+        return success();
+    }
+
+    if (kind == PluginKind::Pass) {
+        auto plugin = PassPlugin::load(path.str());
+        if (!plugin) {
+            llvm::errs() << "Failed to load pass plugin from '" << path
+                         << "': " << llvm::toString(plugin.takeError()) << "\n";
+            return failure();
+        }
+        plugin->registerPassRegistryCallbacks();
+    }
+    else {
+        auto plugin = DialectPlugin::load(path.str());
+        if (!plugin) {
+            llvm::errs() << "Failed to load dialect plugin from '" << path
+                         << "': " << llvm::toString(plugin.takeError()) << "\n";
+            return failure();
+        }
+        plugin->registerDialectRegistryCallbacks(registry);
+    }
+    getRegisteredPlugins().insert(pluginKey);
+    return success();
+}
+
+} // namespace
+
+LogicalResult catalyst::driver::loadPlugins(llvm::SmallVectorImpl<const char *> &args,
+                                            DialectRegistry &registry,
+                                            std::vector<std::string> &pluginDigests)
+{
+    pluginDigests.clear();
+    llvm::SmallVector<const char *> remainingArgs;
+    for (size_t idx = 0; idx < args.size(); idx++) {
+        llvm::StringRef arg = args[idx];
+        if (idx == 0 || !(arg.consume_front("--") || arg.consume_front("-"))) {
+            remainingArgs.push_back(args[idx]);
+            continue;
+        }
+
+        PluginKind kind;
+        if (arg.consume_front(passPluginOption)) {
+            kind = PluginKind::Pass;
+        }
+        else if (arg.consume_front(dialectPluginOption)) {
+            kind = PluginKind::Dialect;
+        }
+        else {
+            remainingArgs.push_back(args[idx]);
+            continue;
+        }
+
+        // The path is given as `--option=path` or as the next argument
+        llvm::StringRef path;
+        if (arg.consume_front("=")) {
+            path = arg;
+        }
+        else if (arg.empty() && idx + 1 < args.size()) {
+            path = args[++idx];
+        }
+        else {
+            remainingArgs.push_back(args[idx]);
+            continue;
+        }
+
+        if (failed(loadPlugin(kind, path, registry, pluginDigests.emplace_back()))) {
+            return failure();
+        }
+    }
+    args.assign(remainingArgs.begin(), remainingArgs.end());
+    return success();
+}
@@ -199,7 +199,10 @@ namespace {
 constexpr int64_t UNKNOWN = ShapedType::kDynamic;
 
 struct AdjointOpPattern : public ConvertOpToLLVMPattern<AdjointOp> {
-    using ConvertOpToLLVMPattern::ConvertOpToLLVMPattern;
+    AdjointOpPattern(const LLVMTypeConverter &typeConverter, uint64_t checkpointInterval)
+        : ConvertOpToLLVMPattern(typeConverter), checkpointInterval(checkpointInterval)
+    {
+    }
 
     LogicalResult matchAndRewrite(AdjointOp op, AdjointOpAdaptor adaptor,
                                   ConversionPatternRewriter &rewriter) const override
@@ -237,6 +240,23 @@ struct AdjointOpPattern : public ConvertOpToLLVMPattern<AdjointOp> {
         LLVM::LLVMFuncOp gradFnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
             rewriter, op, gradFnName, gradFnSignature);
 
+        // Ask the device to checkpoint its state during the forward pass, so that the backward
+        // pass recomputes the segments between checkpoints instead of keeping every state.
+        LLVM::LLVMFuncOp checkpointFnDecl;
+        auto setCheckpointInterval = [&](uint64_t interval) {
+            Value value =
+                LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(interval));
+            LLVM::CallOp::create(rewriter, loc, checkpointFnDecl, value);
+        };
+        if (checkpointInterval > 0) {
+            StringRef checkpointFnName = "__catalyst__rt__set_tape_checkpoint_interval";
+            Type checkpointFnSignature = LLVM::LLVMFunctionType::get(
+                LLVM::LLVMVoidType::get(ctx), IntegerType::get(ctx, 64));
+            checkpointFnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
+                rewriter, op, checkpointFnName, checkpointFnSignature);
+            setCheckpointInterval(checkpointInterval);
+        }
+
         // Run the forward pass and cache the circuit.
         Value c_true = LLVM::ConstantOp::create(
             rewriter, loc, rewriter.getIntegerAttr(IntegerType::get(ctx, 1), 1));
@@ -263,6 +283,10 @@ struct AdjointOpPattern : public ConvertOpToLLVMPattern<AdjointOp> {
         }
 
         LLVM::CallOp::create(rewriter, loc, gradFnDecl, args);
+        // The interval is kept by the runtime, so it is cleared for the devices initialized later
+        if (checkpointInterval > 0) {
+            setCheckpointInterval(0);
+        }
         catalyst::quantum::DeallocOp::create(rewriter, loc, qreg);
         catalyst::quantum::DeviceReleaseOp::create(rewriter, loc);
 
@@ -270,6 +294,9 @@ struct AdjointOpPattern : public ConvertOpToLLVMPattern<AdjointOp> {
 
         return success();
     }
+
+  private:
+    uint64_t checkpointInterval;
 };
 
 /// Options that configure preprocessing done on MemRefs before being passed to Enzyme.
@@ -304,10 +331,13 @@ struct BackpropOpPattern : public ConvertOpToLLVMPattern<BackpropOp> {
         }
         SymbolTableCollection symbolTable;
         catalyst::traverseCallGraph(callee, &symbolTable, [&](func::FuncOp func) {
-            // Register custom gradients of quantum functions
-            if (func->hasAttrOfType<FlatSymbolRefAttr>("gradient.qgrad")) {
+            // Register custom gradients of quantum functions, given either by their quantum
+            // Jacobian or by their vector-Jacobian product
+            bool isVJP = func->hasAttrOfType<FlatSymbolRefAttr>("gradient.qvjp");
+            if (isVJP || func->hasAttrOfType<FlatSymbolRefAttr>("gradient.qgrad")) {
                 auto qgradFn = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
-                    func, func->getAttrOfType<FlatSymbolRefAttr>("gradient.qgrad"));
+                    func, func->getAttrOfType<FlatSymbolRefAttr>(isVJP ? "gradient.qvjp"
+                                                                       : "gradient.qgrad"));
 
                 // When lowering multiple backprop ops, the callee type will be mutated by the
                 // wrapped op. Save the original unwrapped function type so that later backprop
@@ -323,7 +353,7 @@ struct BackpropOpPattern : public ConvertOpToLLVMPattern<BackpropOp> {
 
                 func::FuncOp augFwd = genAugmentedForward(func, rewriter);
                 func::FuncOp customQGrad =
-                    genCustomQGradient(func, func.getLoc(), qgradFn, rewriter);
+                    genCustomQGradient(func, func.getLoc(), qgradFn, rewriter, isVJP);
                 insertEnzymeCustomGradient(rewriter, func->getParentOfType<ModuleOp>(),
                                            func.getLoc(), func, augFwd, customQGrad);
             }
@@ -605,8 +635,11 @@ struct BackpropOpPattern : public ConvertOpToLLVMPattern<BackpropOp> {
     /// and applies the chain rule via multiplication with the quantum derivative to produce the
     /// gradient of the final output with respect to the gate parameters. This is stored in the
     /// appropriate shadow argument.
+    ///
+    /// If `isVJP` is set, `qgradFn` instead takes the cotangents after the QNode inputs and
+    /// directly returns their product with the quantum derivative, which is added to the shadow.
     func::FuncOp genCustomQGradient(func::FuncOp qnode, Location loc, func::FuncOp qgradFn,
-                                    OpBuilder &builder) const
+                                    OpBuilder &builder, bool isVJP = false) const
     {
         std::string customQGradName = (qnode.getName() + ".customqgrad").str();
         auto customQGrad = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
@@ -662,29 +695,47 @@ struct BackpropOpPattern : public ConvertOpToLLVMPattern<BackpropOp> {
             }
         }
 
-        SmallVector<Value> primalInputs{
-            ValueRange{unwrappedInputs}.take_front(qgradFn.getNumArguments() - 1)};
+        // The QNode has n inputs and m outputs (in destination-passing style).
+        // The customQGrad arguments are: [
+        //   inprimal_0, inshadow_0,
+        //   ...,
+        //   inprimal_n, inshadow_n,
+        //   outprimal_0, outshadow_0,
+        //   ...,
+        //   outprimal_m, outshadow_m
+        // ]
+        // This indexing extracts [outshadow_0, ..., outshadow_m]
+        SmallVector<Value> resultShadows;
+        for (unsigned i = 0; i < qnodeType.getNumResults(); i++) {
+            Value wrapped = block->getArgument((i + qnodeType.getNumInputs()) * 2 + 1);
+            resultShadows.push_back(unwrapMemRef(wrapped, qnodeType.getResult(i)));
+        }
+
+        unsigned numPrimalInputs =
+            qgradFn.getNumArguments() - 1 - (isVJP ? qnodeType.getNumResults() : 0);
+        SmallVector<Value> primalInputs{ValueRange{unwrappedInputs}.take_front(numPrimalInputs)};
         Value gateParamShadow = unwrappedShadows.back();
         assert(cast<MemRefType>(gateParamShadow.getType()).getRank() == 1 &&
                "Expected gate parameter list to be a rank-1 memref");
         Value pcount = memref::DimOp::create(builder, loc, gateParamShadow, 0);
-        primalInputs.push_back(pcount);
 
+        if (isVJP) {
+            // The vector-Jacobian product already has the shape [G] of the gate param shadow, to
+            // which it is added.
+            primalInputs.append(resultShadows);
+            primalInputs.push_back(pcount);
+            auto qvjp = func::CallOp::create(builder, loc, qgradFn, primalInputs);
+            linalg::AddOp::create(builder, loc, ValueRange{gateParamShadow, qvjp.getResult(0)},
+                                  ValueRange{gateParamShadow});
+            func::ReturnOp::create(builder, loc);
+            return customQGrad;
+        }
+
+        primalInputs.push_back(pcount);
         auto qgrad = func::CallOp::create(builder, loc, qgradFn, primalInputs);
 
         for (unsigned i = 0; i < qnodeType.getNumResults(); i++) {
-            // The QNode has n inputs and m outputs (in destination-passing style).
-            // The customQGrad arguments are: [
-            //   inprimal_0, inshadow_0,
-            //   ...,
-            //   inprimal_n, inshadow_n,
-            //   outprimal_0, outshadow_0,
-            //   ...,
-            //   outprimal_m, outshadow_m
-            // ]
-            // This indexing extracts [outshadow_0, ..., outshadow_m]
-            Value resultShadow = unwrapMemRef(
-                block->getArgument((i + qnodeType.getNumInputs()) * 2 + 1), qnodeType.getResult(i));
+            Value resultShadow = resultShadows[i];
 
             // If G is the number of gate params and [...result] is the shape of the result with
             // rank R:
@@ -1075,9 +1126,10 @@ struct ReturnOpPattern : public ConvertOpToLLVMPattern<ReturnOp> {
 namespace catalyst {
 namespace gradient {
 
-void populateConversionPatterns(LLVMTypeConverter &typeConverter, RewritePatternSet &patterns)
+void populateConversionPatterns(LLVMTypeConverter &typeConverter, RewritePatternSet &patterns,
+                                uint64_t adjointCheckpointInterval)
 {
-    patterns.add<AdjointOpPattern>(typeConverter);
+    patterns.add<AdjointOpPattern>(typeConverter, adjointCheckpointInterval);
     patterns.add<BackpropOpPattern>(typeConverter);
     patterns.add<ForwardOpPattern>(typeConverter);
     patterns.add<ReverseOpPattern>(typeConverter);
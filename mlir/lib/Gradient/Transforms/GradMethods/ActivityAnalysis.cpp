@@ -0,0 +1,103 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ActivityAnalysis.hpp"
+
+#include "llvm/ADT/DenseSet.h"
+#include "mlir/IR/BuiltinAttributes.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+
+#include "Quantum/IR/QuantumDialect.h"
+
+namespace catalyst {
+namespace gradient {
+
+constexpr const char *inactiveParamsKey = "gradient.inactive_params";
+
+/// Values of these types can carry a derivative.
+static bool isDifferentiableType(Type type)
+{
+    if (auto shapedType = dyn_cast<ShapedType>(type)) {
+        type = shapedType.getElementType();
+    }
+    return isa<FloatType, ComplexType>(type);
+}
+
+/// Conservatively check whether `value` may depend on a differentiable input of its function.
+///
+/// The backward slice of the value is followed through pure, region-free operations. Values read
+/// from memory, produced by operations with regions or by quantum operations (e.g. mid-circuit
+/// measurements), and floating-point block arguments are all considered active.
+static bool mayDependOnDifferentiableInput(Value value)
+{
+    SmallVector<Value> worklist{value};
+    llvm::DenseSet<Value> visited;
+    while (!worklist.empty()) {
+        Value current = worklist.pop_back_val();
+        if (!visited.insert(current).second) {
+            continue;
+        }
+
+        if (isa<BlockArgument>(current)) {
+            // Integer arguments, such as loop induction variables, cannot carry derivatives.
+            if (isDifferentiableType(current.getType())) {
+                return true;
+            }
+            continue;
+        }
+
+        Operation *op = current.getDefiningOp();
+        if (op->getNumRegions() > 0 || !isMemoryEffectFree(op) ||
+            isa_and_nonnull<quantum::QuantumDialect>(op->getDialect())) {
+            return true;
+        }
+        llvm::append_range(worklist, op->getOperands());
+    }
+    return false;
+}
+
+void annotateInactiveGateParams(func::FuncOp qnode)
+{
+    qnode.walk([&](quantum::DifferentiableGate gate) {
+        ValueRange diffParams = gate.getDiffParams();
+        SmallVector<bool> inactive;
+        inactive.reserve(diffParams.size());
+        for (Value param : diffParams) {
+            inactive.push_back(!mayDependOnDifferentiableInput(param));
+        }
+
+        if (llvm::is_contained(inactive, true)) {
+            gate->setAttr(inactiveParamsKey, DenseBoolArrayAttr::get(qnode.getContext(), inactive));
+        }
+    });
+}
+
+bool isInactiveGateParam(quantum::DifferentiableGate gate, size_t paramIdx)
+{
+    auto inactive = gate->getAttrOfType<DenseBoolArrayAttr>(inactiveParamsKey);
+    return inactive && inactive[paramIdx];
+}
+
+size_t getNumActiveGateParams(quantum::DifferentiableGate gate)
+{
+    size_t numParams = gate.getDiffParams().size();
+    auto inactive = gate->getAttrOfType<DenseBoolArrayAttr>(inactiveParamsKey);
+    if (!inactive) {
+        return numParams;
+    }
+    return numParams - llvm::count(inactive.asArrayRef(), true);
+}
+
+} // namespace gradient
+} // namespace catalyst
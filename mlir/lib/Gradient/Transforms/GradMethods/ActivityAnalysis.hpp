@@ -0,0 +1,39 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+
+#include "Quantum/IR/QuantumInterfaces.h"
+
+using namespace mlir;
+
+namespace catalyst {
+namespace gradient {
+
+/// Annotate the gate parameters of a QNode that cannot affect its differentiated output, i.e. that
+/// are computed from constants and integer arguments only. The annotation is carried over to all
+/// functions cloned from the QNode, which then skip the inactive parameters consistently when
+/// collecting, counting, shifting and differentiating gate parameters.
+void annotateInactiveGateParams(func::FuncOp qnode);
+
+/// Check whether the `paramIdx`-th differentiable parameter of `gate` was annotated as inactive.
+bool isInactiveGateParam(quantum::DifferentiableGate gate, size_t paramIdx);
+
+/// Return the number of differentiable parameters of `gate` that are not annotated as inactive.
+size_t getNumActiveGateParams(quantum::DifferentiableGate gate);
+
+} // namespace gradient
+} // namespace catalyst
@@ -28,6 +28,8 @@
 #include "Quantum/IR/QuantumOps.h"
 #include "Quantum/Utils/RemoveQuantum.h"
 
+#include "ActivityAnalysis.hpp"
+
 namespace catalyst {
 namespace gradient {
 
@@ -77,10 +79,10 @@ func::FuncOp genParamCountFunction(PatternRewriter &rewriter, Location loc, func
                 PatternRewriter::InsertionGuard insertGuard(rewriter);
                 rewriter.setInsertionPoint(gate);
 
-                ValueRange diffParams = gate.getDiffParams();
-                if (!diffParams.empty()) {
+                size_t numActiveParams = getNumActiveGateParams(gate);
+                if (numActiveParams) {
                     Value currCount = memref::LoadOp::create(rewriter, loc, paramCountBuffer);
-                    Value numParams = index::ConstantOp::create(rewriter, loc, diffParams.size());
+                    Value numParams = index::ConstantOp::create(rewriter, loc, numActiveParams);
                     Value newCount = index::AddOp::create(rewriter, loc, currCount, numParams);
                     memref::StoreOp::create(rewriter, loc, newCount, paramCountBuffer);
                 }
@@ -166,9 +168,12 @@ func::FuncOp genSplitPreprocessed(PatternRewriter &rewriter, Location loc, func:
                 rewriter.setInsertionPoint(gate);
 
                 ValueRange diffParams = gate.getDiffParams();
-                if (!diffParams.empty()) {
+                if (getNumActiveGateParams(gate)) {
                     Value paramIdx = memref::LoadOp::create(rewriter, loc, paramsProcessed);
-                    for (auto param : diffParams) {
+                    for (auto [idx, param] : llvm::enumerate(diffParams)) {
+                        if (isInactiveGateParam(gate, idx)) {
+                            continue;
+                        }
                         memref::StoreOp::create(rewriter, loc, param, paramsBuffer, paramIdx);
                         paramIdx = index::AddOp::create(rewriter, loc, paramIdx, cOne);
                     }
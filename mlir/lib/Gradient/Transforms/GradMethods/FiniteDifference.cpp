@@ -20,8 +20,10 @@
 
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Bufferization/IR/Bufferization.h"
+#include "mlir/Dialect/Index/IR/IndexOps.h"
 #include "mlir/Dialect/Linalg/IR/Linalg.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
 
 #include "Gradient/Utils/DifferentialQNode.h"
@@ -32,6 +34,30 @@
 namespace catalyst {
 namespace gradient {
 
+/// Compute the row-major flat position of `indices` in a tensor of static `shape`.
+static Value linearizeIndices(OpBuilder &builder, Location loc, ValueRange indices,
+                              ArrayRef<int64_t> shape)
+{
+    Value flatIdx = index::ConstantOp::create(builder, loc, 0);
+    for (const auto &[idx, dim] : llvm::zip_equal(indices, shape)) {
+        Value dimSize = index::ConstantOp::create(builder, loc, dim);
+        flatIdx = index::MulOp::create(builder, loc, flatIdx, dimSize);
+        flatIdx = index::AddOp::create(builder, loc, flatIdx, idx);
+    }
+    return flatIdx;
+}
+
+/// The type of `numPerturbations` values of type `type` stacked along a new leading dimension.
+static RankedTensorType getStackedType(Type type, int64_t numPerturbations)
+{
+    if (auto tensorType = dyn_cast<RankedTensorType>(type)) {
+        SmallVector<int64_t> shape{numPerturbations};
+        shape.append(tensorType.getShape().begin(), tensorType.getShape().end());
+        return RankedTensorType::get(shape, tensorType.getElementType());
+    }
+    return RankedTensorType::get({numPerturbations}, type);
+}
+
 LogicalResult FiniteDiffLowering::matchAndRewrite(GradOp op, PatternRewriter &rewriter) const
 {
     if (op.getMethod() != "fd") {
@@ -60,7 +86,7 @@ LogicalResult FiniteDiffLowering::matchAndRewrite(GradOp op, PatternRewriter &re
         gradFn = func::FuncOp::create(rewriter, loc, fnName, fnType, visibility, nullptr, nullptr);
         rewriter.setInsertionPointToStart(gradFn.addEntryBlock());
 
-        computeFiniteDiff(rewriter, loc, gradFn, callee, diffArgIndices, hValue);
+        computeFiniteDiff(rewriter, loc, gradFn, callee, diffArgIndices, hValue, batched);
     }
 
     rewriter.replaceOpWithNewOp<func::CallOp>(op, gradFn, op.getArgOperands());
@@ -69,13 +95,17 @@ LogicalResult FiniteDiffLowering::matchAndRewrite(GradOp op, PatternRewriter &re
 
 void FiniteDiffLowering::computeFiniteDiff(PatternRewriter &rewriter, Location loc,
                                            func::FuncOp gradFn, func::FuncOp callee,
-                                           const std::vector<size_t> &diffArgIndices, double hValue)
+                                           const std::vector<size_t> &diffArgIndices, double hValue,
+                                           bool batched)
 {
     ValueRange callArgs = gradFn.getArguments();
     TypeRange gradResTypes = gradFn.getResultTypes();
     std::vector<Value> gradients;
     gradients.reserve(gradFn.getNumResults());
 
+    // The batched evaluations of the callee, shared by all results for a given argument.
+    DenseMap<size_t, func::CallOp> batchedCalls;
+
     func::CallOp callOp = func::CallOp::create(rewriter, loc, callee, callArgs);
     for (size_t diffResIdx = 0; diffResIdx < callee.getNumResults(); ++diffResIdx) {
         for (size_t diffArgIdxIdx = 0; diffArgIdxIdx < diffArgIndices.size(); ++diffArgIdxIdx) {
@@ -152,6 +182,41 @@ void FiniteDiffLowering::computeFiniteDiff(PatternRewriter &rewriter, Location l
 
                 gradient = arith::SubFOp::create(rewriter, loc, callResForward, callRes);
             }
+            else if (batched && canBatchPerturbations(callee, operandTy)) {
+                func::CallOp &batchedCall = batchedCalls[diffArgIdx];
+                if (!batchedCall) {
+                    Value perturbedInputs = genPerturbedInputs(rewriter, loc, diffArg, hForOperand);
+                    func::FuncOp batchedFn = genBatchedFunction(rewriter, loc, callee, diffArgIdx);
+
+                    std::vector<Value> batchedArgs(callArgs.begin(), callArgs.end());
+                    batchedArgs.push_back(perturbedInputs);
+                    batchedCall = func::CallOp::create(rewriter, loc, batchedFn, batchedArgs);
+                }
+                Value batchedRes = batchedCall.getResult(diffResIdx);
+
+                // The batched results are indexed by [perturbation, ...result], where the
+                // perturbation is the flat position of the shifted operand element.
+                auto bodyBuilder = [&](OpBuilder &builder, Location loc,
+                                       ValueRange tensorIndices) -> void {
+                    SmallVector<Value> batchedIndices{linearizeIndices(
+                        builder, loc, tensorIndices.take_back(operandRank), operandShape)};
+                    Value unshiftedRes = callRes;
+                    if (isResultTensor) {
+                        ValueRange resultIndices = tensorIndices.take_front(resultRank);
+                        batchedIndices.append(resultIndices.begin(), resultIndices.end());
+                        unshiftedRes =
+                            tensor::ExtractOp::create(builder, loc, callRes, resultIndices);
+                    }
+                    Value shiftedRes =
+                        tensor::ExtractOp::create(builder, loc, batchedRes, batchedIndices);
+
+                    Value result = arith::SubFOp::create(builder, loc, shiftedRes, unshiftedRes);
+                    tensor::YieldOp::create(builder, loc, result);
+                };
+
+                gradient = tensor::GenerateOp::create(rewriter, loc, gradientTy, dynamicDimSizes,
+                                                      bodyBuilder);
+            }
             else {
                 auto bodyBuilder = [&](OpBuilder &rewriter, Location loc,
                                        ValueRange tensorIndices) -> void {
@@ -213,5 +278,132 @@ void FiniteDiffLowering::computeFiniteDiff(PatternRewriter &rewriter, Location l
     func::ReturnOp::create(rewriter, loc, gradients);
 }
 
+/// The perturbations of a tensor argument can be batched when the argument and all results of the
+/// callee have static shapes, so that the stacked inputs and results have static shapes too.
+bool FiniteDiffLowering::canBatchPerturbations(func::FuncOp callee, Type operandTy)
+{
+    auto operandTensorTy = dyn_cast<RankedTensorType>(operandTy);
+    if (!operandTensorTy || operandTensorTy.getRank() == 0 || !operandTensorTy.hasStaticShape()) {
+        return false;
+    }
+    return llvm::all_of(callee.getResultTypes(), [](Type resultTy) {
+        auto resultTensorTy = dyn_cast<RankedTensorType>(resultTy);
+        return resultTensorTy ? resultTensorTy.hasStaticShape() : isa<FloatType>(resultTy);
+    });
+}
+
+/// Stack all the perturbations of `diffArg` along a new leading dimension: the entry i of the
+/// result is `diffArg` with its i-th element (in row-major order) shifted by `hForOperand`.
+Value FiniteDiffLowering::genPerturbedInputs(OpBuilder &builder, Location loc, Value diffArg,
+                                             Value hForOperand)
+{
+    auto operandTy = cast<RankedTensorType>(diffArg.getType());
+    RankedTensorType stackedTy = getStackedType(operandTy, operandTy.getNumElements());
+
+    auto bodyBuilder = [&](OpBuilder &builder, Location loc, ValueRange indices) -> void {
+        ValueRange elemIndices = indices.drop_front();
+        Value elem = tensor::ExtractOp::create(builder, loc, diffArg, elemIndices);
+        Value shiftedElem = arith::AddFOp::create(builder, loc, elem, hForOperand);
+        Value isShifted =
+            index::CmpOp::create(builder, loc, index::IndexCmpPredicate::EQ, indices.front(),
+                                 linearizeIndices(builder, loc, elemIndices, operandTy.getShape()));
+        Value result = arith::SelectOp::create(builder, loc, isShifted, shiftedElem, elem);
+        tensor::YieldOp::create(builder, loc, result);
+    };
+
+    return tensor::GenerateOp::create(builder, loc, stackedTy, ValueRange{}, bodyBuilder);
+}
+
+/// Generate a version of the callee that takes the perturbations of its argument `diffArgIdx`
+/// stacked along a leading dimension (as an extra last argument) and returns its results stacked
+/// the same way. The evaluations form a single loop, which LLVM can vectorize across the
+/// perturbations once the callee is inlined.
+func::FuncOp FiniteDiffLowering::genBatchedFunction(PatternRewriter &rewriter, Location loc,
+                                                    func::FuncOp callee, size_t diffArgIdx)
+{
+    std::string fnName = (callee.getName() + ".fdbatch" + std::to_string(diffArgIdx)).str();
+    func::FuncOp batchedFn =
+        SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(callee, rewriter.getStringAttr(fnName));
+    if (batchedFn) {
+        return batchedFn;
+    }
+
+    auto operandTy = cast<RankedTensorType>(callee.getArgumentTypes()[diffArgIdx]);
+    int64_t numPerturbations = operandTy.getNumElements();
+
+    SmallVector<Type> argTypes(callee.getArgumentTypes());
+    argTypes.push_back(getStackedType(operandTy, numPerturbations));
+    SmallVector<Type> resultTypes;
+    for (Type resultTy : callee.getResultTypes()) {
+        resultTypes.push_back(getStackedType(resultTy, numPerturbations));
+    }
+
+    PatternRewriter::InsertionGuard insertGuard(rewriter);
+    rewriter.setInsertionPointAfter(callee);
+    batchedFn = func::FuncOp::create(rewriter, loc, fnName,
+                                     rewriter.getFunctionType(argTypes, resultTypes));
+    batchedFn.setPrivate();
+    Block *entryBlock = batchedFn.addEntryBlock();
+    rewriter.setInsertionPointToStart(entryBlock);
+
+    ValueRange args = entryBlock->getArguments();
+    Value perturbedInputs = args.back();
+    SmallVector<Value> inits;
+    for (Type resultTy : resultTypes) {
+        auto stackedTy = cast<RankedTensorType>(resultTy);
+        inits.push_back(tensor::EmptyOp::create(rewriter, loc, stackedTy.getShape(),
+                                                stackedTy.getElementType()));
+    }
+
+    // The offsets, sizes and strides of the entry `perturbationIdx` of a stacked tensor.
+    auto getSliceParams = [&](OpBuilder &builder, Value perturbationIdx, RankedTensorType sliceTy,
+                              SmallVectorImpl<OpFoldResult> &offsets,
+                              SmallVectorImpl<OpFoldResult> &sizes,
+                              SmallVectorImpl<OpFoldResult> &strides) {
+        offsets.push_back(perturbationIdx);
+        offsets.append(sliceTy.getRank(), builder.getIndexAttr(0));
+        sizes.push_back(builder.getIndexAttr(1));
+        for (int64_t dim : sliceTy.getShape()) {
+            sizes.push_back(builder.getIndexAttr(dim));
+        }
+        strides.append(sliceTy.getRank() + 1, builder.getIndexAttr(1));
+    };
+
+    Value cZero = index::ConstantOp::create(rewriter, loc, 0);
+    Value cOne = index::ConstantOp::create(rewriter, loc, 1);
+    Value cNumPerturbations = index::ConstantOp::create(rewriter, loc, numPerturbations);
+    auto forOp = scf::ForOp::create(
+        rewriter, loc, cZero, cNumPerturbations, cOne, inits,
+        [&](OpBuilder &builder, Location loc, Value perturbationIdx, ValueRange stackedResults) {
+            SmallVector<OpFoldResult> offsets, sizes, strides;
+            getSliceParams(builder, perturbationIdx, operandTy, offsets, sizes, strides);
+            Value perturbedInput = tensor::ExtractSliceOp::create(
+                builder, loc, operandTy, perturbedInputs, offsets, sizes, strides);
+
+            SmallVector<Value> callArgs(args.drop_back());
+            callArgs[diffArgIdx] = perturbedInput;
+            func::CallOp callOp = func::CallOp::create(builder, loc, callee, callArgs);
+
+            SmallVector<Value> newStackedResults;
+            for (const auto &[result, stackedResult] :
+                 llvm::zip_equal(callOp.getResults(), stackedResults)) {
+                if (auto resultTy = dyn_cast<RankedTensorType>(result.getType())) {
+                    SmallVector<OpFoldResult> offsets, sizes, strides;
+                    getSliceParams(builder, perturbationIdx, resultTy, offsets, sizes, strides);
+                    newStackedResults.push_back(tensor::InsertSliceOp::create(
+                        builder, loc, result, stackedResult, offsets, sizes, strides));
+                }
+                else {
+                    newStackedResults.push_back(tensor::InsertOp::create(
+                        builder, loc, result, stackedResult, perturbationIdx));
+                }
+            }
+            scf::YieldOp::create(builder, loc, newStackedResults);
+        });
+
+    func::ReturnOp::create(rewriter, loc, forOp.getResults());
+    return batchedFn;
+}
+
 } // namespace gradient
 } // namespace catalyst
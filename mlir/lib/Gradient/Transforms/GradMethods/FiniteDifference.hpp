@@ -27,14 +27,25 @@ namespace catalyst {
 namespace gradient {
 
 struct FiniteDiffLowering : public OpRewritePattern<GradOp> {
-    using OpRewritePattern<GradOp>::OpRewritePattern;
+    FiniteDiffLowering(MLIRContext *context, bool batched, PatternBenefit benefit = 1)
+        : OpRewritePattern<GradOp>(context, benefit), batched(batched)
+    {
+    }
 
     LogicalResult matchAndRewrite(GradOp op, PatternRewriter &rewriter) const override;
 
   private:
+    // Whether to evaluate all perturbations of a tensor argument in a single batched call.
+    bool batched;
+
     static void computeFiniteDiff(PatternRewriter &rewriter, Location loc, func::FuncOp gradFn,
                                   func::FuncOp callee, const std::vector<size_t> &diffArgIndices,
-                                  double hValue);
+                                  double hValue, bool batched);
+    static bool canBatchPerturbations(func::FuncOp callee, Type operandTy);
+    static Value genPerturbedInputs(OpBuilder &builder, Location loc, Value diffArg,
+                                    Value hForOperand);
+    static func::FuncOp genBatchedFunction(PatternRewriter &rewriter, Location loc,
+                                           func::FuncOp callee, size_t diffArgIdx);
 };
 
 } // namespace gradient
@@ -29,6 +29,7 @@
 #include "Quantum/IR/QuantumOps.h"
 #include "Quantum/Utils/RemoveQuantum.h"
 
+#include "ActivityAnalysis.hpp"
 #include "ClassicalJacobian.hpp"
 
 using namespace mlir;
@@ -38,7 +39,8 @@ namespace gradient {
 // Prototypes
 static FailureOr<func::FuncOp> cloneCallee(PatternRewriter &rewriter, Operation *callSite,
                                            OperandRange argOperands, func::FuncOp callee,
-                                           SmallVectorImpl<Value> &backpropArgs);
+                                           SmallVectorImpl<Value> &backpropArgs,
+                                           bool pruneInactiveParams);
 static func::FuncOp genQNodeQuantumOnly(PatternRewriter &rewriter, Location loc,
                                         func::FuncOp qnode);
 static func::FuncOp genFullGradFunction(PatternRewriter &rewriter, Location loc,
@@ -126,10 +128,12 @@ void initializeCotangents(TypeRange primalResultTypes, unsigned activeResult, Va
 }
 
 /// Recursively process all the QNodes of the `callee` being differentiated. The resulting
-/// BackpropOps will be called with `backpropArgs`.
+/// BackpropOps will be called with `backpropArgs`. With `pruneInactiveParams`, the inactive gate
+/// parameters of parameter-shift QNodes are left out of the generated functions.
 static FailureOr<func::FuncOp> cloneCallee(PatternRewriter &rewriter, Operation *callSite,
                                            OperandRange argOperands, func::FuncOp callee,
-                                           SmallVectorImpl<Value> &backpropArgs)
+                                           SmallVectorImpl<Value> &backpropArgs,
+                                           bool pruneInactiveParams)
 {
     assert(callSite && "Operation pointer is null");
 
@@ -162,6 +166,12 @@ static FailureOr<func::FuncOp> cloneCallee(PatternRewriter &rewriter, Operation
                     "callee of method='defer'");
             }
 
+            // The annotation must precede the generation of all functions cloned from the QNode,
+            // so that they agree on which gate parameters are collected.
+            if (pruneInactiveParams && getQNodeDiffMethod(qnode) == "parameter-shift") {
+                annotateInactiveGateParams(qnode);
+            }
+
             // In order to allocate memory for various tensors relating to the number of gate
             // parameters at runtime we run a function that merely counts up for each gate parameter
             // encountered.
@@ -224,7 +234,7 @@ LogicalResult HybridGradientLowering::matchAndRewrite(GradOp op, PatternRewriter
 
     SmallVector<Value> backpropArgs(op.getArgOperands());
     FailureOr<func::FuncOp> clonedCallee =
-        cloneCallee(rewriter, op, op.getArgOperands(), callee, backpropArgs);
+        cloneCallee(rewriter, op, op.getArgOperands(), callee, backpropArgs, pruneInactiveParams);
     if (failed(clonedCallee)) {
         return failure();
     }
@@ -259,7 +269,7 @@ LogicalResult HybridValueAndGradientLowering::matchAndRewrite(ValueAndGradOp op,
 
     SmallVector<Value> backpropArgs(op.getArgOperands());
     FailureOr<func::FuncOp> clonedCallee =
-        cloneCallee(rewriter, op, op.getArgOperands(), callee, backpropArgs);
+        cloneCallee(rewriter, op, op.getArgOperands(), callee, backpropArgs, pruneInactiveParams);
     if (failed(clonedCallee)) {
         return failure();
     }
@@ -282,6 +292,57 @@ LogicalResult HybridValueAndGradientLowering::matchAndRewrite(ValueAndGradOp op,
     return success();
 }
 
+/// A vector-Jacobian product only needs the cotangents propagated through the callee once, so
+/// rather than building the full Jacobian with one BackpropOp per entry of the callee results, a
+/// single BackpropOp is seeded with the cotangents themselves. It also keeps the callee results,
+/// which saves the separate forward call of the generic lowering.
+LogicalResult HybridVJPLowering::matchAndRewrite(VJPOp op, PatternRewriter &rewriter) const
+{
+    if (op.getMethod() != "auto") {
+        return failure();
+    }
+
+    Location loc = op.getLoc();
+    func::FuncOp callee =
+        SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(op, op.getCalleeAttr());
+
+    SmallVector<Value> backpropArgs(op.getParams());
+    FailureOr<func::FuncOp> clonedCallee =
+        cloneCallee(rewriter, op, op.getParams(), callee, backpropArgs, pruneInactiveParams);
+    if (failed(clonedCallee)) {
+        return failure();
+    }
+
+    // The BackpropOp takes the cotangents of scalar results as rank-0 tensors.
+    SmallVector<Value> cotangents;
+    for (Value cotangent : op.getCotangents()) {
+        if (isa<FloatType>(cotangent.getType())) {
+            auto tensorType = RankedTensorType::get({}, cotangent.getType());
+            cotangent = tensor::FromElementsOp::create(rewriter, loc, tensorType, cotangent);
+        }
+        cotangents.push_back(cotangent);
+    }
+
+    const std::vector<size_t> &diffArgIndices = computeDiffArgIndices(op.getDiffArgIndices());
+    auto backpropOp = BackpropOp::create(
+        rewriter, loc, op.getCalleeResults().getTypes(),
+        computeBackpropTypes(*clonedCallee, diffArgIndices), SymbolRefAttr::get(*clonedCallee),
+        backpropArgs, /*arg_shadows=*/ValueRange{}, /*primal results=*/ValueRange{}, cotangents,
+        op.getDiffArgIndicesAttr(), rewriter.getBoolAttr(true));
+
+    SmallVector<Value> results(backpropOp.getVals());
+    for (const auto &[gradient, vjp] : llvm::zip(backpropOp.getGradients(), op.getVjps())) {
+        Value result = gradient;
+        if (isa<RankedTensorType>(gradient.getType()) && isa<FloatType>(vjp.getType())) {
+            result = tensor::ExtractOp::create(rewriter, loc, gradient, ValueRange{});
+        }
+        results.push_back(result);
+    }
+
+    rewriter.replaceOp(op, results);
+    return success();
+}
+
 /// Generate a version of the QNode that accepts the parameter buffer. This is so Enzyme will
 /// see that the gate parameters flow into the custom quantum function.
 static func::FuncOp genQNodeQuantumOnly(PatternRewriter &rewriter, Location loc, func::FuncOp qnode)
@@ -328,7 +389,11 @@ static func::FuncOp genQNodeQuantumOnly(PatternRewriter &rewriter, Location loc,
         ValueRange diffParams = gateOp.getDiffParams();
         SmallVector<Value> newParams{diffParams.size()};
         for (const auto [paramIdx, recomputedParam] : llvm::enumerate(diffParams)) {
-            newParams[paramIdx] = loadThenIncrementCounter(rewriter, paramCounter, paramsTensor);
+            // Inactive parameters are not collected by the preprocessing and keep their value.
+            newParams[paramIdx] =
+                isInactiveGateParam(gateOp, paramIdx)
+                    ? recomputedParam
+                    : loadThenIncrementCounter(rewriter, paramCounter, paramsTensor);
         }
         MutableOperandRange range{gateOp, static_cast<unsigned>(gateOp.getDiffOperandIdx()),
                                   static_cast<unsigned>(diffParams.size())};
@@ -341,12 +406,15 @@ static func::FuncOp genQNodeQuantumOnly(PatternRewriter &rewriter, Location loc,
 }
 
 /// Generate a function that computes a Jacobian row-by-row using one or more BackpropOps.
+///
+/// The primal values of a ValueAndGradOp are the same for every backward pass, so they are only
+/// kept from the first BackpropOp. The remaining ones mark the callee results as not needed, which
+/// lets Enzyme skip their computation and the copies out of the result buffers.
 static func::FuncOp genFullGradFunction(PatternRewriter &rewriter, Location loc,
                                         GradientOpInterface op, FunctionType fnType,
                                         func::FuncOp callee, mlir::BoolAttr keepValueResults)
 {
     mlir::DenseIntElementsAttr diffArgIndicesAttr = op.getDiffArgIndicesAttr();
-    ValueTypeRange<ResultRange> resultTypes = op->getResultTypes();
 
     assert((isa<GradOp>(op) || isa<ValueAndGradOp>(op)) &&
            "FullGradFunction should only be generated from GradOp or ValueAndGradOp.");
@@ -364,6 +432,8 @@ static func::FuncOp genFullGradFunction(PatternRewriter &rewriter, Location loc,
             valTypes.push_back(val.getType());
         }
     }
+    // The values come first in the results of a ValueAndGradOp.
+    TypeRange resultTypes = TypeRange(op->getResultTypes()).drop_front(valTypes.size());
 
     // Define the properties of the full gradient function.
     const std::vector<size_t> &diffArgIndices = computeDiffArgIndices(op.getDiffArgIndices());
@@ -385,6 +455,20 @@ static func::FuncOp genFullGradFunction(PatternRewriter &rewriter, Location loc,
 
         SmallVector<Value> backpropValResults;
         SmallVector<Value> backpropGradResults{numGradients};
+        auto createBackpropOp = [&](ValueRange cotangents) {
+            bool keepValues = keepValueResults.getValue() && backpropValResults.empty();
+            auto backpropOp = gradient::BackpropOp::create(
+                rewriter, loc, keepValues ? TypeRange(valTypes) : TypeRange{},
+                computeBackpropTypes(callee, diffArgIndices), SymbolRefAttr::get(callee),
+                entryBlock->getArguments(), /*arg_shadows=*/ValueRange{},
+                /*primal results=*/ValueRange{}, cotangents, diffArgIndicesAttr,
+                rewriter.getBoolAttr(keepValues));
+
+            // After backpropagation, collect any possible callee results into the values of the
+            // grad op
+            backpropValResults.append(backpropOp.getVals().begin(), backpropOp.getVals().end());
+            return backpropOp;
+        };
         // Iterate over the primal results
         for (const auto &[cotangentIdx, primalResult] : llvm::enumerate(callee.getResultTypes())) {
             // There is one Jacobian per distinct differential argument.
@@ -412,18 +496,7 @@ static func::FuncOp genFullGradFunction(PatternRewriter &rewriter, Location loc,
                         initializeCotangents(callee.getResultTypes(), cotangentIdx, indices,
                                              rewriter, loc, cotangents);
 
-                        auto backpropOp = gradient::BackpropOp::create(
-                            rewriter, loc, valTypes, computeBackpropTypes(callee, diffArgIndices),
-                            SymbolRefAttr::get(callee), entryBlock->getArguments(),
-                            /*arg_shadows=*/ValueRange{},
-                            /*primal results=*/ValueRange{}, cotangents, diffArgIndicesAttr,
-                            keepValueResults);
-
-                        // After backpropagation, collect any possible callee results into the
-                        // values of the grad op
-                        backpropValResults.insert(backpropValResults.end(),
-                                                  backpropOp.getVals().begin(),
-                                                  backpropOp.getVals().end());
+                        auto backpropOp = createBackpropOp(cotangents);
 
                         // Then collect the gradients...
 
@@ -483,16 +556,7 @@ static func::FuncOp genFullGradFunction(PatternRewriter &rewriter, Location loc,
                 initializeCotangents(callee.getResultTypes(), cotangentIdx, ValueRange(), rewriter,
                                      loc, cotangents);
 
-                auto backpropOp = gradient::BackpropOp::create(
-                    rewriter, loc, valTypes, computeBackpropTypes(callee, diffArgIndices),
-                    SymbolRefAttr::get(callee), entryBlock->getArguments(),
-                    /*arg_shadows=*/ValueRange{}, /*primal results=*/ValueRange{}, cotangents,
-                    diffArgIndicesAttr, keepValueResults);
-
-                // After backpropagation, collect any possible callee results into the values of the
-                // grad op
-                backpropValResults.insert(backpropValResults.end(), backpropOp.getVals().begin(),
-                                          backpropOp.getVals().end());
+                auto backpropOp = createBackpropOp(cotangents);
 
                 // Then collect the gradients...
                 for (const auto &[backpropIdx, jacobianSlice] :
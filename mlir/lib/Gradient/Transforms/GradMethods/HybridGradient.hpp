@@ -27,17 +27,47 @@ namespace gradient {
 
 // grad lowering
 struct HybridGradientLowering : public mlir::OpRewritePattern<GradOp> {
-    using OpRewritePattern<GradOp>::OpRewritePattern;
+    HybridGradientLowering(mlir::MLIRContext *context, bool pruneInactiveParams)
+        : OpRewritePattern<GradOp>(context), pruneInactiveParams(pruneInactiveParams)
+    {
+    }
 
     mlir::LogicalResult matchAndRewrite(GradOp op, mlir::PatternRewriter &rewriter) const override;
+
+  private:
+    // Whether to skip the inactive gate parameters of parameter-shift QNodes.
+    bool pruneInactiveParams;
 };
 
 // value_and_grad lowering
 struct HybridValueAndGradientLowering : public mlir::OpRewritePattern<ValueAndGradOp> {
-    using OpRewritePattern<ValueAndGradOp>::OpRewritePattern;
+    HybridValueAndGradientLowering(mlir::MLIRContext *context, bool pruneInactiveParams)
+        : OpRewritePattern<ValueAndGradOp>(context), pruneInactiveParams(pruneInactiveParams)
+    {
+    }
 
     mlir::LogicalResult matchAndRewrite(ValueAndGradOp op,
                                         mlir::PatternRewriter &rewriter) const override;
+
+  private:
+    // Whether to skip the inactive gate parameters of parameter-shift QNodes.
+    bool pruneInactiveParams;
+};
+
+// vjp lowering, which seeds a single backward pass with the cotangents instead of contracting them
+// with the Jacobian of the callee
+struct HybridVJPLowering : public mlir::OpRewritePattern<VJPOp> {
+    HybridVJPLowering(mlir::MLIRContext *context, bool pruneInactiveParams,
+                      mlir::PatternBenefit benefit)
+        : OpRewritePattern<VJPOp>(context, benefit), pruneInactiveParams(pruneInactiveParams)
+    {
+    }
+
+    mlir::LogicalResult matchAndRewrite(VJPOp op, mlir::PatternRewriter &rewriter) const override;
+
+  private:
+    // Whether to skip the inactive gate parameters of parameter-shift QNodes.
+    bool pruneInactiveParams;
 };
 
 } // namespace gradient
@@ -22,6 +22,7 @@
 
 #include "Quantum/IR/QuantumOps.h"
 
+#include "ActivityAnalysis.hpp"
 #include "ParameterShift.hpp"
 
 namespace catalyst {
@@ -57,7 +58,7 @@ static Value genSelectiveShift(PatternRewriter &rewriter, Location loc, Value pa
 
 func::FuncOp ParameterShiftLowering::genShiftFunction(PatternRewriter &rewriter, Location loc,
                                                       func::FuncOp callee, const int64_t numShifts,
-                                                      const int64_t loopDepth)
+                                                      const int64_t loopDepth, bool batched)
 {
     // The shiftVector is a new function argument with 1 element for each gate parameter to be
     // shifted. For gates inside of loops, we additionally use a selector to dynamically
@@ -81,6 +82,12 @@ func::FuncOp ParameterShiftLowering::genShiftFunction(PatternRewriter &rewriter,
         shiftedFn =
             func::FuncOp::create(rewriter, loc, fnName, fnType, visibility, nullptr, nullptr);
 
+        // As a QNode, the calls to the shifted function are dispatched asynchronously when the
+        // QNodes are, so that the batched evaluations of the gradient run concurrently.
+        if (batched) {
+            shiftedFn->setAttr("qnode", rewriter.getUnitAttr());
+        }
+
         // First copy the entire function as is, then we can add the shifts.
         // Make sure to add the shiftVector/selectorVector parameters to the new function.
         rewriter.cloneRegionBefore(callee.getBody(), shiftedFn.getBody(), shiftedFn.end());
@@ -105,7 +112,7 @@ func::FuncOp ParameterShiftLowering::genShiftFunction(PatternRewriter &rewriter,
                 selectors.push_back({iteration, selector});
             }
             else if (auto gate = dyn_cast<quantum::DifferentiableGate>(op)) {
-                if (gate.getDiffParams().empty()) {
+                if (!getNumActiveGateParams(gate)) {
                     return;
                 }
 
@@ -117,6 +124,10 @@ func::FuncOp ParameterShiftLowering::genShiftFunction(PatternRewriter &rewriter,
                 shiftedParams.reserve(params.size());
 
                 for (size_t i = 0; i < params.size(); i++) {
+                    if (isInactiveGateParam(gate, i)) {
+                        shiftedParams.push_back(params[i]);
+                        continue;
+                    }
                     Value idx = index::ConstantOp::create(rewriter, loc, shiftsProcessed++);
                     Value shift = tensor::ExtractOp::create(rewriter, loc, shiftVector, idx);
                     Value shiftedParam =
@@ -24,11 +24,13 @@
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
 
 #include "Catalyst/Utils/StaticAllocas.h"
+#include "Gradient/Utils/EinsumLinalgGeneric.h"
 #include "Gradient/Utils/GradientShape.h"
 #include "Quantum/IR/QuantumDialect.h"
 #include "Quantum/IR/QuantumOps.h"
 #include "Quantum/Utils/RemoveQuantum.h"
 
+#include "ActivityAnalysis.hpp"
 #include "ParameterShift.hpp"
 
 namespace catalyst {
@@ -51,11 +53,17 @@ static void updateSelectorVector(PatternRewriter &rewriter, Location loc,
     selectorsToStore.clear();
 }
 
-/// Generate calls to the shifted function to compute the current gradient element.
-static std::vector<Value> computePartialDerivative(PatternRewriter &rewriter, Location loc,
-                                                   int64_t numShifts, int64_t currentShift,
-                                                   Value selectorBuffer, func::FuncOp shiftedFn,
-                                                   std::vector<Value> callArgs)
+/// The results of the shifted function for the positive and negative shifts of a parameter.
+struct ShiftedEvaluations {
+    std::vector<Value> evalPos;
+    std::vector<Value> evalNeg;
+};
+
+/// Generate calls to the shifted function to evaluate the current gradient element.
+static ShiftedEvaluations evaluateShiftedFunction(PatternRewriter &rewriter, Location loc,
+                                                  int64_t numShifts, int64_t currentShift,
+                                                  Value selectorBuffer, func::FuncOp shiftedFn,
+                                                  std::vector<Value> callArgs)
 {
     constexpr double shift = llvm::numbers::pi / 2;
     ShapedType shiftVectorType = RankedTensorType::get({numShifts}, rewriter.getF64Type());
@@ -78,8 +86,6 @@ static std::vector<Value> computePartialDerivative(PatternRewriter &rewriter, Lo
         SparseElementsAttr::get(shiftVectorType, nonZeroIndices, nonZeroValuesNeg);
     Value shiftVectorNeg = arith::ConstantOp::create(rewriter, loc, shiftVectorAttrNeg);
 
-    // Compute the partial derivate for this parameter via the simplified
-    // parameter-shift rule: df/dx = [f(x + pi/2) - f(x - pi/2)] / 2.
     callArgs.push_back(shiftVectorPos);
     callArgs.push_back(selectorVector);
     ValueRange evalPos = func::CallOp::create(rewriter, loc, shiftedFn, callArgs).getResults();
@@ -87,6 +93,19 @@ static std::vector<Value> computePartialDerivative(PatternRewriter &rewriter, Lo
     callArgs[callArgs.size() - 2] = shiftVectorNeg;
     ValueRange evalNeg = func::CallOp::create(rewriter, loc, shiftedFn, callArgs).getResults();
 
+    return {std::vector<Value>(evalPos.begin(), evalPos.end()),
+            std::vector<Value>(evalNeg.begin(), evalNeg.end())};
+}
+
+/// Compute the current gradient element from the evaluations of the shifted function.
+static std::vector<Value> computePartialDerivative(PatternRewriter &rewriter, Location loc,
+                                                   const ShiftedEvaluations &evaluations)
+{
+    const std::vector<Value> &evalPos = evaluations.evalPos;
+    const std::vector<Value> &evalNeg = evaluations.evalNeg;
+
+    // Compute the partial derivate for this parameter via the simplified
+    // parameter-shift rule: df/dx = [f(x + pi/2) - f(x - pi/2)] / 2.
     std::vector<Value> derivatives;
     derivatives.reserve(evalPos.size());
 
@@ -178,19 +197,59 @@ static void storePartialDerivative(PatternRewriter &rewriter, Location loc,
     memref::StoreOp::create(rewriter, loc, newGradIdx, gradientsProcessed);
 }
 
+/// Contract the partial derivatives of all results with respect to a gate parameter with the
+/// cotangents of the results, which gives the element of the vector-Jacobian product for this
+/// gate parameter.
+static Value contractPartialDerivative(PatternRewriter &rewriter, Location loc,
+                                       ValueRange derivatives, ValueRange cotangents)
+{
+    Type f64 = rewriter.getF64Type();
+    Value vjp = arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(0.0));
+    for (const auto &[derivative, cotangent] : llvm::zip(derivatives, cotangents)) {
+        Value product;
+        if (auto tensorType = dyn_cast<RankedTensorType>(derivative.getType())) {
+            SmallVector<int64_t> axes;
+            for (int64_t dim = 0; dim < tensorType.getRank(); dim++) {
+                axes.push_back(dim);
+            }
+            Value contracted =
+                catalyst::einsumLinalgGeneric(rewriter, loc, axes, axes, {}, derivative, cotangent);
+            product = tensor::ExtractOp::create(rewriter, loc, contracted);
+        }
+        else {
+            product = arith::MulFOp::create(rewriter, loc, derivative, cotangent);
+        }
+        if (product.getType() != f64) {
+            product = arith::ExtFOp::create(rewriter, loc, f64, product);
+        }
+        vjp = arith::AddFOp::create(rewriter, loc, vjp, product);
+    }
+    return vjp;
+}
+
 func::FuncOp ParameterShiftLowering::genQGradFunction(PatternRewriter &rewriter, Location loc,
                                                       func::FuncOp callee, func::FuncOp shiftedFn,
                                                       const int64_t numShifts,
-                                                      const int64_t loopDepth)
+                                                      const int64_t loopDepth, bool batched,
+                                                      bool vjp)
 {
     // Define the properties of the quantum gradient function. The shape of the returned
     // gradient is unknown as the number of gate parameters in the unrolled circuit is only
     // determined at run time. The dynamic size is an input to the gradient function.
-    std::string fnName = callee.getSymName().str() + ".qgrad";
+    // The vector-Jacobian product version also takes the cotangents of the callee results, and
+    // returns a single gradient with one element per gate parameter.
+    std::string fnName = callee.getSymName().str() + (vjp ? ".qvjp" : ".qgrad");
     std::vector<Type> fnArgTypes = callee.getArgumentTypes().vec();
+    if (vjp) {
+        fnArgTypes.insert(fnArgTypes.end(), callee.getResultTypes().begin(),
+                          callee.getResultTypes().end());
+    }
     Type gradientSizeType = rewriter.getIndexType();
     fnArgTypes.push_back(gradientSizeType);
-    const std::vector<Type> &gradResTypes = computeQGradTypes(callee);
+    const std::vector<Type> &gradResTypes =
+        vjp ? std::vector<Type>{RankedTensorType::get({ShapedType::kDynamic},
+                                                      rewriter.getF64Type())}
+            : computeQGradTypes(callee);
     FunctionType fnType = rewriter.getFunctionType(fnArgTypes, gradResTypes);
     StringAttr visibility = rewriter.getStringAttr("private");
 
@@ -207,6 +266,12 @@ func::FuncOp ParameterShiftLowering::genQGradFunction(PatternRewriter &rewriter,
 
         const std::vector<Value> callArgs(gradientFn.getArguments().begin(),
                                           gradientFn.getArguments().end());
+        SmallVector<Value> cotangents;
+        if (vjp) {
+            for (Type resultType : callee.getResultTypes()) {
+                cotangents.push_back(gradientFn.getBlocks().front().addArgument(resultType, loc));
+            }
+        }
         Value gradientSize = gradientFn.getBlocks().front().addArgument(gradientSizeType, loc);
 
         // Allocate the memory for the selector and gradient vectors and define some constants.
@@ -243,13 +308,46 @@ func::FuncOp ParameterShiftLowering::genQGradFunction(PatternRewriter &rewriter,
             }
         }
 
+        // Either store the partial derivatives of all results, or only their contraction with the
+        // cotangents.
+        auto storeDerivatives = [&](const std::vector<Value> &derivatives) {
+            if (vjp) {
+                Value contracted =
+                    contractPartialDerivative(rewriter, loc, derivatives, cotangents);
+                storePartialDerivative(rewriter, loc, gradientBuffers, gradientsProcessed,
+                                       contracted);
+            }
+            else {
+                storePartialDerivative(rewriter, loc, gradientBuffers, gradientsProcessed,
+                                       derivatives);
+            }
+        };
+
         int64_t currentShift = 0;
         int64_t loopLevel = 0;
         std::vector<std::pair<scf::ForOp, int64_t>> selectorsToStore;
 
+        // In the batched form, the gradient elements of a block are only computed once all of its
+        // shifted evaluations are issued, right before the next op with regions or the terminator
+        // of the block, which keeps the gradient elements in order.
+        std::vector<ShiftedEvaluations> pendingEvaluations;
+        auto storePendingDerivatives = [&](Operation *before) {
+            PatternRewriter::InsertionGuard insertGuard(rewriter);
+            rewriter.setInsertionPoint(before);
+            for (const ShiftedEvaluations &evaluations : pendingEvaluations) {
+                storeDerivatives(computePartialDerivative(rewriter, loc, evaluations));
+            }
+            pendingEvaluations.clear();
+        };
+
         // Traverse nested IR in pre-order so that selectors for loops are handled
         // before entering the loop body.
         gradientFn.walk<WalkOrder::PreOrder>([&](Operation *op) {
+            if (!pendingEvaluations.empty() &&
+                (op->getNumRegions() > 0 || op->hasTrait<OpTrait::IsTerminator>())) {
+                storePendingDerivatives(op);
+            }
+
             if (auto forOp = dyn_cast<scf::ForOp>(op)) {
                 selectorsToStore.push_back({forOp, loopLevel});
                 loopLevel++;
@@ -258,16 +356,19 @@ func::FuncOp ParameterShiftLowering::genQGradFunction(PatternRewriter &rewriter,
                 PatternRewriter::InsertionGuard insertGuard(rewriter);
                 rewriter.setInsertionPoint(gate);
 
-                size_t numParams = gate.getDiffParams().size();
+                size_t numParams = getNumActiveGateParams(gate);
                 if (numParams) {
                     updateSelectorVector(rewriter, loc, selectorsToStore, selectorBuffer);
 
                     for (size_t _ = 0; _ < numParams; _++) {
-                        const std::vector<Value> &derivatives =
-                            computePartialDerivative(rewriter, loc, numShifts, currentShift++,
-                                                     selectorBuffer, shiftedFn, callArgs);
-                        storePartialDerivative(rewriter, loc, gradientBuffers, gradientsProcessed,
-                                               derivatives);
+                        ShiftedEvaluations evaluations =
+                            evaluateShiftedFunction(rewriter, loc, numShifts, currentShift++,
+                                                    selectorBuffer, shiftedFn, callArgs);
+                        if (batched) {
+                            pendingEvaluations.push_back(std::move(evaluations));
+                            continue;
+                        }
+                        storeDerivatives(computePartialDerivative(rewriter, loc, evaluations));
                     }
                 }
             }
@@ -20,6 +20,8 @@
 #include "Gradient/Utils/GradientShape.h"
 #include "Quantum/IR/QuantumOps.h"
 
+#include "ActivityAnalysis.hpp"
+
 namespace catalyst {
 namespace gradient {
 
@@ -40,14 +42,15 @@ LogicalResult ParameterShiftLowering::matchAndRewrite(func::FuncOp op,
 
     // Generate the shifted version of callee, enabling us to shift an arbitrary gate
     // parameter at runtime.
-    func::FuncOp shiftFn = genShiftFunction(rewriter, loc, op, numShifts, loopDepth);
+    func::FuncOp shiftFn = genShiftFunction(rewriter, loc, op, numShifts, loopDepth, batched);
 
     // Generate the quantum gradient function, exploiting the structure of the original function
     // to dynamically compute the partial derivate with respect to each gate parameter.
-    func::FuncOp qGradFn = genQGradFunction(rewriter, loc, op, shiftFn, numShifts, loopDepth);
+    func::FuncOp qGradFn =
+        genQGradFunction(rewriter, loc, op, shiftFn, numShifts, loopDepth, batched, vjp);
 
     // Register the quantum gradient on the quantum-only split-out QNode.
-    registerCustomGradient(op, FlatSymbolRefAttr::get(qGradFn));
+    registerCustomGradient(op, FlatSymbolRefAttr::get(qGradFn), vjp);
     return success();
 }
 
@@ -62,10 +65,11 @@ std::pair<int64_t, int64_t> ParameterShiftLowering::analyzeFunction(func::FuncOp
             loopLevel++;
         }
         else if (auto gate = dyn_cast<quantum::DifferentiableGate>(op)) {
-            if (gate.getDiffParams().empty())
+            size_t numActiveParams = getNumActiveGateParams(gate);
+            if (!numActiveParams)
                 return;
 
-            numShifts += gate.getDiffParams().size();
+            numShifts += numActiveParams;
             maxLoopDepth = std::max(loopLevel, maxLoopDepth);
         }
         else if (isa<scf::YieldOp>(op) && isa<scf::ForOp>(op->getParentOp())) {
@@ -27,18 +27,28 @@ namespace catalyst {
 namespace gradient {
 
 struct ParameterShiftLowering : public OpRewritePattern<func::FuncOp> {
-    using OpRewritePattern<func::FuncOp>::OpRewritePattern;
+    ParameterShiftLowering(MLIRContext *context, bool batched, bool vjp,
+                           PatternBenefit benefit = 1)
+        : OpRewritePattern<func::FuncOp>(context, benefit), batched(batched), vjp(vjp)
+    {
+    }
 
     LogicalResult matchAndRewrite(func::FuncOp op, PatternRewriter &rewriter) const override;
 
   private:
+    // Whether to issue all shifted evaluations of a block before combining them.
+    bool batched;
+    // Whether to contract the partial derivatives with the cotangents instead of storing them.
+    bool vjp;
+
     static std::pair<int64_t, int64_t> analyzeFunction(func::FuncOp callee);
     static func::FuncOp genShiftFunction(PatternRewriter &rewriter, Location loc,
                                          func::FuncOp callee, const int64_t numShifts,
-                                         const int64_t loopDepth);
+                                         const int64_t loopDepth, bool batched);
     static func::FuncOp genQGradFunction(PatternRewriter &rewriter, Location loc,
                                          func::FuncOp callee, func::FuncOp shiftedFn,
-                                         const int64_t numShifts, const int64_t loopDepth);
+                                         const int64_t numShifts, const int64_t loopDepth,
+                                         bool batched, bool vjp);
 };
 
 } // namespace gradient
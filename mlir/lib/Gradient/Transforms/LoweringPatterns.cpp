@@ -27,12 +27,17 @@ using namespace catalyst::gradient;
 namespace catalyst {
 namespace gradient {
 
-void populateLoweringPatterns(RewritePatternSet &patterns)
+void populateLoweringPatterns(RewritePatternSet &patterns, bool batchParameterShift,
+                              bool pruneInactiveParams, bool batchFiniteDiff,
+                              bool vjpParameterShift)
 {
-    patterns.add<HybridGradientLowering>(patterns.getContext());
-    patterns.add<HybridValueAndGradientLowering>(patterns.getContext());
-    patterns.add<FiniteDiffLowering>(patterns.getContext(), 1);
-    patterns.add<ParameterShiftLowering>(patterns.getContext(), 1);
+    patterns.add<HybridGradientLowering>(patterns.getContext(), pruneInactiveParams);
+    patterns.add<HybridValueAndGradientLowering>(patterns.getContext(), pruneInactiveParams);
+    // Takes precedence over the generic lowering of VJPOp through the full Jacobian.
+    patterns.add<HybridVJPLowering>(patterns.getContext(), pruneInactiveParams, 2);
+    patterns.add<FiniteDiffLowering>(patterns.getContext(), batchFiniteDiff, 1);
+    patterns.add<ParameterShiftLowering>(patterns.getContext(), batchParameterShift,
+                                         vjpParameterShift, 1);
     patterns.add<AdjointLowering>(patterns.getContext(), 1);
     patterns.add<JVPLoweringPattern>(patterns.getContext());
     patterns.add<VJPLoweringPattern>(patterns.getContext());
@@ -49,7 +49,8 @@ struct GradientLoweringPass : impl::GradientLoweringPassBase<GradientLoweringPas
     void runOnOperation() final
     {
         RewritePatternSet gradientPatterns(&getContext());
-        populateLoweringPatterns(gradientPatterns);
+        populateLoweringPatterns(gradientPatterns, batchParameterShift, pruneInactiveParams,
+                                 batchFiniteDiff, vjpParameterShift);
 
         // This is required to remove qubit values returned by if/for ops in the
         // quantum gradient function of the parameter-shift pattern.
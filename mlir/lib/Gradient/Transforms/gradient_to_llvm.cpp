@@ -50,7 +50,7 @@ struct GradientConversionPass : impl::GradientConversionPassBase<GradientConvers
         LLVMTypeConverter typeConverter(context, options);
 
         RewritePatternSet patterns(context);
-        populateConversionPatterns(typeConverter, patterns);
+        populateConversionPatterns(typeConverter, patterns, adjointCheckpointInterval);
 
         LLVMConversionTarget target(*context);
         target.addIllegalDialect<GradientDialect>();
@@ -47,11 +47,12 @@ bool catalyst::gradient::requiresCustomGradient(func::FuncOp funcOp)
     return funcOp->hasAttrOfType<FlatSymbolRefAttr>(pureQuantumKey);
 }
 
-void catalyst::gradient::registerCustomGradient(func::FuncOp qnode, FlatSymbolRefAttr qgradFn)
+void catalyst::gradient::registerCustomGradient(func::FuncOp qnode, FlatSymbolRefAttr qgradFn,
+                                                bool isVJP)
 {
     Operation *pureQuantumFunc = SymbolTable::lookupNearestSymbolFrom(
         qnode, qnode->getAttrOfType<FlatSymbolRefAttr>(pureQuantumKey));
-    pureQuantumFunc->setAttr("gradient.qgrad", qgradFn);
+    pureQuantumFunc->setAttr(isVJP ? "gradient.qvjp" : "gradient.qgrad", qgradFn);
 
     // Mark this op as processed so it doesn't get processed again.
     qnode->removeAttr(pureQuantumKey);
@@ -20,6 +20,7 @@
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/IR/Value.h"
 #include "mlir/Transforms/DialectConversion.h"
 
@@ -231,7 +232,8 @@ mlir::Value CreateNormalizedAngle(mlir::PatternRewriter &rewriter, mlir::Locatio
  *
  *        This function returns the pulse duration as an mlir::Value by creating an arith::DivFOp.
  *        In order to do so, it must also create an arith::ConstantOp for the Rabi frequency, and
- *        an arith::MulFOp for the detuning times two.
+ *        an arith::MulFOp for the detuning times two. If the angle is a compile-time constant,
+ *        the duration is folded into a single arith::ConstantOp instead.
  *
  * @param rewriter MLIR PatternRewriter
  * @param loc      MLIR Location
@@ -243,6 +245,17 @@ mlir::Value CreateNormalizedAngle(mlir::PatternRewriter &rewriter, mlir::Locatio
 mlir::Value computePulseDuration(mlir::PatternRewriter &rewriter, mlir::Location &loc,
                                  const mlir::Value &angle, double rabi, double detuning)
 {
+    FloatAttr angleAttr;
+    if (matchPattern(angle, m_Constant(&angleAttr))) {
+        constexpr double FOUR_PI = 4.0 * llvm::numbers::pi;
+        double normalizedAngle = std::fmod(angleAttr.getValueAsDouble(), FOUR_PI);
+        if (normalizedAngle < 0.0) {
+            normalizedAngle += FOUR_PI;
+        }
+        double duration = normalizedAngle * (detuning * 2) / (rabi * rabi);
+        return arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(duration));
+    }
+
     auto normalizedAngle = CreateNormalizedAngle(rewriter, loc, angle);
     TypedAttr rabiAttr = rewriter.getF64FloatAttr(rabi);
     mlir::Value rabiValue = arith::ConstantOp::create(rewriter, loc, rabiAttr).getResult();
@@ -257,25 +270,34 @@ mlir::Value computePulseDuration(mlir::PatternRewriter &rewriter, mlir::Location
     return duration;
 }
 
+/**
+ * @brief Creates the beam attribute of a pulse driving the given level transition with a beam
+ *        from the database.
+ */
+static BeamAttr getBeamAttr(mlir::Builder &builder, LevelTransition transition, const Beam &beam)
+{
+    return BeamAttr::get(builder.getContext(), builder.getI64IntegerAttr(transition),
+                         builder.getF64FloatAttr(beam.rabi), builder.getF64FloatAttr(beam.detuning),
+                         builder.getDenseI64ArrayAttr(beam.polarization),
+                         builder.getDenseI64ArrayAttr(beam.wavevector));
+}
+
 mlir::LogicalResult oneQubitGateToPulse(CustomOp op, mlir::PatternRewriter &rewriter, double phase1,
-                                        double phase2, const std::vector<Beam> &beams1)
+                                        double phase2, const std::vector<Beam> &beams1,
+                                        GatePulseCache &cache)
 {
     auto qubitIndex = walkBackQubitSSA(op, 0);
     if (qubitIndex.has_value()) {
         // Set the optional transition index now
         auto qubitIndexValue = qubitIndex.value();
-        Beam beam = beams1[qubitIndexValue];
-
-        auto beam0toEAttr = BeamAttr::get(
-            op.getContext(), rewriter.getI64IntegerAttr(LevelTransition::DOWN_E),
-            rewriter.getF64FloatAttr(beam.rabi), rewriter.getF64FloatAttr(beam.detuning),
-            rewriter.getDenseI64ArrayAttr(beam.polarization),
-            rewriter.getDenseI64ArrayAttr(beam.wavevector));
-        auto beam1toEAttr = BeamAttr::get(
-            op.getContext(), rewriter.getI64IntegerAttr(LevelTransition::UP_E),
-            rewriter.getF64FloatAttr(beam.rabi), rewriter.getF64FloatAttr(beam.detuning),
-            rewriter.getDenseI64ArrayAttr(beam.polarization),
-            rewriter.getDenseI64ArrayAttr(beam.wavevector));
+        const Beam &beam = beams1[qubitIndexValue];
+
+        ArrayRef<Attribute> beamAttrs = cache.getBeams({0, qubitIndexValue, -1}, [&] {
+            return SmallVector<Attribute>{getBeamAttr(rewriter, LevelTransition::DOWN_E, beam),
+                                          getBeamAttr(rewriter, LevelTransition::UP_E, beam)};
+        });
+        auto beam0toEAttr = cast<BeamAttr>(beamAttrs[0]);
+        auto beam1toEAttr = cast<BeamAttr>(beamAttrs[1]);
 
         // TODO (backlog): Pull the math formula from database and apply it in MLIR (but right now
         // it is not in the database)
@@ -322,149 +344,94 @@ mlir::LogicalResult oneQubitGateToPulse(CustomOp op, mlir::PatternRewriter &rewr
 };
 
 mlir::LogicalResult MSGateToPulse(CustomOp op, mlir::PatternRewriter &rewriter,
-                                  const std::vector<Beam> &beams2)
+                                  const std::vector<Beam> &beams2, int64_t nQubits,
+                                  GatePulseCache &cache)
 {
-    auto qnode = op->getParentOfType<func::FuncOp>();
     MLIRContext *ctx = op.getContext();
 
     auto qubitIndex0 = walkBackQubitSSA(op, 0);
     auto qubitIndex1 = walkBackQubitSSA(op, 1);
 
     if (qubitIndex0.has_value() && qubitIndex1.has_value()) {
-        quantum::AllocOp allocOp;
-        qnode.walk([&](quantum::AllocOp op) {
-            allocOp = op;
-            return WalkResult::interrupt();
-        });
         auto qubitIndex0Value = qubitIndex0.value();
         auto qubitIndex1Value = qubitIndex1.value();
-        auto nQubits = allocOp.getNqubitsAttr();
-        if (nQubits.has_value()) {
-            auto twoQubitComboIndex =
-                getTwoQubitCombinationIndex(nQubits.value(), qubitIndex0Value, qubitIndex1Value);
-
-            // Each qubit pair combination uses 3 beams in the database:
-            //   beams2[combo*3 + 0]: global beam (DOWN_E transition)
-            //   beams2[combo*3 + 1]: individual red-sideband beam (UP_E, lower detuning)
-            //   beams2[combo*3 + 2]: individual blue-sideband beam (UP_E, higher detuning)
-            size_t beamBaseIndex = static_cast<size_t>(twoQubitComboIndex) * 3;
-            if (beamBaseIndex + 2 >= beams2.size()) {
-                op.emitError()
-                    << "Missing two-qubit beam parameters for qubits "
-                    << "(" << qubitIndex0Value << ", " << qubitIndex1Value << ") "
-                    << "used as input to MS gate. Expected 3 beam entries starting at index "
-                    << beamBaseIndex << " but there are only " << beams2.size()
-                    << " beam parameters in the database."
-                    << " Ensure that the database contains all necessary parameters for the "
-                       "circuit.";
-                return failure();
-            }
+        auto twoQubitComboIndex =
+            getTwoQubitCombinationIndex(nQubits, qubitIndex0Value, qubitIndex1Value);
+
+        // Each qubit pair combination uses 3 beams in the database:
+        //   beams2[combo*3 + 0]: global beam (DOWN_E transition)
+        //   beams2[combo*3 + 1]: individual red-sideband beam (UP_E, lower detuning)
+        //   beams2[combo*3 + 2]: individual blue-sideband beam (UP_E, higher detuning)
+        size_t beamBaseIndex = static_cast<size_t>(twoQubitComboIndex) * 3;
+        if (beamBaseIndex + 2 >= beams2.size()) {
+            op.emitError() << "Missing two-qubit beam parameters for qubits "
+                           << "(" << qubitIndex0Value << ", " << qubitIndex1Value << ") "
+                           << "used as input to MS gate. Expected 3 beam entries starting at index "
+                           << beamBaseIndex << " but there are only " << beams2.size()
+                           << " beam parameters in the database."
+                           << " Ensure that the database contains all necessary parameters for the "
+                              "circuit.";
+            return failure();
+        }
 
-            const Beam &globalBeam = beams2[beamBaseIndex];
-            const Beam &redSidebandBeam = beams2[beamBaseIndex + 1];
-            const Beam &blueSidebandBeam = beams2[beamBaseIndex + 2];
+        const Beam &globalBeam = beams2[beamBaseIndex];
+        const Beam &redSidebandBeam = beams2[beamBaseIndex + 1];
+        const Beam &blueSidebandBeam = beams2[beamBaseIndex + 2];
 
-            auto loc = op.getLoc();
-            auto qubits = op.getInQubits();
+        // Note that the each beamAttr below is different! The respective formulas are taken from
+        // the Ion dialect specification document.
 
-            auto angle = op.getParams().front();
-            auto time =
-                computePulseDuration(rewriter, loc, angle, globalBeam.rabi, globalBeam.detuning);
+        // TODO: Pull the math formula from database and apply it in MLIR once OQD provides it.
+        // Rabi and phase may become SSA values and not attributes.
 
-            // Convert quantum.bit to ion.ionqubit
-            auto ionQubits = convertQuantumBitsToIonQubits(rewriter, loc, qubits);
-            if (!ionQubits.has_value()) {
-                return failure();
-            }
+        // The global beam drives the DOWN_E transition, and the blue- and red-sideband individual
+        // beams drive the UP_E transition, on each of the two qubits
+        ArrayRef<Attribute> beamAttrs =
+            cache.getBeams({nQubits, qubitIndex0Value, qubitIndex1Value}, [&] {
+                return SmallVector<Attribute>{
+                    getBeamAttr(rewriter, LevelTransition::DOWN_E, globalBeam),
+                    getBeamAttr(rewriter, LevelTransition::UP_E, blueSidebandBeam),
+                    getBeamAttr(rewriter, LevelTransition::UP_E, redSidebandBeam)};
+            });
+        SmallVector<BeamAttr, 3> qubitBeams;
+        for (Attribute beamAttr : beamAttrs) {
+            qubitBeams.push_back(cast<BeamAttr>(beamAttr));
+        }
 
-            auto ppOp = ion::ParallelProtocolOp::create(
-                rewriter, loc, ionQubits.value(),
-                [&](OpBuilder &builder, Location loc, ValueRange qubits) {
-                    mlir::FloatAttr phase0Attr = builder.getF64FloatAttr(0.0);
-                    auto qubit0 = qubits.front();
-                    auto qubit1 = qubits.back();
-
-                    // Note that the each beamAttr below is different! The respective formulas are
-                    // taken from the Ion dialect specification document.
-
-                    // TODO: Pull the math formula from database and apply it in MLIR once OQD
-                    // provides it.
-                    // Rabi and phase may become SSA values and not attributes.
-
-                    // Pulse1: global beam on qubit0 (DOWN_E transition)
-                    auto beam1Attr =
-                        BeamAttr::get(ctx, rewriter.getI64IntegerAttr(LevelTransition::DOWN_E),
-                                      rewriter.getF64FloatAttr(globalBeam.rabi),
-                                      rewriter.getF64FloatAttr(globalBeam.detuning),
-                                      rewriter.getDenseI64ArrayAttr(globalBeam.polarization),
-                                      rewriter.getDenseI64ArrayAttr(globalBeam.wavevector));
-                    ion::PulseOp::create(builder, loc, PulseType::get(ctx), time, qubit0, beam1Attr,
-                                         phase0Attr);
-
-                    // Pulse2: blue-sideband individual beam on qubit0 (UP_E transition)
-                    auto beam2Attr =
-                        BeamAttr::get(ctx, rewriter.getI64IntegerAttr(LevelTransition::UP_E),
-                                      rewriter.getF64FloatAttr(blueSidebandBeam.rabi),
-                                      rewriter.getF64FloatAttr(blueSidebandBeam.detuning),
-                                      rewriter.getDenseI64ArrayAttr(blueSidebandBeam.polarization),
-                                      rewriter.getDenseI64ArrayAttr(blueSidebandBeam.wavevector));
-                    ion::PulseOp::create(builder, loc, PulseType::get(ctx), time, qubit0, beam2Attr,
-                                         phase0Attr);
-
-                    // Pulse3: red-sideband individual beam on qubit0 (UP_E transition)
-                    auto beam3Attr =
-                        BeamAttr::get(ctx, rewriter.getI64IntegerAttr(LevelTransition::UP_E),
-                                      rewriter.getF64FloatAttr(redSidebandBeam.rabi),
-                                      rewriter.getF64FloatAttr(redSidebandBeam.detuning),
-                                      rewriter.getDenseI64ArrayAttr(redSidebandBeam.polarization),
-                                      rewriter.getDenseI64ArrayAttr(redSidebandBeam.wavevector));
-                    ion::PulseOp::create(builder, loc, PulseType::get(ctx), time, qubit0, beam3Attr,
-                                         phase0Attr);
-
-                    // Pulse4: global beam on qubit1 (DOWN_E transition)
-                    auto beam4Attr =
-                        BeamAttr::get(ctx, rewriter.getI64IntegerAttr(LevelTransition::DOWN_E),
-                                      rewriter.getF64FloatAttr(globalBeam.rabi),
-                                      rewriter.getF64FloatAttr(globalBeam.detuning),
-                                      rewriter.getDenseI64ArrayAttr(globalBeam.polarization),
-                                      rewriter.getDenseI64ArrayAttr(globalBeam.wavevector));
-                    ion::PulseOp::create(builder, loc, PulseType::get(ctx), time, qubit1, beam4Attr,
-                                         phase0Attr);
-
-                    // Pulse5: blue-sideband individual beam on qubit1 (UP_E transition)
-                    auto beam5Attr =
-                        BeamAttr::get(ctx, rewriter.getI64IntegerAttr(LevelTransition::UP_E),
-                                      rewriter.getF64FloatAttr(blueSidebandBeam.rabi),
-                                      rewriter.getF64FloatAttr(blueSidebandBeam.detuning),
-                                      rewriter.getDenseI64ArrayAttr(blueSidebandBeam.polarization),
-                                      rewriter.getDenseI64ArrayAttr(blueSidebandBeam.wavevector));
-                    ion::PulseOp::create(builder, loc, PulseType::get(ctx), time, qubit1, beam5Attr,
-                                         phase0Attr);
-
-                    // Pulse6: red-sideband individual beam on qubit1 (UP_E transition)
-                    auto beam6Attr =
-                        BeamAttr::get(ctx, rewriter.getI64IntegerAttr(LevelTransition::UP_E),
-                                      rewriter.getF64FloatAttr(redSidebandBeam.rabi),
-                                      rewriter.getF64FloatAttr(redSidebandBeam.detuning),
-                                      rewriter.getDenseI64ArrayAttr(redSidebandBeam.polarization),
-                                      rewriter.getDenseI64ArrayAttr(redSidebandBeam.wavevector));
-                    ion::PulseOp::create(builder, loc, PulseType::get(ctx), time, qubit1, beam6Attr,
-                                         phase0Attr);
-                });
-
-            // Convert ion.qubit back to quantum.bit
-            auto qubitResults = convertIonQubitsToQuantumBits(rewriter, loc, ppOp.getResults());
-            if (!qubitResults.has_value()) {
-                return failure();
-            }
-            rewriter.replaceOp(op, qubitResults.value());
-            return success();
+        auto loc = op.getLoc();
+        auto qubits = op.getInQubits();
+
+        auto angle = op.getParams().front();
+        auto time =
+            computePulseDuration(rewriter, loc, angle, globalBeam.rabi, globalBeam.detuning);
+
+        // Convert quantum.bit to ion.ionqubit
+        auto ionQubits = convertQuantumBitsToIonQubits(rewriter, loc, qubits);
+        if (!ionQubits.has_value()) {
+            return failure();
         }
-        else {
-            op.emitError()
-                << "Impossible to determine the number of qubits because the value is dynamic";
+
+        auto ppOp = ion::ParallelProtocolOp::create(
+            rewriter, loc, ionQubits.value(),
+            [&](OpBuilder &builder, Location loc, ValueRange qubits) {
+                mlir::FloatAttr phase0Attr = builder.getF64FloatAttr(0.0);
+
+                // Pulses 1-3 on qubit0, then pulses 4-6 on qubit1
+                for (Value qubit : {qubits.front(), qubits.back()}) {
+                    for (BeamAttr beamAttr : qubitBeams) {
+                        ion::PulseOp::create(builder, loc, PulseType::get(ctx), time, qubit,
+                                             beamAttr, phase0Attr);
+                    }
+                }
+            });
+
+        // Convert ion.qubit back to quantum.bit
+        auto qubitResults = convertIonQubitsToQuantumBits(rewriter, loc, ppOp.getResults());
+        if (!qubitResults.has_value()) {
             return failure();
         }
+        rewriter.replaceOp(op, qubitResults.value());
+        return success();
     }
     else {
         op.emitError() << "Impossible to determine the original qubit because the value is dynamic";
@@ -477,9 +444,13 @@ struct GatesToPulsesRewritePattern : public mlir::OpConversionPattern<CustomOp>
 
     std::vector<Beam> beams1;
     std::vector<Beam> beams2;
+    int64_t nQubits;
+    GatePulseCache &cache;
 
-    GatesToPulsesRewritePattern(mlir::MLIRContext *ctx, const OQDDatabaseManager &dataManager)
-        : mlir::OpConversionPattern<CustomOp>::OpConversionPattern(ctx)
+    GatesToPulsesRewritePattern(mlir::MLIRContext *ctx, const OQDDatabaseManager &dataManager,
+                                int64_t nQubits, GatePulseCache &cache)
+        : mlir::OpConversionPattern<CustomOp>::OpConversionPattern(ctx), nQubits(nQubits),
+          cache(cache)
     {
         beams1 = dataManager.getBeams1Params();
         beams2 = dataManager.getBeams2Params();
@@ -492,18 +463,18 @@ struct GatesToPulsesRewritePattern : public mlir::OpConversionPattern<CustomOp>
         // Assume ions are in the same funcop as the operations
         // RX case -> PP(P1, P2)
         if (op.getGateName() == "RX") {
-            auto result = oneQubitGateToPulse(op, rewriter, 0.0, 0.0, beams1);
+            auto result = oneQubitGateToPulse(op, rewriter, 0.0, 0.0, beams1, cache);
             return result;
         }
         // RY case -> PP(P1, P2)
         else if (op.getGateName() == "RY") {
             auto result = oneQubitGateToPulse(op, rewriter, llvm::numbers::pi / 2,
-                                              llvm::numbers::pi / 2, beams1);
+                                              llvm::numbers::pi / 2, beams1, cache);
             return result;
         }
         // MS case -> PP(P1, P2, P3, P4, P5, P6)
         else if (op.getGateName() == "MS") {
-            auto result = MSGateToPulse(op, rewriter, beams2);
+            auto result = MSGateToPulse(op, rewriter, beams2, nQubits, cache);
             return result;
         }
         return failure();
@@ -638,9 +609,10 @@ struct MeasureOpToMeasurePulsePattern : public mlir::OpRewritePattern<MeasureOp>
 };
 
 void populateGatesToPulsesPatterns(RewritePatternSet &patterns,
-                                   const OQDDatabaseManager &dataManager)
+                                   const OQDDatabaseManager &dataManager, int64_t nQubits,
+                                   GatePulseCache &cache)
 {
-    patterns.add<GatesToPulsesRewritePattern>(patterns.getContext(), dataManager);
+    patterns.add<GatesToPulsesRewritePattern>(patterns.getContext(), dataManager, nQubits, cache);
 }
 
 void populateMeasureToPulsesPatterns(RewritePatternSet &patterns,
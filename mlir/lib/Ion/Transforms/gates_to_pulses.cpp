@@ -12,6 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "llvm/ADT/Hashing.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Pass/Pass.h"
@@ -32,9 +39,56 @@ namespace ion {
 #define GEN_PASS_DEF_GATESTOPULSESPASS
 #include "Ion/Transforms/Passes.h.inc"
 
+namespace {
+
+// The database managers of all the instances of the pass in the process, e.g. of the pipelines of
+// successive compilations, keyed by the hash of the contents of their TOML files and the number
+// of qubits, so that the same configuration is only parsed once per process.
+std::shared_ptr<const OQDDatabaseManager> getSharedDataManager(const std::string &deviceToml,
+                                                               const std::string &qubitToml,
+                                                               const std::string &gateToml,
+                                                               size_t nQubits)
+{
+    static std::mutex mutex;
+    static std::unordered_map<size_t, std::shared_ptr<const OQDDatabaseManager>> dataManagers;
+
+    llvm::hash_code key = llvm::hash_value(nQubits);
+    for (const std::string &path : {deviceToml, qubitToml, gateToml}) {
+        // Unreadable files are keyed by their path, and reported by the database manager
+        auto buffer = llvm::MemoryBuffer::getFile(path);
+        key = llvm::hash_combine(key, buffer ? (*buffer)->getBuffer() : llvm::StringRef(path));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &dataManager = dataManagers[static_cast<size_t>(key)];
+    if (!dataManager) {
+        dataManager =
+            std::make_shared<const OQDDatabaseManager>(deviceToml, qubitToml, gateToml, nQubits);
+    }
+    return dataManager;
+}
+
+} // namespace
+
 struct GatesToPulsesPass : impl::GatesToPulsesPassBase<GatesToPulsesPass> {
     using GatesToPulsesPassBase::GatesToPulsesPassBase;
 
+    // The database and the pulse parameters of the gates are shared by all the QNodes lowered by
+    // this pass instance. Only the phonons depend on the number of qubits of the QNode. The
+    // databases are also shared with the other instances of the pass, see getSharedDataManager.
+    std::map<size_t, std::shared_ptr<const OQDDatabaseManager>> dataManagers;
+    GatePulseCache pulseCache;
+
+    const OQDDatabaseManager &getDataManager(size_t nQubits)
+    {
+        auto &dataManager = dataManagers[nQubits];
+        if (!dataManager) {
+            dataManager = getSharedDataManager(DeviceTomlLoc, QubitTomlLoc,
+                                               Gate2PulseDecompTomlLoc, nQubits);
+        }
+        return *dataManager;
+    }
+
     LevelAttr getLevelAttr(MLIRContext *ctx, IRRewriter &builder, Level level)
     {
         return LevelAttr::get(
@@ -83,8 +137,7 @@ struct GatesToPulsesPass : impl::GatesToPulsesPassBase<GatesToPulsesPass> {
         auto allocOp = *op.getOps<quantum::AllocOp>().begin();
         auto nQubits = allocOp.getNqubitsAttr().value();
 
-        OQDDatabaseManager dataManager(DeviceTomlLoc, QubitTomlLoc, Gate2PulseDecompTomlLoc,
-                                       nQubits);
+        const OQDDatabaseManager &dataManager = getDataManager(nQubits);
 
         if (LoadIon) {
             // FIXME(?): we only load Yb171 ion since the hardware ion species is unlikely to change
@@ -125,7 +178,7 @@ struct GatesToPulsesPass : impl::GatesToPulsesPassBase<GatesToPulsesPass> {
         }
 
         RewritePatternSet ionPatterns(&getContext());
-        populateGatesToPulsesPatterns(ionPatterns, dataManager);
+        populateGatesToPulsesPatterns(ionPatterns, dataManager, nQubits, pulseCache);
 
         if (failed(applyPartialConversion(op, target, std::move(ionPatterns)))) {
             return signalPassFailure();
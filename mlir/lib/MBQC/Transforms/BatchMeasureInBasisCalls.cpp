@@ -0,0 +1,208 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+
+#include "Catalyst/Utils/RuntimeFunctionAttributes.h"
+#include "Catalyst/Utils/StaticAllocas.h"
+#include "MBQC/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace {
+
+constexpr StringRef MEASURE_IN_BASIS = "__catalyst__mbqc__measure_in_basis";
+
+bool isMeasureInBasisCall(Operation *op)
+{
+    auto call = dyn_cast<LLVM::CallOp>(op);
+    return call && call.getCallee() && *call.getCallee() == MEASURE_IN_BASIS;
+}
+
+/// A straight-line run of measurements, together with the operations interleaved with them that
+/// depend on their results and must therefore be moved after the batched call.
+struct MeasurementBatch {
+    SmallVector<LLVM::CallOp> calls;
+    SmallVector<Operation *> dependents;
+};
+
+/// Operations that may be interleaved with the measurements of a batch without ending it: those
+/// that do not touch the device state, qubit lookups, and the loads of measurement results.
+bool isTransparent(Operation *op, const llvm::DenseSet<Value> &tainted)
+{
+    if (isMemoryEffectFree(op)) {
+        return true;
+    }
+
+    auto isQubitLookup = [](Operation *op) {
+        auto call = dyn_cast_or_null<LLVM::CallOp>(op);
+        return call && call.getCallee() &&
+               *call.getCallee() == "__catalyst__rt__array_get_element_ptr_1d";
+    };
+    if (isQubitLookup(op)) {
+        return true;
+    }
+    if (auto load = dyn_cast<LLVM::LoadOp>(op)) {
+        return isQubitLookup(load.getAddr().getDefiningOp()) || tainted.contains(load.getAddr());
+    }
+    return false;
+}
+
+Value createI64(IRRewriter &rewriter, Location loc, int64_t value)
+{
+    return LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(value));
+}
+
+/// Store `values` into a new stack buffer of element type `type`.
+Value createBuffer(IRRewriter &rewriter, Location loc, Type type, ArrayRef<Value> values)
+{
+    auto ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+    Value buffer = catalyst::getStaticAlloca(loc, rewriter, type, values.size()).getResult();
+    for (auto [idx, value] : llvm::enumerate(values)) {
+        auto itemPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, type, buffer,
+                                           ArrayRef<LLVM::GEPArg>{static_cast<int32_t>(idx)},
+                                           LLVM::GEPNoWrapFlags::inbounds);
+        LLVM::StoreOp::create(rewriter, loc, value, itemPtr);
+    }
+    return buffer;
+}
+
+void emitBatch(IRRewriter &rewriter, ModuleOp mod, const MeasurementBatch &batch)
+{
+    MLIRContext *ctx = rewriter.getContext();
+    Location loc = batch.calls.back().getLoc();
+
+    StringRef qirName = "__catalyst__mbqc__measure_in_basis_array";
+    Type i32Type = IntegerType::get(ctx, 32);
+    Type i64Type = IntegerType::get(ctx, 64);
+    Type f64Type = Float64Type::get(ctx);
+    Type ptrType = LLVM::LLVMPointerType::get(ctx);
+    auto fnDecl = mod.lookupSymbol<LLVM::LLVMFuncOp>(qirName);
+    if (!fnDecl) {
+        OpBuilder::InsertionGuard guard(rewriter);
+        rewriter.setInsertionPointToStart(mod.getBody());
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx), {i64Type, ptrType, ptrType, ptrType, ptrType, ptrType});
+        fnDecl = LLVM::LLVMFuncOp::create(rewriter, loc, qirName, qirSignature);
+        catalyst::annotateRuntimeFunction(fnDecl);
+    }
+
+    // The operands of every measurement dominate the last one, so the batch replaces it in place
+    rewriter.setInsertionPoint(batch.calls.back());
+    SmallVector<Value> wires, planes, angles, postselects;
+    for (LLVM::CallOp call : batch.calls) {
+        ValueRange operands = call.getArgOperands();
+        wires.push_back(operands[0]);
+        planes.push_back(operands[1]);
+        angles.push_back(operands[2]);
+        postselects.push_back(operands[3]);
+    }
+
+    int64_t numQubits = batch.calls.size();
+    Value results = catalyst::getStaticAlloca(loc, rewriter, ptrType, numQubits).getResult();
+    SmallVector<Value> args = {
+        createI64(rewriter, loc, numQubits),
+        createBuffer(rewriter, loc, ptrType, wires),
+        createBuffer(rewriter, loc, i32Type, planes),
+        createBuffer(rewriter, loc, f64Type, angles),
+        createBuffer(rewriter, loc, i32Type, postselects),
+        results,
+    };
+    LLVM::CallOp::create(rewriter, loc, fnDecl, args);
+
+    for (auto [idx, call] : llvm::enumerate(batch.calls)) {
+        auto resultPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, ptrType, results,
+                                             ArrayRef<LLVM::GEPArg>{static_cast<int32_t>(idx)},
+                                             LLVM::GEPNoWrapFlags::inbounds);
+        Value result = LLVM::LoadOp::create(rewriter, loc, ptrType, resultPtr);
+        rewriter.replaceAllUsesWith(call.getResult(), result);
+    }
+
+    // Uses of the results that were interleaved with the measurements now follow the batch, while
+    // those after the last measurement already do
+    Operation *insertionPoint = batch.calls.back();
+    for (Operation *dependent : batch.dependents) {
+        if (dependent->isBeforeInBlock(insertionPoint)) {
+            rewriter.moveOpBefore(dependent, insertionPoint);
+        }
+    }
+
+    for (LLVM::CallOp call : batch.calls) {
+        rewriter.eraseOp(call);
+    }
+}
+
+} // namespace
+
+namespace catalyst {
+namespace mbqc {
+
+void batchMeasureInBasisCalls(Operation *root)
+{
+    SmallVector<MeasurementBatch> batches;
+    root->walk([&](Block *block) {
+        MeasurementBatch current;
+        // Results of the measurements of the current batch, and values computed from them
+        llvm::DenseSet<Value> tainted;
+        auto flush = [&]() {
+            if (current.calls.size() > 1) {
+                batches.push_back(std::move(current));
+            }
+            current = MeasurementBatch();
+            tainted.clear();
+        };
+        auto isTainted = [&](Operation *op) {
+            return llvm::any_of(op->getOperands(), [&](Value v) { return tainted.contains(v); });
+        };
+
+        for (Operation &op : *block) {
+            if (isMeasureInBasisCall(&op)) {
+                // A measurement whose basis is fed forward from the batch starts a new one
+                if (isTainted(&op)) {
+                    flush();
+                }
+                current.calls.push_back(cast<LLVM::CallOp>(op));
+                tainted.insert(op.getResult(0));
+            }
+            else if (current.calls.empty()) {
+                continue;
+            }
+            else if (op.getNumRegions() == 0 && isTransparent(&op, tainted)) {
+                if (isTainted(&op)) {
+                    current.dependents.push_back(&op);
+                    tainted.insert(op.getResults().begin(), op.getResults().end());
+                }
+            }
+            else {
+                flush();
+            }
+        }
+        flush();
+    });
+
+    IRRewriter rewriter(root->getContext());
+    for (const MeasurementBatch &batch : batches) {
+        emitBatch(rewriter, batch.calls.front()->getParentOfType<ModuleOp>(), batch);
+    }
+}
+
+} // namespace mbqc
+} // namespace catalyst
@@ -57,7 +57,11 @@ struct MBQCConversionPass : impl::MBQCConversionPassBase<MBQCConversionPass> {
         target.addIllegalDialect<catalyst::mbqc::MBQCDialect>();
 
         if (failed(applyPartialConversion(getOperation(), target, std::move(patterns)))) {
-            signalPassFailure();
+            return signalPassFailure();
+        }
+
+        if (batchMeasurements) {
+            batchMeasureInBasisCalls(getOperation());
         }
     }
 };
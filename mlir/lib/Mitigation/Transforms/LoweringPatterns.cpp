@@ -23,9 +23,9 @@ using namespace catalyst::mitigation;
 namespace catalyst {
 namespace mitigation {
 
-void populateLoweringPatterns(RewritePatternSet &patterns)
+void populateLoweringPatterns(RewritePatternSet &patterns, bool parallelScaleFactors)
 {
-    patterns.add<ZneLowering>(patterns.getContext());
+    patterns.add<ZneLowering>(patterns.getContext(), parallelScaleFactors);
 }
 
 } // namespace mitigation
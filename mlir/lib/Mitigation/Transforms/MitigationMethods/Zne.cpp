@@ -25,6 +25,7 @@
 #include "mlir/Dialect/Index/IR/IndexOps.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
 #include "mlir/IR/IRMapping.h"
 
 #include "Catalyst/Utils/CallGraph.h"
@@ -72,6 +73,50 @@ func::FuncOp createZneFunc(func::FuncOp funcOp, PatternRewriter &rewriter)
     return fnFoldedOp;
 }
 
+// Call the folded circuit once per scale factor in an scf.forall, whose iterations are independent
+// and run concurrently once the async QNode pipeline lowers the loop to async tasks. Each
+// iteration writes its row of results into the results tensor.
+Value parallelFolding(Location loc, PatternRewriter &rewriter, mitigation::ZneOp op,
+                      func::FuncOp fnFoldedOp, int64_t sizeInt)
+{
+    OpBuilder::InsertionGuard guard(rewriter);
+    RankedTensorType resultType = cast<RankedTensorType>(op.getResultTypes().front());
+    Value results =
+        tensor::EmptyOp::create(rewriter, loc, resultType.getShape(), resultType.getElementType());
+    auto forallOp =
+        scf::ForallOp::create(rewriter, loc, ArrayRef<OpFoldResult>{rewriter.getIndexAttr(sizeInt)},
+                              ValueRange{results}, std::nullopt);
+
+    rewriter.setInsertionPointToStart(forallOp.getBody());
+    Value i = forallOp.getInductionVar(0);
+    std::vector<Value> newArgs(op.getArgs().begin(), op.getArgs().end());
+    Value numFold = tensor::ExtractOp::create(rewriter, loc, op.getNumFolds(), ValueRange{i});
+    newArgs.push_back(index::CastSOp::create(rewriter, loc, rewriter.getIndexType(), numFold));
+    func::CallOp callOp = func::CallOp::create(rewriter, loc, fnFoldedOp, newArgs);
+
+    SmallVector<Value> resultValues;
+    for (Value resultValue : callOp.getResults()) {
+        if (isa<RankedTensorType>(resultValue.getType())) {
+            resultValue = tensor::ExtractOp::create(rewriter, loc, resultValue);
+        }
+        resultValues.push_back(resultValue);
+    }
+    // The results are a vector with one measurement, or a matrix with one row per scale factor
+    SmallVector<int64_t> rowShape(resultType.getRank(), 1);
+    rowShape.back() = callOp.getNumResults();
+    Value row = tensor::FromElementsOp::create(
+        rewriter, loc, RankedTensorType::get(rowShape, resultType.getElementType()), resultValues);
+
+    SmallVector<OpFoldResult> offsets(rowShape.size(), rewriter.getIndexAttr(0));
+    offsets.front() = i;
+    SmallVector<OpFoldResult> sizes = getAsIndexOpFoldResult(rewriter.getContext(), rowShape);
+    SmallVector<OpFoldResult> strides(rowShape.size(), rewriter.getIndexAttr(1));
+    rewriter.setInsertionPointToStart(forallOp.getTerminator().getBody());
+    tensor::ParallelInsertSliceOp::create(rewriter, loc, row, forallOp.getRegionIterArgs().front(),
+                                          offsets, sizes, strides);
+    return forallOp.getResult(0);
+}
+
 // TODO: Optimize the traversal of call graphs (currently used twice)
 // Also all functions exploree in the call graph get their ZNE version.
 LogicalResult ZneLowering::matchAndRewrite(mitigation::ZneOp op, PatternRewriter &rewriter) const
@@ -92,6 +137,13 @@ LogicalResult ZneLowering::matchAndRewrite(mitigation::ZneOp op, PatternRewriter
     if (!calleeOp->hasAttr("qnode")) {
         // Traverse the callgraph, copy all the function to a `.zne` version and fold qnodes
         traverseCallGraph(calleeOp, /*symbolTable=*/nullptr, [&](func::FuncOp funcOp) {
+            // The .zne counterpart takes the scale factor as an argument, so that it is shared by
+            // all ZNE operations calling the same function
+            std::string zneName = funcOp.getName().str() + ".zne";
+            if (SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+                    moduleOp, rewriter.getStringAttr(zneName))) {
+                return;
+            }
             if (!funcOp->hasAttr("qnode")) {
                 // Copy the function and create a .zne counter part and add the scale factor as last
                 // argument
@@ -153,6 +205,10 @@ LogicalResult ZneLowering::matchAndRewrite(mitigation::ZneOp op, PatternRewriter
         fnFoldedOp = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(calleeOp, foldedOpRefAttr);
     }
     rewriter.setInsertionPoint(op);
+    if (parallelScaleFactors) {
+        rewriter.replaceOp(op, parallelFolding(loc, rewriter, op, fnFoldedOp, sizeInt));
+        return success();
+    }
     RankedTensorType resultType = cast<RankedTensorType>(op.getResultTypes().front());
 
     // Loop over the num fold to create a folded circuit per factor
@@ -27,11 +27,17 @@ namespace catalyst {
 namespace mitigation {
 
 struct ZneLowering : public OpRewritePattern<mitigation::ZneOp> {
-    using OpRewritePattern<mitigation::ZneOp>::OpRewritePattern;
+    ZneLowering(MLIRContext *ctx, bool parallelScaleFactors = false)
+        : OpRewritePattern<mitigation::ZneOp>(ctx), parallelScaleFactors(parallelScaleFactors)
+    {
+    }
 
     LogicalResult matchAndRewrite(mitigation::ZneOp op, PatternRewriter &rewriter) const override;
 
   private:
+    // Whether the folded circuits of the scale factors are executed in an scf.forall
+    bool parallelScaleFactors;
+
     static FlatSymbolRefAttr getOrInsertFoldedCircuit(Location loc, PatternRewriter &builder,
                                                       func::FuncOp op, Folding foldingAlgorithm);
     static FlatSymbolRefAttr getOrInsertQuantumAlloc(Location loc, PatternRewriter &rewriter,
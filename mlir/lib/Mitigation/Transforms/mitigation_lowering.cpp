@@ -40,7 +40,7 @@ struct MitigationLoweringPass : impl::MitigationLoweringPassBase<MitigationLower
     void runOnOperation() final
     {
         RewritePatternSet mitigationPatterns(&getContext());
-        populateLoweringPatterns(mitigationPatterns);
+        populateLoweringPatterns(mitigationPatterns, parallelScaleFactors);
 
         if (failed(applyPatternsGreedily(getOperation(), std::move(mitigationPatterns)))) {
             return signalPassFailure();
@@ -19,6 +19,7 @@
 #include "PBC/IR/PBCOpInterfaces.h"
 #include "PBC/IR/PBCOps.h"
 #include "PBC/Transforms/Patterns.h"
+#include "PBC/Utils/PackedPauliString.h"
 #include "PBC/Utils/PauliStringWrapper.h"
 
 using namespace mlir;
@@ -146,6 +147,10 @@ struct CommutePPR : public OpRewritePattern<PPRotationOp> {
 
     size_t MAX_PAULI_SIZE;
 
+    // Commutation is decided on the packed Pauli words, so that ops that cannot be commuted
+    // because of the size limit are rejected without building the Stim strings.
+    mutable PauliProductCache pauliProductCache;
+
     CommutePPR(mlir::MLIRContext *context, size_t maxPauliSize, PatternBenefit benefit)
         : OpRewritePattern(context), MAX_PAULI_SIZE(maxPauliSize)
     {
@@ -154,10 +159,20 @@ struct CommutePPR : public OpRewritePattern<PPRotationOp> {
     LogicalResult matchAndRewrite(PPRotationOp op, PatternRewriter &rewriter) const override
     {
         return visitValidNonCliffordPPR(op, [&](PPRotationOp nonCliffordPPR) {
+            auto [cliffordPauli, nonCliffordPauli] =
+                packPPROps(op, nonCliffordPPR, op.getOutQubits(), nonCliffordPPR.getInQubits(),
+                           pauliProductCache);
+            bool isCommuting = cliffordPauli.commutes(nonCliffordPauli);
+
+            // Skip if Pauli size is too large
+            if (!isCommuting && exceedPauliSizeLimit(cliffordPauli.size(), MAX_PAULI_SIZE)) {
+                return failure();
+            }
+
             auto [normCliffordPPR, normNonCliffordPPR] = normalizePPROps(op, nonCliffordPPR);
 
             // Handle commuting case
-            if (normCliffordPPR.commutes(normNonCliffordPPR)) {
+            if (isCommuting) {
                 moveCliffordPastNonClifford(normCliffordPPR, normNonCliffordPPR, nullptr, rewriter);
                 return success();
             }
@@ -165,12 +180,6 @@ struct CommutePPR : public OpRewritePattern<PPRotationOp> {
             // Handle non-commuting case
             auto commutedResult = normCliffordPPR.computeCommutationRulesWith(normNonCliffordPPR);
 
-            // Skip if Pauli size is too large
-            size_t pauliSize = commutedResult.get_pauli_word().size();
-            if (exceedPauliSizeLimit(pauliSize, MAX_PAULI_SIZE)) {
-                return failure();
-            }
-
             moveCliffordPastNonClifford(normCliffordPPR, normNonCliffordPPR, &commutedResult,
                                         rewriter);
             return success();
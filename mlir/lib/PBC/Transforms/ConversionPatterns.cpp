@@ -49,29 +49,23 @@ template <typename T> struct PPRotationBasedPattern : public OpConversionPattern
 
         Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
 
+        // The condition is passed to the runtime as a predicate, so that a conditional PPR lowers
+        // to a single call instead of a branch around it
+        Value cond = adaptor.getCondition();
+        if (!cond) {
+            cond = LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(1));
+        }
+
         // Get the rotation angle based on the op type
         // Since the qml.PauliRot(phi) == PPR(phi/2), this rotation_kind is multiplied by 2.
         Value thetaValue;
-        Value cond;
         if constexpr (std::is_same_v<T, PPRotationOp>) {
-            if (op.getCondition()) {
-                cond = op.getCondition();
-            }
-            else {
-                cond = LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(1));
-            }
             // Compute the rotation angle: theta = π / rotation_kind
             // rotation_kind can be ±1, ±2, ±4, ±8
             double theta = 2 * (llvm::numbers::pi / static_cast<double>(op.getRotationKind()));
             thetaValue = LLVM::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(theta));
         }
         else if constexpr (std::is_same_v<T, PPRotationArbitraryOp>) {
-            if (op.getCondition()) {
-                cond = op.getCondition();
-            }
-            else {
-                cond = LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(1));
-            }
             // multiply by 2 to get the rotation angle
             thetaValue = LLVM::FMulOp::create(
                 rewriter, loc, adaptor.getArbitraryAngle(),
@@ -81,10 +75,10 @@ template <typename T> struct PPRotationBasedPattern : public OpConversionPattern
             static_assert(!std::is_same_v<T, T>(), "unexpected type in templated rewrite");
         }
 
-        Value pauliWordPtr = getPauliProductPtr(loc, rewriter, mod, op.getPauliProduct());
+        Value pauliMasksPtr = getPackedPauliWordPtr(loc, rewriter, mod, op.getPauliProduct());
         Value modifiersPtr = LLVM::ZeroOp::create(rewriter, loc, ptrType);
-        createPauliRotCall(loc, rewriter, op.getOperation(), pauliWordPtr, thetaValue, modifiersPtr,
-                           cond, adaptor.getInQubits());
+        createPauliRotCall(loc, rewriter, op.getOperation(), pauliMasksPtr, thetaValue,
+                           modifiersPtr, cond, adaptor.getInQubits());
 
         // Replace the op with the input qubits
         rewriter.replaceOp(op, adaptor.getInQubits());
@@ -104,12 +98,12 @@ template <typename T> struct PPMeasurementOpPattern : public OpConversionPattern
         const TypeConverter *conv = this->getTypeConverter();
         ModuleOp mod = op->template getParentOfType<ModuleOp>();
 
-        // Create a global string for the Pauli word
+        // Create a global constant for the packed Pauli word
         Value selectSwitch;
         Value pauliWordPtr, pauliWordAltPtr;
         Value negated, negatedAlt;
         if constexpr (std::is_same_v<T, PPMeasurementOp>) {
-            pauliWordPtr = getPauliProductPtr(loc, rewriter, mod, op.getPauliProduct());
+            pauliWordPtr = getPackedPauliWordPtr(loc, rewriter, mod, op.getPauliProduct());
             negated =
                 LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(op.getNegated()));
             pauliWordAltPtr = pauliWordPtr;
@@ -117,19 +111,19 @@ template <typename T> struct PPMeasurementOpPattern : public OpConversionPattern
             selectSwitch = LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(true));
         }
         else if constexpr (std::is_same_v<T, SelectPPMeasurementOp>) {
-            pauliWordPtr = getPauliProductPtr(loc, rewriter, mod, op.getPauliProduct_0());
+            pauliWordPtr = getPackedPauliWordPtr(loc, rewriter, mod, op.getPauliProduct_0());
             negated =
                 LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(op.getNegated_0()));
-            pauliWordAltPtr = getPauliProductPtr(loc, rewriter, mod, op.getPauliProduct_1());
+            pauliWordAltPtr = getPackedPauliWordPtr(loc, rewriter, mod, op.getPauliProduct_1());
             negatedAlt =
                 LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(op.getNegated_1()));
-            selectSwitch = op.getSelectSwitch();
+            selectSwitch = adaptor.getSelectSwitch();
         }
         else {
             static_assert(!std::is_same_v<T, T>(), "unexpected type in templated rewrite");
         }
 
-        StringRef qirName = "__catalyst__qis__PauliMeasure";
+        StringRef qirName = "__catalyst__qis__PackedPauliMeasure";
         Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
         Type qirSignature = LLVM::LLVMFunctionType::get(
             conv->convertType(ResultType::get(ctx)),
@@ -59,26 +59,41 @@ struct CountPPMSpecsPass : public impl::CountPPMSpecsPassBase<CountPPMSpecsPass>
         return success();
     }
 
+    // Count how many times an op is executed, from the static (or affine) bounds of the enclosing
+    // for loops and the static conditions of the enclosing conditionals.
+    FailureOr<int64_t> countExecutions(Operation *op)
+    {
+        std::optional<int64_t> numExecutions;
+        if (!isOpInWhileOp(op)) {
+            numExecutions = countStaticExecutions(op);
+        }
+        if (!numExecutions) {
+            if (isOpInIfOp(op) || isOpInWhileOp(op)) {
+                op->emitOpError(
+                    "PPM statistics is not available when there are conditionals or while loops.");
+            }
+            else {
+                op->emitOpError(
+                    "PPM statistics is not available when there are dynamically sized for loops.");
+            }
+            return failure();
+        }
+        return *numExecutions;
+    }
+
     LogicalResult countPPM(pbc::PPMeasurementOp op,
                            llvm::DenseMap<StringRef, llvm::DenseMap<StringRef, int>> &PPMSpecs)
     {
-        if (isOpInIfOp(op) || isOpInWhileOp(op)) {
-            return op->emitOpError(
-                "PPM statistics is not available when there are conditionals or while loops.");
+        FailureOr<int64_t> numExecutions = countExecutions(op);
+        if (failed(numExecutions)) {
+            return failure();
+        }
+        if (*numExecutions == 0) {
+            return success();
         }
 
         auto parentFuncOp = op->getParentOfType<func::FuncOp>();
-
-        // Handle when PPM op is in a static for loop
-        // Note that countStaticForloopIterations returns -1 when it bails out for
-        // dynamic loop bounds
-        // When bailing out on dynamic, just error.
-        int64_t forLoopMultiplier = countStaticForloopIterations(op);
-        if (forLoopMultiplier == -1) {
-            return op->emitOpError(
-                "PPM statistics is not available when there are dynamically sized for loops.");
-        }
-        PPMSpecs[parentFuncOp.getName()]["num_of_ppm"] += forLoopMultiplier;
+        PPMSpecs[parentFuncOp.getName()]["num_of_ppm"] += *numExecutions;
         return success();
     }
 
@@ -86,9 +101,12 @@ struct CountPPMSpecsPass : public impl::CountPPMSpecsPassBase<CountPPMSpecsPass>
                            llvm::DenseMap<StringRef, llvm::DenseMap<StringRef, int>> &PPMSpecs,
                            llvm::BumpPtrAllocator &stringAllocator)
     {
-        if (isOpInIfOp(op) || isOpInWhileOp(op)) {
-            return op->emitOpError(
-                "PPM statistics is not available when there are conditionals or while loops.");
+        FailureOr<int64_t> numExecutions = countExecutions(op);
+        if (failed(numExecutions)) {
+            return failure();
+        }
+        if (*numExecutions == 0) {
+            return success();
         }
 
         int8_t rotationKind = op.getRotationKind();
@@ -101,16 +119,7 @@ struct CountPPMSpecsPass : public impl::CountPPMSpecsPassBase<CountPPMSpecsPass>
         StringRef maxWeightRotationKindKey =
             saver.save("max_weight_pi" + std::to_string(abs(rotationKind)));
 
-        // Handle when PPR op is in a static for loop
-        // Note that countStaticForloopIterations returns -1 when it bails out for
-        // dynamic loop bounds
-        // When bailing out on dynamic, just error.
-        int64_t forLoopMultiplier = countStaticForloopIterations(op);
-        if (forLoopMultiplier == -1) {
-            return op->emitOpError(
-                "PPM statistics is not available when there are dynamically sized for loops.");
-        }
-        PPMSpecs[funcName][numRotationKindKey] += forLoopMultiplier;
+        PPMSpecs[funcName][numRotationKindKey] += *numExecutions;
 
         PPMSpecs[funcName][maxWeightRotationKindKey] =
             std::max(PPMSpecs[funcName][maxWeightRotationKindKey],
@@ -121,7 +130,7 @@ struct CountPPMSpecsPass : public impl::CountPPMSpecsPassBase<CountPPMSpecsPass>
     bool commuteToLayer(PBCOpInterface rhsOp, PBCLayer &lhsLayer)
     {
         for (auto lhsOp : lhsLayer.getOps()) {
-            if (!commutes(rhsOp, lhsOp)) {
+            if (!commutes(rhsOp, lhsOp, lhsLayer.getContext()->pauliProductCache)) {
                 return false;
             }
         }
@@ -15,8 +15,8 @@
 #include "mlir/Transforms/DialectConversion.h"
 
 #include "PBC/IR/PBCOps.h"
+#include "PBC/Transforms/PPRDecomposeUtils.h"
 #include "PBC/Transforms/Patterns.h"
-#include "PBC/Utils/PauliStringWrapper.h"
 #include "Quantum/IR/QuantumOps.h"
 
 using namespace mlir;
@@ -46,7 +46,8 @@ namespace {
 /// |+⟩──| Z |───| X(π/2)|──| Z(phi)|──| X |
 ///      └───┘   └───────┘  └───────┘  └───┘
 /// PZ, and X are PPMs, while X(phi), Z(phi), and P(pi/2) are PPRs.
-LogicalResult convertArbitraryPPRToArbitraryZ(PPRotationArbitraryOp &op, PatternRewriter &rewriter)
+void convertArbitraryPPRToArbitraryZ(PPRotationArbitraryOp op, const PPRDecompositionPlan &plan,
+                                     RewriterBase &rewriter)
 {
     auto loc = op.getLoc();
 
@@ -60,8 +61,7 @@ LogicalResult convertArbitraryPPRToArbitraryZ(PPRotationArbitraryOp &op, Pattern
     // |   ╠══
     // | Z |──
     // └───┘
-    SmallVector<StringRef> PZ = extractPauliString(op);
-    PZ.emplace_back("Z");
+    ArrayRef<StringRef> PZ = plan.extendedPauli;
     SmallVector<Value> inQubits = op.getInQubits();
     inQubits.emplace_back(plusQubit.getOutQubits().front());
     auto ppmPZ = PPMeasurementOp::create(rewriter, loc, PZ, inQubits);
@@ -100,7 +100,13 @@ LogicalResult convertArbitraryPPRToArbitraryZ(PPRotationArbitraryOp &op, Pattern
 
     // Deallocate the axillary qubits |+⟩
     DeallocQubitOp::create(rewriter, loc, ppmX.getOutQubits().back());
-    return success();
+}
+
+// Single-qubit arbitrary PPRs in the Z basis are the target of the decomposition
+bool isDecomposable(PPRotationArbitraryOp op)
+{
+    ArrayAttr pauliProduct = op.getPauliProduct();
+    return !(pauliProduct.size() == 1 && cast<StringAttr>(pauliProduct[0]).getValue() == "Z");
 }
 
 struct DecomposeArbitraryPPR : public OpRewritePattern<PPRotationArbitraryOp> {
@@ -109,10 +115,11 @@ struct DecomposeArbitraryPPR : public OpRewritePattern<PPRotationArbitraryOp> {
     LogicalResult matchAndRewrite(PPRotationArbitraryOp op,
                                   PatternRewriter &rewriter) const override
     {
-        if (op.getPauliProduct() == rewriter.getStrArrayAttr({"Z"})) {
+        if (!isDecomposable(op)) {
             return failure();
         }
-        return convertArbitraryPPRToArbitraryZ(op, rewriter);
+        convertArbitraryPPRToArbitraryZ(op, planPPRDecomposition(op.getPauliProduct()), rewriter);
+        return success();
     }
 };
 
@@ -126,5 +133,21 @@ void populateDecomposeArbitraryPPRPatterns(RewritePatternSet &patterns)
     patterns.add<DecomposeArbitraryPPR>(patterns.getContext());
 }
 
+void decomposeArbitraryPPRBatch(Operation *root)
+{
+    SmallVector<Operation *> ops;
+    root->walk([&](PPRotationArbitraryOp op) {
+        if (isDecomposable(op)) {
+            ops.push_back(op);
+        }
+    });
+
+    decomposePPRBatch(root->getContext(), ops,
+                      [](Operation *op, const PPRDecompositionPlan &plan, RewriterBase &rewriter) {
+                          convertArbitraryPPRToArbitraryZ(cast<PPRotationArbitraryOp>(op), plan,
+                                                          rewriter);
+                      });
+}
+
 } // namespace pbc
 } // namespace catalyst
@@ -23,7 +23,6 @@
 #include "PBC/IR/PBCOps.h"
 #include "PBC/Transforms/PPRDecomposeUtils.h"
 #include "PBC/Transforms/Patterns.h"
-#include "PBC/Utils/PauliStringWrapper.h"
 #include "Quantum/IR/QuantumOps.h"
 
 using namespace mlir;
@@ -70,19 +69,18 @@ LogicalInitKind getMagicState(PPRotationOp op)
 ///   * Measuring -1 corresponds to storing `true = 1` and 1 corresponds to storing `false = 0`.
 ///   - If the X or Y measurement yields -1, apply P(π/2) on the input qubits
 void decomposePauliCorrectedPiOverEight(bool avoidPauliYMeasure, PPRotationOp op,
-                                        PatternRewriter &rewriter)
+                                        const PPRDecompositionPlan &plan, RewriterBase &rewriter)
 {
     auto loc = op.getLoc();
     // We always initialize the magic state here, not the conjugate.
     auto magic = FabricateOp::create(rewriter, loc, LogicalInitKind::magic);
 
-    SmallVector<StringRef> pauliP = extractPauliString(op); // [P]
-    SmallVector<Value> inQubits = op.getInQubits();         // [input qubits]
+    ArrayRef<StringRef> pauliP = plan.pauli;        // [P]
+    SmallVector<Value> inQubits = op.getInQubits(); // [input qubits]
 
     // PPM (P⊗Z) on input qubits and |m⟩
-    SmallVector<StringRef> extendedPauliP = pauliP;
-    extendedPauliP.emplace_back("Z");                   // extend Z for the axillary qubit -> [P, Z]
-    inQubits.emplace_back(magic.getOutQubits().back()); // [input qubits, |m⟩]
+    ArrayRef<StringRef> extendedPauliP = plan.extendedPauli; // [P, Z]
+    inQubits.emplace_back(magic.getOutQubits().back());      // [input qubits, |m⟩]
 
     int8_t rotationKind = op.getRotationKind();
     auto ppmPZ = PPMeasurementOp::create(rewriter, loc, extendedPauliP, inQubits, rotationKind < 0);
@@ -190,7 +188,7 @@ void decomposePauliCorrectedPiOverEight(bool avoidPauliYMeasure, PPRotationOp op
 /// |0⟩─────────| Y |─| Z(π/2)|───╚══╣X/Z╠═╝
 ///             └───┘ └───────┘      └───┘
 void decomposeAutoCorrectedPiOverEight(bool avoidPauliYMeasure, PPRotationOp op,
-                                       PatternRewriter &rewriter)
+                                       const PPRDecompositionPlan &plan, RewriterBase &rewriter)
 {
     auto loc = op.getLoc();
 
@@ -200,13 +198,12 @@ void decomposeAutoCorrectedPiOverEight(bool avoidPauliYMeasure, PPRotationOp op,
 
     auto [pauliForAxillaryQubit, negated] = determinePauliAndSignOfMeasurement(avoidPauliYMeasure);
 
-    SmallVector<StringRef> pauliP = extractPauliString(op);
+    ArrayRef<StringRef> pauliP = plan.pauli;
     SmallVector<Value> inQubits = op.getInQubits(); // [input qubits]
 
     // PPM (P⊗Z) on input qubits and |m⟩
-    // extend the pi/8 P with Z -> P⊗Z
-    SmallVector<StringRef> extPauliP = pauliP;
-    extPauliP.emplace_back("Z");                    // extend Z for the axillary qubit
+    // the pi/8 P extended with Z for the axillary qubit -> P⊗Z
+    ArrayRef<StringRef> extPauliP = plan.extendedPauli;
     inQubits.emplace_back(magic.getOutQubits()[0]); // [input qubits, |m⟩]
     auto ppmPZ = PPMeasurementOp::create(rewriter, loc, extPauliP, inQubits); // [input qubits, |m⟩]
 
@@ -265,20 +262,20 @@ void decomposeAutoCorrectedPiOverEight(bool avoidPauliYMeasure, PPRotationOp op,
 ///   * Measuring -1 corresponds to storing `true = 1` and 1 corresponds to storing `false = 0`.
 /// - If X measurement yields -1 then apply P(π/2)
 /// FIXME: The expected value output is non-deterministic -- presumably caused by global phase.
-void decomposeInjectMagicStatePiOverEight(PPRotationOp op, PatternRewriter &rewriter)
+void decomposeInjectMagicStatePiOverEight(PPRotationOp op, const PPRDecompositionPlan &plan,
+                                          RewriterBase &rewriter)
 {
     auto loc = op.getLoc();
 
     // Fabricate the magic state |m⟩
     auto magic = FabricateOp::create(rewriter, loc, getMagicState(op));
 
-    SmallVector<StringRef> pauliP = extractPauliString(op); // [P = n qubit]
-    SmallVector<Value> inQubits = op.getInQubits();         // [input qubits]
+    ArrayRef<StringRef> pauliP = plan.pauli;        // [P = n qubit]
+    SmallVector<Value> inQubits = op.getInQubits(); // [input qubits]
 
     // PPM (P⊗Z) on input qubits and |m⟩
-    SmallVector<StringRef> extendedPauliP = pauliP;
-    extendedPauliP.emplace_back("Z");               // extend Z for the axillary qubit -> [P, Z]
-    inQubits.emplace_back(magic.getOutQubits()[0]); // [input qubits, |m⟩]
+    ArrayRef<StringRef> extendedPauliP = plan.extendedPauli; // [P, Z]
+    inQubits.emplace_back(magic.getOutQubits()[0]);          // [input qubits, |m⟩]
     auto ppmPZ = PPMeasurementOp::create(rewriter, loc, extendedPauliP, inQubits);
 
     // PPR P(π/4) on input qubits if PPM (P⊗Z) yields -1
@@ -302,6 +299,24 @@ void decomposeInjectMagicStatePiOverEight(PPRotationOp op, PatternRewriter &rewr
     rewriter.replaceOp(op, pprPI2.getOutQubits());
 }
 
+bool isDecomposable(PPRotationOp op) { return op.isNonClifford() && !op.getCondition(); }
+
+void decomposePiOverEight(DecomposeMethod method, bool avoidPauliYMeasure, PPRotationOp op,
+                          const PPRDecompositionPlan &plan, RewriterBase &rewriter)
+{
+    switch (method) {
+    case DecomposeMethod::AutoCorrected:
+        decomposeAutoCorrectedPiOverEight(avoidPauliYMeasure, op, plan, rewriter);
+        break;
+    case DecomposeMethod::CliffordCorrected:
+        decomposeInjectMagicStatePiOverEight(op, plan, rewriter);
+        break;
+    case DecomposeMethod::PauliCorrected:
+        decomposePauliCorrectedPiOverEight(avoidPauliYMeasure, op, plan, rewriter);
+        break;
+    }
+}
+
 struct DecomposeNonCliffordPPR : public OpRewritePattern<PPRotationOp> {
     using OpRewritePattern::OpRewritePattern;
 
@@ -316,21 +331,12 @@ struct DecomposeNonCliffordPPR : public OpRewritePattern<PPRotationOp> {
 
     LogicalResult matchAndRewrite(PPRotationOp op, PatternRewriter &rewriter) const override
     {
-        if (op.isNonClifford() && !op.getCondition()) {
-            switch (method) {
-            case DecomposeMethod::AutoCorrected:
-                decomposeAutoCorrectedPiOverEight(avoidPauliYMeasure, op, rewriter);
-                break;
-            case DecomposeMethod::CliffordCorrected:
-                decomposeInjectMagicStatePiOverEight(op, rewriter);
-                break;
-            case DecomposeMethod::PauliCorrected:
-                decomposePauliCorrectedPiOverEight(avoidPauliYMeasure, op, rewriter);
-                break;
-            }
-            return success();
+        if (!isDecomposable(op)) {
+            return failure();
         }
-        return failure();
+        decomposePiOverEight(method, avoidPauliYMeasure, op,
+                             planPPRDecomposition(op.getPauliProduct()), rewriter);
+        return success();
     }
 };
 } // namespace
@@ -346,5 +352,22 @@ void populateDecomposeNonCliffordPPRPatterns(RewritePatternSet &patterns,
                                           avoidPauliYMeasure, 1);
 }
 
+void decomposeNonCliffordPPRBatch(Operation *root, DecomposeMethod decomposeMethod,
+                                  bool avoidPauliYMeasure)
+{
+    SmallVector<Operation *> ops;
+    root->walk([&](PPRotationOp op) {
+        if (isDecomposable(op)) {
+            ops.push_back(op);
+        }
+    });
+
+    decomposePPRBatch(root->getContext(), ops,
+                      [&](Operation *op, const PPRDecompositionPlan &plan, RewriterBase &rewriter) {
+                          decomposePiOverEight(decomposeMethod, avoidPauliYMeasure,
+                                               cast<PPRotationOp>(op), plan, rewriter);
+                      });
+}
+
 } // namespace pbc
 } // namespace catalyst
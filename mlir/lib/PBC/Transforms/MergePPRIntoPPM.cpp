@@ -21,6 +21,7 @@
 #include "PBC/IR/PBCOpInterfaces.h"
 #include "PBC/IR/PBCOps.h"
 #include "PBC/Transforms/Patterns.h"
+#include "PBC/Utils/PackedPauliString.h"
 #include "PBC/Utils/PauliStringWrapper.h"
 #include "Quantum/IR/QuantumOps.h"
 
@@ -168,6 +169,10 @@ struct MergePPRIntoPPM : public OpRewritePattern<PPMeasurementOp> {
 
     size_t MAX_PAULI_SIZE;
 
+    // Commutation is decided on the packed Pauli words, so that ops that cannot be merged
+    // because of the size limit are rejected without building the Stim strings.
+    mutable PauliProductCache pauliProductCache;
+
     MergePPRIntoPPM(mlir::MLIRContext *context, size_t maxPauliSize, PatternBenefit benefit)
         : OpRewritePattern(context, benefit), MAX_PAULI_SIZE(maxPauliSize)
     {
@@ -176,10 +181,20 @@ struct MergePPRIntoPPM : public OpRewritePattern<PPMeasurementOp> {
     LogicalResult matchAndRewrite(PPMeasurementOp PPMOp, PatternRewriter &rewriter) const override
     {
         return visitValidCliffordPPR(PPMOp, [&](PPRotationOp cliffordPPROp) {
+            auto [pprPauli, ppmPauli] =
+                packPPROps(cliffordPPROp, PPMOp, cliffordPPROp.getOutQubits(), PPMOp.getInQubits(),
+                           pauliProductCache);
+            bool isCommuting = pprPauli.commutes(ppmPauli);
+
+            // Skip if Pauli size is too large
+            if (!isCommuting && exceedPauliSizeLimit(pprPauli.size(), MAX_PAULI_SIZE)) {
+                return failure();
+            }
+
             auto [normPPROp, normPPMOp] = normalizePPROps(cliffordPPROp, PPMOp);
 
             // Handle commuting case
-            if (normPPROp.commutes(normPPMOp)) {
+            if (isCommuting) {
                 moveCliffordPastPPM(normPPROp, normPPMOp, nullptr, rewriter);
                 return success();
             }
@@ -187,12 +202,6 @@ struct MergePPRIntoPPM : public OpRewritePattern<PPMeasurementOp> {
             // Handle non-commuting case
             auto commutedResult = normPPROp.computeCommutationRulesWith(normPPMOp);
 
-            // Skip if Pauli size is too large
-            size_t pauliSize = commutedResult.get_pauli_word().size();
-            if (exceedPauliSizeLimit(pauliSize, MAX_PAULI_SIZE)) {
-                return failure();
-            }
-
             moveCliffordPastPPM(normPPROp, normPPMOp, &commutedResult, rewriter);
             return success();
         });
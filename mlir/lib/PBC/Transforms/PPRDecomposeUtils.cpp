@@ -14,6 +14,9 @@
 
 #include "PBC/Transforms/PPRDecomposeUtils.h"
 
+#include "llvm/ADT/DenseMap.h"
+
+#include "PBC/IR/PBCOpInterfaces.h"
 #include "PBC/IR/PBCOps.h"         // for FabricateOp
 #include "Quantum/IR/QuantumOps.h" // for quantum::AllocQubitOp
 
@@ -29,7 +32,7 @@ std::pair<mlir::StringRef, bool> determinePauliAndSignOfMeasurement(bool avoidPa
 }
 
 mlir::OpResult initializeZeroOrPlusI(bool avoidPauliYMeasure, mlir::Location loc,
-                                     mlir::PatternRewriter &rewriter)
+                                     mlir::RewriterBase &rewriter)
 {
     if (avoidPauliYMeasure) {
         // Fabricate |Y⟩
@@ -42,5 +45,46 @@ mlir::OpResult initializeZeroOrPlusI(bool avoidPauliYMeasure, mlir::Location loc
     return allocatedQubit.getOutQubit();
 }
 
+PPRDecompositionPlan planPPRDecomposition(mlir::ArrayAttr pauliProduct)
+{
+    PPRDecompositionPlan plan;
+    plan.pauli.reserve(pauliProduct.size());
+    for (mlir::Attribute pauli : pauliProduct) {
+        plan.pauli.emplace_back(mlir::cast<mlir::StringAttr>(pauli).getValue());
+    }
+    plan.extendedPauli = plan.pauli;
+    plan.extendedPauli.emplace_back("Z");
+    return plan;
+}
+
+void decomposePPRBatch(mlir::MLIRContext *ctx, llvm::ArrayRef<mlir::Operation *> ops,
+                       PPRDecompositionFn decompose)
+{
+    llvm::DenseMap<mlir::ArrayAttr, size_t> planIndices;
+    llvm::SmallVector<mlir::ArrayAttr> pauliProducts;
+    llvm::SmallVector<size_t> opPlans;
+    opPlans.reserve(ops.size());
+    for (mlir::Operation *op : ops) {
+        mlir::ArrayAttr pauliProduct = mlir::cast<PBCOpInterface>(op).getPauliProduct();
+        auto [it, inserted] = planIndices.try_emplace(pauliProduct, pauliProducts.size());
+        if (inserted) {
+            pauliProducts.push_back(pauliProduct);
+        }
+        opPlans.push_back(it->second);
+    }
+
+    llvm::SmallVector<PPRDecompositionPlan> plans;
+    plans.reserve(pauliProducts.size());
+    for (mlir::ArrayAttr pauliProduct : pauliProducts) {
+        plans.push_back(planPPRDecomposition(pauliProduct));
+    }
+
+    mlir::IRRewriter rewriter(ctx);
+    for (auto [op, planIdx] : llvm::zip_equal(ops, opPlans)) {
+        rewriter.setInsertionPoint(op);
+        decompose(op, plans[planIdx], rewriter);
+    }
+}
+
 } // namespace pbc
 } // namespace catalyst
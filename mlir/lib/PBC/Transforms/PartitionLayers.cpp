@@ -14,6 +14,10 @@
 
 #define DEBUG_TYPE "partition-layers"
 
+#include <vector>
+
+#include "llvm/ADT/DenseMap.h"
+
 #include "mlir/IR/IRMapping.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/Pass/Pass.h"
@@ -70,6 +74,11 @@ void constructLayer(PBCLayer &layer, IRRewriter &writer)
             mapper.map(inOperands, operands);
             llvm::SmallVector<Value> newResults(results.begin(), results.end());
 
+            llvm::DenseMap<Value, size_t> resultIndices;
+            for (auto [i, result] : llvm::enumerate(outResults)) {
+                resultIndices[result] = i;
+            }
+
             for (const auto &op : layer.getOps()) {
                 auto newOp = op->clone(mapper);
                 builder.insert(newOp);
@@ -78,11 +87,9 @@ void constructLayer(PBCLayer &layer, IRRewriter &writer)
                 mapper.map(op->getResults(), newOp->getResults());
 
                 // Rewrite yield operands to the cloned results where applicable
-                for (auto [i, result] : llvm::enumerate(outResults)) {
-                    for (auto [j, newResult] : llvm::enumerate(op->getResults())) {
-                        if (result == newResult) {
-                            newResults[i] = newOp->getResult(j);
-                        }
+                for (auto [result, newResult] : llvm::zip(op->getResults(), newOp->getResults())) {
+                    if (auto it = resultIndices.find(result); it != resultIndices.end()) {
+                        newResults[it->second] = newResult;
                     }
                 }
             }
@@ -124,7 +131,9 @@ struct PartitionLayersPass : public impl::PartitionLayersPassBase<PartitionLayer
         PBCLayerContext layerContext;
         PBCLayer currentLayer(&layerContext);
 
-        // Accumulate consecutive PBC ops into a layer
+        // 1) Assign the PBC ops to layers in a single walk, without modifying the IR:
+        // each op either joins the current layer or starts a new one.
+        std::vector<std::vector<PBCOpInterface>> layerOps;
         getOperation()->walk([&](PBCOpInterface op) {
             // Skip ops nested inside an existing pbc.layer region
             if (isParentLayerOp(op))
@@ -134,7 +143,7 @@ struct PartitionLayersPass : public impl::PartitionLayersPassBase<PartitionLayer
             if (currentLayer.insert(op))
                 return WalkResult::skip();
 
-            constructLayer(currentLayer, writer);
+            layerOps.push_back(currentLayer.getOps());
 
             // Start a new layer and insert the op
             currentLayer = PBCLayer(&layerContext);
@@ -142,8 +151,14 @@ struct PartitionLayersPass : public impl::PartitionLayersPassBase<PartitionLayer
 
             return WalkResult::advance();
         });
+        layerOps.push_back(currentLayer.getOps());
 
-        constructLayer(currentLayer, writer);
+        // 2) Materialize the layers in order. The operands and results of a layer are collected
+        // once the previous layers have been replaced by their pbc.layer ops.
+        for (const auto &ops : layerOps) {
+            PBCLayer layer(&layerContext, ops);
+            constructLayer(layer, writer);
+        }
     };
 };
 
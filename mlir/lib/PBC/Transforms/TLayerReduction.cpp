@@ -16,6 +16,10 @@
 
 #include <vector>
 
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SetVector.h"
+
 #include "mlir/IR/IRMapping.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/Pass/Pass.h"
@@ -23,7 +27,7 @@
 #include "PBC/IR/PBCOps.h"
 #include "PBC/Utils/PBCLayer.h"
 #include "PBC/Utils/PBCOpUtils.h"
-#include "PBC/Utils/PauliStringWrapper.h"
+#include "PBC/Utils/PackedPauliString.h"
 
 using namespace mlir;
 using namespace catalyst::pbc;
@@ -38,42 +42,193 @@ namespace pbc {
 #define GEN_PASS_DEF_TLAYERREDUCTIONPASS
 #include "PBC/Transforms/Passes.h.inc"
 
+// Number the qubit wires of the program: qubit values connected through the in- and out-qubits of
+// PBC ops are on the same wire, and any other qubit value starts a new wire.
+class QubitWires {
+  private:
+    llvm::DenseMap<Value, unsigned> wires;
+    unsigned numWires = 0;
+
+  public:
+    unsigned getWire(Value qubit)
+    {
+        SmallVector<Value> chain;
+        auto it = wires.find(qubit);
+        while (it == wires.end()) {
+            chain.push_back(qubit);
+            auto pbcOp = qubit.getDefiningOp<PBCOpInterface>();
+            if (!pbcOp) {
+                it = wires.try_emplace(qubit, numWires++).first;
+                break;
+            }
+            auto outQubits = pbcOp.getOutQubits();
+            auto pos = std::distance(outQubits.begin(), llvm::find(outQubits, qubit));
+            qubit = pbcOp.getInQubits()[pos];
+            it = wires.find(qubit);
+        }
+
+        unsigned wire = it->second;
+        for (Value value : chain) {
+            wires[value] = wire;
+        }
+        return wire;
+    }
+
+    // Drop the results of an op that is about to be erased, so that their storage can be reused.
+    void forget(Operation *op)
+    {
+        for (Value result : op->getResults()) {
+            wires.erase(result);
+        }
+    }
+};
+
+// A layer whose ops are indexed by the wires on which their Pauli words act non-trivially, so that
+// the ops that may not commute with, or be equal to, another op are found without scanning the
+// whole layer.
+class IndexedLayer {
+  private:
+    PBCLayer layer;
+
+    llvm::DenseMap<unsigned, SmallVector<Operation *>> wireOps;
+    llvm::DenseMap<Operation *, SmallVector<unsigned>> opWires;
+
+    // Ops with an identity Pauli word, which are only equal to other identity words
+    SmallVector<Operation *> identityOps;
+
+    // Position of the ops in the layer, to report merge candidates in layer order
+    llvm::DenseMap<Operation *, unsigned> opOrder;
+    unsigned nextOrder = 0;
+
+  public:
+    IndexedLayer(PBCLayerContext *ctx) : layer(ctx) {}
+
+    bool empty() const { return layer.empty(); }
+    const std::vector<PBCOpInterface> &getOps() const { return layer.getOps(); }
+    PBCLayerContext *getContext() const { return layer.getContext(); }
+    PBCOpInterface getFirstOp() const { return layer.getFirstOp(); }
+
+    // Wires on which the Pauli word of `op` is not the identity
+    static SmallVector<unsigned> getSupportWires(PBCOpInterface op, QubitWires &wires,
+                                                 PauliProductCache &cache)
+    {
+        SmallVector<unsigned> support;
+        for (auto [qubit, code] :
+             llvm::zip(op.getInQubits(), cache.getCodes(op.getPauliProduct()))) {
+            if (code != 0) {
+                support.push_back(wires.getWire(qubit));
+            }
+        }
+        return support;
+    }
+
+    void insertToLayer(PBCOpInterface op, QubitWires &wires)
+    {
+        layer.insertToLayer(op);
+
+        auto support = getSupportWires(op, wires, getContext()->pauliProductCache);
+        for (unsigned wire : support) {
+            wireOps[wire].push_back(op);
+        }
+        if (support.empty()) {
+            identityOps.push_back(op);
+        }
+        opWires[op] = std::move(support);
+        opOrder[op] = nextOrder++;
+    }
+
+    void eraseOp(PBCOpInterface op)
+    {
+        layer.eraseOp(op);
+
+        auto it = opWires.find(op);
+        assert(it != opWires.end() && "op should be in the layer");
+        for (unsigned wire : it->second) {
+            llvm::erase(wireOps[wire], op.getOperation());
+        }
+        if (it->second.empty()) {
+            llvm::erase(identityOps, op.getOperation());
+        }
+        opWires.erase(it);
+        opOrder.erase(op);
+    }
+
+    // Ops of the layer that act non-trivially on one of the wires of `op`, or that have an
+    // identity Pauli word, in layer order. All other ops of the layer trivially commute with `op`
+    // and differ from it.
+    SmallVector<PBCOpInterface> getCandidates(PBCOpInterface op, QubitWires &wires)
+    {
+        llvm::SmallSetVector<Operation *, 8> candidates;
+        for (unsigned wire : getSupportWires(op, wires, getContext()->pauliProductCache)) {
+            auto it = wireOps.find(wire);
+            if (it != wireOps.end()) {
+                candidates.insert(it->second.begin(), it->second.end());
+            }
+        }
+        candidates.insert(identityOps.begin(), identityOps.end());
+
+        SmallVector<PBCOpInterface> ordered;
+        for (Operation *candidate : candidates) {
+            ordered.push_back(cast<PBCOpInterface>(candidate));
+        }
+        llvm::sort(ordered, [&](PBCOpInterface lhs, PBCOpInterface rhs) {
+            return opOrder.lookup(lhs) < opOrder.lookup(rhs);
+        });
+        return ordered;
+    }
+};
+
 // Check whether `rhsOp` can commute left across every op in `lhsLayer` (same block),
 // and, if so, identify a merge `mergeOp` candidate in `lhsLayer`.
 // This `mergeOp` later on, will be used in `mergePPR` function.
 std::pair<bool, PBCOpInterface> checkCommutationAndFindMerge(PBCOpInterface rhsOp,
-                                                             PBCLayer &lhsLayer)
+                                                             IndexedLayer &lhsLayer,
+                                                             QubitWires &wires)
 {
-    PBCOpInterface mergeOp = nullptr;
-    for (auto lhsOp : lhsLayer.getOps()) {
-        if (lhsOp->getBlock() != rhsOp->getBlock()) {
-            return std::pair(false, nullptr);
-        }
+    if (lhsLayer.empty()) {
+        return std::pair(true, nullptr);
+    }
+
+    // All ops of a layer are in the same block.
+    PBCOpInterface firstOp = lhsLayer.getFirstOp();
+    if (firstOp->getBlock() != rhsOp->getBlock()) {
+        return std::pair(false, nullptr);
+    }
 
+    // An intervening non-PPR between any op of the layer and `rhsOp` is also between the first op
+    // of the layer and `rhsOp`, so the reaching values only need to exist at the first op.
+    // TODO: Handle non-PPR not directly dominated by `lhsOp`.
+    std::vector<Value> rhsOpInQubitsFromFirstOp = getInQubitReachingValuesAt(rhsOp, firstOp);
+    if (llvm::any_of(rhsOpInQubitsFromFirstOp, [](Value qubit) { return qubit == nullptr; })) {
+        return std::pair(false, nullptr);
+    }
+
+    // Ops that act on none of the wires of `rhsOp` commute with it and cannot be merged with it.
+    PBCOpInterface mergeOp = nullptr;
+    for (auto lhsOp : lhsLayer.getCandidates(rhsOp, wires)) {
         assert(lhsOp != rhsOp && "lshOp and rhsOp should not be equal");
         assert(lhsOp->isBeforeInBlock(rhsOp) && "lhsOp should be before rhsOp");
 
         // Reaching in-qubit values of `rhsOp` at the program point of `lhsOp`.
         std::vector<Value> rhsOpInQubitsFromLhsOp = getInQubitReachingValuesAt(rhsOp, lhsOp);
         if (llvm::any_of(rhsOpInQubitsFromLhsOp, [](Value qubit) { return qubit == nullptr; })) {
-            // Missing reaching value (intervening non-PPR); commutation fails.
-            // TODO: Handle non-PPR not directly dominated by `lhsOp`.
             return std::pair(false, nullptr);
         }
 
         // Normalize to Pauli strings
-        auto normalizedOps =
-            normalizePPROps(lhsOp, rhsOp, lhsOp.getInQubits(), rhsOpInQubitsFromLhsOp);
+        auto [lhsPauli, rhsPauli] =
+            packPPROps(lhsOp, rhsOp, lhsOp.getInQubits(), rhsOpInQubitsFromLhsOp,
+                       lhsLayer.getContext()->pauliProductCache);
 
         // TODO: Handle PPRotationArbitraryOp properly
 
-        if (!normalizedOps.first.commutes(normalizedOps.second)) {
+        if (!lhsPauli.commutes(rhsPauli)) {
             return std::pair(false, nullptr);
         }
 
         // Equal normalized Pauli strings => merge candidate
         // TODO: include cancellation of opposite sign rotations
-        auto canMerge = normalizedOps.first == normalizedOps.second;
+        auto canMerge = lhsPauli == rhsPauli;
         if (canMerge) {
             mergeOp = lhsOp;
         }
@@ -82,8 +237,8 @@ std::pair<bool, PBCOpInterface> checkCommutationAndFindMerge(PBCOpInterface rhsO
     return std::pair(true, mergeOp);
 }
 
-void moveOpToLayer(PBCOpInterface rhsOp, PBCLayer &rhsLayer, PBCOpInterface mergeOp,
-                   PBCLayer &lhsLayer, IRRewriter &writer)
+void moveOpToLayer(PBCOpInterface rhsOp, IndexedLayer &rhsLayer, PBCOpInterface mergeOp,
+                   IndexedLayer &lhsLayer, QubitWires &wires, IRRewriter &writer)
 {
     //    lhsLayer   :  rhsLayer
     //    ┌───────┐  :  ┌───────┐
@@ -125,9 +280,10 @@ void moveOpToLayer(PBCOpInterface rhsOp, PBCLayer &rhsLayer, PBCOpInterface merg
 
     writer.setInsertionPointAfter(lhsOp);
     writer.insert(newOp);
-    lhsLayer.insertToLayer(newOp);
+    lhsLayer.insertToLayer(newOp, wires);
 
     rhsLayer.eraseOp(rhsOp);
+    wires.forget(rhsOp);
     // Rewire users of the erased `rhsOp` to its original operands.
     writer.replaceOp(rhsOp, rhsOp->getOperands());
 }
@@ -135,13 +291,15 @@ void moveOpToLayer(PBCOpInterface rhsOp, PBCLayer &rhsLayer, PBCOpInterface merg
 // Merge `rhsOp` into `mergeOp` in lhsLayer when equal under normalization.
 // To merge this we keep and update the rotation kind of `mergeOp` in lhsLayer,
 // then just remove the `rhsOp` from the rhsLayer.
-void mergePPR(PPRotationOp rhsOp, PBCLayer &rhsLayer, PPRotationOp mergeOp, IRRewriter &writer)
+void mergePPR(PPRotationOp rhsOp, IndexedLayer &rhsLayer, PPRotationOp mergeOp,
+              QubitWires &wires, IRRewriter &writer)
 {
     assert(rhsOp.getRotationKind() == mergeOp.getRotationKind() && "expected same rotation kind");
 
     mergeOp.setRotationKind(mergeOp.getRotationKind() / 2);
 
     rhsLayer.eraseOp(rhsOp);
+    wires.forget(rhsOp);
     writer.replaceOp(rhsOp, rhsOp->getOperands());
 }
 
@@ -153,9 +311,10 @@ struct TLayerReductionPass : impl::TLayerReductionPassBase<TLayerReductionPass>
         MLIRContext *context = &getContext();
         IRRewriter writer(context);
         PBCLayerContext layerContext;
-        PBCLayer currentLayer(&layerContext);
+        QubitWires wires;
+        IndexedLayer currentLayer(&layerContext);
 
-        std::vector<PBCLayer> layers;
+        std::vector<IndexedLayer> layers;
 
         // 1) Build initial layers:
         // - try to commute non-Clifford PPR into current layer;
@@ -165,17 +324,17 @@ struct TLayerReductionPass : impl::TLayerReductionPassBase<TLayerReductionPass>
                 return WalkResult::skip();
             }
 
-            auto [isCommute, _] = checkCommutationAndFindMerge(op, currentLayer);
+            auto [isCommute, _] = checkCommutationAndFindMerge(op, currentLayer, wires);
             if (isCommute) {
-                currentLayer.insertToLayer(op);
+                currentLayer.insertToLayer(op, wires);
                 return WalkResult::skip();
             }
 
             layers.emplace_back(std::move(currentLayer));
 
             // Start a new layer and insert the op
-            currentLayer = PBCLayer(&layerContext);
-            currentLayer.insertToLayer(op);
+            currentLayer = IndexedLayer(&layerContext);
+            currentLayer.insertToLayer(op, wires);
 
             return WalkResult::advance();
         });
@@ -192,15 +351,15 @@ struct TLayerReductionPass : impl::TLayerReductionPassBase<TLayerReductionPass>
                 auto &prevLayer = layers[idx - 1];
 
                 for (PBCOpInterface op : currentLayer.getOps()) {
-                    auto [isCommute, mergeOp] = checkCommutationAndFindMerge(op, prevLayer);
+                    auto [isCommute, mergeOp] = checkCommutationAndFindMerge(op, prevLayer, wires);
 
                     if (isCommute && mergeOp) {
                         mergePPR(cast<PPRotationOp>(op), currentLayer, cast<PPRotationOp>(mergeOp),
-                                 writer);
+                                 wires, writer);
                         changed = true;
                     }
                     else if (isCommute) {
-                        moveOpToLayer(op, currentLayer, mergeOp, prevLayer, writer);
+                        moveOpToLayer(op, currentLayer, mergeOp, prevLayer, wires, writer);
                         changed = true;
                     }
                 }
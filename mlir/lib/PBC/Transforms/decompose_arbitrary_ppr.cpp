@@ -38,6 +38,11 @@ struct DecomposeArbitraryPPRPass : impl::DecomposeArbitraryPPRPassBase<Decompose
         auto ctx = &getContext();
         auto module = getOperation();
 
+        if (batch) {
+            decomposeArbitraryPPRBatch(module);
+            return;
+        }
+
         RewritePatternSet patterns(ctx);
         populateDecomposeArbitraryPPRPatterns(patterns);
 
@@ -39,6 +39,11 @@ struct DecomposeNonCliffordPPRPass
 
     void runOnOperation() final
     {
+        if (batch) {
+            decomposeNonCliffordPPRBatch(getOperation(), decomposeMethod, avoidYMeasure);
+            return;
+        }
+
         RewritePatternSet patterns(&getContext());
 
         populateDecomposeNonCliffordPPRPatterns(patterns, decomposeMethod, avoidYMeasure);
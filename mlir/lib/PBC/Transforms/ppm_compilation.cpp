@@ -21,6 +21,7 @@
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 
 #include "PBC/IR/PBCDialect.h"
+#include "PBC/IR/PBCOpInterfaces.h"
 #include "PBC/Transforms/Patterns.h"
 #include "Quantum/IR/QuantumOps.h"
 
@@ -36,6 +37,27 @@ namespace pbc {
 #define GEN_PASS_DEF_PPMCOMPILATIONPASS
 #include "PBC/Transforms/Passes.h.inc"
 
+// Collect the PBC ops in program order, to seed the worklist of a rewrite sweep.
+static SmallVector<Operation *> collectPBCOps(Operation *root)
+{
+    SmallVector<Operation *> ops;
+    root->walk([&](PBCOpInterface op) { ops.push_back(op); });
+    return ops;
+}
+
+// Apply `patterns` to the PBC ops and the ops created from them, top-down from a single worklist.
+// Unlike the greedy driver applied to the whole module, the ops are not rescanned once the
+// worklist is empty, and regions are not simplified.
+static LogicalResult applySweepPatterns(Operation *root, RewritePatternSet &&patterns)
+{
+    GreedyRewriteConfig config;
+    config.setStrictness(GreedyRewriteStrictness::ExistingAndNewOps);
+    config.setRegionSimplificationLevel(GreedySimplifyRegionLevel::Disabled);
+    config.setUseTopDownTraversal(true);
+
+    return applyOpPatternsGreedily(collectPBCOps(root), std::move(patterns), config);
+}
+
 struct PPMCompilationPass : public impl::PPMCompilationPassBase<PPMCompilationPass> {
     using PPMCompilationPassBase::PPMCompilationPassBase;
 
@@ -65,6 +87,30 @@ struct PPMCompilationPass : public impl::PPMCompilationPassBase<PPMCompilationPa
             }
         }
 
+        if (singleSweep) {
+            // Phase 2: Move the Clifford PPRs forward past the non-Clifford PPRs and into the
+            // measurements as they are reached
+            RewritePatternSet commutePatterns(ctx);
+            populateCommutePPRPatterns(commutePatterns, maxPauliSize);
+            populateMergePPRIntoPPMPatterns(commutePatterns, maxPauliSize);
+
+            if (failed(applySweepPatterns(module, std::move(commutePatterns)))) {
+                return signalPassFailure();
+            }
+
+            // Phase 3: Decompose the non-Clifford PPRs, then the remaining Clifford PPRs together
+            // with the Clifford corrections that the non-Clifford decompositions introduce
+            RewritePatternSet decomposePatterns(ctx);
+            populateDecomposeNonCliffordPPRPatterns(decomposePatterns, decomposeMethod,
+                                                    avoidYMeasure);
+            populateDecomposeCliffordPPRPatterns(decomposePatterns, avoidYMeasure);
+
+            if (failed(applySweepPatterns(module, std::move(decomposePatterns)))) {
+                return signalPassFailure();
+            }
+            return;
+        }
+
         // Phase 2: Commute Clifford gates past T gates using PPR representation
         {
             RewritePatternSet patterns(ctx);
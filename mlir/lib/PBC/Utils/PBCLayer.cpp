@@ -15,9 +15,10 @@
 #include "PBC/Utils/PBCLayer.h"
 
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SetVector.h"
 
 #include "PBC/IR/PBCOps.h"
-#include "PBC/Utils/PauliStringWrapper.h"
+#include "PBC/Utils/PackedPauliString.h"
 #include "Quantum/IR/QuantumOps.h" // for quantum.extract op
 
 using namespace catalyst::pbc;
@@ -25,6 +26,17 @@ using namespace catalyst::pbc;
 namespace catalyst {
 namespace pbc {
 
+// Erase `op` from `ops`, in constant time when it is the last one, as when a layer is emptied in
+// reverse order.
+template <typename Container, typename OpTy> static void eraseFromOps(Container &ops, OpTy op)
+{
+    if (!ops.empty() && ops.back() == op) {
+        ops.pop_back();
+        return;
+    }
+    llvm::erase(ops, op);
+}
+
 void PBCLayer::insertToLayer(PBCOpInterface op)
 {
     ops.emplace_back(op);
@@ -33,9 +45,55 @@ void PBCLayer::insertToLayer(PBCOpInterface op)
     // Update the cached entry qubit set when inserting
     auto entryQubits = getEntryQubitsFrom(op);
     layerEntryQubits.insert(entryQubits.begin(), entryQubits.end());
+    for (Value entry : entryQubits) {
+        entryQubitOps[entry].push_back(op);
+    }
+    opEntryQubits[op] = std::move(entryQubits);
+
+    if (!boundsStale) {
+        if (!firstOp || op->isBeforeInBlock(firstOp)) {
+            firstOp = op;
+        }
+        if (!lastOp || lastOp->isBeforeInBlock(op)) {
+            lastOp = op;
+        }
+    }
 }
 
-void PBCLayer::eraseOp(PBCOpInterface op) { llvm::erase(ops, op); }
+void PBCLayer::eraseOp(PBCOpInterface op)
+{
+    eraseFromOps(ops, op);
+
+    if (auto it = opEntryQubits.find(op); it != opEntryQubits.end()) {
+        for (Value entry : it->second) {
+            eraseFromOps(entryQubitOps[entry], op.getOperation());
+        }
+        opEntryQubits.erase(it);
+    }
+
+    if (op == firstOp || op == lastOp) {
+        boundsStale = true;
+    }
+}
+
+void PBCLayer::updateBounds() const
+{
+    if (!boundsStale) {
+        return;
+    }
+
+    firstOp = nullptr;
+    lastOp = nullptr;
+    for (auto op : ops) {
+        if (!firstOp || op->isBeforeInBlock(firstOp)) {
+            firstOp = op;
+        }
+        if (!lastOp || lastOp->isBeforeInBlock(op)) {
+            lastOp = op;
+        }
+    }
+    boundsStale = false;
+}
 
 void PBCLayer::updateResultAndOperand(PBCOpInterface op)
 {
@@ -128,15 +186,25 @@ bool PBCLayer::commute(PBCOpInterface src, PBCOpInterface dst)
     auto srcEntryQubits = getEntryQubitsFrom(src);
     auto dstEntryQubits = getEntryQubitsFrom(dst);
 
-    auto normalizedOps = normalizePPROps(src, dst, srcEntryQubits, dstEntryQubits);
+    auto [srcPauli, dstPauli] =
+        packPPROps(src, dst, srcEntryQubits, dstEntryQubits, context->pauliProductCache);
 
-    return normalizedOps.first.commutes(normalizedOps.second);
+    return srcPauli.commutes(dstPauli);
 }
 
-// Commute an op to all the ops in the layer
+// Commute an op to all the ops in the layer. Only the ops sharing an entry qubit with it are
+// checked, the others act on disjoint qubits and trivially commute.
 bool PBCLayer::commuteToLayer(PBCOpInterface op)
 {
-    return llvm::all_of(ops, [&](auto existingOp) { return commute(op, existingOp); });
+    llvm::SmallSetVector<mlir::Operation *, 8> candidates;
+    for (Value entry : getEntryQubitsFrom(op)) {
+        if (auto it = entryQubitOps.find(entry); it != entryQubitOps.end()) {
+            candidates.insert(it->second.begin(), it->second.end());
+        }
+    }
+    return llvm::all_of(candidates, [&](mlir::Operation *existingOp) {
+        return commute(op, llvm::cast<PBCOpInterface>(existingOp));
+    });
 }
 
 bool PBCLayer::isSameBlock(PBCOpInterface op) const
@@ -146,35 +214,43 @@ bool PBCLayer::isSameBlock(PBCOpInterface op) const
     return op->getBlock() == ops.back()->getBlock();
 }
 
-// Check if the op has extract op that must be occurred before the operations in layers
+// Check if the op has extract op that must be occurred before the operations in layers.
+// The ops of a layer share a block, so it is enough to compare with the earliest one.
 bool PBCLayer::extractsAreBeforeExistingOps(PBCOpInterface op) const
 {
-    for (auto existingOp : ops) {
-        for (auto operand : op->getOperands()) {
-            auto defOp = operand.getDefiningOp();
-            // Only meaningful to compare within the same block
-            if (auto extractOp = llvm::dyn_cast_or_null<quantum::ExtractOp>(defOp)) {
-                if (extractOp->getBlock() == existingOp->getBlock() &&
-                    !extractOp->isBeforeInBlock(existingOp)) {
-                    return false;
-                }
+    if (ops.empty()) {
+        return true;
+    }
+
+    auto existingOp = getFirstOp();
+    for (auto operand : op->getOperands()) {
+        auto defOp = operand.getDefiningOp();
+        // Only meaningful to compare within the same block
+        if (auto extractOp = llvm::dyn_cast_or_null<quantum::ExtractOp>(defOp)) {
+            if (extractOp->getBlock() == existingOp->getBlock() &&
+                !extractOp->isBeforeInBlock(existingOp)) {
+                return false;
             }
         }
     }
     return true;
 }
 
-// Ensure the new op does not have insert op before existing ops
+// Ensure the new op does not have insert op before existing ops, i.e. before the latest one
 bool PBCLayer::insertsAreAfterExistingOps(PBCOpInterface op) const
 {
-    for (auto existingOp : ops) {
-        for (auto result : op->getResults()) {
-            for (auto user : result.getUsers()) {
-                if (auto insertOp = llvm::dyn_cast<quantum::InsertOp>(user)) {
-                    if (insertOp->getBlock() == existingOp->getBlock() &&
-                        insertOp->isBeforeInBlock(existingOp)) {
-                        return false;
-                    }
+    if (ops.empty()) {
+        return true;
+    }
+
+    updateBounds();
+    auto existingOp = lastOp;
+    for (auto result : op->getResults()) {
+        for (auto user : result.getUsers()) {
+            if (auto insertOp = llvm::dyn_cast<quantum::InsertOp>(user)) {
+                if (insertOp->getBlock() == existingOp->getBlock() &&
+                    insertOp->isBeforeInBlock(existingOp)) {
+                    return false;
                 }
             }
         }
@@ -19,7 +19,7 @@
 #include "stablehlo/dialect/StablehloOps.h"
 
 #include "PBC/IR/PBCOpInterfaces.h"
-#include "PBC/Utils/PauliStringWrapper.h"
+#include "PBC/Utils/PackedPauliString.h"
 
 namespace catalyst {
 namespace pbc {
@@ -74,7 +74,7 @@ std::vector<mlir::Value> getInQubitReachingValuesAt(PBCOpInterface srcOp, PBCOpI
     return dominanceQubits;
 }
 
-bool commutes(PBCOpInterface rhsOp, PBCOpInterface lhsOp)
+bool commutes(PBCOpInterface rhsOp, PBCOpInterface lhsOp, PauliProductCache &cache)
 {
     if (lhsOp->getBlock() != rhsOp->getBlock()) {
         return false;
@@ -92,10 +92,11 @@ bool commutes(PBCOpInterface rhsOp, PBCOpInterface lhsOp)
     }
 
     // Normalize the ops to the same Pauli string.
-    auto normalizedOps = normalizePPROps(lhsOp, rhsOp, lhsOp.getInQubits(), rhsOpInQubitsFromLhs);
+    auto [lhsPauli, rhsPauli] =
+        packPPROps(lhsOp, rhsOp, lhsOp.getInQubits(), rhsOpInQubitsFromLhs, cache);
 
     // If the normalized ops do not commute, the original ops do not commute.
-    if (!normalizedOps.first.commutes(normalizedOps.second)) {
+    if (!lhsPauli.commutes(rhsPauli)) {
         return false;
     }
 
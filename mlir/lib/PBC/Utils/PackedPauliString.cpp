@@ -0,0 +1,117 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PBC/Utils/PackedPauliString.h"
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/ADT/bit.h"
+
+#include "PBC/IR/PBCOps.h"
+
+using namespace mlir;
+
+namespace catalyst {
+namespace pbc {
+
+constexpr size_t wordBits = 64;
+
+PackedPauliString::PackedPauliString(size_t numQubits)
+    : numQubits(numQubits), xBits((numQubits + wordBits - 1) / wordBits, 0),
+      zBits((numQubits + wordBits - 1) / wordBits, 0)
+{
+}
+
+void PackedPauliString::setPauli(size_t qubit, uint8_t code)
+{
+    const uint64_t mask = uint64_t{1} << (qubit % wordBits);
+    if (code & 1) {
+        xBits[qubit / wordBits] |= mask;
+    }
+    if (code & 2) {
+        zBits[qubit / wordBits] |= mask;
+    }
+}
+
+bool PackedPauliString::commutes(const PackedPauliString &other) const
+{
+    assert(xBits.size() == other.xBits.size() && "Pauli strings should have the same size");
+
+    unsigned parity = 0;
+    for (size_t i = 0; i < xBits.size(); i++) {
+        uint64_t anticommuting = (xBits[i] & other.zBits[i]) ^ (zBits[i] & other.xBits[i]);
+        parity ^= llvm::popcount(anticommuting);
+    }
+    return (parity & 1) == 0;
+}
+
+bool PackedPauliString::operator==(const PackedPauliString &rhs) const
+{
+    return negative == rhs.negative && xBits == rhs.xBits && zBits == rhs.zBits;
+}
+
+ArrayRef<uint8_t> PauliProductCache::getCodes(ArrayAttr pauliProduct)
+{
+    auto [it, inserted] = codes.try_emplace(pauliProduct);
+    if (inserted) {
+        it->second.reserve(pauliProduct.size());
+        for (Attribute pauli : pauliProduct) {
+            StringRef pauliStr = cast<StringAttr>(pauli).getValue();
+            uint8_t code = llvm::StringSwitch<uint8_t>(pauliStr)
+                               .Case("X", 1)
+                               .Case("Z", 2)
+                               .Case("Y", 3)
+                               .Default(0);
+            it->second.push_back(code);
+        }
+    }
+    return it->second;
+}
+
+static bool getSign(PBCOpInterface op)
+{
+    Operation *operation = op.getOperation();
+    if (auto pprOp = dyn_cast<PPRotationOp>(operation)) {
+        return pprOp.getRotationKind() < 0;
+    }
+    if (auto ppmOp = dyn_cast<PPMeasurementOp>(operation)) {
+        return ppmOp.getNegated();
+    }
+    return false;
+}
+
+PackedPauliPair packPPROps(PBCOpInterface lhs, PBCOpInterface rhs, ValueRange lhsQubits,
+                           ValueRange rhsQubits, PauliProductCache &cache)
+{
+    llvm::SmallDenseMap<Value, size_t, 8> denseIndices;
+    for (ValueRange qubits : {lhsQubits, rhsQubits}) {
+        for (Value qubit : qubits) {
+            denseIndices.try_emplace(qubit, denseIndices.size());
+        }
+    }
+
+    auto pack = [&](PBCOpInterface op, ValueRange opQubits) {
+        PackedPauliString packed(denseIndices.size());
+        for (auto [qubit, code] : llvm::zip(opQubits, cache.getCodes(op.getPauliProduct()))) {
+            packed.setPauli(denseIndices.lookup(qubit), code);
+        }
+        packed.setNegative(getSign(op));
+        return packed;
+    };
+
+    return {pack(lhs, lhsQubits), pack(rhs, rhsQubits)};
+}
+
+} // namespace pbc
+} // namespace catalyst
@@ -0,0 +1,225 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Transforms/DialectConversion.h"
+
+#include "Catalyst/Utils/EnsureFunctionDeclaration.h"
+#include "PauliFrame/IR/PauliFrameOps.h"
+#include "PauliFrame/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace {
+
+using namespace catalyst::pauli_frame;
+using namespace catalyst::quantum;
+
+// The Pauli frame is tracked by the runtime, see the `__catalyst__pf__*` functions of the runtime
+// C API. Records are returned as a byte with the X-parity bit in bit 0 and the Z-parity bit in
+// bit 1.
+
+LLVM::LLVMFuncOp getRuntimeFunction(ConversionPatternRewriter &rewriter, Operation *op,
+                                    StringRef fnName, Type resultTy, ArrayRef<Type> argTys)
+{
+    Type fnSignature = LLVM::LLVMFunctionType::get(resultTy, argTys);
+    return catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(rewriter, op, fnName,
+                                                                 fnSignature);
+}
+
+// Split an encoded Pauli record into its X- and Z-parity bits.
+std::pair<Value, Value> decodePauliRecord(ConversionPatternRewriter &rewriter, Location loc,
+                                          Value record)
+{
+    Type i1 = rewriter.getI1Type();
+    Value one = LLVM::ConstantOp::create(rewriter, loc, rewriter.getI8IntegerAttr(1));
+    Value xParity = LLVM::TruncOp::create(rewriter, loc, i1, record);
+    Value zParity = LLVM::TruncOp::create(rewriter, loc, i1,
+                                          LLVM::LShrOp::create(rewriter, loc, record, one));
+    return {xParity, zParity};
+}
+
+struct InitOpPattern : public OpConversionPattern<InitOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(InitOp op, InitOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        MLIRContext *ctx = getContext();
+        Type qubitTy = getTypeConverter()->convertType(QubitType::get(ctx));
+        LLVM::LLVMFuncOp fnDecl = getRuntimeFunction(rewriter, op, "__catalyst__pf__init",
+                                                     LLVM::LLVMVoidType::get(ctx), {qubitTy});
+
+        for (Value qubit : adaptor.getInQubits()) {
+            LLVM::CallOp::create(rewriter, op.getLoc(), fnDecl, qubit);
+        }
+        rewriter.replaceOp(op, adaptor.getInQubits());
+        return success();
+    }
+};
+
+struct InitQregOpPattern : public OpConversionPattern<InitQregOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(InitQregOp op, InitQregOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        MLIRContext *ctx = getContext();
+        Type qregTy = getTypeConverter()->convertType(QuregType::get(ctx));
+        LLVM::LLVMFuncOp fnDecl = getRuntimeFunction(rewriter, op, "__catalyst__pf__init_qreg",
+                                                     LLVM::LLVMVoidType::get(ctx), {qregTy});
+
+        LLVM::CallOp::create(rewriter, op.getLoc(), fnDecl, adaptor.getInQreg());
+        rewriter.replaceOp(op, adaptor.getInQreg());
+        return success();
+    }
+};
+
+// Lowers `pauli_frame.set` and `pauli_frame.update`, which apply the same Pauli record to each of
+// their qubits.
+template <typename OpTy> struct PauliRecordOpPattern : public OpConversionPattern<OpTy> {
+    using OpConversionPattern<OpTy>::OpConversionPattern;
+    using OpAdaptor = typename OpConversionPattern<OpTy>::OpAdaptor;
+
+    StringRef fnName;
+
+    PauliRecordOpPattern(const TypeConverter &typeConverter, MLIRContext *ctx, StringRef fnName)
+        : OpConversionPattern<OpTy>(typeConverter, ctx), fnName(fnName)
+    {
+    }
+
+    LogicalResult matchAndRewrite(OpTy op, OpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        MLIRContext *ctx = this->getContext();
+        Type qubitTy = this->getTypeConverter()->convertType(QubitType::get(ctx));
+        Type i1 = rewriter.getI1Type();
+        LLVM::LLVMFuncOp fnDecl = getRuntimeFunction(
+            rewriter, op, fnName, LLVM::LLVMVoidType::get(ctx), {qubitTy, i1, i1});
+
+        Value xParity = LLVM::ConstantOp::create(rewriter, loc, i1, op.getXParity());
+        Value zParity = LLVM::ConstantOp::create(rewriter, loc, i1, op.getZParity());
+        for (Value qubit : adaptor.getInQubits()) {
+            LLVM::CallOp::create(rewriter, loc, fnDecl, ValueRange{qubit, xParity, zParity});
+        }
+        rewriter.replaceOp(op, adaptor.getInQubits());
+        return success();
+    }
+};
+
+struct UpdateWithCliffordOpPattern : public OpConversionPattern<UpdateWithCliffordOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(UpdateWithCliffordOp op, UpdateWithCliffordOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        MLIRContext *ctx = getContext();
+        Type qubitTy = getTypeConverter()->convertType(QubitType::get(ctx));
+        Type gateTy = IntegerType::get(ctx, 32);
+        Type numQubitsTy = IntegerType::get(ctx, 64);
+        LLVM::LLVMFuncOp fnDecl = getRuntimeFunction(
+            rewriter, op, "__catalyst__pf__update_with_clifford", LLVM::LLVMVoidType::get(ctx),
+            {gateTy, numQubitsTy, qubitTy, qubitTy});
+
+        const auto gateValueInt = static_cast<uint32_t>(op.getCliffordGate());
+        Value gate =
+            LLVM::ConstantOp::create(rewriter, loc, rewriter.getI32IntegerAttr(gateValueInt));
+
+        // The second qubit is null for single-qubit gates. Since a null qubit is also the qubit of
+        // ID 0, the runtime relies on the number of qubits instead.
+        ValueRange qubits = adaptor.getInQubits();
+        Value numQubits = LLVM::ConstantOp::create(
+            rewriter, loc, rewriter.getI64IntegerAttr(static_cast<int64_t>(qubits.size())));
+        Value other = qubits.size() > 1 ? qubits[1]
+                                        : LLVM::ZeroOp::create(rewriter, loc, qubitTy).getResult();
+
+        LLVM::CallOp::create(rewriter, loc, fnDecl, ValueRange{gate, numQubits, qubits[0], other});
+        rewriter.replaceOp(op, qubits);
+        return success();
+    }
+};
+
+// Lowers `pauli_frame.read` and `pauli_frame.flush`, which return the Pauli record of their qubit.
+template <typename OpTy> struct GetPauliRecordOpPattern : public OpConversionPattern<OpTy> {
+    using OpConversionPattern<OpTy>::OpConversionPattern;
+    using OpAdaptor = typename OpConversionPattern<OpTy>::OpAdaptor;
+
+    StringRef fnName;
+
+    GetPauliRecordOpPattern(const TypeConverter &typeConverter, MLIRContext *ctx, StringRef fnName)
+        : OpConversionPattern<OpTy>(typeConverter, ctx), fnName(fnName)
+    {
+    }
+
+    LogicalResult matchAndRewrite(OpTy op, OpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        MLIRContext *ctx = this->getContext();
+        Type qubitTy = this->getTypeConverter()->convertType(QubitType::get(ctx));
+        LLVM::LLVMFuncOp fnDecl =
+            getRuntimeFunction(rewriter, op, fnName, IntegerType::get(ctx, 8), {qubitTy});
+
+        Value record =
+            LLVM::CallOp::create(rewriter, loc, fnDecl, adaptor.getInQubit()).getResult();
+        auto [xParity, zParity] = decodePauliRecord(rewriter, loc, record);
+        rewriter.replaceOp(op, {xParity, zParity, adaptor.getInQubit()});
+        return success();
+    }
+};
+
+struct CorrectMeasurementOpPattern : public OpConversionPattern<CorrectMeasurementOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(CorrectMeasurementOp op, CorrectMeasurementOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        MLIRContext *ctx = getContext();
+        Type qubitTy = getTypeConverter()->convertType(QubitType::get(ctx));
+        Type i1 = rewriter.getI1Type();
+        LLVM::LLVMFuncOp fnDecl = getRuntimeFunction(
+            rewriter, op, "__catalyst__pf__correct_measurement", i1, {i1, qubitTy});
+
+        Value mres = LLVM::CallOp::create(rewriter, op.getLoc(), fnDecl,
+                                          ValueRange{adaptor.getInMres(), adaptor.getInQubit()})
+                         .getResult();
+        rewriter.replaceOp(op, {mres, adaptor.getInQubit()});
+        return success();
+    }
+};
+
+} // namespace
+
+namespace catalyst {
+namespace pauli_frame {
+
+void populateConversionPatterns(LLVMTypeConverter &typeConverter, RewritePatternSet &patterns)
+{
+    MLIRContext *ctx = patterns.getContext();
+    patterns.add<InitOpPattern, InitQregOpPattern, UpdateWithCliffordOpPattern,
+                 CorrectMeasurementOpPattern>(typeConverter, ctx);
+    patterns.add<PauliRecordOpPattern<SetOp>>(typeConverter, ctx, "__catalyst__pf__set");
+    patterns.add<PauliRecordOpPattern<UpdateOp>>(typeConverter, ctx, "__catalyst__pf__update");
+    patterns.add<GetPauliRecordOpPattern<ReadOp>>(typeConverter, ctx, "__catalyst__pf__read");
+    patterns.add<GetPauliRecordOpPattern<FlushOp>>(typeConverter, ctx, "__catalyst__pf__flush");
+}
+
+} // namespace pauli_frame
+} // namespace catalyst
@@ -0,0 +1,66 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mlir/Conversion/LLVMCommon/ConversionTarget.h"
+#include "mlir/Conversion/LLVMCommon/TypeConverter.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Transforms/DialectConversion.h"
+
+#include "PauliFrame/IR/PauliFrameOps.h"
+#include "PauliFrame/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace catalyst {
+namespace pauli_frame {
+
+#define GEN_PASS_DEF_PAULIFRAMECONVERSIONPASS
+#include "PauliFrame/Transforms/Passes.h.inc"
+
+class PauliFrameTypeConverter : public LLVMTypeConverter {
+  public:
+    PauliFrameTypeConverter(MLIRContext *ctx) : LLVMTypeConverter(ctx)
+    {
+        addConversion([&](quantum::QubitType type) { return convertQubitType(type); });
+        addConversion([&](quantum::QuregType type) { return convertQuregType(type); });
+    }
+
+  private:
+    Type convertQubitType(Type mlirType) { return LLVM::LLVMPointerType::get(&getContext()); }
+    Type convertQuregType(Type mlirType) { return LLVM::LLVMPointerType::get(&getContext()); }
+};
+
+struct PauliFrameConversionPass : impl::PauliFrameConversionPassBase<PauliFrameConversionPass> {
+    using PauliFrameConversionPassBase::PauliFrameConversionPassBase;
+
+    void runOnOperation() final
+    {
+        MLIRContext *context = &getContext();
+        PauliFrameTypeConverter typeConverter(context);
+
+        RewritePatternSet patterns(context);
+        populateConversionPatterns(typeConverter, patterns);
+
+        LLVMConversionTarget target(*context);
+        target.addIllegalDialect<PauliFrameDialect>();
+
+        if (failed(applyPartialConversion(getOperation(), target, std::move(patterns)))) {
+            signalPassFailure();
+        }
+    }
+};
+
+} // namespace pauli_frame
+} // namespace catalyst
@@ -22,6 +22,7 @@
 #include <variant>
 #include <vector>
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SCCIterator.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallVector.h"
@@ -644,53 +645,46 @@ OpTy migrateOpToValueSemantics(IRRewriter &builder, Operation *qrefOp, QubitValu
     return cast<OpTy>(newOp);
 }
 
-void _getNecessaryRegionRValuesImpl(Region &r, SetVector<Value> &necessaryRegionRValues,
-                                    std::function<bool(Region &, Value)> isFromOutside)
+/**
+ * @brief Given a quantum operand of a qref operation, return the rValue that needs to be taken in
+ * for it: the rQreg of an rQubit `qref.get`-ed from a dynamic index, or the operand itself.
+ * Returns a null Value for non-quantum operands.
+ *
+ * @param v
+ * @return Value
+ */
+Value getNecessaryRValue(Value v)
 {
-    llvm::SmallDenseSet<Value, 8> rQregsTakenIn;
+    if (auto getOp = v.getDefiningOp<qref::GetOp>()) {
+        return getOp.getIdx() ? getRSourceRegisterValue(v) : v;
+    }
+    return isa<qref::QubitType, qref::QuregType>(v.getType()) ? v : Value();
+}
 
-    r.walk([&](Operation *op) {
-        if (!isa<qref::QRefDialect>(op->getDialect()) && !isa<func::CallOp>(op)) {
-            return;
-        }
-        if (isa<qref::GetOp>(op)) {
-            // qref.get is not a gate, do not count it as a user
-            // For example, if the rQubit result from a qref.get has no users, the get op is not
-            // actually needed by the region.
-            return;
-        }
-        for (Value v : op->getOperands()) {
-            if (isa<qref::QuregType>(v.getType())) {
-                // Ignore allocations from inside the region itself
-                if (isFromOutside(r, v)) {
-                    necessaryRegionRValues.insert(v);
-                    rQregsTakenIn.insert(v);
-                }
-            }
-            else if (isa<qref::QubitType>(v.getType())) {
-                if (auto getOp = v.getDefiningOp<qref::GetOp>()) {
-                    Value rQreg = getRSourceRegisterValue(v);
-                    if (isFromOutside(r, rQreg)) {
-                        if (getOp.getIdx()) {
-                            // dynamic extract index, must take in the reg
-                            necessaryRegionRValues.insert(rQreg);
-                            rQregsTakenIn.insert(rQreg);
-                        }
-                        else {
-                            necessaryRegionRValues.insert(v);
-                        }
-                    }
-                }
-                else {
-                    // Ignore allocations from inside the region itself
-                    if (isFromOutside(r, v)) {
-                        necessaryRegionRValues.insert(v);
-                    }
-                }
-            }
-        }
-    });
+/**
+ * @brief Return the Value whose definition decides whether a necessary rValue comes from outside a
+ * region: the rQreg of a `qref.get`-ed rQubit, or the rValue itself.
+ *
+ * @param rValue
+ * @return Value
+ */
+Value getRValueOrigin(Value rValue)
+{
+    return rValue.getDefiningOp<qref::GetOp>() ? getRSourceRegisterValue(rValue) : rValue;
+}
+
+bool usesNecessaryRValues(Operation *op)
+{
+    // qref.get is not a gate, do not count it as a user
+    // For example, if the rQubit result from a qref.get has no users, the get op is not
+    // actually needed by the region.
+    return (isa<qref::QRefDialect>(op->getDialect()) || isa<func::CallOp>(op)) &&
+           !isa<qref::GetOp>(op);
+}
 
+void removeRedundantRValues(SetVector<Value> &necessaryRegionRValues,
+                            const llvm::SmallDenseSet<Value, 8> &rQregsTakenIn)
+{
     // If any rQregs are taken in, any rQubits belonging to them must not be taken in separately
     necessaryRegionRValues.remove_if([&](const Value &v) {
         if (isa<BlockArgument>(v)) {
@@ -718,8 +712,34 @@ void _getNecessaryRegionRValuesImpl(Region &r, SetVector<Value> &necessaryRegion
     });
 }
 
+void _getNecessaryRegionRValuesImpl(Region &r, SetVector<Value> &necessaryRegionRValues,
+                                    std::function<bool(Region &, Value)> isFromOutside)
+{
+    llvm::SmallDenseSet<Value, 8> rQregsTakenIn;
+
+    r.walk([&](Operation *op) {
+        if (!usesNecessaryRValues(op)) {
+            return;
+        }
+        for (Value v : op->getOperands()) {
+            Value rValue = getNecessaryRValue(v);
+            // Ignore allocations from inside the region itself
+            if (!rValue || !isFromOutside(r, getRValueOrigin(rValue))) {
+                continue;
+            }
+            necessaryRegionRValues.insert(rValue);
+            if (isa<qref::QuregType>(rValue.getType())) {
+                rQregsTakenIn.insert(rValue);
+            }
+        }
+    });
+
+    removeRedundantRValues(necessaryRegionRValues, rQregsTakenIn);
+}
+
 /**
- * @brief Collect the rQreg and rQubit Values that are captured into a region from above by closure.
+ * @brief Collect the rQreg and rQubit Values that are captured into the regions of a function from
+ * above by closure.
  *
  * Reference semantics dialect operations do not take in or produce qreg Values, which means all
  * qreg Values are taken in via closure from above.
@@ -736,15 +756,73 @@ void _getNecessaryRegionRValuesImpl(Region &r, SetVector<Value> &necessaryRegion
  *
  * Registers and qubits allocated within the region are not collected.
  *
- * @param r
- * @param necessaryRegionRValues
+ * Each region-ed operation collects the rValues of its regions before converting them, so walking
+ * every nested operation on each query would make the conversion quadratic in the nesting depth.
+ * Instead, the rValues taken in from outside a region are computed once, in program order, from
+ * those of the regions nested in it and the operands of its own operations. A nested region takes
+ * in the rValues of its parent that are not defined in the parent.
+ *
+ * Regions are cached by address, so an instance must not outlive the conversion of the function
+ * it is queried for.
  */
-void collectNecessaryRegionRValues(Region &r, SetVector<Value> &necessaryRegionRValues)
-{
-    _getNecessaryRegionRValuesImpl(r, necessaryRegionRValues, [&](Region &r, Value v) {
-        return v.getParentRegion()->isProperAncestor(&r);
-    });
-}
+struct NecessaryRegionRValuesCache {
+  public:
+    /**
+     * @brief Collect the rValues captured into the region `r` from above.
+     *
+     * @param r
+     * @param necessaryRegionRValues
+     */
+    void collect(Region &r, SetVector<Value> &necessaryRegionRValues)
+    {
+        llvm::SmallDenseSet<Value, 8> rQregsTakenIn;
+        for (Value rValue : getRValuesFromOutside(r)) {
+            necessaryRegionRValues.insert(rValue);
+            if (isa<qref::QuregType>(rValue.getType())) {
+                rQregsTakenIn.insert(rValue);
+            }
+        }
+        removeRedundantRValues(necessaryRegionRValues, rQregsTakenIn);
+    }
+
+  private:
+    DenseMap<Region *, SetVector<Value>> rValuesFromOutside;
+
+    const SetVector<Value> &getRValuesFromOutside(Region &r)
+    {
+        if (auto it = rValuesFromOutside.find(&r); it != rValuesFromOutside.end()) {
+            return it->second;
+        }
+
+        auto isFromOutside = [&](Value rValue) {
+            return getRValueOrigin(rValue).getParentRegion()->isProperAncestor(&r);
+        };
+
+        // Nested operations come before their parent, as in a post-order walk
+        SetVector<Value> rValues;
+        for (Block &block : r) {
+            for (Operation &op : block) {
+                for (Region &nested : op.getRegions()) {
+                    for (Value rValue : getRValuesFromOutside(nested)) {
+                        if (isFromOutside(rValue)) {
+                            rValues.insert(rValue);
+                        }
+                    }
+                }
+                if (!usesNecessaryRValues(&op)) {
+                    continue;
+                }
+                for (Value v : op.getOperands()) {
+                    Value rValue = getNecessaryRValue(v);
+                    if (rValue && isFromOutside(rValue)) {
+                        rValues.insert(rValue);
+                    }
+                }
+            }
+        }
+        return rValuesFromOutside[&r] = std::move(rValues);
+    }
+};
 
 /**
  * @brief Collect the rQreg and rQubit Values that are needed in a subroutine func op.
@@ -1107,7 +1185,7 @@ void addRootVValuesToRetOp(Operation *retOp, ArrayRef<Value> rValuesToReturn,
  * @param r
  */
 void addVArgsToRegionAndHandle(IRRewriter &builder, const SetVector<Value> &rValuesUsedByRegion,
-                               Region &r)
+                               Region &r, NecessaryRegionRValuesCache &rValuesCache)
 {
     MLIRContext *ctx = r.getContext();
     Location loc = r.getLoc();
@@ -1125,7 +1203,7 @@ void addVArgsToRegionAndHandle(IRRewriter &builder, const SetVector<Value> &rVal
         }
     }
 
-    handleRegion(builder, r, regionTracker);
+    handleRegion(builder, r, regionTracker, rValuesCache);
     addRootVValuesToRetOp(r.front().getTerminator(), rValuesUsedByRegion.getArrayRef(),
                           regionTracker);
 }
@@ -1146,7 +1224,8 @@ void addVArgsToRegionAndHandle(IRRewriter &builder, const SetVector<Value> &rVal
 void addPretendedArgsToRegionAndHandle(IRRewriter &builder,
                                        const SetVector<Value> &rValuesUsedByRegion,
                                        TransientQubitExtractor &extractor,
-                                       QubitValueTracker &outerTracker, Region &r)
+                                       QubitValueTracker &outerTracker, Region &r,
+                                       NecessaryRegionRValuesCache &rValuesCache)
 {
     // Copy over all the existing root Value maps in the outer scope
     QubitValueTracker regionTracker = outerTracker;
@@ -1157,19 +1236,20 @@ void addPretendedArgsToRegionAndHandle(IRRewriter &builder,
         regionTracker.setCurrentVQubit(rValuesUsedByRegion[idx], vQubit);
     }
 
-    handleRegion(builder, r, regionTracker);
+    handleRegion(builder, r, regionTracker, rValuesCache);
     addRootVValuesToRetOp(r.front().getTerminator(), rValuesUsedByRegion.getArrayRef(),
                           regionTracker);
 }
 
-void handleAdjoint(IRRewriter &builder, qref::AdjointOp rAdjointOp, QubitValueTracker &tracker)
+void handleAdjoint(IRRewriter &builder, qref::AdjointOp rAdjointOp, QubitValueTracker &tracker,
+                   NecessaryRegionRValuesCache &rValuesCache)
 {
     OpBuilder::InsertionGuard guard(builder);
     builder.setInsertionPoint(rAdjointOp);
     Location loc = rAdjointOp->getLoc();
 
     SetVector<Value> rValuesUsedByRegion;
-    collectNecessaryRegionRValues(rAdjointOp.getRegion(), rValuesUsedByRegion);
+    rValuesCache.collect(rAdjointOp.getRegion(), rValuesUsedByRegion);
 
     quantum::AdjointOp vAdjointOp;
     {
@@ -1208,7 +1288,8 @@ void handleAdjoint(IRRewriter &builder, qref::AdjointOp rAdjointOp, QubitValueTr
         quantum::YieldOp::create(builder, loc, {});
 
         // 3. Create new args with quantum.bit/reg types and set them as root for the new region
-        addVArgsToRegionAndHandle(builder, rValuesUsedByRegion, vAdjointOp.getRegion());
+        addVArgsToRegionAndHandle(builder, rValuesUsedByRegion, vAdjointOp.getRegion(),
+                                  rValuesCache);
 
         // Update tracker with results
         for (auto [i, j] :
@@ -1256,7 +1337,8 @@ void createElseBranchWithDefaultYields(IRRewriter &builder,
     scf::YieldOp::create(builder, ifOp->getLoc(), elseYieldVals);
 }
 
-void handleIf(IRRewriter &builder, scf::IfOp ifOp, QubitValueTracker &tracker)
+void handleIf(IRRewriter &builder, scf::IfOp ifOp, QubitValueTracker &tracker,
+              NecessaryRegionRValuesCache &rValuesCache)
 {
     OpBuilder::InsertionGuard guard(builder);
     builder.setInsertionPoint(ifOp);
@@ -1265,9 +1347,9 @@ void handleIf(IRRewriter &builder, scf::IfOp ifOp, QubitValueTracker &tracker)
     bool hasElseRegion = !ifOp.getElseRegion().empty();
 
     SetVector<Value> rValuesUsedByRegion;
-    collectNecessaryRegionRValues(ifOp.getThenRegion(), rValuesUsedByRegion);
+    rValuesCache.collect(ifOp.getThenRegion(), rValuesUsedByRegion);
     if (hasElseRegion) {
-        collectNecessaryRegionRValues(ifOp.getElseRegion(), rValuesUsedByRegion);
+        rValuesCache.collect(ifOp.getElseRegion(), rValuesUsedByRegion);
     }
 
     if (rValuesUsedByRegion.size() == 0) {
@@ -1304,7 +1386,7 @@ void handleIf(IRRewriter &builder, scf::IfOp ifOp, QubitValueTracker &tracker)
         builder.inlineRegionBefore(ifOp.getThenRegion(), newIfOp.getThenRegion(),
                                    newIfOp.getThenRegion().end());
         addPretendedArgsToRegionAndHandle(builder, rValuesUsedByRegion, extractor, tracker,
-                                          newIfOp.getThenRegion());
+                                          newIfOp.getThenRegion(), rValuesCache);
 
         // 3. Handle "else" region
         // If none existed before, we need to create an empty "else" region, just for the yield
@@ -1314,7 +1396,7 @@ void handleIf(IRRewriter &builder, scf::IfOp ifOp, QubitValueTracker &tracker)
             builder.inlineRegionBefore(ifOp.getElseRegion(), newIfOp.getElseRegion(),
                                        newIfOp.getElseRegion().end());
             addPretendedArgsToRegionAndHandle(builder, rValuesUsedByRegion, extractor, tracker,
-                                              newIfOp.getElseRegion());
+                                              newIfOp.getElseRegion(), rValuesCache);
         }
         else {
             // no explicit "else" region on the original if op, just yield whatever the closure
@@ -1344,7 +1426,8 @@ void handleIf(IRRewriter &builder, scf::IfOp ifOp, QubitValueTracker &tracker)
     builder.eraseOp(ifOp);
 }
 
-void handleSwitch(IRRewriter &builder, scf::IndexSwitchOp switchOp, QubitValueTracker &tracker)
+void handleSwitch(IRRewriter &builder, scf::IndexSwitchOp switchOp, QubitValueTracker &tracker,
+                  NecessaryRegionRValuesCache &rValuesCache)
 {
     OpBuilder::InsertionGuard guard(builder);
     builder.setInsertionPoint(switchOp);
@@ -1353,9 +1436,9 @@ void handleSwitch(IRRewriter &builder, scf::IndexSwitchOp switchOp, QubitValueTr
 
     SetVector<Value> rValuesUsedByRegion;
     for (Region &r : switchOp.getCaseRegions()) {
-        collectNecessaryRegionRValues(r, rValuesUsedByRegion);
+        rValuesCache.collect(r, rValuesUsedByRegion);
     }
-    collectNecessaryRegionRValues(switchOp.getDefaultRegion(), rValuesUsedByRegion);
+    rValuesCache.collect(switchOp.getDefaultRegion(), rValuesUsedByRegion);
 
     if (rValuesUsedByRegion.size() == 0) {
         return;
@@ -1389,14 +1472,14 @@ void handleSwitch(IRRewriter &builder, scf::IndexSwitchOp switchOp, QubitValueTr
         builder.inlineRegionBefore(switchOp.getDefaultRegion(), newSwitchOp.getDefaultRegion(),
                                    newSwitchOp.getDefaultRegion().end());
         addPretendedArgsToRegionAndHandle(builder, rValuesUsedByRegion, extractor, tracker,
-                                          newSwitchOp.getDefaultRegion());
+                                          newSwitchOp.getDefaultRegion(), rValuesCache);
 
         // 3. Handle the case regions
         for (auto [oldCaseRegion, newCaseRegion] :
              llvm::zip_equal(switchOp.getCaseRegions(), newSwitchOp.getCaseRegions())) {
             builder.inlineRegionBefore(oldCaseRegion, newCaseRegion, newCaseRegion.end());
             addPretendedArgsToRegionAndHandle(builder, rValuesUsedByRegion, extractor, tracker,
-                                              newCaseRegion);
+                                              newCaseRegion, rValuesCache);
         }
 
         // Update outer tracker with results
@@ -1420,14 +1503,15 @@ void handleSwitch(IRRewriter &builder, scf::IndexSwitchOp switchOp, QubitValueTr
     builder.eraseOp(switchOp);
 }
 
-void handleFor(IRRewriter &builder, scf::ForOp forOp, QubitValueTracker &tracker)
+void handleFor(IRRewriter &builder, scf::ForOp forOp, QubitValueTracker &tracker,
+               NecessaryRegionRValuesCache &rValuesCache)
 {
     OpBuilder::InsertionGuard guard(builder);
     builder.setInsertionPoint(forOp);
     Location loc = forOp->getLoc();
 
     SetVector<Value> rValuesUsedByRegion;
-    collectNecessaryRegionRValues(forOp.getRegion(), rValuesUsedByRegion);
+    rValuesCache.collect(forOp.getRegion(), rValuesUsedByRegion);
 
     if (rValuesUsedByRegion.size() == 0) {
         return;
@@ -1470,7 +1554,8 @@ void handleFor(IRRewriter &builder, scf::ForOp forOp, QubitValueTracker &tracker
                                    newLoop.getRegion().end());
 
         // 3. Create new args with quantum.bit/reg types and set them as root for the new region
-        addVArgsToRegionAndHandle(builder, rValuesUsedByRegion, newLoop.getRegion());
+        addVArgsToRegionAndHandle(builder, rValuesUsedByRegion, newLoop.getRegion(),
+                                  rValuesCache);
 
         // Update tracker with results
         // Again, The loop's block always takes in the iteration variable (the `i`) as a block
@@ -1497,7 +1582,8 @@ void handleFor(IRRewriter &builder, scf::ForOp forOp, QubitValueTracker &tracker
     builder.eraseOp(forOp);
 }
 
-void handleWhile(IRRewriter &builder, scf::WhileOp whileOp, QubitValueTracker &tracker)
+void handleWhile(IRRewriter &builder, scf::WhileOp whileOp, QubitValueTracker &tracker,
+                 NecessaryRegionRValuesCache &rValuesCache)
 {
     OpBuilder::InsertionGuard guard(builder);
     builder.setInsertionPoint(whileOp);
@@ -1505,8 +1591,8 @@ void handleWhile(IRRewriter &builder, scf::WhileOp whileOp, QubitValueTracker &t
     MLIRContext *ctx = whileOp.getContext();
 
     SetVector<Value> rValuesUsedByRegion;
-    collectNecessaryRegionRValues(whileOp.getBefore(), rValuesUsedByRegion);
-    collectNecessaryRegionRValues(whileOp.getAfter(), rValuesUsedByRegion);
+    rValuesCache.collect(whileOp.getBefore(), rValuesUsedByRegion);
+    rValuesCache.collect(whileOp.getAfter(), rValuesUsedByRegion);
 
     if (rValuesUsedByRegion.size() == 0) {
         return;
@@ -1555,8 +1641,10 @@ void handleWhile(IRRewriter &builder, scf::WhileOp whileOp, QubitValueTracker &t
                                    newLoop.getAfter().end());
 
         // 3. Create new args with quantum.bit/reg types and set them as root for the new region
-        addVArgsToRegionAndHandle(builder, rValuesUsedByRegion, newLoop.getBefore());
-        addVArgsToRegionAndHandle(builder, rValuesUsedByRegion, newLoop.getAfter());
+        addVArgsToRegionAndHandle(builder, rValuesUsedByRegion, newLoop.getBefore(),
+                                  rValuesCache);
+        addVArgsToRegionAndHandle(builder, rValuesUsedByRegion, newLoop.getAfter(),
+                                  rValuesCache);
 
         // Update tracker with results
         for (auto [i, j] :
@@ -1602,7 +1690,8 @@ void handleSubroutine(IRRewriter &builder, func::FuncOp f,
         }
     }
 
-    handleRegion(builder, f.getBody(), regionTracker);
+    NecessaryRegionRValuesCache rValuesCache;
+    handleRegion(builder, f.getBody(), regionTracker, rValuesCache);
     addRootVValuesToRetOp(f.front().getTerminator(), rValuesUsedBySubroutine.getArrayRef(),
                           regionTracker);
 
@@ -1625,7 +1714,8 @@ void handleSubroutine(IRRewriter &builder, func::FuncOp f,
                                         f.front().getTerminator()->getOperandTypes()));
 }
 
-void handleRegion(IRRewriter &builder, Region &r, QubitValueTracker &tracker)
+void handleRegion(IRRewriter &builder, Region &r, QubitValueTracker &tracker,
+                  NecessaryRegionRValuesCache &rValuesCache)
 {
     r.walk<WalkOrder::PreOrder>([&](Operation *op) {
         if (auto rAllocOp = dyn_cast<qref::AllocOp>(op)) {
@@ -1659,19 +1749,19 @@ void handleRegion(IRRewriter &builder, Region &r, QubitValueTracker &tracker)
             handleMeasure(builder, rMeasureOp, tracker);
         }
         else if (auto adjointOp = dyn_cast<qref::AdjointOp>(op)) {
-            handleAdjoint(builder, adjointOp, tracker);
+            handleAdjoint(builder, adjointOp, tracker, rValuesCache);
         }
         else if (auto ifOp = dyn_cast<scf::IfOp>(op)) {
-            handleIf(builder, ifOp, tracker);
+            handleIf(builder, ifOp, tracker, rValuesCache);
         }
         else if (auto switchOp = dyn_cast<scf::IndexSwitchOp>(op)) {
-            handleSwitch(builder, switchOp, tracker);
+            handleSwitch(builder, switchOp, tracker, rValuesCache);
         }
         else if (auto forOp = dyn_cast<scf::ForOp>(op)) {
-            handleFor(builder, forOp, tracker);
+            handleFor(builder, forOp, tracker, rValuesCache);
         }
         else if (auto whileOp = dyn_cast<scf::WhileOp>(op)) {
-            handleWhile(builder, whileOp, tracker);
+            handleWhile(builder, whileOp, tracker, rValuesCache);
         }
     });
 }
@@ -1789,7 +1879,8 @@ struct ValueSemanticsConversionPass
         // Convert the main quantum.mode functions
         for (auto targetFunc : targetFuncs) {
             QubitValueTracker tracker;
-            handleRegion(builder, targetFunc.getBody(), tracker);
+            NecessaryRegionRValuesCache rValuesCache;
+            handleRegion(builder, targetFunc.getBody(), tracker, rValuesCache);
 
             targetFunc.walk([&](qref::GetOp getOp) {
                 assert(getOp.use_empty() &&
@@ -37,6 +37,7 @@ struct QubitValueTracker;
 struct TransientQubitExtractor;
 struct rQubitGetOpInfo;
 struct SubroutineInfo;
+struct NecessaryRegionRValuesCache;
 
 // The main converter function
 template <typename OpTy>
@@ -58,14 +59,20 @@ void handleCompbasis(IRRewriter &builder, qref::ComputationalBasisOp rCompbasisO
 void handleNamedObs(IRRewriter &builder, qref::NamedObsOp rNamedObsOp, QubitValueTracker &tracker);
 void handleHermitian(IRRewriter &builder, qref::HermitianOp rHermitianOp,
                      QubitValueTracker &tracker);
-void handleAdjoint(IRRewriter &builder, qref::AdjointOp rAdjointOp, QubitValueTracker &tracker);
-void handleIf(IRRewriter &builder, scf::IfOp ifOp, QubitValueTracker &tracker);
-void handleSwitch(IRRewriter &builder, scf::IndexSwitchOp switchOp, QubitValueTracker &tracker);
-void handleFor(IRRewriter &builder, scf::ForOp forOp, QubitValueTracker &tracker);
-void handleWhile(IRRewriter &builder, scf::WhileOp whileOp, QubitValueTracker &tracker);
+void handleAdjoint(IRRewriter &builder, qref::AdjointOp rAdjointOp, QubitValueTracker &tracker,
+                   NecessaryRegionRValuesCache &rValuesCache);
+void handleIf(IRRewriter &builder, scf::IfOp ifOp, QubitValueTracker &tracker,
+              NecessaryRegionRValuesCache &rValuesCache);
+void handleSwitch(IRRewriter &builder, scf::IndexSwitchOp switchOp, QubitValueTracker &tracker,
+                  NecessaryRegionRValuesCache &rValuesCache);
+void handleFor(IRRewriter &builder, scf::ForOp forOp, QubitValueTracker &tracker,
+               NecessaryRegionRValuesCache &rValuesCache);
+void handleWhile(IRRewriter &builder, scf::WhileOp whileOp, QubitValueTracker &tracker,
+                 NecessaryRegionRValuesCache &rValuesCache);
 void handleSubroutine(IRRewriter &builder, func::FuncOp f,
                       const SetVector<Value> &rValuesUsedBySubroutine);
 
 // Main driver
-void handleRegion(IRRewriter &builder, Region &r, QubitValueTracker &tracker);
+void handleRegion(IRRewriter &builder, Region &r, QubitValueTracker &tracker,
+                  NecessaryRegionRValuesCache &rValuesCache);
 } // anonymous namespace
@@ -14,6 +14,9 @@
 
 #define DEBUG_TYPE "verify-no-quantum-use-after-free"
 
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
 #include "mlir/IR/Dominance.h"
 #include "mlir/IR/Operation.h"
 #include "mlir/IR/Value.h"
@@ -27,28 +30,47 @@ using namespace mlir;
 using namespace catalyst;
 
 namespace {
-bool hasUseAfterFree(Value qubit, Operation *gate, DominanceInfo &domInfo)
-{
-    if (auto getOp = qubit.getDefiningOp<qref::GetOp>()) {
-        Value qreg = getOp.getQreg();
-        for (Operation *user : qreg.getUsers()) {
-            if (auto deallocOp = dyn_cast<qref::DeallocOp>(user)) {
-                if (domInfo.properlyDominates(deallocOp, gate)) {
-                    return true;
-                }
+
+/**
+ * @brief The deallocations of each qref.reg and root qref.bit Value nested in an operation.
+ *
+ * Indexing the deallocations once lets each gate be checked against the deallocations of its own
+ * qubits only, instead of against every user of their registers, which includes every `qref.get`.
+ */
+struct QuantumDeallocationAnalysis {
+    QuantumDeallocationAnalysis(Operation *op)
+    {
+        op->walk([&](Operation *nestedOp) {
+            if (auto deallocOp = dyn_cast<qref::DeallocOp>(nestedOp)) {
+                deallocations[deallocOp.getQreg()].push_back(deallocOp);
             }
-        }
-    }
-    else {
-        for (Operation *user : qubit.getUsers()) {
-            if (auto deallocQubitOp = dyn_cast<qref::DeallocQubitOp>(user)) {
-                if (domInfo.properlyDominates(deallocQubitOp, gate)) {
-                    return true;
-                }
+            else if (auto deallocQubitOp = dyn_cast<qref::DeallocQubitOp>(nestedOp)) {
+                deallocations[deallocQubitOp.getQubit()].push_back(deallocQubitOp);
             }
-        }
+        });
     }
-    return false;
+
+    ArrayRef<Operation *> getDeallocations(Value rValue) const
+    {
+        auto it = deallocations.find(rValue);
+        return it == deallocations.end() ? ArrayRef<Operation *>() : ArrayRef(it->second);
+    }
+
+  private:
+    DenseMap<Value, SmallVector<Operation *, 1>> deallocations;
+};
+
+bool hasUseAfterFree(Value qubit, Operation *gate, const QuantumDeallocationAnalysis &deallocs,
+                     DominanceInfo &domInfo)
+{
+    // A qubit from a register is freed by the deallocation of the register
+    Value freed = qubit;
+    if (auto getOp = qubit.getDefiningOp<qref::GetOp>()) {
+        freed = getOp.getQreg();
+    }
+    return llvm::any_of(deallocs.getDeallocations(freed), [&](Operation *deallocOp) {
+        return domInfo.properlyDominates(deallocOp, gate);
+    });
 }
 } // namespace
 
@@ -65,12 +87,16 @@ struct VerifyNoQuantumUseAfterFreePass
 
     void runOnOperation() final
     {
-        Operation *mod = getOperation();
-        DominanceInfo domInfo(mod);
+        // Both analyses are cached by the pass manager, and this pass does not invalidate them.
+        // The pass only looks at the IR nested in the operation it runs on, so it can be scheduled
+        // on each function separately, and thus in parallel.
+        Operation *op = getOperation();
+        auto &domInfo = getAnalysis<DominanceInfo>();
+        auto &deallocs = getAnalysis<QuantumDeallocationAnalysis>();
 
-        WalkResult wr = mod->walk([&](qref::QuantumOperation qOp) {
+        WalkResult wr = op->walk([&](qref::QuantumOperation qOp) {
             for (Value &qubit : qOp.getQubitOperands()) {
-                if (hasUseAfterFree(qubit, qOp, domInfo)) {
+                if (hasUseAfterFree(qubit, qOp, deallocs, domInfo)) {
                     qOp.emitOpError("Detected use of a qubit after deallocation");
                     return WalkResult::interrupt();
                 }
@@ -80,6 +106,8 @@ struct VerifyNoQuantumUseAfterFreePass
         if (wr.wasInterrupted()) {
             return signalPassFailure();
         }
+
+        markAllAnalysesPreserved();
     }
 };
 
@@ -228,6 +228,22 @@ LogicalResult AssembleTannerGraphOp::verify()
     return success();
 }
 
+LogicalResult MeasureSyndromeOp::verify()
+{
+    const auto numQubits = static_cast<int64_t>(getInQubits().size());
+    if (numQubits == 0) {
+        return emitOpError() << "expected at least one qubit to measure";
+    }
+
+    const auto syndromeSize = getSyndrome().getType().getDimSize(0);
+    if (!ShapedType::isDynamic(syndromeSize) && syndromeSize != numQubits) {
+        return emitOpError() << "expected the syndrome to have one bit per measured qubit, but got "
+                             << syndromeSize << " bits for " << numQubits << " qubits";
+    }
+
+    return success();
+}
+
 //===----------------------------------------------------------------------===//
 // QecPhysical op canonicalizers.
 //===----------------------------------------------------------------------===//
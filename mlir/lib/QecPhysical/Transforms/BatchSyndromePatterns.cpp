@@ -0,0 +1,122 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/PatternMatch.h"
+
+#include "QecPhysical/IR/QecPhysicalOps.h"
+#include "QecPhysical/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace {
+
+using namespace catalyst::qecp;
+
+/// Replace a syndrome assembled from the results of individual measurements,
+///
+///     %m0, %q0 = qecp.measure %a0 : i1, !qecp.qubit<aux>
+///     %m1, %q1 = qecp.measure %a1 : i1, !qecp.qubit<aux>
+///     %esm = tensor.from_elements %m0, %m1 : tensor<2xi1>
+///
+/// by a single measurement of the whole round,
+///
+///     %esm, %q0, %q1 = qecp.measure_syndrome %a0, %a1 : tensor<2xi1>, !qecp.qubit<aux>, ...
+///
+/// The measurements are merged at the position of the last one, so that none of their output
+/// qubits or results may be used before it. Other uses of the individual results are read back
+/// from the syndrome.
+struct BatchSyndromeMeasurementsPattern : public OpRewritePattern<tensor::FromElementsOp> {
+    using OpRewritePattern<tensor::FromElementsOp>::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(tensor::FromElementsOp op,
+                                  PatternRewriter &rewriter) const override
+    {
+        RankedTensorType syndromeType = op.getType();
+        if (syndromeType.getRank() != 1 || !syndromeType.getElementType().isInteger(1) ||
+            op.getElements().size() < 2) {
+            return failure();
+        }
+
+        Block *block = op->getBlock();
+        SmallVector<MeasureOp> measurements;
+        llvm::SmallPtrSet<Operation *, 8> visited;
+        for (Value element : op.getElements()) {
+            auto measure = element.getDefiningOp<MeasureOp>();
+            if (!measure || measure->getBlock() != block || !visited.insert(measure).second) {
+                return failure();
+            }
+            measurements.push_back(measure);
+        }
+
+        MeasureOp last = measurements.front();
+        for (MeasureOp measure : measurements) {
+            if (last->isBeforeInBlock(measure)) {
+                last = measure;
+            }
+        }
+
+        auto isUsedAfterLast = [&](Value value) {
+            return llvm::all_of(value.getUsers(), [&](Operation *user) {
+                Operation *ancestor = block->findAncestorOpInBlock(*user);
+                return ancestor && last->isBeforeInBlock(ancestor);
+            });
+        };
+        for (MeasureOp measure : measurements) {
+            if (!isUsedAfterLast(measure.getMres()) || !isUsedAfterLast(measure.getOutQubit())) {
+                return rewriter.notifyMatchFailure(
+                    op, "a measurement of the round is used before the end of the round");
+            }
+        }
+
+        SmallVector<Value> inQubits;
+        for (MeasureOp measure : measurements) {
+            inQubits.push_back(measure.getInQubit());
+        }
+        rewriter.setInsertionPointAfter(last);
+        auto batch = MeasureSyndromeOp::create(rewriter, last.getLoc(), syndromeType,
+                                               ValueRange(inQubits).getTypes(), inQubits);
+        rewriter.replaceOp(op, batch.getSyndrome());
+
+        for (auto [idx, measure] : llvm::enumerate(measurements)) {
+            Value mres = measure.getMres();
+            if (!mres.use_empty()) {
+                Value index = arith::ConstantIndexOp::create(rewriter, measure.getLoc(), idx);
+                rewriter.replaceAllUsesWith(
+                    mres, tensor::ExtractOp::create(rewriter, measure.getLoc(),
+                                                    batch.getSyndrome(), index));
+            }
+            rewriter.replaceAllUsesWith(measure.getOutQubit(), batch.getOutQubits()[idx]);
+            rewriter.eraseOp(measure);
+        }
+        return success();
+    }
+};
+
+} // namespace
+
+namespace catalyst {
+namespace qecp {
+
+void populateBatchSyndromeMeasurementsPatterns(RewritePatternSet &patterns)
+{
+    patterns.add<BatchSyndromeMeasurementsPattern>(patterns.getContext());
+}
+
+} // namespace qecp
+} // namespace catalyst
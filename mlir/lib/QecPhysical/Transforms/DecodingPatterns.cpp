@@ -0,0 +1,168 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Bufferization/IR/Bufferization.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Transforms/DialectConversion.h"
+
+#include "Catalyst/Utils/EnsureFunctionDeclaration.h"
+#include "QecPhysical/IR/QecPhysicalOps.h"
+#include "QecPhysical/IR/QecPhysicalTypes.h"
+#include "QecPhysical/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace {
+
+using namespace catalyst::qecp;
+
+// The syndrome decoders are kept by the runtime, see the `__catalyst__qecp__*` functions of the
+// runtime C API. Tanner graphs are lowered to the i64 keys of their decoders.
+
+LLVM::LLVMFuncOp getRuntimeFunction(ConversionPatternRewriter &rewriter, Operation *op,
+                                    StringRef fnName, Type resultTy, ArrayRef<Type> argTys)
+{
+    Type fnSignature = LLVM::LLVMFunctionType::get(resultTy, argTys);
+    return catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(rewriter, op, fnName,
+                                                                 fnSignature);
+}
+
+// Get a memref of a 1-d tensor or memref operand, or a failure if its layout is not contiguous.
+FailureOr<Value> getBuffer(ConversionPatternRewriter &rewriter, Location loc, Value array)
+{
+    if (auto tensorType = dyn_cast<RankedTensorType>(array.getType())) {
+        MemRefType memrefType = bufferization::getMemRefTypeWithStaticIdentityLayout(tensorType);
+        return bufferization::ToBufferOp::create(rewriter, loc, memrefType, array).getResult();
+    }
+    if (!cast<MemRefType>(array.getType()).getLayout().isIdentity()) {
+        return failure();
+    }
+    return array;
+}
+
+// Get a pointer to the first element of a memref with an identity layout.
+Value getDataPtr(ConversionPatternRewriter &rewriter, Location loc, Value memref)
+{
+    Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+    Value index = memref::ExtractAlignedPointerAsIndexOp::create(rewriter, loc, memref);
+    Value address = arith::IndexCastOp::create(rewriter, loc, rewriter.getI64Type(), index);
+    return LLVM::IntToPtrOp::create(rewriter, loc, ptrType, address);
+}
+
+Value getI64Constant(ConversionPatternRewriter &rewriter, Location loc, int64_t value)
+{
+    return LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(value));
+}
+
+struct AssembleTannerGraphOpPattern : public OpConversionPattern<AssembleTannerGraphOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(AssembleTannerGraphOp op, AssembleTannerGraphOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        auto graphType = cast<TannerGraphType>(op.getTannerGraph().getType());
+        unsigned bitWidth = graphType.getElementType().getIntOrFloatBitWidth();
+        if (bitWidth != 8 && bitWidth != 16 && bitWidth != 32 && bitWidth != 64) {
+            return rewriter.notifyMatchFailure(op, "unsupported Tanner graph element type");
+        }
+
+        FailureOr<Value> rowIdx = getBuffer(rewriter, loc, adaptor.getRowIdx());
+        FailureOr<Value> colPtr = getBuffer(rewriter, loc, adaptor.getColPtr());
+        if (failed(rowIdx) || failed(colPtr)) {
+            return rewriter.notifyMatchFailure(op, "expected contiguous Tanner graph arrays");
+        }
+
+        Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+        Type i64 = rewriter.getI64Type();
+        LLVM::LLVMFuncOp fnDecl =
+            getRuntimeFunction(rewriter, op, "__catalyst__qecp__decoder_create", i64,
+                               {ptrType, i64, ptrType, i64, i64});
+
+        SmallVector<Value> args = {
+            getDataPtr(rewriter, loc, *rowIdx),
+            getI64Constant(rewriter, loc, graphType.getRowIdxSize()),
+            getDataPtr(rewriter, loc, *colPtr),
+            getI64Constant(rewriter, loc, graphType.getColPtrSize()),
+            getI64Constant(rewriter, loc, bitWidth),
+        };
+        rewriter.replaceOp(op, LLVM::CallOp::create(rewriter, loc, fnDecl, args));
+        return success();
+    }
+};
+
+struct DecodeEsmCssOpPattern : public OpConversionPattern<DecodeEsmCssOp> {
+    using OpConversionPattern::OpConversionPattern;
+
+    LogicalResult matchAndRewrite(DecodeEsmCssOp op, DecodeEsmCssOpAdaptor adaptor,
+                                  ConversionPatternRewriter &rewriter) const override
+    {
+        Location loc = op.getLoc();
+        auto esmType = cast<ShapedType>(op.getEsm().getType());
+        auto errIdxType = cast<RankedTensorType>(op.getErrIdx().getType());
+        if (!esmType.hasStaticShape() || !errIdxType.hasStaticShape()) {
+            return rewriter.notifyMatchFailure(op, "expected statically shaped ESM and indices");
+        }
+
+        FailureOr<Value> esm = getBuffer(rewriter, loc, adaptor.getEsm());
+        if (failed(esm)) {
+            return rewriter.notifyMatchFailure(op, "expected a contiguous ESM");
+        }
+
+        // The decoded indices are written by the runtime into a new buffer, which only the result
+        // tensor refers to
+        auto errIdxBufferType = MemRefType::get(errIdxType.getShape(), rewriter.getI64Type());
+        Value errIdxBuffer = memref::AllocOp::create(rewriter, loc, errIdxBufferType);
+
+        Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+        Type i64 = rewriter.getI64Type();
+        LLVM::LLVMFuncOp fnDecl =
+            getRuntimeFunction(rewriter, op, "__catalyst__qecp__decode_esm",
+                               LLVM::LLVMVoidType::get(rewriter.getContext()),
+                               {i64, ptrType, i64, ptrType, i64});
+
+        SmallVector<Value> args = {
+            adaptor.getTannerGraph(),
+            getDataPtr(rewriter, loc, *esm),
+            getI64Constant(rewriter, loc, esmType.getNumElements()),
+            getDataPtr(rewriter, loc, errIdxBuffer),
+            getI64Constant(rewriter, loc, errIdxType.getNumElements()),
+        };
+        LLVM::CallOp::create(rewriter, loc, fnDecl, args);
+
+        Value errIdx = bufferization::ToTensorOp::create(
+            rewriter, loc, RankedTensorType::get(errIdxType.getShape(), rewriter.getI64Type()),
+            errIdxBuffer, true);
+        rewriter.replaceOp(op, arith::IndexCastOp::create(rewriter, loc, errIdxType, errIdx));
+        return success();
+    }
+};
+
+} // namespace
+
+namespace catalyst {
+namespace qecp {
+
+void populateDecodingLoweringPatterns(TypeConverter &typeConverter, RewritePatternSet &patterns)
+{
+    patterns.add<AssembleTannerGraphOpPattern>(typeConverter, patterns.getContext());
+    patterns.add<DecodeEsmCssOpPattern>(typeConverter, patterns.getContext());
+}
+
+} // namespace qecp
+} // namespace catalyst
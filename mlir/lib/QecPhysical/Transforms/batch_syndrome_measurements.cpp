@@ -0,0 +1,46 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+
+#include "QecPhysical/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace catalyst {
+namespace qecp {
+
+#define GEN_PASS_DEF_BATCHSYNDROMEMEASUREMENTSPASS
+#include "QecPhysical/Transforms/Passes.h.inc"
+
+struct BatchSyndromeMeasurementsPass
+    : impl::BatchSyndromeMeasurementsPassBase<BatchSyndromeMeasurementsPass> {
+    using BatchSyndromeMeasurementsPassBase::BatchSyndromeMeasurementsPassBase;
+
+    void runOnOperation() final
+    {
+        RewritePatternSet patterns(&getContext());
+        populateBatchSyndromeMeasurementsPatterns(patterns);
+
+        if (failed(applyPatternsGreedily(getOperation(), std::move(patterns)))) {
+            signalPassFailure();
+        }
+    }
+};
+
+} // namespace qecp
+} // namespace catalyst
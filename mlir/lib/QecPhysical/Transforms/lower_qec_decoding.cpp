@@ -0,0 +1,61 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Bufferization/IR/Bufferization.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Transforms/DialectConversion.h"
+
+#include "QecPhysical/IR/QecPhysicalOps.h"
+#include "QecPhysical/IR/QecPhysicalTypes.h"
+#include "QecPhysical/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace catalyst {
+namespace qecp {
+
+#define GEN_PASS_DEF_QECDECODINGLOWERINGPASS
+#include "QecPhysical/Transforms/Passes.h.inc"
+
+struct QecDecodingLoweringPass : impl::QecDecodingLoweringPassBase<QecDecodingLoweringPass> {
+    using QecDecodingLoweringPassBase::QecDecodingLoweringPassBase;
+
+    void runOnOperation() final
+    {
+        MLIRContext *context = &getContext();
+
+        // Tanner graphs are the keys of their decoders in the runtime
+        TypeConverter typeConverter;
+        typeConverter.addConversion([](Type type) { return type; });
+        typeConverter.addConversion(
+            [](TannerGraphType type) -> Type { return IntegerType::get(type.getContext(), 64); });
+
+        RewritePatternSet patterns(context);
+        populateDecodingLoweringPatterns(typeConverter, patterns);
+
+        ConversionTarget target(*context);
+        target.markUnknownOpDynamicallyLegal([](Operation *) { return true; });
+        target.addIllegalOp<AssembleTannerGraphOp, DecodeEsmCssOp>();
+
+        if (failed(applyPartialConversion(getOperation(), target, std::move(patterns)))) {
+            signalPassFailure();
+        }
+    }
+};
+
+} // namespace qecp
+} // namespace catalyst
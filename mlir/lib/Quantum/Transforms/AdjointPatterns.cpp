@@ -332,30 +332,21 @@ class AdjointGenerator {
             }
         }
     }
-    void visitOperation(func::CallOp callOp, OpBuilder &builder)
-    {
-        // Get the the original function
-        SymbolRefAttr symbol = dyn_cast_if_present<SymbolRefAttr>(callOp.getCallableForCallee());
-        func::FuncOp funcOp =
-            dyn_cast_or_null<func::FuncOp>(SymbolTable::lookupNearestSymbolFrom(callOp, symbol));
-        assert(funcOp != nullptr && "The funcOp is null and therefore not supported.");
-
-        auto resultTypes = funcOp.getResultTypes();
 
-        bool quantum = std::any_of(resultTypes.begin(), resultTypes.end(), [](const auto &value) {
-            return isa<QuregType, QubitType>(value);
-        });
-        if (!quantum) {
-            // This operation is purely classical
-            return;
+    /// Get the function computing the adjoint of `funcOp`, creating it on first use.
+    func::FuncOp getOrCreateAdjointFunction(func::FuncOp funcOp, OpBuilder &builder)
+    {
+        // The adjoint of a function is outlined once and shared by all of its calls, so that
+        // nested adjoints of large subroutines do not duplicate their reversed bodies
+        ModuleOp moduleOp = funcOp->getParentOfType<ModuleOp>();
+        std::string adjointName = funcOp.getName().str() + ".adjoint";
+        if (auto adjointFnOp = moduleOp.lookupSymbol<func::FuncOp>(adjointName)) {
+            return adjointFnOp;
         }
 
-        // Save the insertion point to come back to it after creating the adjoint of the function
-        auto insertionSaved = builder.saveInsertionPoint();
-        MLIRContext *ctx = builder.getContext();
-
         // Create the adjoint of the original function at the module level
-        ModuleOp moduleOp = funcOp->getParentOfType<ModuleOp>();
+        OpBuilder::InsertionGuard insertionGuard(builder);
+        MLIRContext *ctx = builder.getContext();
         builder.setInsertionPointToStart(moduleOp.getBody());
 
         Block *originalBlock = &funcOp.front();
@@ -367,7 +358,6 @@ class AdjointGenerator {
             FunctionType::get(ctx, /*inputs=*/
                               originalArguments.getTypes(),
                               /*outputs=*/originalTerminator->getOperandTypes());
-        std::string adjointName = funcOp.getName().str() + ".adjoint";
         Location loc = funcOp.getLoc();
         func::FuncOp adjointFnOp = func::FuncOp::create(builder, loc, adjointName, adjointFnType);
         adjointFnOp.setPrivate();
@@ -414,9 +404,29 @@ class AdjointGenerator {
         rewriter.eraseOp(terminator);
         builder.setInsertionPointAfter(adjointOp);
         func::ReturnOp::create(builder, loc, adjointOp.getResults());
+        return adjointFnOp;
+    }
 
-        // Leave the adjoint func op to go back at the saved insertion
-        builder.restoreInsertionPoint(insertionSaved);
+    void visitOperation(func::CallOp callOp, OpBuilder &builder)
+    {
+        // Get the the original function
+        SymbolRefAttr symbol = dyn_cast_if_present<SymbolRefAttr>(callOp.getCallableForCallee());
+        func::FuncOp funcOp =
+            dyn_cast_or_null<func::FuncOp>(SymbolTable::lookupNearestSymbolFrom(callOp, symbol));
+        assert(funcOp != nullptr && "The funcOp is null and therefore not supported.");
+
+        auto resultTypes = funcOp.getResultTypes();
+
+        bool quantum = std::any_of(resultTypes.begin(), resultTypes.end(), [](const auto &value) {
+            return isa<QuregType, QubitType>(value);
+        });
+        if (!quantum) {
+            // This operation is purely classical
+            return;
+        }
+
+        func::FuncOp adjointFnOp = getOrCreateAdjointFunction(funcOp, builder);
+        Location loc = funcOp.getLoc();
 
         std::vector<Value> args;
         getAdjointCallOpArgs(callOp, args);
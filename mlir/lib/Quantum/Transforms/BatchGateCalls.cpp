@@ -0,0 +1,250 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iterator>
+#include <optional>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+
+#include "Catalyst/Utils/RuntimeFunctionAttributes.h"
+#include "Catalyst/Utils/StaticAllocas.h"
+#include "Quantum/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace {
+
+constexpr StringRef QIS_PREFIX = "__catalyst__qis__";
+
+// Gate names in runtime opcode order; this must match `GateId` in runtime/include/Types.h.
+constexpr StringRef GATE_NAMES[] = {
+    "Identity",
+    "PauliX",
+    "PauliY",
+    "PauliZ",
+    "Hadamard",
+    "S",
+    "T",
+    "PhaseShift",
+    "RX",
+    "RY",
+    "RZ",
+    "Rot",
+    "CNOT",
+    "CY",
+    "CZ",
+    "SWAP",
+    "IsingXX",
+    "IsingYY",
+    "IsingXY",
+    "IsingZZ",
+    "SingleExcitation",
+    "DoubleExcitation",
+    "ControlledPhaseShift",
+    "CRX",
+    "CRY",
+    "CRZ",
+    "MS",
+    "CRot",
+    "CSWAP",
+    "Toffoli",
+    "MultiRZ",
+    "GlobalPhase",
+    "PCPhase",
+    "ISWAP",
+    "PSWAP",
+};
+
+struct BatchableGate {
+    LLVM::CallOp call;
+    int64_t opcode;
+    ValueRange params;
+    ValueRange wires;
+};
+
+/// Match a fixed-arity gate call without modifiers, i.e. a call of the form
+/// `__catalyst__qis__<Gate>(double..., ptr..., null)` as emitted by the QIR conversion patterns.
+std::optional<BatchableGate> matchBatchableGate(Operation *op)
+{
+    auto call = dyn_cast<LLVM::CallOp>(op);
+    if (!call || !call.getCallee() || call.getCallee()->size() <= QIS_PREFIX.size() ||
+        call.getVarCalleeType() || !call.getCallee()->starts_with(QIS_PREFIX)) {
+        return std::nullopt;
+    }
+
+    // Variadic gates (Identity, MultiRZ, PCPhase) are lowered to vararg calls and skipped above.
+    StringRef gateName = call.getCallee()->drop_front(QIS_PREFIX.size());
+    const auto *it = llvm::find(GATE_NAMES, gateName);
+    if (it == std::end(GATE_NAMES)) {
+        return std::nullopt;
+    }
+
+    ValueRange operands = call.getArgOperands();
+    if (operands.empty() || !operands.back().getDefiningOp<LLVM::ZeroOp>()) {
+        return std::nullopt;
+    }
+    operands = operands.drop_back();
+
+    size_t numParams = 0;
+    while (numParams < operands.size() && isa<Float64Type>(operands[numParams].getType())) {
+        numParams++;
+    }
+    ValueRange wires = operands.drop_front(numParams);
+    if (!llvm::all_of(wires.getTypes(), llvm::IsaPred<LLVM::LLVMPointerType>)) {
+        return std::nullopt;
+    }
+
+    return BatchableGate{call, std::distance(std::begin(GATE_NAMES), it),
+                         operands.take_front(numParams), wires};
+}
+
+/// Operations that may be interleaved with the gates of a batch. Batching moves them in front of
+/// the gates, which is only safe for operations that do not observe the device state.
+bool isTransparent(Operation *op)
+{
+    if (isMemoryEffectFree(op)) {
+        return true;
+    }
+
+    auto isQubitLookup = [](Operation *op) {
+        auto call = dyn_cast_or_null<LLVM::CallOp>(op);
+        return call && call.getCallee() &&
+               *call.getCallee() == "__catalyst__rt__array_get_element_ptr_1d";
+    };
+    if (isQubitLookup(op)) {
+        return true;
+    }
+    if (auto load = dyn_cast<LLVM::LoadOp>(op)) {
+        return isQubitLookup(load.getAddr().getDefiningOp());
+    }
+    return false;
+}
+
+Value createI64(IRRewriter &rewriter, Location loc, int64_t value)
+{
+    return LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(value));
+}
+
+/// Store `values` into a new stack buffer of element type `type`, or return a null pointer when
+/// there are none.
+Value createBuffer(IRRewriter &rewriter, Location loc, Type type, ArrayRef<Value> values)
+{
+    auto ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+    if (values.empty()) {
+        return LLVM::ZeroOp::create(rewriter, loc, ptrType);
+    }
+
+    Value buffer = catalyst::getStaticAlloca(loc, rewriter, type, values.size()).getResult();
+    for (auto [idx, value] : llvm::enumerate(values)) {
+        auto itemPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, type, buffer,
+                                           ArrayRef<LLVM::GEPArg>{static_cast<int32_t>(idx)},
+                                           LLVM::GEPNoWrapFlags::inbounds);
+        LLVM::StoreOp::create(rewriter, loc, value, itemPtr);
+    }
+    return buffer;
+}
+
+void emitBatch(IRRewriter &rewriter, ModuleOp mod, ArrayRef<BatchableGate> batch)
+{
+    MLIRContext *ctx = rewriter.getContext();
+    Location loc = batch.back().call.getLoc();
+
+    StringRef qirName = "__catalyst__qis__ApplyBatch";
+    Type i64Type = IntegerType::get(ctx, 64);
+    Type ptrType = LLVM::LLVMPointerType::get(ctx);
+    auto fnDecl = mod.lookupSymbol<LLVM::LLVMFuncOp>(qirName);
+    if (!fnDecl) {
+        OpBuilder::InsertionGuard guard(rewriter);
+        rewriter.setInsertionPointToStart(mod.getBody());
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx), {i64Type, ptrType, i64Type, ptrType, i64Type, ptrType});
+        fnDecl = LLVM::LLVMFuncOp::create(rewriter, loc, qirName, qirSignature);
+        catalyst::annotateRuntimeFunction(fnDecl);
+    }
+
+    // Every gate header is four i64 values: opcode, adjoint, number of params, number of wires.
+    rewriter.setInsertionPoint(batch.back().call);
+    SmallVector<Value> headers;
+    SmallVector<Value> params;
+    SmallVector<Value> wires;
+    for (const BatchableGate &gate : batch) {
+        headers.push_back(createI64(rewriter, loc, gate.opcode));
+        headers.push_back(createI64(rewriter, loc, 0));
+        headers.push_back(createI64(rewriter, loc, gate.params.size()));
+        headers.push_back(createI64(rewriter, loc, gate.wires.size()));
+        params.append(gate.params.begin(), gate.params.end());
+        wires.append(gate.wires.begin(), gate.wires.end());
+    }
+
+    SmallVector<Value> args = {
+        createI64(rewriter, loc, batch.size()),
+        createBuffer(rewriter, loc, i64Type, headers),
+        createI64(rewriter, loc, params.size()),
+        createBuffer(rewriter, loc, Float64Type::get(ctx), params),
+        createI64(rewriter, loc, wires.size()),
+        createBuffer(rewriter, loc, ptrType, wires),
+    };
+    LLVM::CallOp::create(rewriter, loc, fnDecl, args);
+
+    for (const BatchableGate &gate : batch) {
+        Operation *modifiers = gate.call.getArgOperands().back().getDefiningOp();
+        rewriter.eraseOp(gate.call);
+        if (modifiers->use_empty()) {
+            rewriter.eraseOp(modifiers);
+        }
+    }
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+void batchQIRGateCalls(Operation *root)
+{
+    SmallVector<SmallVector<BatchableGate>> batches;
+    root->walk([&](Block *block) {
+        SmallVector<BatchableGate> current;
+        auto flush = [&]() {
+            if (current.size() > 1) {
+                batches.push_back(std::move(current));
+            }
+            current.clear();
+        };
+
+        for (Operation &op : *block) {
+            if (auto gate = matchBatchableGate(&op)) {
+                current.push_back(*gate);
+            }
+            else if (!isTransparent(&op)) {
+                flush();
+            }
+        }
+        flush();
+    });
+
+    IRRewriter rewriter(root->getContext());
+    for (ArrayRef<BatchableGate> batch : batches) {
+        emitBatch(rewriter, batch.front().call->getParentOfType<ModuleOp>(), batch);
+    }
+}
+
+} // namespace quantum
+} // namespace catalyst
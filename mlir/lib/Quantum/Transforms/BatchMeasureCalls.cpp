@@ -0,0 +1,294 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <optional>
+#include <utility>
+
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "mlir/Dialect/LLVMIR/LLVMDialect.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+
+#include "Catalyst/Utils/RuntimeFunctionAttributes.h"
+#include "Catalyst/Utils/StaticAllocas.h"
+#include "Quantum/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace {
+
+constexpr StringRef MEASURE_BIT = "__catalyst__qis__MeasureBit";
+
+bool isMeasureBitCall(Operation *op)
+{
+    auto call = dyn_cast<LLVM::CallOp>(op);
+    return call && call.getCallee() && *call.getCallee() == MEASURE_BIT;
+}
+
+/// A straight-line run of measurements, together with the operations interleaved with them that
+/// depend on their outcomes and must therefore be moved after the batched call.
+struct MeasurementBatch {
+    SmallVector<LLVM::CallOp> calls;
+    SmallVector<Operation *> dependents;
+};
+
+bool isQubitLookup(Operation *op)
+{
+    auto call = dyn_cast_or_null<LLVM::CallOp>(op);
+    return call && call.getCallee() &&
+           *call.getCallee() == "__catalyst__rt__array_get_element_ptr_1d";
+}
+
+/// Operations that may be interleaved with the measurements of a batch without ending it: those
+/// that do not touch the device state, and qubit lookups.
+bool isTransparent(Operation *op)
+{
+    if (isMemoryEffectFree(op)) {
+        return true;
+    }
+    if (isQubitLookup(op)) {
+        return true;
+    }
+    if (auto load = dyn_cast<LLVM::LoadOp>(op)) {
+        return isQubitLookup(load.getAddr().getDefiningOp());
+    }
+    return false;
+}
+
+/// The register and index at which a qubit was looked up, without an index if it is dynamic.
+struct RegisterSlot {
+    Value reg;
+    std::optional<int64_t> index;
+};
+
+/// Get the register slot from which `wire` was loaded. The qubits of the slots of a register are
+/// extracted again after each insertion, as another value of the same qubit.
+std::optional<RegisterSlot> getRegisterSlot(Value wire)
+{
+    auto load = wire.getDefiningOp<LLVM::LoadOp>();
+    if (!load || !isQubitLookup(load.getAddr().getDefiningOp())) {
+        return std::nullopt;
+    }
+
+    auto lookup = cast<LLVM::CallOp>(load.getAddr().getDefiningOp());
+    RegisterSlot slot{lookup.getArgOperands()[0], std::nullopt};
+    APInt index;
+    if (matchPattern(lookup.getArgOperands()[1], m_ConstantInt(&index))) {
+        slot.index = index.getSExtValue();
+    }
+    return slot;
+}
+
+/// The qubits measured by a batch, by value and by register slot.
+class MeasuredQubits {
+    llvm::DenseSet<Value> wires;
+    llvm::DenseSet<std::pair<Value, int64_t>> slots;
+    // Registers with a measured slot, and those with a measured slot of a dynamic index
+    llvm::DenseSet<Value> registers;
+    llvm::DenseSet<Value> dynamicRegisters;
+
+  public:
+    /// Whether `wire` may be a qubit that is already measured.
+    bool contains(Value wire) const
+    {
+        std::optional<RegisterSlot> slot = getRegisterSlot(wire);
+        if (!slot) {
+            return wires.contains(wire);
+        }
+        if (!slot->index) {
+            return registers.contains(slot->reg);
+        }
+        return slots.contains({slot->reg, *slot->index}) || dynamicRegisters.contains(slot->reg);
+    }
+
+    void insert(Value wire)
+    {
+        wires.insert(wire);
+        if (std::optional<RegisterSlot> slot = getRegisterSlot(wire)) {
+            registers.insert(slot->reg);
+            if (slot->index) {
+                slots.insert({slot->reg, *slot->index});
+            }
+            else {
+                dynamicRegisters.insert(slot->reg);
+            }
+        }
+    }
+
+    void clear()
+    {
+        wires.clear();
+        slots.clear();
+        registers.clear();
+        dynamicRegisters.clear();
+    }
+};
+
+Value createI64(IRRewriter &rewriter, Location loc, int64_t value)
+{
+    return LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(value));
+}
+
+/// Store `values` into a new stack buffer of element type `type`.
+Value createBuffer(IRRewriter &rewriter, Location loc, Type type, ArrayRef<Value> values)
+{
+    auto ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+    Value buffer = catalyst::getStaticAlloca(loc, rewriter, type, values.size()).getResult();
+    for (auto [idx, value] : llvm::enumerate(values)) {
+        auto itemPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, type, buffer,
+                                           ArrayRef<LLVM::GEPArg>{static_cast<int32_t>(idx)},
+                                           LLVM::GEPNoWrapFlags::inbounds);
+        LLVM::StoreOp::create(rewriter, loc, value, itemPtr);
+    }
+    return buffer;
+}
+
+void emitBatch(IRRewriter &rewriter, ModuleOp mod, const MeasurementBatch &batch)
+{
+    MLIRContext *ctx = rewriter.getContext();
+    Location loc = batch.calls.back().getLoc();
+
+    StringRef qirName = "__catalyst__qis__MeasureBits";
+    Type i1Type = IntegerType::get(ctx, 1);
+    Type i32Type = IntegerType::get(ctx, 32);
+    Type i64Type = IntegerType::get(ctx, 64);
+    Type ptrType = LLVM::LLVMPointerType::get(ctx);
+    auto fnDecl = mod.lookupSymbol<LLVM::LLVMFuncOp>(qirName);
+    if (!fnDecl) {
+        OpBuilder::InsertionGuard guard(rewriter);
+        rewriter.setInsertionPointToStart(mod.getBody());
+        Type qirSignature = LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
+                                                        {i64Type, ptrType, ptrType, ptrType});
+        fnDecl = LLVM::LLVMFuncOp::create(rewriter, loc, qirName, qirSignature);
+        catalyst::annotateRuntimeFunction(fnDecl);
+    }
+
+    // The operands of every measurement dominate the last one, so the batch replaces it in place
+    rewriter.setInsertionPoint(batch.calls.back());
+    SmallVector<Value> wires, postselects;
+    for (LLVM::CallOp call : batch.calls) {
+        ValueRange operands = call.getArgOperands();
+        wires.push_back(operands[0]);
+        postselects.push_back(operands[1]);
+    }
+
+    // The outcome of measurement `i` is bit `i % 64` of word `i / 64`
+    int64_t numQubits = batch.calls.size();
+    int64_t numWords = (numQubits + 63) / 64;
+    Value bits = catalyst::getStaticAlloca(loc, rewriter, i64Type, numWords).getResult();
+    SmallVector<Value> args = {
+        createI64(rewriter, loc, numQubits),
+        createBuffer(rewriter, loc, ptrType, wires),
+        createBuffer(rewriter, loc, i32Type, postselects),
+        bits,
+    };
+    LLVM::CallOp::create(rewriter, loc, fnDecl, args);
+
+    SmallVector<Value> words;
+    for (int64_t idx = 0; idx < numWords; idx++) {
+        auto wordPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, i64Type, bits,
+                                           ArrayRef<LLVM::GEPArg>{static_cast<int32_t>(idx)},
+                                           LLVM::GEPNoWrapFlags::inbounds);
+        words.push_back(LLVM::LoadOp::create(rewriter, loc, i64Type, wordPtr));
+    }
+    for (auto [idx, call] : llvm::enumerate(batch.calls)) {
+        Value word = words[idx / 64];
+        if (idx % 64 != 0) {
+            word = LLVM::LShrOp::create(rewriter, loc, word, createI64(rewriter, loc, idx % 64));
+        }
+        Value result = LLVM::TruncOp::create(rewriter, loc, i1Type, word);
+        rewriter.replaceAllUsesWith(call.getResult(), result);
+    }
+
+    // Uses of the outcomes that were interleaved with the measurements now follow the batch, while
+    // those after the last measurement already do
+    Operation *insertionPoint = batch.calls.back();
+    for (Operation *dependent : batch.dependents) {
+        if (dependent->isBeforeInBlock(insertionPoint)) {
+            rewriter.moveOpBefore(dependent, insertionPoint);
+        }
+    }
+
+    for (LLVM::CallOp call : batch.calls) {
+        rewriter.eraseOp(call);
+    }
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+void batchQIRMeasureCalls(Operation *root)
+{
+    SmallVector<MeasurementBatch> batches;
+    root->walk([&](Block *block) {
+        MeasurementBatch current;
+        // Outcomes of the measurements of the current batch, and values computed from them
+        llvm::DenseSet<Value> tainted;
+        // Qubits measured by the current batch
+        MeasuredQubits measured;
+        auto flush = [&]() {
+            if (current.calls.size() > 1) {
+                batches.push_back(std::move(current));
+            }
+            current = MeasurementBatch();
+            tainted.clear();
+            measured.clear();
+        };
+        auto isTainted = [&](Operation *op) {
+            return llvm::any_of(op->getOperands(), [&](Value v) { return tainted.contains(v); });
+        };
+
+        for (Operation &op : *block) {
+            if (isMeasureBitCall(&op)) {
+                // Measuring a qubit of the batch again, or a qubit selected by an outcome of the
+                // batch, starts a new one
+                Value wire = op.getOperand(0);
+                if (isTainted(&op) || measured.contains(wire)) {
+                    flush();
+                }
+                current.calls.push_back(cast<LLVM::CallOp>(op));
+                tainted.insert(op.getResult(0));
+                measured.insert(wire);
+            }
+            else if (current.calls.empty()) {
+                continue;
+            }
+            else if (op.getNumRegions() == 0 && isTransparent(&op)) {
+                if (isTainted(&op)) {
+                    current.dependents.push_back(&op);
+                    tainted.insert(op.getResults().begin(), op.getResults().end());
+                }
+            }
+            else {
+                flush();
+            }
+        }
+        flush();
+    });
+
+    IRRewriter rewriter(root->getContext());
+    for (const MeasurementBatch &batch : batches) {
+        emitBatch(rewriter, batch.calls.front()->getParentOfType<ModuleOp>(), batch);
+    }
+}
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,266 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "batch-qnode-loops"
+
+#include <optional>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Catalyst/Utils/CallGraph.h"
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Transforms/Passes.h"
+#include "Quantum/Utils/QnodeCalls.h"
+
+using namespace mlir;
+using namespace catalyst;
+using namespace catalyst::quantum;
+
+namespace {
+
+/// Whether a function, or a function that it calls, initializes a device.
+bool initializesDevice(func::FuncOp funcOp)
+{
+    bool found = false;
+    traverseCallGraph(funcOp, /*symbolTable=*/nullptr, [&](func::FuncOp callee) {
+        found |= callee.walk([](DeviceInitOp) { return WalkResult::interrupt(); })
+                     .wasInterrupted();
+    });
+    return found;
+}
+
+/// The single device session of a qnode, which is initialized and released in its body, while
+/// the functions it calls use the device of the qnode.
+std::optional<std::pair<DeviceInitOp, DeviceReleaseOp>> getDeviceSession(func::FuncOp qnode)
+{
+    if (!qnode.getBody().hasOneBlock()) {
+        return std::nullopt;
+    }
+    SmallVector<DeviceInitOp> inits(qnode.getOps<DeviceInitOp>());
+    SmallVector<DeviceReleaseOp> releases(qnode.getOps<DeviceReleaseOp>());
+    if (inits.size() != 1 || releases.size() != 1 ||
+        !inits.front()->isBeforeInBlock(releases.front())) {
+        return std::nullopt;
+    }
+
+    // Devices initialized in nested regions or in the callees would need a session of their own
+    size_t numDevices = 0;
+    bool calleeDevice = false;
+    qnode.walk([&](Operation *op) {
+        if (isa<DeviceInitOp, DeviceReleaseOp>(op)) {
+            numDevices++;
+        }
+        else if (auto callOp = dyn_cast<func::CallOp>(op)) {
+            auto callee = SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(
+                callOp, callOp.getCalleeAttr());
+            calleeDevice |= !callee || initializesDevice(callee);
+        }
+    });
+    if (numDevices != 2 || calleeDevice) {
+        return std::nullopt;
+    }
+    return std::make_pair(inits.front(), releases.front());
+}
+
+/// Get the value of the shots of the session device before the loop, from a constant or from an
+/// argument of the qnode that the loop does not define.
+std::optional<Value> getLoopInvariantShots(OpBuilder &builder, scf::ForOp forOp,
+                                           func::CallOp callOp, DeviceInitOp deviceOp)
+{
+    Value shots = deviceOp.getShots();
+    if (!shots) {
+        return Value();
+    }
+    if (auto arg = dyn_cast<BlockArgument>(shots)) {
+        Value operand = callOp.getArgOperands()[arg.getArgNumber()];
+        if (!forOp.isDefinedOutsideOfLoop(operand)) {
+            return std::nullopt;
+        }
+        return operand;
+    }
+    if (auto constOp = shots.getDefiningOp<arith::ConstantOp>()) {
+        return builder.clone(*constOp)->getResult(0);
+    }
+    return std::nullopt;
+}
+
+/// Declare the runtime function `fnName` if it is missing, and call it.
+void callRuntime(OpBuilder &builder, ModuleOp mod, Location loc, StringRef fnName,
+                 ValueRange args)
+{
+    auto fnDecl = mod.lookupSymbol<func::FuncOp>(fnName);
+    if (!fnDecl) {
+        OpBuilder::InsertionGuard guard(builder);
+        builder.setInsertionPointToStart(mod.getBody());
+        fnDecl = func::FuncOp::create(builder, loc, fnName,
+                                      builder.getFunctionType(args.getTypes(), {}));
+        fnDecl.setPrivate();
+    }
+    func::CallOp::create(builder, loc, fnDecl, args);
+}
+
+/// Get the number of iterations of a loop as an i64.
+Value getTripCount(OpBuilder &builder, scf::ForOp forOp)
+{
+    Location loc = forOp.getLoc();
+    Value span = arith::SubIOp::create(builder, loc, forOp.getUpperBound(), forOp.getLowerBound());
+    Value count = arith::CeilDivSIOp::create(builder, loc, span, forOp.getStep());
+    Value zero = arith::ConstantOp::create(builder, loc, builder.getZeroAttr(count.getType()));
+    count = arith::MaxSIOp::create(builder, loc, count, zero);
+    if (count.getType().isIndex()) {
+        count = arith::IndexCastOp::create(builder, loc, builder.getI64Type(), count);
+    }
+    else if (!count.getType().isInteger(64)) {
+        count = arith::ExtSIOp::create(builder, loc, builder.getI64Type(), count);
+    }
+    return count;
+}
+
+class QnodeLoopBatcher {
+  private:
+    ModuleOp mod;
+    SymbolTable symbolTable;
+
+    // The copies of the qnodes that run in the device session of their caller
+    llvm::DenseMap<func::FuncOp, func::FuncOp> sessionQnodes;
+
+    /// Get the copy of a qnode without its device initialization and release.
+    func::FuncOp getSessionQnode(func::FuncOp qnode)
+    {
+        if (func::FuncOp sessionQnode = sessionQnodes.lookup(qnode)) {
+            return sessionQnode;
+        }
+        func::FuncOp sessionQnode = qnode.clone();
+        sessionQnode.setSymName((qnode.getSymName() + ".batched").str());
+        // The copy is a regular function called in a loop, that qnode passes must not execute as
+        // a qnode of its own.
+        sessionQnode->removeAttr("quantum.node");
+        sessionQnode->removeAttr("qnode");
+        symbolTable.insert(sessionQnode, std::next(Block::iterator(qnode)));
+        for (auto deviceOp : llvm::make_early_inc_range(sessionQnode.getOps<DeviceInitOp>())) {
+            deviceOp.erase();
+        }
+        for (auto releaseOp :
+             llvm::make_early_inc_range(sessionQnode.getOps<DeviceReleaseOp>())) {
+            releaseOp.erase();
+        }
+        sessionQnodes[qnode] = sessionQnode;
+        return sessionQnode;
+    }
+
+  public:
+    explicit QnodeLoopBatcher(ModuleOp mod) : mod(mod), symbolTable(mod) {}
+
+    /// Run the qnode called in a loop in a single device session around the loop.
+    bool batchLoop(scf::ForOp forOp)
+    {
+        func::CallOp qnodeCall;
+        func::FuncOp qnode;
+        bool valid = true;
+        forOp.getBody()->walk([&](Operation *op) {
+            if (isa<DeviceInitOp>(op)) {
+                valid = false;
+            }
+            auto callOp = dyn_cast<func::CallOp>(op);
+            if (!callOp) {
+                return;
+            }
+            auto callee = symbolTable.lookup<func::FuncOp>(callOp.getCallee());
+            if (!callee || !initializesDevice(callee)) {
+                return;
+            }
+            valid &= !qnodeCall && callOp->getBlock() == forOp.getBody() &&
+                     getQnodeCalls(callee, mod).has_value();
+            qnodeCall = callOp;
+            qnode = callee;
+        });
+        if (!valid || !qnodeCall) {
+            return false;
+        }
+        auto session = getDeviceSession(qnode);
+        if (!session) {
+            return false;
+        }
+        auto [deviceOp, releaseOp] = *session;
+
+        OpBuilder builder(forOp);
+        Location loc = forOp.getLoc();
+        std::optional<Value> shots = getLoopInvariantShots(builder, forOp, qnodeCall, deviceOp);
+        if (!shots) {
+            return false;
+        }
+        IRMapping mapping;
+        if (*shots) {
+            mapping.map(deviceOp.getShots(), *shots);
+        }
+        builder.clone(*deviceOp, mapping);
+        callRuntime(builder, mod, loc, "__catalyst__rt__device_start_batch",
+                    getTripCount(builder, forOp));
+
+        builder.setInsertionPointAfter(forOp);
+        callRuntime(builder, mod, loc, "__catalyst__rt__device_end_batch", ValueRange{});
+        builder.clone(*releaseOp);
+
+        qnodeCall.setCallee(getSessionQnode(qnode).getSymName());
+        return true;
+    }
+};
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_BATCHQNODELOOPSPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct BatchQnodeLoopsPass : impl::BatchQnodeLoopsPassBase<BatchQnodeLoopsPass> {
+    using BatchQnodeLoopsPassBase::BatchQnodeLoopsPassBase;
+
+    void runOnOperation() final
+    {
+        ModuleOp mod = getOperation();
+        QnodeLoopBatcher batcher(mod);
+
+        // Loops are visited innermost first, so that the device of an inner loop is not batched
+        // again by the loops around it. The loops of functions with a device of their own, e.g.
+        // qnodes, already run in a device session.
+        SmallVector<scf::ForOp> loops;
+        for (auto funcOp : mod.getOps<func::FuncOp>()) {
+            if (funcOp.walk([](DeviceInitOp) { return WalkResult::interrupt(); })
+                    .wasInterrupted()) {
+                continue;
+            }
+            funcOp.walk([&](scf::ForOp forOp) { loops.push_back(forOp); });
+        }
+        bool changed = false;
+        for (scf::ForOp forOp : loops) {
+            changed |= batcher.batchLoop(forOp);
+        }
+        if (!changed) {
+            markAllAnalysesPreserved();
+        }
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,212 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "commutation-cancellation-pattern"
+
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Transforms/Patterns.h"
+
+using llvm::dbgs;
+using namespace mlir;
+using namespace catalyst::quantum;
+
+namespace {
+
+// The basis in which a gate acts on one of its qubits. Two gates commute if, on each qubit they
+// share, they act in the same basis or one of them acts trivially. For example, the control of a
+// CNOT acts in the Z basis, so Z rotations commute through it.
+enum class WireBasis { Any, Z, X, Y, None };
+
+const llvm::StringMap<SmallVector<WireBasis, 3>> gateWireBases = {
+    {"Identity", {WireBasis::Any}},
+    {"PauliZ", {WireBasis::Z}},
+    {"Z", {WireBasis::Z}},
+    {"S", {WireBasis::Z}},
+    {"T", {WireBasis::Z}},
+    {"RZ", {WireBasis::Z}},
+    {"PhaseShift", {WireBasis::Z}},
+    {"PauliX", {WireBasis::X}},
+    {"X", {WireBasis::X}},
+    {"SX", {WireBasis::X}},
+    {"RX", {WireBasis::X}},
+    {"PauliY", {WireBasis::Y}},
+    {"Y", {WireBasis::Y}},
+    {"RY", {WireBasis::Y}},
+    {"CNOT", {WireBasis::Z, WireBasis::X}},
+    {"CY", {WireBasis::Z, WireBasis::Y}},
+    {"CZ", {WireBasis::Z, WireBasis::Z}},
+    {"CRX", {WireBasis::Z, WireBasis::X}},
+    {"CRY", {WireBasis::Z, WireBasis::Y}},
+    {"CRZ", {WireBasis::Z, WireBasis::Z}},
+    {"ControlledPhaseShift", {WireBasis::Z, WireBasis::Z}},
+    {"IsingXX", {WireBasis::X, WireBasis::X}},
+    {"IsingYY", {WireBasis::Y, WireBasis::Y}},
+    {"IsingZZ", {WireBasis::Z, WireBasis::Z}},
+    {"Toffoli", {WireBasis::Z, WireBasis::Z, WireBasis::X}}};
+
+const StringSet<> hermitianOps = {"Identity", "Hadamard", "PauliX", "PauliY", "PauliZ",
+                                  "X",        "Y",        "Z",      "CNOT",   "CY",
+                                  "CZ",       "SWAP",     "Toffoli"};
+
+const StringSet<> additiveRotationsSet = {"RX",  "RY",  "RZ",  "PhaseShift", "CRX",     "CRY",
+                                          "CRZ", "ControlledPhaseShift",      "IsingXX", "IsingYY",
+                                          "IsingZZ"};
+
+// Bound on the number of gates looked through on each wire, to keep the rewrite linear
+constexpr unsigned maxCommutingGates = 64;
+
+// Returns the basis in which the gate acts on the qubit at `position` of its qubit operands.
+WireBasis getWireBasis(QuantumGate gate, unsigned position)
+{
+    // Control qubits are only acted on through projectors on the computational basis
+    size_t numNonCtrlQubits = gate.getNonCtrlQubitOperands().size();
+    if (position >= numNonCtrlQubits) {
+        return WireBasis::Z;
+    }
+
+    if (isa<MultiRZOp>(gate)) {
+        return WireBasis::Z;
+    }
+
+    if (auto op = dyn_cast<CustomOp>(gate.getOperation())) {
+        auto it = gateWireBases.find(op.getGateName());
+        if (it != gateWireBases.end() && it->second.size() == numNonCtrlQubits) {
+            return it->second[position];
+        }
+    }
+    return WireBasis::None;
+}
+
+bool commute(WireBasis lhs, WireBasis rhs)
+{
+    if (lhs == WireBasis::Any || rhs == WireBasis::Any) {
+        return true;
+    }
+    return lhs == rhs && lhs != WireBasis::None;
+}
+
+// Walks back from the qubit value through the gates that commute with `op` on this wire, and
+// returns the first gate that does not. `resultIndex` is set to the position of the qubit in the
+// results of the returned gate.
+Operation *findPrecedingGate(CustomOp op, Value qubit, WireBasis basis, unsigned &resultIndex)
+{
+    for (unsigned step = 0; step <= maxCommutingGates; step++) {
+        auto gate = dyn_cast_or_null<QuantumGate>(qubit.getDefiningOp());
+        if (!gate || gate->getBlock() != op->getBlock()) {
+            return nullptr;
+        }
+
+        unsigned position = cast<OpResult>(qubit).getResultNumber();
+        auto customGate = dyn_cast<CustomOp>(gate.getOperation());
+        if (customGate && customGate.getGateName() == op.getGateName()) {
+            resultIndex = position;
+            return gate;
+        }
+
+        if (!commute(basis, getWireBasis(gate, position))) {
+            return nullptr;
+        }
+        qubit = gate.getQubitOperands()[position];
+    }
+    return nullptr;
+}
+
+struct CommutingGatesRewritePattern : public OpRewritePattern<CustomOp> {
+    using OpRewritePattern<CustomOp>::OpRewritePattern;
+
+    /// Cancel a gate with a preceding inverse gate, or merge a rotation into a preceding rotation
+    /// of the same kind, when all the gates in between commute with it. The gates in between are
+    /// found by following each qubit back through the gates that act in the same basis on it, so
+    /// for example in
+    ///     CNOT(q0, q1) -- RZ(q0) -- CNOT(q0, q1)
+    /// the two CNOTs cancel, since the RZ commutes with the control of the second CNOT.
+    LogicalResult matchAndRewrite(CustomOp op, PatternRewriter &rewriter) const override
+    {
+        StringRef gateName = op.getGateName();
+        bool isHermitian = hermitianOps.contains(gateName);
+        bool isRotation = additiveRotationsSet.contains(gateName);
+        if (!gateWireBases.contains(gateName) && !isHermitian) {
+            return failure();
+        }
+
+        auto gate = cast<QuantumGate>(op.getOperation());
+        std::vector<Value> inQubits = gate.getQubitOperands();
+
+        // All qubits must lead back to the same gate, at the same positions
+        CustomOp parentOp;
+        for (auto [position, qubit] : llvm::enumerate(inQubits)) {
+            unsigned resultIndex;
+            Operation *preceding =
+                findPrecedingGate(op, qubit, getWireBasis(gate, position), resultIndex);
+            if (!preceding || resultIndex != position || (parentOp && preceding != parentOp)) {
+                return failure();
+            }
+            parentOp = cast<CustomOp>(preceding);
+        }
+
+        if (parentOp.getInQubits().size() != op.getInQubits().size() ||
+            !llvm::equal(parentOp.getInCtrlValues(), op.getInCtrlValues())) {
+            return failure();
+        }
+
+        // Parameters are compared as SSA values, which relies on CSE having run before
+        bool sameParams = llvm::equal(parentOp.getParams(), op.getParams());
+        bool oneAdjoint = parentOp.getAdjoint() != op.getAdjoint();
+        auto parentGate = cast<QuantumGate>(parentOp.getOperation());
+
+        if ((isHermitian && op.getParams().empty()) || (oneAdjoint && sameParams)) {
+            LLVM_DEBUG(dbgs() << "Cancelling across commuting gates:\n"
+                              << parentOp << "\n"
+                              << op << "\n");
+            rewriter.replaceOp(op, inQubits);
+            rewriter.replaceOp(parentOp, parentGate.getQubitOperands());
+            return success();
+        }
+
+        if (isRotation && !oneAdjoint) {
+            LLVM_DEBUG(dbgs() << "Merging across commuting gates:\n"
+                              << parentOp << "\n"
+                              << op << "\n");
+            rewriter.setInsertionPoint(op);
+            SmallVector<Value> sumParams;
+            for (auto [param, parentParam] : llvm::zip(op.getParams(), parentOp.getParams())) {
+                sumParams.push_back(
+                    arith::AddFOp::create(rewriter, op.getLoc(), parentParam, param).getResult());
+            }
+            rewriter.modifyOpInPlace(op, [&]() { op.getParamsMutable().assign(sumParams); });
+            rewriter.replaceOp(parentOp, parentGate.getQubitOperands());
+            return success();
+        }
+
+        return failure();
+    }
+};
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+void populateCommutationCancellationPatterns(RewritePatternSet &patterns)
+{
+    patterns.add<CommutingGatesRewritePattern>(patterns.getContext(), 1);
+}
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,127 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "compact-qubit-registers"
+
+#include <map>
+#include <optional>
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Transforms/Passes.h"
+
+using llvm::dbgs;
+using namespace mlir;
+using namespace catalyst;
+using namespace catalyst::quantum;
+
+namespace {
+
+/// Collect the wires of the register allocated by `allocOp` that the program accesses, mapped to
+/// their index in the compacted register. Fails if the register is used by anything else than
+/// extractions and insertions at static indices, and deallocation, which would depend on its size.
+std::optional<std::map<int64_t, int64_t>> getUsedWires(AllocOp allocOp,
+                                                        SmallVector<Operation *> &indexingOps)
+{
+    std::map<int64_t, int64_t> wires;
+    SmallVector<Value> worklist{allocOp.getQreg()};
+    while (!worklist.empty()) {
+        Value qreg = worklist.pop_back_val();
+        for (Operation *user : qreg.getUsers()) {
+            if (auto extractOp = dyn_cast<ExtractOp>(user)) {
+                if (!extractOp.getIdxAttr().has_value()) {
+                    return std::nullopt;
+                }
+                wires[*extractOp.getIdxAttr()] = 0;
+                indexingOps.push_back(extractOp);
+            }
+            else if (auto insertOp = dyn_cast<InsertOp>(user)) {
+                if (!insertOp.getIdxAttr().has_value() || insertOp.getInQreg() != qreg) {
+                    return std::nullopt;
+                }
+                wires[*insertOp.getIdxAttr()] = 0;
+                indexingOps.push_back(insertOp);
+                worklist.push_back(insertOp.getOutQreg());
+            }
+            else if (!isa<DeallocOp>(user)) {
+                return std::nullopt;
+            }
+        }
+    }
+
+    int64_t index = 0;
+    for (auto &[wire, compactedWire] : wires) {
+        compactedWire = index++;
+    }
+    return wires;
+}
+
+/// Shrink a register to the wires that the program accesses, so that the device simulates fewer
+/// qubits.
+void compactRegister(AllocOp allocOp)
+{
+    if (!allocOp.getNqubitsAttr().has_value()) {
+        return;
+    }
+    int64_t numQubits = *allocOp.getNqubitsAttr();
+
+    SmallVector<Operation *> indexingOps;
+    std::optional<std::map<int64_t, int64_t>> wires = getUsedWires(allocOp, indexingOps);
+    if (!wires || static_cast<int64_t>(wires->size()) >= numQubits) {
+        return;
+    }
+
+    LLVM_DEBUG(dbgs() << "compacting " << numQubits << " qubits to " << wires->size() << "\n");
+    allocOp.setNqubitsAttr(wires->size());
+    for (Operation *op : indexingOps) {
+        if (auto extractOp = dyn_cast<ExtractOp>(op)) {
+            extractOp.setIdxAttr(wires->at(*extractOp.getIdxAttr()));
+        }
+        else {
+            auto insertOp = cast<InsertOp>(op);
+            insertOp.setIdxAttr(wires->at(*insertOp.getIdxAttr()));
+        }
+    }
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_COMPACTQUBITREGISTERSPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct CompactQubitRegistersPass : impl::CompactQubitRegistersPassBase<CompactQubitRegistersPass> {
+    using CompactQubitRegistersPassBase::CompactQubitRegistersPassBase;
+
+    void runOnOperation() final
+    {
+        getOperation()->walk([](func::FuncOp funcOp) {
+            // The number of qubits of the device is observable
+            if (funcOp.walk([](NumQubitsOp) { return WalkResult::interrupt(); }).wasInterrupted()) {
+                return;
+            }
+            funcOp.walk([](AllocOp allocOp) { compactRegister(allocOp); });
+        });
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -12,12 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <optional>
 #include <string>
 
 #include "mlir/Dialect/LLVMIR/FunctionCallUtils.h"
 #include "mlir/Dialect/LLVMIR/LLVMDialect.h"
 #include "mlir/IR/BuiltinAttributes.h"
 #include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
 #include "mlir/Transforms/DialectConversion.h"
 
 #include "Catalyst/Utils/EnsureFunctionDeclaration.h"
@@ -48,41 +51,85 @@ Value getGlobalString(Location loc, OpBuilder &rewriter, StringRef key, StringRe
                                ArrayRef<LLVM::GEPArg>{0, 0}, LLVM::GEPNoWrapFlags::inbounds);
 }
 
-Value getPauliProductPtr(Location loc, OpBuilder &rewriter, ModuleOp mod, ArrayAttr pauliProduct)
+Value getPackedPauliWordPtr(Location loc, OpBuilder &rewriter, ModuleOp mod,
+                            ArrayAttr pauliProduct)
 {
+    // The X masks then the Z masks, with qubit `i` at bit `i % 64` of word `i / 64` of each
+    const size_t numWords = (pauliProduct.size() + 63) / 64;
+    SmallVector<uint64_t> masks(2 * numWords, 0);
     std::string pauliWord;
-    for (Attribute attr : pauliProduct) {
-        pauliWord += cast<StringAttr>(attr).getValue().str();
+    for (auto [i, attr] : llvm::enumerate(pauliProduct)) {
+        StringRef pauli = cast<StringAttr>(attr).getValue();
+        pauliWord += pauli.str();
+        const uint64_t bit = uint64_t{1} << (i % 64);
+        if (pauli == "X" || pauli == "Y") {
+            masks[i / 64] |= bit;
+        }
+        if (pauli == "Z" || pauli == "Y") {
+            masks[numWords + i / 64] |= bit;
+        }
     }
-    std::string pauliWordKey = "pauli_word_" + pauliWord;
-    return getGlobalString(loc, rewriter, pauliWordKey,
-                           StringRef(pauliWord.c_str(), pauliWord.length() + 1), mod);
+
+    std::string key = "pauli_masks_" + pauliWord;
+    LLVM::GlobalOp glb = mod.lookupSymbol<LLVM::GlobalOp>(key);
+    if (!glb) {
+        OpBuilder::InsertionGuard guard(rewriter); // to reset the insertion point
+        rewriter.setInsertionPointToStart(mod.getBody());
+        auto type = LLVM::LLVMArrayType::get(rewriter.getI64Type(), masks.size());
+        auto tensorType =
+            RankedTensorType::get({static_cast<int64_t>(masks.size())}, rewriter.getI64Type());
+        glb = LLVM::GlobalOp::create(rewriter, loc, type, true, LLVM::Linkage::Internal, key,
+                                     DenseElementsAttr::get(tensorType, ArrayRef<uint64_t>(masks)));
+    }
+    return LLVM::AddressOfOp::create(rewriter, loc, glb);
+}
+
+/**
+ * @brief Store the qubit operands of a QIR call into an array on stack and return a pointer to
+ * it, or a null pointer if there are none. Used by the `_array` variants of the variadic QIR
+ * entry points, which take the qubits as a pointer and a length.
+ */
+static Value getQubitArrayPtr(Location loc, RewriterBase &rewriter, ValueRange qubits)
+{
+    Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+    if (qubits.empty()) {
+        return LLVM::ZeroOp::create(rewriter, loc, ptrType);
+    }
+
+    Value arrayPtr = catalyst::getStaticAlloca(loc, rewriter, ptrType, qubits.size()).getResult();
+    for (int i = 0; static_cast<size_t>(i) < qubits.size(); i++) {
+        auto itemPtr =
+            LLVM::GEPOp::create(rewriter, loc, ptrType, ptrType, arrayPtr,
+                                llvm::ArrayRef<LLVM::GEPArg>{i}, LLVM::GEPNoWrapFlags::inbounds);
+        LLVM::StoreOp::create(rewriter, loc, qubits[i], itemPtr);
+    }
+    return arrayPtr;
 }
 
 void createPauliRotCall(Location loc, ConversionPatternRewriter &rewriter, Operation *op,
-                        Value pauliWordPtr, Value thetaValue, Value modifiersPtr, Value cond,
+                        Value pauliMasksPtr, Value thetaValue, Value modifiersPtr, Value cond,
                         ValueRange inQubits)
 {
     MLIRContext *ctx = rewriter.getContext();
-    StringRef qirName = "__catalyst__qis__PauliRot";
+    StringRef qirName = "__catalyst__qis__PackedPauliRot_array";
     Type ptrType = LLVM::LLVMPointerType::get(ctx);
-    Type qirSignature =
-        LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
-                                    {ptrType, Float64Type::get(ctx), ptrType,
-                                     IntegerType::get(ctx, 1), IntegerType::get(ctx, 64)},
-                                    /*isVarArg=*/true);
+    Type qirSignature = LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
+                                                    {ptrType, Float64Type::get(ctx), ptrType,
+                                                     IntegerType::get(ctx, 1),
+                                                     IntegerType::get(ctx, 64), ptrType});
 
     LLVM::LLVMFuncOp fnDecl =
         catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(rewriter, op, qirName, qirSignature);
 
     int64_t numQubits = inQubits.size();
+    Value qubitsPtr = getQubitArrayPtr(loc, rewriter, inQubits);
     SmallVector<Value> args;
-    args.push_back(pauliWordPtr);
+    args.push_back(pauliMasksPtr);
     args.push_back(thetaValue);
     args.push_back(modifiersPtr);
     args.push_back(cond);
     args.push_back(LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(numQubits)));
-    args.append(inQubits.begin(), inQubits.end());
+    args.push_back(qubitsPtr);
 
     LLVM::CallOp::create(rewriter, loc, fnDecl, args);
 }
@@ -96,7 +143,59 @@ constexpr int64_t UNKNOWN = ShapedType::kDynamic;
 constexpr int32_t NO_POSTSELECT = -1;
 
 /**
- * @brief Initialize and fill the  `struct Modifiers` on stack return a pointer to it.
+ * @brief Get a pointer to a constant `struct Modifiers` with only the adjoint flag set, which is
+ * shared by all the uncontrolled adjoint gates of the module.
+ */
+Value getAdjointModifiersPtr(Location loc, RewriterBase &rewriter, Type structType)
+{
+    auto mod = rewriter.getInsertionBlock()->getParent()->getParentOfType<ModuleOp>();
+    StringRef key = "adjoint_modifiers";
+    LLVM::GlobalOp glb = mod.lookupSymbol<LLVM::GlobalOp>(key);
+    if (!glb) {
+        OpBuilder::InsertionGuard guard(rewriter); // to reset the insertion point
+        rewriter.setInsertionPointToStart(mod.getBody());
+        glb = LLVM::GlobalOp::create(rewriter, loc, structType, true, LLVM::Linkage::Internal, key,
+                                     Attribute());
+        rewriter.createBlock(&glb.getInitializerRegion());
+        Value modifiers = LLVM::ZeroOp::create(rewriter, loc, structType);
+        Value adjointVal = LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(true));
+        modifiers = LLVM::InsertValueOp::create(rewriter, loc, modifiers, adjointVal,
+                                                ArrayRef<int64_t>{0});
+        LLVM::ReturnOp::create(rewriter, loc, modifiers);
+    }
+    return LLVM::AddressOfOp::create(rewriter, loc, glb);
+}
+
+/**
+ * @brief Get a pointer to a constant array of the controlled values, shared by all the gates of
+ * the module with the same controlled values, if they are all static.
+ */
+std::optional<Value> getStaticControlledValuesPtr(Location loc, RewriterBase &rewriter,
+                                                  ValueRange controlledValues)
+{
+    std::string values;
+    for (Value value : controlledValues) {
+        APInt constant;
+        if (!matchPattern(value, m_ConstantInt(&constant))) {
+            return std::nullopt;
+        }
+        values.push_back(constant.isZero() ? 0 : 1);
+    }
+    std::string key = "controlled_values_";
+    for (char value : values) {
+        key.push_back(value ? '1' : '0');
+    }
+    auto mod = rewriter.getInsertionBlock()->getParent()->getParentOfType<ModuleOp>();
+    return getGlobalString(loc, rewriter, key, values, mod);
+}
+
+/**
+ * @brief Get a pointer to the `struct Modifiers` of a gate.
+ *
+ * There are no modifiers for gates that are neither adjoint nor controlled, whose pointer is null,
+ * and the modifiers of uncontrolled adjoint gates are a constant global. The modifiers of
+ * controlled gates are filled on stack, since the controlled qubits are only known at runtime,
+ * but their controlled values are a constant global if they are static.
  *
  * @param loc MLIR Location object
  * @param rewriter MLIR OpBuilder object
@@ -117,15 +216,16 @@ Value getModifiersPtr(Location loc, RewriterBase &rewriter, const TypeConverter
     auto sizeType = IntegerType::get(ctx, 64);
 
     auto ptrType = LLVM::LLVMPointerType::get(ctx);
+    auto structType = LLVM::LLVMStructType::getLiteral(ctx, {boolType, sizeType, ptrType, ptrType});
 
-    Value nullPtr = LLVM::ZeroOp::create(rewriter, loc, ptrType);
-
-    if (!adjoint && controlledQubits.empty() && controlledValues.empty()) {
-        return nullPtr;
+    if (controlledQubits.empty()) {
+        if (adjoint) {
+            return getAdjointModifiersPtr(loc, rewriter, structType);
+        }
+        return LLVM::ZeroOp::create(rewriter, loc, ptrType);
     }
 
     auto adjointVal = LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(adjoint));
-    auto structType = LLVM::LLVMStructType::getLiteral(ctx, {boolType, sizeType, ptrType, ptrType});
     auto modifiersPtr = catalyst::getStaticAlloca(loc, rewriter, structType, 1).getResult();
     auto adjointPtr =
         LLVM::GEPOp::create(rewriter, loc, ptrType, structType, modifiersPtr,
@@ -140,28 +240,28 @@ Value getModifiersPtr(Location loc, RewriterBase &rewriter, const TypeConverter
         LLVM::GEPOp::create(rewriter, loc, ptrType, structType, modifiersPtr,
                             llvm::ArrayRef<LLVM::GEPArg>{0, 3}, LLVM::GEPNoWrapFlags::inbounds);
 
-    Value ctrlPtr = nullPtr;
-    Value valuePtr = nullPtr;
-    if (!controlledQubits.empty()) {
-        ctrlPtr =
-            catalyst::getStaticAlloca(loc, rewriter, ptrType, controlledQubits.size()).getResult();
-        valuePtr =
-            catalyst::getStaticAlloca(loc, rewriter, boolType, controlledQubits.size()).getResult();
-        for (int i = 0; static_cast<size_t>(i) < controlledQubits.size(); i++) {
-            {
-                auto itemPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, ptrType, ctrlPtr,
-                                                   llvm::ArrayRef<LLVM::GEPArg>{i},
-                                                   LLVM::GEPNoWrapFlags::inbounds);
-                auto qubit = controlledQubits[i];
-                LLVM::StoreOp::create(rewriter, loc, qubit, itemPtr);
-            }
-            {
-                auto itemPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, boolType, valuePtr,
-                                                   llvm::ArrayRef<LLVM::GEPArg>{i},
-                                                   LLVM::GEPNoWrapFlags::inbounds);
-                auto value = controlledValues[i];
-                LLVM::StoreOp::create(rewriter, loc, value, itemPtr);
-            }
+    Value ctrlPtr =
+        catalyst::getStaticAlloca(loc, rewriter, ptrType, controlledQubits.size()).getResult();
+    std::optional<Value> staticValuePtr =
+        getStaticControlledValuesPtr(loc, rewriter, controlledValues);
+    Value valuePtr = staticValuePtr ? *staticValuePtr
+                                    : catalyst::getStaticAlloca(loc, rewriter, boolType,
+                                                                controlledQubits.size())
+                                          .getResult();
+    for (int i = 0; static_cast<size_t>(i) < controlledQubits.size(); i++) {
+        {
+            auto itemPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, ptrType, ctrlPtr,
+                                               llvm::ArrayRef<LLVM::GEPArg>{i},
+                                               LLVM::GEPNoWrapFlags::inbounds);
+            auto qubit = controlledQubits[i];
+            LLVM::StoreOp::create(rewriter, loc, qubit, itemPtr);
+        }
+        if (!staticValuePtr) {
+            auto itemPtr = LLVM::GEPOp::create(rewriter, loc, ptrType, boolType, valuePtr,
+                                               llvm::ArrayRef<LLVM::GEPArg>{i},
+                                               LLVM::GEPNoWrapFlags::inbounds);
+            auto value = controlledValues[i];
+            LLVM::StoreOp::create(rewriter, loc, value, itemPtr);
         }
     }
 
@@ -611,22 +711,24 @@ struct MultiRZOpPattern : public OpConversionPattern<MultiRZOp> {
         auto modifiersPtr = getModifiersPtr(loc, rewriter, conv, op.getAdjointFlag(),
                                             adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
 
-        std::string qirName = "__catalyst__qis__MultiRZ";
-        Type qirSignature = LLVM::LLVMFunctionType::get(
-            LLVM::LLVMVoidType::get(ctx),
-            {Float64Type::get(ctx), modifiersPtr.getType(), IntegerType::get(ctx, 64)},
-            /*isVarArg=*/true);
+        std::string qirName = "__catalyst__qis__MultiRZ_array";
+        Type qirSignature = LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
+                                                        {Float64Type::get(ctx),
+                                                         modifiersPtr.getType(),
+                                                         IntegerType::get(ctx, 64),
+                                                         LLVM::LLVMPointerType::get(ctx)});
 
         LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
             rewriter, op, qirName, qirSignature);
 
         int64_t numQubits = op.getOutQubits().size();
+        Value qubitsPtr = getQubitArrayPtr(loc, rewriter, adaptor.getInQubits());
         SmallVector<Value> args;
         args.insert(args.end(), adaptor.getTheta());
         args.insert(args.end(), modifiersPtr);
         args.insert(args.end(),
                     LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(numQubits)));
-        args.insert(args.end(), adaptor.getInQubits().begin(), adaptor.getInQubits().end());
+        args.insert(args.end(), qubitsPtr);
         LLVM::CallOp::create(rewriter, loc, fnDecl, args);
 
         SmallVector<Value> values;
@@ -651,12 +753,12 @@ struct PauliRotOpPattern : public OpConversionPattern<PauliRotOp> {
         auto modifiersPtr = getModifiersPtr(loc, rewriter, conv, op.getAdjointFlag(),
                                             adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
 
-        Value pauliWordPtr = getPauliProductPtr(loc, rewriter, mod, op.getPauliProduct());
+        Value pauliMasksPtr = getPackedPauliWordPtr(loc, rewriter, mod, op.getPauliProduct());
         Value thetaValue = adaptor.getAngle();
         Value cond = LLVM::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(true));
 
-        createPauliRotCall(loc, rewriter, op.getOperation(), pauliWordPtr, thetaValue, modifiersPtr,
-                           cond, adaptor.getInQubits());
+        createPauliRotCall(loc, rewriter, op.getOperation(), pauliMasksPtr, thetaValue,
+                           modifiersPtr, cond, adaptor.getInQubits());
 
         SmallVector<Value> values;
         values.insert(values.end(), adaptor.getInQubits().begin(), adaptor.getInQubits().end());
@@ -680,24 +782,24 @@ struct PCPhaseOpPattern : public OpConversionPattern<PCPhaseOp> {
         auto modifiersPtr = getModifiersPtr(loc, rewriter, conv, op.getAdjointFlag(),
                                             adaptor.getInCtrlQubits(), adaptor.getInCtrlValues());
 
-        std::string qirName = "__catalyst__qis__PCPhase";
-        Type qirSignature =
-            LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
-                                        {Float64Type::get(ctx), Float64Type::get(ctx),
-                                         modifiersPtr.getType(), IntegerType::get(ctx, 64)},
-                                        /*isVarArg=*/true);
+        std::string qirName = "__catalyst__qis__PCPhase_array";
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx),
+            {Float64Type::get(ctx), Float64Type::get(ctx), modifiersPtr.getType(),
+             IntegerType::get(ctx, 64), LLVM::LLVMPointerType::get(ctx)});
 
         LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
             rewriter, op, qirName, qirSignature);
 
         int64_t numQubits = op.getOutQubits().size();
+        Value qubitsPtr = getQubitArrayPtr(loc, rewriter, adaptor.getInQubits());
         SmallVector<Value> args;
         args.insert(args.end(), adaptor.getTheta());
         args.insert(args.end(), adaptor.getDim());
         args.insert(args.end(), modifiersPtr);
         args.insert(args.end(),
                     LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(numQubits)));
-        args.insert(args.end(), adaptor.getInQubits().begin(), adaptor.getInQubits().end());
+        args.insert(args.end(), qubitsPtr);
         LLVM::CallOp::create(rewriter, loc, fnDecl, args);
 
         SmallVector<Value> values;
@@ -728,24 +830,24 @@ struct QubitUnitaryOpPattern : public OpConversionPattern<QubitUnitaryOp> {
         Type matrixType = conv->convertType(
             MemRefType::get({UNKNOWN, UNKNOWN}, ComplexType::get(Float64Type::get(ctx))));
 
-        std::string qirName = "__catalyst__qis__QubitUnitary";
-        Type qirSignature =
-            LLVM::LLVMFunctionType::get(LLVM::LLVMVoidType::get(ctx),
-                                        {LLVM::LLVMPointerType::get(rewriter.getContext()),
-                                         modifiersPtr.getType(), IntegerType::get(ctx, 64)},
-                                        /*isVarArg=*/true);
+        std::string qirName = "__catalyst__qis__QubitUnitary_array";
+        Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
+        Type qirSignature = LLVM::LLVMFunctionType::get(
+            LLVM::LLVMVoidType::get(ctx),
+            {ptrType, modifiersPtr.getType(), IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
             rewriter, op, qirName, qirSignature);
 
         int64_t numQubits = adaptor.getInQubits().size();
-        SmallVector<Value> args = adaptor.getOperands();
-        args.insert(args.begin() + 1,
-                    LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(numQubits)));
-        args.insert(args.begin() + 1, modifiersPtr);
-        // Replace the memref argument (LLVM struct) with a pointer to memref.
-        args[0] = catalyst::getStaticAlloca(loc, rewriter, matrixType, 1);
-        LLVM::StoreOp::create(rewriter, loc, adaptor.getMatrix(), args[0]);
+        Value qubitsPtr = getQubitArrayPtr(loc, rewriter, adaptor.getInQubits());
+        // Pass the memref argument (LLVM struct) as a pointer to memref.
+        Value matrixPtr = catalyst::getStaticAlloca(loc, rewriter, matrixType, 1);
+        LLVM::StoreOp::create(rewriter, loc, adaptor.getMatrix(), matrixPtr);
+        SmallVector<Value> args = {
+            matrixPtr, modifiersPtr,
+            LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(numQubits)),
+            qubitsPtr};
 
         LLVM::CallOp::create(rewriter, loc, fnDecl, args);
 
@@ -944,9 +1046,9 @@ struct MeasureOpPattern : public OpConversionPattern<MeasureOp> {
         Type postselectTy = IntegerType::get(ctx, 32);
         SmallVector<Type> argSignatures = {qubitTy, postselectTy};
 
-        StringRef qirName = "__catalyst__qis__Measure";
-        Type qirSignature =
-            LLVM::LLVMFunctionType::get(conv->convertType(ResultType::get(ctx)), argSignatures);
+        // The outcome is returned as a bit, rather than as a result pointer to load from
+        StringRef qirName = "__catalyst__qis__MeasureBit";
+        Type qirSignature = LLVM::LLVMFunctionType::get(IntegerType::get(ctx, 1), argSignatures);
 
         LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
             rewriter, op, qirName, qirSignature);
@@ -960,8 +1062,7 @@ struct MeasureOpPattern : public OpConversionPattern<MeasureOp> {
         // Add qubit and postselect values as arguments of the CallOp
         SmallVector<Value> args = {adaptor.getInQubit(), postselect};
 
-        Value resultPtr = LLVM::CallOp::create(rewriter, loc, fnDecl, args).getResult();
-        Value mres = LLVM::LoadOp::create(rewriter, loc, IntegerType::get(ctx, 1), resultPtr);
+        Value mres = LLVM::CallOp::create(rewriter, loc, fnDecl, args).getResult();
         rewriter.replaceOp(op, {mres, adaptor.getInQubit()});
 
         return success();
@@ -978,28 +1079,27 @@ template <typename T> class SampleBasedPattern : public OpConversionPattern<T> {
         Location loc = op.getLoc();
         MLIRContext *ctx = this->getContext();
 
+        Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
         Type qirSignature = LLVM::LLVMFunctionType::get(
-            LLVM::LLVMVoidType::get(ctx),
-            {LLVM::LLVMPointerType::get(rewriter.getContext()), IntegerType::get(ctx, 64)},
-            /*isVarArg=*/true);
+            LLVM::LLVMVoidType::get(ctx), {ptrType, IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
             rewriter, op, qirName, qirSignature);
 
-        // We need to handle the C ABI convention of passing the result memref
-        // as a struct pointer in the first argument to the C function.
-        Value structPtr = catalyst::getStaticAlloca(loc, rewriter, structType, 1);
-
         // For now obtain the qubit values from an unrealized cast created by the
         // ComputationalBasisOp lowering. Improve this once the runtime interface changes to
         // accept observables for sample.
         assert(isa<UnrealizedConversionCastOp>(adaptor.getObs().getDefiningOp()));
         ValueRange qubits = adaptor.getObs().getDefiningOp()->getOperands();
+        Value qubitsPtr = getQubitArrayPtr(loc, rewriter, qubits);
+
+        // We need to handle the C ABI convention of passing the result memref
+        // as a struct pointer in the first argument to the C function.
+        Value structPtr = catalyst::getStaticAlloca(loc, rewriter, structType, 1);
 
         Value numQubits =
             LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(qubits.size()));
-        SmallVector<Value> args = {structPtr, numQubits};
-        args.insert(args.end(), qubits.begin(), qubits.end());
+        SmallVector<Value> args = {structPtr, numQubits, qubitsPtr};
 
         if constexpr (std::is_same_v<T, SampleOp>) {
             LLVM::StoreOp::create(rewriter, loc, adaptor.getInData(), structPtr);
@@ -1034,7 +1134,7 @@ struct SampleOpPattern : public SampleBasedPattern<SampleOp> {
         Type matrixType =
             conv->convertType(MemRefType::get({UNKNOWN, UNKNOWN}, Float64Type::get(ctx)));
 
-        StringRef qirName = "__catalyst__qis__Sample";
+        StringRef qirName = "__catalyst__qis__Sample_array";
         performRewrite(rewriter, matrixType, qirName, op, adaptor);
         rewriter.eraseOp(op);
 
@@ -1058,7 +1158,7 @@ struct CountsOpPattern : public SampleBasedPattern<CountsOp> {
         Type vector2Type = conv->convertType(MemRefType::get({UNKNOWN}, IntegerType::get(ctx, 64)));
         Type structType = LLVM::LLVMStructType::getLiteral(ctx, {vector1Type, vector2Type});
 
-        StringRef qirName = "__catalyst__qis__Counts";
+        StringRef qirName = "__catalyst__qis__Counts_array";
         performRewrite(rewriter, structType, qirName, op, adaptor);
         rewriter.eraseOp(op);
 
@@ -1066,14 +1166,110 @@ struct CountsOpPattern : public SampleBasedPattern<CountsOp> {
     }
 };
 
+/// Collect the statistics measured right after `op` in the same block, with only side-effect free
+/// operations in between, since they are all measured on the same state as `op`.
+///
+/// Only a leading part of these statistics is lowered together with `op`, so that the statistics
+/// that are left are never seen by the pattern of another statistic before them.
+static SmallVector<Operation *> collectJointStats(Operation *op)
+{
+    SmallVector<Operation *> stats;
+    for (Operation *next = op->getNextNode(); next; next = next->getNextNode()) {
+        if (isa<ExpvalOp, VarianceOp>(next)) {
+            stats.push_back(next);
+        }
+        else if (!isMemoryEffectFree(next)) {
+            break;
+        }
+    }
+    return stats;
+}
+
+/// Whether the observable `obs` is already defined, and converted, where `op` is lowered.
+static bool isDefinedBefore(Value obs, Operation *op)
+{
+    Operation *def = obs.getDefiningOp();
+    return !def || def->getBlock() != op->getBlock() || def->isBeforeInBlock(op);
+}
+
 template <typename T> struct StatsBasedPattern : public OpConversionPattern<T> {
     using OpConversionPattern<T>::OpConversionPattern;
 
     LogicalResult matchAndRewrite(T op, typename T::Adaptor adaptor,
                                   ConversionPatternRewriter &rewriter) const override
     {
+        Location loc = op.getLoc();
         MLIRContext *ctx = this->getContext();
         const TypeConverter *conv = this->getTypeConverter();
+        Type f64Type = Float64Type::get(ctx);
+        Type obsType = conv->convertType(ObservableType::get(ctx));
+        Type ptrType = LLVM::LLVMPointerType::get(ctx);
+        Type voidType = LLVM::LLVMVoidType::get(ctx);
+
+        // The statistics of the same state are measured in a single device call: the expectation
+        // value and the variance of the same observable, or the expectation values of several
+        // observables. The device writes them to a stack buffer, in the order of the operands.
+        SmallVector<Operation *> stats = collectJointStats(op);
+        auto loadResult = [&](Value resultPtr, int64_t idx) -> Value {
+            Value itemPtr =
+                LLVM::GEPOp::create(rewriter, loc, ptrType, f64Type, resultPtr,
+                                    ArrayRef<LLVM::GEPArg>{idx}, LLVM::GEPNoWrapFlags::inbounds);
+            return LLVM::LoadOp::create(rewriter, loc, f64Type, itemPtr);
+        };
+
+        if (!stats.empty() && !isa<T>(stats.front()) &&
+            stats.front()->getOperand(0) == op.getObs()) {
+            Type qirSignature = LLVM::LLVMFunctionType::get(voidType, {ptrType, obsType});
+            LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
+                rewriter, op, "__catalyst__qis__ExpvalVar", qirSignature);
+
+            Value resultPtr = catalyst::getStaticAlloca(loc, rewriter, f64Type, 2);
+            LLVM::CallOp::create(rewriter, loc, fnDecl, ValueRange{resultPtr, adaptor.getObs()});
+            Value expval = loadResult(resultPtr, 0);
+            Value var = loadResult(resultPtr, 1);
+
+            constexpr bool isExpval = std::is_same_v<T, ExpvalOp>;
+            rewriter.replaceOp(stats.front(), isExpval ? var : expval);
+            rewriter.replaceOp(op, isExpval ? expval : var);
+            return success();
+        }
+
+        if constexpr (std::is_same_v<T, ExpvalOp>) {
+            SmallVector<Operation *> expvals{op};
+            SmallVector<Value> obsKeys{adaptor.getObs()};
+            for (Operation *other : stats) {
+                auto expvalOp = dyn_cast<ExpvalOp>(other);
+                if (!expvalOp || !isDefinedBefore(expvalOp.getObs(), op)) {
+                    break;
+                }
+                Value obsKey = rewriter.getRemappedValue(expvalOp.getObs());
+                if (!obsKey) {
+                    break;
+                }
+                expvals.push_back(other);
+                obsKeys.push_back(obsKey);
+            }
+
+            if (expvals.size() > 1) {
+                Type qirSignature = LLVM::LLVMFunctionType::get(
+                    voidType, {ptrType, IntegerType::get(ctx, 64)}, /*isVarArg=*/true);
+                LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
+                    rewriter, op, "__catalyst__qis__Expvals", qirSignature);
+
+                int64_t numObs = expvals.size();
+                Value resultPtr = catalyst::getStaticAlloca(loc, rewriter, f64Type, numObs);
+                SmallVector<Value> args{
+                    resultPtr,
+                    LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(numObs))};
+                args.append(obsKeys);
+                LLVM::CallOp::create(rewriter, loc, fnDecl, args);
+
+                for (int64_t i = 0; i < numObs; i++) {
+                    rewriter.replaceOp(expvals[i], loadResult(resultPtr, i));
+                }
+                return success();
+            }
+        }
 
         StringRef qirName;
         if constexpr (std::is_same_v<T, ExpvalOp>) {
@@ -1083,8 +1279,7 @@ template <typename T> struct StatsBasedPattern : public OpConversionPattern<T> {
             qirName = "__catalyst__qis__Variance";
         }
 
-        Type qirSignature = LLVM::LLVMFunctionType::get(
-            Float64Type::get(ctx), conv->convertType(ObservableType::get(ctx)));
+        Type qirSignature = LLVM::LLVMFunctionType::get(f64Type, obsType);
 
         LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
             rewriter, op, qirName, qirSignature);
@@ -1112,47 +1307,41 @@ template <typename T> struct StateBasedPattern : public OpConversionPattern<T> {
         StringRef qirName;
         if constexpr (std::is_same_v<T, ProbsOp>) {
             vectorType = conv->convertType(MemRefType::get({UNKNOWN}, Float64Type::get(ctx)));
-            qirName = "__catalyst__qis__Probs";
+            qirName = "__catalyst__qis__Probs_array";
         }
         else {
             vectorType = conv->convertType(
                 MemRefType::get({UNKNOWN}, ComplexType::get(Float64Type::get(ctx))));
-            qirName = "__catalyst__qis__State";
+            qirName = "__catalyst__qis__State_array";
         }
 
+        Type ptrType = LLVM::LLVMPointerType::get(rewriter.getContext());
         Type qirSignature = LLVM::LLVMFunctionType::get(
-            LLVM::LLVMVoidType::get(ctx),
-            {LLVM::LLVMPointerType::get(rewriter.getContext()), IntegerType::get(ctx, 64)},
-            /*isVarArg=*/true);
+            LLVM::LLVMVoidType::get(ctx), {ptrType, IntegerType::get(ctx, 64), ptrType});
 
         LLVM::LLVMFuncOp fnDecl = catalyst::ensureFunctionDeclaration<LLVM::LLVMFuncOp>(
             rewriter, op, qirName, qirSignature);
 
-        // We need to handle the C ABI convention of passing the result memref
-        // as a struct pointer in the first argument to the C function.
-        Value structPtr = catalyst::getStaticAlloca(loc, rewriter, vectorType, 1);
-        LLVM::StoreOp::create(rewriter, loc, adaptor.getStateIn(), structPtr);
-
         // For now obtain the qubit values from an unrealized cast created by the
         // ComputationalBasisOp lowering. Improve this once the runtime interface changes to
         // accept observables for sample.
         assert(isa<UnrealizedConversionCastOp>(adaptor.getObs().getDefiningOp()));
         ValueRange qubits = adaptor.getObs().getDefiningOp()->getOperands();
-
-        SmallVector<Value> args = {structPtr};
-        if constexpr (std::is_same_v<T, ProbsOp>) {
-            Value numQubits =
-                LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(qubits.size()));
-            args.push_back(numQubits);
-            args.insert(args.end(), qubits.begin(), qubits.end());
-        }
-        else {
+        if constexpr (!std::is_same_v<T, ProbsOp>) {
             // __catalyst__qis__State does not support individual qubit measurements yet, so it must
             // be invoked without specific specific qubits (i.e. measure the whole register).
-            Value numQubits =
-                LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(0));
-            args.push_back(numQubits);
+            qubits = ValueRange{};
         }
+        Value qubitsPtr = getQubitArrayPtr(loc, rewriter, qubits);
+
+        // We need to handle the C ABI convention of passing the result memref
+        // as a struct pointer in the first argument to the C function.
+        Value structPtr = catalyst::getStaticAlloca(loc, rewriter, vectorType, 1);
+        LLVM::StoreOp::create(rewriter, loc, adaptor.getStateIn(), structPtr);
+
+        Value numQubits =
+            LLVM::ConstantOp::create(rewriter, loc, rewriter.getI64IntegerAttr(qubits.size()));
+        SmallVector<Value> args = {structPtr, numQubits, qubitsPtr};
 
         LLVM::CallOp::create(rewriter, loc, fnDecl, args);
         rewriter.eraseOp(op);
@@ -1176,6 +1365,7 @@ struct SetStateOpPattern : public OpConversionPattern<SetStateOp> {
         auto func = mlir::LLVM::lookupOrCreateFn(rewriter, moduleOp, "__catalyst__qis__SetState",
                                                  {ptrTy, i64}, voidTy, isVarArg)
                         .value();
+        catalyst::annotateRuntimeFunction(func);
 
         SmallVector<Value> args;
 
@@ -1217,6 +1407,7 @@ struct SetBasisStateOpPattern : public OpConversionPattern<SetBasisStateOp> {
             mlir::LLVM::lookupOrCreateFn(rewriter, moduleOp, "__catalyst__qis__SetBasisState",
                                          {ptrTy, i64}, voidTy, isVarArg)
                 .value();
+        catalyst::annotateRuntimeFunction(func);
 
         SmallVector<Value> args;
 
@@ -18,7 +18,10 @@
 
 #include "DGBuilder.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <thread>
 #include <variant>
 
 #include "DGUtils.hpp"
@@ -68,6 +71,15 @@ struct DecompositionGraph::Impl {
     std::unordered_map<RuleId, Vertex> ruleIdToVertex;
     std::unordered_map<OperatorNode, std::vector<RuleNode>, OperatorNodeHash> opToRules;
 
+    // Flat arrays indexed by operator IDs, and by rule IDs, where the rule IDs of each operator
+    // and the input terms of each rule are stored contiguously, at offsets[id] to offsets[id + 1]
+    std::vector<double> targetCosts;
+    std::vector<std::size_t> opRuleOffsets;
+    std::vector<RuleId> opRuleIds;
+    std::vector<OperatorId> ruleOutputIds;
+    std::vector<std::size_t> ruleInputOffsets;
+    std::vector<DecompositionGraph::InternedTerm> ruleInputIds;
+
     OperatorId registerOp(const OperatorNode &op)
     {
         const auto it = opToId.find(op);
@@ -155,6 +167,54 @@ struct DecompositionGraph::Impl {
         rules = std::move(effectiveRules);
     }
 
+    /**
+     * @brief The operators of a slice of the rules, interned with IDs local to the slice, so that
+     * the slices of large rule libraries are interned in parallel.
+     *
+     * Operators with a wildcard number of wires or parameters match operators that don't match
+     * each other, so that their IDs depend on all the operators registered before them. Their
+     * slices are registered term by term instead.
+     */
+    struct RuleFragment {
+        RuleId begin{0};
+        RuleId end{0};
+        bool hasWildcards{false};
+        std::unordered_map<OperatorNode, OperatorId, OperatorNodeHash> opToLocalId;
+        std::vector<const OperatorNode *> localOps;
+        std::vector<OperatorId> outputIds;
+        std::vector<std::size_t> inputOffsets;
+        std::vector<DecompositionGraph::InternedTerm> inputIds;
+
+        OperatorId registerLocalOp(const OperatorNode &op)
+        {
+            const auto [it, inserted] = opToLocalId.emplace(op, localOps.size());
+            if (inserted) {
+                localOps.push_back(&op);
+                hasWildcards = hasWildcards || op.numWires == -1 || op.numParams == -1;
+            }
+            return it->second;
+        }
+
+        void intern(const std::vector<RuleNode> &rules, RuleId _begin, RuleId _end)
+        {
+            begin = _begin;
+            end = _end;
+            outputIds.reserve(end - begin);
+            inputOffsets.reserve(end - begin);
+            for (RuleId ruleId = begin; ruleId < end; ruleId++) {
+                const auto &rule = rules[ruleId];
+                outputIds.push_back(registerLocalOp(rule.output));
+                inputOffsets.push_back(inputIds.size());
+                for (const auto &input : rule.inputs) {
+                    inputIds.push_back({registerLocalOp(input.op), input.multiplicity});
+                }
+            }
+        }
+    };
+
+    // The minimum number of rules interned by each thread
+    static constexpr std::size_t minRulesPerThread = 2048;
+
     void buildGraph()
     {
         // Register all operators
@@ -168,10 +228,10 @@ struct DecompositionGraph::Impl {
         }
 
         // Register all rules
+        internRuleTerms();
         for (RuleId ruleId = 0; ruleId < rules.size(); ruleId++) {
             const auto &rule = rules[ruleId];
-            const auto id = registerOp(rule.output);
-            const auto output_vertex = opIdToVertex[id];
+            const auto output_vertex = opIdToVertex[ruleOutputIds[ruleId]];
 
             // Create a vertex for the rule and connect it to its output operator vertex
             const auto rule_vertex =
@@ -183,12 +243,97 @@ struct DecompositionGraph::Impl {
             boost::add_edge(rule_vertex, output_vertex, GraphWeightedEdge{}, graph);
 
             // Connect rule vertex to input operator vertices
-            for (const auto &input : rule.inputs) {
-                const auto input_id = registerOp(input.op);
-                const auto input_vertex = opIdToVertex[input_id];
+            for (std::size_t idx = ruleInputOffsets[ruleId]; idx < ruleInputOffsets[ruleId + 1];
+                 idx++) {
+                const auto input_vertex = opIdToVertex[ruleInputIds[idx].op];
                 boost::add_edge(input_vertex, rule_vertex, GraphWeightedEdge{}, graph);
             }
         }
+
+        internRules();
+    }
+
+    void internRuleTerms()
+    {
+        // Slices of the rules are interned in parallel, and merged in order, so that the operators
+        // get the same IDs as if the rules were interned one after the other
+        const std::size_t numThreads = std::max<std::size_t>(
+            1, std::min<std::size_t>(std::thread::hardware_concurrency(),
+                                     rules.size() / minRulesPerThread));
+        std::vector<RuleFragment> fragments(numThreads);
+        auto internFragment = [&](std::size_t idx) {
+            fragments[idx].intern(rules, rules.size() * idx / numThreads,
+                                  rules.size() * (idx + 1) / numThreads);
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(numThreads - 1);
+        for (std::size_t idx = 1; idx < numThreads; idx++) {
+            workers.emplace_back(internFragment, idx);
+        }
+        internFragment(0);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+
+        ruleOutputIds.reserve(rules.size());
+        ruleInputOffsets.reserve(rules.size() + 1);
+        for (const auto &fragment : fragments) {
+            if (fragment.hasWildcards) {
+                for (RuleId ruleId = fragment.begin; ruleId < fragment.end; ruleId++) {
+                    const auto &rule = rules[ruleId];
+                    ruleOutputIds.push_back(registerOp(rule.output));
+                    ruleInputOffsets.push_back(ruleInputIds.size());
+                    for (const auto &input : rule.inputs) {
+                        ruleInputIds.push_back({registerOp(input.op), input.multiplicity});
+                    }
+                }
+                continue;
+            }
+
+            std::vector<OperatorId> localToId;
+            localToId.reserve(fragment.localOps.size());
+            for (const OperatorNode *op : fragment.localOps) {
+                localToId.push_back(registerOp(*op));
+            }
+
+            const std::size_t inputBase = ruleInputIds.size();
+            for (const OperatorId localId : fragment.outputIds) {
+                ruleOutputIds.push_back(localToId[localId]);
+            }
+            for (const std::size_t offset : fragment.inputOffsets) {
+                ruleInputOffsets.push_back(inputBase + offset);
+            }
+            for (const auto &input : fragment.inputIds) {
+                ruleInputIds.push_back({localToId[input.op], input.multiplicity});
+            }
+        }
+        ruleInputOffsets.push_back(ruleInputIds.size());
+    }
+
+    void internRules()
+    {
+        const std::size_t numOps = idToOp.size();
+
+        targetCosts.assign(numOps, std::numeric_limits<double>::infinity());
+        for (const auto &[op, cost] : gateset.ops) {
+            targetCosts[opToId.at(op)] = cost;
+        }
+
+        std::vector<std::size_t> numRulesPerOp(numOps, 0);
+        for (const OperatorId outputId : ruleOutputIds) {
+            numRulesPerOp[outputId]++;
+        }
+
+        opRuleOffsets.assign(numOps + 1, 0);
+        for (OperatorId id = 0; id < numOps; id++) {
+            opRuleOffsets[id + 1] = opRuleOffsets[id] + numRulesPerOp[id];
+        }
+        opRuleIds.resize(rules.size());
+        std::vector<std::size_t> nextRule(opRuleOffsets.begin(), opRuleOffsets.end() - 1);
+        for (RuleId ruleId = 0; ruleId < rules.size(); ruleId++) {
+            opRuleIds[nextRule[ruleOutputIds[ruleId]]++] = ruleId;
+        }
     }
 };
 
@@ -230,6 +375,24 @@ DecompositionGraph &DecompositionGraph::operator=(DecompositionGraph &&other) no
     return impl->gateset;
 }
 
+bool DecompositionGraph::setTargetCosts(const WeightedGateset &gateset)
+{
+    if (gateset.ops.size() != impl->gateset.ops.size()) {
+        return false;
+    }
+    for (const auto &[op, _] : gateset.ops) {
+        if (!impl->gateset.contains(op)) {
+            return false;
+        }
+    }
+
+    for (const auto &[op, cost] : gateset.ops) {
+        impl->targetCosts[impl->opToId.at(op)] = cost;
+    }
+    impl->gateset = gateset;
+    return true;
+}
+
 [[nodiscard]] const std::vector<RuleNode> &DecompositionGraph::getRules() const noexcept
 {
     return impl->rules;
@@ -271,6 +434,49 @@ bool DecompositionGraph::hasOperator(const OperatorNode &op) const
     return impl->opToId.find(op) != impl->opToId.end();
 }
 
+std::size_t DecompositionGraph::getNumOperatorIds() const noexcept { return impl->idToOp.size(); }
+
+std::optional<DecompositionGraph::OperatorId>
+DecompositionGraph::findOperatorId(const OperatorNode &op) const
+{
+    const auto it = impl->opToId.find(op);
+    if (it == impl->opToId.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+const OperatorNode &DecompositionGraph::getOperator(OperatorId id) const
+{
+    return impl->idToOp[id];
+}
+
+double DecompositionGraph::getTargetCost(OperatorId id) const { return impl->targetCosts[id]; }
+
+bool DecompositionGraph::isTargetGate(OperatorId id) const
+{
+    return impl->targetCosts[id] != std::numeric_limits<double>::infinity();
+}
+
+std::span<const DecompositionGraph::RuleId> DecompositionGraph::getRuleIdsFor(OperatorId id) const
+{
+    return std::span<const RuleId>(impl->opRuleIds)
+        .subspan(impl->opRuleOffsets[id], impl->opRuleOffsets[id + 1] - impl->opRuleOffsets[id]);
+}
+
+DecompositionGraph::OperatorId DecompositionGraph::getRuleOutputId(RuleId id) const
+{
+    return impl->ruleOutputIds[id];
+}
+
+std::span<const DecompositionGraph::InternedTerm>
+DecompositionGraph::getRuleInputIds(RuleId id) const
+{
+    return std::span<const InternedTerm>(impl->ruleInputIds)
+        .subspan(impl->ruleInputOffsets[id],
+                 impl->ruleInputOffsets[id + 1] - impl->ruleInputOffsets[id]);
+}
+
 void DecompositionGraph::showGraph() const
 {
     std::cerr << "Decomposition Graph:\n";
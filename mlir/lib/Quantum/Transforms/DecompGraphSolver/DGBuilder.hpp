@@ -24,7 +24,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 
 #include "DGTypes.hpp"
@@ -38,6 +41,15 @@ class DecompositionGraph {
 
   public:
     using RuleId = std::size_t;
+    using OperatorId = std::size_t;
+
+    /**
+     * @brief An input term of a rule, with its operator interned into an operator ID.
+     */
+    struct InternedTerm {
+        OperatorId op;
+        std::size_t multiplicity;
+    };
 
     /**
      * @brief Constructs the decomposition graph from the given operators, gateset, and rules.
@@ -88,6 +100,19 @@ class DecompositionGraph {
      */
     [[nodiscard]] const Core::WeightedGateset &getGateset() const noexcept;
 
+    /**
+     * @brief Replaces the costs of the target gates with the costs of the given gateset, which
+     * must have the same gates.
+     *
+     * The operators and rules of the graph are kept, so that the graph can be solved again for
+     * other gate costs without being rebuilt.
+     *
+     * @param gateset The target gateset with the new costs.
+     * @return bool False if the gates of the given gateset differ from the target gates of the
+     * graph, in which case the graph is not changed.
+     */
+    bool setTargetCosts(const Core::WeightedGateset &gateset);
+
     /**
      * @brief Returns the list of decomposition rules for the graph decomposition problem,
      * which define how operators can be decomposed into other operators. Each rule includes
@@ -144,6 +169,54 @@ class DecompositionGraph {
      */
     bool hasOperator(const Core::OperatorNode &op) const;
 
+    // Interned view of the graph
+    //
+    // Operators are interned into dense IDs when the graph is built, in the order they are
+    // registered, and rules are stored in flat arrays indexed by these IDs. Solvers use this view
+    // to avoid hashing operator names while solving.
+
+    /**
+     * @brief Returns the number of interned operators, which are numbered from 0.
+     */
+    [[nodiscard]] std::size_t getNumOperatorIds() const noexcept;
+
+    /**
+     * @brief Returns the ID of the given operator node, or std::nullopt if it is not in the
+     * graph.
+     */
+    [[nodiscard]] std::optional<OperatorId> findOperatorId(const Core::OperatorNode &op) const;
+
+    /**
+     * @brief Returns the operator node of the given operator ID.
+     */
+    [[nodiscard]] const Core::OperatorNode &getOperator(OperatorId id) const;
+
+    /**
+     * @brief Returns the cost of the given operator in the target gateset, or infinity if it is
+     * not a target gate.
+     */
+    [[nodiscard]] double getTargetCost(OperatorId id) const;
+
+    /**
+     * @brief Checks if the given operator is a target gate in the gateset.
+     */
+    [[nodiscard]] bool isTargetGate(OperatorId id) const;
+
+    /**
+     * @brief Returns the IDs of the rules that decompose the given operator, in graph order.
+     */
+    [[nodiscard]] std::span<const RuleId> getRuleIdsFor(OperatorId id) const;
+
+    /**
+     * @brief Returns the ID of the operator the given rule decomposes.
+     */
+    [[nodiscard]] OperatorId getRuleOutputId(RuleId id) const;
+
+    /**
+     * @brief Returns the interned input terms of the given rule.
+     */
+    [[nodiscard]] std::span<const InternedTerm> getRuleInputIds(RuleId id) const;
+
     /**
      * @brief Prints the graph structure for debugging purposes.
      *
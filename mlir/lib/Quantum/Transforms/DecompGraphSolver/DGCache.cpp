@@ -0,0 +1,283 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DGCache.cpp
+ */
+
+#include "DGCache.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+#include "DGUtils.hpp"
+
+using namespace DecompGraph::Core;
+
+namespace DecompGraph::Solver {
+
+namespace {
+
+constexpr const char *cacheHeader = "DecompGraphSolutionCache";
+constexpr int cacheVersion = 1;
+
+// Strings are prefixed by their length, so that they may contain any character
+void writeString(std::ostream &os, const std::string &str) { os << str.size() << ':' << str; }
+
+void writeOperator(std::ostream &os, const OperatorNode &op)
+{
+    writeString(os, op.name);
+    os << ' ' << op.numWires << ' ' << op.numParams << ' ' << op.adjoint;
+}
+
+void writeRule(std::ostream &os, const ChosenDecompRule &rule)
+{
+    writeOperator(os, rule.op);
+    os << ' ' << rule.isBasis << ' ';
+    writeString(os, rule.ruleName);
+    os << ' ' << rule.totalCost << ' ' << rule.inputs.size();
+    for (const auto &input : rule.inputs) {
+        os << ' ';
+        writeOperator(os, input.op);
+        os << ' ' << input.multiplicity;
+    }
+    os << ' ' << rule.basisCounts.size();
+    for (const auto &[basis_op, count] : rule.basisCounts) {
+        os << ' ';
+        writeOperator(os, basis_op);
+        os << ' ' << count;
+    }
+}
+
+std::string readString(std::istream &is)
+{
+    std::size_t size = 0;
+    char separator = '\0';
+    if (!(is >> size >> separator) || separator != ':') {
+        is.setstate(std::ios::failbit);
+        return "";
+    }
+
+    std::string str(size, '\0');
+    is.read(str.data(), static_cast<std::streamsize>(size));
+    return str;
+}
+
+OperatorNode readOperator(std::istream &is)
+{
+    OperatorNode op;
+    op.name = readString(is);
+    is >> op.numWires >> op.numParams >> op.adjoint;
+    return op;
+}
+
+ChosenDecompRule readRule(std::istream &is)
+{
+    ChosenDecompRule rule;
+    rule.op = readOperator(is);
+    is >> rule.isBasis;
+    rule.ruleName = readString(is);
+
+    std::size_t numInputs = 0;
+    is >> rule.totalCost >> numInputs;
+    for (std::size_t i = 0; i < numInputs && is; i++) {
+        RuleTerm input;
+        input.op = readOperator(is);
+        is >> input.multiplicity;
+        rule.inputs.push_back(std::move(input));
+    }
+
+    std::size_t numBasis = 0;
+    is >> numBasis;
+    for (std::size_t i = 0; i < numBasis && is; i++) {
+        OperatorNode basis_op = readOperator(is);
+        std::size_t count = 0;
+        is >> count;
+        rule.basisCounts.emplace(std::move(basis_op), count);
+    }
+    return rule;
+}
+
+std::string describeOperator(const OperatorNode &op)
+{
+    std::ostringstream oss;
+    writeOperator(oss, op);
+    return oss.str();
+}
+
+} // namespace
+
+SolutionCache::GraphKey SolutionCache::getGraphKey(const DecompositionGraph &graph,
+                                                   bool withCosts)
+{
+    // Sort the descriptions, so that the key doesn't depend on the order of the gates and rules
+    std::vector<std::string> gates;
+    for (const auto &[op, cost] : graph.getGateset().ops) {
+        std::ostringstream oss;
+        oss << std::setprecision(std::numeric_limits<double>::max_digits10);
+        writeOperator(oss, op);
+        if (withCosts) {
+            oss << ' ' << cost;
+        }
+        gates.push_back(oss.str());
+    }
+    std::sort(gates.begin(), gates.end());
+
+    std::vector<std::string> rules;
+    for (const auto &rule : graph.getRules()) {
+        std::ostringstream oss;
+        writeString(oss, rule.name);
+        oss << ' ' << static_cast<int>(rule.origin) << ' ' << describeOperator(rule.output);
+        for (const auto &input : rule.inputs) {
+            oss << ' ' << describeOperator(input.op) << ' ' << input.multiplicity;
+        }
+        rules.push_back(oss.str());
+    }
+    std::sort(rules.begin(), rules.end());
+
+    std::ostringstream key;
+    key << gates.size() << '\n';
+    for (const auto &gate : gates) {
+        key << gate << '\n';
+    }
+    key << rules.size() << '\n';
+    for (const auto &rule : rules) {
+        key << rule << '\n';
+    }
+    return GraphKey(key.str());
+}
+
+std::optional<GraphResult> SolutionCache::lookup(const GraphKey &graphKey,
+                                                 const OperatorNode &op) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto graphIt = graphs.find(graphKey);
+    if (graphIt == graphs.end()) {
+        return std::nullopt;
+    }
+    const auto opIt = graphIt->second.find(op);
+    if (opIt == graphIt->second.end()) {
+        return std::nullopt;
+    }
+    return opIt->second;
+}
+
+void SolutionCache::insert(const GraphKey &graphKey, const OperatorNode &op, GraphResult solution)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    insertLocked(graphKey, op, std::move(solution));
+}
+
+void SolutionCache::insertLocked(const GraphKey &graphKey, const OperatorNode &op,
+                                 GraphResult solution)
+{
+    if (maxSize == 0) {
+        return;
+    }
+
+    auto graphIt = graphs.try_emplace(graphKey).first;
+    auto [opIt, inserted] = graphIt->second.try_emplace(op, std::move(solution));
+    if (!inserted) {
+        return;
+    }
+    insertionOrder.emplace_back(&graphIt->first, &opIt->first);
+
+    while (insertionOrder.size() > maxSize) {
+        const auto [oldestKey, oldestOp] = insertionOrder.front();
+        insertionOrder.pop_front();
+
+        auto oldestGraphIt = graphs.find(*oldestKey);
+        auto &solutions = oldestGraphIt->second;
+        solutions.erase(solutions.find(*oldestOp));
+        if (solutions.empty()) {
+            graphs.erase(oldestGraphIt);
+        }
+    }
+}
+
+std::size_t SolutionCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return insertionOrder.size();
+}
+
+void SolutionCache::save(std::ostream &os) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    os << std::setprecision(std::numeric_limits<double>::max_digits10);
+    os << cacheHeader << ' ' << cacheVersion << '\n' << graphs.size() << '\n';
+    for (const auto &[graphKey, solutions] : graphs) {
+        writeString(os, graphKey.text);
+        os << ' ' << solutions.size() << '\n';
+        for (const auto &[op, solution] : solutions) {
+            writeOperator(os, op);
+            os << ' ' << solution.size() << '\n';
+            for (const auto &[_, rule] : solution) {
+                writeRule(os, rule);
+                os << '\n';
+            }
+        }
+    }
+}
+
+void SolutionCache::load(std::istream &is)
+{
+    std::string header;
+    int version = 0;
+    if (!(is >> header >> version) || header != cacheHeader || version != cacheVersion) {
+        throw GraphError("Unsupported decomposition solution cache format");
+    }
+
+    std::unordered_map<std::string, OperatorSolutions> loaded;
+    std::size_t numGraphs = 0;
+    is >> numGraphs;
+    for (std::size_t i = 0; i < numGraphs && is; i++) {
+        const std::string graphKey = readString(is);
+        std::size_t numSolutions = 0;
+        is >> numSolutions;
+        auto &solutions = loaded[graphKey];
+        for (std::size_t j = 0; j < numSolutions && is; j++) {
+            OperatorNode op = readOperator(is);
+            std::size_t numRules = 0;
+            is >> numRules;
+            GraphResult solution;
+            for (std::size_t k = 0; k < numRules && is; k++) {
+                ChosenDecompRule rule = readRule(is);
+                solution.emplace(rule.op, std::move(rule));
+            }
+            solutions.emplace(std::move(op), std::move(solution));
+        }
+    }
+    if (!is) {
+        throw GraphError("Malformed decomposition solution cache");
+    }
+
+    // Only merge complete caches
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &[graphKey, solutions] : loaded) {
+        const GraphKey key(graphKey);
+        for (auto &[op, solution] : solutions) {
+            insertLocked(key, op, std::move(solution));
+        }
+    }
+}
+
+} // namespace DecompGraph::Solver
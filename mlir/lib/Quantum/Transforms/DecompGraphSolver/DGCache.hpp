@@ -0,0 +1,151 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DGCache.hpp
+ *
+ * @brief This file defines the SolutionCache class, which memoises the operators solved by
+ * DecompositionSolver instances across decomposition graphs that share the same target gateset
+ * and decomposition rules, such as the graphs of the QNodes of a program. The cache can be saved
+ * to and loaded from a stream, so that repeated compilations reuse solved decompositions. The
+ * number of cached solutions is bounded, and the oldest solutions are evicted first.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "DGBuilder.hpp"
+#include "DGTypes.hpp"
+
+namespace DecompGraph::Solver {
+
+class SolutionCache {
+  public:
+    /**
+     * @brief The key of the solutions of a graph. Keys describe whole graphs, so their hash is
+     * only computed once rather than on every lookup.
+     */
+    struct GraphKey {
+        std::string text;
+        std::size_t hash;
+
+        explicit GraphKey(std::string _text = "")
+            : text(std::move(_text)), hash(std::hash<std::string>{}(text))
+        {
+        }
+
+        bool operator==(const GraphKey &other) const
+        {
+            return hash == other.hash && text == other.text;
+        }
+    };
+
+    static constexpr std::size_t defaultMaxSize = 1 << 16;
+
+    /**
+     * @brief Constructs an empty cache.
+     *
+     * @param _maxSize The maximum number of cached operator solutions, over all the graphs.
+     */
+    explicit SolutionCache(std::size_t _maxSize = defaultMaxSize) : maxSize(_maxSize) {}
+
+    /**
+     * @brief Returns the key under which the solutions of the given graph are cached.
+     *
+     * The key is a canonical description of the target gateset, including the gate weights,
+     * and of the effective decomposition rules of the graph, including the fixed and alternative
+     * rules. Two graphs with the same key choose the same rule for any operator, regardless of
+     * their root operators.
+     *
+     * @param graph The decomposition graph.
+     * @param withCosts Whether the key includes the gate weights, or only the target gates.
+     * @return GraphKey The key of the graph.
+     */
+    [[nodiscard]] static GraphKey getGraphKey(const DecompositionGraph &graph,
+                                              bool withCosts = true);
+
+    /**
+     * @brief Looks up the solution of an operator in the graphs of the given key.
+     *
+     * @param graphKey The key of the graph, as returned by getGraphKey.
+     * @param op The operator node to look up.
+     * @return std::optional<Core::GraphResult> The chosen rules of the operator and of all the
+     * operators it decomposes into, or std::nullopt if the operator is not cached.
+     */
+    [[nodiscard]] std::optional<Core::GraphResult> lookup(const GraphKey &graphKey,
+                                                          const Core::OperatorNode &op) const;
+
+    /**
+     * @brief Caches the solution of an operator in the graphs of the given key.
+     *
+     * If the cache is full, the oldest cached solution is evicted.
+     *
+     * @param graphKey The key of the graph, as returned by getGraphKey.
+     * @param op The solved operator node.
+     * @param solution The chosen rules of the operator and of all the operators it decomposes
+     * into.
+     */
+    void insert(const GraphKey &graphKey, const Core::OperatorNode &op,
+                Core::GraphResult solution);
+
+    /**
+     * @brief Returns the number of cached operator solutions, over all the graphs.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Writes all the cached solutions to the given stream.
+     */
+    void save(std::ostream &os) const;
+
+    /**
+     * @brief Reads solutions written by save from the given stream and adds them to the cache.
+     *
+     * Solutions that are already cached are kept. Loaded solutions are newer than the cached
+     * ones, and are evicted last.
+     *
+     * @throws Core::GraphError if the stream is not a valid solution cache.
+     */
+    void load(std::istream &is);
+
+  private:
+    using OperatorSolutions =
+        std::unordered_map<Core::OperatorNode, Core::GraphResult, Core::OperatorNodeHash>;
+
+    struct GraphKeyHash {
+        std::size_t operator()(const GraphKey &key) const { return key.hash; }
+    };
+
+    void insertLocked(const GraphKey &graphKey, const Core::OperatorNode &op,
+                      Core::GraphResult solution);
+
+    mutable std::mutex mutex;
+    std::size_t maxSize;
+    std::unordered_map<GraphKey, OperatorSolutions, GraphKeyHash> graphs{};
+
+    // The cached solutions from oldest to newest. The keys point into `graphs`, whose nodes are
+    // stable until erased.
+    std::deque<std::pair<const GraphKey *, const Core::OperatorNode *>> insertionOrder{};
+};
+
+} // namespace DecompGraph::Solver
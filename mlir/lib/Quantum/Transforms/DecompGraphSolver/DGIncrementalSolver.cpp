@@ -0,0 +1,350 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file DGIncrementalSolver.cpp
+ */
+
+#include "DGIncrementalSolver.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "DGCache.hpp"
+#include "DGTypes.hpp"
+#include "DGUtils.hpp"
+
+using namespace DecompGraph::Core;
+
+namespace DecompGraph::Solver {
+
+IncrementalSolver::IncrementalSolver(DecompositionGraph _graph) : graph(std::move(_graph))
+{
+    const std::size_t numOps = graph.getNumOperatorIds();
+    const std::size_t numRules = graph.getNumRules();
+    costs.assign(numOps, infinity);
+    chosenRules.assign(numOps, noRule);
+    isPending.assign(numOps, false);
+    pendingInputs.assign(numRules, 0);
+
+    // The users are only built once, as the rules of the graph don't depend on the gate costs
+    userOffsets.assign(numOps + 1, 0);
+    for (RuleId rule = 0; rule < numRules; rule++) {
+        if (graph.isTargetGate(graph.getRuleOutputId(rule))) {
+            continue; // target gates are never decomposed
+        }
+        for (const auto &input : graph.getRuleInputIds(rule)) {
+            userOffsets[input.op + 1]++;
+        }
+    }
+    for (OperatorId id = 0; id < numOps; id++) {
+        userOffsets[id + 1] += userOffsets[id];
+    }
+    users.resize(userOffsets.back());
+    std::vector<std::size_t> nextUser(userOffsets.begin(), userOffsets.end() - 1);
+    for (RuleId rule = 0; rule < numRules; rule++) {
+        if (graph.isTargetGate(graph.getRuleOutputId(rule))) {
+            continue;
+        }
+        for (const auto &input : graph.getRuleInputIds(rule)) {
+            users[nextUser[input.op]++] = rule;
+        }
+    }
+}
+
+std::string IncrementalSolver::getGraphKey(const DecompositionGraph &graph)
+{
+    // The exported solution only covers the operators the roots decompose into
+    std::vector<std::string> roots;
+    for (const auto &root : graph.getRootOps()) {
+        roots.push_back(print_op(root));
+    }
+    std::sort(roots.begin(), roots.end());
+
+    std::ostringstream key;
+    key << SolutionCache::getGraphKey(graph, /*withCosts=*/false).text << roots.size() << '\n';
+    for (const auto &root : roots) {
+        key << root << '\n';
+    }
+    return key.str();
+}
+
+double IncrementalSolver::evalRule(RuleId rule) const
+{
+    const auto inputs = graph.getRuleInputIds(rule);
+    if (inputs.empty()) {
+        return infinity; // invalid rule
+    }
+
+    double total_cost = 0.0;
+    for (const auto &input : inputs) {
+        total_cost += costs[input.op] * static_cast<double>(input.multiplicity);
+    }
+    return total_cost;
+}
+
+void IncrementalSolver::resolve(const std::vector<OperatorId> &ops)
+{
+    struct Candidate {
+        double cost;
+        std::size_t order;
+        OperatorId op;
+
+        bool operator>(const Candidate &other) const
+        {
+            return cost != other.cost ? cost > other.cost : order > other.order;
+        }
+    };
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> queue;
+    std::size_t numCandidates = 0;
+
+    // Keep the cheapest candidate rule of each operator, the first one in the graph on ties, as
+    // the best-first strategy of the DecompositionSolver
+    auto offer = [&](OperatorId id, double cost, RuleId rule) {
+        if (cost == infinity || costs[id] < cost ||
+            (costs[id] == cost && chosenRules[id] <= rule)) {
+            return;
+        }
+        queue.push(Candidate{cost, numCandidates++, id});
+        costs[id] = cost;
+        chosenRules[id] = rule;
+    };
+
+    for (const OperatorId id : ops) {
+        isPending[id] = true;
+        costs[id] = infinity;
+        chosenRules[id] = noRule;
+    }
+
+    // Rules wait for their pending inputs to be resolved, each input term counting separately,
+    // while the other operators keep their costs
+    for (const OperatorId id : ops) {
+        if (graph.isTargetGate(id)) {
+            queue.push(Candidate{graph.getTargetCost(id), numCandidates++, id});
+            costs[id] = graph.getTargetCost(id);
+            continue;
+        }
+        for (const RuleId rule : graph.getRuleIdsFor(id)) {
+            pendingInputs[rule] = 0;
+            for (const auto &input : graph.getRuleInputIds(rule)) {
+                pendingInputs[rule] += isPending[input.op] ? 1 : 0;
+            }
+        }
+    }
+    for (const OperatorId id : ops) {
+        if (graph.isTargetGate(id)) {
+            continue;
+        }
+        for (const RuleId rule : graph.getRuleIdsFor(id)) {
+            if (pendingInputs[rule] == 0) {
+                offer(id, evalRule(rule), rule);
+            }
+        }
+    }
+
+    while (!queue.empty()) {
+        const OperatorId id = queue.top().op;
+        queue.pop();
+        if (!isPending[id]) {
+            continue; // already resolved at a lower cost
+        }
+        isPending[id] = false;
+        numResolved++;
+
+        for (std::size_t userIdx = userOffsets[id]; userIdx < userOffsets[id + 1]; userIdx++) {
+            const RuleId rule = users[userIdx];
+            const OperatorId output = graph.getRuleOutputId(rule);
+            if (!isPending[output] || --pendingInputs[rule] != 0) {
+                continue;
+            }
+            offer(output, evalRule(rule), rule);
+        }
+    }
+
+    // The operators left pending cannot be decomposed
+    for (const OperatorId id : ops) {
+        isPending[id] = false;
+    }
+}
+
+void IncrementalSolver::raiseCosts(const std::vector<OperatorId> &gates)
+{
+    // The affected operators are the gates and the operators whose chosen rule uses an affected
+    // operator, the others keep their costs and rules
+    std::vector<OperatorId> affected;
+    for (const OperatorId gate : gates) {
+        isPending[gate] = true;
+        affected.push_back(gate);
+    }
+    for (std::size_t idx = 0; idx < affected.size(); idx++) {
+        const OperatorId id = affected[idx];
+        for (std::size_t userIdx = userOffsets[id]; userIdx < userOffsets[id + 1]; userIdx++) {
+            const RuleId rule = users[userIdx];
+            const OperatorId output = graph.getRuleOutputId(rule);
+            if (chosenRules[output] == rule && !isPending[output]) {
+                isPending[output] = true;
+                affected.push_back(output);
+            }
+        }
+    }
+    for (const OperatorId id : affected) {
+        isPending[id] = false;
+    }
+
+    resolve(affected);
+}
+
+void IncrementalSolver::lowerCosts(const std::vector<OperatorId> &gates)
+{
+    using Candidate = std::pair<double, OperatorId>;
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> queue;
+    std::vector<OperatorId> updated;
+
+    auto update = [&](OperatorId id, double cost, RuleId rule) {
+        costs[id] = cost;
+        chosenRules[id] = rule;
+        queue.emplace(cost, id);
+        if (!isPending[id]) {
+            isPending[id] = true;
+            updated.push_back(id);
+        }
+    };
+
+    for (const OperatorId gate : gates) {
+        update(gate, graph.getTargetCost(gate), noRule);
+    }
+
+    // Gate costs are non-negative, so a rule is never cheaper than its inputs, and the updates
+    // settle in increasing order of cost, as in Dijkstra's algorithm
+    while (!queue.empty()) {
+        const auto [cost, id] = queue.top();
+        queue.pop();
+        if (cost != costs[id]) {
+            continue; // updated again at a lower cost
+        }
+
+        for (std::size_t userIdx = userOffsets[id]; userIdx < userOffsets[id + 1]; userIdx++) {
+            const RuleId rule = users[userIdx];
+            const OperatorId output = graph.getRuleOutputId(rule);
+            if (const double ruleCost = evalRule(rule); ruleCost < costs[output]) {
+                update(output, ruleCost, rule);
+            }
+        }
+    }
+
+    numResolved += updated.size();
+    for (const OperatorId id : updated) {
+        isPending[id] = false;
+    }
+}
+
+bool IncrementalSolver::updateGateset(const WeightedGateset &gateset)
+{
+    if (!graph.setTargetCosts(gateset)) {
+        return false;
+    }
+    numResolved = 0;
+    if (!solved) {
+        return true;
+    }
+
+    std::vector<OperatorId> raised;
+    std::vector<OperatorId> lowered;
+    for (OperatorId id = 0; id < graph.getNumOperatorIds(); id++) {
+        if (!graph.isTargetGate(id) || graph.getTargetCost(id) == costs[id]) {
+            continue;
+        }
+        (graph.getTargetCost(id) > costs[id] ? raised : lowered).push_back(id);
+    }
+
+    // The lowered gates keep their previous costs until the raised gates are resolved, so that
+    // their decreases are propagated from a solution that is optimal for the previous costs
+    if (!raised.empty()) {
+        raiseCosts(raised);
+    }
+    if (!lowered.empty()) {
+        lowerCosts(lowered);
+    }
+    return true;
+}
+
+ChosenDecompRule IncrementalSolver::exportRule(OperatorId id, GraphResult &result)
+{
+    ChosenDecompRule chosen;
+    chosen.totalCost = costs[id];
+
+    if (chosenRules[id] == noRule) {
+        chosen.op = graph.getOperator(id);
+        chosen.isBasis = true;
+        chosen.ruleName = "BasisRule";
+        chosen.basisCounts.emplace(graph.getOperator(id), 1);
+        return chosen;
+    }
+
+    // The inputs of the chosen rules are resolved before the operators using them, so the
+    // chosen rules don't form cycles
+    for (const auto &input : graph.getRuleInputIds(chosenRules[id])) {
+        const auto &inputOp = graph.getOperator(input.op);
+        auto inputIt = result.find(inputOp);
+        if (inputIt == result.end()) {
+            inputIt = result.emplace(inputOp, exportRule(input.op, result)).first;
+        }
+        for (const auto &[basis_op, count] : inputIt->second.basisCounts) {
+            chosen.basisCounts[basis_op] += count * input.multiplicity;
+        }
+    }
+
+    const auto &rule = graph.getRule(chosenRules[id]);
+    chosen.op = rule.output;
+    chosen.isBasis = false;
+    chosen.ruleName = rule.name;
+    chosen.inputs = rule.inputs;
+    return chosen;
+}
+
+GraphResult IncrementalSolver::solve()
+{
+    if (!solved) {
+        std::vector<OperatorId> ops(graph.getNumOperatorIds());
+        for (OperatorId id = 0; id < ops.size(); id++) {
+            ops[id] = id;
+        }
+        numResolved = 0;
+        resolve(ops);
+        solved = true;
+    }
+
+    GraphResult result;
+    for (const auto &root : graph.getRootOps()) {
+        const OperatorId rootId = *graph.findOperatorId(root);
+        if (costs[rootId] == infinity) {
+            std::vector<std::string> rules_error;
+            for (const auto &rule : graph.getAllRulesFor(root)) {
+                rules_error.push_back(rule.name);
+            }
+            throw GraphSolverFailedError(root, rules_error);
+        }
+        if (result.find(root) == result.end()) {
+            result.emplace(root, exportRule(rootId, result));
+        }
+    }
+    return result;
+}
+
+} // namespace DecompGraph::Solver
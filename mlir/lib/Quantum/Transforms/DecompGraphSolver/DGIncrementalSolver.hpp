@@ -0,0 +1,146 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file DGIncrementalSolver.hpp
+ *
+ * @brief This file defines the IncrementalSolver class, which keeps a decomposition graph and
+ * the optimal decompositions of all its operators, so that the graph is solved again for other
+ * gate costs by only updating the operators whose decompositions are affected by the changed
+ * costs, such as in a sweep over the weights of the target gateset.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "DGBuilder.hpp"
+#include "DGTypes.hpp"
+
+namespace DecompGraph::Solver {
+
+/**
+ * @brief An incremental best-first solver of a decomposition graph.
+ *
+ * The first solve resolves all the operators of the graph bottom-up from the target gates, as
+ * the best-first strategy of the DecompositionSolver. When the costs of the target gates change,
+ * the costs are propagated as in dynamic shortest path algorithms (Ramalingam and Reps, 1996):
+ *
+ * - The operators whose chosen decomposition uses a gate that became more expensive are
+ *   resolved again, best-first from the operators that are not affected.
+ * - The gates that became cheaper are then propagated to the operators whose rules use them, as
+ *   long as a rule becomes cheaper than the chosen one.
+ *
+ * The costs of the solution are the same as those of a new solve. Among rules of equal cost, the
+ * rule kept may differ from the one a new solve would choose. Gate costs must be non-negative.
+ */
+class IncrementalSolver {
+  public:
+    /**
+     * @brief Constructs an IncrementalSolver that keeps the given decomposition graph.
+     */
+    explicit IncrementalSolver(DecompositionGraph _graph);
+
+    /**
+     * @brief Returns the key under which the solver of the given graph is kept, which describes
+     * the root operators, the target gates and the effective rules of the graph, but not the gate
+     * costs.
+     */
+    [[nodiscard]] static std::string getGraphKey(const DecompositionGraph &graph);
+
+    [[nodiscard]] const DecompositionGraph &getGraph() const noexcept { return graph; }
+
+    /**
+     * @brief Solves the graph for the current gate costs, and returns the chosen rules of the
+     * root operators and of all the operators they decompose into.
+     *
+     * @throws GraphSolverFailedError if a root operator cannot be decomposed.
+     */
+    Core::GraphResult solve();
+
+    /**
+     * @brief Changes the costs of the target gates, and updates the solution of the affected
+     * operators if the graph was already solved.
+     *
+     * @param gateset The target gateset with the new costs.
+     * @return bool False if the gates of the given gateset differ from the target gates of the
+     * graph, in which case the graph must be rebuilt.
+     */
+    bool updateGateset(const Core::WeightedGateset &gateset);
+
+    /**
+     * @brief Returns the number of operators resolved by the last solve or update.
+     */
+    [[nodiscard]] std::size_t getNumResolved() const noexcept { return numResolved; }
+
+  private:
+    using OperatorId = DecompositionGraph::OperatorId;
+    using RuleId = DecompositionGraph::RuleId;
+
+    // The rule of target gates and of operators without decomposition
+    static constexpr RuleId noRule = std::numeric_limits<RuleId>::max();
+    static constexpr double infinity = std::numeric_limits<double>::infinity();
+
+    DecompositionGraph graph;
+    bool solved{false};
+    std::size_t numResolved{0};
+
+    // The optimal cost and chosen rule of each operator
+    std::vector<double> costs{};
+    std::vector<RuleId> chosenRules{};
+
+    // The rules using each operator, once per input term, stored contiguously at
+    // userOffsets[id] to userOffsets[id + 1]
+    std::vector<std::size_t> userOffsets{};
+    std::vector<RuleId> users{};
+
+    // Scratch space of the resolution, which is reset after each resolution
+    std::vector<bool> isPending{};
+    std::vector<std::size_t> pendingInputs{};
+
+    /**
+     * @brief Returns the cost of the given rule from the current costs of its inputs, or
+     * infinity if the rule has no inputs or an input has no decomposition.
+     */
+    [[nodiscard]] double evalRule(RuleId rule) const;
+
+    /**
+     * @brief Resolves the given operators best-first, from the costs of the other operators.
+     */
+    void resolve(const std::vector<OperatorId> &ops);
+
+    /**
+     * @brief Resolves the operators whose chosen decompositions use the given gates, whose costs
+     * increased.
+     */
+    void raiseCosts(const std::vector<OperatorId> &gates);
+
+    /**
+     * @brief Propagates the given gates, whose costs decreased, to the operators that become
+     * cheaper.
+     */
+    void lowerCosts(const std::vector<OperatorId> &gates);
+
+    /**
+     * @brief Converts the solution of the given operator back to a chosen decomposition rule,
+     * with the basis gate counts of its decomposition.
+     */
+    Core::ChosenDecompRule exportRule(OperatorId id, Core::GraphResult &result);
+};
+
+} // namespace DecompGraph::Solver
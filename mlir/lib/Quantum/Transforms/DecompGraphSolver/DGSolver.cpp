@@ -19,8 +19,12 @@
 #include "DGSolver.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <optional>
+#include <queue>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "DGTypes.hpp"
@@ -29,117 +33,431 @@ using namespace DecompGraph::Core;
 
 namespace DecompGraph::Solver {
 
-ChosenDecompRule DecompositionSolver::basisRule(const OperatorNode &op)
+void DecompositionSolver::setSolved(OperatorId id, SolutionKind kind, RuleId rule, double totalCost)
 {
-    if (!graph.isTargetGate(op)) {
-        return invalidRule(op); // not a target gate, so no valid basis rule
+    auto &solution = solutions[id];
+    solution.state = SolutionState::Solved;
+    solution.kind = kind;
+    solution.rule = rule;
+    solution.totalCost = totalCost;
+    solution.basisCounts.clear();
+
+    if (kind == SolutionKind::Basis) {
+        solution.basisCounts.emplace_back(id, 1);
+        return;
     }
 
-    ChosenDecompRule solution;
-    solution.op = op;
-    solution.isBasis = true;
-    solution.totalCost = graph.getGateset().getCost(op);
-    solution.basisCounts.emplace(op, 1);
-    solution.ruleName = "BasisRule";
-    return solution;
+    if (kind == SolutionKind::Cached) {
+        for (const auto &[basis_op, count] : cachedRules.at(id).basisCounts) {
+            solution.basisCounts.emplace_back(*graph.findOperatorId(basis_op), count);
+        }
+        std::sort(solution.basisCounts.begin(), solution.basisCounts.end());
+        return;
+    }
+
+    // Aggregate the counts of the inputs in a dense array, and only sort the touched entries
+    for (const auto &input : graph.getRuleInputIds(rule)) {
+        for (const auto &[basis_id, count] : solutions[input.op].basisCounts) {
+            if (!scratchSeen[basis_id]) {
+                scratchSeen[basis_id] = true;
+                scratchIds.push_back(basis_id);
+            }
+            scratchCounts[basis_id] += count * input.multiplicity;
+        }
+    }
+    std::sort(scratchIds.begin(), scratchIds.end());
+    solution.basisCounts.reserve(scratchIds.size());
+    for (const OperatorId basis_id : scratchIds) {
+        solution.basisCounts.emplace_back(basis_id, scratchCounts[basis_id]);
+        scratchCounts[basis_id] = 0;
+        scratchSeen[basis_id] = false;
+    }
+    scratchIds.clear();
 }
 
-ChosenDecompRule DecompositionSolver::evalRule(const RuleNode &rule)
+std::optional<double> DecompositionSolver::evalRule(RuleId rule)
 {
-    ChosenDecompRule solution;
-    solution.ruleName = rule.name;
-    solution.isBasis = false;
-    solution.inputs = rule.inputs;
-    solution.op = rule.output;
+    const auto inputs = graph.getRuleInputIds(rule);
+    if (inputs.empty()) {
+        return std::nullopt; // invalid rule
+    }
 
     double total_cost = 0.0;
-    for (const auto &input : rule.inputs) {
-        ChosenDecompRule child;
-        child = solveOperator(input.op);
-        if (isInvalidRule(child)) {
+    for (const auto &input : inputs) {
+        if (!solveOperator(input.op)) {
             // if any input cannot be solved, this rule is invalid
-            return invalidRule(solution.op);
+            return std::nullopt;
         }
+        total_cost += solutions[input.op].totalCost * static_cast<double>(input.multiplicity);
+    }
+    return total_cost;
+}
+
+std::vector<DecompositionSolver::OperatorId> DecompositionSolver::lookupCached(OperatorId id)
+{
+    if (cache == nullptr) {
+        return {};
+    }
+    auto cached = cache->lookup(graphKey, graph.getOperator(id));
+    if (!cached.has_value()) {
+        return {};
+    }
 
-        total_cost += child.totalCost * static_cast<double>(input.multiplicity);
-        for (const auto &[basis_op, count] : child.basisCounts) {
-            solution.basisCounts[basis_op] += count * input.multiplicity;
+    // Graphs with the same key have the same operators, but check in case of stale caches
+    std::vector<OperatorId> closure;
+    closure.reserve(cached->size());
+    for (const auto &[op, rule] : *cached) {
+        const auto opId = graph.findOperatorId(op);
+        if (!opId.has_value()) {
+            return {};
         }
+        for (const auto &[basis_op, _] : rule.basisCounts) {
+            if (!graph.findOperatorId(basis_op).has_value()) {
+                return {};
+            }
+        }
+        for (const auto &input : rule.inputs) {
+            if (!graph.findOperatorId(input.op).has_value()) {
+                return {};
+            }
+        }
+        closure.push_back(*opId);
     }
 
-    if (rule.inputs.empty() && total_cost == 0.0) {
-        return invalidRule(solution.op); // invalid rule
+    for (auto &[op, rule] : *cached) {
+        cachedRules.emplace(*graph.findOperatorId(op), std::move(rule));
     }
-    solution.totalCost = total_cost;
-    return solution;
+    return closure;
 }
 
-ChosenDecompRule DecompositionSolver::bestRule(const OperatorNode &op)
+bool DecompositionSolver::solveOperator(OperatorId id)
 {
-    const auto &all_rules = graph.getAllRulesFor(op);
-    if (all_rules.empty()) {
-        return invalidRule(op); // no valid rules
+    auto &solution = solutions[id];
+
+    // Check if the operator has already been solved
+    if (solution.state == SolutionState::Solved) {
+        if (solution.pathDependent) {
+            cycleDepth = 0; // conservatively make the operators using it path-dependent
+        }
+        return true;
     }
 
-    std::optional<ChosenDecompRule> best_rule;
+    if (solution.state == SolutionState::Solving) {
+        cycleDepth = std::min(cycleDepth, solution.depth);
+        return false; // cycle detected, fail to prevent infinite recursion
+    }
+
+    if (const auto closure = lookupCached(id); !closure.empty()) {
+        for (const OperatorId cachedId : closure) {
+            if (solutions[cachedId].state == SolutionState::Unsolved) {
+                setSolved(cachedId, SolutionKind::Cached, 0, cachedRules.at(cachedId).totalCost);
+            }
+        }
+        return true;
+    }
+
+    const std::size_t depth = stackSize;
+    const std::size_t outerCycleDepth =
+        std::exchange(cycleDepth, std::numeric_limits<std::size_t>::max());
+
+    // RAII guard for the solving state to check/solve the graph recursively
+    struct SolvingGuard {
+        std::vector<OperatorSolution> &solutions_;
+        std::size_t &stackSize_;
+        OperatorId id_;
 
-    for (const auto &rule : all_rules) {
-        auto candidate = evalRule(rule);
-        if (!isInvalidRule(candidate) &&
-            (!best_rule.has_value() || candidate.totalCost < best_rule->totalCost)) {
-            best_rule = std::move(candidate);
+        explicit SolvingGuard(std::vector<OperatorSolution> &solutions, std::size_t &stackSize,
+                              OperatorId id, std::size_t depth)
+            : solutions_(solutions), stackSize_(stackSize), id_(id)
+        {
+            solutions_[id_].state = SolutionState::Solving;
+            solutions_[id_].depth = depth;
+            stackSize_++;
+        }
+        ~SolvingGuard()
+        {
+            if (solutions_[id_].state == SolutionState::Solving) {
+                solutions_[id_].state = SolutionState::Unsolved;
+            }
+            stackSize_--;
         }
+
+        SolvingGuard(const SolvingGuard &) = delete;
+        SolvingGuard &operator=(const SolvingGuard &) = delete;
+    } solvingGuard(solutions, stackSize, id, depth);
+
+    bool solved = false;
+    if (graph.isTargetGate(id)) {
+        setSolved(id, SolutionKind::Basis, 0, graph.getTargetCost(id));
+        solved = true;
     }
+    else {
+        // Keep the first rule with the lowest cost
+        std::optional<std::pair<double, RuleId>> best_rule;
+        for (const RuleId rule : graph.getRuleIdsFor(id)) {
+            const auto cost = evalRule(rule);
+            if (cost.has_value() && (!best_rule.has_value() || *cost < best_rule->first)) {
+                best_rule.emplace(*cost, rule);
+            }
+        }
 
-    if (!best_rule.has_value()) {
-        return invalidRule(op); // no valid rules
+        // Keep the cached solution if the operator was found in the cache while solving its
+        // rules, through a cycle
+        if (cachedRules.find(id) != cachedRules.end()) {
+            setSolved(id, SolutionKind::Cached, 0, cachedRules.at(id).totalCost);
+            solved = true;
+        }
+        else if (best_rule.has_value()) {
+            setSolved(id, SolutionKind::Rule, best_rule->second, best_rule->first);
+            solved = true;
+        }
     }
 
-    return best_rule.value();
+    // Cycles cut at this operator or below don't depend on the path to it
+    const bool isPathDependent = cycleDepth < depth;
+    cycleDepth = std::min(cycleDepth, outerCycleDepth);
+
+    if (solved) {
+        if (isPathDependent) {
+            solutions[id].pathDependent = true;
+        }
+        else if (cache != nullptr) {
+            cache->insert(graphKey, graph.getOperator(id), collectSolution(id));
+        }
+    }
+    return solved;
 }
 
-ChosenDecompRule DecompositionSolver::solveOperator(const OperatorNode &op)
+ChosenDecompRule DecompositionSolver::exportRule(OperatorId id) const
 {
-    // Check if the operator has already been solved
-    if (const auto it = solvedMap.find(op); it != solvedMap.end()) {
-        return it->second;
+    const auto &solution = solutions[id];
+    if (solution.kind == SolutionKind::Cached) {
+        return cachedRules.at(id);
     }
 
-    if (visited.find(op) != visited.end()) {
-        return invalidRule(op); // cycle detected, return invalid rule to prevent infinite recursion
+    ChosenDecompRule chosen;
+    chosen.totalCost = solution.totalCost;
+    for (const auto &[basis_id, count] : solution.basisCounts) {
+        chosen.basisCounts.emplace(graph.getOperator(basis_id), count);
     }
 
-    // RAII guard for the visited set to check/solve the graph recursively
-    struct VisitGuard {
-        std::unordered_set<OperatorNode, OperatorNodeHash> &visited_;
-        std::vector<OperatorNode> &solvingStack_;
-        const OperatorNode &currentNode_;
+    if (solution.kind == SolutionKind::Basis) {
+        chosen.op = graph.getOperator(id);
+        chosen.isBasis = true;
+        chosen.ruleName = "BasisRule";
+        return chosen;
+    }
 
-        explicit VisitGuard(std::unordered_set<OperatorNode, OperatorNodeHash> &visited,
-                            std::vector<OperatorNode> &solvingStack, const OperatorNode &node)
-            : visited_(visited), solvingStack_(solvingStack), currentNode_(node)
-        {
-            visited_.insert(currentNode_);         // add to visited in case of exceptions
-            solvingStack_.push_back(currentNode_); // push to stack in case of exceptions
+    const auto &rule = graph.getRule(solution.rule);
+    chosen.op = rule.output;
+    chosen.isBasis = false;
+    chosen.ruleName = rule.name;
+    chosen.inputs = rule.inputs;
+    return chosen;
+}
+
+GraphResult DecompositionSolver::collectSolution(OperatorId id) const
+{
+    GraphResult solution;
+    std::unordered_set<OperatorId> collected;
+    std::vector<OperatorId> pending{id};
+    while (!pending.empty()) {
+        const OperatorId current = pending.back();
+        pending.pop_back();
+
+        if (solutions[current].state != SolutionState::Solved ||
+            !collected.insert(current).second) {
+            continue;
         }
-        ~VisitGuard()
+        solution.emplace(graph.getOperator(current), exportRule(current));
+
+        const auto &currentSolution = solutions[current];
+        if (currentSolution.kind == SolutionKind::Rule) {
+            for (const auto &input : graph.getRuleInputIds(currentSolution.rule)) {
+                pending.push_back(input.op);
+            }
+        }
+        else if (currentSolution.kind == SolutionKind::Cached) {
+            for (const auto &input : cachedRules.at(current).inputs) {
+                pending.push_back(*graph.findOperatorId(input.op));
+            }
+        }
+    }
+    return solution;
+}
+
+GraphResult DecompositionSolver::collectAllSolutions() const
+{
+    GraphResult solution;
+    for (OperatorId id = 0; id < solutions.size(); id++) {
+        if (solutions[id].state == SolutionState::Solved) {
+            solution.emplace(graph.getOperator(id), exportRule(id));
+        }
+    }
+    return solution;
+}
+
+std::optional<OperatorNode> DecompositionSolver::solveBestFirst()
+{
+    const std::size_t numOps = graph.getNumOperatorIds();
+    const std::size_t numRules = graph.getNumRules();
+
+    // Rules wait for their inputs to be resolved, each input term counting separately. The users
+    // of each operator are stored contiguously, at userOffsets[id] to userOffsets[id + 1].
+    std::vector<std::size_t> pendingInputs(numRules, 0);
+    std::vector<std::size_t> userOffsets(numOps + 1, 0);
+    for (RuleId rule = 0; rule < numRules; rule++) {
+        const auto inputs = graph.getRuleInputIds(rule);
+        if (inputs.empty() || graph.isTargetGate(graph.getRuleOutputId(rule))) {
+            continue; // rules without inputs are invalid, and target gates are never decomposed
+        }
+        pendingInputs[rule] = inputs.size();
+        for (const auto &input : inputs) {
+            userOffsets[input.op + 1]++;
+        }
+    }
+    for (OperatorId id = 0; id < numOps; id++) {
+        userOffsets[id + 1] += userOffsets[id];
+    }
+    std::vector<RuleId> users(userOffsets.back());
+    std::vector<std::size_t> nextUser(userOffsets.begin(), userOffsets.end() - 1);
+    for (RuleId rule = 0; rule < numRules; rule++) {
+        if (pendingInputs[rule] == 0) {
+            continue;
+        }
+        for (const auto &input : graph.getRuleInputIds(rule)) {
+            users[nextUser[input.op]++] = rule;
+        }
+    }
+
+    struct Candidate {
+        double cost;
+        std::size_t order;
+        OperatorId op;
+
+        bool operator>(const Candidate &other) const
         {
-            visited_.erase(currentNode_);
-            if (!solvingStack_.empty()) {
-                solvingStack_.pop_back();
+            return cost != other.cost ? cost > other.cost : order > other.order;
+        }
+    };
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> queue;
+    std::size_t numCandidates = 0;
+
+    // Only the cost and the rule of the candidates are kept, their basis gate counts are only
+    // aggregated for the rules chosen at resolution. Rules are shifted by one, so that zero
+    // identifies target gates and cached solutions, which are known up front.
+    std::vector<double> bestCost(numOps, std::numeric_limits<double>::infinity());
+    std::vector<std::size_t> bestRule(numOps, std::numeric_limits<std::size_t>::max());
+
+    // Keep the cheapest candidate rule of each operator, the first one in the graph on ties
+    auto offer = [&](OperatorId id, double cost, std::size_t ruleTag) {
+        if (bestCost[id] < cost || (bestCost[id] == cost && bestRule[id] <= ruleTag)) {
+            return;
+        }
+        queue.push(Candidate{cost, numCandidates++, id});
+        bestCost[id] = cost;
+        bestRule[id] = ruleTag;
+    };
+
+    // Cached solutions are optimal, they seed the search in case other roots decompose into them
+    std::vector<bool> isUnresolvedRoot(numOps, false);
+    std::size_t numUnresolvedRoots = 0;
+    for (const auto &root : graph.getRootOps()) {
+        const OperatorId rootId = *graph.findOperatorId(root);
+        if (const auto closure = lookupCached(rootId); !closure.empty()) {
+            for (const OperatorId cachedId : closure) {
+                offer(cachedId, cachedRules.at(cachedId).totalCost, 0);
             }
+            continue;
         }
+        if (!isUnresolvedRoot[rootId]) {
+            isUnresolvedRoot[rootId] = true;
+            numUnresolvedRoots++;
+        }
+    }
+    for (OperatorId id = 0; id < numOps; id++) {
+        if (graph.isTargetGate(id)) {
+            offer(id, graph.getTargetCost(id), 0);
+        }
+    }
 
-        VisitGuard(const VisitGuard &) = delete;
-        VisitGuard &operator=(const VisitGuard &) = delete;
-    } visitGuard(visited, solvingStack, op);
+    while (!queue.empty() && numUnresolvedRoots != 0) {
+        const OperatorId id = queue.top().op;
+        queue.pop();
+        if (solutions[id].state == SolutionState::Solved) {
+            continue; // already resolved at a lower cost
+        }
 
-    auto chosen = graph.isTargetGate(op) ? basisRule(op) : bestRule(op);
+        // All the inputs of the chosen rule are resolved, so its counts can be aggregated
+        if (bestRule[id] != 0) {
+            setSolved(id, SolutionKind::Rule, bestRule[id] - 1, bestCost[id]);
+        }
+        else if (cachedRules.find(id) != cachedRules.end()) {
+            setSolved(id, SolutionKind::Cached, 0, bestCost[id]);
+        }
+        else {
+            setSolved(id, SolutionKind::Basis, 0, bestCost[id]);
+        }
+        if (isUnresolvedRoot[id]) {
+            isUnresolvedRoot[id] = false;
+            numUnresolvedRoots--;
+        }
+
+        for (std::size_t userIdx = userOffsets[id]; userIdx < userOffsets[id + 1]; userIdx++) {
+            const RuleId rule = users[userIdx];
+            if (--pendingInputs[rule] != 0) {
+                continue;
+            }
 
-    if (!isInvalidRule(chosen)) {
-        solvedMap.emplace(op, chosen);
+            const OperatorId output = graph.getRuleOutputId(rule);
+            if (solutions[output].state == SolutionState::Solved) {
+                continue;
+            }
+            double cost = 0.0;
+            for (const auto &input : graph.getRuleInputIds(rule)) {
+                cost += solutions[input.op].totalCost * static_cast<double>(input.multiplicity);
+            }
+            offer(output, cost, rule + 1);
+        }
     }
-    return chosen;
+
+    for (const auto &root : graph.getRootOps()) {
+        if (isUnresolvedRoot[*graph.findOperatorId(root)]) {
+            return root;
+        }
+    }
+
+    // Cached roots are not resolved by the search if it stopped before reaching them
+    for (const auto &[cachedId, rule] : cachedRules) {
+        if (solutions[cachedId].state == SolutionState::Unsolved) {
+            setSolved(cachedId, SolutionKind::Cached, 0, rule.totalCost);
+        }
+    }
+
+    // Only keep the operators the roots decompose into
+    for (const auto &root : graph.getRootOps()) {
+        GraphResult rootSolution = collectSolution(*graph.findOperatorId(root));
+        if (cache != nullptr) {
+            cache->insert(graphKey, root, rootSolution);
+        }
+        solvedMap.merge(rootSolution);
+    }
+    return std::nullopt;
+}
+
+void DecompositionSolver::failRoot(const OperatorNode &root)
+{
+    // Debugging output:
+    graph.showGraph();
+    showSolution(collectAllSolutions());
+
+    // Prepare error msg:
+    std::vector<std::string> rules_error;
+    for (const auto &rule : graph.getAllRulesFor(root)) {
+        rules_error.push_back(rule.name);
+    }
+
+    throw GraphSolverFailedError(root, rules_error); // all rules failed for this root operator
 }
 
 GraphResult DecompositionSolver::solve()
@@ -149,24 +467,29 @@ GraphResult DecompositionSolver::solve()
         return solvedMap;
     }
 
-    for (const auto &root : graph.getRootOps()) {
-        const auto chosen_rule = solveOperator(root);
-        if (isInvalidRule(chosen_rule)) {
-            // Debugging output:
-            graph.showGraph();
-            showSolution(solvedMap);
-
-            // Prepare error msg:
-            std::vector<std::string> rules_error;
-            for (const auto &rule : graph.getAllRulesFor(root)) {
-                rules_error.push_back(rule.name);
-            }
+    if (cache != nullptr) {
+        graphKey = SolutionCache::getGraphKey(graph);
+    }
+
+    const std::size_t numOps = graph.getNumOperatorIds();
+    solutions.assign(numOps, OperatorSolution{});
+    scratchCounts.assign(numOps, 0);
+    scratchSeen.assign(numOps, false);
 
-            throw GraphSolverFailedError(root,
-                                         rules_error); // all rules failed for this root operator
+    if (strategy == SolverStrategy::BestFirst) {
+        if (const auto failedRoot = solveBestFirst(); failedRoot.has_value()) {
+            failRoot(*failedRoot);
+        }
+        return solvedMap;
+    }
+
+    for (const auto &root : graph.getRootOps()) {
+        if (!solveOperator(*graph.findOperatorId(root))) {
+            failRoot(root);
         }
     }
 
+    solvedMap = collectAllSolutions();
     return solvedMap;
 }
 
@@ -20,30 +20,57 @@
  * The solver uses a recursive approach with memoization to efficiently explore the decomposition
  * rules and find the best decomposition for each operator node in the graph. The result includes
  * the mapping from operator nodes to their chosen decomposition rules, as well as the list of
- * solved root nodes in the graph.
+ * solved root nodes in the graph. Alternatively, the solver resolves operators best-first from
+ * the target gates, which scales better to large rule libraries.
  */
 
 #pragma once
 
+#include <cstddef>
+#include <limits>
 #include <optional>
+#include <string>
 #include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "DGBuilder.hpp"
+#include "DGCache.hpp"
 #include "DGTypes.hpp"
 #include "DGUtils.hpp"
 
 namespace DecompGraph::Solver {
 
+/**
+ * @brief The search strategies of the DecompositionSolver.
+ *
+ * - DepthFirst: Recursively explores the rules of each root operator, memoising the solved
+ *   operators. Cycles are cut at the operators being solved.
+ * - BestFirst: Resolves operators bottom-up from the target gates in increasing order of cost,
+ *   as in Dijkstra's algorithm generalised to rules with several inputs (Knuth, 1977). Each rule
+ *   is evaluated once, when all its inputs are resolved, and the search stops as soon as all the
+ *   root operators are resolved. It scales better to large rule libraries and is not affected by
+ *   cycles, but requires non-negative gate costs.
+ */
+enum class SolverStrategy : uint8_t { DepthFirst = 0, BestFirst = 1 };
+
 class DecompositionSolver {
   public:
     /**
      * @brief Constructs a DecompositionSolver with the given decomposition graph.
      *
      * @param _graph The decomposition graph to be solved.
+     * @param _cache An optional cache of solutions shared with the solvers of other graphs.
+     * Operators found in the cache are not solved again, and newly solved operators are
+     * added to it.
+     * @param _strategy The search strategy of the solver.
      */
-    explicit DecompositionSolver(const DecompositionGraph &_graph) : graph(_graph) {}
+    explicit DecompositionSolver(const DecompositionGraph &_graph,
+                                 SolutionCache *_cache = nullptr,
+                                 SolverStrategy _strategy = SolverStrategy::DepthFirst)
+        : graph(_graph), cache(_cache), strategy(_strategy)
+    {
+    }
 
     /**
      * @brief Solves the graph decomposition problem for the given decomposition graph
@@ -62,92 +89,121 @@ class DecompositionSolver {
     Core::GraphResult solve();
 
   private:
-    const DecompositionGraph &graph;
+    using OperatorId = DecompositionGraph::OperatorId;
+    using RuleId = DecompositionGraph::RuleId;
 
-    std::unordered_map<Core::OperatorNode, Core::ChosenDecompRule, Core::OperatorNodeHash>
-        solvedMap{};
-    std::unordered_set<Core::OperatorNode, Core::OperatorNodeHash> visited{};
-    std::vector<Core::OperatorNode> solvingStack{};
+    enum class SolutionState : uint8_t { Unsolved = 0, Solving = 1, Solved = 2 };
+    enum class SolutionKind : uint8_t { Basis = 0, Rule = 1, Cached = 2 };
 
     /**
-     * @brief basisRule constructs a ChosenDecompRule for a target gate operator,
-     * which is a valid decomposition rule that represents the operator itself as
-     * a basis gate in the target gateset.
-     *
-     * @param op The operator node to solve for.
-     * @return Core::ChosenDecompRule
+     * @brief The solution of an interned operator. Basis gate counts are kept as pairs of
+     * operator IDs and counts, sorted by operator ID, and are only aggregated for the chosen rule
+     * of each operator.
      */
-    Core::ChosenDecompRule basisRule(const Core::OperatorNode &op);
+    struct OperatorSolution {
+        SolutionState state{SolutionState::Unsolved};
+        SolutionKind kind{SolutionKind::Basis};
+        bool pathDependent{false};
+        std::size_t depth{0}; // position in the solving stack while solving
+        RuleId rule{0};
+        double totalCost{0.0};
+        std::vector<std::pair<OperatorId, std::size_t>> basisCounts{};
+    };
+
+    const DecompositionGraph &graph;
+    SolutionCache *cache;
+    SolverStrategy strategy;
+    SolutionCache::GraphKey graphKey{};
+
+    // Operators are solved by their ID in the graph, and only converted back to operator nodes
+    // in the result
+    std::vector<OperatorSolution> solutions{};
+    std::unordered_map<OperatorId, Core::ChosenDecompRule> cachedRules{};
+    std::vector<std::size_t> scratchCounts{};
+    std::vector<bool> scratchSeen{};
+    std::vector<OperatorId> scratchIds{};
+    std::size_t stackSize{0};
+    Core::GraphResult solvedMap{};
+
+    // The solution of an operator that cuts a cycle through one of the operators being solved
+    // above it in the solving stack depends on the path it was reached from, and cannot be
+    // shared with other graphs. cycleDepth is the lowest depth in the stack of the operators
+    // cut by the operator being solved.
+    std::size_t cycleDepth{std::numeric_limits<std::size_t>::max()};
 
     /**
-     * @brief Evaluates the given decomposition rule and returns the resulting chosen
-     * decomposition rule.
-     *
-     * This method recursively solves for the input operators of the given rule,
-     * calculates the total cost of the decomposition by summing the costs of the input
-     * operators according to the target gateset, and aggregates the basis gate counts
-     * from the input operators. If any of the input operators cannot be solved
-     * (i.e., they do not have a valid decomposition rule), this method returns
-     * an invalid ChosenDecompRule with an empty rule name.
+     * @brief Solves all the root operators with the best-first strategy, see SolverStrategy.
      *
-     * @param rule The decomposition rule to evaluate.
-     * @return Core::ChosenDecompRule The resulting chosen decomposition rule after evaluating
-     * the given rule.
+     * @return std::optional<Core::OperatorNode> The first root operator that could not be
+     * solved, or std::nullopt if all the root operators were solved.
      */
-    Core::ChosenDecompRule evalRule(const Core::RuleNode &rule);
+    std::optional<Core::OperatorNode> solveBestFirst();
 
     /**
-     * @brief Finds the best decomposition rule for the given operator node by evaluating
-     * all applicable rules and selecting the one with the lowest total cost.
-     *
-     * This method retrieves all decomposition rules that can decompose the given operator node
-     * from the decomposition graph, evaluates each rule using the evalRule method, and keeps
-     * track of the best valid rule (i.e., the one with the lowest total cost
-     * that can successfully decompose the operator). If no valid rules are found, this method
-     * returns an invalid ChosenDecompRule with an empty rule name.
-     *
-     * @param op The operator node to find the best decomposition rule for.
-     * @return Core::ChosenDecompRule The best chosen decomposition rule for the given operator
-     * node, or an invalid ChosenDecompRule if no valid rules are found.
+     * @brief Throws a GraphSolverFailedError for the given root operator, after printing the
+     * graph and the partial solution for debugging.
      */
-    Core::ChosenDecompRule bestRule(const Core::OperatorNode &op);
+    [[noreturn]] void failRoot(const Core::OperatorNode &root);
 
     /**
-     * @brief Solves for the given operator node and returns the chosen decomposition rule.
-     *
-     * @param op The operator node to solve for.
-     * @return Core::ChosenDecompRule The chosen decomposition rule for the given operator node
-     * as determined by the graph solver. This includes whether the operator is a basis gate,
-     * the name of the chosen rule, the chosen input operators for the rule,
-     * the total cost of the decomposition, and the counts of basis gates
-     * used in the decomposition.
+     * @brief Looks up the given operator in the solution cache and keeps the cached chosen
+     * rules of the operator and of all the operators it decomposes into.
      *
+     * @return std::vector<OperatorId> The IDs of the operators of the cached solution, or an
+     * empty vector if the operator is not cached. Cached solutions with operators that are not
+     * in the graph are ignored.
+     */
+    std::vector<OperatorId> lookupCached(OperatorId id);
+
+    /**
+     * @brief Marks the given operator as solved with the given kind, rule and cost, and
+     * aggregates its basis gate counts from the inputs of its chosen rule, which must be solved.
      */
-    Core::ChosenDecompRule solveOperator(const Core::OperatorNode &op);
+    void setSolved(OperatorId id, SolutionKind kind, RuleId rule, double totalCost);
 
     /**
-     * @brief Returns an invalid ChosenDecompRule for the given operator node, which indicates
-     * that no valid decomposition rule could be found for the operator. This is used as a
-     * sentinel value to indicate failure in finding a valid decomposition rule during the solving
-     * process.
+     * @brief Converts the solution of the given interned operator back to a chosen decomposition
+     * rule.
+     */
+    Core::ChosenDecompRule exportRule(OperatorId id) const;
+
+    /**
+     * @brief Collects the chosen rules of the given solved operator and of all the operators
+     * it decomposes into, to be stored in the solution cache.
+     */
+    Core::GraphResult collectSolution(OperatorId id) const;
+
+    /**
+     * @brief Collects the chosen rules of all the solved operators.
+     */
+    Core::GraphResult collectAllSolutions() const;
+
+    /**
+     * @brief Evaluates the given decomposition rule and returns its total cost.
      *
-     * @param op The operator node for which to return an invalid ChosenDecompRule.
-     * @return Core::ChosenDecompRule An invalid ChosenDecompRule.
+     * This method recursively solves for the input operators of the given rule and
+     * calculates the total cost of the decomposition by summing the costs of the input
+     * operators according to the target gateset. If any of the input operators cannot be solved
+     * (i.e., they do not have a valid decomposition rule), or the rule has no inputs, this method
+     * returns std::nullopt.
+     *
+     * @param rule The ID of the decomposition rule to evaluate.
+     * @return std::optional<double> The total cost of the rule, if it is valid.
      */
-    [[nodiscard]] inline Core::ChosenDecompRule invalidRule(const Core::OperatorNode &op)
-    {
-        return {op, false, "", {}, 0.0, {}};
-    }
+    std::optional<double> evalRule(RuleId rule);
 
     /**
-     * @brief Checks if the given ChosenDecompRule is invalid, which is determined by whether the
-     * rule name is empty. An invalid ChosenDecompRule indicates that no valid decomposition rule
-     * could be found for the operator during the solving process.
+     * @brief Solves for the given operator and returns whether it has a valid decomposition.
+     *
+     * Target gates are solved as basis gates. Other operators are solved by evaluating all the
+     * rules that decompose them and selecting the first one with the lowest total cost.
+     * Solutions are memoised, while failures are not, since they may be caused by cycles cut
+     * on the path to the operator.
+     *
+     * @param id The ID of the operator to solve for.
+     * @return bool True if the operator was solved.
      */
-    [[nodiscard]] inline bool isInvalidRule(const Core::ChosenDecompRule &rule) const
-    {
-        return rule.ruleName.empty();
-    }
+    bool solveOperator(OperatorId id);
 };
 
 } // namespace DecompGraph::Solver
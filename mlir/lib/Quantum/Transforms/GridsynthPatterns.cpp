@@ -14,8 +14,12 @@
 
 #define DEBUG_TYPE "gridsynth-patterns"
 
+#include <optional>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Debug.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
@@ -25,11 +29,14 @@
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/Builders.h"
 #include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/Dominance.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/Types.h"
 #include "mlir/IR/Value.h"
 
 #include "Catalyst/Utils/EnsureFunctionDeclaration.h"
+#include "GridsynthTable.hpp"
 #include "PBC/IR/PBCOps.h"
 #include "Quantum/IR/QuantumOps.h"
 #include "Quantum/Transforms/Patterns.h"
@@ -70,10 +77,14 @@ Value createGateChain(PatternRewriter &rewriter, Location loc, Value qbitIn,
 }
 
 /**
- * @brief Populates the scf.index_switch op for the Clifford+T basis.
+ * @brief The gates of each Clifford+T gate code (GateType of the RS decomposition runtime).
  */
-void populateCliffordTSwitchCases(PatternRewriter &rewriter, Location loc,
-                                  scf::IndexSwitchOp switchOp, Value qbitIn)
+struct CliffordTConfig {
+    ArrayRef<StringRef> gates;
+    bool isAdjoint;
+};
+
+ArrayRef<CliffordTConfig> getCliffordTConfigs()
 {
     static StringRef gates0[] = {"T"};
     static StringRef gates1[] = {"Hadamard", "T"};
@@ -85,7 +96,7 @@ void populateCliffordTSwitchCases(PatternRewriter &rewriter, Location loc,
     static StringRef gates7[] = {"Hadamard"};
     static StringRef gates8[] = {"S"}; // Used for both Case 8 and 9
 
-    SmallVector<std::pair<llvm::ArrayRef<StringRef>, bool>, 10> caseConfigs = {
+    static const CliffordTConfig caseConfigs[] = {
         {gates0, /*isAdjoint=*/false}, // Case 0
         {gates1, /*isAdjoint=*/false}, // Case 1
         {gates2, /*isAdjoint=*/false}, // Case 2
@@ -97,6 +108,16 @@ void populateCliffordTSwitchCases(PatternRewriter &rewriter, Location loc,
         {gates8, /*isAdjoint=*/false}, // Case 8
         {gates8, /*isAdjoint=*/true},  // Case 9
     };
+    return caseConfigs;
+}
+
+/**
+ * @brief Populates the scf.index_switch op for the Clifford+T basis.
+ */
+void populateCliffordTSwitchCases(PatternRewriter &rewriter, Location loc,
+                                  scf::IndexSwitchOp switchOp, Value qbitIn)
+{
+    ArrayRef<CliffordTConfig> caseConfigs = getCliffordTConfigs();
 
     // Populate Switch Cases
     assert(caseConfigs.size() == switchOp.getCases().size() &&
@@ -108,7 +129,7 @@ void populateCliffordTSwitchCases(PatternRewriter &rewriter, Location loc,
         rewriter.setInsertionPointToStart(&caseRegion.front());
 
         // Pass the qubit through the chain
-        Value qbitOut = createGateChain(rewriter, loc, qbitIn, config.first, config.second);
+        Value qbitOut = createGateChain(rewriter, loc, qbitIn, config.gates, config.isAdjoint);
         scf::YieldOp::create(rewriter, loc, qbitOut);
     }
 
@@ -122,64 +143,76 @@ void populateCliffordTSwitchCases(PatternRewriter &rewriter, Location loc,
 }
 
 /**
- * @brief Populates the scf.index_switch op for the PPR-Basis.
- * Maps the new enum (I, X2...adjZ8) to PPRotationOps.
+ * @brief The rotation of each PPR gate code (PPRGateType of the RS decomposition runtime).
+ * Maps the enum (I, X2...adjZ8) to PPRotationOps.
  */
-void populatePPRBasisSwitchCases(PatternRewriter &rewriter, Location loc,
-                                 scf::IndexSwitchOp switchOp, Value qbitIn)
-{
-    // Helper to create a single PPRotationOp directly on the qubit.
-    auto createPPROp = [&](OpBuilder &builder, ArrayRef<StringRef> pauliWord, int8_t rotationKind,
-                           bool isAdjoint, Value currentQbit) -> Value {
-        // negate if adjoint
-        if (isAdjoint) {
-            rotationKind = -rotationKind;
-        }
-        auto pprOp = catalyst::pbc::PPRotationOp::create(builder, loc, pauliWord, rotationKind,
-                                                         ValueRange{currentQbit});
-        return pprOp->getResult(0);
-    };
-
-    struct PPRConfig {
-        bool isIdentity;
-        ArrayRef<StringRef> pauli;
-        int8_t n;       // The denominator (2, 4, 8)
-        bool isAdjoint; // True if adjX, adjY, etc.
-    };
+struct PPRConfig {
+    bool isIdentity;
+    ArrayRef<StringRef> pauli;
+    int8_t n;       // The denominator (2, 4, 8)
+    bool isAdjoint; // True if adjX, adjY, etc.
+};
 
+ArrayRef<PPRConfig> getPPRConfigs()
+{
     static StringRef xPauli[] = {"X"};
     static StringRef yPauli[] = {"Y"};
     static StringRef zPauli[] = {"Z"};
 
-    SmallVector<PPRConfig> caseConfigs;
+    static const SmallVector<PPRConfig> caseConfigs = [] {
+        SmallVector<PPRConfig> configs;
+
+        // Case 0: I
+        configs.push_back({true, {}, 0, false});
+
+        // Helper to push X, Y, Z series
+        auto pushSeries = [&](ArrayRef<StringRef> pauli) {
+            configs.push_back({false, pauli, 2, false});
+            configs.push_back({false, pauli, 4, false});
+            configs.push_back({false, pauli, 8, false});
+            configs.push_back({false, pauli, 2, true});
+            configs.push_back({false, pauli, 4, true});
+            configs.push_back({false, pauli, 8, true});
+        };
+
+        pushSeries(xPauli);
+        pushSeries(yPauli);
+        pushSeries(zPauli);
+        return configs;
+    }();
+    return caseConfigs;
+}
 
-    // Case 0: I
-    caseConfigs.push_back({true, {}, 0, false});
+/**
+ * @brief Creates a single PPRotationOp directly on the qubit, or forwards it for the identity.
+ */
+Value createPPRGate(OpBuilder &builder, Location loc, const PPRConfig &config, Value qbitIn)
+{
+    if (config.isIdentity) {
+        return qbitIn;
+    }
 
-    // Helper to push X, Y, Z series
-    auto pushSeries = [&](ArrayRef<StringRef> pauli) {
-        caseConfigs.push_back({false, pauli, 2, false});
-        caseConfigs.push_back({false, pauli, 4, false});
-        caseConfigs.push_back({false, pauli, 8, false});
-        caseConfigs.push_back({false, pauli, 2, true});
-        caseConfigs.push_back({false, pauli, 4, true});
-        caseConfigs.push_back({false, pauli, 8, true});
-    };
+    // negate if adjoint
+    int8_t rotationKind = config.isAdjoint ? -config.n : config.n;
+    auto pprOp = catalyst::pbc::PPRotationOp::create(builder, loc, config.pauli, rotationKind,
+                                                     ValueRange{qbitIn});
+    return pprOp->getResult(0);
+}
 
-    pushSeries(xPauli);
-    pushSeries(yPauli);
-    pushSeries(zPauli);
+/**
+ * @brief Populates the scf.index_switch op for the PPR-Basis.
+ */
+void populatePPRBasisSwitchCases(PatternRewriter &rewriter, Location loc,
+                                 scf::IndexSwitchOp switchOp, Value qbitIn)
+{
+    ArrayRef<PPRConfig> caseConfigs = getPPRConfigs();
 
     for (size_t i = 0; i < caseConfigs.size(); i++) {
-        const auto &config = caseConfigs[i];
         Region &caseRegion = switchOp.getCaseRegions()[i];
         caseRegion.push_back(new Block());
         rewriter.setInsertionPointToStart(&caseRegion.front());
 
-        Value qbitOut = config.isIdentity ? qbitIn
-                                          : createPPROp(rewriter, config.pauli, config.n,
-                                                        config.isAdjoint, qbitIn);
-
+        Value qbitOut = createPPRGate(rewriter, loc, caseConfigs[i], qbitIn);
         scf::YieldOp::create(rewriter, loc, qbitOut);
     }
 
@@ -358,6 +391,61 @@ func::FuncOp getOrCreateDecompositionFunc(ModuleOp module, PatternRewriter &rewr
     return func;
 }
 
+// --- Precomputed decompositions of constant angles ---
+
+/**
+ * @brief Returns the value of a constant angle, or std::nullopt if it is only known at runtime.
+ */
+std::optional<double> getConstantAngle(Value angle)
+{
+    FloatAttr angleAttr;
+    if (!matchPattern(angle, m_Constant(&angleAttr))) {
+        return std::nullopt;
+    }
+    return angleAttr.getValueAsDouble();
+}
+
+/**
+ * @brief Looks up the precomputed decomposition of a constant angle in the gridsynth table.
+ *
+ * @param angle The angle of the decomposed op.
+ * @param doubled Whether the angle is doubled before the decomposition, as for the PPR ops.
+ * @return The decomposition, or std::nullopt if the angle is not a constant of the table.
+ */
+std::optional<RSDecomp::GridsynthTable::Decomposition>
+lookupPrecomputed(Value angle, bool doubled, double epsilon, bool pprBasis)
+{
+    std::optional<double> constAngle = getConstantAngle(angle);
+    if (!constAngle.has_value()) {
+        return std::nullopt;
+    }
+    // Double the angle the same way as the runtime call would, so that the table keys match
+    double rzAngle = doubled ? *constAngle * 2.0 : *constAngle;
+    return RSDecomp::GridsynthTable::lookup(rzAngle, epsilon, pprBasis);
+}
+
+/**
+ * @brief Applies the gates of a precomputed decomposition to the qubit, as the cases of the
+ * decomposition loop would.
+ */
+Value applyPrecomputedGates(PatternRewriter &rewriter, Location loc, Value qbitIn,
+                            std::string_view gates, bool pprBasis)
+{
+    Value currentQbit = qbitIn;
+    for (char gate : gates) {
+        size_t gateCode = RSDecomp::GridsynthTable::decode_gate(gate, pprBasis);
+        if (pprBasis) {
+            currentQbit = createPPRGate(rewriter, loc, getPPRConfigs()[gateCode], currentQbit);
+        }
+        else {
+            const CliffordTConfig &config = getCliffordTConfigs()[gateCode];
+            currentQbit =
+                createGateChain(rewriter, loc, currentQbit, config.gates, config.isAdjoint);
+        }
+    }
+    return currentQbit;
+}
+
 // --- Rewrite Pattern for CustomOp (RZ/PhaseShift) ---
 
 struct DecomposeCustomOpPattern : public OpRewritePattern<CustomOp> {
@@ -390,6 +478,29 @@ struct DecomposeCustomOpPattern : public OpRewritePattern<CustomOp> {
         ModuleOp mod = op->getParentOfType<ModuleOp>();
         Location loc = op.getLoc();
 
+        // Constant angles of the precomputed table are decomposed at compile time
+        if (auto decomposition = lookupPrecomputed(angle, /*doubled=*/false, epsilon, pprBasis)) {
+            Value finalQbitResult =
+                applyPrecomputedGates(rewriter, loc, qbitOperand, decomposition->gates, pprBasis);
+
+            // PhaseShift(phi) = RZ(phi) * GlobalPhase(-phi/2)
+            double phase = decomposition->phase;
+            if (isPhaseShift) {
+                phase -= *getConstantAngle(angle) / 2.0;
+            }
+            Value finalPhase =
+                arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(phase));
+
+            NamedAttrList gphaseAttrs;
+            gphaseAttrs.append(rewriter.getNamedAttr("operandSegmentSizes",
+                                                     rewriter.getDenseI32ArrayAttr({1, 0, 0})));
+            GlobalPhaseOp::create(rewriter, loc, TypeRange{}, ValueRange{finalPhase},
+                                  gphaseAttrs.getAttrs());
+
+            rewriter.replaceOp(op, finalQbitResult);
+            return success();
+        }
+
         func::FuncOp decompFunc = getOrCreateDecompositionFunc(mod, rewriter, epsilon, pprBasis);
 
         // Call the function using the qubit directly
@@ -455,6 +566,23 @@ struct DecomposePPRArbitraryOpPattern
         ModuleOp mod = op->getParentOfType<ModuleOp>();
         Location loc = op.getLoc();
 
+        // Constant angles of the precomputed table are decomposed at compile time
+        if (auto decomposition = lookupPrecomputed(angle, /*doubled=*/true, epsilon, pprBasis)) {
+            Value finalQbitResult =
+                applyPrecomputedGates(rewriter, loc, qbitOperand, decomposition->gates, pprBasis);
+            Value phase = arith::ConstantOp::create(rewriter, loc,
+                                                    rewriter.getF64FloatAttr(decomposition->phase));
+
+            NamedAttrList gphaseAttrs;
+            gphaseAttrs.append(rewriter.getNamedAttr("operandSegmentSizes",
+                                                     rewriter.getDenseI32ArrayAttr({1, 0, 0})));
+            GlobalPhaseOp::create(rewriter, loc, TypeRange{}, ValueRange{phase},
+                                  gphaseAttrs.getAttrs());
+
+            rewriter.replaceOp(op, finalQbitResult);
+            return success();
+        }
+
         // PPR(theta, Z) = exp(-i * theta * Z)
         // RZ(phi)       = exp(-i * phi/2 * Z)
         // phi = 2 * theta
@@ -480,11 +608,135 @@ struct DecomposePPRArbitraryOpPattern
     }
 };
 
+// --- Batched solving of the rotation angles ---
+
+/**
+ * @brief Returns the angle that the rewrite patterns above pass to the runtime for the given op,
+ * and whether it is doubled first, or std::nullopt if the op is not decomposed.
+ */
+std::optional<std::pair<Value, bool>> getDecomposedAngle(Operation *op)
+{
+    if (auto customOp = dyn_cast<CustomOp>(op)) {
+        StringRef gateName = customOp.getGateName();
+        if (gateName != "RZ" && gateName != "PhaseShift") {
+            return std::nullopt;
+        }
+        return std::make_pair(customOp.getAllParams()[0], false);
+    }
+
+    if (auto pprOp = dyn_cast<catalyst::pbc::PPRotationArbitraryOp>(op)) {
+        Builder builder(op->getContext());
+        if (pprOp.getPauliProduct() != builder.getStrArrayAttr({"Z"}) || pprOp.getCondition()) {
+            return std::nullopt;
+        }
+        return std::make_pair(pprOp.getArbitraryAngle(), true);
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief The distinct angles of the decomposed ops of a block, which are available before the
+ * first decomposed op (head). The PPR angles are doubled first.
+ */
+struct AngleBatch {
+    Operation *head;
+    SmallVector<Value> angles;
+    SmallVector<Value> doubledAngles;
+};
+
+/**
+ * @brief Emits a call to `rs_decomposition_solve_batch` with the angles of the batch before its
+ * head op.
+ */
+void emitSolveBatch(IRRewriter &rewriter, const AngleBatch &batch, double epsilon, bool pprBasis)
+{
+    ModuleOp mod = batch.head->getParentOfType<ModuleOp>();
+    Location loc = batch.head->getLoc();
+    auto f64Type = rewriter.getF64Type();
+    auto anglesMemRefType = MemRefType::get({ShapedType::kDynamic}, f64Type);
+
+    // Ensure or declare Solve Batch: (memref, f64, i1) -> void
+    StringRef funcName = "rs_decomposition_solve_batch";
+    auto solveBatchFunc = mod.lookupSymbol<func::FuncOp>(funcName);
+    if (!solveBatchFunc) {
+        OpBuilder::InsertionGuard guard(rewriter);
+        rewriter.setInsertionPointToStart(mod.getBody());
+        auto solveBatchType =
+            rewriter.getFunctionType({anglesMemRefType, f64Type, rewriter.getI1Type()}, {});
+        solveBatchFunc = func::FuncOp::create(rewriter, loc, funcName, solveBatchType);
+        solveBatchFunc.setPrivate();
+    }
+
+    rewriter.setInsertionPoint(batch.head);
+
+    SmallVector<Value> values(batch.angles);
+    if (!batch.doubledAngles.empty()) {
+        // Double the angles the same way as the PPR pattern, so that they match at runtime
+        Value c2 = arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(2.0));
+        for (Value angle : batch.doubledAngles) {
+            values.push_back(arith::MulFOp::create(rewriter, loc, angle, c2));
+        }
+    }
+    // Use memref.alloc (Heap) instead of alloca (Stack), since the block may be a loop body
+    Value numAngles = arith::ConstantIndexOp::create(rewriter, loc, values.size());
+    Value anglesMemref = memref::AllocOp::create(rewriter, loc, anglesMemRefType, numAngles);
+    for (auto [idx, value] : llvm::enumerate(values)) {
+        Value idxVal = arith::ConstantIndexOp::create(rewriter, loc, idx);
+        memref::StoreOp::create(rewriter, loc, value, anglesMemref, ValueRange{idxVal});
+    }
+
+    Value epsilonVal = arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(epsilon));
+    Value pprBasisVal = arith::ConstantOp::create(rewriter, loc, rewriter.getBoolAttr(pprBasis));
+    func::CallOp::create(rewriter, loc, solveBatchFunc,
+                         ValueRange{anglesMemref, epsilonVal, pprBasisVal});
+
+    memref::DeallocOp::create(rewriter, loc, anglesMemref);
+}
+
 } // anonymous namespace
 
 namespace catalyst {
 namespace quantum {
 
+void batchGridsynthAngles(Operation *root, double epsilon, bool pprBasis)
+{
+    DominanceInfo domInfo(root);
+
+    // In each block, batch the distinct angles of the decomposed ops that are already available
+    // before the first one
+    SmallVector<AngleBatch> batches;
+    root->walk([&](Block *block) {
+        Operation *head = nullptr;
+        llvm::SetVector<Value> angles;
+        llvm::SetVector<Value> doubledAngles;
+        for (Operation &op : *block) {
+            auto angle = getDecomposedAngle(&op);
+            if (!angle.has_value()) {
+                continue;
+            }
+            // Constant angles of the precomputed table are not solved at runtime
+            if (lookupPrecomputed(angle->first, angle->second, epsilon, pprBasis).has_value()) {
+                continue;
+            }
+            if (head == nullptr) {
+                head = &op;
+            }
+            if (domInfo.properlyDominates(angle->first, head)) {
+                (angle->second ? doubledAngles : angles).insert(angle->first);
+            }
+        }
+        if (angles.size() + doubledAngles.size() > 1) {
+            batches.push_back({head, angles.takeVector(), doubledAngles.takeVector()});
+        }
+    });
+
+    IRRewriter rewriter(root->getContext());
+    for (const AngleBatch &batch : batches) {
+        emitSolveBatch(rewriter, batch, epsilon, pprBasis);
+    }
+}
+
 void populateGridsynthPatterns(RewritePatternSet &patterns, double epsilon, bool pprBasis)
 {
     patterns.add<DecomposeCustomOpPattern>(patterns.getContext(), epsilon, pprBasis);
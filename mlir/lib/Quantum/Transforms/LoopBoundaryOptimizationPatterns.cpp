@@ -16,10 +16,13 @@
 
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/IR/IRMapping.h"
 #include "mlir/IR/Operation.h"
 #include "mlir/IR/PatternMatch.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
 #include "mlir/Support/LogicalResult.h"
 
 #include "Quantum/IR/QuantumOps.h"
@@ -629,6 +632,238 @@ struct LoopBoundaryForLoopRewritePattern : public OpRewritePattern<scf::ForOp> {
     }
 };
 
+//===----------------------------------------------------------------------===//
+//                   Loop Rotation Folding Patterns
+//===----------------------------------------------------------------------===//
+
+// Rotations whose composition is the rotation by the sum of their angles.
+static const StringSet<> additiveRotationsSet = {"RX", "RY", "RZ", "PhaseShift"};
+
+// How a rotation angle computed in a loop body depends on the induction variable.
+enum class AngleKind {
+    Invariant,
+    Affine,
+    NonAffine,
+};
+
+// Returns true if the value is defined outside the loop, or computed in the loop body by pure
+// operations from loop invariant values.
+bool isLoopInvariantValue(Value value, scf::ForOp forOp)
+{
+    if (!forOp.getBodyRegion().isAncestor(value.getParentRegion())) {
+        return true;
+    }
+    Operation *definingOp = value.getDefiningOp();
+    if (!definingOp || definingOp->getNumRegions() != 0 || !isPure(definingOp)) {
+        return false;
+    }
+    return llvm::all_of(definingOp->getOperands(),
+                        [&](Value operand) { return isLoopInvariantValue(operand, forOp); });
+}
+
+// Returns true if the value is the induction variable converted to a floating point number.
+bool isInductionVarToFloat(Value value, scf::ForOp forOp)
+{
+    auto castOp = value.getDefiningOp();
+    if (!isa_and_nonnull<arith::SIToFPOp, arith::UIToFPOp>(castOp)) {
+        return false;
+    }
+    Value integer = castOp->getOperand(0);
+    if (isa_and_nonnull<arith::IndexCastOp, arith::IndexCastUIOp>(integer.getDefiningOp())) {
+        integer = integer.getDefiningOp()->getOperand(0);
+    }
+    return integer == forOp.getInductionVar();
+}
+
+AngleKind classifyAngle(Value angle, scf::ForOp forOp)
+{
+    if (isLoopInvariantValue(angle, forOp)) {
+        return AngleKind::Invariant;
+    }
+    if (isInductionVarToFloat(angle, forOp)) {
+        return AngleKind::Affine;
+    }
+
+    Operation *definingOp = angle.getDefiningOp();
+    if (isa_and_nonnull<arith::AddFOp, arith::SubFOp>(definingOp)) {
+        AngleKind lhs = classifyAngle(definingOp->getOperand(0), forOp);
+        AngleKind rhs = classifyAngle(definingOp->getOperand(1), forOp);
+        return lhs == AngleKind::NonAffine || rhs == AngleKind::NonAffine ? AngleKind::NonAffine
+                                                                          : AngleKind::Affine;
+    }
+    if (isa_and_nonnull<arith::NegFOp>(definingOp)) {
+        return classifyAngle(definingOp->getOperand(0), forOp);
+    }
+    if (isa_and_nonnull<arith::MulFOp>(definingOp)) {
+        // A product is affine when at most one of its factors depends on the induction variable
+        AngleKind lhs = classifyAngle(definingOp->getOperand(0), forOp);
+        AngleKind rhs = classifyAngle(definingOp->getOperand(1), forOp);
+        return lhs == AngleKind::Invariant || rhs == AngleKind::Invariant
+                   ? std::max(lhs, rhs)
+                   : AngleKind::NonAffine;
+    }
+    if (isa_and_nonnull<arith::DivFOp>(definingOp)) {
+        AngleKind rhs = classifyAngle(definingOp->getOperand(1), forOp);
+        return rhs == AngleKind::Invariant ? classifyAngle(definingOp->getOperand(0), forOp)
+                                           : AngleKind::NonAffine;
+    }
+    return AngleKind::NonAffine;
+}
+
+// Collects the rotations that are the only operations on a qubit carried by the loop, i.e. the
+// qubit goes from the region iter arg through these rotations straight to the yield.
+// The rotations must all be the same additive rotation, with angles affine in the induction
+// variable.
+std::optional<SmallVector<CustomOp>> getRotationChain(scf::ForOp forOp, unsigned idx)
+{
+    Value current = forOp.getRegionIterArgs()[idx];
+    if (!isa<quantum::QubitType>(current.getType())) {
+        return std::nullopt;
+    }
+
+    Operation *yieldOp = forOp.getBody()->getTerminator();
+    SmallVector<CustomOp> chain;
+    while (true) {
+        if (!current.hasOneUse()) {
+            return std::nullopt;
+        }
+        OpOperand &use = *current.getUses().begin();
+        if (use.getOwner() == yieldOp) {
+            if (use.getOperandNumber() != idx) {
+                return std::nullopt;
+            }
+            break;
+        }
+
+        auto op = dyn_cast<CustomOp>(use.getOwner());
+        if (!op || op.getAdjoint() || !op.getInCtrlQubits().empty() ||
+            op.getInQubits().size() != 1 || op.getParams().size() != 1 ||
+            !additiveRotationsSet.contains(op.getGateName()) ||
+            (!chain.empty() && chain.front().getGateName() != op.getGateName()) ||
+            classifyAngle(op.getParams()[0], forOp) == AngleKind::NonAffine) {
+            return std::nullopt;
+        }
+        chain.push_back(op);
+        current = op.getOutQubits()[0];
+    }
+
+    if (chain.empty()) {
+        return std::nullopt;
+    }
+    return chain;
+}
+
+// Clones the computation of an angle after the loop, with the induction variable (converted to a
+// floating point number) replaced by `inductionValue`.
+Value cloneAngle(Value angle, scf::ForOp forOp, Value inductionValue, IRMapping &mapping,
+                 PatternRewriter &rewriter)
+{
+    if (!forOp.getBodyRegion().isAncestor(angle.getParentRegion())) {
+        return angle;
+    }
+    if (Value mapped = mapping.lookupOrNull(angle)) {
+        return mapped;
+    }
+    if (isInductionVarToFloat(angle, forOp)) {
+        return inductionValue;
+    }
+
+    Operation *definingOp = angle.getDefiningOp();
+    for (Value operand : definingOp->getOperands()) {
+        mapping.map(operand, cloneAngle(operand, forOp, inductionValue, mapping, rewriter));
+    }
+    Operation *clone = rewriter.clone(*definingOp, mapping);
+    return clone->getResult(cast<OpResult>(angle).getResultNumber());
+}
+
+// Converts an index or integer loop bound to f64.
+Value castBoundToF64(Value bound, PatternRewriter &rewriter)
+{
+    Location loc = bound.getLoc();
+    if (bound.getType().isIndex()) {
+        bound = arith::IndexCastOp::create(rewriter, loc, rewriter.getI64Type(), bound);
+    }
+    return arith::SIToFPOp::create(rewriter, loc, rewriter.getF64Type(), bound);
+}
+
+// Folds the rotations applied by every iteration of a loop to a qubit into a single rotation after
+// the loop. Rotations about the same axis compose additively, so when the angle is affine in the
+// induction variable, the total angle over N iterations is N times the angle at the mean value of
+// the induction variable, lb + step * (N - 1) / 2:
+//
+//     scf.for %i = %lb to %ub step %step iter_args(%q0 = %q) {
+//         %theta = ... affine in %i ...
+//         %q1 = quantum.custom "RZ"(%theta) %q0
+//         scf.yield %q1
+//     }
+//
+// becomes a loop that leaves the qubit untouched, followed by quantum.custom "RZ"(%total).
+struct LoopRotationFoldingPattern : public OpRewritePattern<scf::ForOp> {
+    using OpRewritePattern<scf::ForOp>::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(scf::ForOp forOp, PatternRewriter &rewriter) const override
+    {
+        SmallVector<std::pair<unsigned, SmallVector<CustomOp>>> chains;
+        for (unsigned idx = 0; idx < forOp.getNumRegionIterArgs(); idx++) {
+            if (auto chain = getRotationChain(forOp, idx)) {
+                chains.emplace_back(idx, std::move(*chain));
+            }
+        }
+        if (chains.empty()) {
+            return failure();
+        }
+
+        LLVM_DEBUG(llvm::dbgs() << "Folding the rotations of the following loop:\n"
+                                << forOp << "\n");
+
+        // Number of iterations and mean value of the induction variable, as f64
+        Location loc = forOp.getLoc();
+        rewriter.setInsertionPointAfter(forOp);
+        Value lowerBound = forOp.getLowerBound();
+        Value step = forOp.getStep();
+        Value zero = arith::ConstantOp::create(rewriter, loc, rewriter.getZeroAttr(step.getType()));
+        Value range = arith::SubIOp::create(rewriter, loc, forOp.getUpperBound(), lowerBound);
+        Value numIterations = arith::MaxSIOp::create(
+            rewriter, loc, arith::CeilDivSIOp::create(rewriter, loc, range, step), zero);
+
+        Value numIterationsF64 = castBoundToF64(numIterations, rewriter);
+        Value one = arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(1.0));
+        Value half = arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(0.5));
+        Value meanOffset = arith::MulFOp::create(
+            rewriter, loc,
+            arith::MulFOp::create(rewriter, loc, castBoundToF64(step, rewriter),
+                                  arith::SubFOp::create(rewriter, loc, numIterationsF64, one)),
+            half);
+        Value meanInductionValue = arith::AddFOp::create(
+            rewriter, loc, castBoundToF64(lowerBound, rewriter), meanOffset);
+
+        for (auto &[idx, chain] : chains) {
+            IRMapping mapping;
+            Value totalAngle;
+            for (CustomOp op : chain) {
+                Value angle =
+                    cloneAngle(op.getParams()[0], forOp, meanInductionValue, mapping, rewriter);
+                totalAngle =
+                    totalAngle ? arith::AddFOp::create(rewriter, loc, totalAngle, angle) : angle;
+            }
+            totalAngle = arith::MulFOp::create(rewriter, loc, numIterationsF64, totalAngle);
+
+            Value result = forOp.getResult(idx);
+            auto foldedOp = CustomOp::create(rewriter, loc, chain.front().getGateName(),
+                                             ValueRange{result}, ValueRange{}, ValueRange{},
+                                             ValueRange{totalAngle});
+            rewriter.replaceAllUsesExcept(result, foldedOp.getOutQubits()[0], foldedOp);
+
+            for (CustomOp op : chain) {
+                rewriter.replaceAllUsesWith(op.getOutQubits()[0], op.getInQubits()[0]);
+                rewriter.eraseOp(op);
+            }
+        }
+
+        return success();
+    }
+};
+
 } // namespace
 
 namespace catalyst {
@@ -645,5 +880,10 @@ void populateLoopBoundaryPatterns(RewritePatternSet &patterns, unsigned int mode
     patterns.add<LoopBoundaryForLoopRewritePattern>(patterns.getContext(), loopBoundaryMode, 1);
 }
 
+void populateLoopRotationFoldingPatterns(RewritePatternSet &patterns)
+{
+    patterns.add<LoopRotationFoldingPattern>(patterns.getContext(), 1);
+}
+
 } // namespace quantum
 } // namespace catalyst
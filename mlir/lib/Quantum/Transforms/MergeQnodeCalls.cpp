@@ -0,0 +1,91 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "merge-qnode-calls"
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/Dominance.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Quantum/Transforms/Passes.h"
+#include "Quantum/Utils/QnodeCalls.h"
+
+using namespace mlir;
+using namespace catalyst;
+using namespace catalyst::quantum;
+
+namespace {
+
+/// Whether two calls of the same qnode compute the same results.
+bool isSameCall(CallOpInterface lhs, CallOpInterface rhs)
+{
+    return lhs->getName() == rhs->getName() && lhs.getArgOperands() == rhs.getArgOperands() &&
+           lhs->getDiscardableAttrDictionary() == rhs->getDiscardableAttrDictionary();
+}
+
+/// Replace the calls of a deterministic qnode by an identical call that dominates them.
+bool mergeCalls(ArrayRef<CallOpInterface> calls, DominanceInfo &domInfo)
+{
+    bool changed = false;
+    SmallVector<CallOpInterface> keptCalls;
+    for (CallOpInterface callOp : calls) {
+        auto sameCall = llvm::find_if(keptCalls, [&](CallOpInterface keptCall) {
+            return isSameCall(keptCall, callOp) && domInfo.properlyDominates(keptCall, callOp);
+        });
+        if (sameCall == keptCalls.end()) {
+            keptCalls.push_back(callOp);
+            continue;
+        }
+        callOp->replaceAllUsesWith((*sameCall)->getResults());
+        callOp->erase();
+        changed = true;
+    }
+    return changed;
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_MERGEQNODECALLSPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct MergeQnodeCallsPass : impl::MergeQnodeCallsPassBase<MergeQnodeCallsPass> {
+    using MergeQnodeCallsPassBase::MergeQnodeCallsPassBase;
+
+    void runOnOperation() final
+    {
+        ModuleOp mod = getOperation();
+        DominanceInfo &domInfo = getAnalysis<DominanceInfo>();
+
+        bool changed = false;
+        for (func::FuncOp funcOp : getQnodes(mod)) {
+            std::optional<SmallVector<CallOpInterface>> calls = getQnodeCalls(funcOp, mod);
+            if (!calls || calls->size() < 2 || !isDeterministicQnode(funcOp)) {
+                continue;
+            }
+            changed |= mergeCalls(*calls, domInfo);
+        }
+        if (!changed) {
+            markAllAnalysesPreserved();
+        }
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,209 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "propagate-simple-states"
+
+#include <array>
+#include <optional>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/MathExtras.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Catalyst/IR/CatalystDialect.h"
+#include "Quantum/IR/QuantumOps.h"
+
+#include "PropagateSimpleStatesAnalysis.hpp"
+
+using namespace mlir;
+using namespace catalyst;
+
+namespace {
+
+/// The phase that a gate multiplies one of its eigenstates by, `constant + coefficient * param`
+/// for the parameter `param` of the gate.
+struct EigenPhase {
+    double constant;
+    double coefficient;
+};
+
+// The gates, of any parameters, of which the Pauli eigenstates are eigenstates too, with their
+// phases on the first and the second eigenstate of a basis, e.g. |0> and |1>
+using EigenPhases = std::array<EigenPhase, 2>;
+static const llvm::StringMap<EigenPhases> zEigenGates = {
+    {"Identity", {{{0, 0}, {0, 0}}}},
+    {"PauliZ", {{{0, 0}, {llvm::numbers::pi, 0}}}},
+    {"S", {{{0, 0}, {llvm::numbers::pi / 2, 0}}}},
+    {"T", {{{0, 0}, {llvm::numbers::pi / 4, 0}}}},
+    {"RZ", {{{0, -0.5}, {0, 0.5}}}},
+    {"PhaseShift", {{{0, 0}, {0, 1}}}},
+};
+static const llvm::StringMap<EigenPhases> xEigenGates = {
+    {"Identity", {{{0, 0}, {0, 0}}}},
+    {"PauliX", {{{0, 0}, {llvm::numbers::pi, 0}}}},
+    {"SX", {{{0, 0}, {llvm::numbers::pi / 2, 0}}}},
+    {"RX", {{{0, -0.5}, {0, 0.5}}}},
+};
+static const llvm::StringMap<EigenPhases> yEigenGates = {
+    {"Identity", {{{0, 0}, {0, 0}}}},
+    {"PauliY", {{{0, 0}, {llvm::numbers::pi, 0}}}},
+    {"RY", {{{0, -0.5}, {0, 0.5}}}},
+};
+
+/// The phase that `gate` multiplies the state `qs` of its qubit by, if it only multiplies it by a
+/// phase. The qubit is not entangled, so that the phase is global.
+std::optional<EigenPhase> getEigenPhase(StringRef gate, QubitState qs)
+{
+    auto lookup = [&](const llvm::StringMap<EigenPhases> &gates,
+                      size_t idx) -> std::optional<EigenPhase> {
+        auto it = gates.find(gate);
+        if (it == gates.end()) {
+            return std::nullopt;
+        }
+        return it->second[idx];
+    };
+
+    switch (qs) {
+    case QubitState::ZERO:
+        return lookup(zEigenGates, 0);
+    case QubitState::ONE:
+        return lookup(zEigenGates, 1);
+    case QubitState::PLUS:
+        return lookup(xEigenGates, 0);
+    case QubitState::MINUS:
+        return lookup(xEigenGates, 1);
+    case QubitState::LEFT:
+        return lookup(yEigenGates, 0);
+    case QubitState::RIGHT:
+        return lookup(yEigenGates, 1);
+    case QubitState::NOT_A_BASIS:
+        return std::nullopt;
+    }
+    return std::nullopt;
+}
+
+/// Apply the phase that the gate `op`, about to be removed, multiplies its eigenstate by as a
+/// global phase before it.
+void applyEigenPhase(quantum::CustomOp op, EigenPhase phase, IRRewriter &builder)
+{
+    if (phase.constant == 0 && phase.coefficient == 0) {
+        return;
+    }
+
+    // quantum.gphase(phi) multiplies the state by exp(-i * phi), and the adjoint by exp(i * phi)
+    double sign = op.getAdjoint() ? 1.0 : -1.0;
+    Location loc = op.getLoc();
+    builder.setInsertionPoint(op);
+    Value angle;
+    if (phase.coefficient != 0) {
+        Value coefficient = arith::ConstantOp::create(
+            builder, loc, builder.getF64FloatAttr(sign * phase.coefficient));
+        angle = arith::MulFOp::create(builder, loc, op.getParams().front(), coefficient);
+    }
+    if (phase.constant != 0) {
+        Value constant =
+            arith::ConstantOp::create(builder, loc, builder.getF64FloatAttr(sign * phase.constant));
+        angle = angle ? arith::AddFOp::create(builder, loc, angle, constant).getResult() : constant;
+    }
+    quantum::GlobalPhaseOp::create(builder, loc, /*out_ctrl_qubits=*/TypeRange{}, angle,
+                                   /*adjoint=*/false, /*in_ctrl_qubits=*/ValueRange{},
+                                   /*in_ctrl_values=*/ValueRange{});
+}
+
+/// Remove the gates acting on known simple states that they only multiply by a phase, applied as a
+/// global phase instead, and fold the measurements of known computational basis states into
+/// constants.
+bool propagateSimpleStates(FunctionOpInterface &func)
+{
+    mlir::IRRewriter builder(func->getContext());
+
+    PropagateSimpleStatesAnalysis pssa(func);
+    llvm::DenseMap<Value, QubitState> qubitValues = pssa.getQubitValues();
+
+    bool changed = false;
+    func->walk([&](quantum::CustomOp op) {
+        // Controlled gates have several qubit results and act on entangled qubits
+        if (op->getNumResults() != 1 || op.getInQubits().size() != 1) {
+            return;
+        }
+        Value in = op.getInQubits()[0];
+        if (!qubitValues.contains(in)) {
+            return;
+        }
+        std::optional<EigenPhase> phase = getEigenPhase(op.getGateName(), qubitValues[in]);
+        if (!phase || (phase->coefficient != 0 && op.getParams().size() != 1)) {
+            return;
+        }
+        applyEigenPhase(op, *phase, builder);
+        builder.replaceAllUsesWith(op->getResult(0), in);
+        builder.eraseOp(op);
+        changed = true;
+    });
+
+    func->walk([&](quantum::MeasureOp op) {
+        Value in = op.getInQubit();
+        if (op.getPostselect() || !qubitValues.contains(in)) {
+            return;
+        }
+        QubitState qs = qubitValues[in];
+        if (!pssa.isZero(qs) && !pssa.isOne(qs)) {
+            return;
+        }
+        builder.setInsertionPoint(op);
+        Value mres = arith::ConstantOp::create(builder, op.getLoc(),
+                                               builder.getBoolAttr(pssa.isOne(qs)));
+        builder.replaceAllUsesWith(op.getMres(), mres);
+        builder.replaceAllUsesWith(op.getOutQubit(), in);
+        builder.eraseOp(op);
+        changed = true;
+    });
+
+    return changed;
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_PROPAGATESIMPLESTATESPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct PropagateSimpleStatesPass
+    : public impl::PropagateSimpleStatesPassBase<PropagateSimpleStatesPass> {
+    using impl::PropagateSimpleStatesPassBase<PropagateSimpleStatesPass>::
+        PropagateSimpleStatesPassBase;
+
+    void runOnOperation() override
+    {
+        auto op = getOperation();
+        for (Operation &nestedOp : op->getRegion(0).front().getOperations()) {
+            if (auto func = dyn_cast<FunctionOpInterface>(nestedOp)) {
+                // Removing a gate lets the analysis track the states after it, so that the
+                // propagation is repeated until no gate is removed anymore
+                bool changed = true;
+                while (changed) {
+                    changed = propagateSimpleStates(func);
+                }
+            }
+        }
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
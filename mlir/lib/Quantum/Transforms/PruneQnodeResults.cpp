@@ -0,0 +1,130 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "prune-qnode-results"
+
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/Iterators.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Quantum/IR/QuantumInterfaces.h"
+#include "Quantum/Transforms/Passes.h"
+#include "Quantum/Utils/QnodeCalls.h"
+
+using namespace mlir;
+using namespace catalyst;
+using namespace catalyst::quantum;
+
+namespace {
+
+/// Erase the measurements and pure operations of a function whose results are not used anymore.
+void eraseDeadMeasurements(func::FuncOp funcOp)
+{
+    funcOp.walk<WalkOrder::PostOrder, ReverseIterator>([](Operation *op) {
+        bool deadMeasurement = isa<quantum::MeasurementProcess>(op) &&
+                               op->getNumResults() > 0 && op->use_empty();
+        if (deadMeasurement || isOpTriviallyDead(op)) {
+            op->erase();
+        }
+    });
+}
+
+/// Remove the results of a qnode that none of its calls use.
+bool pruneUnusedResults(func::FuncOp funcOp, ArrayRef<CallOpInterface> calls)
+{
+    BitVector unused(funcOp.getNumResults(), true);
+    for (CallOpInterface callOp : calls) {
+        for (OpResult result : callOp->getResults()) {
+            if (!result.use_empty()) {
+                unused.reset(result.getResultNumber());
+            }
+        }
+    }
+    if (unused.none()) {
+        return false;
+    }
+
+    if (failed(funcOp.eraseResults(unused))) {
+        return false;
+    }
+    funcOp.walk([&](func::ReturnOp returnOp) { returnOp->eraseOperands(unused); });
+    for (CallOpInterface callOp : calls) {
+        OpBuilder builder(callOp);
+        CallOpInterface newCallOp =
+            createQnodeCall(builder, callOp, funcOp, callOp.getArgOperands());
+        unsigned newIndex = 0;
+        for (OpResult result : callOp->getResults()) {
+            if (!unused.test(result.getResultNumber())) {
+                result.replaceAllUsesWith(newCallOp->getResult(newIndex++));
+            }
+        }
+        callOp->erase();
+    }
+    eraseDeadMeasurements(funcOp);
+    return true;
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_PRUNEQNODERESULTSPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct PruneQnodeResultsPass : impl::PruneQnodeResultsPassBase<PruneQnodeResultsPass> {
+    using PruneQnodeResultsPassBase::PruneQnodeResultsPassBase;
+
+    void runOnOperation() final
+    {
+        ModuleOp mod = getOperation();
+
+        // Pruning the results of a qnode may leave results of the qnodes it calls unused in turn
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (func::FuncOp funcOp : getQnodes(mod)) {
+                std::optional<SmallVector<CallOpInterface>> calls = getQnodeCalls(funcOp, mod);
+                if (!calls) {
+                    continue;
+                }
+                if (hasOnlyQuantumEffects(funcOp)) {
+                    // Calls whose results are all unused have no effect
+                    SmallVector<CallOpInterface> liveCalls;
+                    for (CallOpInterface callOp : *calls) {
+                        if (callOp->use_empty()) {
+                            callOp->erase();
+                            changed = true;
+                        }
+                        else {
+                            liveCalls.push_back(callOp);
+                        }
+                    }
+                    *calls = std::move(liveCalls);
+                }
+                if (!calls->empty() && pruneUnusedResults(funcOp, *calls)) {
+                    changed = true;
+                }
+            }
+        }
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,367 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "lower-sample-postprocessing"
+
+#include <cmath>
+#include <optional>
+#include <string>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "stablehlo/dialect/StablehloOps.h"
+
+#include "Catalyst/IR/CatalystDialect.h"
+#include "Catalyst/IR/CatalystOps.h"
+#include "Quantum/IR/QuantumOps.h"
+
+using namespace mlir;
+using namespace catalyst;
+using namespace catalyst::quantum;
+
+namespace {
+
+// The bitstring indices of the shots are computed in an index type of at least 32 bits
+constexpr double kMaxIndex = 2147483647.0;
+
+// Whether `value` is a constant whose elements are all equal to `expected`
+bool isSplatConstant(Value value, double expected)
+{
+    DenseElementsAttr attr;
+    if (!matchPattern(value, m_Constant(&attr)) || !attr.isSplat()) {
+        return false;
+    }
+    if (isa<FloatType>(attr.getElementType())) {
+        return attr.getSplatValue<APFloat>().convertToDouble() == expected;
+    }
+    if (isa<IntegerType>(attr.getElementType())) {
+        return static_cast<double>(attr.getSplatValue<APInt>().getSExtValue()) == expected;
+    }
+    return false;
+}
+
+// Whether `body` applies the binary operation `OpTy` to its two arguments, in any order
+template <typename OpTy> bool isBinaryBody(Region &body)
+{
+    if (!body.hasOneBlock()) {
+        return false;
+    }
+    Block &block = body.front();
+    if (block.getNumArguments() != 2 || !llvm::hasNItems(block.getOperations(), 2)) {
+        return false;
+    }
+    auto binaryOp = dyn_cast<OpTy>(&block.front());
+    auto returnOp = dyn_cast<stablehlo::ReturnOp>(&block.back());
+    if (!binaryOp || !returnOp || returnOp.getNumOperands() != 1 ||
+        returnOp.getOperand(0) != binaryOp.getResult()) {
+        return false;
+    }
+    Value lhs = binaryOp.getLhs();
+    Value rhs = binaryOp.getRhs();
+    Value arg0 = block.getArgument(0);
+    Value arg1 = block.getArgument(1);
+    return (lhs == arg0 && rhs == arg1) || (lhs == arg1 && rhs == arg0);
+}
+
+// Whether `op` reduces its single input over `dim` with the binary operation `OpTy` from `init`
+template <typename OpTy> bool isReduction(stablehlo::ReduceOp op, int64_t dim, double init)
+{
+    return op.getInputs().size() == 1 && llvm::equal(op.getDimensions(), ArrayRef<int64_t>{dim}) &&
+           isSplatConstant(op.getInitValues()[0], init) && isBinaryBody<OpTy>(op.getBody());
+}
+
+// The static computational basis samples, of shape (shots, columns), that `value` is, if any
+TypedValue<RankedTensorType> getBasisSamples(Value value)
+{
+    auto sampleOp = value.getDefiningOp<SampleOp>();
+    if (!sampleOp || !sampleOp.getObs().getDefiningOp<ComputationalBasisOp>()) {
+        return {};
+    }
+    auto type = dyn_cast<RankedTensorType>(value.getType());
+    if (!type || type.getRank() != 2 || !type.hasStaticShape() || type.getNumElements() == 0) {
+        return {};
+    }
+    return cast<TypedValue<RankedTensorType>>(value);
+}
+
+Value makeConst(PatternRewriter &rewriter, Location loc, int64_t val)
+{
+    auto type = RankedTensorType::get({}, rewriter.getI32Type());
+    auto attr = DenseElementsAttr::get(type, APInt(32, static_cast<uint64_t>(val)));
+    return arith::ConstantOp::create(rewriter, loc, attr);
+}
+
+/**
+ * @brief The parity eigenvalues, 1 or -1, of the columns [first, last) of computational basis
+ * samples at each shot.
+ */
+struct ParityMatch {
+    TypedValue<RankedTensorType> samples;
+    int64_t first;
+    int64_t last;
+};
+
+// Match the product over the columns of the eigenvalues `1 - 2 * samples` of a slice of columns
+std::optional<ParityMatch> matchParity(stablehlo::ReduceOp op)
+{
+    if (!isReduction<stablehlo::MulOp>(op, /*dim=*/1, /*init=*/1.0)) {
+        return std::nullopt;
+    }
+    auto subOp = op.getInputs()[0].getDefiningOp<stablehlo::SubtractOp>();
+    if (!subOp || !isSplatConstant(subOp.getLhs(), 1.0)) {
+        return std::nullopt;
+    }
+    auto mulOp = subOp.getRhs().getDefiningOp<stablehlo::MulOp>();
+    if (!mulOp) {
+        return std::nullopt;
+    }
+    Value bits = mulOp.getLhs();
+    if (!isSplatConstant(mulOp.getRhs(), 2.0)) {
+        if (!isSplatConstant(bits, 2.0)) {
+            return std::nullopt;
+        }
+        bits = mulOp.getRhs();
+    }
+
+    if (auto samples = getBasisSamples(bits)) {
+        return ParityMatch{samples, 0, samples.getType().getDimSize(1)};
+    }
+    auto sliceOp = bits.getDefiningOp<stablehlo::SliceOp>();
+    if (!sliceOp) {
+        return std::nullopt;
+    }
+    auto samples = getBasisSamples(sliceOp.getOperand());
+    ArrayRef<int64_t> start = sliceOp.getStartIndices();
+    ArrayRef<int64_t> limit = sliceOp.getLimitIndices();
+    if (!samples || start[0] != 0 || limit[0] != samples.getType().getDimSize(0) ||
+        !llvm::all_of(sliceOp.getStrides(), [](int64_t stride) { return stride == 1; })) {
+        return std::nullopt;
+    }
+    return ParityMatch{samples, start[1], limit[1]};
+}
+
+// Whether `op` sums the parities of the shots of a parity reduction
+bool isParitySum(Operation *op)
+{
+    auto reduceOp = dyn_cast<stablehlo::ReduceOp>(op);
+    return reduceOp && isReduction<stablehlo::AddOp>(reduceOp, /*dim=*/0, /*init=*/0.0);
+}
+
+catalyst::CustomCallOp createParityCall(PatternRewriter &rewriter, Location loc, Type resultType,
+                                        const ParityMatch &parity, StringRef kernelName)
+{
+    RankedTensorType samplesType = parity.samples.getType();
+    SmallVector<Value> operands = {makeConst(rewriter, loc, samplesType.getDimSize(0)),
+                                   makeConst(rewriter, loc, samplesType.getDimSize(1)),
+                                   makeConst(rewriter, loc, parity.first),
+                                   makeConst(rewriter, loc, parity.last), parity.samples};
+    return catalyst::CustomCallOp::create(rewriter, loc, TypeRange{resultType}, operands,
+                                          rewriter.getStringAttr(kernelName),
+                                          /*number_original_arg=*/nullptr);
+}
+
+/**
+ * @brief Lower the parities of the shots of computational basis samples to the parity kernel.
+ */
+struct ParityPattern : public OpRewritePattern<stablehlo::ReduceOp> {
+    using OpRewritePattern::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(stablehlo::ReduceOp op, PatternRewriter &rewriter) const override
+    {
+        std::optional<ParityMatch> parity = matchParity(op);
+        // The sums of the parities are lowered to the parity sum kernel instead
+        if (!parity || (op->hasOneUse() && isParitySum(*op->user_begin()))) {
+            return failure();
+        }
+        auto callOp = createParityCall(rewriter, op.getLoc(), op.getResult(0).getType(), *parity,
+                                       "catalyst_sample_parity_f64");
+        rewriter.replaceOp(op, callOp.getResults());
+        return success();
+    }
+};
+
+/**
+ * @brief Lower the sum over the shots of the parities of computational basis samples, e.g. of
+ * the expectation value of a Pauli word, to the parity sum kernel.
+ */
+struct ParitySumPattern : public OpRewritePattern<stablehlo::ReduceOp> {
+    using OpRewritePattern::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(stablehlo::ReduceOp op, PatternRewriter &rewriter) const override
+    {
+        if (!isParitySum(op)) {
+            return failure();
+        }
+        auto parityOp = op.getInputs()[0].getDefiningOp<stablehlo::ReduceOp>();
+        if (!parityOp) {
+            return failure();
+        }
+        std::optional<ParityMatch> parity = matchParity(parityOp);
+        if (!parity) {
+            return failure();
+        }
+        auto callOp = createParityCall(rewriter, op.getLoc(), op.getResult(0).getType(), *parity,
+                                       "catalyst_sample_parity_sum_f64");
+        rewriter.replaceOp(op, callOp.getResults());
+        return success();
+    }
+};
+
+// The name of the counts kernel for counts of the given element type
+std::optional<std::string> getCountsKernelName(Type type)
+{
+    if (type.isF32()) {
+        return "catalyst_sample_counts_f32";
+    }
+    if (type.isF64()) {
+        return "catalyst_sample_counts_f64";
+    }
+    if (type.isSignlessInteger(32)) {
+        return "catalyst_sample_counts_i32";
+    }
+    if (type.isSignlessInteger(64)) {
+        return "catalyst_sample_counts_i64";
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Lower the bitstring histograms and marginal counts of computational basis samples to
+ * the counts kernel.
+ *
+ * The histogram adds one to a zero tensor at the bitstring index of each shot, which is the dot
+ * product of the samples of the shot with constant non-negative integer weights of the columns.
+ */
+struct CountsPattern : public OpRewritePattern<stablehlo::ScatterOp> {
+    using OpRewritePattern::OpRewritePattern;
+
+    LogicalResult matchAndRewrite(stablehlo::ScatterOp op, PatternRewriter &rewriter) const override
+    {
+        if (op.getInputs().size() != 1 || op.getUpdates().size() != 1) {
+            return failure();
+        }
+        auto countsType = dyn_cast<RankedTensorType>(op.getResult(0).getType());
+        if (!countsType || countsType.getRank() != 1 || !countsType.hasStaticShape()) {
+            return failure();
+        }
+        std::optional<std::string> kernelName = getCountsKernelName(countsType.getElementType());
+        auto dims = op.getScatterDimensionNumbers();
+        if (!kernelName || !isSplatConstant(op.getInputs()[0], 0.0) ||
+            !isSplatConstant(op.getUpdates()[0], 1.0) ||
+            !isBinaryBody<stablehlo::AddOp>(op.getUpdateComputation()) ||
+            !dims.getUpdateWindowDims().empty() || !dims.getInputBatchingDims().empty() ||
+            !llvm::equal(dims.getInsertedWindowDims(), ArrayRef<int64_t>{0}) ||
+            !llvm::equal(dims.getScatterDimsToOperandDims(), ArrayRef<int64_t>{0}) ||
+            dims.getIndexVectorDim() != 1) {
+            return failure();
+        }
+
+        // The indices of shape (shots, 1) are the converted dot products of shape (shots)
+        Value indices = op.getScatterIndices();
+        auto indicesType = cast<RankedTensorType>(indices.getType());
+        if (indicesType.getRank() != 2 || indicesType.getDimSize(1) != 1 ||
+            indicesType.getElementTypeBitWidth() < 32) {
+            return failure();
+        }
+        if (auto reshapeOp = indices.getDefiningOp<stablehlo::ReshapeOp>()) {
+            indices = reshapeOp.getOperand();
+        }
+        else if (auto broadcastOp = indices.getDefiningOp<stablehlo::BroadcastInDimOp>();
+                 broadcastOp &&
+                 llvm::equal(broadcastOp.getBroadcastDimensions(), ArrayRef<int64_t>{0})) {
+            indices = broadcastOp.getOperand();
+        }
+        else {
+            return failure();
+        }
+        auto convertOp = indices.getDefiningOp<stablehlo::ConvertOp>();
+        auto dotOp = convertOp ? convertOp.getOperand().getDefiningOp<stablehlo::DotGeneralOp>()
+                               : nullptr;
+        if (!dotOp) {
+            return failure();
+        }
+        auto dotDims = dotOp.getDotDimensionNumbers();
+        auto samples = getBasisSamples(dotOp.getLhs());
+        DenseFPElementsAttr weightsAttr;
+        if (!samples || !dotDims.getLhsBatchingDimensions().empty() ||
+            !dotDims.getRhsBatchingDimensions().empty() ||
+            !llvm::equal(dotDims.getLhsContractingDimensions(), ArrayRef<int64_t>{1}) ||
+            !llvm::equal(dotDims.getRhsContractingDimensions(), ArrayRef<int64_t>{0}) ||
+            !matchPattern(dotOp.getRhs(), m_Constant(&weightsAttr))) {
+            return failure();
+        }
+
+        // The indices are exact when the weights are integers that sum up to a valid index
+        SmallVector<int64_t> weights;
+        double total = 0;
+        for (const APFloat &weight : weightsAttr.getValues<APFloat>()) {
+            double value = weight.convertToDouble();
+            if (value < 0 || value != std::trunc(value)) {
+                return failure();
+            }
+            total += value;
+            weights.push_back(static_cast<int64_t>(value));
+        }
+        if (total > kMaxIndex) {
+            return failure();
+        }
+
+        Location loc = op.getLoc();
+        RankedTensorType samplesType = samples.getType();
+        auto weightsType = RankedTensorType::get({static_cast<int64_t>(weights.size())},
+                                                 rewriter.getI64Type());
+        Value weightsConst = arith::ConstantOp::create(
+            rewriter, loc, DenseElementsAttr::get(weightsType, ArrayRef(weights)));
+        SmallVector<Value> operands = {makeConst(rewriter, loc, samplesType.getDimSize(0)),
+                                       makeConst(rewriter, loc, samplesType.getDimSize(1)),
+                                       makeConst(rewriter, loc, countsType.getDimSize(0)),
+                                       weightsConst, samples};
+        auto callOp = catalyst::CustomCallOp::create(rewriter, loc, TypeRange{countsType},
+                                                     operands, rewriter.getStringAttr(*kernelName),
+                                                     /*number_original_arg=*/nullptr);
+        rewriter.replaceOp(op, callOp.getResults());
+        return success();
+    }
+};
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_LOWERSAMPLEPOSTPROCESSINGPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct LowerSamplePostprocessingPass
+    : impl::LowerSamplePostprocessingPassBase<LowerSamplePostprocessingPass> {
+    using LowerSamplePostprocessingPassBase::LowerSamplePostprocessingPassBase;
+
+    void runOnOperation() final
+    {
+        RewritePatternSet patterns(&getContext());
+        patterns.add<CountsPattern, ParityPattern, ParitySumPattern>(&getContext());
+        if (failed(applyPatternsGreedily(getOperation(), std::move(patterns)))) {
+            return signalPassFailure();
+        }
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,105 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "single-sweep"
+
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Rewrite/PatternApplicator.h"
+
+#include "Quantum/Transforms/Patterns.h"
+
+using namespace llvm;
+using namespace mlir;
+
+namespace {
+
+/// Keeps track of the ops erased by the rewrites, so that the sweep never visits them.
+struct ErasedOpsListener : public RewriterBase::Listener {
+    DenseSet<Operation *> erased;
+
+    void notifyOperationInserted(Operation *op, OpBuilder::InsertPoint previous) override
+    {
+        // The memory of an erased op may be reused for a new one
+        erased.erase(op);
+    }
+
+    void notifyOperationErased(Operation *op) override { erased.insert(op); }
+};
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+void applyPatternsInSingleSweep(Operation *root, const FrozenRewritePatternSet &patterns)
+{
+    PatternApplicator applicator(patterns);
+    applicator.applyDefaultCostModel();
+
+    ErasedOpsListener listener;
+    PatternRewriter rewriter(root->getContext());
+    rewriter.setListener(&listener);
+
+    // The ops are visited in program order, so the users of a gate are always visited after it.
+    // A rewrite of a gate with its parent then leaves the result for the next gate of the wire to
+    // match against, and each chain of gates is reduced as the sweep walks down the wire.
+    SmallVector<Operation *> ops;
+    root->walk<WalkOrder::PreOrder>([&](Operation *op) {
+        if (op != root) {
+            ops.push_back(op);
+        }
+    });
+
+    SmallVector<Operation *> operandOps;
+    size_t numRewrites = 0;
+    for (Operation *op : ops) {
+        if (listener.erased.contains(op)) {
+            continue;
+        }
+
+        operandOps.clear();
+        for (Value operand : op->getOperands()) {
+            if (Operation *definingOp = operand.getDefiningOp()) {
+                operandOps.push_back(definingOp);
+            }
+        }
+
+        rewriter.setInsertionPoint(op);
+        if (failed(applicator.matchAndRewrite(op, rewriter))) {
+            continue;
+        }
+        numRewrites++;
+
+        // The patterns may only replace the uses of the gates they cancel or merge, so erase
+        // them here instead of leaving them to a later dead code elimination
+        if (!listener.erased.contains(op) && isOpTriviallyDead(op)) {
+            rewriter.eraseOp(op);
+        }
+        for (Operation *definingOp : operandOps) {
+            if (!listener.erased.contains(definingOp) && isOpTriviallyDead(definingOp)) {
+                rewriter.eraseOp(definingOp);
+            }
+        }
+    }
+
+    LLVM_DEBUG(dbgs() << "single sweep: " << numRewrites << " rewrites over " << ops.size()
+                      << " ops\n");
+}
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,170 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "specialize-qnode-constants"
+
+#include <string>
+
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+
+#include "Quantum/Transforms/Passes.h"
+#include "Quantum/Utils/QnodeCalls.h"
+
+using namespace mlir;
+using namespace catalyst;
+using namespace catalyst::quantum;
+
+namespace {
+
+/// The calls of a qnode with the same constant arguments, and the constant operation of each
+/// argument, or nullptr for the arguments that are not constant.
+struct CallSignature {
+    SmallVector<Attribute> constants;
+    SmallVector<Operation *> constantOps;
+    SmallVector<CallOpInterface> calls;
+};
+
+/// Group the calls of a qnode by their constant arguments, in the order of their first call.
+SmallVector<CallSignature> groupCalls(ArrayRef<CallOpInterface> calls)
+{
+    SmallVector<CallSignature> signatures;
+    for (CallOpInterface callOp : calls) {
+        SmallVector<Attribute> constants;
+        SmallVector<Operation *> constantOps;
+        for (Value operand : callOp.getArgOperands()) {
+            Attribute constant;
+            Operation *constantOp = nullptr;
+            if (matchPattern(operand, m_Constant(&constant))) {
+                constantOp = operand.getDefiningOp();
+            }
+            constants.push_back(constant);
+            constantOps.push_back(constantOp);
+        }
+
+        auto signature = llvm::find_if(signatures, [&](const CallSignature &other) {
+            return other.constants == constants &&
+                   other.calls.front()->getDiscardableAttrDictionary() ==
+                       callOp->getDiscardableAttrDictionary();
+        });
+        if (signature == signatures.end()) {
+            signatures.push_back({std::move(constants), std::move(constantOps), {}});
+            signature = std::prev(signatures.end());
+        }
+        signature->calls.push_back(callOp);
+    }
+    return signatures;
+}
+
+/// Replace the constant arguments of a qnode by copies of their constants, remove them from the
+/// qnode and its calls, and fold the operations computing the gate parameters from them.
+void specialize(func::FuncOp funcOp, const CallSignature &signature)
+{
+    BitVector constantArgs(funcOp.getNumArguments());
+    Block &entryBlock = funcOp.getBody().front();
+    OpBuilder builder = OpBuilder::atBlockBegin(&entryBlock);
+    for (auto [idx, constantOp] : llvm::enumerate(signature.constantOps)) {
+        if (!constantOp) {
+            continue;
+        }
+        Operation *clonedOp = builder.clone(*constantOp);
+        entryBlock.getArgument(idx).replaceAllUsesWith(clonedOp->getResult(0));
+        constantArgs.set(idx);
+    }
+    (void)funcOp.eraseArguments(constantArgs);
+
+    for (CallOpInterface callOp : signature.calls) {
+        SmallVector<Value> operands;
+        for (auto [idx, operand] : llvm::enumerate(callOp.getArgOperands())) {
+            if (!constantArgs.test(idx)) {
+                operands.push_back(operand);
+            }
+        }
+        OpBuilder callBuilder(callOp);
+        CallOpInterface newCallOp = createQnodeCall(callBuilder, callOp, funcOp, operands);
+        callOp->replaceAllUsesWith(newCallOp->getResults());
+        callOp->erase();
+    }
+
+    // Folding alone propagates the constants to the gate parameters, e.g. through the
+    // tensor.extract of a scalar tensor argument
+    RewritePatternSet patterns(funcOp.getContext());
+    (void)applyPatternsGreedily(funcOp, std::move(patterns));
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_SPECIALIZEQNODECONSTANTSPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct SpecializeQnodeConstantsPass
+    : impl::SpecializeQnodeConstantsPassBase<SpecializeQnodeConstantsPass> {
+    using SpecializeQnodeConstantsPassBase::SpecializeQnodeConstantsPassBase;
+
+    void runOnOperation() final
+    {
+        ModuleOp mod = getOperation();
+        SymbolTableCollection symbolTables;
+
+        // Clones are inserted after the qnodes they specialize, in the same module, and are not
+        // visited themselves
+        for (func::FuncOp funcOp : getQnodes(mod)) {
+            std::optional<SmallVector<CallOpInterface>> calls = getQnodeCalls(funcOp, mod);
+            if (!calls || calls->empty()) {
+                continue;
+            }
+
+            SmallVector<CallSignature> signatures = groupCalls(*calls);
+            llvm::erase_if(signatures, [](const CallSignature &signature) {
+                return llvm::all_of(signature.constantOps, [](Operation *op) { return !op; });
+            });
+
+            // A qnode always called with the same constants is specialized in place
+            if (signatures.size() == 1 && signatures.front().calls.size() == calls->size()) {
+                specialize(funcOp, signatures.front());
+                continue;
+            }
+
+            // Otherwise the most called signatures are specialized first, within the budget
+            llvm::stable_sort(signatures, [](const CallSignature &lhs, const CallSignature &rhs) {
+                return lhs.calls.size() > rhs.calls.size();
+            });
+            if (signatures.size() > maxClones) {
+                signatures.resize(maxClones);
+            }
+            SymbolTable &symbolTable = symbolTables.getSymbolTable(funcOp->getParentOp());
+            Operation *insertionPoint = funcOp;
+            for (auto [idx, signature] : llvm::enumerate(signatures)) {
+                func::FuncOp clone = funcOp.clone();
+                clone.setName((funcOp.getSymName() + "_specialized_" + std::to_string(idx)).str());
+                symbolTable.insert(clone, std::next(Block::iterator(insertionPoint)));
+                insertionPoint = clone;
+                specialize(clone, signature);
+            }
+        }
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -22,6 +22,7 @@
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/SCF/Utils/Utils.h"
 #include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/SymbolTable.h"
 #include "mlir/IR/Types.h"
@@ -52,6 +53,48 @@ struct SplitMultipleTapesPass : public impl::SplitMultipleTapesPassBase<SplitMul
         return count;
     } // countTapes()
 
+    bool isSameDevice(catalyst::quantum::DeviceInitOp lhs, catalyst::quantum::DeviceInitOp rhs)
+    {
+        if (lhs->getAttrDictionary() != rhs->getAttrDictionary()) {
+            return false;
+        }
+        Value lhsShots = lhs.getShots();
+        Value rhsShots = rhs.getShots();
+        if (lhsShots == rhsShots) {
+            return true;
+        }
+        APInt lhsValue, rhsValue;
+        return lhsShots && rhsShots && matchPattern(lhsShots, m_ConstantInt(&lhsValue)) &&
+               matchPattern(rhsShots, m_ConstantInt(&rhsValue)) && lhsValue == rhsValue;
+    } // isSameDevice()
+
+    void shareDevices(const func::FuncOp &func)
+    {
+        // A tape targeting the same device as the previous tape continues it: the device release
+        // of the previous tape and the device of this tape are removed, so that the runtime does
+        // not release and initialize the device again in between.
+        // Each tape still deallocates its qubits and the next one allocates fresh qubits.
+        catalyst::quantum::DeviceInitOp lastDevice;
+        catalyst::quantum::DeviceReleaseOp lastRelease;
+        for (Block &block : func->getRegion(0).getBlocks()) {
+            for (Operation &op : llvm::make_early_inc_range(block.getOperations())) {
+                if (auto release = dyn_cast<catalyst::quantum::DeviceReleaseOp>(op)) {
+                    lastRelease = release;
+                }
+                else if (auto device = dyn_cast<catalyst::quantum::DeviceInitOp>(op)) {
+                    if (lastDevice && lastRelease && isSameDevice(lastDevice, device)) {
+                        lastRelease->erase();
+                        device->erase();
+                    }
+                    else {
+                        lastDevice = device;
+                    }
+                    lastRelease = nullptr;
+                }
+            }
+        }
+    } // shareDevices()
+
     void collectOperationsForEachTape(const func::FuncOp &func,
                                       SmallVector<std::vector<Operation *>> &OpsEachTape)
     {
@@ -264,6 +307,9 @@ struct SplitMultipleTapesPass : public impl::SplitMultipleTapesPassBase<SplitMul
         module->walk([&](func::FuncOp func) {
             // Don't process functions that are not qnodes: they won't have tapes.
             if (func->hasAttrOfType<UnitAttr>("quantum.node")) {
+                if (shareDevice) {
+                    shareDevices(func);
+                }
                 unsigned int howManyTapes = countTapes(func);
                 if (howManyTapes >= 2) {
                     MultitapePrograms.push_back(std::make_pair(func, howManyTapes));
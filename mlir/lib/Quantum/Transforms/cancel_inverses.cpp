@@ -62,6 +62,12 @@ struct CancelInversesPass : impl::CancelInversesPassBase<CancelInversesPass> {
 
         Operation *module = getOperation();
 
+        // Cancel the chains of inverses along each wire in a single sweep first, so that the
+        // greedy driver only has the rewrites across loop boundaries and leftovers to handle
+        RewritePatternSet sweepPatterns(&getContext());
+        populateCancelInversesPatterns(sweepPatterns);
+        applyPatternsInSingleSweep(module, FrozenRewritePatternSet(std::move(sweepPatterns)));
+
         RewritePatternSet patterns(&getContext());
         populateLoopBoundaryPatterns(patterns, 2);
         populateCancelInversesPatterns(patterns);
@@ -0,0 +1,63 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "commutation-cancellation"
+
+#include "llvm/Support/Debug.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Pass/PassManager.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "mlir/Transforms/Passes.h"
+
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Transforms/Patterns.h"
+
+using namespace llvm;
+using namespace mlir;
+using namespace catalyst::quantum;
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_COMMUTATIONCANCELLATIONPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct CommutationCancellationPass
+    : impl::CommutationCancellationPassBase<CommutationCancellationPass> {
+    using CommutationCancellationPassBase::CommutationCancellationPassBase;
+
+    void runOnOperation() final
+    {
+        LLVM_DEBUG(dbgs() << "commutation cancellation"
+                          << "\n");
+
+        // Run cse first, so that equal gate parameters are the same SSA values
+        MLIRContext *ctx = &getContext();
+        auto earlyCSEpm = PassManager::on<ModuleOp>(ctx);
+        earlyCSEpm.addPass(mlir::createCSEPass());
+        if (failed(runPipeline(earlyCSEpm, getOperation()))) {
+            return signalPassFailure();
+        }
+
+        RewritePatternSet patterns(&getContext());
+        populateCommutationCancellationPatterns(patterns);
+        if (failed(applyPatternsGreedily(getOperation(), std::move(patterns)))) {
+            return signalPassFailure();
+        }
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -17,6 +17,7 @@
 #include "mlir/Dialect/LLVMIR/LLVMDialect.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Interfaces/ViewLikeInterface.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 
 #include "Quantum/Transforms/Passes.h"
@@ -106,6 +107,36 @@ Value allocCopyMemrefDyn(Location loc, Value memref, PatternRewriter &rewriter)
     return newMemRef;
 }
 
+/**
+ * Whether a returned memref may point to a global constant buffer, as far as it can be told at
+ * compile time.
+ */
+enum class GlobalAliasing { Never, Always, Unknown };
+
+/**
+ * Follow the views of `memref` back to the operation that defines its buffer. Buffers allocated by
+ * the function never alias a global, while buffers of `memref.get_global` always do. Anything else,
+ * e.g. arguments or results of calls and control flow, is only known at runtime.
+ */
+GlobalAliasing getGlobalAliasing(Value memref)
+{
+    Operation *defOp = memref.getDefiningOp();
+    while (defOp) {
+        if (isa<memref::AllocOp>(defOp)) {
+            return GlobalAliasing::Never;
+        }
+        if (isa<memref::GetGlobalOp>(defOp)) {
+            return GlobalAliasing::Always;
+        }
+        auto viewOp = dyn_cast<ViewLikeOpInterface>(defOp);
+        if (!viewOp) {
+            break;
+        }
+        defOp = viewOp.getViewSource().getDefiningOp();
+    }
+    return GlobalAliasing::Unknown;
+}
+
 /**
  * Take a function and wrap all the memrefs it returns with an alloc-copy wrappers. The wrappers
  * would handle the memory-allocation errors by returning the original memrefs instead of new ones.
@@ -121,10 +152,25 @@ void applyCopyGlobalMemRefToReturnOp(func::ReturnOp op, PatternRewriter &rewrite
     LLVMTypeConverter typeConverter(rewriter.getContext());
     Type mlirIndex = rewriter.getIndexType();
     Type llvmIndex = typeConverter.convertType(mlirIndex);
-    auto deadbeefAttr = rewriter.getIntegerAttr(mlirIndex, 0xdeadbeef);
-    Value deadbeef = LLVM::ConstantOp::create(rewriter, op->getLoc(), llvmIndex, deadbeefAttr);
+    Value deadbeef;
 
     for (Value memref : memrefs) {
+        // Skip the runtime check when the aliasing is known at compile time
+        GlobalAliasing aliasing = getGlobalAliasing(memref);
+        if (aliasing == GlobalAliasing::Never) {
+            newMemRefs.push_back(memref);
+            continue;
+        }
+        if (aliasing == GlobalAliasing::Always) {
+            newMemRefs.push_back(allocCopyMemrefDyn(op->getLoc(), memref, rewriter));
+            continue;
+        }
+
+        if (!deadbeef) {
+            auto deadbeefAttr = rewriter.getIntegerAttr(mlirIndex, 0xdeadbeef);
+            deadbeef = LLVM::ConstantOp::create(rewriter, op->getLoc(), llvmIndex, deadbeefAttr);
+        }
+
         Type ty = memref.getType();
         Type llvmTy = typeConverter.convertType(ty);
         Value llvmMemRef =
@@ -166,6 +166,27 @@ struct DecomposeLoweringPass : impl::DecomposeLoweringPassBase<DecomposeLowering
         });
     }
 
+    // Keep the used decomposition functions that are larger than `maxInlineSize` outlined:
+    // all of their calls share the single function, so that the IR does not grow with each
+    // decomposed operation
+    void markLargeDecompositionFunctions(ModuleOp module)
+    {
+        if (maxInlineSize < 0) {
+            return;
+        }
+        module.walk([&](func::FuncOp func) {
+            if (DecompUtils::isDecompositionFunction(func)) {
+                int64_t size = 0;
+                func.getBody().walk([&](Operation *) { size++; });
+                if (size > maxInlineSize) {
+                    func.setPrivate();
+                    func.setNoInline(true);
+                }
+            }
+            return WalkResult::skip();
+        });
+    }
+
   public:
     void runOnOperation() final
     {
@@ -197,6 +218,7 @@ struct DecomposeLoweringPass : impl::DecomposeLoweringPassBase<DecomposeLowering
         }
 
         // Step 4: Inline and canonicalize/CSE the module again
+        markLargeDecompositionFunctions(module);
         PassManager pm(&getContext());
         pm.addPass(createInlinerPass());
         pm.addPass(createCanonicalizerPass());
@@ -907,9 +907,25 @@ void constructForLoopSampleBody(IRRewriter &builder, scf::ForOp forOp, func::Fun
     loopYields.push_back(insertSliceOp.getResult());
 }
 
+/// Get the declaration of the runtime function `fnName`, and declare it if it is missing.
+func::FuncOp getOrCreateRuntimeFunc(IRRewriter &builder, ModuleOp mod, Location loc,
+                                    StringRef fnName, FunctionType fnType)
+{
+    auto fnDecl = mod.lookupSymbol<func::FuncOp>(fnName);
+    if (!fnDecl) {
+        OpBuilder::InsertionGuard guard(builder);
+        builder.setInsertionPointToStart(mod.getBody());
+        fnDecl = func::FuncOp::create(builder, loc, fnName, fnType);
+        fnDecl.setPrivate();
+    }
+    return fnDecl;
+}
+
+/// When `rejectShots` is set, the loop carries the number of accepted shots as its last iteration
+/// argument, and the results of the shots rejected by the runtime are not accumulated.
 void constructForLoopBody(IRRewriter &builder, scf::ForOp forOp, func::FuncOp oneShotKernel,
                           const SmallVector<std::string> &loopIterArgsMPKinds,
-                          const IRMapping &cloneMapper)
+                          const IRMapping &cloneMapper, bool rejectShots = false)
 {
     OpBuilder::InsertionGuard guard(builder);
     Location loc = forOp->getLoc();
@@ -951,22 +967,247 @@ void constructForLoopBody(IRRewriter &builder, scf::ForOp forOp, func::FuncOp on
         }
     }
 
+    if (rejectShots) {
+        ModuleOp mod = forOp->getParentOfType<ModuleOp>();
+        func::FuncOp acceptedDecl =
+            getOrCreateRuntimeFunc(builder, mod, loc, "__catalyst__rt__shot_accepted",
+                                   builder.getFunctionType({}, builder.getI1Type()));
+        Value accepted = func::CallOp::create(builder, loc, acceptedDecl).getResult(0);
+        for (size_t i = 0; i < loopYields.size(); i++) {
+            loopYields[i] = arith::SelectOp::create(builder, loc, accepted, loopYields[i],
+                                                    forOp.getRegionIterArg(i));
+        }
+        Value acceptedCount = forOp.getRegionIterArgs().back();
+        auto increment = arith::ExtUIOp::create(builder, loc, acceptedCount.getType(), accepted);
+        loopYields.push_back(arith::AddIOp::create(builder, loc, acceptedCount, increment));
+    }
+
     scf::YieldOp::create(builder, loc, loopYields);
 }
 
+/// Whether the shots may be rejected at a failed postselection, which requires a postselected
+/// measurement, and results that are accumulated over the accepted shots only. Samples have one
+/// row per shot and keep filling the postselected outcomes.
+bool supportsPostselectRejection(func::FuncOp oneShotKernel,
+                                 const SmallVector<std::string> &loopIterArgsMPKinds)
+{
+    if (llvm::is_contained(loopIterArgsMPKinds, "sample")) {
+        return false;
+    }
+    auto isPostselected = [](quantum::MeasureOp op) {
+        return op.getPostselect() ? WalkResult::interrupt() : WalkResult::advance();
+    };
+    return oneShotKernel.walk(isPostselected).wasInterrupted();
+}
+
+//
+// Methods to construct the parallel loop over shots
+//
+
+/// Whether the results of every measurement kind can be gathered shot by shot in a parallel loop.
+/// The counts eigenvalues are only carried through the sequential loop, so counts do not qualify.
+bool supportsParallelShots(const SmallVector<std::string> &loopIterArgsMPKinds)
+{
+    return llvm::all_of(loopIterArgsMPKinds, [](const std::string &mpKind) {
+        return mpKind == "expval" || mpKind == "variance" || mpKind == "probs" ||
+               mpKind == "sample";
+    });
+}
+
+/// Append the random stream id as the last argument of the one-shot kernel, and pin the device
+/// to it right after its initialization. Each shot then draws from the stream of its own index, so
+/// that seeded results do not depend on the order in which the shots are scheduled.
+LogicalResult addShotPRNGStream(IRRewriter &builder, func::FuncOp oneShotKernel)
+{
+    OpBuilder::InsertionGuard guard(builder);
+    Location loc = oneShotKernel.getLoc();
+    Type i64Type = builder.getI64Type();
+
+    auto deviceInitOps = oneShotKernel.getOps<quantum::DeviceInitOp>();
+    if (deviceInitOps.empty()) {
+        return oneShotKernel.emitOpError("parallel shots require the device to be initialized "
+                                         "in the body of the one-shot kernel");
+    }
+    quantum::DeviceInitOp deviceInitOp = *deviceInitOps.begin();
+
+    unsigned streamIdx = oneShotKernel.getNumArguments();
+    if (failed(oneShotKernel.insertArgument(streamIdx, i64Type, {}, loc))) {
+        return failure();
+    }
+
+    builder.setInsertionPointAfter(deviceInitOp);
+    func::FuncOp fnDecl = getOrCreateRuntimeFunc(
+        builder, oneShotKernel->getParentOfType<ModuleOp>(), loc, "__catalyst__rt__set_prng_stream",
+        builder.getFunctionType(i64Type, {}));
+    func::CallOp::create(builder, loc, fnDecl, oneShotKernel.getArgument(streamIdx));
+    return success();
+}
+
+/// Run the one-shot kernel once per shot in an `scf.forall`, so that the shots may execute
+/// concurrently. Samples are inserted in place; the other measurements are first gathered into
+/// one row per shot and summed up afterwards in a sequential loop, which gives the same values as
+/// the iteration arguments of the sequential `scf.for` over shots.
+FailureOr<SmallVector<Value>>
+createParallelShotsLoop(IRRewriter &builder, Value shots, func::FuncOp qnodeFunc,
+                        func::FuncOp oneShotKernel, const SmallVector<Value> &loopIterArgs,
+                        const SmallVector<std::string> &loopIterArgsMPKinds)
+{
+    OpBuilder::InsertionGuard guard(builder);
+    Location loc = shots.getLoc();
+    Type f64Type = builder.getF64Type();
+
+    OpFoldResult numShots =
+        index::CastSOp::create(builder, loc, builder.getIndexType(), shots).getResult();
+    auto zero = builder.getIndexAttr(0);
+    auto one = builder.getIndexAttr(1);
+
+    // Per-shot outputs: the full sample tensor, one f64 per shot for expvals, or one row of
+    // probabilities per shot.
+    SmallVector<Value> outputs;
+    for (auto [i, mpKind] : llvm::enumerate(loopIterArgsMPKinds)) {
+        if (mpKind == "sample") {
+            outputs.push_back(loopIterArgs[i]);
+        }
+        else if (mpKind == "expval" || mpKind == "variance") {
+            SmallVector<OpFoldResult> perShotSizes = {numShots};
+            outputs.push_back(tensor::EmptyOp::create(builder, loc, perShotSizes, f64Type));
+        }
+        else if (mpKind == "probs") {
+            OpFoldResult numProbs = tensor::getMixedSize(builder, loc, loopIterArgs[i], 0);
+            SmallVector<OpFoldResult> perShotSizes = {numShots, numProbs};
+            outputs.push_back(tensor::EmptyOp::create(builder, loc, perShotSizes, f64Type));
+        }
+    }
+
+    if (failed(addShotPRNGStream(builder, oneShotKernel))) {
+        return failure();
+    }
+
+    auto forallOp = scf::ForallOp::create(builder, loc, ArrayRef<OpFoldResult>{numShots}, outputs,
+                                          std::nullopt);
+
+    builder.setInsertionPointToStart(forallOp.getBody());
+    Value shot = forallOp.getInductionVar(0);
+    SmallVector<Value> kernelArgs(qnodeFunc.getBody().front().getArguments());
+    kernelArgs.push_back(
+        index::CastSOp::create(builder, loc, builder.getI64Type(), shot).getResult());
+    auto kernalCallOp = func::CallOp::create(
+        builder, loc, oneShotKernel.getFunctionType().getResults(), oneShotKernel.getSymName(),
+        kernelArgs);
+
+    SmallVector<Value> sources;
+    SmallVector<SmallVector<OpFoldResult>> sizes;
+    for (auto [i, mpKind] : llvm::enumerate(loopIterArgsMPKinds)) {
+        Value result = kernalCallOp.getResult(i);
+        if (mpKind == "expval" || mpKind == "variance") {
+            sources.push_back(tensor::FromElementsOp::create(
+                builder, loc, RankedTensorType::get({1}, f64Type), result));
+            sizes.push_back({one});
+        }
+        else if (mpKind == "probs") {
+            sources.push_back(result);
+            sizes.push_back({one, tensor::getMixedSize(builder, loc, result, 0)});
+        }
+        else {
+            sources.push_back(result);
+            sizes.push_back({one, tensor::getMixedSize(builder, loc, result, 1)});
+        }
+    }
+
+    builder.setInsertionPointToStart(forallOp.getTerminator().getBody());
+    for (auto [i, source] : llvm::enumerate(sources)) {
+        SmallVector<OpFoldResult> offsets(sizes[i].size(), zero);
+        offsets[0] = shot;
+        SmallVector<OpFoldResult> strides(sizes[i].size(), one);
+        tensor::ParallelInsertSliceOp::create(builder, loc, source,
+                                              forallOp.getRegionIterArgs()[i], offsets, sizes[i],
+                                              strides);
+    }
+
+    // Sum up the per-shot expvals and probabilities
+    builder.setInsertionPointAfter(forallOp);
+    SmallVector<Value> loopResults(forallOp.getResults());
+    SmallVector<Value> sumInits;
+    SmallVector<size_t> sumIndices;
+    for (auto [i, mpKind] : llvm::enumerate(loopIterArgsMPKinds)) {
+        if (mpKind != "sample") {
+            sumInits.push_back(loopIterArgs[i]);
+            sumIndices.push_back(i);
+        }
+    }
+    if (sumInits.empty()) {
+        return loopResults;
+    }
+
+    scf::ForOp sumOp = createForLoop(builder, shots, sumInits);
+    builder.setInsertionPointToEnd(sumOp.getBody());
+    Value iv = sumOp.getInductionVar();
+    SmallVector<Value> sumYields;
+    for (auto [j, i] : llvm::enumerate(sumIndices)) {
+        Value perShot = forallOp.getResult(i);
+        Value sum = sumOp.getRegionIterArg(j);
+        if (loopIterArgsMPKinds[i] == "probs") {
+            SmallVector<OpFoldResult> offsets = {iv, zero};
+            SmallVector<OpFoldResult> sliceSizes = {one,
+                                                    tensor::getMixedSize(builder, loc, perShot, 1)};
+            SmallVector<OpFoldResult> strides = {one, one};
+            auto row = tensor::ExtractSliceOp::create(builder, loc,
+                                                      cast<RankedTensorType>(sum.getType()),
+                                                      perShot, offsets, sliceSizes, strides);
+            sumYields.push_back(stablehlo::AddOp::create(builder, loc, row, sum).getResult());
+        }
+        else {
+            auto value = tensor::ExtractOp::create(builder, loc, perShot, iv);
+            sumYields.push_back(arith::AddFOp::create(builder, loc, value, sum).getResult());
+        }
+    }
+    scf::YieldOp::create(builder, loc, sumYields);
+
+    for (auto [j, i] : llvm::enumerate(sumIndices)) {
+        loopResults[i] = sumOp.getResult(j);
+    }
+    return loopResults;
+}
+
+//
+// Methods to toggle the measurement tree of the runtime
+//
+
+/// Call the runtime to enable or disable the execution of the measurement branches of the
+/// following shots as a tree, see `MeasurementTreeDevice` in the runtime.
+void toggleMeasurementTree(IRRewriter &builder, ModuleOp mod, Location loc, bool status)
+{
+    func::FuncOp fnDecl =
+        getOrCreateRuntimeFunc(builder, mod, loc, "__catalyst__rt__toggle_measurement_tree",
+                               builder.getFunctionType(builder.getI1Type(), {}));
+    Value statusVal = arith::ConstantOp::create(builder, loc, builder.getBoolAttr(status));
+    func::CallOp::create(builder, loc, fnDecl, statusVal);
+}
+
+/// Call the runtime to enable or disable the early rejection of the following shots at their
+/// first failed postselected measurement, see `ShotRejectionDevice` in the runtime.
+void toggleShotRejection(IRRewriter &builder, ModuleOp mod, Location loc, bool status)
+{
+    func::FuncOp fnDecl =
+        getOrCreateRuntimeFunc(builder, mod, loc, "__catalyst__rt__toggle_shot_rejection",
+                               builder.getFunctionType(builder.getI1Type(), {}));
+    Value statusVal = arith::ConstantOp::create(builder, loc, builder.getBoolAttr(status));
+    func::CallOp::create(builder, loc, fnDecl, statusVal);
+}
+
 //
 // Methods to postprocess the for loop results
 //
 
-void postProcessLoopProbsResults(IRRewriter &builder, scf::ForOp forOp, func::FuncOp oneShotKernel,
-                                 Value shots, SmallVector<Value> &retVals, size_t retIdx,
+void postProcessLoopProbsResults(IRRewriter &builder, Location loc, ValueRange loopResults,
+                                 func::FuncOp oneShotKernel, Value shots,
+                                 SmallVector<Value> &retVals, size_t retIdx,
                                  const IRMapping &cloneMapper)
 {
     // Divide the sum by shots
     // shots Value is I64, need to turn into tensor<f64> and then broadcast for
     // division
     OpBuilder::InsertionGuard guard(builder);
-    Location loc = forOp->getLoc();
     Type i32Type = builder.getI32Type();
     Type f64Type = builder.getF64Type();
 
@@ -1000,23 +1241,22 @@ void postProcessLoopProbsResults(IRRewriter &builder, scf::ForOp forOp, func::Fu
                                                                builder.getDenseI64ArrayAttr({}));
     }
 
-    auto divOp = stablehlo::DivOp::create(builder, loc, forOp->getResult(retIdx), broadcastedShots);
+    auto divOp = stablehlo::DivOp::create(builder, loc, loopResults[retIdx], broadcastedShots);
     retVals.push_back(divOp.getResult());
 }
 
-void postProcessLoopResults(IRRewriter &builder, scf::ForOp forOp, func::FuncOp oneShotKernel,
-                            Value shots, SmallVector<Value> &retVals,
+void postProcessLoopResults(IRRewriter &builder, Location loc, ValueRange loopResults,
+                            func::FuncOp oneShotKernel, Value shots, SmallVector<Value> &retVals,
                             const SmallVector<std::string> &loopIterArgsMPKinds,
                             const IRMapping &cloneMapper)
 {
     OpBuilder::InsertionGuard guard(builder);
-    Location loc = forOp->getLoc();
     Type f64Type = builder.getF64Type();
 
     for (auto [i, mpKind] : llvm::enumerate(loopIterArgsMPKinds)) {
         if (mpKind == "expval") {
             auto int2floatCastOp = arith::SIToFPOp::create(builder, loc, f64Type, shots);
-            auto divOp = arith::DivFOp::create(builder, loc, forOp->getResult(i),
+            auto divOp = arith::DivFOp::create(builder, loc, loopResults[i],
                                                int2floatCastOp.getResult());
             retVals.push_back(divOp.getResult());
         }
@@ -1025,7 +1265,7 @@ void postProcessLoopResults(IRRewriter &builder, scf::ForOp forOp, func::FuncOp
             // Divide the sum by shots
             // shots Value is I64, need to turn into tensor<f64> for division
             auto int2floatCastOp = arith::SIToFPOp::create(builder, loc, f64Type, shots);
-            auto divOp = arith::DivFOp::create(builder, loc, forOp->getResult(i),
+            auto divOp = arith::DivFOp::create(builder, loc, loopResults[i],
                                                int2floatCastOp.getResult());
 
             // Var(a set of MCMs) = Exp(a set of MCMs) - Exp(a set of MCMs)^2
@@ -1037,18 +1277,12 @@ void postProcessLoopResults(IRRewriter &builder, scf::ForOp forOp, func::FuncOp
         }
 
         else if (mpKind == "probs") {
-            postProcessLoopProbsResults(builder, forOp, oneShotKernel, shots, retVals, i,
-                                        cloneMapper);
+            postProcessLoopProbsResults(builder, loc, loopResults, oneShotKernel, shots, retVals,
+                                        i, cloneMapper);
         }
 
-        else if (mpKind == "sample") {
-            retVals.push_back(forOp->getResult(i));
-        }
-        else if (mpKind == "eigens") {
-            retVals.push_back(forOp->getResult(i));
-        }
-        else if (mpKind == "counts") {
-            retVals.push_back(forOp->getResult(i));
+        else if (mpKind == "sample" || mpKind == "eigens" || mpKind == "counts") {
+            retVals.push_back(loopResults[i]);
         }
     }
 }
@@ -1082,6 +1316,11 @@ struct DynamicOneShotPass : public impl::DynamicOneShotPassBase<DynamicOneShotPa
         // For each qnode function, find the returned MPs
         // Then handle the one shot logic for each MP type
         for (auto qnodeFunc : qnodeFuncs) {
+            if (qnodeFunc.getOps<quantum::DeviceInitOp>().empty()) {
+                qnodeFunc->emitOpError("one-shot execution requires the qnode to initialize "
+                                       "its device in its body");
+                return signalPassFailure();
+            }
             qnodeFunc->removeAttr("quantum.node");
             func::FuncOp qKernel = splitQuantumAndPostProcessing(builder, qnodeFunc);
 
@@ -1131,14 +1370,48 @@ struct DynamicOneShotPass : public impl::DynamicOneShotPassBase<DynamicOneShotPa
                 return signalPassFailure();
             }
             builder.setInsertionPointToEnd(&qKernel.getBody().front());
-            scf::ForOp forOp = createForLoop(builder, shots, loopIterArgs);
-            constructForLoopBody(builder, forOp, oneShotKernel, loopIterArgsMPKinds, cloneMapper);
+            if (measurementTree) {
+                toggleMeasurementTree(builder, mod, loc, true);
+            }
+            // Rejected shots are not counted, so the results are normalized by the accepted shots
+            bool rejectShots = postselectRejection &&
+                               supportsPostselectRejection(oneShotKernel, loopIterArgsMPKinds);
+            Value normalizationShots = shots;
+            if (rejectShots) {
+                toggleShotRejection(builder, mod, loc, true);
+                loopIterArgs.push_back(arith::ConstantOp::create(
+                    builder, loc, builder.getI64Type(), builder.getI64IntegerAttr(0)));
+            }
+            SmallVector<Value> loopResults;
+            if (!rejectShots && parallelShots && supportsParallelShots(loopIterArgsMPKinds)) {
+                FailureOr<SmallVector<Value>> parallelResults = createParallelShotsLoop(
+                    builder, shots, qKernel, oneShotKernel, loopIterArgs, loopIterArgsMPKinds);
+                if (failed(parallelResults)) {
+                    return signalPassFailure();
+                }
+                loopResults = std::move(*parallelResults);
+            }
+            else {
+                scf::ForOp forOp = createForLoop(builder, shots, loopIterArgs);
+                constructForLoopBody(builder, forOp, oneShotKernel, loopIterArgsMPKinds,
+                                     cloneMapper, rejectShots);
+                loopResults.append(forOp.getResults().begin(), forOp.getResults().end());
+                if (rejectShots) {
+                    normalizationShots = loopResults.pop_back_val();
+                }
+            }
 
             // Perform each MP's necessary post processing after the loop body
             builder.setInsertionPointToEnd(&qKernel.getBody().front());
+            if (measurementTree) {
+                toggleMeasurementTree(builder, mod, loc, false);
+            }
+            if (rejectShots) {
+                toggleShotRejection(builder, mod, loc, false);
+            }
             SmallVector<Value> retVals;
-            postProcessLoopResults(builder, forOp, oneShotKernel, shots, retVals,
-                                   loopIterArgsMPKinds, cloneMapper);
+            postProcessLoopResults(builder, shots.getLoc(), loopResults, oneShotKernel,
+                                   normalizationShots, retVals, loopIterArgsMPKinds, cloneMapper);
             func::ReturnOp::create(builder, loc, retVals);
         }
     }
@@ -14,9 +14,17 @@
 
 #define DEBUG_TYPE "graph-decomposition"
 
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/LLVMIR/LLVMDialect.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
@@ -34,6 +42,8 @@
 #include "Quantum/Transforms/Passes.h"
 
 #include "DGBuilder.hpp"
+#include "DGCache.hpp"
+#include "DGIncrementalSolver.hpp"
 #include "DGSolver.hpp"
 #include "DGTypes.hpp"
 
@@ -47,6 +57,43 @@ namespace quantum {
 #define GEN_PASS_DEF_GRAPHDECOMPOSITIONPASS
 #include "Quantum/Transforms/Passes.h.inc"
 
+namespace {
+
+/// Solutions shared by all the runs of the pass in the process, such as the QNodes of a program,
+/// along with the solution cache files already loaded into them.
+struct SharedSolutionCache {
+    std::mutex mutex;
+    llvm::StringSet<> loadedFiles;
+    SolutionCache cache;
+};
+
+SharedSolutionCache &getSharedSolutionCache()
+{
+    static SharedSolutionCache sharedCache;
+    return sharedCache;
+}
+
+/// Incremental solvers shared by the runs of the pass in the process, by the key of their graph
+/// without the gate costs, so that runs that only change the gate costs update the solution of a
+/// previous run.
+struct SharedIncrementalSolvers {
+    struct Entry {
+        std::mutex mutex;
+        std::optional<IncrementalSolver> solver;
+    };
+
+    std::mutex mutex;
+    llvm::StringMap<std::unique_ptr<Entry>> entries;
+};
+
+SharedIncrementalSolvers &getSharedIncrementalSolvers()
+{
+    static SharedIncrementalSolvers sharedSolvers;
+    return sharedSolvers;
+}
+
+} // namespace
+
 struct GraphDecompositionPass : public impl::GraphDecompositionPassBase<GraphDecompositionPass> {
     using GraphDecompositionPassBase::GraphDecompositionPassBase;
     void runOnOperation() final
@@ -111,8 +158,21 @@ struct GraphDecompositionPass : public impl::GraphDecompositionPassBase<GraphDec
         AltDecomps altDecomps = buildAltDecomps(opToAltDecompNames, rulesByName);
         DecompositionGraph graph(setOfOps, targetGateSet, setOfRules, std::move(fixedDecomps),
                                  std::move(altDecomps));
-        DecompositionSolver solver(graph);
-        auto solution = solver.solve();
+        GraphResult solution;
+        if (incrementalOption) {
+            solution = solveIncrementally(std::move(graph), targetGateSet);
+        }
+        else {
+            SolutionCache &cache = loadSolutionCache();
+            const size_t numCachedSolutions = cache.size();
+            DecompositionSolver solver(graph, &cache,
+                                       bestFirstOption ? SolverStrategy::BestFirst
+                                                       : SolverStrategy::DepthFirst);
+            solution = solver.solve();
+            if (cache.size() != numCachedSolutions) {
+                saveSolutionCache(cache);
+            }
+        }
         ///////////////////////////
         // Step 3: Insert decomposition rules picked by the graph solver (solution) into the
         // module
@@ -138,6 +198,80 @@ struct GraphDecompositionPass : public impl::GraphDecompositionPassBase<GraphDec
     }
 
   private:
+    GraphResult solveIncrementally(DecompositionGraph graph, const WeightedGateset &gateset)
+    {
+        SharedIncrementalSolvers &sharedSolvers = getSharedIncrementalSolvers();
+        const std::string graphKey = IncrementalSolver::getGraphKey(graph);
+
+        SharedIncrementalSolvers::Entry *entry = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(sharedSolvers.mutex);
+            auto &slot = sharedSolvers.entries[graphKey];
+            if (!slot) {
+                slot = std::make_unique<SharedIncrementalSolvers::Entry>();
+            }
+            entry = slot.get();
+        }
+
+        // Graphs of the same key only differ by their gate costs
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        if (!entry->solver.has_value() || !entry->solver->updateGateset(gateset)) {
+            entry->solver.emplace(std::move(graph));
+        }
+        GraphResult solution = entry->solver->solve();
+        LLVM_DEBUG(llvm::dbgs() << "Resolved " << entry->solver->getNumResolved() << " of "
+                                << entry->solver->getGraph().getNumOperatorIds()
+                                << " operators of the decomposition graph\n");
+        return solution;
+    }
+
+    SolutionCache &loadSolutionCache()
+    {
+        SharedSolutionCache &sharedCache = getSharedSolutionCache();
+        if (solutionCacheFile.empty()) {
+            return sharedCache.cache;
+        }
+
+        std::lock_guard<std::mutex> lock(sharedCache.mutex);
+        if (!sharedCache.loadedFiles.insert(solutionCacheFile).second ||
+            !llvm::sys::fs::exists(solutionCacheFile)) {
+            return sharedCache.cache;
+        }
+
+        // A stale or corrupted cache file is not an error, it is overwritten with new solutions
+        std::ifstream cacheStream(solutionCacheFile);
+        try {
+            sharedCache.cache.load(cacheStream);
+        }
+        catch (const GraphError &e) {
+            LLVM_DEBUG(llvm::dbgs() << "Ignoring solution cache '" << solutionCacheFile
+                                    << "': " << e.what() << "\n");
+        }
+        return sharedCache.cache;
+    }
+
+    void saveSolutionCache(const SolutionCache &cache)
+    {
+        if (solutionCacheFile.empty()) {
+            return;
+        }
+
+        std::ostringstream cacheStream;
+        cache.save(cacheStream);
+
+        // The file is written to a temporary file first and then renamed, so that concurrent
+        // compilations never read a partially written cache
+        std::lock_guard<std::mutex> lock(getSharedSolutionCache().mutex);
+        llvm::Error err = llvm::writeToOutput(solutionCacheFile, [&](llvm::raw_ostream &os) {
+            os << cacheStream.str();
+            return llvm::Error::success();
+        });
+        if (err) {
+            getOperation().emitWarning() << "failed to write the decomposition solution cache: "
+                                         << llvm::toString(std::move(err));
+        }
+    }
+
     void parseFixedDecomps(llvm::StringMap<std::string> &opToFixedDecompName,
                            llvm::StringSet<> &userRuleNames)
     {
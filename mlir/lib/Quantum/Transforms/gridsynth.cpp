@@ -44,6 +44,7 @@ struct GridsynthPass : impl::GridsynthPassBase<GridsynthPass> {
         mlir::MLIRContext *context = &getContext();
         RewritePatternSet patterns(context);
 
+        batchGridsynthAngles(module, epsilon, pprBasis);
         populateGridsynthPatterns(patterns, epsilon, pprBasis);
 
         if (failed(applyPatternsGreedily(module, std::move(patterns)))) {
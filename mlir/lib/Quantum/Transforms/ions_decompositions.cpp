@@ -51,6 +51,11 @@ struct IonsDecompositionPass : impl::IonsDecompositionPassBase<IonsDecomposition
         }
         RewritePatternSet patterns(&getContext());
         populateIonsDecompositionPatterns(patterns);
+        if (mergeRotations) {
+            // Fuse the rotations of consecutive decompositions as soon as they are produced, so
+            // that fewer pulses are scheduled from them
+            populateMergeRotationsPatterns(patterns);
+        }
         if (failed(applyPatternsGreedily(module, std::move(patterns)))) {
             return signalPassFailure();
         }
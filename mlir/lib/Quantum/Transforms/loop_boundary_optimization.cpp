@@ -51,6 +51,9 @@ struct LoopBoundaryOptimizationPass
 
         RewritePatternSet patterns(&getContext());
         populateLoopBoundaryPatterns(patterns, 0);
+        if (foldRotations) {
+            populateLoopRotationFoldingPatterns(patterns);
+        }
 
         if (failed(applyPatternsGreedily(module, std::move(patterns)))) {
             return signalPassFailure();
@@ -18,12 +18,159 @@
 
 #include "llvm/ADT/SmallVector.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/IR/BuiltinOps.h"
+#include "mlir/Interfaces/LoopLikeInterface.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
 #include "mlir/Pass/Pass.h"
 
 #include "Quantum/IR/QuantumOps.h"
 
 using namespace mlir;
+using namespace catalyst::quantum;
+
+namespace {
+
+/// Get the uncontrolled global phase applied by a block, if it applies exactly one.
+GlobalPhaseOp getSinglePhase(Block &block)
+{
+    GlobalPhaseOp singlePhase;
+    for (GlobalPhaseOp phaseOp : block.getOps<GlobalPhaseOp>()) {
+        if (!phaseOp.getInCtrlQubits().empty()) {
+            continue;
+        }
+        if (singlePhase) {
+            return nullptr;
+        }
+        singlePhase = phaseOp;
+    }
+    return singlePhase;
+}
+
+/// Get the angle of a global phase, negated if the phase is adjoint.
+Value getSignedAngle(OpBuilder &builder, GlobalPhaseOp phaseOp)
+{
+    if (!phaseOp.getAdjoint()) {
+        return phaseOp.getAngle();
+    }
+    builder.setInsertionPoint(phaseOp);
+    return arith::NegFOp::create(builder, phaseOp.getLoc(), phaseOp.getAngle());
+}
+
+/// Move the computation of `value` out of `loop`, if it only depends on values defined outside.
+bool hoistOutOfLoop(LoopLikeOpInterface loop, Value value)
+{
+    if (loop.isDefinedOutsideOfLoop(value)) {
+        return true;
+    }
+    Operation *op = value.getDefiningOp();
+    if (!op || op->getParentOp() != loop || op->getNumRegions() != 0 || !isPure(op)) {
+        return false;
+    }
+    for (Value operand : op->getOperands()) {
+        if (!hoistOutOfLoop(loop, operand)) {
+            return false;
+        }
+    }
+    loop.moveOutOfLoop(op);
+    return true;
+}
+
+/// Fold the global phase applied by each iteration of a loop into a single phase after the loop,
+/// multiplied by its trip count.
+void hoistPhaseFromFor(OpBuilder &builder, scf::ForOp forOp)
+{
+    GlobalPhaseOp phaseOp = getSinglePhase(*forOp.getBody());
+    if (!phaseOp || !hoistOutOfLoop(forOp, phaseOp.getAngle())) {
+        return;
+    }
+
+    Location loc = forOp.getLoc();
+    builder.setInsertionPointAfter(forOp);
+    Value distance =
+        arith::SubIOp::create(builder, loc, forOp.getUpperBound(), forOp.getLowerBound());
+    Value tripCount = arith::CeilDivSIOp::create(builder, loc, distance, forOp.getStep());
+    Value zero = arith::ConstantOp::create(builder, loc, builder.getZeroAttr(tripCount.getType()));
+    tripCount = arith::MaxSIOp::create(builder, loc, tripCount, zero);
+    if (tripCount.getType().isIndex()) {
+        tripCount = arith::IndexCastOp::create(builder, loc, builder.getI64Type(), tripCount);
+    }
+    tripCount = arith::SIToFPOp::create(builder, loc, builder.getF64Type(), tripCount);
+    Value angle = arith::MulFOp::create(builder, loc, phaseOp.getAngle(), tripCount);
+
+    phaseOp->moveAfter(angle.getDefiningOp());
+    phaseOp.getAngleMutable().assign(angle);
+}
+
+/// Hoist the global phases applied by both branches of a conditional into a single phase after
+/// it, whose angle is yielded by the branches.
+void hoistPhaseFromIf(OpBuilder &builder, scf::IfOp ifOp)
+{
+    if (ifOp.getElseRegion().empty()) {
+        return;
+    }
+    GlobalPhaseOp thenPhase = getSinglePhase(*ifOp.thenBlock());
+    GlobalPhaseOp elsePhase = getSinglePhase(*ifOp.elseBlock());
+    if (!thenPhase || !elsePhase) {
+        return;
+    }
+
+    for (GlobalPhaseOp phaseOp : {thenPhase, elsePhase}) {
+        Value angle = getSignedAngle(builder, phaseOp);
+        Operation *yieldOp = phaseOp->getBlock()->getTerminator();
+        yieldOp->insertOperands(yieldOp->getNumOperands(), angle);
+    }
+
+    SmallVector<Type> resultTypes(ifOp.getResultTypes());
+    resultTypes.push_back(builder.getF64Type());
+    builder.setInsertionPoint(ifOp);
+    auto newIfOp = scf::IfOp::create(builder, ifOp.getLoc(), resultTypes, ifOp.getCondition(),
+                                     /*addThenBlock=*/false, /*addElseBlock=*/false);
+    newIfOp.getThenRegion().takeBody(ifOp.getThenRegion());
+    newIfOp.getElseRegion().takeBody(ifOp.getElseRegion());
+    ifOp.replaceAllUsesWith(newIfOp.getResults().drop_back());
+    ifOp.erase();
+
+    thenPhase->moveAfter(newIfOp);
+    thenPhase.getAngleMutable().assign(newIfOp.getResults().back());
+    thenPhase.setAdjoint(false);
+    elsePhase.erase();
+}
+
+/// Merge the uncontrolled global phases of a block into its last one.
+void combinePhases(OpBuilder &builder, Block *block)
+{
+    auto phases = block->getOps<GlobalPhaseOp>();
+    auto simplePhases = llvm::make_filter_range(
+        phases, [](GlobalPhaseOp phaseOp) { return phaseOp.getInCtrlQubits().empty(); });
+    if (simplePhases.empty() || std::next(simplePhases.begin()) == simplePhases.end()) {
+        return;
+    }
+
+    GlobalPhaseOp lastPhase = *std::prev(simplePhases.end());
+    auto remainingPhases = llvm::drop_end(simplePhases);
+
+    builder.setInsertionPoint(lastPhase);
+    Value runningSum = lastPhase.getAngle();
+    if (lastPhase.getAdjoint()) {
+        runningSum = arith::NegFOp::create(builder, lastPhase->getLoc(), runningSum);
+        lastPhase.setAdjoint(false);
+    }
+
+    for (GlobalPhaseOp phaseOp : llvm::make_early_inc_range(remainingPhases)) {
+        llvm::SmallVector<Value, 2> args{runningSum, phaseOp.getAngle()};
+        if (phaseOp.getAdjoint()) {
+            runningSum = arith::SubFOp::create(builder, phaseOp.getLoc(), args);
+        }
+        else {
+            runningSum = arith::AddFOp::create(builder, phaseOp.getLoc(), args);
+        }
+        phaseOp->erase();
+    }
+    lastPhase.getAngleMutable().assign(runningSum);
+}
+
+} // namespace
 
 namespace catalyst {
 namespace quantum {
@@ -40,36 +187,18 @@ struct CombineGlobalPhasesPass : impl::CombineGlobalPhasesPassBase<CombineGlobal
         ModuleOp mod = getOperation();
         OpBuilder builder(mod->getContext());
 
+        // Nested blocks are visited first, so that the phases of loop bodies and branches are
+        // already merged when they are hoisted into the enclosing block
         mod.walk([&](Block *block) {
-            auto phases = block->getOps<GlobalPhaseOp>();
-            auto simplePhases = llvm::make_filter_range(
-                phases, [](GlobalPhaseOp phaseOp) { return phaseOp.getInCtrlQubits().empty(); });
-            if (simplePhases.empty() || std::next(simplePhases.begin()) == simplePhases.end()) {
-                return WalkResult::advance();
-            }
-
-            GlobalPhaseOp lastPhase = *std::prev(simplePhases.end());
-            auto remainingPhases = llvm::drop_end(simplePhases);
-
-            builder.setInsertionPoint(lastPhase);
-            Value runningSum = lastPhase.getAngle();
-            if (lastPhase.getAdjoint()) {
-                runningSum = arith::NegFOp::create(builder, lastPhase->getLoc(), runningSum);
-                lastPhase.setAdjoint(false);
-            }
-
-            for (GlobalPhaseOp phaseOp : llvm::make_early_inc_range(remainingPhases)) {
-                llvm::SmallVector<Value, 2> args{runningSum, phaseOp.getAngle()};
-                if (phaseOp.getAdjoint()) {
-                    runningSum = arith::SubFOp::create(builder, phaseOp.getLoc(), args);
+            for (Operation &op : llvm::make_early_inc_range(*block)) {
+                if (auto forOp = dyn_cast<scf::ForOp>(op)) {
+                    hoistPhaseFromFor(builder, forOp);
                 }
-                else {
-                    runningSum = arith::AddFOp::create(builder, phaseOp.getLoc(), args);
+                else if (auto ifOp = dyn_cast<scf::IfOp>(op)) {
+                    hoistPhaseFromIf(builder, ifOp);
                 }
-                phaseOp->erase();
             }
-            lastPhase.getAngleMutable().assign(runningSum);
-
+            combinePhases(builder, block);
             return WalkResult::advance();
         });
     }
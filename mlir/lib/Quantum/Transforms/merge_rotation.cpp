@@ -60,6 +60,12 @@ struct MergeRotationsPass : impl::MergeRotationsPassBase<MergeRotationsPass> {
             return signalPassFailure();
         }
 
+        // Merge the chains of rotations along each wire in a single sweep first, so that the
+        // greedy driver only has the rewrites across loop boundaries and leftovers to handle
+        RewritePatternSet sweepPatterns(&getContext());
+        populateMergeRotationsPatterns(sweepPatterns);
+        applyPatternsInSingleSweep(module, FrozenRewritePatternSet(std::move(sweepPatterns)));
+
         RewritePatternSet patterns(&getContext());
         populateLoopBoundaryPatterns(patterns, 1);
         populateMergeRotationsPatterns(patterns);
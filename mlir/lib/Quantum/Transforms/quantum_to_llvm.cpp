@@ -88,6 +88,14 @@ struct QuantumConversionPass : impl::QuantumConversionPassBase<QuantumConversion
 
         if (failed(applyFullConversion(getOperation(), target, std::move(patterns)))) {
             signalPassFailure();
+            return;
+        }
+
+        if (batchGates) {
+            batchQIRGateCalls(getOperation());
+        }
+        if (batchMeasurements) {
+            batchQIRMeasureCalls(getOperation());
         }
     }
 };
@@ -37,12 +37,25 @@
 //     %r1   = call @circuit.group.1()  // ev2 (overlaps with ev0)
 //     return %r0#0, %r0#1, %r1
 //   }
+//
+// With grouping_strategy="qwc", qubit-wise commuting observables share a group, where the groups
+// are found by colouring the graph of the observables that do not commute. The qubits of each
+// group are then rotated to the computational basis before being measured:
+//   func.func @circuit() -> (f64, f64, f64) {
+//     %r0:2 = call @circuit.group.0()  // ev0, ev1 (X(0) and Y(1) commute qubit-wise)
+//     %r1   = call @circuit.group.1()  // ev2 (Z(0) does not commute with X(0))
+//     return %r0#0, %r0#1, %r1
+//   }
 
 #define DEBUG_TYPE "split-non-commuting"
 
+#include <algorithm>
+#include <cmath>
 #include <deque>
+#include <optional>
 
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/SmallVector.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
@@ -117,6 +130,82 @@ struct SplitNonCommutingPass : public impl::SplitNonCommutingPassBase<SplitNonCo
             nullptr, OperationEquivalence::Flags::IgnoreLocations);
     }
 
+    /// The basis each qubit of an observable is measured in, for observables that are tensor
+    /// products of named observables. Identities are left out, since they commute with all.
+    /// Returns std::nullopt for any other observable.
+    static std::optional<llvm::DenseMap<Value, NamedObservable>> getObservableBases(Value obs)
+    {
+        llvm::DenseMap<Value, NamedObservable> bases;
+        SmallVector<Value> worklist{obs};
+        while (!worklist.empty()) {
+            Operation *defOp = worklist.pop_back_val().getDefiningOp();
+            if (auto namedObs = dyn_cast_or_null<NamedObsOp>(defOp)) {
+                if (namedObs.getType() == NamedObservable::Identity) {
+                    continue;
+                }
+                auto [it, inserted] = bases.try_emplace(namedObs.getQubit(), namedObs.getType());
+                if (!inserted && it->second != namedObs.getType()) {
+                    return std::nullopt;
+                }
+            }
+            else if (auto tensorOp = dyn_cast_or_null<TensorOp>(defOp)) {
+                llvm::append_range(worklist, tensorOp.getTerms());
+            }
+            else {
+                return std::nullopt;
+            }
+        }
+        return bases;
+    }
+
+    /// Two observables commute qubit-wise if they are measured in the same basis on every qubit
+    /// they share. Observables of unknown structure are assumed not to commute with any other.
+    static bool qubitWiseCommute(const std::optional<llvm::DenseMap<Value, NamedObservable>> &lhs,
+                                 const std::optional<llvm::DenseMap<Value, NamedObservable>> &rhs)
+    {
+        if (!lhs || !rhs) {
+            return false;
+        }
+        return llvm::all_of(*lhs, [&](const auto &qubitBasis) {
+            auto it = rhs->find(qubitBasis.first);
+            return it == rhs->end() || it->second == qubitBasis.second;
+        });
+    }
+
+    /// Colour a graph with the DSATUR heuristic: repeatedly colour the vertex with the most
+    /// distinctly coloured neighbours (ties broken by degree) with the smallest colour that none of
+    /// its neighbours has. Returns the colour of each vertex, numbered from 0.
+    static SmallVector<int> colourGraph(ArrayRef<SmallVector<int>> adjacency)
+    {
+        const size_t numVertices = adjacency.size();
+        SmallVector<int> colours(numVertices, -1);
+        SmallVector<llvm::DenseSet<int>> neighbourColours(numVertices);
+
+        for (size_t step = 0; step < numVertices; ++step) {
+            int next = -1;
+            for (size_t v = 0; v < numVertices; ++v) {
+                if (colours[v] >= 0) {
+                    continue;
+                }
+                if (next < 0 || neighbourColours[v].size() > neighbourColours[next].size() ||
+                    (neighbourColours[v].size() == neighbourColours[next].size() &&
+                     adjacency[v].size() > adjacency[next].size())) {
+                    next = static_cast<int>(v);
+                }
+            }
+
+            int colour = 0;
+            while (neighbourColours[next].contains(colour)) {
+                colour++;
+            }
+            colours[next] = colour;
+            for (int neighbour : adjacency[next]) {
+                neighbourColours[neighbour].insert(colour);
+            }
+        }
+        return colours;
+    }
+
     struct MeasInfo {
         int idx;
         MeasurementProcess measurementOp;
@@ -125,8 +214,10 @@ struct SplitNonCommutingPass : public impl::SplitNonCommutingPassBase<SplitNonCo
     };
 
     /// Assign each measurement to a group. With the default strategy, each measurement gets its own
-    /// group. And with "wires", measurements on non-overlapping wires are packed into the same
-    /// group and also handles deduplication to canonicalize identical observables.
+    /// group. With "wires", measurements on non-overlapping wires are packed into the same group,
+    /// and with "qwc", qubit-wise commuting measurements are, by colouring the graph of the
+    /// measurements that do not commute. Also handles deduplication to canonicalize identical
+    /// observables.
     /// This function updates the following maps:
     /// - measInfos:     a list of all measurements and their information.
     /// - measToGroup:   maps a measurement index to a group index.
@@ -190,16 +281,55 @@ struct SplitNonCommutingPass : public impl::SplitNonCommutingPassBase<SplitNonCo
                 // assign the new group index to the measurement.
                 measToGroup[i] = static_cast<int>(it - groupQubits.begin());
             }
-            else {
+            else if (strategy != "qwc") {
                 measToGroup[i] = static_cast<int>(uniqueIndices.size()) - 1;
             }
         }
 
+        if (strategy == "qwc") {
+            return assignQubitWiseCommutingGroups(measInfos, uniqueIndices, measToGroup,
+                                                  canonicalMeas);
+        }
+
         int numGroups = (strategy == "wires") ? static_cast<int>(groupQubits.size())
                                               : static_cast<int>(uniqueIndices.size());
         return numGroups;
     }
 
+    /// Assign the unique measurements to groups of qubit-wise commuting observables, and their
+    /// duplicates to the groups of their canonical measurements. Returns the number of groups.
+    static int assignQubitWiseCommutingGroups(ArrayRef<MeasInfo> measInfos,
+                                              ArrayRef<int> uniqueIndices,
+                                              llvm::DenseMap<int, int> &measToGroup,
+                                              const llvm::DenseMap<int, int> &canonicalMeas)
+    {
+        SmallVector<std::optional<llvm::DenseMap<Value, NamedObservable>>> bases;
+        for (int i : uniqueIndices) {
+            bases.push_back(getObservableBases(measInfos[i].obs));
+        }
+
+        SmallVector<SmallVector<int>> adjacency(uniqueIndices.size());
+        for (size_t u = 0; u < uniqueIndices.size(); ++u) {
+            for (size_t v = u + 1; v < uniqueIndices.size(); ++v) {
+                if (!qubitWiseCommute(bases[u], bases[v])) {
+                    adjacency[u].push_back(static_cast<int>(v));
+                    adjacency[v].push_back(static_cast<int>(u));
+                }
+            }
+        }
+
+        SmallVector<int> colours = colourGraph(adjacency);
+        int numGroups = 0;
+        for (auto [u, i] : llvm::enumerate(uniqueIndices)) {
+            measToGroup[i] = colours[u];
+            numGroups = std::max(numGroups, colours[u] + 1);
+        }
+        for (auto [i, canonical] : canonicalMeas) {
+            measToGroup[i] = measToGroup.lookup(canonical);
+        }
+        return numGroups;
+    }
+
     /// Find the measurement index that a return value traces back to.
     /// Returns -1 if not found.
     static int findMeasIdxForReturnValue(Value returnValue)
@@ -391,9 +521,11 @@ struct SplitNonCommutingPass : public impl::SplitNonCommutingPassBase<SplitNonCo
         removeReturnValues(groupFunc, toRemove);
     }
 
-    /// Distribute device shots among group functions by dividing the original shots by the number
-    /// of groups.
-    static void distributeShots(func::FuncOp groupFunc, int numGroups)
+    /// Distribute device shots among group functions. By default the original shots are divided by
+    /// the number of groups, and with a share, the group gets that fraction of the original shots,
+    /// but at least one shot.
+    static void distributeShots(func::FuncOp groupFunc, int numGroups,
+                                std::optional<double> shotShare)
     {
         // Find the DeviceInitOp in the group function
         DeviceInitOp deviceOp = nullptr;
@@ -418,10 +550,24 @@ struct SplitNonCommutingPass : public impl::SplitNonCommutingPassBase<SplitNonCo
         // Simplify the shots to a constant if possible
         IntegerAttr intAttr;
         if (matchPattern(shots, m_Constant(&intAttr))) {
-            int64_t dividedVal = intAttr.getValue().getSExtValue() / numGroups;
+            int64_t originalVal = intAttr.getValue().getSExtValue();
+            int64_t dividedVal =
+                shotShare ? std::max<int64_t>(
+                                1, static_cast<int64_t>(std::floor(originalVal * *shotShare)))
+                          : originalVal / numGroups;
             dividedShots =
                 arith::ConstantOp::create(builder, loc, builder.getI64IntegerAttr(dividedVal));
         }
+        else if (shotShare) {
+            Value shareVal =
+                arith::ConstantOp::create(builder, loc, builder.getF64FloatAttr(*shotShare));
+            Value shotsF64 = arith::SIToFPOp::create(builder, loc, builder.getF64Type(), shots);
+            Value scaled = arith::MulFOp::create(builder, loc, shotsF64, shareVal);
+            Value scaledShots = arith::FPToSIOp::create(builder, loc, shots.getType(), scaled);
+            Value one = arith::ConstantOp::create(builder, loc,
+                                                  builder.getIntegerAttr(shots.getType(), 1));
+            dividedShots = arith::MaxSIOp::create(builder, loc, scaledShots, one);
+        }
         else {
             Value numGroupsVal = arith::ConstantOp::create(
                 builder, loc, builder.getI64IntegerAttr(static_cast<int64_t>(numGroups)));
@@ -431,13 +577,114 @@ struct SplitNonCommutingPass : public impl::SplitNonCommutingPassBase<SplitNonCo
         deviceOp.getShotsMutable().assign(dividedShots);
     }
 
+    /// The fraction of the shots each group gets when the shots are distributed in proportion to
+    /// the weights that split-to-single-terms records on the expvals of the Hamiltonian terms with
+    /// constant coefficients, i.e. to the sum of the absolute coefficients each group measures.
+    /// Returns std::nullopt if some measurement has no weight, or all weights are zero.
+    static std::optional<SmallVector<double>>
+    getWeightedShotShares(ArrayRef<MeasInfo> measInfos,
+                          const llvm::DenseMap<int, int> &measToGroup, int numGroups)
+    {
+        SmallVector<double> groupWeights(numGroups, 0.0);
+        double totalWeight = 0.0;
+        for (const MeasInfo &info : measInfos) {
+            auto weightAttr = info.measurementOp->getAttrOfType<FloatAttr>("term_weight");
+            if (!weightAttr) {
+                return std::nullopt;
+            }
+            groupWeights[measToGroup.lookup(info.idx)] += weightAttr.getValueAsDouble();
+            totalWeight += weightAttr.getValueAsDouble();
+        }
+        if (totalWeight <= 0.0) {
+            return std::nullopt;
+        }
+
+        for (double &weight : groupWeights) {
+            weight /= totalWeight;
+        }
+        return groupWeights;
+    }
+
+    /// Rotate the qubits that a group of qubit-wise commuting observables measures in the X, Y or
+    /// Hadamard basis to the computational basis, and measure them in the Z basis instead. Qubits
+    /// that are still used by other operations than their observables, insertion and release are
+    /// left as they are, and are measured in their original basis by the device.
+    static void rotateToComputationalBasis(func::FuncOp groupFunc)
+    {
+        llvm::MapVector<Value, SmallVector<NamedObsOp>> qubitObservables;
+        groupFunc.walk([&](NamedObsOp namedObs) {
+            qubitObservables[namedObs.getQubit()].push_back(namedObs);
+        });
+
+        for (auto &[qubit, namedObsOps] : qubitObservables) {
+            std::optional<NamedObservable> basis;
+            for (NamedObsOp namedObs : namedObsOps) {
+                if (namedObs.getType() != NamedObservable::Identity) {
+                    basis = namedObs.getType();
+                    break;
+                }
+            }
+            if (!basis || *basis == NamedObservable::PauliZ) {
+                continue;
+            }
+            if (llvm::any_of(namedObsOps, [&](NamedObsOp namedObs) {
+                    return namedObs.getType() != NamedObservable::Identity &&
+                           namedObs.getType() != *basis;
+                })) {
+                continue;
+            }
+            if (!llvm::all_of(qubit.getUsers(), [](Operation *user) {
+                    return isa<NamedObsOp, InsertOp, DeallocQubitOp>(user);
+                })) {
+                continue;
+            }
+
+            // The diagonalizing gates of the observables, as in PennyLane
+            OpBuilder builder(groupFunc.getContext());
+            builder.setInsertionPointAfterValue(qubit);
+            Location loc = namedObsOps.front().getLoc();
+            Value rotated = qubit;
+            auto applyGate = [&](StringRef gate, ValueRange params = {}) {
+                rotated = CustomOp::create(builder, loc, gate, ValueRange{rotated}, params)
+                              .getOutQubits()
+                              .front();
+            };
+            switch (*basis) {
+            case NamedObservable::PauliX:
+                applyGate("Hadamard");
+                break;
+            case NamedObservable::PauliY:
+                applyGate("PauliZ");
+                applyGate("S");
+                applyGate("Hadamard");
+                break;
+            case NamedObservable::Hadamard:
+                applyGate("RY", arith::ConstantOp::create(builder, loc,
+                                                          builder.getF64FloatAttr(-M_PI / 4))
+                                    .getResult());
+                break;
+            default:
+                llvm_unreachable("unexpected observable basis");
+            }
+
+            // All other users of the qubit were checked to be measurements or its release
+            qubit.replaceUsesWithIf(rotated,
+                                    [](OpOperand &use) { return !isa<CustomOp>(use.getOwner()); });
+            for (NamedObsOp namedObs : namedObsOps) {
+                if (namedObs.getType() != NamedObservable::Identity) {
+                    namedObs.setType(NamedObservable::PauliZ);
+                }
+            }
+        }
+    }
+
     /// Create a duplicate function for the given group index.
     /// Clones the original function, removes measurements from other groups,
     /// deduplicates measurements within the group, and inserts the new function into the module.
     func::FuncOp createGroupFunction(func::FuncOp funcOp, int groupIdx, int numGroups,
                                      ArrayRef<int> returnValueGroupIds,
                                      const llvm::DenseMap<int, int> &canonicalMeas,
-                                     SymbolTable &modSymTable)
+                                     std::optional<double> shotShare, SymbolTable &modSymTable)
     {
         // clone the entire function
         func::FuncOp groupFunc = funcOp.clone();
@@ -454,7 +701,12 @@ struct SplitNonCommutingPass : public impl::SplitNonCommutingPassBase<SplitNonCo
         deduplicateMeasurements(groupFunc, canonicalMeas);
 
         // Distribute shots among groups
-        distributeShots(groupFunc, numGroups);
+        distributeShots(groupFunc, numGroups, shotShare);
+
+        // Measure the qubit-wise commuting observables of the group in the computational basis
+        if (groupingStrategy == "qwc") {
+            rotateToComputationalBasis(groupFunc);
+        }
 
         return groupFunc;
     }
@@ -583,12 +835,24 @@ struct SplitNonCommutingPass : public impl::SplitNonCommutingPassBase<SplitNonCo
             auto [groupReturnPositions, returnValueGroupIds] =
                 analyzeGroupReturnPositions(funcOp, numGroups, measToGroup, returnValueMeasIds);
 
+            // Distribute the shots by the coefficients of the measured terms, when requested and
+            // known
+            std::optional<SmallVector<double>> shotShares;
+            if (shotDistribution == "coefficients") {
+                shotShares = getWeightedShotShares(measInfos, measToGroup, numGroups);
+            }
+
             // Create a duplicate function for each group
             SymbolTable modSymTable(moduleOp);
             SmallVector<func::FuncOp> groupFunctions;
             for (int i = 0; i < numGroups; ++i) {
-                groupFunctions.push_back(createGroupFunction(
-                    funcOp, i, numGroups, returnValueGroupIds, canonicalMeas, modSymTable));
+                std::optional<double> shotShare;
+                if (shotShares) {
+                    shotShare = (*shotShares)[i];
+                }
+                groupFunctions.push_back(createGroupFunction(funcOp, i, numGroups,
+                                                             returnValueGroupIds, canonicalMeas,
+                                                             shotShare, modSymTable));
             }
 
             // Replace original function body with calls to group functions
@@ -14,6 +14,9 @@
 
 #define DEBUG_TYPE "split-to-single-terms"
 
+#include <cmath>
+#include <optional>
+
 #include "llvm/ADT/DenseMap.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
@@ -21,6 +24,7 @@
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/IRMapping.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/IR/SymbolTable.h"
 #include "mlir/Interfaces/FunctionInterfaces.h"
 #include "mlir/Pass/Pass.h"
@@ -76,6 +80,32 @@ struct SplitToSingleTermsPass : public impl::SplitToSingleTermsPassBase<SplitToS
         }
     }
 
+    /// Recursively collect the coefficient of each leaf observable of a Hamiltonian, in the order
+    /// of collectLeafObservables, when the coefficients of the Hamiltonian and all its parents are
+    /// constant, and std::nullopt otherwise.
+    void collectConstantCoefficients(Value obs, std::optional<double> coeffMultiplier,
+                                     SmallVectorImpl<std::optional<double>> &coefficients)
+    {
+        Operation *defOp = obs.getDefiningOp();
+
+        if (auto hamOp = dyn_cast_or_null<HamiltonianOp>(defOp)) {
+            DenseFPElementsAttr coeffsAttr;
+            bool isConstant = matchPattern(hamOp.getCoeffs(), m_Constant(&coeffsAttr));
+
+            for (auto [i, term] : llvm::enumerate(hamOp.getTerms())) {
+                std::optional<double> coeff;
+                if (coeffMultiplier && isConstant) {
+                    coeff = *coeffMultiplier *
+                            coeffsAttr.getValues<APFloat>()[i].convertToDouble();
+                }
+                collectConstantCoefficients(term, coeff, coefficients);
+            }
+        }
+        else {
+            coefficients.push_back(coeffMultiplier);
+        }
+    }
+
     /// Recursively collect coefficients from Hamiltonian.
     /// This creates coefficient computation operations in the current insertion point
     void buildCoefficientsExpr(Value obs, Value coeffMultiplier, OpBuilder &builder, Location loc,
@@ -284,11 +314,15 @@ struct SplitToSingleTermsPass : public impl::SplitToSingleTermsPassBase<SplitToS
             // Collect leaf observables
             SmallVector<Value> leafObs;
             collectLeafObservables(obs, leafObs);
+            SmallVector<std::optional<double>> leafCoeffs;
+            collectConstantCoefficients(obs, 1.0, leafCoeffs);
 
             // Create individual expvals with from_elements wrappers
             // For Identity observables, use constant 1.0 instead of computing expval
+            // Expvals of terms with constant coefficients record their magnitude as their
+            // weight, for split-non-commuting to distribute the shots by
             SmallVector<Value> newExpvalTensors;
-            for (Value leaf : leafObs) {
+            for (auto [leaf, coeff] : llvm::zip_equal(leafObs, leafCoeffs)) {
                 Value tensor;
                 if (isIdentityObservable(leaf)) {
                     // Identity expval is always 1.0
@@ -299,10 +333,13 @@ struct SplitToSingleTermsPass : public impl::SplitToSingleTermsPassBase<SplitToS
                         ValueRange{one});
                 }
                 else {
-                    Value expval = ExpvalOp::create(builder, loc, builder.getF64Type(), leaf);
+                    auto expval = ExpvalOp::create(builder, loc, builder.getF64Type(), leaf);
+                    if (coeff) {
+                        expval->setAttr("term_weight", builder.getF64FloatAttr(std::abs(*coeff)));
+                    }
                     tensor = tensor::FromElementsOp::create(
                         builder, loc, RankedTensorType::get({}, builder.getF64Type()),
-                        ValueRange{expval});
+                        ValueRange{expval.getResult()});
                 }
                 newExpvalTensors.push_back(tensor);
             }
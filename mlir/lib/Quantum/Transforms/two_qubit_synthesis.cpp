@@ -0,0 +1,382 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Synthesizes the one- and two-qubit unitary ops with a constant matrix, then collects maximal
+// blocks of gates acting on the same pair of qubits, computes their unitary and re-synthesizes it
+// with at most three CNOTs through the KAK decomposition, see
+// https://arxiv.org/abs/quant-ph/0308006 and https://arxiv.org/abs/quant-ph/0507171.
+
+#define DEBUG_TYPE "two-qubit-synthesis"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Interfaces/FunctionInterfaces.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Utils/TwoQubitSynthesis.h"
+
+using namespace llvm;
+using namespace mlir;
+using namespace catalyst::quantum;
+
+namespace {
+
+// A gate of a two-qubit block, with the positions of its qubits in the block
+struct BlockGate {
+    CustomOp op;
+    SmallVector<unsigned, 2> wires;
+};
+
+// A maximal block of gates acting on two qubits, in time order
+struct TwoQubitBlock {
+    SmallVector<BlockGate> gates;
+    Value inputs[2];
+    Value outputs[2];
+};
+
+std::optional<std::vector<double>> getConstantParams(CustomOp op)
+{
+    std::vector<double> params;
+    for (Value param : op.getParams()) {
+        FloatAttr paramAttr;
+        if (!matchPattern(param, m_Constant(&paramAttr))) {
+            return std::nullopt;
+        }
+        params.push_back(paramAttr.getValueAsDouble());
+    }
+    return params;
+}
+
+bool isSupportedSingleQubitGate(CustomOp op)
+{
+    if (op.getInQubits().size() != 1 || !op.getInCtrlQubits().empty()) {
+        return false;
+    }
+    std::optional<std::vector<double>> params = getConstantParams(op);
+    return params && getSingleQubitGateMatrix(op.getGateName(), *params, op.getAdjoint());
+}
+
+bool isSupportedTwoQubitGate(CustomOp op)
+{
+    if (op.getInQubits().size() != 2 || !op.getInCtrlQubits().empty()) {
+        return false;
+    }
+    std::optional<std::vector<double>> params = getConstantParams(op);
+    return params && getTwoQubitGateMatrix(op.getGateName(), *params, op.getAdjoint());
+}
+
+// Returns the gate that uses the qubit value, if it is its only use and the gate has not been
+// visited yet.
+CustomOp getUniqueUser(Value qubit, Block *block, const DenseSet<Operation *> &visited)
+{
+    if (!qubit.hasOneUse()) {
+        return nullptr;
+    }
+    auto user = dyn_cast<CustomOp>(*qubit.getUsers().begin());
+    if (!user || user->getBlock() != block || visited.contains(user)) {
+        return nullptr;
+    }
+    return user;
+}
+
+TwoQubitBlock collectBlock(CustomOp seed, const DenseSet<Operation *> &visited)
+{
+    Block *block = seed->getBlock();
+    TwoQubitBlock result;
+
+    // Single-qubit gates right before the seed, whose result is only used by the block
+    for (unsigned wire = 0; wire < 2; wire++) {
+        SmallVector<CustomOp> chain;
+        Value qubit = seed.getInQubits()[wire];
+        while (auto producer = qubit.getDefiningOp<CustomOp>()) {
+            if (producer->getBlock() != block || visited.contains(producer) ||
+                !qubit.hasOneUse() || !isSupportedSingleQubitGate(producer)) {
+                break;
+            }
+            chain.push_back(producer);
+            qubit = producer.getInQubits()[0];
+        }
+        result.inputs[wire] = qubit;
+        for (CustomOp op : llvm::reverse(chain)) {
+            result.gates.push_back({op, {wire}});
+        }
+    }
+    result.gates.push_back({seed, {0, 1}});
+
+    // Gates after the seed that only act on the two qubits
+    Value current[2] = {seed.getOutQubits()[0], seed.getOutQubits()[1]};
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (unsigned wire = 0; wire < 2; wire++) {
+            CustomOp user = getUniqueUser(current[wire], block, visited);
+            if (!user) {
+                continue;
+            }
+
+            if (isSupportedSingleQubitGate(user)) {
+                result.gates.push_back({user, {wire}});
+                current[wire] = user.getOutQubits()[0];
+                changed = true;
+                continue;
+            }
+
+            if (isSupportedTwoQubitGate(user) &&
+                getUniqueUser(current[1 - wire], block, visited) == user) {
+                unsigned first = user.getInQubits()[0] == current[0] ? 0 : 1;
+                result.gates.push_back({user, {first, 1 - first}});
+                current[first] = user.getOutQubits()[0];
+                current[1 - first] = user.getOutQubits()[1];
+                changed = true;
+            }
+        }
+    }
+
+    result.outputs[0] = current[0];
+    result.outputs[1] = current[1];
+    return result;
+}
+
+Matrix4 computeBlockUnitary(const TwoQubitBlock &block)
+{
+    const Matrix4 swap = *getTwoQubitGateMatrix("SWAP", {}, false);
+    Matrix4 unitary = embedSingleQubitGate(*getSingleQubitGateMatrix("Identity", {}, false), 0);
+
+    for (const BlockGate &gate : block.gates) {
+        CustomOp op = gate.op;
+        std::vector<double> params = *getConstantParams(op);
+        StringRef name = op.getGateName();
+        Matrix4 matrix;
+        if (gate.wires.size() == 1) {
+            matrix = embedSingleQubitGate(*getSingleQubitGateMatrix(name, params, op.getAdjoint()),
+                                          gate.wires[0]);
+        }
+        else {
+            matrix = *getTwoQubitGateMatrix(name, params, op.getAdjoint());
+            if (gate.wires[0] == 1) {
+                matrix = multiply(swap, multiply(matrix, swap));
+            }
+        }
+        unitary = multiply(matrix, unitary);
+    }
+    return unitary;
+}
+
+// Costs are compared by number of CNOTs first, and by number of gates second.
+std::pair<unsigned, size_t> getBlockCost(const TwoQubitBlock &block)
+{
+    unsigned numCNOTs = 0;
+    for (const BlockGate &gate : block.gates) {
+        if (gate.wires.size() == 2) {
+            numCNOTs += getTwoQubitGateCNOTCount(gate.op.getGateName());
+        }
+    }
+    return {numCNOTs, block.gates.size()};
+}
+
+// Creates the gates of the circuit on the input qubits at the insertion point of the rewriter, and
+// returns the output qubits.
+SmallVector<Value, 2> createCircuit(const TwoQubitCircuit &circuit, ValueRange inputs,
+                                    Location loc, IRRewriter &rewriter)
+{
+    SmallVector<Value, 2> current(inputs.begin(), inputs.end());
+    for (const SynthesizedGate &gate : circuit.gates) {
+        if (gate.kind == SynthesizedGate::Kind::CNOT) {
+            auto cnot = CustomOp::create(rewriter, loc, "CNOT",
+                                         ValueRange{current[gate.wire], current[1 - gate.wire]});
+            current[gate.wire] = cnot.getOutQubits()[0];
+            current[1 - gate.wire] = cnot.getOutQubits()[1];
+            continue;
+        }
+
+        StringRef name = gate.kind == SynthesizedGate::Kind::RZ ? "RZ" : "RY";
+        Value angle =
+            arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(gate.angle));
+        auto rotation = CustomOp::create(rewriter, loc, name, ValueRange{current[gate.wire]},
+                                         ValueRange{angle});
+        current[gate.wire] = rotation.getOutQubits()[0];
+    }
+
+    // The circuit is exp(i phase) times its gates, and GlobalPhase(phi) = exp(-i phi)
+    if (circuit.phase != 0) {
+        Value phase =
+            arith::ConstantOp::create(rewriter, loc, rewriter.getF64FloatAttr(-circuit.phase));
+        NamedAttrList gphaseAttrs;
+        gphaseAttrs.append(
+            rewriter.getNamedAttr("operandSegmentSizes", rewriter.getDenseI32ArrayAttr({1, 0, 0})));
+        GlobalPhaseOp::create(rewriter, loc, TypeRange{}, ValueRange{phase},
+                              gphaseAttrs.getAttrs());
+    }
+    return current;
+}
+
+void replaceBlock(const TwoQubitBlock &block, CustomOp seed, const TwoQubitCircuit &circuit,
+                  IRRewriter &rewriter)
+{
+    rewriter.setInsertionPoint(seed);
+    SmallVector<Value, 2> current = createCircuit(
+        circuit, ValueRange{block.inputs[0], block.inputs[1]}, seed.getLoc(), rewriter);
+
+    rewriter.replaceAllUsesWith(block.outputs[0], current[0]);
+    rewriter.replaceAllUsesWith(block.outputs[1], current[1]);
+    for (const BlockGate &gate : llvm::reverse(block.gates)) {
+        rewriter.eraseOp(gate.op);
+    }
+}
+
+// Returns the constant matrix of a unitary op without controls.
+DenseElementsAttr getConstantMatrix(QubitUnitaryOp op)
+{
+    DenseElementsAttr matrixAttr;
+    if (!op.getInCtrlQubits().empty() || !matchPattern(op.getMatrix(), m_Constant(&matrixAttr))) {
+        return nullptr;
+    }
+    return matrixAttr;
+}
+
+std::optional<TwoQubitCircuit> synthesizeConstantMatrix(DenseElementsAttr matrixAttr, bool adjoint)
+{
+    auto values = matrixAttr.tryGetValues<std::complex<double>>();
+    if (failed(values)) {
+        return std::nullopt;
+    }
+    std::vector<Complex> matrix(values->begin(), values->end());
+    size_t dim = matrix.size() == 4 ? 2 : 4;
+    if (adjoint) {
+        std::vector<Complex> transposed(matrix.size());
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                transposed[col * dim + row] = std::conj(matrix[row * dim + col]);
+            }
+        }
+        matrix = std::move(transposed);
+    }
+
+    if (matrix.size() == 4) {
+        Matrix2 unitary;
+        std::copy(matrix.begin(), matrix.end(), unitary.begin());
+        return synthesizeSingleQubitUnitary(unitary);
+    }
+    Matrix4 unitary;
+    std::copy(matrix.begin(), matrix.end(), unitary.begin());
+    return synthesizeTwoQubitUnitary(unitary);
+}
+
+// Replaces the one- and two-qubit unitary ops with a constant matrix with their synthesized
+// circuit, so that the later passes can act on its gates, and so that the device doesn't apply a
+// dense matrix at run time.
+void synthesizeConstantUnitaries(FunctionOpInterface func)
+{
+    IRRewriter rewriter(func->getContext());
+
+    // The synthesized circuits of the matrices, and of their adjoint. Attributes are uniqued by
+    // content, so that identical matrices are only synthesized once.
+    DenseMap<Attribute, std::optional<TwoQubitCircuit>> cache[2];
+
+    SmallVector<QubitUnitaryOp> unitaries;
+    func->walk([&](QubitUnitaryOp op) { unitaries.push_back(op); });
+    for (QubitUnitaryOp op : unitaries) {
+        DenseElementsAttr matrixAttr = getConstantMatrix(op);
+        size_t numQubits = op.getInQubits().size();
+        if (!matrixAttr || numQubits < 1 || numQubits > 2 ||
+            matrixAttr.getNumElements() != static_cast<int64_t>(1 << (2 * numQubits))) {
+            continue;
+        }
+
+        auto [it, inserted] = cache[op.getAdjoint()].try_emplace(matrixAttr);
+        if (inserted) {
+            it->second = synthesizeConstantMatrix(matrixAttr, op.getAdjoint());
+        }
+        if (!it->second) {
+            LLVM_DEBUG(dbgs() << "failed to synthesize the matrix of " << op << "\n");
+            continue;
+        }
+
+        rewriter.setInsertionPoint(op);
+        SmallVector<Value, 2> outputs =
+            createCircuit(*it->second, op.getInQubits(), op.getLoc(), rewriter);
+        rewriter.replaceOp(op, outputs);
+    }
+}
+
+void synthesizeTwoQubitBlocks(FunctionOpInterface func)
+{
+    IRRewriter rewriter(func->getContext());
+
+    SmallVector<CustomOp> seeds;
+    func->walk([&](CustomOp op) {
+        if (isSupportedTwoQubitGate(op)) {
+            seeds.push_back(op);
+        }
+    });
+
+    DenseSet<Operation *> visited;
+    for (CustomOp seed : seeds) {
+        if (visited.contains(seed)) {
+            continue;
+        }
+
+        TwoQubitBlock block = collectBlock(seed, visited);
+        for (const BlockGate &gate : block.gates) {
+            visited.insert(gate.op);
+        }
+
+        std::optional<TwoQubitCircuit> circuit =
+            synthesizeTwoQubitUnitary(computeBlockUnitary(block));
+        if (!circuit) {
+            LLVM_DEBUG(dbgs() << "failed to synthesize the block of " << seed << "\n");
+            continue;
+        }
+
+        std::pair<unsigned, size_t> oldCost = getBlockCost(block);
+        std::pair<unsigned, size_t> newCost = {circuit->numCNOTs, circuit->gates.size()};
+        if (newCost >= oldCost) {
+            continue;
+        }
+
+        LLVM_DEBUG(dbgs() << "replacing a block of " << oldCost.second << " gates and "
+                          << oldCost.first << " CNOTs with " << newCost.second << " gates and "
+                          << newCost.first << " CNOTs\n");
+        replaceBlock(block, seed, *circuit, rewriter);
+    }
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DECL_TWOQUBITSYNTHESISPASS
+#define GEN_PASS_DEF_TWOQUBITSYNTHESISPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct TwoQubitSynthesisPass : public impl::TwoQubitSynthesisPassBase<TwoQubitSynthesisPass> {
+    using impl::TwoQubitSynthesisPassBase<TwoQubitSynthesisPass>::TwoQubitSynthesisPassBase;
+
+    void runOnOperation() override
+    {
+        getOperation()->walk([](FunctionOpInterface func) {
+            synthesizeConstantUnitaries(func);
+            synthesizeTwoQubitBlocks(func);
+        });
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,173 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "unroll-quantum-loops"
+
+#include <optional>
+
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/SCF/Utils/Utils.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "mlir/Transforms/RegionUtils.h"
+
+#include "Quantum/IR/QuantumInterfaces.h"
+#include "Quantum/Transforms/Passes.h"
+#include "Quantum/Transforms/Patterns.h"
+
+using llvm::dbgs;
+using namespace mlir;
+using namespace catalyst::quantum;
+
+namespace {
+
+/// The number of iterations of a loop with constant bounds.
+std::optional<int64_t> getConstantTripCount(scf::ForOp forOp)
+{
+    std::optional<int64_t> lb = getConstantIntValue(forOp.getLowerBound());
+    std::optional<int64_t> ub = getConstantIntValue(forOp.getUpperBound());
+    std::optional<int64_t> step = getConstantIntValue(forOp.getStep());
+    if (!lb || !ub || !step || *step <= 0) {
+        return std::nullopt;
+    }
+    return *ub > *lb ? (*ub - *lb + *step - 1) / *step : 0;
+}
+
+/// The number of gates a block applies, counting the gates of nested loops with constant bounds
+/// once per iteration, and the gates of both branches of conditionals.
+int64_t countGates(Block &block)
+{
+    int64_t count = 0;
+    for (Operation &op : block) {
+        if (isa<QuantumGate>(op)) {
+            count++;
+        }
+        int64_t nestedCount = 0;
+        for (Region &region : op.getRegions()) {
+            for (Block &nestedBlock : region) {
+                nestedCount += countGates(nestedBlock);
+            }
+        }
+        if (auto forOp = dyn_cast<scf::ForOp>(op)) {
+            nestedCount *= getConstantTripCount(forOp).value_or(1);
+        }
+        count += nestedCount;
+    }
+    return count;
+}
+
+/// The number of gates of a loop once fully unrolled, after cancelling and merging the gates of
+/// consecutive iterations.
+///
+/// The loop is unrolled in a detached function, whose arguments stand for the values the loop uses
+/// from above but constants, so that the patterns never reach the gates around the loop.
+std::optional<int64_t> countUnrolledGates(scf::ForOp forOp, const FrozenRewritePatternSet &patterns)
+{
+    llvm::SetVector<Value> usedValues(forOp->operand_begin(), forOp->operand_end());
+    getUsedValuesDefinedAbove(forOp.getRegion(), usedValues);
+
+    auto isConstant = [](Value value) {
+        Operation *definingOp = value.getDefiningOp();
+        return definingOp && definingOp->hasTrait<OpTrait::ConstantLike>();
+    };
+    SmallVector<Value> arguments;
+    SmallVector<Type> argumentTypes;
+    for (Value value : usedValues) {
+        if (!isConstant(value)) {
+            arguments.push_back(value);
+            argumentTypes.push_back(value.getType());
+        }
+    }
+
+    OpBuilder builder(forOp.getContext());
+    FunctionType funcType = builder.getFunctionType(argumentTypes, forOp.getResultTypes());
+    auto funcOp = func::FuncOp::create(forOp.getLoc(), "unrolled_loop", funcType);
+    Block *entryBlock = funcOp.addEntryBlock();
+    builder.setInsertionPointToStart(entryBlock);
+
+    IRMapping mapping;
+    mapping.map(arguments, entryBlock->getArguments());
+    for (Value value : usedValues) {
+        if (isConstant(value)) {
+            mapping.map(value, builder.clone(*value.getDefiningOp())->getResult(0));
+        }
+    }
+    auto copy = cast<scf::ForOp>(builder.clone(*forOp, mapping));
+    func::ReturnOp::create(builder, forOp.getLoc(), copy.getResults());
+
+    std::optional<int64_t> gateCount;
+    if (succeeded(loopUnrollFull(copy))) {
+        (void)applyPatternsGreedily(funcOp.getBody(), patterns);
+        gateCount = countGates(*entryBlock);
+    }
+    funcOp.erase();
+    return gateCount;
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+#define GEN_PASS_DEF_UNROLLQUANTUMLOOPSPASS
+#include "Quantum/Transforms/Passes.h.inc"
+
+struct UnrollQuantumLoopsPass : impl::UnrollQuantumLoopsPassBase<UnrollQuantumLoopsPass> {
+    using UnrollQuantumLoopsPassBase::UnrollQuantumLoopsPassBase;
+
+    void runOnOperation() final
+    {
+        RewritePatternSet patternSet(&getContext());
+        populateCancelInversesPatterns(patternSet);
+        populateMergeRotationsPatterns(patternSet);
+        FrozenRewritePatternSet patterns(std::move(patternSet));
+
+        // Inner loops are visited first, so that outer loops are costed with the inner loops
+        // that were unrolled
+        SmallVector<scf::ForOp> forOps;
+        getOperation()->walk([&](scf::ForOp forOp) { forOps.push_back(forOp); });
+
+        for (scf::ForOp forOp : forOps) {
+            std::optional<int64_t> tripCount = getConstantTripCount(forOp);
+            if (!tripCount || *tripCount < 2 || *tripCount > maxTripCount) {
+                continue;
+            }
+            const int64_t rolledGates = countGates(*forOp.getBody()) * *tripCount;
+            if (rolledGates == 0 || rolledGates > maxUnrolledGates) {
+                continue;
+            }
+
+            std::optional<int64_t> unrolledGates = countUnrolledGates(forOp, patterns);
+            if (!unrolledGates) {
+                continue;
+            }
+            LLVM_DEBUG(dbgs() << "loop of " << rolledGates << " gates has " << *unrolledGates
+                              << " gates when unrolled\n");
+
+            const double savedGates = static_cast<double>(rolledGates - *unrolledGates);
+            if (savedGates >= 1 && savedGates >= minGateReduction * rolledGates) {
+                (void)loopUnrollFull(forOp);
+            }
+        }
+    }
+};
+
+} // namespace quantum
+} // namespace catalyst
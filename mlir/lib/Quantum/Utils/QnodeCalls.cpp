@@ -0,0 +1,142 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Quantum/Utils/QnodeCalls.h"
+
+#include "mlir/IR/Matchers.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+
+#include "Catalyst/IR/CatalystOps.h"
+#include "Catalyst/Utils/CallGraph.h"
+#include "Quantum/IR/QuantumDialect.h"
+#include "Quantum/IR/QuantumOps.h"
+
+using namespace mlir;
+
+namespace catalyst {
+namespace quantum {
+
+static constexpr llvm::StringRef quantumNodeAttr = "quantum.node";
+static constexpr llvm::StringRef legacyQNodeAttr = "qnode";
+
+static bool isQnode(func::FuncOp funcOp)
+{
+    return funcOp->hasAttrOfType<UnitAttr>(quantumNodeAttr) ||
+           funcOp->hasAttrOfType<UnitAttr>(legacyQNodeAttr);
+}
+
+SmallVector<func::FuncOp> getQnodes(ModuleOp mod)
+{
+    SmallVector<func::FuncOp> qnodes;
+    auto collectQnodes = [&](ModuleOp table) {
+        for (auto funcOp : table.getOps<func::FuncOp>()) {
+            if (isQnode(funcOp)) {
+                qnodes.push_back(funcOp);
+            }
+        }
+    };
+    collectQnodes(mod);
+    for (auto nestedMod : mod.getOps<ModuleOp>()) {
+        collectQnodes(nestedMod);
+    }
+    return qnodes;
+}
+
+std::optional<SmallVector<CallOpInterface>> getQnodeCalls(func::FuncOp funcOp, ModuleOp mod)
+{
+    // The qnode of a nested module is public, so that it can be launched from `mod`
+    bool isKernel = funcOp->getParentOp() != mod.getOperation();
+    if (!isQnode(funcOp) || funcOp.isExternal() || (funcOp.isPublic() && !isKernel)) {
+        return std::nullopt;
+    }
+    std::optional<SymbolTable::UseRange> uses = SymbolTable::getSymbolUses(funcOp, mod);
+    if (!uses) {
+        return std::nullopt;
+    }
+    SmallVector<CallOpInterface> calls;
+    for (const SymbolTable::SymbolUse &use : *uses) {
+        Operation *user = use.getUser();
+        if (!isa<func::CallOp, LaunchKernelOp>(user)) {
+            return std::nullopt;
+        }
+        calls.push_back(cast<CallOpInterface>(user));
+    }
+    return calls;
+}
+
+CallOpInterface createQnodeCall(OpBuilder &builder, CallOpInterface callOp, func::FuncOp funcOp,
+                                ValueRange operands)
+{
+    Operation *newCallOp;
+    if (auto launchOp = dyn_cast<LaunchKernelOp>(callOp.getOperation())) {
+        auto callee = SymbolRefAttr::get(launchOp.getCalleeModuleName(),
+                                         {FlatSymbolRefAttr::get(funcOp.getSymNameAttr())});
+        newCallOp = LaunchKernelOp::create(builder, callOp.getLoc(), funcOp.getResultTypes(),
+                                           callee, operands, /*arg_attrs=*/nullptr,
+                                           /*res_attrs=*/nullptr);
+    }
+    else {
+        newCallOp = func::CallOp::create(builder, callOp.getLoc(), funcOp, operands);
+    }
+    newCallOp->setDiscardableAttrs(callOp->getDiscardableAttrDictionary());
+    return cast<CallOpInterface>(newCallOp);
+}
+
+bool hasOnlyQuantumEffects(func::FuncOp funcOp)
+{
+    bool onlyQuantum = true;
+    traverseCallGraph(funcOp, /*symbolTable=*/nullptr, [&](func::FuncOp callee) {
+        if (callee.isExternal()) {
+            onlyQuantum = false;
+            return;
+        }
+        callee.walk([&](Operation *op) {
+            if (isa<QuantumDialect>(op->getDialect()) || isa<func::CallOp>(op) ||
+                op->hasTrait<OpTrait::HasRecursiveMemoryEffects>() || isMemoryEffectFree(op)) {
+                return WalkResult::advance();
+            }
+            onlyQuantum = false;
+            return WalkResult::interrupt();
+        });
+    });
+    return onlyQuantum;
+}
+
+bool isDeterministicQnode(func::FuncOp funcOp)
+{
+    if (!hasOnlyQuantumEffects(funcOp)) {
+        return false;
+    }
+    bool deterministic = true;
+    traverseCallGraph(funcOp, /*symbolTable=*/nullptr, [&](func::FuncOp callee) {
+        callee.walk([&](Operation *op) {
+            if (auto deviceOp = dyn_cast<DeviceInitOp>(op)) {
+                Value shots = deviceOp.getShots();
+                if (!shots || matchPattern(shots, m_Zero())) {
+                    return WalkResult::advance();
+                }
+            }
+            else if (!isa<MeasureOp>(op)) {
+                return WalkResult::advance();
+            }
+            deterministic = false;
+            return WalkResult::interrupt();
+        });
+    });
+    return deterministic;
+}
+
+} // namespace quantum
+} // namespace catalyst
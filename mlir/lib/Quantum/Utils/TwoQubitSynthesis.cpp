@@ -0,0 +1,812 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Quantum/Utils/TwoQubitSynthesis.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+using namespace catalyst::quantum;
+
+constexpr double PI = 3.14159265358979323846;
+constexpr Complex I_UNIT{0, 1};
+
+// Tolerance of the intermediate numerical steps, which are well conditioned for unitary inputs
+constexpr double NUMERIC_TOL = 1e-7;
+
+using RealMatrix4 = std::array<double, 16>;
+
+//===----------------------------------------------------------------------===//
+// Small matrix helpers
+//===----------------------------------------------------------------------===//
+
+Matrix2 multiply2(const Matrix2 &lhs, const Matrix2 &rhs)
+{
+    return {lhs[0] * rhs[0] + lhs[1] * rhs[2], lhs[0] * rhs[1] + lhs[1] * rhs[3],
+            lhs[2] * rhs[0] + lhs[3] * rhs[2], lhs[2] * rhs[1] + lhs[3] * rhs[3]};
+}
+
+Matrix2 adjoint2(const Matrix2 &m)
+{
+    return {std::conj(m[0]), std::conj(m[2]), std::conj(m[1]), std::conj(m[3])};
+}
+
+Matrix4 adjoint4(const Matrix4 &m)
+{
+    Matrix4 result;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            result[i * 4 + j] = std::conj(m[j * 4 + i]);
+        }
+    }
+    return result;
+}
+
+Matrix4 transpose4(const Matrix4 &m)
+{
+    Matrix4 result;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            result[i * 4 + j] = m[j * 4 + i];
+        }
+    }
+    return result;
+}
+
+Matrix4 identity4()
+{
+    Matrix4 result{};
+    for (int i = 0; i < 4; i++) {
+        result[i * 4 + i] = 1;
+    }
+    return result;
+}
+
+Matrix4 kron(const Matrix2 &a, const Matrix2 &b)
+{
+    Matrix4 result;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            result[i * 4 + j] = a[(i / 2) * 2 + j / 2] * b[(i % 2) * 2 + j % 2];
+        }
+    }
+    return result;
+}
+
+Matrix4 scale(const Matrix4 &m, Complex factor)
+{
+    Matrix4 result;
+    std::transform(m.begin(), m.end(), result.begin(), [&](Complex v) { return v * factor; });
+    return result;
+}
+
+Complex trace(const Matrix4 &m) { return m[0] + m[5] + m[10] + m[15]; }
+
+double distance(const Matrix4 &lhs, const Matrix4 &rhs)
+{
+    double result = 0;
+    for (int i = 0; i < 16; i++) {
+        result += std::norm(lhs[i] - rhs[i]);
+    }
+    return std::sqrt(result);
+}
+
+Complex determinant4(Matrix4 m)
+{
+    // Gaussian elimination with partial pivoting
+    Complex det = 1;
+    for (int col = 0; col < 4; col++) {
+        int pivot = col;
+        for (int row = col + 1; row < 4; row++) {
+            if (std::abs(m[row * 4 + col]) > std::abs(m[pivot * 4 + col])) {
+                pivot = row;
+            }
+        }
+        if (std::abs(m[pivot * 4 + col]) == 0) {
+            return 0;
+        }
+        if (pivot != col) {
+            for (int k = 0; k < 4; k++) {
+                std::swap(m[col * 4 + k], m[pivot * 4 + k]);
+            }
+            det = -det;
+        }
+        det *= m[col * 4 + col];
+        for (int row = col + 1; row < 4; row++) {
+            Complex factor = m[row * 4 + col] / m[col * 4 + col];
+            for (int k = col; k < 4; k++) {
+                m[row * 4 + k] -= factor * m[col * 4 + k];
+            }
+        }
+    }
+    return det;
+}
+
+bool isUnitary(const Matrix4 &m, double tolerance)
+{
+    return distance(multiply(adjoint4(m), m), identity4()) < tolerance;
+}
+
+//===----------------------------------------------------------------------===//
+// Gate matrices
+//===----------------------------------------------------------------------===//
+
+const Matrix2 PAULI_X{0, 1, 1, 0};
+const Matrix2 PAULI_Y{0, -I_UNIT, I_UNIT, 0};
+const Matrix2 PAULI_Z{1, 0, 0, -1};
+const Matrix2 IDENTITY2{1, 0, 0, 1};
+
+Matrix2 rx(double theta)
+{
+    double c = std::cos(theta / 2), s = std::sin(theta / 2);
+    return {c, -I_UNIT * s, -I_UNIT * s, c};
+}
+
+Matrix2 ry(double theta)
+{
+    double c = std::cos(theta / 2), s = std::sin(theta / 2);
+    return {c, -s, s, c};
+}
+
+Matrix2 rz(double theta)
+{
+    return {std::exp(-I_UNIT * (theta / 2)), 0, 0, std::exp(I_UNIT * (theta / 2))};
+}
+
+Matrix4 controlled(const Matrix2 &target)
+{
+    Matrix4 result = identity4();
+    result[10] = target[0];
+    result[11] = target[1];
+    result[14] = target[2];
+    result[15] = target[3];
+    return result;
+}
+
+// Returns exp(-i theta/2 P) for an involutory two-qubit Pauli product P.
+Matrix4 pauliRotation(const Matrix4 &pauli, double theta)
+{
+    Matrix4 result = scale(identity4(), std::cos(theta / 2));
+    for (int i = 0; i < 16; i++) {
+        result[i] += -I_UNIT * std::sin(theta / 2) * pauli[i];
+    }
+    return result;
+}
+
+Matrix4 cnot(unsigned control)
+{
+    Matrix4 result{};
+    for (int basis = 0; basis < 4; basis++) {
+        int q0 = basis >> 1, q1 = basis & 1;
+        if (control == 0) {
+            q1 ^= q0;
+        }
+        else {
+            q0 ^= q1;
+        }
+        result[(q0 * 2 + q1) * 4 + basis] = 1;
+    }
+    return result;
+}
+
+//===----------------------------------------------------------------------===//
+// KAK decomposition
+//===----------------------------------------------------------------------===//
+
+// The magic basis, in which local SU(2) x SU(2) gates are real orthogonal matrices and the
+// canonical gates exp(i(a XX + b YY + c ZZ)) are diagonal.
+Matrix4 magicBasis()
+{
+    const double r = 1 / std::sqrt(2.0);
+    return {r, 0, 0, I_UNIT * r, 0, I_UNIT * r, r, 0, 0, I_UNIT * r, -r, 0, r, 0, 0, -I_UNIT * r};
+}
+
+// Diagonalizes the real symmetric matrix `m` with the cyclic Jacobi method. Returns the orthogonal
+// matrix whose columns are the eigenvectors.
+RealMatrix4 jacobiEigenvectors(RealMatrix4 m)
+{
+    RealMatrix4 v{};
+    for (int i = 0; i < 4; i++) {
+        v[i * 4 + i] = 1;
+    }
+
+    for (int sweep = 0; sweep < 64; sweep++) {
+        double offDiagonal = 0;
+        for (int p = 0; p < 4; p++) {
+            for (int q = p + 1; q < 4; q++) {
+                offDiagonal += m[p * 4 + q] * m[p * 4 + q];
+            }
+        }
+        if (offDiagonal < 1e-30) {
+            break;
+        }
+
+        for (int p = 0; p < 4; p++) {
+            for (int q = p + 1; q < 4; q++) {
+                double apq = m[p * 4 + q];
+                if (std::abs(apq) < 1e-300) {
+                    continue;
+                }
+                double tau = (m[q * 4 + q] - m[p * 4 + p]) / (2 * apq);
+                double t = (tau >= 0 ? 1 : -1) / (std::abs(tau) + std::sqrt(1 + tau * tau));
+                double c = 1 / std::sqrt(1 + t * t), s = t * c;
+
+                for (int k = 0; k < 4; k++) {
+                    double mkp = m[k * 4 + p], mkq = m[k * 4 + q];
+                    m[k * 4 + p] = c * mkp - s * mkq;
+                    m[k * 4 + q] = s * mkp + c * mkq;
+                }
+                for (int k = 0; k < 4; k++) {
+                    double mpk = m[p * 4 + k], mqk = m[q * 4 + k];
+                    m[p * 4 + k] = c * mpk - s * mqk;
+                    m[q * 4 + k] = s * mpk + c * mqk;
+                }
+                for (int k = 0; k < 4; k++) {
+                    double vkp = v[k * 4 + p], vkq = v[k * 4 + q];
+                    v[k * 4 + p] = c * vkp - s * vkq;
+                    v[k * 4 + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+    return v;
+}
+
+// Finds a real orthogonal matrix with unit determinant that diagonalizes the complex symmetric
+// unitary `m`. Its real and imaginary parts are commuting real symmetric matrices, which are
+// simultaneously diagonalized through a generic linear combination of the two.
+std::optional<Matrix4> diagonalizeSymmetricUnitary(const Matrix4 &m)
+{
+    for (double angle : {0.4273, 1.1309, 2.0671, 2.7517, 0.8861, 1.6103}) {
+        RealMatrix4 combination;
+        for (int i = 0; i < 16; i++) {
+            combination[i] = std::cos(angle) * m[i].real() + std::sin(angle) * m[i].imag();
+        }
+        RealMatrix4 p = jacobiEigenvectors(combination);
+
+        Matrix4 pc;
+        std::copy(p.begin(), p.end(), pc.begin());
+        if (determinant4(pc).real() < 0) {
+            for (int k = 0; k < 4; k++) {
+                pc[k * 4] = -pc[k * 4];
+            }
+        }
+
+        Matrix4 diagonal = multiply(transpose4(pc), multiply(m, pc));
+        double offDiagonal = 0;
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                if (i != j) {
+                    offDiagonal += std::norm(diagonal[i * 4 + j]);
+                }
+            }
+        }
+        if (std::sqrt(offDiagonal) < NUMERIC_TOL) {
+            return pc;
+        }
+    }
+    return std::nullopt;
+}
+
+// The KAK decomposition U = exp(i phase) K1 exp(i(a XX + b YY + c ZZ)) K2, with K1 and K2 in
+// SU(2) x SU(2).
+struct KAKDecomposition {
+    Matrix4 k1, k2;
+    std::array<double, 3> coordinates;
+    double phase;
+};
+
+std::optional<KAKDecomposition> computeKAK(const Matrix4 &u)
+{
+    Complex det = determinant4(u);
+    double phase = std::arg(det) / 4;
+    Matrix4 special = scale(u, std::exp(-I_UNIT * phase));
+
+    Matrix4 magic = magicBasis();
+    Matrix4 magicAdj = adjoint4(magic);
+    Matrix4 up = multiply(magicAdj, multiply(special, magic));
+
+    std::optional<Matrix4> p = diagonalizeSymmetricUnitary(multiply(transpose4(up), up));
+    if (!p) {
+        return std::nullopt;
+    }
+    Matrix4 diagonal = multiply(transpose4(*p), multiply(multiply(transpose4(up), up), *p));
+
+    // up = k1m diag(exp(i eps)) k2m with k2m = p^T and k1m real orthogonal
+    std::array<double, 4> eps;
+    for (int k = 0; k < 4; k++) {
+        eps[k] = std::arg(diagonal[k * 4 + k]) / 2;
+    }
+    auto buildK1 = [&]() {
+        Matrix4 k1m = multiply(up, *p);
+        for (int row = 0; row < 4; row++) {
+            for (int k = 0; k < 4; k++) {
+                k1m[row * 4 + k] *= std::exp(-I_UNIT * eps[k]);
+            }
+        }
+        return k1m;
+    };
+    Matrix4 k1m = buildK1();
+    if (determinant4(k1m).real() < 0) {
+        eps[0] += PI;
+        k1m = buildK1();
+    }
+
+    KAKDecomposition result;
+    result.k1 = multiply(magic, multiply(k1m, magicAdj));
+    result.k2 = multiply(magic, multiply(transpose4(*p), magicAdj));
+
+    // Project eps onto the diagonals of XX, YY and ZZ in the magic basis, which together with the
+    // identity form an orthogonal basis of R^4.
+    const Matrix4 paulis[3] = {kron(PAULI_X, PAULI_X), kron(PAULI_Y, PAULI_Y),
+                               kron(PAULI_Z, PAULI_Z)};
+    double offset = 0;
+    for (int k = 0; k < 4; k++) {
+        offset += eps[k] / 4;
+    }
+    for (int axis = 0; axis < 3; axis++) {
+        Matrix4 d = multiply(magicAdj, multiply(paulis[axis], magic));
+        double coordinate = 0;
+        for (int k = 0; k < 4; k++) {
+            coordinate += eps[k] * d[k * 4 + k].real() / 4;
+        }
+        result.coordinates[axis] = coordinate;
+    }
+    result.phase = phase + offset;
+    return result;
+}
+
+//===----------------------------------------------------------------------===//
+// Circuit construction
+//===----------------------------------------------------------------------===//
+
+// A circuit made of alternating local layers and CNOTs: locals[0], cnots[0], locals[1], ...,
+// cnots[n-1], locals[n], in time order.
+struct LayeredCircuit {
+    std::vector<Matrix4> locals;
+    std::vector<unsigned> cnots;
+    double phase = 0;
+};
+
+// Returns a layered circuit equal to exp(i(a XX + b YY + c ZZ)), with coordinates reduced to
+// [-pi/4, pi/4], using the fewest CNOTs.
+LayeredCircuit buildCanonicalCircuit(std::array<double, 3> coordinates, double tolerance)
+{
+    auto isZero = [&](double v) { return std::abs(v) < tolerance; };
+    auto isQuarter = [&](double v) { return std::abs(std::abs(v) - PI / 4) < tolerance; };
+    double a = coordinates[0], b = coordinates[1], c = coordinates[2];
+
+    // Local Clifford conjugations: H x H exchanges XX and ZZ, RX(pi/2) x RX(pi/2) maps ZZ to YY
+    // and S x S maps XX to YY
+    const double r = 1 / std::sqrt(2.0);
+    const Matrix2 h{r, r, r, -r};
+    const Matrix4 hh = kron(h, h);
+    const Matrix4 rxrx = kron(rx(PI / 2), rx(PI / 2));
+    const Matrix4 ss = kron(rz(PI / 2), rz(PI / 2));
+
+    LayeredCircuit circuit;
+    if (isZero(a) && isZero(b) && isZero(c)) {
+        circuit.locals = {identity4()};
+        return circuit;
+    }
+
+    int numZero = isZero(a) + isZero(b) + isZero(c);
+    if (numZero == 2 && (isQuarter(a) || isQuarter(b) || isQuarter(c))) {
+        // exp(i theta ZZ) = exp(-i theta) (RZ(-2 theta) x RZ(-2 theta)) (I x H) CNOT (I x H) for
+        // theta = +-pi/4, conjugated onto the non-zero axis
+        int axis = !isZero(a) ? 0 : (!isZero(b) ? 1 : 2);
+        double theta = coordinates[axis];
+        const Matrix4 conj = axis == 0 ? hh : (axis == 1 ? rxrx : identity4());
+        const Matrix4 conjAdj = adjoint4(conj);
+        Matrix4 ih = kron(IDENTITY2, h);
+        circuit.locals = {multiply(ih, conjAdj),
+                          multiply(conj, multiply(kron(rz(-2 * theta), rz(-2 * theta)), ih))};
+        circuit.cnots = {0};
+        circuit.phase = -theta;
+        return circuit;
+    }
+
+    if (numZero >= 1) {
+        // exp(i(a XX + c ZZ)) = CNOT (RX(-2a) x RZ(-2c)) CNOT, with a zero coordinate moved to the
+        // YY axis by a local Clifford conjugation
+        Matrix4 conj = identity4();
+        double x = a, z = c;
+        if (!isZero(b) && isZero(a)) {
+            conj = ss;
+            x = b;
+        }
+        else if (!isZero(b)) {
+            conj = rxrx;
+            z = b;
+        }
+        circuit.locals = {adjoint4(conj), kron(rx(-2 * x), rz(-2 * z)), conj};
+        circuit.cnots = {0, 0};
+        return circuit;
+    }
+
+    // The three-CNOT circuit of Vatan and Williams (Phys. Rev. A 69, 032315)
+    circuit.locals = {kron(IDENTITY2, rz(-PI / 2)), kron(rz(-PI / 2 - 2 * c), ry(PI / 2 + 2 * a)),
+                      kron(IDENTITY2, ry(-PI / 2 - 2 * b)), kron(rz(PI / 2), IDENTITY2)};
+    circuit.cnots = {1, 0, 1};
+    return circuit;
+}
+
+// Splits a local two-qubit unitary into exp(i phase) A x B. Returns std::nullopt if it is not a
+// tensor product.
+std::optional<std::pair<Matrix2, Matrix2>> splitLocal(const Matrix4 &m, double &phase)
+{
+    auto block = [&](int r, int c) {
+        return Matrix2{m[(2 * r) * 4 + 2 * c], m[(2 * r) * 4 + 2 * c + 1],
+                       m[(2 * r + 1) * 4 + 2 * c], m[(2 * r + 1) * 4 + 2 * c + 1]};
+    };
+    auto normSquared = [](const Matrix2 &b) {
+        return std::norm(b[0]) + std::norm(b[1]) + std::norm(b[2]) + std::norm(b[3]);
+    };
+
+    int bestR = 0, bestC = 0;
+    for (int r = 0; r < 2; r++) {
+        for (int c = 0; c < 2; c++) {
+            if (normSquared(block(r, c)) > normSquared(block(bestR, bestC))) {
+                bestR = r;
+                bestC = c;
+            }
+        }
+    }
+
+    Matrix2 second = block(bestR, bestC);
+    Complex det = second[0] * second[3] - second[1] * second[2];
+    if (std::abs(det) < NUMERIC_TOL) {
+        return std::nullopt;
+    }
+    Complex norm = std::sqrt(det);
+    for (Complex &v : second) {
+        v /= norm;
+    }
+
+    Matrix2 secondAdj = adjoint2(second);
+    Matrix2 first;
+    for (int r = 0; r < 2; r++) {
+        for (int c = 0; c < 2; c++) {
+            Matrix2 product = multiply2(secondAdj, block(r, c));
+            first[r * 2 + c] = (product[0] + product[3]) / 2.0;
+        }
+    }
+
+    // Normalize the first factor to SU(2) as well and move its phase out
+    Complex firstDet = first[0] * first[3] - first[1] * first[2];
+    Complex firstNorm = std::sqrt(firstDet);
+    for (Complex &v : first) {
+        v /= firstNorm;
+    }
+    phase += std::arg(firstNorm);
+
+    if (distance(scale(kron(first, second), firstNorm), m) > NUMERIC_TOL) {
+        return std::nullopt;
+    }
+    return std::make_pair(first, second);
+}
+
+// Appends the rotation to the circuit, dropping it if it is trivial. Angles are reduced to
+// (-pi, pi], using R(theta + 2 pi) = -R(theta).
+void appendRotation(TwoQubitCircuit &circuit, SynthesizedGate::Kind kind, unsigned wire,
+                    double angle, double tolerance)
+{
+    double reduced = std::remainder(angle, 2 * PI);
+    long turns = std::lround((angle - reduced) / (2 * PI));
+    if (turns % 2 != 0) {
+        circuit.phase += PI;
+    }
+    if (std::abs(reduced) < tolerance) {
+        return;
+    }
+    circuit.gates.push_back({kind, wire, reduced});
+}
+
+// Appends a ZYZ decomposition of the SU(2) matrix `m` acting on `wire`:
+// m = RZ(beta) RY(gamma) RZ(delta), up to a sign that is added to the circuit phase.
+void appendSingleQubitGate(TwoQubitCircuit &circuit, const Matrix2 &m, unsigned wire,
+                           double tolerance)
+{
+    double gamma = 2 * std::atan2(std::abs(m[2]), std::abs(m[0]));
+    double sum = 0, difference = 0;
+    if (std::abs(m[0]) > NUMERIC_TOL) {
+        sum = 2 * std::arg(m[3]);
+    }
+    if (std::abs(m[2]) > NUMERIC_TOL) {
+        difference = 2 * std::arg(m[2]);
+    }
+    if (std::abs(m[0]) <= NUMERIC_TOL) {
+        sum = difference;
+    }
+    else if (std::abs(m[2]) <= NUMERIC_TOL) {
+        difference = sum;
+    }
+    double beta = (sum + difference) / 2, delta = (sum - difference) / 2;
+
+    // The decomposition is exact up to a sign
+    Matrix2 rebuilt = multiply2(rz(beta), multiply2(ry(gamma), rz(delta)));
+    Complex overlap = std::conj(rebuilt[0]) * m[0] + std::conj(rebuilt[1]) * m[1] +
+                      std::conj(rebuilt[2]) * m[2] + std::conj(rebuilt[3]) * m[3];
+    if (overlap.real() < 0) {
+        circuit.phase += PI;
+    }
+
+    appendRotation(circuit, SynthesizedGate::Kind::RZ, wire, delta, tolerance);
+    appendRotation(circuit, SynthesizedGate::Kind::RY, wire, gamma, tolerance);
+    appendRotation(circuit, SynthesizedGate::Kind::RZ, wire, beta, tolerance);
+}
+
+Matrix4 evaluate(const TwoQubitCircuit &circuit)
+{
+    Matrix4 result = identity4();
+    for (const SynthesizedGate &gate : circuit.gates) {
+        switch (gate.kind) {
+        case SynthesizedGate::Kind::RZ:
+            result = multiply(embedSingleQubitGate(rz(gate.angle), gate.wire), result);
+            break;
+        case SynthesizedGate::Kind::RY:
+            result = multiply(embedSingleQubitGate(ry(gate.angle), gate.wire), result);
+            break;
+        case SynthesizedGate::Kind::CNOT:
+            result = multiply(cnot(gate.wire), result);
+            break;
+        }
+    }
+    return scale(result, std::exp(I_UNIT * circuit.phase));
+}
+
+} // namespace
+
+namespace catalyst {
+namespace quantum {
+
+Matrix4 multiply(const Matrix4 &lhs, const Matrix4 &rhs)
+{
+    Matrix4 result{};
+    for (int i = 0; i < 4; i++) {
+        for (int k = 0; k < 4; k++) {
+            for (int j = 0; j < 4; j++) {
+                result[i * 4 + j] += lhs[i * 4 + k] * rhs[k * 4 + j];
+            }
+        }
+    }
+    return result;
+}
+
+Matrix4 embedSingleQubitGate(const Matrix2 &gate, unsigned wire)
+{
+    return wire == 0 ? kron(gate, IDENTITY2) : kron(IDENTITY2, gate);
+}
+
+std::optional<Matrix2> getSingleQubitGateMatrix(std::string_view name,
+                                                const std::vector<double> &params, bool adjoint)
+{
+    const double r = 1 / std::sqrt(2.0);
+    std::optional<Matrix2> matrix;
+
+    if (params.empty()) {
+        if (name == "Identity") {
+            matrix = IDENTITY2;
+        }
+        else if (name == "PauliX" || name == "X") {
+            matrix = PAULI_X;
+        }
+        else if (name == "PauliY" || name == "Y") {
+            matrix = PAULI_Y;
+        }
+        else if (name == "PauliZ" || name == "Z") {
+            matrix = PAULI_Z;
+        }
+        else if (name == "Hadamard" || name == "H") {
+            matrix = Matrix2{r, r, r, -r};
+        }
+        else if (name == "S") {
+            matrix = Matrix2{1, 0, 0, I_UNIT};
+        }
+        else if (name == "T") {
+            matrix = Matrix2{1, 0, 0, std::exp(I_UNIT * (PI / 4))};
+        }
+        else if (name == "SX") {
+            matrix = Matrix2{Complex(0.5, 0.5), Complex(0.5, -0.5), Complex(0.5, -0.5),
+                             Complex(0.5, 0.5)};
+        }
+    }
+    else if (params.size() == 1) {
+        if (name == "RX") {
+            matrix = rx(params[0]);
+        }
+        else if (name == "RY") {
+            matrix = ry(params[0]);
+        }
+        else if (name == "RZ") {
+            matrix = rz(params[0]);
+        }
+        else if (name == "PhaseShift") {
+            matrix = Matrix2{1, 0, 0, std::exp(I_UNIT * params[0])};
+        }
+    }
+    else if (params.size() == 3 && name == "Rot") {
+        matrix = multiply2(rz(params[2]), multiply2(ry(params[1]), rz(params[0])));
+    }
+
+    if (matrix && adjoint) {
+        matrix = adjoint2(*matrix);
+    }
+    return matrix;
+}
+
+std::optional<Matrix4> getTwoQubitGateMatrix(std::string_view name,
+                                             const std::vector<double> &params, bool adjoint)
+{
+    std::optional<Matrix4> matrix;
+
+    if (params.empty()) {
+        if (name == "CNOT") {
+            matrix = cnot(0);
+        }
+        else if (name == "CY") {
+            matrix = controlled(PAULI_Y);
+        }
+        else if (name == "CZ") {
+            matrix = controlled(PAULI_Z);
+        }
+        else if (name == "SWAP") {
+            matrix = Matrix4{1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1};
+        }
+        else if (name == "ISWAP") {
+            matrix = Matrix4{1, 0, 0, 0, 0, 0, I_UNIT, 0, 0, I_UNIT, 0, 0, 0, 0, 0, 1};
+        }
+    }
+    else if (params.size() == 1) {
+        double theta = params[0];
+        if (name == "IsingXX") {
+            matrix = pauliRotation(kron(PAULI_X, PAULI_X), theta);
+        }
+        else if (name == "IsingYY") {
+            matrix = pauliRotation(kron(PAULI_Y, PAULI_Y), theta);
+        }
+        else if (name == "IsingZZ") {
+            matrix = pauliRotation(kron(PAULI_Z, PAULI_Z), theta);
+        }
+        else if (name == "IsingXY") {
+            double c = std::cos(theta / 2), s = std::sin(theta / 2);
+            matrix = Matrix4{1, 0, 0, 0, 0, c, I_UNIT * s, 0, 0, I_UNIT * s, c, 0, 0, 0, 0, 1};
+        }
+        else if (name == "CRX") {
+            matrix = controlled(rx(theta));
+        }
+        else if (name == "CRY") {
+            matrix = controlled(ry(theta));
+        }
+        else if (name == "CRZ") {
+            matrix = controlled(rz(theta));
+        }
+        else if (name == "ControlledPhaseShift") {
+            matrix = controlled(Matrix2{1, 0, 0, std::exp(I_UNIT * theta)});
+        }
+    }
+
+    if (matrix && adjoint) {
+        matrix = adjoint4(*matrix);
+    }
+    return matrix;
+}
+
+unsigned getTwoQubitGateCNOTCount(std::string_view name)
+{
+    if (name == "CNOT" || name == "CY" || name == "CZ") {
+        return 1;
+    }
+    if (name == "SWAP") {
+        return 3;
+    }
+    return 2;
+}
+
+std::optional<TwoQubitCircuit> synthesizeSingleQubitUnitary(const Matrix2 &unitary,
+                                                            double tolerance)
+{
+    const Matrix4 embedded = embedSingleQubitGate(unitary, 0);
+    if (!isUnitary(embedded, NUMERIC_TOL)) {
+        return std::nullopt;
+    }
+
+    // Factor the unitary as exp(i phase) times a matrix of SU(2)
+    Complex root = std::sqrt(unitary[0] * unitary[3] - unitary[1] * unitary[2]);
+    Matrix2 special;
+    for (int i = 0; i < 4; i++) {
+        special[i] = unitary[i] / root;
+    }
+
+    TwoQubitCircuit circuit;
+    circuit.phase = std::arg(root);
+    appendSingleQubitGate(circuit, special, 0, tolerance);
+    circuit.phase = std::remainder(circuit.phase, 2 * PI);
+    if (std::abs(circuit.phase) < tolerance) {
+        circuit.phase = 0;
+    }
+
+    if (distance(evaluate(circuit), embedded) > tolerance) {
+        return std::nullopt;
+    }
+    return circuit;
+}
+
+std::optional<TwoQubitCircuit> synthesizeTwoQubitUnitary(const Matrix4 &unitary, double tolerance)
+{
+    if (!isUnitary(unitary, NUMERIC_TOL)) {
+        return std::nullopt;
+    }
+
+    std::optional<KAKDecomposition> kak = computeKAK(unitary);
+    if (!kak) {
+        return std::nullopt;
+    }
+
+    // Reduce the coordinates to [-pi/4, pi/4] using exp(i pi/2 P) = i P for P in {XX, YY, ZZ}.
+    // These factors are local and commute with the canonical gate, so they are folded into K2.
+    const Matrix4 paulis[3] = {kron(PAULI_X, PAULI_X), kron(PAULI_Y, PAULI_Y),
+                               kron(PAULI_Z, PAULI_Z)};
+    Matrix4 k2 = kak->k2;
+    double phase = kak->phase;
+    std::array<double, 3> coordinates = kak->coordinates;
+    for (int axis = 0; axis < 3; axis++) {
+        long shifts = std::lround(coordinates[axis] / (PI / 2));
+        coordinates[axis] -= shifts * (PI / 2);
+        if (shifts % 2 != 0) {
+            k2 = multiply(paulis[axis], k2);
+        }
+        phase += shifts * (PI / 2);
+    }
+
+    LayeredCircuit layered = buildCanonicalCircuit(coordinates, tolerance);
+    layered.locals.front() = multiply(layered.locals.front(), k2);
+    layered.locals.back() = multiply(kak->k1, layered.locals.back());
+    layered.phase += phase;
+
+    TwoQubitCircuit circuit;
+    circuit.phase = layered.phase;
+    circuit.numCNOTs = layered.cnots.size();
+    for (size_t i = 0; i < layered.locals.size(); i++) {
+        auto factors = splitLocal(layered.locals[i], circuit.phase);
+        if (!factors) {
+            return std::nullopt;
+        }
+        appendSingleQubitGate(circuit, factors->first, 0, tolerance);
+        appendSingleQubitGate(circuit, factors->second, 1, tolerance);
+        if (i < layered.cnots.size()) {
+            circuit.gates.push_back({SynthesizedGate::Kind::CNOT, layered.cnots[i], 0});
+        }
+    }
+
+    // The three-CNOT circuit matches the canonical gate only up to a global phase, which is
+    // recovered from the reconstructed matrix.
+    Matrix4 rebuilt = evaluate(circuit);
+    Complex overlap = trace(multiply(adjoint4(rebuilt), unitary)) / 4.0;
+    circuit.phase += std::arg(overlap);
+    circuit.phase = std::remainder(circuit.phase, 2 * PI);
+    if (std::abs(circuit.phase) < tolerance) {
+        circuit.phase = 0;
+    }
+
+    if (distance(evaluate(circuit), unitary) > tolerance) {
+        return std::nullopt;
+    }
+    return circuit;
+}
+
+} // namespace quantum
+} // namespace catalyst
@@ -42,11 +42,14 @@ constexpr StringLiteral delayMu = "delay_mu";
 constexpr StringLiteral rtioOutput = "rtio_output";
 constexpr StringLiteral rtioInit = "rtio_init";
 constexpr StringLiteral rtioGetCounter = "rtio_get_counter";
+constexpr StringLiteral dmaPlayback = "dma_playback";
 constexpr StringLiteral kernel = "__kernel__";
 // ARTIQ RPC runtime
 constexpr StringLiteral rpcSend = "rpc_send";
 constexpr StringLiteral rpcSendAsync = "rpc_send_async";
 constexpr StringLiteral rpcRecv = "rpc_recv";
+// Host-side dispatcher of coalesced async RPCs
+constexpr StringLiteral rpcBatch = "__rtio_rpc_batch";
 } // namespace ARTIQFuncNames
 
 //===----------------------------------------------------------------------===//
@@ -69,6 +72,7 @@ constexpr int32_t spiFlagsReleaseCS = 10; // SPI_CS_POLARITY | SPI_END (CS high
 constexpr int64_t ioUpdatePulseWidth = 8;
 constexpr int64_t refPeriodMu = 8;   // RTIO reference period (Kasli = 8ns @ 125MHz RTIO clock)
 constexpr int64_t minTTLPulseMu = 8; // Minimum TTL pulse duration to avoid 0 duration events
+constexpr int64_t dmaBufferAlignment = 64; // DMA core reads buffers in 64-byte bursts
 } // namespace ARTIQHardwareConfig
 
 //===----------------------------------------------------------------------===//
@@ -80,7 +84,7 @@ class ARTIQRuntimeBuilder {
   public:
     ARTIQRuntimeBuilder(OpBuilder &builder, Operation *contextOp)
         : builder(builder), contextOp(contextOp), ctx(builder.getContext()),
-          i32Ty(IntegerType::get(ctx, 32)), i64Ty(IntegerType::get(ctx, 64)),
+          i1Ty(IntegerType::get(ctx, 1)), i32Ty(IntegerType::get(ctx, 32)), i64Ty(IntegerType::get(ctx, 64)),
           f64Ty(Float64Type::get(ctx)), voidTy(LLVM::LLVMVoidType::get(ctx))
     {
     }
@@ -137,6 +141,17 @@ class ARTIQRuntimeBuilder {
         return call.getResult();
     }
 
+    // DMA playback of a buffer recorded at compile time, offset by `timestamp`
+    // void dma_playback(int64_t timestamp, int32_t ptr, bool uses_ddma)
+    void dmaPlayback(Value timestamp, Value buffer)
+    {
+        auto func = ensureFunc(ARTIQFuncNames::dmaPlayback,
+                               LLVM::LLVMFunctionType::get(voidTy, {i64Ty, i32Ty, i1Ty}));
+        Value ptr = LLVM::PtrToIntOp::create(builder, getLoc(), i32Ty, buffer);
+        Value usesDDMA = arith::ConstantOp::create(builder, getLoc(), builder.getBoolAttr(false));
+        LLVM::CallOp::create(builder, getLoc(), func, ValueRange{timestamp, ptr, usesDDMA});
+    }
+
     // Duration conversion
     Value secToMu(Value durationSec)
     {
@@ -247,7 +262,7 @@ class ARTIQRuntimeBuilder {
     OpBuilder &builder;
     Operation *contextOp;
     MLIRContext *ctx;
-    Type i32Ty, i64Ty, f64Ty, voidTy;
+    Type i1Ty, i32Ty, i64Ty, f64Ty, voidTy;
 
     LLVM::LLVMFuncOp ensureFunc(StringRef name, LLVM::LLVMFunctionType funcTy)
     {
@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <deque>
+#include <cmath>
+#include <optional>
+#include <string>
 
 #include "mlir/Analysis/TopologicalSortUtils.h"
 #include "mlir/Conversion/LLVMCommon/TypeConverter.h"
@@ -23,6 +25,7 @@
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/Matchers.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
@@ -49,22 +52,23 @@ namespace {
 // Type Aliases
 //===----------------------------------------------------------------------===//
 
-using ScheduleGroupsMap = DenseMap<int, llvm::SetVector<Operation *>>;
-using GroupingPredicate =
-    std::function<bool(rtio::RTIOPulseOp reference, rtio::RTIOPulseOp candidate)>;
+/// Groups of pulses indexed by their group ID, which is also the order they are scheduled in.
+using ScheduleGroups = SmallVector<llvm::SetVector<Operation *>>;
 
 //===----------------------------------------------------------------------===//
 // Pulse Scheduling
 //===----------------------------------------------------------------------===//
 
-class PulseScheduler {
+/// The grouping predicate is a template parameter rather than a std::function, so that it is
+/// inlined into the group extension loops which call it for every pair of candidate pulses.
+template <typename GroupingPredicate> class PulseScheduler {
   public:
     PulseScheduler(func::FuncOp funcOp, OpBuilder &builder, GroupingPredicate predicate)
         : funcOp(funcOp), builder(builder), groupingPredicate(std::move(predicate))
     {
     }
 
-    ScheduleGroupsMap schedule()
+    ScheduleGroups schedule()
     {
         // Collect all pulses
         funcOp.walk([&](rtio::RTIOPulseOp pulse) { allPulses.push_back(pulse); });
@@ -89,8 +93,7 @@ class PulseScheduler {
     DenseMap<rtio::RTIOPulseOp, SetVector<rtio::RTIOPulseOp>> pulseConsumers;
     DenseSet<Value> processedEvents;
     DenseSet<rtio::RTIOPulseOp> processedPulses;
-    ScheduleGroupsMap groups;
-    int nextGroupId = 0;
+    ScheduleGroups groups;
 
     SmallVector<rtio::RTIOPulseOp> getEventConsumers(Value event)
     {
@@ -107,12 +110,12 @@ class PulseScheduler {
 
     void processFromEmptyOps()
     {
-        std::deque<Value> worklist;
+        // FIFO worklist, consumed from the front by index to avoid deque node allocations
+        SmallVector<Value> worklist;
         funcOp.walk([&](rtio::RTIOEmptyOp emptyOp) { worklist.push_back(emptyOp.getResult()); });
 
-        while (!worklist.empty()) {
-            Value event = worklist.front();
-            worklist.pop_front();
+        for (size_t head = 0; head < worklist.size(); head++) {
+            Value event = worklist[head];
 
             // check if event has already been processed
             // if not, process the event and insert it into the processed events
@@ -228,8 +231,7 @@ class PulseScheduler {
 
     void recordGroup(const DenseMap<int32_t, SmallVector<rtio::RTIOPulseOp>> &channelPulses)
     {
-        int groupId = nextGroupId++;
-        auto &groupOps = groups[groupId];
+        auto &groupOps = groups.emplace_back();
         for (auto &[_, pulses] : channelPulses) {
             for (auto pulse : pulses) {
                 groupOps.insert(pulse.getOperation());
@@ -324,42 +326,35 @@ class PulseScheduler {
 // Frequency Decomposition
 //===----------------------------------------------------------------------===//
 
-void decomposeFrequencyPulses(ScheduleGroupsMap &pulseGroups)
+void decomposeFrequencyPulses(ScheduleGroups &pulseGroups)
 {
     if (pulseGroups.empty()) {
         return;
     }
 
-    auto firstOp = pulseGroups.begin()->second.front();
+    auto firstOp = pulseGroups.front().front();
     OpBuilder builder(firstOp->getContext());
 
     // Track last frequency per channel (to avoid redundant frequency settings)
     DenseMap<Value, Value> channelLastFreq;
 
-    // Sort groups by ID for deterministic processing
-    SmallVector<std::pair<int, llvm::SetVector<Operation *> *>> sortedGroups;
-    for (auto &entry : pulseGroups) {
-        sortedGroups.push_back({entry.first, &entry.second});
-    }
-    llvm::sort(sortedGroups, [](const auto &a, const auto &b) { return a.first < b.first; });
-
-    for (auto &[groupId, groupOpsPtr] : sortedGroups) {
-        auto &groupOps = *groupOpsPtr;
+    // Groups are stored in the order they were scheduled in, which keeps processing deterministic
+    DenseSet<Value> groupEvents;
+    for (auto &groupOps : pulseGroups) {
         if (groupOps.empty()) {
             continue;
         }
 
+        groupEvents.clear();
+        for (auto *op : groupOps) {
+            groupEvents.insert(cast<rtio::RTIOPulseOp>(op).getEvent());
+        }
+
         // Find root pulses (pulses whose wait isn't produced by another pulse in this group)
         DenseMap<Value, rtio::RTIOPulseOp> channelRoots;
         for (auto *op : groupOps) {
             auto pulse = cast<rtio::RTIOPulseOp>(op);
-            Value wait = pulse.getWait();
-
-            bool isRoot = llvm::none_of(groupOps, [&](Operation *other) {
-                return cast<rtio::RTIOPulseOp>(other).getEvent() == wait;
-            });
-
-            if (isRoot) {
+            if (!groupEvents.contains(pulse.getWait())) {
                 Value channel = pulse.getChannel();
                 if (!channelRoots.count(channel)) {
                     channelRoots[channel] = pulse;
@@ -433,6 +428,128 @@ void decomposeFrequencyPulses(ScheduleGroupsMap &pulseGroups)
         }
     }
 }
+
+//===----------------------------------------------------------------------===//
+// DMA Recording
+//===----------------------------------------------------------------------===//
+
+/// Get the duration in machine units of a TTL pulse, computed as lowerTTLPulse does at runtime,
+/// if the pulse has a static channel and a constant duration.
+std::optional<int64_t> getStaticTTLDurationMu(rtio::RTIOPulseOp pulse)
+{
+    if (pulse->hasAttr("_control") || pulse->hasAttr("_slack") || pulse->hasAttr("_frequency") ||
+        pulse->hasAttr("_dma")) {
+        return std::nullopt;
+    }
+    if (!cast<rtio::ChannelType>(pulse.getChannel().getType()).isStatic()) {
+        return std::nullopt;
+    }
+
+    FloatAttr duration;
+    if (!matchPattern(pulse.getDuration(), m_Constant(&duration))) {
+        return std::nullopt;
+    }
+    auto durationMu = static_cast<int64_t>(
+        std::round(duration.getValueAsDouble() / ARTIQHardwareConfig::nanosecondPeriod));
+    return std::max(durationMu, ARTIQHardwareConfig::minTTLPulseMu);
+}
+
+/// Append an output event to a DMA buffer, in the record format of the ARTIQ DMA core: length,
+/// channel (24 bits), timestamp (64 bits), address (8 bits) and data (32 bits), little endian.
+void appendDMAOutput(std::string &buffer, int64_t timestamp, int32_t target, int32_t data)
+{
+    constexpr char recordLength = 1 + 3 + 8 + 1 + 4;
+    buffer.push_back(recordLength);
+    for (int shift = 8; shift < 32; shift += 8) {
+        buffer.push_back(static_cast<char>(target >> shift));
+    }
+    for (int shift = 0; shift < 64; shift += 8) {
+        buffer.push_back(static_cast<char>(timestamp >> shift));
+    }
+    buffer.push_back(static_cast<char>(target));
+    for (int shift = 0; shift < 32; shift += 8) {
+        buffer.push_back(static_cast<char>(data >> shift));
+    }
+}
+
+/// Record the chains of at least `minPulses` consecutive static TTL pulses of a function into
+/// constant DMA buffers. The first pulse of each chain is tagged with the buffer and the duration
+/// of the chain, and the rest of the chain is erased. `numBuffers` counts the buffers of the
+/// module, to give them unique names.
+void recordStaticPulseChains(func::FuncOp funcOp, OpBuilder &builder, unsigned minPulses,
+                             unsigned &numBuffers)
+{
+    ModuleOp module = funcOp->getParentOfType<ModuleOp>();
+    SmallVector<rtio::RTIOPulseOp> pulses;
+    funcOp.walk([&](rtio::RTIOPulseOp pulse) { pulses.push_back(pulse); });
+
+    // Blocks are sorted topologically, so the first unvisited pulse of a chain is its head
+    DenseSet<Operation *> visited;
+    int64_t channelBase = -1;
+    for (auto head : pulses) {
+        if (visited.contains(head) || !getStaticTTLDurationMu(head)) {
+            continue;
+        }
+
+        // Extend the chain while the next pulse is the only one waiting on the current pulse
+        SmallVector<rtio::RTIOPulseOp> chain{head};
+        SmallVector<int64_t> durationsMu{*getStaticTTLDurationMu(head)};
+        while (chain.back().getEvent().hasOneUse()) {
+            auto next = dyn_cast<rtio::RTIOPulseOp>(*chain.back().getEvent().getUsers().begin());
+            if (!next || next->getBlock() != head->getBlock()) {
+                break;
+            }
+            std::optional<int64_t> durationMu = getStaticTTLDurationMu(next);
+            if (!durationMu) {
+                break;
+            }
+            chain.push_back(next);
+            durationsMu.push_back(*durationMu);
+        }
+        for (auto pulse : chain) {
+            visited.insert(pulse);
+        }
+        if (chain.size() < minPulses) {
+            continue;
+        }
+
+        if (channelBase < 0) {
+            channelBase = getTTLChannelBase(module);
+        }
+
+        // Each pulse switches its channel on, and off again when the next pulse starts
+        std::string buffer;
+        int64_t timestamp = 0;
+        for (auto [pulse, durationMu] : llvm::zip_equal(chain, durationsMu)) {
+            auto target =
+                static_cast<int32_t>((extractChannelId(pulse.getChannel()) + channelBase) << 8);
+            appendDMAOutput(buffer, timestamp, target, 1);
+            timestamp += durationMu;
+            appendDMAOutput(buffer, timestamp, target, 0);
+        }
+
+        // A zero length terminates the buffer, which is padded to the DMA burst size
+        buffer.push_back(0);
+        buffer.resize(llvm::alignTo(buffer.size(), ARTIQHardwareConfig::dmaBufferAlignment), 0);
+
+        OpBuilder::InsertionGuard guard(builder);
+        builder.setInsertionPointToStart(module.getBody());
+        std::string name = "__rtio_dma_" + std::to_string(numBuffers++);
+        auto bufferType = LLVM::LLVMArrayType::get(builder.getI8Type(), buffer.size());
+        LLVM::GlobalOp::create(builder, head.getLoc(), bufferType, /*isConstant=*/true,
+                               LLVM::Linkage::Internal, name, builder.getStringAttr(buffer),
+                               ARTIQHardwareConfig::dmaBufferAlignment);
+
+        head->setAttr("_dma", FlatSymbolRefAttr::get(builder.getContext(), name));
+        head->setAttr("_dma_duration", builder.getI64IntegerAttr(timestamp));
+        if (chain.size() > 1) {
+            chain.back().getEvent().replaceAllUsesWith(head.getEvent());
+        }
+        for (auto pulse : llvm::reverse(ArrayRef(chain).drop_front())) {
+            pulse.erase();
+        }
+    }
+}
 } // namespace
 
 //===----------------------------------------------------------------------===//
@@ -452,9 +569,11 @@ struct RTIOEventToARTIQPass : public impl::RTIOEventToARTIQPassBase<RTIOEventToA
         OpBuilder builder(ctx);
 
         // Schedule pulses into groups
-        DenseMap<func::FuncOp, ScheduleGroupsMap> pulseGroups;
+        DenseMap<func::FuncOp, ScheduleGroups> pulseGroups;
         module.walk([&](func::FuncOp funcOp) {
-            PulseScheduler scheduler(funcOp, builder, sameChannelSameFrequency);
+            PulseScheduler scheduler(funcOp, builder, [](RTIOPulseOp ref, RTIOPulseOp candidate) {
+                return sameChannelSameFrequency(ref, candidate);
+            });
             pulseGroups[funcOp] = scheduler.schedule();
         });
 
@@ -486,6 +605,14 @@ struct RTIOEventToARTIQPass : public impl::RTIOEventToARTIQPassBase<RTIOEventToA
             }
         }
 
+        // Record static TTL pulse chains into DMA buffers
+        if (dmaMinPulses > 0) {
+            unsigned numBuffers = 0;
+            module.walk([&](func::FuncOp funcOp) {
+                recordStaticPulseChains(funcOp, builder, dmaMinPulses, numBuffers);
+            });
+        }
+
         // Setup device initialization
         if (failed(setupKernelDevice(module, builder))) {
             return signalPassFailure();
@@ -494,6 +621,11 @@ struct RTIOEventToARTIQPass : public impl::RTIOEventToARTIQPassBase<RTIOEventToA
         // Assign unique RPC service IDs to all rtio.rpc ops
         rpcIdMap = assignRPCIds(module);
 
+        // Send runs of async RPCs to the host as a single RPC
+        if (coalesceRPCs) {
+            coalesceAsyncRPCs(module, builder, rpcIdMap);
+        }
+
         // Lowering to LLVM
         if (failed(lowerToLLVM(module))) {
             return signalPassFailure();
@@ -581,6 +713,70 @@ struct RTIOEventToARTIQPass : public impl::RTIOEventToARTIQPassBase<RTIOEventToA
         return idMap;
     }
 
+    // Replace each run of at least two async RPCs without keyword arguments by a single async RPC
+    // of the host-side dispatcher `__rtio_rpc_batch`. Its positional arguments are, for each RPC of
+    // the run in order, the service ID of the RPC, its number of arguments, and its arguments.
+    // Async RPCs have no results, so the RPCs of a run do not depend on each other, and are only
+    // moved past the side-effect free operations between them.
+    static void coalesceAsyncRPCs(ModuleOp module, OpBuilder &builder,
+                                  llvm::SmallVector<std::pair<int32_t, std::string>> &idMap)
+    {
+        auto isCoalescable = [](rtio::RTIORPCOp rpc) {
+            return rpc.getIsAsync() && !rpc->hasAttr("keyword_names");
+        };
+
+        SmallVector<SmallVector<rtio::RTIORPCOp>> runs;
+        module.walk([&](Block *block) {
+            SmallVector<rtio::RTIORPCOp> run;
+            auto endRun = [&]() {
+                if (run.size() > 1) {
+                    runs.push_back(run);
+                }
+                run.clear();
+            };
+            for (Operation &op : *block) {
+                auto rpc = dyn_cast<rtio::RTIORPCOp>(op);
+                if (rpc && isCoalescable(rpc)) {
+                    run.push_back(rpc);
+                }
+                else if (!isMemoryEffectFree(&op)) {
+                    endRun();
+                }
+            }
+            endRun();
+        });
+        if (runs.empty()) {
+            return;
+        }
+
+        const int32_t batchId = static_cast<int32_t>(idMap.size()) + 1;
+        idMap.push_back({batchId, ARTIQFuncNames::rpcBatch.str()});
+
+        OpBuilder::InsertionGuard guard(builder);
+        for (auto &run : runs) {
+            Location loc = run.back().getLoc();
+            builder.setInsertionPoint(run.back());
+
+            SmallVector<Value> args;
+            for (auto rpc : run) {
+                args.push_back(arith::ConstantOp::create(
+                    builder, loc, builder.getI32IntegerAttr(rpc.getRpcIdAttr().getInt())));
+                args.push_back(arith::ConstantOp::create(
+                    builder, loc, builder.getI32IntegerAttr(rpc.getArgs().size())));
+                llvm::append_range(args, rpc.getArgs());
+            }
+            rtio::RTIORPCOp::create(builder, loc, TypeRange{},
+                                    FlatSymbolRefAttr::get(builder.getContext(),
+                                                           ARTIQFuncNames::rpcBatch),
+                                    builder.getUnitAttr(), builder.getI32IntegerAttr(batchId),
+                                    args);
+
+            for (auto rpc : run) {
+                rpc.erase();
+            }
+        }
+    }
+
     LogicalResult lowerToLLVM(ModuleOp module)
     {
         MLIRContext *ctx = &getContext();
@@ -47,6 +47,9 @@ struct PulseOpLowering : public OpConversionPattern<RTIOPulseOp> {
         if (op->hasAttr("_control")) {
             return lowerControlPulse(op, adaptor, rewriter, artiq);
         }
+        else if (op->hasAttr("_dma")) {
+            return lowerDMAPulse(op, rewriter, artiq);
+        }
         else if (op->hasAttr("_slack")) {
             return lowerSlackPulse(op, rewriter, artiq);
         }
@@ -83,6 +86,27 @@ struct PulseOpLowering : public OpConversionPattern<RTIOPulseOp> {
         return success();
     }
 
+    LogicalResult lowerDMAPulse(RTIOPulseOp op, ConversionPatternRewriter &rewriter,
+                                ARTIQRuntimeBuilder &artiq) const
+    {
+        auto buffer = op->getAttrOfType<FlatSymbolRefAttr>("_dma");
+        auto durationMu = op->getAttrOfType<IntegerAttr>("_dma_duration");
+        if (!durationMu) {
+            return op->emitError("DMA pulse is missing its _dma_duration attribute");
+        }
+
+        // Recorded timestamps are relative to the start of the chain, so that playback at the
+        // current time replays the chain where the first pulse would have started
+        Type ptrTy = LLVM::LLVMPointerType::get(rewriter.getContext());
+        Value bufferPtr = LLVM::AddressOfOp::create(rewriter, op.getLoc(), ptrTy, buffer.getValue());
+        artiq.dmaPlayback(artiq.nowMu(), bufferPtr);
+        artiq.delayMu(artiq.constI64(durationMu.getInt()));
+
+        Value newTime = artiq.nowMu();
+        rewriter.replaceOp(op, newTime);
+        return success();
+    }
+
     LogicalResult lowerTTLPulse(RTIOPulseOp op, OpAdaptor adaptor,
                                 ConversionPatternRewriter &rewriter,
                                 ARTIQRuntimeBuilder &artiq) const
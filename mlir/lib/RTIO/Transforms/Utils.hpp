@@ -31,12 +31,9 @@ inline int32_t extractChannelId(mlir::Value channelValue)
     return type.getChannelId().getInt();
 }
 
-/// Compute the device address for a given channel value.
-inline mlir::Value computeChannelDeviceAddr(mlir::OpBuilder &builder, mlir::Operation *op,
-                                            mlir::Value channelValue)
+/// Get the RTIO channel of the first TTL switch, to which channel IDs are relative.
+inline int64_t getTTLChannelBase(mlir::ModuleOp mod)
 {
-    mlir::Location loc = op->getLoc();
-    mlir::ModuleOp mod = op->getParentOfType<mlir::ModuleOp>();
     auto configAttr = mod->getAttrOfType<ConfigAttr>(ConfigAttr::getModuleAttrName());
     assert(configAttr && "configAttr not found");
 
@@ -50,7 +47,15 @@ inline mlir::Value computeChannelDeviceAddr(mlir::OpBuilder &builder, mlir::Oper
             current = cfg.get(key);
         }
     }
-    int64_t channelBase = mlir::cast<mlir::IntegerAttr>(current).getInt();
+    return mlir::cast<mlir::IntegerAttr>(current).getInt();
+}
+
+/// Compute the device address for a given channel value.
+inline mlir::Value computeChannelDeviceAddr(mlir::OpBuilder &builder, mlir::Operation *op,
+                                            mlir::Value channelValue)
+{
+    mlir::Location loc = op->getLoc();
+    int64_t channelBase = getTTLChannelBase(op->getParentOfType<mlir::ModuleOp>());
 
     llvm::APInt channelIdAPInt;
     assert(mlir::matchPattern(channelValue, mlir::m_ConstantInt(&channelIdAPInt)) &&
@@ -17,11 +17,16 @@
 #include <algorithm>
 #include <vector>
 
+#include "llvm/ADT/SmallPtrSet.h"
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/Index/IR/IndexOps.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
 #include "stablehlo/dialect/StablehloOps.h"
 
 using namespace mlir;
@@ -30,7 +35,14 @@ namespace catalyst {
 namespace hlo_extensions {
 
 struct ScatterOpRewritePattern : public mlir::OpRewritePattern<stablehlo::ScatterOp> {
-    using mlir::OpRewritePattern<stablehlo::ScatterOp>::OpRewritePattern;
+    // Whether scatters with a scalar update computation are lowered to a loop over whole update
+    // windows, instead of calling the update computation on every element
+    bool specializeUpdates;
+
+    ScatterOpRewritePattern(MLIRContext *context, PatternBenefit benefit, bool specializeUpdates)
+        : OpRewritePattern(context, benefit), specializeUpdates(specializeUpdates)
+    {
+    }
 
     void emitIndicesError(stablehlo::ScatterOp op) const
     {
@@ -170,9 +182,8 @@ struct ScatterOpRewritePattern : public mlir::OpRewritePattern<stablehlo::Scatte
         // Let's make some simplifying assumptions
 
         // Add checks for supported cases (assumptions: no update windows dim, unique indices and
-        // sorted indices)
+        // sorted indices). The other lowerings report unsupported indices.
         if (!op.getUniqueIndices() || !op.getIndicesAreSorted()) {
-            emitIndicesError(op);
             return failure();
         }
 
@@ -284,6 +295,315 @@ struct ScatterOpRewritePattern : public mlir::OpRewritePattern<stablehlo::Scatte
         return success();
     }
 
+    // Whether the operation only computes on scalars, and can be cloned inside the body of a
+    // linalg.generic
+    static bool isScalarOp(Operation &op)
+    {
+        auto isScalar = [](Type type) { return !isa<ShapedType>(type); };
+        return op.getNumRegions() == 0 && isMemoryEffectFree(&op) &&
+               llvm::all_of(op.getOperandTypes(), isScalar) &&
+               llvm::all_of(op.getResultTypes(), isScalar);
+    }
+
+    // The update computation can be applied to single elements if it only consists of scalar
+    // operations on the elements of its rank-0 arguments, as produced by the lowering of
+    // `x.at[...].set/add/multiply/min/max(...)` to linalg:
+    //
+    // ^bb0(%arg0: tensor<T>, %arg1: tensor<T>):
+    //   %0 = tensor.extract %arg0[] : tensor<T>
+    //   %1 = tensor.extract %arg1[] : tensor<T>
+    //   %2 = arith.addf %0, %1 : T
+    //   %3 = tensor.from_elements %2 : tensor<T>
+    //   stablehlo.return %3 : tensor<T>
+    //
+    // where the scalar operations may also be wrapped in a rank-0 linalg.generic.
+    mlir::LogicalResult isScalarComputation(stablehlo::ScatterOp op) const
+    {
+        Region &region = op.getUpdateComputation();
+        if (!region.hasOneBlock()) {
+            return failure();
+        }
+        Block &block = region.front();
+        Type elementType = cast<RankedTensorType>(op.getResult(0).getType()).getElementType();
+        auto isElementTensor = [&](Type type) {
+            return type == RankedTensorType::get({}, elementType);
+        };
+        if (block.getNumArguments() != 2 ||
+            !llvm::all_of(block.getArgumentTypes(), isElementTensor)) {
+            return failure();
+        }
+
+        // The rank-0 tensors standing for a scalar
+        llvm::SmallPtrSet<Value, 8> scalarTensors(block.args_begin(), block.args_end());
+        for (Operation &nested : block) {
+            if (auto extractOp = dyn_cast<tensor::ExtractOp>(nested)) {
+                if (!scalarTensors.contains(extractOp.getTensor())) {
+                    return failure();
+                }
+            }
+            else if (auto fromElementsOp = dyn_cast<tensor::FromElementsOp>(nested)) {
+                if (fromElementsOp.getType().getRank() != 0) {
+                    return failure();
+                }
+                scalarTensors.insert(fromElementsOp.getResult());
+            }
+            else if (auto emptyOp = dyn_cast<tensor::EmptyOp>(nested)) {
+                // Only used as the destination of rank-0 linalg.generic ops
+                if (emptyOp.getType().getRank() != 0) {
+                    return failure();
+                }
+            }
+            else if (auto genericOp = dyn_cast<linalg::GenericOp>(nested)) {
+                Block *body = genericOp.getBody();
+                bool usesInit = !body->getArguments().back().use_empty();
+                if (genericOp.getNumLoops() != 0 || genericOp.getNumDpsInits() != 1 || usesInit ||
+                    !llvm::all_of(genericOp.getDpsInputs(),
+                                  [&](Value input) { return scalarTensors.contains(input); }) ||
+                    !llvm::all_of(body->without_terminator(), isScalarOp)) {
+                    return failure();
+                }
+                scalarTensors.insert(genericOp->getResult(0));
+            }
+            else if (auto returnOp = dyn_cast<stablehlo::ReturnOp>(nested)) {
+                return success(returnOp.getNumOperands() == 1 &&
+                               scalarTensors.contains(returnOp.getOperand(0)));
+            }
+            else if (!isScalarOp(nested)) {
+                return failure();
+            }
+        }
+        return failure();
+    }
+
+    // Emit the update computation checked by isScalarComputation on the scalars `current` and
+    // `update`, and return the updated scalar.
+    Value emitScalarComputation(OpBuilder &builder, Region &region, Value current,
+                                Value update) const
+    {
+        Block &block = region.front();
+        // Map the rank-0 tensors to their element, and the scalars to their clones
+        IRMapping mapping;
+        mapping.map(block.getArgument(0), current);
+        mapping.map(block.getArgument(1), update);
+        for (Operation &nested : block) {
+            if (auto extractOp = dyn_cast<tensor::ExtractOp>(nested)) {
+                mapping.map(extractOp.getResult(), mapping.lookup(extractOp.getTensor()));
+            }
+            else if (auto fromElementsOp = dyn_cast<tensor::FromElementsOp>(nested)) {
+                mapping.map(fromElementsOp.getResult(),
+                            mapping.lookupOrDefault(fromElementsOp.getElements().front()));
+            }
+            else if (auto genericOp = dyn_cast<linalg::GenericOp>(nested)) {
+                Block *body = genericOp.getBody();
+                for (auto [arg, input] :
+                     llvm::zip(body->getArguments(), genericOp.getDpsInputs())) {
+                    mapping.map(arg, mapping.lookup(input));
+                }
+                for (Operation &inner : body->without_terminator()) {
+                    builder.clone(inner, mapping);
+                }
+                auto yieldOp = cast<linalg::YieldOp>(body->getTerminator());
+                mapping.map(genericOp->getResult(0),
+                            mapping.lookupOrDefault(yieldOp.getOperand(0)));
+            }
+            else if (auto returnOp = dyn_cast<stablehlo::ReturnOp>(nested)) {
+                return mapping.lookup(returnOp.getOperand(0));
+            }
+            else if (!isa<tensor::EmptyOp>(nested)) {
+                builder.clone(nested, mapping);
+            }
+        }
+        llvm_unreachable("the update computation has a terminator");
+    }
+
+    // The multi-dimensional index of the `linear` index in a tensor of shape `shape`.
+    SmallVector<Value> delinearizeIndex(OpBuilder &builder, Location loc, Value linear,
+                                        ArrayRef<int64_t> shape) const
+    {
+        SmallVector<Value> indices(shape.size());
+        for (int64_t dim = shape.size() - 1; dim > 0; dim--) {
+            Value size = index::ConstantOp::create(builder, loc, shape[dim]);
+            indices[dim] = arith::RemUIOp::create(builder, loc, linear, size);
+            linear = arith::DivUIOp::create(builder, loc, linear, size);
+        }
+        if (!shape.empty()) {
+            indices[0] = linear;
+        }
+        return indices;
+    }
+
+    mlir::LogicalResult lowerToUpdateLoop(stablehlo::ScatterOp op,
+                                          mlir::PatternRewriter &rewriter) const
+    {
+        // Common scatters, such as the one-hot updates and point updates `x.at[i].set(v)`, and
+        // the segment sums `x.at[indices].add(v)`, update windows of the input, which are slices
+        // of the input, with a scalar update computation. Instead of calling the update
+        // computation on every element, we loop over the windows and update each of them with a
+        // linalg.generic, which LLVM can vectorize once bufferized:
+        //
+        // scf.for %i = 0 to num_windows iter_args(%result = %input) {
+        //   %start = start index of the window %i, from %scatter_indices
+        //   %window = tensor.extract_slice %result[%start] [window_shape]
+        //   %update = tensor.extract_slice %updates[%i, 0, ...] [1, window_shape]
+        //   %updated = linalg.generic ins(%update) outs(%window) { update computation }
+        //   tensor.insert_slice %updated into %result[%start] [window_shape]
+        // }
+        //
+        // Updating the windows one after the other stays correct for indices which are neither
+        // unique nor sorted, and windows which are out of bounds are skipped like in XLA.
+        if (failed(this->onlyOneInputUpdateAndResult(op)) || failed(this->noBatching(op)) ||
+            failed(this->isScalarComputation(op))) {
+            return failure();
+        }
+        Value input = op.getInputs().front();
+        Value update = op.getUpdates().front();
+        Value scatterIndices = op.getScatterIndices();
+        auto inputTy = cast<RankedTensorType>(input.getType());
+        auto updateTy = cast<RankedTensorType>(update.getType());
+        auto scatterIndicesTy = cast<RankedTensorType>(scatterIndices.getType());
+        if (!inputTy.hasStaticShape() || !updateTy.hasStaticShape() ||
+            !scatterIndicesTy.hasStaticShape() ||
+            updateTy.getElementType() != inputTy.getElementType()) {
+            return failure();
+        }
+
+        auto scatterDimNumbers = op.getScatterDimensionNumbers();
+        ArrayRef<int64_t> updateWindowDims = scatterDimNumbers.getUpdateWindowDims();
+        ArrayRef<int64_t> insertedWindowDims = scatterDimNumbers.getInsertedWindowDims();
+        ArrayRef<int64_t> scatterDimsToOperandDims =
+            scatterDimNumbers.getScatterDimsToOperandDims();
+        int64_t indexVectorDim = scatterDimNumbers.getIndexVectorDim();
+
+        // The update scatter dims must lead the update window dims
+        int64_t numScatterDims = updateTy.getRank() - updateWindowDims.size();
+        for (auto [i, dim] : llvm::enumerate(updateWindowDims)) {
+            if (dim != numScatterDims + static_cast<int64_t>(i)) {
+                return failure();
+            }
+        }
+        ArrayRef<int64_t> scatterShape = updateTy.getShape().take_front(numScatterDims);
+        ArrayRef<int64_t> windowShape = updateTy.getShape().drop_front(numScatterDims);
+
+        // The index vectors must be along the last dimension of the scatter indices, possibly
+        // implicitly, and the other dimensions must match the update scatter dims
+        bool implicitIndexVector = indexVectorDim == scatterIndicesTy.getRank();
+        if (!implicitIndexVector && indexVectorDim != scatterIndicesTy.getRank() - 1) {
+            return failure();
+        }
+        ArrayRef<int64_t> indicesShape = scatterIndicesTy.getShape();
+        if (!implicitIndexVector) {
+            indicesShape = indicesShape.drop_back();
+        }
+        if (indicesShape != scatterShape || scatterDimsToOperandDims.empty()) {
+            return failure();
+        }
+
+        // The window covers the input dimensions which are not inserted, in order
+        SmallVector<int64_t> inputWindowShape;
+        for (int64_t dim = 0, windowDim = 0; dim < inputTy.getRank(); dim++) {
+            inputWindowShape.push_back(
+                llvm::is_contained(insertedWindowDims, dim) ? 1 : windowShape[windowDim++]);
+        }
+
+        Location loc = op.getLoc();
+        Region &region = op.getUpdateComputation();
+        bool assignment = succeeded(this->isAssignment(op));
+        auto windowTy = RankedTensorType::get(windowShape, inputTy.getElementType());
+        int64_t numWindows = ShapedType::getNumElements(scatterShape);
+
+        Value c0 = index::ConstantOp::create(rewriter, loc, 0);
+        Value c1 = index::ConstantOp::create(rewriter, loc, 1);
+        Value numWindowsValue = index::ConstantOp::create(rewriter, loc, numWindows);
+        auto updateWindow = [&](OpBuilder &builder, Location loc, Value i, ValueRange iterArgs) {
+            Value results = iterArgs.front();
+            SmallVector<Value> scatterIndex = delinearizeIndex(builder, loc, i, scatterShape);
+
+            // The start of the window in the input, and whether it is in bounds
+            SmallVector<Value> start(inputTy.getRank(), c0);
+            Value inBounds;
+            for (auto [k, dim] : llvm::enumerate(scatterDimsToOperandDims)) {
+                SmallVector<Value> indexVectorIndex = scatterIndex;
+                if (!implicitIndexVector) {
+                    indexVectorIndex.push_back(index::ConstantOp::create(builder, loc, k));
+                }
+                Value index = tensor::ExtractOp::create(builder, loc, scatterIndices,
+                                                        indexVectorIndex);
+                start[dim] =
+                    arith::IndexCastOp::create(builder, loc, builder.getIndexType(), index);
+                Value maxStart = index::ConstantOp::create(
+                    builder, loc, inputTy.getDimSize(dim) - inputWindowShape[dim]);
+                Value aboveMin = arith::CmpIOp::create(builder, loc, arith::CmpIPredicate::sge,
+                                                       start[dim], c0);
+                Value belowMax = arith::CmpIOp::create(builder, loc, arith::CmpIPredicate::sle,
+                                                       start[dim], maxStart);
+                Value dimInBounds = arith::AndIOp::create(builder, loc, aboveMin, belowMax);
+                if (inBounds) {
+                    dimInBounds = arith::AndIOp::create(builder, loc, inBounds, dimInBounds);
+                }
+                inBounds = dimInBounds;
+            }
+
+            auto thenBuilder = [&](OpBuilder &builder, Location loc) {
+                Value updated;
+                if (windowShape.empty()) {
+                    // Point updates work on the elements directly
+                    Value current = tensor::ExtractOp::create(builder, loc, results, start);
+                    Value value = tensor::ExtractOp::create(builder, loc, update, scatterIndex);
+                    Value element = emitScalarComputation(builder, region, current, value);
+                    updated = tensor::InsertOp::create(builder, loc, element, results, start);
+                }
+                else {
+                    SmallVector<OpFoldResult> offsets = getAsOpFoldResult(start);
+                    SmallVector<OpFoldResult> sizes = getAsIndexOpFoldResult(
+                        builder.getContext(), inputWindowShape);
+                    SmallVector<OpFoldResult> strides(inputTy.getRank(), builder.getIndexAttr(1));
+
+                    SmallVector<OpFoldResult> updateOffsets = getAsOpFoldResult(scatterIndex);
+                    updateOffsets.append(windowShape.size(), builder.getIndexAttr(0));
+                    SmallVector<OpFoldResult> updateSizes(numScatterDims, builder.getIndexAttr(1));
+                    llvm::append_range(updateSizes,
+                                       getAsIndexOpFoldResult(builder.getContext(), windowShape));
+                    SmallVector<OpFoldResult> updateStrides(updateTy.getRank(),
+                                                            builder.getIndexAttr(1));
+                    Value window = tensor::ExtractSliceOp::create(
+                        builder, loc, windowTy, update, updateOffsets, updateSizes, updateStrides);
+
+                    if (!assignment) {
+                        Value current = tensor::ExtractSliceOp::create(
+                            builder, loc, windowTy, results, offsets, sizes, strides);
+                        SmallVector<AffineMap> indexingMaps(
+                            2, builder.getMultiDimIdentityMap(windowTy.getRank()));
+                        SmallVector<utils::IteratorType> iteratorTypes(
+                            windowTy.getRank(), utils::IteratorType::parallel);
+                        window = linalg::GenericOp::create(
+                                     builder, loc, TypeRange{windowTy}, ValueRange{window},
+                                     ValueRange{current}, indexingMaps, iteratorTypes,
+                                     [&](OpBuilder &builder, Location loc, ValueRange args) {
+                                         Value element = emitScalarComputation(
+                                             builder, region, args[1], args[0]);
+                                         linalg::YieldOp::create(builder, loc, element);
+                                     })
+                                     .getResult(0);
+                    }
+                    updated = tensor::InsertSliceOp::create(builder, loc, window, results, offsets,
+                                                            sizes, strides);
+                }
+                scf::YieldOp::create(builder, loc, updated);
+            };
+            auto elseBuilder = [&](OpBuilder &builder, Location loc) {
+                scf::YieldOp::create(builder, loc, results);
+            };
+            Value result =
+                scf::IfOp::create(builder, loc, inBounds, thenBuilder, elseBuilder).getResult(0);
+            scf::YieldOp::create(builder, loc, result);
+        };
+        Value result = scf::ForOp::create(rewriter, loc, c0, numWindowsValue, c1,
+                                          /*iterArgsInit=*/input, updateWindow)
+                           .getResult(0);
+        rewriter.replaceOp(op, result);
+        return success();
+    }
+
     mlir::LogicalResult matchAndRewrite(stablehlo::ScatterOp op,
                                         mlir::PatternRewriter &rewriter) const override
     {
@@ -292,6 +612,10 @@ struct ScatterOpRewritePattern : public mlir::OpRewritePattern<stablehlo::Scatte
             return success();
         }
 
+        if (specializeUpdates && succeeded(this->lowerToUpdateLoop(op, rewriter))) {
+            return success();
+        }
+
         if (failed(onlyOneInputUpdateAndResult(op))) {
             // Otherwise it will segfault.
             op.emitError() << "Only one input, update, and result";
@@ -752,9 +1076,9 @@ struct ScatterOpRewritePattern : public mlir::OpRewritePattern<stablehlo::Scatte
     }
 };
 
-void populateScatterPatterns(RewritePatternSet &patterns)
+void populateScatterPatterns(RewritePatternSet &patterns, bool specializeUpdates)
 {
-    patterns.add<ScatterOpRewritePattern>(patterns.getContext(), 1);
+    patterns.add<ScatterOpRewritePattern>(patterns.getContext(), 1, specializeUpdates);
 }
 
 } // namespace hlo_extensions
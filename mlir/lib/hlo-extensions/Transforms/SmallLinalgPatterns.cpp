@@ -0,0 +1,580 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define DEBUG_TYPE "small-linalg"
+
+#include <algorithm>
+#include <optional>
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Sequence.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/Math/IR/Math.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/IR/PatternMatch.h"
+#include "stablehlo/dialect/StablehloOps.h"
+
+#include "hlo-extensions/Transforms/Patterns.h"
+
+using namespace mlir;
+
+namespace {
+
+/// The number of sweeps of the Jacobi eigenvalue iteration. Cyclic Jacobi converges
+/// quadratically, and matrices of up to 16x16 converge to double precision in fewer sweeps.
+constexpr int64_t JACOBI_SWEEPS = 12;
+
+/// The elements of a small matrix, by rows.
+using Matrix = SmallVector<SmallVector<Value>>;
+
+Matrix toMatrix(ArrayRef<Value> elements, int64_t rows, int64_t cols)
+{
+    Matrix matrix;
+    for (int64_t i = 0; i < rows; ++i) {
+        matrix.emplace_back(elements.slice(i * cols, cols));
+    }
+    return matrix;
+}
+
+SmallVector<Value> toElements(const Matrix &matrix)
+{
+    SmallVector<Value> elements;
+    for (const SmallVector<Value> &row : matrix) {
+        llvm::append_range(elements, row);
+    }
+    return elements;
+}
+
+Matrix transpose(const Matrix &matrix)
+{
+    Matrix result(matrix.front().size(), SmallVector<Value>(matrix.size()));
+    for (auto [i, row] : llvm::enumerate(matrix)) {
+        for (auto [j, value] : llvm::enumerate(row)) {
+            result[j][i] = value;
+        }
+    }
+    return result;
+}
+
+/// Builds the scalar arithmetic of the inline kernels.
+struct ScalarOps {
+    OpBuilder &builder;
+    Location loc;
+
+    Value constant(Type type, double value)
+    {
+        return arith::ConstantOp::create(builder, loc, builder.getFloatAttr(type, value));
+    }
+    Value i32(int64_t value)
+    {
+        return arith::ConstantOp::create(builder, loc, builder.getI32IntegerAttr(value));
+    }
+    Value add(Value lhs, Value rhs) { return arith::AddFOp::create(builder, loc, lhs, rhs); }
+    Value sub(Value lhs, Value rhs) { return arith::SubFOp::create(builder, loc, lhs, rhs); }
+    Value mul(Value lhs, Value rhs) { return arith::MulFOp::create(builder, loc, lhs, rhs); }
+    Value div(Value lhs, Value rhs) { return arith::DivFOp::create(builder, loc, lhs, rhs); }
+    Value neg(Value value) { return arith::NegFOp::create(builder, loc, value); }
+    Value abs(Value value) { return math::AbsFOp::create(builder, loc, value); }
+    Value sqrt(Value value) { return math::SqrtOp::create(builder, loc, value); }
+    Value cmp(arith::CmpFPredicate predicate, Value lhs, Value rhs)
+    {
+        return arith::CmpFOp::create(builder, loc, predicate, lhs, rhs);
+    }
+    Value eq(Value lhs, Value rhs)
+    {
+        return arith::CmpIOp::create(builder, loc, arith::CmpIPredicate::eq, lhs, rhs);
+    }
+    Value select(Value condition, Value trueValue, Value falseValue)
+    {
+        return arith::SelectOp::create(builder, loc, condition, trueValue, falseValue);
+    }
+
+    /// The LAPACK `info` result, which records the 1-based `step` of the first failure.
+    Value recordFailure(Value info, Value failed, int64_t step)
+    {
+        Value first = arith::AndIOp::create(builder, loc, failed, eq(info, i32(0)));
+        return select(first, i32(step), info);
+    }
+};
+
+/// The character option `name` of the backend config of a LAPACK custom call.
+std::optional<char> getCharOption(stablehlo::CustomCallOp op, StringRef name)
+{
+    IntegerAttr option;
+    if (auto config = dyn_cast_or_null<DictionaryAttr>(op->getAttr("backend_config"))) {
+        option = dyn_cast_or_null<IntegerAttr>(config.get(name));
+    }
+    if (!option) {
+        return std::nullopt;
+    }
+    return static_cast<char>(option.getValue().getZExtValue());
+}
+
+/// Reshape a batch of matrices into the flat 1-D tensor of its elements, and back.
+Value flatten(OpBuilder &builder, Location loc, Value value)
+{
+    auto type = cast<RankedTensorType>(value.getType());
+    auto flatType = RankedTensorType::get({type.getNumElements()}, type.getElementType());
+    ReassociationIndices dims = llvm::to_vector(llvm::seq<int64_t>(0, type.getRank()));
+    return tensor::CollapseShapeOp::create(builder, loc, flatType, value,
+                                           ArrayRef<ReassociationIndices>{dims});
+}
+
+Value unflatten(OpBuilder &builder, Location loc, Value flat, RankedTensorType type)
+{
+    if (type.getRank() == 1) {
+        return flat;
+    }
+    if (type.getRank() == 0) {
+        return tensor::CollapseShapeOp::create(builder, loc, type, flat,
+                                               ArrayRef<ReassociationIndices>{});
+    }
+    ReassociationIndices dims = llvm::to_vector(llvm::seq<int64_t>(0, type.getRank()));
+    return tensor::ExpandShapeOp::create(builder, loc, type, flat,
+                                         ArrayRef<ReassociationIndices>{dims});
+}
+
+using EntryFn = llvm::function_ref<SmallVector<SmallVector<Value>>(
+    OpBuilder &, Location, ArrayRef<SmallVector<Value>>)>;
+
+/**
+ * @brief Replace a LAPACK custom call by a loop over the entries of its batch.
+ *
+ * The first `numBatchDims` dimensions of the operands and results index the batch. For each
+ * entry, `computeEntry` maps the elements of the operands, in row-major order, to the elements of
+ * the results.
+ */
+void replaceByBatchLoop(PatternRewriter &rewriter, stablehlo::CustomCallOp op,
+                        int64_t numBatchDims, EntryFn computeEntry)
+{
+    Location loc = op.getLoc();
+    auto operandType = cast<RankedTensorType>(op->getOperand(0).getType());
+    int64_t batchSize = 1;
+    for (int64_t dim : operandType.getShape().take_front(numBatchDims)) {
+        batchSize *= dim;
+    }
+    auto getEntrySize = [&](Type type) {
+        return cast<RankedTensorType>(type).getNumElements() / batchSize;
+    };
+
+    SmallVector<Value> operands;
+    for (Value operand : op->getOperands()) {
+        operands.push_back(flatten(rewriter, loc, operand));
+    }
+    SmallVector<Value> inits;
+    for (Type type : op->getResultTypes()) {
+        auto resultType = cast<RankedTensorType>(type);
+        auto flatType =
+            RankedTensorType::get({resultType.getNumElements()}, resultType.getElementType());
+        inits.push_back(tensor::EmptyOp::create(rewriter, loc, flatType.getShape(),
+                                                flatType.getElementType()));
+    }
+
+    auto computeEntries = [&](OpBuilder &builder, Location bodyLoc, Value iv, ValueRange accs) {
+        auto getEntryOffset = [&](Type type) -> Value {
+            Value size = arith::ConstantIndexOp::create(builder, bodyLoc, getEntrySize(type));
+            return arith::MulIOp::create(builder, bodyLoc, iv, size);
+        };
+
+        SmallVector<SmallVector<Value>> entries;
+        for (Value operand : operands) {
+            Value offset = getEntryOffset(operand.getType());
+            SmallVector<Value> &elements = entries.emplace_back();
+            for (int64_t k = 0; k < getEntrySize(operand.getType()); ++k) {
+                Value index = arith::AddIOp::create(
+                    builder, bodyLoc, offset, arith::ConstantIndexOp::create(builder, bodyLoc, k));
+                elements.push_back(tensor::ExtractOp::create(builder, bodyLoc, operand, index));
+            }
+        }
+
+        SmallVector<SmallVector<Value>> results = computeEntry(builder, bodyLoc, entries);
+        SmallVector<Value> updated;
+        for (auto [acc, elements] : llvm::zip_equal(accs, results)) {
+            auto accType = cast<RankedTensorType>(acc.getType());
+            auto entryType = RankedTensorType::get({static_cast<int64_t>(elements.size())},
+                                                   accType.getElementType());
+            Value entry = tensor::FromElementsOp::create(builder, bodyLoc, entryType, elements);
+            SmallVector<OpFoldResult> offsets = {getEntryOffset(accType)};
+            SmallVector<OpFoldResult> sizes = {builder.getIndexAttr(elements.size())};
+            SmallVector<OpFoldResult> strides = {builder.getIndexAttr(1)};
+            updated.push_back(
+                tensor::InsertSliceOp::create(builder, bodyLoc, entry, acc, offsets, sizes, strides)
+                    .getResult());
+        }
+        scf::YieldOp::create(builder, bodyLoc, updated);
+    };
+    Value lowerBound = arith::ConstantIndexOp::create(rewriter, loc, 0);
+    Value upperBound = arith::ConstantIndexOp::create(rewriter, loc, batchSize);
+    Value step = arith::ConstantIndexOp::create(rewriter, loc, 1);
+    auto loop = scf::ForOp::create(rewriter, loc, lowerBound, upperBound, step, inits,
+                                   computeEntries);
+
+    SmallVector<Value> results;
+    for (auto [flat, type] : llvm::zip_equal(loop.getResults(), op->getResultTypes())) {
+        results.push_back(unflatten(rewriter, loc, flat, cast<RankedTensorType>(type)));
+    }
+    rewriter.replaceOp(op, results);
+}
+
+/// LU factorization with partial pivoting (getrf) of an m x n matrix. The results are the packed
+/// factors, the 1-based pivot rows and the info code.
+SmallVector<SmallVector<Value>> computeGetrf(ScalarOps &s, int64_t m, int64_t n,
+                                             ArrayRef<Value> elements)
+{
+    Matrix a = toMatrix(elements, m, n);
+    Type type = elements.front().getType();
+    Value info = s.i32(0);
+    SmallVector<Value> pivots;
+    for (int64_t k = 0; k < std::min(m, n); ++k) {
+        // Like LAPACK, the pivot is the first entry of largest magnitude on or below the diagonal
+        Value pivotRow = s.i32(k);
+        Value largest = s.abs(a[k][k]);
+        for (int64_t i = k + 1; i < m; ++i) {
+            Value magnitude = s.abs(a[i][k]);
+            Value larger = s.cmp(arith::CmpFPredicate::OGT, magnitude, largest);
+            largest = s.select(larger, magnitude, largest);
+            pivotRow = s.select(larger, s.i32(i), pivotRow);
+        }
+        pivots.push_back(arith::AddIOp::create(s.builder, s.loc, pivotRow, s.i32(1)));
+
+        SmallVector<Value> isPivot(m);
+        for (int64_t i = k + 1; i < m; ++i) {
+            isPivot[i] = s.eq(pivotRow, s.i32(i));
+        }
+        for (int64_t j = 0; j < n; ++j) {
+            Value row = a[k][j];
+            for (int64_t i = k + 1; i < m; ++i) {
+                a[k][j] = s.select(isPivot[i], a[i][j], a[k][j]);
+                a[i][j] = s.select(isPivot[i], row, a[i][j]);
+            }
+        }
+
+        // A zero pivot, whose column is then zero below the diagonal, is recorded and skipped
+        Value singular = s.cmp(arith::CmpFPredicate::OEQ, a[k][k], s.constant(type, 0.0));
+        info = s.recordFailure(info, singular, k + 1);
+        for (int64_t i = k + 1; i < m; ++i) {
+            a[i][k] = s.select(singular, a[i][k], s.div(a[i][k], a[k][k]));
+        }
+        for (int64_t i = k + 1; i < m; ++i) {
+            for (int64_t j = k + 1; j < n; ++j) {
+                a[i][j] = s.sub(a[i][j], s.mul(a[i][k], a[k][j]));
+            }
+        }
+    }
+    return {toElements(a), pivots, {info}};
+}
+
+/// Cholesky factorization (potrf) of the triangle `uplo` of an n x n matrix, which is
+/// overwritten by the factor. The other triangle is left unchanged.
+SmallVector<SmallVector<Value>> computePotrf(ScalarOps &s, char uplo, int64_t n,
+                                             ArrayRef<Value> elements)
+{
+    Matrix a = toMatrix(elements, n, n);
+    bool lower = uplo == 'L';
+    auto input = [&](int64_t i, int64_t j) { return lower ? a[i][j] : a[j][i]; };
+
+    Type type = elements.front().getType();
+    Value info = s.i32(0);
+    Matrix l(n, SmallVector<Value>(n));
+    for (int64_t j = 0; j < n; ++j) {
+        Value diagonal = input(j, j);
+        for (int64_t k = 0; k < j; ++k) {
+            diagonal = s.sub(diagonal, s.mul(l[j][k], l[j][k]));
+        }
+        // Unordered comparisons also catch NaN entries
+        Value notPositive = s.cmp(arith::CmpFPredicate::ULE, diagonal, s.constant(type, 0.0));
+        info = s.recordFailure(info, notPositive, j + 1);
+        l[j][j] = s.sqrt(diagonal);
+        for (int64_t i = j + 1; i < n; ++i) {
+            Value value = input(i, j);
+            for (int64_t k = 0; k < j; ++k) {
+                value = s.sub(value, s.mul(l[i][k], l[j][k]));
+            }
+            l[i][j] = s.div(value, l[j][j]);
+        }
+    }
+
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j <= i; ++j) {
+            (lower ? a[i][j] : a[j][i]) = l[i][j];
+        }
+    }
+    return {toElements(a), {info}};
+}
+
+/// Triangular solve (trsm) of op(A) X = B if `side` is 'L', or of X op(A) = B otherwise, for an
+/// m x n matrix B.
+SmallVector<SmallVector<Value>> computeTrsm(ScalarOps &s, char side, char uplo, char trans,
+                                            char diag, int64_t m, int64_t n,
+                                            ArrayRef<Value> aElements, ArrayRef<Value> bElements)
+{
+    bool left = side == 'L';
+    int64_t k = left ? m : n;
+    Matrix a = toMatrix(aElements, k, k);
+    Matrix b = toMatrix(bElements, m, n);
+
+    // Both cases solve M Y = C for a triangular M: M = op(A) on the left, while on the right
+    // X op(A) = B is solved as op(A)^T X^T = B^T
+    bool transposed = (trans != 'N') == left;
+    bool lower = (uplo == 'L') != transposed;
+    auto triangular = [&](int64_t i, int64_t j) { return transposed ? a[j][i] : a[i][j]; };
+    Matrix c = left ? b : transpose(b);
+    for (size_t col = 0; col < c.front().size(); ++col) {
+        for (int64_t step = 0; step < k; ++step) {
+            int64_t i = lower ? step : k - 1 - step;
+            Value value = c[i][col];
+            int64_t begin = lower ? 0 : i + 1;
+            int64_t end = lower ? i : k;
+            for (int64_t j = begin; j < end; ++j) {
+                value = s.sub(value, s.mul(triangular(i, j), c[j][col]));
+            }
+            if (diag != 'U') {
+                value = s.div(value, triangular(i, i));
+            }
+            c[i][col] = value;
+        }
+    }
+    return {toElements(left ? c : transpose(c))};
+}
+
+/// Apply the Jacobi rotation that zeroes the off-diagonal entry (p, q) of the symmetric matrix
+/// `d`, accumulating it into the eigenvectors `v`.
+void rotate(ScalarOps &s, Matrix &d, Matrix &v, int64_t p, int64_t q)
+{
+    Type type = d[p][q].getType();
+    Value zero = s.constant(type, 0.0);
+    Value one = s.constant(type, 1.0);
+
+    // The smaller root t of t^2 + 2 theta t - 1 = 0 is the tangent of the rotation angle
+    Value apq = d[p][q];
+    Value theta = s.div(s.sub(d[q][q], d[p][p]), s.mul(s.constant(type, 2.0), apq));
+    Value t = s.div(one, s.add(s.abs(theta), s.sqrt(s.add(s.mul(theta, theta), one))));
+    t = s.select(s.cmp(arith::CmpFPredicate::OLT, theta, zero), s.neg(t), t);
+    t = s.select(s.cmp(arith::CmpFPredicate::OEQ, apq, zero), zero, t);
+    Value c = s.div(one, s.sqrt(s.add(s.mul(t, t), one)));
+    Value sn = s.mul(t, c);
+
+    int64_t n = d.size();
+    for (int64_t r = 0; r < n; ++r) {
+        if (r == p || r == q) {
+            continue;
+        }
+        Value arp = d[r][p];
+        Value arq = d[r][q];
+        d[r][p] = d[p][r] = s.sub(s.mul(c, arp), s.mul(sn, arq));
+        d[r][q] = d[q][r] = s.add(s.mul(sn, arp), s.mul(c, arq));
+    }
+    d[p][p] = s.sub(d[p][p], s.mul(t, apq));
+    d[q][q] = s.add(d[q][q], s.mul(t, apq));
+    d[p][q] = d[q][p] = zero;
+
+    for (int64_t r = 0; r < n; ++r) {
+        Value vrp = v[r][p];
+        Value vrq = v[r][q];
+        v[r][p] = s.sub(s.mul(c, vrp), s.mul(sn, vrq));
+        v[r][q] = s.add(s.mul(sn, vrp), s.mul(c, vrq));
+    }
+}
+
+/// Eigendecomposition (syevd) of the symmetric n x n matrix given by its triangle `uplo`, by
+/// cyclic Jacobi iteration. The results are the eigenvectors, as columns, the eigenvalues in
+/// ascending order and the info code.
+SmallVector<SmallVector<Value>> computeSyevd(ScalarOps &s, char uplo, int64_t n,
+                                             ArrayRef<Value> elements)
+{
+    Matrix a = toMatrix(elements, n, n);
+    Type type = elements.front().getType();
+
+    // The sweeps carry the upper triangle of the matrix, followed by the eigenvectors
+    SmallVector<Value> state;
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = i; j < n; ++j) {
+            state.push_back(uplo == 'L' ? a[j][i] : a[i][j]);
+        }
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            state.push_back(s.constant(type, i == j ? 1.0 : 0.0));
+        }
+    }
+    auto unpack = [n](ValueRange values, Matrix &d, Matrix &v) {
+        d.assign(n, SmallVector<Value>(n));
+        auto it = values.begin();
+        for (int64_t i = 0; i < n; ++i) {
+            for (int64_t j = i; j < n; ++j) {
+                d[i][j] = d[j][i] = *it++;
+            }
+        }
+        v = toMatrix(SmallVector<Value>(it, values.end()), n, n);
+    };
+
+    auto sweep = [&](OpBuilder &builder, Location loc, Value, ValueRange iterArgs) {
+        ScalarOps bs{builder, loc};
+        Matrix d, v;
+        unpack(iterArgs, d, v);
+        for (int64_t p = 0; p < n; ++p) {
+            for (int64_t q = p + 1; q < n; ++q) {
+                rotate(bs, d, v, p, q);
+            }
+        }
+        SmallVector<Value> next;
+        for (int64_t i = 0; i < n; ++i) {
+            llvm::append_range(next, ArrayRef<Value>(d[i]).drop_front(i));
+        }
+        llvm::append_range(next, toElements(v));
+        scf::YieldOp::create(builder, loc, next);
+    };
+    Value lowerBound = arith::ConstantIndexOp::create(s.builder, s.loc, 0);
+    Value upperBound = arith::ConstantIndexOp::create(s.builder, s.loc, JACOBI_SWEEPS);
+    Value step = arith::ConstantIndexOp::create(s.builder, s.loc, 1);
+    auto sweeps = scf::ForOp::create(s.builder, s.loc, lowerBound, upperBound, step, state, sweep);
+
+    Matrix d, v;
+    unpack(sweeps.getResults(), d, v);
+    SmallVector<Value> w;
+    for (int64_t i = 0; i < n; ++i) {
+        w.push_back(d[i][i]);
+    }
+
+    // Sort the eigenvalues, together with the eigenvector columns, with a bubble sorting network
+    auto swapIf = [&](Value swap, Value &lhs, Value &rhs) {
+        Value first = s.select(swap, rhs, lhs);
+        rhs = s.select(swap, lhs, rhs);
+        lhs = first;
+    };
+    for (int64_t pass = 0; pass < n; ++pass) {
+        for (int64_t i = 0; i + 1 < n - pass; ++i) {
+            Value swap = s.cmp(arith::CmpFPredicate::OGT, w[i], w[i + 1]);
+            swapIf(swap, w[i], w[i + 1]);
+            for (int64_t r = 0; r < n; ++r) {
+                swapIf(swap, v[r][i], v[r][i + 1]);
+            }
+        }
+    }
+    return {toElements(v), w, {s.i32(0)}};
+}
+
+/**
+ * @brief Expand the LAPACK custom calls on small, statically shaped real matrices inline.
+ *
+ * Factorizations, triangular solves and symmetric eigendecompositions of matrices whose
+ * dimensions do not exceed `maxSize` are unrolled into scalar arithmetic, which avoids the call
+ * and memref descriptor overhead of the LAPACK kernels. Larger matrices, complex matrices and the
+ * other kernels are left to the LAPACK custom call lowering.
+ */
+struct SmallLinalgCustomCallPattern : public OpRewritePattern<stablehlo::CustomCallOp> {
+    SmallLinalgCustomCallPattern(MLIRContext *ctx, int64_t maxSize)
+        : OpRewritePattern(ctx, /*benefit=*/2), maxSize(maxSize)
+    {
+    }
+
+    LogicalResult matchAndRewrite(stablehlo::CustomCallOp op,
+                                  PatternRewriter &rewriter) const override
+    {
+        StringRef kernel = op.getCallTargetName();
+        if (!kernel.consume_front("lapack_") || !kernel.consume_back("_ffi") ||
+            !(kernel.consume_front("s") || kernel.consume_front("d"))) {
+            return failure();
+        }
+
+        // The operands are batches of small matrices, and the results are statically shaped
+        auto isStatic = [](Type type) {
+            auto tensorType = dyn_cast<RankedTensorType>(type);
+            return tensorType && tensorType.hasStaticShape() && tensorType.getNumElements() > 0;
+        };
+        auto isSmallMatrix = [&](Type type) {
+            return isStatic(type) && cast<RankedTensorType>(type).getRank() >= 2 &&
+                   llvm::all_of(cast<RankedTensorType>(type).getShape().take_back(2),
+                                [&](int64_t dim) { return dim <= maxSize; });
+        };
+        if (op->getNumOperands() == 0 || !llvm::all_of(op->getOperandTypes(), isSmallMatrix) ||
+            !llvm::all_of(op->getResultTypes(), isStatic)) {
+            return failure();
+        }
+        auto aType = cast<RankedTensorType>(op->getOperand(0).getType());
+        if (!isa<Float32Type, Float64Type>(aType.getElementType())) {
+            return failure();
+        }
+        int64_t numBatchDims = aType.getRank() - 2;
+        int64_t rows = aType.getDimSize(numBatchDims);
+        int64_t cols = aType.getDimSize(numBatchDims + 1);
+
+        auto expand = [&](auto computeEntry) {
+            LLVM_DEBUG(llvm::dbgs() << "Expanding " << op.getCallTargetName() << " inline\n");
+            replaceByBatchLoop(rewriter, op, numBatchDims,
+                               [&](OpBuilder &builder, Location loc,
+                                   ArrayRef<SmallVector<Value>> operands) {
+                                   ScalarOps s{builder, loc};
+                                   return computeEntry(s, operands);
+                               });
+            return success();
+        };
+        using Operands = ArrayRef<SmallVector<Value>>;
+
+        std::optional<char> uplo = getCharOption(op, "uplo");
+        if (kernel == "getrf" && op->getNumResults() == 3) {
+            return expand([&](ScalarOps &s, Operands operands) {
+                return computeGetrf(s, rows, cols, operands[0]);
+            });
+        }
+        if (kernel == "potrf" && op->getNumResults() == 2 && rows == cols && uplo) {
+            return expand([&](ScalarOps &s, Operands operands) {
+                return computePotrf(s, *uplo, rows, operands[0]);
+            });
+        }
+        if (kernel == "syevd" && op->getNumResults() == 3 && rows == cols && uplo) {
+            return expand([&](ScalarOps &s, Operands operands) {
+                return computeSyevd(s, *uplo, rows, operands[0]);
+            });
+        }
+
+        std::optional<char> side = getCharOption(op, "side");
+        std::optional<char> trans = getCharOption(op, "trans_x");
+        std::optional<char> diag = getCharOption(op, "diag");
+        if (kernel == "trsm" && op->getNumOperands() == 2 && uplo && side && trans && diag) {
+            auto bType = cast<RankedTensorType>(op->getOperand(1).getType());
+            if (bType.getShape().drop_back(2) != aType.getShape().drop_back(2)) {
+                return failure();
+            }
+            int64_t m = bType.getDimSize(numBatchDims);
+            int64_t n = bType.getDimSize(numBatchDims + 1);
+            if (rows != cols || rows != (*side == 'L' ? m : n)) {
+                return failure();
+            }
+            return expand([&](ScalarOps &s, Operands operands) {
+                return computeTrsm(s, *side, *uplo, *trans, *diag, m, n, operands[0], operands[1]);
+            });
+        }
+        return failure();
+    }
+
+  private:
+    int64_t maxSize;
+};
+
+} // namespace
+
+namespace catalyst {
+namespace hlo_extensions {
+
+void populateSmallLinalgPatterns(RewritePatternSet &patterns, int64_t maxSize)
+{
+    patterns.add<SmallLinalgCustomCallPattern>(patterns.getContext(), maxSize);
+}
+
+} // namespace hlo_extensions
+} // namespace catalyst
@@ -17,8 +17,12 @@
 #include <vector>
 
 #include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/Index/IR/IndexDialect.h"
+#include "mlir/Dialect/Math/IR/Math.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 #include "stablehlo/dialect/StablehloOps.h"
@@ -46,6 +50,9 @@ struct HloCustomCallLoweringPass : impl::HloCustomCallLoweringPassBase<HloCustom
                           << "\n");
 
         RewritePatternSet patterns(&getContext());
+        if (maxInlineSize > 0) {
+            populateSmallLinalgPatterns(patterns, maxInlineSize);
+        }
         populateHloCustomCallPatterns(patterns);
         if (failed(applyPatternsGreedily(getOperation(), std::move(patterns)))) {
             return signalPassFailure();
@@ -34,26 +34,32 @@ limitations under the License.
 ==============================================================================*/
 
 // The modifications are porting the pass from the upstream stablehlo namespace to
-// catalyst namespace.
+// catalyst namespace, and lowering single-key numeric sorts to calls to the sort kernels of the
+// custom calls library.
 
 // This file implements logic for lowering stablehlo.sort to the SCF dialect.
 #include <iterator>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/Arith/Utils/Utils.h"
 #include "mlir/Dialect/Bufferization/IR/Bufferization.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h" // TF:llvm-project
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
 #include "mlir/IR/Block.h"
 #include "mlir/IR/Builders.h"
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/IR/IRMapping.h"
 #include "mlir/IR/ImplicitLocOpBuilder.h"
 #include "mlir/IR/Location.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/TypeRange.h"
 #include "mlir/IR/ValueRange.h"
@@ -65,6 +71,8 @@ limitations under the License.
 #include "stablehlo/transforms/Passes.h"
 #include "llvm/ADT/STLExtras.h"
 
+#include "Catalyst/IR/CatalystOps.h"
+
 using namespace mlir;
 using namespace stablehlo;
 
@@ -559,6 +567,284 @@ struct SortOpPattern : public OpRewritePattern<SortOp> {
     }
 };
 
+// The order of a sort, as defined by a comparator comparing the first operands.
+struct SortOrder {
+    bool descending;
+    // Floats are in total order rather than numeric order, integers unsigned rather than signed
+    bool alternateOrder;
+};
+
+// The index of the comparator argument that `value` is, or is the element of. The canonicalization
+// of floats of JAX, replacing -0.0 by 0.0 and all NaNs by the same NaN with selects of constants,
+// is looked through, in which case `canonicalized` is set.
+std::optional<unsigned> getComparatorArgIndex(Value value, Block &comparatorBlock,
+                                              bool &canonicalized)
+{
+    while (true) {
+        if (auto arg = dyn_cast<BlockArgument>(value)) {
+            if (arg.getOwner() == &comparatorBlock) {
+                return arg.getArgNumber();
+            }
+            // The arguments of a rank-0 linalg.generic stand for its inputs
+            auto genericOp = dyn_cast<linalg::GenericOp>(arg.getOwner()->getParentOp());
+            if (!genericOp || arg.getArgNumber() >= genericOp.getNumDpsInputs()) {
+                return std::nullopt;
+            }
+            value = genericOp.getDpsInputs()[arg.getArgNumber()];
+            continue;
+        }
+
+        Operation *op = value.getDefiningOp();
+        if (auto extractOp = dyn_cast<tensor::ExtractOp>(op)) {
+            value = extractOp.getTensor();
+        }
+        else if (auto fromElementsOp = dyn_cast<tensor::FromElementsOp>(op)) {
+            value = fromElementsOp.getElements().front();
+        }
+        else if (auto genericOp = dyn_cast<linalg::GenericOp>(op)) {
+            if (genericOp.getNumLoops() != 0) {
+                return std::nullopt;
+            }
+            auto yieldOp = cast<linalg::YieldOp>(genericOp.getBody()->getTerminator());
+            value = yieldOp.getOperand(cast<OpResult>(value).getResultNumber());
+        }
+        else if (isa<arith::SelectOp, stablehlo::SelectOp>(op) &&
+                 matchPattern(op->getOperand(1), m_Constant())) {
+            value = op->getOperand(2);
+            canonicalized = true;
+        }
+        else {
+            return std::nullopt;
+        }
+    }
+}
+
+// The order of a comparator comparing the first operands with a single comparison, e.g.
+//
+//   ^bb0(%lhs: tensor<f64>, %rhs: tensor<f64>, ...):
+//     %0 = arith.cmpf olt, %lhs, %rhs : tensor<f64>
+//     stablehlo.return %0 : tensor<i1>
+//
+// where the comparison may also be a stablehlo.compare, or be on the elements of the operands.
+std::optional<SortOrder> getSortOrder(Region &comparator)
+{
+    if (!comparator.hasOneBlock()) {
+        return std::nullopt;
+    }
+    Block &block = comparator.front();
+    Value result = block.getTerminator()->getOperand(0);
+    if (auto fromElementsOp = result.getDefiningOp<tensor::FromElementsOp>()) {
+        result = fromElementsOp.getElements().front();
+    }
+    if (auto genericOp = result.getDefiningOp<linalg::GenericOp>()) {
+        if (genericOp.getNumLoops() != 0) {
+            return std::nullopt;
+        }
+        result = cast<linalg::YieldOp>(genericOp.getBody()->getTerminator()).getOperand(0);
+    }
+    Operation *comparison = result.getDefiningOp();
+    if (!comparison || comparison->getNumOperands() != 2) {
+        return std::nullopt;
+    }
+    bool canonicalized = false;
+    std::optional<unsigned> lhs =
+        getComparatorArgIndex(comparison->getOperand(0), block, canonicalized);
+    std::optional<unsigned> rhs =
+        getComparatorArgIndex(comparison->getOperand(1), block, canonicalized);
+    bool swapped = lhs == 1 && rhs == 0;
+    if (!swapped && !(lhs == 0 && rhs == 1)) {
+        return std::nullopt;
+    }
+
+    std::optional<SortOrder> order;
+    if (auto cmpFOp = dyn_cast<arith::CmpFOp>(comparison)) {
+        switch (cmpFOp.getPredicate()) {
+        case arith::CmpFPredicate::OLT:
+        case arith::CmpFPredicate::ULT:
+            order = SortOrder{/*descending=*/false, /*alternateOrder=*/false};
+            break;
+        case arith::CmpFPredicate::OGT:
+        case arith::CmpFPredicate::UGT:
+            order = SortOrder{/*descending=*/true, /*alternateOrder=*/false};
+            break;
+        default:
+            break;
+        }
+    }
+    else if (auto cmpIOp = dyn_cast<arith::CmpIOp>(comparison)) {
+        switch (cmpIOp.getPredicate()) {
+        case arith::CmpIPredicate::slt:
+            order = SortOrder{/*descending=*/false, /*alternateOrder=*/false};
+            break;
+        case arith::CmpIPredicate::sgt:
+            order = SortOrder{/*descending=*/true, /*alternateOrder=*/false};
+            break;
+        case arith::CmpIPredicate::ult:
+            order = SortOrder{/*descending=*/false, /*alternateOrder=*/true};
+            break;
+        case arith::CmpIPredicate::ugt:
+            order = SortOrder{/*descending=*/true, /*alternateOrder=*/true};
+            break;
+        default:
+            break;
+        }
+    }
+    else if (auto compareOp = dyn_cast<stablehlo::CompareOp>(comparison)) {
+        std::optional<ComparisonType> compareType = compareOp.getCompareType();
+        // The total order of canonicalized floats is the numeric order of the kernels
+        bool alternateOrder =
+            (compareType == ComparisonType::TOTALORDER && !canonicalized) ||
+            compareType == ComparisonType::UNSIGNED;
+        if (compareOp.getComparisonDirection() == ComparisonDirection::LT) {
+            order = SortOrder{/*descending=*/false, alternateOrder};
+        }
+        else if (compareOp.getComparisonDirection() == ComparisonDirection::GT) {
+            order = SortOrder{/*descending=*/true, alternateOrder};
+        }
+    }
+
+    if (order && swapped) {
+        order->descending = !order->descending;
+    }
+    return order;
+}
+
+// The name of the sort kernel for keys and an optional payload of the given element types, e.g.
+// catalyst_sort_f64_i32 for the arguments of jnp.argsort.
+std::optional<std::string> getSortKernelName(Type keyType, Type payloadType)
+{
+    auto getTypeName = [](Type type) -> std::optional<std::string> {
+        if (type.isF32()) {
+            return "f32";
+        }
+        if (type.isF64()) {
+            return "f64";
+        }
+        if (type.isSignlessInteger(32)) {
+            return "i32";
+        }
+        if (type.isSignlessInteger(64)) {
+            return "i64";
+        }
+        return std::nullopt;
+    };
+
+    std::optional<std::string> keyName = getTypeName(keyType);
+    if (!keyName) {
+        return std::nullopt;
+    }
+    std::string name = "catalyst_sort_" + *keyName;
+    if (payloadType) {
+        if (!payloadType.isSignlessInteger(32) && !payloadType.isSignlessInteger(64)) {
+            return std::nullopt;
+        }
+        name += "_" + *getTypeName(payloadType);
+    }
+    return name;
+}
+
+// The number of leading elements of the sorted rows that are used, when the results are only
+// used by slices of leading elements, as in lax.top_k, and the size of the rows otherwise.
+int64_t getUsedPrefixSize(SortOp op, int64_t rowSize)
+{
+    int64_t sortDim = op.getDimension();
+    int64_t prefixSize = 0;
+    for (Value result : op.getResults()) {
+        for (Operation *user : result.getUsers()) {
+            auto sliceOp = dyn_cast<tensor::ExtractSliceOp>(user);
+            if (!sliceOp) {
+                return rowSize;
+            }
+            std::optional<int64_t> offset = getConstantIntValue(sliceOp.getMixedOffsets()[sortDim]);
+            std::optional<int64_t> size = getConstantIntValue(sliceOp.getMixedSizes()[sortDim]);
+            std::optional<int64_t> stride = getConstantIntValue(sliceOp.getMixedStrides()[sortDim]);
+            if (offset != 0 || !size || stride != 1) {
+                return rowSize;
+            }
+            prefixSize = std::max(prefixSize, *size);
+        }
+    }
+    return prefixSize > 0 ? prefixSize : rowSize;
+}
+
+/**
+ * @brief Lower single-key numeric sorts to a call to a sort kernel of the custom calls library.
+ *
+ * The sorts along the last, static dimension of f32, f64, i32 or i64 keys, with an optional i32
+ * or i64 payload permuted with the keys as in jnp.argsort, are sorted by a radix sort at runtime
+ * instead of the merge sort emitted by SortOpPattern. When the results are only used by slices
+ * of the first elements of the sorted rows, as in lax.top_k, the kernel only sorts these first
+ * elements, and the slices are taken from the smaller sorted rows.
+ */
+struct NumericSortOpPattern : public OpRewritePattern<SortOp> {
+    NumericSortOpPattern(MLIRContext *context) : OpRewritePattern(context, /*benefit=*/2) {}
+
+    LogicalResult matchAndRewrite(SortOp op, PatternRewriter &rewriter) const override
+    {
+        if (op.getNumOperands() > 2) {
+            return failure();
+        }
+        auto keyType = dyn_cast<RankedTensorType>(op.getOperand(0).getType());
+        if (!keyType || !keyType.hasStaticShape() || keyType.getRank() == 0 ||
+            static_cast<int64_t>(op.getDimension()) != keyType.getRank() - 1 ||
+            keyType.getNumElements() == 0) {
+            return failure();
+        }
+        Type payloadType;
+        if (op.getNumOperands() == 2) {
+            payloadType = cast<ShapedType>(op.getOperand(1).getType()).getElementType();
+        }
+        std::optional<std::string> kernelName =
+            getSortKernelName(keyType.getElementType(), payloadType);
+        std::optional<SortOrder> order = getSortOrder(op.getComparator());
+        if (!kernelName || !order) {
+            return failure();
+        }
+
+        Location loc = op.getLoc();
+        int64_t rowSize = keyType.getShape().back();
+        int64_t batchSize = keyType.getNumElements() / rowSize;
+        int64_t prefixSize = getUsedPrefixSize(op, rowSize);
+
+        auto makeConst = [&](int64_t val) -> Value {
+            auto type = RankedTensorType::get({}, rewriter.getI32Type());
+            auto attr = DenseElementsAttr::get(type, APInt(32, static_cast<uint64_t>(val)));
+            return arith::ConstantOp::create(rewriter, loc, attr);
+        };
+        SmallVector<Value> operands = {makeConst(batchSize), makeConst(rowSize),
+                                       makeConst(prefixSize), makeConst(order->descending),
+                                       makeConst(order->alternateOrder)};
+        llvm::append_range(operands, op.getOperands());
+
+        SmallVector<Type> resultTypes;
+        for (Value input : op.getOperands()) {
+            auto inputType = cast<RankedTensorType>(input.getType());
+            SmallVector<int64_t> shape(inputType.getShape());
+            shape.back() = prefixSize;
+            resultTypes.push_back(RankedTensorType::get(shape, inputType.getElementType()));
+        }
+        auto callOp = catalyst::CustomCallOp::create(rewriter, loc, resultTypes, operands,
+                                                     rewriter.getStringAttr(*kernelName),
+                                                     /*number_original_arg=*/nullptr);
+        if (prefixSize == rowSize) {
+            rewriter.replaceOp(op, callOp.getResults());
+            return success();
+        }
+
+        // Take the slices of leading elements from the sorted prefixes instead
+        for (auto [result, prefix] : llvm::zip(op.getResults(), callOp.getResults())) {
+            for (Operation *user : llvm::make_early_inc_range(result.getUsers())) {
+                auto sliceOp = cast<tensor::ExtractSliceOp>(user);
+                rewriter.replaceOpWithNewOp<tensor::ExtractSliceOp>(
+                    sliceOp, sliceOp.getType(), prefix, sliceOp.getMixedOffsets(),
+                    sliceOp.getMixedSizes(), sliceOp.getMixedStrides());
+            }
+        }
+        rewriter.eraseOp(op);
+        return success();
+    }
+};
+
 } // namespace
 
 namespace catalyst {
@@ -576,7 +862,7 @@ struct StablehloLegalizeSortPass
         MLIRContext *ctx = f.getContext();
 
         RewritePatternSet patterns(ctx);
-        patterns.add<SortOpPattern>(ctx);
+        patterns.add<SortOpPattern, NumericSortOpPattern>(ctx);
 
         mlir::ConversionTarget target(*ctx);
         target.markUnknownOpDynamicallyLegal([](Operation *) { return true; });
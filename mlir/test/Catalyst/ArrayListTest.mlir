@@ -48,3 +48,48 @@ func.func @list_load_data(%arg0: !catalyst.arraylist<f64>) -> memref<?xf64> {
     return %data : memref<?xf64>
     // CHECK: return [[view]]
 }
+
+// -----
+
+// The initial capacity is the number of pushes to a list, if it is known statically
+
+// CHECK-LABEL: func.func @list_init_static_pushes
+func.func @list_init_static_pushes(%arg0: f64, %arg1: i1) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c2 = arith.constant 2 : index
+    %c10 = arith.constant 10 : index
+    // CHECK: [[capacity:%.+]] = arith.constant 61 : index
+    // CHECK: memref.alloc([[capacity]]) : memref<?xf64>
+    %list = catalyst.list_init : !catalyst.arraylist<f64>
+    scf.for %i = %c0 to %c10 step %c1 {
+        catalyst.list_push %arg0, %list : !catalyst.arraylist<f64>
+        scf.for %j = %c0 to %c10 step %c2 {
+            scf.if %arg1 {
+                catalyst.list_push %arg0, %list : !catalyst.arraylist<f64>
+            }
+        }
+    }
+    catalyst.list_push %arg0, %list : !catalyst.arraylist<f64>
+    %0 = catalyst.list_pop %list : !catalyst.arraylist<f64>
+    catalyst.list_dealloc %list : !catalyst.arraylist<f64>
+    return
+}
+
+// -----
+
+// The default capacity is used for pushes in loops of unknown trip counts
+
+// CHECK-LABEL: func.func @list_init_dynamic_pushes
+func.func @list_init_dynamic_pushes(%arg0: f64, %arg1: index) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    // CHECK: [[capacity:%.+]] = arith.constant 32 : index
+    // CHECK: memref.alloc([[capacity]]) : memref<?xf64>
+    %list = catalyst.list_init : !catalyst.arraylist<f64>
+    scf.for %i = %c0 to %arg1 step %c1 {
+        catalyst.list_push %arg0, %list : !catalyst.arraylist<f64>
+    }
+    catalyst.list_dealloc %list : !catalyst.arraylist<f64>
+    return
+}
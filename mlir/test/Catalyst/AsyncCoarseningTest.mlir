@@ -0,0 +1,126 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --qnode-to-async-lowering="coarsen max-merged-size=8" --split-input-file %s | FileCheck %s
+
+// Consecutive calls to small independent qnodes are merged into one task, which stays async
+// because another qnode is called before the results are used.
+
+module @merge {
+  func.func private @f() -> memref<2xf64> attributes {qnode} {
+    %0 = memref.alloc() : memref<2xf64>
+    return %0 : memref<2xf64>
+  }
+
+  func.func private @big() -> memref<2xf64> attributes {qnode} {
+    %0 = memref.alloc() : memref<2xf64>
+    %1 = memref.alloc() : memref<2xf64>
+    %2 = memref.alloc() : memref<2xf64>
+    %3 = memref.alloc() : memref<2xf64>
+    %4 = memref.alloc() : memref<2xf64>
+    %5 = memref.alloc() : memref<2xf64>
+    %6 = memref.alloc() : memref<2xf64>
+    %7 = memref.alloc() : memref<2xf64>
+    return %7 : memref<2xf64>
+  }
+
+  // CHECK-LABEL: @jit_merge
+  func.func public @jit_merge() -> (memref<2xf64>, memref<2xf64>, memref<2xf64>) {
+    // CHECK:      [[token:%.+]], [[results:%.+]]:2 = async.execute
+    // CHECK-NEXT:   [[f0:%.+]] = call @f()
+    // CHECK-NEXT:   [[f1:%.+]] = call @f()
+    // CHECK-NEXT:   async.yield [[f0]], [[f1]]
+    // CHECK-NOT:  async.execute
+    // CHECK:      [[big:%.+]] = call @big()
+    // CHECK:      [[value0:%.+]] = async.await [[results]]#0
+    // CHECK:      [[value1:%.+]] = async.await [[results]]#1
+    // CHECK:      return [[value0]], [[value1]], [[big]]
+    %0 = call @f() : () -> memref<2xf64>
+    %1 = call @f() : () -> memref<2xf64>
+    %2 = call @big() : () -> memref<2xf64>
+    return %0, %1, %2 : memref<2xf64>, memref<2xf64>, memref<2xf64>
+  }
+}
+
+// -----
+
+// A call whose results are used before any other qnode is called stays synchronous.
+
+module @single {
+  func.func private @f() -> memref<2xf64> attributes {qnode} {
+    %0 = memref.alloc() : memref<2xf64>
+    return %0 : memref<2xf64>
+  }
+
+  // CHECK-LABEL: @jit_single
+  func.func public @jit_single() -> memref<2xf64> {
+    // CHECK-NOT: async.execute
+    // CHECK:     [[value:%.+]] = call @f() {transformed}
+    // CHECK-NOT: async.await
+    // CHECK:     return [[value]]
+    %0 = call @f() : () -> memref<2xf64>
+    return %0 : memref<2xf64>
+  }
+}
+
+// -----
+
+// A call using the results of another is not merged with it, and both stay synchronous.
+
+module @dependent {
+  func.func private @g(%arg0: memref<2xf64>) -> memref<2xf64> attributes {qnode} {
+    return %arg0 : memref<2xf64>
+  }
+
+  // CHECK-LABEL: @jit_dependent
+  func.func public @jit_dependent(%arg0: memref<2xf64>) -> memref<2xf64> {
+    // CHECK-NOT: async.execute
+    // CHECK:     [[first:%.+]] = call @g(%arg0)
+    // CHECK:     [[second:%.+]] = call @g([[first]])
+    // CHECK:     return [[second]]
+    %0 = call @g(%arg0) : (memref<2xf64>) -> memref<2xf64>
+    %1 = call @g(%0) : (memref<2xf64>) -> memref<2xf64>
+    return %1 : memref<2xf64>
+  }
+}
+
+// -----
+
+// A call stays async when a qnode is called in a loop before its results are used, while the
+// call in the loop is the only task in flight.
+
+module @loop {
+  func.func private @f() -> memref<2xf64> attributes {qnode} {
+    %0 = memref.alloc() : memref<2xf64>
+    return %0 : memref<2xf64>
+  }
+
+  // CHECK-LABEL: @jit_loop
+  func.func public @jit_loop(%arg0: index) -> memref<2xf64> {
+    // CHECK:     [[token:%.+]], [[results:%.+]] = async.execute
+    // CHECK:       call @f()
+    // CHECK:     scf.for
+    // CHECK-NOT:   async.execute
+    // CHECK:       call @f() {transformed}
+    // CHECK:     [[value:%.+]] = async.await [[results]]
+    // CHECK:     return [[value]]
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %0 = call @f() : () -> memref<2xf64>
+    scf.for %i = %c0 to %arg0 step %c1 {
+      %1 = call @f() : () -> memref<2xf64>
+    }
+    return %0 : memref<2xf64>
+  }
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 // RUN: quantum-opt --add-exception-handling=stop-after-step=3 --verify-diagnostics --split-input-file %s | FileCheck %s
+// RUN: quantum-opt --add-exception-handling="stop-after-step=3 cold-error-paths=true" --verify-diagnostics --split-input-file %s | FileCheck %s --check-prefix=COLD
 
 module {
 
@@ -136,3 +137,50 @@ module @remove_puts {
     llvm.return
   }
 }
+
+// -----
+
+// CHECK-LABEL: @cold_error_paths
+// COLD-LABEL: @cold_error_paths
+module @cold_error_paths {
+
+  // Check that the error paths are weighted as unlikely and the error function is cold
+  llvm.func internal @async_execute_fn() -> !llvm.ptr attributes { catalyst.preHandleError } {
+    %0 = llvm.mlir.zero : !llvm.ptr
+    llvm.return %0 : !llvm.ptr
+  }
+
+  llvm.func internal @async_execute_fn2() -> !llvm.ptr attributes { catalyst.preHandleError } {
+    %0 = llvm.mlir.zero : !llvm.ptr
+    llvm.return %0 : !llvm.ptr
+  }
+
+  llvm.func @mlirAsyncRuntimeIsTokenError(!llvm.ptr) -> i1
+  llvm.func @abort() -> ()
+
+  // COLD: llvm.func @__catalyst__host__rt__unrecoverable_error() attributes {passthrough = ["cold"]}
+
+  // CHECK-NOT: weights
+  // COLD-LABEL: llvm.func @caller
+  llvm.func @caller() {
+    %0 = llvm.call @async_execute_fn() : () -> (!llvm.ptr)
+    %1 = llvm.call @mlirAsyncRuntimeIsTokenError(%0) : (!llvm.ptr) -> i1
+    %2 = llvm.mlir.constant(1 : i64) : i1
+    %3 = llvm.xor %1, %2: i1
+    // COLD: llvm.cond_br %{{.*}} weights([1, 2000]), ^{{.+}}, ^{{.+}}
+    llvm.cond_br %3, ^fail, ^success
+    ^fail:
+    llvm.call @abort() : () -> ()
+    llvm.unreachable
+    ^success:
+    %4 = llvm.call @async_execute_fn2() : () -> (!llvm.ptr)
+    %5 = llvm.call @mlirAsyncRuntimeIsTokenError(%4) : (!llvm.ptr) -> i1
+    // COLD: llvm.cond_br %{{.*}} weights([2000, 1]), ^{{.+}}, ^{{.+}}
+    llvm.cond_br %5, ^success2, ^fail2
+    ^fail2:
+    llvm.call @abort() : () -> ()
+    llvm.unreachable
+    ^success2:
+    llvm.return
+  }
+}
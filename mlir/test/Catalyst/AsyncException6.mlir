@@ -0,0 +1,32 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --add-exception-handling=stop-after-step=6 --verify-diagnostics --split-input-file %s | FileCheck %s
+
+module {
+
+  // Check that async regions are scheduled on the Catalyst runtime executor.
+  // CHECK-DAG: llvm.func @__catalyst__rt__async_execute(!llvm.ptr, !llvm.ptr)
+  llvm.func @mlirAsyncRuntimeExecute(!llvm.ptr, !llvm.ptr) -> ()
+
+  // CHECK-LABEL: @schedule
+  llvm.func @schedule(%handle: !llvm.ptr, %resume: !llvm.ptr) {
+    // CHECK-NOT: llvm.call @mlirAsyncRuntimeExecute
+    // CHECK: llvm.call @__catalyst__rt__async_execute(%arg0, %arg1)
+    // CHECK-NOT: llvm.call @mlirAsyncRuntimeExecute
+    llvm.call @mlirAsyncRuntimeExecute(%handle, %resume) : (!llvm.ptr, !llvm.ptr) -> ()
+    llvm.return
+  }
+
+}
@@ -0,0 +1,118 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --batch-callbacks --split-input-file %s | FileCheck %s
+
+// The arguments of all iterations are stacked ahead of the loop, and a single batched call
+// computes the results of all of them.
+
+// CHECK-LABEL: @test_batch
+module @test_batch {
+  // CHECK: catalyst.callback @callback_1(tensor<f64>) -> tensor<2xf64>
+  // CHECK: catalyst.callback @callback_1_batch_4(tensor<4xf64>) -> tensor<4x2xf64>
+  // CHECK-SAME: batched
+  // CHECK-SAME: id = 1
+  catalyst.callback @callback_1(tensor<f64>) -> tensor<2xf64> attributes {argc = 1 : i64, id = 1 : i64, resc = 1 : i64}
+
+  // CHECK-LABEL: func.func @loop(
+  // CHECK-SAME: [[x:%.+]]: tensor<f64>
+  func.func @loop(%x: tensor<f64>, %init: tensor<2xf64>) -> tensor<2xf64> {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c4 = arith.constant 4 : index
+    // CHECK: [[empty:%.+]] = tensor.empty() : tensor<4xf64>
+    // CHECK: [[stacked:%.+]] = scf.for [[i:%.+]] = {{.*}} iter_args([[acc:%.+]] = [[empty]])
+    // CHECK:   [[arg:%.+]] = arith.addf [[x]]
+    // CHECK:   [[k:%.+]] = arith.divui
+    // CHECK:   [[inserted:%.+]] = tensor.insert_slice [[arg]] into [[acc]]{{\[}}[[k]]{{\]}} [1] [1] : tensor<f64> into tensor<4xf64>
+    // CHECK:   scf.yield [[inserted]]
+    // CHECK: [[results:%.+]] = catalyst.callback_call @callback_1_batch_4([[stacked]]) : (tensor<4xf64>) -> tensor<4x2xf64>
+    // CHECK: scf.for
+    // CHECK-NOT: catalyst.callback_call
+    // CHECK-NOT: arith.addf
+    // CHECK:   [[j:%.+]] = arith.divui
+    // CHECK:   [[result:%.+]] = tensor.extract_slice [[results]]{{\[}}[[j]], 0] [1, 2] [1, 1] : tensor<4x2xf64> to tensor<2xf64>
+    // CHECK:   arith.addf {{.*}}[[result]]
+    %r = scf.for %i = %c0 to %c4 step %c1 iter_args(%acc = %init) -> (tensor<2xf64>) {
+      %i64 = arith.index_cast %i : index to i64
+      %f = arith.sitofp %i64 : i64 to f64
+      %t = tensor.from_elements %f : tensor<f64>
+      %arg = arith.addf %x, %t : tensor<f64>
+      %y = catalyst.callback_call @callback_1(%arg) : (tensor<f64>) -> tensor<2xf64>
+      %next = arith.addf %acc, %y : tensor<2xf64>
+      scf.yield %next : tensor<2xf64>
+    }
+    return %r : tensor<2xf64>
+  }
+}
+
+// -----
+
+// Callbacks whose arguments depend on previous iterations are not batched.
+
+// CHECK-LABEL: @test_loop_carried
+module @test_loop_carried {
+  // CHECK-NOT: batched
+  catalyst.callback @callback_1(tensor<f64>) -> tensor<f64> attributes {argc = 1 : i64, id = 1 : i64, resc = 1 : i64}
+
+  func.func @loop(%init: tensor<f64>) -> tensor<f64> {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c4 = arith.constant 4 : index
+    // CHECK: scf.for
+    // CHECK:   catalyst.callback_call @callback_1(
+    %r = scf.for %i = %c0 to %c4 step %c1 iter_args(%acc = %init) -> (tensor<f64>) {
+      %y = catalyst.callback_call @callback_1(%acc) : (tensor<f64>) -> tensor<f64>
+      scf.yield %y : tensor<f64>
+    }
+    return %r : tensor<f64>
+  }
+}
+
+// -----
+
+// Callbacks with a custom gradient, and loops with dynamic bounds, are not batched.
+
+// CHECK-LABEL: @test_not_batched
+module @test_not_batched {
+  // CHECK-NOT: batched
+  catalyst.callback @callback_1(tensor<f64>) -> tensor<f64> attributes {argc = 1 : i64, id = 1 : i64, resc = 1 : i64}
+  catalyst.callback @callback_2(tensor<f64>) -> tensor<f64> attributes {argc = 1 : i64, id = 2 : i64, resc = 1 : i64}
+  catalyst.callback @callback_3(tensor<f64>, tensor<f64>) -> tensor<f64> attributes {argc = 2 : i64, id = 3 : i64, resc = 1 : i64}
+  catalyst.callback @callback_4(tensor<f64>) -> tensor<f64> attributes {argc = 1 : i64, id = 4 : i64, resc = 1 : i64}
+  gradient.custom_grad @callback_1 @callback_2 @callback_3
+
+  func.func @custom_grad(%x: tensor<f64>) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c4 = arith.constant 4 : index
+    // CHECK: scf.for
+    // CHECK:   catalyst.callback_call @callback_1(
+    scf.for %i = %c0 to %c4 step %c1 {
+      %y = catalyst.callback_call @callback_1(%x) : (tensor<f64>) -> tensor<f64>
+    }
+    return
+  }
+
+  func.func @dynamic(%x: tensor<f64>, %n: index) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    // CHECK: scf.for
+    // CHECK:   catalyst.callback_call @callback_4(
+    scf.for %i = %c0 to %n step %c1 {
+      %y = catalyst.callback_call @callback_4(%x) : (tensor<f64>) -> tensor<f64>
+    }
+    return
+  }
+}
@@ -19,7 +19,7 @@
 //////////////////////////
 
 // CHECK-DAG: llvm.mlir.global internal constant @[[hash:["0-9]+]]("Test Message")
-// CHECK-DAG: llvm.func @__catalyst__rt__assert_bool(i1, !llvm.ptr)
+// CHECK-DAG: llvm.func @__catalyst__rt__assert_bool(i1, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 func.func @assert_constant(%arg0: i1, %arg1: !llvm.ptr) {
     // CHECK: [[array_ptr:%.+]] = llvm.mlir.addressof @[[hash]] : !llvm.ptr
@@ -36,7 +36,7 @@ func.func @assert_constant(%arg0: i1, %arg1: !llvm.ptr) {
 // Catalyst PrintOp //
 //////////////////////
 
-// CHECK-DAG: llvm.func @__catalyst__rt__print_tensor(!llvm.ptr, i1)
+// CHECK-DAG: llvm.func @__catalyst__rt__print_tensor(!llvm.ptr {llvm.nocapture, llvm.readonly}, i1)
 
 // CHECK-LABEL: @dbprint_val
 func.func @dbprint_val(%arg0 : memref<1xi64>) {
@@ -81,7 +81,7 @@ func.func @dbprint_val(%arg0 : memref<1xi64>) {
 // -----
 
 // CHECK-DAG: llvm.mlir.global internal constant @[[hash:["0-9]+]]("Hello, Catalyst")
-// CHECK-DAG: llvm.func @__catalyst__rt__print_string(!llvm.ptr)
+// CHECK-DAG: llvm.func @__catalyst__rt__print_string(!llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @dbprint_str
 func.func @dbprint_str() {
@@ -138,6 +138,27 @@ module @test0 {
 
 // -----
 
+// CHECK-LABEL: @test_batched
+module @test_batched {
+
+  // Batched callbacks also pass the ranks of their stacked arguments and results.
+  // CHECK-LABEL: func.func private @callback_4_batch_3(
+  // CHECK-DAG: [[id:%.+]] = llvm.mlir.constant(4
+  // CHECK-DAG: [[argc:%.+]] = llvm.mlir.constant(1
+  // CHECK-DAG: [[resc:%.+]] = llvm.mlir.constant(1
+  // CHECK-DAG: [[ranks:%.+]] = llvm.alloca {{.*}} x i64
+  // CHECK-DAG: [[rank0:%.+]] = llvm.mlir.constant(1 : i64)
+  // CHECK-DAG: [[rank1:%.+]] = llvm.mlir.constant(2 : i64)
+  // CHECK-DAG: [[ptr0:%.+]] = llvm.getelementptr inbounds [[ranks]][0]
+  // CHECK-DAG: llvm.store [[rank0]], [[ptr0]]
+  // CHECK-DAG: [[ptr1:%.+]] = llvm.getelementptr inbounds [[ranks]][1]
+  // CHECK-DAG: llvm.store [[rank1]], [[ptr1]]
+  // CHECK: llvm.call @__catalyst_inactive_batched_callback([[id]], [[argc]], [[resc]], [[ranks]]
+  catalyst.callback @callback_4_batch_3(memref<3xf64>, memref<3x2xf64>) attributes {argc = 1 : i64, batched, id = 4 : i64, resc = 1 : i64}
+}
+
+// -----
+
 // CHECK-LABEL: @test1
 module @test1 {
   catalyst.callback @callback_1(memref<f64>, memref<f64>) attributes {argc = 1 : i64, id = 1 : i64, resc = 1 : i64}
@@ -142,3 +142,35 @@ module {
     return %a : tensor<i64>
   }
 }
+
+// -----
+
+// QNodes are only detensorized if no gradient op may differentiate them
+
+// CHECK-LABEL: func.func @main(
+// CHECK:         call @circuit.detensorized({{%.+}}) : (f64) -> f64
+// CHECK:         gradient.grad "auto" @differentiated
+// CHECK-LABEL: func.func private @differentiated(
+// CHECK:         call @differentiated_circuit({{%.+}}) : (tensor<f64>) -> tensor<f64>
+// CHECK-LABEL: func.func private @circuit.detensorized(
+// CHECK-SAME:                              {{%.+}}: f64
+// CHECK-SAME:                            ) -> f64 attributes {qnode}
+module {
+  func.func @main(%arg0: f64) -> (f64, tensor<f64>) {
+    %tensor_arg = tensor.from_elements %arg0 : tensor<f64>
+    %result_tensor = func.call @circuit(%tensor_arg) : (tensor<f64>) -> tensor<f64>
+    %result_scalar = tensor.extract %result_tensor[] : tensor<f64>
+    %grad = gradient.grad "auto" @differentiated(%tensor_arg) : (tensor<f64>) -> tensor<f64>
+    return %result_scalar, %grad : f64, tensor<f64>
+  }
+  func.func private @differentiated(%arg0: tensor<f64>) -> tensor<f64> {
+    %0 = func.call @differentiated_circuit(%arg0) : (tensor<f64>) -> tensor<f64>
+    return %0 : tensor<f64>
+  }
+  func.func private @circuit(%arg0: tensor<f64>) -> tensor<f64> attributes {qnode} {
+    return %arg0 : tensor<f64>
+  }
+  func.func private @differentiated_circuit(%arg0: tensor<f64>) -> tensor<f64> attributes {qnode} {
+    return %arg0 : tensor<f64>
+  }
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 // RUN: quantum-opt --detensorize-scf --canonicalize --split-input-file %s | FileCheck %s
+// RUN: quantum-opt --pass-pipeline="builtin.module(func.func(detensorize-scf),canonicalize)" --split-input-file %s | FileCheck %s
 
 // CHECK-LABEL: @test_for_loop
 // CHECK-NOT:     scf.for {{.*}} -> (tensor<f64>)
@@ -140,3 +141,37 @@ func.func public @test_nested_ifs(%arg0: tensor<f64>) -> tensor<f64> {
 
   return %1 : tensor<f64>
 }
+
+// -----
+
+// CHECK-LABEL: @test_index_switch
+// CHECK-NOT:     scf.index_switch {{.*}} -> tensor<f64>
+// CHECK:         [[SWITCH_RES:%.+]] = scf.index_switch {{.*}} -> f64
+// CHECK:         case 0 {
+// CHECK:           arith.addf
+// CHECK:           scf.yield {{.*}} : f64
+// CHECK:         case 1 {
+// CHECK:           arith.subf
+// CHECK:           scf.yield {{.*}} : f64
+// CHECK:         default {
+// CHECK:           scf.yield {{.*}} : f64
+// CHECK:         [[FUN_RES:%.+]] = tensor.from_elements [[SWITCH_RES]]
+// CHECK:         return [[FUN_RES]] : tensor<f64>
+func.func public @test_index_switch(%arg0: index, %arg1: f64, %arg2: f64) -> tensor<f64> {
+  %0 = scf.index_switch %arg0 -> tensor<f64>
+  case 0 {
+    %1 = arith.addf %arg1, %arg2 : f64
+    %from_elements = tensor.from_elements %1 : tensor<f64>
+    scf.yield %from_elements : tensor<f64>
+  }
+  case 1 {
+    %1 = arith.subf %arg1, %arg2 : f64
+    %from_elements = tensor.from_elements %1 : tensor<f64>
+    scf.yield %from_elements : tensor<f64>
+  }
+  default {
+    %from_elements = tensor.from_elements %arg1 : tensor<f64>
+    scf.yield %from_elements : tensor<f64>
+  }
+  return %0 : tensor<f64>
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 // RUN: quantum-opt --disable-assertion --split-input-file %s | FileCheck %s
+// RUN: quantum-opt --pass-pipeline="builtin.module(func.func(disable-assertion))" --split-input-file %s | FileCheck %s
 
 //////////////////////////
 // Catalyst AssertionOp //
@@ -0,0 +1,134 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// RUN: quantum-opt --pass-pipeline="builtin.module(func.func(elide-memref-copies))" --split-input-file %s | FileCheck %s
+
+// CHECK-LABEL: @dead_source
+func.func @dead_source(%arg0: f64, %arg1: index) -> memref<4xf64> {
+    // CHECK: [[buf:%.+]] = memref.alloc() : memref<4xf64>
+    // CHECK-NEXT: memref.store %arg0, [[buf]]
+    // CHECK-NEXT: return [[buf]]
+    %0 = memref.alloc() : memref<4xf64>
+    memref.store %arg0, %0[%arg1] : memref<4xf64>
+    %1 = memref.alloc() : memref<4xf64>
+    memref.copy %0, %1 : memref<4xf64> to memref<4xf64>
+    memref.dealloc %0 : memref<4xf64>
+    return %1 : memref<4xf64>
+}
+
+// -----
+
+// CHECK-LABEL: @live_source
+func.func @live_source(%arg0: f64, %arg1: index) -> memref<4xf64> {
+    // The source is written after the copy, which must keep the old contents
+    // CHECK: memref.copy
+    %0 = memref.alloc() : memref<4xf64>
+    memref.store %arg0, %0[%arg1] : memref<4xf64>
+    %1 = memref.alloc() : memref<4xf64>
+    memref.copy %0, %1 : memref<4xf64> to memref<4xf64>
+    memref.store %arg0, %0[%arg1] : memref<4xf64>
+    "test.use"(%0) : (memref<4xf64>) -> ()
+    memref.dealloc %0 : memref<4xf64>
+    return %1 : memref<4xf64>
+}
+
+// -----
+
+// CHECK-LABEL: @aliased_source
+func.func @aliased_source(%arg0: f64) -> memref<4xf64> {
+    // CHECK: memref.copy
+    %c0 = arith.constant 0 : index
+    %0 = memref.alloc() : memref<4xf64>
+    %view = memref.subview %0[0] [2] [1] : memref<4xf64> to memref<2xf64, strided<[1]>>
+    %1 = memref.alloc() : memref<4xf64>
+    memref.copy %0, %1 : memref<4xf64> to memref<4xf64>
+    memref.store %arg0, %view[%c0] : memref<2xf64, strided<[1]>>
+    memref.dealloc %0 : memref<4xf64>
+    return %1 : memref<4xf64>
+}
+
+// -----
+
+memref.global "private" constant @angles : memref<2xf64> = dense<[1.0, 2.0]>
+
+// CHECK-LABEL: @read_only_copy_of_constant
+func.func @read_only_copy_of_constant(%arg0: index) -> f64 {
+    // CHECK: [[global:%.+]] = memref.get_global @angles
+    // CHECK-NOT: memref.alloc
+    // CHECK-NOT: memref.copy
+    // CHECK: [[res:%.+]] = memref.load [[global]][%arg0]
+    // CHECK-NOT: memref.dealloc
+    // CHECK: return [[res]]
+    %0 = memref.get_global @angles : memref<2xf64>
+    %1 = memref.alloc() : memref<2xf64>
+    memref.copy %0, %1 : memref<2xf64> to memref<2xf64>
+    %2 = memref.load %1[%arg0] : memref<2xf64>
+    memref.dealloc %1 : memref<2xf64>
+    return %2 : f64
+}
+
+// -----
+
+memref.global "private" constant @angles : memref<2xf64> = dense<[1.0, 2.0]>
+
+// CHECK-LABEL: @returned_copy_of_constant
+func.func @returned_copy_of_constant() -> memref<2xf64> {
+    // The copy is owned by the caller, so it cannot be replaced by the global
+    // CHECK: memref.copy
+    %0 = memref.get_global @angles : memref<2xf64>
+    %1 = memref.alloc() : memref<2xf64>
+    memref.copy %0, %1 : memref<2xf64> to memref<2xf64>
+    return %1 : memref<2xf64>
+}
+
+// -----
+
+// CHECK-LABEL: @read_only_copy
+func.func @read_only_copy(%arg0: f64, %arg1: index) -> f64 {
+    // CHECK: [[buf:%.+]] = memref.alloc() : memref<4xf64>
+    // CHECK-NEXT: memref.store %arg0, [[buf]]
+    // CHECK-NEXT: [[lhs:%.+]] = memref.load [[buf]]
+    // CHECK-NEXT: [[rhs:%.+]] = memref.load [[buf]]
+    // CHECK-NEXT: memref.dealloc [[buf]]
+    // CHECK-NEXT: arith.addf [[lhs]], [[rhs]]
+    %0 = memref.alloc() : memref<4xf64>
+    memref.store %arg0, %0[%arg1] : memref<4xf64>
+    %1 = memref.alloc() : memref<4xf64>
+    memref.copy %0, %1 : memref<4xf64> to memref<4xf64>
+    %2 = memref.load %0[%arg1] : memref<4xf64>
+    %3 = memref.load %1[%arg1] : memref<4xf64>
+    memref.dealloc %0 : memref<4xf64>
+    memref.dealloc %1 : memref<4xf64>
+    %4 = arith.addf %2, %3 : f64
+    return %4 : f64
+}
+
+// -----
+
+// CHECK-LABEL: @read_after_source_freed
+func.func @read_after_source_freed(%arg0: f64, %arg1: index) -> f64 {
+    // The copy is read after the source is freed
+    // CHECK: memref.copy
+    %0 = memref.alloc() : memref<4xf64>
+    memref.store %arg0, %0[%arg1] : memref<4xf64>
+    %1 = memref.alloc() : memref<4xf64>
+    memref.copy %0, %1 : memref<4xf64> to memref<4xf64>
+    %2 = memref.load %0[%arg1] : memref<4xf64>
+    memref.dealloc %0 : memref<4xf64>
+    %3 = memref.load %1[%arg1] : memref<4xf64>
+    memref.dealloc %1 : memref<4xf64>
+    %4 = arith.addf %2, %3 : f64
+    return %4 : f64
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 // RUN: quantum-opt --hlo-custom-call-lowering --split-input-file %s | FileCheck %s
+// RUN: quantum-opt --hlo-custom-call-lowering="max-inline-size=0" --split-input-file %s | FileCheck %s --check-prefix=NOINLINE
 
 func.func @custom_call(%arg0: tensor<3x3xf64>) -> tensor<3x3xf64> {
     // CHECK: %cst = arith.constant dense<1> : tensor<i32>
@@ -22,3 +23,68 @@ func.func @custom_call(%arg0: tensor<3x3xf64>) -> tensor<3x3xf64> {
     %0 = stablehlo.custom_call @lapack_dgesdd_ffi(%arg0) {api_version = 2 : i32, backend_config = "", operand_layouts = [dense<[0, 1]> : tensor<2xindex>], output_operand_aliases = [#stablehlo.output_operand_alias<output_tuple_indices = [], operand_index = 0, operand_tuple_indices = []>], result_layouts = [dense<[0, 1]> : tensor<2xindex>]} : (tensor<3x3xf64>) -> tensor<3x3xf64>
     return %0 : tensor<3x3xf64>
 }
+
+// -----
+
+// LAPACK calls on small real matrices are expanded inline
+
+// CHECK-LABEL: @syevd_small
+// NOINLINE-LABEL: @syevd_small
+func.func @syevd_small(%arg0: tensor<2x2xf64>) -> (tensor<2x2xf64>, tensor<2xf64>, tensor<i32>) {
+    // CHECK-NOT: catalyst.custom_call
+    // CHECK: [[flat:%.+]] = tensor.collapse_shape %arg0 {{\[}}[0, 1]] : tensor<2x2xf64> into tensor<4xf64>
+    // CHECK: scf.for
+    // CHECK: tensor.extract [[flat]]
+    // CHECK: scf.for {{.*}} iter_args
+    // CHECK: math.sqrt
+    // CHECK: scf.yield
+    // CHECK: tensor.from_elements
+    // CHECK: tensor.insert_slice
+    // CHECK: tensor.expand_shape {{.*}} : tensor<4xf64> into tensor<2x2xf64>
+    // CHECK: tensor.collapse_shape {{.*}} : tensor<1xi32> into tensor<i32>
+    // CHECK-NOT: catalyst.custom_call
+    // NOINLINE: catalyst.custom_call fn("lapack_dsyevd_ffi")
+    %0:3 = stablehlo.custom_call @lapack_dsyevd_ffi(%arg0) {api_version = 4 : i32, backend_config = {mode = 86 : ui8, uplo = 76 : ui8}} : (tensor<2x2xf64>) -> (tensor<2x2xf64>, tensor<2xf64>, tensor<i32>)
+    return %0#0, %0#1, %0#2 : tensor<2x2xf64>, tensor<2xf64>, tensor<i32>
+}
+
+// -----
+
+// CHECK-LABEL: @getrf_batched
+func.func @getrf_batched(%arg0: tensor<2x3x3xf32>) -> (tensor<2x3x3xf32>, tensor<2x3xi32>, tensor<2xi32>) {
+    // CHECK-NOT: catalyst.custom_call
+    // CHECK: tensor.collapse_shape %arg0 {{\[}}[0, 1, 2]] : tensor<2x3x3xf32> into tensor<18xf32>
+    // CHECK: scf.for
+    // CHECK: math.absf
+    // CHECK: arith.divf
+    // CHECK: tensor.expand_shape {{.*}} : tensor<18xf32> into tensor<2x3x3xf32>
+    // CHECK: tensor.expand_shape {{.*}} : tensor<6xi32> into tensor<2x3xi32>
+    // CHECK-NOT: catalyst.custom_call
+    %0:3 = stablehlo.custom_call @lapack_sgetrf_ffi(%arg0) {api_version = 4 : i32, backend_config = {}} : (tensor<2x3x3xf32>) -> (tensor<2x3x3xf32>, tensor<2x3xi32>, tensor<2xi32>)
+    return %0#0, %0#1, %0#2 : tensor<2x3x3xf32>, tensor<2x3xi32>, tensor<2xi32>
+}
+
+// -----
+
+// CHECK-LABEL: @trsm_small
+func.func @trsm_small(%arg0: tensor<2x2xf64>, %arg1: tensor<2x3xf64>) -> tensor<2x3xf64> {
+    // CHECK-NOT: catalyst.custom_call
+    // CHECK: tensor.collapse_shape %arg1 {{\[}}[0, 1]] : tensor<2x3xf64> into tensor<6xf64>
+    // CHECK: arith.divf
+    // CHECK-NOT: catalyst.custom_call
+    %0 = stablehlo.custom_call @lapack_dtrsm_ffi(%arg0, %arg1) {api_version = 4 : i32, backend_config = {diag = 78 : ui8, side = 76 : ui8, trans_x = 78 : ui8, uplo = 76 : ui8}} : (tensor<2x2xf64>, tensor<2x3xf64>) -> tensor<2x3xf64>
+    return %0 : tensor<2x3xf64>
+}
+
+// -----
+
+// Large and complex matrices are left to LAPACK
+
+// CHECK-LABEL: @potrf_fallback
+func.func @potrf_fallback(%arg0: tensor<9x9xf64>, %arg1: tensor<2x2xcomplex<f64>>) -> (tensor<9x9xf64>, tensor<2x2xcomplex<f64>>) {
+    // CHECK: catalyst.custom_call fn("lapack_dpotrf_ffi")
+    %0:2 = stablehlo.custom_call @lapack_dpotrf_ffi(%arg0) {api_version = 4 : i32, backend_config = {uplo = 76 : ui8}} : (tensor<9x9xf64>) -> (tensor<9x9xf64>, tensor<i32>)
+    // CHECK: catalyst.custom_call fn("lapack_zpotrf_ffi")
+    %1:2 = stablehlo.custom_call @lapack_zpotrf_ffi(%arg1) {api_version = 4 : i32, backend_config = {uplo = 76 : ui8}} : (tensor<2x2xcomplex<f64>>) -> (tensor<2x2xcomplex<f64>>, tensor<i32>)
+    return %0#0, %1#0 : tensor<9x9xf64>, tensor<2x2xcomplex<f64>>
+}
@@ -0,0 +1,147 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --stablehlo-legalize-sort --split-input-file | FileCheck %s
+
+// Single-key numeric sorts call a sort kernel with the batch size, the row size, the number of
+// sorted elements, the direction and whether the order is the alternate order.
+
+// CHECK-LABEL: func.func @sort_f64(
+// CHECK-SAME: [[x:%.+]]: tensor<3x100xf64>
+func.func @sort_f64(%x: tensor<3x100xf64>) -> tensor<3x100xf64> {
+    // CHECK: [[batch:%.+]] = arith.constant dense<3> : tensor<i32>
+    // CHECK: [[n:%.+]] = arith.constant dense<100> : tensor<i32>
+    // CHECK: [[k:%.+]] = arith.constant dense<100> : tensor<i32>
+    // CHECK: [[descending:%.+]] = arith.constant dense<0> : tensor<i32>
+    // CHECK: [[alternate:%.+]] = arith.constant dense<0> : tensor<i32>
+    // CHECK: [[sorted:%.+]] = catalyst.custom_call fn("catalyst_sort_f64")([[batch]], [[n]], [[k]], [[descending]], [[alternate]], [[x]])
+    // CHECK-SAME: -> tensor<3x100xf64>
+    // CHECK-NOT: scf.while
+    // CHECK: return [[sorted]]
+    %0 = "stablehlo.sort"(%x) <{dimension = 1 : i64, is_stable = true}> ({
+    ^bb0(%lhs: tensor<f64>, %rhs: tensor<f64>):
+        %1 = arith.cmpf olt, %lhs, %rhs : tensor<f64>
+        stablehlo.return %1 : tensor<i1>
+    }) : (tensor<3x100xf64>) -> tensor<3x100xf64>
+    return %0 : tensor<3x100xf64>
+}
+
+// -----
+
+// Argsorts permute the indices with the keys.
+
+// CHECK-LABEL: func.func @argsort_i64(
+// CHECK-SAME: [[x:%.+]]: tensor<50xi64>
+func.func @argsort_i64(%x: tensor<50xi64>) -> tensor<50xi32> {
+    // CHECK: [[indices:%.+]] = stablehlo.iota
+    // CHECK: [[batch:%.+]] = arith.constant dense<1> : tensor<i32>
+    // CHECK: [[n:%.+]] = arith.constant dense<50> : tensor<i32>
+    // CHECK: [[k:%.+]] = arith.constant dense<50> : tensor<i32>
+    // CHECK: [[descending:%.+]] = arith.constant dense<1> : tensor<i32>
+    // CHECK: [[alternate:%.+]] = arith.constant dense<0> : tensor<i32>
+    // CHECK: [[sorted:%.+]]:2 = catalyst.custom_call fn("catalyst_sort_i64_i32")([[batch]], [[n]], [[k]], [[descending]], [[alternate]], [[x]], [[indices]])
+    // CHECK-SAME: -> (tensor<50xi64>, tensor<50xi32>)
+    // CHECK: return [[sorted]]#1
+    %indices = stablehlo.iota dim = 0 : tensor<50xi32>
+    %0:2 = "stablehlo.sort"(%x, %indices) <{dimension = 0 : i64, is_stable = true}> ({
+    ^bb0(%lhs: tensor<i64>, %rhs: tensor<i64>, %lhs_index: tensor<i32>, %rhs_index: tensor<i32>):
+        %1 = tensor.extract %lhs[] : tensor<i64>
+        %2 = tensor.extract %rhs[] : tensor<i64>
+        %3 = arith.cmpi sgt, %1, %2 : i64
+        %4 = tensor.from_elements %3 : tensor<i1>
+        stablehlo.return %4 : tensor<i1>
+    }) : (tensor<50xi64>, tensor<50xi32>) -> (tensor<50xi64>, tensor<50xi32>)
+    return %0#1 : tensor<50xi32>
+}
+
+// -----
+
+// When only the first elements of the sorted rows are used, e.g. by `lax.top_k`, only these
+// elements are sorted.
+
+// CHECK-LABEL: func.func @top_k(
+// CHECK-SAME: [[x:%.+]]: tensor<1000xf32>, [[indices:%.+]]: tensor<1000xi32>
+func.func @top_k(%x: tensor<1000xf32>, %indices: tensor<1000xi32>) -> (tensor<5xf32>, tensor<5xi32>) {
+    // CHECK: [[batch:%.+]] = arith.constant dense<1> : tensor<i32>
+    // CHECK: [[n:%.+]] = arith.constant dense<1000> : tensor<i32>
+    // CHECK: [[k:%.+]] = arith.constant dense<5> : tensor<i32>
+    // CHECK: [[descending:%.+]] = arith.constant dense<1> : tensor<i32>
+    // CHECK: [[alternate:%.+]] = arith.constant dense<1> : tensor<i32>
+    // CHECK: [[sorted:%.+]]:2 = catalyst.custom_call fn("catalyst_sort_f32_i32")([[batch]], [[n]], [[k]], [[descending]], [[alternate]], [[x]], [[indices]])
+    // CHECK-SAME: -> (tensor<5xf32>, tensor<5xi32>)
+    // CHECK-DAG: [[values:%.+]] = tensor.extract_slice [[sorted]]#0[0] [5] [1] : tensor<5xf32> to tensor<5xf32>
+    // CHECK-DAG: [[top:%.+]] = tensor.extract_slice [[sorted]]#1[0] [5] [1] : tensor<5xi32> to tensor<5xi32>
+    // CHECK: return [[values]], [[top]]
+    %0:2 = "stablehlo.sort"(%x, %indices) <{dimension = 0 : i64, is_stable = true}> ({
+    ^bb0(%lhs: tensor<f32>, %rhs: tensor<f32>, %lhs_index: tensor<i32>, %rhs_index: tensor<i32>):
+        %1 = stablehlo.compare GT, %lhs, %rhs, TOTALORDER : (tensor<f32>, tensor<f32>) -> tensor<i1>
+        stablehlo.return %1 : tensor<i1>
+    }) : (tensor<1000xf32>, tensor<1000xi32>) -> (tensor<1000xf32>, tensor<1000xi32>)
+    %values = tensor.extract_slice %0#0[0] [5] [1] : tensor<1000xf32> to tensor<5xf32>
+    %top = tensor.extract_slice %0#1[0] [5] [1] : tensor<1000xi32> to tensor<5xi32>
+    return %values, %top : tensor<5xf32>, tensor<5xi32>
+}
+
+// -----
+
+// The floats canonicalized by JAX, with -0.0 replaced by 0.0 and all NaNs by the same NaN, are
+// sorted in the numeric order of the kernels rather than in the total order.
+
+// CHECK-LABEL: func.func @canonicalized_total_order(
+// CHECK-SAME: [[x:%.+]]: tensor<10xf64>
+func.func @canonicalized_total_order(%x: tensor<10xf64>) -> tensor<10xf64> {
+    // CHECK: [[batch:%.+]] = arith.constant dense<1> : tensor<i32>
+    // CHECK: [[n:%.+]] = arith.constant dense<10> : tensor<i32>
+    // CHECK: [[k:%.+]] = arith.constant dense<10> : tensor<i32>
+    // CHECK: [[descending:%.+]] = arith.constant dense<0> : tensor<i32>
+    // CHECK: [[alternate:%.+]] = arith.constant dense<0> : tensor<i32>
+    // CHECK: catalyst.custom_call fn("catalyst_sort_f64")([[batch]], [[n]], [[k]], [[descending]], [[alternate]], [[x]])
+    %0 = "stablehlo.sort"(%x) <{dimension = 0 : i64, is_stable = true}> ({
+    ^bb0(%lhs: tensor<f64>, %rhs: tensor<f64>):
+        %zero = stablehlo.constant dense<0.000000e+00> : tensor<f64>
+        %nan = stablehlo.constant dense<0x7FF8000000000000> : tensor<f64>
+        %1 = stablehlo.compare EQ, %lhs, %zero, FLOAT : (tensor<f64>, tensor<f64>) -> tensor<i1>
+        %2 = stablehlo.select %1, %zero, %lhs : tensor<i1>, tensor<f64>
+        %3 = stablehlo.compare NE, %2, %2, FLOAT : (tensor<f64>, tensor<f64>) -> tensor<i1>
+        %4 = stablehlo.select %3, %nan, %2 : tensor<i1>, tensor<f64>
+        %5 = stablehlo.compare EQ, %rhs, %zero, FLOAT : (tensor<f64>, tensor<f64>) -> tensor<i1>
+        %6 = stablehlo.select %5, %zero, %rhs : tensor<i1>, tensor<f64>
+        %7 = stablehlo.compare NE, %6, %6, FLOAT : (tensor<f64>, tensor<f64>) -> tensor<i1>
+        %8 = stablehlo.select %7, %nan, %6 : tensor<i1>, tensor<f64>
+        %9 = stablehlo.compare LT, %4, %8, TOTALORDER : (tensor<f64>, tensor<f64>) -> tensor<i1>
+        stablehlo.return %9 : tensor<i1>
+    }) : (tensor<10xf64>) -> tensor<10xf64>
+    return %0 : tensor<10xf64>
+}
+
+// -----
+
+// Comparators that are not a single comparison of the keys, e.g. of lexicographic sorts, still
+// lower to a merge sort.
+
+// CHECK-LABEL: func.func @lexsort(
+func.func @lexsort(%x: tensor<8xf64>, %y: tensor<8xf64>) -> tensor<8xf64> {
+    // CHECK-NOT: catalyst.custom_call
+    // CHECK: scf.while
+    %0:2 = "stablehlo.sort"(%x, %y) <{dimension = 0 : i64, is_stable = true}> ({
+    ^bb0(%lhs: tensor<f64>, %rhs: tensor<f64>, %lhs_y: tensor<f64>, %rhs_y: tensor<f64>):
+        %1 = arith.cmpf olt, %lhs, %rhs : tensor<f64>
+        %2 = arith.cmpf oeq, %lhs, %rhs : tensor<f64>
+        %3 = arith.cmpf olt, %lhs_y, %rhs_y : tensor<f64>
+        %4 = arith.andi %2, %3 : tensor<i1>
+        %5 = arith.ori %1, %4 : tensor<i1>
+        stablehlo.return %5 : tensor<i1>
+    }) : (tensor<8xf64>, tensor<8xf64>) -> (tensor<8xf64>, tensor<8xf64>)
+    return %0#0 : tensor<8xf64>
+}
@@ -0,0 +1,116 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --pass-pipeline="builtin.module(func.func(loop-carried-in-place))" --split-input-file %s | FileCheck %s
+
+#map = affine_map<(d0) -> (d0)>
+
+// A gradient descent step reads the parameters before updating them elementwise.
+
+// CHECK-LABEL: @for_descent
+func.func @for_descent(%init: tensor<4xf64>, %n: index) -> tensor<4xf64> {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    // CHECK: scf.for {{.+}} iter_args([[x:%.+]] = {{%.+}})
+    %0 = scf.for %i = %c0 to %n step %c1 iter_args(%x = %init) -> (tensor<4xf64>) {
+        // CHECK: [[grad:%.+]] = linalg.generic {{.+}} ins([[x]] : tensor<4xf64>) outs({{%.+}} : tensor<4xf64>)
+        %empty0 = tensor.empty() : tensor<4xf64>
+        %grad = linalg.generic {indexing_maps = [#map, #map], iterator_types = ["parallel"]}
+            ins(%x : tensor<4xf64>) outs(%empty0 : tensor<4xf64>) {
+        ^bb0(%in: f64, %out: f64):
+            %1 = math.sin %in : f64
+            linalg.yield %1 : f64
+        } -> tensor<4xf64>
+        // CHECK: [[next:%.+]] = linalg.generic {{.+}} ins([[x]], [[grad]] : tensor<4xf64>, tensor<4xf64>) outs([[x]] : tensor<4xf64>)
+        %empty1 = tensor.empty() : tensor<4xf64>
+        %next = linalg.generic {indexing_maps = [#map, #map, #map], iterator_types = ["parallel"]}
+            ins(%x, %grad : tensor<4xf64>, tensor<4xf64>) outs(%empty1 : tensor<4xf64>) {
+        ^bb0(%in: f64, %in_grad: f64, %out: f64):
+            %1 = arith.subf %in, %in_grad : f64
+            linalg.yield %1 : f64
+        } -> tensor<4xf64>
+        // CHECK: scf.yield [[next]]
+        scf.yield %next : tensor<4xf64>
+    }
+    return %0 : tensor<4xf64>
+}
+
+// -----
+
+#map = affine_map<(d0) -> (d0)>
+
+// The tensors of a while loop are carried from its condition to its body.
+
+// CHECK-LABEL: @while_descent
+func.func @while_descent(%init: tensor<4xf64>, %tol: f64) -> tensor<4xf64> {
+    %c0 = arith.constant 0 : index
+    // CHECK: scf.while
+    %0 = scf.while (%x = %init) : (tensor<4xf64>) -> tensor<4xf64> {
+        %1 = tensor.extract %x[%c0] : tensor<4xf64>
+        %2 = arith.cmpf ogt, %1, %tol : f64
+        scf.condition(%2) %x : tensor<4xf64>
+    } do {
+    // CHECK: ^bb0([[x:%.+]]: tensor<4xf64>)
+    ^bb0(%x: tensor<4xf64>):
+        // CHECK: [[next:%.+]] = linalg.generic {{.+}} ins([[x]] : tensor<4xf64>) outs([[x]] : tensor<4xf64>)
+        %empty = tensor.empty() : tensor<4xf64>
+        %next = linalg.generic {indexing_maps = [#map, #map], iterator_types = ["parallel"]}
+            ins(%x : tensor<4xf64>) outs(%empty : tensor<4xf64>) {
+        ^bb0(%in: f64, %out: f64):
+            %1 = arith.mulf %in, %in : f64
+            linalg.yield %1 : f64
+        } -> tensor<4xf64>
+        // CHECK: scf.yield [[next]]
+        scf.yield %next : tensor<4xf64>
+    }
+    return %0 : tensor<4xf64>
+}
+
+// -----
+
+#map = affine_map<(d0) -> (d0)>
+#reverse = affine_map<(d0) -> (3 - d0)>
+
+// The carried tensor is not updated in place when it is still read afterwards, or read at other
+// positions than the ones written to.
+
+// CHECK-LABEL: @not_in_place
+func.func @not_in_place(%init: tensor<4xf64>, %n: index) -> (tensor<4xf64>, tensor<4xf64>) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    // CHECK: scf.for {{.+}} iter_args([[x:%.+]] = {{%.+}}, [[y:%.+]] = {{%.+}})
+    %0:2 = scf.for %i = %c0 to %n step %c1 iter_args(%x = %init, %y = %init) -> (tensor<4xf64>, tensor<4xf64>) {
+        // CHECK: [[empty:%.+]] = tensor.empty
+        // CHECK: linalg.generic {{.+}} ins([[x]] : tensor<4xf64>) outs([[empty]] : tensor<4xf64>)
+        %empty0 = tensor.empty() : tensor<4xf64>
+        %nextx = linalg.generic {indexing_maps = [#map, #map], iterator_types = ["parallel"]}
+            ins(%x : tensor<4xf64>) outs(%empty0 : tensor<4xf64>) {
+        ^bb0(%in: f64, %out: f64):
+            %1 = arith.mulf %in, %in : f64
+            linalg.yield %1 : f64
+        } -> tensor<4xf64>
+        %1 = tensor.extract %x[%c0] : tensor<4xf64>
+        // CHECK: [[empty:%.+]] = tensor.empty
+        // CHECK: linalg.generic {{.+}} ins([[y]] : tensor<4xf64>) outs([[empty]] : tensor<4xf64>)
+        %empty1 = tensor.empty() : tensor<4xf64>
+        %nexty = linalg.generic {indexing_maps = [#reverse, #map], iterator_types = ["parallel"]}
+            ins(%y : tensor<4xf64>) outs(%empty1 : tensor<4xf64>) {
+        ^bb0(%in: f64, %out: f64):
+            %2 = arith.addf %in, %1 : f64
+            linalg.yield %2 : f64
+        } -> tensor<4xf64>
+        scf.yield %nextx, %nexty : tensor<4xf64>, tensor<4xf64>
+    }
+    return %0#0, %0#1 : tensor<4xf64>, tensor<4xf64>
+}
@@ -61,3 +61,59 @@ module @global {
   }
 
 }
+
+// -----
+
+// Test that the functions of many nested modules get unique names, and that all references to them
+// are replaced
+// CHECK-LABEL: @many
+module @many {
+  // CHECK-NOT: module
+  // CHECK-DAG: func.func @circuit_0(
+  // CHECK-DAG: func.func @circuit_1(
+  // CHECK-DAG: func.func @circuit_2(
+  // CHECK-DAG: func.func @helper_0(
+  // CHECK-DAG: func.func @helper_1(
+  // CHECK-DAG: func.func @helper_2(
+
+  module @module_a {
+    func.func @circuit(%arg0: f64) -> f64 attributes {quantum.node} {
+      %0 = func.call @helper(%arg0) : (f64) -> f64
+      return %0 : f64
+    }
+    func.func @helper(%arg0: f64) -> f64 {
+      return %arg0 : f64
+    }
+  }
+
+  module @module_b {
+    func.func @circuit(%arg0: f64) -> f64 attributes {quantum.node} {
+      %0 = func.call @helper(%arg0) : (f64) -> f64
+      return %0 : f64
+    }
+    func.func @helper(%arg0: f64) -> f64 {
+      return %arg0 : f64
+    }
+  }
+
+  module @module_c {
+    func.func @circuit(%arg0: f64) -> f64 attributes {quantum.node} {
+      %0 = func.call @helper(%arg0) : (f64) -> f64
+      return %0 : f64
+    }
+    func.func @helper(%arg0: f64) -> f64 {
+      return %arg0 : f64
+    }
+  }
+
+  // CHECK: func.func @main
+  func.func @main(%arg0: f64) -> (f64, f64, f64) {
+    // CHECK: [[a:%.+]] = call @circuit_{{[0-2]}}(%arg0)
+    // CHECK: [[b:%.+]] = call @circuit_{{[0-2]}}(%arg0)
+    // CHECK: gradient.grad "auto" @circuit_{{[0-2]}}(%arg0)
+    %0 = catalyst.launch_kernel @module_a::@circuit(%arg0) : (f64) -> f64
+    %1 = catalyst.launch_kernel @module_b::@circuit(%arg0) : (f64) -> f64
+    %2 = gradient.grad "auto" @module_c::@circuit(%arg0) : (f64) -> f64
+    return %0, %1, %2 : f64, f64, f64
+  }
+}
@@ -0,0 +1,68 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --noalias-memref-args --split-input-file %s | FileCheck %s
+
+// Distinct buffers allocated by the caller are noalias, and so are the views of noalias arguments
+// passed on to other functions.
+
+// CHECK-LABEL: func.func private @post_process(
+// CHECK-SAME: %arg0: memref<4xf64> {llvm.noalias}, %arg1: memref<4xf64> {llvm.noalias})
+func.func private @post_process(%probs: memref<4xf64>, %out: memref<4xf64>) {
+    %c0 = arith.constant 0 : index
+    %0 = memref.load %probs[%c0] : memref<4xf64>
+    memref.store %0, %out[%c0] : memref<4xf64>
+    %1 = memref.cast %probs : memref<4xf64> to memref<?xf64>
+    func.call @scale(%1, %out) : (memref<?xf64>, memref<4xf64>) -> ()
+    return
+}
+
+// CHECK-LABEL: func.func private @scale(
+// CHECK-SAME: %arg0: memref<?xf64> {llvm.noalias}, %arg1: memref<4xf64> {llvm.noalias})
+func.func private @scale(%in: memref<?xf64>, %out: memref<4xf64>) {
+    return
+}
+
+// CHECK-LABEL: func.func @entry(
+// CHECK-SAME: %arg0: memref<4xf64>)
+func.func @entry(%arg0: memref<4xf64>) {
+    %probs = memref.alloc() : memref<4xf64>
+    %out = memref.alloca() : memref<4xf64>
+    func.call @post_process(%probs, %out) : (memref<4xf64>, memref<4xf64>) -> ()
+    return
+}
+
+// -----
+
+// Views of the same buffer, or buffers of unknown origin, may alias.
+
+// CHECK-LABEL: func.func private @same_buffer(
+// CHECK-SAME: %arg0: memref<4xf64>, %arg1: memref<2xf64>)
+func.func private @same_buffer(%a: memref<4xf64>, %b: memref<2xf64>) {
+    return
+}
+
+// CHECK-LABEL: func.func private @unknown_buffer(
+// CHECK-SAME: %arg0: memref<4xf64>, %arg1: memref<4xf64>)
+func.func private @unknown_buffer(%a: memref<4xf64>, %b: memref<4xf64>) {
+    return
+}
+
+func.func @entry(%arg0: memref<4xf64>) {
+    %0 = memref.alloc() : memref<4xf64>
+    %1 = memref.subview %0[0] [2] [1] : memref<4xf64> to memref<2xf64>
+    func.call @same_buffer(%0, %1) : (memref<4xf64>, memref<2xf64>) -> ()
+    func.call @unknown_buffer(%0, %arg0) : (memref<4xf64>, memref<4xf64>) -> ()
+    return
+}
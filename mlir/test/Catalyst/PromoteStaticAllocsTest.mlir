@@ -0,0 +1,103 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --allow-unregistered-dialect --pass-pipeline="builtin.module(func.func(promote-static-allocs{max-alloc-size-in-bytes=64 max-total-size-in-bytes=96}))" --split-input-file %s | FileCheck %s
+
+// CHECK-LABEL: @promote_in_loop
+func.func @promote_in_loop(%arg0: f64, %arg1: index) -> f64 {
+    // CHECK: [[buf:%.+]] = memref.alloca() {alignment = 64 : i64} : memref<4xf64>
+    // CHECK-NOT: memref.alloc(
+    // CHECK: scf.for
+    // CHECK-NEXT: memref.store %arg0, [[buf]]
+    // CHECK-NEXT: memref.load [[buf]]
+    // CHECK-NOT: memref.dealloc
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %0 = scf.for %i = %c0 to %arg1 step %c1 iter_args(%acc = %arg0) -> f64 {
+        %1 = memref.alloc() {alignment = 64 : i64} : memref<4xf64>
+        memref.store %arg0, %1[%i] : memref<4xf64>
+        %2 = memref.load %1[%i] : memref<4xf64>
+        memref.dealloc %1 : memref<4xf64>
+        %3 = arith.addf %acc, %2 : f64
+        scf.yield %3 : f64
+    }
+    return %0 : f64
+}
+
+// -----
+
+// CHECK-LABEL: @promote_views
+func.func @promote_views(%arg0: f64) -> f64 {
+    // CHECK: memref.alloca() : memref<2x2xf64>
+    // CHECK-NOT: memref.dealloc
+    %c0 = arith.constant 0 : index
+    %0 = memref.alloc() : memref<2x2xf64>
+    %1 = memref.collapse_shape %0 [[0, 1]] : memref<2x2xf64> into memref<4xf64>
+    memref.store %arg0, %1[%c0] : memref<4xf64>
+    %2 = memref.load %0[%c0, %c0] : memref<2x2xf64>
+    memref.dealloc %0 : memref<2x2xf64>
+    return %2 : f64
+}
+
+// -----
+
+// CHECK-LABEL: @keep_escaping
+func.func @keep_escaping(%arg0: index) -> memref<4xf64> {
+    // Returned buffers, buffers passed to calls, too large or dynamically shaped buffers, and
+    // buffers of parallel loops stay on the heap
+    // CHECK: [[ret:%.+]] = memref.alloc() : memref<4xf64>
+    // CHECK: [[called:%.+]] = memref.alloc() : memref<4xf64>
+    // CHECK: call @callee([[called]])
+    // CHECK: memref.alloc() : memref<16xf64>
+    // CHECK: memref.alloc(%arg0) : memref<?xf64>
+    // CHECK: scf.forall
+    // CHECK-NEXT: memref.alloc() : memref<4xf64>
+    // CHECK-NOT: memref.alloca
+    %0 = memref.alloc() : memref<4xf64>
+    %1 = memref.alloc() : memref<4xf64>
+    func.call @callee(%1) : (memref<4xf64>) -> ()
+    memref.dealloc %1 : memref<4xf64>
+    %2 = memref.alloc() : memref<16xf64>
+    memref.dealloc %2 : memref<16xf64>
+    %3 = memref.alloc(%arg0) : memref<?xf64>
+    memref.dealloc %3 : memref<?xf64>
+    scf.forall (%i) in (%arg0) {
+        %4 = memref.alloc() : memref<4xf64>
+        "test.use"(%4) : (memref<4xf64>) -> ()
+        memref.dealloc %4 : memref<4xf64>
+    }
+    return %0 : memref<4xf64>
+}
+
+func.func private @callee(memref<4xf64>)
+
+// -----
+
+// CHECK-LABEL: @total_size
+func.func @total_size() {
+    // Only the buffers that fit in the total size are promoted
+    // CHECK: memref.alloca() : memref<4xf64>
+    // CHECK-NEXT: memref.alloca() : memref<8xf64>
+    // CHECK: memref.alloc() : memref<2xf64>
+    %0 = memref.alloc() : memref<8xf64>
+    "test.use"(%0) : (memref<8xf64>) -> ()
+    memref.dealloc %0 : memref<8xf64>
+    %1 = memref.alloc() : memref<4xf64>
+    "test.use"(%1) : (memref<4xf64>) -> ()
+    memref.dealloc %1 : memref<4xf64>
+    %2 = memref.alloc() : memref<2xf64>
+    "test.use"(%2) : (memref<2xf64>) -> ()
+    memref.dealloc %2 : memref<2xf64>
+    return
+}
@@ -54,3 +54,22 @@ module @test1 {
     llvm.return
   }
 }
+
+// -----
+
+// Batched callbacks are inactive as well.
+
+// CHECK-LABEL: @test2
+module @test2 {
+
+  // CHECK: llvm.mlir.global external @__enzyme_inactivefn() {{.*}} : !llvm.array<2 x ptr>
+  // CHECK: [[undef:%.+]] = llvm.mlir.undef
+  // CHECK: [[ptr0:%.+]] = llvm.mlir.addressof @__catalyst_inactive_callback
+  // CHECK: [[array:%.+]] = llvm.insertvalue [[ptr0]], [[undef]][0]
+  // CHECK: [[ptr1:%.+]] = llvm.mlir.addressof @__catalyst_inactive_batched_callback
+  // CHECK: [[retval:%.+]] = llvm.insertvalue [[ptr1]], [[array]][1]
+  // CHECK: llvm.return [[retval]]
+
+  llvm.func @__catalyst_inactive_callback(i64, i64, i64, ...)
+  llvm.func @__catalyst_inactive_batched_callback(i64, i64, i64, !llvm.ptr, ...)
+}
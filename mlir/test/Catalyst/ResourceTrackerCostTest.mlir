@@ -0,0 +1,73 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --pass-pipeline="builtin.module(resource-tracker{output-json=true estimate-cost=true gate-durations=Hadamard=20,CNOT=200 default-gate-duration=10 shots=100})" --split-input-file %s | FileCheck %s
+// RUN: quantum-opt --pass-pipeline="builtin.module(resource-tracker{output-json=true estimate-cost=true gate-durations=Hadamard})" --split-input-file --verify-diagnostics %s
+
+
+// Gates without an entry fall back to the default duration.
+
+// CHECK-LABEL: "cost_gates"
+// CHECK:   "cost_estimate"
+// CHECK:     "shot_duration": 240
+// CHECK:     "shots": 100
+// CHECK:     "state_vector_bytes": 64
+// CHECK:     "total_duration": 24000
+// CHECK:   "num_qubits": 2
+// expected-error @below {{invalid gate duration entry 'Hadamard', expected NAME=DURATION}}
+module {
+func.func @cost_gates() {
+    %0 = quantum.alloc( 2) : !quantum.reg
+    %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+    %2 = quantum.extract %0[ 1] : !quantum.reg -> !quantum.bit
+    %3 = quantum.custom "Hadamard"() %1 : !quantum.bit
+    %4 = quantum.custom "T"() %3 : !quantum.bit
+    %5 = quantum.custom "S"() %2 : !quantum.bit
+    %6:2 = quantum.custom "CNOT"() %4, %5 : !quantum.bit, !quantum.bit
+    %7 = quantum.insert %0[ 0], %6#0 : !quantum.reg, !quantum.bit
+    %8 = quantum.insert %7[ 1], %6#1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %8 : !quantum.reg
+    return
+}
+}
+
+// -----
+
+// The state vector of 58 qubits is the largest whose size in bytes fits in int64.
+
+// CHECK-LABEL: "max_qubits"
+// CHECK:     "state_vector_bytes": 4611686018427387904
+// expected-error @below {{invalid gate duration entry 'Hadamard', expected NAME=DURATION}}
+module {
+func.func @max_qubits() {
+    %0 = quantum.alloc( 58) : !quantum.reg
+    quantum.dealloc %0 : !quantum.reg
+    return
+}
+}
+
+// -----
+
+// Larger state vectors saturate at the maximum of int64.
+
+// CHECK-LABEL: "too_many_qubits"
+// CHECK:     "state_vector_bytes": 9223372036854775807
+// expected-error @below {{invalid gate duration entry 'Hadamard', expected NAME=DURATION}}
+module {
+func.func @too_many_qubits() {
+    %0 = quantum.alloc( 59) : !quantum.reg
+    quantum.dealloc %0 : !quantum.reg
+    return
+}
+}
@@ -180,6 +180,85 @@ func.func @nested_static_for(%arg0: !quantum.bit) -> !quantum.bit {
 
 // -----
 
+// Loop bounds computed from constants
+
+// CHECK-LABEL: "computed_bounds_for"
+// CHECK: "operations"
+// CHECK-DAG: "PauliX(1)": 1000000
+func.func @computed_bounds_for(%arg0: !quantum.bit) -> !quantum.bit {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c10 = arith.constant 10 : index
+    %c100 = arith.constant 100 : index
+    %n = arith.muli %c10, %c100 : index
+
+    %q = scf.for %i = %c0 to %n step %c1 iter_args(%a = %arg0) -> (!quantum.bit) {
+        %q2 = scf.for %j = %c0 to %n step %c1 iter_args(%b = %a) -> (!quantum.bit) {
+            %out = quantum.custom "PauliX"() %b : !quantum.bit
+            scf.yield %out : !quantum.bit
+        }
+        scf.yield %q2 : !quantum.bit
+    }
+
+    return %q : !quantum.bit
+}
+
+// -----
+
+// Triangular loop nest: the inner bound depends on the outer induction variable
+
+// CHECK-LABEL: "triangular_for"
+// CHECK: "operations"
+// CHECK-DAG: "PauliX(1)": 10
+// CHECK-DAG: "Hadamard(1)": 5
+func.func @triangular_for(%arg0: !quantum.bit) -> !quantum.bit {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c5 = arith.constant 5 : index
+
+    %q = scf.for %i = %c0 to %c5 step %c1 iter_args(%a = %arg0) -> (!quantum.bit) {
+        %h = quantum.custom "Hadamard"() %a : !quantum.bit
+        %q2 = scf.for %j = %c0 to %i step %c1 iter_args(%b = %h) -> (!quantum.bit) {
+            %out = quantum.custom "PauliX"() %b : !quantum.bit
+            scf.yield %out : !quantum.bit
+        }
+        scf.yield %q2 : !quantum.bit
+    }
+
+    return %q : !quantum.bit
+}
+
+// -----
+
+// Conditionals on an induction variable only count the branch taken at each iteration
+
+// CHECK-LABEL: "if_on_induction_var"
+// CHECK: "operations"
+// CHECK-DAG: "Hadamard(1)": 3
+// CHECK-DAG: "PauliX(1)": 7
+func.func @if_on_induction_var(%arg0: !quantum.bit) -> !quantum.bit {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c3 = arith.constant 3 : index
+    %c10 = arith.constant 10 : index
+
+    %q = scf.for %i = %c0 to %c10 step %c1 iter_args(%a = %arg0) -> (!quantum.bit) {
+        %cond = arith.cmpi slt, %i, %c3 : index
+        %r = scf.if %cond -> !quantum.bit {
+            %t = quantum.custom "Hadamard"() %a : !quantum.bit
+            scf.yield %t : !quantum.bit
+        } else {
+            %f = quantum.custom "PauliX"() %a : !quantum.bit
+            scf.yield %f : !quantum.bit
+        }
+        scf.yield %r : !quantum.bit
+    }
+
+    return %q : !quantum.bit
+}
+
+// -----
+
 // Measurements
 
 // CHECK-LABEL: "measurement_ops"
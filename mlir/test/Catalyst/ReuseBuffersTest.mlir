@@ -0,0 +1,81 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --pass-pipeline="builtin.module(func.func(reuse-buffers))" --split-input-file %s | FileCheck %s
+
+// CHECK-LABEL: @reuse_in_block
+func.func @reuse_in_block(%arg0: f64, %arg1: index) -> f64 {
+    // CHECK: [[buf:%.+]] = memref.alloc() : memref<4xf64>
+    // CHECK-NEXT: memref.store %arg0, [[buf]]
+    %0 = memref.alloc() : memref<4xf64>
+    memref.store %arg0, %0[%arg1] : memref<4xf64>
+    memref.dealloc %0 : memref<4xf64>
+
+    // A buffer of a different type is not reused
+    // CHECK-NEXT: [[other:%.+]] = memref.alloc() : memref<8xf64>
+    // CHECK-NEXT: memref.store %arg0, [[other]]
+    // CHECK-NEXT: memref.dealloc [[other]]
+    %1 = memref.alloc() : memref<8xf64>
+    memref.store %arg0, %1[%arg1] : memref<8xf64>
+    memref.dealloc %1 : memref<8xf64>
+
+    // CHECK-NEXT: memref.store %arg0, [[buf]]
+    // CHECK-NEXT: [[res:%.+]] = memref.load [[buf]]
+    // CHECK-NEXT: memref.dealloc [[buf]]
+    // CHECK-NEXT: return [[res]]
+    %2 = memref.alloc() : memref<4xf64>
+    memref.store %arg0, %2[%arg1] : memref<4xf64>
+    %3 = memref.load %2[%arg1] : memref<4xf64>
+    memref.dealloc %2 : memref<4xf64>
+    return %3 : f64
+}
+
+// -----
+
+// CHECK-LABEL: @hoist_from_loop
+func.func @hoist_from_loop(%arg0: f64, %arg1: index) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    // CHECK: [[buf:%.+]] = memref.alloc() : memref<4xf64>
+    // CHECK-NEXT: scf.for
+    scf.for %i = %c0 to %arg1 step %c1 {
+        // CHECK-NOT: memref.alloc
+        // CHECK-NOT: memref.dealloc
+        // CHECK: memref.store %arg0, [[buf]]
+        %0 = memref.alloc() : memref<4xf64>
+        memref.store %arg0, %0[%c0] : memref<4xf64>
+        memref.dealloc %0 : memref<4xf64>
+    }
+    // CHECK: }
+    // CHECK-NEXT: memref.dealloc [[buf]]
+    return
+}
+
+// -----
+
+// CHECK-LABEL: @dynamic_size_in_loop
+func.func @dynamic_size_in_loop(%arg0: f64, %arg1: index) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    // CHECK: scf.for [[i:%.+]] =
+    scf.for %i = %c0 to %arg1 step %c1 {
+        // CHECK-NEXT: [[buf:%.+]] = memref.alloc([[i]]) : memref<?xf64>
+        // CHECK-NEXT: memref.store
+        // CHECK-NEXT: memref.dealloc [[buf]]
+        %0 = memref.alloc(%i) : memref<?xf64>
+        memref.store %arg0, %0[%c0] : memref<?xf64>
+        memref.dealloc %0 : memref<?xf64>
+    }
+    return
+}
@@ -0,0 +1,135 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --scatter-lowering --split-input-file --verify-diagnostics | FileCheck %s
+
+// Point updates, e.g. `x.at[i].add(v)`, compute on the updated element directly.
+
+// CHECK-LABEL: func.func @point_add(
+// CHECK-SAME: [[x:%.+]]: tensor<5xf64>, [[indices:%.+]]: tensor<1xi32>, [[v:%.+]]: tensor<f64>
+func.func @point_add(%x: tensor<5xf64>, %indices: tensor<1xi32>, %v: tensor<f64>) -> tensor<5xf64> {
+  // CHECK-NOT: func.call
+  // CHECK: scf.for {{.*}} iter_args([[acc:%.+]] = [[x]]) -> (tensor<5xf64>)
+  // CHECK:   [[index:%.+]] = tensor.extract [[indices]]
+  // CHECK:   [[start:%.+]] = arith.index_cast [[index]] : i32 to index
+  // CHECK:   [[inbounds:%.+]] = arith.andi
+  // CHECK:   scf.if [[inbounds]] -> (tensor<5xf64>)
+  // CHECK:     [[current:%.+]] = tensor.extract [[acc]][[[start]]] : tensor<5xf64>
+  // CHECK:     [[update:%.+]] = tensor.extract [[v]][] : tensor<f64>
+  // CHECK:     [[sum:%.+]] = arith.addf [[current]], [[update]] : f64
+  // CHECK:     [[inserted:%.+]] = tensor.insert [[sum]] into [[acc]][[[start]]] : tensor<5xf64>
+  // CHECK:     scf.yield [[inserted]]
+  // CHECK:   } else {
+  // CHECK:     scf.yield [[acc]]
+  %0 = "stablehlo.scatter"(%x, %indices, %v) ({
+  ^bb0(%arg0: tensor<f64>, %arg1: tensor<f64>):
+    %1 = tensor.extract %arg0[] : tensor<f64>
+    %2 = tensor.extract %arg1[] : tensor<f64>
+    %3 = arith.addf %1, %2 : f64
+    %4 = tensor.from_elements %3 : tensor<f64>
+    stablehlo.return %4 : tensor<f64>
+  }) {indices_are_sorted = true, scatter_dimension_numbers = #stablehlo.scatter<inserted_window_dims = [0], scatter_dims_to_operand_dims = [0]>, unique_indices = true} : (tensor<5xf64>, tensor<1xi32>, tensor<f64>) -> tensor<5xf64>
+  return %0 : tensor<5xf64>
+}
+
+// -----
+
+// Segment sums, e.g. `x.at[indices].add(v)`, add whole rows with a linalg.generic, and support
+// indices which are neither unique nor sorted.
+
+// CHECK-LABEL: func.func @segment_sum(
+// CHECK-SAME: [[x:%.+]]: tensor<4x3xf64>, [[indices:%.+]]: tensor<6x1xi32>, [[v:%.+]]: tensor<6x3xf64>
+func.func @segment_sum(%x: tensor<4x3xf64>, %indices: tensor<6x1xi32>, %v: tensor<6x3xf64>) -> tensor<4x3xf64> {
+  // CHECK-DAG: [[c0:%.+]] = index.constant 0
+  // CHECK-DAG: [[c6:%.+]] = index.constant 6
+  // CHECK: scf.for [[i:%.+]] = [[c0]] to [[c6]] {{.*}} iter_args([[acc:%.+]] = [[x]]) -> (tensor<4x3xf64>)
+  // CHECK:   [[index:%.+]] = tensor.extract [[indices]][[[i]], {{%.+}}] : tensor<6x1xi32>
+  // CHECK:   [[start:%.+]] = arith.index_cast [[index]] : i32 to index
+  // CHECK:   arith.cmpi sle, [[start]], {{%.+}} : index
+  // CHECK:   scf.if
+  // CHECK:     [[update:%.+]] = tensor.extract_slice [[v]][[[i]], 0] [1, 3] [1, 1] : tensor<6x3xf64> to tensor<3xf64>
+  // CHECK:     [[current:%.+]] = tensor.extract_slice [[acc]][[[start]], 0] [1, 3] [1, 1] : tensor<4x3xf64> to tensor<3xf64>
+  // CHECK:     [[sum:%.+]] = linalg.generic {{.*}} ins([[update]] : tensor<3xf64>) outs([[current]] : tensor<3xf64>)
+  // CHECK:     ^bb0([[in:%.+]]: f64, [[out:%.+]]: f64):
+  // CHECK:       [[add:%.+]] = arith.addf [[out]], [[in]] : f64
+  // CHECK:       linalg.yield [[add]] : f64
+  // CHECK:     tensor.insert_slice [[sum]] into [[acc]][[[start]], 0] [1, 3] [1, 1] : tensor<3xf64> into tensor<4x3xf64>
+  %0 = "stablehlo.scatter"(%x, %indices, %v) ({
+  ^bb0(%arg0: tensor<f64>, %arg1: tensor<f64>):
+    %1 = tensor.extract %arg0[] : tensor<f64>
+    %2 = tensor.extract %arg1[] : tensor<f64>
+    %3 = arith.addf %1, %2 : f64
+    %4 = tensor.from_elements %3 : tensor<f64>
+    stablehlo.return %4 : tensor<f64>
+  }) {indices_are_sorted = false, scatter_dimension_numbers = #stablehlo.scatter<update_window_dims = [1], inserted_window_dims = [0], scatter_dims_to_operand_dims = [0], index_vector_dim = 1>, unique_indices = false} : (tensor<4x3xf64>, tensor<6x1xi32>, tensor<6x3xf64>) -> tensor<4x3xf64>
+  return %0 : tensor<4x3xf64>
+}
+
+// -----
+
+// Assignments of several rows insert the rows directly, and the update computation may be
+// wrapped in a rank-0 linalg.generic.
+
+#map = affine_map<() -> ()>
+
+// CHECK-LABEL: func.func @set_rows(
+// CHECK-SAME: [[x:%.+]]: tensor<4x3xf64>, [[indices:%.+]]: tensor<2xi32>, [[v:%.+]]: tensor<2x3xf64>
+func.func @set_rows(%x: tensor<4x3xf64>, %indices: tensor<2xi32>, %v: tensor<2x3xf64>) -> tensor<4x3xf64> {
+  // CHECK: scf.for [[i:%.+]] = {{.*}} iter_args([[acc:%.+]] = [[x]]) -> (tensor<4x3xf64>)
+  // CHECK:   [[index:%.+]] = tensor.extract [[indices]][[[i]]] : tensor<2xi32>
+  // CHECK:   [[start:%.+]] = arith.index_cast [[index]] : i32 to index
+  // CHECK:   scf.if
+  // CHECK:     [[update:%.+]] = tensor.extract_slice [[v]][[[i]], 0] [1, 3] [1, 1] : tensor<2x3xf64> to tensor<3xf64>
+  // CHECK-NOT: linalg.generic
+  // CHECK:     tensor.insert_slice [[update]] into [[acc]][[[start]], 0] [1, 3] [1, 1] : tensor<3xf64> into tensor<4x3xf64>
+  %0 = "stablehlo.scatter"(%x, %indices, %v) ({
+  ^bb0(%arg0: tensor<f64>, %arg1: tensor<f64>):
+    stablehlo.return %arg1 : tensor<f64>
+  }) {indices_are_sorted = true, scatter_dimension_numbers = #stablehlo.scatter<update_window_dims = [1], inserted_window_dims = [0], scatter_dims_to_operand_dims = [0], index_vector_dim = 1>, unique_indices = true} : (tensor<4x3xf64>, tensor<2xi32>, tensor<2x3xf64>) -> tensor<4x3xf64>
+  return %0 : tensor<4x3xf64>
+}
+
+// CHECK-LABEL: func.func @max_rows(
+func.func @max_rows(%x: tensor<4x3xf64>, %indices: tensor<2x1xi32>, %v: tensor<2x3xf64>) -> tensor<4x3xf64> {
+  // CHECK-NOT: func.call
+  // CHECK: linalg.generic
+  // CHECK:   arith.maximumf
+  %0 = "stablehlo.scatter"(%x, %indices, %v) ({
+  ^bb0(%arg0: tensor<f64>, %arg1: tensor<f64>):
+    %1 = tensor.empty() : tensor<f64>
+    %2 = linalg.generic {indexing_maps = [#map, #map, #map], iterator_types = []} ins(%arg0, %arg1 : tensor<f64>, tensor<f64>) outs(%1 : tensor<f64>) {
+    ^bb0(%in: f64, %in_0: f64, %out: f64):
+      %3 = arith.maximumf %in, %in_0 : f64
+      linalg.yield %3 : f64
+    } -> tensor<f64>
+    stablehlo.return %2 : tensor<f64>
+  }) {indices_are_sorted = true, scatter_dimension_numbers = #stablehlo.scatter<update_window_dims = [1], inserted_window_dims = [0], scatter_dims_to_operand_dims = [0], index_vector_dim = 1>, unique_indices = true} : (tensor<4x3xf64>, tensor<2x1xi32>, tensor<2x3xf64>) -> tensor<4x3xf64>
+  return %0 : tensor<4x3xf64>
+}
+
+// -----
+
+// Update computations on tensors are still called on every element.
+
+// CHECK-LABEL: func.func @tensor_computation(
+func.func @tensor_computation(%x: tensor<7x5xf64>, %indices: tensor<1xi32>, %v: tensor<5xf64>) -> tensor<7x5xf64> {
+  // CHECK-NOT: linalg.generic
+  // CHECK: func.call @__catalyst_update_scatter
+  %0 = "stablehlo.scatter"(%x, %indices, %v) ({
+  ^bb0(%arg0: tensor<f64>, %arg1: tensor<f64>):
+    %1 = stablehlo.add %arg0, %arg1 : tensor<f64>
+    stablehlo.return %1 : tensor<f64>
+  }) {indices_are_sorted = true, scatter_dimension_numbers = #stablehlo.scatter<update_window_dims = [0], inserted_window_dims = [0], scatter_dims_to_operand_dims = [0]>, unique_indices = true} : (tensor<7x5xf64>, tensor<1xi32>, tensor<5xf64>) -> tensor<7x5xf64>
+  return %0 : tensor<7x5xf64>
+}
@@ -0,0 +1,39 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --convert-gradient-to-llvm="adjoint-checkpoint-interval=16" %s | FileCheck %s
+// RUN: quantum-opt --convert-gradient-to-llvm %s | FileCheck %s --check-prefix=NOCKPT
+
+func.func private @circuit.nodealloc(%arg0: f32) -> (!quantum.reg)
+
+// CHECK-DAG:   llvm.func @__catalyst__rt__set_tape_checkpoint_interval(i64)
+// NOCKPT-NOT:  __catalyst__rt__set_tape_checkpoint_interval
+
+// CHECK-LABEL: func.func @adjoint_checkpointed
+func.func @adjoint_checkpointed(%arg0: f32, %arg1 : index) -> (memref<?xf64>) {
+    // CHECK-DAG:   [[T:%.+]] = llvm.mlir.constant(true) : i1
+    // CHECK-DAG:   [[K:%.+]] = llvm.mlir.constant(16 : i64) : i64
+
+    // The interval is set before the forward pass is recorded.
+    // CHECK:       llvm.call @__catalyst__rt__set_tape_checkpoint_interval([[K]]) : (i64) -> ()
+    // CHECK:       llvm.call @__catalyst__rt__toggle_recorder([[T]]) : (i1) -> ()
+    // CHECK:       call @circuit.nodealloc(%arg0)
+    // CHECK:       llvm.call @__catalyst__qis__Gradient
+    // CHECK:       [[zero:%.+]] = llvm.mlir.constant(0 : i64) : i64
+    // CHECK:       llvm.call @__catalyst__rt__set_tape_checkpoint_interval([[zero]]) : (i64) -> ()
+    %alloc0 = memref.alloc(%arg1) : memref<?xf64>
+    gradient.adjoint @circuit.nodealloc(%arg0) size(%arg1) in(%alloc0 : memref<?xf64>) : (f32) -> ()
+
+    return %alloc0 : memref<?xf64>
+}
@@ -0,0 +1,68 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --lower-gradients="batch-finite-diff" --split-input-file | FileCheck %s
+
+// Check that all perturbations of a tensor argument are evaluated by one batched call, shared by
+// all the results of the callee
+func.func private @funcMultiRes(%arg0: tensor<3xf64>) -> (f64, tensor<2xf64>) attributes {qnode, diff_method = "finite-diff"}
+
+// CHECK-LABEL: func.func private @funcMultiRes.fdbatch0(%arg0: tensor<3xf64>, %arg1: tensor<3x3xf64>) -> (tensor<3xf64>, tensor<3x2xf64>)
+    // CHECK:        [[RES:%.+]]:2 = scf.for [[IDX:%.+]] = {{%.+}} to {{%.+}} step {{%.+}} iter_args([[ACC0:%.+]] = {{%.+}}, [[ACC1:%.+]] = {{%.+}})
+    // CHECK:          [[INPUT:%.+]] = tensor.extract_slice %arg1[[[IDX]], 0] [1, 3] [1, 1] : tensor<3x3xf64> to tensor<3xf64>
+    // CHECK:          [[CALL:%.+]]:2 = func.call @funcMultiRes([[INPUT]])
+    // CHECK:          [[NEWACC0:%.+]] = tensor.insert [[CALL]]#0 into [[ACC0]][[[IDX]]]
+    // CHECK:          [[NEWACC1:%.+]] = tensor.insert_slice [[CALL]]#1 into [[ACC1]][[[IDX]], 0] [1, 2] [1, 1] : tensor<2xf64> into tensor<3x2xf64>
+    // CHECK:          scf.yield [[NEWACC0]], [[NEWACC1]]
+    // CHECK:        return [[RES]]#0, [[RES]]#1
+
+// CHECK-LABEL: @funcMultiRes.finitediff0(%arg0: tensor<3xf64>) -> (tensor<3xf64>, tensor<2x3xf64>)
+    // CHECK:        [[CALLPOS:%.+]]:2 = call @funcMultiRes(%arg0)
+    // CHECK:        [[INPUTS:%.+]] = tensor.generate
+    // CHECK:          arith.addf
+    // CHECK:          index.cmp eq
+    // CHECK:          arith.select
+    // CHECK:        [[BATCHED:%.+]]:2 = call @funcMultiRes.fdbatch0(%arg0, [[INPUTS]])
+    // CHECK-NOT:    call @funcMultiRes
+    // CHECK:        [[DIFF0:%.+]] = tensor.generate
+    // CHECK:          tensor.extract [[BATCHED]]#0
+    // CHECK:        arith.divf [[DIFF0]]
+    // CHECK:        [[DIFF1:%.+]] = tensor.generate
+    // CHECK:          tensor.extract [[CALLPOS]]#1
+    // CHECK:          tensor.extract [[BATCHED]]#1
+    // CHECK:        arith.divf [[DIFF1]]
+
+// CHECK-LABEL: @gradCallMultiRes
+func.func @gradCallMultiRes(%arg0: tensor<3xf64>) -> (tensor<3xf64>, tensor<2x3xf64>) {
+    // CHECK:   call @funcMultiRes.finitediff0(%arg0)
+    %0:2 = gradient.grad "fd" @funcMultiRes(%arg0) : (tensor<3xf64>) -> (tensor<3xf64>, tensor<2x3xf64>)
+    func.return %0#0, %0#1 : tensor<3xf64>, tensor<2x3xf64>
+}
+
+// -----
+
+// Check that dynamically-shaped arguments are not batched
+func.func private @funcDynamicTensor(%arg0: tensor<?xf64>) -> f64 attributes {qnode, diff_method = "finite-diff"}
+
+// CHECK-NOT: @funcDynamicTensor.fdbatch0
+// CHECK-LABEL: @funcDynamicTensor.finitediff0
+    // CHECK:        tensor.generate
+    // CHECK:          bufferization.clone
+    // CHECK:          call @funcDynamicTensor
+
+// CHECK-LABEL: @gradCallDynamicTensor
+func.func @gradCallDynamicTensor(%arg0: tensor<?xf64>) -> tensor<?xf64> {
+    %0 = gradient.grad "fd" @funcDynamicTensor(%arg0) : (tensor<?xf64>) -> tensor<?xf64>
+    func.return %0 : tensor<?xf64>
+}
@@ -279,3 +279,44 @@ func.func @gradCallMultiArg(%arg0: tensor<f64>, %arg1: tensor<2xf64>) -> (tensor
     %2:2 = gradient.grad "auto" @funcMultiArg(%arg0, %arg1) {diffArgIndices = dense<[0, 1]> : tensor<2xindex>} : (tensor<f64>, tensor<2xf64>) -> (tensor<f64>, tensor<2xf64>)
     func.return %0, %1, %2#0, %2#1 : tensor<f64>, tensor<2xf64>, tensor<f64>, tensor<2xf64>
 }
+
+// -----
+
+// Check that the values of value_and_grad are taken from the backward pass
+func.func @funcValueAndGrad(%arg0: tensor<f64>, %arg1: tensor<2xf64>) -> tensor<f64> attributes {qnode, diff_method = "parameter-shift"} {
+    func.return %arg0 : tensor<f64>
+}
+
+// CHECK-LABEL:  @funcValueAndGrad.fullgrad01(%arg0: tensor<f64>, %arg1: tensor<2xf64>, %arg2: index) -> (tensor<f64>, tensor<f64>, tensor<2xf64>)
+    // CHECK:        [[cotangent:%.+]] = tensor.insert
+    // CHECK:        [[res:%.+]]:3 = gradient.backprop @funcValueAndGrad.preprocess(%arg0, %arg1, %arg2) cotangents([[cotangent]] {{.+}}keepValueResults = true
+    // CHECK-NOT:    gradient.backprop
+    // CHECK:        return [[res]]#0, [[res]]#1, [[res]]#2
+
+// CHECK-LABEL:  @valueAndGradCall(%arg0: tensor<f64>, %arg1: tensor<2xf64>) -> (tensor<f64>, tensor<f64>, tensor<2xf64>)
+func.func @valueAndGradCall(%arg0: tensor<f64>, %arg1: tensor<2xf64>) -> (tensor<f64>, tensor<f64>, tensor<2xf64>) {
+    // CHECK:        [[pcount:%.+]] = call @funcValueAndGrad.pcount
+    // CHECK:        [[res:%.+]]:3 = call @funcValueAndGrad.fullgrad01(%arg0, %arg1, [[pcount]])
+    // CHECK:        return [[res]]#0, [[res]]#1, [[res]]#2
+    %0:3 = gradient.value_and_grad "auto" @funcValueAndGrad(%arg0, %arg1) {diffArgIndices = dense<[0, 1]> : tensor<2xindex>, resultSegmentSizes = array<i32: 1, 2>} : (tensor<f64>, tensor<2xf64>) -> (tensor<f64>, tensor<f64>, tensor<2xf64>)
+    func.return %0#0, %0#1, %0#2 : tensor<f64>, tensor<f64>, tensor<2xf64>
+}
+
+// -----
+
+// Check that only the first backward pass of a vector value keeps the values
+func.func @funcValueAndGradVector(%arg0: tensor<f64>) -> tensor<2xf64> attributes {qnode, diff_method = "parameter-shift"} {
+    %0 = tensor.from_elements %arg0, %arg0 : tensor<2xf64>
+    func.return %0 : tensor<2xf64>
+}
+
+// CHECK-LABEL:  @funcValueAndGradVector.fullgrad0(%arg0: tensor<f64>, %arg1: index) -> (tensor<2xf64>, tensor<2xf64>)
+    // CHECK:        [[first:%.+]]:2 = gradient.backprop @funcValueAndGradVector.preprocess(%arg0, %arg1) {{.+}}keepValueResults = true
+    // CHECK:        [[second:%.+]] = gradient.backprop @funcValueAndGradVector.preprocess(%arg0, %arg1) {{.+}}keepValueResults = false{{.+}}resultSegmentSizes = array<i32: 0, 1>
+    // CHECK-NOT:    gradient.backprop
+    // CHECK:        return [[first]]#0
+
+func.func @valueAndGradVectorCall(%arg0: tensor<f64>) -> (tensor<2xf64>, tensor<2xf64>) {
+    %0:2 = gradient.value_and_grad "auto" @funcValueAndGradVector(%arg0) {diffArgIndices = dense<0> : tensor<1xindex>, resultSegmentSizes = array<i32: 1, 1>} : (tensor<f64>) -> (tensor<2xf64>, tensor<2xf64>)
+    func.return %0#0, %0#1 : tensor<2xf64>, tensor<2xf64>
+}
@@ -0,0 +1,60 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --lower-gradients="batch-parameter-shift=true" --split-input-file | FileCheck %s
+
+// The shifted function is a QNode, so that its calls are dispatched asynchronously with the QNodes.
+// CHECK-LABEL: @batched_circuit.shifted
+// CHECK-SAME: attributes {qnode}
+
+// All shifted evaluations of a block are issued before any gradient element is computed, and the
+// pending elements are stored before the loop, to keep the gradient in order.
+// CHECK-LABEL: @batched_circuit.qgrad(%arg0: f64, %arg1: f64, %arg2: index) -> tensor<?xf64>
+// CHECK: [[epos0:%[a-zA-Z0-9_]+]] = call @batched_circuit.shifted
+// CHECK: [[eneg0:%[a-zA-Z0-9_]+]] = call @batched_circuit.shifted
+// CHECK: [[epos1:%[a-zA-Z0-9_]+]] = call @batched_circuit.shifted
+// CHECK: [[eneg1:%[a-zA-Z0-9_]+]] = call @batched_circuit.shifted
+// CHECK-NOT: call
+// CHECK: arith.subf [[epos0]], [[eneg0]]
+// CHECK: memref.store
+// CHECK: arith.subf [[epos1]], [[eneg1]]
+// CHECK: memref.store
+// CHECK: scf.for
+// CHECK: [[epos2:%[a-zA-Z0-9_]+]] = call @batched_circuit.shifted
+// CHECK: [[eneg2:%[a-zA-Z0-9_]+]] = call @batched_circuit.shifted
+// CHECK: arith.subf [[epos2]], [[eneg2]]
+// CHECK: memref.store
+// CHECK: scf.yield
+func.func @batched_circuit(%arg0: f64, %arg1: f64) -> f64 attributes {qnode, diff_method = "parameter-shift"} {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c3 = arith.constant 3 : index
+    %idx = arith.constant 0 : i64
+    %r = quantum.alloc(1) : !quantum.reg
+    %q_0 = quantum.extract %r[%idx] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "rz"(%arg0) %q_0 : !quantum.bit
+    %q_2 = quantum.custom "rx"(%arg1) %q_1 : !quantum.bit
+    %q_3 = scf.for %i = %c0 to %c3 step %c1 iter_args(%q = %q_2) -> !quantum.bit {
+        %q_4 = quantum.custom "ry"(%arg0) %q : !quantum.bit
+        scf.yield %q_4 : !quantum.bit
+    }
+    %obs = quantum.namedobs %q_3[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    func.return %expval : f64
+}
+
+func.func @gradCall0(%arg0: f64, %arg1: f64) -> (f64, f64) {
+    %0:2 = gradient.grad "auto" @batched_circuit(%arg0, %arg1) : (f64, f64) -> (f64, f64)
+    func.return %0#0, %0#1 : f64, f64
+}
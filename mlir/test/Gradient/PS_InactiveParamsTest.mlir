@@ -0,0 +1,65 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --lower-gradients="prune-inactive-params=true" | FileCheck %s --check-prefix=SHIFT
+// RUN: quantum-opt %s --lower-gradients="prune-inactive-params=true" | FileCheck %s --check-prefix=PCOUNT
+// RUN: quantum-opt %s --lower-gradients="prune-inactive-params=true" | FileCheck %s --check-prefix=QUANTUM
+
+// Only the parameter of the RX gate depends on the differentiable argument. The parameters of the
+// RY and RZ gates are computed from a constant and an integer argument, and are thus skipped.
+
+// SHIFT-LABEL: @circuit.shifted(%arg0: tensor<1xf64>, %arg1: i64, %arg2: tensor<1xf64>, %arg3: tensor<0xindex>) -> f64
+// SHIFT:         [[f0:%.+]] = tensor.extract %arg0
+// SHIFT:         [[s0:%.+]] = tensor.extract %arg2
+// SHIFT-NEXT:    [[r0:%.+]] = arith.addf [[s0]], [[f0]] : f64
+// SHIFT-NEXT:    [[q1:%.+]] = quantum.custom "rx"([[r0]])
+// SHIFT-NOT:     tensor.extract %arg2
+// SHIFT:         [[q2:%.+]] = quantum.custom "ry"(%cst{{.*}}) [[q1]]
+// SHIFT-NOT:     tensor.extract %arg2
+// SHIFT:         quantum.custom "rz"(%{{.+}}) [[q2]]
+
+// PCOUNT-LABEL: @circuit.pcount(%arg0: tensor<1xf64>, %arg1: i64) -> index
+// PCOUNT:         [[c1:%.+]] = index.constant 1
+// PCOUNT:         index.add %{{.+}}, [[c1]]
+// PCOUNT-NOT:     index.add
+// PCOUNT:         return
+
+// QUANTUM-LABEL: @circuit.quantum(%arg0: tensor<1xf64>, %arg1: i64, %arg2: tensor<?xf64>) -> f64
+// QUANTUM:         [[p0:%.+]] = tensor.extract %arg2
+// QUANTUM:         [[q1:%.+]] = quantum.custom "rx"([[p0]])
+// QUANTUM-NOT:     tensor.extract %arg2
+// QUANTUM:         quantum.custom "ry"(%cst{{.*}}) [[q1]]
+func.func @circuit(%arg0: tensor<1xf64>, %arg1: i64) -> f64 attributes {qnode, diff_method = "parameter-shift"} {
+    %c0 = arith.constant 0 : index
+    %cst = arith.constant 0.5 : f64
+    %f0 = tensor.extract %arg0[%c0] : tensor<1xf64>
+    %n = arith.sitofp %arg1 : i64 to f64
+    %f1 = arith.mulf %n, %cst : f64
+
+    %idx = arith.constant 0 : i64
+    %r_0 = quantum.alloc(1) : !quantum.reg
+    %q_0 = quantum.extract %r_0[%idx] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "rx"(%f0) %q_0 : !quantum.bit
+    %q_2 = quantum.custom "ry"(%cst) %q_1 : !quantum.bit
+    %q_3 = quantum.custom "rz"(%f1) %q_2 : !quantum.bit
+
+    %r_1 = quantum.insert %r_0[%idx], %q_3 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    func.return %f0 : f64
+}
+
+func.func @gradCall(%arg0: tensor<1xf64>, %arg1: i64) -> tensor<1xf64> {
+    %0 = gradient.grad "auto" @circuit(%arg0, %arg1) : (tensor<1xf64>, i64) -> tensor<1xf64>
+    func.return %0 : tensor<1xf64>
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --lower-gradients="vjp-parameter-shift=true" --split-input-file | FileCheck %s
+
+// The vector-Jacobian product takes the cotangents of the results after the QNode arguments, and
+// contracts the partial derivatives of both results with them before storing a single element
+// per gate parameter, instead of storing a gradient buffer per result.
+// CHECK-LABEL: @two_results.qvjp(%arg0: f64, %arg1: f64, %arg2: f64, %arg3: index) -> tensor<?xf64>
+// CHECK: [[grad:%.+]] = memref.alloc(%arg3) : memref<?xf64>
+// CHECK-NOT: memref.alloc
+// CHECK: scf.for
+// CHECK: [[d0:%.+]] = arith.mulf {{%.+}}, %arg1 : f64
+// CHECK: [[vjp0:%.+]] = arith.addf {{%.+}}, [[d0]] : f64
+// CHECK: [[d1:%.+]] = arith.mulf {{%.+}}, %arg2 : f64
+// CHECK: [[vjp1:%.+]] = arith.addf [[vjp0]], [[d1]] : f64
+// CHECK: memref.store [[vjp1]], [[grad]]
+// CHECK-NOT: memref.store {{%.+}}, [[grad]]
+// CHECK: scf.yield
+
+func.func @two_results(%arg0: f64) -> (f64, f64) attributes {qnode, diff_method = "parameter-shift"} {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c3 = arith.constant 3 : index
+    %idx = arith.constant 0 : i64
+    %r = quantum.alloc(1) : !quantum.reg
+    %q_0 = quantum.extract %r[%idx] : !quantum.reg -> !quantum.bit
+    %q_1 = scf.for %i = %c0 to %c3 step %c1 iter_args(%q = %q_0) -> !quantum.bit {
+        %q_2 = quantum.custom "ry"(%arg0) %q : !quantum.bit
+        scf.yield %q_2 : !quantum.bit
+    }
+    %obs_z = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval_z = quantum.expval %obs_z : f64
+    %obs_x = quantum.namedobs %q_1[PauliX] : !quantum.obs
+    %expval_x = quantum.expval %obs_x : f64
+    func.return %expval_z, %expval_x : f64, f64
+}
+
+func.func @gradCall0(%arg0: f64) -> (f64, f64) {
+    %0:2 = gradient.grad "auto" @two_results(%arg0) : (f64) -> (f64, f64)
+    func.return %0#0, %0#1 : f64, f64
+}
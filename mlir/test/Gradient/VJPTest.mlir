@@ -14,6 +14,8 @@
 
 // RUN: quantum-opt %s --lower-gradients | FileCheck %s
 
+// The generic lowering contracts the cotangents with the Jacobian of the callee
+
 func.func private @func1(tensor<4xf64>) -> tensor<3x4xf64>
 func.func public @vjptest1(
     %arg0: tensor<4xf64>
@@ -21,6 +23,7 @@ func.func public @vjptest1(
   ) -> (tensor<3x4xf64>, tensor<4xf64>)
   attributes {llvm.emit_c_interface}
 {
+  // CHECK-LABEL: func.func public @vjptest1
   // CHECK:      call @func1
   // CHECK-SAME:     : (tensor<4xf64>) -> tensor<3x4xf64>
 
@@ -34,7 +37,7 @@ func.func public @vjptest1(
       callee = @func1
     , diffArgIndices = dense<0> : tensor<1xi64>
     , finiteDiffParam = 9.9999999999999995E-8 : f64
-    , method = "auto"
+    , method = "fd"
     , operand_segment_sizes = array<i32: 1, 1>
     , result_segment_sizes = array<i32: 1, 1>
     } : (tensor<4xf64>, tensor<3x4xf64>) -> (tensor<3x4xf64>, tensor<4xf64>)
@@ -50,6 +53,7 @@ func.func public @vjptest2(
   ) -> (tensor<6xf64>, tensor<2x6xf64>, tensor<3x2xf64>, tensor<2x3xf64>)
   attributes {llvm.emit_c_interface}
 {
+  // CHECK-LABEL: func.func public @vjptest2
   // CHECK:      call @func2
   // CHECK-SAME:     : (tensor<3x2xf64>, tensor<2x3xf64>) -> (tensor<6xf64>, tensor<2x6xf64>)
 
@@ -75,7 +79,7 @@ func.func public @vjptest2(
       callee = @func2
     , diffArgIndices = dense<[0, 1]> : tensor<2xi64>
     , finiteDiffParam = 9.9999999999999995E-8 : f64
-    , method = "auto"
+    , method = "fd"
     , operand_segment_sizes = array<i32: 2, 2>
     , result_segment_sizes = array<i32: 2, 2>
     } : (tensor<3x2xf64>, tensor<2x3xf64>, tensor<6xf64>, tensor<2x6xf64>)
@@ -83,3 +87,35 @@ func.func public @vjptest2(
   return %0#0, %0#1, %0#2, %0#3
       : tensor<6xf64>, tensor<2x6xf64>, tensor<3x2xf64>, tensor<2x3xf64>
 }
+
+// With Enzyme, a single backward pass is seeded with the cotangents, which also gives the callee
+// results
+
+func.func private @func3(tensor<4xf64>, f64) -> (tensor<3xf64>, f64)
+func.func public @vjptest3(
+    %arg0: tensor<4xf64>
+  , %arg1: f64
+  , %arg2: tensor<3xf64>
+  , %arg3: f64
+  ) -> (tensor<3xf64>, f64, tensor<4xf64>, f64)
+  attributes {llvm.emit_c_interface}
+{
+  // CHECK-LABEL: func.func public @vjptest3
+  // CHECK-NOT:  call @func3
+  // CHECK:      [[cotang:%.+]] = tensor.from_elements %arg3 : tensor<f64>
+  // CHECK:      [[res:%.+]]:4 = gradient.backprop @func3.cloned(%arg0, %arg1)
+  // CHECK-SAME:     cotangents(%arg2, [[cotang]] : tensor<3xf64>, tensor<f64>)
+  // CHECK-SAME:     keepValueResults = true
+  // CHECK-SAME:     : (tensor<4xf64>, f64) -> (tensor<3xf64>, f64, tensor<4xf64>, f64)
+  // CHECK-NOT:  linalg.generic
+  // CHECK:      return [[res]]#0, [[res]]#1, [[res]]#2, [[res]]#3
+  %0:4 = "gradient.vjp"(%arg0, %arg1, %arg2, %arg3) {
+      callee = @func3
+    , diffArgIndices = dense<[0, 1]> : tensor<2xi64>
+    , finiteDiffParam = 9.9999999999999995E-8 : f64
+    , method = "auto"
+    , operand_segment_sizes = array<i32: 2, 2>
+    , result_segment_sizes = array<i32: 2, 2>
+    } : (tensor<4xf64>, f64, tensor<3xf64>, f64) -> (tensor<3xf64>, f64, tensor<4xf64>, f64)
+  return %0#0, %0#1, %0#2, %0#3 : tensor<3xf64>, f64, tensor<4xf64>, f64
+}
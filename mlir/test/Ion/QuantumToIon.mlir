@@ -581,3 +581,38 @@ func.func @example_measure() -> (i1, !quantum.bit) attributes {qnode} {
     %mres, %q_out = quantum.measure %2 : i1, !quantum.bit
     return %mres, %q_out : i1, !quantum.bit
 }
+
+
+// -----
+
+
+// Durations of gates with static angles are folded at compile time, and repeated gates on the
+// same qubit share their beams
+// CHECK-LABEL: example_static_angle
+func.func @example_static_angle() -> !quantum.bit attributes {qnode} {
+    %angle = arith.constant 2.000000e+00 : f64
+    %negative_angle = arith.constant -1.000000e+00 : f64
+
+    %1 = quantum.alloc( 1) : !quantum.reg
+    %2 = quantum.extract %1[ 0] : !quantum.reg -> !quantum.bit
+
+    // CHECK-NOT: arith.remf
+    // CHECK-NOT: arith.divf
+    // CHECK: [[time0:%.+]] = arith.constant 7.27{{[0-9]+}} : f64
+    // CHECK: ion.parallelprotocol
+    // CHECK: ion.pulse([[time0]] : f64) %arg0 {
+    // CHECK-SAME:     beam = #ion.beam<transition_index = 0 : i64, rabi = 1.100000e+00 : f64
+    // CHECK: ion.pulse([[time0]] : f64) %arg0 {
+    // CHECK-SAME:     beam = #ion.beam<transition_index = 2 : i64, rabi = 1.100000e+00 : f64
+    %3 = quantum.custom "RX"(%angle) %2 : !quantum.bit
+
+    // CHECK: [[time1:%.+]] = arith.constant 42.0{{[0-9]+}} : f64
+    // CHECK: ion.parallelprotocol
+    // CHECK: ion.pulse([[time1]] : f64) %arg0 {
+    // CHECK-SAME:     beam = #ion.beam<transition_index = 0 : i64, rabi = 1.100000e+00 : f64
+    // CHECK: ion.pulse([[time1]] : f64) %arg0 {
+    // CHECK-SAME:     beam = #ion.beam<transition_index = 2 : i64, rabi = 1.100000e+00 : f64
+    // CHECK-NOT: arith.divf
+    %4 = quantum.custom "RX"(%negative_angle) %3 : !quantum.bit
+    return %4 : !quantum.bit
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s \
+// RUN:   --convert-arith-to-llvm \
+// RUN:   --convert-mbqc-to-llvm="batch-measurements=true" \
+// RUN:   --convert-quantum-to-llvm \
+// RUN:   --reconcile-unrealized-casts \
+// RUN:   --split-input-file \
+// RUN: | FileCheck %s
+
+// CHECK-LABEL: @batch_measurements
+module @batch_measurements {
+  // CHECK: llvm.func @__catalyst__mbqc__measure_in_basis_array(i64, !llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture})
+  // CHECK-LABEL: @test
+  func.func @test(%q0: !quantum.bit, %q1: !quantum.bit, %q2: !quantum.bit, %angle: f64) -> (i1, i1, i1) {
+    // The first two measurements are independent and measured as a batch
+    // CHECK-NOT: llvm.call @__catalyst__mbqc__measure_in_basis(
+    // CHECK: llvm.call @__catalyst__mbqc__measure_in_basis_array({{%.+}}, {{%.+}}, {{%.+}}, {{%.+}}, {{%.+}}, [[results:%[0-9]+]])
+    // CHECK: [[ptr0:%.+]] = llvm.getelementptr inbounds [[results]][0]
+    // CHECK: [[res0:%.+]] = llvm.load [[ptr0]] : !llvm.ptr -> !llvm.ptr
+    // CHECK: [[ptr1:%.+]] = llvm.getelementptr inbounds [[results]][1]
+    // CHECK: [[res1:%.+]] = llvm.load [[ptr1]] : !llvm.ptr -> !llvm.ptr
+    // CHECK: [[m0:%.+]] = llvm.load [[res0]] : !llvm.ptr -> i1
+    // CHECK: [[m1:%.+]] = llvm.load [[res1]] : !llvm.ptr -> i1
+    %m0, %q3 = mbqc.measure_in_basis [XY, %angle] %q0 : i1, !quantum.bit
+    %m1, %q4 = mbqc.measure_in_basis [YZ, %angle] %q1 : i1, !quantum.bit
+
+    // The basis of the last measurement is fed forward from the first, so it is not batched
+    // CHECK: [[fed:%.+]] = llvm.select [[m0]], {{%.+}}, %arg3
+    // CHECK: llvm.call @__catalyst__mbqc__measure_in_basis(%arg2, {{%.+}}, [[fed]], {{%.+}})
+    // CHECK-NOT: llvm.call @__catalyst__mbqc__measure_in_basis_array
+    %zero = arith.constant 0.0 : f64
+    %fed = arith.select %m0, %zero, %angle : f64
+    %m2, %q5 = mbqc.measure_in_basis [XY, %fed] %q2 : i1, !quantum.bit
+    return %m0, %m1, %m2 : i1, i1, i1
+  }
+}
+
+// -----
+
+// CHECK-LABEL: @single_measurement
+module @single_measurement {
+  // CHECK-NOT: __catalyst__mbqc__measure_in_basis_array
+  func.func @test(%q0: !quantum.bit, %angle: f64) -> i1 {
+    // CHECK: llvm.call @__catalyst__mbqc__measure_in_basis(
+    %m0, %q1 = mbqc.measure_in_basis [XY, %angle] %q0 : i1, !quantum.bit
+    return %m0 : i1
+  }
+}
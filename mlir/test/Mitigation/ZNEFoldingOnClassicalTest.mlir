@@ -293,3 +293,44 @@ func.func @qjitZne(%arg0: tensor<3xf64>, %arg1: f64) -> tensor<5xf64> {
     %0 = mitigation.zne @multipleQnodes(%arg0, %arg1) folding (global) numFolds (%numFolds : tensor<5xindex>) : (tensor<3xf64>, f64) -> tensor<5xf64>
     func.return %0 : tensor<5xf64>
 }
+
+// -----
+
+func.func @circuit(%arg0: tensor<3xf64>) -> f64 attributes {qnode} {
+    %shots = arith.constant 0 : i64
+    quantum.device shots(%shots) ["rtd_lightning.so", "LightningQubit", "{}"]
+    %c0 = arith.constant 0 : index
+    %f0 = tensor.extract %arg0[%c0] : tensor<3xf64>
+    %r = quantum.alloc(1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "rx"(%f0) %q_0 : !quantum.bit
+    %12 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    %obs = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    quantum.dealloc %12 : !quantum.reg
+    quantum.device_release
+    func.return %expval : f64
+}
+
+func.func @classical(%arg0: tensor<3xf64>) -> f64 {
+    %0 = call @circuit(%arg0) : (tensor<3xf64>) -> f64
+    %1 = arith.mulf %0, %0 : f64
+    return %1 : f64
+}
+
+// The ZNE operations with different scale factors share the folded functions
+// CHECK:         func.func private @circuit.folded(
+// CHECK-NOT:     func.func private @circuit.folded(
+// CHECK:         func.func @classical.zne(
+// CHECK-NOT:     func.func @classical.zne(
+// CHECK:         func.func @qjitZneTwice(%arg0: tensor<3xf64>) -> (tensor<3xf64>, tensor<2xf64>) {
+// CHECK:           func.call @classical.zne
+// CHECK:           func.call @classical.zne
+
+func.func @qjitZneTwice(%arg0: tensor<3xf64>) -> (tensor<3xf64>, tensor<2xf64>) {
+    %numFolds = arith.constant dense<[1, 2, 3]> : tensor<3xindex>
+    %0 = mitigation.zne @classical(%arg0) folding (global) numFolds (%numFolds : tensor<3xindex>) : (tensor<3xf64>) -> tensor<3xf64>
+    %numFoldsLarge = arith.constant dense<[50, 100]> : tensor<2xindex>
+    %1 = mitigation.zne @classical(%arg0) folding (global) numFolds (%numFoldsLarge : tensor<2xindex>) : (tensor<3xf64>) -> tensor<2xf64>
+    func.return %0, %1 : tensor<3xf64>, tensor<2xf64>
+}
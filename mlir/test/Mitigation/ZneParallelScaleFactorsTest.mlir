@@ -0,0 +1,76 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --lower-mitigation="parallel-scale-factors=true" --split-input-file --verify-diagnostics | FileCheck %s
+
+func.func @circuit(%arg0: f64) -> f64 attributes {qnode} {
+    %shots = arith.constant 0 : i64
+    quantum.device shots(%shots) ["rtd_lightning.so", "LightningQubit", "{}"]
+    %r = quantum.alloc(1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "rx"(%arg0) %q_0 : !quantum.bit
+    %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    %obs = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    func.return %expval : f64
+}
+
+// CHECK-LABEL: func.func @zneParallel(%arg0: f64) -> tensor<5xf64> {
+    // CHECK-DAG:    [[numFolds:%.+]] = arith.constant dense<[1, 2, 3, 4, 5]> : tensor<5xindex>
+    // CHECK-DAG:    [[empty:%.+]] = tensor.empty() : tensor<5xf64>
+    // CHECK:        [[results:%.+]] = scf.forall ([[i:%.+]]) in (5) shared_outs([[out:%.+]] = [[empty]]) -> (tensor<5xf64>) {
+        // CHECK:    [[numFold:%.+]] = tensor.extract [[numFolds]]{{\[}}[[i]]] : tensor<5xindex>
+        // CHECK:    [[result:%.+]] = func.call @circuit.folded(%arg0, [[numFold]]) : (f64, index) -> f64
+        // CHECK:    [[row:%.+]] = tensor.from_elements [[result]] : tensor<1xf64>
+        // CHECK:    scf.forall.in_parallel {
+            // CHECK:    tensor.parallel_insert_slice [[row]] into [[out]]{{\[}}[[i]]] [1] [1] : tensor<1xf64> into tensor<5xf64>
+    // CHECK-NOT:    scf.for
+    // CHECK:        return [[results]]
+func.func @zneParallel(%arg0: f64) -> tensor<5xf64> {
+    %numFolds = arith.constant dense<[1, 2, 3, 4, 5]> : tensor<5xindex>
+    %0 = mitigation.zne @circuit(%arg0) folding (global) numFolds (%numFolds : tensor<5xindex>) : (f64) -> tensor<5xf64>
+    func.return %0 : tensor<5xf64>
+}
+
+// -----
+
+func.func @circuitTwoResults(%arg0: f64) -> (f64, f64) attributes {qnode} {
+    %shots = arith.constant 0 : i64
+    quantum.device shots(%shots) ["rtd_lightning.so", "LightningQubit", "{}"]
+    %r = quantum.alloc(1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "rx"(%arg0) %q_0 : !quantum.bit
+    %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    %obs_z = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval_z = quantum.expval %obs_z : f64
+    %obs_y = quantum.namedobs %q_1[PauliY] : !quantum.obs
+    %expval_y = quantum.expval %obs_y : f64
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    func.return %expval_z, %expval_y : f64, f64
+}
+
+// CHECK-LABEL: func.func @zneParallelTwoResults(%arg0: f64) -> tensor<3x2xf64> {
+    // CHECK:        scf.forall ([[i:%.+]]) in (3) shared_outs([[out:%.+]] = {{%.+}}) -> (tensor<3x2xf64>) {
+        // CHECK:    [[result:%.+]]:2 = func.call @circuitTwoResults.folded(%arg0, {{%.+}}) : (f64, index) -> (f64, f64)
+        // CHECK:    [[row:%.+]] = tensor.from_elements [[result]]#0, [[result]]#1 : tensor<1x2xf64>
+        // CHECK:    scf.forall.in_parallel {
+            // CHECK:    tensor.parallel_insert_slice [[row]] into [[out]]{{\[}}[[i]], 0] [1, 2] [1, 1] : tensor<1x2xf64> into tensor<3x2xf64>
+func.func @zneParallelTwoResults(%arg0: f64) -> tensor<3x2xf64> {
+    %numFolds = arith.constant dense<[1, 2, 3]> : tensor<3xindex>
+    %0 = mitigation.zne @circuitTwoResults(%arg0) folding (global) numFolds (%numFolds : tensor<3xindex>) : (f64) -> tensor<3x2xf64>
+    func.return %0 : tensor<3x2xf64>
+}
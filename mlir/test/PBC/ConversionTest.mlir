@@ -22,18 +22,18 @@
 
 // CHECK-LABEL: @test_ppr
 module @test_ppr {
-    // CHECK: llvm.func @__catalyst__qis__PauliRot(!llvm.ptr, f64, !llvm.ptr, i1, i64, ...)
-    // CHECK: llvm.mlir.global internal constant @pauli_word_XIZ("XIZ\00")
+    // CHECK: llvm.func @__catalyst__qis__PackedPauliRot_array(!llvm.ptr {llvm.nocapture, llvm.readonly}, f64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i1, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
+    // CHECK: llvm.mlir.global internal constant @pauli_masks_XIZ(dense<[1, 4]> : tensor<2xi64>)
     func.func @ppr(%q0 : !quantum.bit, %q1 : !quantum.bit, %q2 : !quantum.bit, %pred : i1) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
         // CHECK-DAG: [[ctrue:%.+]] = llvm.mlir.constant(true) : i1
         // CHECK-DAG: [[theta:%.+]] = llvm.mlir.constant(1.5
-        // CHECK-DAG: llvm.mlir.addressof @pauli_word_XIZ : !llvm.ptr
-        // CHECK-DAG: [[pauliPtr:%.+]] = llvm.getelementptr inbounds {{.*}}[0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.array<4 x i8>
+        // CHECK-DAG: [[pauliPtr:%.+]] = llvm.mlir.addressof @pauli_masks_XIZ : !llvm.ptr
         // CHECK-DAG: [[zero:%.+]] = llvm.mlir.zero : !llvm.ptr
-        // CHECK-DAG: [[numQubits:%.+]] = llvm.mlir.constant(3 : i64) : i64
-        // CHECK: llvm.call @__catalyst__qis__PauliRot([[pauliPtr]], [[theta]], [[zero]], [[ctrue]], [[numQubits]], %arg0, %arg1, %arg2)
+        // CHECK: llvm.store %arg2, {{%.+}} : !llvm.ptr, !llvm.ptr
+        // CHECK: [[numQubits:%.+]] = llvm.mlir.constant(3 : i64) : i64
+        // CHECK: llvm.call @__catalyst__qis__PackedPauliRot_array([[pauliPtr]], [[theta]], [[zero]], [[ctrue]], [[numQubits]], {{%.+}})
         %qs:3 = pbc.ppr ["X", "I", "Z"](4) %q0, %q1, %q2 : !quantum.bit, !quantum.bit, !quantum.bit
-        // CHECK: llvm.call @__catalyst__qis__PauliRot({{%.+}}, {{%.+}}, {{%.+}}, %arg3, {{%.+}}, %arg0, %arg1, %arg2)
+        // CHECK: llvm.call @__catalyst__qis__PackedPauliRot_array({{%.+}}, {{%.+}}, {{%.+}}, %arg3, {{%.+}}, {{%.+}})
         %out:3 = pbc.ppr ["X", "I", "Z"](4) %qs#0, %qs#1, %qs#2 cond(%pred) : !quantum.bit, !quantum.bit, !quantum.bit
         return %out#0, %out#1, %out#2 : !quantum.bit, !quantum.bit, !quantum.bit
     }
@@ -44,19 +44,19 @@ module @test_ppr {
 
 // CHECK-LABEL: @test_ppr_arbitrary
 module @test_ppr_arbitrary {
-    // CHECK: llvm.func @__catalyst__qis__PauliRot(!llvm.ptr, f64, !llvm.ptr, i1, i64, ...)
-    // CHECK: llvm.mlir.global internal constant @pauli_word_XZ("XZ\00")
+    // CHECK: llvm.func @__catalyst__qis__PackedPauliRot_array(!llvm.ptr {llvm.nocapture, llvm.readonly}, f64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i1, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
+    // CHECK: llvm.mlir.global internal constant @pauli_masks_XZ(dense<[1, 2]> : tensor<2xi64>)
     func.func @ppr_arbitrary(%q0 : !quantum.bit, %q1 : !quantum.bit, %theta : f64, %pred : i1) -> (!quantum.bit, !quantum.bit) {
         // CHECK-DAG: [[ctrue:%.+]] = llvm.mlir.constant(true) : i1
         // CHECK-DAG: [[CONST2:%.+]] = llvm.mlir.constant(2.000000e+00 : f64) : f64
         // CHECK-DAG: [[MUL:%.+]] = llvm.fmul %arg2, [[CONST2]] : f64
-        // CHECK-DAG: llvm.mlir.addressof @pauli_word_XZ : !llvm.ptr
-        // CHECK-DAG: [[pauliPtr:%.+]] = llvm.getelementptr inbounds {{.*}}[0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.array<3 x i8>
+        // CHECK-DAG: [[pauliPtr:%.+]] = llvm.mlir.addressof @pauli_masks_XZ : !llvm.ptr
         // CHECK-DAG: [[zero:%.+]] = llvm.mlir.zero : !llvm.ptr
-        // CHECK-DAG: [[numQubits:%.+]] = llvm.mlir.constant(2 : i64) : i64
-        // CHECK: llvm.call @__catalyst__qis__PauliRot([[pauliPtr]], [[MUL]], [[zero]], [[ctrue]], [[numQubits]], %arg0, %arg1)
+        // CHECK: llvm.store %arg1, {{%.+}} : !llvm.ptr, !llvm.ptr
+        // CHECK: [[numQubits:%.+]] = llvm.mlir.constant(2 : i64) : i64
+        // CHECK: llvm.call @__catalyst__qis__PackedPauliRot_array([[pauliPtr]], [[MUL]], [[zero]], [[ctrue]], [[numQubits]], {{%.+}})
         %qs:2 = pbc.ppr.arbitrary ["X", "Z"](%theta) %q0, %q1 : !quantum.bit, !quantum.bit
-        // CHECK: llvm.call @__catalyst__qis__PauliRot({{%.+}}, {{%.+}}, {{%.+}}, %arg3, {{%.+}}, %arg0, %arg1)
+        // CHECK: llvm.call @__catalyst__qis__PackedPauliRot_array({{%.+}}, {{%.+}}, {{%.+}}, %arg3, {{%.+}}, {{%.+}})
         %out:2 = pbc.ppr.arbitrary ["X", "Z"](%theta) %qs#0, %qs#1 cond(%pred) : !quantum.bit, !quantum.bit
         return %out#0, %out#1 : !quantum.bit, !quantum.bit
     }
@@ -66,15 +66,14 @@ module @test_ppr_arbitrary {
 
 // CHECK-LABEL: @test_ppm
 module @test_ppm {
-    // CHECK: llvm.func @__catalyst__qis__PauliMeasure(!llvm.ptr, i1, !llvm.ptr, i1, i1, i64, ...) -> !llvm.ptr
-    // CHECK: llvm.mlir.global internal constant @pauli_word_XY("XY\00")
+    // CHECK: llvm.func @__catalyst__qis__PackedPauliMeasure(!llvm.ptr {llvm.nocapture, llvm.readonly}, i1, !llvm.ptr {llvm.nocapture, llvm.readonly}, i1, i1, i64, ...) -> !llvm.ptr
+    // CHECK: llvm.mlir.global internal constant @pauli_masks_XY(dense<[3, 2]> : tensor<2xi64>)
     func.func @ppm(%q0 : !quantum.bit, %q1 : !quantum.bit) -> (i1, !quantum.bit, !quantum.bit) {
         // CHECK-DAG: [[ctrue:%.+]] = llvm.mlir.constant(true) : i1
         // CHECK-DAG: [[cfalse:%.+]] = llvm.mlir.constant(false) : i1
-        // CHECK-DAG: llvm.mlir.addressof @pauli_word_XY : !llvm.ptr
-        // CHECK-DAG: [[pauliPtr:%.+]] = llvm.getelementptr inbounds {{.*}}[0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.array<3 x i8>
+        // CHECK-DAG: [[pauliPtr:%.+]] = llvm.mlir.addressof @pauli_masks_XY : !llvm.ptr
         // CHECK-DAG: [[numQubits:%.+]] = llvm.mlir.constant(2 : i64) : i64
-        // CHECK: [[resultPtr:%.+]] = llvm.call @__catalyst__qis__PauliMeasure([[pauliPtr]], [[cfalse]], [[pauliPtr]], [[cfalse]], [[ctrue]], [[numQubits]], %arg0, %arg1)
+        // CHECK: [[resultPtr:%.+]] = llvm.call @__catalyst__qis__PackedPauliMeasure([[pauliPtr]], [[cfalse]], [[pauliPtr]], [[cfalse]], [[ctrue]], [[numQubits]], %arg0, %arg1)
         // CHECK: [[mres:%.+]] = llvm.load [[resultPtr]] : !llvm.ptr -> i1
         %mres, %out:2 = pbc.ppm ["X", "Y"] %q0, %q1 : i1, !quantum.bit, !quantum.bit
         return %mres, %out#0, %out#1 : i1, !quantum.bit, !quantum.bit
@@ -85,15 +84,14 @@ module @test_ppm {
 
 // CHECK-LABEL: @test_ppm_negative_basis
 module @test_ppm_negative_basis {
-    // CHECK: llvm.func @__catalyst__qis__PauliMeasure(!llvm.ptr, i1, !llvm.ptr, i1, i1, i64, ...) -> !llvm.ptr
-    // CHECK: llvm.mlir.global internal constant @pauli_word_XY("XY\00")
+    // CHECK: llvm.func @__catalyst__qis__PackedPauliMeasure(!llvm.ptr {llvm.nocapture, llvm.readonly}, i1, !llvm.ptr {llvm.nocapture, llvm.readonly}, i1, i1, i64, ...) -> !llvm.ptr
+    // CHECK: llvm.mlir.global internal constant @pauli_masks_XY(dense<[3, 2]> : tensor<2xi64>)
     func.func @ppm_negative_basis(%q0 : !quantum.bit, %q1 : !quantum.bit) -> (i1, !quantum.bit, !quantum.bit) {
         // CHECK-DAG: [[neg:%.+]] = llvm.mlir.constant(true) : i1
         // CHECK-DAG: [[switch:%.+]] = llvm.mlir.constant(true) : i1
-        // CHECK-DAG: llvm.mlir.addressof @pauli_word_XY : !llvm.ptr
-        // CHECK-DAG: [[pauliPtr:%.+]] = llvm.getelementptr inbounds {{.*}}[0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.array<3 x i8>
+        // CHECK-DAG: [[pauliPtr:%.+]] = llvm.mlir.addressof @pauli_masks_XY : !llvm.ptr
         // CHECK-DAG: [[numQubits:%.+]] = llvm.mlir.constant(2 : i64) : i64
-        // CHECK: [[resultPtr:%.+]] = llvm.call @__catalyst__qis__PauliMeasure([[pauliPtr]], [[neg]], [[pauliPtr]], [[neg]], [[switch]], [[numQubits]], %arg0, %arg1)
+        // CHECK: [[resultPtr:%.+]] = llvm.call @__catalyst__qis__PackedPauliMeasure([[pauliPtr]], [[neg]], [[pauliPtr]], [[neg]], [[switch]], [[numQubits]], %arg0, %arg1)
         // CHECK: [[mres:%.+]] = llvm.load [[resultPtr]] : !llvm.ptr -> i1
         %mres, %out:2 = pbc.ppm ["X", "Y"](-) %q0, %q1 : i1, !quantum.bit, !quantum.bit
         return %mres, %out#0, %out#1 : i1, !quantum.bit, !quantum.bit
@@ -104,19 +102,40 @@ module @test_ppm_negative_basis {
 
 // CHECK-LABEL: @test_select_ppm
 module @test_select_ppm {
-    // CHECK: llvm.func @__catalyst__qis__PauliMeasure(!llvm.ptr, i1, !llvm.ptr, i1, i1, i64, ...) -> !llvm.ptr
-    // CHECK: llvm.mlir.global internal constant @pauli_word_XY("XY\00")
+    // CHECK: llvm.func @__catalyst__qis__PackedPauliMeasure(!llvm.ptr {llvm.nocapture, llvm.readonly}, i1, !llvm.ptr {llvm.nocapture, llvm.readonly}, i1, i1, i64, ...) -> !llvm.ptr
+    // CHECK: llvm.mlir.global internal constant @pauli_masks_XY(dense<[3, 2]> : tensor<2xi64>)
     func.func @select_ppm(%q0 : !quantum.bit, %q1 : !quantum.bit, %sel : i1) -> (i1, !quantum.bit, !quantum.bit) {
         // CHECK-DAG: [[cfalse:%.+]] = llvm.mlir.constant(false) : i1
         // CHECK-DAG: [[ctrue:%.+]] = llvm.mlir.constant(true) : i1
-        // CHECK-DAG: llvm.mlir.addressof @pauli_word_XY : !llvm.ptr
-        // CHECK-DAG: [[pauliPtr0:%.+]] = llvm.getelementptr inbounds {{.*}}[0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.array<3 x i8>
-        // CHECK-DAG: llvm.mlir.addressof @pauli_word_XZ : !llvm.ptr
-        // CHECK-DAG: [[pauliPtr1:%.+]] = llvm.getelementptr inbounds {{.*}}[0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.array<3 x i8>
+        // CHECK-DAG: [[pauliPtr0:%.+]] = llvm.mlir.addressof @pauli_masks_XY : !llvm.ptr
+        // CHECK-DAG: [[pauliPtr1:%.+]] = llvm.mlir.addressof @pauli_masks_XZ : !llvm.ptr
         // CHECK-DAG: [[numQubits:%.+]] = llvm.mlir.constant(2 : i64) : i64
-        // CHECK: [[resultPtr:%.+]] = llvm.call @__catalyst__qis__PauliMeasure([[pauliPtr0]], [[cfalse]], [[pauliPtr1]], [[ctrue]], %arg2, [[numQubits]], %arg0, %arg1)
+        // CHECK: [[resultPtr:%.+]] = llvm.call @__catalyst__qis__PackedPauliMeasure([[pauliPtr0]], [[cfalse]], [[pauliPtr1]], [[ctrue]], %arg2, [[numQubits]], %arg0, %arg1)
         // CHECK: [[mres:%.+]] = llvm.load [[resultPtr]] : !llvm.ptr -> i1
         %mres, %out:2 = pbc.select.ppm (%sel ? ["X", "Y"] : ["X", "Z"](-)) %q0, %q1 : i1, !quantum.bit, !quantum.bit
         return %mres, %out#0, %out#1 : i1, !quantum.bit, !quantum.bit
     }
 }
+
+// -----
+
+// Measurement outcomes feed forward into later operations as runtime predicates, without branching
+// CHECK-LABEL: @test_feed_forward
+module @test_feed_forward {
+    func.func @feed_forward(%q0 : !quantum.bit, %q1 : !quantum.bit) -> (i1, !quantum.bit, !quantum.bit) {
+        // CHECK-NOT: llvm.cond_br
+        // CHECK-NOT: scf.if
+        // CHECK: [[m0Ptr:%.+]] = llvm.call @__catalyst__qis__PackedPauliMeasure(
+        // CHECK: [[m0:%.+]] = llvm.load [[m0Ptr]] : !llvm.ptr -> i1
+        // CHECK: llvm.call @__catalyst__qis__PackedPauliRot_array({{%.+}}, {{%.+}}, {{%.+}}, [[m0]], {{%.+}}, {{%.+}})
+        // CHECK: [[m1Ptr:%.+]] = llvm.call @__catalyst__qis__PackedPauliMeasure({{%.+}}, {{%.+}}, {{%.+}}, {{%.+}}, [[m0]], {{%.+}}, {{%.+}})
+        // CHECK: [[m1:%.+]] = llvm.load [[m1Ptr]] : !llvm.ptr -> i1
+        // CHECK: llvm.call @__catalyst__qis__PackedPauliRot_array({{%.+}}, {{%.+}}, {{%.+}}, [[m1]], {{%.+}}, {{%.+}})
+        // CHECK-NOT: llvm.cond_br
+        %m0, %qs:2 = pbc.ppm ["Z", "Z"] %q0, %q1 : i1, !quantum.bit, !quantum.bit
+        %r0:2 = pbc.ppr ["X", "X"](2) %qs#0, %qs#1 cond(%m0) : !quantum.bit, !quantum.bit
+        %m1, %r1:2 = pbc.select.ppm (%m0 ? ["X", "Y"] : ["Y", "X"]) %r0#0, %r0#1 : i1, !quantum.bit, !quantum.bit
+        %out:2 = pbc.ppr ["Z", "X"](4) %r1#0, %r1#1 cond(%m1) : !quantum.bit, !quantum.bit
+        return %m1, %out#0, %out#1 : i1, !quantum.bit, !quantum.bit
+    }
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 // RUN: quantum-opt --decompose-arbitrary-ppr --split-input-file -verify-diagnostics %s | FileCheck %s
+// RUN: quantum-opt --decompose-arbitrary-ppr="batch=true" --split-input-file -verify-diagnostics %s | FileCheck %s
 
 func.func @test_arb_ppr_to_arb_z_0(%q1 : !quantum.bit, %q2 : !quantum.bit){
 
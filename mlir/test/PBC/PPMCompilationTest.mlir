@@ -25,6 +25,11 @@
 // RUN: test -s %t.ppr.params
 // RUN: diff %t.ppm.params %t.ppr.params
 
+// The single-sweep driver leaves no gates and no Clifford or non-Clifford PPRs behind
+// RUN: quantum-opt --ppm-compilation="single-sweep=true" --split-input-file -verify-diagnostics %s | FileCheck %s --check-prefix=SWEEP
+// SWEEP-NOT: quantum.custom
+// SWEEP-NOT: pbc.ppr {{.*}}({{-?[48]}})
+
 func.func @test_clifford_t_to_ppm_1() -> (tensor<i1>, tensor<i1>) {
     %0 = quantum.alloc( 2) : !quantum.reg
     %1 = quantum.extract %0[ 1] : !quantum.reg -> !quantum.bit
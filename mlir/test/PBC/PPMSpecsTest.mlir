@@ -402,6 +402,42 @@ func.func public @static_for_loop_nested(%arg0: !quantum.bit) {
 
 // -----
 
+//CHECK: {
+//CHECK:     "triangular_for_loop": {
+//CHECK:         "max_weight_pi4": 1,
+//CHECK:         "num_of_ppm": 2,
+//CHECK:         "pi4_ppr": 6
+//CHECK:     }
+//CHECK: }
+func.func public @triangular_for_loop(%arg0: !quantum.bit) {
+    %c4 = arith.constant 4 : index
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c2 = arith.constant 2 : index
+
+    // COM: the inner loop runs 0 + 1 + 2 + 3 = 6 times, the PPM runs when i is even
+    %q = scf.for %iter = %c0 to %c4 step %c1 iter_args(%arg1 = %arg0) -> (!quantum.bit) {
+        %q_inner = scf.for %iter_inner = %c0 to %iter step %c1 iter_args(%arg1_inner = %arg1) -> (!quantum.bit) {
+          %out_qubits_inner = pbc.ppr ["Z"](4) %arg1_inner : !quantum.bit
+          scf.yield %out_qubits_inner : !quantum.bit
+        }
+
+        %rem = arith.remsi %iter, %c2 : index
+        %even = arith.cmpi eq, %rem, %c0 : index
+        %out_qubits = scf.if %even -> !quantum.bit {
+          %mres, %out_qubits_1 = pbc.ppm ["Z"] %q_inner : i1, !quantum.bit
+          scf.yield %out_qubits_1 : !quantum.bit
+        } else {
+          scf.yield %q_inner : !quantum.bit
+        }
+        scf.yield %out_qubits : !quantum.bit
+    }
+
+    return
+}
+
+// -----
+
 func.func public @dynamic_for_loop_error(%arg0: !quantum.bit, %c: index) {
     %c0 = arith.constant 0 : index
     %c1 = arith.constant 1 : index
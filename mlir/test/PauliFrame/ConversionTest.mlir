@@ -0,0 +1,109 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s \
+// RUN:   --convert-arith-to-llvm \
+// RUN:   --convert-pauli-frame-to-llvm \
+// RUN:   --convert-quantum-to-llvm \
+// RUN:   --reconcile-unrealized-casts \
+// RUN:   --split-input-file -verify-diagnostics \
+// RUN: | FileCheck %s
+
+// CHECK-DAG: llvm.func @__catalyst__pf__init(!llvm.ptr)
+// CHECK-DAG: llvm.func @__catalyst__pf__init_qreg(!llvm.ptr)
+
+// CHECK-LABEL: test_init
+func.func @test_init(%qreg : !quantum.reg, %q0 : !quantum.bit, %q1 : !quantum.bit) {
+    // CHECK: llvm.call @__catalyst__pf__init_qreg(%arg0)
+    %0 = pauli_frame.init_qreg %qreg : !quantum.reg
+
+    // CHECK: llvm.call @__catalyst__pf__init(%arg1)
+    // CHECK: llvm.call @__catalyst__pf__init(%arg2)
+    %1, %2 = pauli_frame.init %q0, %q1 : !quantum.bit, !quantum.bit
+    func.return
+}
+
+// -----
+
+// CHECK-DAG: llvm.func @__catalyst__pf__update(!llvm.ptr, i1, i1)
+// CHECK-DAG: llvm.func @__catalyst__pf__set(!llvm.ptr, i1, i1)
+
+// CHECK-LABEL: test_update
+func.func @test_update(%q0 : !quantum.bit, %q1 : !quantum.bit) {
+    // CHECK: [[x:%.+]] = llvm.mlir.constant(true) : i1
+    // CHECK: [[z:%.+]] = llvm.mlir.constant(false) : i1
+    // CHECK: llvm.call @__catalyst__pf__update(%arg0, [[x]], [[z]])
+    // CHECK: llvm.call @__catalyst__pf__update(%arg1, [[x]], [[z]])
+    %0, %1 = pauli_frame.update [1, 0] %q0, %q1 : !quantum.bit, !quantum.bit
+
+    // CHECK: [[x:%.+]] = llvm.mlir.constant(false) : i1
+    // CHECK: [[z:%.+]] = llvm.mlir.constant(true) : i1
+    // CHECK: llvm.call @__catalyst__pf__set(%arg0, [[x]], [[z]])
+    %2 = pauli_frame.set [0, 1] %0 : !quantum.bit
+    func.return
+}
+
+// -----
+
+// CHECK-DAG: llvm.func @__catalyst__pf__update_with_clifford(i32, i64, !llvm.ptr, !llvm.ptr)
+
+// CHECK-LABEL: test_update_with_clifford
+func.func @test_update_with_clifford(%q0 : !quantum.bit, %q1 : !quantum.bit) {
+    // CHECK: [[h:%.+]] = llvm.mlir.constant(0 : i32) : i32
+    // CHECK: [[one:%.+]] = llvm.mlir.constant(1 : i64) : i64
+    // CHECK: [[null:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: llvm.call @__catalyst__pf__update_with_clifford([[h]], [[one]], %arg0, [[null]])
+    %0 = pauli_frame.update_with_clifford [Hadamard] %q0 : !quantum.bit
+
+    // CHECK: [[cnot:%.+]] = llvm.mlir.constant(2 : i32) : i32
+    // CHECK: [[two:%.+]] = llvm.mlir.constant(2 : i64) : i64
+    // CHECK: llvm.call @__catalyst__pf__update_with_clifford([[cnot]], [[two]], %arg0, %arg1)
+    %1, %2 = pauli_frame.update_with_clifford [CNOT] %0, %q1 : !quantum.bit, !quantum.bit
+    func.return
+}
+
+// -----
+
+// CHECK-DAG: llvm.func @__catalyst__pf__read(!llvm.ptr) -> i8
+// CHECK-DAG: llvm.func @__catalyst__pf__flush(!llvm.ptr) -> i8
+
+// CHECK-LABEL: test_read_flush
+func.func @test_read_flush(%q0 : !quantum.bit) -> i1 {
+    // CHECK: [[record:%.+]] = llvm.call @__catalyst__pf__read(%arg0) : (!llvm.ptr) -> i8
+    // CHECK: [[one:%.+]] = llvm.mlir.constant(1 : i8) : i8
+    // CHECK: [[x:%.+]] = llvm.trunc [[record]] : i8 to i1
+    // CHECK: [[shift:%.+]] = llvm.lshr [[record]], [[one]] : i8
+    // CHECK: [[z:%.+]] = llvm.trunc [[shift]] : i8 to i1
+    %x0, %z0, %0 = pauli_frame.read %q0 : i1, i1, !quantum.bit
+
+    // CHECK: llvm.call @__catalyst__pf__flush(%arg0) : (!llvm.ptr) -> i8
+    %x1, %z1, %1 = pauli_frame.flush %0 : i1, i1, !quantum.bit
+
+    // CHECK: [[parity:%.+]] = llvm.xor [[x]], [[z]] : i1
+    // CHECK: return [[parity]]
+    %parity = arith.xori %x0, %z0 : i1
+    func.return %parity : i1
+}
+
+// -----
+
+// CHECK-DAG: llvm.func @__catalyst__pf__correct_measurement(i1, !llvm.ptr) -> i1
+
+// CHECK-LABEL: test_correct_measurement
+func.func @test_correct_measurement(%mres : i1, %q0 : !quantum.bit) -> i1 {
+    // CHECK: [[mres:%.+]] = llvm.call @__catalyst__pf__correct_measurement(%arg0, %arg1) : (i1, !llvm.ptr) -> i1
+    // CHECK: return [[mres]]
+    %0, %1 = pauli_frame.correct_measurement %mres, %q0 : i1, !quantum.bit
+    func.return %0 : i1
+}
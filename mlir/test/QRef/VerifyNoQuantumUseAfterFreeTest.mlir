@@ -13,6 +13,8 @@
 // limitations under the License.
 
 // RUN: quantum-opt --split-input-file --verify-diagnostics --verify-no-quantum-use-after-free %s
+// RUN: quantum-opt --split-input-file --verify-diagnostics \
+// RUN:   --pass-pipeline="builtin.module(func.func(verify-no-quantum-use-after-free))" %s
 
 
 func.func @test_use_after_free() {
@@ -0,0 +1,103 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --batch-syndrome-measurements --split-input-file --verify-diagnostics %s | FileCheck %s
+
+// CHECK-LABEL: test_batch_round
+func.func @test_batch_round(%arg0 : !qecp.qubit<aux>, %arg1 : !qecp.qubit<aux>, %arg2 : !qecp.qubit<aux>) -> (tensor<3xi1>, !qecp.qubit<aux>, !qecp.qubit<aux>, !qecp.qubit<aux>) {
+    // CHECK-NOT: qecp.measure %
+    // CHECK: [[esm:%.+]], [[out:%.+]]:3 = qecp.measure_syndrome %arg0, %arg1, %arg2 : tensor<3xi1>, !qecp.qubit<aux>, !qecp.qubit<aux>, !qecp.qubit<aux>
+    // CHECK-NOT: tensor.from_elements
+    // CHECK: return [[esm]], [[out]]#0, [[out]]#1, [[out]]#2
+    %m0, %q0 = qecp.measure %arg0 : i1, !qecp.qubit<aux>
+    %m1, %q1 = qecp.measure %arg1 : i1, !qecp.qubit<aux>
+    %m2, %q2 = qecp.measure %arg2 : i1, !qecp.qubit<aux>
+    %esm = tensor.from_elements %m0, %m1, %m2 : tensor<3xi1>
+    func.return %esm, %q0, %q1, %q2 : tensor<3xi1>, !qecp.qubit<aux>, !qecp.qubit<aux>, !qecp.qubit<aux>
+}
+
+// -----
+
+// The qubits of a round are measured in the order of the syndrome, and the other uses of the
+// individual results are read back from the syndrome
+
+// CHECK-LABEL: test_batch_round_reordered
+func.func @test_batch_round_reordered(%arg0 : !qecp.qubit<aux>, %arg1 : !qecp.qubit<aux>) -> (tensor<2xi1>, i1) {
+    // CHECK-DAG: [[idx:%.+]] = arith.constant 1 : index
+    // CHECK: [[esm:%.+]], [[out:%.+]]:2 = qecp.measure_syndrome %arg1, %arg0
+    // CHECK: [[m0:%.+]] = tensor.extract [[esm]]{{\[}}[[idx]]] : tensor<2xi1>
+    // CHECK: qecp.dealloc_aux [[out]]#0
+    // CHECK: qecp.dealloc_aux [[out]]#1
+    // CHECK: return [[esm]], [[m0]]
+    %m0, %q0 = qecp.measure %arg0 : i1, !qecp.qubit<aux>
+    %m1, %q1 = qecp.measure %arg1 : i1, !qecp.qubit<aux>
+    %esm = tensor.from_elements %m1, %m0 : tensor<2xi1>
+    qecp.dealloc_aux %q1 : !qecp.qubit<aux>
+    qecp.dealloc_aux %q0 : !qecp.qubit<aux>
+    func.return %esm, %m0 : tensor<2xi1>, i1
+}
+
+// -----
+
+// Repeated rounds are batched in the body of the loop that repeats them
+
+// CHECK-LABEL: test_batch_repeated_rounds
+func.func @test_batch_repeated_rounds(%arg0 : !qecp.tanner_graph<8, 6, i32>, %arg1 : !qecp.qubit<aux>, %arg2 : !qecp.qubit<aux>) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c10 = arith.constant 10 : index
+    // CHECK: scf.for
+    // CHECK: [[esm:%.+]], [[out:%.+]]:2 = qecp.measure_syndrome
+    // CHECK-NOT: qecp.measure %
+    // CHECK: qecp.decode_esm_css({{%.+}} : !qecp.tanner_graph<8, 6, i32>) [[esm]]
+    // CHECK: scf.yield [[out]]#0, [[out]]#1
+    %q:2 = scf.for %i = %c0 to %c10 step %c1 iter_args(%a0 = %arg1, %a1 = %arg2) -> (!qecp.qubit<aux>, !qecp.qubit<aux>) {
+        %m0, %q0 = qecp.measure %a0 : i1, !qecp.qubit<aux>
+        %m1, %q1 = qecp.measure %a1 : i1, !qecp.qubit<aux>
+        %esm = tensor.from_elements %m0, %m1 : tensor<2xi1>
+        %err = qecp.decode_esm_css(%arg0 : !qecp.tanner_graph<8, 6, i32>) %esm : tensor<2xi1> -> tensor<1xindex>
+        scf.yield %q0, %q1 : !qecp.qubit<aux>, !qecp.qubit<aux>
+    }
+    func.return
+}
+
+// -----
+
+// A round whose qubit is used before its last measurement is not batched
+
+// CHECK-LABEL: test_no_batch_interleaved_use
+func.func @test_no_batch_interleaved_use(%arg0 : !qecp.qubit<aux>, %arg1 : !qecp.qubit<aux>) -> tensor<2xi1> {
+    // CHECK-NOT: qecp.measure_syndrome
+    // CHECK: tensor.from_elements
+    %m0, %q0 = qecp.measure %arg0 : i1, !qecp.qubit<aux>
+    %q2 = qecp.hadamard %q0 : !qecp.qubit<aux>
+    %m1, %q1 = qecp.measure %arg1 : i1, !qecp.qubit<aux>
+    %esm = tensor.from_elements %m0, %m1 : tensor<2xi1>
+    qecp.dealloc_aux %q1 : !qecp.qubit<aux>
+    qecp.dealloc_aux %q2 : !qecp.qubit<aux>
+    func.return %esm : tensor<2xi1>
+}
+
+// -----
+
+// The same measurement twice in a syndrome is not batched
+
+// CHECK-LABEL: test_no_batch_repeated_result
+func.func @test_no_batch_repeated_result(%arg0 : !qecp.qubit<aux>) -> tensor<2xi1> {
+    // CHECK-NOT: qecp.measure_syndrome
+    %m0, %q0 = qecp.measure %arg0 : i1, !qecp.qubit<aux>
+    %esm = tensor.from_elements %m0, %m0 : tensor<2xi1>
+    qecp.dealloc_aux %q0 : !qecp.qubit<aux>
+    func.return %esm : tensor<2xi1>
+}
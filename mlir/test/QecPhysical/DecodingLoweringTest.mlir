@@ -0,0 +1,60 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --lower-qec-decoding --split-input-file --verify-diagnostics %s | FileCheck %s
+
+// CHECK-DAG: llvm.func @__catalyst__qecp__decoder_create(!llvm.ptr {llvm.nocapture, llvm.readonly}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i64, i64) -> i64
+// CHECK-DAG: llvm.func @__catalyst__qecp__decode_esm(i64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i64, !llvm.ptr {llvm.nocapture}, i64)
+
+// CHECK-LABEL: test_decode_esm_css_tensor
+func.func @test_decode_esm_css_tensor(%row_idx : tensor<8xi32>, %col_ptr : tensor<6xi32>, %esm : tensor<2xi1>) -> tensor<1xindex> {
+    // CHECK-DAG: [[rows:%.+]] = bufferization.to_buffer %arg0 : tensor<8xi32> to memref<8xi32>
+    // CHECK-DAG: [[cols:%.+]] = bufferization.to_buffer %arg1 : tensor<6xi32> to memref<6xi32>
+    // CHECK-DAG: [[rowsIdx:%.+]] = memref.extract_aligned_pointer_as_index [[rows]]
+    // CHECK-DAG: [[colsIdx:%.+]] = memref.extract_aligned_pointer_as_index [[cols]]
+    // CHECK-DAG: [[numRows:%.+]] = llvm.mlir.constant(8 : i64) : i64
+    // CHECK-DAG: [[numCols:%.+]] = llvm.mlir.constant(6 : i64) : i64
+    // CHECK-DAG: [[bitWidth:%.+]] = llvm.mlir.constant(32 : i64) : i64
+    // CHECK: [[decoder:%.+]] = llvm.call @__catalyst__qecp__decoder_create({{%.+}}, [[numRows]], {{%.+}}, [[numCols]], [[bitWidth]]) : (!llvm.ptr, i64, !llvm.ptr, i64, i64) -> i64
+    %graph = qecp.assemble_tanner %row_idx, %col_ptr : tensor<8xi32>, tensor<6xi32> -> !qecp.tanner_graph<8, 6, i32>
+
+    // CHECK: [[esm:%.+]] = bufferization.to_buffer %arg2 : tensor<2xi1> to memref<2xi1>
+    // CHECK: [[errIdx:%.+]] = memref.alloc() : memref<1xi64>
+    // CHECK-DAG: [[numChecks:%.+]] = llvm.mlir.constant(2 : i64) : i64
+    // CHECK-DAG: [[numErrIdx:%.+]] = llvm.mlir.constant(1 : i64) : i64
+    // CHECK: llvm.call @__catalyst__qecp__decode_esm([[decoder]], {{%.+}}, [[numChecks]], {{%.+}}, [[numErrIdx]])
+    // CHECK: [[tensor:%.+]] = bufferization.to_tensor [[errIdx]] restrict : memref<1xi64> to tensor<1xi64>
+    // CHECK: [[result:%.+]] = arith.index_cast [[tensor]] : tensor<1xi64> to tensor<1xindex>
+    // CHECK-NOT: qecp.
+    // CHECK: return [[result]]
+    %err_idx = qecp.decode_esm_css(%graph : !qecp.tanner_graph<8, 6, i32>) %esm : tensor<2xi1> -> tensor<1xindex>
+    func.return %err_idx : tensor<1xindex>
+}
+
+// -----
+
+// CHECK-LABEL: test_decode_esm_css_memref
+func.func @test_decode_esm_css_memref(%row_idx : memref<8xi64>, %col_ptr : memref<6xi64>, %esm : memref<2xi1>) -> tensor<1xindex> {
+    // CHECK-NOT: bufferization.to_buffer
+    // CHECK-DAG: memref.extract_aligned_pointer_as_index %arg0
+    // CHECK-DAG: memref.extract_aligned_pointer_as_index %arg1
+    // CHECK-DAG: [[bitWidth:%.+]] = llvm.mlir.constant(64 : i64) : i64
+    // CHECK: [[decoder:%.+]] = llvm.call @__catalyst__qecp__decoder_create({{.*}}, [[bitWidth]])
+    %graph = qecp.assemble_tanner %row_idx, %col_ptr : memref<8xi64>, memref<6xi64> -> !qecp.tanner_graph<8, 6, i64>
+
+    // CHECK: memref.extract_aligned_pointer_as_index %arg2
+    // CHECK: llvm.call @__catalyst__qecp__decode_esm([[decoder]],
+    %err_idx = qecp.decode_esm_css(%graph : !qecp.tanner_graph<8, 6, i64>) %esm : memref<2xi1> -> tensor<1xindex>
+    func.return %err_idx : tensor<1xindex>
+}
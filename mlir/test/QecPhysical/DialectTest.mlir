@@ -217,6 +217,13 @@ func.func @test_measure(%arg0 : !qecp.qubit<data>, %arg1 : !qecp.qubit<aux>) {
 
 // -----
 
+func.func @test_measure_syndrome(%arg0 : !qecp.qubit<aux>, %arg1 : !qecp.qubit<aux>) {
+    %esm, %0, %1 = qecp.measure_syndrome %arg0, %arg1 : tensor<2xi1>, !qecp.qubit<aux>, !qecp.qubit<aux>
+    func.return
+}
+
+// -----
+
 func.func @test_assemble_tanner_graph_memref(%arg0 : memref<8xi32>, %arg1 : memref<6xi32>) {
     %0 = qecp.assemble_tanner %arg0, %arg1 : memref<8xi32>, memref<6xi32> -> !qecp.tanner_graph<8, 6, i32>
     func.return
@@ -227,3 +227,11 @@ func.func @test_assemble_tanner_mismatch_shapes(%arg0 : tensor<8xi32>, %arg1 : t
     %0 = qecp.assemble_tanner %arg0, %arg1 : tensor<8xi32>, tensor<6xi32> -> !qecp.tanner_graph<1, 2, i32>
     func.return
 }
+
+// -----
+
+func.func @test_measure_syndrome_mismatch_size(%arg0 : !qecp.qubit<aux>, %arg1 : !qecp.qubit<aux>) {
+    // expected-error@below {{expected the syndrome to have one bit per measured qubit, but got 3 bits for 2 qubits}}
+    %esm, %0, %1 = qecp.measure_syndrome %arg0, %arg1 : tensor<3xi1>, !qecp.qubit<aux>, !qecp.qubit<aux>
+    func.return
+}
@@ -412,3 +412,31 @@ func.func private @adjoint_index_switch(%idx: index) -> !quantum.reg {
 
   return %1 : !quantum.reg
 }
+
+// -----
+
+// The adjoint of a function called several times is outlined once
+
+func.func private @shared_callee(%arg0: f64, %arg1: !quantum.reg) -> !quantum.reg {
+    %1 = quantum.extract %arg1[ 0] : !quantum.reg -> !quantum.bit
+    %2 = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+    %3 = quantum.insert %arg1[ 0], %2 : !quantum.reg, !quantum.bit
+    func.return %3 : !quantum.reg
+}
+
+// CHECK:       func.func private @shared_callee.adjoint(%arg0: f64, %arg1: !quantum.reg) -> !quantum.reg
+// CHECK-NOT:   func.func private @shared_callee.adjoint
+
+// CHECK-LABEL: func.func @shared_adjoint
+func.func @shared_adjoint(%arg0: f64, %arg1: f64, %arg2: !quantum.reg) -> !quantum.reg {
+  // CHECK-NOT: quantum.adjoint
+  // CHECK:     call @shared_callee.adjoint(%arg1, {{%.+}}) : (f64, !quantum.reg) -> !quantum.reg
+  // CHECK:     call @shared_callee.adjoint(%arg0, {{%.+}}) : (f64, !quantum.reg) -> !quantum.reg
+  %0 = quantum.adjoint(%arg2) : !quantum.reg {
+  ^bb0(%arg3: !quantum.reg):
+    %1 = func.call @shared_callee(%arg0, %arg3) : (f64, !quantum.reg) -> !quantum.reg
+    %2 = func.call @shared_callee(%arg1, %1) : (f64, !quantum.reg) -> !quantum.reg
+    quantum.yield %2 : !quantum.reg
+  }
+  return %0 : !quantum.reg
+}
@@ -42,3 +42,38 @@ func.func @returning_allocation() -> !quantum.reg {
     // CHECK-NEXT: return [[reg]]
     return %0 : !quantum.reg
 }
+
+// -----
+
+// CHECK-LABEL: @straight_line_deallocation
+func.func @straight_line_deallocation(%arg0: f64, %arg1: index) -> f64 {
+    // CHECK: [[buf:%.+]] = memref.alloc() : memref<4xf64>
+    %0 = memref.alloc() : memref<4xf64>
+    // CHECK: [[view:%.+]] = memref.subview [[buf]]
+    %1 = memref.subview %0[0] [2] [1] : memref<4xf64> to memref<2xf64, strided<[1]>>
+    // CHECK: memref.store %arg0, [[view]]
+    memref.store %arg0, %1[%arg1] : memref<2xf64, strided<[1]>>
+    // CHECK: [[res:%.+]] = memref.load [[buf]]
+    %2 = memref.load %0[%arg1] : memref<4xf64>
+    // CHECK-NEXT: memref.dealloc [[buf]]
+    // CHECK-NEXT: return [[res]]
+    return %2 : f64
+}
+
+// -----
+
+// CHECK-LABEL: @structured_loop_deallocation
+func.func @structured_loop_deallocation(%arg0: f64, %arg1: index) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    // CHECK: [[buf:%.+]] = memref.alloc() : memref<4xf64>
+    %0 = memref.alloc() : memref<4xf64>
+    // CHECK: scf.for
+    scf.for %i = %c0 to %arg1 step %c1 {
+        // CHECK-NOT: memref.dealloc
+        memref.store %arg0, %0[%i] : memref<4xf64>
+    }
+    // CHECK: memref.dealloc [[buf]]
+    // CHECK-NEXT: return
+    return
+}
@@ -0,0 +1,122 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(batch-qnode-loops)" --split-input-file --verify-diagnostics | FileCheck %s
+
+// The device of a qnode called in a loop is initialized once around the loop
+
+module @vmap {
+  func.func private @circuit(%arg0: f64) -> f64 attributes {qnode} {
+    %shots = arith.constant 100 : i64
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "RX"(%arg0) %q_0 : !quantum.bit
+    %obs = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func public @main(%arg0: memref<4xf64>, %arg1: memref<4xf64>) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c4 = arith.constant 4 : index
+    scf.for %i = %c0 to %c4 step %c1 {
+      %x = memref.load %arg0[%i] : memref<4xf64>
+      %y = func.call @circuit(%x) : (f64) -> f64
+      memref.store %y, %arg1[%i] : memref<4xf64>
+    }
+    return
+  }
+}
+
+// CHECK-DAG: func.func private @__catalyst__rt__device_start_batch(i64)
+// CHECK-DAG: func.func private @__catalyst__rt__device_end_batch()
+
+// CHECK-LABEL: func.func private @circuit(
+// CHECK:         quantum.device
+// CHECK:         quantum.device_release
+
+// CHECK-LABEL: func.func private @circuit.batched(
+// CHECK-NOT:     attributes {qnode}
+// CHECK-NOT:     quantum.device
+// CHECK:         quantum.alloc
+// CHECK:         quantum.dealloc
+// CHECK-NOT:     quantum.device_release
+// CHECK:         return
+
+// CHECK-LABEL: func.func public @main
+// CHECK:         [[shots:%.+]] = arith.constant 100 : i64
+// CHECK:         quantum.device shots([[shots]]) ["librtd_lightning.so", "LightningSimulator", "{}"]
+// CHECK:         [[size:%.+]] = arith.index_cast {{%.+}} : index to i64
+// CHECK:         call @__catalyst__rt__device_start_batch([[size]]) : (i64) -> ()
+// CHECK:         scf.for
+// CHECK:           func.call @circuit.batched(
+// CHECK:         }
+// CHECK:         call @__catalyst__rt__device_end_batch() : () -> ()
+// CHECK:         quantum.device_release
+// CHECK:         return
+
+// -----
+
+// Loops whose shots change with the iterations, or that call other devices, are not changed
+
+module @unchanged {
+  func.func private @circuit_shots(%shots: i64) -> f64 attributes {qnode} {
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q_0[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    quantum.dealloc %r : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func private @circuit_other() -> f64 attributes {qnode} {
+    quantum.device ["librtd_null_qubit.so", "NullQubit", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q_0[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    quantum.dealloc %r : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func public @main(%arg0: memref<4xf64>) {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c4 = arith.constant 4 : index
+    %c100 = arith.constant 100 : i64
+    scf.for %i = %c0 to %c4 step %c1 {
+      %shots = arith.index_cast %i : index to i64
+      %y = func.call @circuit_shots(%shots) : (i64) -> f64
+      memref.store %y, %arg0[%i] : memref<4xf64>
+    }
+    scf.for %i = %c0 to %c4 step %c1 {
+      %y = func.call @circuit_shots(%c100) : (i64) -> f64
+      %z = func.call @circuit_other() : () -> f64
+      memref.store %y, %arg0[%i] : memref<4xf64>
+    }
+    return
+  }
+}
+
+// CHECK-LABEL: module @unchanged
+// CHECK-NOT:     __catalyst__rt__device_start_batch
+// CHECK-NOT:     .batched
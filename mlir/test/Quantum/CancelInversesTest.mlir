@@ -705,3 +705,23 @@ func.func @test_loop_boundary_rotation(%q0: !quantum.bit, %q1: !quantum.bit) ->
     // CHECK: return [[scf]]#0, [[qubit_6]]
     func.return %scf#0, %scf#1 : !quantum.bit, !quantum.bit
 }
+
+// -----
+
+// test long nested chain of inverses on one wire
+// CHECK-LABEL: test_cancel_inverses_long_chain
+func.func @test_cancel_inverses_long_chain(%arg0: !quantum.bit) -> !quantum.bit {
+    // CHECK-NOT: quantum.custom
+    // CHECK: return %arg0
+    %0 = quantum.custom "Hadamard"() %arg0 : !quantum.bit
+    %1 = quantum.custom "PauliX"() %0 : !quantum.bit
+    %2 = quantum.custom "PauliY"() %1 : !quantum.bit
+    %3 = quantum.custom "PauliZ"() %2 : !quantum.bit
+    %4 = quantum.custom "PauliZ"() %3 : !quantum.bit
+    %5 = quantum.custom "PauliY"() %4 : !quantum.bit
+    %6 = quantum.custom "PauliX"() %5 : !quantum.bit
+    %7 = quantum.custom "Hadamard"() %6 : !quantum.bit
+    %8 = quantum.custom "Hadamard"() %7 : !quantum.bit
+    %9 = quantum.custom "Hadamard"() %8 : !quantum.bit
+    return %9 : !quantum.bit
+}
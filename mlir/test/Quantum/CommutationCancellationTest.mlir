@@ -0,0 +1,96 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --pass-pipeline="builtin.module(commutation-cancellation)" --split-input-file -verify-diagnostics %s | FileCheck %s
+
+// CNOTs cancel through a Z rotation on the control
+// CHECK-LABEL: test_cancel_through_control
+func.func @test_cancel_through_control(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    %cst = arith.constant 1.230000e+00 : f64
+    // CHECK: [[rz:%.+]] = quantum.custom "RZ"({{%.+}}) %arg0 : !quantum.bit
+    // CHECK-NOT: quantum.custom
+    // CHECK: return [[rz]], %arg1
+    %0:2 = quantum.custom "CNOT"() %q0, %q1 : !quantum.bit, !quantum.bit
+    %1 = quantum.custom "RZ"(%cst) %0#0 : !quantum.bit
+    %2:2 = quantum.custom "CNOT"() %1, %0#1 : !quantum.bit, !quantum.bit
+    return %2#0, %2#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CNOTs cancel through X gates on the target and a CZ sharing the control
+// CHECK-LABEL: test_cancel_through_target
+func.func @test_cancel_through_target(%q0: !quantum.bit, %q1: !quantum.bit, %q2: !quantum.bit) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
+    // CHECK: [[x:%.+]] = quantum.custom "PauliX"() %arg1 : !quantum.bit
+    // CHECK: [[cz:%.+]]:2 = quantum.custom "CZ"() %arg0, %arg2 : !quantum.bit, !quantum.bit
+    // CHECK-NOT: quantum.custom
+    // CHECK: return [[cz]]#0, [[x]], [[cz]]#1
+    %0:2 = quantum.custom "CNOT"() %q0, %q1 : !quantum.bit, !quantum.bit
+    %1 = quantum.custom "PauliX"() %0#1 : !quantum.bit
+    %2:2 = quantum.custom "CZ"() %0#0, %q2 : !quantum.bit, !quantum.bit
+    %3:2 = quantum.custom "CNOT"() %2#0, %1 : !quantum.bit, !quantum.bit
+    return %3#0, %3#1, %2#1 : !quantum.bit, !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Z rotations merge through the control of a CNOT
+// CHECK-LABEL: test_merge_through_control
+func.func @test_merge_through_control(%q0: !quantum.bit, %q1: !quantum.bit, %a: f64, %b: f64) -> (!quantum.bit, !quantum.bit) {
+    // CHECK: [[cnot:%.+]]:2 = quantum.custom "CNOT"() %arg0, %arg1 : !quantum.bit, !quantum.bit
+    // CHECK: [[sum:%.+]] = arith.addf %arg2, %arg3 : f64
+    // CHECK: [[rz:%.+]] = quantum.custom "RZ"([[sum]]) [[cnot]]#0 : !quantum.bit
+    // CHECK-NOT: quantum.custom
+    // CHECK: return [[rz]], [[cnot]]#1
+    %0 = quantum.custom "RZ"(%a) %q0 : !quantum.bit
+    %1:2 = quantum.custom "CNOT"() %0, %q1 : !quantum.bit, !quantum.bit
+    %2 = quantum.custom "RZ"(%b) %1#0 : !quantum.bit
+    return %2, %1#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// T and its adjoint cancel through a controlled phase shift
+// CHECK-LABEL: test_cancel_adjoint
+func.func @test_cancel_adjoint(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    %cst = arith.constant 1.230000e+00 : f64
+    // CHECK: [[cp:%.+]]:2 = quantum.custom "ControlledPhaseShift"({{%.+}}) %arg0, %arg1 : !quantum.bit, !quantum.bit
+    // CHECK-NOT: quantum.custom
+    // CHECK: return [[cp]]#0, [[cp]]#1
+    %0 = quantum.custom "T"() %q1 : !quantum.bit
+    %1:2 = quantum.custom "ControlledPhaseShift"(%cst) %q0, %0 : !quantum.bit, !quantum.bit
+    %2 = quantum.custom "T"() %1#1 adj : !quantum.bit
+    return %1#0, %2 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Gates acting in different bases do not commute
+// CHECK-LABEL: test_no_commutation
+func.func @test_no_commutation(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    %cst = arith.constant 1.230000e+00 : f64
+    // CHECK: quantum.custom "CNOT"
+    // CHECK: quantum.custom "RX"
+    // CHECK: quantum.custom "CNOT"
+    // CHECK: quantum.custom "Hadamard"
+    // CHECK: quantum.custom "CZ"
+    // CHECK: quantum.custom "Hadamard"
+    %0:2 = quantum.custom "CNOT"() %q0, %q1 : !quantum.bit, !quantum.bit
+    %1 = quantum.custom "RX"(%cst) %0#0 : !quantum.bit
+    %2:2 = quantum.custom "CNOT"() %1, %0#1 : !quantum.bit, !quantum.bit
+    %3 = quantum.custom "Hadamard"() %2#0 : !quantum.bit
+    %4:2 = quantum.custom "CZ"() %3, %2#1 : !quantum.bit, !quantum.bit
+    %5 = quantum.custom "Hadamard"() %4#0 : !quantum.bit
+    return %5, %4#1 : !quantum.bit, !quantum.bit
+}
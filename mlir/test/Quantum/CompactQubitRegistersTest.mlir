@@ -0,0 +1,73 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --compact-qubit-registers --split-input-file --verify-diagnostics | FileCheck %s
+
+// Registers only accessed at static indices are shrunk to the accessed wires
+
+// CHECK-LABEL: func.func @compact
+func.func @compact() -> tensor<4xcomplex<f64>> {
+    // CHECK: [[reg:%.+]] = quantum.alloc( 2) : !quantum.reg
+    // CHECK: quantum.extract [[reg]][ 0]
+    // CHECK: quantum.extract [[reg]][ 1]
+    // CHECK: [[reg1:%.+]] = quantum.insert [[reg]][ 0]
+    // CHECK: quantum.insert [[reg1]][ 1]
+    %r = quantum.alloc( 10) : !quantum.reg
+    %q2 = quantum.extract %r[ 2] : !quantum.reg -> !quantum.bit
+    %q7 = quantum.extract %r[ 7] : !quantum.reg -> !quantum.bit
+    %0:2 = quantum.custom "CNOT"() %q2, %q7 : !quantum.bit, !quantum.bit
+    %obs = quantum.compbasis qubits %0#0, %0#1 : !quantum.obs
+    %state = quantum.state %obs : tensor<4xcomplex<f64>>
+    %r_1 = quantum.insert %r[ 2], %0#0 : !quantum.reg, !quantum.bit
+    %r_2 = quantum.insert %r_1[ 7], %0#1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_2 : !quantum.reg
+    return %state : tensor<4xcomplex<f64>>
+}
+
+// -----
+
+// Registers whose size is observable are kept
+
+// CHECK-LABEL: func.func @whole_register
+func.func @whole_register() -> tensor<1024xf64> {
+    // CHECK: quantum.alloc( 10)
+    // CHECK: quantum.extract {{%.+}}[ 2]
+    %r = quantum.alloc( 10) : !quantum.reg
+    %q2 = quantum.extract %r[ 2] : !quantum.reg -> !quantum.bit
+    %0 = quantum.custom "Hadamard"() %q2 : !quantum.bit
+    %r_1 = quantum.insert %r[ 2], %0 : !quantum.reg, !quantum.bit
+    %obs = quantum.compbasis qreg %r_1 : !quantum.obs
+    %probs = quantum.probs %obs : tensor<1024xf64>
+    quantum.dealloc %r_1 : !quantum.reg
+    return %probs : tensor<1024xf64>
+}
+
+// CHECK-LABEL: func.func @dynamic_index
+func.func @dynamic_index(%arg0: i64) {
+    // CHECK: quantum.alloc( 10)
+    %r = quantum.alloc( 10) : !quantum.reg
+    %q = quantum.extract %r[%arg0] : !quantum.reg -> !quantum.bit
+    %r_1 = quantum.insert %r[%arg0], %q : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    return
+}
+
+// CHECK-LABEL: func.func @num_qubits
+func.func @num_qubits() -> i64 {
+    // CHECK: quantum.alloc( 10)
+    %r = quantum.alloc( 10) : !quantum.reg
+    %n = quantum.num_qubits : i64
+    quantum.dealloc %r : !quantum.reg
+    return %n : i64
+}
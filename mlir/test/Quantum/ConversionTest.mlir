@@ -18,7 +18,7 @@
 // Runtime Management //
 ////////////////////////
 
-// CHECK: llvm.func @__catalyst__rt__initialize(!llvm.ptr)
+// CHECK: llvm.func @__catalyst__rt__initialize(!llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @init
 func.func @init() {
@@ -44,7 +44,7 @@ func.func @finalize() {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__rt__device_init(!llvm.ptr, !llvm.ptr, !llvm.ptr, i64, i1)
+// CHECK: llvm.func @__catalyst__rt__device_init(!llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture, llvm.readonly}, i64, i1)
 
 // CHECK-LABEL: @device
 func.func @device() {
@@ -143,6 +143,7 @@ func.func @alloc_qb() {
 // -----
 
 // CHECK: llvm.func @__catalyst__rt__qubit_release_array(!llvm.ptr)
+// CHECK-SAME: attributes {passthrough = ["enzyme_inactive"]}
 
 // CHECK-LABEL: @dealloc
 func.func @dealloc(%r : !quantum.reg) {
@@ -205,7 +206,7 @@ func.func @insert(%r : !quantum.reg, %q : !quantum.bit) -> !quantum.reg {
 
 // CHECK-LABEL: @custom_gate
 module @custom_gate {
-  // CHECK: llvm.func @__catalyst__qis__Identity(!llvm.ptr, i64, ...)
+  // CHECK: llvm.func @__catalyst__qis__Identity(!llvm.ptr {llvm.nocapture, llvm.readonly}, i64, ...)
   // CHECK-LABEL: @test
   func.func @test(%q0: !quantum.bit, %p: f64) -> () {
     // CHECK: [[nullptr:%.+]] = llvm.mlir.zero
@@ -220,7 +221,7 @@ module @custom_gate {
 
 // CHECK-LABEL: @custom_gate
 module @custom_gate {
-  // CHECK: llvm.func @__catalyst__qis__Identity(!llvm.ptr, i64, ...)
+  // CHECK: llvm.func @__catalyst__qis__Identity(!llvm.ptr {llvm.nocapture, llvm.readonly}, i64, ...)
   // CHECK-LABEL: @test
   func.func @test(%q0: !quantum.bit, %q1: !quantum.bit, %p: f64) -> () {
     // CHECK: [[nullptr:%.+]] = llvm.mlir.zero
@@ -235,7 +236,8 @@ module @custom_gate {
 
 // CHECK-LABEL: @custom_gate
 module @custom_gate {
-  // CHECK: llvm.func @__catalyst__qis__RX(f64, !llvm.ptr, !llvm.ptr)
+  // CHECK: llvm.func @__catalyst__qis__RX(f64, !llvm.ptr, !llvm.ptr {llvm.nocapture, llvm.readonly})
+  // CHECK-SAME: attributes {passthrough = ["enzyme_inactive", "nofree"]}
   // CHECK-LABEL: @test
   func.func @test(%q0: !quantum.bit, %p: f64) -> () {
     // CHECK: [[nullptr:%.+]] = llvm.mlir.zero
@@ -249,7 +251,7 @@ module @custom_gate {
 
 // CHECK-LABEL: @custom_gate
 module @custom_gate {
-  // CHECK: llvm.func @__catalyst__qis__SWAP(!llvm.ptr, !llvm.ptr, !llvm.ptr)
+  // CHECK: llvm.func @__catalyst__qis__SWAP(!llvm.ptr, !llvm.ptr, !llvm.ptr {llvm.nocapture, llvm.readonly})
   // CHECK-LABEL: @test
   func.func @test(%q0: !quantum.bit, %p: f64) -> () {
     // CHECK: [[nullptr:%.+]] = llvm.mlir.zero
@@ -263,7 +265,7 @@ module @custom_gate {
 
 // CHECK-LABEL: @custom_gate
 module @custom_gate {
-  // CHECK-DAG: llvm.func @__catalyst__qis__CRot(f64, f64, f64, !llvm.ptr, !llvm.ptr, !llvm.ptr)
+  // CHECK-DAG: llvm.func @__catalyst__qis__CRot(f64, f64, f64, !llvm.ptr, !llvm.ptr, !llvm.ptr {llvm.nocapture, llvm.readonly})
   // CHECK-LABEL: @test
   func.func @test(%q0: !quantum.bit, %p: f64) -> () {
     // CHECK: [[nullptr:%.+]] = llvm.mlir.zero
@@ -278,48 +280,50 @@ module @custom_gate {
 
 // CHECK-LABEL: @custom_gate
 module @custom_gate {
-  // CHECK: llvm.func @__catalyst__qis__RX(f64, !llvm.ptr, !llvm.ptr)
+  // CHECK-DAG: llvm.func @__catalyst__qis__RX(f64, !llvm.ptr, !llvm.ptr {llvm.nocapture, llvm.readonly})
+  // CHECK-DAG: llvm.mlir.global internal constant @adjoint_modifiers() {{.*}} : !llvm.struct<(i1, i64, ptr, ptr)>
+  // CHECK-DAG: llvm.insertvalue {{%.+}}, {{%.+}}[0] : !llvm.struct<(i1, i64, ptr, ptr)>
   // CHECK-LABEL: @test
   func.func @test(%q0: !quantum.bit, %p: f64) -> () {
-    // CHECK: [[nullptr:%.+]] = llvm.mlir.zero
-    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: [[alloca:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(i1, i64, ptr, ptr)>
-    // CHECK: [[true:%.+]] = llvm.mlir.constant(true)
-    // CHECK: [[off0:%.+]] = llvm.getelementptr inbounds [[alloca]][0, 0]
-    // CHECK: [[off1:%.+]] = llvm.getelementptr inbounds [[alloca]][0, 1]
-    // CHECK: [[off2:%.+]] = llvm.getelementptr inbounds [[alloca]][0, 2]
-    // CHECK: [[off3:%.+]] = llvm.getelementptr inbounds [[alloca]][0, 3]
-    // CHECK: llvm.store [[true]], [[off0]]
-    // CHECK: [[c0:%.+]] = llvm.mlir.constant(0 : i64)
-    // CHECK: llvm.store [[c0]], [[off1]]
-    // CHECK: llvm.store [[nullptr]], [[off2]]
-    // CHECK: llvm.store [[nullptr]], [[off3]]
-    // CHECK: llvm.call @__catalyst__qis__RX(%arg1, %arg0, [[alloca]])
+    // CHECK-NOT: llvm.alloca
+    // CHECK: [[modifiers:%.+]] = llvm.mlir.addressof @adjoint_modifiers
+    // CHECK-NOT: llvm.store
+    // CHECK: llvm.call @__catalyst__qis__RX(%arg1, %arg0, [[modifiers]])
     %q1 = quantum.custom "RX"(%p) %q0 { adjoint } : !quantum.bit
+
+    // CHECK: [[modifiers:%.+]] = llvm.mlir.addressof @adjoint_modifiers
+    // CHECK: llvm.call @__catalyst__qis__RX(%arg1, %arg0, [[modifiers]])
+    %q2 = quantum.custom "RX"(%p) %q1 { adjoint } : !quantum.bit
     return
   }
 }
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__MultiRZ(f64, !llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__MultiRZ_array(f64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @multirz
 func.func @multirz(%q0 : !quantum.bit, %p : f64) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
 
     // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs:%.+]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__MultiRZ(%arg1, [[p]], [[c1]], %arg0)
+    // CHECK: llvm.call @__catalyst__qis__MultiRZ_array(%arg1, [[p]], [[c1]], [[qs]])
     %q1 = quantum.multirz(%p) %q0 : !quantum.bit
 
     // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs:%.+]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
-    // CHECK: llvm.call @__catalyst__qis__MultiRZ(%arg1, [[p]], [[c2]], %arg0, %arg0)
+    // CHECK: llvm.call @__catalyst__qis__MultiRZ_array(%arg1, [[p]], [[c2]], [[qs]])
     %q2:2 = quantum.multirz(%p) %q1, %q1 : !quantum.bit, !quantum.bit
 
     // CHECK: [[p:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs:%.+]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c3:%.+]] = llvm.mlir.constant(3 : i64)
-    // CHECK: llvm.call @__catalyst__qis__MultiRZ(%arg1, [[p]], [[c3]], %arg0, %arg0, %arg0)
+    // CHECK: llvm.call @__catalyst__qis__MultiRZ_array(%arg1, [[p]], [[c3]], [[qs]])
     %q3:3 = quantum.multirz(%p) %q2#0, %q2#1, %q2#1 : !quantum.bit, !quantum.bit, !quantum.bit
 
     // CHECK: [[st1:%.+]] = llvm.insertvalue %arg0
@@ -331,31 +335,33 @@ func.func @multirz(%q0 : !quantum.bit, %p : f64) -> (!quantum.bit, !quantum.bit,
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__PauliRot(!llvm.ptr, f64, !llvm.ptr, i1, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__PackedPauliRot_array(!llvm.ptr {llvm.nocapture, llvm.readonly}, f64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i1, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @paulirot
 func.func @paulirot(%q0 : !quantum.bit, %angle : f64) -> (!quantum.bit) {
     // CHECK-DAG: [[ctrue:%.+]] = llvm.mlir.constant(true) : i1
-    // CHECK-DAG: llvm.mlir.addressof @pauli_word_X : !llvm.ptr
-    // CHECK-DAG: [[pauliPtr:%.+]] = llvm.getelementptr inbounds {{.*}}[0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.array<2 x i8>
-    // CHECK-DAG: [[numQubits:%.+]] = llvm.mlir.constant(1 : i64) : i64
-    // CHECK: llvm.call @__catalyst__qis__PauliRot([[pauliPtr]], {{%.+}}, {{%.+}}, [[ctrue]], [[numQubits]], %arg0)
+    // CHECK-DAG: [[pauliPtr:%.+]] = llvm.mlir.addressof @pauli_masks_X : !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs:%.+]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
+    // CHECK: [[numQubits:%.+]] = llvm.mlir.constant(1 : i64) : i64
+    // CHECK: llvm.call @__catalyst__qis__PackedPauliRot_array([[pauliPtr]], {{%.+}}, {{%.+}}, [[ctrue]], [[numQubits]], [[qs]])
     %out = quantum.paulirot ["X"](%angle) %q0 : !quantum.bit
     return %out : !quantum.bit
 }
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__PauliRot(!llvm.ptr, f64, !llvm.ptr, i1, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__PackedPauliRot_array(!llvm.ptr {llvm.nocapture, llvm.readonly}, f64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i1, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @controlled_paulirot
 func.func @controlled_paulirot(%q0 : !quantum.bit, %q1 : !quantum.bit, %angle : f64) -> (!quantum.bit) {
     // CHECK: [[alloca:%.+]] = llvm.alloca {{%.+}} x !llvm.struct<(i1, i64, ptr, ptr)> : (i64) -> !llvm.ptr
-    // CHECK: llvm.mlir.addressof @pauli_word_X : !llvm.ptr
-    // CHECK: [[pauliPtr:%.+]] = llvm.getelementptr inbounds {{.*}}[0, 0] : (!llvm.ptr) -> !llvm.ptr, !llvm.array<2 x i8>
+    // CHECK: [[pauliPtr:%.+]] = llvm.mlir.addressof @pauli_masks_X : !llvm.ptr
     // CHECK: [[ctrue:%.+]] = llvm.mlir.constant(true) : i1
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs:%.+]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[numQubits:%.+]] = llvm.mlir.constant(1 : i64) : i64
-    // CHECK: llvm.call @__catalyst__qis__PauliRot([[pauliPtr]], {{%.+}}, [[alloca]], [[ctrue]], [[numQubits]], %arg0)
+    // CHECK: llvm.call @__catalyst__qis__PackedPauliRot_array([[pauliPtr]], {{%.+}}, [[alloca]], [[ctrue]], [[numQubits]], [[qs]])
     %true = llvm.mlir.constant (1 : i1) :i1
     %out_qubits, %out_ctrl_qubits  = quantum.paulirot ["X"](%angle) %q0 ctrls (%q1) ctrlvals (%true) : !quantum.bit ctrls !quantum.bit
     return %out_qubits : !quantum.bit
@@ -363,24 +369,30 @@ func.func @controlled_paulirot(%q0 : !quantum.bit, %q1 : !quantum.bit, %angle :
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__PCPhase(f64, f64, !llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__PCPhase_array(f64, f64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @pcphase
 func.func @pcphase(%q0 : !quantum.bit, %p : f64, %d: f64) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
 
     // CHECK: [[d:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs:%.+]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__PCPhase(%arg1, %arg2, [[d]], [[c1]], %arg0)
+    // CHECK: llvm.call @__catalyst__qis__PCPhase_array(%arg1, %arg2, [[d]], [[c1]], [[qs]])
     %q1 = quantum.pcphase(%p, %d) %q0 : !quantum.bit
 
     // CHECK: [[d:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs:%.+]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
-    // CHECK: llvm.call @__catalyst__qis__PCPhase(%arg1, %arg2, [[d]], [[c2]], %arg0, %arg0)
+    // CHECK: llvm.call @__catalyst__qis__PCPhase_array(%arg1, %arg2, [[d]], [[c2]], [[qs]])
     %q2:2 = quantum.pcphase(%p, %d) %q1, %q1 : !quantum.bit, !quantum.bit
 
     // CHECK: [[d:%.+]] = llvm.mlir.zero : !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs:%.+]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c3:%.+]] = llvm.mlir.constant(3 : i64)
-    // CHECK: llvm.call @__catalyst__qis__PCPhase(%arg1, %arg2, [[d]], [[c3]], %arg0, %arg0, %arg0)
+    // CHECK: llvm.call @__catalyst__qis__PCPhase_array(%arg1, %arg2, [[d]], [[c3]], [[qs]])
     %q3:3 = quantum.pcphase(%p, %d) %q2#0, %q2#1, %q2#1 : !quantum.bit, !quantum.bit, !quantum.bit
 
     // CHECK: [[st1:%.+]] = llvm.insertvalue %arg0
@@ -392,7 +404,7 @@ func.func @pcphase(%q0 : !quantum.bit, %p : f64, %d: f64) -> (!quantum.bit, !qua
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__QubitUnitary(!llvm.ptr, !llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__QubitUnitary_array(!llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture, llvm.readonly}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @qubit_unitary
 func.func @qubit_unitary(%q0 : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>,  %p2 : memref<4x4xcomplex<f64>>) -> (!quantum.bit, !quantum.bit) {
@@ -408,8 +420,8 @@ func.func @qubit_unitary(%q0 : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>,  %p
 
     %q2:2 = quantum.unitary(%p2 : memref<4x4xcomplex<f64>>) %q1, %q1 : !quantum.bit, !quantum.bit
 
-    // CHECK: llvm.call @__catalyst__qis__QubitUnitary(
-    // CHECK: llvm.call @__catalyst__qis__QubitUnitary(
+    // CHECK: llvm.call @__catalyst__qis__QubitUnitary_array(
+    // CHECK: llvm.call @__catalyst__qis__QubitUnitary_array(
 
     return %q2#0, %q2#1 : !quantum.bit, !quantum.bit
 }
@@ -453,7 +465,7 @@ func.func @namedobs(%q : !quantum.bit) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__HermitianObs(!llvm.ptr, i64, ...) -> i64
+// CHECK: llvm.func @__catalyst__qis__HermitianObs(!llvm.ptr {llvm.nocapture, llvm.readonly}, i64, ...) -> i64
 
 // CHECK-LABEL: @hermitian
 func.func @hermitian(%q : !quantum.bit, %p1 : memref<2x2xcomplex<f64>>, %p2 : memref<4x4xcomplex<f64>>) {
@@ -492,7 +504,7 @@ func.func @tensor(%obs : !quantum.obs) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__HamiltonianObs(!llvm.ptr, i64, ...) -> i64
+// CHECK: llvm.func @__catalyst__qis__HamiltonianObs(!llvm.ptr {llvm.nocapture, llvm.readonly}, i64, ...) -> i64
 // CHECK-LABEL: @hamiltonian
 func.func @hamiltonian(%obs : !quantum.obs, %p1 : memref<1xf64>, %p2 : memref<3xf64>) {
     // CHECK: [[memrefvar:%.+]] = llvm.mlir.poison
@@ -512,7 +524,7 @@ func.func @hamiltonian(%obs : !quantum.obs, %p1 : memref<1xf64>, %p2 : memref<3x
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__HamiltonianObs(!llvm.ptr, i64, ...) -> i64
+// CHECK: llvm.func @__catalyst__qis__HamiltonianObs(!llvm.ptr {llvm.nocapture, llvm.readonly}, i64, ...) -> i64
 
 // CHECK-LABEL: @hamiltonian
 func.func @hamiltonian(%obs : !quantum.obs, %p1 : memref<1xf64>, %p2 : memref<3xf64>) {
@@ -537,14 +549,14 @@ func.func @hamiltonian(%obs : !quantum.obs, %p1 : memref<1xf64>, %p2 : memref<3x
 // Measurements //
 //////////////////
 
-// CHECK: llvm.func @__catalyst__qis__Measure(!llvm.ptr, i32) -> !llvm.ptr
+// CHECK: llvm.func @__catalyst__qis__MeasureBit(!llvm.ptr, i32) -> i1
 
 // CHECK-LABEL: @measure
 func.func @measure(%q : !quantum.bit) -> !quantum.bit {
 
     // CHECK: [[postselect:%.+]] = llvm.mlir.constant(-1 : i32) : i32
 
-    // CHECK: llvm.call @__catalyst__qis__Measure(%arg0, [[postselect]])
+    // CHECK: llvm.call @__catalyst__qis__MeasureBit(%arg0, [[postselect]])
     %res, %new_q = quantum.measure %q : i1, !quantum.bit
 
     // CHECK: return %arg0
@@ -553,14 +565,14 @@ func.func @measure(%q : !quantum.bit) -> !quantum.bit {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__Measure(!llvm.ptr, i32) -> !llvm.ptr
+// CHECK: llvm.func @__catalyst__qis__MeasureBit(!llvm.ptr, i32) -> i1
 
 // CHECK-LABEL: @measure
 func.func @measure(%q : !quantum.bit) -> !quantum.bit {
 
     // CHECK: [[postselect:%.+]] = llvm.mlir.constant(0 : i32) : i32
 
-    // CHECK: llvm.call @__catalyst__qis__Measure(%arg0, [[postselect]])
+    // CHECK: llvm.call @__catalyst__qis__MeasureBit(%arg0, [[postselect]])
     %res, %new_q = quantum.measure %q postselect 0 : i1, !quantum.bit
 
     // CHECK: return %arg0
@@ -569,7 +581,7 @@ func.func @measure(%q : !quantum.bit) -> !quantum.bit {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__Sample(!llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__Sample_array(!llvm.ptr {llvm.nocapture}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @sample
 func.func @sample(%q : !quantum.bit, %dyn_shots: i64) {
@@ -580,8 +592,11 @@ func.func @sample(%q : !quantum.bit, %dyn_shots: i64) {
     %dyn_alloc1 = memref.alloc(%idx1) : memref<?x1xf64>
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Sample([[ptr]], [[c1]], %arg0)
+    // CHECK: llvm.call @__catalyst__qis__Sample_array([[ptr]], [[c1]], [[qs]])
     quantum.sample %o1 in(%dyn_alloc1 : memref<?x1xf64>)
 
     return
@@ -593,8 +608,13 @@ func.func @sample(%q : !quantum.bit, %dyn_shots: i64) {
 func.func @sample(%q : !quantum.bit, %dyn_shots: i64) {
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
+    // CHECK: [[e1:%.+]] = llvm.getelementptr inbounds [[qs]][1] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e1]]
     // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Sample([[ptr]], [[c2]], %arg0, %arg0)
+    // CHECK: llvm.call @__catalyst__qis__Sample_array([[ptr]], [[c2]], [[qs]])
     %o2 = quantum.compbasis qubits %q, %q : !quantum.obs
     %idx2 = index.casts %dyn_shots : i64 to index
     %dyn_alloc2 = memref.alloc(%idx2) : memref<?x2xf64>
@@ -604,7 +624,7 @@ func.func @sample(%q : !quantum.bit, %dyn_shots: i64) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__Counts(!llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__Counts_array(!llvm.ptr {llvm.nocapture}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @counts
 func.func @counts(%q : !quantum.bit) {
@@ -612,8 +632,11 @@ func.func @counts(%q : !quantum.bit) {
     %o1 = quantum.compbasis qubits %q : !quantum.obs
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>, struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Counts([[ptr]], [[c1]], %arg0)
+    // CHECK: llvm.call @__catalyst__qis__Counts_array([[ptr]], [[c1]], [[qs]])
     %in_eigvals1 = memref.alloc() : memref<2xf64>
     %in_counts1 = memref.alloc() : memref<2xi64>
     quantum.counts %o1 in(%in_eigvals1 : memref<2xf64>, %in_counts1 : memref<2xi64>)
@@ -629,8 +652,13 @@ func.func @counts(%q : !quantum.bit) {
     %o2 = quantum.compbasis qubits %q, %q : !quantum.obs
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>, struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
+    // CHECK: [[e1:%.+]] = llvm.getelementptr inbounds [[qs]][1] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e1]]
     // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Counts([[ptr]], [[c2]], %arg0, %arg0)
+    // CHECK: llvm.call @__catalyst__qis__Counts_array([[ptr]], [[c2]], [[qs]])
     %in_eigvals2 = memref.alloc() : memref<4xf64>
     %in_counts2 = memref.alloc() : memref<4xi64>
     quantum.counts %o2 in(%in_eigvals2 : memref<4xf64>, %in_counts2 : memref<4xi64>)
@@ -665,7 +693,50 @@ func.func @var(%obs : !quantum.obs) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__Probs(!llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__ExpvalVar(!llvm.ptr {llvm.nocapture}, i64)
+
+// CHECK-LABEL: @expval_var
+func.func @expval_var(%obs : !quantum.obs) -> (f64, f64) {
+
+    // CHECK: [[ptr:%.+]] = llvm.alloca {{%.+}} x f64
+    // CHECK: llvm.call @__catalyst__qis__ExpvalVar([[ptr]], %arg0)
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[ptr]][0] : (!llvm.ptr) -> !llvm.ptr, f64
+    // CHECK: [[expval:%.+]] = llvm.load [[e0]] : !llvm.ptr -> f64
+    // CHECK: [[e1:%.+]] = llvm.getelementptr inbounds [[ptr]][1] : (!llvm.ptr) -> !llvm.ptr, f64
+    // CHECK: [[var:%.+]] = llvm.load [[e1]] : !llvm.ptr -> f64
+    // CHECK-NOT: __catalyst__qis__Expval(
+    // CHECK-NOT: __catalyst__qis__Variance(
+    // CHECK: return [[expval]], [[var]]
+    %var = quantum.var %obs : f64
+    %expval = quantum.expval %obs : f64
+
+    return %expval, %var : f64, f64
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__qis__Expvals(!llvm.ptr {llvm.nocapture}, i64, ...)
+
+// CHECK-LABEL: @expvals
+func.func @expvals(%obs0 : !quantum.obs, %obs1 : !quantum.obs, %obs2 : !quantum.obs) -> (f64, f64, f64) {
+
+    // CHECK: [[ptr:%.+]] = llvm.alloca {{%.+}} x f64
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: llvm.call @__catalyst__qis__Expvals([[ptr]], [[c2]], %arg0, %arg1)
+    // The variance of another observable is measured on its own, and ends the joint statistics
+    // CHECK: llvm.call @__catalyst__qis__Variance(%arg2)
+    // CHECK: llvm.call @__catalyst__qis__Expval(%arg0)
+    %expval0 = quantum.expval %obs0 : f64
+    %expval1 = quantum.expval %obs1 : f64
+    %var2 = quantum.var %obs2 : f64
+    %expval2 = quantum.expval %obs0 : f64
+
+    return %expval0, %expval1, %var2 : f64, f64, f64
+}
+
+// -----
+
+// CHECK: llvm.func @__catalyst__qis__Probs_array(!llvm.ptr {llvm.nocapture}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @probs
 func.func @probs(%q : !quantum.bit) {
@@ -674,8 +745,11 @@ func.func @probs(%q : !quantum.bit) {
 
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Probs([[ptr]], [[c1]], %arg0)
+    // CHECK: llvm.call @__catalyst__qis__Probs_array([[ptr]], [[c1]], [[qs]])
     %alloc1 = memref.alloc() : memref<2xf64>
     quantum.probs %o1 in(%alloc1 : memref<2xf64>)
 
@@ -688,8 +762,17 @@ func.func @probs(%q : !quantum.bit) {
     %o2 = quantum.compbasis qubits %q, %q, %q, %q : !quantum.obs
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
+    // CHECK: [[qs:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK: [[e0:%.+]] = llvm.getelementptr inbounds [[qs]][0] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e0]]
+    // CHECK: [[e1:%.+]] = llvm.getelementptr inbounds [[qs]][1] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e1]]
+    // CHECK: [[e2:%.+]] = llvm.getelementptr inbounds [[qs]][2] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e2]]
+    // CHECK: [[e3:%.+]] = llvm.getelementptr inbounds [[qs]][3] : (!llvm.ptr) -> !llvm.ptr, !llvm.ptr
+    // CHECK: llvm.store %arg0, [[e3]]
     // CHECK: [[c4:%.+]] = llvm.mlir.constant(4 : i64)
-    // CHECK: llvm.call @__catalyst__qis__Probs([[ptr]], [[c4]], %arg0, %arg0, %arg0, %arg0)
+    // CHECK: llvm.call @__catalyst__qis__Probs_array([[ptr]], [[c4]], [[qs]])
     %alloc2 = memref.alloc() : memref<16xf64>
     quantum.probs %o2 in(%alloc2 : memref<16xf64>)
     return
@@ -697,7 +780,7 @@ func.func @probs(%q : !quantum.bit) {
 
 // -----
 
-// CHECK: llvm.func @__catalyst__qis__State(!llvm.ptr, i64, ...)
+// CHECK: llvm.func @__catalyst__qis__State_array(!llvm.ptr {llvm.nocapture}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
 
 // CHECK-LABEL: @state
 func.func @state(%q : !quantum.bit) {
@@ -706,7 +789,7 @@ func.func @state(%q : !quantum.bit) {
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: [[c0:%.+]] = llvm.mlir.constant(0 : i64)
-    // CHECK: llvm.call @__catalyst__qis__State([[ptr]], [[c0]])
+    // CHECK: llvm.call @__catalyst__qis__State_array([[ptr]], [[c0]], {{%.+}})
     %alloc1 = memref.alloc() : memref<2xcomplex<f64>>
     quantum.state %o1 in(%alloc1 : memref<2xcomplex<f64>>)
 
@@ -721,7 +804,7 @@ func.func @state(%q : !quantum.bit) {
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[ptr:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<1 x i64>, array<1 x i64>)>
     // CHECK: [[c0:%.+]] = llvm.mlir.constant(0 : i64)
-    // CHECK: llvm.call @__catalyst__qis__State([[ptr]], [[c0]])
+    // CHECK: llvm.call @__catalyst__qis__State_array([[ptr]], [[c0]], {{%.+}})
     %alloc2 = memref.alloc() : memref<16xcomplex<f64>>
     quantum.state %o2 in(%alloc2: memref<16xcomplex<f64>>)
     return
@@ -729,6 +812,7 @@ func.func @state(%q : !quantum.bit) {
 
 // -----
 
+// CHECK: llvm.mlir.global internal constant @controlled_values_1("\01")
 // CHECK-LABEL: @controlled_circuit
 func.func @controlled_circuit(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantum.bit) {
 
@@ -738,8 +822,7 @@ func.func @controlled_circuit(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantu
     %cst_1 = llvm.mlir.constant (3.000000e-01 : f64) : f64
 
     // CHECK: [[true:%.+]] = llvm.mlir.constant(true)
-    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: [[alloca0:%.+]] = llvm.alloca [[c1]] x i1
+    // CHECK-NOT: llvm.alloca {{.*}} x i1
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[alloca1:%.+]] = llvm.alloca [[c1]] x !llvm.ptr
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
@@ -756,14 +839,15 @@ func.func @controlled_circuit(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantu
     // CHECK: [[offset1:%.+]] = llvm.getelementptr inbounds [[mod]][0, 1]
     // CHECK: [[offset2:%.+]] = llvm.getelementptr inbounds [[mod]][0, 2]
     // CHECK: [[offset3:%.+]] = llvm.getelementptr inbounds [[mod]][0, 3]
+    // CHECK: [[values:%.+]] = llvm.mlir.addressof @controlled_values_1
+    // CHECK: [[valuesPtr:%.+]] = llvm.getelementptr inbounds [[values]][0, 0]
     // CHECK: [[offset:%.+]] = llvm.getelementptr inbounds [[alloca1]][0]
 
     // CHECK: llvm.store %arg2, [[offset]]
 
-    // CHECK: [[ptr_to_bool:%.+]] = llvm.getelementptr inbounds [[alloca0]][0]
-    // CHECK: llvm.store [[true]], [[ptr_to_bool]]
-    // CHECK: llvm.store {{.*}}, [[offset2]]
-    // CHECK: llvm.store {{.*}}, [[offset3]]
+    // CHECK-NOT: llvm.store [[true]]
+    // CHECK: llvm.store [[alloca1]], [[offset2]]
+    // CHECK: llvm.store [[valuesPtr]], [[offset3]]
     // CHECK: llvm.call @__catalyst__qis__Rot
     // CHECK-SAME: [[mod]]
     %out_qubits, %out_ctrl_qubits = quantum.custom "Rot"(%cst, %cst_1, %cst_0) %2 ctrls (%3) ctrlvals (%true) : !quantum.bit ctrls !quantum.bit
@@ -778,8 +862,7 @@ func.func @controlled_circuit(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantu
     %true = llvm.mlir.constant (1 : i1) :i1
 
     // CHECK: [[cst6:%.+]] = llvm.mlir.constant(6.0
-    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: [[alloca0:%.+]] = llvm.alloca [[c1]] x i1
+    // CHECK-NOT: llvm.alloca {{.*}} x i1
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[alloca1:%.+]] = llvm.alloca [[c1]] x !llvm.ptr
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
@@ -790,13 +873,14 @@ func.func @controlled_circuit(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantu
     // CHECK: [[offset1:%.+]] = llvm.getelementptr inbounds [[mod]][0, 1]
     // CHECK: [[offset2:%.+]] = llvm.getelementptr inbounds [[mod]][0, 2]
     // CHECK: [[offset3:%.+]] = llvm.getelementptr inbounds [[mod]][0, 3]
+    // CHECK: [[values:%.+]] = llvm.mlir.addressof @controlled_values_1
+    // CHECK: [[valuesPtr:%.+]] = llvm.getelementptr inbounds [[values]][0, 0]
     // CHECK: [[offset:%.+]] = llvm.getelementptr inbounds [[alloca1]][0]
 
     // CHECK: llvm.store %arg2, [[offset]]
-    // CHECK: [[ptr_to_bool:%.+]] = llvm.getelementptr inbounds [[alloca0]][0]
-    // CHECK: llvm.store [[true]], [[ptr_to_bool]]
-    // CHECK: llvm.store {{.*}}, [[offset2]]
-    // CHECK: llvm.store {{.*}}, [[offset3]]
+    // CHECK-NOT: llvm.store [[true]]
+    // CHECK: llvm.store [[alloca1]], [[offset2]]
+    // CHECK: llvm.store [[valuesPtr]], [[offset3]]
     // CHECK: llvm.call @__catalyst__qis__MultiRZ
     // CHECK-SAME: [[mod]]
 
@@ -815,7 +899,9 @@ func.func @controlled_circuit(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantu
     // CHECK: [[alloca0:%.+]] = llvm.alloca [[c1]] x !llvm.struct<(ptr, ptr, i64, array<2 x i64>, array<2 x i64>)>
 
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
-    // CHECK: [[alloca1:%.+]] = llvm.alloca [[c1]] x i1
+    // CHECK: [[qs:%.+]] = llvm.alloca [[c1]] x !llvm.ptr
+
+    // CHECK-NOT: llvm.alloca {{.*}} x i1
 
     // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
     // CHECK: [[alloca2:%.+]] = llvm.alloca [[c1]] x !llvm.ptr
@@ -831,8 +917,9 @@ func.func @controlled_circuit(%1 : !quantum.bit, %2 : !quantum.bit, %3 : !quantu
     // CHECK: llvm.store {{.*}}, [[offset2]]
     // CHECK: llvm.store {{.*}}, [[offset3]]
 
-    // CHECK: llvm.call @__catalyst__qis__QubitUnitary
+    // CHECK: llvm.call @__catalyst__qis__QubitUnitary_array
     // CHECK-SAME: [[mod]]
+    // CHECK-SAME: [[qs]]
 
     %out_qubits_4, %out_ctrl_qubits_5 = quantum.unitary(%arg0 : memref<2x2xcomplex<f64>>) %2 ctrls (%3) ctrlvals (%true) : !quantum.bit ctrls !quantum.bit
     return
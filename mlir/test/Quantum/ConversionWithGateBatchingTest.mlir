@@ -0,0 +1,72 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt \
+// RUN:   --pass-pipeline="builtin.module(convert-quantum-to-llvm{batch-gates=true})" \
+// RUN:   --split-input-file %s | FileCheck %s
+
+// CHECK-LABEL: @batch_gates
+module @batch_gates {
+  // CHECK: llvm.func @__catalyst__qis__ApplyBatch(i64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly}, i64, !llvm.ptr {llvm.nocapture, llvm.readonly})
+  // CHECK-LABEL: @test
+  func.func @test(%q0: !quantum.bit, %q1: !quantum.bit, %p: f64) -> () {
+    // CHECK-DAG: [[headers:%.+]] = llvm.alloca {{%.+}} x i64
+    // CHECK-DAG: [[params:%.+]] = llvm.alloca {{%.+}} x f64
+    // CHECK-DAG: [[wires:%.+]] = llvm.alloca {{%.+}} x !llvm.ptr
+    // CHECK-NOT: llvm.call @__catalyst__qis__Hadamard
+    // CHECK-NOT: llvm.call @__catalyst__qis__RX
+    // CHECK-NOT: llvm.call @__catalyst__qis__CNOT
+    // CHECK: [[c3:%.+]] = llvm.mlir.constant(3 : i64)
+    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: llvm.store %arg2
+    // CHECK: [[c4:%.+]] = llvm.mlir.constant(4 : i64)
+    // CHECK: llvm.call @__catalyst__qis__ApplyBatch([[c3]], [[headers]], [[c1]], [[params]], [[c4]], [[wires]])
+    // CHECK-NOT: llvm.call @__catalyst__qis__
+    %q2 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %q3 = quantum.custom "RX"(%p) %q2 : !quantum.bit
+    %q4:2 = quantum.custom "CNOT"() %q3, %q1 : !quantum.bit, !quantum.bit
+    return
+  }
+}
+
+// -----
+
+// CHECK-LABEL: @no_batch_with_modifiers
+module @no_batch_with_modifiers {
+  // CHECK-NOT: __catalyst__qis__ApplyBatch
+  func.func @test(%q0: !quantum.bit, %p: f64) -> () {
+    %q1 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %q2 = quantum.custom "RX"(%p) %q1 { adjoint } : !quantum.bit
+    %q3 = quantum.custom "Hadamard"() %q2 : !quantum.bit
+    return
+  }
+}
+
+// -----
+
+// CHECK-LABEL: @measurement_splits_batch
+module @measurement_splits_batch {
+  // CHECK-LABEL: @test
+  func.func @test(%q0: !quantum.bit, %q1: !quantum.bit) -> () {
+    // CHECK: llvm.call @__catalyst__qis__ApplyBatch
+    // CHECK: llvm.call @__catalyst__qis__MeasureBit
+    // CHECK: llvm.call @__catalyst__qis__ApplyBatch
+    %q2 = quantum.custom "Hadamard"() %q0 : !quantum.bit
+    %q3 = quantum.custom "PauliX"() %q1 : !quantum.bit
+    %res, %q4 = quantum.measure %q2 : i1, !quantum.bit
+    %q5 = quantum.custom "Hadamard"() %q4 : !quantum.bit
+    %q6:2 = quantum.custom "CNOT"() %q5, %q3 : !quantum.bit, !quantum.bit
+    return
+  }
+}
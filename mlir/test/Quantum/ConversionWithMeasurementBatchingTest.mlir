@@ -0,0 +1,87 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt \
+// RUN:   --pass-pipeline="builtin.module(convert-quantum-to-llvm{batch-measurements=true})" \
+// RUN:   --split-input-file %s | FileCheck %s
+
+// CHECK-LABEL: @batch_measurements
+module @batch_measurements {
+  // CHECK: llvm.func @__catalyst__qis__MeasureBits(i64, !llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture, llvm.readonly}, !llvm.ptr {llvm.nocapture})
+  // CHECK-LABEL: @test
+  func.func @test(%q0: !quantum.bit, %q1: !quantum.bit) -> (i1, i1, i1) {
+    // The first two measurements are independent and measured as a batch
+    // CHECK-DAG: [[bits:%.+]] = llvm.alloca {{%.+}} x i64
+    // CHECK-NOT: llvm.call @__catalyst__qis__MeasureBit(
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: llvm.call @__catalyst__qis__MeasureBits([[c2]], {{%.+}}, {{%.+}}, [[bits]])
+    // CHECK: [[ptr:%.+]] = llvm.getelementptr inbounds [[bits]][0]
+    // CHECK: [[word:%.+]] = llvm.load [[ptr]] : !llvm.ptr -> i64
+    // CHECK: [[m0:%.+]] = llvm.trunc [[word]] : i64 to i1
+    // CHECK: [[c1:%.+]] = llvm.mlir.constant(1 : i64)
+    // CHECK: [[shifted:%.+]] = llvm.lshr [[word]], [[c1]]
+    // CHECK: [[m1:%.+]] = llvm.trunc [[shifted]] : i64 to i1
+    %m0, %q2 = quantum.measure %q0 : i1, !quantum.bit
+    %m1, %q3 = quantum.measure %q1 postselect 1 : i1, !quantum.bit
+
+    // Measuring the first qubit again is not part of the batch
+    // CHECK: [[m2:%.+]] = llvm.call @__catalyst__qis__MeasureBit(%arg0, {{%.+}})
+    // CHECK-NOT: llvm.call @__catalyst__qis__MeasureBits
+    %m2, %q4 = quantum.measure %q2 : i1, !quantum.bit
+
+    // CHECK: llvm.return {{%.+}}
+    return %m0, %m1, %m2 : i1, i1, i1
+  }
+}
+
+// -----
+
+// CHECK-LABEL: @gate_splits_batch
+module @gate_splits_batch {
+  // CHECK-NOT: __catalyst__qis__MeasureBits
+  func.func @test(%q0: !quantum.bit, %q1: !quantum.bit) -> (i1, i1) {
+    // CHECK: llvm.call @__catalyst__qis__MeasureBit(
+    // CHECK: llvm.call @__catalyst__qis__Hadamard
+    // CHECK: llvm.call @__catalyst__qis__MeasureBit(
+    %m0, %q2 = quantum.measure %q0 : i1, !quantum.bit
+    %q3 = quantum.custom "Hadamard"() %q1 : !quantum.bit
+    %m1, %q4 = quantum.measure %q3 : i1, !quantum.bit
+    return %m0, %m1 : i1, i1
+  }
+}
+
+// -----
+
+// CHECK-LABEL: @register_slots
+module @register_slots {
+  // CHECK-LABEL: @test
+  func.func @test(%r0: !quantum.reg) -> (i1, i1, i1) {
+    // The qubits of distinct slots are measured as a batch
+    // CHECK: [[c2:%.+]] = llvm.mlir.constant(2 : i64)
+    // CHECK: llvm.call @__catalyst__qis__MeasureBits([[c2]],
+    %q0 = quantum.extract %r0[0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r0[1] : !quantum.reg -> !quantum.bit
+    %m0, %q2 = quantum.measure %q0 : i1, !quantum.bit
+    %m1, %q3 = quantum.measure %q1 : i1, !quantum.bit
+
+    // The qubit extracted again from the first slot is the first qubit, which is not part of the
+    // batch
+    // CHECK: llvm.call @__catalyst__qis__MeasureBit(
+    // CHECK-NOT: llvm.call @__catalyst__qis__MeasureBits
+    %r1 = quantum.insert %r0[0], %q2 : !quantum.reg, !quantum.bit
+    %q4 = quantum.extract %r1[0] : !quantum.reg -> !quantum.bit
+    %m2, %q5 = quantum.measure %q4 : i1, !quantum.bit
+    return %m0, %m1, %m2 : i1, i1, i1
+  }
+}
@@ -0,0 +1,65 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --decompose-lowering="max-inline-size=3" --split-input-file -verify-diagnostics %s | FileCheck %s
+
+// Decomposition rules larger than the inlining size are called, and kept as a single function
+
+module @outlined_rule {
+  // CHECK-LABEL: func.func public @test_two_rots
+  func.func public @test_two_rots(%arg0: f64) -> !quantum.bit {
+    // CHECK: [[QUBIT:%.+]] = quantum.extract
+    // CHECK: [[QUBIT1:%.+]] = call @Rot_to_RZRYRZ_decomp(%arg0, %arg0, %arg0, [[QUBIT]])
+    // CHECK: [[QUBIT2:%.+]] = call @Rot_to_RZRYRZ_decomp(%arg0, %arg0, %arg0, [[QUBIT1]])
+    // CHECK-NOT: quantum.custom "Rot"
+    %0 = quantum.alloc( 1) : !quantum.reg
+    %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+    %2 = quantum.custom "Rot"(%arg0, %arg0, %arg0) %1 : !quantum.bit
+    %3 = quantum.custom "Rot"(%arg0, %arg0, %arg0) %2 : !quantum.bit
+    return %3 : !quantum.bit
+  }
+
+  // CHECK: func.func private @Rot_to_RZRYRZ_decomp
+  // CHECK-SAME: no_inline
+  func.func public @Rot_to_RZRYRZ_decomp(%arg0: f64, %arg1: f64, %arg2: f64, %arg3: !quantum.bit) -> !quantum.bit attributes {target_gate = "Rot", llvm.linkage = #llvm.linkage<internal>} {
+    %out_qubits = quantum.custom "RZ"(%arg0) %arg3 : !quantum.bit
+    %out_qubits_0 = quantum.custom "RY"(%arg1) %out_qubits : !quantum.bit
+    %out_qubits_1 = quantum.custom "RZ"(%arg2) %out_qubits_0 : !quantum.bit
+    return %out_qubits_1 : !quantum.bit
+  }
+}
+
+// -----
+
+// Decomposition rules within the inlining size are still inlined
+
+module @inlined_rule {
+  // CHECK-LABEL: func.func public @test_hadamard
+  func.func public @test_hadamard() -> !quantum.bit {
+    // CHECK-NOT: call
+    // CHECK: quantum.custom "PauliZ"
+    // CHECK: quantum.custom "PauliX"
+    %0 = quantum.alloc( 1) : !quantum.reg
+    %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+    %2 = quantum.custom "Hadamard"() %1 : !quantum.bit
+    return %2 : !quantum.bit
+  }
+
+  // CHECK-NOT: func.func private @Hadamard_to_RY_decomp
+  func.func private @Hadamard_to_RY_decomp(%arg0: !quantum.bit) -> !quantum.bit attributes {target_gate = "Hadamard", llvm.linkage = #llvm.linkage<internal>} {
+    %out_qubits = quantum.custom "PauliZ"() %arg0 : !quantum.bit
+    %out_qubits_1 = quantum.custom "PauliX"() %out_qubits : !quantum.bit
+    return %out_qubits_1 : !quantum.bit
+  }
+}
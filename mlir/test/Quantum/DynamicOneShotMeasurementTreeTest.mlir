@@ -0,0 +1,45 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --dynamic-one-shot="measurement-tree=true" --split-input-file --verify-diagnostics %s | FileCheck %s
+
+// The loop over shots is surrounded by the runtime calls that enable and disable the measurement
+// tree, so that the shots share the simulation of their common execution prefixes.
+
+func.func public @test_expval(%arg0: f64) -> tensor<f64> attributes {quantum.node} {
+  %1000 = arith.constant 1000 : i64
+  quantum.device shots(%1000) ["", "", ""]
+  %0 = quantum.alloc( 2) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %out_qubits = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+  %mres, %out_qubit = quantum.measure %out_qubits : i1, !quantum.bit
+  %2 = quantum.namedobs %out_qubit[ PauliZ] : !quantum.obs
+  %expval = quantum.expval %2 : f64
+  %from_elements = tensor.from_elements %expval : tensor<f64>
+  %4 = quantum.insert %0[ 0], %out_qubit : !quantum.reg, !quantum.bit
+  quantum.dealloc %4 : !quantum.reg
+  quantum.device_release
+  return %from_elements : tensor<f64>
+}
+
+// CHECK: func.func private @__catalyst__rt__toggle_measurement_tree(i1)
+
+// CHECK: func.func public @test_expval.quantum(%arg0: f64) -> f64 {
+// CHECK:   [[true:%.+]] = arith.constant true
+// CHECK:   call @__catalyst__rt__toggle_measurement_tree([[true]]) : (i1) -> ()
+// CHECK:   scf.for
+// CHECK:     func.call @test_expval.quantum.one_shot_kernel(%arg0) : (f64) -> f64
+// CHECK:   [[false:%.+]] = arith.constant false
+// CHECK:   call @__catalyst__rt__toggle_measurement_tree([[false]]) : (i1) -> ()
+// CHECK:   return
@@ -0,0 +1,158 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --dynamic-one-shot="parallel-shots=true" --split-input-file --verify-diagnostics %s | FileCheck %s
+
+
+func.func public @test_expval(%arg0: f64) -> tensor<f64> attributes {quantum.node} {
+  %1000 = arith.constant 1000 : i64
+  quantum.device shots(%1000) ["", "", ""]
+  %0 = quantum.alloc( 2) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %out_qubit = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+  %2 = quantum.namedobs %out_qubit[ PauliZ] : !quantum.obs
+  %expval = quantum.expval %2 : f64
+  %from_elements = tensor.from_elements %expval : tensor<f64>
+  %4 = quantum.insert %0[ 0], %out_qubit : !quantum.reg, !quantum.bit
+  quantum.dealloc %4 : !quantum.reg
+  quantum.device_release
+  return %from_elements : tensor<f64>
+}
+
+// Each shot pins the device to the random stream of its index
+// CHECK: func.func private @__catalyst__rt__set_prng_stream(i64)
+// CHECK: func.func public @test_expval.quantum.one_shot_kernel(%arg0: f64, [[stream:%[^:]+]]: i64) -> f64
+// CHECK:   quantum.device shots({{%.+}})
+// CHECK-NEXT:   call @__catalyst__rt__set_prng_stream([[stream]]) : (i64) -> ()
+
+// CHECK: func.func public @test_expval.quantum(%arg0: f64) -> f64 {
+// CHECK:   [[shots:%.+]] = arith.constant 1000 : i64
+// CHECK:   [[init:%.+]] = arith.constant 0.000000e+00 : f64
+// CHECK:   [[numShots:%.+]] = index.casts [[shots]] : i64 to index
+// CHECK:   [[empty:%.+]] = tensor.empty([[numShots]]) : tensor<?xf64>
+// CHECK:   [[perShot:%.+]] = scf.forall ([[shot:%.+]]) in ([[numShots]]) shared_outs([[out:%.+]] = [[empty]]) -> (tensor<?xf64>) {
+// CHECK:     [[shotId:%.+]] = index.casts [[shot]] : index to i64
+// CHECK:     [[call:%.+]] = func.call @test_expval.quantum.one_shot_kernel(%arg0, [[shotId]]) : (f64, i64) -> f64
+// CHECK:     [[row:%.+]] = tensor.from_elements [[call]] : tensor<1xf64>
+// CHECK:     scf.forall.in_parallel {
+// CHECK:       tensor.parallel_insert_slice [[row]] into [[out]]{{\[}}[[shot]]] [1] [1] : tensor<1xf64> into tensor<?xf64>
+// CHECK:   [[total:%.+]] = scf.for [[iv:%.+]] = {{%.+}} to {{%.+}} step {{%.+}} iter_args([[sum:%.+]] = [[init]]) -> (f64) {
+// CHECK:     [[value:%.+]] = tensor.extract [[perShot]]{{\[}}[[iv]]] : tensor<?xf64>
+// CHECK:     [[add:%.+]] = arith.addf [[value]], [[sum]] : f64
+// CHECK:     scf.yield [[add]] : f64
+// CHECK:   [[castShots:%.+]] = arith.sitofp [[shots]] : i64 to f64
+// CHECK:   [[div:%.+]] = arith.divf [[total]], [[castShots]] : f64
+// CHECK:   return [[div]] : f64
+
+
+// -----
+
+
+func.func public @test_sample(%arg0: f64) -> tensor<1000x2xi64> attributes {quantum.node} {
+  %1000 = arith.constant 1000 : i64
+  quantum.device shots(%1000) ["", "", ""]
+  %0 = quantum.alloc( 2) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %out_qubits = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+  %mres, %out_qubit = quantum.measure %out_qubits : i1, !quantum.bit
+  %2 = quantum.insert %0[ 0], %out_qubit : !quantum.reg, !quantum.bit
+  %3 = quantum.compbasis qreg %2 : !quantum.obs
+  %4 = quantum.sample %3 : tensor<1000x2xf64>
+  %5 = stablehlo.convert %4 : (tensor<1000x2xf64>) -> tensor<1000x2xi64>
+  quantum.dealloc %2 : !quantum.reg
+  quantum.device_release
+  return %5 : tensor<1000x2xi64>
+}
+
+// CHECK: func.func public @test_sample.quantum(%arg0: f64) -> tensor<1000x2xf64> {
+// CHECK:   [[empty:%.+]] = tensor.empty() : tensor<1000x2xf64>
+// CHECK:   [[fullSamples:%.+]] = scf.forall ([[shot:%.+]]) in ({{%.+}}) shared_outs([[out:%.+]] = [[empty]]) -> (tensor<1000x2xf64>) {
+// CHECK:     [[call:%.+]] = func.call @test_sample.quantum.one_shot_kernel(%arg0, {{%.+}}) : (f64, i64) -> tensor<1x2xf64>
+// CHECK:     scf.forall.in_parallel {
+// CHECK:       tensor.parallel_insert_slice [[call]] into [[out]]{{\[}}[[shot]], 0] [1, 2] [1, 1] : tensor<1x2xf64> into tensor<1000x2xf64>
+// CHECK-NOT: scf.for
+// CHECK:   return [[fullSamples]] : tensor<1000x2xf64>
+
+
+// -----
+
+
+func.func public @test_probs(%arg0: f64) -> tensor<4xf64> attributes {quantum.node} {
+  %1000 = arith.constant 1000 : i64
+  quantum.device shots(%1000) ["", "", ""]
+  %0 = quantum.alloc( 2) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %out_qubits = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+  %mres, %out_qubit = quantum.measure %out_qubits : i1, !quantum.bit
+  %2 = quantum.insert %0[ 0], %out_qubit : !quantum.reg, !quantum.bit
+  %3 = quantum.compbasis qreg %2 : !quantum.obs
+  %4 = quantum.probs %3 : tensor<4xf64>
+  quantum.dealloc %2 : !quantum.reg
+  quantum.device_release
+  return %4 : tensor<4xf64>
+}
+
+// CHECK: func.func public @test_probs.quantum(%arg0: f64) -> tensor<4xf64> {
+// CHECK:   [[init:%.+]] = stablehlo.constant dense<0.000000e+00> : tensor<4xf64>
+// CHECK:   [[empty:%.+]] = tensor.empty({{%.+}}) : tensor<?x4xf64>
+// CHECK:   [[perShot:%.+]] = scf.forall ([[shot:%.+]]) in ({{%.+}}) shared_outs([[out:%.+]] = [[empty]]) -> (tensor<?x4xf64>) {
+// CHECK:     [[call:%.+]] = func.call @test_probs.quantum.one_shot_kernel(%arg0, {{%.+}}) : (f64, i64) -> tensor<4xf64>
+// CHECK:       tensor.parallel_insert_slice [[call]] into [[out]]{{\[}}[[shot]], 0] [1, 4] [1, 1] : tensor<4xf64> into tensor<?x4xf64>
+// CHECK:   [[total:%.+]] = scf.for [[iv:%.+]] = {{%.+}} to {{%.+}} step {{%.+}} iter_args([[sum:%.+]] = [[init]]) -> (tensor<4xf64>) {
+// CHECK:     [[row:%.+]] = tensor.extract_slice [[perShot]]{{\[}}[[iv]], 0] [1, 4] [1, 1] : tensor<?x4xf64> to tensor<4xf64>
+// CHECK:     [[add:%.+]] = stablehlo.add [[row]], [[sum]] : tensor<4xf64>
+// CHECK:     scf.yield [[add]] : tensor<4xf64>
+// CHECK:   stablehlo.divide [[total]], {{%.+}} : tensor<4xf64>
+
+
+// -----
+
+
+func.func public @test_counts(%arg0: f64) -> (tensor<4xi64>, tensor<4xi64>) attributes {quantum.node} {
+  %1000 = arith.constant 1000 : i64
+  quantum.device shots(%1000) ["", "", ""]
+  %0 = quantum.alloc( 2) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %out_qubits = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+  %mres, %out_qubit = quantum.measure %out_qubits : i1, !quantum.bit
+  %2 = quantum.insert %0[ 0], %out_qubit : !quantum.reg, !quantum.bit
+  %3 = quantum.compbasis qreg %2 : !quantum.obs
+  %eigvals, %counts = quantum.counts %3 : tensor<4xf64>, tensor<4xi64>
+  %4 = stablehlo.convert %eigvals : (tensor<4xf64>) -> tensor<4xi64>
+  quantum.dealloc %2 : !quantum.reg
+  quantum.device_release
+  return %4, %counts : tensor<4xi64>, tensor<4xi64>
+}
+
+// Counts keep the sequential loop over shots
+// CHECK: func.func public @test_counts.quantum(%arg0: f64) -> (tensor<4xf64>, tensor<4xi64>)
+// CHECK-NOT: scf.forall
+// CHECK:   scf.for
+
+
+// -----
+
+
+// A qnode without a device has no shots to parallelize
+// expected-error @below {{one-shot execution requires the qnode to initialize its device in its body}}
+func.func public @test_no_device(%arg0: f64) -> tensor<f64> attributes {quantum.node} {
+  %0 = quantum.alloc( 1) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %out_qubits = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+  %2 = quantum.namedobs %out_qubits[ PauliZ] : !quantum.obs
+  %3 = quantum.expval %2 : f64
+  %from_elements = tensor.from_elements %3 : tensor<f64>
+  quantum.dealloc %0 : !quantum.reg
+  return %from_elements : tensor<f64>
+}
@@ -0,0 +1,102 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --dynamic-one-shot="postselect-rejection=true" --split-input-file --verify-diagnostics %s | FileCheck %s
+
+// The shots rejected at a failed postselection are not accumulated, and the results are
+// normalized by the number of accepted shots instead of the number of shots.
+
+func.func public @test_expval(%arg0: f64) -> tensor<f64> attributes {quantum.node} {
+  %1000 = arith.constant 1000 : i64
+  quantum.device shots(%1000) ["", "", ""]
+  %0 = quantum.alloc( 2) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %out_qubits = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+  %mres, %out_qubit = quantum.measure %out_qubits postselect 1 : i1, !quantum.bit
+  %2 = quantum.namedobs %out_qubit[ PauliZ] : !quantum.obs
+  %expval = quantum.expval %2 : f64
+  %from_elements = tensor.from_elements %expval : tensor<f64>
+  %4 = quantum.insert %0[ 0], %out_qubit : !quantum.reg, !quantum.bit
+  quantum.dealloc %4 : !quantum.reg
+  quantum.device_release
+  return %from_elements : tensor<f64>
+}
+
+// CHECK-DAG: func.func private @__catalyst__rt__toggle_shot_rejection(i1)
+// CHECK-DAG: func.func private @__catalyst__rt__shot_accepted() -> i1
+
+// CHECK: func.func public @test_expval.quantum(%arg0: f64) -> f64 {
+// CHECK:   [[true:%.+]] = arith.constant true
+// CHECK:   call @__catalyst__rt__toggle_shot_rejection([[true]]) : (i1) -> ()
+// CHECK:   [[zero:%.+]] = arith.constant 0 : i64
+// CHECK:   [[loop:%.+]]:2 = scf.for {{.+}} iter_args([[sum:%.+]] = {{%.+}}, [[count:%.+]] = [[zero]]) -> (f64, i64) {
+// CHECK:     [[res:%.+]] = func.call @test_expval.quantum.one_shot_kernel(%arg0) : (f64) -> f64
+// CHECK:     [[add:%.+]] = arith.addf [[res]], [[sum]] : f64
+// CHECK:     [[accepted:%.+]] = func.call @__catalyst__rt__shot_accepted() : () -> i1
+// CHECK:     [[select:%.+]] = arith.select [[accepted]], [[add]], [[sum]] : f64
+// CHECK:     [[inc:%.+]] = arith.extui [[accepted]] : i1 to i64
+// CHECK:     [[newCount:%.+]] = arith.addi [[count]], [[inc]] : i64
+// CHECK:     scf.yield [[select]], [[newCount]] : f64, i64
+// CHECK:   [[false:%.+]] = arith.constant false
+// CHECK:   call @__catalyst__rt__toggle_shot_rejection([[false]]) : (i1) -> ()
+// CHECK:   [[accShots:%.+]] = arith.sitofp [[loop]]#1 : i64 to f64
+// CHECK:   [[mean:%.+]] = arith.divf [[loop]]#0, [[accShots]] : f64
+// CHECK:   return [[mean]]
+
+// -----
+
+// Samples keep one row per shot, so their shots are not rejected
+
+func.func public @test_sample() -> tensor<1000x2xi64> attributes {quantum.node} {
+  %1000 = arith.constant 1000 : i64
+  quantum.device shots(%1000) ["", "", ""]
+  %0 = quantum.alloc( 2) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %mres, %out_qubit = quantum.measure %1 postselect 0 : i1, !quantum.bit
+  %2 = quantum.insert %0[ 0], %out_qubit : !quantum.reg, !quantum.bit
+  %3 = quantum.compbasis qreg %2 : !quantum.obs
+  %4 = quantum.sample %3 : tensor<1000x2xf64>
+  %5 = stablehlo.convert %4 : (tensor<1000x2xf64>) -> tensor<1000x2xi64>
+  quantum.dealloc %2 : !quantum.reg
+  quantum.device_release
+  return %5 : tensor<1000x2xi64>
+}
+
+// CHECK-NOT: __catalyst__rt__toggle_shot_rejection
+// CHECK-LABEL: func.func public @test_sample.quantum
+// CHECK-NOT: __catalyst__rt__shot_accepted
+
+// -----
+
+// Circuits without postselection are not rejected
+
+func.func public @test_no_postselect(%arg0: f64) -> tensor<f64> attributes {quantum.node} {
+  %1000 = arith.constant 1000 : i64
+  quantum.device shots(%1000) ["", "", ""]
+  %0 = quantum.alloc( 2) : !quantum.reg
+  %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+  %out_qubits = quantum.custom "RX"(%arg0) %1 : !quantum.bit
+  %mres, %out_qubit = quantum.measure %out_qubits : i1, !quantum.bit
+  %2 = quantum.namedobs %out_qubit[ PauliZ] : !quantum.obs
+  %expval = quantum.expval %2 : f64
+  %from_elements = tensor.from_elements %expval : tensor<f64>
+  %4 = quantum.insert %0[ 0], %out_qubit : !quantum.reg, !quantum.bit
+  quantum.dealloc %4 : !quantum.reg
+  quantum.device_release
+  return %from_elements : tensor<f64>
+}
+
+// CHECK-NOT: __catalyst__rt__toggle_shot_rejection
+// CHECK-LABEL: func.func public @test_no_postselect.quantum
+// CHECK-NOT: __catalyst__rt__shot_accepted
@@ -284,3 +284,88 @@ func.func @test_ppr_arbitrary_ignored(%arg0: !quantum.bit, %theta: f64) -> (!qua
 
     return %q1, %q3#1, %q4 : !quantum.bit, !quantum.bit, !quantum.bit
 }
+
+// -----
+
+// Test that the angles available before the first decomposed op are solved in a single batch
+
+// CHECK-DAG: func.func private @rs_decomposition_solve_batch(memref<?xf64>, f64, i1)
+
+// CHECK-LABEL: @test_batched_angles
+// CHECK-SAME: ([[Q_IN:%.+]]: !quantum.bit, [[THETA:%.+]]: f64, [[PHI:%.+]]: f64)
+func.func @test_batched_angles(%arg0: !quantum.bit, %theta: f64, %phi: f64) -> !quantum.bit {
+
+    // COM: repeated angles are only batched once, and PPR angles are doubled
+    // CHECK-DAG: [[C3:%.+]] = arith.constant 3 : index
+    // CHECK-DAG: [[C2:%.+]] = arith.constant 2.0{{.*}} : f64
+    // CHECK-DAG: [[DOUBLED:%.+]] = arith.mulf [[THETA]], [[C2]]
+    // CHECK: [[ANGLES:%.+]] = memref.alloc([[C3]]) : memref<?xf64>
+    // CHECK: memref.store [[THETA]], [[ANGLES]]
+    // CHECK: memref.store [[PHI]], [[ANGLES]]
+    // CHECK: memref.store [[DOUBLED]], [[ANGLES]]
+    // CHECK: call @rs_decomposition_solve_batch([[ANGLES]], {{%.+}}, {{%.+}}) : (memref<?xf64>, f64, i1) -> ()
+    // CHECK: memref.dealloc [[ANGLES]]
+
+    // CLIFFORD-COUNT-4: call @__catalyst_decompose_RZ(
+    // PPR-COUNT-4:      call @__catalyst_decompose_RZ_ppr_basis(
+    // CLIFFORD-NOT:     call @__catalyst_decompose_RZ(
+    // PPR-NOT:          call @__catalyst_decompose_RZ_ppr_basis(
+
+    %q1 = quantum.custom "RZ"(%theta) %arg0 : !quantum.bit
+    %q2 = quantum.custom "PhaseShift"(%phi) %q1 : !quantum.bit
+    %q3 = quantum.custom "RZ"(%theta) %q2 : !quantum.bit
+
+    // COM: angles computed after the first decomposed op are not batched
+    %late = arith.addf %theta, %phi : f64
+    %q4 = quantum.custom "RZ"(%late) %q3 : !quantum.bit
+
+    %q5 = pbc.ppr.arbitrary ["Z"](%theta) %q4 : !quantum.bit
+    return %q5 : !quantum.bit
+}
+
+// CHECK-LABEL: @test_batch_needs_two_angles
+func.func @test_batch_needs_two_angles(%arg0: !quantum.bit, %theta: f64) -> !quantum.bit {
+
+    // CHECK-NOT: call @rs_decomposition_solve_batch
+    // CLIFFORD: call @__catalyst_decompose_RZ(
+    // PPR:      call @__catalyst_decompose_RZ_ppr_basis(
+
+    %q1 = quantum.custom "RZ"(%theta) %arg0 : !quantum.bit
+    %q2 = quantum.custom "RZ"(%theta) %q1 : !quantum.bit
+    return %q2 : !quantum.bit
+}
+
+// -----
+
+// Test that constant angles of the precomputed table are decomposed at compile time, and are not
+// solved at runtime
+
+// CHECK-LABEL: @test_precomputed_angles
+// CHECK-SAME: ([[Q_IN:%.+]]: !quantum.bit, [[PHI:%.+]]: f64)
+func.func @test_precomputed_angles(%arg0: !quantum.bit, %phi: f64) -> !quantum.bit {
+    // COM: pi / 8, and pi / 16 which is doubled to pi / 8 for the PPR
+    %theta = arith.constant 0.39269908169872414 : f64
+    %half_theta = arith.constant 0.19634954084936207 : f64
+
+    // CHECK-NOT: call @rs_decomposition_solve_batch
+    // CLIFFORD-NOT: call @__catalyst_decompose_RZ(
+    // PPR-NOT:      call @__catalyst_decompose_RZ_ppr_basis(
+
+    // CLIFFORD: [[G1:%.+]] = quantum.custom "Hadamard"() [[Q_IN]]
+    // CLIFFORD: [[G2:%.+]] = quantum.custom "T"() [[G1]]
+    // PPR:      [[G1:%.+]] = pbc.ppr ["X"](4) [[Q_IN]]
+    // CHECK:    quantum.gphase
+    %q1 = quantum.custom "RZ"(%theta) %arg0 : !quantum.bit
+
+    // CHECK:    quantum.gphase
+    %q2 = quantum.custom "PhaseShift"(%theta) %q1 : !quantum.bit
+
+    // CHECK:    quantum.gphase
+    %q3 = pbc.ppr.arbitrary ["Z"](%half_theta) %q2 : !quantum.bit
+
+    // COM: other angles are still decomposed at runtime
+    // CLIFFORD: call @__catalyst_decompose_RZ({{%.+}}, [[PHI]])
+    // PPR:      call @__catalyst_decompose_RZ_ppr_basis({{%.+}}, [[PHI]])
+    %q4 = quantum.custom "RZ"(%phi) %q3 : !quantum.bit
+    return %q4 : !quantum.bit
+}
@@ -0,0 +1,53 @@
+// Copyright 2024 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --ions-decomposition="merge-rotations=true" --split-input-file -verify-diagnostics %s | FileCheck %s
+
+// The RX rotations at the boundaries of the decompositions are merged with the RX in between
+
+// CHECK-LABEL: func.func @test_ions_decomposition_merge
+func.func @test_ions_decomposition_merge(%arg0: f64) -> !quantum.bit {
+    // CHECK: quantum.custom "RX"
+    // CHECK: quantum.custom "RY"
+    // CHECK: quantum.custom "RX"
+    // CHECK: quantum.custom "RY"
+    // CHECK: quantum.custom "RX"
+    // CHECK-NOT: quantum.custom
+    // CHECK: return
+    %0 = quantum.alloc( 1) : !quantum.reg
+    %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+    %2 = quantum.custom "T"() %1 : !quantum.bit
+    %3 = quantum.custom "RX"(%arg0) %2 : !quantum.bit
+    %4 = quantum.custom "T"() %3 : !quantum.bit
+    return %4 : !quantum.bit
+}
+
+// -----
+
+// CHECK-LABEL: func.func @test_ions_decomposition_merge_hadamards
+func.func @test_ions_decomposition_merge_hadamards() -> !quantum.bit {
+    // CHECK-DAG: [[PIO2:%.+]] = arith.constant 1.5707963267948966 : f64
+    // CHECK-DAG: [[PI:%.+]] = arith.constant 3.1415926535897931 : f64
+    // CHECK: quantum.custom "RX"
+    // CHECK: quantum.custom "RY"([[PIO2]])
+    // CHECK: quantum.custom "RX"([[PI]])
+    // CHECK: quantum.custom "RY"([[PIO2]])
+    // CHECK: quantum.custom "RX"([[PI]])
+    // CHECK-NOT: quantum.custom
+    %0 = quantum.alloc( 1) : !quantum.reg
+    %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+    %2 = quantum.custom "Hadamard"() %1 : !quantum.bit
+    %3 = quantum.custom "Hadamard"() %2 : !quantum.bit
+    return %3 : !quantum.bit
+}
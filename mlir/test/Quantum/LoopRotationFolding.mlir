@@ -0,0 +1,103 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --loop-boundary="fold-rotations=true" --split-input-file -verify-diagnostics %s | FileCheck %s
+
+// A loop invariant rotation is folded into a single rotation by N times the angle.
+
+// CHECK-LABEL: func @fold_invariant_rotation(
+// CHECK-SAME: [[arg:%.+]]: !quantum.bit) -> !quantum.bit {
+func.func @fold_invariant_rotation(%q: !quantum.bit) -> !quantum.bit {
+    %start = arith.constant 0 : index
+    %stop = arith.constant 10 : index
+    %step = arith.constant 1 : index
+    %phi = arith.constant 0.1 : f64
+
+    // CHECK-DAG: [[total:%.+]] = arith.constant 1.000000e+00 : f64
+    // CHECK: [[loop:%.+]] = scf.for {{.*}} iter_args([[q0:%.+]] = [[arg]]) -> (!quantum.bit) {
+    // CHECK-NOT: quantum.custom
+    // CHECK: scf.yield [[q0]] : !quantum.bit
+    %qq = scf.for %i = %start to %stop step %step iter_args(%q_0 = %q) -> (!quantum.bit) {
+        %q_1 = quantum.custom "RZ"(%phi) %q_0 : !quantum.bit
+        scf.yield %q_1 : !quantum.bit
+    }
+
+    // CHECK: [[out:%.+]] = quantum.custom "RZ"([[total]]) [[loop]] : !quantum.bit
+    // CHECK: return [[out]]
+    func.return %qq : !quantum.bit
+}
+
+// -----
+
+// Angles that grow linearly with the induction variable are summed in closed form:
+// 0.5 * (0 + 1 + 2 + 3) = 3.0, and chained rotations on the same qubit are added up.
+
+// CHECK-LABEL: func @fold_affine_rotation(
+// CHECK-SAME: [[arg:%.+]]: !quantum.bit) -> !quantum.bit {
+func.func @fold_affine_rotation(%q: !quantum.bit) -> !quantum.bit {
+    %start = arith.constant 0 : index
+    %stop = arith.constant 4 : index
+    %step = arith.constant 1 : index
+    %half = arith.constant 0.5 : f64
+    %phi = arith.constant 0.25 : f64
+
+    // CHECK-DAG: [[total:%.+]] = arith.constant 4.000000e+00 : f64
+    // CHECK: [[loop:%.+]] = scf.for
+    // CHECK-NOT: quantum.custom
+    // CHECK: scf.yield
+    %qq = scf.for %i = %start to %stop step %step iter_args(%q_0 = %q) -> (!quantum.bit) {
+        %i_int = arith.index_cast %i : index to i64
+        %i_float = arith.sitofp %i_int : i64 to f64
+        %theta = arith.mulf %i_float, %half : f64
+        %q_1 = quantum.custom "RX"(%theta) %q_0 : !quantum.bit
+        %q_2 = quantum.custom "RX"(%phi) %q_1 : !quantum.bit
+        scf.yield %q_2 : !quantum.bit
+    }
+
+    // CHECK: [[out:%.+]] = quantum.custom "RX"([[total]]) [[loop]] : !quantum.bit
+    // CHECK: return [[out]]
+    func.return %qq : !quantum.bit
+}
+
+// -----
+
+// Angles that are not affine in the induction variable, and qubits with other gates, are kept.
+
+// CHECK-LABEL: func @no_fold(
+func.func @no_fold(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    %start = arith.constant 0 : index
+    %stop = arith.constant 4 : index
+    %step = arith.constant 1 : index
+    %phi = arith.constant 0.25 : f64
+
+    // CHECK: scf.for
+    // CHECK: arith.mulf
+    // CHECK: quantum.custom "RZ"
+    // CHECK: quantum.custom "RY"
+    // CHECK: quantum.custom "H"
+    // CHECK: scf.yield
+    // CHECK-NOT: quantum.custom
+    // CHECK: return
+    %qq:2 = scf.for %i = %start to %stop step %step iter_args(%q_0 = %q0, %q_1 = %q1) -> (!quantum.bit, !quantum.bit) {
+        %i_int = arith.index_cast %i : index to i64
+        %i_float = arith.sitofp %i_int : i64 to f64
+        %theta = arith.mulf %i_float, %i_float : f64
+        %q_2 = quantum.custom "RZ"(%theta) %q_0 : !quantum.bit
+        %q_3 = quantum.custom "RY"(%phi) %q_1 : !quantum.bit
+        %q_4 = quantum.custom "H"() %q_3 : !quantum.bit
+        scf.yield %q_2, %q_4 : !quantum.bit, !quantum.bit
+    }
+
+    func.return %qq#0, %qq#1 : !quantum.bit, !quantum.bit
+}
@@ -41,26 +41,53 @@ func.func public @wrapper() -> memref<1xf64> attributes {llvm.emit_c_interface}
 
 // Test that the transformation actually happened
 // CHECK-LABEL: @wrapper
-func.func public @wrapper() -> memref<1xf64> attributes {llvm.emit_c_interface} {
-  %0 = arith.constant 0.0 : f64
-  %alloc = memref.alloc() {alignment = 64 : i64} : memref<1xf64>
-  %c0 = arith.constant 0 : index
-  memref.store %0, %alloc[%c0] : memref<1xf64>
+// CHECK-SAME: [[arg:%.+]]: memref<1xf64>
+func.func public @wrapper(%x: memref<1xf64>) -> memref<1xf64> attributes {llvm.emit_c_interface} {
   // CHECK: [[deadbeef:%.+]] = llvm.mlir.constant(3735928559 : index) : i64
-  // CHECK: [[struct:%.+]] = builtin.unrealized_conversion_cast %alloc
+  // CHECK: [[struct:%.+]] = builtin.unrealized_conversion_cast [[arg]]
   // CHECK: [[ptr:%.+]] = llvm.extractvalue [[struct]][0]
   // CHECK: [[int:%.+]] = llvm.ptrtoint [[ptr]]
   // CHECK: [[cmp:%.+]] = llvm.icmp "eq" [[deadbeef]], [[int]]
   // CHECK: [[res:%.+]] = scf.if [[cmp]]
   // CHECK-NEXT: [[new:%.+]] = memref.alloc
-  // CHECK-NEXT: memref.copy %alloc, [[new]]
+  // CHECK-NEXT: memref.copy [[arg]], [[new]]
   // CHECK-NEXT: scf.yield [[new]]
   // CHECK-NEXT: else
-  // CHECK-NEXT: scf.yield %alloc
+  // CHECK-NEXT: scf.yield [[arg]]
   // CHECK: return [[res]]
-  func.return %alloc : memref<1xf64>
+  func.return %x : memref<1xf64>
 }
 
+// -----
+
+// Test that buffers allocated by the function are returned without a check
+// CHECK-LABEL: @wrapper
+// CHECK-SAME: llvm.copy_memref
+func.func public @wrapper() -> memref<2xf64> attributes {llvm.emit_c_interface} {
+  // CHECK-NOT: llvm.icmp
+  // CHECK: [[cast:%.+]] = memref.cast
+  // CHECK-NOT: memref.copy
+  // CHECK: return [[cast]]
+  %alloc = memref.alloc() {alignment = 64 : i64} : memref<2xf64>
+  %cast = memref.cast %alloc : memref<2xf64> to memref<2xf64>
+  func.return %cast : memref<2xf64>
+}
+
+// -----
+
+// Test that global constant buffers are always copied
+memref.global "private" constant @__constant_2xf64 : memref<2xf64> = dense<[1.0, 2.0]>
+
+// CHECK-LABEL: @wrapper
+func.func public @wrapper() -> memref<2xf64> attributes {llvm.emit_c_interface} {
+  // CHECK: [[global:%.+]] = memref.get_global @__constant_2xf64
+  // CHECK-NOT: llvm.icmp
+  // CHECK: [[new:%.+]] = memref.alloc() : memref<2xf64>
+  // CHECK-NEXT: memref.copy [[global]], [[new]]
+  // CHECK-NEXT: return [[new]]
+  %0 = memref.get_global @__constant_2xf64 : memref<2xf64>
+  func.return %0 : memref<2xf64>
+}
 
 // -----
 
@@ -66,12 +66,12 @@ func.func @keep_controlled_global_phases(%arg0: f64, %arg1: f64, %arg2: f64, %q:
 func.func @merge_global_phases_in_scf_if(%cond: i1, %arg0: f64, %arg1: f64) {
     // CHECK-SAME: [[COND:%.+]]: i1, [[A:%.+]]: f64, [[B:%.+]]: f64
 
-    // CHECK: [[IF_RES:%.+]] = scf.if [[COND]] -> (f64) {
+    // CHECK: [[IF_RES:%.+]]:2 = scf.if [[COND]] -> (f64, f64) {
     %ret = scf.if %cond -> (f64) {
         // CHECK-NOT: quantum.gphase
         // CHECK: [[THEN_SUM:%.+]] = arith.addf [[A]], [[A]]
-        // CHECK: quantum.gphase([[THEN_SUM]])
         // CHECK-NOT: quantum.gphase
+        // CHECK: scf.yield [[A]], [[THEN_SUM]] : f64, f64
         quantum.gphase(%arg0)
         quantum.gphase(%arg0)
 
@@ -80,8 +80,8 @@ func.func @merge_global_phases_in_scf_if(%cond: i1, %arg0: f64, %arg1: f64) {
     } else {
         // CHECK-NOT: quantum.gphase
         // CHECK: [[ELSE_SUM:%.+]] = arith.addf [[B]], [[B]]
-        // CHECK: quantum.gphase([[ELSE_SUM]])
         // CHECK-NOT: quantum.gphase
+        // CHECK: scf.yield [[B]], [[ELSE_SUM]] : f64, f64
         quantum.gphase(%arg1)
         quantum.gphase(%arg1)
 
@@ -89,7 +89,8 @@ func.func @merge_global_phases_in_scf_if(%cond: i1, %arg0: f64, %arg1: f64) {
     }
 
     // CHECK-NOT: quantum.gphase
-    // CHECK: [[OUT_SUM:%.+]] = arith.addf [[IF_RES]], [[A]]
+    // CHECK: [[SUM1:%.+]] = arith.addf [[IF_RES]]#0, [[IF_RES]]#1
+    // CHECK: [[OUT_SUM:%.+]] = arith.addf [[SUM1]], [[A]]
     // CHECK: quantum.gphase([[OUT_SUM]])
     // CHECK-NOT: quantum.gphase
     quantum.gphase(%arg0)
@@ -138,3 +139,61 @@ func.func @merge_global_phases_adjoint(%arg0: f64, %arg1: f64, %arg2: f64) {
 
     return
 }
+
+// -----
+
+// CHECK-LABEL: func.func @keep_global_phase_in_single_branch(
+func.func @keep_global_phase_in_single_branch(%cond: i1, %arg0: f64) {
+    // CHECK: scf.if
+    // CHECK-NEXT: quantum.gphase
+    scf.if %cond {
+        quantum.gphase(%arg0)
+    }
+    return
+}
+
+// -----
+
+// CHECK-LABEL: func.func @fold_global_phase_out_of_scf_for(
+func.func @fold_global_phase_out_of_scf_for(%arg0: f64, %n: index) {
+    // CHECK-SAME: [[A:%.+]]: f64, [[N:%.+]]: index
+
+    // CHECK-DAG: [[C0:%.+]] = arith.constant 0 : index
+    // CHECK-DAG: [[C2:%.+]] = arith.constant 2 : index
+    // CHECK: [[ANGLE:%.+]] = arith.addf [[A]], [[A]]
+    // CHECK: scf.for
+    // CHECK-NOT: quantum.gphase
+    // CHECK: }
+    // CHECK: [[DIST:%.+]] = arith.subi [[N]], [[C0]]
+    // CHECK: [[DIV:%.+]] = arith.ceildivsi [[DIST]], [[C2]]
+    // CHECK: [[COUNT:%.+]] = arith.maxsi [[DIV]]
+    // CHECK: [[COUNT_I64:%.+]] = arith.index_cast [[COUNT]] : index to i64
+    // CHECK: [[COUNT_F64:%.+]] = arith.sitofp [[COUNT_I64]] : i64 to f64
+    // CHECK: [[TOTAL:%.+]] = arith.mulf [[ANGLE]], [[COUNT_F64]]
+    // CHECK: quantum.gphase([[TOTAL]])
+    %c0 = arith.constant 0 : index
+    %c2 = arith.constant 2 : index
+    scf.for %i = %c0 to %n step %c2 {
+        quantum.gphase(%arg0)
+        quantum.gphase(%arg0)
+    }
+    return
+}
+
+// -----
+
+// CHECK-LABEL: func.func @keep_variant_global_phase_in_scf_for(
+func.func @keep_variant_global_phase_in_scf_for(%n: index) {
+    // CHECK: scf.for
+    // CHECK: quantum.gphase
+    // CHECK: }
+    // CHECK-NOT: quantum.gphase
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    scf.for %i = %c0 to %n step %c1 {
+        %i64 = arith.index_cast %i : index to i64
+        %angle = arith.sitofp %i64 : i64 to f64
+        quantum.gphase(%angle)
+    }
+    return
+}
@@ -0,0 +1,120 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(merge-qnode-calls)" --split-input-file --verify-diagnostics | FileCheck %s
+
+// Analytic calls with the same arguments are merged, while calls with other arguments are kept
+
+module @analytic {
+  func.func private @circuit(%arg0: f64) -> f64 attributes {quantum.node} {
+    quantum.device ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "RX"(%arg0) %q_0 : !quantum.bit
+    %obs = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func public @main(%arg0: f64, %arg1: f64) -> (f64, f64, f64) {
+    %loss = func.call @circuit(%arg0) : (f64) -> f64
+    %metric = func.call @circuit(%arg0) : (f64) -> f64
+    %other = func.call @circuit(%arg1) : (f64) -> f64
+    return %loss, %metric, %other : f64, f64, f64
+  }
+}
+
+// CHECK-LABEL: func.func public @main
+// CHECK:         [[loss:%.+]] = call @circuit(%arg0)
+// CHECK-NOT:     call @circuit(%arg0)
+// CHECK:         [[other:%.+]] = call @circuit(%arg1)
+// CHECK:         return [[loss]], [[loss]], [[other]]
+
+// -----
+
+// Calls of qnodes with shots, or with mid-circuit measurements, are kept
+
+module @random {
+  func.func private @circuit_shots() -> f64 attributes {quantum.node} {
+    %shots = arith.constant 100 : i64
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q_0[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    quantum.dealloc %r : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func private @circuit_mcm() -> i1 attributes {quantum.node} {
+    quantum.device ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %m, %q_1 = quantum.measure %q_0 : i1, !quantum.bit
+    %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    return %m : i1
+  }
+
+  func.func public @main() -> (f64, f64, i1, i1) {
+    %0 = func.call @circuit_shots() : () -> f64
+    %1 = func.call @circuit_shots() : () -> f64
+    %2 = func.call @circuit_mcm() : () -> i1
+    %3 = func.call @circuit_mcm() : () -> i1
+    return %0, %1, %2, %3 : f64, f64, i1, i1
+  }
+}
+
+// CHECK-LABEL: func.func public @main
+// CHECK-COUNT-2: call @circuit_shots()
+// CHECK-COUNT-2: call @circuit_mcm()
+
+// -----
+
+// The kernel launches of the qnodes of the nested modules of the frontend are merged too
+
+module @nested_module {
+  module @module_circuit {
+    func.func public @circuit(%arg0: tensor<f64>) -> tensor<f64> attributes {quantum.node} {
+      quantum.device ["librtd_lightning.so", "LightningSimulator", "{}"]
+      %r = quantum.alloc( 1) : !quantum.reg
+      %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+      %theta = tensor.extract %arg0[] : tensor<f64>
+      %q_1 = quantum.custom "RX"(%theta) %q_0 : !quantum.bit
+      %obs = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+      %expval = quantum.expval %obs : f64
+      %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+      quantum.dealloc %r_1 : !quantum.reg
+      quantum.device_release
+      %result = tensor.from_elements %expval : tensor<f64>
+      return %result : tensor<f64>
+    }
+  }
+
+  func.func public @jit_main(%arg0: tensor<f64>) -> (tensor<f64>, tensor<f64>) {
+    %loss = catalyst.launch_kernel @module_circuit::@circuit(%arg0) : (tensor<f64>) -> tensor<f64>
+    %metric = catalyst.launch_kernel @module_circuit::@circuit(%arg0) : (tensor<f64>) -> tensor<f64>
+    return %loss, %metric : tensor<f64>, tensor<f64>
+  }
+}
+
+// CHECK-LABEL: func.func public @jit_main
+// CHECK:         [[loss:%.+]] = catalyst.launch_kernel @module_circuit::@circuit(%arg0)
+// CHECK-NOT:     catalyst.launch_kernel
+// CHECK:         return [[loss]], [[loss]]
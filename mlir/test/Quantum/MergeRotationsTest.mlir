@@ -1337,3 +1337,24 @@ func.func public @merge_const_var(%q0: !quantum.bit, %0: f64) {
     func.return
 }
 
+
+// -----
+
+// merge a long chain of rotations on one wire
+
+// CHECK-LABEL: merge_long_chain
+func.func public @merge_long_chain(%q0: !quantum.bit, %a: f64, %b: f64, %c: f64, %d: f64, %e: f64) -> !quantum.bit {
+    // CHECK: [[ab:%.+]] = arith.addf %arg1, %arg2
+    // CHECK: [[abc:%.+]] = arith.addf [[ab]], %arg3
+    // CHECK: [[abcd:%.+]] = arith.addf [[abc]], %arg4
+    // CHECK: [[abcde:%.+]] = arith.addf [[abcd]], %arg5
+    // CHECK: [[ret:%.+]] = quantum.custom "RZ"([[abcde]]) %arg0
+    // CHECK-NOT: quantum.custom
+    // CHECK: return [[ret]]
+    %0 = quantum.custom "RZ"(%a) %q0 : !quantum.bit
+    %1 = quantum.custom "RZ"(%b) %0 : !quantum.bit
+    %2 = quantum.custom "RZ"(%c) %1 : !quantum.bit
+    %3 = quantum.custom "RZ"(%d) %2 : !quantum.bit
+    %4 = quantum.custom "RZ"(%e) %3 : !quantum.bit
+    return %4 : !quantum.bit
+}
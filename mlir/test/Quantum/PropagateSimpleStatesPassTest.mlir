@@ -0,0 +1,113 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(propagate-simple-states)" --split-input-file --verify-diagnostics | FileCheck %s
+
+// Gates leaving known simple states unchanged are removed
+
+// CHECK-LABEL: func.func @eigen_gates
+func.func @eigen_gates(%arg0: f64) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
+    // CHECK: [[reg:%.+]] = quantum.alloc
+    // CHECK: [[q0:%.+]] = quantum.extract [[reg]][ 0]
+    // CHECK: [[q1:%.+]] = quantum.extract [[reg]][ 1]
+    // CHECK: [[q2:%.+]] = quantum.extract [[reg]][ 2]
+    // CHECK-NOT: "RZ"
+    // CHECK: [[half:%.+]] = arith.constant 5.000000e-01 : f64
+    // CHECK: [[rzPhase:%.+]] = arith.mulf %arg0, [[half]] : f64
+    // CHECK: quantum.gphase([[rzPhase]])
+    // CHECK-NOT: "T"
+    // CHECK: [[plus:%.+]] = quantum.custom "Hadamard"() [[q0]]
+    // CHECK-NOT: "RX"
+    // CHECK: [[rxPhase:%.+]] = arith.mulf %arg0, {{%.+}} : f64
+    // CHECK: quantum.gphase([[rxPhase]])
+    // CHECK-NOT: "PauliX"
+    // CHECK: [[minus:%.+]] = quantum.custom "PauliZ"() [[plus]]
+    // CHECK: [[one:%.+]] = quantum.custom "PauliX"() [[q1]]
+    // CHECK-NOT: "PhaseShift"
+    // CHECK: [[minusOne:%.+]] = arith.constant -1.000000e+00 : f64
+    // CHECK: [[psPhase:%.+]] = arith.mulf %arg0, [[minusOne]] : f64
+    // CHECK: quantum.gphase([[psPhase]])
+    // CHECK: [[notBasis:%.+]] = quantum.custom "RY"(%arg0) [[q2]]
+    // CHECK: [[rz:%.+]] = quantum.custom "RZ"(%arg0) [[notBasis]]
+    // CHECK: return [[minus]], [[one]], [[rz]]
+    %r = quantum.alloc( 3) : !quantum.reg
+    %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r[ 1] : !quantum.reg -> !quantum.bit
+    %q2 = quantum.extract %r[ 2] : !quantum.reg -> !quantum.bit
+    %0 = quantum.custom "RZ"(%arg0) %q0 : !quantum.bit
+    %1 = quantum.custom "T"() %0 : !quantum.bit
+    %2 = quantum.custom "Hadamard"() %1 : !quantum.bit
+    %3 = quantum.custom "RX"(%arg0) %2 : !quantum.bit
+    %4 = quantum.custom "PauliX"() %3 : !quantum.bit
+    %5 = quantum.custom "PauliZ"() %4 : !quantum.bit
+    %6 = quantum.custom "PauliX"() %q1 : !quantum.bit
+    %7 = quantum.custom "PhaseShift"(%arg0) %6 : !quantum.bit
+    %8 = quantum.custom "RY"(%arg0) %q2 : !quantum.bit
+    %9 = quantum.custom "RZ"(%arg0) %8 : !quantum.bit
+    return %5, %7, %9 : !quantum.bit, !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// The phases of the removed gates are applied as global phases, negated for adjoint gates
+
+// CHECK-LABEL: func.func @eigen_phases
+func.func @eigen_phases() -> (!quantum.bit, !quantum.bit) {
+    // CHECK-NOT: "T"
+    // CHECK: [[tPhase:%.+]] = arith.constant -0.78539816339744828 : f64
+    // CHECK: quantum.gphase([[tPhase]])
+    // CHECK-NOT: "S"
+    // CHECK: [[sPhase:%.+]] = arith.constant 1.5707963267948966 : f64
+    // CHECK: quantum.gphase([[sPhase]])
+    // CHECK: [[minus:%.+]] = quantum.custom "Hadamard"()
+    // CHECK-NOT: "PauliX"
+    // CHECK: [[xPhase:%.+]] = arith.constant -3.1415926535897931 : f64
+    // CHECK: quantum.gphase([[xPhase]])
+    // CHECK: return {{%.+}}, [[minus]]
+    %r = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r[ 1] : !quantum.reg -> !quantum.bit
+    %one = quantum.custom "PauliX"() %q0 : !quantum.bit
+    %0 = quantum.custom "T"() %one : !quantum.bit
+    %1 = quantum.custom "S"() %0 adj : !quantum.bit
+    %2 = quantum.custom "PauliX"() %q1 : !quantum.bit
+    %minus = quantum.custom "Hadamard"() %2 : !quantum.bit
+    %3 = quantum.custom "PauliX"() %minus : !quantum.bit
+    return %1, %3 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Measurements of known computational basis states are folded into constants
+
+// CHECK-LABEL: func.func @known_measurements
+func.func @known_measurements() -> (i1, i1, i1, !quantum.bit) {
+    // CHECK: [[q0:%.+]] = quantum.extract {{%.+}}[ 0]
+    // CHECK-DAG: [[false:%.+]] = arith.constant false
+    // CHECK-DAG: [[true:%.+]] = arith.constant true
+    // CHECK: [[plus:%.+]] = quantum.custom "Hadamard"()
+    // CHECK: [[mres:%.+]], {{%.+}} = quantum.measure [[plus]]
+    // CHECK-NOT: quantum.measure
+    // CHECK: return [[false]], [[true]], [[mres]], [[q0]]
+    %r = quantum.alloc( 3) : !quantum.reg
+    %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r[ 1] : !quantum.reg -> !quantum.bit
+    %q2 = quantum.extract %r[ 2] : !quantum.reg -> !quantum.bit
+    %m0, %out0 = quantum.measure %q0 : i1, !quantum.bit
+    %one = quantum.custom "PauliX"() %q1 : !quantum.bit
+    %m1, %out1 = quantum.measure %one : i1, !quantum.bit
+    %plus = quantum.custom "Hadamard"() %q2 : !quantum.bit
+    %m2, %out2 = quantum.measure %plus : i1, !quantum.bit
+    return %m0, %m1, %m2, %out0 : i1, i1, i1, !quantum.bit
+}
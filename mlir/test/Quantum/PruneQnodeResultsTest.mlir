@@ -0,0 +1,183 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(prune-qnode-results)" --split-input-file --verify-diagnostics | FileCheck %s
+
+// The results of a qnode that the caller does not use are removed with their measurements
+
+module @unused_result {
+  func.func private @circuit(%arg0: f64) -> (f64, f64) attributes {quantum.node} {
+    %shots = arith.constant 0 : i64
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "RX"(%arg0) %q_0 : !quantum.bit
+    %obs_z = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval_z = quantum.expval %obs_z : f64
+    %obs_x = quantum.namedobs %q_1[PauliX] : !quantum.obs
+    %expval_x = quantum.expval %obs_x : f64
+    %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    return %expval_z, %expval_x : f64, f64
+  }
+
+  func.func public @main(%arg0: f64) -> f64 {
+    %0:2 = func.call @circuit(%arg0) : (f64) -> (f64, f64)
+    return %0#1 : f64
+  }
+}
+
+// CHECK-LABEL: func.func private @circuit(%arg0: f64) -> f64
+// CHECK-NOT:     PauliZ
+// CHECK:         [[obs:%.+]] = quantum.namedobs {{%.+}}[ PauliX]
+// CHECK:         [[expval:%.+]] = quantum.expval [[obs]] : f64
+// CHECK:         return [[expval]] : f64
+
+// CHECK-LABEL: func.func public @main
+// CHECK:         [[result:%.+]] = call @circuit(%arg0) : (f64) -> f64
+// CHECK:         return [[result]] : f64
+
+// -----
+
+// Calls whose results are all unused are removed, as well as the results of the tapes that only
+// these calls used
+
+module @unused_call {
+  func.func private @circuit_tape_0() -> f64 attributes {quantum.node} {
+    %shots = arith.constant 0 : i64
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q_0[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    quantum.dealloc %r : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func private @circuit() -> (f64, f64) attributes {quantum.node} {
+    %0 = func.call @circuit_tape_0() : () -> f64
+    %1 = arith.constant 1.000000e+00 : f64
+    return %0, %1 : f64, f64
+  }
+
+  func.func public @main() -> f64 {
+    %0:2 = func.call @circuit() : () -> (f64, f64)
+    %1:2 = func.call @circuit() : () -> (f64, f64)
+    return %0#1 : f64
+  }
+}
+
+// CHECK-LABEL: func.func private @circuit() -> f64
+// CHECK-NOT:     call @circuit_tape_0
+// CHECK:         return
+
+// CHECK-LABEL: func.func public @main
+// CHECK:         call @circuit()
+// CHECK-NOT:     call @circuit()
+// CHECK:         return
+
+// -----
+
+// Qnodes with other symbol uses, or calling external functions, keep their results and calls
+
+module @kept {
+  func.func private @circuit() -> f64 attributes {quantum.node} {
+    %shots = arith.constant 0 : i64
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q_0[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    quantum.dealloc %r : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func private @circuit_print() -> f64 attributes {quantum.node} {
+    %shots = arith.constant 0 : i64
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q_0[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    func.call @callback(%expval) : (f64) -> ()
+    quantum.dealloc %r : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func private @callback(f64)
+
+  func.func public @main() {
+    %0 = func.call @circuit() : () -> f64
+    %1 = func.call @circuit_print() : () -> f64
+    %ptr = func.constant @circuit : () -> f64
+    return
+  }
+}
+
+// CHECK-LABEL: func.func private @circuit() -> f64
+// CHECK:         quantum.expval
+
+// CHECK-LABEL: func.func private @circuit_print() -> f64
+// CHECK:         quantum.expval
+
+// CHECK-LABEL: func.func public @main
+// CHECK:         call @circuit() : () -> f64
+// CHECK:         call @circuit_print() : () -> f64
+
+// -----
+
+// The qnodes of the nested modules of the frontend, launched as kernels, are pruned too
+
+module @nested_module {
+  module @module_circuit {
+    func.func public @circuit(%arg0: tensor<f64>) -> (tensor<f64>, tensor<f64>) attributes {quantum.node} {
+      %shots = arith.constant 0 : i64
+      quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+      %r = quantum.alloc( 1) : !quantum.reg
+      %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+      %theta = tensor.extract %arg0[] : tensor<f64>
+      %q_1 = quantum.custom "RX"(%theta) %q_0 : !quantum.bit
+      %obs_z = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+      %expval_z = quantum.expval %obs_z : f64
+      %obs_x = quantum.namedobs %q_1[PauliX] : !quantum.obs
+      %expval_x = quantum.expval %obs_x : f64
+      %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+      quantum.dealloc %r_1 : !quantum.reg
+      quantum.device_release
+      %z = tensor.from_elements %expval_z : tensor<f64>
+      %x = tensor.from_elements %expval_x : tensor<f64>
+      return %z, %x : tensor<f64>, tensor<f64>
+    }
+  }
+
+  func.func public @jit_main(%arg0: tensor<f64>) -> tensor<f64> {
+    %0:2 = catalyst.launch_kernel @module_circuit::@circuit(%arg0) : (tensor<f64>) -> (tensor<f64>, tensor<f64>)
+    %1:2 = catalyst.launch_kernel @module_circuit::@circuit(%arg0) : (tensor<f64>) -> (tensor<f64>, tensor<f64>)
+    return %0#1 : tensor<f64>
+  }
+}
+
+// CHECK-LABEL: module @module_circuit
+// CHECK:         func.func public @circuit(%arg0: tensor<f64>) -> tensor<f64>
+// CHECK-NOT:       PauliZ
+// CHECK:           quantum.namedobs {{%.+}}[ PauliX]
+
+// CHECK-LABEL: func.func public @jit_main
+// CHECK:         [[result:%.+]] = catalyst.launch_kernel @module_circuit::@circuit(%arg0) : (tensor<f64>) -> tensor<f64>
+// CHECK-NOT:     catalyst.launch_kernel
+// CHECK:         return [[result]] : tensor<f64>
@@ -0,0 +1,181 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// RUN: quantum-opt %s --lower-sample-postprocessing --split-input-file --verify-diagnostics | FileCheck %s
+
+// The histogram of the bitstrings of all columns calls the counts kernel with the number of
+// shots, columns and bins, and the integer weights of the columns.
+
+// CHECK-LABEL: func.func @bitstring_histogram
+func.func @bitstring_histogram() -> tensor<8xi64> {
+    // CHECK: [[samples:%.+]] = quantum.sample
+    // CHECK-DAG: [[shots:%.+]] = arith.constant dense<1000> : tensor<i32>
+    // CHECK-DAG: [[columns:%.+]] = arith.constant dense<3> : tensor<i32>
+    // CHECK-DAG: [[bins:%.+]] = arith.constant dense<8> : tensor<i32>
+    // CHECK-DAG: [[weights:%.+]] = arith.constant dense<[4, 2, 1]> : tensor<3xi64>
+    // CHECK: [[counts:%.+]] = catalyst.custom_call fn("catalyst_sample_counts_i64")([[shots]], [[columns]], [[bins]], [[weights]], [[samples]])
+    // CHECK-SAME: -> tensor<8xi64>
+    // CHECK-NOT: stablehlo.scatter
+    // CHECK: return [[counts]]
+    %r = quantum.alloc( 3) : !quantum.reg
+    %obs = quantum.compbasis qreg %r : !quantum.obs
+    %samples = quantum.sample %obs : tensor<1000x3xf64>
+    %powers = stablehlo.constant dense<[4.0, 2.0, 1.0]> : tensor<3xf64>
+    %dot = stablehlo.dot_general %samples, %powers, contracting_dims = [1] x [0] : (tensor<1000x3xf64>, tensor<3xf64>) -> tensor<1000xf64>
+    %indices = stablehlo.convert %dot : (tensor<1000xf64>) -> tensor<1000xi32>
+    %indices2d = stablehlo.reshape %indices : (tensor<1000xi32>) -> tensor<1000x1xi32>
+    %zeros = stablehlo.constant dense<0> : tensor<8xi64>
+    %ones = stablehlo.constant dense<1> : tensor<1000xi64>
+    %counts = "stablehlo.scatter"(%zeros, %indices2d, %ones) ({
+    ^bb0(%lhs: tensor<i64>, %rhs: tensor<i64>):
+        %sum = stablehlo.add %lhs, %rhs : tensor<i64>
+        stablehlo.return %sum : tensor<i64>
+    }) {indices_are_sorted = false, scatter_dimension_numbers = #stablehlo.scatter<inserted_window_dims = [0], scatter_dims_to_operand_dims = [0], index_vector_dim = 1>, unique_indices = false} : (tensor<8xi64>, tensor<1000x1xi32>, tensor<1000xi64>) -> tensor<8xi64>
+    quantum.dealloc %r : !quantum.reg
+    return %counts : tensor<8xi64>
+}
+
+// -----
+
+// Marginal counts give a zero weight to the columns that are left out.
+
+// CHECK-LABEL: func.func @marginal_counts
+func.func @marginal_counts() -> tensor<4xf64> {
+    // CHECK: [[samples:%.+]] = quantum.sample
+    // CHECK-DAG: [[weights:%.+]] = arith.constant dense<[2, 0, 1]> : tensor<3xi64>
+    // CHECK: [[counts:%.+]] = catalyst.custom_call fn("catalyst_sample_counts_f64")({{%.+}}, {{%.+}}, {{%.+}}, [[weights]], [[samples]])
+    // CHECK-SAME: -> tensor<4xf64>
+    // CHECK: return [[counts]]
+    %r = quantum.alloc( 3) : !quantum.reg
+    %obs = quantum.compbasis qreg %r : !quantum.obs
+    %samples = quantum.sample %obs : tensor<500x3xf64>
+    %powers = stablehlo.constant dense<[2.0, 0.0, 1.0]> : tensor<3xf64>
+    %dot = stablehlo.dot_general %samples, %powers, contracting_dims = [1] x [0] : (tensor<500x3xf64>, tensor<3xf64>) -> tensor<500xf64>
+    %indices = stablehlo.convert %dot : (tensor<500xf64>) -> tensor<500xi64>
+    %indices2d = stablehlo.broadcast_in_dim %indices, dims = [0] : (tensor<500xi64>) -> tensor<500x1xi64>
+    %zeros = stablehlo.constant dense<0.0> : tensor<4xf64>
+    %ones = stablehlo.constant dense<1.0> : tensor<500xf64>
+    %counts = "stablehlo.scatter"(%zeros, %indices2d, %ones) ({
+    ^bb0(%lhs: tensor<f64>, %rhs: tensor<f64>):
+        %sum = stablehlo.add %lhs, %rhs : tensor<f64>
+        stablehlo.return %sum : tensor<f64>
+    }) {indices_are_sorted = false, scatter_dimension_numbers = #stablehlo.scatter<inserted_window_dims = [0], scatter_dims_to_operand_dims = [0], index_vector_dim = 1>, unique_indices = false} : (tensor<4xf64>, tensor<500x1xi64>, tensor<500xf64>) -> tensor<4xf64>
+    quantum.dealloc %r : !quantum.reg
+    return %counts : tensor<4xf64>
+}
+
+// -----
+
+// Histograms with weights that are not integers keep their scatter.
+
+// CHECK-LABEL: func.func @fractional_weights
+func.func @fractional_weights() -> tensor<4xi64> {
+    // CHECK-NOT: catalyst.custom_call
+    // CHECK: stablehlo.scatter
+    %r = quantum.alloc( 2) : !quantum.reg
+    %obs = quantum.compbasis qreg %r : !quantum.obs
+    %samples = quantum.sample %obs : tensor<100x2xf64>
+    %weights = stablehlo.constant dense<[1.5, 1.0]> : tensor<2xf64>
+    %dot = stablehlo.dot_general %samples, %weights, contracting_dims = [1] x [0] : (tensor<100x2xf64>, tensor<2xf64>) -> tensor<100xf64>
+    %indices = stablehlo.convert %dot : (tensor<100xf64>) -> tensor<100xi32>
+    %indices2d = stablehlo.reshape %indices : (tensor<100xi32>) -> tensor<100x1xi32>
+    %zeros = stablehlo.constant dense<0> : tensor<4xi64>
+    %ones = stablehlo.constant dense<1> : tensor<100xi64>
+    %counts = "stablehlo.scatter"(%zeros, %indices2d, %ones) ({
+    ^bb0(%lhs: tensor<i64>, %rhs: tensor<i64>):
+        %sum = stablehlo.add %lhs, %rhs : tensor<i64>
+        stablehlo.return %sum : tensor<i64>
+    }) {indices_are_sorted = false, scatter_dimension_numbers = #stablehlo.scatter<inserted_window_dims = [0], scatter_dims_to_operand_dims = [0], index_vector_dim = 1>, unique_indices = false} : (tensor<4xi64>, tensor<100x1xi32>, tensor<100xi64>) -> tensor<4xi64>
+    quantum.dealloc %r : !quantum.reg
+    return %counts : tensor<4xi64>
+}
+
+// -----
+
+// The sum of the parities of a slice of columns calls the parity sum kernel with the number of
+// shots and columns, and the first and last columns of the slice.
+
+// CHECK-LABEL: func.func @parity_expval
+func.func @parity_expval() -> tensor<f64> {
+    // CHECK: [[samples:%.+]] = quantum.sample
+    // CHECK-DAG: [[shots:%.+]] = arith.constant dense<1000> : tensor<i32>
+    // CHECK-DAG: [[columns:%.+]] = arith.constant dense<4> : tensor<i32>
+    // CHECK-DAG: [[first:%.+]] = arith.constant dense<1> : tensor<i32>
+    // CHECK-DAG: [[last:%.+]] = arith.constant dense<3> : tensor<i32>
+    // CHECK: [[sum:%.+]] = catalyst.custom_call fn("catalyst_sample_parity_sum_f64")([[shots]], [[columns]], [[first]], [[last]], [[samples]])
+    // CHECK-SAME: -> tensor<f64>
+    // CHECK-NOT: stablehlo.reduce
+    // CHECK: [[mean:%.+]] = stablehlo.divide [[sum]]
+    // CHECK: return [[mean]]
+    %r = quantum.alloc( 4) : !quantum.reg
+    %obs = quantum.compbasis qreg %r : !quantum.obs
+    %samples = quantum.sample %obs : tensor<1000x4xf64>
+    %slice = "stablehlo.slice"(%samples) <{start_indices = array<i64: 0, 1>, limit_indices = array<i64: 1000, 3>, strides = array<i64: 1, 1>}> : (tensor<1000x4xf64>) -> tensor<1000x2xf64>
+    %two = stablehlo.constant dense<2.0> : tensor<1000x2xf64>
+    %one = stablehlo.constant dense<1.0> : tensor<1000x2xf64>
+    %doubled = stablehlo.multiply %two, %slice : tensor<1000x2xf64>
+    %eigvals = stablehlo.subtract %one, %doubled : tensor<1000x2xf64>
+    %init_one = stablehlo.constant dense<1.0> : tensor<f64>
+    %parities = stablehlo.reduce(%eigvals init: %init_one) applies stablehlo.multiply across dimensions = [1] : (tensor<1000x2xf64>, tensor<f64>) -> tensor<1000xf64>
+    %init_zero = stablehlo.constant dense<0.0> : tensor<f64>
+    %sum = stablehlo.reduce(%parities init: %init_zero) applies stablehlo.add across dimensions = [0] : (tensor<1000xf64>, tensor<f64>) -> tensor<f64>
+    %shots = stablehlo.constant dense<1000.0> : tensor<f64>
+    %mean = stablehlo.divide %sum, %shots : tensor<f64>
+    quantum.dealloc %r : !quantum.reg
+    return %mean : tensor<f64>
+}
+
+// -----
+
+// The parities of the shots that are used otherwise call the parity kernel.
+
+// CHECK-LABEL: func.func @parities
+func.func @parities() -> tensor<200xf64> {
+    // CHECK: [[samples:%.+]] = quantum.sample
+    // CHECK-DAG: [[first:%.+]] = arith.constant dense<0> : tensor<i32>
+    // CHECK-DAG: [[last:%.+]] = arith.constant dense<2> : tensor<i32>
+    // CHECK: [[parities:%.+]] = catalyst.custom_call fn("catalyst_sample_parity_f64")({{%.+}}, {{%.+}}, [[first]], [[last]], [[samples]])
+    // CHECK-SAME: -> tensor<200xf64>
+    // CHECK: return [[parities]]
+    %r = quantum.alloc( 2) : !quantum.reg
+    %obs = quantum.compbasis qreg %r : !quantum.obs
+    %samples = quantum.sample %obs : tensor<200x2xf64>
+    %two = stablehlo.constant dense<2.0> : tensor<200x2xf64>
+    %one = stablehlo.constant dense<1.0> : tensor<200x2xf64>
+    %doubled = stablehlo.multiply %samples, %two : tensor<200x2xf64>
+    %eigvals = stablehlo.subtract %one, %doubled : tensor<200x2xf64>
+    %init_one = stablehlo.constant dense<1.0> : tensor<f64>
+    %parities = stablehlo.reduce(%eigvals init: %init_one) applies stablehlo.multiply across dimensions = [1] : (tensor<200x2xf64>, tensor<f64>) -> tensor<200xf64>
+    quantum.dealloc %r : !quantum.reg
+    return %parities : tensor<200xf64>
+}
+
+// -----
+
+// The samples of other observables than the computational basis are not bits.
+
+// CHECK-LABEL: func.func @named_observable
+func.func @named_observable() -> tensor<f64> {
+    // CHECK-NOT: catalyst.custom_call
+    // CHECK: stablehlo.reduce
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %obs = quantum.namedobs %q[PauliZ] : !quantum.obs
+    %samples = quantum.sample %obs : tensor<100xf64>
+    %init_zero = stablehlo.constant dense<0.0> : tensor<f64>
+    %sum = stablehlo.reduce(%samples init: %init_zero) applies stablehlo.add across dimensions = [0] : (tensor<100xf64>, tensor<f64>) -> tensor<f64>
+    quantum.dealloc %r : !quantum.reg
+    return %sum : tensor<f64>
+}
@@ -0,0 +1,195 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(specialize-qnode-constants)" --split-input-file --verify-diagnostics | FileCheck %s
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(specialize-qnode-constants{max-clones=1})" --split-input-file --verify-diagnostics | FileCheck %s --check-prefix=BUDGET
+
+// A qnode always called with the same constant angle is specialized in place, and the angle is
+// folded into its gates
+
+module @same_constant {
+  func.func private @circuit(%arg0: tensor<f64>, %arg1: tensor<f64>) -> tensor<f64> attributes {quantum.node} {
+    quantum.device ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %theta = tensor.extract %arg0[] : tensor<f64>
+    %q_1 = quantum.custom "RX"(%theta) %q_0 : !quantum.bit
+    %phi = tensor.extract %arg1[] : tensor<f64>
+    %q_2 = quantum.custom "RZ"(%phi) %q_1 : !quantum.bit
+    %obs = quantum.namedobs %q_2[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    %r_1 = quantum.insert %r[ 0], %q_2 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    %result = tensor.from_elements %expval : tensor<f64>
+    return %result : tensor<f64>
+  }
+
+  func.func public @main(%arg0: tensor<f64>) -> (tensor<f64>, tensor<f64>) {
+    %angle = stablehlo.constant dense<5.000000e-01> : tensor<f64>
+    %0 = func.call @circuit(%angle, %arg0) : (tensor<f64>, tensor<f64>) -> tensor<f64>
+    %1 = func.call @circuit(%angle, %arg0) : (tensor<f64>, tensor<f64>) -> tensor<f64>
+    return %0, %1 : tensor<f64>, tensor<f64>
+  }
+}
+
+// CHECK-LABEL: func.func private @circuit(%arg0: tensor<f64>) -> tensor<f64>
+// CHECK-DAG:     [[theta:%.+]] = arith.constant 5.000000e-01 : f64
+// CHECK:         quantum.custom "RX"([[theta]])
+// CHECK:         [[phi:%.+]] = tensor.extract %arg0[]
+// CHECK:         quantum.custom "RZ"([[phi]])
+// CHECK-LABEL: func.func public @main
+// CHECK:         call @circuit(%arg0) : (tensor<f64>) -> tensor<f64>
+// CHECK:         call @circuit(%arg0) : (tensor<f64>) -> tensor<f64>
+// CHECK-NOT:   func.func private @circuit_specialized
+
+// -----
+
+// Calls with different constants call specialized clones, within the budget, while calls without
+// constants keep calling the generic qnode
+
+module @different_constants {
+  func.func private @circuit(%arg0: f64) -> f64 attributes {quantum.node} {
+    quantum.device ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "RX"(%arg0) %q_0 : !quantum.bit
+    %obs = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func public @main(%arg0: f64) -> (f64, f64, f64, f64) {
+    %pi = arith.constant 3.1415926535897931 : f64
+    %half = arith.constant 5.000000e-01 : f64
+    %0 = func.call @circuit(%half) : (f64) -> f64
+    %1 = func.call @circuit(%pi) : (f64) -> f64
+    %2 = func.call @circuit(%pi) : (f64) -> f64
+    %3 = func.call @circuit(%arg0) : (f64) -> f64
+    return %0, %1, %2, %3 : f64, f64, f64, f64
+  }
+}
+
+// CHECK-LABEL: func.func private @circuit(%arg0: f64) -> f64
+// CHECK:         quantum.custom "RX"(%arg0)
+// CHECK-LABEL: func.func private @circuit_specialized_0() -> f64 attributes {quantum.node}
+// CHECK:         [[pi:%.+]] = arith.constant 3.1415926535897931 : f64
+// CHECK:         quantum.custom "RX"([[pi]])
+// CHECK-LABEL: func.func private @circuit_specialized_1() -> f64 attributes {quantum.node}
+// CHECK:         [[half:%.+]] = arith.constant 5.000000e-01 : f64
+// CHECK:         quantum.custom "RX"([[half]])
+// CHECK-LABEL: func.func public @main
+// CHECK:         call @circuit_specialized_1() : () -> f64
+// CHECK:         call @circuit_specialized_0() : () -> f64
+// CHECK:         call @circuit_specialized_0() : () -> f64
+// CHECK:         call @circuit(%arg0) : (f64) -> f64
+
+// BUDGET-LABEL: module @different_constants
+// BUDGET-NOT:     func.func private @circuit_specialized_1
+// BUDGET-LABEL: func.func public @main
+// BUDGET:         call @circuit(%{{.+}}) : (f64) -> f64
+// BUDGET:         call @circuit_specialized_0() : () -> f64
+// BUDGET:         call @circuit_specialized_0() : () -> f64
+// BUDGET:         call @circuit(%arg0) : (f64) -> f64
+
+// -----
+
+// Qnodes used by other operations than calls are not specialized
+
+module @other_use {
+  func.func private @circuit(%arg0: f64) -> f64 attributes {quantum.node} {
+    quantum.device ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %r = quantum.alloc( 1) : !quantum.reg
+    %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q_1 = quantum.custom "RX"(%arg0) %q_0 : !quantum.bit
+    %obs = quantum.namedobs %q_1[PauliZ] : !quantum.obs
+    %expval = quantum.expval %obs : f64
+    %r_1 = quantum.insert %r[ 0], %q_1 : !quantum.reg, !quantum.bit
+    quantum.dealloc %r_1 : !quantum.reg
+    quantum.device_release
+    return %expval : f64
+  }
+
+  func.func public @main() -> (f64, f64) {
+    %half = arith.constant 5.000000e-01 : f64
+    %0 = func.call @circuit(%half) : (f64) -> f64
+    %1 = gradient.grad "fd" @circuit(%half) : (f64) -> f64
+    return %0, %1 : f64, f64
+  }
+}
+
+// CHECK-LABEL: module @other_use
+// CHECK:         func.func private @circuit(%arg0: f64) -> f64
+// CHECK-NOT:     func.func private @circuit_specialized
+// CHECK:         call @circuit(%{{.+}}) : (f64) -> f64
+
+// -----
+
+// The qnodes of the nested modules of the frontend, launched as kernels, are specialized in their
+// module, so that its transform sequence acts on the clones too
+
+module @nested_module {
+  module @module_circuit {
+    module attributes {transform.with_named_sequence} {
+      transform.named_sequence @__transform_main(%arg0: !transform.op<"builtin.module">) {
+        transform.yield
+      }
+    }
+
+    func.func public @circuit(%arg0: tensor<f64>, %arg1: tensor<f64>) -> tensor<f64> attributes {quantum.node} {
+      quantum.device ["librtd_lightning.so", "LightningSimulator", "{}"]
+      %r = quantum.alloc( 1) : !quantum.reg
+      %q_0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+      %theta = tensor.extract %arg0[] : tensor<f64>
+      %q_1 = quantum.custom "RX"(%theta) %q_0 : !quantum.bit
+      %phi = tensor.extract %arg1[] : tensor<f64>
+      %q_2 = quantum.custom "RZ"(%phi) %q_1 : !quantum.bit
+      %obs = quantum.namedobs %q_2[PauliZ] : !quantum.obs
+      %expval = quantum.expval %obs : f64
+      %r_1 = quantum.insert %r[ 0], %q_2 : !quantum.reg, !quantum.bit
+      quantum.dealloc %r_1 : !quantum.reg
+      quantum.device_release
+      %result = tensor.from_elements %expval : tensor<f64>
+      return %result : tensor<f64>
+    }
+  }
+
+  func.func public @jit_main(%arg0: tensor<f64>) -> (tensor<f64>, tensor<f64>, tensor<f64>, tensor<f64>) {
+    %pi = stablehlo.constant dense<3.1415926535897931> : tensor<f64>
+    %half = stablehlo.constant dense<5.000000e-01> : tensor<f64>
+    %0 = catalyst.launch_kernel @module_circuit::@circuit(%half, %arg0) : (tensor<f64>, tensor<f64>) -> tensor<f64>
+    %1 = catalyst.launch_kernel @module_circuit::@circuit(%pi, %arg0) : (tensor<f64>, tensor<f64>) -> tensor<f64>
+    %2 = catalyst.launch_kernel @module_circuit::@circuit(%pi, %arg0) : (tensor<f64>, tensor<f64>) -> tensor<f64>
+    %3 = catalyst.launch_kernel @module_circuit::@circuit(%arg0, %arg0) : (tensor<f64>, tensor<f64>) -> tensor<f64>
+    return %0, %1, %2, %3 : tensor<f64>, tensor<f64>, tensor<f64>, tensor<f64>
+  }
+}
+
+// CHECK-LABEL: module @module_circuit
+// CHECK:         transform.named_sequence @__transform_main
+// CHECK:         func.func public @circuit(%arg0: tensor<f64>, %arg1: tensor<f64>) -> tensor<f64>
+// CHECK:         func.func public @circuit_specialized_0(%arg0: tensor<f64>) -> tensor<f64> attributes {quantum.node}
+// CHECK-DAG:       [[pi:%.+]] = arith.constant 3.1415926535897931 : f64
+// CHECK:           quantum.custom "RX"([[pi]])
+// CHECK:         func.func public @circuit_specialized_1(%arg0: tensor<f64>) -> tensor<f64> attributes {quantum.node}
+// CHECK-DAG:       [[half:%.+]] = arith.constant 5.000000e-01 : f64
+// CHECK:           quantum.custom "RX"([[half]])
+// CHECK-LABEL: func.func public @jit_main
+// CHECK:         catalyst.launch_kernel @module_circuit::@circuit_specialized_1(%arg0) : (tensor<f64>) -> tensor<f64>
+// CHECK:         catalyst.launch_kernel @module_circuit::@circuit_specialized_0(%arg0) : (tensor<f64>) -> tensor<f64>
+// CHECK:         catalyst.launch_kernel @module_circuit::@circuit_specialized_0(%arg0) : (tensor<f64>) -> tensor<f64>
+// CHECK:         catalyst.launch_kernel @module_circuit::@circuit(%arg0, %arg0) : (tensor<f64>, tensor<f64>) -> tensor<f64>
@@ -0,0 +1,97 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(split-multiple-tapes{share-device=true})" --split-input-file --verify-diagnostics | FileCheck %s
+
+// Consecutive tapes on the same device share a single device initialization, while a tape on
+// another device is still split into its own function
+
+module @circuit_threetapes_module {
+  func.func private @circuit_threetapes(%arg0: tensor<f64>) -> tensor<f64> attributes {quantum.node} {
+    %shots = arith.constant 100 : i64
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %qreg_t0 = quantum.alloc( 1) : !quantum.reg
+    %obs_t0 = quantum.compbasis qreg %qreg_t0 : !quantum.obs
+    %sample_t0 = quantum.sample %obs_t0 : tensor<100x1xf64>
+    quantum.dealloc %qreg_t0 : !quantum.reg
+    quantum.device_release
+    %shots_1 = arith.constant 100 : i64
+    quantum.device shots(%shots_1) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %tape1_out = stablehlo.multiply %arg0, %arg0 : tensor<f64>
+    %qreg_t1 = quantum.alloc( 1) : !quantum.reg
+    %obs_t1 = quantum.compbasis qreg %qreg_t1 : !quantum.obs
+    %sample_t1 = quantum.sample %obs_t1 : tensor<100x1xf64>
+    quantum.dealloc %qreg_t1 : !quantum.reg
+    quantum.device_release
+    quantum.device shots(%shots) ["librtd_null_qubit.so", "NullQubit", "{}"]
+    %tape2_out = stablehlo.add %arg0, %arg0 : tensor<f64>
+    %qreg_t2 = quantum.alloc( 1) : !quantum.reg
+    %obs_t2 = quantum.compbasis qreg %qreg_t2 : !quantum.obs
+    %sample_t2 = quantum.sample %obs_t2 : tensor<100x1xf64>
+    quantum.dealloc %qreg_t2 : !quantum.reg
+    quantum.device_release
+    %result = stablehlo.subtract %tape1_out, %tape2_out : tensor<f64>
+    return %result : tensor<f64>
+  }
+}
+
+// CHECK: func.func private @circuit_threetapes
+// CHECK: func.call @circuit_threetapes_tape_0
+// CHECK: func.call @circuit_threetapes_tape_1
+// CHECK-NOT: func.call @circuit_threetapes_tape_2
+
+// CHECK: func.func private @circuit_threetapes_tape_0
+// CHECK: quantum.device shots({{%.+}}) ["librtd_lightning.so", "LightningSimulator", "{}"]
+// CHECK: quantum.dealloc
+// CHECK-NOT: quantum.device
+// CHECK: stablehlo.multiply
+// CHECK: quantum.alloc
+// CHECK: quantum.dealloc
+// CHECK-NEXT: quantum.device_release
+// CHECK: return
+
+// CHECK: func.func private @circuit_threetapes_tape_1
+// CHECK: quantum.device shots({{%.+}}) ["librtd_null_qubit.so", "NullQubit", "{}"]
+// CHECK: stablehlo.add
+// CHECK: quantum.device_release
+// CHECK: return
+
+// -----
+
+// Tapes on the same device with different shots are not merged
+
+module @circuit_shots_module {
+  func.func private @circuit_shots() -> tensor<f64> attributes {quantum.node} {
+    %shots = arith.constant 100 : i64
+    %shots_1 = arith.constant 200 : i64
+    quantum.device shots(%shots) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %qreg_t0 = quantum.alloc( 1) : !quantum.reg
+    %obs_t0 = quantum.compbasis qreg %qreg_t0 : !quantum.obs
+    %sample_t0 = quantum.sample %obs_t0 : tensor<100x1xf64>
+    quantum.dealloc %qreg_t0 : !quantum.reg
+    quantum.device_release
+    quantum.device shots(%shots_1) ["librtd_lightning.so", "LightningSimulator", "{}"]
+    %qreg_t1 = quantum.alloc( 1) : !quantum.reg
+    %obs_t1 = quantum.compbasis qreg %qreg_t1 : !quantum.obs
+    %sample_t1 = quantum.sample %obs_t1 : tensor<200x1xf64>
+    quantum.dealloc %qreg_t1 : !quantum.reg
+    quantum.device_release
+    %result = stablehlo.constant dense<0.000000e+00> : tensor<f64>
+    return %result : tensor<f64>
+  }
+}
+
+// CHECK: func.func private @circuit_shots
+// CHECK: func.call @circuit_shots_tape_0
+// CHECK: func.call @circuit_shots_tape_1
@@ -0,0 +1,111 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --split-non-commuting="grouping-strategy=qwc" --split-input-file --verify-diagnostics | FileCheck %s
+
+// Test qubit-wise commuting observables
+// X(0), Y(1) and X(0)@Y(1) commute qubit-wise, while Z(0) only commutes qubit-wise with Y(1).
+// Z(0) conflicts with the most observables and is coloured first -> group 0, with Y(1)
+// X(0) and X(0)@Y(1) -> group 1
+
+// CHECK-LABEL: func.func public @circ_qwc
+// CHECK-SAME: () -> (f64, f64, f64, f64)
+// CHECK-NOT: quantum.node
+// CHECK: %[[CALL0:.*]]:2 = call @circ_qwc.group.0
+// CHECK: %[[CALL1:.*]]:2 = call @circ_qwc.group.1
+// CHECK: return %[[CALL1]]#0, %[[CALL0]]#0, %[[CALL0]]#1, %[[CALL1]]#1
+
+// CHECK-LABEL: func.func private @circ_qwc.group.0
+// CHECK-SAME: () -> (f64, f64) attributes {quantum.node}
+// CHECK: %[[Q0:.*]] = quantum.extract %{{.*}}[ 0]
+// CHECK: %[[Q1:.*]] = quantum.extract %{{.*}}[ 1]
+// CHECK: %[[Z1:.*]] = quantum.custom "PauliZ"() %[[Q1]]
+// CHECK: %[[S1:.*]] = quantum.custom "S"() %[[Z1]]
+// CHECK: %[[R1:.*]] = quantum.custom "Hadamard"() %[[S1]]
+// CHECK: %[[OBS_Y1:.*]] = quantum.namedobs %[[R1]][ PauliZ]
+// CHECK: %[[OBS_Z0:.*]] = quantum.namedobs %[[Q0]][ PauliZ]
+// CHECK: %[[EV1:.*]] = quantum.expval %[[OBS_Y1]]
+// CHECK: %[[EV2:.*]] = quantum.expval %[[OBS_Z0]]
+// CHECK: return %[[EV1]], %[[EV2]]
+
+// CHECK-LABEL: func.func private @circ_qwc.group.1
+// CHECK-SAME: () -> (f64, f64) attributes {quantum.node}
+// CHECK: %[[Q0:.*]] = quantum.extract %{{.*}}[ 0]
+// CHECK: %[[R0:.*]] = quantum.custom "Hadamard"() %[[Q0]]
+// CHECK: %[[Q1:.*]] = quantum.extract %{{.*}}[ 1]
+// CHECK: %[[Z1:.*]] = quantum.custom "PauliZ"() %[[Q1]]
+// CHECK: %[[S1:.*]] = quantum.custom "S"() %[[Z1]]
+// CHECK: %[[R1:.*]] = quantum.custom "Hadamard"() %[[S1]]
+// CHECK: %[[OBS_X0:.*]] = quantum.namedobs %[[R0]][ PauliZ]
+// CHECK: %[[OBS_TX0:.*]] = quantum.namedobs %[[R0]][ PauliZ]
+// CHECK: %[[OBS_TY1:.*]] = quantum.namedobs %[[R1]][ PauliZ]
+// CHECK: %[[TENSOR:.*]] = quantum.tensor %[[OBS_TX0]], %[[OBS_TY1]]
+// CHECK: %[[EV0:.*]] = quantum.expval %[[OBS_X0]]
+// CHECK: %[[EV3:.*]] = quantum.expval %[[TENSOR]]
+// CHECK: return %[[EV0]], %[[EV3]]
+
+module {
+  func.func public @circ_qwc() -> (f64, f64, f64, f64) attributes {quantum.node} {
+    %shots = arith.constant 100 : i64
+    quantum.device shots(%shots) ["", "", ""]
+    %reg = quantum.alloc(2) : !quantum.reg
+    %q0 = quantum.extract %reg[0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %reg[1] : !quantum.reg -> !quantum.bit
+    %obs_x0 = quantum.namedobs %q0[PauliX] : !quantum.obs
+    %obs_y1 = quantum.namedobs %q1[PauliY] : !quantum.obs
+    %obs_z0 = quantum.namedobs %q0[PauliZ] : !quantum.obs
+    %obs_tx0 = quantum.namedobs %q0[PauliX] : !quantum.obs
+    %obs_ty1 = quantum.namedobs %q1[PauliY] : !quantum.obs
+    %tensor_obs = quantum.tensor %obs_tx0, %obs_ty1 : !quantum.obs
+    %expval_x0 = quantum.expval %obs_x0 : f64
+    %expval_y1 = quantum.expval %obs_y1 : f64
+    %expval_z0 = quantum.expval %obs_z0 : f64
+    %expval_xy = quantum.expval %tensor_obs : f64
+    quantum.dealloc %reg : !quantum.reg
+    quantum.device_release
+    return %expval_x0, %expval_y1, %expval_z0, %expval_xy : f64, f64, f64, f64
+  }
+}
+
+// -----
+
+// Test the rotation of a Hadamard observable
+// H(0) and X(0) do not commute qubit-wise -> one group each
+
+// CHECK-LABEL: func.func private @circ_hadamard.group.0
+// CHECK: %[[Q0:.*]] = quantum.extract %{{.*}}[ 0]
+// CHECK: %[[ANGLE:.*]] = arith.constant -0.78539816339744{{[0-9]*}} : f64
+// CHECK: %[[R0:.*]] = quantum.custom "RY"(%[[ANGLE]]) %[[Q0]]
+// CHECK: quantum.namedobs %[[R0]][ PauliZ]
+
+// CHECK-LABEL: func.func private @circ_hadamard.group.1
+// CHECK: %[[Q0:.*]] = quantum.extract %{{.*}}[ 0]
+// CHECK: %[[R0:.*]] = quantum.custom "Hadamard"() %[[Q0]]
+// CHECK: quantum.namedobs %[[R0]][ PauliZ]
+
+module {
+  func.func public @circ_hadamard() -> (f64, f64) attributes {quantum.node} {
+    %shots = arith.constant 100 : i64
+    quantum.device shots(%shots) ["", "", ""]
+    %reg = quantum.alloc(1) : !quantum.reg
+    %q0 = quantum.extract %reg[0] : !quantum.reg -> !quantum.bit
+    %obs_h0 = quantum.namedobs %q0[Hadamard] : !quantum.obs
+    %obs_x0 = quantum.namedobs %q0[PauliX] : !quantum.obs
+    %expval_h0 = quantum.expval %obs_h0 : f64
+    %expval_x0 = quantum.expval %obs_x0 : f64
+    quantum.dealloc %reg : !quantum.reg
+    quantum.device_release
+    return %expval_h0, %expval_x0 : f64, f64
+  }
+}
@@ -0,0 +1,83 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --split-non-commuting="shot-distribution=coefficients" --split-input-file --verify-diagnostics | FileCheck %s
+
+// Test shots distributed in proportion to the coefficients of the Hamiltonian terms
+// expval(Z(0) + X(1) + 2*Y(2)) -> 25, 25 and 50 of the 100 shots
+
+// CHECK-LABEL: func.func private @circ.single_terms.group.0
+// CHECK: %[[SHOTS0:.*]] = arith.constant 25
+// CHECK: quantum.device shots(%[[SHOTS0]])
+// CHECK: quantum.namedobs %{{.*}}[ PauliZ]
+
+// CHECK-LABEL: func.func private @circ.single_terms.group.1
+// CHECK: %[[SHOTS1:.*]] = arith.constant 25
+// CHECK: quantum.device shots(%[[SHOTS1]])
+// CHECK: quantum.namedobs %{{.*}}[ PauliX]
+
+// CHECK-LABEL: func.func private @circ.single_terms.group.2
+// CHECK: %[[SHOTS2:.*]] = arith.constant 50
+// CHECK: quantum.device shots(%[[SHOTS2]])
+// CHECK: quantum.namedobs %{{.*}}[ PauliY]
+
+module {
+  func.func public @circ() -> tensor<f64> attributes {quantum.node} {
+    %shots = arith.constant 100 : i64
+    quantum.device shots(%shots) ["", "", ""]
+    %reg = quantum.alloc(3) : !quantum.reg
+    %q0 = quantum.extract %reg[0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %reg[1] : !quantum.reg -> !quantum.bit
+    %q2 = quantum.extract %reg[2] : !quantum.reg -> !quantum.bit
+    %obs_z0 = quantum.namedobs %q0[PauliZ] : !quantum.obs
+    %obs_x1 = quantum.namedobs %q1[PauliX] : !quantum.obs
+    %obs_y2 = quantum.namedobs %q2[PauliY] : !quantum.obs
+    %coeffs = stablehlo.constant dense<[1.000000e+00, 1.000000e+00, 2.000000e+00]> : tensor<3xf64>
+    %ham = quantum.hamiltonian(%coeffs : tensor<3xf64>) %obs_z0, %obs_x1, %obs_y2 : !quantum.obs
+    %expval_h = quantum.expval %ham : f64
+    %result = tensor.from_elements %expval_h : tensor<f64>
+    quantum.dealloc %reg : !quantum.reg
+    quantum.device_release
+    return %result : tensor<f64>
+  }
+}
+
+// -----
+
+// Test dynamic shots, which are scaled at runtime
+
+// CHECK-LABEL: func.func private @circ_dynamic.single_terms.group.1
+// CHECK: %[[SHARE:.*]] = arith.constant 7.500000e-01 : f64
+// CHECK: %[[SHOTS_F64:.*]] = arith.sitofp %arg0 : i64 to f64
+// CHECK: %[[SCALED:.*]] = arith.mulf %[[SHOTS_F64]], %[[SHARE]]
+// CHECK: %[[SCALED_SHOTS:.*]] = arith.fptosi %[[SCALED]] : f64 to i64
+// CHECK: %[[SHOTS:.*]] = arith.maxsi %[[SCALED_SHOTS]]
+// CHECK: quantum.device shots(%[[SHOTS]])
+
+module {
+  func.func public @circ_dynamic(%shots: i64) -> tensor<f64> attributes {quantum.node} {
+    quantum.device shots(%shots) ["", "", ""]
+    %reg = quantum.alloc(1) : !quantum.reg
+    %q0 = quantum.extract %reg[0] : !quantum.reg -> !quantum.bit
+    %obs_z0 = quantum.namedobs %q0[PauliZ] : !quantum.obs
+    %obs_x0 = quantum.namedobs %q0[PauliX] : !quantum.obs
+    %coeffs = stablehlo.constant dense<[1.000000e+00, -3.000000e+00]> : tensor<2xf64>
+    %ham = quantum.hamiltonian(%coeffs : tensor<2xf64>) %obs_z0, %obs_x0 : !quantum.obs
+    %expval_h = quantum.expval %ham : f64
+    %result = tensor.from_elements %expval_h : tensor<f64>
+    quantum.dealloc %reg : !quantum.reg
+    quantum.device_release
+    return %result : tensor<f64>
+  }
+}
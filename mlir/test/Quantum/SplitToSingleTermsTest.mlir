@@ -160,3 +160,34 @@ module {
     return %result : tensor<f64>
   }
 }
+
+// -----
+
+// Test the weights recorded on the expvals of terms with constant coefficients
+// H = 0.5 * (-2.0 * Z(0) + X(1)) + 3.0 * Identity
+
+// CHECK-LABEL: func.func public @circ_weights.single_terms
+// CHECK: quantum.expval %{{.*}} {term_weight = 1.000000e+00 : f64}
+// CHECK: quantum.expval %{{.*}} {term_weight = 5.000000e-01 : f64}
+// CHECK-NOT: quantum.expval
+
+module {
+  func.func public @circ_weights() -> tensor<f64> attributes {quantum.node} {
+    quantum.device ["", "", ""]
+    %reg = quantum.alloc(2) : !quantum.reg
+    %q0 = quantum.extract %reg[0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %reg[1] : !quantum.reg -> !quantum.bit
+    %obs_z0 = quantum.namedobs %q0[PauliZ] : !quantum.obs
+    %obs_x1 = quantum.namedobs %q1[PauliX] : !quantum.obs
+    %identity = quantum.namedobs %q1[Identity] : !quantum.obs
+    %inner_coeffs = stablehlo.constant dense<[-2.000000e+00, 1.000000e+00]> : tensor<2xf64>
+    %inner = quantum.hamiltonian(%inner_coeffs : tensor<2xf64>) %obs_z0, %obs_x1 : !quantum.obs
+    %coeffs = stablehlo.constant dense<[5.000000e-01, 3.000000e+00]> : tensor<2xf64>
+    %ham = quantum.hamiltonian(%coeffs : tensor<2xf64>) %inner, %identity : !quantum.obs
+    %expval_h = quantum.expval %ham : f64
+    %result = tensor.from_elements %expval_h : tensor<f64>
+    quantum.dealloc %reg : !quantum.reg
+    quantum.device_release
+    return %result : tensor<f64>
+  }
+}
@@ -0,0 +1,147 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --two-qubit-synthesis --split-input-file -verify-diagnostics %s | FileCheck %s
+
+// A block equal to the identity is removed.
+
+// CHECK-LABEL: func @identity_block(
+// CHECK-SAME: [[q0:%.+]]: !quantum.bit, [[q1:%.+]]: !quantum.bit)
+func.func @identity_block(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    // CHECK-NOT: quantum.custom
+    // CHECK-NOT: quantum.gphase
+    // CHECK: return [[q0]], [[q1]]
+    %0:2 = quantum.custom "CNOT"() %q0, %q1 : !quantum.bit, !quantum.bit
+    %1 = quantum.custom "Hadamard"() %0#1 : !quantum.bit
+    %2:2 = quantum.custom "CZ"() %0#0, %1 : !quantum.bit, !quantum.bit
+    %3 = quantum.custom "Hadamard"() %2#1 : !quantum.bit
+    %4:2 = quantum.custom "CNOT"() %2#0, %3 : !quantum.bit, !quantum.bit
+    %5:2 = quantum.custom "CNOT"() %4#0, %4#1 : !quantum.bit, !quantum.bit
+    func.return %5#0, %5#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Two ZZ rotations built from four CNOTs are merged into a single one with two CNOTs.
+
+// CHECK-LABEL: func @merge_zz_rotations(
+// CHECK-SAME: [[q0:%.+]]: !quantum.bit, [[q1:%.+]]: !quantum.bit)
+func.func @merge_zz_rotations(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    %phi = arith.constant 3.000000e-01 : f64
+    %theta = arith.constant 5.000000e-01 : f64
+
+    // CHECK: [[a:%.+]]:2 = quantum.custom "CNOT"() [[q0]], [[q1]]
+    // CHECK: [[b:%.+]] = quantum.custom "RZ"({{%.+}}) [[a]]#1
+    // CHECK: [[c:%.+]]:2 = quantum.custom "CNOT"() [[a]]#0, [[b]]
+    // CHECK-NOT: quantum.custom
+    // CHECK: return [[c]]#0, [[c]]#1
+    %0:2 = quantum.custom "CNOT"() %q0, %q1 : !quantum.bit, !quantum.bit
+    %1 = quantum.custom "RZ"(%phi) %0#1 : !quantum.bit
+    %2:2 = quantum.custom "CNOT"() %0#0, %1 : !quantum.bit, !quantum.bit
+    %3:2 = quantum.custom "CNOT"() %2#0, %2#1 : !quantum.bit, !quantum.bit
+    %4 = quantum.custom "RZ"(%theta) %3#1 : !quantum.bit
+    %5:2 = quantum.custom "CNOT"() %3#0, %4 : !quantum.bit, !quantum.bit
+    func.return %5#0, %5#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Gates on swapped wires and single-qubit gates before the first two-qubit gate are part of the
+// block. The block below is a SWAP followed by a CNOT, which needs two CNOTs instead of four.
+
+// CHECK-LABEL: func @swapped_wires(
+func.func @swapped_wires(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    // CHECK-COUNT-2: quantum.custom "CNOT"
+    // CHECK-NOT: quantum.custom "CNOT"
+    // CHECK-NOT: quantum.custom "SWAP"
+    // CHECK: return
+    %0 = quantum.custom "PauliX"() %q0 : !quantum.bit
+    %1 = quantum.custom "PauliX"() %0 : !quantum.bit
+    %2:2 = quantum.custom "SWAP"() %1, %q1 : !quantum.bit, !quantum.bit
+    %3:2 = quantum.custom "CNOT"() %2#1, %2#0 : !quantum.bit, !quantum.bit
+    func.return %3#1, %3#0 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Blocks are only replaced when the cost goes down: three alternating CNOTs already implement a
+// SWAP optimally.
+
+// CHECK-LABEL: func @optimal_block(
+func.func @optimal_block(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    // CHECK: quantum.custom "CNOT"
+    // CHECK: quantum.custom "CNOT"
+    // CHECK: quantum.custom "CNOT"
+    // CHECK-NOT: quantum.custom
+    %0:2 = quantum.custom "CNOT"() %q0, %q1 : !quantum.bit, !quantum.bit
+    %1:2 = quantum.custom "CNOT"() %0#1, %0#0 : !quantum.bit, !quantum.bit
+    %2:2 = quantum.custom "CNOT"() %1#1, %1#0 : !quantum.bit, !quantum.bit
+    func.return %2#0, %2#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Gates with dynamic parameters or controls end a block.
+
+// CHECK-LABEL: func @dynamic_parameter(
+func.func @dynamic_parameter(%q0: !quantum.bit, %q1: !quantum.bit, %phi: f64) -> (!quantum.bit, !quantum.bit) {
+    // CHECK: quantum.custom "CNOT"
+    // CHECK: quantum.custom "RZ"
+    // CHECK: quantum.custom "CNOT"
+    %0:2 = quantum.custom "CNOT"() %q0, %q1 : !quantum.bit, !quantum.bit
+    %1 = quantum.custom "RZ"(%phi) %0#1 : !quantum.bit
+    %2:2 = quantum.custom "CNOT"() %0#0, %1 : !quantum.bit, !quantum.bit
+    func.return %2#0, %2#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Unitaries with a constant matrix are synthesized into rotations and CNOTs, and the result is
+// merged with the surrounding gates.
+
+// CHECK-LABEL: func @constant_unitaries(
+// CHECK-SAME: [[q0:%.+]]: !quantum.bit, [[q1:%.+]]: !quantum.bit)
+func.func @constant_unitaries(%q0: !quantum.bit, %q1: !quantum.bit) -> (!quantum.bit, !quantum.bit) {
+    %cnot = arith.constant dense<[[(1.0, 0.0), (0.0, 0.0), (0.0, 0.0), (0.0, 0.0)],
+                                  [(0.0, 0.0), (1.0, 0.0), (0.0, 0.0), (0.0, 0.0)],
+                                  [(0.0, 0.0), (0.0, 0.0), (0.0, 0.0), (1.0, 0.0)],
+                                  [(0.0, 0.0), (0.0, 0.0), (1.0, 0.0), (0.0, 0.0)]]> : tensor<4x4xcomplex<f64>>
+    %x = arith.constant dense<[[(0.0, 0.0), (1.0, 0.0)], [(1.0, 0.0), (0.0, 0.0)]]> : tensor<2x2xcomplex<f64>>
+
+    // CHECK-NOT: quantum.unitary
+    // CHECK: [[a:%.+]]:2 = quantum.custom "CNOT"() [[q0]], [[q1]]
+    // CHECK-NOT: quantum.custom "CNOT"
+    // CHECK-NOT: quantum.unitary
+    // CHECK: return
+    %0 = quantum.unitary(%x : tensor<2x2xcomplex<f64>>) %q1 : !quantum.bit
+    %1:2 = quantum.unitary(%cnot : tensor<4x4xcomplex<f64>>) %q0, %0 : !quantum.bit, !quantum.bit
+    %2 = quantum.unitary(%x : tensor<2x2xcomplex<f64>>) %1#1 : !quantum.bit
+    func.return %1#0, %2 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Unitaries with a dynamic matrix or with controls are kept.
+
+// CHECK-LABEL: func @dynamic_unitary(
+func.func @dynamic_unitary(%q0: !quantum.bit, %q1: !quantum.bit, %m: tensor<2x2xcomplex<f64>>) -> (!quantum.bit, !quantum.bit) {
+    %true = arith.constant true
+    %x = arith.constant dense<[[(0.0, 0.0), (1.0, 0.0)], [(1.0, 0.0), (0.0, 0.0)]]> : tensor<2x2xcomplex<f64>>
+
+    // CHECK: quantum.unitary
+    // CHECK: quantum.unitary
+    %0 = quantum.unitary(%m : tensor<2x2xcomplex<f64>>) %q0 : !quantum.bit
+    %1, %2 = quantum.unitary(%x : tensor<2x2xcomplex<f64>>) %0 ctrls(%q1) ctrlvals(%true) : !quantum.bit ctrls !quantum.bit
+    func.return %1, %2 : !quantum.bit, !quantum.bit
+}
@@ -0,0 +1,90 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt --unroll-quantum-loops --split-input-file -verify-diagnostics %s | FileCheck %s
+// RUN: quantum-opt --unroll-quantum-loops="min-gate-reduction=0.9" --split-input-file -verify-diagnostics %s | FileCheck %s --check-prefix=REDUCTION
+
+// The basis changes and entangling gates of consecutive Trotter steps cancel, and their rotations
+// merge, so that the 15 gates of the loop reduce to 5 once unrolled.
+
+// CHECK-LABEL: func @trotter_steps(
+// REDUCTION-LABEL: func @trotter_steps(
+func.func @trotter_steps(%q0: !quantum.bit, %q1: !quantum.bit, %theta: f64) -> (!quantum.bit, !quantum.bit) {
+    %start = arith.constant 0 : index
+    %stop = arith.constant 3 : index
+    %step = arith.constant 1 : index
+
+    // CHECK-NOT: scf.for
+    // CHECK-COUNT-6: quantum.custom "Hadamard"
+    // CHECK-NOT: scf.for
+    // CHECK: return
+
+    // REDUCTION: scf.for
+    // REDUCTION-COUNT-2: quantum.custom "Hadamard"
+    // REDUCTION-NOT: quantum.custom "Hadamard"
+    // REDUCTION: scf.yield
+    %qq:2 = scf.for %i = %start to %stop step %step iter_args(%a = %q0, %b = %q1) -> (!quantum.bit, !quantum.bit) {
+        %a_1 = quantum.custom "Hadamard"() %a : !quantum.bit
+        %c:2 = quantum.custom "CNOT"() %a_1, %b : !quantum.bit, !quantum.bit
+        %b_1 = quantum.custom "RZ"(%theta) %c#1 : !quantum.bit
+        %d:2 = quantum.custom "CNOT"() %c#0, %b_1 : !quantum.bit, !quantum.bit
+        %a_2 = quantum.custom "Hadamard"() %d#0 : !quantum.bit
+        scf.yield %a_2, %d#1 : !quantum.bit, !quantum.bit
+    }
+    func.return %qq#0, %qq#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Loops whose gates don't cancel or merge across iterations stay rolled.
+
+// CHECK-LABEL: func @no_cancellation(
+func.func @no_cancellation(%q0: !quantum.bit, %q1: !quantum.bit, %theta: f64) -> (!quantum.bit, !quantum.bit) {
+    %start = arith.constant 0 : index
+    %stop = arith.constant 4 : index
+    %step = arith.constant 1 : index
+
+    // CHECK: scf.for
+    // CHECK-COUNT-1: quantum.custom "RX"
+    // CHECK-NOT: quantum.custom "RX"
+    // CHECK: scf.yield
+    %qq:2 = scf.for %i = %start to %stop step %step iter_args(%a = %q0, %b = %q1) -> (!quantum.bit, !quantum.bit) {
+        %a_1 = quantum.custom "RX"(%theta) %a : !quantum.bit
+        %c:2 = quantum.custom "CNOT"() %a_1, %b : !quantum.bit, !quantum.bit
+        scf.yield %c#0, %c#1 : !quantum.bit, !quantum.bit
+    }
+    func.return %qq#0, %qq#1 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// Loops with more iterations than max-trip-count stay rolled.
+
+// CHECK-LABEL: func @long_loop(
+func.func @long_loop(%q0: !quantum.bit, %theta: f64) -> !quantum.bit {
+    %start = arith.constant 0 : index
+    %stop = arith.constant 100 : index
+    %step = arith.constant 1 : index
+
+    // CHECK: scf.for
+    // CHECK-COUNT-2: quantum.custom "Hadamard"
+    // CHECK: scf.yield
+    %qq = scf.for %i = %start to %stop step %step iter_args(%a = %q0) -> (!quantum.bit) {
+        %a_1 = quantum.custom "Hadamard"() %a : !quantum.bit
+        %a_2 = quantum.custom "RZ"(%theta) %a_1 : !quantum.bit
+        %a_3 = quantum.custom "Hadamard"() %a_2 : !quantum.bit
+        scf.yield %a_3 : !quantum.bit
+    }
+    func.return %qq : !quantum.bit
+}
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 // RUN: quantum-opt %s --convert-rtio-event-to-artiq --split-input-file | FileCheck %s
+// RUN: quantum-opt %s --convert-rtio-event-to-artiq="dma-min-pulses=3" --split-input-file | FileCheck %s --check-prefix=DMA
+// RUN: quantum-opt %s --convert-rtio-event-to-artiq="coalesce-rpcs=true" --split-input-file | FileCheck %s --check-prefix=RPC
 
 // CHECK: llvm.func @now_mu() -> i64
 // CHECK: llvm.func @at_mu(i64)
@@ -178,6 +180,30 @@ module @rpc_async_with_args attributes {rtio.config = #rtio.config<{core_addr =
 
 // -----
 
+// Runs of async RPCs are sent to the host as a single RPC of the batch dispatcher, with the
+// service ID and the number of arguments of each RPC before its arguments
+// RPC-LABEL: module @rpc_coalesce
+// RPC-DAG: llvm.mlir.global private constant @__rtio_str_iiIIfiiI_n
+module @rpc_coalesce attributes {rtio.config = #rtio.config<{core_addr = "172.31.9.64", device_db = {core = {arguments = {host = "172.31.9.64", ref_period = 1.000000e-09 : f64, target = "cortexa9"}, class = "Core", module = "artiq.coredevice.core", type = "local"}, spi_urukul0 = {arguments = {channel = 17 : i64}, class = "SPIMaster", module = "artiq.coredevice.spi2", type = "local"}, ttl_urukul0_io_update = {arguments = {channel = 18 : i64}, class = "TTLOut", module = "artiq.coredevice.ttl", type = "local"}, ttl_urukul0_sw0 = {arguments = {channel = 19 : i64}, class = "TTLOut", module = "artiq.coredevice.ttl", type = "local"}, urukul0_ch0 = {arguments = {chip_select = 4 : i64, cpld_device = "urukul0_cpld", pll_en = 1 : i64, pll_n = 32 : i64, sw_device = "ttl_urukul0_sw0"}, class = "AD9910", module = "artiq.coredevice.ad9910", type = "local"}, urukul0_cpld = {arguments = {clk_div = 0 : i64, clk_sel = 2 : i64, io_update_device = "ttl_urukul0_io_update", refclk = 125000000 : i64, spi_device = "spi_urukul0", sync_device}, class = "CPLD", module = "artiq.coredevice.urukul", type = "local"}}}>} {
+  // RPC-LABEL: func.func @__kernel__
+  func.func @__kernel__(%key: i64, %idx: i64, %val: f64) {
+    // RPC: [[batch:%.+]] = arith.constant 4 : i32
+    // RPC: llvm.call @rpc_send_async([[batch]], {{.*}}) : (i32, !llvm.ptr, !llvm.ptr) -> ()
+    // RPC-NOT: llvm.call @rpc_send_async
+    // RPC: llvm.call @rpc_send({{.*}}) : (i32, !llvm.ptr, !llvm.ptr) -> ()
+    // RPC: [[single:%.+]] = arith.constant 2 : i32
+    // RPC: llvm.call @rpc_send_async([[single]], {{.*}}) : (i32, !llvm.ptr, !llvm.ptr) -> ()
+    rtio.rpc @transfer_data async (%key, %idx, %val : i64, i64, f64)
+    %sum = arith.addi %key, %idx : i64
+    rtio.rpc @send_data async (%sum : i64)
+    rtio.rpc @program_awg
+    rtio.rpc @send_data async (%sum : i64)
+    return
+  }
+}
+
+// -----
+
 // ID deduplication: set_dataset called twice gets the same rpc_id.
 module @rpc_id_deduplication attributes {rtio.config = #rtio.config<{core_addr = "172.31.9.64", device_db = {core = {arguments = {host = "172.31.9.64", ref_period = 1.000000e-09 : f64, target = "cortexa9"}, class = "Core", module = "artiq.coredevice.core", type = "local"}, spi_urukul0 = {arguments = {channel = 17 : i64}, class = "SPIMaster", module = "artiq.coredevice.spi2", type = "local"}, ttl_urukul0_io_update = {arguments = {channel = 18 : i64}, class = "TTLOut", module = "artiq.coredevice.ttl", type = "local"}, ttl_urukul0_sw0 = {arguments = {channel = 19 : i64}, class = "TTLOut", module = "artiq.coredevice.ttl", type = "local"}, urukul0_ch0 = {arguments = {chip_select = 4 : i64, cpld_device = "urukul0_cpld", pll_en = 1 : i64, pll_n = 32 : i64, sw_device = "ttl_urukul0_sw0"}, class = "AD9910", module = "artiq.coredevice.ad9910", type = "local"}, urukul0_cpld = {arguments = {clk_div = 0 : i64, clk_sel = 2 : i64, io_update_device = "ttl_urukul0_io_update", refclk = 125000000 : i64, spi_device = "spi_urukul0", sync_device}, class = "CPLD", module = "artiq.coredevice.urukul", type = "local"}}}>} {
   // CHECK-LABEL: func.func @__kernel__
@@ -218,3 +244,34 @@ module @rpc_with_return attributes {rtio.config = #rtio.config<{core_addr = "172
     return %x : i64
   }
 }
+
+// -----
+
+// Chains of static TTL pulses are recorded into DMA buffers at compile time
+// DMA-LABEL: module @dma_sequential
+// DMA-DAG: llvm.mlir.global internal constant @__rtio_dma_0({{.*}}alignment = 64{{.*}} : !llvm.array<128 x i8>
+// DMA-DAG: llvm.func @dma_playback(i64, i32, i1)
+module @dma_sequential attributes {rtio.config = #rtio.config<{core_addr = "172.31.9.64", device_db = {core = {arguments = {host = "172.31.9.64", ref_period = 1.000000e-09 : f64, target = "cortexa9"}, class = "Core", module = "artiq.coredevice.core", type = "local"}, spi_urukul0 = {arguments = {channel = 17 : i64}, class = "SPIMaster", module = "artiq.coredevice.spi2", type = "local"}, ttl_urukul0_io_update = {arguments = {channel = 18 : i64}, class = "TTLOut", module = "artiq.coredevice.ttl", type = "local"}, ttl_urukul0_sw0 = {arguments = {channel = 19 : i64}, class = "TTLOut", module = "artiq.coredevice.ttl", type = "local"}, urukul0_ch0 = {arguments = {chip_select = 4 : i64, cpld_device = "urukul0_cpld", pll_en = 1 : i64, pll_n = 32 : i64, sw_device = "ttl_urukul0_sw0"}, class = "AD9910", module = "artiq.coredevice.ad9910", type = "local"}, urukul0_cpld = {arguments = {clk_div = 0 : i64, clk_sel = 2 : i64, io_update_device = "ttl_urukul0_io_update", refclk = 125000000 : i64, spi_device = "spi_urukul0", sync_device}, class = "CPLD", module = "artiq.coredevice.urukul", type = "local"}}}>} {
+  func.func @__kernel__() attributes {diff_method = "parameter-shift", qnode} {
+    %cst_dur = arith.constant 1.0e-6 : f64
+    %cst_freq = arith.constant 20000000.0 : f64
+    %cst_phase = arith.constant 0.0 : f64
+
+    %0 = rtio.empty : !rtio.event
+    %ch0 = rtio.channel : !rtio.channel<"dds", [2 : i64], 0>
+
+    // DMA: llvm.call @__rtio_set_frequency
+    // DMA: [[BUF:%.+]] = llvm.mlir.addressof @__rtio_dma_0 : !llvm.ptr
+    // DMA: [[PTR:%.+]] = llvm.ptrtoint [[BUF]] : !llvm.ptr to i32
+    // DMA: llvm.call @dma_playback({{%.+}}, [[PTR]], {{%.+}}) : (i64, i32, i1) -> ()
+    // DMA: [[DURATION:%.+]] = arith.constant 3000 : i64
+    // DMA: llvm.call fastcc tail @delay_mu([[DURATION]])
+    // DMA-NOT: @rtio_output
+    %1 = rtio.pulse %ch0 duration(%cst_dur) frequency(%cst_freq) phase(%cst_phase) wait(%0) {offset = 0 : i64} : <"dds", [2 : i64], 0> -> !rtio.event
+    %2 = rtio.pulse %ch0 duration(%cst_dur) frequency(%cst_freq) phase(%cst_phase) wait(%1) {offset = 0 : i64} : <"dds", [2 : i64], 0> -> !rtio.event
+    %3 = rtio.pulse %ch0 duration(%cst_dur) frequency(%cst_freq) phase(%cst_phase) wait(%2) {offset = 0 : i64} : <"dds", [2 : i64], 0> -> !rtio.event
+
+    // DMA: return
+    return
+  }
+}
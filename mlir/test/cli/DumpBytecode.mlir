@@ -0,0 +1,31 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe1(canonicalize)" --keep-intermediate --dump-bytecode --workspace=%t -o %t/out.mlir
+// RUN: FileCheck %s --check-prefix=DUMP < %t/1_Afterpipe1.mlirbc
+// RUN: catalyst --tool=opt %t/1_Afterpipe1.mlirbc --catalyst-pipeline="pipe2(canonicalize)" | FileCheck %s
+
+// The intermediate files are saved as bytecode, which the compiler driver reads back as input
+
+func.func @foo() -> i64 {
+    %0 = arith.constant 1 : i64
+    %1 = arith.addi %0, %0 : i64
+    return %1 : i64
+}
+
+// DUMP: MLIR{{.+}}git
+
+// CHECK: func.func @foo() -> i64
+// CHECK: arith.constant 2 : i64
@@ -0,0 +1,30 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: rm -rf %t.cache
+// RUN: sed 's/KWARGS/{a: 0}/' %s > %t.first.mlir
+// RUN: sed 's/KWARGS/{a: 1}/' %s > %t.second.mlir
+// RUN: catalyst --tool=opt %t.first.mlir --catalyst-pipeline="pipe1(canonicalize);pipe2(canonicalize)" --cache-dir=%t.cache --incremental --verbose 2>&1 | FileCheck %s --check-prefix=FIRST
+// RUN: catalyst --tool=opt %t.second.mlir --catalyst-pipeline="pipe1(canonicalize);pipe2(canonicalize)" --cache-dir=%t.cache --incremental --verbose 2>&1 | FileCheck %s --check-prefix=SECOND
+
+func.func @foo() {
+    quantum.device ["rtd_null_qubit.so", "NullQubit", "KWARGS"]
+    return
+}
+
+// FIRST-NOT: Resuming from snapshot
+// FIRST: quantum.device ["rtd_null_qubit.so", "NullQubit", "{a: 0}"]
+
+// SECOND: Resuming from snapshot
+// SECOND: quantum.device ["rtd_null_qubit.so", "NullQubit", "{a: 1}"]
@@ -0,0 +1,28 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(func.func(chlo-legalize-to-stablehlo);stablehlo-legalize-to-linalg)" | FileCheck %s
+
+// The driver does not load the StableHLO dialects up front. The parser loads them for the input,
+// and the lowering passes load the dialects they create operations of.
+
+// CHECK-LABEL: @hlo
+func.func @hlo(%arg0: tensor<2xf64>, %arg1: tensor<2xf64>) -> tensor<2xf64> {
+    // CHECK-NOT: chlo.
+    // CHECK-NOT: stablehlo.
+    // CHECK: linalg.generic
+    %0 = chlo.broadcast_add %arg0, %arg1 : (tensor<2xf64>, tensor<2xf64>) -> tensor<2xf64>
+    %1 = stablehlo.multiply %0, %arg1 : tensor<2xf64>
+    return %1 : tensor<2xf64>
+}
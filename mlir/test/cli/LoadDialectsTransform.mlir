@@ -0,0 +1,39 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(apply-transform-sequence)" | FileCheck %s
+
+// Modules with a transform program load all the dialects before the pipeline runs, as the passes
+// applied by the transform interpreter cannot load them.
+
+module @workflow {
+
+  module attributes {transform.with_named_sequence} {
+    transform.named_sequence @__transform_main(%arg0: !transform.op<"builtin.module">) {
+      %0 = transform.apply_registered_pass "cancel-inverses" to %arg0 : (!transform.op<"builtin.module">) -> !transform.op<"builtin.module">
+      transform.yield
+    }
+  }
+
+  // CHECK-LABEL: @f
+  func.func private @f() -> !quantum.bit {
+    %0 = quantum.alloc( 1) : !quantum.reg
+    %1 = quantum.extract %0[ 0] : !quantum.reg -> !quantum.bit
+    // CHECK-NOT: quantum.custom "Hadamard"
+    %out_qubits = quantum.custom "Hadamard"() %1 : !quantum.bit
+    %out_qubits_1 = quantum.custom "Hadamard"() %out_qubits : !quantum.bit
+    return %out_qubits_1 : !quantum.bit
+  }
+
+}
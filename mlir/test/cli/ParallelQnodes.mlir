@@ -0,0 +1,65 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(builtin.module(apply-transform-sequence);inline-nested-module;adjoint-lowering)" --parallel-qnodes --dump-catalyst-pipeline 2>&1 | FileCheck %s --check-prefix=CHECK-NESTED
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(inline-nested-module;adjoint-lowering)" --parallel-qnodes --dump-catalyst-pipeline 2>&1 | FileCheck %s --check-prefix=CHECK-INSERTED
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(inline-nested-module;adjoint-lowering)" --parallel-qnodes | FileCheck %s
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(inline-nested-module;adjoint-lowering)" | FileCheck %s
+
+// The qnode-local passes after inline-nested-module also run on each qnode module before the
+// inlining, either in the pipeline nested on the modules or in a new one, with the same result
+
+module @circuit_module {
+  func.func private @circuit() -> !quantum.reg attributes {qnode} {
+    %c0_i64 = arith.constant 0 : i64
+    %0 = quantum.alloc( 1) : !quantum.reg
+    %1 = quantum.adjoint(%0) : !quantum.reg {
+    ^bb0(%arg0: !quantum.reg):
+      %2 = quantum.extract %arg0[%c0_i64] : !quantum.reg -> !quantum.bit
+      %3 = quantum.custom "RX"() %2 : !quantum.bit
+      %4 = quantum.insert %arg0[%c0_i64], %3 : !quantum.reg, !quantum.bit
+      quantum.yield %4 : !quantum.reg
+    }
+    return %1 : !quantum.reg
+  }
+}
+
+func.func @entry() -> !quantum.reg {
+  %0 = catalyst.launch_kernel @circuit_module::@circuit() : () -> !quantum.reg
+  return %0 : !quantum.reg
+}
+
+// CHECK-NESTED: builtin.module(
+// CHECK-NESTED:   builtin.module(
+// CHECK-NESTED:     apply-transform-sequence,
+// CHECK-NESTED:     adjoint-lowering
+// CHECK-NESTED:   ),
+// CHECK-NESTED:   inline-nested-module
+// CHECK-NESTED:   adjoint-lowering
+// CHECK-NESTED: )
+
+// CHECK-INSERTED: builtin.module(
+// CHECK-INSERTED:   builtin.module(
+// CHECK-INSERTED:     adjoint-lowering
+// CHECK-INSERTED:   ),
+// CHECK-INSERTED:   inline-nested-module
+// CHECK-INSERTED:   adjoint-lowering
+// CHECK-INSERTED: )
+
+// CHECK-NOT: module @circuit_module
+// CHECK: func.func private @circuit()
+// CHECK-NOT: quantum.adjoint
+// CHECK: quantum.custom "RX"() {{%.+}} adj
+// CHECK: func.func @entry()
+// CHECK: func.call @circuit()
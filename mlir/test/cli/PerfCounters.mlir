@@ -0,0 +1,56 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: catalyst --tool=translate %s --perf-counters=/tmp/counters.json --keep-intermediate --workspace=%t -o %t/out.ll
+// RUN: FileCheck %s < %t/1_AfterLLVMIRTranslation.ll
+
+// Each qnode and each entry point is wrapped by the performance counters of the runtime, and the
+// entry points write them to the file before returning
+
+llvm.func @circuit() -> f64 attributes {quantum.node} {
+  %0 = llvm.mlir.constant(0.0 : f64) : f64
+  llvm.return %0 : f64
+}
+
+llvm.func @jit_circuit() -> f64 {
+  %0 = llvm.call @circuit() : () -> f64
+  llvm.return %0 : f64
+}
+
+llvm.func @_catalyst_pyface_jit_circuit(%arg0: !llvm.ptr, %arg1: !llvm.ptr) {
+  %0 = llvm.call @jit_circuit() : () -> f64
+  llvm.store %0, %arg0 : f64, !llvm.ptr
+  llvm.return
+}
+
+// CHECK-DAG: @__catalyst_perf_counters_circuit = internal constant [8 x i8] c"circuit\00"
+// CHECK-DAG: @__catalyst_perf_counters_jit_circuit = internal constant [12 x i8] c"jit_circuit\00"
+// CHECK-DAG: @__catalyst_perf_counters_file = internal constant [19 x i8] c"/tmp/counters.json\00"
+
+// CHECK-LABEL: define double @circuit()
+// CHECK:         call void @__catalyst__rt__perf_counters_begin(ptr @__catalyst_perf_counters_circuit)
+// CHECK:         call void @__catalyst__rt__perf_counters_end(ptr @__catalyst_perf_counters_circuit)
+// CHECK-NOT:     call void @__catalyst__rt__perf_counters_write
+// CHECK:         ret double 0.000000e+00
+
+// CHECK-LABEL: define double @jit_circuit()
+// CHECK-NOT:     call void @__catalyst__rt__perf_counters_begin
+// CHECK:         ret double
+
+// CHECK-LABEL: define void @_catalyst_pyface_jit_circuit(ptr %0, ptr %1)
+// CHECK:         call void @__catalyst__rt__perf_counters_begin(ptr @__catalyst_perf_counters_jit_circuit)
+// CHECK:         call void @__catalyst__rt__perf_counters_end(ptr @__catalyst_perf_counters_jit_circuit)
+// CHECK-NEXT:    call void @__catalyst__rt__perf_counters_write(ptr @__catalyst_perf_counters_file)
+// CHECK-NEXT:    ret void
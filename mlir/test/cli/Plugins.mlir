@@ -0,0 +1,32 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: not catalyst %s --tool=opt --load-pass-plugin=%t.missing.so 2>&1 | FileCheck %s -check-prefix=CHECK-CLI
+// RUN: printf '%s --tool=opt --load-dialect-plugin %t.missing.so\n%s --tool=opt -o %t.mlir\n' | catalyst --server 2>&1 | FileCheck %s -check-prefix=CHECK-SERVER
+// RUN: FileCheck %s -check-prefix=CHECK-OUTPUT < %t.mlir
+
+// Plugins are loaded by the driver before the options are parsed, and a served compilation that
+// requests a missing plugin fails without stopping the server
+
+func.func @foo(%arg0: f64) -> f64 {
+    return %arg0 : f64
+}
+
+// CHECK-CLI: Unable to read plugin '{{.*}}.missing.so'
+
+// CHECK-SERVER:      Unable to read plugin '{{.*}}.missing.so'
+// CHECK-SERVER-NEXT: {{^}}1{{$}}
+// CHECK-SERVER-NEXT: {{^}}0{{$}}
+
+// CHECK-OUTPUT: func.func @foo
@@ -0,0 +1,63 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(canonicalize)" | FileCheck %s
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(canonicalize)" --emit-bytecode -o %t.mlirbc
+// RUN: catalyst --tool=opt %t.mlirbc --catalyst-pipeline="pipe(canonicalize)" | FileCheck %s
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe(canonicalize)" --prune-unreachable-functions=false | FileCheck %s --check-prefix=KEEP
+
+// The private functions that the public functions can never reach are erased after parsing,
+// while the decomposition rules and the functions referenced other than by a call are kept
+
+func.func @entry(%arg0: f64) -> f64 {
+    %0 = func.call @called(%arg0) : (f64) -> f64
+    %1 = gradient.grad "auto" @differentiated(%0) : (f64) -> f64
+    return %1 : f64
+}
+
+func.func private @called(%arg0: f64) -> f64 {
+    %0 = func.call @called_transitively(%arg0) : (f64) -> f64
+    return %0 : f64
+}
+
+func.func private @called_transitively(%arg0: f64) -> f64 {
+    return %arg0 : f64
+}
+
+func.func private @differentiated(%arg0: f64) -> f64 {
+    return %arg0 : f64
+}
+
+func.func private @rule(%arg0: !quantum.bit) -> !quantum.bit attributes {target_gate = "PauliX"} {
+    return %arg0 : !quantum.bit
+}
+
+func.func private @unreachable(%arg0: f64) -> f64 {
+    %0 = func.call @unreachable_callee(%arg0) : (f64) -> f64
+    return %0 : f64
+}
+
+func.func private @unreachable_callee(%arg0: f64) -> f64 {
+    return %arg0 : f64
+}
+
+// CHECK-DAG: func.func @entry
+// CHECK-DAG: func.func private @called(
+// CHECK-DAG: func.func private @called_transitively
+// CHECK-DAG: func.func private @differentiated
+// CHECK-DAG: func.func private @rule
+// CHECK-NOT: @unreachable
+
+// KEEP: func.func private @unreachable(
+// KEEP: func.func private @unreachable_callee
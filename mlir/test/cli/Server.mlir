@@ -0,0 +1,37 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: printf '%s --tool=opt --catalyst-pipeline=pipe(canonicalize) -o %t.first.mlir\n%t.missing.mlir --tool=opt -o %t.missing.out.mlir\n--unknown-option\n%s --tool=opt\n%s --tool=opt --catalyst-pipeline=pipe(cse) --mlir-print-debuginfo -o %t.last.mlir\n' | catalyst --server | FileCheck %s --implicit-check-not=func
+// RUN: FileCheck %s --check-prefix=FIRST < %t.first.mlir
+// RUN: FileCheck %s --check-prefix=LAST < %t.last.mlir
+
+// A served compilation runs for each line of the standard input and writes its output to a file,
+// and its exit code to the standard output, while the invalid requests, including those without
+// an output file, fail without stopping the server
+
+func.func @foo(%arg0: f64) -> f64 {
+    return %arg0 : f64
+}
+
+// CHECK:      {{^}}0{{$}}
+// CHECK-NEXT: {{^}}1{{$}}
+// CHECK-NEXT: {{^}}1{{$}}
+// CHECK-NEXT: {{^}}1{{$}}
+// CHECK-NEXT: {{^}}0{{$}}
+
+// FIRST:     func.func @foo
+// FIRST-NOT: loc(
+
+// LAST: func.func @foo
+// LAST: loc(
@@ -0,0 +1,29 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe1(split-multiple-tapes;inline-nested-module)" --telemetry=%t.json --verify-diagnostics
+// RUN: FileCheck %s < %t.json
+
+func.func @foo() {
+    return
+}
+
+// CHECK: "traceEvents": [
+// CHECK:   "anchor": "builtin.module",
+// CHECK:   "ops_after": 3,
+// CHECK:   "ops_before": 3,
+// CHECK:   "name": "split-multiple-tapes",
+// CHECK:   "ph": "X",
+// CHECK:   "anchor": "builtin.module",
+// CHECK:   "name": "inline-nested-module",
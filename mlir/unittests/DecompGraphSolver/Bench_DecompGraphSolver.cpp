@@ -0,0 +1,89 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the graph solver strategies on large rule libraries. They are hidden from the
+// default test run, and run with `runner_tests_dgsolver "[.benchmark]"`.
+
+#include "DGBuilder.hpp"
+#include "DGSolver.hpp"
+#include "DGTypes.hpp"
+#include "RuleLibrary.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace DecompGraph::Core;
+using namespace DecompGraph::Solver;
+
+TEST_CASE("Benchmark GraphSolver on an acyclic rule library", "[DecompGraph::Solver][.benchmark]")
+{
+    // 3960 rules over 1000 operators
+    const auto library = makeRuleLibrary(/*numLayers*/ 10, /*opsPerLayer*/ 100,
+                                         /*rulesPerOp*/ 4, /*inputsPerRule*/ 4);
+    const DecompositionGraph graph(library.roots, library.gateset, library.rules);
+
+    BENCHMARK("depth-first")
+    {
+        DecompositionSolver solver(graph);
+        return solver.solve().size();
+    };
+
+    BENCHMARK("best-first")
+    {
+        DecompositionSolver solver(graph, nullptr, SolverStrategy::BestFirst);
+        return solver.solve().size();
+    };
+}
+
+TEST_CASE("Benchmark GraphSolver on a rule library with many alternatives",
+          "[DecompGraph::Solver][.benchmark]")
+{
+    // 9900 rules over 400 operators
+    const auto library = makeRuleLibrary(/*numLayers*/ 4, /*opsPerLayer*/ 100,
+                                         /*rulesPerOp*/ 33, /*inputsPerRule*/ 3);
+    const DecompositionGraph graph(library.roots, library.gateset, library.rules);
+
+    BENCHMARK("depth-first")
+    {
+        DecompositionSolver solver(graph);
+        return solver.solve().size();
+    };
+
+    BENCHMARK("best-first")
+    {
+        DecompositionSolver solver(graph, nullptr, SolverStrategy::BestFirst);
+        return solver.solve().size();
+    };
+}
+
+TEST_CASE("Benchmark GraphSolver on a cyclic rule library", "[DecompGraph::Solver][.benchmark]")
+{
+    // 2000 rules over 500 operators, with inputs from any layer
+    const auto library = makeRuleLibrary(/*numLayers*/ 5, /*opsPerLayer*/ 100,
+                                         /*rulesPerOp*/ 5, /*inputsPerRule*/ 2,
+                                         /*withCycles*/ true);
+    const DecompositionGraph graph(library.roots, library.gateset, library.rules);
+
+    BENCHMARK("depth-first")
+    {
+        DecompositionSolver solver(graph);
+        return solver.solve().size();
+    };
+
+    BENCHMARK("best-first")
+    {
+        DecompositionSolver solver(graph, nullptr, SolverStrategy::BestFirst);
+        return solver.solve().size();
+    };
+}
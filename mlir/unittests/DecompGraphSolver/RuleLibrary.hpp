@@ -0,0 +1,75 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DGTypes.hpp"
+
+/**
+ * A synthetic library of decomposition rules, with its target gateset and root operators.
+ */
+struct RuleLibrary {
+    std::vector<DecompGraph::Core::OperatorNode> roots;
+    DecompGraph::Core::WeightedGateset gateset;
+    std::vector<DecompGraph::Core::RuleNode> rules;
+};
+
+/**
+ * @brief Generates a layered rule library, in which layer 0 is the target gateset and each
+ * operator of the other layers has `rulesPerOp` rules into `inputsPerRule` operators of lower
+ * layers, or of any layer if `withCycles` is set. The roots are the operators of the top layer.
+ */
+inline RuleLibrary makeRuleLibrary(std::size_t numLayers, std::size_t opsPerLayer,
+                                   std::size_t rulesPerOp, std::size_t inputsPerRule,
+                                   bool withCycles = false, uint32_t seed = 2026)
+{
+    using DecompGraph::Core::OperatorNode;
+
+    std::mt19937 rng(seed);
+    auto operatorAt = [&](std::size_t layer, std::size_t idx) {
+        return OperatorNode{"Op" + std::to_string(layer) + "_" + std::to_string(idx), 1, 0, false};
+    };
+
+    RuleLibrary library;
+    for (std::size_t idx = 0; idx < opsPerLayer; idx++) {
+        // Integral costs keep the sums exact, whatever the order of the additions
+        library.gateset.ops.emplace(operatorAt(0, idx), static_cast<double>(1 + rng() % 5));
+    }
+
+    for (std::size_t layer = 1; layer < numLayers; layer++) {
+        for (std::size_t idx = 0; idx < opsPerLayer; idx++) {
+            const OperatorNode output = operatorAt(layer, idx);
+            for (std::size_t r = 0; r < rulesPerOp; r++) {
+                DecompGraph::Core::RuleNode rule{output.name + "_rule" + std::to_string(r), output,
+                                                 {}};
+                for (std::size_t i = 0; i < inputsPerRule; i++) {
+                    const std::size_t inputLayer = rng() % (withCycles ? numLayers : layer);
+                    const std::size_t inputIdx = rng() % opsPerLayer;
+                    rule.inputs.push_back({operatorAt(inputLayer, inputIdx), 1 + rng() % 3});
+                }
+                library.rules.push_back(std::move(rule));
+            }
+            if (layer == numLayers - 1) {
+                library.roots.push_back(output);
+            }
+        }
+    }
+    return library;
+}
@@ -13,11 +13,18 @@
 // limitations under the License.
 
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <sstream>
 
 #include "DGBuilder.hpp"
+#include "DGCache.hpp"
+#include "DGIncrementalSolver.hpp"
 #include "DGSolver.hpp"
 #include "DGTypes.hpp"
 #include "DGUtils.hpp"
+#include "RuleLibrary.hpp"
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -189,6 +196,62 @@ TEST_CASE("Test DecompositionGraph lookup and counting", "[DecompGraph::Solver]"
     }
 }
 
+TEST_CASE("Test DecompositionGraph interned operators", "[DecompGraph::Solver]")
+{
+    const OperatorNode h{"H", 1, 0, false};
+    const OperatorNode rz{"RZ", 1, 1, false};
+    const OperatorNode rx{"RX", 1, 1, false};
+    const OperatorNode ry{"RY", 1, 1, false};
+    const OperatorNode rz_wildcard{"RZ"};
+
+    const WeightedGateset gateset{{{rz, 1.0}, {rx, 3.0}}};
+
+    const std::vector<RuleNode> rules{
+        {"h_to_rz_rx_rz", h, {{rz, 2}, {rx, 1}}},
+        {"ry_to_rz_rx", ry, {{rz_wildcard, 1}, {rx, 1}}},
+        {"h_to_ry_rx_ry", h, {{ry, 2}, {rx, 1}}},
+    };
+
+    const DecompositionGraph graph({h}, gateset, rules);
+    REQUIRE(graph.getNumOperatorIds() == 4);
+
+    // Roots are interned first, and operators equal up to wildcards share their ID
+    const auto h_id = graph.findOperatorId(h);
+    const auto rz_id = graph.findOperatorId(rz);
+    const auto rx_id = graph.findOperatorId(rx);
+    const auto ry_id = graph.findOperatorId(ry);
+    REQUIRE(h_id == 0);
+    REQUIRE(rz_id.has_value());
+    REQUIRE(rx_id.has_value());
+    REQUIRE(ry_id.has_value());
+    REQUIRE(graph.findOperatorId(rz_wildcard) == rz_id);
+    REQUIRE_FALSE(graph.findOperatorId(OperatorNode{"CNOT", 2, 0, false}).has_value());
+    REQUIRE(graph.getOperator(*ry_id) == ry);
+
+    REQUIRE(graph.isTargetGate(*rz_id));
+    REQUIRE(graph.getTargetCost(*rx_id) == 3.0);
+    REQUIRE_FALSE(graph.isTargetGate(*h_id));
+    REQUIRE(graph.getTargetCost(*h_id) == std::numeric_limits<double>::infinity());
+
+    // The rules of each operator keep their order in the graph
+    const auto h_rules = graph.getRuleIdsFor(*h_id);
+    REQUIRE(h_rules.size() == 2);
+    REQUIRE(graph.getRule(h_rules[0]).name == "h_to_rz_rx_rz");
+    REQUIRE(graph.getRule(h_rules[1]).name == "h_to_ry_rx_ry");
+    REQUIRE(graph.getRuleIdsFor(*rz_id).empty());
+
+    const auto ry_rules = graph.getRuleIdsFor(*ry_id);
+    REQUIRE(ry_rules.size() == 1);
+    REQUIRE(graph.getRuleOutputId(ry_rules[0]) == *ry_id);
+
+    const auto inputs = graph.getRuleInputIds(h_rules[1]);
+    REQUIRE(inputs.size() == 2);
+    REQUIRE(inputs[0].op == *ry_id);
+    REQUIRE(inputs[0].multiplicity == 2);
+    REQUIRE(inputs[1].op == *rx_id);
+    REQUIRE(inputs[1].multiplicity == 1);
+}
+
 TEST_CASE("Test the graph construction with realistic ops and multiple rules from PennyLane",
           "[DecompGraph::Solver]")
 {
@@ -533,3 +596,406 @@ TEST_CASE("Test GraphSolver with MultiRZ decompositions", "[DecompGraph::Solver]
     REQUIRE(chosen_rule_multiRZ5.ruleName == "multiRZ5_to_rz");
     REQUIRE(chosen_rule_multiRZ5.totalCost == 1.0 * 5);
 }
+
+TEST_CASE("Test SolutionCache shared between graphs", "[DecompGraph::Solver]")
+{
+    const OperatorNode h{"H", 1, 0, false};
+    const OperatorNode cnot{"CNOT", 2, 0, false};
+    const OperatorNode rz{"RZ", 1, 1, false};
+    const OperatorNode rx{"RX", 1, 1, false};
+    const OperatorNode cz{"CZ", 2, 0, false};
+
+    const WeightedGateset gateset{{{rz, 1.0}, {rx, 2.0}, {cz, 3.0}}};
+    const std::vector<RuleNode> rules{
+        {"h_to_rz_rx_rz", h, {{rz, 2}, {rx, 1}}},
+        {"cnot_to_h_cz_h", cnot, {{h, 2}, {cz, 1}}},
+    };
+
+    SolutionCache cache;
+    const DecompositionGraph graph({h}, gateset, rules);
+    DecompositionSolver solver(graph, &cache);
+    const auto solutions = solver.solve();
+    REQUIRE(solutions.at(h).totalCost == 1.0 * 2 + 2.0);
+    REQUIRE(cache.size() == 3); // H, RZ and RX
+
+    const auto key = SolutionCache::getGraphKey(graph);
+    const auto cached = cache.lookup(key, h);
+    REQUIRE(cached.has_value());
+    REQUIRE(cached->size() == 3);
+    REQUIRE(cached->at(h).ruleName == "h_to_rz_rx_rz");
+
+    // A graph with other roots but the same gateset and rules reuses the solution of H
+    const DecompositionGraph graph2({cnot, h}, gateset, rules);
+    REQUIRE(SolutionCache::getGraphKey(graph2) == key);
+    DecompositionSolver solver2(graph2, &cache);
+    const auto solutions2 = solver2.solve();
+    REQUIRE(solutions2.at(cnot).ruleName == "cnot_to_h_cz_h");
+    REQUIRE(solutions2.at(cnot).totalCost == 2 * (1.0 * 2 + 2.0) + 3.0);
+    REQUIRE(solutions2.at(cnot).basisCounts.at(rz) == 4);
+    REQUIRE(solutions2.at(h).totalCost == solutions.at(h).totalCost);
+    REQUIRE(cache.size() == 5); // CNOT and CZ are new
+
+    // Graphs with other gate weights don't share solutions
+    const WeightedGateset gateset3{{{rz, 1.0}, {rx, 5.0}, {cz, 3.0}}};
+    const DecompositionGraph graph3({h}, gateset3, rules);
+    REQUIRE(SolutionCache::getGraphKey(graph3) != key);
+    REQUIRE_FALSE(cache.lookup(SolutionCache::getGraphKey(graph3), h).has_value());
+    DecompositionSolver solver3(graph3, &cache);
+    REQUIRE(solver3.solve().at(h).totalCost == 1.0 * 2 + 5.0);
+}
+
+TEST_CASE("Test SolutionCache entries are used by the solver", "[DecompGraph::Solver]")
+{
+    const OperatorNode h{"H", 1, 0, false};
+    const OperatorNode rz{"RZ", 1, 1, false};
+    const OperatorNode rx{"RX", 1, 1, false};
+
+    const WeightedGateset gateset{{{rz, 1.0}, {rx, 2.0}}};
+    const std::vector<RuleNode> rules{
+        {"h_to_rz_rx_rz", h, {{rz, 2}, {rx, 1}}},
+        {"h_to_rx_rz", h, {{rx, 1}, {rz, 1}}},
+    };
+    const DecompositionGraph graph({h}, gateset, rules);
+
+    SolutionCache cache;
+    ChosenDecompRule cachedRule{h, false, "h_to_rz_rx_rz", {{rz, 2}, {rx, 1}}, 4.0, {}};
+    cache.insert(SolutionCache::getGraphKey(graph), h, {{h, cachedRule}});
+
+    DecompositionSolver solver(graph, &cache);
+    const auto solutions = solver.solve();
+    REQUIRE(solutions.at(h).ruleName == "h_to_rz_rx_rz");
+    REQUIRE(solutions.at(h).totalCost == 4.0);
+}
+
+TEST_CASE("Test SolutionCache skips path-dependent solutions", "[DecompGraph::Solver]")
+{
+    const OperatorNode a{"A"};
+    const OperatorNode b{"B"};
+    const OperatorNode x{"X"};
+    const OperatorNode y{"Y"};
+
+    const WeightedGateset gateset{{{x, 5.0}, {y, 1.0}}};
+    const std::vector<RuleNode> rules{
+        {"a_to_b", a, {{b, 1}}},
+        {"a_to_x", a, {{x, 1}}},
+        {"b_to_a", b, {{a, 1}}},
+        {"b_to_y", b, {{y, 1}}},
+    };
+
+    SolutionCache cache;
+    const DecompositionGraph graph({a}, gateset, rules);
+    DecompositionSolver solver(graph, &cache);
+    const auto solutions = solver.solve();
+    REQUIRE(solutions.at(a).ruleName == "a_to_b");
+    REQUIRE(solutions.at(b).ruleName == "b_to_y");
+
+    // B was solved with the cycle through A cut, which depends on being reached from A
+    const auto key = SolutionCache::getGraphKey(graph);
+    REQUIRE(cache.lookup(key, a).has_value());
+    REQUIRE(cache.lookup(key, a)->size() == 3); // A, B and Y
+    REQUIRE_FALSE(cache.lookup(key, b).has_value());
+}
+
+TEST_CASE("Test SolutionCache evicts the oldest solutions", "[DecompGraph::Solver]")
+{
+    const OperatorNode h{"H", 1, 0, false};
+    const OperatorNode rz{"RZ", 1, 1, false};
+    const OperatorNode rx{"RX", 1, 1, false};
+
+    const auto key = SolutionCache::GraphKey("graph");
+    const auto otherKey = SolutionCache::GraphKey("other graph");
+    REQUIRE(key == SolutionCache::GraphKey("graph"));
+    REQUIRE_FALSE(key == otherKey);
+
+    SolutionCache cache(2);
+    cache.insert(key, h, {{h, ChosenDecompRule{h, false, "h_rule", {}, 1.0, {}}}});
+    cache.insert(otherKey, rz, {{rz, ChosenDecompRule{rz, true, "", {}, 1.0, {}}}});
+    REQUIRE(cache.size() == 2);
+
+    // Inserting a cached solution again neither replaces nor refreshes it
+    cache.insert(key, h, {{h, ChosenDecompRule{h, false, "other_rule", {}, 1.0, {}}}});
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.lookup(key, h)->at(h).ruleName == "h_rule");
+
+    cache.insert(key, rx, {{rx, ChosenDecompRule{rx, true, "", {}, 1.0, {}}}});
+    REQUIRE(cache.size() == 2);
+    REQUIRE_FALSE(cache.lookup(key, h).has_value());
+    REQUIRE(cache.lookup(otherKey, rz).has_value());
+    REQUIRE(cache.lookup(key, rx).has_value());
+
+    cache.insert(key, h, {{h, ChosenDecompRule{h, false, "h_rule", {}, 1.0, {}}}});
+    REQUIRE(cache.size() == 2);
+    REQUIRE_FALSE(cache.lookup(otherKey, rz).has_value());
+
+    SolutionCache disabled(0);
+    disabled.insert(key, h, {{h, ChosenDecompRule{h, false, "h_rule", {}, 1.0, {}}}});
+    REQUIRE(disabled.size() == 0);
+    REQUIRE_FALSE(disabled.lookup(key, h).has_value());
+}
+
+TEST_CASE("Test SolutionCache save and load", "[DecompGraph::Solver]")
+{
+    const OperatorNode h{"H", 1, 0, false};
+    const OperatorNode rz{"RZ", 1, 1, false};
+    const OperatorNode rx{"RX", 1, 1, true};
+
+    const WeightedGateset gateset{{{rz, 0.1}, {rx, 2.0 / 3.0}}};
+    const std::vector<RuleNode> rules{
+        {"h to rz rx", h, {{rz, 2}, {rx, 1}}},
+    };
+    const DecompositionGraph graph({h}, gateset, rules);
+
+    SolutionCache cache;
+    DecompositionSolver solver(graph, &cache);
+    const auto solutions = solver.solve();
+
+    std::stringstream stream;
+    cache.save(stream);
+
+    SolutionCache loaded;
+    loaded.load(stream);
+    REQUIRE(loaded.size() == cache.size());
+
+    const auto entry = loaded.lookup(SolutionCache::getGraphKey(graph), h);
+    REQUIRE(entry.has_value());
+    const auto &rule = entry->at(h);
+    REQUIRE(rule.ruleName == "h to rz rx");
+    REQUIRE_FALSE(rule.isBasis);
+    REQUIRE(rule.totalCost == solutions.at(h).totalCost);
+    REQUIRE(rule.inputs.size() == 2);
+    REQUIRE(rule.basisCounts.at(rz) == 2);
+    REQUIRE(entry->at(rx).op.adjoint);
+    REQUIRE(entry->at(rx).isBasis);
+
+    std::stringstream malformed("DecompGraphSolutionCache 1\n1\n5:abc");
+    REQUIRE_THROWS_AS(loaded.load(malformed), GraphError);
+    std::stringstream unsupported("DecompGraphSolutionCache 0\n0\n");
+    REQUIRE_THROWS_AS(loaded.load(unsupported), GraphError);
+    REQUIRE(loaded.size() == cache.size());
+}
+
+TEST_CASE("Test best-first GraphSolver with intermediate ops", "[DecompGraph::Solver]")
+{
+    const OperatorNode cnot{"CNOT", 2, 0, false};
+    const OperatorNode h{"H", 1, 0, false};
+    const OperatorNode cz{"CZ", 2, 0, false};
+    const OperatorNode rz{"RZ", 1, 1, false};
+    const OperatorNode rx{"RX", 1, 1, false};
+    const OperatorNode unused{"Unused", 1, 0, false};
+
+    const WeightedGateset gateset{{{rz, 1.0}, {rx, 2.0}, {cz, 3.0}}};
+    const std::vector<RuleNode> rules{
+        {"cnot_to_h_cz_h", cnot, {{h, 2}, {cz, 1}}},
+        {"h_to_rz_rx_rz", h, {{rz, 2}, {rx, 1}}},
+        {"h_to_rx_rz_rx", h, {{rx, 2}, {rz, 1}}},
+        {"unused_to_rz", unused, {{rz, 1}}},
+    };
+
+    const DecompositionGraph graph({cnot}, gateset, rules);
+    DecompositionSolver solver(graph, nullptr, SolverStrategy::BestFirst);
+    const auto solutions = solver.solve();
+
+    // Only the operators CNOT decomposes into are in the solution
+    REQUIRE(solutions.size() == 5);
+    REQUIRE(solutions.at(cnot).ruleName == "cnot_to_h_cz_h");
+    REQUIRE(solutions.at(cnot).totalCost == 2 * (1.0 * 2 + 2.0) + 3.0);
+    REQUIRE(solutions.at(cnot).basisCounts.at(rz) == 4);
+    REQUIRE(solutions.at(cnot).basisCounts.at(rx) == 2);
+    REQUIRE(solutions.at(cnot).basisCounts.at(cz) == 1);
+    REQUIRE(solutions.at(h).ruleName == "h_to_rz_rx_rz");
+    REQUIRE(solutions.at(cz).isBasis);
+    REQUIRE(solutions.find(unused) == solutions.end());
+}
+
+TEST_CASE("Test best-first GraphSolver with cyclic decompositions", "[DecompGraph::Solver]")
+{
+    const OperatorNode hadamard{"Hadamard"};
+    const OperatorNode globalPhase{"GlobalPhase"};
+    const OperatorNode rx{"RX"};
+    const OperatorNode rz{"RZ"};
+    const OperatorNode ry{"RY"};
+
+    const std::vector<RuleNode> rules{
+        {"ry_to_hadamard", ry, {{hadamard, 2}}},
+        {"ry_to_rz_rx", ry, {{rx, 1}, {rz, 2}}},
+        {"hadamard_to_rz_ry", hadamard, {{globalPhase, 1}, {ry, 1}, {rz, 1}}},
+        {"hadamard_to_rz_rx", hadamard, {{globalPhase, 1}, {rx, 1}, {rz, 2}}},
+    };
+
+    const WeightedGateset gateset{{{globalPhase, 1.0}, {rx, 1.0}, {rz, 1.0}}};
+    const DecompositionGraph graph({hadamard, ry}, gateset, rules);
+    DecompositionSolver solver(graph, nullptr, SolverStrategy::BestFirst);
+    const auto solutions = solver.solve();
+    REQUIRE(solutions.at(hadamard).ruleName == "hadamard_to_rz_rx");
+    REQUIRE(solutions.at(hadamard).totalCost == 4.0);
+    REQUIRE(solutions.at(ry).ruleName == "ry_to_rz_rx");
+    REQUIRE(solutions.at(ry).totalCost == 3.0);
+}
+
+TEST_CASE("Test best-first GraphSolveError for unsolvable operator", "[DecompGraph::Solver]")
+{
+    const OperatorNode a{"A"};
+    const OperatorNode b{"B"};
+    const OperatorNode rz{"RZ", 1, 1, false};
+
+    const WeightedGateset gateset{{{rz, 1.0}}};
+    const std::vector<RuleNode> rules{
+        {"a_to_b", a, {{b, 1}}},
+        {"b_to_a", b, {{a, 1}}},
+    };
+
+    const DecompositionGraph graph({a}, gateset, rules);
+    DecompositionSolver solver(graph, nullptr, SolverStrategy::BestFirst);
+    REQUIRE_THROWS_WITH(solver.solve(), ContainsSubstring("Decomposition rule not found") &&
+                                            ContainsSubstring("a_to_b"));
+}
+
+TEST_CASE("Test best-first GraphSolver agrees with the depth-first solver", "[DecompGraph::Solver]")
+{
+    const auto library = makeRuleLibrary(/*numLayers*/ 6, /*opsPerLayer*/ 40, /*rulesPerOp*/ 4,
+                                         /*inputsPerRule*/ 3);
+    const DecompositionGraph graph(library.roots, library.gateset, library.rules);
+
+    DecompositionSolver depthFirst(graph);
+    const auto expected = depthFirst.solve();
+
+    SolutionCache cache;
+    DecompositionSolver bestFirst(graph, &cache, SolverStrategy::BestFirst);
+    const auto solutions = bestFirst.solve();
+    for (const auto &[op, rule] : solutions) {
+        REQUIRE(rule.ruleName == expected.at(op).ruleName);
+        REQUIRE(rule.totalCost == expected.at(op).totalCost);
+        REQUIRE(rule.basisCounts == expected.at(op).basisCounts);
+    }
+    for (const auto &root : library.roots) {
+        REQUIRE(solutions.find(root) != solutions.end());
+    }
+
+    // The roots are cached, and a solver of the same graph resolves them from the cache
+    REQUIRE(cache.size() == library.roots.size());
+    DecompositionSolver cached(graph, &cache, SolverStrategy::BestFirst);
+    REQUIRE(cached.solve().size() == solutions.size());
+}
+
+TEST_CASE("Test DecompositionGraph interns large rule libraries in parallel",
+          "[DecompGraph::Solver]")
+{
+    auto library = makeRuleLibrary(/*numLayers*/ 6, /*opsPerLayer*/ 500, /*rulesPerOp*/ 4,
+                                   /*inputsPerRule*/ 3);
+
+    // Operators with wildcards are interned term by term
+    const bool withWildcards = GENERATE(false, true);
+    if (withWildcards) {
+        library.rules[library.rules.size() / 2].inputs.push_back({OperatorNode{"Op0_0"}, 1});
+    }
+    const DecompositionGraph graph(library.roots, library.gateset, library.rules);
+    REQUIRE(graph.getNumRules() == library.rules.size());
+
+    // The roots are interned first, in order, and the rules keep their terms
+    for (std::size_t idx = 0; idx < library.roots.size(); idx++) {
+        REQUIRE(graph.getOperator(idx) == library.roots[idx]);
+    }
+    std::size_t numUsers = 0;
+    for (DecompositionGraph::RuleId ruleId = 0; ruleId < graph.getNumRules(); ruleId++) {
+        const auto &rule = graph.getRule(ruleId);
+        const auto inputs = graph.getRuleInputIds(ruleId);
+        REQUIRE(graph.getOperator(graph.getRuleOutputId(ruleId)) == rule.output);
+        REQUIRE(inputs.size() == rule.inputs.size());
+        for (std::size_t idx = 0; idx < inputs.size(); idx++) {
+            REQUIRE(graph.getOperator(inputs[idx].op) == rule.inputs[idx].op);
+            REQUIRE(inputs[idx].multiplicity == rule.inputs[idx].multiplicity);
+        }
+        numUsers += graph.getRuleIdsFor(graph.getRuleOutputId(ruleId)).size();
+    }
+    REQUIRE(numUsers == 4 * graph.getNumRules());
+
+    // Each operator is interned once
+    for (std::size_t id = 0; id < graph.getNumOperatorIds(); id++) {
+        REQUIRE(*graph.findOperatorId(graph.getOperator(id)) == id);
+    }
+}
+
+TEST_CASE("Test IncrementalSolver switches rules when gate costs change", "[DecompGraph::Solver]")
+{
+    const OperatorNode cnot{"CNOT", 2, 0, false};
+    const OperatorNode h{"H", 1, 0, false};
+    const OperatorNode cz{"CZ", 2, 0, false};
+    const OperatorNode rz{"RZ", 1, 1, false};
+    const OperatorNode rx{"RX", 1, 1, false};
+
+    const std::vector<RuleNode> rules{
+        {"cnot_to_h_cz_h", cnot, {{h, 2}, {cz, 1}}},
+        {"h_to_rz_rx_rz", h, {{rz, 2}, {rx, 1}}},
+        {"h_to_rx_rz_rx", h, {{rx, 2}, {rz, 1}}},
+    };
+
+    IncrementalSolver solver(
+        DecompositionGraph({cnot}, WeightedGateset{{{rz, 1.0}, {rx, 2.0}, {cz, 3.0}}}, rules));
+    auto solutions = solver.solve();
+    REQUIRE(solver.getNumResolved() == 5);
+    REQUIRE(solutions.at(h).ruleName == "h_to_rz_rx_rz");
+    REQUIRE(solutions.at(cnot).totalCost == 2 * 4.0 + 3.0);
+
+    // A more expensive RZ only resolves the operators whose rules use it
+    REQUIRE(solver.updateGateset(WeightedGateset{{{rz, 3.0}, {rx, 2.0}, {cz, 3.0}}}));
+    REQUIRE(solver.getNumResolved() == 3);
+    solutions = solver.solve();
+    REQUIRE(solutions.at(h).ruleName == "h_to_rx_rz_rx");
+    REQUIRE(solutions.at(h).basisCounts.at(rx) == 2);
+    REQUIRE(solutions.at(cnot).totalCost == 2 * 7.0 + 3.0);
+    REQUIRE(solutions.at(cnot).basisCounts.at(rx) == 4);
+
+    // A cheaper CZ is propagated to CNOT only
+    REQUIRE(solver.updateGateset(WeightedGateset{{{rz, 3.0}, {rx, 2.0}, {cz, 1.0}}}));
+    REQUIRE(solver.getNumResolved() == 2);
+    solutions = solver.solve();
+    REQUIRE(solutions.at(h).ruleName == "h_to_rx_rz_rx");
+    REQUIRE(solutions.at(cnot).totalCost == 2 * 7.0 + 1.0);
+
+    // The graph must be rebuilt for other target gates
+    REQUIRE_FALSE(solver.updateGateset(WeightedGateset{{{rz, 1.0}, {rx, 1.0}}}));
+    REQUIRE_FALSE(solver.updateGateset(WeightedGateset{{{rz, 1.0}, {rx, 1.0}, {h, 1.0}}}));
+    REQUIRE(solver.solve().at(cnot).totalCost == 2 * 7.0 + 1.0);
+}
+
+TEST_CASE("Test IncrementalSolver agrees with a new solve", "[DecompGraph::Solver]")
+{
+    const bool withCycles = GENERATE(false, true);
+    const auto library = makeRuleLibrary(/*numLayers*/ 5, /*opsPerLayer*/ 40, /*rulesPerOp*/ 5,
+                                         /*inputsPerRule*/ 2, withCycles);
+    IncrementalSolver solver(DecompositionGraph(library.roots, library.gateset, library.rules));
+    solver.solve();
+    const std::size_t numResolved = solver.getNumResolved();
+
+    std::mt19937 rng(7);
+    WeightedGateset gateset = library.gateset;
+    for (std::size_t step = 0; step < 20; step++) {
+        // Change a few gate costs, either way
+        for (std::size_t i = 0; i < 3; i++) {
+            auto gateIt = std::next(gateset.ops.begin(), rng() % gateset.ops.size());
+            gateIt->second = static_cast<double>(rng() % 10);
+        }
+        REQUIRE(solver.updateGateset(gateset));
+        REQUIRE(solver.getNumResolved() < numResolved);
+        const auto solutions = solver.solve();
+
+        const DecompositionGraph graph(library.roots, gateset, library.rules);
+        DecompositionSolver fresh(graph, nullptr, SolverStrategy::BestFirst);
+        const auto expected = fresh.solve();
+
+        // Rules of equal costs may differ, but not the costs
+        for (const auto &root : library.roots) {
+            REQUIRE(solutions.at(root).totalCost == expected.at(root).totalCost);
+        }
+        for (const auto &[op, rule] : solutions) {
+            double basisCost = 0.0;
+            for (const auto &[basis_op, count] : rule.basisCounts) {
+                basisCost += gateset.ops.at(basis_op) * static_cast<double>(count);
+            }
+            REQUIRE(rule.totalCost == basisCost);
+            if (const auto expectedIt = expected.find(op); expectedIt != expected.end()) {
+                REQUIRE(rule.totalCost == expectedIt->second.totalCost);
+            }
+        }
+    }
+}
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 /**
@@ -139,6 +140,63 @@ template <typename T, size_t R> class DataView {
         return data_aligned[loc];
     }
 
+    /**
+     * @brief Get a pointer to the first element of the view.
+     *
+     * Combined with `is_contiguous()`, this gives direct access to the elements as a dense
+     * row-major array of `size()` elements.
+     */
+    [[nodiscard]] auto data() const -> T *
+    {
+        return data_aligned ? data_aligned + offset : nullptr;
+    }
+
+    /**
+     * @brief Check whether the elements are stored densely in row-major order, i.e. whether the
+     * iteration order of the view matches the physical memory layout. Axes of size 1 may have any
+     * stride.
+     */
+    [[nodiscard]] auto is_contiguous() const -> bool
+    {
+        size_t expected_stride = 1;
+        for (size_t axis = R; axis-- > 0;) {
+            if (sizes[axis] != 1 && strides[axis] != expected_stride) {
+                return false;
+            }
+            expected_stride *= sizes[axis];
+        }
+        return true;
+    }
+
+    /**
+     * @brief Assign `value` to every element of the view.
+     */
+    void fill(const T &value)
+    {
+        if (is_contiguous()) {
+            std::fill_n(data(), size(), value);
+        }
+        else {
+            std::fill(begin(), end(), value);
+        }
+    }
+
+    /**
+     * @brief Copy `size()` elements from `first` into the view, in iteration order.
+     *
+     * Contiguous views are written with a single bulk copy, which reduces to `memmove` for
+     * trivially copyable types.
+     */
+    template <typename InputIt> void copy_from(InputIt first)
+    {
+        if (is_contiguous()) {
+            std::copy_n(first, size(), data());
+        }
+        else {
+            std::copy_n(first, size(), begin());
+        }
+    }
+
     iterator begin()
     {
         return iterator{*this, (*this).size() == 0 ? -1 : static_cast<int64_t>(offset)};
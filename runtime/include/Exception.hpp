@@ -40,6 +40,13 @@
  */
 #define RT_ASSERT(expression) RT_FAIL_IF(!(expression), "Assertion: " #expression)
 
+/**
+ * @brief Macro that throws `UnsupportedException` with given message, for optional features
+ * that are not implemented.
+ */
+#define RT_UNSUPPORTED(message)                                                                    \
+    Catalyst::Runtime::_unsupported((message), __FILE__, __LINE__, __func__)
+
 /**
  * @brief Macro that emits a non-fatal warning message to stderr.
  */
@@ -73,18 +80,48 @@ class RuntimeException : public std::exception {
 };
 
 /**
- * @brief Throws a `RuntimeException` with the given error message.
+ * @brief The exception thrown by Catalyst for optional features that are not implemented, e.g.
+ * by a device. Callers may catch it to fall back to another implementation.
+ */
+class UnsupportedException : public RuntimeException {
+  public:
+    using RuntimeException::RuntimeException;
+};
+
+/**
+ * @brief Format a runtime error message with its source location.
  *
  * @note This is not supposed to be called directly.
  */
-[[noreturn]] inline void _abort(const char *message, const char *file_name, size_t line,
-                                const char *function_name)
+inline auto _formatError(const char *message, const char *file_name, size_t line,
+                         const char *function_name) -> std::string
 {
     std::stringstream sstream;
     sstream << "[" << file_name << ":" << line << "][Function:" << function_name
             << "] Error in Catalyst Runtime: " << message;
+    return sstream.str();
+}
+
+/**
+ * @brief Throws a `RuntimeException` with the given error message.
+ *
+ * @note This is not supposed to be called directly.
+ */
+[[noreturn]] inline void _abort(const char *message, const char *file_name, size_t line,
+                                const char *function_name)
+{
+    throw RuntimeException(_formatError(message, file_name, line, function_name));
+} // LCOV_EXCL_LINE
 
-    throw RuntimeException(sstream.str());
+/**
+ * @brief Throws an `UnsupportedException` with the given error message.
+ *
+ * @note This is not supposed to be called directly.
+ */
+[[noreturn]] inline void _unsupported(const char *message, const char *file_name, size_t line,
+                                      const char *function_name)
+{
+    throw UnsupportedException(_formatError(message, file_name, line, function_name));
 } // LCOV_EXCL_LINE
 
 } // namespace Catalyst::Runtime
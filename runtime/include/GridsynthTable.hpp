@@ -0,0 +1,106 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+/**
+ * A table of precomputed Ross-Selinger (gridsynth) decompositions of RZ rotations.
+ *
+ * The table covers the angles m * pi / 2^k that are common in QFT-style circuits at the standard
+ * precisions, so that both the gridsynth pass (for constant angles) and the RS decomposition
+ * runtime can skip the search for them. It is shared by the compiler and the runtime, and thus
+ * only depends on the standard library.
+ *
+ * The entries are listed in `GridsynthTable.def`, and the gates are encoded as one character per
+ * gate: '0' + GateType for the Clifford+T basis, and 'a' + PPRGateType for the PPR basis.
+ */
+namespace RSDecomp::GridsynthTable {
+
+// The version of the table, to be increased whenever its entries are regenerated.
+inline constexpr int GRIDSYNTH_TABLE_VERSION = 1;
+
+struct Entry {
+    // The rotation angle is multiple * pi / 2^log2_denominator.
+    int multiple;
+    int log2_denominator;
+    double epsilon;
+    double phase;
+    std::string_view gates;
+    double ppr_phase;
+    std::string_view ppr_gates;
+};
+
+inline constexpr Entry ENTRIES[] = {
+#define GRIDSYNTH_TABLE_ENTRY(MULTIPLE, LOG2_DENOMINATOR, EPSILON, PHASE, GATES, PPR_PHASE,       \
+                              PPR_GATES)                                                           \
+    {MULTIPLE, LOG2_DENOMINATOR, EPSILON, PHASE, GATES, PPR_PHASE, PPR_GATES},
+#include "GridsynthTable.def"
+#undef GRIDSYNTH_TABLE_ENTRY
+};
+
+/**
+ * @brief A precomputed decomposition, in the encoding of the table.
+ */
+struct Decomposition {
+    std::string_view gates;
+    double phase;
+};
+
+/**
+ * @brief Returns the angle of an entry, computed the same way as `multiple * pi / 2^k` is in
+ * the frontend, so that the angles of the circuits match exactly.
+ */
+inline double entry_angle(const Entry &entry)
+{
+    return std::ldexp(entry.multiple * M_PI, -entry.log2_denominator);
+}
+
+/**
+ * @brief Looks up the precomputed decomposition of an RZ rotation.
+ *
+ * Only exact matches of the angle and the precision are returned, so that a decomposition is
+ * never longer than the one a search at the requested precision would find.
+ *
+ * @param angle The rotation angle.
+ * @param epsilon The precision of the decomposition.
+ * @param ppr_basis Whether to return the decomposition in the PPR basis.
+ * @return The decomposition, or std::nullopt if the table has no entry for the angle.
+ */
+inline std::optional<Decomposition> lookup(double angle, double epsilon, bool ppr_basis)
+{
+    for (const Entry &entry : ENTRIES) {
+        if (entry.epsilon == epsilon && entry_angle(entry) == angle) {
+            if (ppr_basis) {
+                return Decomposition{entry.ppr_gates, entry.ppr_phase};
+            }
+            return Decomposition{entry.gates, entry.phase};
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Decodes a gate of a decomposition to its GateType or PPRGateType value.
+ */
+inline size_t decode_gate(char gate, bool ppr_basis)
+{
+    return static_cast<size_t>(gate - (ppr_basis ? 'a' : '0'));
+}
+
+} // namespace RSDecomp::GridsynthTable
@@ -0,0 +1,177 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "DataView.hpp"
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime {
+
+/**
+ * The marginal probabilities of a subset of qubits, computed from the probabilities of all qubits.
+ *
+ * Basis states use the first qubit as the most significant bit, both in the full and in the
+ * marginal distribution, and the kept qubits may be given in any order. Each basis state of the
+ * full distribution is mapped to its marginal state with one table lookup per byte of its index,
+ * instead of one bit test per kept qubit. When the kept qubits are consecutive and in order, the
+ * marginal states are contiguous blocks of the full distribution, which are summed directly.
+ * Large distributions are split into chunks that are reduced concurrently into private buffers.
+ */
+class ProbsMarginalizer final {
+  private:
+    // Distributions below this size are marginalized on the calling thread
+    static constexpr size_t MIN_PARALLEL_SIZE = size_t{1} << 18;
+    // Larger marginals would make the private buffers of the threads too costly
+    static constexpr size_t MAX_PARALLEL_MARGINAL_SIZE = size_t{1} << 16;
+
+    size_t num_qubits;
+    std::vector<size_t> positions;
+    // Marginal bits contributed by each value of each byte of a full index
+    std::vector<std::array<size_t, 256>> tables;
+    // The number of trailing qubits summed in each block, if the kept qubits are consecutive
+    std::optional<size_t> block_bits;
+
+    [[nodiscard]] auto toMarginalIndex(size_t idx) const -> size_t
+    {
+        size_t marginal = 0;
+        for (size_t byte = 0; byte < tables.size(); byte++) {
+            marginal |= tables[byte][(idx >> (8 * byte)) & 0xFF];
+        }
+        return marginal;
+    }
+
+    void accumulate(const double *probs, size_t begin, size_t end, double *marginals) const
+    {
+        if (block_bits) {
+            const size_t block_size = size_t{1} << *block_bits;
+            const size_t mask = (size_t{1} << positions.size()) - 1;
+            for (size_t block = begin; block < end; block += block_size) {
+                // Independent partial sums, which the compiler keeps in vector registers
+                std::array<double, 4> totals{};
+                size_t idx = block;
+                for (; idx + 4 <= block + block_size; idx += 4) {
+                    for (size_t lane = 0; lane < 4; lane++) {
+                        totals[lane] += probs[idx + lane];
+                    }
+                }
+                for (; idx < block + block_size; idx++) {
+                    totals[0] += probs[idx];
+                }
+                marginals[(block >> *block_bits) & mask] +=
+                    (totals[0] + totals[1]) + (totals[2] + totals[3]);
+            }
+            return;
+        }
+
+        for (size_t idx = begin; idx < end; idx++) {
+            marginals[toMarginalIndex(idx)] += probs[idx];
+        }
+    }
+
+  public:
+    /**
+     * @param num_qubits The number of qubits of the full distribution.
+     * @param positions The positions of the kept qubits in the full distribution, counted from
+     * the most significant bit.
+     */
+    ProbsMarginalizer(size_t num_qubits, std::vector<size_t> positions)
+        : num_qubits(num_qubits), positions(std::move(positions))
+    {
+        RT_FAIL_IF(num_qubits >= 64, "Too many qubits to compute marginal probabilities for");
+
+        const size_t num_kept = this->positions.size();
+        std::vector<bool> kept(num_qubits, false);
+        for (size_t pos : this->positions) {
+            RT_FAIL_IF(pos >= num_qubits || kept[pos], "Invalid qubits for marginal probabilities");
+            kept[pos] = true;
+        }
+
+        bool consecutive = true;
+        for (size_t i = 1; i < num_kept; i++) {
+            consecutive = consecutive && this->positions[i] == this->positions[i - 1] + 1;
+        }
+        if (consecutive && num_kept > 0) {
+            block_bits = num_qubits - this->positions.back() - 1;
+            return;
+        }
+
+        tables.resize((num_qubits + 7) / 8);
+        for (size_t i = 0; i < num_kept; i++) {
+            // Full and marginal bits are counted from the least significant bit
+            const size_t bit = num_qubits - 1 - this->positions[i];
+            const size_t marginal_bit = size_t{1} << (num_kept - 1 - i);
+            for (size_t value = 0; value < 256; value++) {
+                if ((value >> (bit % 8)) & 1) {
+                    tables[bit / 8][value] |= marginal_bit;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Marginalize the probabilities `probs` of all qubits into `marginals`.
+     */
+    void operator()(std::span<const double> probs, DataView<double, 1> &marginals) const
+    {
+        const size_t marginal_size = size_t{1} << positions.size();
+        RT_FAIL_IF(probs.size() != (size_t{1} << num_qubits),
+                   "Invalid size for the probabilities of all qubits");
+        RT_FAIL_IF(marginals.size() != marginal_size,
+                   "Invalid size for the pre-allocated probabilities");
+
+        const size_t block_size = block_bits ? size_t{1} << *block_bits : 1;
+        size_t num_threads = 1;
+        if (probs.size() >= MIN_PARALLEL_SIZE && marginal_size <= MAX_PARALLEL_MARGINAL_SIZE) {
+            num_threads = std::min<size_t>({std::max(std::thread::hardware_concurrency(), 1U),
+                                            probs.size() / MIN_PARALLEL_SIZE,
+                                            probs.size() / block_size});
+        }
+
+        std::vector<double> buffers(num_threads * marginal_size, 0);
+        // Chunks are whole blocks, so that each block is summed by a single thread
+        const size_t chunk = (probs.size() / block_size + num_threads - 1) / num_threads;
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < num_threads; t++) {
+            workers.emplace_back([&, t] {
+                const size_t begin = std::min(t * chunk * block_size, probs.size());
+                const size_t end = std::min(begin + chunk * block_size, probs.size());
+                accumulate(probs.data(), begin, end, buffers.data() + t * marginal_size);
+            });
+        }
+        accumulate(probs.data(), 0, std::min(chunk * block_size, probs.size()), buffers.data());
+        for (auto &worker : workers) {
+            worker.join();
+        }
+
+        for (size_t t = 1; t < num_threads; t++) {
+            for (size_t i = 0; i < marginal_size; i++) {
+                buffers[i] += buffers[t * marginal_size + i];
+            }
+        }
+        marginals.copy_from(buffers.begin());
+    }
+};
+
+} // namespace Catalyst::Runtime
@@ -23,6 +23,10 @@
 
 #include "Types.h"
 
+namespace Catalyst::Runtime::OQD {
+class OpenAPLWriter;
+} // namespace Catalyst::Runtime::OQD
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -43,8 +47,13 @@ struct Pulse {
 };
 
 // OQD Runtime Instructions
-void __catalyst__oqd__rt__initialize();
-void __catalyst__oqd__rt__finalize(const std::string &openapl_file_name);
+// Each device owns an OpenAPL program, which is written to `openapl_file_name`. Starting a
+// program binds it to the calling thread, to which the instructions below are then recorded.
+Catalyst::Runtime::OQD::OpenAPLWriter *
+__catalyst__oqd__rt__initialize(const std::string &openapl_file_name);
+void __catalyst__oqd__rt__start(Catalyst::Runtime::OQD::OpenAPLWriter *program);
+void __catalyst__oqd__rt__finish(Catalyst::Runtime::OQD::OpenAPLWriter *program);
+void __catalyst__oqd__rt__finalize(Catalyst::Runtime::OQD::OpenAPLWriter *program);
 void __catalyst__oqd__ion(const std::string &ion_specs);
 void __catalyst__oqd__modes(const std::vector<std::string> &phonon_specs);
 Pulse *__catalyst__oqd__pulse(QUBIT *qubit, double duration, double phase, Beam *beam);
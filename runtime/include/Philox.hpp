@@ -0,0 +1,139 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Catalyst::Runtime {
+
+/**
+ * A counter-based Philox4x32-10 random number engine.
+ *
+ * The output is a pure function of a 64-bit key, a 64-bit stream and a 64-bit position in the
+ * stream, so engines can be split into independent streams and jumped ahead in O(1) without any
+ * shared state. This makes it suitable for handing one reproducible stream to each thread or
+ * device that runs concurrently. The engine satisfies `UniformRandomBitGenerator` and can be used
+ * with the standard distributions.
+ */
+class PhiloxEngine {
+  public:
+    using result_type = uint32_t;
+    using Block = std::array<uint32_t, 4>;
+
+  private:
+    static constexpr uint32_t M0 = 0xD2511F53;
+    static constexpr uint32_t M1 = 0xCD9E8D57;
+    static constexpr uint32_t W0 = 0x9E3779B9;
+    static constexpr uint32_t W1 = 0xBB67AE85;
+    static constexpr size_t NUM_ROUNDS = 10;
+
+    uint64_t key;
+    uint64_t stream;
+    // Index of the next block to generate
+    uint64_t position{0};
+    Block buffer{};
+    size_t buffer_idx{4};
+
+    [[nodiscard]] static auto makeCounter(uint64_t lo, uint64_t hi) -> Block
+    {
+        return {static_cast<uint32_t>(lo), static_cast<uint32_t>(lo >> 32),
+                static_cast<uint32_t>(hi), static_cast<uint32_t>(hi >> 32)};
+    }
+
+    void refill()
+    {
+        buffer = generate(key, makeCounter(position, stream));
+        position++;
+        buffer_idx = 0;
+    }
+
+  public:
+    explicit PhiloxEngine(uint64_t key = 0, uint64_t stream = 0) : key(key), stream(stream) {}
+
+    /**
+     * @brief Apply the Philox4x32-10 bijection to `counter` under `key`.
+     */
+    [[nodiscard]] static auto generate(uint64_t key, Block counter) -> Block
+    {
+        uint32_t k0 = static_cast<uint32_t>(key);
+        uint32_t k1 = static_cast<uint32_t>(key >> 32);
+        for (size_t round = 0; round < NUM_ROUNDS; round++) {
+            if (round) {
+                k0 += W0;
+                k1 += W1;
+            }
+            const uint64_t p0 = static_cast<uint64_t>(M0) * counter[0];
+            const uint64_t p1 = static_cast<uint64_t>(M1) * counter[2];
+            counter = {static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ k0,
+                       static_cast<uint32_t>(p1),
+                       static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ k1,
+                       static_cast<uint32_t>(p0)};
+        }
+        return counter;
+    }
+
+    static constexpr auto min() -> result_type { return 0; }
+    static constexpr auto max() -> result_type { return std::numeric_limits<result_type>::max(); }
+
+    auto operator()() -> result_type
+    {
+        if (buffer_idx == 4) {
+            refill();
+        }
+        return buffer[buffer_idx++];
+    }
+
+    /**
+     * @brief Advance the engine by `z` outputs in constant time.
+     */
+    void discard(unsigned long long z)
+    {
+        for (; z && buffer_idx < 4; z--) {
+            buffer_idx++;
+        }
+        position += z / 4;
+        if (z % 4) {
+            refill();
+            buffer_idx = z % 4;
+        }
+    }
+
+    /**
+     * @brief Derive an independent engine for the sub-stream `id`.
+     *
+     * The child depends only on this engine's key and stream and on `id`, not on how many numbers
+     * have been drawn, so the same split always yields the same sequence regardless of the order
+     * in which concurrent workers are set up.
+     */
+    [[nodiscard]] auto split(uint64_t id) const -> PhiloxEngine
+    {
+        // Derive the child under a distinct key so it never overlaps this engine's own outputs.
+        const Block derived = generate(key ^ 0x5851F42D4C957F2DULL, makeCounter(id, stream));
+        return PhiloxEngine(derived[0] | (static_cast<uint64_t>(derived[1]) << 32),
+                            derived[2] | (static_cast<uint64_t>(derived[3]) << 32));
+    }
+
+    friend auto operator==(const PhiloxEngine &lhs, const PhiloxEngine &rhs) -> bool
+    {
+        // Compare the index of the next output, independently of whether its block is buffered
+        auto next = [](const PhiloxEngine &e) { return 4 * (e.position - 1) + e.buffer_idx; };
+        return lhs.key == rhs.key && lhs.stream == rhs.stream && next(lhs) == next(rhs);
+    }
+};
+
+} // namespace Catalyst::Runtime
@@ -14,13 +14,22 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <complex>
+#include <functional>
+#include <future>
 #include <optional>
 #include <random>
+#include <span>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "DataView.hpp"
 #include "Exception.hpp"
+#include "Marginals.hpp"
+#include "Philox.hpp"
 #include "Types.h"
 
 // A helper template macro to generate the <IDENTIFIER>Factory function by
@@ -34,6 +43,56 @@
 
 namespace Catalyst::Runtime {
 
+/**
+ * @brief Get the `NamedOperation` identifier of a gate opcode.
+ *
+ * @param id The gate opcode.
+ *
+ * @return `std::string_view` The gate name, as passed to `QuantumDevice::NamedOperation`.
+ */
+constexpr auto getGateName(GateId id) -> std::string_view
+{
+    constexpr std::array<std::string_view, static_cast<size_t>(GateId::NumGates)> names{
+        "Identity",
+        "PauliX",
+        "PauliY",
+        "PauliZ",
+        "Hadamard",
+        "S",
+        "T",
+        "PhaseShift",
+        "RX",
+        "RY",
+        "RZ",
+        "Rot",
+        "CNOT",
+        "CY",
+        "CZ",
+        "SWAP",
+        "IsingXX",
+        "IsingYY",
+        "IsingXY",
+        "IsingZZ",
+        "SingleExcitation",
+        "DoubleExcitation",
+        "ControlledPhaseShift",
+        "CRX",
+        "CRY",
+        "CRZ",
+        "MS",
+        "CRot",
+        "CSWAP",
+        "Toffoli",
+        "MultiRZ",
+        "GlobalPhase",
+        "PCPhase",
+        "ISWAP",
+        "PSWAP",
+    };
+    const auto idx = static_cast<size_t>(id);
+    return idx < names.size() ? names[idx] : std::string_view{};
+}
+
 /**
  * @brief Interface class for Catalyst Runtime device backends.
  *
@@ -87,6 +146,21 @@ struct QuantumDevice {
      */
     virtual auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> = 0;
 
+    /**
+     * @brief (Optional) Allocate an array of qubits, writing their IDs into `ids`.
+     *
+     * Same as `AllocateQubits` with `ids.size()` qubits, but fills the register storage of the
+     * runtime in place. Devices can override it to avoid building an intermediate vector.
+     *
+     * @param ids Pre-allocated buffer for the IDs of the new qubits.
+     */
+    virtual void AllocateQubitsInPlace(std::span<QubitIdType> ids)
+    {
+        const std::vector<QubitIdType> qubits = AllocateQubits(ids.size());
+        RT_FAIL_IF(qubits.size() != ids.size(), "Invalid number of allocated qubits");
+        std::copy(qubits.begin(), qubits.end(), ids.begin());
+    }
+
     /**
      * @brief Release an array of qubits.
      *
@@ -121,7 +195,7 @@ struct QuantumDevice {
      */
     virtual auto AllocateQubit() -> QubitIdType
     {
-        RT_FAIL("Dynamic qubit allocation is unsupported by device");
+        RT_UNSUPPORTED("Dynamic qubit allocation is unsupported by device");
     }
 
     /**
@@ -144,7 +218,7 @@ struct QuantumDevice {
      */
     virtual void ReleaseQubit(QubitIdType qubit)
     {
-        RT_FAIL("Dynamic qubit release is unsupported by device");
+        RT_UNSUPPORTED("Dynamic qubit release is unsupported by device");
     }
 
     // ----------------------------------------
@@ -193,6 +267,21 @@ struct QuantumDevice {
      */
     virtual void SetDevicePRNG(std::mt19937 *gen) {};
 
+    /**
+     * @brief (Optional) Set a counter-based random stream for the device.
+     *
+     * For seeded executions the runtime derives one Philox stream per device instance from
+     * the program seed, in addition to the shared generator passed to `SetDevicePRNG`. Unlike
+     * the shared generator, each stream is owned by a single device and its sequence depends
+     * only on the seed and the stream id, so devices that run concurrently on different threads
+     * (for example with async QNodes or parallel shots) stay reproducible without locking.
+     * The hook may be called again during execution via `__catalyst__rt__set_prng_stream`
+     * to move the device to another stream. It is not called for unseeded executions.
+     *
+     * @param engine The stream for this device, to be copied by the device.
+     */
+    virtual void SetDeviceStreamPRNG(const PhiloxEngine &engine) {};
+
     // ----------------------------------------
     //  QUANTUM OPERATIONS
     // ----------------------------------------
@@ -220,6 +309,113 @@ struct QuantumDevice {
                                 const std::vector<bool> &controlled_values = {},
                                 const std::vector<std::string> &optional_params = {}) = 0;
 
+    /**
+     * @brief (Optional) Apply a quantum gate identified by its opcode.
+     *
+     * This is the dispatch path used by the Catalyst Runtime C-API for all built-in gates. Unlike
+     * `NamedOperation`, the gate is identified by an integer opcode and all array arguments are
+     * non-owning views into caller-provided buffers, so no strings or vectors are constructed per
+     * gate. Devices are encouraged to override this method for low-overhead gate application; the
+     * views are only valid for the duration of the call.
+     *
+     * The default implementation forwards to `NamedOperation` using the gate names from
+     * `getGateName`.
+     *
+     * See `NamedOperation` for additional gate semantics.
+     *
+     * @param id The opcode of the operation to apply.
+     * @param params Float parameters for parametric gates (may be empty).
+     * @param wires Qubits to apply the operation to.
+     * @param inverse Apply the inverse (Hermitian adjoint) of the operation.
+     * @param controlled_wires Control qubits applied to the operation.
+     * @param controlled_values Control values associated to the control qubits (equal length).
+     */
+    virtual void GateOperation(GateId id, std::span<const double> params,
+                               std::span<const QubitIdType> wires, bool inverse = false,
+                               std::span<const QubitIdType> controlled_wires = {},
+                               std::span<const bool> controlled_values = {})
+    {
+        NamedOperation(std::string{getGateName(id)},
+                       std::vector<double>(params.begin(), params.end()),
+                       std::vector<QubitIdType>(wires.begin(), wires.end()), inverse,
+                       std::vector<QubitIdType>(controlled_wires.begin(), controlled_wires.end()),
+                       std::vector<bool>(controlled_values.begin(), controlled_values.end()));
+    }
+
+    /**
+     * @brief (Optional) Apply a Pauli product rotation given by a packed Pauli word.
+     *
+     * This is the dispatch path used by the Catalyst Runtime C-API for `PauliRot`, whose Pauli
+     * words are packed into bit masks by the compiler (see `UnpackPauliWord`), so that no string
+     * is parsed per rotation. The views are only valid for the duration of the call.
+     *
+     * The default implementation forwards to `NamedOperation` with the gate name `PauliRot` and
+     * the unpacked Pauli word as optional parameter.
+     *
+     * @param pauli_masks The X masks then the Z masks of the Pauli word on `wires`.
+     * @param theta The rotation angle.
+     * @param wires Qubits to apply the rotation to.
+     * @param inverse Apply the inverse (Hermitian adjoint) of the rotation.
+     * @param controlled_wires Control qubits applied to the rotation.
+     * @param controlled_values Control values associated to the control qubits (equal length).
+     */
+    virtual void PackedPauliRot(std::span<const uint64_t> pauli_masks, double theta,
+                                std::span<const QubitIdType> wires, bool inverse = false,
+                                std::span<const QubitIdType> controlled_wires = {},
+                                std::span<const bool> controlled_values = {})
+    {
+        NamedOperation("PauliRot", {theta}, std::vector<QubitIdType>(wires.begin(), wires.end()),
+                       inverse,
+                       std::vector<QubitIdType>(controlled_wires.begin(), controlled_wires.end()),
+                       std::vector<bool>(controlled_values.begin(), controlled_values.end()),
+                       {UnpackPauliWord(pauli_masks, wires.size())});
+    }
+
+    /**
+     * @brief (Optional) Apply a block of uncontrolled gates in program order.
+     *
+     * The Catalyst Runtime C-API calls this method for gate runs that the compiler packed into a
+     * single buffer (see the `batch-gates` option of `convert-quantum-to-llvm`). Devices with a
+     * high per-call cost, e.g. remote or Python-backed devices, can override it to submit the
+     * whole block at once. The parameters and wires of gate `i` immediately follow those of gate
+     * `i - 1` in `params` and `wires`; the sizes are validated by the caller.
+     *
+     * The default implementation calls `GateOperation` once per gate.
+     *
+     * @param gates Opcode, adjoint flag, and operand counts of each gate.
+     * @param params Float parameters of all gates, concatenated.
+     * @param wires Qubits of all gates, concatenated.
+     */
+    virtual void ApplyOperations(std::span<const BatchedGate> gates,
+                                 std::span<const double> params,
+                                 std::span<const QubitIdType> wires)
+    {
+        for (const auto &gate : gates) {
+            GateOperation(static_cast<GateId>(gate.opcode), params.first(gate.num_params),
+                          wires.first(gate.num_wires), static_cast<bool>(gate.adjoint));
+            params = params.subspan(gate.num_params);
+            wires = wires.subspan(gate.num_wires);
+        }
+    }
+
+    /**
+     * @brief (Optional) Start a batch of executions of the same circuit structure.
+     *
+     * The compiler runs the calls of a qnode in a loop, e.g. a `vmap` over a qnode, in a single
+     * device session (see the `batch-qnode-loops` pass): the device is initialized once, and then
+     * executes `batch_size` circuits that only differ by their parameters, each allocating and
+     * releasing its qubits, before `EndBatch`. Devices can use this hint to prepare for the whole
+     * batch, e.g. to reserve their state once or to vectorize across the batch.
+     *
+     * @param batch_size The number of executions in the batch.
+     */
+    virtual void StartBatch([[maybe_unused]] size_t batch_size) {}
+
+    /**
+     * @brief (Optional) End the batch of executions started by `StartBatch`.
+     */
+    virtual void EndBatch() {}
+
     /**
      * @brief Perform a computational-basis measurement on one qubit.
      *
@@ -235,6 +431,29 @@ struct QuantumDevice {
      */
     virtual auto Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result = 0;
 
+    /**
+     * @brief (Optional) Perform independent mid-circuit measurements on a group of qubits.
+     *
+     * The Catalyst Runtime C-API calls this method for runs of measurements that the compiler
+     * packed into a single buffer (see the `batch-measurements` option of `convert-mbqc-to-llvm`).
+     * No measurement of the group depends on the outcome of another, so devices with a high
+     * per-call cost can override it to perform the whole group at once.
+     *
+     * The default implementation calls `Measure` once per qubit.
+     *
+     * @param wires The qubits to measure.
+     * @param postselects Optional postselected outcome of each measurement.
+     * @param results The measurement results, of the same size as `wires`.
+     */
+    virtual void MeasureBatch(std::span<const QubitIdType> wires,
+                              std::span<const std::optional<int32_t>> postselects,
+                              std::span<Result> results)
+    {
+        for (size_t i = 0; i < wires.size(); i++) {
+            results[i] = Measure(wires[i], postselects[i]);
+        }
+    }
+
     /**
      * @brief (Optional) Apply an arbitrary unitary matrix to the device.
      *
@@ -254,7 +473,35 @@ struct QuantumDevice {
                                  const std::vector<QubitIdType> &controlled_wires = {},
                                  const std::vector<bool> &controlled_values = {})
     {
-        RT_FAIL("MatrixOperation is unsupported by device");
+        RT_UNSUPPORTED("MatrixOperation is unsupported by device");
+    }
+
+    /**
+     * @brief (Optional) Apply a given matrix directly from a view of the caller's buffer.
+     *
+     * This is the dispatch path used by the Catalyst Runtime C-API for `QubitUnitary`. The matrix
+     * is a (possibly strided) row-major view of the MemRef passed in by the program and is only
+     * valid for the duration of the call; devices overriding this method avoid copying the matrix
+     * on every application.
+     *
+     * The default implementation copies the matrix and the wires into vectors and forwards to
+     * `MatrixOperation`.
+     *
+     * @param matrix A view of the square matrix of size `2^len(wires) x 2^len(wires)`.
+     * @param wires Qubits to apply the operation to.
+     * @param inverse Apply the inverse (Hermitian adjoint) of the operation.
+     * @param controlled_wires Control qubits applied to the operation.
+     * @param controlled_values Control values associated to the control qubits (equal length).
+     */
+    virtual void MatrixOperationView(DataView<std::complex<double>, 2> &matrix,
+                                     std::span<const QubitIdType> wires, bool inverse = false,
+                                     std::span<const QubitIdType> controlled_wires = {},
+                                     std::span<const bool> controlled_values = {})
+    {
+        MatrixOperation(std::vector<std::complex<double>>(matrix.begin(), matrix.end()),
+                        std::vector<QubitIdType>(wires.begin(), wires.end()), inverse,
+                        std::vector<QubitIdType>(controlled_wires.begin(), controlled_wires.end()),
+                        std::vector<bool>(controlled_values.begin(), controlled_values.end()));
     }
 
     /**
@@ -272,7 +519,7 @@ struct QuantumDevice {
      */
     virtual void SetBasisState(DataView<int8_t, 1> &n, std::vector<QubitIdType> &wires)
     {
-        RT_FAIL("SetBasisState is unsupported by device");
+        RT_UNSUPPORTED("SetBasisState is unsupported by device");
     }
 
     /**
@@ -287,7 +534,51 @@ struct QuantumDevice {
      */
     virtual void SetState(DataView<std::complex<double>, 1> &state, std::vector<QubitIdType> &wires)
     {
-        RT_FAIL("SetState is unsupported by device");
+        RT_UNSUPPORTED("SetState is unsupported by device");
+    }
+
+    /**
+     * @brief (Optional) Initialize qubits to a computational basis state given by its index.
+     *
+     * Like `SetBasisState`, with the basis state packed into an integer whose most significant
+     * bit, among the `len(wires)` lowest ones, is the state of the first wire. By default, the bits
+     * are unpacked for `SetBasisState`.
+     *
+     * @param index The index of the basis state |index>.
+     * @param wires The qubits to initialize, at most 64.
+     */
+    virtual void SetBasisStateIndex(uint64_t index, std::vector<QubitIdType> &wires)
+    {
+        std::vector<int8_t> bits(wires.size());
+        for (size_t i = 0; i < wires.size(); i++) {
+            bits[i] = static_cast<int8_t>((index >> (wires.size() - 1 - i)) & 1);
+        }
+        DataView<int8_t, 1> view(bits);
+        SetBasisState(view, wires);
+    }
+
+    /**
+     * @brief (Optional) Initialize qubits to a quantum state given by its non-zero amplitudes.
+     *
+     * Like `SetState`, with only the amplitudes of the basis states in `indices`, all other
+     * amplitudes being zero. Devices that can initialize their state directly should override this
+     * method, as the default implementation builds the full state vector of size 2^len(wires) for
+     * `SetState`.
+     *
+     * @param indices The indices of the basis states with non-zero amplitudes.
+     * @param amplitudes The amplitude of each basis state in `indices`.
+     * @param wires The qubits to initialize.
+     */
+    virtual void SetSparseState(std::span<const int64_t> indices,
+                                std::span<const std::complex<double>> amplitudes,
+                                std::vector<QubitIdType> &wires)
+    {
+        std::vector<std::complex<double>> state(size_t{1} << wires.size());
+        for (size_t i = 0; i < indices.size(); i++) {
+            state[indices[i]] = amplitudes[i];
+        }
+        DataView<std::complex<double>, 1> view(state);
+        SetState(view, wires);
     }
 
     // ----------------------------------------
@@ -321,7 +612,30 @@ struct QuantumDevice {
     virtual auto Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
                             const std::vector<QubitIdType> &wires) -> ObsIdType
     {
-        RT_FAIL("Observable is unsupported by device");
+        RT_UNSUPPORTED("Observable is unsupported by device");
+    }
+
+    /**
+     * @brief (Optional) Construct a Hermitian observable from a view of the caller's buffer.
+     *
+     * This is the dispatch path used by the Catalyst Runtime C-API for Hermitian observables. The
+     * matrix view is only valid for the duration of the call, so devices overriding this method
+     * must copy the data they need to retain.
+     *
+     * The default implementation copies the matrix and the wires into vectors and forwards to
+     * `Observable` with `ObsId::Hermitian`.
+     *
+     * @param matrix A view of the square matrix of size `2^len(wires) x 2^len(wires)`.
+     * @param wires Qubits the observable acts on.
+     *
+     * @return `ObsIdType` ID of the constructed observable.
+     */
+    virtual auto HermitianObservableView(DataView<std::complex<double>, 2> &matrix,
+                                         std::span<const QubitIdType> wires) -> ObsIdType
+    {
+        return Observable(ObsId::Hermitian,
+                          std::vector<std::complex<double>>(matrix.begin(), matrix.end()),
+                          std::vector<QubitIdType>(wires.begin(), wires.end()));
     }
 
     /**
@@ -339,7 +653,7 @@ struct QuantumDevice {
      */
     virtual auto TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType
     {
-        RT_FAIL("TensorObservable is unsupported by device");
+        RT_UNSUPPORTED("TensorObservable is unsupported by device");
     }
 
     /**
@@ -359,7 +673,65 @@ struct QuantumDevice {
     virtual auto HamiltonianObservable(const std::vector<double> &coeffs,
                                        const std::vector<ObsIdType> &obs) -> ObsIdType
     {
-        RT_FAIL("HamiltonianObservable is unsupported by device");
+        RT_UNSUPPORTED("HamiltonianObservable is unsupported by device");
+    }
+
+    /**
+     * @brief (Optional) Construct a named observable from non-owning views.
+     *
+     * Like `Observable`, but for the matrix-free kinds {Identity, PauliX, PauliY, PauliZ,
+     * Hadamard} and with the target qubits passed as a view into a caller-provided buffer. This is
+     * the path used by the Catalyst Runtime C-API for named observables. The view is only valid
+     * for the duration of the call.
+     *
+     * The default implementation forwards to `Observable`.
+     *
+     * @param id The name of the observable.
+     * @param wires Qubits the observable applies to.
+     *
+     * @return `ObsIdType` ID of the constructed observable.
+     */
+    virtual auto NamedObservableView(ObsId id, std::span<const QubitIdType> wires) -> ObsIdType
+    {
+        return Observable(id, {}, std::vector<QubitIdType>(wires.begin(), wires.end()));
+    }
+
+    /**
+     * @brief (Optional) Construct a tensor product of existing observables from a non-owning view.
+     *
+     * Like `TensorObservable`, but with the observable IDs passed as a view into a caller-provided
+     * buffer. The view is only valid for the duration of the call.
+     *
+     * The default implementation forwards to `TensorObservable`.
+     *
+     * @param obs The list of observables IDs.
+     *
+     * @return `ObsIdType` ID of the constructed observable.
+     */
+    virtual auto TensorObservableView(std::span<const ObsIdType> obs) -> ObsIdType
+    {
+        return TensorObservable(std::vector<ObsIdType>(obs.begin(), obs.end()));
+    }
+
+    /**
+     * @brief (Optional) Construct a linear combination of existing observables from non-owning
+     * views.
+     *
+     * Like `HamiltonianObservable`, but with the coefficients and observable IDs passed as views
+     * into caller-provided buffers. The views are only valid for the duration of the call.
+     *
+     * The default implementation forwards to `HamiltonianObservable`.
+     *
+     * @param coeffs The list of coefficients.
+     * @param obs The list of observables IDs.
+     *
+     * @return `ObsIdType` ID of the constructed observable.
+     */
+    virtual auto HamiltonianObservableView(std::span<const double> coeffs,
+                                           std::span<const ObsIdType> obs) -> ObsIdType
+    {
+        return HamiltonianObservable(std::vector<double>(coeffs.begin(), coeffs.end()),
+                                     std::vector<ObsIdType>(obs.begin(), obs.end()));
     }
 
     // ----------------------------------------
@@ -390,7 +762,7 @@ struct QuantumDevice {
      */
     virtual void Sample(DataView<double, 2> &samples)
     {
-        RT_FAIL("Sample is unsupported by device");
+        RT_UNSUPPORTED("Sample is unsupported by device");
     }
 
     /**
@@ -403,7 +775,123 @@ struct QuantumDevice {
      */
     virtual void PartialSample(DataView<double, 2> &samples, const std::vector<QubitIdType> &wires)
     {
-        RT_FAIL("PartialSample is unsupported by device");
+        RT_UNSUPPORTED("PartialSample is unsupported by device");
+    }
+
+    /**
+     * @brief (Optional) Compute raw samples in chunks of bounded size.
+     *
+     * Like `Sample` and `PartialSample`, but rather than filling one buffer with every shot, the
+     * samples are handed to `callback` at most `chunk_shots` shots at a time, so that they can be
+     * reduced as they arrive with bounded memory. Each chunk uses the layout of `Sample` and is
+     * only valid for the duration of the callback.
+     *
+     * The default implementation draws every chunk with `Sample` or `PartialSample` by temporarily
+     * lowering the device shots. Devices that can produce samples incrementally may override it.
+     *
+     * @param wires Qubits to compute samples for, or all qubits if empty.
+     * @param chunk_shots The maximum number of shots per chunk.
+     * @param callback Invoked with each chunk of samples and its number of shots.
+     */
+    virtual void SampleChunked(const std::vector<QubitIdType> &wires, size_t chunk_shots,
+                               const std::function<void(DataView<double, 2> &, size_t)> &callback)
+    {
+        RT_FAIL_IF(!chunk_shots, "The number of shots per sample chunk must be positive");
+
+        const size_t shots = GetDeviceShots();
+        const size_t num_wires = wires.empty() ? GetNumQubits() : wires.size();
+        std::vector<double> buffer(std::min(shots, chunk_shots) * num_wires);
+
+        try {
+            for (size_t done = 0; done < shots; done += chunk_shots) {
+                const size_t num_shots = std::min(chunk_shots, shots - done);
+                const size_t sizes[2] = {num_shots, num_wires};
+                const size_t strides[2] = {num_wires, 1};
+                DataView<double, 2> chunk(buffer.data(), 0, sizes, strides);
+
+                SetDeviceShots(num_shots);
+                if (wires.empty()) {
+                    Sample(chunk);
+                }
+                else {
+                    PartialSample(chunk, wires);
+                }
+                callback(chunk, num_shots);
+            }
+        }
+        catch (...) {
+            SetDeviceShots(shots);
+            throw;
+        }
+        SetDeviceShots(shots);
+    }
+
+    /**
+     * @brief (Optional) Compute raw samples in a bit-packed format.
+     *
+     * Like `Sample` and `PartialSample`, but every measured bit occupies a single bit instead of a
+     * double. Each shot is stored in a row of `ceil(num_qubits / 64)` words, where bit `j % 64` of
+     * word `j / 64` holds the sample of the `j`-th requested qubit.
+     *
+     * The default implementation packs the output of `SampleChunked`, so that only a bounded chunk
+     * of unpacked samples is held in memory at any time.
+     *
+     * @param samples The pre-allocated buffer of shape (shots, ceil(num_qubits / 64)).
+     * @param wires Qubits to compute samples for, or all qubits if empty.
+     */
+    virtual void PackedSample(DataView<uint64_t, 2> &samples, const std::vector<QubitIdType> &wires)
+    {
+        constexpr size_t chunk_shots = 1024;
+
+        samples.fill(0);
+        size_t shot = 0;
+        SampleChunked(wires, chunk_shots, [&](DataView<double, 2> &chunk, size_t num_shots) {
+            const size_t num_wires = num_shots ? chunk.size() / num_shots : 0;
+            const double *bits = chunk.data();
+            for (size_t i = 0; i < num_shots; i++, shot++) {
+                for (size_t j = 0; j < num_wires; j++) {
+                    if (bits[i * num_wires + j] != 0.0) {
+                        samples(shot, j / 64) |= uint64_t{1} << (j % 64);
+                    }
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief (Optional) Submit the circuit for sampling without waiting for the results.
+     *
+     * Remote devices block in `Sample` and `PartialSample` until the provider returns the
+     * results. Devices that can run a circuit in the background should override this method to
+     * dispatch the job and return immediately, so that the program can submit other circuits or do
+     * classical work while the results are pending. The job must capture the circuit and the shot
+     * count at the time of submission: the program may continue to modify the device state before
+     * the future is awaited.
+     *
+     * The default implementation samples synchronously and returns a ready future.
+     *
+     * @param wires Qubits to compute samples for, or all qubits if empty.
+     *
+     * @return A future holding the samples of shape (shots, num_qubits) in row-major order.
+     */
+    virtual auto SubmitSample(const std::vector<QubitIdType> &wires)
+        -> std::future<std::vector<double>>
+    {
+        const size_t num_wires = wires.empty() ? GetNumQubits() : wires.size();
+        std::vector<double> buffer(GetDeviceShots() * num_wires);
+        const size_t sizes[2] = {GetDeviceShots(), num_wires};
+        const size_t strides[2] = {num_wires, 1};
+        DataView<double, 2> view(buffer.data(), 0, sizes, strides);
+        if (wires.empty()) {
+            Sample(view);
+        }
+        else {
+            PartialSample(view, wires);
+        }
+
+        std::promise<std::vector<double>> result;
+        result.set_value(std::move(buffer));
+        return result.get_future();
     }
 
     /**
@@ -435,12 +923,16 @@ struct QuantumDevice {
      * The results of this operation must be written into the `eigvals` and `counts` argument
      * buffers.
      *
+     * The default implementation accumulates the histogram from `SampleChunked` (see
+     * `AccumulateCounts`), so it only holds `2^n` counts plus one bounded chunk of samples. Devices
+     * that can count outcomes natively should override it.
+     *
      * @param eigvals The pre-allocated buffer for all measured states.
      * @param counts The pre-allocated buffer for all measured counts.
      */
     virtual void Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts)
     {
-        RT_FAIL("Counts is unsupported by device");
+        AccumulateCounts(eigvals, counts, {});
     }
 
     /**
@@ -455,7 +947,7 @@ struct QuantumDevice {
     virtual void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
                                const std::vector<QubitIdType> &wires)
     {
-        RT_FAIL("PartialCounts is unsupported by device");
+        AccumulateCounts(eigvals, counts, wires);
     }
 
     /**
@@ -469,19 +961,33 @@ struct QuantumDevice {
      *
      * @param probs The pre-allocated buffer for the probabilities.
      */
-    virtual void Probs(DataView<double, 1> &probs) { RT_FAIL("Probs is unsupported by device"); }
+    virtual void Probs(DataView<double, 1> &probs)
+    {
+        RT_UNSUPPORTED("Probs is unsupported by device");
+    }
 
     /**
      * @brief (Optional) Compute measurement probabilities for a quantum subsystem.
      *
      * Like `Probs`, but for a subset of currently allocated qubits.
      *
+     * By default, the probabilities of all qubits are computed with `Probs` and marginalized onto
+     * `wires` (see `ProbsMarginalizer`), at the positions of these qubits given by
+     * `GetQubitPositions`. Devices that can compute marginals directly should override this.
+     *
      * @param probs The pre-allocated buffer for the probabilities.
      * @param wires Qubits to compute probabilities for.
      */
     virtual void PartialProbs(DataView<double, 1> &probs, const std::vector<QubitIdType> &wires)
     {
-        RT_FAIL("PartialProbs is unsupported by device");
+        const size_t num_qubits = GetNumQubits();
+        const ProbsMarginalizer marginalize(num_qubits, GetQubitPositions(wires));
+
+        std::vector<double> all_probs(size_t{1} << num_qubits);
+        DataView<double, 1> view(all_probs);
+        Probs(view);
+
+        marginalize(all_probs, probs);
     }
     /**
      * @brief (Optional) Compute the expected value of an observable.
@@ -496,7 +1002,10 @@ struct QuantumDevice {
      *
      * @return `double` The expectation value of the observable.
      */
-    virtual auto Expval(ObsIdType obsKey) -> double { RT_FAIL("Expval is unsupported by device"); }
+    virtual auto Expval(ObsIdType obsKey) -> double
+    {
+        RT_UNSUPPORTED("Expval is unsupported by device");
+    }
 
     /**
      * @brief (Optional) Compute the variance of an observable.
@@ -511,7 +1020,41 @@ struct QuantumDevice {
      *
      * @return `double` The variance of the observable.
      */
-    virtual auto Var(ObsIdType obsKey) -> double { RT_FAIL("Var is unsupported by device"); }
+    virtual auto Var(ObsIdType obsKey) -> double { RT_UNSUPPORTED("Var is unsupported by device"); }
+
+    /**
+     * @brief (Optional) Compute both the expected value and the variance of an observable.
+     *
+     * Devices that get both moments from a single pass over the state, e.g. a single basis
+     * rotation or copy of the state for a Hermitian or tensor observable, should override this
+     * method. By default, it calls `Expval` and then `Var`.
+     *
+     * @param obsKey The ID of the constructed observable.
+     *
+     * @return The expectation value and the variance of the observable.
+     */
+    virtual auto ExpvalVar(ObsIdType obsKey) -> std::pair<double, double>
+    {
+        const double expval = Expval(obsKey);
+        return {expval, Var(obsKey)};
+    }
+
+    /**
+     * @brief (Optional) Compute the expected values of several observables.
+     *
+     * All observables are measured on the same quantum state, so that devices can share the
+     * basis rotations and state copies between observables on the same wires. By default, it
+     * calls `Expval` for each observable in turn.
+     *
+     * @param obsKeys The IDs of the constructed observables.
+     * @param expvals The pre-allocated buffer for the expectation value of each observable.
+     */
+    virtual void Expvals(std::span<const ObsIdType> obsKeys, std::span<double> expvals)
+    {
+        for (size_t i = 0; i < obsKeys.size(); i++) {
+            expvals[i] = Expval(obsKeys[i]);
+        }
+    }
 
     /**
      * @brief (Optional) Get the full quantum state of all qubits.
@@ -528,7 +1071,21 @@ struct QuantumDevice {
      */
     virtual void State(DataView<std::complex<double>, 1> &state)
     {
-        RT_FAIL("State is unsupported by device");
+        RT_UNSUPPORTED("State is unsupported by device");
+    }
+
+    /**
+     * @brief Borrow the device's own state-vector storage.
+     *
+     * Devices that store the state vector contiguously, as the `2^n` amplitudes returned by
+     * `State` and in the same order, can lend it to avoid copying the state into a separate
+     * buffer. The view is read-only and only valid until the next operation on the device.
+     *
+     * @return A view of the state vector, or an empty view if the device doesn't lend its storage.
+     */
+    [[nodiscard]] virtual auto GetStateView() const -> std::span<const std::complex<double>>
+    {
+        return {};
     }
 
     /**
@@ -543,7 +1100,22 @@ struct QuantumDevice {
     virtual auto PauliMeasure(const std::string &pauli_word, const std::vector<QubitIdType> &wires)
         -> Result
     {
-        RT_FAIL("PauliMeasure is unsupported by device");
+        RT_UNSUPPORTED("PauliMeasure is unsupported by device");
+    }
+
+    /**
+     * @brief (Optional) Perform a Pauli-basis measurement given by a packed Pauli word.
+     *
+     * Like `PauliMeasure`, with the Pauli word packed into bit masks by the compiler (see
+     * `UnpackPauliWord`). By default, the word is unpacked and measured with `PauliMeasure`.
+     *
+     * @param pauli_masks The X masks then the Z masks of the Pauli word on `wires`.
+     * @param wires The qubits to measure.
+     */
+    virtual auto PackedPauliMeasure(std::span<const uint64_t> pauli_masks,
+                                    const std::vector<QubitIdType> &wires) -> Result
+    {
+        return PauliMeasure(UnpackPauliWord(pauli_masks, wires.size()), wires);
     }
 
     // ----------------------------------------
@@ -577,7 +1149,7 @@ struct QuantumDevice {
     virtual void Gradient(std::vector<DataView<double, 1>> &gradients,
                           const std::vector<size_t> &trainParams)
     {
-        RT_FAIL("Differentiation is unsupported by device");
+        RT_UNSUPPORTED("Differentiation is unsupported by device");
     }
 
     /**
@@ -585,14 +1157,112 @@ struct QuantumDevice {
      *
      * See `Gradient` for additional information.
      */
-    virtual void StartTapeRecording() { RT_FAIL("Differentiation is unsupported by device"); }
+    virtual void StartTapeRecording()
+    {
+        RT_UNSUPPORTED("Differentiation is unsupported by device");
+    }
 
     /**
      * @brief (Optional) Stop recording a quantum tape if provided.
      *
      * See `Gradient` for additional information.
      */
-    virtual void StopTapeRecording() { RT_FAIL("Differentiation is unsupported by device"); }
+    virtual void StopTapeRecording() { RT_UNSUPPORTED("Differentiation is unsupported by device"); }
+
+    /**
+     * @brief (Optional) Checkpoint the state every `interval` operations of the recorded tape.
+     *
+     * Devices that support it store a snapshot of their state every `interval` operations during
+     * the forward pass, and recompute the segments between snapshots during the backward pass of
+     * `Gradient`, instead of keeping every intermediate state. An interval of about the square
+     * root of the circuit depth bounds the memory to O(sqrt(depth)) snapshots and segment states,
+     * for one extra forward pass. This is a hint that devices are free to ignore.
+     *
+     * @param interval The number of operations between two snapshots; 0 disables checkpointing.
+     */
+    virtual void SetTapeCheckpointInterval([[maybe_unused]] size_t interval) {}
+
+  protected:
+    /**
+     * @brief Unpack a Pauli word packed into bit masks.
+     *
+     * A Pauli word on `n` qubits is packed into `2 * ceil(n / 64)` words: the X masks followed by
+     * the Z masks, with qubit `i` at bit `i % 64` of word `i / 64` of each. The Pauli operator on
+     * a qubit is X if only its X bit is set, Z if only its Z bit is set, Y if both are set and
+     * the identity otherwise.
+     *
+     * @param pauli_masks The X masks then the Z masks of the Pauli word.
+     * @param num_qubits The number of qubits of the Pauli word.
+     * @return The Pauli word as a string of `I`, `X`, `Y` and `Z`.
+     */
+    [[nodiscard]] static auto UnpackPauliWord(std::span<const uint64_t> pauli_masks,
+                                              size_t num_qubits) -> std::string
+    {
+        const size_t num_words = (num_qubits + 63) / 64;
+        RT_FAIL_IF(pauli_masks.size() != 2 * num_words, "Invalid size for the packed Pauli word");
+
+        std::string pauli_word(num_qubits, 'I');
+        for (size_t i = 0; i < num_qubits; i++) {
+            const bool x = (pauli_masks[i / 64] >> (i % 64)) & 1;
+            const bool z = (pauli_masks[num_words + i / 64] >> (i % 64)) & 1;
+            pauli_word[i] = x ? (z ? 'Y' : 'X') : (z ? 'Z' : 'I');
+        }
+        return pauli_word;
+    }
+
+    /**
+     * @brief (Optional) Get the positions of qubits in the basis states of `Probs`.
+     *
+     * Positions are counted from the most significant bit of the basis states. This is only
+     * needed by the default implementation of `PartialProbs`.
+     *
+     * @param wires Qubits to get the positions of.
+     * @return The position of each qubit.
+     */
+    [[nodiscard]] virtual auto GetQubitPositions(const std::vector<QubitIdType> &wires)
+        -> std::vector<size_t>
+    {
+        RT_UNSUPPORTED("PartialProbs is unsupported by device");
+    }
+
+    /**
+     * @brief Compute sample counts directly from chunks of samples.
+     *
+     * Each chunk produced by `SampleChunked` is folded into the `counts` histogram as it arrives,
+     * with the first wire as the most significant bit of the basis state, so the full (shots,
+     * wires) sample matrix is never materialized.
+     *
+     * @param eigvals The pre-allocated buffer for all measured states.
+     * @param counts The pre-allocated buffer for all measured counts.
+     * @param wires Qubits to compute sample counts for, or all qubits if empty.
+     */
+    void AccumulateCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                          const std::vector<QubitIdType> &wires)
+    {
+        constexpr size_t chunk_shots = 1024;
+
+        const size_t num_wires = wires.empty() ? GetNumQubits() : wires.size();
+        RT_FAIL_IF(num_wires >= 64, "Too many qubits to compute sample counts for");
+        RT_FAIL_IF(eigvals.size() != (size_t{1} << num_wires) || counts.size() != eigvals.size(),
+                   "Invalid size for the pre-allocated counts");
+
+        size_t state = 0;
+        for (auto it = eigvals.begin(); it != eigvals.end(); ++it) {
+            *it = static_cast<double>(state++);
+        }
+        counts.fill(0);
+
+        SampleChunked(wires, chunk_shots, [&](DataView<double, 2> &chunk, size_t num_shots) {
+            const double *bits = chunk.data();
+            for (size_t i = 0; i < num_shots; i++) {
+                size_t basis_state = 0;
+                for (size_t j = 0; j < num_wires; j++) {
+                    basis_state = (basis_state << 1) | (bits[i * num_wires + j] != 0.0);
+                }
+                counts(basis_state) += 1;
+            }
+        });
+    }
 };
 
 } // namespace Catalyst::Runtime
@@ -27,12 +27,28 @@ void __catalyst__rt__fail_cstr(const char *);
 void __catalyst__rt__initialize(uint32_t *);
 void __catalyst__rt__device_init(int8_t *, int8_t *, int8_t *, int64_t, bool);
 void __catalyst__rt__device_release();
+void __catalyst__rt__device_start_batch(int64_t);
+void __catalyst__rt__device_end_batch();
 void __catalyst__rt__finalize();
 void __catalyst__rt__toggle_recorder(bool);
+void __catalyst__rt__toggle_measurement_tree(bool);
+void __catalyst__rt__toggle_shot_rejection(bool);
+bool __catalyst__rt__shot_accepted();
+double __catalyst__rt__shot_acceptance_rate();
+int64_t __catalyst__rt__memory_current_bytes();
+int64_t __catalyst__rt__memory_peak_bytes();
+int64_t __catalyst__rt__device_memory_peak_bytes();
+void __catalyst__rt__set_tape_checkpoint_interval(int64_t);
+void __catalyst__rt__set_prng_stream(int64_t);
+void __catalyst__rt__async_execute(void *, void (*)(void *));
+void __catalyst__rt__async_configure(int64_t, bool, int64_t);
 void __catalyst__rt__print_state();
 void __catalyst__rt__print_tensor(OpaqueMemRefT *, bool);
 void __catalyst__rt__print_string(char *);
 void __catalyst__rt__assert_bool(bool, char *);
+void __catalyst__rt__perf_counters_begin(const char *);
+void __catalyst__rt__perf_counters_end(const char *);
+void __catalyst__rt__perf_counters_write(const char *);
 int64_t __catalyst__rt__array_get_size_1d(QirArray *);
 int8_t *__catalyst__rt__array_get_element_ptr_1d(QirArray *, int64_t);
 void __catalyst__rt__array_update_element_1d(QirArray *, int64_t, QUBIT *);
@@ -51,6 +67,8 @@ RESULT *__catalyst__rt__result_get_zero();
 // Quantum Gate Set Instructions
 void __catalyst__qis__SetState(MemRefT_CplxT_double_1d *, uint64_t, ...);
 void __catalyst__qis__SetBasisState(MemRefT_int8_1d *, uint64_t, ...);
+void __catalyst__qis__SetSparseState(MemRefT_int64_1d *, MemRefT_CplxT_double_1d *, uint64_t, ...);
+void __catalyst__qis__SetBasisStateIndex(uint64_t, uint64_t, ...);
 void __catalyst__qis__Identity(const Modifiers *, int64_t, /* qubits */...);
 void __catalyst__qis__PauliX(QUBIT *, const Modifiers *);
 void __catalyst__qis__PauliY(QUBIT *, const Modifiers *);
@@ -83,17 +101,28 @@ void __catalyst__qis__CRot(double, double, double, QUBIT *, QUBIT *, const Modif
 void __catalyst__qis__CSWAP(QUBIT *, QUBIT *, QUBIT *, const Modifiers *);
 void __catalyst__qis__Toffoli(QUBIT *, QUBIT *, QUBIT *, const Modifiers *);
 void __catalyst__qis__MultiRZ(double, const Modifiers *, int64_t, /*qubits*/...);
+void __catalyst__qis__MultiRZ_array(double, const Modifiers *, int64_t, QUBIT **);
 void __catalyst__qis__GlobalPhase(double, const Modifiers *);
 void __catalyst__qis__PCPhase(double, double, const Modifiers *, int64_t, /*qubits*/...);
+void __catalyst__qis__PCPhase_array(double, double, const Modifiers *, int64_t, QUBIT **);
 void __catalyst__qis__ISWAP(QUBIT *, QUBIT *, const Modifiers *);
 void __catalyst__qis__PSWAP(double, QUBIT *, QUBIT *, const Modifiers *);
+void __catalyst__qis__ApplyBatch(int64_t, const BatchedGate *, int64_t, const double *, int64_t,
+                                 QUBIT **);
 void __catalyst__qis__PauliRot(const char *, double, const Modifiers *, bool, int64_t,
                                /*qubits*/...);
+void __catalyst__qis__PauliRot_array(const char *, double, const Modifiers *, bool, int64_t,
+                                     QUBIT **);
+// The Pauli word is packed into bit masks, see `QuantumDevice::UnpackPauliWord`.
+void __catalyst__qis__PackedPauliRot_array(const uint64_t *, double, const Modifiers *, bool,
+                                           int64_t, QUBIT **);
 
 // Struct pointer arguments for these instructions represent real arguments,
 // as passing structs by value is too unreliable / compiler dependant.
 void __catalyst__qis__QubitUnitary(MemRefT_CplxT_double_2d *, const Modifiers *, int64_t,
                                    /*qubits*/...);
+void __catalyst__qis__QubitUnitary_array(MemRefT_CplxT_double_2d *, const Modifiers *, int64_t,
+                                         QUBIT **);
 
 ObsIdType __catalyst__qis__NamedObs(int64_t, QUBIT *);
 ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *, int64_t, /*qubits*/...);
@@ -102,19 +131,54 @@ ObsIdType __catalyst__qis__HamiltonianObs(MemRefT_double_1d *, int64_t, /*obsKey
 
 // Struct pointers arguments here represent return values.
 RESULT *__catalyst__qis__Measure(QUBIT *, int32_t);
+bool __catalyst__qis__MeasureBit(QUBIT *, int32_t);
+void __catalyst__qis__MeasureBits(int64_t, QUBIT **, const int32_t *, uint64_t *);
 RESULT *__catalyst__qis__PauliMeasure(const char *, bool, const char *, bool, bool, int64_t,
                                       /*qubits*/...);
+RESULT *__catalyst__qis__PackedPauliMeasure(const uint64_t *, bool, const uint64_t *, bool, bool,
+                                            int64_t, /*qubits*/...);
 double __catalyst__qis__Expval(ObsIdType);
 double __catalyst__qis__Variance(ObsIdType);
+void __catalyst__qis__ExpvalVar(double *, ObsIdType);
+void __catalyst__qis__Expvals(double *, int64_t, /*obsKeys*/...);
 void __catalyst__qis__Probs(MemRefT_double_1d *, int64_t, /*qubits*/...);
+void __catalyst__qis__Probs_array(MemRefT_double_1d *, int64_t, QUBIT **);
 void __catalyst__qis__Sample(MemRefT_double_2d *, int64_t, /*qubits*/...);
+void __catalyst__qis__Sample_array(MemRefT_double_2d *, int64_t, QUBIT **);
+void __catalyst__qis__SampleChunked(SampleChunkCallback, void *, int64_t, int64_t,
+                                    /*qubits*/...);
+void __catalyst__qis__PackedSample(MemRefT_int64_2d *, int64_t, /*qubits*/...);
+int64_t __catalyst__qis__SubmitSample(int64_t, /*qubits*/...);
+void __catalyst__qis__AwaitSample(MemRefT_double_2d *, int64_t);
 void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *, int64_t, /*qubits*/...);
+void __catalyst__qis__Counts_array(PairT_MemRefT_double_int64_1d *, int64_t, QUBIT **);
 void __catalyst__qis__State(MemRefT_CplxT_double_1d *, int64_t, /*qubits*/...);
+void __catalyst__qis__State_array(MemRefT_CplxT_double_1d *, int64_t, QUBIT **);
+bool __catalyst__qis__StateView(MemRefT_CplxT_double_1d *);
 void __catalyst__qis__Gradient(int64_t, /*results*/...);
 void __catalyst__qis__Gradient_params(MemRefT_int64_1d *, int64_t, /*results*/...);
 
 // MBQC operations
 RESULT *__catalyst__mbqc__measure_in_basis(QUBIT *, uint32_t, double, int32_t);
+void __catalyst__mbqc__measure_in_basis_array(int64_t, QUBIT **, const uint32_t *, const double *,
+                                              const int32_t *, RESULT **);
+
+// Pauli frame operations
+void __catalyst__pf__init(QUBIT *);
+void __catalyst__pf__init_qreg(QirArray *);
+void __catalyst__pf__set(QUBIT *, bool, bool);
+void __catalyst__pf__update(QUBIT *, bool, bool);
+void __catalyst__pf__update_with_clifford(uint32_t, int64_t, QUBIT *, QUBIT *);
+uint8_t __catalyst__pf__read(QUBIT *);
+uint8_t __catalyst__pf__flush(QUBIT *);
+bool __catalyst__pf__correct_measurement(bool, QUBIT *);
+
+// QEC decoding operations
+int64_t __catalyst__qecp__decoder_create(const void *, int64_t, const void *, int64_t, int64_t);
+int64_t __catalyst__qecp__decoder_register(SyndromeDecoderCallback, void *, int64_t);
+void __catalyst__qecp__decoder_push(int64_t, const uint64_t *, int64_t, int64_t);
+int64_t __catalyst__qecp__decoder_pull(int64_t, int64_t *, int64_t);
+void __catalyst__qecp__decode_esm(int64_t, const bool *, int64_t, int64_t *, int64_t);
 
 // Async runtime error
 void __catalyst__host__rt__unrecoverable_error();
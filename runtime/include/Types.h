@@ -48,6 +48,57 @@ enum ObsType : int8_t {
     Hamiltonian,
 };
 
+// Gate opcodes for the string-free `QuantumDevice::GateOperation` dispatch.
+// The numeric values are part of the runtime ABI; append new gates before `NumGates` only.
+enum class GateId : int16_t {
+    Identity = 0,
+    PauliX,
+    PauliY,
+    PauliZ,
+    Hadamard,
+    S,
+    T,
+    PhaseShift,
+    RX,
+    RY,
+    RZ,
+    Rot,
+    CNOT,
+    CY,
+    CZ,
+    SWAP,
+    IsingXX,
+    IsingYY,
+    IsingXY,
+    IsingZZ,
+    SingleExcitation,
+    DoubleExcitation,
+    ControlledPhaseShift,
+    CRX,
+    CRY,
+    CRZ,
+    MS,
+    CRot,
+    CSWAP,
+    Toffoli,
+    MultiRZ,
+    GlobalPhase,
+    PCPhase,
+    ISWAP,
+    PSWAP,
+    NumGates,
+};
+
+// Header of one gate in a packed gate batch (see `__catalyst__qis__ApplyBatch`).
+// The parameters and wires of consecutive gates are stored back to back in two separate
+// contiguous buffers; all fields are 64-bit to keep the layout trivial to emit from the compiler.
+struct BatchedGate {
+    int64_t opcode; // GateId
+    int64_t adjoint;
+    int64_t num_params;
+    int64_t num_wires;
+};
+
 // complex<float> type
 struct CplxT_float {
     float real;
@@ -125,6 +176,15 @@ struct MemRefT_int64_1d {
     std::size_t strides[1];
 };
 
+// MemRefT<int64_t, dimension=2> type
+struct MemRefT_int64_2d {
+    int64_t *data_allocated;
+    int64_t *data_aligned;
+    std::size_t offset;
+    std::size_t sizes[2];
+    std::size_t strides[2];
+};
+
 // MemRefT<int64_t, dimension=1> type
 struct MemRefT_int8_1d {
     int8_t *data_allocated;
@@ -154,8 +214,19 @@ using MemRefT_CplxT_double_2d = struct MemRefT_CplxT_double_2d;
 using MemRefT_double_1d = struct MemRefT_double_1d;
 using MemRefT_double_2d = struct MemRefT_double_2d;
 using MemRefT_int64_1d = struct MemRefT_int64_1d;
+using MemRefT_int64_2d = struct MemRefT_int64_2d;
 using PairT_MemRefT_double_int64_1d = struct PairT_MemRefT_double_int64_1d;
 using Modifiers = struct Modifiers;
+using BatchedGate = struct BatchedGate;
+
+// Receives a row-major (shots x qubits) chunk of samples from `__catalyst__qis__SampleChunked`.
+using SampleChunkCallback = void (*)(void *context, const double *samples, int64_t numShots,
+                                     int64_t numQubits);
+
+// Decodes a round of `numChecks` bit-packed syndrome bits into the indices of the qubits to
+// correct, for the syndrome decoders registered with `__catalyst__qecp__decoder_register`.
+using SyndromeDecoderCallback = void (*)(void *context, const uint64_t *syndrome, int64_t numChecks,
+                                         int64_t *corrections);
 
 #ifdef __cplusplus
 } // extern "C"
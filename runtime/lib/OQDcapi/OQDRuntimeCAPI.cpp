@@ -14,99 +14,54 @@
 
 #include "OQDRuntimeCAPI.h"
 
-#include <fstream>
-#include <unordered_map>
+#include <string>
 #include <vector>
 
-#include "nlohmann/json.hpp"
-
 #include "Exception.hpp"
+#include "OpenAPLWriter.hpp"
 
-using json = nlohmann::json;
-
-static std::unique_ptr<json> JSON = nullptr;
-static std::unique_ptr<std::vector<Pulse *>> PulseGarbageCan = nullptr;
-static std::unique_ptr<std::unordered_map<Pulse *, bool>> PulseIsMeasurePulse = nullptr;
+using Catalyst::Runtime::OQD::OpenAPLWriter;
 
-template <typename T> json &numerical_json_factory(T value)
-{
-    static json j;
-    j["class_"] = "MathNum";
-    j["value"] = value;
-    return j;
-}
+// The program of the OQD device executing on this thread
+static thread_local OpenAPLWriter *CurrentProgram = nullptr;
 
-void to_json(json &j, const Pulse &p, bool is_measure_pulse = false)
+static auto getCurrentProgram() -> OpenAPLWriter &
 {
-    RT_FAIL_IF(p.target >= (*JSON)["system"]["ions"].size(), "ion index out of range");
-
-    const auto &transitions = (*JSON)["system"]["ions"][p.target]["transitions"];
-    RT_FAIL_IF(p.beam->transition_index < 0 ||
-                   static_cast<size_t>(p.beam->transition_index) >= transitions.size(),
-               "transition index out of range");
-
-    j = json{{"class_", is_measure_pulse ? "MeasurePulse" : "Pulse"}, {"duration", p.duration}};
-
-    json j_beam;
-    j_beam["class_"] = "Beam";
-    j_beam["target"] = p.target;
-    j_beam["polarization"] = p.beam->polarization;
-    j_beam["wavevector"] = p.beam->wavevector;
-    j_beam["rabi"] = numerical_json_factory<double>(p.beam->rabi);
-    j_beam["detuning"] = numerical_json_factory<double>(p.beam->detuning);
-    j_beam["phase"] = numerical_json_factory<double>(p.phase);
-    j_beam["transition"] = transitions[p.beam->transition_index];
-
-    j["beam"] = j_beam;
+    RT_FAIL_IF(!CurrentProgram, "No active OpenAPL program on this thread");
+    return *CurrentProgram;
 }
 
 extern "C" {
 
-void __catalyst__oqd__rt__initialize()
+OpenAPLWriter *__catalyst__oqd__rt__initialize(const std::string &openapl_file_name)
 {
-    PulseGarbageCan = std::make_unique<std::vector<Pulse *>>();
-    PulseIsMeasurePulse = std::make_unique<std::unordered_map<Pulse *, bool>>();
-
-    JSON = std::make_unique<json>();
-    (*JSON)["class_"] = "AtomicCircuit";
-
-    json system = R"({
-  "class_": "System",
-  "ions": [],
-  "modes": []
-})"_json;
-    (*JSON)["system"] = system;
-
-    // The main openapl program is a sequential protocol
-    // Each gate is a parallel protocol in the main sequential protocol
-    json protocol = R"({
-  "class_": "SequentialProtocol",
-  "sequence": []
-})"_json;
-    (*JSON)["protocol"] = protocol;
+    CurrentProgram = new OpenAPLWriter(openapl_file_name);
+    return CurrentProgram;
 }
 
-void __catalyst__oqd__rt__finalize(const std::string &openapl_file_name)
+void __catalyst__oqd__rt__start(OpenAPLWriter *program)
 {
-    for (auto pulse : *PulseGarbageCan) {
-        delete pulse;
-    }
-    PulseIsMeasurePulse->clear();
-
-    std::ofstream out_json(openapl_file_name);
-    out_json << JSON->dump(2);
-    JSON = nullptr;
+    CurrentProgram = program;
+    program->start();
 }
 
-void __catalyst__oqd__ion(const std::string &ion_specs)
+void __catalyst__oqd__rt__finish(OpenAPLWriter *program) { program->finish(); }
+
+void __catalyst__oqd__rt__finalize(OpenAPLWriter *program)
 {
-    (*JSON)["system"]["ions"].push_back(json::parse(ion_specs));
+    if (CurrentProgram == program) {
+        CurrentProgram = nullptr;
+    }
+    delete program;
 }
 
+void __catalyst__oqd__ion(const std::string &ion_specs) { getCurrentProgram().addIon(ion_specs); }
+
 void __catalyst__oqd__modes(const std::vector<std::string> &phonon_specs)
 {
-    for (auto phonon_spec : phonon_specs) {
-        (*JSON)["system"]["modes"].push_back(json::parse(phonon_spec));
+    auto &program = getCurrentProgram();
+    for (const auto &phonon_spec : phonon_specs) {
+        program.addMode(phonon_spec);
     }
 }
 
@@ -114,40 +69,20 @@ Pulse *__catalyst__oqd__pulse(QUBIT *qubit, double duration, double phase, Beam
 {
     size_t wire = reinterpret_cast<QubitIdType>(qubit);
 
-    // Since this is CAPI, we cannot return smart pointer.
-    // This means we have to new and delete manually.
-    Pulse *pulse = new Pulse({beam, wire, duration, phase});
-    PulseGarbageCan->push_back(pulse);
-    (*PulseIsMeasurePulse)[pulse] = false;
-    return pulse;
+    // Pulses are owned by the program, until it is finished.
+    return getCurrentProgram().createPulse(beam, wire, duration, phase, /*is_measure=*/false);
 }
 
 Pulse *__catalyst__oqd__measure_pulse(QUBIT *qubit, double duration, double phase, Beam *beam)
 {
     size_t wire = reinterpret_cast<QubitIdType>(qubit);
 
-    Pulse *pulse = new Pulse({beam, wire, duration, phase});
-    PulseGarbageCan->push_back(pulse);
-    (*PulseIsMeasurePulse)[pulse] = true;
-    return pulse;
+    return getCurrentProgram().createPulse(beam, wire, duration, phase, /*is_measure=*/true);
 }
 
 void __catalyst__oqd__ParallelProtocol(Pulse **pulses, size_t num_of_pulses)
 {
-    json j;
-    j["class_"] = "ParallelProtocol";
-
-    std::vector<json> pulses_json;
-    for (std::size_t i = 0; i < num_of_pulses; i++) {
-        Pulse *p = pulses[i];
-        bool is_measure = PulseIsMeasurePulse->count(p) ? (*PulseIsMeasurePulse)[p] : false;
-        json pj;
-        to_json(pj, *p, is_measure);
-        pulses_json.push_back(pj);
-    }
-    j["sequence"] = pulses_json;
-
-    (*JSON)["protocol"]["sequence"].push_back(j);
+    getCurrentProgram().addParallelProtocol(pulses, num_of_pulses);
 }
 
 bool __catalyst__oqd__readout_bit(QUBIT *qubit)
@@ -0,0 +1,88 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+namespace Catalyst::Runtime::OQD {
+
+/**
+ * An ion or phonon specification of the OpenAPL system, parsed from its JSON string.
+ */
+struct OQDSpec {
+    // The compact serialisation of the specification, as written into the system
+    std::string serialised;
+    // The compact serialisation of each transition of an ion
+    std::vector<std::string> transitions;
+};
+
+/**
+ * A cache of the parsed ion and phonon specifications, keyed by the hash of their JSON strings.
+ *
+ * The same large specifications are passed to every OQD device, and to every ion of a device,
+ * so that each distinct string is only parsed once per process. The cache is shared by the
+ * devices of all threads, and the parsed specifications are immutable.
+ */
+class OQDSpecCache {
+  private:
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const OQDSpec>> specs;
+
+  public:
+    /**
+     * @brief Get the parsed specification of a JSON string, parsing it on first use.
+     */
+    auto get(const std::string &json) -> std::shared_ptr<const OQDSpec>
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (auto it = specs.find(json); it != specs.end()) {
+            return it->second;
+        }
+
+        const auto parsed = nlohmann::json::parse(json);
+        auto spec = std::make_shared<OQDSpec>();
+        spec->serialised = parsed.dump();
+        if (parsed.contains("transitions")) {
+            for (const auto &transition : parsed["transitions"]) {
+                spec->transitions.push_back(transition.dump());
+            }
+        }
+        specs.emplace(json, spec);
+        return spec;
+    }
+
+    [[nodiscard]] auto size() -> size_t
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return specs.size();
+    }
+
+    /**
+     * @brief The cache shared by all the OQD devices of the process.
+     */
+    static auto global() -> OQDSpecCache &
+    {
+        static OQDSpecCache cache;
+        return cache;
+    }
+};
+
+} // namespace Catalyst::Runtime::OQD
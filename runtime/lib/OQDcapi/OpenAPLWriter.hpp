@@ -0,0 +1,264 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include "Exception.hpp"
+#include "OQDRuntimeCAPI.h"
+#include "OQDSpecCache.hpp"
+
+namespace Catalyst::Runtime::OQD {
+
+/**
+ * A streaming writer of OpenAPL `AtomicCircuit` programs.
+ *
+ * Only the system (ions and phonon modes) is kept, as pulses refer to its transitions, and its
+ * specifications are only parsed once per process (see `OQDSpecCache`). Each parallel protocol is
+ * serialised into a reused buffer and appended to the output file as soon as it is added, rather
+ * than accumulated into a document that is formatted at the end. Each device owns its writer, so
+ * concurrent devices write independent programs.
+ */
+class OpenAPLWriter {
+  private:
+    std::string file_name;
+    std::ofstream out;
+
+    std::vector<std::shared_ptr<const OQDSpec>> ions;
+    std::vector<std::shared_ptr<const OQDSpec>> modes;
+
+    bool started{false};
+    bool system_written{false};
+    size_t num_protocols{0};
+
+    // Pulses created through the C-API that have not been written yet, and the storage of written
+    // ones, which is reused for new pulses
+    struct PendingPulse {
+        std::unique_ptr<Pulse> pulse;
+        bool is_measure;
+    };
+    std::unordered_map<const Pulse *, PendingPulse> pending_pulses;
+    std::vector<std::unique_ptr<Pulse>> free_pulses;
+
+    std::string buffer;
+
+    void appendNumber(double value)
+    {
+        // JSON has no representation of non-finite numbers
+        if (!std::isfinite(value)) {
+            buffer.append("null");
+            return;
+        }
+
+        std::array<char, 32> digits{};
+        auto [end, ec] = std::to_chars(digits.begin(), digits.end(), value);
+        RT_ASSERT(ec == std::errc());
+        buffer.append(digits.begin(), end);
+        // Keep the number a float, as nlohmann::json serialises it
+        if (std::string_view(digits.begin(), end).find_first_of(".e") == std::string_view::npos) {
+            buffer.append(".0");
+        }
+    }
+
+    template <typename T> void appendInteger(T value)
+    {
+        std::array<char, 24> digits{};
+        auto [end, ec] = std::to_chars(digits.begin(), digits.end(), value);
+        RT_ASSERT(ec == std::errc());
+        buffer.append(digits.begin(), end);
+    }
+
+    void appendMathNum(const char *key, double value)
+    {
+        buffer.append(",\"").append(key).append("\":{\"class_\":\"MathNum\",\"value\":");
+        appendNumber(value);
+        buffer.append("}");
+    }
+
+    void appendVector(const char *key, const std::array<int64_t, 3> &vec)
+    {
+        buffer.append(",\"").append(key).append("\":[");
+        for (size_t i = 0; i < vec.size(); i++) {
+            buffer.append(i ? "," : "");
+            appendInteger(vec[i]);
+        }
+        buffer.append("]");
+    }
+
+    void appendPulse(const Pulse &p)
+    {
+        RT_FAIL_IF(p.target >= ions.size(), "ion index out of range");
+        const auto &ion_transitions = ions[p.target]->transitions;
+        RT_FAIL_IF(p.beam->transition_index < 0 ||
+                       static_cast<size_t>(p.beam->transition_index) >= ion_transitions.size(),
+                   "transition index out of range");
+
+        buffer.append("{\"class_\":\"");
+        auto it = pending_pulses.find(&p);
+        const bool is_measure = it != pending_pulses.end() && it->second.is_measure;
+        buffer.append(is_measure ? "MeasurePulse" : "Pulse");
+        buffer.append("\",\"duration\":");
+        appendNumber(p.duration);
+
+        buffer.append(",\"beam\":{\"class_\":\"Beam\",\"target\":");
+        appendInteger(p.target);
+        appendVector("polarization", p.beam->polarization);
+        appendVector("wavevector", p.beam->wavevector);
+        appendMathNum("rabi", p.beam->rabi);
+        appendMathNum("detuning", p.beam->detuning);
+        appendMathNum("phase", p.phase);
+        buffer.append(",\"transition\":");
+        buffer.append(ion_transitions[p.beam->transition_index]);
+        buffer.append("}}");
+    }
+
+    void writeSpecs(const std::vector<std::shared_ptr<const OQDSpec>> &specs)
+    {
+        out << "[";
+        for (size_t i = 0; i < specs.size(); i++) {
+            out << (i ? "," : "") << specs[i]->serialised;
+        }
+        out << "]";
+    }
+
+    void writeSystem()
+    {
+        out << "{\"class_\":\"AtomicCircuit\",\"system\":{\"class_\":\"System\",\"ions\":";
+        writeSpecs(ions);
+        out << ",\"modes\":";
+        writeSpecs(modes);
+        out << "},\"protocol\":{\"class_\":\"SequentialProtocol\",\"sequence\":[";
+        system_written = true;
+    }
+
+  public:
+    explicit OpenAPLWriter(const std::string &_file_name) : file_name(_file_name) {}
+    ~OpenAPLWriter() { finish(); }
+
+    OpenAPLWriter(const OpenAPLWriter &) = delete;
+    OpenAPLWriter &operator=(const OpenAPLWriter &) = delete;
+
+    [[nodiscard]] auto getFileName() const -> const std::string & { return file_name; }
+
+    /**
+     * @brief Start a new program, overwriting the output file of any previous one.
+     */
+    void start()
+    {
+        finish();
+        out.open(file_name, std::ios::out | std::ios::trunc);
+        RT_FAIL_IF(!out.is_open(), "Failed to open the OpenAPL output file");
+        started = true;
+    }
+
+    /**
+     * @brief Complete the program and close the output file.
+     */
+    void finish()
+    {
+        if (!started) {
+            return;
+        }
+        if (!system_written) {
+            writeSystem();
+        }
+        out << "]}}\n";
+        out.close();
+
+        ions.clear();
+        modes.clear();
+        pending_pulses.clear();
+        free_pulses.clear();
+        started = false;
+        system_written = false;
+        num_protocols = 0;
+    }
+
+    void addIon(const std::string &ion_specs)
+    {
+        RT_FAIL_IF(system_written, "Cannot add an ion after the OpenAPL protocol has started");
+
+        ions.push_back(OQDSpecCache::global().get(ion_specs));
+    }
+
+    void addMode(const std::string &phonon_specs)
+    {
+        RT_FAIL_IF(system_written, "Cannot add a mode after the OpenAPL protocol has started");
+        modes.push_back(OQDSpecCache::global().get(phonon_specs));
+    }
+
+    auto createPulse(Beam *beam, size_t target, double duration, double phase, bool is_measure)
+        -> Pulse *
+    {
+        std::unique_ptr<Pulse> pulse;
+        if (free_pulses.empty()) {
+            pulse = std::make_unique<Pulse>();
+        }
+        else {
+            pulse = std::move(free_pulses.back());
+            free_pulses.pop_back();
+        }
+        *pulse = Pulse{beam, target, duration, phase};
+
+        Pulse *ptr = pulse.get();
+        pending_pulses.emplace(ptr, PendingPulse{std::move(pulse), is_measure});
+        return ptr;
+    }
+
+    /**
+     * @brief Append a `ParallelProtocol` of the given pulses to the main sequential protocol.
+     *
+     * Pulses created by this writer are released once written, so they must not be reused.
+     */
+    void addParallelProtocol(Pulse **protocol_pulses, size_t num_pulses)
+    {
+        RT_FAIL_IF(!started, "The OpenAPL program has not been started");
+
+        buffer.clear();
+        buffer.append(num_protocols ? "," : "");
+        buffer.append("{\"class_\":\"ParallelProtocol\",\"sequence\":[");
+        for (size_t i = 0; i < num_pulses; i++) {
+            buffer.append(i ? "," : "");
+            appendPulse(*protocol_pulses[i]);
+        }
+        buffer.append("]}");
+
+        // Only write out complete protocols, so that invalid pulses leave the program unchanged
+        if (!system_written) {
+            writeSystem();
+        }
+        out << buffer;
+        num_protocols++;
+
+        for (size_t i = 0; i < num_pulses; i++) {
+            auto it = pending_pulses.find(protocol_pulses[i]);
+            if (it != pending_pulses.end()) {
+                free_pulses.push_back(std::move(it->second.pulse));
+                pending_pulses.erase(it);
+            }
+        }
+    }
+};
+
+} // namespace Catalyst::Runtime::OQD
@@ -0,0 +1,122 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Generates runtime/include/GridsynthTable.def on the standard output:
+//
+//     cmake --build <build> --target generate_gridsynth_table
+//     <path/to>/generate_gridsynth_table > runtime/include/GridsynthTable.def
+//
+// The decompositions are searched for directly, rather than through `eval_ross_algorithm`, so that
+// the entries of an existing table are never copied into a new one. Increase
+// GRIDSYNTH_TABLE_VERSION whenever the output changes.
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "RSDecomp.hpp"
+
+using namespace RSDecomp::RossSelinger;
+
+namespace {
+
+constexpr std::array<int, 4> MULTIPLES = {1, -1, 3, -3};
+constexpr int MIN_LOG2_DENOMINATOR = 3;
+constexpr int MAX_LOG2_DENOMINATOR = 16;
+
+struct Precision {
+    std::string_view name;
+    double value;
+};
+constexpr std::array<Precision, 5> PRECISIONS = {
+    Precision{"1e-2", 1e-2}, Precision{"1e-3", 1e-3}, Precision{"1e-4", 1e-4},
+    Precision{"1e-5", 1e-5}, Precision{"1e-6", 1e-6}};
+
+constexpr std::string_view HEADER = R"(// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Precomputed gridsynth decompositions, version 1 (see GRIDSYNTH_TABLE_VERSION).
+//
+// GRIDSYNTH_TABLE_ENTRY(multiple, log2_denominator, epsilon, phase, gates, ppr_phase, ppr_gates)
+//
+// Entries for the angles m * pi / 2^k with m in {1, -1, 3, -3} and 3 <= k <= 16, at the
+// precisions 1e-2 to 1e-6, as returned by `eval_ross_algorithm` and `eval_ross_algorithm_ppr` of
+// the RS decomposition runtime. The gates are encoded as described in GridsynthTable.hpp.
+//
+// This file is generated by runtime/lib/RSDecompRuntime/GenerateGridsynthTable.cpp. It is
+// included without an include guard, and must define GRIDSYNTH_TABLE_ENTRY first.
+
+)";
+
+/**
+ * @brief Formats a double with enough digits to read back to the same value.
+ */
+std::string format_double(double value)
+{
+    std::array<char, 32> buffer;
+    std::snprintf(buffer.data(), buffer.size(), "%.17g", value);
+    return buffer.data();
+}
+
+template <typename Gate> std::string encode_gates(const std::vector<Gate> &gates, char first)
+{
+    std::string encoded;
+    encoded.reserve(gates.size());
+    for (Gate gate : gates) {
+        encoded.push_back(static_cast<char>(first + static_cast<int>(gate)));
+    }
+    return encoded;
+}
+
+} // namespace
+
+int main()
+{
+    std::cout << HEADER;
+    for (int log2_denominator = MIN_LOG2_DENOMINATOR; log2_denominator <= MAX_LOG2_DENOMINATOR;
+         log2_denominator++) {
+        for (int multiple : MULTIPLES) {
+            // Computed as in GridsynthTable::entry_angle
+            const double angle = std::ldexp(multiple * M_PI, -log2_denominator);
+            for (const Precision &precision : PRECISIONS) {
+                const auto [gates, phase] =
+                    compute_clifford_T_decomposition(angle, precision.value);
+                // The PPR decompositions are converted as in eval_ross_algorithm_ppr
+                const auto [ppr_gates, ppr_phase_update] = HST_to_PPR(gates);
+
+                std::cout << "GRIDSYNTH_TABLE_ENTRY(" << multiple << ", " << log2_denominator
+                          << ", " << precision.name << ", " << format_double(phase) << ", \""
+                          << encode_gates(gates, '0') << "\", "
+                          << format_double(phase + ppr_phase_update) << ", \""
+                          << encode_gates(ppr_gates, 'a') << "\")\n";
+            }
+        }
+    }
+    return 0;
+}
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <complex>
 #include <optional>
@@ -109,8 +110,11 @@ inline int bbox_grid_points(const bbox &bbox)
  */
 class one_dim_problem_solution_iterator {
   private:
+    // Number of candidate 'b' values that are checked together.
+    static constexpr long BATCH_SIZE = 32;
+
     // --- State for the iteration ---
-    long b_current; // The current 'b' value in the main loop
+    long b_current; // The next 'b' value to be added to a batch
     long b_min;     // The minimum 'b' to check
 
     // --- Scaled problem parameters (calculated once in constructor) ---
@@ -121,54 +125,83 @@ class one_dim_problem_solution_iterator {
     ZSqrtTwo current_solution;
     bool is_done = false;
 
+    // --- Valid (a, b) pairs of the current batch, in decreasing order of 'b' ---
+    std::array<std::pair<long, long>, BATCH_SIZE> batch;
+    size_t batch_size = 0;
+    size_t batch_idx = 0;
+
     /**
-     * @brief Encapsulates the main loop logic.
-     * It searches for the next valid solution starting from b_current.
+     * @brief Checks the next batch of candidates for 'b', until one of them yields a valid
+     * (a, b) or all of them are exhausted.
+     *
+     * The bounds of each candidate are computed in a branch-free loop over the whole batch, so
+     * that the compiler can vectorise it, and only the valid pairs are collected afterwards.
      */
-    void find_next_solution()
+    void fill_batch()
     {
-        for (long b = b_current; b >= b_min; b--) {
-            // Use the constraints x0 <= a + b * sqrt(2) <= x1 to obtain the bounds on a.
-            double lower_bound_a = x0_scaled - b * M_SQRT2;
-            double upper_bound_a = x1_scaled - b * M_SQRT2;
-
-            RT_FAIL_IF(upper_bound_a - lower_bound_a >= 1.0,
-                       "Scaled interval width for 'a' should be less than one.");
-
-            // Check if the bounds on the interval contains an integer.
-            if (std::ceil(lower_bound_a) == std::floor(upper_bound_a)) {
-                long a = static_cast<long>(std::ceil(lower_bound_a));
-
-                // Check if the solution satisfies both bounds on x and y.
-                if ((x0_scaled + y0_scaled <= 2.0 * a) && (2.0 * a <= x1_scaled + y1_scaled)) {
-                    double alpha = a + b * M_SQRT2;
-                    double beta = a - b * M_SQRT2;
-
-                    // Check if the consecutive solutions are within the desired bounds.
-                    if (x0_scaled <= alpha && alpha <= x1_scaled && y0_scaled <= beta &&
-                        beta <= y1_scaled) {
-                        // A valid (a, b) has been found.
-
-                        // Undo the scaling to obtain the solution.
-                        ZSqrtTwo sol_scaled(a, b);
-                        current_solution =
-                            (k1 < 0) ? (sol_scaled / s_scale) : (sol_scaled * s_scale);
-
-                        // Check if we need to apply the sqrt(2) conjugation (yield sol.adj2()).
-                        if (f_adj2) {
-                            current_solution = current_solution.adj2();
-                        }
-
-                        // Set state for the next call to find_next_solution()
-                        b_current = b - 1;
-                        return; // Exit, preserving the state for the next ++ operation.
-                    }
+        batch_size = 0;
+        batch_idx = 0;
+
+        std::array<double, BATCH_SIZE> a_values;
+        std::array<bool, BATCH_SIZE> is_valid;
+
+        while (batch_size == 0 && b_current >= b_min) {
+            const long count = std::min(BATCH_SIZE, b_current - b_min + 1);
+
+            for (long i = 0; i < count; i++) {
+                const double b_sqrt2 = static_cast<double>(b_current - i) * M_SQRT2;
+
+                // Use the constraints x0 <= a + b * sqrt(2) <= x1 to obtain the bounds on a.
+                // As the interval is narrower than one, it contains an integer iff the ceiling
+                // of its lower bound does not exceed its upper bound.
+                const double a = std::ceil(x0_scaled - b_sqrt2);
+                const double alpha = a + b_sqrt2;
+                const double beta = a - b_sqrt2;
+
+                // Check if the solution satisfies both bounds on x and y, and if the
+                // consecutive solutions are within the desired bounds.
+                a_values[i] = a;
+                is_valid[i] = (a <= x1_scaled - b_sqrt2) & (x0_scaled + y0_scaled <= 2.0 * a) &
+                              (2.0 * a <= x1_scaled + y1_scaled) & (x0_scaled <= alpha) &
+                              (alpha <= x1_scaled) & (y0_scaled <= beta) & (beta <= y1_scaled);
+            }
+
+            for (long i = 0; i < count; i++) {
+                if (is_valid[i]) {
+                    batch[batch_size++] = {static_cast<long>(a_values[i]), b_current - i};
                 }
             }
+            b_current -= count;
         }
+    }
 
-        // If the loop completes, no more solutions can be found.
-        is_done = true;
+    /**
+     * @brief Encapsulates the main loop logic.
+     * It yields the next valid solution from the current batch, refilling it when exhausted.
+     */
+    void find_next_solution()
+    {
+        if (batch_idx == batch_size) {
+            fill_batch();
+        }
+
+        // If no batch has a valid pair, no more solutions can be found.
+        if (batch_idx == batch_size) {
+            is_done = true;
+            return;
+        }
+
+        // A valid (a, b) has been found.
+        auto [a, b] = batch[batch_idx++];
+
+        // Undo the scaling to obtain the solution.
+        ZSqrtTwo sol_scaled(a, b);
+        current_solution = (k1 < 0) ? (sol_scaled / s_scale) : (sol_scaled * s_scale);
+
+        // Check if we need to apply the sqrt(2) conjugation (yield sol.adj2()).
+        if (f_adj2) {
+            current_solution = current_solution.adj2();
+        }
     }
 
   public:
@@ -253,6 +286,10 @@ class one_dim_problem_solution_iterator {
             return;
         }
 
+        // The interval on 'a' has the same width for every 'b'.
+        RT_FAIL_IF(x1_scaled - x0_scaled >= 1.0,
+                   "Scaled interval width for 'a' should be less than one.");
+
         // Find the very first solution
         find_next_solution();
     }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <optional>
 #include <random>
 #include <tuple>
@@ -62,8 +63,10 @@ inline bool primality_test(INT_TYPE n)
         return *val_opt;
     }
 
-    // 25 iterations provides a very high probability of correctness
-    if (boost::multiprecision::miller_rabin_test(n, 25)) {
+    // 25 iterations provides a very high probability of correctness. Use one generator per
+    // thread, since the default one of boost is shared.
+    thread_local boost::random::mt19937 gen;
+    if (boost::multiprecision::miller_rabin_test(n, 25, gen)) {
         cache.put(n, true);
         return true;
     }
@@ -176,62 +179,49 @@ inline std::optional<INT_TYPE> sqrt_modulo_p(INT_TYPE n, INT_TYPE p)
 }
 
 /**
- * @brief Computes an integer factor of a number n.
+ * @brief Runs the Brent's variant of the Pollard's rho algorithm on the integers of type T.
  *
- * This function implements the Brent's variant of the Pollard's rho algorithm
- * for integer factorization.
- * Ref: https://doi.org/10.1007/BF01933190
+ * The products of two residues are reduced in WideT, which must hold the square of n.
  *
- * @param n The number to factor.
+ * @param n The odd number to factor.
  * @param max_trials The maximum number of attempts to find a factor.
  * @return An integer factor of n, or std::nullopt if no factors are found.
  */
-inline std::optional<INT_TYPE> integer_factorize(INT_TYPE n, int max_trials)
+template <typename T, typename WideT> std::optional<T> brent_factorize(T n, int max_trials)
 {
-    static lru_cache<std::pair<INT_TYPE, int>, std::optional<INT_TYPE>, FACTORING_CACHE_SIZE> cache;
-    auto cache_key = std::make_pair(n, max_trials);
-
-    if (auto val_opt = cache.get(cache_key); val_opt) {
-        return *val_opt;
-    }
-
-    if (n <= 2) {
-        cache.put(cache_key, std::nullopt);
-        return std::nullopt;
-    }
-    if (n % 2 == 0) {
-        cache.put(cache_key, INT_TYPE(2));
-        return INT_TYPE(2);
-    }
+    auto mul_mod = [&n](const T &x, const T &y) {
+        return static_cast<T>(WideT(x) * WideT(y) % WideT(n));
+    };
 
-    static boost::random::mt11213b gen(std::random_device{}());
+    // One generator per thread, since decompositions may be solved in parallel
+    thread_local boost::random::mt11213b gen(std::random_device{}());
 
     // Main loop: retry with different parameters on failure
     while (max_trials-- > 0) {
-        INT_TYPE n_minus_1 = n - 1;
-        boost::random::uniform_int_distribution<INT_TYPE> dist(1, n_minus_1);
+        T n_minus_1 = n - 1;
+        boost::random::uniform_int_distribution<T> dist(1, n_minus_1);
 
-        INT_TYPE y = dist(gen);
-        INT_TYPE c = dist(gen);
-        INT_TYPE m = dist(gen);
+        T y = dist(gen);
+        T c = dist(gen);
+        T m = dist(gen);
 
-        INT_TYPE g = 1, r = 1, q = 1, x = y, xs;
+        T g = 1, r = 1, q = 1, x = y, xs;
 
         while (g == 1) {
             x = y;
             // Process next `r` steps
-            for (INT_TYPE i = 0; i < r; ++i)
-                y = ((y * y) % n + c) % n;
+            for (T i = 0; i < r; ++i)
+                y = (mul_mod(y, y) + c) % n;
 
-            INT_TYPE k = 0;
+            T k = 0;
             while (k < r && g == 1) {
                 xs = y;
                 // Process next `min(m, r-k)` steps
-                INT_TYPE loop_limit = min(m, r - k);
-                for (INT_TYPE i = 0; i < loop_limit; ++i) {
-                    y = ((y * y) % n + c) % n;
-                    INT_TYPE diff = x > y ? x - y : y - x;
-                    q = (q * diff) % n;
+                T loop_limit = Utils::min<T>(m, r - k);
+                for (T i = 0; i < loop_limit; ++i) {
+                    y = (mul_mod(y, y) + c) % n;
+                    T diff = x > y ? x - y : y - x;
+                    q = mul_mod(q, diff);
                 }
                 g = gcd(q, n);
                 k += m;
@@ -244,23 +234,69 @@ inline std::optional<INT_TYPE> integer_factorize(INT_TYPE n, int max_trials)
             g = 1;
             y = xs;
             while (g == 1) {
-                y = ((y * y) % n + c) % n;
-                INT_TYPE diff = x > y ? x - y : y - x;
+                y = (mul_mod(y, y) + c) % n;
+                T diff = x > y ? x - y : y - x;
                 g = gcd(diff, n);
             }
         }
 
         // If we found a valid integer factor, such that it is neither 1 nor n.
         if (g != 1 && g != n) {
-            cache.put(cache_key, g);
             return g;
         }
     }
-
-    cache.put(cache_key, std::nullopt);
     return std::nullopt;
 }
 
+/**
+ * @brief Computes an integer factor of a number n.
+ *
+ * This function implements the Brent's variant of the Pollard's rho algorithm
+ * for integer factorization. Numbers that fit in 63 bits are factored with native
+ * integers, and larger ones with multiprecision integers.
+ * Ref: https://doi.org/10.1007/BF01933190
+ *
+ * @param n The number to factor.
+ * @param max_trials The maximum number of attempts to find a factor.
+ * @return An integer factor of n, or std::nullopt if no factors are found.
+ */
+inline std::optional<INT_TYPE> integer_factorize(INT_TYPE n, int max_trials)
+{
+    static lru_cache<std::pair<INT_TYPE, int>, std::optional<INT_TYPE>, FACTORING_CACHE_SIZE> cache;
+    auto cache_key = std::make_pair(n, max_trials);
+
+    if (auto val_opt = cache.get(cache_key); val_opt) {
+        return *val_opt;
+    }
+
+    if (n <= 2) {
+        cache.put(cache_key, std::nullopt);
+        return std::nullopt;
+    }
+    if (n % 2 == 0) {
+        cache.put(cache_key, INT_TYPE(2));
+        return INT_TYPE(2);
+    }
+
+    std::optional<INT_TYPE> factor;
+#ifdef __SIZEOF_INT128__
+    // The sum of a residue and c stays below 2^64
+    if (boost::multiprecision::msb(n) < 63) {
+        if (auto fixed_factor = brent_factorize<uint64_t, unsigned __int128>(
+                static_cast<uint64_t>(n), max_trials)) {
+            factor = INT_TYPE(*fixed_factor);
+        }
+    }
+    else
+#endif
+    {
+        factor = brent_factorize<INT_TYPE, INT_TYPE>(n, max_trials);
+    }
+
+    cache.put(cache_key, factor);
+    return factor;
+}
+
 /**
  * @brief Computes the prime factorization of a number n.
  *
@@ -14,14 +14,23 @@
 
 #include "RSDecomp.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 #include "DataView.hpp"
 #include "GridProblems.hpp"
+#include "GridsynthTable.hpp"
 #include "NormSolver.hpp"
 #include "NormalForms.hpp"
 #include "Rings.hpp"
@@ -130,47 +139,169 @@ std::pair<std::vector<GateType>, double> compute_clifford_T_decomposition(double
     return {std::move(decomposition), phase};
 }
 
-// Cache for Standard Basis
-using StdCacheKey = std::tuple<double, double>;
-using StdCacheValue = std::pair<std::vector<GateType>, double>;
-static lru_cache<StdCacheKey, StdCacheValue, ROSS_CACHE_SIZE> ross_cache_std;
+/**
+ * @brief Decodes the precomputed decomposition of an angle from the gridsynth table.
+ * @return The gates and the global phase, or std::nullopt if the table has no entry for the angle.
+ */
+template <typename Gate>
+std::optional<std::pair<std::vector<Gate>, double>> lookup_precomputed(double angle,
+                                                                        double epsilon,
+                                                                        bool ppr_basis)
+{
+    auto entry = GridsynthTable::lookup(angle, epsilon, ppr_basis);
+    if (!entry) {
+        return std::nullopt;
+    }
 
-std::pair<std::vector<GateType>, double> eval_ross_algorithm(double angle, double epsilon)
+    std::vector<Gate> gates;
+    gates.reserve(entry->gates.size());
+    for (char gate : entry->gates) {
+        gates.push_back(static_cast<Gate>(GridsynthTable::decode_gate(gate, ppr_basis)));
+    }
+    return std::make_pair(std::move(gates), entry->phase);
+}
+
+// Caches of the results of both bases. The results are shared between the caches and their
+// users, so that the size, gates and phase of a decomposition are read without copying the gates.
+using RossCacheKey = std::tuple<double, double>;
+using StdCacheValue = std::shared_ptr<const std::pair<std::vector<GateType>, double>>;
+using PPRCacheValue = std::shared_ptr<const std::pair<std::vector<PPRGateType>, double>>;
+static lru_cache<RossCacheKey, StdCacheValue, ROSS_CACHE_SIZE> ross_cache_std;
+static lru_cache<RossCacheKey, PPRCacheValue, ROSS_CACHE_SIZE> ross_cache_ppr;
+
+StdCacheValue get_ross_result(double angle, double epsilon)
 {
-    StdCacheKey key = {angle, epsilon};
+    RossCacheKey key = {angle, epsilon};
 
     if (auto val_opt = ross_cache_std.get(key); val_opt) {
         return *val_opt;
     }
 
-    auto result = compute_clifford_T_decomposition(angle, epsilon);
+    // Common angles are read from the precomputed table instead of being searched for
+    auto decomposition = lookup_precomputed<GateType>(angle, epsilon, /*ppr_basis=*/false);
+    auto result = std::make_shared<const std::pair<std::vector<GateType>, double>>(
+        decomposition ? std::move(*decomposition)
+                      : compute_clifford_T_decomposition(angle, epsilon));
     ross_cache_std.put(key, result);
     return result;
 }
 
-// Cache for PPR Basis
-using PPRCacheKey = std::tuple<double, double>;
-using PPRCacheValue = std::pair<std::vector<PPRGateType>, double>;
-static lru_cache<PPRCacheKey, PPRCacheValue, ROSS_CACHE_SIZE> ross_cache_ppr;
-
-std::pair<std::vector<PPRGateType>, double> eval_ross_algorithm_ppr(double angle, double epsilon)
+PPRCacheValue get_ross_result_ppr(double angle, double epsilon)
 {
-    PPRCacheKey key = {angle, epsilon};
+    RossCacheKey key = {angle, epsilon};
 
     if (auto val_opt = ross_cache_ppr.get(key); val_opt) {
         return *val_opt;
     }
 
-    auto [gates, phase] = compute_clifford_T_decomposition(angle, epsilon);
+    if (auto decomposition = lookup_precomputed<PPRGateType>(angle, epsilon, /*ppr_basis=*/true)) {
+        auto result = std::make_shared<const std::pair<std::vector<PPRGateType>, double>>(
+            std::move(*decomposition));
+        ross_cache_ppr.put(key, result);
+        return result;
+    }
 
-    auto [ppr_gates, ppr_phase_update] = HST_to_PPR(gates);
+    // The PPR decomposition is converted from the Clifford+T one, which may be cached already
+    const StdCacheValue std_result = get_ross_result(angle, epsilon);
+    const auto &[gates, phase] = *std_result;
 
-    PPRCacheValue result = {std::move(ppr_gates), phase + ppr_phase_update};
+    auto [ppr_gates, ppr_phase_update] = HST_to_PPR(gates);
 
+    auto result = std::make_shared<const std::pair<std::vector<PPRGateType>, double>>(
+        std::move(ppr_gates), phase + ppr_phase_update);
     ross_cache_ppr.put(key, result);
     return result;
 }
 
+std::pair<std::vector<GateType>, double> eval_ross_algorithm(double angle, double epsilon)
+{
+    return *get_ross_result(angle, epsilon);
+}
+
+std::pair<std::vector<PPRGateType>, double> eval_ross_algorithm_ppr(double angle, double epsilon)
+{
+    return *get_ross_result_ppr(angle, epsilon);
+}
+
+RossCacheStats get_ross_cache_stats(bool ppr_basis)
+{
+    if (ppr_basis) {
+        return {ross_cache_ppr.hits(), ross_cache_ppr.misses(), ross_cache_ppr.size()};
+    }
+    return {ross_cache_std.hits(), ross_cache_std.misses(), ross_cache_std.size()};
+}
+
+void clear_ross_caches()
+{
+    ross_cache_std.clear();
+    ross_cache_ppr.clear();
+}
+
+/**
+ * @brief Solves the decompositions of many angles on a pool of threads.
+ *
+ * The results are stored in the caches of `get_ross_result` and `get_ross_result_ppr`,
+ * so that the following calls for these angles do not solve them again. Repeated angles are only
+ * solved once, and only as many angles as the caches hold are solved.
+ *
+ * @param angles The target rotation angles.
+ * @param epsilon The desired approximation precision.
+ * @param ppr_basis Whether to decompose into the PPR basis.
+ * @param num_threads The maximum number of threads, or 0 for the hardware concurrency.
+ */
+void solve_ross_algorithm_batch(std::vector<double> angles, double epsilon, bool ppr_basis,
+                                size_t num_threads)
+{
+    std::sort(angles.begin(), angles.end());
+    angles.erase(std::unique(angles.begin(), angles.end()), angles.end());
+    if (angles.size() > ROSS_CACHE_SIZE) {
+        angles.resize(ROSS_CACHE_SIZE);
+    }
+
+    if (num_threads == 0) {
+        num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    num_threads = std::min(num_threads, angles.size());
+    std::atomic<size_t> next_angle{0};
+    std::exception_ptr error;
+    std::mutex error_mu;
+
+    auto worker = [&]() {
+        try {
+            for (size_t idx = next_angle++; idx < angles.size(); idx = next_angle++) {
+                if (ppr_basis) {
+                    (void)get_ross_result_ppr(angles[idx], epsilon);
+                }
+                else {
+                    (void)get_ross_result(angles[idx], epsilon);
+                }
+            }
+        }
+        catch (...) {
+            // Stop the other workers, and report the first error to the caller
+            next_angle = angles.size();
+            std::lock_guard<std::mutex> lock(error_mu);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (size_t idx = 1; idx < num_threads; idx++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 /**
  * @brief Try to convert a pair of gates for HST_to_PPR
  * @return std::pair<bool, double> true if a pair rule matched and was appended; false otherwise.
@@ -303,12 +434,10 @@ size_t rs_decomposition_get_size(double theta, double epsilon, bool ppr_basis)
                 "epsilon value.");
     }
     if (ppr_basis) {
-        auto result = eval_ross_algorithm_ppr(theta, epsilon);
-        return result.first.size();
+        return get_ross_result_ppr(theta, epsilon)->first.size();
     }
     else {
-        auto result = eval_ross_algorithm(theta, epsilon);
-        return result.first.size();
+        return get_ross_result(theta, epsilon)->first.size();
     }
 }
 
@@ -343,7 +472,8 @@ void rs_decomposition_get_gates([[maybe_unused]] size_t *data_allocated, size_t
     DataView<size_t, 1> gates_view(data_aligned, offset, sizes, strides);
 
     if (ppr_basis) {
-        const auto &[gates, phase] = eval_ross_algorithm_ppr(theta, epsilon);
+        const auto result = get_ross_result_ppr(theta, epsilon);
+        const auto &gates = result->first;
         size_t s = gates.size();
         RT_FAIL_IF(gates_view.size() < s, "Error: memref allocated too small for PPR gates.\n")
 
@@ -352,7 +482,8 @@ void rs_decomposition_get_gates([[maybe_unused]] size_t *data_allocated, size_t
         }
     }
     else {
-        const auto &[gates, phase] = eval_ross_algorithm(theta, epsilon);
+        const auto result = get_ross_result(theta, epsilon);
+        const auto &gates = result->first;
 
         size_t s = gates.size();
         RT_FAIL_IF(gates_view.size() < s, "Error: memref allocated too small for PPR gates.\n")
@@ -374,11 +505,45 @@ void rs_decomposition_get_gates([[maybe_unused]] size_t *data_allocated, size_t
 double rs_decomposition_get_phase(double theta, double epsilon, bool ppr_basis)
 {
     if (ppr_basis) {
-        return eval_ross_algorithm_ppr(theta, epsilon).second;
+        return get_ross_result_ppr(theta, epsilon)->second;
     }
     else {
-        return eval_ross_algorithm(theta, epsilon).second;
+        return get_ross_result(theta, epsilon)->second;
+    }
+}
+
+/**
+ * @brief Solves the decompositions of the angles of a memref in parallel, ahead of the calls to
+ * `rs_decomposition_get_size`, `rs_decomposition_get_gates` and `rs_decomposition_get_phase`
+ * for each angle, which are then served from a cache.
+ *
+ * Like `rs_decomposition_get_gates`, this function takes the fields of a 1D memref (f64) as
+ * individual arguments.
+ *
+ * @param angles_allocated Pointer to allocated data
+ * @param angles_aligned Pointer to aligned data
+ * @param offset Data offset
+ * @param size0 Size of dimension 0
+ * @param stride0 Stride of dimension 0
+ * @param epsilon Error
+ * @param ppr_basis Whether to use PPR basis
+ */
+void rs_decomposition_solve_batch([[maybe_unused]] double *angles_allocated,
+                                  double *angles_aligned, size_t offset, size_t size0,
+                                  size_t stride0, double epsilon, bool ppr_basis)
+{
+    (void)angles_allocated;
+
+    const size_t sizes[1] = {size0};
+    const size_t strides[1] = {stride0};
+    DataView<double, 1> angles_view(angles_aligned, offset, sizes, strides);
+
+    std::vector<double> angles;
+    angles.reserve(angles_view.size());
+    for (size_t i = 0; i < angles_view.size(); ++i) {
+        angles.push_back(angles_view(i));
     }
+    solve_ross_algorithm_batch(std::move(angles), epsilon, ppr_basis);
 }
 
 } // extern "C"
@@ -19,9 +19,24 @@
 namespace RSDecomp::RossSelinger {
 using namespace RSDecomp::Rings;
 using namespace RSDecomp::CliffordData;
+/**
+ * @brief The hit and miss counts and the number of entries of a decomposition result cache.
+ */
+struct RossCacheStats {
+    size_t hits;
+    size_t misses;
+    size_t size;
+};
+
+std::pair<std::vector<GateType>, double> compute_clifford_T_decomposition(double angle,
+                                                                          double epsilon);
 std::pair<std::vector<GateType>, double> eval_ross_algorithm(double angle, double epsilon);
 std::pair<std::vector<PPRGateType>, double> eval_ross_algorithm_ppr(double angle, double epsilon);
 std::pair<std::vector<PPRGateType>, double> HST_to_PPR(const std::vector<GateType> &vector);
+RossCacheStats get_ross_cache_stats(bool ppr_basis);
+void clear_ross_caches();
+void solve_ross_algorithm_batch(std::vector<double> angles, double epsilon, bool ppr_basis,
+                                size_t num_threads = 0);
 
 extern "C" {
 
@@ -33,5 +48,8 @@ void rs_decomposition_get_gates(size_t *data_allocated, size_t *data_aligned, si
 
 double rs_decomposition_get_phase(double theta, double epsilon, bool ppr_basis);
 
+void rs_decomposition_solve_batch(double *angles_allocated, double *angles_aligned, size_t offset,
+                                  size_t size0, size_t stride0, double epsilon, bool ppr_basis);
+
 } // extern "C"
 } // namespace RSDecomp::RossSelinger
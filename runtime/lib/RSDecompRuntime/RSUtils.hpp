@@ -16,6 +16,7 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 #include <optional>
 
 #include "Exception.hpp"
@@ -57,7 +58,8 @@ template <typename T> T gcd(T a, T b)
  * @brief Simple LRU (Least Recently Used) Cache implementation.
  *
  * This cache stores key-value pairs up to a maximum size. When the cache exceeds this size,
- * the least recently used item is evicted.
+ * the least recently used item is evicted. The cache may be used from several threads, and
+ * counts the hits and misses of its lookups.
  *
  * @tparam Key The type of the keys.
  * @tparam Value The type of the values.
@@ -82,12 +84,15 @@ template <typename Key, typename Value, size_t MaxSize> class lru_cache {
      */
     std::optional<Value> get(const Key &key)
     {
+        std::lock_guard<std::mutex> lock(mu);
         auto map_it = cache_map.find(key);
 
         if (map_it == cache_map.end()) {
+            num_misses++;
             return std::nullopt;
         }
 
+        num_hits++;
         cache_list.splice(cache_list.begin(), cache_list, map_it->second);
 
         return map_it->second->second;
@@ -105,6 +110,7 @@ template <typename Key, typename Value, size_t MaxSize> class lru_cache {
      */
     void put(const Key &key, const Value &value)
     {
+        std::lock_guard<std::mutex> lock(mu);
         auto map_it = cache_map.find(key);
 
         if (map_it != cache_map.end()) {
@@ -125,20 +131,48 @@ template <typename Key, typename Value, size_t MaxSize> class lru_cache {
     /**
      * @brief Returns the current number of items in the cache.
      */
-    size_t size() const { return cache_map.size(); }
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        return cache_map.size();
+    }
+
+    /**
+     * @brief Returns the number of lookups that found their key.
+     */
+    size_t hits() const
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        return num_hits;
+    }
+
+    /**
+     * @brief Returns the number of lookups that did not find their key.
+     */
+    size_t misses() const
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        return num_misses;
+    }
 
     /**
-     * @brief Clears all items from the cache.
+     * @brief Clears all items from the cache, and resets the hit and miss counters.
      */
     void clear()
     {
+        std::lock_guard<std::mutex> lock(mu);
         cache_map.clear();
         cache_list.clear();
+        num_hits = 0;
+        num_misses = 0;
     }
 
   private:
     std::list<list_pair_t> cache_list;
     map_t cache_map;
+    size_t num_hits{0};
+    size_t num_misses{0};
+    mutable std::mutex mu; // To protect cache_list, cache_map and the counters
 };
 
 } // namespace RSDecomp::Utils
@@ -14,6 +14,8 @@
 
 #include "Rings.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
 
 #include "RSUtils.hpp"
@@ -21,6 +23,54 @@
 namespace RSDecomp::Rings {
 using namespace RSDecomp::Utils;
 
+// Note on the fixed-width fast path:
+// Most ring elements met by the grid and norm solvers have small coefficients, for which the
+// multiprecision arithmetic of INT_TYPE is dominated by its temporaries. The products and norms
+// below therefore compute with FIXED_INT_TYPE when all of their operands have at most
+// `Bits` bits, which is chosen so that none of the intermediate results can overflow, and fall
+// back to INT_TYPE otherwise.
+namespace {
+#ifdef __SIZEOF_INT128__
+using FIXED_INT_TYPE = __int128;
+#else
+using FIXED_INT_TYPE = int64_t;
+#endif
+
+constexpr unsigned FIXED_INT_BITS = sizeof(FIXED_INT_TYPE) * 8 - 1;
+
+// Operands of products of two elements, of which up to four are summed
+constexpr unsigned FIXED_MUL_BITS = std::min(62u, (FIXED_INT_BITS - 3) / 2);
+// Operands of the quartic norm of ZOmega, of which the squares of sums are subtracted
+constexpr unsigned FIXED_NORM4_BITS = (FIXED_MUL_BITS - 2) / 2;
+
+/**
+ * @brief Returns whether all the given integers have at most `Bits` bits.
+ *
+ * This only inspects the limbs of the cpp_int backend, so that it is much cheaper than comparing
+ * the integers against a bound.
+ */
+template <unsigned Bits, typename... Ints> inline bool fit_in_bits(const Ints &...xs)
+{
+    static_assert(Bits < 64, "Fixed-width operands must fit in a single 64-bit value");
+    auto fits = [](const INT_TYPE &x) {
+        return x.backend().size() == 1 &&
+               static_cast<uint64_t>(x.backend().limbs()[0]) < (uint64_t(1) << Bits);
+    };
+    return (fits(xs) && ...);
+}
+
+/**
+ * @brief Converts an integer that fits in FIXED_MUL_BITS bits to FIXED_INT_TYPE.
+ */
+inline FIXED_INT_TYPE to_fixed(const INT_TYPE &x)
+{
+    const auto magnitude = static_cast<FIXED_INT_TYPE>(x.backend().limbs()[0]);
+    return x.backend().sign() ? -magnitude : magnitude;
+}
+
+inline INT_TYPE from_fixed(FIXED_INT_TYPE x) { return INT_TYPE(x); }
+} // namespace
+
 // Note:
 // Definitions for most of the ring operations here are available in
 // https://arxiv.org/pdf/1212.6253 secion 3
@@ -60,6 +110,11 @@ ZSqrtTwo ZSqrtTwo::operator-(const ZSqrtTwo &other) const
  */
 ZSqrtTwo ZSqrtTwo::operator*(const ZSqrtTwo &other) const
 {
+    if (fit_in_bits<FIXED_MUL_BITS>(a, b, other.a, other.b)) {
+        const FIXED_INT_TYPE xa = to_fixed(a), xb = to_fixed(b);
+        const FIXED_INT_TYPE ya = to_fixed(other.a), yb = to_fixed(other.b);
+        return ZSqrtTwo(from_fixed(xa * ya + 2 * xb * yb), from_fixed(xa * yb + xb * ya));
+    }
     return ZSqrtTwo(a * other.a + 2 * b * other.b, a * other.b + b * other.a);
 }
 
@@ -86,7 +141,14 @@ ZSqrtTwo ZSqrtTwo::operator/(INT_TYPE scalar) const
 /**
  * @brief Computes the norm of the ZSqrtTwo element. (Definition 4, arXiv:1212.6253)
  */
-INT_TYPE ZSqrtTwo::norm() const { return a * a - 2 * b * b; }
+INT_TYPE ZSqrtTwo::norm() const
+{
+    if (fit_in_bits<FIXED_MUL_BITS>(a, b)) {
+        const FIXED_INT_TYPE xa = to_fixed(a), xb = to_fixed(b);
+        return from_fixed(xa * xa - 2 * xb * xb);
+    }
+    return a * a - 2 * b * b;
+}
 
 /**
  * @brief Computes the adjoint of the ZSqrtTwo element.
@@ -196,6 +258,12 @@ bool ZOmega::operator==(const ZOmega &other) const
  */
 ZOmega ZOmega::operator+(const ZOmega &other) const
 {
+    if (fit_in_bits<FIXED_MUL_BITS>(a, b, c, d, other.a, other.b, other.c, other.d)) {
+        return ZOmega(from_fixed(to_fixed(a) + to_fixed(other.a)),
+                      from_fixed(to_fixed(b) + to_fixed(other.b)),
+                      from_fixed(to_fixed(c) + to_fixed(other.c)),
+                      from_fixed(to_fixed(d) + to_fixed(other.d)));
+    }
     return ZOmega(a + other.a, b + other.b, c + other.c, d + other.d);
 }
 
@@ -217,6 +285,16 @@ ZOmega ZOmega::operator-() const { return ZOmega(-a, -b, -c, -d); }
  */
 ZOmega ZOmega::operator*(const ZOmega &other) const
 {
+    if (fit_in_bits<FIXED_MUL_BITS>(a, b, c, d, other.a, other.b, other.c, other.d)) {
+        const FIXED_INT_TYPE xa = to_fixed(a), xb = to_fixed(b), xc = to_fixed(c),
+                             xd = to_fixed(d);
+        const FIXED_INT_TYPE ya = to_fixed(other.a), yb = to_fixed(other.b),
+                             yc = to_fixed(other.c), yd = to_fixed(other.d);
+        return ZOmega(from_fixed(xa * yd + xb * yc + xc * yb + xd * ya),
+                      from_fixed(xb * yd + xc * yc + xd * yb - xa * ya),
+                      from_fixed(xc * yd + xd * yc - xa * yb - xb * ya),
+                      from_fixed(xd * yd - xa * yc - xb * yb - xc * ya));
+    }
     return ZOmega(a * other.d + b * other.c + c * other.b + d * other.a,
                   b * other.d + c * other.c + d * other.b - a * other.a,
                   c * other.d + d * other.c - a * other.b - b * other.a,
@@ -269,6 +347,13 @@ ZOmega ZOmega::adj2() const { return ZOmega(-a, b, -c, d); }
  */
 INT_TYPE ZOmega::norm4() const
 {
+    if (fit_in_bits<FIXED_NORM4_BITS>(a, b, c, d)) {
+        const FIXED_INT_TYPE xa = to_fixed(a), xb = to_fixed(b), xc = to_fixed(c),
+                             xd = to_fixed(d);
+        const FIXED_INT_TYPE first = xa * xa + xb * xb + xc * xc + xd * xd;
+        const FIXED_INT_TYPE second = xa * xb + xb * xc + xc * xd - xd * xa;
+        return from_fixed(first * first - 2 * second * second);
+    }
     INT_TYPE first = a * a + b * b + c * c + d * d;
     INT_TYPE second = a * b + b * c + c * d - d * a;
     return first * first - 2 * second * second;
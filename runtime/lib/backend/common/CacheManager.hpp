@@ -15,9 +15,11 @@
 #pragma once
 
 #include <complex>
+#include <span>
 #include <string>
 #include <vector>
 
+#include "Exception.hpp"
 #include "Types.h"
 #include "Utils.hpp"
 
@@ -29,17 +31,28 @@ namespace Catalyst::Runtime {
  * One direct use case of this functionality is explored to compute gradient
  * of a circuit with taking advantage of gradient methods provided by
  * simulators.
+ *
+ * Operations are recorded in a structure-of-arrays tape: the parameters, wires,
+ * matrices and control data of all operations are appended to one contiguous
+ * buffer each, together with an offset table per buffer. The data of operation
+ * `i` lives in `[offsets[i], offsets[i + 1])`, so recording a gate does not
+ * allocate once the buffers are reserved.
  */
 template <typename ComplexT = std::complex<double>> class CacheManager {
   protected:
     // Operations Data
     std::vector<std::string> ops_names_{};
-    std::vector<std::vector<double>> ops_params_{};
-    std::vector<std::vector<size_t>> ops_wires_{};
     std::vector<bool> ops_inverses_{};
-    std::vector<std::vector<ComplexT>> ops_matrixs_{};
-    std::vector<std::vector<size_t>> ops_controlled_wires_{};
-    std::vector<std::vector<bool>> ops_controlled_values_{};
+    std::vector<double> ops_params_{};
+    std::vector<size_t> ops_params_offsets_{0};
+    std::vector<size_t> ops_wires_{};
+    std::vector<size_t> ops_wires_offsets_{0};
+    std::vector<ComplexT> ops_matrices_{};
+    std::vector<size_t> ops_matrices_offsets_{0};
+    std::vector<size_t> ops_controlled_wires_{};
+    std::vector<size_t> ops_controlled_wires_offsets_{0};
+    std::vector<bool> ops_controlled_values_{};
+    std::vector<size_t> ops_controlled_values_offsets_{0};
 
     // Observables Data
     std::vector<ObsIdType> obs_keys_{};
@@ -48,6 +61,21 @@ template <typename ComplexT = std::complex<double>> class CacheManager {
     // Number of parameters
     size_t num_params_{0};
 
+    template <typename T, typename RangeT>
+    static void _append(std::vector<T> &data, std::vector<size_t> &offsets, const RangeT &values)
+    {
+        data.insert(data.end(), values.begin(), values.end());
+        offsets.push_back(data.size());
+    }
+
+    template <typename T>
+    [[nodiscard]] auto _slice(const std::vector<T> &data, const std::vector<size_t> &offsets,
+                              size_t idx) const -> std::span<const T>
+    {
+        RT_FAIL_IF(idx >= getNumOperations(), "Invalid cached operation index");
+        return std::span<const T>(data).subspan(offsets[idx], offsets[idx + 1] - offsets[idx]);
+    }
+
   public:
     CacheManager() = default;
     ~CacheManager() = default;
@@ -63,12 +91,17 @@ template <typename ComplexT = std::complex<double>> class CacheManager {
     void Reset()
     {
         ops_names_.clear();
+        ops_inverses_.clear();
         ops_params_.clear();
+        ops_params_offsets_.resize(1);
         ops_wires_.clear();
-        ops_inverses_.clear();
-        ops_matrixs_.clear();
+        ops_wires_offsets_.resize(1);
+        ops_matrices_.clear();
+        ops_matrices_offsets_.resize(1);
         ops_controlled_wires_.clear();
+        ops_controlled_wires_offsets_.resize(1);
         ops_controlled_values_.clear();
+        ops_controlled_values_offsets_.resize(1);
 
         obs_keys_.clear();
         obs_callees_.clear();
@@ -76,6 +109,26 @@ template <typename ComplexT = std::complex<double>> class CacheManager {
         num_params_ = 0;
     }
 
+    /**
+     * @brief Reserve the tape for an estimated number of operations.
+     *
+     * @param num_ops Number of operations
+     * @param num_params Total number of gate parameters
+     * @param num_wires Total number of target wires
+     */
+    void Reserve(size_t num_ops, size_t num_params, size_t num_wires)
+    {
+        ops_names_.reserve(num_ops);
+        ops_inverses_.reserve(num_ops);
+        ops_params_.reserve(num_params);
+        ops_params_offsets_.reserve(num_ops + 1);
+        ops_wires_.reserve(num_wires);
+        ops_wires_offsets_.reserve(num_ops + 1);
+        ops_matrices_offsets_.reserve(num_ops + 1);
+        ops_controlled_wires_offsets_.reserve(num_ops + 1);
+        ops_controlled_values_offsets_.reserve(num_ops + 1);
+    }
+
     /**
      * @brief Add a new operation to the list of cached gates.
      *
@@ -87,19 +140,19 @@ template <typename ComplexT = std::complex<double>> class CacheManager {
      * @param controlled_wires Control wires
      * @param controlled_values Control values
      */
-    void addOperation(const std::string &name, const std::vector<double> &params,
-                      const std::vector<size_t> &wires, bool inverse,
-                      const std::vector<ComplexT> &matrix = {},
-                      const std::vector<size_t> &controlled_wires = {},
+    void addOperation(const std::string &name, std::span<const double> params,
+                      std::span<const size_t> wires, bool inverse,
+                      std::span<const ComplexT> matrix = {},
+                      std::span<const size_t> controlled_wires = {},
                       const std::vector<bool> &controlled_values = {})
     {
         ops_names_.push_back(name);
-        ops_params_.push_back(params);
-        ops_wires_.push_back(wires);
         ops_inverses_.push_back(inverse);
-        ops_matrixs_.push_back(matrix);
-        ops_controlled_wires_.push_back(controlled_wires);
-        ops_controlled_values_.push_back(controlled_values);
+        _append(ops_params_, ops_params_offsets_, params);
+        _append(ops_wires_, ops_wires_offsets_, wires);
+        _append(ops_matrices_, ops_matrices_offsets_, matrix);
+        _append(ops_controlled_wires_, ops_controlled_wires_offsets_, controlled_wires);
+        _append(ops_controlled_values_, ops_controlled_values_offsets_, controlled_values);
 
         num_params_ += params.size();
     }
@@ -132,45 +185,51 @@ template <typename ComplexT = std::complex<double>> class CacheManager {
     auto getOperationsNames() -> const std::vector<std::string> & { return ops_names_; }
 
     /**
-     * @brief Get a reference to operations parameters.
+     * @brief Get a reference to operations inverses.
      */
-    auto getOperationsParameters() -> const std::vector<std::vector<double>> &
-    {
-        return ops_params_;
-    }
+    auto getOperationsInverses() -> const std::vector<bool> & { return ops_inverses_; }
 
     /**
-     * @brief Get a reference to operations wires.
+     * @brief Get the parameters of operation `idx`.
      */
-    auto getOperationsWires() -> const std::vector<std::vector<size_t>> & { return ops_wires_; }
+    [[nodiscard]] auto getOperationParameters(size_t idx) const -> std::span<const double>
+    {
+        return _slice(ops_params_, ops_params_offsets_, idx);
+    }
 
     /**
-     * @brief Get a reference to operation controlled wires.
+     * @brief Get the wires of operation `idx`.
      */
-    auto getOperationsControlledWires() -> const std::vector<std::vector<size_t>> &
+    [[nodiscard]] auto getOperationWires(size_t idx) const -> std::span<const size_t>
     {
-        return this->ops_controlled_wires_;
+        return _slice(ops_wires_, ops_wires_offsets_, idx);
     }
 
     /**
-     * @brief Get a reference to operation controlled values.
+     * @brief Get the matrix of operation `idx`, empty unless it is a 'MatrixOp'.
      */
-    auto getOperationsControlledValues() -> const std::vector<std::vector<bool>> &
+    [[nodiscard]] auto getOperationMatrix(size_t idx) const -> std::span<const ComplexT>
     {
-        return this->ops_controlled_values_;
+        return _slice(ops_matrices_, ops_matrices_offsets_, idx);
     }
 
     /**
-     * @brief Get a reference to operations inverses.
+     * @brief Get the controlled wires of operation `idx`.
      */
-    auto getOperationsInverses() -> const std::vector<bool> & { return ops_inverses_; }
+    [[nodiscard]] auto getOperationControlledWires(size_t idx) const -> std::span<const size_t>
+    {
+        return _slice(ops_controlled_wires_, ops_controlled_wires_offsets_, idx);
+    }
 
     /**
-     * @brief Get a reference to operations matrices.
+     * @brief Get the controlled values of operation `idx`.
      */
-    auto getOperationsMatrices() -> const std::vector<std::vector<ComplexT>> &
+    [[nodiscard]] auto getOperationControlledValues(size_t idx) const -> std::vector<bool>
     {
-        return ops_matrixs_;
+        RT_FAIL_IF(idx >= getNumOperations(), "Invalid cached operation index");
+        auto first = ops_controlled_values_.begin();
+        return {first + ops_controlled_values_offsets_[idx],
+                first + ops_controlled_values_offsets_[idx + 1]};
     }
 
     /**
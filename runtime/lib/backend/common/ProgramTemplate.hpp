@@ -0,0 +1,96 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime {
+
+/**
+ * @brief Combine the hash of `value` into `seed`.
+ */
+template <typename T> inline void hashCombine(size_t &seed, const T &value)
+{
+    seed ^= std::hash<T>{}(value) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+/**
+ * A serialised program with placeholders for its numeric gate parameters.
+ *
+ * The static text of the program is kept in a single buffer together with the offsets at which
+ * parameter values are inserted. A parametric circuit that is executed repeatedly with the same
+ * gates and wires is then serialised once, and each execution only formats its parameter values
+ * into a reused output buffer (see `bind`).
+ *
+ * The values are bound into the program text rather than declared as OpenQASM 3 `input`
+ * parameters and passed alongside it. The bound program is then a plain circuit, which every
+ * provider accepts whether or not it supports program inputs, and which OpenQASM 2 programs can
+ * use as well.
+ *
+ * @param precision Number of significant digits of the bound parameter values
+ */
+class ProgramTemplate {
+  private:
+    std::string text;
+    std::vector<size_t> slots;
+    size_t precision;
+    std::string buffer;
+
+  public:
+    explicit ProgramTemplate(size_t _precision = 5) : precision(_precision) {}
+    ~ProgramTemplate() = default;
+
+    [[nodiscard]] auto getNumParams() const -> size_t { return slots.size(); }
+    [[nodiscard]] auto getText() const -> const std::string & { return text; }
+
+    void append(std::string_view str) { text.append(str); }
+    void appendParam() { slots.push_back(text.size()); }
+
+    /**
+     * @brief Fill the parameter placeholders with `values`, in order of appearance.
+     *
+     * @return The program, valid until the next call to `bind`.
+     */
+    [[nodiscard]] auto bind(const std::vector<double> &values) -> const std::string &
+    {
+        RT_FAIL_IF(values.size() != slots.size(),
+                   "Invalid number of parameters for the program template");
+
+        buffer.clear();
+        buffer.reserve(text.size() + values.size() * (precision + 8));
+        std::array<char, 64> digits{};
+        size_t pos = 0;
+        for (size_t idx = 0; idx < slots.size(); idx++) {
+            buffer.append(text, pos, slots[idx] - pos);
+            // Same representation as `std::setprecision(precision)` with the default float field
+            const int len = std::snprintf(digits.data(), digits.size(), "%.*g",
+                                          static_cast<int>(precision), values[idx]);
+            buffer.append(digits.data(), len);
+            pos = slots[idx];
+        }
+        buffer.append(text, pos);
+        return buffer;
+    }
+};
+
+} // namespace Catalyst::Runtime
@@ -15,7 +15,9 @@
 #pragma once
 
 #include <algorithm>
+#include <limits>
 #include <map>
+#include <vector>
 
 #include "Exception.hpp"
 #include "Types.h"
@@ -142,4 +144,203 @@ class QubitManager {
         this->qubits_map.clear();
     }
 };
+
+/**
+ * Flat Qubit Manager
+ *
+ * @brief An alternative to `QubitManager` backed by contiguous vectors. Simulator qubit IDs are
+ * handed out in increasing order and index directly into a dense slot vector, so that looking up
+ * the device ID of a qubit is O(1). Released device IDs are kept in a free list and reused by
+ * later allocations instead of renumbering the remaining qubits, which makes releasing a qubit
+ * O(1) as well. Device IDs therefore stay in `[0, peak number of active qubits)`.
+ *
+ * The slots span the simulator IDs from the oldest qubit to the newest one. Once most of them are
+ * free, e.g. when a long-lived qubit is kept while others are repeatedly allocated and released,
+ * the remaining qubits are moved out of the slots into an ordered map, so that the slots restart
+ * from the next simulator ID instead of growing with every allocation.
+ */
+template <typename SimQubitIdType = QubitIdType, typename DevQubitIdType = size_t>
+class FlatQubitManager {
+  private:
+    static constexpr DevQubitIdType INVALID_DEVICE_ID = std::numeric_limits<DevQubitIdType>::max();
+    static constexpr SimQubitIdType INVALID_SIM_ID = std::numeric_limits<SimQubitIdType>::max();
+
+    SimQubitIdType next_idx{0};
+    // The simulator ID stored in `slots[0]`
+    SimQubitIdType base_idx{0};
+    size_t num_active{0};
+
+    // Simulator ID (offset by `base_idx`) -> device ID
+    std::vector<DevQubitIdType> slots{};
+    // Simulator ID -> device ID of the qubits allocated before the slots were last compacted
+    std::map<SimQubitIdType, DevQubitIdType> compacted{};
+    // Device ID -> simulator ID
+    std::vector<SimQubitIdType> owners{};
+    std::vector<DevQubitIdType> free_device_ids{};
+
+    [[nodiscard]] inline auto _find_slot(SimQubitIdType s_idx) -> DevQubitIdType *
+    {
+        if (s_idx < this->base_idx) {
+            auto it = this->compacted.find(s_idx);
+            return it != this->compacted.end() ? &it->second : nullptr;
+        }
+
+        const auto offset = static_cast<size_t>(s_idx - this->base_idx);
+        if (offset >= this->slots.size()) {
+            return nullptr;
+        }
+
+        DevQubitIdType *slot = &this->slots[offset];
+        return *slot == INVALID_DEVICE_ID ? nullptr : slot;
+    }
+
+  public:
+    FlatQubitManager() = default;
+    ~FlatQubitManager() = default;
+
+    FlatQubitManager(const FlatQubitManager &) = delete;
+    FlatQubitManager &operator=(const FlatQubitManager &) = delete;
+    FlatQubitManager(FlatQubitManager &&) = delete;
+    FlatQubitManager &operator=(FlatQubitManager &&) = delete;
+
+    [[nodiscard]] auto isValidQubitId(SimQubitIdType s_idx) -> bool
+    {
+        return _find_slot(s_idx) != nullptr;
+    }
+
+    [[nodiscard]] auto isValidQubitId(const std::vector<SimQubitIdType> &ss_idx) -> bool
+    {
+        return std::all_of(ss_idx.begin(), ss_idx.end(),
+                           [this](SimQubitIdType s) { return isValidQubitId(s); });
+    }
+
+    [[nodiscard]] auto getAllQubitIds() -> std::vector<SimQubitIdType>
+    {
+        std::vector<SimQubitIdType> ids;
+        ids.reserve(this->num_active);
+        for (const auto &[s_idx, d_idx] : this->compacted) {
+            ids.push_back(s_idx);
+        }
+        for (size_t i = 0; i < this->slots.size(); i++) {
+            if (this->slots[i] != INVALID_DEVICE_ID) {
+                ids.push_back(this->base_idx + static_cast<SimQubitIdType>(i));
+            }
+        }
+
+        return ids;
+    }
+
+    [[nodiscard]] auto getDeviceId(SimQubitIdType s_idx) -> DevQubitIdType
+    {
+        const DevQubitIdType *slot = _find_slot(s_idx);
+        RT_FAIL_IF(!slot, "Invalid device qubit index");
+
+        return *slot;
+    }
+
+    auto getDeviceIds(const std::vector<SimQubitIdType> &ss_idx) -> std::vector<DevQubitIdType>
+    {
+        std::vector<DevQubitIdType> dd_idx;
+        dd_idx.reserve(ss_idx.size());
+        for (const auto &s : ss_idx) {
+            dd_idx.push_back(getDeviceId(s));
+        }
+        return dd_idx;
+    }
+
+    [[nodiscard]] auto getSimulatorId(DevQubitIdType d_idx) -> SimQubitIdType
+    {
+        RT_FAIL_IF(d_idx >= this->owners.size() || this->owners[d_idx] == INVALID_SIM_ID,
+                   "Invalid simulator qubit index");
+
+        return this->owners[d_idx];
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return this->num_active; }
+
+    /**
+     * @brief Get the number of slots, of active and released qubits, that the manager holds.
+     */
+    [[nodiscard]] auto getNumSlots() const -> size_t
+    {
+        return this->slots.size() + this->compacted.size();
+    }
+
+    [[nodiscard]] auto Allocate() -> SimQubitIdType
+    {
+        DevQubitIdType d_idx;
+        if (!this->free_device_ids.empty()) {
+            d_idx = this->free_device_ids.back();
+            this->free_device_ids.pop_back();
+        }
+        else {
+            d_idx = this->owners.size();
+            this->owners.push_back(INVALID_SIM_ID);
+        }
+
+        this->owners[d_idx] = this->next_idx;
+        this->slots.push_back(d_idx);
+        this->num_active++;
+        return this->next_idx++;
+    }
+
+    auto AllocateRange(size_t size) -> std::vector<SimQubitIdType>
+    {
+        std::vector<SimQubitIdType> ids;
+        ids.reserve(size);
+        this->slots.reserve(this->slots.size() + size);
+        for (size_t i = 0; i < size; i++) {
+            ids.push_back(Allocate());
+        }
+        return ids;
+    }
+
+    void Release(SimQubitIdType s_idx)
+    {
+        DevQubitIdType *slot = _find_slot(s_idx);
+        RT_FAIL_IF(!slot, "Invalid simulator qubit index");
+
+        this->owners[*slot] = INVALID_SIM_ID;
+        this->free_device_ids.push_back(*slot);
+        if (s_idx < this->base_idx) {
+            this->compacted.erase(s_idx);
+        }
+        else {
+            *slot = INVALID_DEVICE_ID;
+        }
+
+        // Start over once no qubit is left so the slots do not grow with every allocation
+        if (!--this->num_active) {
+            ReleaseAll();
+            return;
+        }
+
+        // Otherwise, move the remaining qubits out of the slots once at least three quarters of
+        // them are free, which bounds the slots by four times the number of active qubits, and
+        // amortizes the compaction over the releases that freed them
+        constexpr size_t min_compacted_slots = 64;
+        if (this->slots.size() >= min_compacted_slots &&
+            this->slots.size() >= 4 * (this->num_active - this->compacted.size())) {
+            for (size_t i = 0; i < this->slots.size(); i++) {
+                if (this->slots[i] != INVALID_DEVICE_ID) {
+                    this->compacted.emplace(this->base_idx + static_cast<SimQubitIdType>(i),
+                                            this->slots[i]);
+                }
+            }
+            this->base_idx = this->next_idx;
+            this->slots.clear();
+        }
+    }
+
+    void ReleaseAll()
+    {
+        // Simulator IDs are never reused, so new slots start from the next simulator ID.
+        this->base_idx = this->next_idx;
+        this->num_active = 0;
+        this->slots.clear();
+        this->compacted.clear();
+        this->owners.clear();
+        this->free_device_ids.clear();
+    }
+};
 } // namespace Catalyst::Runtime
@@ -18,16 +18,21 @@
 #include <cmath>
 #include <complex>
 #include <cstdio>
+#include <functional>
+#include <numeric>
 #include <optional>
 #include <random>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "CacheManager.hpp"
 #include "DataView.hpp"
 #include "QuantumDevice.hpp"
 #include "QubitManager.hpp"
 #include "ResourceTracker.hpp"
+#include "SyntheticMeasurements.hpp"
 #include "Types.h"
 #include "Utils.hpp"
 
@@ -66,11 +71,16 @@ static std::string classifyPauliRotAngle(double angle, const double tolerance =
  * - Supports device shot configuration
  * - Implements all Quantum Runtime (QR) and Quantum Instruction Set (QIS) methods as no-ops
  * - Optionally tracks resource usage including gate counts, wire usage, and circuit depth
+ * - Optionally runs in a throughput mode without resource tracking or qubit validation, whose
+ *   costs are only those of the runtime ABI
  * - Returns mock results for all measurements and observations
+ * - Records the circuit between `StartTapeRecording` and `StopTapeRecording`, and walks the
+ *   recorded tape in `Gradient` like an adjoint-method simulator would, without any state updates
  *
  * The null device is particularly useful for:
  * - Testing quantum program compilation and execution without quantum simulation overhead
  * - Resource tracking & resource estimation
+ * - Profiling the overheads of the device-gradient (adjoint) runtime ABI
  * - Validating quantum program structure and control flow
  */
 struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
@@ -86,6 +96,19 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
      * - "resources_filename": Static filename for resource output [requires resource tracking]
      * - "compute_depth": Enable/disable circuit depth computation ("True"/"False") [requires
      * resource tracking]
+     * - "estimate_cost": Enable/disable the estimation of the execution cost ("True"/"False")
+     * [requires resource tracking]
+     * - "gate_durations": Gate duration table of the cost estimates, as `NAME=DURATION` entries
+     * separated by ';' (enables the cost estimation) [requires resource tracking]
+     * - "default_gate_duration": Duration of the gates not in the gate duration table [requires
+     * resource tracking]
+     * - "synthetic_measurements": Distribution of the synthetic measurement outcomes, one of
+     * "zeros" (default), "uniform", "bitstrings" and "random" (see `SyntheticMeasurements`)
+     * - "synthetic_bitstrings": Bitstrings of the "bitstrings" distribution, separated by ';'
+     * - "synthetic_seed": Seed of the "random" distribution, 0 by default
+     * - "throughput": Enable/disable the throughput mode ("True"/"False"), in which qubits are
+     * numbered without being validated and resources cannot be tracked, so that the device
+     * measures the maximum throughput of the runtime ABI
      *
      * @param kwargs non-nested JSON-like string containing device configuration parameters
      */
@@ -101,6 +124,30 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
         if (device_kwargs.contains("compute_depth")) {
             this->resource_tracker_.SetComputeDepth(device_kwargs["compute_depth"] == "True");
         }
+        if (device_kwargs.contains("estimate_cost")) {
+            this->resource_tracker_.SetEstimateCost(device_kwargs["estimate_cost"] == "True");
+        }
+        if (device_kwargs.contains("gate_durations")) {
+            this->resource_tracker_.SetGateDurations(device_kwargs["gate_durations"]);
+        }
+        if (device_kwargs.contains("default_gate_duration")) {
+            this->resource_tracker_.SetDefaultGateDuration(
+                std::stod(device_kwargs["default_gate_duration"]));
+        }
+        if (device_kwargs.contains("synthetic_measurements")) {
+            const std::string bitstrings = device_kwargs.contains("synthetic_bitstrings")
+                                               ? device_kwargs["synthetic_bitstrings"]
+                                               : "";
+            const uint64_t seed = device_kwargs.contains("synthetic_seed")
+                                      ? std::stoull(device_kwargs["synthetic_seed"])
+                                      : 0;
+            this->synthetic_.Configure(device_kwargs["synthetic_measurements"], bitstrings, seed);
+        }
+        if (device_kwargs.contains("throughput")) {
+            this->throughput_ = device_kwargs["throughput"] == "True";
+        }
+        RT_FAIL_IF(this->throughput_ && this->track_resources_,
+                   "Resource tracking is not supported in the throughput mode of null.qubit");
     }
     ~NullQubit()
     {
@@ -132,7 +179,12 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
      */
     auto AllocateQubit() -> QubitIdType
     {
-        QubitIdType new_qubit = this->qubit_manager.Allocate(num_qubits_);
+        if (this->throughput_) {
+            num_qubits_++;
+            return next_qubit_id_++;
+        }
+
+        QubitIdType new_qubit = this->qubit_manager.Allocate();
         if (this->track_resources_) {
             this->resource_tracker_.AllocateQubit(new_qubit);
         }
@@ -156,15 +208,35 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
         return result;
     }
 
+    /**
+     * @brief Allocate qubits directly into the register storage of the runtime.
+     */
+    void AllocateQubitsInPlace(std::span<QubitIdType> ids)
+    {
+        if (this->throughput_) {
+            std::iota(ids.begin(), ids.end(), next_qubit_id_);
+            next_qubit_id_ += static_cast<QubitIdType>(ids.size());
+            num_qubits_ += ids.size();
+            return;
+        }
+        std::generate(ids.begin(), ids.end(), [this]() { return AllocateQubit(); });
+    }
+
     /**
      * @brief Releases a previously allocated qubit
      *
-     * Decrements the qubit counter and releases the qubit through the qubit manager.
+     * Decrements the qubit counter and releases the qubit through the qubit manager, which is
+     * bypassed in the throughput mode.
      *
      * @param q The qubit ID of the qubit to release
      */
     void ReleaseQubit(QubitIdType q)
     {
+        if (this->throughput_) {
+            num_qubits_ -= num_qubits_ ? 1 : 0;
+            return;
+        }
+
         if (num_qubits_) {
             num_qubits_--;
             this->qubit_manager.Release(q);
@@ -201,7 +273,11 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
      *
      * @param shots The number of measurement shots to configure
      */
-    void SetDeviceShots(std::size_t shots) { device_shots_ = shots; }
+    void SetDeviceShots(std::size_t shots)
+    {
+        device_shots_ = shots;
+        resource_tracker_.SetShots(shots);
+    }
 
     /**
      * @brief Returns the current number of configured device shots
@@ -221,22 +297,56 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
     void SetDevicePRNG([[maybe_unused]] std::mt19937 *gen) {}
 
     /**
-     * @brief No-op implementation for starting quantum tape recording
+     * @brief No-op implementation for setting a device random stream
+     *
+     * @param engine The counter-based random stream (ignored in null device)
+     */
+    void SetDeviceStreamPRNG([[maybe_unused]] const PhiloxEngine &engine) {}
+
+    /**
+     * @brief Starts recording the operations and observables of the circuit
      *
-     * The null device doesn't maintain quantum state, so tape recording is not applicable.
-     * This method exists to satisfy the QuantumDevice interface for compatibility with
-     * caching and gradient computation systems.
+     * The recorded tape is cleared, and all subsequent operations and expectation values are
+     * cached until `StopTapeRecording` is called. The tape is used by `Gradient`.
      */
-    void StartTapeRecording() {}
+    void StartTapeRecording()
+    {
+        RT_FAIL_IF(tape_recording_, "Cannot re-activate the cache manager");
+        tape_recording_ = true;
+        cache_manager_.Reset();
+        num_tape_checkpoints_ = 0;
+    }
 
     /**
-     * @brief No-op implementation for stopping quantum tape recording
+     * @brief Stops recording the operations and observables of the circuit
      *
-     * The null device doesn't maintain quantum state, so tape recording is not applicable.
-     * This method exists to satisfy the QuantumDevice interface for compatibility with
-     * caching and gradient computation systems.
+     * The recorded tape is kept until the next call to `StartTapeRecording`.
      */
-    void StopTapeRecording() {}
+    void StopTapeRecording()
+    {
+        RT_FAIL_IF(!tape_recording_, "Cannot stop an already stopped cache manager");
+        tape_recording_ = false;
+    }
+
+    /**
+     * @brief Sets the number of recorded operations between two (null) state checkpoints
+     *
+     * With a non-zero interval, `Gradient` walks the tape segment by segment, recomputing each
+     * segment from its checkpoint instead of uncomputing the state gate by gate.
+     *
+     * @param interval The number of operations between two checkpoints; 0 disables checkpointing
+     */
+    void SetTapeCheckpointInterval(std::size_t interval) { tape_checkpoint_interval_ = interval; }
+
+    /**
+     * @brief Returns the number of state checkpoints taken while recording the current tape
+     *
+     * @return size_t The number of checkpoints
+     */
+    [[nodiscard]] auto GetNumTapeCheckpoints() const -> std::size_t
+    {
+        return num_tape_checkpoints_;
+    }
 
     /**
      * @brief No-op implementation for state preparation using a statevector
@@ -270,11 +380,41 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
         }
     }
 
+    /**
+     * @brief No-op implementation for packed computational basis state preparation
+     *
+     * @param index The index of the computational basis state (ignored)
+     * @param wires The qubits to prepare (ignored)
+     */
+    void SetBasisStateIndex(uint64_t, std::vector<QubitIdType> &wires)
+    {
+        if (this->track_resources_) {
+            this->resource_tracker_.SetBasisState(wires);
+        }
+    }
+
+    /**
+     * @brief No-op implementation for state preparation from the non-zero amplitudes
+     *
+     * Unlike the default implementation, no state vector is built for the prepared qubits.
+     *
+     * @param indices The basis states of the amplitudes (ignored)
+     * @param amplitudes The non-zero amplitudes (ignored)
+     * @param wires The qubits to prepare (ignored)
+     */
+    void SetSparseState(std::span<const int64_t>, std::span<const std::complex<double>>,
+                        std::vector<QubitIdType> &wires)
+    {
+        if (this->track_resources_) {
+            this->resource_tracker_.SetState(wires);
+        }
+    }
+
     /**
      * @brief No-op implementation for a named quantum operation
      *
      * If resource tracking is enabled, records the operation details including name,
-     * parameters, and wire usage.
+     * parameters, and wire usage. The operation is added to the tape while recording.
      *
      * @param name The name of the quantum operation (e.g., "PauliX", "CNOT", "RZ")
      * @param params Parameters for parametric gates (ignored)
@@ -286,9 +426,12 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
     void NamedOperation(const std::string &name, const std::vector<double> &params,
                         const std::vector<QubitIdType> &wires, bool inverse,
                         const std::vector<QubitIdType> &controlled_wires = {},
-                        [[maybe_unused]] const std::vector<bool> &controlled_values = {},
+                        const std::vector<bool> &controlled_values = {},
                         [[maybe_unused]] const std::vector<std::string> &optional_params = {})
     {
+        if (tape_recording_) {
+            RecordOperation(name, params, wires, inverse, {}, controlled_wires, controlled_values);
+        }
         if (this->track_resources_) {
             std::string tracked_name = name;
             if (name == "PauliRot" && !params.empty()) {
@@ -299,28 +442,108 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
         }
     }
 
+    /**
+     * @brief No-op implementation for an opcode-identified quantum operation
+     *
+     * Allocation-free unless tape recording is enabled, in which case the operation is recorded
+     * like `NamedOperation`. Resource tracking looks the opcode up in the tracker's gate ID cache,
+     * so it only allocates the first time an opcode variant is seen.
+     *
+     * @param id The opcode of the quantum operation
+     * @param params Parameters for parametric gates (ignored)
+     * @param wires The target qubits for the operation
+     * @param inverse Whether this is an adjoint (inverse) operation
+     * @param controlled_wires Control qubits for controlled operations
+     * @param controlled_values Control values for multi-controlled operations
+     */
+    void GateOperation(GateId id, std::span<const double> params,
+                       std::span<const QubitIdType> wires, bool inverse = false,
+                       std::span<const QubitIdType> controlled_wires = {},
+                       std::span<const bool> controlled_values = {})
+    {
+        if (tape_recording_) {
+            RecordOperation(std::string{getGateName(id)}, params, wires, inverse, {},
+                            controlled_wires,
+                            std::vector<bool>(controlled_values.begin(), controlled_values.end()));
+        }
+        if (this->track_resources_) {
+            this->resource_tracker_.GateOperation(id, inverse, wires, controlled_wires);
+        }
+    }
+
+    /**
+     * @brief No-op implementation for a batch of quantum operations
+     *
+     * If resource tracking or tape recording is enabled, each gate of the batch is recorded via
+     * `GateOperation`.
+     *
+     * @param gates Opcode, adjoint flag, and operand counts of each gate
+     * @param params Parameters of all gates, concatenated (ignored)
+     * @param wires Target qubits of all gates, concatenated
+     */
+    void ApplyOperations(std::span<const BatchedGate> gates, std::span<const double> params,
+                         std::span<const QubitIdType> wires)
+    {
+        if (this->track_resources_ || tape_recording_) {
+            QuantumDevice::ApplyOperations(gates, params, wires);
+        }
+    }
+
     /**
      * @brief No-op implementation for a generic matrix operation
      *
      * If resource tracking is enabled, records the operation as a general unitary matrix
      * operation.
      *
-     * @param matrix The unitary matrix defining the operation (ignored)
+     * @param matrix The unitary matrix defining the operation
      * @param wires The target qubits for the operation
      * @param inverse Whether this is an adjoint (inverse) operation
      * @param controlled_wires Control qubits for controlled operations
      * @param controlled_values Control values for multi-controlled operations
      */
-    void MatrixOperation([[maybe_unused]] const std::vector<std::complex<double>> &matrix,
+    void MatrixOperation(const std::vector<std::complex<double>> &matrix,
                          const std::vector<QubitIdType> &wires, bool inverse,
                          const std::vector<QubitIdType> &controlled_wires = {},
                          const std::vector<bool> &controlled_values = {})
     {
+        if (tape_recording_) {
+            RecordOperation("QubitUnitary", {}, wires, inverse, matrix, controlled_wires,
+                            controlled_values);
+        }
         if (this->track_resources_) {
             this->resource_tracker_.MatrixOperation(inverse, wires, controlled_wires);
         }
     }
 
+    /**
+     * @brief No-op implementation for a generic matrix operation given as a view
+     *
+     * See `MatrixOperation`.
+     *
+     * @param matrix The unitary matrix defining the operation
+     * @param wires The target qubits for the operation
+     * @param inverse Whether this is an adjoint (inverse) operation
+     * @param controlled_wires Control qubits for controlled operations
+     * @param controlled_values Control values for multi-controlled operations
+     */
+    void MatrixOperationView(DataView<std::complex<double>, 2> &matrix,
+                             std::span<const QubitIdType> wires, bool inverse = false,
+                             std::span<const QubitIdType> controlled_wires = {},
+                             std::span<const bool> controlled_values = {})
+    {
+        if (tape_recording_) {
+            RecordOperation("QubitUnitary", {}, wires, inverse,
+                            std::vector<std::complex<double>>(matrix.begin(), matrix.end()),
+                            controlled_wires,
+                            std::vector<bool>(controlled_values.begin(), controlled_values.end()));
+        }
+        if (this->track_resources_) {
+            this->resource_tracker_.MatrixOperation(
+                inverse, std::vector<QubitIdType>(wires.begin(), wires.end()),
+                std::vector<QubitIdType>(controlled_wires.begin(), controlled_wires.end()));
+        }
+    }
+
     /**
      * @brief Creates a null observable and returns a dummy identifier
      *
@@ -343,6 +566,24 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
         return 0;
     }
 
+    /**
+     * @brief Creates a null Hermitian observable from a view of its matrix
+     *
+     * See `Observable`.
+     *
+     * @param matrix The matrix representation of the observable (ignored)
+     * @param wires The qubits the observable acts on (ignored)
+     * @return ObsIdType A dummy identifier for the created observable
+     */
+    auto HermitianObservableView(DataView<std::complex<double>, 2> &, std::span<const QubitIdType>)
+        -> ObsIdType
+    {
+        if (this->track_resources_) {
+            return this->resource_tracker_.Observable(ObsId::Hermitian);
+        }
+        return 0;
+    }
+
     /**
      * @brief Creates a null tensor product observable and returns a dummy identifier
      *
@@ -381,17 +622,72 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
         return 0;
     }
 
+    /**
+     * @brief Creates a null named observable from a view of its wires
+     *
+     * See `Observable`.
+     *
+     * @param obs_id The type of observable (Identity, PauliX, PauliY, PauliZ, or Hadamard)
+     * @param wires The qubits the observable acts on (ignored)
+     * @return ObsIdType A dummy identifier for the created observable
+     */
+    auto NamedObservableView(ObsId obs_id, std::span<const QubitIdType>) -> ObsIdType
+    {
+        if (this->track_resources_) {
+            return this->resource_tracker_.Observable(obs_id);
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Creates a null tensor product observable from a view of observable identifiers
+     *
+     * See `TensorObservable`.
+     *
+     * @param obs_ids View of observable identifiers to combine
+     * @return ObsIdType A dummy identifier for the created observable
+     */
+    auto TensorObservableView(std::span<const ObsIdType> obs_ids) -> ObsIdType
+    {
+        if (this->track_resources_) {
+            return this->resource_tracker_.CombinedObservable("Prod", obs_ids.size());
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Creates a null Hamiltonian observable from views of its terms
+     *
+     * See `HamiltonianObservable`.
+     *
+     * @param coeffs Coefficients for the Hamiltonian terms (ignored)
+     * @param obs_ids Observable identifiers for the Hamiltonian terms
+     * @return ObsIdType A dummy identifier for the created observable
+     */
+    auto HamiltonianObservableView(std::span<const double>, std::span<const ObsIdType> obs_ids)
+        -> ObsIdType
+    {
+        if (this->track_resources_) {
+            return this->resource_tracker_.CombinedObservable("Hamiltonian", obs_ids.size());
+        }
+        return 0;
+    }
+
     /**
      * @brief Returns a dummy expectation value (always 0)
      *
      * The null device doesn't compute actual expectation values since it maintains
-     * no quantum state. Always returns 0 for consistency.
+     * no quantum state. Always returns 0 for consistency. The observable is added to the tape
+     * while recording.
      *
      * @param obs_id The observable identifier
      * @return double Always returns 0
      */
     auto Expval(ObsIdType obs_id) -> double
     {
+        if (tape_recording_) {
+            cache_manager_.addObservable(obs_id, MeasurementsT::Expval);
+        }
         if (this->track_resources_) {
             this->resource_tracker_.ObsMeasurement("expval", obs_id);
         }
@@ -403,13 +699,17 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
      * @brief Returns a dummy variance value (always 0)
      *
      * The null device doesn't compute actual variances since it maintains
-     * no quantum state. Always returns 0 for consistency.
+     * no quantum state. Always returns 0 for consistency. The observable is added to the tape
+     * while recording.
      *
      * @param obs_id The observable identifier
      * @return double Always returns 0
      */
     auto Var(ObsIdType obs_id) -> double
     {
+        if (tape_recording_) {
+            cache_manager_.addObservable(obs_id, MeasurementsT::Var);
+        }
         if (this->track_resources_) {
             this->resource_tracker_.ObsMeasurement("var", obs_id);
         }
@@ -432,12 +732,8 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
             this->resource_tracker_.AnalyticalMeasurement("state", "all");
         }
 
-        auto iter = state.begin();
-        *iter = 1.0;
-        if (num_qubits_ > 0) {
-            ++iter;
-            std::fill(iter, state.end(), 0.0);
-        }
+        state.fill(0.0);
+        *state.begin() = 1.0;
     }
 
     /**
@@ -455,7 +751,7 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
             this->resource_tracker_.AnalyticalMeasurement("probs", "all");
         }
 
-        MakeProbsDummyReturn(probs);
+        MakeProbsDummyReturn(probs, num_qubits_);
     }
 
     /**
@@ -473,7 +769,7 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
             this->resource_tracker_.AnalyticalMeasurement("probs", std::to_string(wires.size()));
         }
 
-        MakeProbsDummyReturn(probs);
+        MakeProbsDummyReturn(probs, wires.size());
     }
 
     /**
@@ -490,7 +786,7 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
             this->resource_tracker_.AnalyticalMeasurement("sample", "all");
         }
 
-        MakeSampleDummyReturn(samples);
+        MakeSampleDummyReturn(samples, num_qubits_);
     }
 
     /**
@@ -508,7 +804,61 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
             this->resource_tracker_.AnalyticalMeasurement("sample", std::to_string(wires.size()));
         }
 
-        MakeSampleDummyReturn(samples);
+        MakeSampleDummyReturn(samples, wires.size());
+    }
+
+    /**
+     * @brief Hands out dummy samples in chunks of shots
+     *
+     * All chunks share a single buffer, of zeros unless the measurements are synthetic, and the
+     * sampling is tracked as a single measurement rather than once per chunk.
+     *
+     * @param wires Qubits to compute samples for, or all qubits if empty
+     * @param chunk_shots The maximum number of shots per chunk
+     * @param callback Invoked with each chunk of samples and its number of shots
+     */
+    void SampleChunked(const std::vector<QubitIdType> &wires, std::size_t chunk_shots,
+                       const std::function<void(DataView<double, 2> &, std::size_t)> &callback)
+    {
+        RT_FAIL_IF(!chunk_shots, "The number of shots per sample chunk must be positive");
+        if (this->track_resources_) {
+            this->resource_tracker_.AnalyticalMeasurement(
+                "sample", wires.empty() ? "all" : std::to_string(wires.size()));
+        }
+
+        const std::size_t num_wires = wires.empty() ? num_qubits_ : wires.size();
+        std::vector<double> buffer(std::min(device_shots_, chunk_shots) * num_wires, 0.0);
+        for (std::size_t done = 0; done < device_shots_; done += chunk_shots) {
+            const std::size_t num_shots = std::min(chunk_shots, device_shots_ - done);
+            const std::size_t sizes[2] = {num_shots, num_wires};
+            const std::size_t strides[2] = {num_wires, 1};
+            DataView<double, 2> chunk(buffer.data(), 0, sizes, strides);
+            if (synthetic_.IsEnabled()) {
+                synthetic_.FillSamples(chunk, num_shots, num_wires);
+            }
+            callback(chunk, num_shots);
+        }
+    }
+
+    /**
+     * @brief Fills the packed sample array with ground state measurements (all zero bits)
+     *
+     * @param samples The 2D packed sample array to fill (shape: shots × words per shot)
+     * @param wires The subset of qubits to sample from, or all qubits if empty
+     */
+    void PackedSample(DataView<uint64_t, 2> &samples, const std::vector<QubitIdType> &wires)
+    {
+        if (this->track_resources_) {
+            this->resource_tracker_.AnalyticalMeasurement(
+                "sample", wires.empty() ? "all" : std::to_string(wires.size()));
+        }
+
+        if (synthetic_.IsEnabled()) {
+            synthetic_.FillPackedSamples(samples, device_shots_,
+                                         wires.empty() ? num_qubits_ : wires.size());
+            return;
+        }
+        samples.fill(0);
     }
 
     /**
@@ -528,7 +878,7 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
             this->resource_tracker_.AnalyticalMeasurement("counts", "all");
         }
 
-        MakeCountsDummyReturn(eigvals, counts);
+        MakeCountsDummyReturn(eigvals, counts, num_qubits_);
     }
 
     /**
@@ -548,7 +898,7 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
             this->resource_tracker_.AnalyticalMeasurement("counts", std::to_string(wires.size()));
         }
 
-        MakeCountsDummyReturn(eigvals, counts);
+        MakeCountsDummyReturn(eigvals, counts, wires.size());
     }
 
     /**
@@ -566,7 +916,26 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
         if (this->track_resources_) {
             this->resource_tracker_.MidMeasurement();
         }
-        return const_cast<Result>(&GLOBAL_RESULT_FALSE_CONST);
+        return MakeMeasurementDummyReturn();
+    }
+
+    /**
+     * @brief Performs a group of dummy measurements that always return false
+     *
+     * @param wires The qubits to measure
+     * @param postselects Optional postselection value of each measurement (ignored)
+     * @param results The measurement results, all set to the global false constant
+     */
+    void MeasureBatch(std::span<const QubitIdType> wires,
+                      std::span<const std::optional<int32_t>>, std::span<Result> results)
+    {
+        if (this->track_resources_) {
+            for (std::size_t i = 0; i < wires.size(); i++) {
+                this->resource_tracker_.MidMeasurement();
+            }
+        }
+        std::generate(results.begin(), results.end(),
+                      [this]() { return MakeMeasurementDummyReturn(); });
     }
 
     /**
@@ -585,27 +954,91 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
     }
 
     /**
-     * @brief No-op implementation for gradient computation
+     * @brief Computes the (all-zero) Jacobian of the recorded tape with the adjoint method
      *
-     * The null device doesn't maintain quantum state or support gradient computation.
-     * This method exists to satisfy the QuantumDevice interface.
+     * The recorded operations are walked in reverse once per recorded observable, the way an
+     * adjoint-method simulator applies the inverse of each gate to its two states and the
+     * generator of each trainable parameter. With checkpointing, each segment is first
+     * recomputed from its checkpoint, and the ket states of the segment are restored instead of
+     * uncomputed. No state is updated; the number of gate applications is accumulated in
+     * `GetNumAdjointGateApplications` instead. Since all expectation values of the null device
+     * are constant, every derivative is 0.
      *
-     * @param gradients Vector of gradient data views (not modified)
-     * @param trainable_params Indices of trainable parameters (ignored)
+     * @param gradients One pre-allocated gradient per recorded observable
+     * @param trainable_params Indices of the trainable parameters; all if empty
      */
-    void Gradient(std::vector<DataView<double, 1>> &, const std::vector<std::size_t> &) {}
+    void Gradient(std::vector<DataView<double, 1>> &gradients,
+                  const std::vector<std::size_t> &trainable_params)
+    {
+        const std::size_t num_observables = cache_manager_.getNumObservables();
+        const std::size_t num_params = cache_manager_.getNumParams();
+        RT_FAIL_IF(gradients.size() != num_observables,
+                   "Invalid number of pre-allocated gradients");
+
+        const std::size_t num_trainable =
+            trainable_params.empty() ? num_params : trainable_params.size();
+        std::vector<bool> is_trainable(num_params, trainable_params.empty());
+        for (std::size_t param : trainable_params) {
+            RT_FAIL_IF(param >= num_params, "Invalid trainable parameter");
+            is_trainable[param] = true;
+        }
+
+        const std::size_t num_ops = cache_manager_.getNumOperations();
+        for (auto &gradient : gradients) {
+            RT_FAIL_IF(gradient.size() != num_trainable, "Invalid size of the gradient");
+
+            // Reverse pass: the inverse of each operation is applied to both the bra and the ket
+            // states, and the generator of each trainable parameter to a copy of the ket state.
+            // Checkpointed segments are recomputed forward from their checkpoint instead of
+            // uncomputing the ket state.
+            const std::size_t segment_size =
+                tape_checkpoint_interval_ ? tape_checkpoint_interval_ : num_ops;
+            std::size_t param_idx = num_params;
+            for (std::size_t segment_end = num_ops; segment_end > 0;) {
+                const std::size_t segment_begin =
+                    (segment_end - 1) / segment_size * segment_size;
+                if (tape_checkpoint_interval_) {
+                    num_adjoint_gate_applications_ += segment_end - segment_begin;
+                }
+                for (std::size_t op_idx = segment_end; op_idx-- > segment_begin;) {
+                    num_adjoint_gate_applications_ += tape_checkpoint_interval_ ? 1 : 2;
+                    for (std::size_t i = cache_manager_.getOperationParameters(op_idx).size();
+                         i > 0; i--) {
+                        if (is_trainable[--param_idx]) {
+                            num_adjoint_gate_applications_++;
+                        }
+                    }
+                }
+                segment_end = segment_begin;
+            }
+
+            gradient.fill(0.0);
+        }
+    }
 
     /**
-     * @brief Returns dummy cache manager information
+     * @brief Returns the number of gate applications the adjoint method would have performed
+     * in all calls to `Gradient` so far
      *
-     * The null device doesn't support caching, so this returns zero counts and empty vectors.
+     * @return size_t The number of simulated gate and generator applications
+     */
+    [[nodiscard]] auto GetNumAdjointGateApplications() const -> std::size_t
+    {
+        return num_adjoint_gate_applications_;
+    }
+
+    /**
+     * @brief Returns the statistics of the recorded tape
      *
-     * @return Tuple containing cache statistics (all zeros/empty)
+     * @return Tuple containing the number of operations, observables and parameters, the names
+     * of the operations and the keys of the observables
      */
     auto CacheManagerInfo() -> std::tuple<std::size_t, std::size_t, std::size_t,
                                           std::vector<std::string>, std::vector<ObsIdType>>
     {
-        return {0, 0, 0, {}, {}};
+        return {cache_manager_.getNumOperations(), cache_manager_.getNumObservables(),
+                cache_manager_.getNumParams(), cache_manager_.getOperationsNames(),
+                cache_manager_.getObservablesKeys()};
     }
 
     /**
@@ -628,27 +1061,73 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
      */
     auto IsTrackingResources() const -> bool { return track_resources_; }
 
+    auto IsThroughputMode() const -> bool { return throughput_; }
+
+    /**
+     * @brief Returns the resource tracker of the device
+     *
+     * Gives access to the resource counts and cost estimates of the current execution before
+     * they are written out, e.g. for a scheduler to compare the estimates of several devices.
+     *
+     * @return const ResourceTracker& The resource tracker
+     */
+    auto GetResourceTracker() const -> const ResourceTracker & { return resource_tracker_; }
+
   private:
-    void MakeProbsDummyReturn(DataView<double, 1> &probs)
+    void RecordOperation(const std::string &name, std::span<const double> params,
+                         std::span<const QubitIdType> wires, bool inverse,
+                         std::span<const std::complex<double>> matrix,
+                         std::span<const QubitIdType> controlled_wires,
+                         const std::vector<bool> &controlled_values)
     {
-        auto iter = probs.begin();
-        *iter = 1.0;
-        if (num_qubits_ > 0) {
-            ++iter;
-            std::fill(iter, probs.end(), 0.0);
+        if (tape_checkpoint_interval_ &&
+            cache_manager_.getNumOperations() % tape_checkpoint_interval_ == 0) {
+            num_tape_checkpoints_++;
+        }
+
+        auto toDeviceIds = [this](std::span<const QubitIdType> ids) {
+            std::vector<std::size_t> dev_ids;
+            dev_ids.reserve(ids.size());
+            for (auto id : ids) {
+                // The qubits are not managed in the throughput mode
+                dev_ids.push_back(this->throughput_ ? static_cast<std::size_t>(id)
+                                                    : this->qubit_manager.getDeviceId(id));
+            }
+            return dev_ids;
+        };
+        cache_manager_.addOperation(name, params, toDeviceIds(wires), inverse, matrix,
+                                    toDeviceIds(controlled_wires), controlled_values);
+    }
+
+    void MakeProbsDummyReturn(DataView<double, 1> &probs, std::size_t num_wires)
+    {
+        if (synthetic_.IsEnabled()) {
+            synthetic_.FillProbs(probs, num_wires);
+            return;
         }
+        probs.fill(0.0);
+        *probs.begin() = 1.0;
     }
 
-    void MakeSampleDummyReturn(DataView<double, 2> &samples)
+    void MakeSampleDummyReturn(DataView<double, 2> &samples, std::size_t num_wires)
     {
         // If num_qubits == 0, the samples array is unallocated (shape=(shots, 0)), so don't fill
-        if (num_qubits_ > 0) {
-            std::fill(samples.begin(), samples.end(), 0.0);
+        if (num_qubits_ > 0 && synthetic_.IsEnabled()) {
+            synthetic_.FillSamples(samples, device_shots_, num_wires);
+        }
+        else if (num_qubits_ > 0) {
+            samples.fill(0.0);
         }
     }
 
-    void MakeCountsDummyReturn(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts)
+    void MakeCountsDummyReturn(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                               std::size_t num_wires)
     {
+        if (num_qubits_ > 0 && synthetic_.IsEnabled()) {
+            synthetic_.FillCounts(eigvals, counts, device_shots_, num_wires);
+            return;
+        }
+
         auto iter_eigvals = eigvals.begin();
         *iter_eigvals = 0.0;
         ++iter_eigvals;
@@ -665,11 +1144,26 @@ struct NullQubit final : public Catalyst::Runtime::QuantumDevice {
 
     bool track_resources_{false};
     ResourceTracker resource_tracker_;
+    bool throughput_{false};
+    SyntheticMeasurements synthetic_;
+    QubitIdType next_qubit_id_{0};
     std::size_t num_qubits_{0};
     std::size_t device_shots_{0};
-    Catalyst::Runtime::QubitManager<QubitIdType, std::size_t> qubit_manager{};
+    Catalyst::Runtime::FlatQubitManager<QubitIdType, std::size_t> qubit_manager{};
+    Catalyst::Runtime::CacheManager<std::complex<double>> cache_manager_{};
+    bool tape_recording_{false};
+    std::size_t tape_checkpoint_interval_{0};
+    std::size_t num_tape_checkpoints_{0};
+    std::size_t num_adjoint_gate_applications_{0};
+
+    auto MakeMeasurementDummyReturn() -> Result
+    {
+        return const_cast<Result>(synthetic_.NextMeasurement() ? &GLOBAL_RESULT_TRUE_CONST
+                                                               : &GLOBAL_RESULT_FALSE_CONST);
+    }
 
     // static constants for RESULT values
+    static constexpr bool GLOBAL_RESULT_TRUE_CONST = true;
     static constexpr bool GLOBAL_RESULT_FALSE_CONST = false;
 };
 } // namespace Catalyst::Runtime::Devices
@@ -13,11 +13,15 @@
 // limitations under the License.
 
 #include <chrono>
+#include <exception>
+#include <limits>
+#include <span>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "QuantumDevice.hpp"
 #include "Utils.hpp"
 
 namespace Catalyst::Runtime {
@@ -29,106 +33,254 @@ namespace Catalyst::Runtime {
  * This class provides comprehensive tracking of quantum circuit resources during execution,
  * including counting gate types and sizes, tracking maximum wire usage, and optionally
  * computing circuit depth. It can export the collected data to JSON format for analysis.
+ *
+ * It can also estimate the cost of the execution from a table of gate durations: the duration of
+ * a shot is the critical path of the circuit where every gate takes its tabulated duration (or the
+ * default one), and the memory is the size of a state vector over the maximum number of wires.
+ *
+ * Recording a gate is kept cheap so that circuits with billions of gates can be tracked: gate
+ * names are interned into dense IDs (and gate opcodes are mapped to these IDs without building a
+ * name), counters are flat arrays indexed by gate ID, gate size and qubit ID, and the depth and
+ * duration are updated in a single streaming pass. Names are only materialized when the JSON is
+ * written out.
  */
 struct ResourceTracker final {
   private:
     std::unordered_map<ObsIdType, std::string> observable_names_;
 
-    std::unordered_map<std::string, std::size_t> gate_types_;
-    std::unordered_map<std::size_t, std::size_t> gate_sizes_;
-    std::unordered_map<QubitIdType, std::size_t> wire_depths_;
+    // The per-qubit state, indexed by qubit ID
+    struct WireState {
+        std::size_t depth = 0;
+        double time = 0; // The finish time of the last operation on the wire
+        bool allocated = false;
+    };
+
+    // Opcodes with more control wires than this go through the name-based interning
+    static constexpr std::size_t max_cached_controls_ = 3;
+    static constexpr std::size_t no_gate_id_ = std::numeric_limits<std::size_t>::max();
+
+    std::unordered_map<std::string, std::size_t> gate_ids_;
+    std::vector<std::string> gate_names_;      // Indexed by gate ID
+    std::vector<std::string> gate_base_names_; // Indexed by gate ID
+    std::vector<std::size_t> gate_counts_;     // Indexed by gate ID
+    std::vector<double> gate_id_durations_;    // Indexed by gate ID
+    std::vector<std::size_t> opcode_gate_ids_; // Indexed by OpcodeSlot
+    std::vector<std::size_t> gate_sizes_;      // Indexed by the number of wires
+    std::vector<WireState> wires_;
     std::unordered_map<std::string, std::size_t> measurements_;
+    std::unordered_map<std::string, double> gate_durations_;
 
     std::size_t max_num_wires_;
     std::size_t curr_num_wires_;
     std::size_t total_allocd_wires_;
     std::size_t
         max_deallocd_depth_; // The maximum depth of any qubit which has already been released
+    double max_deallocd_time_; // The maximum finish time of any qubit which has been released
+    double default_gate_duration_;
+    std::size_t shots_;
     bool static_filename_;
     bool compute_depth_;
+    bool estimate_cost_;
     std::string resources_filename_;
 
     /**
-     * @brief Update the depth of the circuit given by the wires and controlled wires.
+     * @brief Returns the interned ID of a gate name, assigning a new one if needed
      *
-     * @param wires The wires the operation is being applied to
-     * @param controlled_wires The control wires the operation is being applied to
+     * @param name The full name of the operation, including its modifiers
+     * @param base_name The name of the operation without modifiers, used to look up its duration
      */
-    void UpdateDepth(const std::vector<QubitIdType> &wires,
-                     const std::vector<QubitIdType> &controlled_wires = {})
+    auto InternGate(const std::string &name, const std::string &base_name = "") -> std::size_t
     {
-        if (!compute_depth_) {
-            return;
+        auto [it, inserted] = gate_ids_.try_emplace(name, gate_names_.size());
+        if (inserted) {
+            gate_names_.push_back(name);
+            gate_base_names_.push_back(base_name);
+            gate_counts_.push_back(0);
+            gate_id_durations_.push_back(GetGateDuration(name, base_name));
         }
+        return it->second;
+    }
 
-        std::size_t max_depth = 0;
+    /**
+     * @brief Returns the slot of an opcode in the opcode to gate ID cache
+     *
+     * @return The slot, or no_gate_id_ if the operation has too many control wires to be cached
+     */
+    static auto OpcodeSlot(GateId id, bool inverse, std::size_t num_controls) -> std::size_t
+    {
+        if (num_controls > max_cached_controls_) {
+            return no_gate_id_;
+        }
+        return (static_cast<std::size_t>(id) * 2 + inverse) * (max_cached_controls_ + 1) +
+               num_controls;
+    }
+
+    /**
+     * @brief Returns the decorated name of a named operation, e.g. `2C(Adjoint(S))`
+     */
+    static auto DecorateName(const std::string &name, bool inverse, std::size_t num_controls)
+        -> std::string
+    {
+        std::string prefix = "";
+        std::string suffix = "";
+        if (num_controls != 0) {
+            if (num_controls > 1) {
+                prefix += std::to_string(num_controls);
+            }
+            prefix += "C(";
+            suffix += ")";
+        }
+        if (inverse) {
+            prefix += "Adjoint(";
+            suffix += ")";
+        }
+        return prefix + name + suffix;
+    }
+
+    /**
+     * @brief Check that the wires given by the wires and controlled wires are allocated.
+     *
+     * @param wires The wires the operation is being applied to
+     * @param controlled_wires The control wires the operation is being applied to
+     */
+    void CheckWires(std::span<const QubitIdType> wires,
+                    std::span<const QubitIdType> controlled_wires) const
+    {
+        auto is_allocated = [this](QubitIdType i) {
+            return i >= 0 && static_cast<std::size_t>(i) < wires_.size() && wires_[i].allocated;
+        };
         for (const auto &i : wires) {
-            auto curr_depth = wire_depths_.find(i);
-            RT_FAIL_IF(curr_depth == wire_depths_.end(),
+            RT_FAIL_IF(!is_allocated(i),
                        ("Wire index " + std::to_string(i) + " is not an allocated wire").c_str());
-            max_depth = std::max(max_depth, curr_depth->second);
         }
         for (const auto &i : controlled_wires) {
-            auto curr_depth = wire_depths_.find(i);
             RT_FAIL_IF(
-                curr_depth == wire_depths_.end(),
+                !is_allocated(i),
                 ("Control wire index " + std::to_string(i) + " is not an allocated wire").c_str());
-            max_depth = std::max(max_depth, curr_depth->second);
         }
+    }
 
-        max_depth++;
-        for (const auto &i : wires) {
-            wire_depths_[i] = max_depth;
+    /**
+     * @brief Update the depth and the finish times of the wires given by the wires and controlled
+     * wires. The wires must have been checked with CheckWires.
+     *
+     * @param duration The duration of the operation
+     * @param wires The wires the operation is being applied to
+     * @param controlled_wires The control wires the operation is being applied to
+     */
+    void UpdateWires(double duration, std::span<const QubitIdType> wires,
+                     std::span<const QubitIdType> controlled_wires)
+    {
+        std::size_t max_depth = 0;
+        double start_time = 0;
+        for (const auto &wire_list : {wires, controlled_wires}) {
+            for (const auto &i : wire_list) {
+                max_depth = std::max(max_depth, wires_[i].depth);
+                start_time = std::max(start_time, wires_[i].time);
+            }
         }
-        for (const auto &i : controlled_wires) {
-            wire_depths_[i] = max_depth;
+
+        for (const auto &wire_list : {wires, controlled_wires}) {
+            for (const auto &i : wire_list) {
+                if (compute_depth_) {
+                    wires_[i].depth = max_depth + 1;
+                }
+                if (estimate_cost_) {
+                    wires_[i].time = start_time + duration;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Refresh the durations of the interned gates after the duration table has changed
+     */
+    void UpdateGateIdDurations()
+    {
+        for (std::size_t i = 0; i < gate_names_.size(); i++) {
+            gate_id_durations_[i] = GetGateDuration(gate_names_[i], gate_base_names_[i]);
         }
     }
 
     /**
      * @brief Internal method to record an operation being applied to the device
      *
-     * Updates the gate type and size counts, and if depth tracking is enabled,
-     * updates the depth of the wires involved in the operation.
+     * Updates the gate type and size counts, and if depth tracking or cost estimation is
+     * enabled, updates the depth or the finish time of the wires involved in the operation.
      *
-     * @param name The name of the operation
+     * @param gate_id The interned ID of the operation
      * @param wires The wires the operation is being applied to
      * @param controlled_wires The control wires the operation is being applied to
      */
-    void RecordOperation(const std::string &name, const std::vector<QubitIdType> &wires,
-                         const std::vector<QubitIdType> &controlled_wires)
+    void RecordOperation(std::size_t gate_id, std::span<const QubitIdType> wires,
+                         std::span<const QubitIdType> controlled_wires)
     {
-        UpdateDepth(wires, controlled_wires);
+        if (compute_depth_ || estimate_cost_) {
+            CheckWires(wires, controlled_wires);
+            UpdateWires(gate_id_durations_[gate_id], wires, controlled_wires);
+        }
         std::size_t total_wires = wires.size() + controlled_wires.size();
+        if (total_wires >= gate_sizes_.size()) {
+            gate_sizes_.resize(total_wires + 1, 0);
+        }
 
-        gate_types_[name]++;
+        gate_counts_[gate_id]++;
         gate_sizes_[total_wires]++;
     }
 
+    /**
+     * @brief Internal method to record a named operation being applied to the device
+     *
+     * @param name The name of the operation
+     * @param wires The wires the operation is being applied to
+     * @param controlled_wires The control wires the operation is being applied to
+     * @param base_name The name of the operation without modifiers, used to look up its duration
+     */
+    void RecordOperation(const std::string &name, std::span<const QubitIdType> wires,
+                         std::span<const QubitIdType> controlled_wires,
+                         const std::string &base_name = "")
+    {
+        if (compute_depth_ || estimate_cost_) {
+            // Do not intern the name of an operation that is going to be rejected
+            CheckWires(wires, controlled_wires);
+        }
+        RecordOperation(InternGate(name, base_name), wires, controlled_wires);
+    }
+
   public:
     /**
      * @brief Default constructor that initializes the ResourceTracker with default settings
      *
-     * Initializes the tracker with depth computation disabled and no static filename set.
-     * Calls Reset() to ensure all tracking data structures are properly initialized.
+     * Initializes the tracker with depth computation and cost estimation disabled and no static
+     * filename set. Calls Reset() to ensure all tracking data structures are properly initialized.
      */
-    ResourceTracker() : static_filename_(false), compute_depth_(false) { Reset(); }
+    ResourceTracker()
+        : opcode_gate_ids_(static_cast<std::size_t>(GateId::NumGates) * 2 *
+                               (max_cached_controls_ + 1),
+                           no_gate_id_),
+          default_gate_duration_(1.0), shots_(0), static_filename_(false), compute_depth_(false),
+          estimate_cost_(false)
+    {
+        Reset();
+    }
 
     /**
      * @brief Resets all tracked resource data to initial state
      *
      * Clears all gate type counts, gate size counts, wire depth information,
      * and resets the maximum wire count to zero. Does not affect configuration
-     * settings like depth computation or filename settings.
+     * settings like depth computation, cost estimation or filename settings.
+     * Interned gate names are kept, so that the next execution does not intern them again.
      */
     void Reset()
     {
-        gate_types_.clear();
+        std::fill(gate_counts_.begin(), gate_counts_.end(), 0);
         gate_sizes_.clear();
-        wire_depths_.clear();
+        wires_.clear();
         max_num_wires_ = 0;
         curr_num_wires_ = 0;
         max_deallocd_depth_ = 0;
+        max_deallocd_time_ = 0;
         total_allocd_wires_ = 0;
     }
 
@@ -144,11 +296,12 @@ struct ResourceTracker final {
     auto GetNumGates(const std::string &gate_name = "") -> std::size_t
     {
         if (gate_name != "") {
-            return gate_types_[gate_name];
+            auto gate_id = gate_ids_.find(gate_name);
+            return gate_id != gate_ids_.end() ? gate_counts_[gate_id->second] : 0;
         }
 
         std::size_t num_gates = 0;
-        for (const auto &[gate_type, count] : gate_types_) {
+        for (const auto &count : gate_counts_) {
             num_gates += count;
         }
         return num_gates;
@@ -184,7 +337,7 @@ struct ResourceTracker final {
      */
     auto GetNumGatesBySize(const std::size_t &gate_size) -> std::size_t
     {
-        return gate_sizes_[gate_size];
+        return gate_size < gate_sizes_.size() ? gate_sizes_[gate_size] : 0;
     }
 
     /**
@@ -223,19 +376,151 @@ struct ResourceTracker final {
      */
     auto GetDepth() const -> std::size_t
     {
-        if (compute_depth_) {
-            if (!wire_depths_.empty()) {
-                auto max_pair = std::max_element(wire_depths_.begin(), wire_depths_.end(),
-                                                 [](const std::pair<QubitIdType, std::size_t> &p1,
-                                                    const std::pair<QubitIdType, std::size_t> &p2) {
-                                                     return p1.second < p2.second;
-                                                 });
-                return std::max(max_deallocd_depth_, max_pair->second);
+        if (!compute_depth_) {
+            return 0;
+        }
+
+        std::size_t depth = max_deallocd_depth_;
+        for (const auto &wire : wires_) {
+            if (wire.allocated) {
+                depth = std::max(depth, wire.depth);
             }
+        }
+        return depth;
+    }
 
-            return max_deallocd_depth_;
+    /**
+     * @brief Returns whether the cost of the execution is currently estimated
+     *
+     * @return True if cost estimation is enabled, false otherwise
+     */
+    auto GetEstimateCost() const -> bool { return estimate_cost_; }
+
+    /**
+     * @brief Returns the duration of an operation in the gate duration table
+     *
+     * @param name The full name of the operation, including its modifiers
+     * @param base_name The name of the operation without modifiers
+     * @return The duration of `name` if it is in the table, else the duration of `base_name` if it
+     * is in the table, else the default gate duration
+     */
+    auto GetGateDuration(const std::string &name, const std::string &base_name = "") const
+        -> double
+    {
+        for (const auto &key : {name, base_name}) {
+            auto duration = gate_durations_.find(key);
+            if (duration != gate_durations_.end()) {
+                return duration->second;
+            }
         }
-        return 0;
+        return default_gate_duration_;
+    }
+
+    /**
+     * @brief Returns the estimated duration of a single shot
+     * Only runs if cost estimation is enabled, otherwise always returns 0
+     *
+     * @return The critical path of the circuit, in the units of the gate duration table
+     */
+    auto GetEstimatedDuration() const -> double
+    {
+        if (!estimate_cost_) {
+            return 0;
+        }
+
+        double duration = max_deallocd_time_;
+        for (const auto &wire : wires_) {
+            if (wire.allocated) {
+                duration = std::max(duration, wire.time);
+            }
+        }
+        return duration;
+    }
+
+    /**
+     * @brief Returns the estimated duration of the execution over all the shots
+     *
+     * An analytic execution (zero shots) costs as much as a single shot.
+     *
+     * @return The estimated duration of a shot times the number of shots
+     */
+    auto GetEstimatedTotalDuration() const -> double
+    {
+        return GetEstimatedDuration() * static_cast<double>(std::max<std::size_t>(shots_, 1));
+    }
+
+    /**
+     * @brief Returns the memory needed to simulate the execution with a state vector
+     *
+     * @return The size in bytes of a complex128 state vector over the maximum number of wires,
+     * saturated at the maximum value of std::size_t
+     */
+    auto GetStateVectorBytes() const -> std::size_t
+    {
+        constexpr std::size_t amplitude_bytes = 16;
+        constexpr std::size_t max_bits = std::numeric_limits<std::size_t>::digits - 5;
+        if (max_num_wires_ > max_bits) {
+            return std::numeric_limits<std::size_t>::max();
+        }
+        return amplitude_bytes << max_num_wires_;
+    }
+
+    /**
+     * @brief Sets the number of shots of the execution, used by the cost estimates
+     *
+     * @param shots The number of shots, or 0 for an analytic execution
+     */
+    void SetShots(std::size_t shots) { shots_ = shots; }
+
+    /**
+     * @brief Sets the duration of the operations not in the gate duration table
+     *
+     * @param duration The default gate duration
+     */
+    void SetDefaultGateDuration(double duration)
+    {
+        default_gate_duration_ = duration;
+        UpdateGateIdDurations();
+    }
+
+    /**
+     * @brief Sets the gate duration table from a list of entries, and enables cost estimation
+     *
+     * The entries are separated by ';' and have the form `NAME=DURATION`, e.g.
+     * `RX=20;CNOT=200;C(RX)=300`. An entry for a base gate name (e.g. `RX`) also applies to its
+     * adjoint and controlled variants that have no entry of their own.
+     *
+     * @param durations The gate duration table
+     * @throws Runtime error if an entry is malformed
+     */
+    void SetGateDurations(const std::string &durations)
+    {
+        std::istringstream entries(durations);
+        std::string entry;
+        while (std::getline(entries, entry, ';')) {
+            if (entry.empty()) {
+                continue;
+            }
+            std::size_t separator = entry.find('=');
+            RT_FAIL_IF(separator == std::string::npos || separator == 0,
+                       ("Invalid gate duration entry '" + entry + "'").c_str());
+
+            std::string value = entry.substr(separator + 1);
+            std::size_t parsed_chars = 0;
+            double duration = -1;
+            try {
+                duration = std::stod(value, &parsed_chars);
+            }
+            catch (const std::exception &) {
+                parsed_chars = 0;
+            }
+            RT_FAIL_IF(parsed_chars == 0 || parsed_chars != value.size() || duration < 0,
+                       ("Invalid gate duration entry '" + entry + "'").c_str());
+
+            gate_durations_[entry.substr(0, separator)] = duration;
+        }
+        UpdateGateIdDurations();
+        SetEstimateCost(true);
     }
 
     /**
@@ -261,9 +546,11 @@ struct ResourceTracker final {
         total_allocd_wires_++;
         max_num_wires_ = std::max(max_num_wires_, curr_num_wires_);
 
-        if (compute_depth_) {
-            wire_depths_[qid] = 0;
+        RT_FAIL_IF(qid < 0, "Cannot track a qubit with a negative ID.");
+        if (static_cast<std::size_t>(qid) >= wires_.size()) {
+            wires_.resize(static_cast<std::size_t>(qid) + 1);
         }
+        wires_[qid] = WireState{0, 0, true};
     }
 
     /**
@@ -275,9 +562,11 @@ struct ResourceTracker final {
     {
         curr_num_wires_--;
 
-        if (compute_depth_) {
-            max_deallocd_depth_ = std::max(max_deallocd_depth_, wire_depths_[qid]);
-            wire_depths_.erase(qid);
+        if (qid >= 0 && static_cast<std::size_t>(qid) < wires_.size()) {
+            auto &wire = wires_[qid];
+            max_deallocd_depth_ = std::max(max_deallocd_depth_, wire.depth);
+            max_deallocd_time_ = std::max(max_deallocd_time_, wire.time);
+            wire = WireState{};
         }
     }
 
@@ -297,6 +586,22 @@ struct ResourceTracker final {
         this->compute_depth_ = compute_depth;
     }
 
+    /**
+     * @brief Enables or disables the estimation of the cost of the execution
+     *
+     * Must be run before any qubits have been allocated and any gates have been executed
+     *
+     * @param estimate_cost Whether to enable cost estimation
+     * @throws Runtime error if called after qubits have already been allocated
+     */
+    void SetEstimateCost(const bool estimate_cost)
+    {
+        if (total_allocd_wires_ != 0) {
+            RT_FAIL("Cannot set cost estimation after qubits have been allocated.");
+        }
+        this->estimate_cost_ = estimate_cost;
+    }
+
     /**
      * @brief Records a named quantum operation for resource tracking
      *
@@ -314,20 +619,39 @@ struct ResourceTracker final {
                         const std::vector<QubitIdType> &wires,
                         const std::vector<QubitIdType> &controlled_wires = {})
     {
-        std::string prefix = "";
-        std::string suffix = "";
-        if (!controlled_wires.empty()) {
-            if (controlled_wires.size() > 1) {
-                prefix += std::to_string(controlled_wires.size());
+        RecordOperation(DecorateName(name, inverse, controlled_wires.size()), wires,
+                        controlled_wires, name);
+    }
+
+    /**
+     * @brief Records an opcode-identified quantum operation for resource tracking
+     *
+     * Equivalent to `NamedOperation(getGateName(id), ...)`, but the decorated name is only built
+     * the first time an opcode is seen with a given adjoint flag and number of control wires, so
+     * that recording the operation does not allocate.
+     *
+     * @param id The opcode of the quantum operation
+     * @param inverse Whether this is an adjoint (inverse) operation
+     * @param wires The target wires the operation acts upon
+     * @param controlled_wires The control wires for controlled operations (empty for
+     * non-controlled)
+     */
+    void GateOperation(GateId id, bool inverse, std::span<const QubitIdType> wires,
+                       std::span<const QubitIdType> controlled_wires = {})
+    {
+        const std::size_t slot = OpcodeSlot(id, inverse, controlled_wires.size());
+        std::size_t gate_id = slot != no_gate_id_ ? opcode_gate_ids_[slot] : no_gate_id_;
+        if (gate_id == no_gate_id_) {
+            if (compute_depth_ || estimate_cost_) {
+                CheckWires(wires, controlled_wires);
+            }
+            const std::string name{getGateName(id)};
+            gate_id = InternGate(DecorateName(name, inverse, controlled_wires.size()), name);
+            if (slot != no_gate_id_) {
+                opcode_gate_ids_[slot] = gate_id;
             }
-            prefix += "C(";
-            suffix += ")";
-        }
-        if (inverse) {
-            prefix += "Adjoint(";
-            suffix += ")";
         }
-        RecordOperation(prefix + name + suffix, wires, controlled_wires);
+        RecordOperation(gate_id, wires, controlled_wires);
     }
 
     /**
@@ -345,7 +669,8 @@ struct ResourceTracker final {
     void MatrixOperation(bool inverse, const std::vector<QubitIdType> &wires,
                          const std::vector<QubitIdType> &controlled_wires = {})
     {
-        std::string op_name = "QubitUnitary";
+        const std::string base_name = "QubitUnitary";
+        std::string op_name = base_name;
 
         if (!controlled_wires.empty()) {
             op_name = "Controlled" + op_name;
@@ -353,7 +678,7 @@ struct ResourceTracker final {
         if (inverse) {
             op_name = "Adjoint(" + op_name + ")";
         }
-        RecordOperation(op_name, wires, controlled_wires);
+        RecordOperation(op_name, wires, controlled_wires, base_name);
     }
 
     /**
@@ -483,7 +808,7 @@ struct ResourceTracker final {
      *
      * Outputs comprehensive resource tracking data including number of wires,
      * total gate count, breakdown by gate types, breakdown by gate sizes,
-     * and circuit depth (if enabled) in JSON format.
+     * circuit depth (if enabled) and cost estimates (if enabled) in JSON format.
      *
      * @param resources_file File pointer where JSON data will be written
      * @throws Runtime error if file writing fails
@@ -496,15 +821,34 @@ struct ResourceTracker final {
         resources << "  \"num_wires\": " << max_num_wires_ << ",\n";
         resources << "  \"num_gates\": " << GetNumGates() << ",\n";
         resources << "  \"total_allocations\": " << total_allocd_wires_ << ",\n";
+        std::unordered_map<std::string, std::size_t> gate_types;
+        for (std::size_t i = 0; i < gate_counts_.size(); i++) {
+            if (gate_counts_[i] != 0) {
+                gate_types[gate_names_[i]] = gate_counts_[i];
+            }
+        }
+        std::unordered_map<std::size_t, std::size_t> gate_sizes;
+        for (std::size_t i = 0; i < gate_sizes_.size(); i++) {
+            if (gate_sizes_[i] != 0) {
+                gate_sizes[i] = gate_sizes_[i];
+            }
+        }
+
         resources << "  \"gate_types\": ";
-        pretty_print_dict(gate_types_, 2, resources);
+        pretty_print_dict(gate_types, 2, resources);
         resources << ",\n";
         resources << "  \"gate_sizes\": ";
-        pretty_print_dict(gate_sizes_, 2, resources);
+        pretty_print_dict(gate_sizes, 2, resources);
         resources << ",\n";
         resources << "  \"measurements\": ";
         pretty_print_dict(measurements_, 2, resources);
         resources << ",\n";
+        if (estimate_cost_) {
+            resources << "  \"shots\": " << shots_ << ",\n";
+            resources << "  \"estimated_duration\": " << GetEstimatedDuration() << ",\n";
+            resources << "  \"estimated_total_duration\": " << GetEstimatedTotalDuration() << ",\n";
+            resources << "  \"state_vector_bytes\": " << GetStateVectorBytes() << ",\n";
+        }
         if (compute_depth_) {
             resources << "  \"depth\": " << GetDepth();
         }
@@ -0,0 +1,277 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DataView.hpp"
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime {
+
+/**
+ * @brief The synthetic measurement outcomes of the null device, so that the classical processing
+ * of samples, counts and mid-circuit measurements can be benchmarked on realistic data without a
+ * simulator.
+ *
+ * The outcomes follow one of the distributions:
+ * - "zeros": every qubit is measured in |0⟩, the default
+ * - "uniform": shot `s` measures the basis state of index `s` modulo the number of basis states,
+ *   so that all outcomes are equally frequent, and mid-circuit measurements alternate 0 and 1
+ * - "bitstrings": the shots cycle through fixed bitstrings, whose character `j` is the outcome of
+ *   the `j`-th measured qubit (0 past its end), and mid-circuit measurements cycle through their
+ *   concatenated bits
+ * - "random": independent fair outcomes from a pseudo-random generator with a fixed seed
+ *
+ * The shots and the mid-circuit measurements continue the same deterministic sequence across
+ * calls. Each shot is produced as packed 64-bit words, one bit per qubit, so that the random
+ * distribution draws one random number per 64 qubits.
+ */
+class SyntheticMeasurements final {
+  public:
+    enum class Distribution { Zeros, Uniform, Bitstrings, Random };
+
+  private:
+    Distribution distribution_{Distribution::Zeros};
+    std::vector<std::string> bitstrings_;
+    std::mt19937_64 engine_{0};
+    uint64_t next_shot_{0};
+    uint64_t next_measurement_{0};
+    uint64_t random_bits_{0};
+    std::size_t num_random_bits_{0};
+
+    [[nodiscard]] static auto numWords(std::size_t num_wires) -> std::size_t
+    {
+        return (num_wires + 63) / 64;
+    }
+
+    /**
+     * @brief Write the outcome of the next shot on `num_wires` qubits to `words`, where bit
+     * `j % 64` of word `j / 64` is the outcome of qubit `j`.
+     */
+    void nextShot(std::span<uint64_t> words, std::size_t num_wires)
+    {
+        std::fill(words.begin(), words.end(), 0);
+        const uint64_t shot = next_shot_++;
+        switch (distribution_) {
+        case Distribution::Zeros:
+            break;
+        case Distribution::Uniform:
+            // The first qubit is the most significant bit of the index of the basis state
+            for (std::size_t j = 0; j < num_wires && j < 64; j++) {
+                const std::size_t wire = num_wires - 1 - j;
+                words[wire / 64] |= ((shot >> j) & 1) << (wire % 64);
+            }
+            break;
+        case Distribution::Bitstrings: {
+            const std::string &bitstring = bitstrings_[shot % bitstrings_.size()];
+            for (std::size_t j = 0; j < num_wires && j < bitstring.size(); j++) {
+                words[j / 64] |= static_cast<uint64_t>(bitstring[j] == '1') << (j % 64);
+            }
+            break;
+        }
+        case Distribution::Random:
+            for (uint64_t &word : words) {
+                word = engine_();
+            }
+            if (num_wires % 64) {
+                words.back() &= (uint64_t{1} << (num_wires % 64)) - 1;
+            }
+            break;
+        }
+    }
+
+  public:
+    /**
+     * @brief Set the distribution of the outcomes.
+     *
+     * @param distribution One of "zeros", "uniform", "bitstrings" and "random"
+     * @param bitstrings The bitstrings of the "bitstrings" distribution, separated by ';'
+     * @param seed The seed of the "random" distribution
+     */
+    void Configure(const std::string &distribution, const std::string &bitstrings,
+                   uint64_t seed)
+    {
+        if (distribution == "zeros") {
+            distribution_ = Distribution::Zeros;
+        }
+        else if (distribution == "uniform") {
+            distribution_ = Distribution::Uniform;
+        }
+        else if (distribution == "bitstrings") {
+            distribution_ = Distribution::Bitstrings;
+        }
+        else if (distribution == "random") {
+            distribution_ = Distribution::Random;
+        }
+        else {
+            RT_FAIL(("Invalid synthetic measurement distribution '" + distribution + "'").c_str());
+        }
+
+        bitstrings_.clear();
+        std::istringstream entries(bitstrings);
+        std::string entry;
+        while (std::getline(entries, entry, ';')) {
+            RT_FAIL_IF(entry.find_first_not_of("01") != std::string::npos,
+                       ("Invalid synthetic bitstring '" + entry + "'").c_str());
+            if (!entry.empty()) {
+                bitstrings_.push_back(entry);
+            }
+        }
+        RT_FAIL_IF(distribution_ == Distribution::Bitstrings && bitstrings_.empty(),
+                   "The bitstrings distribution requires at least one synthetic bitstring");
+
+        engine_.seed(seed);
+        next_shot_ = 0;
+        next_measurement_ = 0;
+        num_random_bits_ = 0;
+    }
+
+    [[nodiscard]] auto GetDistribution() const -> Distribution { return distribution_; }
+
+    [[nodiscard]] auto IsEnabled() const -> bool { return distribution_ != Distribution::Zeros; }
+
+    /**
+     * @brief Get the outcome of the next mid-circuit measurement.
+     */
+    auto NextMeasurement() -> bool
+    {
+        const uint64_t measurement = next_measurement_++;
+        switch (distribution_) {
+        case Distribution::Zeros:
+            return false;
+        case Distribution::Uniform:
+            return measurement & 1;
+        case Distribution::Bitstrings: {
+            // Cycle through the bits of the concatenated bitstrings
+            std::size_t total = 0;
+            for (const auto &bitstring : bitstrings_) {
+                total += bitstring.size();
+            }
+            std::size_t bit = measurement % total;
+            for (const auto &bitstring : bitstrings_) {
+                if (bit < bitstring.size()) {
+                    return bitstring[bit] == '1';
+                }
+                bit -= bitstring.size();
+            }
+            return false;
+        }
+        case Distribution::Random:
+            if (!num_random_bits_) {
+                random_bits_ = engine_();
+                num_random_bits_ = 64;
+            }
+            num_random_bits_--;
+            return (random_bits_ >> num_random_bits_) & 1;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Fill the samples of shape (shots, num_wires) with the next `shots` shots.
+     */
+    void FillSamples(DataView<double, 2> &samples, std::size_t shots, std::size_t num_wires)
+    {
+        std::vector<uint64_t> words(numWords(num_wires));
+        const bool contiguous = samples.is_contiguous();
+        double *row = samples.data();
+        for (std::size_t shot = 0; shot < shots; shot++, row += num_wires) {
+            nextShot(words, num_wires);
+            for (std::size_t j = 0; j < num_wires; j++) {
+                const double bit = static_cast<double>((words[j / 64] >> (j % 64)) & 1);
+                if (contiguous) {
+                    row[j] = bit;
+                }
+                else {
+                    samples(shot, j) = bit;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Fill the bit-packed samples of shape (shots, ceil(num_wires / 64)) with the next
+     * `shots` shots.
+     */
+    void FillPackedSamples(DataView<uint64_t, 2> &samples, std::size_t shots,
+                           std::size_t num_wires)
+    {
+        std::vector<uint64_t> words(numWords(num_wires));
+        for (std::size_t shot = 0; shot < shots; shot++) {
+            nextShot(words, num_wires);
+            for (std::size_t w = 0; w < words.size(); w++) {
+                samples(shot, w) = words[w];
+            }
+        }
+    }
+
+    /**
+     * @brief Fill the counts of each basis state of `num_wires` qubits over the next `shots`
+     * shots, with the index of each basis state as its eigenvalue.
+     */
+    void FillCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts, std::size_t shots,
+                    std::size_t num_wires)
+    {
+        std::size_t state = 0;
+        for (auto &eigval : eigvals) {
+            eigval = static_cast<double>(state++);
+        }
+        counts.fill(0);
+
+        std::vector<uint64_t> words(numWords(num_wires));
+        for (std::size_t shot = 0; shot < shots; shot++) {
+            nextShot(words, num_wires);
+            std::size_t index = 0;
+            for (std::size_t j = 0; j < num_wires; j++) {
+                index = (index << 1) | ((words[j / 64] >> (j % 64)) & 1);
+            }
+            counts(index)++;
+        }
+    }
+
+    /**
+     * @brief Fill the probabilities of each basis state of `num_wires` qubits under the
+     * distribution, those of "random" being uniform.
+     */
+    void FillProbs(DataView<double, 1> &probs, std::size_t num_wires)
+    {
+        if (distribution_ == Distribution::Uniform || distribution_ == Distribution::Random) {
+            probs.fill(1.0 / static_cast<double>(probs.size()));
+            return;
+        }
+
+        probs.fill(0.0);
+        if (distribution_ == Distribution::Zeros) {
+            probs(0) = 1.0;
+            return;
+        }
+        for (const auto &bitstring : bitstrings_) {
+            std::size_t index = 0;
+            for (std::size_t j = 0; j < num_wires; j++) {
+                index = (index << 1) | (j < bitstring.size() && bitstring[j] == '1');
+            }
+            probs(index) += 1.0 / static_cast<double>(bitstrings_.size());
+        }
+    }
+};
+
+} // namespace Catalyst::Runtime
@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "Exception.hpp"
+#include "ProgramTemplate.hpp"
 
 namespace Catalyst::Runtime::Device::OpenQasm {
 
@@ -286,6 +287,8 @@ struct MatrixBuilder {
     }
 };
 
+using QasmProgramTemplate = Catalyst::Runtime::ProgramTemplate;
+
 /**
  * The OpenQasm gate type.
  *
@@ -330,48 +333,90 @@ class QasmGate {
 
     [[nodiscard]] auto getName() const -> std::string { return name; }
     [[nodiscard]] auto getMatrix() const -> std::vector<std::complex<double>> { return matrix; }
-    [[nodiscard]] auto getParams() const -> std::vector<double> { return params_val; }
+    [[nodiscard]] auto getParams() const -> const std::vector<double> & { return params_val; }
     [[nodiscard]] auto getParamsStr() const -> std::vector<std::string> { return params_str; }
     [[nodiscard]] auto getWires() const -> std::vector<size_t> { return wires; }
     [[nodiscard]] auto getInverse() const -> bool { return inverse; }
 
-    [[nodiscard]] auto toOpenQasm(const QasmRegister &qregister, size_t precision = 5,
-                                  const std::string &version = "3.0") const -> std::string
+    /**
+     * @brief Check whether the gates only differ in their parameter values.
+     */
+    [[nodiscard]] auto hasSameStructure(const QasmGate &other) const -> bool
+    {
+        return name == other.name && wires == other.wires && inverse == other.inverse &&
+               params_val.size() == other.params_val.size() && params_str == other.params_str &&
+               matrix == other.matrix;
+    }
+
+    /**
+     * @brief Combine everything that `hasSameStructure` compares into `seed`.
+     */
+    void hashStructure(size_t &seed) const
+    {
+        hashCombine(seed, name);
+        hashCombine(seed, inverse);
+        hashCombine(seed, params_val.size());
+        for (const auto &param : params_str) {
+            hashCombine(seed, param);
+        }
+        for (auto wire : wires) {
+            hashCombine(seed, wire);
+        }
+        for (const auto &c : matrix) {
+            hashCombine(seed, c.real());
+            hashCombine(seed, c.imag());
+        }
+    }
+
+    /**
+     * @brief Append the gate to `program`, with a placeholder for each parameter value.
+     */
+    void toOpenQasm(QasmProgramTemplate &program, const QasmRegister &qregister,
+                    size_t precision = 5, const std::string &version = "3.0") const
     {
-        std::ostringstream oss;
         // @note This is a Braket specific functionality
         // #pragma braket unitary(matrix) qubit_1, ..., qubit_m
         if (name == "QubitUnitary") {
-            oss << "#pragma braket unitary(";
-            oss << MatrixBuilder::toOpenQasm(matrix, (1UL << wires.size()), precision, version);
-            oss << ") ";
-            oss << qregister.toOpenQasm(RegisterMode::Slice, wires) << "\n";
-            return oss.str();
+            program.append("#pragma braket unitary(");
+            program.append(
+                MatrixBuilder::toOpenQasm(matrix, (1UL << wires.size()), precision, version));
+            program.append(") ");
+            program.append(qregister.toOpenQasm(RegisterMode::Slice, wires));
+            program.append("\n");
+            return;
         }
 
         // name(param_1, ..., param_n) qubit_1, ..., qubit_m
-        oss << name;
+        program.append(name);
         if (!params_val.empty()) {
-            oss << "(";
-            auto iter = params_val.begin();
-            for (; iter != params_val.end() - 1; iter++) {
-                oss << std::setprecision(precision) << *iter << ", ";
+            program.append("(");
+            for (size_t idx = 0; idx < params_val.size(); idx++) {
+                program.append(idx ? ", " : "");
+                program.appendParam();
             }
-            oss << std::setprecision(precision) << *iter << ") ";
+            program.append(") ");
         }
         else if (!params_str.empty()) {
-            oss << "(";
-            auto iter = params_str.begin();
-            for (; iter != params_str.end() - 1; iter++) {
-                oss << *iter << ", ";
+            program.append("(");
+            for (size_t idx = 0; idx < params_str.size(); idx++) {
+                program.append(idx ? ", " : "");
+                program.append(params_str[idx]);
             }
-            oss << *iter << ") ";
+            program.append(") ");
         }
         else {
-            oss << " ";
+            program.append(" ");
         }
-        oss << qregister.toOpenQasm(RegisterMode::Slice, wires) << ";\n";
-        return oss.str();
+        program.append(qregister.toOpenQasm(RegisterMode::Slice, wires));
+        program.append(";\n");
+    }
+
+    [[nodiscard]] auto toOpenQasm(const QasmRegister &qregister, size_t precision = 5,
+                                  const std::string &version = "3.0") const -> std::string
+    {
+        QasmProgramTemplate program(precision);
+        toOpenQasm(program, qregister, precision, version);
+        return program.bind(params_val);
     }
 };
 
@@ -634,6 +679,8 @@ class OpenQasmBuilder {
     std::vector<QasmMeasure> measures;
     size_t num_qubits;
     size_t num_bits;
+    // Hash of everything but the gate parameter values, updated as the circuit is built
+    size_t structure_hash{0};
 
   public:
     explicit OpenQasmBuilder() : num_qubits(0), num_bits(0) {}
@@ -645,6 +692,10 @@ class OpenQasmBuilder {
 
     void Register(RegisterType type, const std::string &name, size_t size)
     {
+        hashCombine(structure_hash, static_cast<uint8_t>(type));
+        hashCombine(structure_hash, name);
+        hashCombine(structure_hash, size);
+
         switch (type) {
         case RegisterType::Qubit:
             qregs.emplace_back(type, name, size);
@@ -664,6 +715,7 @@ class OpenQasmBuilder {
               [[maybe_unused]] bool inverse)
     {
         gates.emplace_back(name, params_val, params_str, wires, inverse);
+        gates.back().hashStructure(structure_hash);
 
         for (auto &param : params_str) {
             vars.emplace_back(VariableType::Float, param);
@@ -673,11 +725,87 @@ class OpenQasmBuilder {
               [[maybe_unused]] bool inverse)
     {
         gates.emplace_back(matrix, wires, inverse);
+        gates.back().hashStructure(structure_hash);
+    }
+    void Measure(size_t bit, size_t wire)
+    {
+        measures.emplace_back(bit, wire);
+        hashCombine(structure_hash, bit);
+        hashCombine(structure_hash, wire);
     }
-    void Measure(size_t bit, size_t wire) { measures.emplace_back(bit, wire); }
 
-    [[nodiscard]] virtual auto toOpenQasm(size_t precision = 5,
-                                          const std::string &version = "3.0") const -> std::string
+    /**
+     * @brief Get the hash of everything but the gate parameter values. Circuits with the same
+     * structure have the same hash.
+     */
+    [[nodiscard]] auto getStructureHash() const -> size_t { return structure_hash; }
+
+    /**
+     * @brief Get the numeric parameters of all gates, in the order of `toOpenQasmTemplate`.
+     */
+    [[nodiscard]] auto getParams() const -> std::vector<double>
+    {
+        std::vector<double> params;
+        for (auto &gate : gates) {
+            const auto &gate_params = gate.getParams();
+            params.insert(params.end(), gate_params.begin(), gate_params.end());
+        }
+        return params;
+    }
+
+    /**
+     * @brief Check whether the circuits only differ in the values of their gate parameters,
+     * in which case they share the same `toOpenQasmTemplate`.
+     *
+     * Circuits with different structure hashes are told apart without walking them.
+     */
+    [[nodiscard]] auto hasSameStructure(const OpenQasmBuilder &other) const -> bool
+    {
+        if (structure_hash != other.structure_hash) {
+            return false;
+        }
+
+        auto same_var = [](const QasmVariable &lhs, const QasmVariable &rhs) {
+            return lhs.getType() == rhs.getType() && lhs.getName() == rhs.getName();
+        };
+        auto same_reg = [](const QasmRegister &lhs, const QasmRegister &rhs) {
+            return lhs.getType() == rhs.getType() && lhs.getName() == rhs.getName() &&
+                   lhs.getSize() == rhs.getSize();
+        };
+        auto same_gate = [](const QasmGate &lhs, const QasmGate &rhs) {
+            return lhs.hasSameStructure(rhs);
+        };
+        auto same_measure = [](const QasmMeasure &lhs, const QasmMeasure &rhs) {
+            return lhs.getBit() == rhs.getBit() && lhs.getWire() == rhs.getWire();
+        };
+
+        return num_qubits == other.num_qubits && num_bits == other.num_bits &&
+               std::equal(vars.begin(), vars.end(), other.vars.begin(), other.vars.end(),
+                          same_var) &&
+               std::equal(qregs.begin(), qregs.end(), other.qregs.begin(), other.qregs.end(),
+                          same_reg) &&
+               std::equal(bregs.begin(), bregs.end(), other.bregs.begin(), other.bregs.end(),
+                          same_reg) &&
+               std::equal(gates.begin(), gates.end(), other.gates.begin(), other.gates.end(),
+                          same_gate) &&
+               std::equal(measures.begin(), measures.end(), other.measures.begin(),
+                          other.measures.end(), same_measure);
+    }
+
+    [[nodiscard]] virtual auto clone() const -> std::unique_ptr<OpenQasmBuilder>
+    {
+        return std::make_unique<OpenQasmBuilder>(*this);
+    }
+
+    /**
+     * @brief Serialise the circuit with a placeholder for each numeric gate parameter.
+     *
+     * Binding the template to `getParams()` gives the same program as `toOpenQasm`, and it can
+     * be re-bound to the parameters of any circuit of the same structure.
+     */
+    [[nodiscard]] virtual auto toOpenQasmTemplate(size_t precision = 5,
+                                                  const std::string &version = "3.0") const
+        -> QasmProgramTemplate
     {
         RT_FAIL_IF(qregs.size() != 1, "Invalid number of quantum registers; Only one quantum "
                                       "register is currently supported.");
@@ -686,47 +814,53 @@ class OpenQasmBuilder {
                    "Invalid number of measurement results registers; At most one measurement"
                    "results register is currently supported.");
 
-        std::ostringstream oss;
+        QasmProgramTemplate program(precision);
 
         // header
-        oss << "OPENQASM " << version << ";\n";
+        program.append("OPENQASM " + version + ";\n");
 
         // variables
         for (auto &var : vars) {
-            oss << var.toOpenQasm();
+            program.append(var.toOpenQasm());
         }
 
         // quantum registers
         for (auto &qreg : qregs) {
-            oss << qreg.toOpenQasm(RegisterMode::Alloc);
+            program.append(qreg.toOpenQasm(RegisterMode::Alloc));
         }
 
         // measurement results registers
         for (auto &breg : bregs) {
-            oss << breg.toOpenQasm(RegisterMode::Alloc);
+            program.append(breg.toOpenQasm(RegisterMode::Alloc));
         }
 
         // quantum gates assuming qregs.size() == 1
         for (auto &gate : gates) {
-            oss << gate.toOpenQasm(qregs[0], precision);
+            gate.toOpenQasm(program, qregs[0], precision);
         }
 
         // quantum measures assuming qregs.size() == 1, bregs.size() <= 1
         for (auto &m : measures) {
             if (bregs.empty()) {
-                oss << m.toOpenQasm(qregs[0]);
+                program.append(m.toOpenQasm(qregs[0]));
             }
             else {
-                oss << m.toOpenQasm(bregs[0], qregs[0]);
+                program.append(m.toOpenQasm(bregs[0], qregs[0]));
             }
         }
 
         // reset quantum registers
         for (auto &qreg : qregs) {
-            oss << qreg.toOpenQasm(RegisterMode::Reset);
+            program.append(qreg.toOpenQasm(RegisterMode::Reset));
         }
 
-        return oss.str();
+        return program;
+    }
+
+    [[nodiscard]] auto toOpenQasm(size_t precision = 5, const std::string &version = "3.0") const
+        -> std::string
+    {
+        return toOpenQasmTemplate(precision, version).bind(getParams());
     }
 
     [[nodiscard]] virtual auto
@@ -752,8 +886,14 @@ class BraketBuilder : public OpenQasmBuilder {
   public:
     using OpenQasmBuilder::OpenQasmBuilder;
 
-    [[nodiscard]] auto toOpenQasm(size_t precision = 5, const std::string &version = "3.0") const
-        -> std::string override
+    [[nodiscard]] auto clone() const -> std::unique_ptr<OpenQasmBuilder> override
+    {
+        return std::make_unique<BraketBuilder>(*this);
+    }
+
+    [[nodiscard]] auto toOpenQasmTemplate(size_t precision = 5,
+                                          const std::string &version = "3.0") const
+        -> QasmProgramTemplate override
     {
         RT_FAIL_IF(qregs.size() != 1, "Invalid number of quantum registers; Only one quantum "
                                       "register is currently supported.");
@@ -763,34 +903,35 @@ class BraketBuilder : public OpenQasmBuilder {
             "Invalid number of measurement results registers; User-specified measurement results "
             "register is not currently supported.");
 
-        std::ostringstream oss;
+        QasmProgramTemplate program(precision);
 
         // header
-        oss << "OPENQASM " << version << ";\n";
+        program.append("OPENQASM " + version + ";\n");
 
         // variables
         for (auto &var : vars) {
-            oss << var.toOpenQasm();
+            program.append(var.toOpenQasm());
         }
 
         // quantum registers
-        oss << qregs[0].toOpenQasm(RegisterMode::Alloc, {}, version);
+        program.append(qregs[0].toOpenQasm(RegisterMode::Alloc, {}, version));
 
         // measurement results registers
         QasmRegister braket_mresults{RegisterType::Bit, "bits", qregs[0].getSize()};
-        oss << braket_mresults.toOpenQasm(RegisterMode::Alloc, {}, version);
+        program.append(braket_mresults.toOpenQasm(RegisterMode::Alloc, {}, version));
 
         // quantum gates assuming qregs.size() == 1
         for (auto &gate : gates) {
-            oss << gate.toOpenQasm(qregs[0], precision, version);
+            gate.toOpenQasm(program, qregs[0], precision, version);
         }
 
         // quantum measures assuming bregs[0].size() == qregs[0].size()
         // and "mresults" isn't a user-specified register.
         QasmMeasure braket_measure{0, 0};
-        oss << braket_measure.toOpenQasm(braket_mresults, qregs[0], RegisterMode::Name, version);
+        program.append(
+            braket_measure.toOpenQasm(braket_mresults, qregs[0], RegisterMode::Name, version));
 
-        return oss.str();
+        return program;
     }
 
     [[nodiscard]] auto toOpenQasmWithCustomInstructions(const std::string &serialized_instructions,
@@ -15,6 +15,8 @@
 #include "OpenQasmDevice.hpp"
 
 #include <bitset>
+#include <future>
+#include <numeric>
 
 #include "Exception.hpp"
 
@@ -36,7 +38,7 @@ auto OpenQasmDevice::AllocateQubits(size_t num_qubits) -> std::vector<QubitIdTyp
 
     builder->Register(OpenQasm::RegisterType::Qubit, "qubits", new_num_qubits);
 
-    std::vector<QubitIdType> result = qubit_manager.AllocateRange(cur_num_qubits, num_qubits);
+    std::vector<QubitIdType> result = qubit_manager.AllocateRange(num_qubits);
 
     RT_FAIL_IF(!this->initial_allocated_QubitIds.empty(),
                "OpenQASM device does not support dynamic qubit allocation")
@@ -53,6 +55,10 @@ void OpenQasmDevice::ReleaseQubits(const std::vector<QubitIdType> &qubits)
                "initial `AllocateQubits` call")
     this->initial_allocated_QubitIds.clear();
 
+    // The next execution is a new task, even if it runs the same circuit.
+    results_circuit.clear();
+    results.clear();
+
     // refresh the builder for device re-use.
     if (builder_type != OpenQasm::BuilderType::Common) {
         builder = std::make_unique<OpenQasm::BraketBuilder>();
@@ -62,6 +68,76 @@ void OpenQasmDevice::ReleaseQubits(const std::vector<QubitIdType> &qubits)
     }
 }
 
+auto OpenQasmDevice::getCircuit() -> std::string
+{
+    if (!cached_builder || !builder->hasSameStructure(*cached_builder)) {
+        cached_program = builder->toOpenQasmTemplate();
+        cached_builder = builder->clone();
+    }
+    return cached_program->bind(builder->getParams());
+}
+
+auto OpenQasmDevice::getResult(const std::string &result_type) -> std::vector<double>
+{
+    auto &&circuit = builder->toOpenQasmWithCustomInstructions("", 9);
+    if (circuit != results_circuit || device_shots != results_shots) {
+        if (!results_builder || !builder->hasSameStructure(*results_builder)) {
+            result_types.clear();
+        }
+        results_builder = builder->clone();
+        results_circuit = circuit;
+        results_shots = device_shots;
+        results.clear();
+    }
+
+    if (auto it = results.find(result_type); it != results.end()) {
+        return it->second;
+    }
+
+    std::vector<std::string> pending_types;
+    if (device_shots == 0) {
+        if (std::find(result_types.begin(), result_types.end(), result_type) ==
+            result_types.end()) {
+            result_types.push_back(result_type);
+        }
+        for (const auto &type : result_types) {
+            if (!results.contains(type)) {
+                pending_types.push_back(type);
+            }
+        }
+    }
+    else {
+        pending_types.push_back(result_type);
+    }
+
+    std::ostringstream oss;
+    for (const auto &type : pending_types) {
+        oss << type << "\n";
+    }
+
+    std::string s3_folder_str{};
+    if (device_kwargs.contains("s3_destination_folder")) {
+        s3_folder_str = device_kwargs["s3_destination_folder"];
+    }
+
+    std::string device_info{};
+    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
+        device_info = device_kwargs["device_arn"];
+    }
+    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
+        device_info = device_kwargs["backend"];
+    }
+
+    auto &&values = runner->Results(circuit + oss.str(), device_info, device_shots, s3_folder_str);
+    RT_FAIL_IF(values.size() != pending_types.size(),
+               "Invalid number of result types returned for the submitted circuit");
+
+    for (size_t i = 0; i < pending_types.size(); i++) {
+        results[pending_types[i]] = std::move(values[i]);
+    }
+    return results[result_type];
+}
+
 auto OpenQasmDevice::GetNumQubits() const -> size_t { return builder->getNumQubits(); }
 
 void OpenQasmDevice::SetDeviceShots(size_t shots) { device_shots = shots; }
@@ -145,22 +221,7 @@ auto OpenQasmDevice::Expval(ObsIdType obsKey) -> double
 
     std::ostringstream oss;
     oss << "#pragma braket result expectation " << obs->toOpenQasm(builder->getQubits()[0]);
-    auto &&circuit = builder->toOpenQasmWithCustomInstructions(oss.str(), 9);
-
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
-
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
-    }
-
-    return runner->Expval(circuit, device_info, device_shots, s3_folder_str);
+    return getResult(oss.str())[0];
 }
 
 auto OpenQasmDevice::Var(ObsIdType obsKey) -> double
@@ -173,22 +234,7 @@ auto OpenQasmDevice::Var(ObsIdType obsKey) -> double
 
     std::ostringstream oss;
     oss << "#pragma braket result variance " << obs->toOpenQasm(builder->getQubits()[0]);
-    auto &&circuit = builder->toOpenQasmWithCustomInstructions(oss.str(), 9);
-
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
-
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
-    }
-
-    return runner->Var(circuit, device_info, device_shots, s3_folder_str);
+    return getResult(oss.str())[0];
 }
 
 void OpenQasmDevice::State(DataView<std::complex<double>, 1> &state)
@@ -214,7 +260,7 @@ void OpenQasmDevice::State(DataView<std::complex<double>, 1> &state)
         runner->State(circuit, device_info, device_shots, GetNumQubits(), s3_folder_str);
     RT_FAIL_IF(state.size() != dv_state.size(), "Invalid size for the pre-allocated state vector");
 
-    std::move(dv_state.begin(), dv_state.end(), state.begin());
+    state.copy_from(dv_state.begin());
 }
 
 void OpenQasmDevice::Probs(DataView<double, 1> &probs)
@@ -232,12 +278,12 @@ void OpenQasmDevice::Probs(DataView<double, 1> &probs)
         device_info = device_kwargs["backend"];
     }
 
-    auto &&dv_probs = runner->Probs(builder->toOpenQasm(), device_info, device_shots,
-                                    GetNumQubits(), s3_folder_str);
+    auto &&dv_probs = runner->Probs(getCircuit(), device_info, device_shots, GetNumQubits(),
+                                    s3_folder_str);
 
     RT_FAIL_IF(probs.size() != dv_probs.size(), "Invalid size for the pre-allocated probabilities");
 
-    std::move(dv_probs.begin(), dv_probs.end(), probs.begin());
+    probs.copy_from(dv_probs.begin());
 }
 
 void OpenQasmDevice::PartialProbs(DataView<double, 1> &probs, const std::vector<QubitIdType> &wires)
@@ -248,27 +294,11 @@ void OpenQasmDevice::PartialProbs(DataView<double, 1> &probs, const std::vector<
     std::ostringstream oss;
     oss << "#pragma braket result probability "
         << builder->getQubits()[0].toOpenQasm(OpenQasm::RegisterMode::Slice, dev_wires);
-    auto &&circuit = builder->toOpenQasmWithCustomInstructions(oss.str());
-
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
-
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
-    }
-
-    auto &&dv_probs =
-        runner->Probs(circuit, device_info, device_shots, wires.size(), s3_folder_str);
+    auto &&dv_probs = getResult(oss.str());
 
     RT_FAIL_IF(probs.size() != dv_probs.size(), "Invalid size for the pre-allocated probabilities");
 
-    std::move(dv_probs.begin(), dv_probs.end(), probs.begin());
+    probs.copy_from(dv_probs.begin());
 }
 
 void OpenQasmDevice::Sample(DataView<double, 2> &samples)
@@ -286,18 +316,11 @@ void OpenQasmDevice::Sample(DataView<double, 2> &samples)
         device_info = device_kwargs["backend"];
     }
 
-    auto &&li_samples = runner->Sample(builder->toOpenQasm(), device_info, device_shots,
-                                       GetNumQubits(), s3_folder_str);
+    auto &&li_samples = runner->Sample(getCircuit(), device_info, device_shots, GetNumQubits(),
+                                       s3_folder_str);
     RT_FAIL_IF(samples.size() != li_samples.size(), "Invalid size for the pre-allocated samples");
 
-    const size_t numQubits = GetNumQubits();
-
-    auto samplesIter = samples.begin();
-    for (size_t shot = 0; shot < device_shots; shot++) {
-        for (size_t wire = 0; wire < numQubits; wire++) {
-            *(samplesIter++) = static_cast<double>(li_samples[shot * numQubits + wire]);
-        }
-    }
+    samples.copy_from(li_samples.begin());
 }
 
 void OpenQasmDevice::PartialSample(DataView<double, 2> &samples,
@@ -327,8 +350,8 @@ void OpenQasmDevice::PartialSample(DataView<double, 2> &samples,
         device_info = device_kwargs["backend"];
     }
 
-    auto &&li_samples = runner->Sample(builder->toOpenQasm(), device_info, device_shots,
-                                       GetNumQubits(), s3_folder_str);
+    auto &&li_samples = runner->Sample(getCircuit(), device_info, device_shots, GetNumQubits(),
+                                       s3_folder_str);
 
     auto samplesIter = samples.begin();
     for (size_t shot = 0; shot < device_shots; shot++) {
@@ -338,6 +361,114 @@ void OpenQasmDevice::PartialSample(DataView<double, 2> &samples,
     }
 }
 
+void OpenQasmDevice::PendingBatch::run(const OpenQasm::OpenQasmRunner &runner)
+{
+    std::vector<size_t> samples;
+    try {
+        if (circuits.size() == 1) {
+            samples = runner.Sample(circuits[0], device_info, shots, num_qubits, s3_folder);
+        }
+        else {
+            samples = runner.SampleBatch(circuits, device_info, shots, num_qubits, s3_folder);
+        }
+        RT_FAIL_IF(samples.size() != circuits.size() * shots * num_qubits,
+                   "Invalid number of samples returned for the submitted batch");
+    }
+    catch (...) {
+        for (auto &result : results) {
+            result.set_exception(std::current_exception());
+        }
+        return;
+    }
+
+    for (size_t idx = 0; idx < circuits.size(); idx++) {
+        const size_t *circuit_samples = samples.data() + idx * shots * num_qubits;
+
+        std::vector<double> result;
+        result.reserve(shots * dev_wires[idx].size());
+        for (size_t shot = 0; shot < shots; shot++) {
+            for (auto wire : dev_wires[idx]) {
+                result.push_back(static_cast<double>(circuit_samples[shot * num_qubits + wire]));
+            }
+        }
+        results[idx].set_value(std::move(result));
+    }
+}
+
+void OpenQasmDevice::runBatches()
+{
+    while (true) {
+        std::unique_ptr<PendingBatch> batch;
+        {
+            std::lock_guard<std::mutex> lock(batches_mu);
+            if (batches.empty()) {
+                batches_running = false;
+                return;
+            }
+            batch = std::move(batches.front());
+            batches.pop_front();
+        }
+        batch->run(*runner);
+    }
+}
+
+auto OpenQasmDevice::SubmitSample(const std::vector<QubitIdType> &wires)
+    -> std::future<std::vector<double>>
+{
+    const size_t numQubits = GetNumQubits();
+    RT_FAIL_IF(wires.size() > numQubits, "Invalid number of wires");
+    RT_FAIL_IF(!isValidQubits(wires), "Invalid given wires to measure");
+
+    std::vector<size_t> dev_wires(numQubits);
+    if (wires.empty()) {
+        std::iota(dev_wires.begin(), dev_wires.end(), 0);
+    }
+    else {
+        dev_wires = getDeviceWires(wires);
+    }
+
+    // The batch takes a snapshot of the circuit, so the device can keep building the next one.
+    // The runner is owned by the device, which stays in the device pool while jobs are pending.
+    std::string circuit = getCircuit();
+    std::future<std::vector<double>> samples;
+    {
+        std::lock_guard<std::mutex> lock(batches_mu);
+
+        // The batches that are not yet running are still open for circuits of the same shape
+        if (batches.empty() || batches.back()->shots != device_shots ||
+            batches.back()->num_qubits != numQubits) {
+            auto batch = std::make_unique<PendingBatch>();
+            batch->shots = device_shots;
+            batch->num_qubits = numQubits;
+
+            if (device_kwargs.contains("s3_destination_folder")) {
+                batch->s3_folder = device_kwargs["s3_destination_folder"];
+            }
+            if (builder_type == OpenQasm::BuilderType::BraketRemote) {
+                batch->device_info = device_kwargs["device_arn"];
+            }
+            else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
+                batch->device_info = device_kwargs["backend"];
+            }
+            batches.push_back(std::move(batch));
+        }
+
+        PendingBatch &batch = *batches.back();
+        batch.circuits.push_back(std::move(circuit));
+        batch.dev_wires.push_back(std::move(dev_wires));
+        samples = batch.results.emplace_back().get_future();
+
+        if (batches_running) {
+            return samples;
+        }
+        batches_running = true;
+    }
+
+    // A previous worker has already drained the queue, so replacing it only waits for it to return
+    batches_worker = std::async(std::launch::async, [this]() { runBatches(); });
+    return samples;
+}
+
 void OpenQasmDevice::Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts)
 {
     const size_t numQubits = GetNumQubits();
@@ -359,8 +490,8 @@ void OpenQasmDevice::Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &
         device_info = device_kwargs["backend"];
     }
 
-    auto &&li_samples = runner->Sample(builder->toOpenQasm(), device_info, device_shots,
-                                       GetNumQubits(), s3_folder_str);
+    auto &&li_samples = runner->Sample(getCircuit(), device_info, device_shots, GetNumQubits(),
+                                       s3_folder_str);
 
     std::iota(eigvals.begin(), eigvals.end(), 0);
     std::fill(counts.begin(), counts.end(), 0);
@@ -402,8 +533,8 @@ void OpenQasmDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_
         device_info = device_kwargs["backend"];
     }
 
-    auto &&li_samples = runner->Sample(builder->toOpenQasm(), device_info, device_shots,
-                                       GetNumQubits(), s3_folder_str);
+    auto &&li_samples = runner->Sample(getCircuit(), device_info, device_shots, GetNumQubits(),
+                                       s3_folder_str);
 
     std::iota(eigvals.begin(), eigvals.end(), 0);
     std::fill(counts.begin(), counts.end(), 0);
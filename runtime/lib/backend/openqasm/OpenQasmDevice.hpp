@@ -17,7 +17,11 @@
 #define __device_openqasm
 
 #include <algorithm>
+#include <deque>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -32,7 +36,7 @@
 namespace Catalyst::Runtime::Device {
 class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
   private:
-    Catalyst::Runtime::QubitManager<QubitIdType, size_t> qubit_manager{};
+    Catalyst::Runtime::FlatQubitManager<QubitIdType, size_t> qubit_manager{};
     std::unique_ptr<OpenQasm::OpenQasmBuilder> builder;
     std::unique_ptr<OpenQasm::OpenQasmRunner> runner;
 
@@ -44,6 +48,47 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
     std::set<QubitIdType> initial_allocated_QubitIds;
     std::unordered_map<std::string, std::string> device_kwargs;
 
+    // Circuits submitted with `SubmitSample` that share the shot and qubit counts, and the promises
+    // of their samples. The batches are sent to the provider one after the other on a background
+    // thread, so the circuits submitted while a batch runs are sent together in the next one.
+    struct PendingBatch {
+        std::string device_info;
+        std::string s3_folder;
+        size_t shots;
+        size_t num_qubits;
+        std::vector<std::string> circuits;
+        std::vector<std::vector<size_t>> dev_wires;
+        std::vector<std::promise<std::vector<double>>> results;
+
+        void run(const OpenQasm::OpenQasmRunner &runner);
+    };
+    std::mutex batches_mu; // To protect batches and batches_running
+    std::deque<std::unique_ptr<PendingBatch>> batches;
+    bool batches_running{false};
+    // Declared after the runner, so that the worker completes before the runner is destroyed
+    std::future<void> batches_worker;
+
+    void runBatches();
+
+    // The serialised program of the last executed circuit and a copy of the builder it was
+    // generated from. Re-executing a circuit of the same structure only re-binds its parameters.
+    std::unique_ptr<OpenQasm::OpenQasmBuilder> cached_builder;
+    std::optional<OpenQasm::QasmProgramTemplate> cached_program;
+
+    // The result types, e.g. expectation values, of the terminal measurements of an analytic
+    // circuit are computed by a single task. The first measurement submits the circuit with the
+    // result types requested from the last circuit of the same structure, and the next ones read
+    // its results. With shots, Braket rejects tasks whose observables don't commute on shared
+    // qubits, so each result type is submitted on its own.
+    std::unique_ptr<OpenQasm::OpenQasmBuilder> results_builder;
+    std::string results_circuit;
+    size_t results_shots{0};
+    std::vector<std::string> result_types;
+    std::unordered_map<std::string, std::vector<double>> results;
+
+    auto getCircuit() -> std::string;
+    auto getResult(const std::string &result_type) -> std::vector<double>;
+
     inline auto getDeviceWires(const std::vector<QubitIdType> &wires) -> std::vector<size_t>
     {
         std::vector<size_t> res;
@@ -60,6 +105,14 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
     }
 
   public:
+    /**
+     * @brief Construct a new OpenQasmDevice object.
+     *
+     * For `braket.local.qubit` devices, the kwarg `runner : native` executes the circuits with the
+     * in-process `NativeRunner` instead of the local simulator of the Amazon Braket SDK.
+     *
+     * @param kwargs non-nested JSON-like string containing device configuration parameters
+     */
     explicit OpenQasmDevice(
         const std::string &kwargs = "{device_type : braket.local.qubit, backend : default}")
     {
@@ -93,6 +146,12 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
             builder = std::make_unique<OpenQasm::BraketBuilder>();
             runner = std::make_unique<OpenQasm::BraketRunner>();
         }
+
+        if (device_kwargs.contains("runner") && device_kwargs["runner"] == "native") {
+            RT_FAIL_IF(builder_type != OpenQasm::BuilderType::BraketLocal,
+                       "The native OpenQasm runner only supports braket.local.qubit devices");
+            runner = std::make_unique<OpenQasm::NativeRunner>();
+        }
     }
     ~OpenQasmDevice() = default;
 
@@ -101,6 +160,7 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
     auto GetNumQubits() const -> size_t override;
     void SetDeviceShots(size_t) override;
     auto GetDeviceShots() const -> size_t override;
+    void SetDevicePRNG(std::mt19937 *gen) override { runner->SetPRNG(gen); }
 
     void NamedOperation(const std::string &, const std::vector<double> &,
                         const std::vector<QubitIdType> &, bool = false,
@@ -120,6 +180,8 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
 
     void Sample(DataView<double, 2> &) override;
     void PartialSample(DataView<double, 2> &, const std::vector<QubitIdType> &) override;
+    auto SubmitSample(const std::vector<QubitIdType> &)
+        -> std::future<std::vector<double>> override;
     void Counts(DataView<double, 1> &, DataView<int64_t, 1> &) override;
     void PartialCounts(DataView<double, 1> &, DataView<int64_t, 1> &,
                        const std::vector<QubitIdType> &) override;
@@ -0,0 +1,611 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <numbers>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime::Device::OpenQasm {
+
+/**
+ * A dense state vector of `num_qubits` qubits, with the first qubit as the most significant bit
+ * of the basis state indices as in Braket and PennyLane.
+ */
+class QasmStateVector {
+  private:
+    size_t num_qubits;
+    std::vector<std::complex<double>> amplitudes;
+
+  public:
+    explicit QasmStateVector(size_t _num_qubits = 0) { reset(_num_qubits); }
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits; }
+    [[nodiscard]] auto getAmplitudes() const -> const std::vector<std::complex<double>> &
+    {
+        return amplitudes;
+    }
+
+    void reset(size_t _num_qubits)
+    {
+        RT_FAIL_IF(_num_qubits >= 8 * sizeof(size_t) - 1,
+                   "Invalid number of qubits for the native OpenQasm runner");
+        num_qubits = _num_qubits;
+        amplitudes.assign(1UL << num_qubits, 0.0);
+        amplitudes[0] = 1.0;
+    }
+
+    /**
+     * @brief Apply the row-major `matrix` of dimension 2^k to the k `wires`, the first of which
+     * is the most significant bit of the row and column indices.
+     */
+    void apply(const std::vector<std::complex<double>> &matrix, const std::vector<size_t> &wires)
+    {
+        const size_t dim = 1UL << wires.size();
+        RT_FAIL_IF(matrix.size() != dim * dim, "Invalid matrix size for the given wires");
+
+        // The offsets of the basis states of the gate relative to a state where all its wires are 0
+        std::vector<size_t> offsets(dim, 0);
+        size_t wires_mask = 0;
+        for (size_t idx = 0; idx < wires.size(); idx++) {
+            RT_FAIL_IF(wires[idx] >= num_qubits, "Invalid wire for the native OpenQasm runner");
+            const size_t bit = 1UL << (num_qubits - 1 - wires[idx]);
+            RT_FAIL_IF(wires_mask & bit, "Invalid repeated wire for the native OpenQasm runner");
+            wires_mask |= bit;
+            for (size_t row = 0; row < dim; row++) {
+                if (row & (1UL << (wires.size() - 1 - idx))) {
+                    offsets[row] |= bit;
+                }
+            }
+        }
+
+        std::vector<std::complex<double>> inputs(dim);
+        for (size_t base = 0; base < amplitudes.size(); base++) {
+            if (base & wires_mask) {
+                continue;
+            }
+            for (size_t col = 0; col < dim; col++) {
+                inputs[col] = amplitudes[base | offsets[col]];
+            }
+            for (size_t row = 0; row < dim; row++) {
+                std::complex<double> sum = 0.0;
+                for (size_t col = 0; col < dim; col++) {
+                    sum += matrix[row * dim + col] * inputs[col];
+                }
+                amplitudes[base | offsets[row]] = sum;
+            }
+        }
+    }
+
+    /**
+     * @brief The probabilities of the basis states of `wires`, the first of which is the most
+     * significant bit.
+     */
+    [[nodiscard]] auto probs(const std::vector<size_t> &wires) const -> std::vector<double>
+    {
+        std::vector<double> result(1UL << wires.size(), 0.0);
+        for (size_t state = 0; state < amplitudes.size(); state++) {
+            size_t idx = 0;
+            for (auto wire : wires) {
+                idx = (idx << 1) | ((state >> (num_qubits - 1 - wire)) & 1);
+            }
+            result[idx] += std::norm(amplitudes[state]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Draw `shots` basis states of all qubits, each as the bits of its qubits in order.
+     */
+    template <typename URBG>
+    [[nodiscard]] auto sample(size_t shots, URBG &gen) const -> std::vector<size_t>
+    {
+        std::vector<double> cumulative(amplitudes.size());
+        double total = 0.0;
+        for (size_t state = 0; state < amplitudes.size(); state++) {
+            total += std::norm(amplitudes[state]);
+            cumulative[state] = total;
+        }
+
+        std::uniform_real_distribution<double> distribution(0.0, total);
+        std::vector<size_t> samples(shots * num_qubits);
+        for (size_t shot = 0; shot < shots; shot++) {
+            const auto iter =
+                std::upper_bound(cumulative.begin(), cumulative.end(), distribution(gen));
+            const size_t state = std::min<size_t>(iter - cumulative.begin(), cumulative.size() - 1);
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                samples[shot * num_qubits + wire] = (state >> (num_qubits - 1 - wire)) & 1;
+            }
+        }
+        return samples;
+    }
+
+    /**
+     * @brief The inner product of the state with `other`, conjugating the state.
+     */
+    [[nodiscard]] auto inner(const QasmStateVector &other) const -> std::complex<double>
+    {
+        std::complex<double> sum = 0.0;
+        for (size_t state = 0; state < amplitudes.size(); state++) {
+            sum += std::conj(amplitudes[state]) * other.amplitudes[state];
+        }
+        return sum;
+    }
+};
+
+/**
+ * The kinds of results requested by `#pragma braket result` instructions.
+ */
+enum class QasmResultType : uint8_t {
+    Expectation, // = 0
+    Variance,
+    Probability,
+    StateVector,
+};
+
+/**
+ * A factor of a tensor product observable, given by its matrix on its wires.
+ */
+struct QasmObsFactor {
+    std::vector<std::complex<double>> matrix;
+    std::vector<size_t> wires;
+};
+
+/**
+ * A result requested by a `#pragma braket result` instruction.
+ */
+struct QasmResult {
+    QasmResultType type;
+    std::vector<QasmObsFactor> observable;
+    std::vector<size_t> wires;
+};
+
+/**
+ * An interpreter for the subset of OpenQasm 3 emitted by `OpenQasmBuilder` and `BraketBuilder`,
+ * which executes the gates of a program on a `QasmStateVector`.
+ *
+ * The program declares a single qubit register, applies the gates of `rt_qasm_gate_map` with
+ * numeric parameters and `#pragma braket unitary` matrices, and ends with measurements of all
+ * qubits or with `#pragma braket result` instructions, which are collected in order.
+ */
+class QasmInterpreter {
+  private:
+    std::string_view text;
+    size_t pos{0};
+
+    std::string qreg_name;
+    QasmStateVector state;
+    std::vector<QasmResult> results;
+
+    using Matrix = std::vector<std::complex<double>>;
+
+    [[nodiscard]] auto atEnd() const -> bool { return pos >= text.size(); }
+
+    void skipSpaces()
+    {
+        while (!atEnd() && (text[pos] == ' ' || text[pos] == '\t')) {
+            pos++;
+        }
+    }
+
+    auto consume(std::string_view token) -> bool
+    {
+        skipSpaces();
+        if (text.substr(pos, token.size()) != token) {
+            return false;
+        }
+        pos += token.size();
+        return true;
+    }
+
+    void expect(std::string_view token)
+    {
+        RT_FAIL_IF(!consume(token), "Unsupported OpenQasm program for the native runner");
+    }
+
+    auto parseIdentifier() -> std::string_view
+    {
+        skipSpaces();
+        const size_t begin = pos;
+        while (!atEnd() && (std::isalnum(static_cast<unsigned char>(text[pos])) ||
+                            text[pos] == '_')) {
+            pos++;
+        }
+        RT_FAIL_IF(begin == pos, "Unsupported OpenQasm program for the native runner");
+        return text.substr(begin, pos - begin);
+    }
+
+    auto parseNumber() -> double
+    {
+        skipSpaces();
+        // The text is a view of a null-terminated string
+        const char *begin = text.data() + pos;
+        char *end = nullptr;
+        const double value = std::strtod(begin, &end);
+        RT_FAIL_IF(end == begin, "Invalid number in the OpenQasm program");
+        pos += end - begin;
+        return value;
+    }
+
+    auto parseSize() -> size_t
+    {
+        const double value = parseNumber();
+        RT_FAIL_IF(value < 0 || value != std::floor(value),
+                   "Invalid index in the OpenQasm program");
+        return static_cast<size_t>(value);
+    }
+
+    // A complex number as printed by `MatrixBuilder`, e.g. `0`, `0.5+0im` or `-1e-05-0.5im`
+    auto parseComplex() -> std::complex<double>
+    {
+        const double real = parseNumber();
+        if (consume("im")) {
+            return {0.0, real};
+        }
+        if (atEnd() || (text[pos] != '+' && text[pos] != '-')) {
+            return {real, 0.0};
+        }
+        const double imag = parseNumber();
+        expect("im");
+        return {real, imag};
+    }
+
+    // A square matrix as printed by `MatrixBuilder`, e.g. `[[0, 1+0im], [1+0im, 0]]`
+    auto parseMatrix() -> Matrix
+    {
+        Matrix matrix;
+        size_t num_rows = 0;
+        expect("[");
+        do {
+            expect("[");
+            do {
+                matrix.push_back(parseComplex());
+            } while (consume(","));
+            expect("]");
+            num_rows++;
+        } while (consume(","));
+        expect("]");
+        RT_FAIL_IF(matrix.size() != num_rows * num_rows, "Invalid matrix in the OpenQasm program");
+        return matrix;
+    }
+
+    // The qubits `name[i], ...`, `name[i:j], ...` or `name` of the qubit register
+    auto parseTargets() -> std::vector<size_t>
+    {
+        std::vector<size_t> wires;
+        do {
+            RT_FAIL_IF(parseIdentifier() != qreg_name,
+                       "Unknown qubit register in the OpenQasm program");
+            if (!consume("[")) {
+                for (size_t wire = 0; wire < state.getNumQubits(); wire++) {
+                    wires.push_back(wire);
+                }
+                continue;
+            }
+            const size_t first = parseSize();
+            const size_t last = consume(":") ? parseSize() : first;
+            expect("]");
+            for (size_t wire = first; wire <= last; wire++) {
+                RT_FAIL_IF(wire >= state.getNumQubits(), "Invalid qubit in the OpenQasm program");
+                wires.push_back(wire);
+            }
+        } while (consume(","));
+        return wires;
+    }
+
+    /**
+     * @brief The matrix of the gate or named observable `name` of `rt_qasm_gate_map`, in the
+     * conventions of Braket.
+     */
+    [[nodiscard]] static auto getGateMatrix(std::string_view name,
+                                            const std::vector<double> &params) -> Matrix
+    {
+        using namespace std::complex_literals;
+        constexpr double inv_sqrt2 = std::numbers::sqrt2 / 2;
+
+        auto expectParams = [&](size_t num_params) {
+            RT_FAIL_IF(params.size() != num_params,
+                       "Invalid number of gate parameters in the OpenQasm program");
+        };
+        // The identity of the given dimension with the bottom-right block replaced by `block`
+        auto controlled = [](size_t dim, const Matrix &block) {
+            Matrix matrix(dim * dim, 0.0);
+            const auto block_dim = static_cast<size_t>(std::sqrt(block.size()));
+            const size_t offset = dim - block_dim;
+            for (size_t idx = 0; idx < offset; idx++) {
+                matrix[idx * dim + idx] = 1.0;
+            }
+            for (size_t row = 0; row < block_dim; row++) {
+                for (size_t col = 0; col < block_dim; col++) {
+                    matrix[(offset + row) * dim + offset + col] = block[row * block_dim + col];
+                }
+            }
+            return matrix;
+        };
+        auto swap = [](std::complex<double> phase) -> Matrix {
+            return {1, 0, 0, 0, 0, 0, phase, 0, 0, phase, 0, 0, 0, 0, 0, 1};
+        };
+
+        const bool parametric =
+            name == "phaseshift" || name == "rx" || name == "ry" || name == "rz" || name == "pswap";
+        expectParams(parametric ? 1 : 0);
+        const double theta = parametric ? params[0] : 0.0;
+        const double c = std::cos(theta / 2);
+        const double s = std::sin(theta / 2);
+
+        const Matrix pauli_x = {0, 1, 1, 0};
+        const Matrix pauli_y = {0, -1i, 1i, 0};
+        const Matrix pauli_z = {1, 0, 0, -1};
+
+        if (name == "i") {
+            return {1, 0, 0, 1};
+        }
+        if (name == "x") {
+            return pauli_x;
+        }
+        if (name == "y") {
+            return pauli_y;
+        }
+        if (name == "z") {
+            return pauli_z;
+        }
+        if (name == "h") {
+            return {inv_sqrt2, inv_sqrt2, inv_sqrt2, -inv_sqrt2};
+        }
+        if (name == "s") {
+            return {1, 0, 0, 1i};
+        }
+        if (name == "t") {
+            return {1, 0, 0, std::polar(1.0, std::numbers::pi / 4)};
+        }
+        if (name == "cnot") {
+            return controlled(4, pauli_x);
+        }
+        if (name == "cy") {
+            return controlled(4, pauli_y);
+        }
+        if (name == "cz") {
+            return controlled(4, pauli_z);
+        }
+        if (name == "swap") {
+            return swap(1.0);
+        }
+        if (name == "iswap") {
+            return swap(1i);
+        }
+        if (name == "pswap") {
+            return swap(std::polar(1.0, theta));
+        }
+        if (name == "cswap") {
+            return controlled(8, swap(1.0));
+        }
+        if (name == "ccnot") {
+            return controlled(8, pauli_x);
+        }
+        if (name == "phaseshift") {
+            return {1, 0, 0, std::polar(1.0, theta)};
+        }
+        if (name == "rx") {
+            return {c, -1i * s, -1i * s, c};
+        }
+        if (name == "ry") {
+            return {c, -s, s, c};
+        }
+        if (name == "rz") {
+            return {std::polar(1.0, -theta / 2), 0, 0, std::polar(1.0, theta / 2)};
+        }
+        RT_FAIL("Unsupported gate for the native OpenQasm runner");
+    }
+
+    // A tensor product of named and hermitian observables, e.g. `x(q[0]) @ hermitian(...) q[1]`
+    auto parseObservable() -> std::vector<QasmObsFactor>
+    {
+        std::vector<QasmObsFactor> factors;
+        do {
+            const auto name = parseIdentifier();
+            QasmObsFactor factor;
+            expect("(");
+            if (name == "hermitian") {
+                factor.matrix = parseMatrix();
+                expect(")");
+                factor.wires = parseTargets();
+            }
+            else {
+                factor.matrix = getGateMatrix(name, {});
+                factor.wires = parseTargets();
+                expect(")");
+            }
+            RT_FAIL_IF(factor.matrix.size() != (1UL << (2 * factor.wires.size())),
+                       "Invalid observable in the OpenQasm program");
+            factors.push_back(std::move(factor));
+        } while (consume("@"));
+        return factors;
+    }
+
+    void parsePragma()
+    {
+        expect("braket");
+        if (consume("unitary")) {
+            expect("(");
+            auto matrix = parseMatrix();
+            expect(")");
+            state.apply(matrix, parseTargets());
+            return;
+        }
+
+        expect("result");
+        QasmResult result;
+        if (consume("expectation")) {
+            result.type = QasmResultType::Expectation;
+            result.observable = parseObservable();
+        }
+        else if (consume("variance")) {
+            result.type = QasmResultType::Variance;
+            result.observable = parseObservable();
+        }
+        else if (consume("probability")) {
+            result.type = QasmResultType::Probability;
+            skipSpaces();
+            if (atEnd() || text[pos] == '\n') {
+                for (size_t wire = 0; wire < state.getNumQubits(); wire++) {
+                    result.wires.push_back(wire);
+                }
+            }
+            else {
+                result.wires = parseTargets();
+            }
+        }
+        else if (consume("state_vector")) {
+            result.type = QasmResultType::StateVector;
+        }
+        else {
+            RT_FAIL("Unsupported result type for the native OpenQasm runner");
+        }
+        results.push_back(std::move(result));
+    }
+
+    void parseStatement()
+    {
+        const auto keyword = parseIdentifier();
+        if (keyword == "OPENQASM") {
+            parseNumber();
+        }
+        else if (keyword == "input") {
+            RT_FAIL("Input parameters are not supported by the native OpenQasm runner");
+        }
+        else if (keyword == "qubit") {
+            RT_FAIL_IF(!qreg_name.empty(), "Only one qubit register is supported by the native "
+                                           "OpenQasm runner");
+            expect("[");
+            const size_t size = parseSize();
+            expect("]");
+            qreg_name = parseIdentifier();
+            state.reset(size);
+        }
+        else if (keyword == "bit") {
+            expect("[");
+            parseSize();
+            expect("]");
+            parseIdentifier();
+        }
+        else if (keyword == "measure") {
+            // Terminal measurements of all qubits are sampled by the runner
+            parseTargets();
+        }
+        else if (consume("[")) {
+            // bits[i] = measure qubits[i]
+            parseSize();
+            expect("]");
+            expect("=");
+            expect("measure");
+            parseTargets();
+        }
+        else if (consume("=")) {
+            // bits = measure qubits
+            expect("measure");
+            parseTargets();
+        }
+        else {
+            std::vector<double> params;
+            if (consume("(")) {
+                do {
+                    params.push_back(parseNumber());
+                } while (consume(","));
+                expect(")");
+            }
+            const auto matrix = getGateMatrix(keyword, params);
+            state.apply(matrix, parseTargets());
+        }
+        expect(";");
+    }
+
+    void run()
+    {
+        while (true) {
+            while (!atEnd() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+                pos++;
+            }
+            if (atEnd()) {
+                break;
+            }
+            if (consume("#pragma")) {
+                parsePragma();
+            }
+            else if (consume("//")) {
+                pos = std::min(text.find('\n', pos), text.size());
+                continue;
+            }
+            else {
+                parseStatement();
+            }
+            skipSpaces();
+            RT_FAIL_IF(!atEnd() && text[pos] != '\n' && text[pos] != '\r',
+                       "Unsupported OpenQasm program for the native runner");
+        }
+    }
+
+  public:
+    /**
+     * @brief Execute the OpenQasm `program` on a new state vector.
+     */
+    explicit QasmInterpreter(const std::string &program) : text(program) { run(); }
+
+    [[nodiscard]] auto getState() const -> const QasmStateVector & { return state; }
+    [[nodiscard]] auto getResults() const -> const std::vector<QasmResult> & { return results; }
+
+    /**
+     * @brief The expectation value of the tensor product `observable` and of its square.
+     */
+    [[nodiscard]] auto moments(const std::vector<QasmObsFactor> &observable) const
+        -> std::pair<double, double>
+    {
+        QasmStateVector applied = state;
+        for (const auto &factor : observable) {
+            applied.apply(factor.matrix, factor.wires);
+        }
+        // <O^2> = |O psi|^2 for Hermitian observables
+        return {state.inner(applied).real(), applied.inner(applied).real()};
+    }
+
+    /**
+     * @brief The values of `result`, flattened as returned by the Braket runner.
+     */
+    [[nodiscard]] auto evaluate(const QasmResult &result) const -> std::vector<double>
+    {
+        switch (result.type) {
+        case QasmResultType::Expectation:
+            return {moments(result.observable).first};
+        case QasmResultType::Variance: {
+            auto [first, second] = moments(result.observable);
+            return {second - first * first};
+        }
+        case QasmResultType::Probability:
+            return state.probs(result.wires);
+        default:
+            RT_FAIL("Unsupported result type for the native OpenQasm runner");
+        }
+    }
+};
+
+} // namespace Catalyst::Runtime::Device::OpenQasm
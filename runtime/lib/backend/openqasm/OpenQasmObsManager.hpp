@@ -15,6 +15,8 @@
 #pragma once
 
 #include <array>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "Exception.hpp"
@@ -28,12 +30,45 @@ namespace Catalyst::Runtime::Device::OpenQasm {
  * @brief The OpenQasmObsManager caches observables of a program at runtime
  * and maps each one to a const unique index (`int64_t`) in the scope
  * of the global context manager.
+ *
+ * Observables are interned by their structure, so that constructing an identical
+ * observable again, e.g. in every execution of a circuit, returns the existing key.
  */
 class OpenQasmObsManager {
   private:
     using ObservablePairType = std::pair<std::shared_ptr<QasmObs>, ObsType>;
     std::vector<ObservablePairType> observables_{};
 
+    // The observable keys by structure: the kind of observable, its name or matrix and
+    // coefficients, and its wires or the keys of its interned operands.
+    std::unordered_map<std::string, ObsIdType> keys_{};
+
+    template <typename T> static void appendBytes(std::string &structure, const T &value)
+    {
+        structure.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static void appendBytes(std::string &structure, const std::vector<T> &values)
+    {
+        appendBytes(structure, values.size());
+        structure.append(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+    }
+
+    /**
+     * @brief Get the key of the observable of the given structure, creating it if needed.
+     */
+    template <typename MakeObs>
+    auto intern(std::string &&structure, ObsType type, MakeObs &&make_obs) -> ObsIdType
+    {
+        auto [it, inserted] =
+            keys_.try_emplace(std::move(structure), static_cast<ObsIdType>(observables_.size()));
+        if (inserted) {
+            observables_.push_back(std::make_pair(make_obs(), type));
+        }
+        return it->second;
+    }
+
     static constexpr std::array<ObsType, 2> hamiltonian_valid_obs_types = {
         ObsType::Basic,
         ObsType::TensorProd,
@@ -51,7 +86,11 @@ class OpenQasmObsManager {
     /**
      * @brief A helper function to clear constructed observables in the program.
      */
-    void clear() { observables_.clear(); }
+    void clear()
+    {
+        observables_.clear();
+        keys_.clear();
+    }
 
     /**
      * @brief Check the validity of observable keys.
@@ -86,7 +125,7 @@ class OpenQasmObsManager {
     [[nodiscard]] auto numObservables() const -> size_t { return observables_.size(); }
 
     /**
-     * @brief Create and cache a new NamedObs instance.
+     * @brief Create and cache a new NamedObs instance, or get the key of an identical one.
      *
      * @param obsId The named observable id of type ObsId
      * @param wires The vector of wires the observable acts on
@@ -99,13 +138,15 @@ class OpenQasmObsManager {
         auto &&obs_str = std::string(
             lookup_obs<simulator_observable_support_size>(simulator_observable_support, obsId));
 
-        observables_.push_back(
-            std::make_pair(std::make_shared<QasmNamedObs>(obs_str, wires), ObsType::Basic));
-        return static_cast<ObsIdType>(observables_.size() - 1);
+        std::string structure{"N"};
+        appendBytes(structure, wires);
+        structure.append(obs_str);
+        return intern(std::move(structure), ObsType::Basic,
+                      [&]() { return std::make_shared<QasmNamedObs>(obs_str, wires); });
     }
 
     /**
-     * @brief Create and cache a new HermitianObs instance.
+     * @brief Create and cache a new HermitianObs instance, or get the key of an identical one.
      *
      * @param matrix The row-wise Hermitian matrix
      * @param wires The vector of wires the observable acts on
@@ -115,14 +156,16 @@ class OpenQasmObsManager {
     createHermitianObs([[maybe_unused]] const std::vector<std::complex<double>> &matrix,
                        [[maybe_unused]] const std::vector<size_t> &wires) -> ObsIdType
     {
-        observables_.push_back(std::make_pair(
-            std::make_shared<QasmHermitianObs>(QasmHermitianObs{matrix, wires}), ObsType::Basic));
-
-        return static_cast<ObsIdType>(observables_.size() - 1);
+        std::string structure{"H"};
+        appendBytes(structure, wires);
+        appendBytes(structure, matrix);
+        return intern(std::move(structure), ObsType::Basic, [&]() {
+            return std::make_shared<QasmHermitianObs>(QasmHermitianObs{matrix, wires});
+        });
     }
 
     /**
-     * @brief Create and cache a new TensorProd instance.
+     * @brief Create and cache a new TensorProd instance, or get the key of an identical one.
      *
      * @param obsKeys The vector of observable keys
      * @return ObsIdType
@@ -146,15 +189,15 @@ class OpenQasmObsManager {
             obs_vec.push_back(obs);
         }
 
-        observables_.push_back(
-            std::make_pair(std::make_shared<QasmTensorObs>(QasmTensorObs(std::move(obs_vec))),
-                           ObsType::TensorProd));
-
-        return static_cast<ObsIdType>(obs_size);
+        std::string structure{"T"};
+        appendBytes(structure, obsKeys);
+        return intern(std::move(structure), ObsType::TensorProd, [&]() {
+            return std::make_shared<QasmTensorObs>(QasmTensorObs(std::move(obs_vec)));
+        });
     }
 
     /**
-     * @brief Create and cache a new HamiltonianObs instance.
+     * @brief Create and cache a new HamiltonianObs instance, or get the key of an identical one.
      *
      * @param coeffs The vector of coefficients
      * @param obsKeys The vector of observable keys
@@ -187,11 +230,13 @@ class OpenQasmObsManager {
             obs_vec.push_back(obs);
         }
 
-        observables_.push_back(std::make_pair(
-            std::make_shared<QasmHamiltonianObs>(QasmHamiltonianObs(coeffs, std::move(obs_vec))),
-            ObsType::Hamiltonian));
-
-        return static_cast<ObsIdType>(obs_size);
+        std::string structure{"S"};
+        appendBytes(structure, obsKeys);
+        appendBytes(structure, coeffs);
+        return intern(std::move(structure), ObsType::Hamiltonian, [&]() {
+            return std::make_shared<QasmHamiltonianObs>(
+                QasmHamiltonianObs(coeffs, std::move(obs_vec)));
+        });
     }
 };
 } // namespace Catalyst::Runtime::Device::OpenQasm
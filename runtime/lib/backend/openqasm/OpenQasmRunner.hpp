@@ -15,11 +15,16 @@
 #pragma once
 
 #include <complex>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "DynamicLibraryLoader.hpp"
 #include "Exception.hpp"
+#include "OpenQasmInterpreter.hpp"
 
 namespace Catalyst::Runtime::Device::OpenQasm {
 
@@ -55,6 +60,15 @@ struct OpenQasmRunner {
         return {};
     }
     [[nodiscard]] virtual auto
+    SampleBatch([[maybe_unused]] const std::vector<std::string> &circuits,
+                [[maybe_unused]] const std::string &device, [[maybe_unused]] size_t shots,
+                [[maybe_unused]] size_t num_qubits,
+                [[maybe_unused]] const std::string &kwargs = "") const -> std::vector<size_t>
+    {
+        RT_FAIL("Not implemented method");
+        return {};
+    }
+    [[nodiscard]] virtual auto
     Expval([[maybe_unused]] const std::string &circuit, [[maybe_unused]] const std::string &device,
            [[maybe_unused]] size_t shots, [[maybe_unused]] const std::string &kwargs = "") const
         -> double
@@ -70,6 +84,15 @@ struct OpenQasmRunner {
         RT_FAIL("Not implemented method");
         return {};
     }
+    [[nodiscard]] virtual auto Results([[maybe_unused]] const std::string &circuit,
+                                       [[maybe_unused]] const std::string &device,
+                                       [[maybe_unused]] size_t shots,
+                                       [[maybe_unused]] const std::string &kwargs = "") const
+        -> std::vector<std::vector<double>>
+    {
+        RT_FAIL("Not implemented method");
+        return {};
+    }
     [[nodiscard]] virtual auto
     State([[maybe_unused]] const std::string &circuit, [[maybe_unused]] const std::string &device,
           [[maybe_unused]] size_t shots, [[maybe_unused]] size_t num_qubits,
@@ -89,18 +112,39 @@ struct OpenQasmRunner {
         RT_FAIL("Not implemented method");
         return {};
     }
+
+    /**
+     * Set the random number generator of runners that sample locally.
+     */
+    virtual void SetPRNG([[maybe_unused]] std::mt19937 *gen) {}
 };
 
 /**
  * The OpenQasm circuit runner to execute an OpenQasm circuit on Braket Devices backed by
  * Amazon Braket Python SDK.
+ *
+ * The Python module is loaded on first use and kept for the lifetime of the runner. The module
+ * itself caches the imported Braket modules and device handles across executions.
  */
 struct BraketRunner : public OpenQasmRunner {
+  private:
+    mutable std::unique_ptr<DynamicLibraryLoader> libLoaderPtr;
+    mutable std::once_flag libLoaderFlag;
+
+    [[nodiscard]] auto getLibLoader() const -> DynamicLibraryLoader &
+    {
+        std::call_once(libLoaderFlag, [this]() {
+            libLoaderPtr = std::make_unique<DynamicLibraryLoader>(OPENQASM_PY);
+        });
+        return *libLoaderPtr;
+    }
+
+  public:
     [[nodiscard]] auto runCircuit(const std::string &circuit, const std::string &device,
                                   size_t shots, const std::string &kwargs = "") const
         -> std::string override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
+        DynamicLibraryLoader &libLoader = getLibLoader();
 
         using func_ptr_t = char *(*)(const char *, const char *, size_t, const char *);
         auto runCircuitImpl = libLoader.getSymbol<func_ptr_t>("runCircuit");
@@ -115,7 +159,7 @@ struct BraketRunner : public OpenQasmRunner {
                              size_t num_qubits, const std::string &kwargs = "") const
         -> std::vector<double> override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
+        DynamicLibraryLoader &libLoader = getLibLoader();
 
         using probsImpl_t =
             void *(*)(const char *, const char *, size_t, size_t, const char *, void *);
@@ -131,7 +175,7 @@ struct BraketRunner : public OpenQasmRunner {
                               size_t num_qubits, const std::string &kwargs = "") const
         -> std::vector<size_t> override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
+        DynamicLibraryLoader &libLoader = getLibLoader();
 
         using samplesImpl_t =
             void *(*)(const char *, const char *, size_t, size_t, const char *, void *);
@@ -143,10 +187,34 @@ struct BraketRunner : public OpenQasmRunner {
         return samples;
     }
 
+    [[nodiscard]] auto SampleBatch(const std::vector<std::string> &circuits,
+                                   const std::string &device, size_t shots, size_t num_qubits,
+                                   const std::string &kwargs = "") const
+        -> std::vector<size_t> override
+    {
+        DynamicLibraryLoader &libLoader = getLibLoader();
+
+        using samplesBatchImpl_t = void *(*)(const char **, size_t, const char *, size_t, size_t,
+                                             const char *, void *);
+        auto samplesBatchImpl = libLoader.getSymbol<samplesBatchImpl_t>("samples_batch");
+
+        std::vector<const char *> circuit_ptrs;
+        circuit_ptrs.reserve(circuits.size());
+        for (const auto &circuit : circuits) {
+            circuit_ptrs.push_back(circuit.c_str());
+        }
+
+        std::vector<size_t> samples;
+        samplesBatchImpl(circuit_ptrs.data(), circuit_ptrs.size(), device.c_str(), shots,
+                         num_qubits, kwargs.c_str(), &samples);
+
+        return samples;
+    }
+
     [[nodiscard]] auto Expval(const std::string &circuit, const std::string &device, size_t shots,
                               const std::string &kwargs = "") const -> double override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
+        DynamicLibraryLoader &libLoader = getLibLoader();
 
         using expvalImpl_t = double (*)(const char *, const char *, size_t, const char *);
         auto expvalImpl = libLoader.getSymbol<expvalImpl_t>("expval");
@@ -157,13 +225,180 @@ struct BraketRunner : public OpenQasmRunner {
     [[nodiscard]] auto Var(const std::string &circuit, const std::string &device, size_t shots,
                            const std::string &kwargs = "") const -> double override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
+        DynamicLibraryLoader &libLoader = getLibLoader();
 
         using varImpl_t = double (*)(const char *, const char *, size_t, const char *);
         auto varImpl = libLoader.getSymbol<varImpl_t>("var");
 
         return varImpl(circuit.c_str(), device.c_str(), shots, kwargs.c_str());
     }
+
+    /**
+     * Run a circuit with several result types in a single task, returning the flattened values
+     * of each of them in order of appearance.
+     */
+    [[nodiscard]] auto Results(const std::string &circuit, const std::string &device, size_t shots,
+                               const std::string &kwargs = "") const
+        -> std::vector<std::vector<double>> override
+    {
+        DynamicLibraryLoader &libLoader = getLibLoader();
+
+        using resultsImpl_t = void (*)(const char *, const char *, size_t, const char *, void *);
+        auto resultsImpl = libLoader.getSymbol<resultsImpl_t>("results");
+
+        std::vector<std::vector<double>> results;
+        resultsImpl(circuit.c_str(), device.c_str(), shots, kwargs.c_str(), &results);
+
+        return results;
+    }
+};
+
+/**
+ * The OpenQasm circuit runner to execute an OpenQasm circuit in-process on the state vector
+ * simulator of `QasmInterpreter`, without Python or the Amazon Braket SDK.
+ *
+ * It replaces the local Braket state vector simulator for the programs of `BraketBuilder`.
+ * Samples are drawn from the final state, and so are the probabilities when shots are set, while
+ * expectation values and variances are computed exactly from the state.
+ */
+struct NativeRunner : public OpenQasmRunner {
+  private:
+    mutable std::mt19937 default_gen{std::random_device{}()};
+    std::mt19937 *gen{nullptr};
+    mutable std::mutex gen_mu; // Submitted circuits are sampled on a background thread
+
+    [[nodiscard]] auto sampleState(const QasmStateVector &state, size_t shots) const
+        -> std::vector<size_t>
+    {
+        std::lock_guard<std::mutex> lock(gen_mu);
+        return state.sample(shots, gen ? *gen : default_gen);
+    }
+
+    static void checkDevice(const std::string &device)
+    {
+        RT_FAIL_IF(device != "default" && device != "braket_sv",
+                   "Only the state vector simulator is supported by the native OpenQasm runner");
+    }
+
+    [[nodiscard]] auto getProbs(const QasmStateVector &state, const std::vector<size_t> &wires,
+                                size_t shots) const -> std::vector<double>
+    {
+        if (!shots) {
+            return state.probs(wires);
+        }
+        const auto samples = sampleState(state, shots);
+        const size_t num_qubits = state.getNumQubits();
+        std::vector<double> probs(1UL << wires.size(), 0.0);
+        for (size_t shot = 0; shot < shots; shot++) {
+            size_t idx = 0;
+            for (auto wire : wires) {
+                idx = (idx << 1) | samples[shot * num_qubits + wire];
+            }
+            probs[idx] += 1.0 / static_cast<double>(shots);
+        }
+        return probs;
+    }
+
+    [[nodiscard]] auto getSingleResult(const std::string &circuit, const std::string &device,
+                                       size_t shots, QasmResultType type) const -> double
+    {
+        checkDevice(device);
+        const QasmInterpreter interpreter(circuit);
+        const auto &results = interpreter.getResults();
+        RT_FAIL_IF(results.size() != 1 || results[0].type != type,
+                   type == QasmResultType::Expectation ? "Unable to compute expectation value"
+                                                       : "Unable to compute variance");
+        return evaluate(interpreter, results[0], shots)[0];
+    }
+
+    [[nodiscard]] auto evaluate(const QasmInterpreter &interpreter, const QasmResult &result,
+                                size_t shots) const -> std::vector<double>
+    {
+        if (result.type == QasmResultType::Probability) {
+            return getProbs(interpreter.getState(), result.wires, shots);
+        }
+        return interpreter.evaluate(result);
+    }
+
+  public:
+    void SetPRNG(std::mt19937 *_gen) override { gen = _gen; }
+
+    [[nodiscard]] auto Probs(const std::string &circuit, const std::string &device, size_t shots,
+                             size_t num_qubits, [[maybe_unused]] const std::string &kwargs = "")
+        const -> std::vector<double> override
+    {
+        checkDevice(device);
+        const QasmInterpreter interpreter(circuit);
+        const auto &state = interpreter.getState();
+        RT_FAIL_IF(state.getNumQubits() != num_qubits, "Invalid number of qubits");
+
+        std::vector<size_t> wires(num_qubits);
+        std::iota(wires.begin(), wires.end(), 0);
+        return getProbs(state, wires, shots);
+    }
+
+    [[nodiscard]] auto Sample(const std::string &circuit, const std::string &device, size_t shots,
+                              size_t num_qubits, [[maybe_unused]] const std::string &kwargs = "")
+        const -> std::vector<size_t> override
+    {
+        checkDevice(device);
+        const QasmInterpreter interpreter(circuit);
+        RT_FAIL_IF(interpreter.getState().getNumQubits() != num_qubits, "Invalid number of qubits");
+        return sampleState(interpreter.getState(), shots);
+    }
+
+    [[nodiscard]] auto SampleBatch(const std::vector<std::string> &circuits,
+                                   const std::string &device, size_t shots, size_t num_qubits,
+                                   const std::string &kwargs = "") const
+        -> std::vector<size_t> override
+    {
+        std::vector<size_t> samples;
+        samples.reserve(circuits.size() * shots * num_qubits);
+        for (const auto &circuit : circuits) {
+            auto &&circuit_samples = Sample(circuit, device, shots, num_qubits, kwargs);
+            samples.insert(samples.end(), circuit_samples.begin(), circuit_samples.end());
+        }
+        return samples;
+    }
+
+    [[nodiscard]] auto Expval(const std::string &circuit, const std::string &device, size_t shots,
+                              [[maybe_unused]] const std::string &kwargs = "") const
+        -> double override
+    {
+        return getSingleResult(circuit, device, shots, QasmResultType::Expectation);
+    }
+
+    [[nodiscard]] auto Var(const std::string &circuit, const std::string &device, size_t shots,
+                           [[maybe_unused]] const std::string &kwargs = "") const
+        -> double override
+    {
+        return getSingleResult(circuit, device, shots, QasmResultType::Variance);
+    }
+
+    [[nodiscard]] auto Results(const std::string &circuit, const std::string &device, size_t shots,
+                               [[maybe_unused]] const std::string &kwargs = "") const
+        -> std::vector<std::vector<double>> override
+    {
+        checkDevice(device);
+        const QasmInterpreter interpreter(circuit);
+
+        std::vector<std::vector<double>> results;
+        for (const auto &result : interpreter.getResults()) {
+            results.push_back(evaluate(interpreter, result, shots));
+        }
+        return results;
+    }
+
+    [[nodiscard]] auto State(const std::string &circuit, const std::string &device,
+                             [[maybe_unused]] size_t shots, size_t num_qubits,
+                             [[maybe_unused]] const std::string &kwargs = "") const
+        -> std::vector<std::complex<double>> override
+    {
+        checkDevice(device);
+        const QasmInterpreter interpreter(circuit);
+        RT_FAIL_IF(interpreter.getState().getNumQubits() != num_qubits, "Invalid number of qubits");
+        return interpreter.getState().getAmplitudes();
+    }
 };
 
 } // namespace Catalyst::Runtime::Device::OpenQasm
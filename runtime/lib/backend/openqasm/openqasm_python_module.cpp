@@ -14,6 +14,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -27,14 +28,24 @@ from braket.aws import AwsDevice
 from braket.devices import LocalSimulator
 from braket.ir.openqasm import Program as OpenQasmProgram
 
+# Braket device handles by name, constructed once per process
+_device_cache = {}
+
 def py_sanitize_device(user_submitted_device):
+    device = _device_cache.get(user_submitted_device)
+    if device is not None:
+        return device
+
     if user_submitted_device in {"default", "braket_sv", "braket_dm"}:
-        return LocalSimulator(user_submitted_device)
+        device = LocalSimulator(user_submitted_device)
     elif "arn:aws:braket" in user_submitted_device:
-        return AwsDevice(user_submitted_device)
+        device = AwsDevice(user_submitted_device)
+    else:
+        msg = "device must be either 'braket.devices.LocalSimulator' or 'braket.aws.AwsDevice'"
+        raise ValueError(msg)
 
-    msg = "device must be either 'braket.devices.LocalSimulator' or 'braket.aws.AwsDevice'"
-    raise ValueError(msg)
+    _device_cache[user_submitted_device] = device
+    return device
 
 def py_sanitize_kwargs(user_submitted_kwargs):
     if user_submitted_kwargs == "":
@@ -69,10 +80,24 @@ def py_expval(circuit, braket_device, kwargs, shots):
             "Unable to compute expectation value; no measurement process was specified")
     return values
 
+def py_results(circuit, braket_device, kwargs, shots):
+    values = py_run_circuit(circuit, braket_device, kwargs, shots).values
+    return [np.ravel(value).tolist() for value in values]
+
 def py_samples(circuit, braket_device, kwargs, shots):
     result = py_run_circuit(circuit, braket_device, kwargs, shots)
     return np.array(result.measurements).flatten()
 
+def py_samples_batch(circuits, braket_device, kwargs, shots):
+    device = py_sanitize_device(braket_device)
+    kwargs = py_sanitize_kwargs(kwargs)
+    programs = [OpenQasmProgram(source=circuit) for circuit in circuits]
+    if not kwargs:
+        batch = device.run_batch(programs, shots=int(shots))
+    else:
+        batch = device.run_batch(programs, shots=int(shots), s3_destination_folder=tuple(kwargs))
+    return np.concatenate([np.array(result.measurements).flatten() for result in batch.results()])
+
 def py_probs(circuit, braket_device, kwargs, shots, num_qubits):
     result = py_run_circuit(circuit, braket_device, kwargs, shots)
     probs_dict = {int(s, 2): p for s, p in result.measurement_probabilities.items()}
@@ -85,6 +110,36 @@ def py_get_results(circuit, braket_device, kwargs, shots):
     return str(py_run_circuit(circuit, braket_device, kwargs, shots))
 )";
 
+/**
+ * @brief Get the namespace in which `program` has been executed.
+ *
+ * The program is executed once per process in a dedicated namespace, so that the Braket modules
+ * are imported and the device handles are cached across circuit executions. The namespace is
+ * intentionally leaked, as it may otherwise be destroyed after the interpreter is finalized.
+ * Must be called with the GIL held.
+ *
+ * The GIL is released while waiting for the namespace, as `gil_safe_call_once_and_store` does in
+ * pybind11, which nanobind lacks. Otherwise, a thread waiting for another thread to execute the
+ * program, such as the batch worker of the device, would hold the GIL that the program needs.
+ */
+static auto getProgramScope() -> nanobind::dict &
+{
+    namespace nb = nanobind;
+    static std::once_flag initialized;
+    static nb::dict *scope = nullptr;
+    {
+        nb::gil_scoped_release release;
+        std::call_once(initialized, [] {
+            nb::gil_scoped_acquire acquire;
+            auto *dict = new nb::dict();
+            (*dict)["__builtins__"] = nb::module_::import_("builtins");
+            nb::exec(nb::str(program.c_str()), *dict);
+            scope = dict;
+        });
+    }
+    return *scope;
+}
+
 extern "C" NB_EXPORT double var(const char *_circuit, const char *_device, size_t shots,
                                 const char *_kwargs)
 {
@@ -95,9 +150,7 @@ extern "C" NB_EXPORT double var(const char *_circuit, const char *_device, size_
     std::string device(_device);
     std::string kwargs(_kwargs);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
+    nb::dict &scope = getProgramScope();
     return nb::cast<double>(scope["py_var"](circuit, device, kwargs, shots).attr("__getitem__")(0));
 }
 
@@ -111,13 +164,34 @@ extern "C" NB_EXPORT double expval(const char *_circuit, const char *_device, si
     std::string device(_device);
     std::string kwargs(_kwargs);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
+    nb::dict &scope = getProgramScope();
     return nb::cast<double>(
         scope["py_expval"](circuit, device, kwargs, shots).attr("__getitem__")(0));
 }
 
+extern "C" NB_EXPORT void results(const char *_circuit, const char *_device, size_t shots,
+                                  const char *_kwargs, void *_vector)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    std::string circuit(_circuit);
+    std::string device(_device);
+    std::string kwargs(_kwargs);
+
+    auto *results = reinterpret_cast<std::vector<std::vector<double>> *>(_vector);
+
+    nb::dict &scope = getProgramScope();
+    for (nb::handle value : scope["py_results"](circuit, device, kwargs, shots)) {
+        std::vector<double> &values = results->emplace_back();
+        for (nb::handle item : value) {
+            values.push_back(nb::cast<double>(item));
+        }
+    }
+
+    return;
+}
+
 extern "C" NB_EXPORT void samples(const char *_circuit, const char *_device, size_t shots,
                                   size_t num_qubits, const char *_kwargs, void *_vector)
 {
@@ -130,9 +204,7 @@ extern "C" NB_EXPORT void samples(const char *_circuit, const char *_device, siz
 
     std::vector<size_t> *samples = reinterpret_cast<std::vector<size_t> *>(_vector);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
+    nb::dict &scope = getProgramScope();
     auto results = scope["py_samples"](circuit, device, kwargs, shots);
 
     samples->reserve(shots * num_qubits);
@@ -143,6 +215,33 @@ extern "C" NB_EXPORT void samples(const char *_circuit, const char *_device, siz
     return;
 }
 
+extern "C" NB_EXPORT void samples_batch(const char **_circuits, size_t num_circuits,
+                                        const char *_device, size_t shots, size_t num_qubits,
+                                        const char *_kwargs, void *_vector)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    nb::list circuits;
+    for (size_t i = 0; i < num_circuits; i++) {
+        circuits.append(nb::str(_circuits[i]));
+    }
+    std::string device(_device);
+    std::string kwargs(_kwargs);
+
+    std::vector<size_t> *samples = reinterpret_cast<std::vector<size_t> *>(_vector);
+
+    nb::dict &scope = getProgramScope();
+    auto results = scope["py_samples_batch"](circuits, device, kwargs, shots);
+
+    samples->reserve(num_circuits * shots * num_qubits);
+    for (nb::handle item : results) {
+        samples->push_back(nb::cast<size_t>(item));
+    }
+
+    return;
+}
+
 extern "C" NB_EXPORT void probs(const char *_circuit, const char *_device, size_t shots,
                                 size_t num_qubits, const char *_kwargs, void *_vector)
 {
@@ -155,9 +254,7 @@ extern "C" NB_EXPORT void probs(const char *_circuit, const char *_device, size_
 
     std::vector<double> *probs = reinterpret_cast<std::vector<double> *>(_vector);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
+    nb::dict &scope = getProgramScope();
     auto results = scope["py_probs"](circuit, device, kwargs, shots, num_qubits);
 
     probs->reserve(std::pow(2, num_qubits));
@@ -178,9 +275,7 @@ extern "C" NB_EXPORT char *runCircuit(const char *_circuit, const char *_device,
     std::string device(_device);
     std::string kwargs(_kwargs);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
+    nb::dict &scope = getProgramScope();
     auto retval = nb::cast<std::string>(scope["py_get_results"](circuit, device, kwargs, shots));
     auto retptr = static_cast<char *>(malloc(retval.size() + 1)); // string is a sequences of `char`
     std::memcpy(retptr, retval.c_str(), retval.size() + 1);
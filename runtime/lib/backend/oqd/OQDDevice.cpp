@@ -22,6 +22,8 @@ namespace Catalyst::Runtime::Device {
 
 auto OQDDevice::AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType>
 {
+    // Every execution writes a new program
+    __catalyst__oqd__rt__start(program);
     for (size_t i = 0; i < num_qubits; i++) {
         __catalyst__oqd__ion(this->ion_specs);
     }
@@ -30,7 +32,7 @@ auto OQDDevice::AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType>
     // need to return a vector from 0 to num_qubits
     std::vector<QubitIdType> result(num_qubits);
     std::generate_n(result.begin(), num_qubits,
-                    [&]() { return this->qubit_manager.Allocate(num_qubits); });
+                    [this]() { return this->qubit_manager.Allocate(); });
 
     RT_FAIL_IF(!this->initial_allocated_QubitIds.empty(),
                "OQD device does not support dynamic qubit allocation")
@@ -46,6 +48,7 @@ void OQDDevice::ReleaseQubits(const std::vector<QubitIdType> &qubits)
                "deallocation qubit ID array contains the same values as those produced by the "
                "initial `AllocateQubits` call")
     this->initial_allocated_QubitIds.clear();
+    __catalyst__oqd__rt__finish(program);
 
     this->ion_specs = "";
     this->phonon_specs.clear();
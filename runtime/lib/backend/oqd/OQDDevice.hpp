@@ -28,12 +28,13 @@
 namespace Catalyst::Runtime::Device {
 class OQDDevice final : public Catalyst::Runtime::QuantumDevice {
   private:
-    Catalyst::Runtime::QubitManager<QubitIdType, size_t> qubit_manager{};
+    Catalyst::Runtime::FlatQubitManager<QubitIdType, size_t> qubit_manager{};
 
     size_t device_shots;
     std::string ion_specs;
     std::string openapl_file_name;
     std::vector<std::string> phonon_specs;
+    Catalyst::Runtime::OQD::OpenAPLWriter *program;
 
     std::set<QubitIdType> initial_allocated_QubitIds;
     std::unordered_map<std::string, std::string> device_kwargs;
@@ -50,8 +51,6 @@ class OQDDevice final : public Catalyst::Runtime::QuantumDevice {
   public:
     explicit OQDDevice(const std::string &kwargs = "{device_type : oqd, backend : default}")
     {
-        __catalyst__oqd__rt__initialize();
-
         // The OQD kwarg string format is:
         // deviceKwargs.str() + "ION:" + std::string(ion_json.dump()) + "PHONON:" +
         // std::string(phonon_json1.dump()) + ... where deviceKwargs are the usual keyword arguments
@@ -83,8 +82,9 @@ class OQDDevice final : public Catalyst::Runtime::QuantumDevice {
         openapl_file_name = device_kwargs.contains("openapl_file_name")
                                 ? device_kwargs["openapl_file_name"]
                                 : "__openapl__output.json";
+        program = __catalyst__oqd__rt__initialize(openapl_file_name);
     }
-    ~OQDDevice() { __catalyst__oqd__rt__finalize(openapl_file_name); };
+    ~OQDDevice() { __catalyst__oqd__rt__finalize(program); };
 
     auto AllocateQubits(size_t) -> std::vector<QubitIdType> override;
     void ReleaseQubits(const std::vector<QubitIdType> &) override;
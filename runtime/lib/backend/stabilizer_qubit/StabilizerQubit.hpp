@@ -0,0 +1,498 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "DataView.hpp"
+#include "Exception.hpp"
+#include "Philox.hpp"
+#include "QuantumDevice.hpp"
+#include "QubitManager.hpp"
+#include "StabilizerTableau.hpp"
+#include "Types.h"
+#include "Utils.hpp"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * @brief A stabilizer simulator device for Clifford circuits.
+ *
+ * The state is stored as a bit-packed stabilizer tableau, so that Clifford gates, mid-circuit
+ * measurements and Pauli product measurements (PPMs) cost a polynomial number of word operations
+ * instead of an exponential state vector update. This makes it suitable for executing the output
+ * of the PBC compilation passes on hundreds or thousands of qubits.
+ *
+ * Supported operations:
+ * - Identity, PauliX, PauliY, PauliZ, Hadamard, S, CNOT, CY, CZ, SWAP and GlobalPhase
+ * - RX, RY, RZ, PhaseShift, MultiRZ, IsingXX, IsingYY, IsingZZ and PauliRot at multiples of pi/2
+ * - Computational basis measurements, Pauli product measurements, samples and counts
+ *
+ * Non-Clifford gates, controlled gates and analytic measurement processes are rejected.
+ *
+ * Samples are generated in two steps: the sampled qubits are measured once on a copy of the
+ * tableau, recording each outcome as an affine function of the random bits drawn so far, and the
+ * shots are then produced 64 at a time by evaluating these functions on random words.
+ */
+class StabilizerQubit final : public Catalyst::Runtime::QuantumDevice {
+  private:
+    std::unordered_map<std::string, std::string> device_kwargs;
+    Catalyst::Runtime::FlatQubitManager<QubitIdType, size_t> qubit_manager{};
+    StabilizerTableau tableau{};
+    size_t device_shots{0};
+
+    std::mt19937 default_gen{std::random_device{}()};
+    std::mt19937 *gen{nullptr};
+    std::optional<PhiloxEngine> stream{};
+
+    // Tolerance of the angles of the rotation gates to multiples of pi/2
+    static constexpr double ANGLE_TOLERANCE = 1e-9;
+
+    static constexpr bool GLOBAL_RESULT_TRUE_CONST = true;
+    static constexpr bool GLOBAL_RESULT_FALSE_CONST = false;
+
+    auto randomBits() -> uint32_t
+    {
+        if (stream) {
+            return (*stream)();
+        }
+        return static_cast<uint32_t>(gen ? (*gen)() : default_gen());
+    }
+
+    auto randomWord() -> uint64_t
+    {
+        const uint64_t high = randomBits();
+        return (high << 32) | randomBits();
+    }
+
+    auto randomBit() -> bool { return randomBits() & 1; }
+
+    static auto getQuarterTurns(double angle, bool inverse) -> unsigned
+    {
+        const double turns = (inverse ? -angle : angle) / (M_PI / 2);
+        const double rounded = std::round(turns);
+        RT_FAIL_IF(std::abs(turns - rounded) > ANGLE_TOLERANCE,
+                   "StabilizerQubit only supports rotations by multiples of pi/2");
+        return static_cast<unsigned>(static_cast<int64_t>(rounded) & 3);
+    }
+
+    auto getPauliString(std::string_view pauli_word, std::span<const size_t> qubits) -> PauliString
+    {
+        RT_FAIL_IF(pauli_word.size() != qubits.size(),
+                   "The length of the Pauli word must be equal to the number of wires");
+
+        PauliString pauli(tableau.getNumWords());
+        for (size_t i = 0; i < qubits.size(); i++) {
+            switch (pauli_word[i]) {
+            case 'I':
+                break;
+            case 'X':
+                pauli.set(qubits[i], true, false);
+                break;
+            case 'Y':
+                pauli.set(qubits[i], true, true);
+                break;
+            case 'Z':
+                pauli.set(qubits[i], false, true);
+                break;
+            default:
+                RT_FAIL("Invalid Pauli word");
+            }
+        }
+        return pauli;
+    }
+
+    auto getPauliString(std::span<const uint64_t> pauli_masks, std::span<const size_t> qubits)
+        -> PauliString
+    {
+        const size_t num_words = (qubits.size() + 63) / 64;
+        RT_FAIL_IF(pauli_masks.size() != 2 * num_words, "Invalid size for the packed Pauli word");
+
+        PauliString pauli(tableau.getNumWords());
+        for (size_t i = 0; i < qubits.size(); i++) {
+            const bool x = (pauli_masks[i / 64] >> (i % 64)) & 1;
+            const bool z = (pauli_masks[num_words + i / 64] >> (i % 64)) & 1;
+            if (x || z) {
+                pauli.set(qubits[i], x, z);
+            }
+        }
+        return pauli;
+    }
+
+    auto getDeviceIds(const std::vector<QubitIdType> &wires) -> std::vector<size_t>
+    {
+        return qubit_manager.getDeviceIds(wires);
+    }
+
+    void ResetQubit(size_t qubit)
+    {
+        PauliString pauli(tableau.getNumWords());
+        pauli.set(qubit, false, true);
+        if (tableau.measure(pauli, [this]() { return randomBit(); }).first) {
+            tableau.X(qubit);
+        }
+    }
+
+    /**
+     * @brief Generate the samples of `qubits` for all shots, and pass each block of up to 64
+     *        shots to `consume` as one word per qubit, with bit `s` holding the outcome of shot s.
+     */
+    template <typename ConsumeFn>
+    void SampleBlocks(const std::vector<size_t> &qubits, ConsumeFn &&consume)
+    {
+        const size_t num_qubits = qubits.size();
+
+        // Measure every qubit once, drawing 0 for the random outcomes, and record the reference
+        // outcomes together with the random outcomes that flip them
+        StabilizerTableau copy = tableau;
+        copy.trackDependencies(num_qubits);
+        const size_t num_dep_words = (num_qubits + 63) / 64;
+        std::vector<uint8_t> reference(num_qubits);
+        std::vector<uint64_t> flips(num_qubits * num_dep_words, 0);
+        size_t num_random = 0;
+        for (size_t i = 0; i < num_qubits; i++) {
+            PauliString pauli(copy.getNumWords());
+            pauli.set(qubits[i], false, true);
+            auto [outcome, random] = copy.measure(pauli, []() { return false; }, num_random);
+            uint64_t *flip = flips.data() + i * num_dep_words;
+            if (random) {
+                flip[num_random / 64] |= uint64_t{1} << (num_random % 64);
+                num_random++;
+            }
+            else {
+                std::copy_n(copy.getScratchDependencies(), num_dep_words, flip);
+            }
+            reference[i] = outcome;
+        }
+
+        std::vector<uint64_t> random_words(num_random);
+        std::vector<uint64_t> block(num_qubits);
+        for (size_t done = 0; done < device_shots; done += 64) {
+            std::generate(random_words.begin(), random_words.end(),
+                          [this]() { return randomWord(); });
+            for (size_t i = 0; i < num_qubits; i++) {
+                uint64_t word = reference[i] ? ~uint64_t{0} : 0;
+                const uint64_t *flip = flips.data() + i * num_dep_words;
+                for (size_t w = 0; w < num_dep_words; w++) {
+                    for (uint64_t bits = flip[w]; bits; bits &= bits - 1) {
+                        word ^= random_words[w * 64 + std::countr_zero(bits)];
+                    }
+                }
+                block[i] = word;
+            }
+            consume(block, done, std::min<size_t>(64, device_shots - done));
+        }
+    }
+
+    void SampleQubits(DataView<double, 2> &samples, const std::vector<size_t> &qubits)
+    {
+        const size_t num_qubits = qubits.size();
+        RT_FAIL_IF(samples.size() != device_shots * num_qubits,
+                   "Invalid size for the pre-allocated samples");
+
+        SampleBlocks(qubits, [&](const std::vector<uint64_t> &block, size_t first, size_t count) {
+            for (size_t s = 0; s < count; s++) {
+                for (size_t i = 0; i < num_qubits; i++) {
+                    samples(first + s, i) = static_cast<double>((block[i] >> s) & 1);
+                }
+            }
+        });
+    }
+
+  public:
+    /**
+     * @brief Constructs a StabilizerQubit device
+     *
+     * Supported parameters:
+     * - "seed": Seed of the device random number generator, unless one is set by the runtime
+     *
+     * @param kwargs non-nested JSON-like string containing device configuration parameters
+     */
+    StabilizerQubit(const std::string &kwargs = "{}")
+    {
+        this->device_kwargs = Catalyst::Runtime::parse_kwargs(kwargs);
+        if (device_kwargs.contains("seed")) {
+            this->default_gen.seed(std::stoul(device_kwargs["seed"]));
+        }
+    }
+    ~StabilizerQubit() = default;
+
+    StabilizerQubit &operator=(const StabilizerQubit &) = delete;
+    StabilizerQubit(const StabilizerQubit &) = delete;
+    StabilizerQubit(StabilizerQubit &&) = delete;
+    StabilizerQubit &operator=(StabilizerQubit &&) = delete;
+
+    auto AllocateQubit() -> QubitIdType
+    {
+        QubitIdType new_qubit = this->qubit_manager.Allocate();
+        const size_t qubit = this->qubit_manager.getDeviceId(new_qubit);
+        if (qubit < tableau.getNumQubits()) {
+            // Device IDs of released qubits are reused
+            ResetQubit(qubit);
+        }
+        else {
+            tableau.addQubits(qubit + 1 - tableau.getNumQubits());
+        }
+        return new_qubit;
+    }
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType>
+    {
+        if (!num_qubits) {
+            return {};
+        }
+        // Grow the tableau once for the whole register
+        auto ids = this->qubit_manager.AllocateRange(num_qubits);
+        size_t max_qubit = 0;
+        std::vector<size_t> reused;
+        for (auto id : ids) {
+            const size_t qubit = this->qubit_manager.getDeviceId(id);
+            max_qubit = std::max(max_qubit, qubit);
+            if (qubit < tableau.getNumQubits()) {
+                reused.push_back(qubit);
+            }
+        }
+        for (size_t qubit : reused) {
+            ResetQubit(qubit);
+        }
+        if (max_qubit >= tableau.getNumQubits()) {
+            tableau.addQubits(max_qubit + 1 - tableau.getNumQubits());
+        }
+        return ids;
+    }
+
+    void ReleaseQubit(QubitIdType q)
+    {
+        this->qubit_manager.Release(q);
+        if (!this->qubit_manager.getNumQubits()) {
+            // The device IDs start over, so the tableau does too
+            tableau = StabilizerTableau();
+        }
+    }
+
+    void ReleaseQubits(const std::vector<QubitIdType> &qubits)
+    {
+        for (auto q : qubits) {
+            this->ReleaseQubit(q);
+        }
+    }
+
+    [[nodiscard]] auto GetNumQubits() const -> size_t { return qubit_manager.getNumQubits(); }
+
+    void SetDeviceShots(size_t shots) { device_shots = shots; }
+
+    [[nodiscard]] auto GetDeviceShots() const -> size_t { return device_shots; }
+
+    void SetDevicePRNG(std::mt19937 *gen_) { this->gen = gen_; }
+
+    void SetDeviceStreamPRNG(const PhiloxEngine &engine) { this->stream = engine; }
+
+    /**
+     * @brief Apply a Clifford gate to the tableau.
+     *
+     * Rotation gates are applied when their angle is a multiple of pi/2, and the Pauli word of
+     * PauliRot is read from the first optional parameter.
+     */
+    void NamedOperation(const std::string &name, const std::vector<double> &params,
+                        const std::vector<QubitIdType> &wires, bool inverse = false,
+                        const std::vector<QubitIdType> &controlled_wires = {},
+                        const std::vector<bool> &controlled_values = {},
+                        const std::vector<std::string> &optional_params = {})
+    {
+        RT_FAIL_IF(!controlled_wires.empty() || !controlled_values.empty(),
+                   "StabilizerQubit does not support controlled operations");
+
+        const auto qubits = getDeviceIds(wires);
+        auto rotate = [&](std::string_view pauli_word) {
+            RT_FAIL_IF(params.size() != 1, "Invalid number of parameters");
+            tableau.rotate(getPauliString(pauli_word, qubits),
+                           getQuarterTurns(params[0], inverse));
+        };
+
+        if (name == "Identity" || name == "GlobalPhase") {
+            return;
+        }
+        if (name == "PauliX") {
+            tableau.X(qubits[0]);
+        }
+        else if (name == "PauliY") {
+            tableau.Y(qubits[0]);
+        }
+        else if (name == "PauliZ") {
+            tableau.Z(qubits[0]);
+        }
+        else if (name == "Hadamard") {
+            tableau.H(qubits[0]);
+        }
+        else if (name == "S") {
+            inverse ? tableau.SAdjoint(qubits[0]) : tableau.S(qubits[0]);
+        }
+        else if (name == "CNOT") {
+            tableau.CNOT(qubits[0], qubits[1]);
+        }
+        else if (name == "CY") {
+            tableau.CY(qubits[0], qubits[1]);
+        }
+        else if (name == "CZ") {
+            tableau.CZ(qubits[0], qubits[1]);
+        }
+        else if (name == "SWAP") {
+            tableau.SWAP(qubits[0], qubits[1]);
+        }
+        else if (name == "RX") {
+            rotate("X");
+        }
+        else if (name == "RY") {
+            rotate("Y");
+        }
+        else if (name == "RZ" || name == "PhaseShift") {
+            // PhaseShift is RZ up to a global phase
+            rotate("Z");
+        }
+        else if (name == "IsingXX") {
+            rotate("XX");
+        }
+        else if (name == "IsingYY") {
+            rotate("YY");
+        }
+        else if (name == "IsingZZ") {
+            rotate("ZZ");
+        }
+        else if (name == "MultiRZ") {
+            rotate(std::string(qubits.size(), 'Z'));
+        }
+        else if (name == "PauliRot") {
+            RT_FAIL_IF(optional_params.empty(), "PauliRot requires a Pauli word");
+            rotate(optional_params[0]);
+        }
+        else {
+            RT_FAIL(("StabilizerQubit does not support the non-Clifford operation " + name)
+                        .c_str());
+        }
+    }
+
+    /**
+     * @brief Apply a Pauli product rotation packed into bit masks, by a multiple of pi/2.
+     */
+    void PackedPauliRot(std::span<const uint64_t> pauli_masks, double theta,
+                        std::span<const QubitIdType> wires, bool inverse = false,
+                        std::span<const QubitIdType> controlled_wires = {},
+                        std::span<const bool> controlled_values = {})
+    {
+        RT_FAIL_IF(!controlled_wires.empty() || !controlled_values.empty(),
+                   "StabilizerQubit does not support controlled operations");
+
+        const auto qubits = getDeviceIds(std::vector<QubitIdType>(wires.begin(), wires.end()));
+        tableau.rotate(getPauliString(pauli_masks, qubits), getQuarterTurns(theta, inverse));
+    }
+
+    /**
+     * @brief Fill the sample array with samples of all qubits, without collapsing the state.
+     */
+    void Sample(DataView<double, 2> &samples)
+    {
+        std::vector<size_t> qubits;
+        for (auto id : qubit_manager.getAllQubitIds()) {
+            qubits.push_back(qubit_manager.getDeviceId(id));
+        }
+        SampleQubits(samples, qubits);
+    }
+
+    /**
+     * @brief Fill the sample array with samples of `wires`, without collapsing the state.
+     */
+    void PartialSample(DataView<double, 2> &samples, const std::vector<QubitIdType> &wires)
+    {
+        SampleQubits(samples, getDeviceIds(wires));
+    }
+
+    /**
+     * @brief Fill the packed sample array with samples of `wires`, or all qubits if empty.
+     */
+    void PackedSample(DataView<uint64_t, 2> &samples, const std::vector<QubitIdType> &wires)
+    {
+        const auto qubits =
+            getDeviceIds(wires.empty() ? qubit_manager.getAllQubitIds() : wires);
+        samples.fill(0);
+        SampleBlocks(qubits, [&](const std::vector<uint64_t> &block, size_t first, size_t count) {
+            for (size_t i = 0; i < qubits.size(); i++) {
+                for (size_t s = 0; s < count; s++) {
+                    samples(first + s, i / 64) |= ((block[i] >> s) & 1) << (i % 64);
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Measure a qubit in the computational basis.
+     *
+     * @param wire The qubit to measure
+     * @param postselect Optional outcome to force a random measurement to
+     * @return Result The measurement outcome
+     */
+    auto Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result
+    {
+        return MeasurePauli(getPauliString("Z", getDeviceIds({wire})), postselect);
+    }
+
+    /**
+     * @brief Measure a Pauli product on the given qubits.
+     *
+     * @param pauli_word The Pauli word to measure
+     * @param wires The qubits to measure
+     * @return Result The measurement outcome, true for the -1 eigenvalue
+     */
+    auto PauliMeasure(const std::string &pauli_word, const std::vector<QubitIdType> &wires)
+        -> Result
+    {
+        return MeasurePauli(getPauliString(pauli_word, getDeviceIds(wires)), std::nullopt);
+    }
+
+    /**
+     * @brief Measure a Pauli product packed into bit masks on the given qubits.
+     *
+     * @param pauli_masks The X masks then the Z masks of the Pauli word
+     * @param wires The qubits to measure
+     * @return Result The measurement outcome, true for the -1 eigenvalue
+     */
+    auto PackedPauliMeasure(std::span<const uint64_t> pauli_masks,
+                            const std::vector<QubitIdType> &wires) -> Result
+    {
+        return MeasurePauli(getPauliString(pauli_masks, getDeviceIds(wires)), std::nullopt);
+    }
+
+  private:
+    auto MeasurePauli(const PauliString &pauli, std::optional<int32_t> postselect) -> Result
+    {
+        auto [outcome, random] = tableau.measure(pauli, [&]() {
+            return postselect ? static_cast<bool>(*postselect) : randomBit();
+        });
+        RT_FAIL_IF(postselect && outcome != static_cast<bool>(*postselect),
+                   "Postselection failed: the measurement outcome has probability 0");
+
+        return const_cast<Result>(outcome ? &GLOBAL_RESULT_TRUE_CONST
+                                          : &GLOBAL_RESULT_FALSE_CONST);
+    }
+};
+
+} // namespace Catalyst::Runtime::Devices
@@ -0,0 +1,389 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * @brief A Pauli string in the symplectic representation.
+ *
+ * The operator on qubit `i` is encoded by bit `i % 64` of the words `x[i / 64]` and `z[i / 64]`,
+ * with (x, z) = (1, 0) for X, (1, 1) for Y and (0, 1) for Z.
+ */
+struct PauliString {
+    std::vector<uint64_t> x;
+    std::vector<uint64_t> z;
+
+    explicit PauliString(size_t num_words) : x(num_words, 0), z(num_words, 0) {}
+
+    void set(size_t qubit, bool x_bit, bool z_bit)
+    {
+        const uint64_t mask = uint64_t{1} << (qubit % 64);
+        x[qubit / 64] = x_bit ? (x[qubit / 64] | mask) : (x[qubit / 64] & ~mask);
+        z[qubit / 64] = z_bit ? (z[qubit / 64] | mask) : (z[qubit / 64] & ~mask);
+    }
+};
+
+/**
+ * @brief The stabilizer tableau of an n-qubit Clifford state (Aaronson & Gottesman, 2004).
+ *
+ * The tableau holds 2n bit-packed Pauli rows: the destabilizer generators in rows [0, n) and the
+ * stabilizer generators in rows [n, 2n), plus a scratch row used by deterministic measurements.
+ * Each row stores its X words followed by its Z words, so that products of rows run over
+ * contiguous memory, and gates update one bit column of every row.
+ *
+ * While sampling, the tableau can additionally track the linear dependency of each row's sign on
+ * the random outcomes drawn so far. The measurement record is then an affine function of these
+ * outcomes, which lets any number of shots be generated from a single pass over the tableau.
+ */
+class StabilizerTableau {
+  private:
+    size_t num_qubits{0};
+    // Words per X (or Z) half of a row
+    size_t num_words{0};
+    std::vector<uint64_t> bits;
+    std::vector<uint8_t> signs;
+
+    // Words per dependency row, 0 unless dependencies are tracked
+    size_t num_dep_words{0};
+    std::vector<uint64_t> deps;
+
+    [[nodiscard]] auto numRows() const -> size_t { return 2 * num_qubits + 1; }
+    [[nodiscard]] auto scratchRow() const -> size_t { return 2 * num_qubits; }
+
+    auto xRow(size_t row) -> uint64_t * { return bits.data() + 2 * row * num_words; }
+    auto zRow(size_t row) -> uint64_t * { return xRow(row) + num_words; }
+    auto depRow(size_t row) -> uint64_t * { return deps.data() + row * num_dep_words; }
+    [[nodiscard]] auto xRow(size_t row) const -> const uint64_t *
+    {
+        return bits.data() + 2 * row * num_words;
+    }
+    [[nodiscard]] auto zRow(size_t row) const -> const uint64_t * { return xRow(row) + num_words; }
+
+    [[nodiscard]] static auto getBit(const uint64_t *words, size_t qubit) -> bool
+    {
+        return (words[qubit / 64] >> (qubit % 64)) & 1;
+    }
+
+    static void setBit(uint64_t *words, size_t qubit, bool value)
+    {
+        const uint64_t mask = uint64_t{1} << (qubit % 64);
+        words[qubit / 64] = value ? (words[qubit / 64] | mask) : (words[qubit / 64] & ~mask);
+    }
+
+    // Apply `update(x_bit, z_bit, sign)` to the bits of `qubit` in every row.
+    template <typename UpdateFn> void forEachRowBit(size_t qubit, UpdateFn &&update)
+    {
+        const size_t word = qubit / 64;
+        const uint64_t shift = qubit % 64;
+        for (size_t row = 0; row < 2 * num_qubits; row++) {
+            uint64_t *x = xRow(row) + word;
+            uint64_t *z = zRow(row) + word;
+            bool x_bit = (*x >> shift) & 1;
+            bool z_bit = (*z >> shift) & 1;
+            bool sign = signs[row];
+            update(x_bit, z_bit, sign);
+            *x = (*x & ~(uint64_t{1} << shift)) | (uint64_t{x_bit} << shift);
+            *z = (*z & ~(uint64_t{1} << shift)) | (uint64_t{z_bit} << shift);
+            signs[row] = sign;
+        }
+    }
+
+    /**
+     * @brief Multiply the Pauli string (xs, zs) into row `target` from the right, and return the
+     *        power of i of the phase of the product, before it is folded into the sign.
+     */
+    auto multiplyInto(size_t target, const uint64_t *xs, const uint64_t *zs, bool sign) -> unsigned
+    {
+        uint64_t *x = xRow(target);
+        uint64_t *z = zRow(target);
+        // Bits 0 and 1 of the per-qubit powers of i, accumulated in two counters
+        uint64_t cnt1 = 0;
+        uint64_t cnt2 = 0;
+        for (size_t w = 0; w < num_words; w++) {
+            const uint64_t old_x = x[w];
+            const uint64_t old_z = z[w];
+            x[w] ^= xs[w];
+            z[w] ^= zs[w];
+            const uint64_t x1z2 = old_x & zs[w];
+            const uint64_t anti_commutes = (xs[w] & old_z) ^ x1z2;
+            cnt2 ^= (cnt1 ^ x[w] ^ z[w] ^ x1z2) & anti_commutes;
+            cnt1 ^= anti_commutes;
+        }
+        unsigned log_i = std::popcount(cnt1) + 2 * std::popcount(cnt2);
+        log_i += 2 * (signs[target] + sign);
+        return log_i & 3;
+    }
+
+    // Set row `target` to the product of rows `target` and `source`, which must commute.
+    void rowsum(size_t target, size_t source)
+    {
+        const unsigned log_i = multiplyInto(target, xRow(source), zRow(source), signs[source]);
+        signs[target] = (log_i & 2) != 0;
+        if (num_dep_words) {
+            uint64_t *dst = depRow(target);
+            const uint64_t *src = depRow(source);
+            for (size_t w = 0; w < num_dep_words; w++) {
+                dst[w] ^= src[w];
+            }
+        }
+    }
+
+    void copyRow(size_t target, size_t source)
+    {
+        std::copy_n(xRow(source), 2 * num_words, xRow(target));
+        signs[target] = signs[source];
+        if (num_dep_words) {
+            std::copy_n(depRow(source), num_dep_words, depRow(target));
+        }
+    }
+
+    void clearRow(size_t row)
+    {
+        std::fill_n(xRow(row), 2 * num_words, 0);
+        signs[row] = 0;
+        if (num_dep_words) {
+            std::fill_n(depRow(row), num_dep_words, 0);
+        }
+    }
+
+    [[nodiscard]] auto anticommutes(size_t row, const PauliString &pauli) const -> bool
+    {
+        const uint64_t *x = xRow(row);
+        const uint64_t *z = zRow(row);
+        uint64_t parity = 0;
+        for (size_t w = 0; w < num_words; w++) {
+            parity ^= (x[w] & pauli.z[w]) ^ (z[w] & pauli.x[w]);
+        }
+        return std::popcount(parity) & 1;
+    }
+
+  public:
+    /**
+     * @brief Construct the tableau of the all-zero state |0...0> of `num_qubits` qubits.
+     */
+    explicit StabilizerTableau(size_t num_qubits = 0)
+        : num_qubits(num_qubits), num_words((num_qubits + 63) / 64),
+          bits(numRows() * 2 * num_words, 0), signs(numRows(), 0)
+    {
+        for (size_t q = 0; q < num_qubits; q++) {
+            setBit(xRow(q), q, true);
+            setBit(zRow(num_qubits + q), q, true);
+        }
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits; }
+    [[nodiscard]] auto getNumWords() const -> size_t { return num_words; }
+
+    /**
+     * @brief Append `count` qubits in the state |0> after the existing qubits.
+     */
+    void addQubits(size_t count)
+    {
+        StabilizerTableau grown(num_qubits + count);
+        for (size_t row = 0; row < num_qubits; row++) {
+            for (auto [src, dst] : {std::pair{row, row},
+                                    std::pair{num_qubits + row, grown.num_qubits + row}}) {
+                std::copy_n(xRow(src), num_words, grown.xRow(dst));
+                std::copy_n(zRow(src), num_words, grown.zRow(dst));
+                grown.signs[dst] = signs[src];
+            }
+        }
+        *this = std::move(grown);
+    }
+
+    /**
+     * @brief Track the dependency of the row signs on up to `num_outcomes` random outcomes.
+     */
+    void trackDependencies(size_t num_outcomes)
+    {
+        num_dep_words = (num_outcomes + 63) / 64;
+        deps.assign(numRows() * num_dep_words, 0);
+    }
+
+    void H(size_t q)
+    {
+        forEachRowBit(q, [](bool &x, bool &z, bool &sign) {
+            sign ^= x & z;
+            std::swap(x, z);
+        });
+    }
+
+    void S(size_t q)
+    {
+        forEachRowBit(q, [](bool &x, bool &z, bool &sign) {
+            sign ^= x & z;
+            z ^= x;
+        });
+    }
+
+    void SAdjoint(size_t q)
+    {
+        forEachRowBit(q, [](bool &x, bool &z, bool &sign) {
+            sign ^= x & !z;
+            z ^= x;
+        });
+    }
+
+    void X(size_t q)
+    {
+        forEachRowBit(q, [](bool &, bool &z, bool &sign) { sign ^= z; });
+    }
+
+    void Y(size_t q)
+    {
+        forEachRowBit(q, [](bool &x, bool &z, bool &sign) { sign ^= x ^ z; });
+    }
+
+    void Z(size_t q)
+    {
+        forEachRowBit(q, [](bool &x, bool &, bool &sign) { sign ^= x; });
+    }
+
+    void CNOT(size_t control, size_t target)
+    {
+        for (size_t row = 0; row < 2 * num_qubits; row++) {
+            uint64_t *x = xRow(row);
+            uint64_t *z = zRow(row);
+            const bool xc = getBit(x, control);
+            const bool zc = getBit(z, control);
+            const bool xt = getBit(x, target);
+            const bool zt = getBit(z, target);
+            signs[row] ^= xc & zt & (xt ^ zc ^ 1);
+            setBit(x, target, xt ^ xc);
+            setBit(z, control, zc ^ zt);
+        }
+    }
+
+    void CZ(size_t control, size_t target)
+    {
+        H(target);
+        CNOT(control, target);
+        H(target);
+    }
+
+    void CY(size_t control, size_t target)
+    {
+        SAdjoint(target);
+        CNOT(control, target);
+        S(target);
+    }
+
+    void SWAP(size_t a, size_t b)
+    {
+        for (size_t row = 0; row < 2 * num_qubits; row++) {
+            for (uint64_t *words : {xRow(row), zRow(row)}) {
+                const bool bit_a = getBit(words, a);
+                setBit(words, a, getBit(words, b));
+                setBit(words, b, bit_a);
+            }
+        }
+    }
+
+    /**
+     * @brief Apply the rotation exp(-i k pi/4 P) of `quarter_turns` = k quarter turns about the
+     *        Pauli string P, which is Clifford for every integer k.
+     *
+     * Rows that commute with P are left unchanged. A half turn flips the sign of the others, and
+     * a quarter turn maps them to i Q P, whose phase is real since Q and P anti-commute.
+     */
+    void rotate(const PauliString &pauli, unsigned quarter_turns)
+    {
+        quarter_turns &= 3;
+        if (!quarter_turns) {
+            return;
+        }
+        for (size_t row = 0; row < 2 * num_qubits; row++) {
+            if (!anticommutes(row, pauli)) {
+                continue;
+            }
+            if (quarter_turns == 2) {
+                signs[row] ^= 1;
+                continue;
+            }
+            const unsigned log_i = multiplyInto(row, pauli.x.data(), pauli.z.data(), false);
+            signs[row] = ((log_i + quarter_turns) & 2) != 0;
+        }
+    }
+
+    /**
+     * @brief Measure the Pauli string P, collapsing the state onto the measured eigenspace.
+     *
+     * @param pauli The Pauli string to measure, with a positive sign
+     * @param draw Called for the outcome of a random measurement
+     * @param outcome_id Index of the dependency bit of a random outcome, if tracked
+     * @return The outcome (0 for the +1 eigenvalue), and whether it was random
+     */
+    template <typename DrawFn>
+    auto measure(const PauliString &pauli, DrawFn &&draw, size_t outcome_id = 0)
+        -> std::pair<bool, bool>
+    {
+        const size_t n = num_qubits;
+        size_t pivot = 2 * n;
+        for (size_t row = n; row < 2 * n; row++) {
+            if (anticommutes(row, pauli)) {
+                pivot = row;
+                break;
+            }
+        }
+
+        if (pivot < 2 * n) {
+            // The destabilizer partner of the pivot is overwritten below
+            for (size_t row = 0; row < 2 * n; row++) {
+                if (row != pivot && row != pivot - n && anticommutes(row, pauli)) {
+                    rowsum(row, pivot);
+                }
+            }
+            copyRow(pivot - n, pivot);
+            clearRow(pivot);
+            std::copy_n(pauli.x.data(), num_words, xRow(pivot));
+            std::copy_n(pauli.z.data(), num_words, zRow(pivot));
+            const bool outcome = draw();
+            signs[pivot] = outcome;
+            if (num_dep_words) {
+                setBit(depRow(pivot), outcome_id, true);
+            }
+            return {outcome, true};
+        }
+
+        // P is in the stabilizer group: its sign is that of the product of the stabilizers whose
+        // destabilizers anti-commute with it
+        const size_t scratch = scratchRow();
+        clearRow(scratch);
+        for (size_t row = 0; row < n; row++) {
+            if (anticommutes(row, pauli)) {
+                rowsum(scratch, n + row);
+            }
+        }
+        return {signs[scratch] != 0, false};
+    }
+
+    /**
+     * @brief The signs of the scratch row of the last deterministic measurement as a function of
+     *        the tracked random outcomes.
+     */
+    [[nodiscard]] auto getScratchDependencies() const -> const uint64_t *
+    {
+        return deps.data() + scratchRow() * num_dep_words;
+    }
+};
+
+} // namespace Catalyst::Runtime::Devices
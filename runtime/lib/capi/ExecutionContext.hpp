@@ -14,60 +14,197 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <deque>
 #include <dlfcn.h>
+#include <fstream>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <random>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include "Exception.hpp"
+#include "HamiltonianEstimator.hpp"
+#include "MeasurementTree.hpp"
+#include "PauliFrame.hpp"
 #include "QuantumDevice.hpp"
+#include "ShotRejection.hpp"
+#include "SyndromeDecoder.hpp"
+#include "Tracer.hpp"
 
 namespace Catalyst::Runtime {
 
 extern "C" void __catalyst_inactive_callback(int64_t identifier, int64_t argc, int64_t retc, ...);
+extern "C" void __catalyst_inactive_batched_callback(int64_t identifier, int64_t argc,
+                                                     int64_t retc, const int64_t *ranks, ...);
+
+/**
+ * The current and peak number of bytes of the buffers charged to an execution or to a device.
+ */
+class MemoryUsage final {
+  private:
+    std::atomic<size_t> current{0};
+    std::atomic<size_t> peak{0};
+
+  public:
+    void add(size_t bytes) noexcept
+    {
+        const size_t now = current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t prev = peak.load(std::memory_order_relaxed);
+        while (prev < now && !peak.compare_exchange_weak(prev, now, std::memory_order_relaxed)) {
+        }
+    }
+
+    void sub(size_t bytes) noexcept { current.fetch_sub(bytes, std::memory_order_relaxed); }
+
+    [[nodiscard]] auto getCurrent() const noexcept -> size_t
+    {
+        return current.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto getPeak() const noexcept -> size_t
+    {
+        return peak.load(std::memory_order_relaxed);
+    }
+};
 
+/**
+ * @brief Tracks the buffers allocated by compiled programs through the runtime, and frees the
+ * remaining ones when the execution context is destroyed (`__catalyst__rt__finalize`).
+ *
+ * Allocations are spread over independently locked shards selected by pointer address, so
+ * concurrent programs (e.g. async QNodes) rarely contend on the same lock. Each operation locks
+ * exactly one shard and is O(1) on average.
+ *
+ * The size of each buffer is charged to the execution, and to the device that was active on the
+ * allocating thread, if any, until the buffer is freed or transferred out of the runtime. With a
+ * limit, an allocation that would take the execution beyond it fails before reaching the system
+ * allocator, instead of the process running out of memory.
+ */
 class MemoryManager // NOLINT(cppcoreguidelines-special-member-functions,
                     // hicpp-special-member-functions)
     final {
   private:
-    std::unordered_set<void *> _impl;
-    std::mutex mu; // To guard the memory manager
+    static constexpr size_t num_shards = 64;
+
+    struct Allocation {
+        size_t size;
+        MemoryUsage *device_usage;
+    };
+
+    // Keep each shard on its own cache line to avoid false sharing between threads
+    struct alignas(64) Shard {
+        std::unordered_map<void *, Allocation> allocations;
+        std::mutex mu;
+    };
+    std::array<Shard, num_shards> shards;
+
+    MemoryUsage usage;
+    size_t limit; // in bytes, 0 for no limit
+
+    static auto getShardIndex(void *ptr) -> size_t
+    {
+        // The low bits are fixed by the allocator alignment, so mix in higher ones
+        const auto addr = reinterpret_cast<uintptr_t>(ptr);
+        return ((addr >> 4) ^ (addr >> 12)) % num_shards;
+    }
+
+    auto getShard(void *ptr) -> Shard & { return shards[getShardIndex(ptr)]; }
 
   public:
-    explicit MemoryManager() { _impl.reserve(1024); };
+    explicit MemoryManager(size_t limit = 0) : limit(limit)
+    {
+        for (auto &shard : shards) {
+            shard.allocations.reserve(1024 / num_shards);
+        }
+    };
 
     ~MemoryManager()
     {
-        // Lock the mutex to protect _impl free
-        std::lock_guard<std::mutex> lock(mu);
-        for (auto *allocation : _impl) {
-            free(allocation); // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+        for (auto &shard : shards) {
+            // Lock the mutex to protect the shard free
+            std::lock_guard<std::mutex> lock(shard.mu);
+            for (auto &[allocation, _] : shard.allocations) {
+                free(allocation); // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+            }
         }
     }
 
-    void insert(void *ptr)
+    /**
+     * @brief Fail if allocating `size` more bytes would exceed the memory limit of the execution.
+     */
+    void checkLimit(size_t size) const
     {
-        // Lock the mutex to protect _impl update
-        std::lock_guard<std::mutex> lock(mu);
-        _impl.insert(ptr);
+        RT_FAIL_IF(limit != 0 && usage.getCurrent() + size > limit,
+                   "The allocation exceeds the memory limit of the execution "
+                   "(CATALYST_RUNTIME_MEMORY_LIMIT)");
     }
-    void erase(void *ptr)
+
+    /**
+     * @brief Track `ptr`, and charge its `size` to the execution and to `device_usage`.
+     */
+    void insert(void *ptr, size_t size = 0, MemoryUsage *device_usage = nullptr)
     {
-        // Lock the mutex to protect _impl update
-        std::lock_guard<std::mutex> lock(mu);
-        _impl.erase(ptr);
+        auto &shard = getShard(ptr);
+        {
+            // Lock the mutex to protect the shard update
+            std::lock_guard<std::mutex> lock(shard.mu);
+            shard.allocations.insert_or_assign(ptr, Allocation{size, device_usage});
+        }
+        usage.add(size);
+        if (device_usage) {
+            device_usage->add(size);
+        }
+    }
+    bool erase(void *ptr)
+    {
+        auto &shard = getShard(ptr);
+        Allocation allocation{};
+        {
+            // Lock the mutex to protect the shard update
+            std::lock_guard<std::mutex> lock(shard.mu);
+            auto it = shard.allocations.find(ptr);
+            if (it == shard.allocations.end()) {
+                return false;
+            }
+            allocation = it->second;
+            shard.allocations.erase(it);
+        }
+        usage.sub(allocation.size);
+        if (allocation.device_usage) {
+            allocation.device_usage->sub(allocation.size);
+        }
+        return true;
     }
     bool contains(void *ptr)
     {
-        // Lock the mutex to protect _impl update
-        std::lock_guard<std::mutex> lock(mu);
-        return _impl.contains(ptr);
+        auto &shard = getShard(ptr);
+        // Lock the mutex to protect the shard lookup
+        std::lock_guard<std::mutex> lock(shard.mu);
+        return shard.allocations.contains(ptr);
     }
+
+    [[nodiscard]] auto getUsage() const -> const MemoryUsage & { return usage; }
 };
 
 class SharedLibraryManager final {
@@ -133,11 +270,85 @@ class SharedLibraryManager final {
     }
 };
 
+/**
+ * Process-wide cache of the device libraries and their resolved factory symbols.
+ *
+ * Each library is opened with `dlopen` once per process and kept resident, so devices that are
+ * created and released on every execution do not repeatedly pay for loading the library and
+ * resolving its factory. Devices share ownership of their library, which keeps it loaded until
+ * the last device using it is destroyed, even if the cache itself is destroyed first at exit.
+ */
+class DeviceLibraryCache final {
+  private:
+    struct Entry {
+        std::shared_ptr<SharedLibraryManager> dylib;
+        std::unordered_map<std::string, void *> symbols;
+    };
+
+    std::unordered_map<std::string, Entry> libraries;
+    std::mutex mu; // To protect libraries
+    size_t num_loads{0};
+    size_t num_lookups{0};
+
+    DeviceLibraryCache() = default;
+
+  public:
+    ~DeviceLibraryCache() = default;
+    DeviceLibraryCache(const DeviceLibraryCache &other) = delete;
+    DeviceLibraryCache &operator=(const DeviceLibraryCache &other) = delete;
+    DeviceLibraryCache(DeviceLibraryCache &&other) = delete;
+    DeviceLibraryCache &operator=(DeviceLibraryCache &&other) = delete;
+
+    static auto getInstance() -> DeviceLibraryCache &
+    {
+        static DeviceLibraryCache cache;
+        return cache;
+    }
+
+    /**
+     * @brief Get the library `filename` and the address of `symbol` in it, loading the library
+     * and resolving the symbol only on first use.
+     */
+    [[nodiscard]] auto getSymbol(const std::string &filename, const std::string &symbol)
+        -> std::pair<std::shared_ptr<SharedLibraryManager>, void *>
+    {
+        std::lock_guard<std::mutex> lock(mu);
+
+        auto &entry = libraries[filename];
+        if (!entry.dylib) {
+            try {
+                entry.dylib = std::make_shared<SharedLibraryManager>(filename);
+            }
+            catch (...) {
+                libraries.erase(filename);
+                throw;
+            }
+            num_loads++;
+        }
+
+        auto sym = entry.symbols.find(symbol);
+        if (sym == entry.symbols.end()) {
+            sym = entry.symbols.emplace(symbol, entry.dylib->getSymbol(symbol)).first;
+            num_lookups++;
+        }
+        return {entry.dylib, sym->second};
+    }
+
+    /**
+     * @brief Get the number of `dlopen` and `dlsym` calls made through the cache.
+     */
+    [[nodiscard]] auto getStats() -> std::pair<size_t, size_t>
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        return {num_loads, num_lookups};
+    }
+};
+
 /**
  * This indicates the various stages a device can be in:
  * - `Active`   : The device is added to the device pool and the `ExecutionContext` device pointer
  *                (`RTD_PTR`) points to this device instance. The CAPI routines have only access to
- *                one single active device per thread via `RTD_PTR`.
+ *                the last initialized active device of each thread via `RTD_PTR`.
  * - `Inactive`  : The device is deactivated meaning `RTD_PTR` does not point to this device.
  *                 The device is not removed from the pool, allowing the `ExecutionContext` manager
  *                 to reuse this device in a multi-qnode workflow when another device with identical
@@ -150,6 +361,266 @@ enum class RTDeviceStatus : uint8_t {
 
 extern "C" Catalyst::Runtime::QuantumDevice *GenericDeviceFactory(const char *kwargs);
 
+/**
+ * @brief Read a non-negative integer setting from the environment variable `name`.
+ */
+[[nodiscard]] inline auto getEnvSize(const char *name, size_t default_value) -> size_t
+{
+    const char *value = std::getenv(name);
+    if (value == nullptr || *value == '\0') {
+        return default_value;
+    }
+    char *end = nullptr;
+    const unsigned long long parsed = std::strtoull(value, &end, 10);
+    RT_FAIL_IF(*end != '\0', "Invalid value for a Catalyst runtime environment variable");
+    return static_cast<size_t>(parsed);
+}
+
+/**
+ * @brief The NUMA nodes of the host and their cores, read from sysfs on Linux.
+ *
+ * Hosts without NUMA information, or with a single node, report no nodes, and all threads are
+ * considered to be on the same (unknown) node.
+ */
+class NumaTopology final {
+  private:
+    std::vector<std::vector<size_t>> node_cpus;
+    std::vector<int> cpu_nodes;
+
+    NumaTopology()
+    {
+#ifdef __linux__
+        for (size_t node = 0;; node++) {
+            std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) +
+                                  "/cpulist");
+            std::string list;
+            if (!cpulist || !std::getline(cpulist, list)) {
+                break;
+            }
+            node_cpus.push_back(parseCpuList(list));
+        }
+        if (node_cpus.size() < 2) {
+            node_cpus.clear();
+        }
+        for (size_t node = 0; node < node_cpus.size(); node++) {
+            for (size_t cpu : node_cpus[node]) {
+                if (cpu >= cpu_nodes.size()) {
+                    cpu_nodes.resize(cpu + 1, -1);
+                }
+                cpu_nodes[cpu] = static_cast<int>(node);
+            }
+        }
+#endif
+    }
+
+  public:
+    [[nodiscard]] static auto getInstance() -> const NumaTopology &
+    {
+        static const NumaTopology topology;
+        return topology;
+    }
+
+    /**
+     * @brief Parse a sysfs CPU list, e.g. "0-3,8,10-11".
+     */
+    [[nodiscard]] static auto parseCpuList(const std::string &list) -> std::vector<size_t>
+    {
+        std::vector<size_t> cpus;
+        size_t pos = 0;
+        while (pos < list.size()) {
+            size_t end = list.find(',', pos);
+            end = end == std::string::npos ? list.size() : end;
+            const std::string range = list.substr(pos, end - pos);
+            const size_t dash = range.find('-');
+            const size_t first = std::stoul(range.substr(0, dash));
+            const size_t last =
+                dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+            for (size_t cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(cpu);
+            }
+            pos = end + 1;
+        }
+        return cpus;
+    }
+
+    [[nodiscard]] auto getNumNodes() const -> size_t { return node_cpus.size(); }
+
+    [[nodiscard]] auto getNodeCpus(size_t node) const -> const std::vector<size_t> &
+    {
+        return node_cpus[node];
+    }
+
+    /**
+     * @brief Get the NUMA node of the core running the calling thread, or -1 if unknown.
+     */
+    [[nodiscard]] auto getCurrentNode() const -> int
+    {
+#ifdef __linux__
+        const int cpu = sched_getcpu();
+        if (cpu >= 0 && static_cast<size_t>(cpu) < cpu_nodes.size()) {
+            return cpu_nodes[cpu];
+        }
+#endif
+        return -1;
+    }
+};
+
+/**
+ * @brief The thread pool on which asynchronous QNodes are executed.
+ *
+ * Async regions are scheduled here instead of on the default MLIR async runtime thread pool,
+ * so that the runtime controls how many QNodes run at the same time. The number of workers
+ * defaults to the hardware concurrency. It can be set together with core pinning and the
+ * maximum number of device instances per device configuration (see `ExecutionContext`) with
+ * the `CATALYST_ASYNC_NUM_WORKERS`, `CATALYST_ASYNC_PIN_WORKERS` and
+ * `CATALYST_ASYNC_MAX_DEVICES` environment variables, or with `__catalyst__rt__async_configure`.
+ * Workers are started on first use. On NUMA hosts, pinned workers are spread round-robin over
+ * the nodes, so that the devices they create and reuse stay local to a node.
+ */
+class AsyncExecutor final {
+  public:
+    using Task = void (*)(void *);
+
+  private:
+    std::vector<std::thread> workers;
+    std::deque<std::pair<Task, void *>> tasks;
+    std::mutex mu; // To protect workers, tasks and the configuration
+    std::condition_variable tasks_cv;
+    bool stopping{false};
+
+    size_t num_workers;
+    bool pin_workers;
+    size_t max_devices_per_key;
+
+    AsyncExecutor()
+        : num_workers(getEnvSize("CATALYST_ASYNC_NUM_WORKERS", 0)),
+          pin_workers(getEnvSize("CATALYST_ASYNC_PIN_WORKERS", 0) != 0),
+          max_devices_per_key(getEnvSize("CATALYST_ASYNC_MAX_DEVICES", 0))
+    {
+    }
+
+    void workerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mu);
+        while (true) {
+            tasks_cv.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            // Drain the queue before stopping so that no scheduled region is lost
+            if (tasks.empty()) {
+                return;
+            }
+            auto [task, handle] = tasks.front();
+            tasks.pop_front();
+
+            lock.unlock();
+            task(handle);
+            lock.lock();
+        }
+    }
+
+    void pinWorker(std::thread &worker, size_t worker_idx)
+    {
+#ifdef __linux__
+        const NumaTopology &topology = NumaTopology::getInstance();
+        size_t core = worker_idx % std::max(std::thread::hardware_concurrency(), 1U);
+        if (const size_t num_nodes = topology.getNumNodes()) {
+            const std::vector<size_t> &cores = topology.getNodeCpus(worker_idx % num_nodes);
+            core = cores[(worker_idx / num_nodes) % cores.size()];
+        }
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(core, &cpuset);
+        pthread_setaffinity_np(worker.native_handle(), sizeof(cpu_set_t), &cpuset);
+#else
+        // Thread affinity is only a hint on other platforms and is not applied
+        static_cast<void>(worker);
+        static_cast<void>(worker_idx);
+#endif
+    }
+
+    // Must be called with `mu` held
+    void startWorkers()
+    {
+        const size_t count =
+            num_workers ? num_workers : std::max(std::thread::hardware_concurrency(), 1U);
+        stopping = false;
+        workers.reserve(count);
+        for (size_t idx = 0; idx < count; idx++) {
+            workers.emplace_back([this]() { workerLoop(); });
+            if (pin_workers) {
+                pinWorker(workers.back(), idx);
+            }
+        }
+    }
+
+    void stopWorkers()
+    {
+        std::vector<std::thread> finished;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            stopping = true;
+            finished.swap(workers);
+        }
+        tasks_cv.notify_all();
+        for (auto &worker : finished) {
+            worker.join();
+        }
+    }
+
+  public:
+    ~AsyncExecutor() { stopWorkers(); }
+    AsyncExecutor(const AsyncExecutor &other) = delete;
+    AsyncExecutor &operator=(const AsyncExecutor &other) = delete;
+    AsyncExecutor(AsyncExecutor &&other) = delete;
+    AsyncExecutor &operator=(AsyncExecutor &&other) = delete;
+
+    static auto getInstance() -> AsyncExecutor &
+    {
+        static AsyncExecutor executor;
+        return executor;
+    }
+
+    /**
+     * @brief Set the number of workers (0 for the hardware concurrency), whether each worker is
+     * pinned to a core, and the device limit of new execution contexts (0 for no limit).
+     * Running workers first finish all scheduled tasks.
+     */
+    void configure(size_t new_num_workers, bool new_pin_workers, size_t new_max_devices)
+    {
+        stopWorkers();
+        std::lock_guard<std::mutex> lock(mu);
+        num_workers = new_num_workers;
+        pin_workers = new_pin_workers;
+        max_devices_per_key = new_max_devices;
+    }
+
+    /**
+     * @brief Schedule `task(handle)` on one of the workers.
+     */
+    void execute(Task task, void *handle)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            if (workers.empty()) {
+                startWorkers();
+            }
+            tasks.emplace_back(task, handle);
+        }
+        tasks_cv.notify_one();
+    }
+
+    [[nodiscard]] auto getNumWorkers() -> size_t
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        return workers.size();
+    }
+
+    [[nodiscard]] auto getMaxDevicesPerKey() -> size_t
+    {
+        std::lock_guard<std::mutex> lock(mu);
+        return max_devices_per_key;
+    }
+};
+
 /**
  * Runtime Device data-class.
  *
@@ -164,11 +635,37 @@ class RTDevice {
     std::string rtd_kwargs;
     bool auto_qubit_management;
 
-    std::unique_ptr<SharedLibraryManager> rtd_dylib{nullptr};
+    std::shared_ptr<SharedLibraryManager> rtd_dylib{nullptr};
     std::unique_ptr<QuantumDevice> rtd_qdevice{nullptr};
 
+    // The measurement tree decorator of rtd_qdevice, once the tree was enabled on this device
+    MeasurementTreeDevice *measurement_tree{nullptr};
+
+    // The shot rejection decorator of rtd_qdevice, once rejection was enabled on this device
+    ShotRejectionDevice *shot_rejection{nullptr};
+
+    // Pauli records of the qubits of this device, for the Pauli frame tracking protocol
+    PauliFrame pauli_frame;
+
+    // Pauli sums of this device, for the expectation values that it cannot compute itself
+    HamiltonianEstimator hamiltonian_estimator;
+
+    // Syndrome decoders of the QEC programs that run on this device
+    DecoderRegistry decoders;
+
     RTDeviceStatus status{RTDeviceStatus::Inactive};
 
+    // The device that was active on the thread when this device was initialized, which becomes
+    // active again when this device is released
+    RTDevice *suspended_device{nullptr};
+
+    // The NUMA node of the thread that created this device, where its first-touched memory is
+    // likely to be, or -1 if unknown
+    int numa_node{-1};
+
+    // The buffers of the programs allocated on a thread while this device was active on it
+    MemoryUsage memory_usage;
+
     static void _complete_dylib_os_extension(std::string &rtd_lib, const std::string &name) noexcept
     {
 #ifdef __linux__
@@ -189,6 +686,10 @@ class RTDevice {
             rtd_name = "NullQubit";
             _complete_dylib_os_extension(rtd_lib, "null_qubit");
         }
+        else if (rtd_lib == "stabilizer.qubit") {
+            rtd_name = "StabilizerQubit";
+            _complete_dylib_os_extension(rtd_lib, "stabilizer_qubit");
+        }
         else if (rtd_lib == "lightning.qubit") {
             rtd_name = "LightningSimulator";
             _complete_dylib_os_extension(rtd_lib, "lightning");
@@ -220,6 +721,33 @@ class RTDevice {
         _pl2runtime_device_info(rtd_lib, rtd_name);
     }
 
+    /**
+     * @brief Get a key that uniquely identifies the device specification, i.e. two devices are
+     * equal (`operator==`) if and only if their keys are equal.
+     */
+    [[nodiscard]] static auto getDeviceKey(std::string_view _rtd_lib, std::string_view _rtd_name,
+                                           std::string_view _rtd_kwargs,
+                                           bool _auto_qubit_management) -> std::string
+    {
+        std::string lib{_rtd_lib};
+        std::string name{_rtd_name};
+        _pl2runtime_device_info(lib, name);
+
+        // NUL separators cannot appear in the C strings the fields are built from
+        std::string key;
+        key.reserve(lib.size() + name.size() + _rtd_kwargs.size() + 4);
+        key.append(lib).push_back('\0');
+        key.append(name).push_back('\0');
+        key.append(_rtd_kwargs).push_back('\0');
+        key.push_back(_auto_qubit_management ? '1' : '0');
+        return key;
+    }
+
+    [[nodiscard]] auto getDeviceKey() const -> std::string
+    {
+        return getDeviceKey(rtd_lib, rtd_name, rtd_kwargs, auto_qubit_management);
+    }
+
     ~RTDevice() = default;
     RTDevice(const RTDevice &other) = delete;
     RTDevice &operator=(const RTDevice &other) = delete;
@@ -239,9 +767,9 @@ class RTDevice {
             return rtd_qdevice;
         }
 
-        rtd_dylib = std::make_unique<SharedLibraryManager>(rtd_lib);
-        std::string factory_name{rtd_name + "Factory"};
-        void *f_ptr = rtd_dylib->getSymbol(factory_name);
+        void *f_ptr = nullptr;
+        std::tie(rtd_dylib, f_ptr) =
+            DeviceLibraryCache::getInstance().getSymbol(rtd_lib, rtd_name + "Factory");
         rtd_qdevice = std::unique_ptr<QuantumDevice>(
             (f_ptr != nullptr)
                 ? reinterpret_cast<decltype(GenericDeviceFactory) *>(f_ptr)(rtd_kwargs.c_str())
@@ -249,6 +777,54 @@ class RTDevice {
         return rtd_qdevice;
     }
 
+    /**
+     * @brief Record the calls to the quantum device of this instance with `tracer`.
+     */
+    void traceQuantumDevice(Tracer &tracer)
+    {
+        rtd_qdevice = std::make_unique<TracingDevice>(std::move(rtd_qdevice), tracer);
+    }
+
+    /**
+     * @brief Enable or disable the execution of mid-circuit measurement branches as a tree, whose
+     * state snapshots are kept across the shots of the same `epoch`.
+     */
+    void setMeasurementTree(bool enabled, size_t epoch)
+    {
+        if (!measurement_tree) {
+            if (!enabled) {
+                return;
+            }
+            auto tree_device = std::make_unique<MeasurementTreeDevice>(std::move(rtd_qdevice));
+            measurement_tree = tree_device.get();
+            rtd_qdevice = std::move(tree_device);
+        }
+        measurement_tree->setEnabled(enabled, epoch);
+    }
+
+    /**
+     * @brief Enable or disable the early rejection of the shots whose postselected measurements
+     * fail, and start a new shot.
+     */
+    void setShotRejection(bool enabled)
+    {
+        if (!shot_rejection) {
+            if (!enabled) {
+                return;
+            }
+            auto rejection_device = std::make_unique<ShotRejectionDevice>(std::move(rtd_qdevice));
+            shot_rejection = rejection_device.get();
+            rtd_qdevice = std::move(rejection_device);
+        }
+        shot_rejection->setEnabled(enabled);
+        shot_rejection->startShot();
+    }
+
+    [[nodiscard]] auto isShotRejected() const -> bool
+    {
+        return shot_rejection && shot_rejection->isRejected();
+    }
+
     [[nodiscard]] auto getDeviceInfo() const
         -> std::tuple<std::string, std::string, std::string, bool>
     {
@@ -257,12 +833,31 @@ class RTDevice {
 
     [[nodiscard]] auto getDeviceName() const -> const std::string & { return rtd_name; }
 
+    [[nodiscard]] auto getPauliFrame() -> PauliFrame & { return pauli_frame; }
+
+    [[nodiscard]] auto getHamiltonianEstimator() -> HamiltonianEstimator &
+    {
+        return hamiltonian_estimator;
+    }
+
+    [[nodiscard]] auto getDecoders() -> DecoderRegistry & { return decoders; }
+
+    [[nodiscard]] auto getMemoryUsage() -> MemoryUsage & { return memory_usage; }
+
     void setDeviceStatus(RTDeviceStatus new_status) noexcept { status = new_status; }
 
     bool getQubitManagementMode() { return auto_qubit_management; }
 
     [[nodiscard]] auto getDeviceStatus() const -> RTDeviceStatus { return status; }
 
+    void setSuspendedDevice(RTDevice *device) noexcept { suspended_device = device; }
+
+    void setNumaNode(int node) noexcept { numa_node = node; }
+
+    [[nodiscard]] auto getNumaNode() const -> int { return numa_node; }
+
+    [[nodiscard]] auto getSuspendedDevice() const -> RTDevice * { return suspended_device; }
+
     friend std::ostream &operator<<(std::ostream &os, const RTDevice &device)
     {
         os << "RTD, name: " << device.rtd_name << " lib: " << device.rtd_lib
@@ -272,32 +867,121 @@ class RTDevice {
     }
 };
 
+/**
+ * Counters of the `ExecutionContext` device pool, to measure how often `device_init` is served
+ * by an existing (warm) device rather than by creating a new one.
+ */
+struct DevicePoolStats {
+    size_t created{0};  // devices constructed through the device factory
+    size_t reused{0};   // `getOrCreateDevice` requests served by an inactive pooled device
+    size_t released{0}; // devices returned to the pool
+    size_t waited{0};   // requests that waited for a device of a configuration at its limit
+    size_t remote{0};   // reused devices created on another NUMA node than the requesting thread
+};
+
+/**
+ * Counters of the shots executed with early shot rejection, whose ratio is the acceptance rate
+ * of the postselected measurements.
+ */
+struct ShotRejectionStats {
+    size_t accepted{0}; // shots whose postselected measurements all succeeded
+    size_t rejected{0}; // shots stopped at a failed postselected measurement
+};
+
 class ExecutionContext final {
   private:
+    // Runtime tracer, if enabled by the environment. It is declared first so that the devices that
+    // record into it are destroyed before it.
+    std::unique_ptr<Tracer> tracer;
+
     // Device pool
     std::vector<std::shared_ptr<RTDevice>> device_pool;
-    std::mutex pool_mu; // To protect device_pool
+    // To protect device_pool, inactive_devices, device_indices, pool_stats and num_devices
+    std::mutex pool_mu;
+
+    // Free lists of inactive devices (indices into device_pool), by device key. Devices are
+    // reused last-in first-out so that the most recently released, warmest instance is picked.
+    std::unordered_map<std::string, std::vector<size_t>> inactive_devices;
+    std::unordered_map<const RTDevice *, size_t> device_indices;
+    DevicePoolStats pool_stats;
+
+    // Maximum number of device instances per device key (0 for no limit). Requests beyond the
+    // limit wait until another thread releases a device of the same key, which bounds the
+    // memory held by concurrently executing QNodes.
+    size_t max_devices_per_key;
+    std::unordered_map<std::string, size_t> num_devices;
+    std::condition_variable pool_cv;
 
     bool initial_tape_recorder_status{false};
 
+    // Number of operations between two state checkpoints of the recorded tape (0 for none).
+    size_t tape_checkpoint_interval{0};
+
+    // Whether the devices execute mid-circuit measurement branches as a tree, and the number of
+    // toggles of the tree, which invalidate the state snapshots of the previous shots.
+    bool measurement_tree_status{false};
+    size_t measurement_tree_epoch{0};
+
+    // Whether the devices stop a shot at its first failed postselected measurement
+    bool shot_rejection_status{false};
+    std::atomic<size_t> accepted_shots{0};
+    std::atomic<size_t> rejected_shots{0};
+
     // ExecutionContext pointers
     std::unique_ptr<MemoryManager> memory_man_ptr{nullptr};
 
+    // Results of jobs submitted with `QuantumDevice::SubmitSample`, by job id
+    std::unordered_map<int64_t, std::future<std::vector<double>>> pending_jobs;
+    int64_t next_job_id{0};
+    std::mutex jobs_mu; // To protect pending_jobs and next_job_id
+
     // PRNG
     uint32_t *seed;
     std::mt19937 gen;
+    std::optional<PhiloxEngine> root_engine;
+
+    /**
+     * @brief Create the tracer requested by the `CATALYST_RUNTIME_TRACE` environment variable,
+     * with ring buffers of `CATALYST_RUNTIME_TRACE_EVENTS` events, or a null pointer.
+     */
+    [[nodiscard]] static auto createTracer() -> std::unique_ptr<Tracer>
+    {
+        const char *path = std::getenv("CATALYST_RUNTIME_TRACE");
+        if (path == nullptr || *path == '\0') {
+            return nullptr;
+        }
+        const size_t capacity = getEnvSize("CATALYST_RUNTIME_TRACE_EVENTS", 65536);
+        RT_FAIL_IF(capacity == 0, "The runtime trace needs room for at least one event per thread");
+        return std::make_unique<Tracer>(path, capacity);
+    }
 
   public:
-    explicit ExecutionContext(uint32_t *seed = nullptr) : seed(seed)
+    explicit ExecutionContext(uint32_t *seed = nullptr)
+        : tracer(createTracer()),
+          max_devices_per_key(AsyncExecutor::getInstance().getMaxDevicesPerKey()), seed(seed)
     {
-        memory_man_ptr = std::make_unique<MemoryManager>();
+        memory_man_ptr =
+            std::make_unique<MemoryManager>(getEnvSize("CATALYST_RUNTIME_MEMORY_LIMIT", 0));
 
         if (this->seed != nullptr) {
             this->gen = std::mt19937(*seed);
+            this->root_engine.emplace(*seed);
+        }
+    }
+
+    ~ExecutionContext()
+    {
+        if (!tracer) {
+            return;
+        }
+        try {
+            tracer->write(getMemoryReport());
+        }
+        catch (const std::exception &e) {
+            std::fprintf(stderr, "[WARNING] Unable to write the runtime trace: %s\n", e.what());
         }
     }
 
-    ~ExecutionContext() = default;
     ExecutionContext(const ExecutionContext &other) = delete;
     ExecutionContext &operator=(const ExecutionContext &other) = delete;
     ExecutionContext(ExecutionContext &&other) = delete;
@@ -310,40 +994,132 @@ class ExecutionContext final {
         return initial_tape_recorder_status;
     }
 
+    void setTapeCheckpointInterval(size_t interval) noexcept { tape_checkpoint_interval = interval; }
+
+    [[nodiscard]] auto getTapeCheckpointInterval() const -> size_t
+    {
+        return tape_checkpoint_interval;
+    }
+
+    void setMeasurementTreeStatus(bool status) noexcept
+    {
+        measurement_tree_status = status;
+        measurement_tree_epoch++;
+    }
+
+    [[nodiscard]] auto getMeasurementTreeStatus() const -> bool { return measurement_tree_status; }
+
+    [[nodiscard]] auto getMeasurementTreeEpoch() const -> size_t { return measurement_tree_epoch; }
+
+    void setShotRejectionStatus(bool status) noexcept { shot_rejection_status = status; }
+
+    [[nodiscard]] auto getShotRejectionStatus() const -> bool { return shot_rejection_status; }
+
+    void recordShot(bool accepted) noexcept { (accepted ? accepted_shots : rejected_shots)++; }
+
+    [[nodiscard]] auto getShotRejectionStats() const -> ShotRejectionStats
+    {
+        return {accepted_shots.load(), rejected_shots.load()};
+    }
+
     [[nodiscard]] auto getMemoryManager() const -> const std::unique_ptr<MemoryManager> &
     {
         return memory_man_ptr;
     }
 
+    /**
+     * @brief Get the peak memory of the execution and of each of its devices, as the members of
+     * a JSON object.
+     */
+    [[nodiscard]] auto getMemoryReport() -> std::string
+    {
+        std::string report = "\"peak_memory_bytes\": " +
+                             std::to_string(memory_man_ptr->getUsage().getPeak()) +
+                             ", \"device_peak_memory_bytes\": [";
+        std::lock_guard<std::mutex> lock(pool_mu);
+        for (size_t i = 0; i < device_pool.size(); i++) {
+            report += (i ? ", " : "") + std::string("{\"device\": \"") +
+                      device_pool[i]->getDeviceName() + "\", \"bytes\": " +
+                      std::to_string(device_pool[i]->getMemoryUsage().getPeak()) + "}";
+        }
+        return report + "]";
+    }
+
+    /**
+     * @brief Get the runtime tracer, or a null pointer if tracing is disabled.
+     */
+    [[nodiscard]] auto getTracer() const -> Tracer * { return tracer.get(); }
+
+    /**
+     * @brief Get the random stream `id` derived from the program seed.
+     *
+     * @return The stream, or an empty optional for unseeded executions.
+     */
+    [[nodiscard]] auto getPRNGStream(uint64_t id) const -> std::optional<PhiloxEngine>
+    {
+        if (!root_engine) {
+            return std::nullopt;
+        }
+        return root_engine->split(id);
+    }
+
     [[nodiscard]] auto getOrCreateDevice(std::string_view rtd_lib, std::string_view rtd_name,
                                          std::string_view rtd_kwargs, bool auto_qubit_management)
         -> const std::shared_ptr<RTDevice> &
     {
-        std::lock_guard<std::mutex> lock(pool_mu);
+        std::unique_lock<std::mutex> lock(pool_mu);
+
+        const std::string device_key =
+            RTDevice::getDeviceKey(rtd_lib, rtd_name, rtd_kwargs, auto_qubit_management);
+        auto &free_list = inactive_devices[device_key];
+        auto has_capacity = [&]() {
+            return !max_devices_per_key || num_devices[device_key] < max_devices_per_key;
+        };
+        if (free_list.empty() && !has_capacity()) {
+            pool_stats.waited++;
+            pool_cv.wait(lock, [&]() { return !free_list.empty() || has_capacity(); });
+        }
+        // Prefer the warmest device created on the NUMA node of the calling thread, whose memory
+        // is local to it
+        const int numa_node = NumaTopology::getInstance().getCurrentNode();
+        if (!free_list.empty()) {
+            auto local = std::find_if(free_list.rbegin(), free_list.rend(), [&](size_t idx) {
+                return device_pool[idx]->getNumaNode() == numa_node;
+            });
+            if (local == free_list.rend()) {
+                local = free_list.rbegin();
+                pool_stats.remote++;
+            }
+            const size_t idx = *local;
+            free_list.erase(std::next(local).base());
+            device_pool[idx]->setDeviceStatus(RTDeviceStatus::Active);
+            pool_stats.reused++;
+            return device_pool[idx];
+        }
 
         auto device =
             std::make_shared<RTDevice>(rtd_lib, rtd_name, rtd_kwargs, auto_qubit_management);
-
         const size_t key = device_pool.size();
-        for (size_t i = 0; i < key; i++) {
-            if (device_pool[i]->getDeviceStatus() == RTDeviceStatus::Inactive &&
-                *device_pool[i] == *device) {
-                device_pool[i]->setDeviceStatus(RTDeviceStatus::Active);
-                return device_pool[i];
-            }
-        }
 
         RT_ASSERT(device->getQuantumDevicePtr());
+        if (tracer) {
+            device->traceQuantumDevice(*tracer);
+        }
 
         // Add a new device
         device->setDeviceStatus(RTDeviceStatus::Active);
+        device->setNumaNode(numa_node);
         if (this->seed != nullptr) {
             device->getQuantumDevicePtr()->SetDevicePRNG(&(this->gen));
+            device->getQuantumDevicePtr()->SetDeviceStreamPRNG(this->root_engine->split(key));
         }
         else {
             device->getQuantumDevicePtr()->SetDevicePRNG(nullptr);
         }
+        device_indices.emplace(device.get(), key);
         device_pool.push_back(device);
+        num_devices[device_key]++;
+        pool_stats.created++;
 
         return device_pool[key];
     }
@@ -367,7 +1143,58 @@ class ExecutionContext final {
     void deactivateDevice(RTDevice *RTD_PTR)
     {
         std::lock_guard<std::mutex> lock(pool_mu);
+        if (RTD_PTR->getDeviceStatus() == RTDeviceStatus::Inactive) {
+            return;
+        }
         RTD_PTR->setDeviceStatus(RTDeviceStatus::Inactive);
+
+        auto idx = device_indices.find(RTD_PTR);
+        RT_FAIL_IF(idx == device_indices.end(), "Cannot release a device outside the device pool");
+        inactive_devices[RTD_PTR->getDeviceKey()].push_back(idx->second);
+        pool_stats.released++;
+        pool_cv.notify_all();
+    }
+
+    /**
+     * @brief Keep the pending result of a submitted job until it is awaited.
+     *
+     * @return The id of the job.
+     */
+    [[nodiscard]] auto addPendingJob(std::future<std::vector<double>> &&result) -> int64_t
+    {
+        std::lock_guard<std::mutex> lock(jobs_mu);
+        const int64_t job = next_job_id++;
+        pending_jobs.emplace(job, std::move(result));
+        return job;
+    }
+
+    /**
+     * @brief Take the pending result of the job `job`, which can only be awaited once.
+     */
+    [[nodiscard]] auto takePendingJob(int64_t job) -> std::future<std::vector<double>>
+    {
+        std::lock_guard<std::mutex> lock(jobs_mu);
+        auto it = pending_jobs.find(job);
+        RT_FAIL_IF(it == pending_jobs.end(), "Invalid or already awaited job id");
+        auto result = std::move(it->second);
+        pending_jobs.erase(it);
+        return result;
+    }
+
+    /**
+     * @brief Limit the number of device instances per device key (0 for no limit).
+     */
+    void setMaxDevicesPerKey(size_t max_devices)
+    {
+        std::lock_guard<std::mutex> lock(pool_mu);
+        max_devices_per_key = max_devices;
+        pool_cv.notify_all();
+    }
+
+    [[nodiscard]] auto getDevicePoolStats() -> DevicePoolStats
+    {
+        std::lock_guard<std::mutex> lock(pool_mu);
+        return pool_stats;
     }
 };
 } // namespace Catalyst::Runtime
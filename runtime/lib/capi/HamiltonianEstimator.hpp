@@ -0,0 +1,259 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+#include "Types.h"
+
+namespace Catalyst::Runtime {
+
+/**
+ * The Pauli operators of a Pauli word on each of its qubits, sorted by qubit, without the
+ * identities.
+ */
+using PauliWord = std::vector<std::pair<QubitIdType, ObsId>>;
+
+/**
+ * The runtime estimator of the expectation values of Pauli sums, for the devices that can sample
+ * but cannot compute these expectation values themselves.
+ *
+ * The Pauli words and sums of Pauli words that the program constructs are recorded under the
+ * keys of the device observables, or under negative keys of the runtime if the device does not
+ * support them. The terms of a sum are grouped into qubit-wise commuting groups, i.e. terms that
+ * act with the same Pauli operator on each of their shared qubits. All terms of a group are
+ * diagonal in the same basis, so that their expectation values are computed from the samples of
+ * a single sampling pass in that basis, instead of one pass per term.
+ */
+class HamiltonianEstimator final {
+  private:
+    struct PauliSum {
+        std::vector<double> coeffs;
+        std::vector<PauliWord> words;
+    };
+
+    std::unordered_map<ObsIdType, PauliWord> words;
+    std::unordered_map<ObsIdType, PauliSum> sums;
+    ObsIdType next_runtime_key{-1};
+
+    /**
+     * @brief Multiply the group `basis` by `word`, if they act with the same Pauli operator on
+     * each of their shared qubits.
+     */
+    static auto mergeBasis(PauliWord &basis, const PauliWord &word) -> bool
+    {
+        PauliWord merged;
+        merged.reserve(basis.size() + word.size());
+        auto lhs = basis.begin();
+        auto rhs = word.begin();
+        while (lhs != basis.end() || rhs != word.end()) {
+            if (rhs == word.end() || (lhs != basis.end() && lhs->first < rhs->first)) {
+                merged.push_back(*lhs++);
+            }
+            else if (lhs == basis.end() || rhs->first < lhs->first) {
+                merged.push_back(*rhs++);
+            }
+            else if (lhs->second == rhs->second) {
+                merged.push_back(*lhs++);
+                rhs++;
+            }
+            else {
+                return false;
+            }
+        }
+        basis = std::move(merged);
+        return true;
+    }
+
+    /**
+     * @brief Get the eigenvalue of `word` at each shot of `samples`, which are measured on the
+     * qubits of `basis`.
+     */
+    static auto getEigenvalues(const PauliWord &basis, const std::vector<double> &samples,
+                               const PauliWord &word) -> std::vector<double>
+    {
+        std::vector<size_t> columns;
+        for (const auto &[qubit, pauli] : word) {
+            auto it = std::partition_point(basis.begin(), basis.end(),
+                                           [&](const auto &entry) { return entry.first < qubit; });
+            columns.push_back(static_cast<size_t>(it - basis.begin()));
+        }
+
+        std::vector<double> eigenvalues(samples.size() / basis.size());
+        for (size_t shot = 0; shot < eigenvalues.size(); shot++) {
+            bool parity = false;
+            for (size_t column : columns) {
+                parity ^= samples[shot * basis.size() + column] != 0;
+            }
+            eigenvalues[shot] = parity ? -1 : 1;
+        }
+        return eigenvalues;
+    }
+
+  public:
+    [[nodiscard]] static auto isPauli(ObsId id) -> bool
+    {
+        return id == ObsId::Identity || id == ObsId::PauliX || id == ObsId::PauliY ||
+               id == ObsId::PauliZ;
+    }
+
+    /**
+     * @brief Forget all recorded observables, whose keys are only valid in one execution.
+     */
+    void reset() noexcept
+    {
+        words.clear();
+        sums.clear();
+        next_runtime_key = -1;
+    }
+
+    /**
+     * @brief Get a new key for an observable that the device does not support.
+     */
+    [[nodiscard]] auto createRuntimeKey() -> ObsIdType { return next_runtime_key--; }
+
+    [[nodiscard]] static auto isRuntimeKey(ObsIdType key) -> bool { return key < 0; }
+
+    [[nodiscard]] auto isPauliWord(ObsIdType key) const -> bool { return words.contains(key); }
+
+    [[nodiscard]] auto isPauliSum(ObsIdType key) const -> bool { return sums.contains(key); }
+
+    [[nodiscard]] auto arePauliWords(std::span<const ObsIdType> keys) const -> bool
+    {
+        return std::all_of(keys.begin(), keys.end(),
+                           [this](ObsIdType key) { return isPauliWord(key); });
+    }
+
+    /**
+     * @brief Record the Pauli operator `id` on `qubit` under `key`.
+     */
+    void recordNamed(ObsIdType key, ObsId id, QubitIdType qubit)
+    {
+        RT_FAIL_IF(!isPauli(id), "Invalid Pauli operator for the Hamiltonian estimator");
+        words[key] = id == ObsId::Identity ? PauliWord{} : PauliWord{{qubit, id}};
+    }
+
+    /**
+     * @brief Record the tensor product of the Pauli words `keys` under `key`, if they act on
+     * disjoint qubits.
+     *
+     * @return Whether the product is a Pauli word.
+     */
+    auto recordTensor(ObsIdType key, std::span<const ObsIdType> keys) -> bool
+    {
+        PauliWord product;
+        for (ObsIdType operand : keys) {
+            const PauliWord &word = words.at(operand);
+            product.insert(product.end(), word.begin(), word.end());
+        }
+        std::sort(product.begin(), product.end());
+        auto same_qubit = [](const auto &lhs, const auto &rhs) { return lhs.first == rhs.first; };
+        if (std::adjacent_find(product.begin(), product.end(), same_qubit) != product.end()) {
+            return false;
+        }
+        words[key] = std::move(product);
+        return true;
+    }
+
+    /**
+     * @brief Record the sum of the Pauli words `keys` with coefficients `coeffs` under `key`.
+     */
+    void recordSum(ObsIdType key, std::span<const double> coeffs, std::span<const ObsIdType> keys)
+    {
+        PauliSum sum{std::vector<double>(coeffs.begin(), coeffs.end()), {}};
+        sum.words.reserve(keys.size());
+        for (ObsIdType operand : keys) {
+            sum.words.push_back(words.at(operand));
+        }
+        sums[key] = std::move(sum);
+    }
+
+    /**
+     * @brief Estimate the expectation value, or the variance, of the Pauli word or sum `key`.
+     *
+     * The variance is only computed for sums of a single qubit-wise commuting group, whose value
+     * is known at each shot.
+     *
+     * @param sample A function that returns the samples, of shape (shots, qubits), of the qubits
+     * of a Pauli word after rotating them to the eigenbasis of its Pauli operators.
+     */
+    template <typename SampleFn>
+    auto estimate(ObsIdType key, SampleFn &&sample, bool variance = false) -> double
+    {
+        PauliSum sum;
+        if (auto it = sums.find(key); it != sums.end()) {
+            sum = it->second;
+        }
+        else {
+            sum = PauliSum{{1.0}, {words.at(key)}};
+        }
+
+        // Greedily assign each term to the first group it commutes with qubit-wise
+        std::vector<PauliWord> bases;
+        std::vector<std::vector<size_t>> groups;
+        for (size_t term = 0; term < sum.words.size(); term++) {
+            if (sum.words[term].empty()) {
+                continue;
+            }
+            size_t group = 0;
+            while (group < bases.size() && !mergeBasis(bases[group], sum.words[term])) {
+                group++;
+            }
+            if (group == bases.size()) {
+                bases.push_back(sum.words[term]);
+                groups.emplace_back();
+            }
+            groups[group].push_back(term);
+        }
+
+        RT_FAIL_IF(variance && groups.size() > 1,
+                   "The variance of a sum of non-commuting Pauli words is not supported");
+
+        double expval = 0;
+        for (size_t term = 0; term < sum.words.size(); term++) {
+            expval += sum.words[term].empty() ? sum.coeffs[term] : 0;
+        }
+        double var = 0;
+        for (size_t group = 0; group < groups.size(); group++) {
+            const std::vector<double> samples = sample(bases[group]);
+            std::vector<double> values(samples.size() / bases[group].size(), 0);
+            for (size_t term : groups[group]) {
+                const auto eigenvalues = getEigenvalues(bases[group], samples, sum.words[term]);
+                for (size_t shot = 0; shot < values.size(); shot++) {
+                    values[shot] += sum.coeffs[term] * eigenvalues[shot];
+                }
+            }
+
+            double total = 0;
+            double total_squares = 0;
+            for (double value : values) {
+                total += value;
+                total_squares += value * value;
+            }
+            const double mean = total / static_cast<double>(values.size());
+            expval += mean;
+            var += total_squares / static_cast<double>(values.size()) - mean * mean;
+        }
+        return variance ? var : expval;
+    }
+};
+
+} // namespace Catalyst::Runtime
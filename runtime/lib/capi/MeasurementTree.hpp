@@ -0,0 +1,693 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "QuantumDevice.hpp"
+
+namespace Catalyst::Runtime {
+
+/**
+ * A device decorator that executes the mid-circuit measurement branches of repeated one-shot
+ * executions as a tree, instead of replaying every shot from the start.
+ *
+ * The gates of a shot are not applied right away, but recorded into a pending segment, and
+ * appended to the execution prefix, i.e. all the gates and measurement outcomes since the qubits
+ * were allocated. The prefix refers to qubits by their position in the device state rather than
+ * by their ID, since devices do not reuse the IDs of released qubits across shots. Before a
+ * measurement or a measurement process reads the state, the state at the end of the prefix is
+ * restored from a snapshot if another shot already reached it, and the pending segment is
+ * skipped. Otherwise the segment is applied and the resulting state is stored as a new snapshot.
+ * Snapshots are looked up by the hash of the prefix, and compared against the whole prefix. The
+ * measurements themselves are still sampled by the device on every shot, from the restored
+ * state, so that the branches are taken with their probabilities.
+ *
+ * Each distinct prefix is thus simulated once, and the cost of a shot on an explored branch is
+ * one state restore per measurement. Operations that cannot be recorded, e.g. operations on
+ * views of caller memory, are applied directly and stop the tree for the rest of the shot.
+ */
+class MeasurementTreeDevice final : public QuantumDevice {
+  private:
+    // Bound on the total number of amplitudes of all snapshots, i.e. 1 GiB of state
+    static constexpr size_t max_snapshot_amplitudes = 1UL << 26;
+
+    // The kinds of events of a prefix
+    enum class Event : uint64_t {
+        Allocate,
+        Release,
+        NamedOperation,
+        GateOperation,
+        PackedPauliRot,
+        ApplyOperations,
+        MatrixOperation,
+        Measure,
+    };
+
+    /**
+     * The gates and measurement outcomes of a shot, encoded as words, and the hash of the words.
+     */
+    struct Prefix {
+        std::vector<uint64_t> words;
+        uint64_t hash{0};
+
+        auto operator==(const Prefix &other) const -> bool { return words == other.words; }
+    };
+
+    struct PrefixHash {
+        auto operator()(const Prefix &prefix) const -> size_t { return prefix.hash; }
+    };
+
+    std::unique_ptr<QuantumDevice> device;
+    bool enabled{false};
+    size_t epoch{0};
+
+    // The recorded operations that are not applied to the device yet
+    std::vector<std::function<void(QuantumDevice &)>> pending;
+    // The gates and measurement outcomes of the shot so far
+    Prefix prefix;
+    // Whether all the operations of the shot so far were recorded
+    bool tracked{true};
+    // The allocated qubits, in the order of the device state
+    std::vector<QubitIdType> qubits;
+
+    std::unordered_map<Prefix, std::vector<std::complex<double>>, PrefixHash> snapshots;
+    size_t snapshot_amplitudes{0};
+
+    [[nodiscard]] auto tracking() const -> bool { return enabled && tracked; }
+
+    void append(uint64_t word)
+    {
+        prefix.words.push_back(word);
+        prefix.hash ^= word + 0x9e3779b97f4a7c15ULL + (prefix.hash << 6) + (prefix.hash >> 2);
+    }
+
+    void append(Event event) { append(static_cast<uint64_t>(event)); }
+
+    void append(double value) { append(std::bit_cast<uint64_t>(value)); }
+
+    void append(std::string_view value)
+    {
+        append(static_cast<uint64_t>(value.size()));
+        for (size_t i = 0; i < value.size(); i += sizeof(uint64_t)) {
+            uint64_t word = 0;
+            for (size_t j = i; j < std::min(i + sizeof(uint64_t), value.size()); j++) {
+                word = (word << 8) | static_cast<uint8_t>(value[j]);
+            }
+            append(word);
+        }
+    }
+
+    template <typename T> void append(std::span<const T> values)
+    {
+        append(static_cast<uint64_t>(values.size()));
+        for (const T &value : values) {
+            if constexpr (std::is_same_v<T, double>) {
+                append(value);
+            }
+            else if constexpr (std::is_same_v<T, std::string>) {
+                append(std::string_view{value});
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>) {
+                append(value.real());
+                append(value.imag());
+            }
+            else {
+                append(static_cast<uint64_t>(value));
+            }
+        }
+    }
+
+    void append(const std::vector<bool> &values)
+    {
+        append(static_cast<uint64_t>(values.size()));
+        for (bool value : values) {
+            append(static_cast<uint64_t>(value));
+        }
+    }
+
+    /**
+     * @brief Append the positions of the qubits `wires` in the device state.
+     */
+    void appendWires(std::span<const QubitIdType> wires)
+    {
+        append(static_cast<uint64_t>(wires.size()));
+        for (QubitIdType wire : wires) {
+            append(static_cast<uint64_t>(
+                std::distance(qubits.begin(), std::find(qubits.begin(), qubits.end(), wire))));
+        }
+    }
+
+    void flush()
+    {
+        for (const auto &operation : pending) {
+            operation(*device);
+        }
+        pending.clear();
+    }
+
+    /**
+     * @brief Apply an operation that cannot be recorded, after which the shot leaves the tree.
+     */
+    template <typename Fn> auto untracked(Fn &&operation)
+    {
+        flush();
+        tracked = false;
+        return operation();
+    }
+
+    /**
+     * @brief Bring the device to the state at the end of the prefix, from a snapshot if there is
+     * one, or by applying the pending operations and storing a snapshot.
+     */
+    void sync()
+    {
+        if (pending.empty()) {
+            return;
+        }
+        if (auto it = snapshots.find(prefix); it != snapshots.end()) {
+            pending.clear();
+            DataView<std::complex<double>, 1> view(it->second);
+            device->SetState(view, qubits);
+            return;
+        }
+
+        flush();
+        const size_t num_amplitudes = 1UL << device->GetNumQubits();
+        if (snapshot_amplitudes + num_amplitudes > max_snapshot_amplitudes) {
+            return;
+        }
+        std::vector<std::complex<double>> state(num_amplitudes);
+        DataView<std::complex<double>, 1> view(state);
+        device->State(view);
+        snapshots.emplace(prefix, std::move(state));
+        snapshot_amplitudes += num_amplitudes;
+    }
+
+    void resetShot()
+    {
+        prefix.words.clear();
+        prefix.hash = 0;
+        tracked = true;
+    }
+
+  public:
+    explicit MeasurementTreeDevice(std::unique_ptr<QuantumDevice> device)
+        : device(std::move(device))
+    {
+    }
+
+    /**
+     * @brief Enable or disable the tree. The snapshots are only valid within an `epoch`, i.e.
+     * between two toggles of the tree, which delimit the shots of one execution.
+     */
+    void setEnabled(bool _enabled, size_t _epoch)
+    {
+        flush();
+        if (epoch != _epoch) {
+            snapshots.clear();
+            snapshot_amplitudes = 0;
+            epoch = _epoch;
+        }
+        enabled = _enabled;
+        resetShot();
+    }
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> override
+    {
+        flush();
+        auto ids = device->AllocateQubits(num_qubits);
+        qubits.insert(qubits.end(), ids.begin(), ids.end());
+        if (tracking()) {
+            append(Event::Allocate);
+            append(static_cast<uint64_t>(ids.size()));
+        }
+        return ids;
+    }
+
+    void AllocateQubitsInPlace(std::span<QubitIdType> ids) override
+    {
+        flush();
+        device->AllocateQubitsInPlace(ids);
+        qubits.insert(qubits.end(), ids.begin(), ids.end());
+        if (tracking()) {
+            append(Event::Allocate);
+            append(static_cast<uint64_t>(ids.size()));
+        }
+    }
+
+    void ReleaseQubits(const std::vector<QubitIdType> &released) override
+    {
+        flush();
+        device->ReleaseQubits(released);
+        if (tracking()) {
+            append(Event::Release);
+            appendWires(released);
+        }
+        std::erase_if(qubits, [&](QubitIdType id) {
+            return std::find(released.begin(), released.end(), id) != released.end();
+        });
+        if (qubits.empty()) {
+            resetShot();
+        }
+    }
+
+    auto GetNumQubits() const -> size_t override { return device->GetNumQubits(); }
+
+    auto AllocateQubit() -> QubitIdType override
+    {
+        flush();
+        QubitIdType id = device->AllocateQubit();
+        qubits.push_back(id);
+        if (tracking()) {
+            append(Event::Allocate);
+            append(static_cast<uint64_t>(1));
+        }
+        return id;
+    }
+
+    void ReleaseQubit(QubitIdType qubit) override
+    {
+        flush();
+        device->ReleaseQubit(qubit);
+        if (tracking()) {
+            append(Event::Release);
+            appendWires(std::span<const QubitIdType>(&qubit, 1));
+        }
+        std::erase(qubits, qubit);
+        if (qubits.empty()) {
+            resetShot();
+        }
+    }
+
+    void SetDeviceShots(size_t shots) override { device->SetDeviceShots(shots); }
+
+    auto GetDeviceShots() const -> size_t override { return device->GetDeviceShots(); }
+
+    void SetDevicePRNG(std::mt19937 *gen) override { device->SetDevicePRNG(gen); }
+
+    void SetDeviceStreamPRNG(const PhiloxEngine &engine) override
+    {
+        device->SetDeviceStreamPRNG(engine);
+    }
+
+    void NamedOperation(const std::string &name, const std::vector<double> &params,
+                        const std::vector<QubitIdType> &wires, bool inverse,
+                        const std::vector<QubitIdType> &controlled_wires,
+                        const std::vector<bool> &controlled_values,
+                        const std::vector<std::string> &optional_params) override
+    {
+        if (!tracking()) {
+            device->NamedOperation(name, params, wires, inverse, controlled_wires,
+                                   controlled_values, optional_params);
+            return;
+        }
+
+        append(Event::NamedOperation);
+        append(std::string_view{name});
+        append(std::span<const double>(params));
+        appendWires(wires);
+        append(static_cast<uint64_t>(inverse));
+        appendWires(controlled_wires);
+        append(controlled_values);
+        append(std::span<const std::string>(optional_params));
+        pending.push_back([=](QuantumDevice &target) {
+            target.NamedOperation(name, params, wires, inverse, controlled_wires,
+                                  controlled_values, optional_params);
+        });
+    }
+
+    void GateOperation(GateId id, std::span<const double> params,
+                       std::span<const QubitIdType> wires, bool inverse,
+                       std::span<const QubitIdType> controlled_wires,
+                       std::span<const bool> controlled_values) override
+    {
+        if (!tracking()) {
+            device->GateOperation(id, params, wires, inverse, controlled_wires, controlled_values);
+            return;
+        }
+
+        append(Event::GateOperation);
+        append(static_cast<uint64_t>(id));
+        append(params);
+        appendWires(wires);
+        append(static_cast<uint64_t>(inverse));
+        appendWires(controlled_wires);
+        append(controlled_values);
+
+        // Copy the operands, whose storage is only valid during this call
+        auto values = std::make_shared<bool[]>(controlled_values.size());
+        std::copy(controlled_values.begin(), controlled_values.end(), values.get());
+        pending.push_back([id, params = std::vector<double>(params.begin(), params.end()),
+                           wires = std::vector<QubitIdType>(wires.begin(), wires.end()), inverse,
+                           controlled_wires = std::vector<QubitIdType>(controlled_wires.begin(),
+                                                                       controlled_wires.end()),
+                           values, num_values = controlled_values.size()](QuantumDevice &target) {
+            target.GateOperation(id, params, wires, inverse, controlled_wires,
+                                 std::span<const bool>(values.get(), num_values));
+        });
+    }
+
+    void PackedPauliRot(std::span<const uint64_t> pauli_masks, double theta,
+                        std::span<const QubitIdType> wires, bool inverse,
+                        std::span<const QubitIdType> controlled_wires,
+                        std::span<const bool> controlled_values) override
+    {
+        if (!tracking()) {
+            device->PackedPauliRot(pauli_masks, theta, wires, inverse, controlled_wires,
+                                   controlled_values);
+            return;
+        }
+
+        append(Event::PackedPauliRot);
+        append(pauli_masks);
+        append(theta);
+        appendWires(wires);
+        append(static_cast<uint64_t>(inverse));
+        appendWires(controlled_wires);
+        append(controlled_values);
+
+        // Copy the operands, whose storage is only valid during this call
+        auto values = std::make_shared<bool[]>(controlled_values.size());
+        std::copy(controlled_values.begin(), controlled_values.end(), values.get());
+        pending.push_back([masks = std::vector<uint64_t>(pauli_masks.begin(), pauli_masks.end()),
+                           theta, wires = std::vector<QubitIdType>(wires.begin(), wires.end()),
+                           inverse,
+                           controlled_wires = std::vector<QubitIdType>(controlled_wires.begin(),
+                                                                       controlled_wires.end()),
+                           values, num_values = controlled_values.size()](QuantumDevice &target) {
+            target.PackedPauliRot(masks, theta, wires, inverse, controlled_wires,
+                                  std::span<const bool>(values.get(), num_values));
+        });
+    }
+
+    void ApplyOperations(std::span<const BatchedGate> gates, std::span<const double> params,
+                         std::span<const QubitIdType> wires) override
+    {
+        if (!tracking()) {
+            device->ApplyOperations(gates, params, wires);
+            return;
+        }
+
+        append(Event::ApplyOperations);
+        append(static_cast<uint64_t>(gates.size()));
+        for (const BatchedGate &gate : gates) {
+            append(static_cast<uint64_t>(gate.opcode));
+            append(static_cast<uint64_t>(gate.adjoint));
+            append(static_cast<uint64_t>(gate.num_params));
+            append(static_cast<uint64_t>(gate.num_wires));
+        }
+        append(params);
+        appendWires(wires);
+        pending.push_back([gates = std::vector<BatchedGate>(gates.begin(), gates.end()),
+                           params = std::vector<double>(params.begin(), params.end()),
+                           wires = std::vector<QubitIdType>(wires.begin(), wires.end())](
+                              QuantumDevice &target) {
+            target.ApplyOperations(gates, params, wires);
+        });
+    }
+
+    auto Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result override
+    {
+        if (!tracking()) {
+            return device->Measure(wire, postselect);
+        }
+
+        sync();
+        Result result = device->Measure(wire, postselect);
+        append(Event::Measure);
+        appendWires(std::span<const QubitIdType>(&wire, 1));
+        append(static_cast<uint64_t>(*result));
+        return result;
+    }
+
+    void MeasureBatch(std::span<const QubitIdType> wires,
+                      std::span<const std::optional<int32_t>> postselects,
+                      std::span<Result> results) override
+    {
+        if (!tracking()) {
+            device->MeasureBatch(wires, postselects, results);
+            return;
+        }
+        // Record each measurement so that the batch still extends the measured prefix
+        for (size_t i = 0; i < wires.size(); i++) {
+            results[i] = Measure(wires[i], postselects[i]);
+        }
+    }
+
+    void MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                         const std::vector<QubitIdType> &wires, bool inverse,
+                         const std::vector<QubitIdType> &controlled_wires,
+                         const std::vector<bool> &controlled_values) override
+    {
+        if (!tracking()) {
+            device->MatrixOperation(matrix, wires, inverse, controlled_wires, controlled_values);
+            return;
+        }
+
+        append(Event::MatrixOperation);
+        append(std::span<const std::complex<double>>(matrix));
+        appendWires(wires);
+        append(static_cast<uint64_t>(inverse));
+        appendWires(controlled_wires);
+        append(controlled_values);
+        pending.push_back([=](QuantumDevice &target) {
+            target.MatrixOperation(matrix, wires, inverse, controlled_wires, controlled_values);
+        });
+    }
+
+    void MatrixOperationView(DataView<std::complex<double>, 2> &matrix,
+                             std::span<const QubitIdType> wires, bool inverse,
+                             std::span<const QubitIdType> controlled_wires,
+                             std::span<const bool> controlled_values) override
+    {
+        untracked([&]() {
+            device->MatrixOperationView(matrix, wires, inverse, controlled_wires,
+                                        controlled_values);
+        });
+    }
+
+    void SetBasisState(DataView<int8_t, 1> &n, std::vector<QubitIdType> &wires) override
+    {
+        untracked([&]() { device->SetBasisState(n, wires); });
+    }
+
+    void SetState(DataView<std::complex<double>, 1> &state,
+                  std::vector<QubitIdType> &wires) override
+    {
+        untracked([&]() { device->SetState(state, wires); });
+    }
+
+    void SetBasisStateIndex(uint64_t index, std::vector<QubitIdType> &wires) override
+    {
+        untracked([&]() { device->SetBasisStateIndex(index, wires); });
+    }
+
+    void SetSparseState(std::span<const int64_t> indices,
+                        std::span<const std::complex<double>> amplitudes,
+                        std::vector<QubitIdType> &wires) override
+    {
+        untracked([&]() { device->SetSparseState(indices, amplitudes, wires); });
+    }
+
+    auto Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
+                    const std::vector<QubitIdType> &wires) -> ObsIdType override
+    {
+        return device->Observable(id, matrix, wires);
+    }
+
+    auto HermitianObservableView(DataView<std::complex<double>, 2> &matrix,
+                                 std::span<const QubitIdType> wires) -> ObsIdType override
+    {
+        return device->HermitianObservableView(matrix, wires);
+    }
+
+    auto TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType override
+    {
+        return device->TensorObservable(obs);
+    }
+
+    auto HamiltonianObservable(const std::vector<double> &coeffs, const std::vector<ObsIdType> &obs)
+        -> ObsIdType override
+    {
+        return device->HamiltonianObservable(coeffs, obs);
+    }
+
+    auto NamedObservableView(ObsId id, std::span<const QubitIdType> wires) -> ObsIdType override
+    {
+        return device->NamedObservableView(id, wires);
+    }
+
+    auto TensorObservableView(std::span<const ObsIdType> obs) -> ObsIdType override
+    {
+        return device->TensorObservableView(obs);
+    }
+
+    auto HamiltonianObservableView(std::span<const double> coeffs, std::span<const ObsIdType> obs)
+        -> ObsIdType override
+    {
+        return device->HamiltonianObservableView(coeffs, obs);
+    }
+
+    void Sample(DataView<double, 2> &samples) override
+    {
+        sync();
+        device->Sample(samples);
+    }
+
+    void PartialSample(DataView<double, 2> &samples, const std::vector<QubitIdType> &wires) override
+    {
+        sync();
+        device->PartialSample(samples, wires);
+    }
+
+    void SampleChunked(const std::vector<QubitIdType> &wires, size_t chunk_shots,
+                       const std::function<void(DataView<double, 2> &, size_t)> &callback) override
+    {
+        sync();
+        device->SampleChunked(wires, chunk_shots, callback);
+    }
+
+    void PackedSample(DataView<uint64_t, 2> &samples,
+                      const std::vector<QubitIdType> &wires) override
+    {
+        sync();
+        device->PackedSample(samples, wires);
+    }
+
+    auto SubmitSample(const std::vector<QubitIdType> &wires)
+        -> std::future<std::vector<double>> override
+    {
+        sync();
+        return device->SubmitSample(wires);
+    }
+
+    void Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts) override
+    {
+        sync();
+        device->Counts(eigvals, counts);
+    }
+
+    void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                       const std::vector<QubitIdType> &wires) override
+    {
+        sync();
+        device->PartialCounts(eigvals, counts, wires);
+    }
+
+    void Probs(DataView<double, 1> &probs) override
+    {
+        sync();
+        device->Probs(probs);
+    }
+
+    void PartialProbs(DataView<double, 1> &probs, const std::vector<QubitIdType> &wires) override
+    {
+        sync();
+        device->PartialProbs(probs, wires);
+    }
+
+    auto Expval(ObsIdType obsKey) -> double override
+    {
+        sync();
+        return device->Expval(obsKey);
+    }
+
+    auto Var(ObsIdType obsKey) -> double override
+    {
+        sync();
+        return device->Var(obsKey);
+    }
+
+    auto ExpvalVar(ObsIdType obsKey) -> std::pair<double, double> override
+    {
+        sync();
+        return device->ExpvalVar(obsKey);
+    }
+
+    void Expvals(std::span<const ObsIdType> obsKeys, std::span<double> expvals) override
+    {
+        sync();
+        device->Expvals(obsKeys, expvals);
+    }
+
+    void State(DataView<std::complex<double>, 1> &state) override
+    {
+        sync();
+        device->State(state);
+    }
+
+    auto GetStateView() const -> std::span<const std::complex<double>> override
+    {
+        // The lent state is out of date while operations are pending, callers then fall back to
+        // `State`, which applies them
+        if (!pending.empty()) {
+            return {};
+        }
+        return device->GetStateView();
+    }
+
+    auto PauliMeasure(const std::string &pauli_word, const std::vector<QubitIdType> &wires)
+        -> Result override
+    {
+        return untracked([&]() { return device->PauliMeasure(pauli_word, wires); });
+    }
+
+    auto PackedPauliMeasure(std::span<const uint64_t> pauli_masks,
+                            const std::vector<QubitIdType> &wires) -> Result override
+    {
+        return untracked([&]() { return device->PackedPauliMeasure(pauli_masks, wires); });
+    }
+
+    void Gradient(std::vector<DataView<double, 1>> &gradients,
+                  const std::vector<size_t> &trainParams) override
+    {
+        untracked([&]() { device->Gradient(gradients, trainParams); });
+    }
+
+    void StartTapeRecording() override
+    {
+        untracked([&]() { device->StartTapeRecording(); });
+    }
+
+    void StopTapeRecording() override
+    {
+        untracked([&]() { device->StopTapeRecording(); });
+    }
+
+    void SetTapeCheckpointInterval(size_t interval) override
+    {
+        device->SetTapeCheckpointInterval(interval);
+    }
+
+    void StartBatch(size_t batch_size) override { device->StartBatch(batch_size); }
+
+    void EndBatch() override { device->EndBatch(); }
+};
+
+} // namespace Catalyst::Runtime
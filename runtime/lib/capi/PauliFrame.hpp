@@ -0,0 +1,220 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+#include "Types.h"
+
+namespace Catalyst::Runtime {
+
+/**
+ * The Clifford gates through which Pauli records are propagated. The values match the
+ * `CliffordGate` enum of the `pauli_frame` dialect.
+ */
+enum class CliffordGate : uint32_t {
+    Hadamard = 0,
+    S = 1,
+    CNOT = 2,
+};
+
+/**
+ * The Pauli frame of the active device, i.e. the Pauli record of each qubit that is tracked in
+ * software instead of being applied to the quantum state.
+ *
+ * The records are stored as two bit sets, with the X- and Z-parity bits of the qubit with ID `i`
+ * at bit `i % 64` of the words `x_words[i / 64]` and `z_words[i / 64]`. Operations on several
+ * qubits build a mask per word, so that the records of a register are updated 64 qubits at a time.
+ * Records of qubits that have never been initialized are the identity.
+ */
+class PauliFrame final {
+  private:
+    using Word = uint64_t;
+    static constexpr size_t word_bits = 64;
+
+    std::vector<Word> x_words;
+    std::vector<Word> z_words;
+
+    [[nodiscard]] static auto getWordIndex(QubitIdType qubit) -> size_t
+    {
+        RT_FAIL_IF(qubit < 0, "Invalid qubit ID for the Pauli frame");
+        return static_cast<size_t>(qubit) / word_bits;
+    }
+
+    [[nodiscard]] static auto getBitMask(QubitIdType qubit) -> Word
+    {
+        return Word{1} << (static_cast<size_t>(qubit) % word_bits);
+    }
+
+    void reserve(size_t word_idx)
+    {
+        if (word_idx >= x_words.size()) {
+            x_words.resize(word_idx + 1, 0);
+            z_words.resize(word_idx + 1, 0);
+        }
+    }
+
+    /**
+     * @brief Call `fn(word_idx, mask)` for each word holding the records of `qubits`, with the
+     * bits of these qubits set in `mask`. Consecutive qubits in the same word are merged into a
+     * single call.
+     */
+    template <typename Fn> void forEachWord(std::span<const QubitIdType> qubits, Fn &&fn)
+    {
+        size_t word_idx = 0;
+        Word mask = 0;
+        for (QubitIdType qubit : qubits) {
+            const size_t idx = getWordIndex(qubit);
+            if (mask != 0 && idx != word_idx) {
+                fn(word_idx, mask);
+                mask = 0;
+            }
+            reserve(idx);
+            word_idx = idx;
+            mask |= getBitMask(qubit);
+        }
+        if (mask != 0) {
+            fn(word_idx, mask);
+        }
+    }
+
+  public:
+    /**
+     * @brief Clear the records of all qubits.
+     */
+    void reset() noexcept
+    {
+        x_words.clear();
+        z_words.clear();
+    }
+
+    /**
+     * @brief Initialize the records of `qubits` to I.
+     */
+    void init(std::span<const QubitIdType> qubits) { set(qubits, false, false); }
+
+    /**
+     * @brief Set the records of `qubits` to the Pauli operator with the given parity bits.
+     */
+    void set(std::span<const QubitIdType> qubits, bool x, bool z)
+    {
+        forEachWord(qubits, [&](size_t idx, Word mask) {
+            x_words[idx] = x ? (x_words[idx] | mask) : (x_words[idx] & ~mask);
+            z_words[idx] = z ? (z_words[idx] | mask) : (z_words[idx] & ~mask);
+        });
+    }
+
+    /**
+     * @brief Multiply the records of `qubits` by the Pauli operator with the given parity bits.
+     */
+    void update(std::span<const QubitIdType> qubits, bool x, bool z)
+    {
+        forEachWord(qubits, [&](size_t idx, Word mask) {
+            x_words[idx] ^= x ? mask : 0;
+            z_words[idx] ^= z ? mask : 0;
+        });
+    }
+
+    /**
+     * @brief Propagate the records of `qubits` through a Hadamard gate on each of them, which
+     * exchanges X and Z.
+     */
+    void applyHadamard(std::span<const QubitIdType> qubits)
+    {
+        forEachWord(qubits, [&](size_t idx, Word mask) {
+            const Word diff = (x_words[idx] ^ z_words[idx]) & mask;
+            x_words[idx] ^= diff;
+            z_words[idx] ^= diff;
+        });
+    }
+
+    /**
+     * @brief Propagate the records of `qubits` through an S gate on each of them, which maps X to
+     * Y and leaves Z unchanged (up to a global phase).
+     */
+    void applyS(std::span<const QubitIdType> qubits)
+    {
+        forEachWord(qubits, [&](size_t idx, Word mask) { z_words[idx] ^= x_words[idx] & mask; });
+    }
+
+    /**
+     * @brief Propagate the records through a CNOT gate: X on the control spreads to the target,
+     * and Z on the target spreads to the control.
+     */
+    void applyCNOT(QubitIdType control, QubitIdType target)
+    {
+        auto [x_control, z_control] = read(control);
+        auto [x_target, z_target] = read(target);
+        set({&control, 1}, x_control, z_control ^ z_target);
+        set({&target, 1}, x_target ^ x_control, z_target);
+    }
+
+    void applyClifford(CliffordGate gate, std::span<const QubitIdType> qubits)
+    {
+        switch (gate) {
+        case CliffordGate::Hadamard:
+            applyHadamard(qubits);
+            return;
+        case CliffordGate::S:
+            applyS(qubits);
+            return;
+        case CliffordGate::CNOT:
+            RT_FAIL_IF(qubits.size() != 2, "Expected exactly two qubits for a CNOT gate");
+            applyCNOT(qubits[0], qubits[1]);
+            return;
+        }
+        RT_FAIL("Unsupported Clifford gate for the Pauli frame");
+    }
+
+    /**
+     * @brief Get the X- and Z-parity bits of the record of `qubit`.
+     */
+    [[nodiscard]] auto read(QubitIdType qubit) const -> std::pair<bool, bool>
+    {
+        const size_t idx = getWordIndex(qubit);
+        if (idx >= x_words.size()) {
+            return {false, false};
+        }
+        const Word mask = getBitMask(qubit);
+        return {(x_words[idx] & mask) != 0, (z_words[idx] & mask) != 0};
+    }
+
+    /**
+     * @brief Get the parity bits of the record of `qubit`, and reset the record to I. The caller
+     * is responsible for applying the returned Pauli operator to the quantum state.
+     */
+    auto flush(QubitIdType qubit) -> std::pair<bool, bool>
+    {
+        auto record = read(qubit);
+        init({&qubit, 1});
+        return record;
+    }
+
+    /**
+     * @brief Correct the result of a computational basis measurement of `qubit`, which is flipped
+     * when the record has an X component.
+     */
+    [[nodiscard]] auto correctMeasurement(QubitIdType qubit, bool mres) const -> bool
+    {
+        return mres != read(qubit).first;
+    }
+};
+
+} // namespace Catalyst::Runtime
@@ -0,0 +1,221 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime {
+
+/**
+ * @brief The hardware performance counters of a thread, read as a group so that all counters
+ * cover the same instructions. They are unavailable off Linux, or if the kernel does not allow
+ * the process to count its own events, e.g. with `perf_event_paranoid` above 2.
+ */
+class ThreadPerfCounters final {
+  public:
+    static constexpr size_t NumCounters = 4;
+    using Counts = std::array<uint64_t, NumCounters>;
+
+  private:
+    std::array<int, NumCounters> fds;
+
+  public:
+    ThreadPerfCounters()
+    {
+        fds.fill(-1);
+#if defined(__linux__)
+        constexpr std::array<uint64_t, NumCounters> configs = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES};
+        for (size_t i = 0; i < NumCounters; i++) {
+            perf_event_attr attr{};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = configs[i];
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, /* pid */ 0,
+                                              /* cpu */ -1, /* group_fd */ fds[0], 0));
+            if (fds[i] < 0) {
+                close();
+                return;
+            }
+        }
+#endif
+    }
+
+    ThreadPerfCounters(const ThreadPerfCounters &) = delete;
+    ThreadPerfCounters &operator=(const ThreadPerfCounters &) = delete;
+
+    ~ThreadPerfCounters() { close(); }
+
+    void close() noexcept
+    {
+#if defined(__linux__)
+        for (int &fd : fds) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            fd = -1;
+        }
+#endif
+    }
+
+    [[nodiscard]] auto isAvailable() const -> bool { return fds[0] >= 0; }
+
+    /**
+     * @brief Read the counts of the cycles, instructions, cache misses and branch misses of the
+     * thread, or zeros if the counters are unavailable.
+     */
+    [[nodiscard]] auto read() const -> Counts
+    {
+        Counts counts{};
+#if defined(__linux__)
+        struct {
+            uint64_t nr;
+            Counts values;
+        } group{};
+        if (isAvailable() && ::read(fds[0], &group, sizeof(group)) == sizeof(group)) {
+            counts = group.values;
+        }
+#endif
+        return counts;
+    }
+};
+
+/**
+ * @brief The opt-in hardware performance counters of the compiled functions, which tell whether a
+ * program spends its time in classical code or in the devices.
+ *
+ * Programs compiled with `--perf-counters=<path>` call `begin` and `end` around the body of each
+ * qnode and each entry point, and `write` at the end of each entry point. The counts of a function
+ * include those of the functions it calls, e.g. the counts of an entry point include those of its
+ * qnodes, whose counts include those of the devices. They are accumulated over all calls, on all
+ * threads, and written as a summary per function in the Chrome trace event format of the compiler
+ * telemetry.
+ */
+class PerfCounters final {
+  private:
+    struct Summary {
+        uint64_t calls{0};
+        std::chrono::steady_clock::duration time{0};
+        ThreadPerfCounters::Counts counts{};
+    };
+
+    struct Frame {
+        const char *name;
+        std::chrono::steady_clock::time_point start;
+        ThreadPerfCounters::Counts counts;
+    };
+
+    struct ThreadState {
+        ThreadPerfCounters counters;
+        std::vector<Frame> frames;
+    };
+
+    std::map<std::string, Summary> summaries;
+    bool available{false};
+    std::mutex summaries_mu; // To protect summaries and available
+
+    static auto getThreadState() -> ThreadState &
+    {
+        thread_local ThreadState state;
+        return state;
+    }
+
+  public:
+    void begin(const char *name)
+    {
+        ThreadState &state = getThreadState();
+        // The counters are read last, so as to not count the setup of the frame
+        state.frames.push_back({name, std::chrono::steady_clock::now(), {}});
+        state.frames.back().counts = state.counters.read();
+    }
+
+    void end(const char *name)
+    {
+        ThreadState &state = getThreadState();
+        const ThreadPerfCounters::Counts counts = state.counters.read();
+        const auto now = std::chrono::steady_clock::now();
+
+        // Frames that an exception skipped the end of are discarded
+        while (!state.frames.empty() && state.frames.back().name != name) {
+            state.frames.pop_back();
+        }
+        if (state.frames.empty()) {
+            return;
+        }
+        const Frame frame = state.frames.back();
+        state.frames.pop_back();
+
+        std::lock_guard<std::mutex> lock(summaries_mu);
+        available |= state.counters.isAvailable();
+        Summary &summary = summaries[name];
+        summary.calls++;
+        summary.time += now - frame.start;
+        for (size_t i = 0; i < ThreadPerfCounters::NumCounters; i++) {
+            summary.counts[i] += counts[i] - frame.counts[i];
+        }
+    }
+
+    /**
+     * @brief Write the summary of each function as a complete event, whose duration is the total
+     * time of its calls and whose arguments are its counts.
+     */
+    void write(const char *path)
+    {
+        std::ofstream os(path);
+        RT_FAIL_IF(!os.is_open(), "Unable to open the performance counters file");
+
+        std::lock_guard<std::mutex> lock(summaries_mu);
+        bool first = true;
+        char line[64];
+        os << "{\"traceEvents\": [";
+        for (const auto &[name, summary] : summaries) {
+            std::snprintf(line, sizeof(line), "\"ts\": 0, \"dur\": %.3f",
+                          std::chrono::duration<double, std::micro>(summary.time).count());
+            os << (first ? "\n" : ",\n") << "{\"name\": \"" << name
+               << "\", \"cat\": \"kernel\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, " << line
+               << ", \"args\": {\"calls\": " << summary.calls
+               << ", \"cycles\": " << summary.counts[0]
+               << ", \"instructions\": " << summary.counts[1]
+               << ", \"cache_misses\": " << summary.counts[2]
+               << ", \"branch_misses\": " << summary.counts[3] << "}}";
+            first = false;
+        }
+        os << "\n], \"displayTimeUnit\": \"ms\", \"otherData\": {\"perf_counters\": "
+           << (available ? "true" : "false") << "}}\n";
+    }
+};
+
+} // namespace Catalyst::Runtime
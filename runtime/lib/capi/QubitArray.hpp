@@ -0,0 +1,113 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <vector>
+
+#include "Types.h"
+
+namespace Catalyst::Runtime {
+
+/**
+ * The runtime representation of a qubit register, handed to compiled code as a `QirArray`.
+ *
+ * The qubit IDs are stored inline after a small header, so that a register takes a single heap
+ * allocation that devices fill in place. Registers that grow beyond their initial size, in the
+ * automatic qubit management mode, move their IDs to a separate buffer that grows geometrically.
+ * As with `std::vector`, growing invalidates the addresses of the elements but not the register.
+ */
+class QubitArray {
+  private:
+    size_t size;
+    size_t capacity;
+    QubitIdType *data;
+
+    explicit QubitArray(size_t num_qubits)
+        : size(num_qubits), capacity(num_qubits), data(getInlineData())
+    {
+    }
+    ~QubitArray()
+    {
+        if (data != getInlineData()) {
+            delete[] data;
+        }
+    }
+
+    [[nodiscard]] auto getInlineData() -> QubitIdType *
+    {
+        return reinterpret_cast<QubitIdType *>(this + 1);
+    }
+
+  public:
+    QubitArray(const QubitArray &) = delete;
+    QubitArray &operator=(const QubitArray &) = delete;
+
+    /**
+     * @brief Allocate a register of `num_qubits` uninitialized qubit IDs.
+     */
+    [[nodiscard]] static auto create(size_t num_qubits) -> QubitArray *
+    {
+        void *storage = ::operator new(sizeof(QubitArray) + num_qubits * sizeof(QubitIdType));
+        return new (storage) QubitArray(num_qubits);
+    }
+
+    static void destroy(QubitArray *array)
+    {
+        array->~QubitArray();
+        ::operator delete(array);
+    }
+
+    [[nodiscard]] static auto fromQirArray(QirArray *array) -> QubitArray *
+    {
+        return reinterpret_cast<QubitArray *>(array);
+    }
+    [[nodiscard]] auto toQirArray() -> QirArray * { return reinterpret_cast<QirArray *>(this); }
+
+    [[nodiscard]] auto getSize() const -> size_t { return size; }
+    [[nodiscard]] auto getData() -> QubitIdType * { return data; }
+    [[nodiscard]] auto getIds() -> std::span<QubitIdType> { return {data, size}; }
+    [[nodiscard]] auto toVector() const -> std::vector<QubitIdType>
+    {
+        return std::vector<QubitIdType>(data, data + size);
+    }
+
+    /**
+     * @brief Append `num_qubits` uninitialized IDs to the register.
+     *
+     * @return The new IDs, to be filled by the caller.
+     */
+    auto grow(size_t num_qubits) -> std::span<QubitIdType>
+    {
+        if (size + num_qubits > capacity) {
+            const size_t new_capacity = std::max(size + num_qubits, 2 * capacity);
+            auto *new_data = new QubitIdType[new_capacity];
+            std::copy(data, data + size, new_data);
+            if (data != getInlineData()) {
+                delete[] data;
+            }
+            data = new_data;
+            capacity = new_capacity;
+        }
+
+        size += num_qubits;
+        return {data + size - num_qubits, num_qubits};
+    }
+};
+
+} // namespace Catalyst::Runtime
@@ -14,19 +14,25 @@
 
 #include "RuntimeCAPI.h"
 
+#include <algorithm>
+#include <array>
 #include <cstdarg>
 #include <cstdlib>
 #include <ctime>
 #include <memory>
 #include <ostream>
+#include <span>
 #include <string_view>
+#include <tuple>
 
 #include "Driver/Timer.h"
 
 #include "Exception.hpp"
 #include "ExecutionContext.hpp"
 #include "MemRefUtils.hpp"
+#include "PerfCounters.hpp"
 #include "QuantumDevice.hpp"
+#include "QubitArray.hpp"
 #include "Types.h"
 
 namespace Catalyst::Runtime {
@@ -34,15 +40,34 @@ namespace Catalyst::Runtime {
 static constexpr RESULT GLOBAL_RESULT_TRUE_CONST{true};
 static constexpr RESULT GLOBAL_RESULT_FALSE_CONST{false};
 
+#ifndef CATALYST_RUNTIME_BITCODE
 /**
  * @brief Global quantum device unique pointer.
  */
-static std::unique_ptr<ExecutionContext> CTX = nullptr;
+std::unique_ptr<ExecutionContext> CTX = nullptr;
 
 /**
- * @brief Thread local device pointer with internal linkage.
+ * @brief Thread local device pointer.
  */
-thread_local static RTDevice *RTD_PTR = nullptr;
+thread_local constinit RTDevice *RTD_PTR = nullptr;
+
+/**
+ * @brief Whether the last shot released by this thread passed its postselected measurements.
+ */
+thread_local constinit bool LAST_SHOT_ACCEPTED = true;
+
+/**
+ * @brief The peak memory of the buffers of the last finalized execution, in bytes.
+ */
+size_t LAST_PEAK_MEMORY = 0;
+#else
+// The bitcode build of this file is linked into compiled kernels, where the runtime state must
+// resolve to the one owned by the rt_capi library.
+extern std::unique_ptr<ExecutionContext> CTX;
+extern thread_local constinit RTDevice *RTD_PTR;
+extern thread_local constinit bool LAST_SHOT_ACCEPTED;
+extern size_t LAST_PEAK_MEMORY;
+#endif
 
 bool getModifiersAdjoint(const Modifiers *modifiers)
 {
@@ -68,6 +93,81 @@ std::vector<bool> getModifiersControlledValues(const Modifiers *modifiers)
 #define MODIFIERS_ARGS(mod)                                                                        \
     getModifiersAdjoint(mod), getModifiersControlledWires(mod), getModifiersControlledValues(mod)
 
+std::span<const QubitIdType> getModifiersControlledWiresSpan(const Modifiers *modifiers)
+{
+    return !modifiers ? std::span<const QubitIdType>()
+                      : std::span<const QubitIdType>(
+                            reinterpret_cast<const QubitIdType *>(modifiers->controlled_wires),
+                            modifiers->num_controlled);
+}
+
+std::span<const bool> getModifiersControlledValuesSpan(const Modifiers *modifiers)
+{
+    return !modifiers ? std::span<const bool>()
+                      : std::span<const bool>(modifiers->controlled_values,
+                                              modifiers->num_controlled);
+}
+
+// Non-owning variant of MODIFIERS_ARGS for `QuantumDevice::GateOperation`.
+#define MODIFIERS_SPANS(mod)                                                                       \
+    getModifiersAdjoint(mod), getModifiersControlledWiresSpan(mod),                                \
+        getModifiersControlledValuesSpan(mod)
+
+/**
+ * @brief A contiguous array of `N` inline elements that only spills to the heap when a larger
+ * size is requested.
+ *
+ * Used to gather the variadic operands of C-API calls (wires, observable keys) without a heap
+ * allocation in the common case, and hand them to the device as a `std::span`.
+ */
+template <typename T, size_t N = 8> class InlineBuffer {
+  private:
+    std::array<T, N> inline_data{};
+    std::vector<T> heap_data;
+    T *ptr;
+    size_t len;
+
+  public:
+    explicit InlineBuffer(size_t size) : ptr(inline_data.data()), len(size)
+    {
+        if (size > N) {
+            heap_data.resize(size);
+            ptr = heap_data.data();
+        }
+    }
+
+    InlineBuffer(const InlineBuffer &) = delete;
+    InlineBuffer &operator=(const InlineBuffer &) = delete;
+    InlineBuffer(InlineBuffer &&) = delete;
+    InlineBuffer &operator=(InlineBuffer &&) = delete;
+
+    [[nodiscard]] auto size() const -> size_t { return len; }
+    [[nodiscard]] auto data() -> T * { return ptr; }
+    T &operator[](size_t idx) { return ptr[idx]; }
+    operator std::span<const T>() const { return {ptr, len}; }
+};
+
+/**
+ * @brief Gather the variadic qubit operands of a C-API call, to forward them to its array
+ * variant.
+ */
+static void _collect_qubits(va_list args, InlineBuffer<QUBIT *> &qubits)
+{
+    for (size_t i = 0; i < qubits.size(); i++) {
+        qubits[i] = va_arg(args, QUBIT *);
+    }
+}
+
+/**
+ * @brief Convert the qubit operands of a C-API call to device wires.
+ */
+template <typename Wires> static void _copy_wires(QUBIT **qubits, Wires &wires)
+{
+    for (size_t i = 0; i < wires.size(); i++) {
+        wires[i] = reinterpret_cast<QubitIdType>(qubits[i]);
+    }
+}
+
 /**
  * @brief Initialize the device instance and update the value of RTD_PTR
  * to the new initialized device pointer.
@@ -83,6 +183,21 @@ std::vector<bool> getModifiersControlledValues(const Modifiers *modifiers)
     return false;
 }
 
+/**
+ * @brief Get the runtime tracer, or a null pointer if tracing is disabled.
+ */
+auto getTracer() -> Tracer * { return CTX ? CTX->getTracer() : nullptr; }
+
+/**
+ * @brief Get the performance counters of the compiled functions, which outlive the execution
+ * contexts so that they accumulate over all executions of the process.
+ */
+auto getPerfCounters() -> PerfCounters &
+{
+    static PerfCounters counters;
+    return counters;
+}
+
 /**
  * @brief get the active device.
  */
@@ -92,27 +207,199 @@ auto getQuantumDevicePtr() -> const std::unique_ptr<QuantumDevice> &
 }
 
 /**
- * @brief Inactivate the active device instance.
+ * @brief Inactivate the active device instance, and reactivate the device that it suspended.
  */
 void deactivateDevice()
 {
+    // Pooled devices start the next execution from an empty Pauli frame
+    RTD_PTR->getPauliFrame().reset();
+    RTD_PTR->getHamiltonianEstimator().reset();
+    RTD_PTR->getDecoders().reset();
+    RTDevice *suspended = RTD_PTR->getSuspendedDevice();
+    RTD_PTR->setSuspendedDevice(nullptr);
     CTX->deactivateDevice(RTD_PTR);
-    RTD_PTR = nullptr;
+    RTD_PTR = suspended;
+}
+
+/**
+ * @brief Get the Pauli frame of the active device.
+ */
+auto getPauliFrame() -> PauliFrame &
+{
+    RT_FAIL_IF(!RTD_PTR, "Cannot track the Pauli frame without an active device");
+    return RTD_PTR->getPauliFrame();
+}
+
+/**
+ * @brief Get the Hamiltonian estimator of the active device.
+ */
+auto getHamiltonianEstimator() -> HamiltonianEstimator &
+{
+    RT_FAIL_IF(!RTD_PTR, "Cannot estimate Hamiltonians without an active device");
+    return RTD_PTR->getHamiltonianEstimator();
+}
+
+/**
+ * @brief Get the syndrome decoders of the active device.
+ */
+auto getDecoders() -> DecoderRegistry &
+{
+    RT_FAIL_IF(!RTD_PTR, "Cannot decode syndromes without an active device");
+    return RTD_PTR->getDecoders();
+}
+
+/**
+ * @brief Read an array of signed integers of `bit_width` bits.
+ */
+auto readIntegers(const void *data, int64_t size, int64_t bit_width) -> std::vector<int64_t>
+{
+    RT_FAIL_IF(size < 0, "Invalid array size");
+    std::vector<int64_t> values(static_cast<size_t>(size));
+    auto read = [&](const auto *typed) { std::copy(typed, typed + size, values.begin()); };
+    switch (bit_width) {
+    case 8:
+        read(static_cast<const int8_t *>(data));
+        break;
+    case 16:
+        read(static_cast<const int16_t *>(data));
+        break;
+    case 32:
+        read(static_cast<const int32_t *>(data));
+        break;
+    case 64:
+        read(static_cast<const int64_t *>(data));
+        break;
+    default:
+        RT_FAIL("Unsupported integer width");
+    }
+    return values;
+}
+
+/**
+ * @brief Create an observable of Pauli words with the device, or under a runtime key if the
+ * device does not support it.
+ */
+template <typename CreateFn> auto createPauliObservable(CreateFn &&create) -> ObsIdType
+{
+    try {
+        return create();
+    }
+    catch (const UnsupportedException &) {
+        return getHamiltonianEstimator().createRuntimeKey();
+    }
+}
+
+/**
+ * @brief Sample the qubits of `basis` after rotating them to the eigenbasis of its Pauli
+ * operators, and rotate them back.
+ */
+auto samplePauliBasis(const PauliWord &basis) -> std::vector<double>
+{
+    const auto &device = getQuantumDevicePtr();
+    std::vector<QubitIdType> wires;
+    for (const auto &[wire, pauli] : basis) {
+        wires.push_back(wire);
+        if (pauli == ObsId::PauliY) {
+            device->NamedOperation("S", {}, {wire}, true);
+        }
+        if (pauli != ObsId::PauliZ) {
+            device->NamedOperation("Hadamard", {}, {wire});
+        }
+    }
+
+    std::vector<double> samples(device->GetDeviceShots() * wires.size());
+    const size_t sizes[2] = {device->GetDeviceShots(), wires.size()};
+    const size_t strides[2] = {wires.size(), 1};
+    DataView<double, 2> view(samples.data(), 0, sizes, strides);
+    device->PartialSample(view, wires);
+
+    for (auto it = basis.rbegin(); it != basis.rend(); it++) {
+        if (it->second != ObsId::PauliZ) {
+            device->NamedOperation("Hadamard", {}, {it->first});
+        }
+        if (it->second == ObsId::PauliY) {
+            device->NamedOperation("S", {}, {it->first});
+        }
+    }
+    return samples;
+}
+
+/**
+ * @brief Whether the statistics of an observable are only measured by the device, without
+ * falling back to the Hamiltonian estimator.
+ */
+auto isDeviceObservable(ObsIdType key) -> bool
+{
+    HamiltonianEstimator &estimator = getHamiltonianEstimator();
+    return !HamiltonianEstimator::isRuntimeKey(key) &&
+           (!(estimator.isPauliWord(key) || estimator.isPauliSum(key)) ||
+            getQuantumDevicePtr()->GetDeviceShots() <= 0);
+}
+
+/**
+ * @brief Measure the expectation value, or the variance, of an observable with the device, or
+ * estimate it from samples for the Pauli words and sums that the device does not support.
+ */
+template <typename MeasureFn>
+auto measureObservable(ObsIdType key, bool variance, MeasureFn &&measure) -> double
+{
+    HamiltonianEstimator &estimator = getHamiltonianEstimator();
+    const bool has_shots = getQuantumDevicePtr()->GetDeviceShots() > 0;
+    if (isDeviceObservable(key)) {
+        return measure();
+    }
+    if (!HamiltonianEstimator::isRuntimeKey(key)) {
+        try {
+            return measure();
+        }
+        catch (const UnsupportedException &) {
+        }
+    }
+    RT_FAIL_IF(!has_shots, "Estimating an unsupported observable requires shots");
+    return estimator.estimate(key, samplePauliBasis, variance);
+}
+
+/**
+ * @brief Encode a Pauli record as a byte, with the X-parity bit in bit 0 and the Z-parity bit
+ * in bit 1.
+ */
+auto encodePauliRecord(std::pair<bool, bool> record) -> uint8_t
+{
+    return static_cast<uint8_t>(record.first) | static_cast<uint8_t>(record.second << 1);
 }
 
-static void autoQubitManagementAllocate(std::vector<QubitIdType> *qubit_vector_ptr, int64_t idx)
+static void autoQubitManagementAllocate(QubitArray *qubit_array, int64_t idx)
 {
     // allocate new qubits if we are in automatic qubit allocation mode
     // and encountered a new user wire index
     // `idx` is the new user wire index from frontend pennylane
-    // number of currently allocated qubits is `qubit_vector_ptr->size()`
-    QirArray *new_qubits = __catalyst__rt__qubit_allocate_array(
-        idx + 1 - static_cast<int64_t>(qubit_vector_ptr->size()));
-    std::vector<QubitIdType> *new_qubits_vector =
-        reinterpret_cast<std::vector<QubitIdType> *>(new_qubits);
-    qubit_vector_ptr->insert(qubit_vector_ptr->end(), new_qubits_vector->begin(),
-                             new_qubits_vector->end());
+    // number of currently allocated qubits is `qubit_array->getSize()`
+    const size_t num_new_qubits = idx + 1 - qubit_array->getSize();
+    getQuantumDevicePtr()->AllocateQubitsInPlace(qubit_array->grow(num_new_qubits));
+}
+
+/**
+ * @brief Look up a symbol of the callback registry library.
+ *
+ * The library is kept loaded and callers look their symbol up once, as callbacks may be called
+ * within hot loops, possibly from several threads.
+ */
+template <typename FuncPtr> FuncPtr lookupRegistrySymbol(const char *name)
+{
+    void *handle = dlopen(LIBREGISTRY, RTLD_LAZY);
+    if (!handle) {
+        char *err_msg = dlerror();
+        RT_FAIL(err_msg);
+    }
+
+    auto symbol = reinterpret_cast<FuncPtr>(dlsym(handle, name));
+    if (!symbol) {
+        char *err_msg = dlerror();
+        RT_FAIL(err_msg);
+    }
+    return symbol;
 }
+
 } // namespace Catalyst::Runtime
 
 extern "C" {
@@ -122,6 +409,7 @@ using timer = catalyst::utils::Timer<>; // default timing ratio of std::milli
 
 void __catalyst_inactive_callback(int64_t identifier, int64_t argc, int64_t retc, ...)
 {
+    TraceScope scope(getTracer(), "inactive_callback", "capi");
     // LIBREGISTRY is a compile time macro. It is defined based on the output
     // name of the callback library. And since it is stored in the same location
     // as this library, it shares the ORIGIN variable. Do a `git grep LIBREGISTRY`
@@ -136,25 +424,29 @@ void __catalyst_inactive_callback(int64_t identifier, int64_t argc, int64_t retc
     //
     // This function cannot be tested from the runtime tests because there would be no valid python
     // function to callback...
-    void *handle = dlopen(LIBREGISTRY, RTLD_LAZY);
-    if (!handle) {
-        char *err_msg = dlerror();
-        RT_FAIL(err_msg);
-    }
-
-    void (*callbackCall)(int64_t, int64_t, int64_t, va_list);
     typedef void (*func_ptr_t)(int64_t, int64_t, int64_t, va_list);
-    callbackCall = (func_ptr_t)dlsym(handle, "callbackCall");
-    if (!callbackCall) {
-        char *err_msg = dlerror();
-        RT_FAIL(err_msg);
-    }
+    static const auto callbackCall = lookupRegistrySymbol<func_ptr_t>("callbackCall");
 
     va_list args;
     va_start(args, retc);
     callbackCall(identifier, argc, retc, args);
     va_end(args);
-    dlclose(handle);
+}
+
+void __catalyst_inactive_batched_callback(int64_t identifier, int64_t argc, int64_t retc,
+                                          const int64_t *ranks, ...)
+{
+    TraceScope scope(getTracer(), "inactive_batched_callback", "capi");
+    // The arguments and results are stacked along their leading dimension, the callback is called
+    // once per slice. See __catalyst_inactive_callback.
+    typedef void (*func_ptr_t)(int64_t, int64_t, int64_t, const int64_t *, va_list);
+    static const auto batchedCallbackCall =
+        lookupRegistrySymbol<func_ptr_t>("batchedCallbackCall");
+
+    va_list args;
+    va_start(args, ranks);
+    batchedCallbackCall(identifier, argc, retc, ranks, args);
+    va_end(args);
 }
 
 void __catalyst__host__rt__unrecoverable_error()
@@ -164,25 +456,26 @@ void __catalyst__host__rt__unrecoverable_error()
 
 void *_mlir_memref_to_llvm_alloc(size_t size)
 {
+    const auto &manager = CTX->getMemoryManager();
+    manager->checkLimit(size);
     void *ptr = malloc(size);
-    CTX->getMemoryManager()->insert(ptr);
+    manager->insert(ptr, size, RTD_PTR ? &RTD_PTR->getMemoryUsage() : nullptr);
     return ptr;
 }
 
 void *_mlir_memref_to_llvm_aligned_alloc(size_t alignment, size_t size)
 {
+    const auto &manager = CTX->getMemoryManager();
+    manager->checkLimit(size);
     void *ptr = aligned_alloc(alignment, size);
-    CTX->getMemoryManager()->insert(ptr);
+    manager->insert(ptr, size, RTD_PTR ? &RTD_PTR->getMemoryUsage() : nullptr);
     return ptr;
 }
 
 bool _mlir_memory_transfer(void *ptr)
 {
-    if (!CTX->getMemoryManager()->contains(ptr)) {
-        return false;
-    }
-    CTX->getMemoryManager()->erase(ptr);
-    return true;
+    TraceScope scope(getTracer(), "memory_transfer", "capi");
+    return CTX->getMemoryManager()->erase(ptr);
 }
 
 void _mlir_memref_to_llvm_free(void *ptr)
@@ -202,6 +495,12 @@ void __catalyst__rt__print_string(char *string)
 
 void __catalyst__rt__assert_bool(bool p, char *s) { RT_FAIL_IF(!p, s); }
 
+void __catalyst__rt__perf_counters_begin(const char *name) { getPerfCounters().begin(name); }
+
+void __catalyst__rt__perf_counters_end(const char *name) { getPerfCounters().end(name); }
+
+void __catalyst__rt__perf_counters_write(const char *path) { getPerfCounters().write(path); }
+
 void __catalyst__rt__print_tensor(OpaqueMemRefT *c_memref, bool printDescriptor)
 {
     if (c_memref->datatype == NumericType::idx) {
@@ -247,6 +546,9 @@ void __catalyst__rt__initialize(uint32_t *seed) { CTX = std::make_unique<Executi
 
 void __catalyst__rt__finalize()
 {
+    if (CTX) {
+        LAST_PEAK_MEMORY = CTX->getMemoryManager()->getUsage().getPeak();
+    }
     RTD_PTR = nullptr;
     CTX.reset(nullptr);
 }
@@ -257,24 +559,42 @@ static int __catalyst__rt__device_init__impl(int8_t *rtd_lib, int8_t *rtd_name,
     // Device library cannot be a nullptr
     RT_FAIL_IF(!rtd_lib, "Invalid device library");
     RT_FAIL_IF(!CTX, "Invalid use of the global driver before initialization");
-    RT_FAIL_IF(RTD_PTR, "Cannot re-initialize an ACTIVE device: Consider using "
-                        "__catalyst__rt__device_release before __catalyst__rt__device_init");
 
+    // A device initialized while another one is active suspends it until its own release, so that
+    // a thread can nest the executions of several devices without releasing them. The devices are
+    // released in the reverse order of their initialization. A device that is already active or
+    // suspended on the thread was not released, e.g. by an execution that failed, and is not
+    // nested again.
+    RTDevice *suspended = RTD_PTR;
     const std::vector<std::string_view> args{
         reinterpret_cast<char *>(rtd_lib), (rtd_name ? reinterpret_cast<char *>(rtd_name) : ""),
         (rtd_kwargs ? reinterpret_cast<char *>(rtd_kwargs) : "")};
+    const std::string device_key =
+        RTDevice::getDeviceKey(args[0], args[1], args[2], auto_qubit_management);
+    for (RTDevice *device = suspended; device; device = device->getSuspendedDevice()) {
+        RT_FAIL_IF(device->getDeviceKey() == device_key,
+                   "Cannot re-initialize an ACTIVE device: Consider using "
+                   "__catalyst__rt__device_release before __catalyst__rt__device_init");
+    }
     RT_FAIL_IF(!initRTDevicePtr(args[0], args[1], args[2], auto_qubit_management),
                "Failed initialization of the backend device");
+    RTD_PTR->setSuspendedDevice(suspended);
     getQuantumDevicePtr()->SetDeviceShots(shots);
+    if (CTX->getTapeCheckpointInterval()) {
+        getQuantumDevicePtr()->SetTapeCheckpointInterval(CTX->getTapeCheckpointInterval());
+    }
     if (CTX->getDeviceRecorderStatus()) {
         getQuantumDevicePtr()->StartTapeRecording();
     }
+    RTD_PTR->setMeasurementTree(CTX->getMeasurementTreeStatus(), CTX->getMeasurementTreeEpoch());
+    RTD_PTR->setShotRejection(CTX->getShotRejectionStatus());
     return 0;
 }
 
 void __catalyst__rt__device_init(int8_t *rtd_lib, int8_t *rtd_name, int8_t *rtd_kwargs,
                                  int64_t shots, bool auto_qubit_management)
 {
+    TraceScope scope(getTracer(), "device_init", "capi");
     timer::timer(__catalyst__rt__device_init__impl, "device_init", /* add_endl */ true, rtd_lib,
                  rtd_name, rtd_kwargs, shots, auto_qubit_management);
 }
@@ -282,6 +602,10 @@ void __catalyst__rt__device_init(int8_t *rtd_lib, int8_t *rtd_name, int8_t *rtd_
 static int __catalyst__rt__device_release__impl()
 {
     RT_FAIL_IF(!CTX, "Cannot release an ACTIVE device out of scope of the global driver");
+    if (CTX->getShotRejectionStatus()) {
+        LAST_SHOT_ACCEPTED = !RTD_PTR->isShotRejected();
+        CTX->recordShot(LAST_SHOT_ACCEPTED);
+    }
     // TODO: This will be used for the async support
     deactivateDevice();
     return 0;
@@ -289,16 +613,23 @@ static int __catalyst__rt__device_release__impl()
 
 void __catalyst__rt__device_release()
 {
+    TraceScope scope(getTracer(), "device_release", "capi");
     timer::timer(__catalyst__rt__device_release__impl, "device_release", /* add_endl */ true);
 }
 
 void __catalyst__rt__print_state()
 {
     size_t num_wires = getQuantumDevicePtr()->GetNumQubits();
-    std::vector<std::complex<double>> state(1 << num_wires);
-    DataView<std::complex<double>, 1> view(state);
 
-    getQuantumDevicePtr()->State(view);
+    // Print from the device storage when it is lent, without a copy of the state
+    std::vector<std::complex<double>> buffer;
+    std::span<const std::complex<double>> state = getQuantumDevicePtr()->GetStateView();
+    if (state.size() != (1UL << num_wires)) {
+        buffer.resize(1UL << num_wires);
+        DataView<std::complex<double>, 1> view(buffer);
+        getQuantumDevicePtr()->State(view);
+        state = buffer;
+    }
 
     std::cout << "State = [\n";
     for (size_t idx = 0; idx < state.size(); idx++) {
@@ -307,6 +638,104 @@ void __catalyst__rt__print_state()
     std::cout << "]\n";
 }
 
+void __catalyst__rt__set_prng_stream(int64_t stream)
+{
+    RT_FAIL_IF(!RTD_PTR, "Cannot set a random stream without an active device");
+    RT_FAIL_IF(stream < 0, "Invalid random stream id");
+
+    // Unseeded executions keep the device's own source of randomness
+    if (auto engine = CTX->getPRNGStream(static_cast<uint64_t>(stream))) {
+        getQuantumDevicePtr()->SetDeviceStreamPRNG(*engine);
+    }
+}
+
+void __catalyst__rt__async_execute(void *handle, void (*resume)(void *))
+{
+    AsyncExecutor::getInstance().execute(resume, handle);
+}
+
+void __catalyst__rt__async_configure(int64_t numWorkers, bool pinWorkers,
+                                     int64_t maxDevicesPerKey)
+{
+    RT_FAIL_IF(numWorkers < 0, "Invalid number of async workers");
+    RT_FAIL_IF(maxDevicesPerKey < 0, "Invalid maximum number of devices");
+
+    AsyncExecutor::getInstance().configure(static_cast<size_t>(numWorkers), pinWorkers,
+                                           static_cast<size_t>(maxDevicesPerKey));
+    if (CTX) {
+        CTX->setMaxDevicesPerKey(static_cast<size_t>(maxDevicesPerKey));
+    }
+}
+
+void __catalyst__rt__device_start_batch(int64_t batch_size)
+{
+    RT_FAIL_IF(!RTD_PTR, "Cannot start a batch without an active device");
+    RT_FAIL_IF(batch_size < 0, "Invalid batch size");
+
+    getQuantumDevicePtr()->StartBatch(static_cast<size_t>(batch_size));
+}
+
+void __catalyst__rt__device_end_batch()
+{
+    RT_FAIL_IF(!RTD_PTR, "Cannot end a batch without an active device");
+
+    getQuantumDevicePtr()->EndBatch();
+}
+
+void __catalyst__rt__set_tape_checkpoint_interval(int64_t interval)
+{
+    RT_FAIL_IF(interval < 0, "Invalid tape checkpoint interval");
+
+    CTX->setTapeCheckpointInterval(static_cast<size_t>(interval));
+    if (RTD_PTR) {
+        getQuantumDevicePtr()->SetTapeCheckpointInterval(static_cast<size_t>(interval));
+    }
+}
+
+void __catalyst__rt__toggle_measurement_tree(bool status)
+{
+    CTX->setMeasurementTreeStatus(status);
+    if (RTD_PTR) {
+        RTD_PTR->setMeasurementTree(status, CTX->getMeasurementTreeEpoch());
+    }
+}
+
+void __catalyst__rt__toggle_shot_rejection(bool status)
+{
+    CTX->setShotRejectionStatus(status);
+    LAST_SHOT_ACCEPTED = true;
+    if (RTD_PTR) {
+        RTD_PTR->setShotRejection(status);
+    }
+}
+
+bool __catalyst__rt__shot_accepted() { return LAST_SHOT_ACCEPTED; }
+
+double __catalyst__rt__shot_acceptance_rate()
+{
+    RT_FAIL_IF(!CTX, "Invalid use of the global driver before initialization");
+    const auto stats = CTX->getShotRejectionStats();
+    const size_t total = stats.accepted + stats.rejected;
+    return total ? static_cast<double>(stats.accepted) / static_cast<double>(total) : 1.0;
+}
+
+int64_t __catalyst__rt__memory_current_bytes()
+{
+    return CTX ? static_cast<int64_t>(CTX->getMemoryManager()->getUsage().getCurrent()) : 0;
+}
+
+int64_t __catalyst__rt__memory_peak_bytes()
+{
+    return static_cast<int64_t>(CTX ? CTX->getMemoryManager()->getUsage().getPeak()
+                                    : LAST_PEAK_MEMORY);
+}
+
+int64_t __catalyst__rt__device_memory_peak_bytes()
+{
+    RT_FAIL_IF(!RTD_PTR, "Cannot query the memory of the device before its initialization");
+    return static_cast<int64_t>(RTD_PTR->getMemoryUsage().getPeak());
+}
+
 void __catalyst__rt__toggle_recorder(bool status)
 {
     CTX->setDeviceRecorderStatus(status);
@@ -332,6 +761,7 @@ static QUBIT *__catalyst__rt__qubit_allocate__impl()
 
 QUBIT *__catalyst__rt__qubit_allocate()
 {
+    TraceScope scope(getTracer(), "qubit_allocate", "capi");
     return timer::timer(__catalyst__rt__qubit_allocate__impl, "qubit_allocate",
                         /* add_endl */ true);
 }
@@ -342,32 +772,22 @@ static QirArray *__catalyst__rt__qubit_allocate_array__impl(int64_t num_qubits)
     RT_ASSERT(CTX->getMemoryManager() != nullptr);
     RT_ASSERT(num_qubits >= 0);
 
-    // For first prototype, we just want to make this work.
-    // But ideally, I think the device should determine the representation.
-    // Essentially just forward this to the device library.
-    // And the device library can choose how to handle everything.
-    std::vector<QubitIdType> qubit_vector = getQuantumDevicePtr()->AllocateQubits(num_qubits);
-
-    // I don't like this copying.
-    std::vector<QubitIdType> *qubit_vector_ptr =
-        new std::vector<QubitIdType>(qubit_vector.begin(), qubit_vector.end());
-
-    // Because this function is interfacing with C
-    // I think we should return a trivial-type
-    //     https://en.cppreference.com/w/cpp/named_req/TrivialType
-    // Why should we return a trivial type?
-    //
-    // Paraphrasing from stackoverflow: https://stackoverflow.com/a/72409589
-    //     extern "C" will avoid name mangling from happening.
-    //     It doesn't prevent a function from returning or accepting a C++ type.
-    //     But the calling language needs to understand the data-layout for the
-    //     type being returned.
-    //     For non-trivial types, this will be difficult to impossible.
-    return (QirArray *)qubit_vector_ptr;
+    // The register is a single allocation, with the qubit IDs filled in place by the device.
+    // It is opaque to compiled code, which only accesses it through the runtime.
+    QubitArray *qubit_array = QubitArray::create(num_qubits);
+    try {
+        getQuantumDevicePtr()->AllocateQubitsInPlace(qubit_array->getIds());
+    }
+    catch (...) {
+        QubitArray::destroy(qubit_array);
+        throw;
+    }
+    return qubit_array->toQirArray();
 }
 
 QirArray *__catalyst__rt__qubit_allocate_array(int64_t num_qubits)
 {
+    TraceScope scope(getTracer(), "qubit_allocate_array", "capi");
     return timer::timer(__catalyst__rt__qubit_allocate_array__impl, "qubit_allocate_array",
                         /* add_endl */ true, num_qubits);
 }
@@ -380,21 +800,22 @@ static int __catalyst__rt__qubit_release__impl(QUBIT *qubit)
 
 void __catalyst__rt__qubit_release(QUBIT *qubit)
 {
+    TraceScope scope(getTracer(), "qubit_release", "capi");
     timer::timer(__catalyst__rt__qubit_release__impl, "qubit_release",
                  /* add_endl */ true, qubit);
 }
 
 static int __catalyst__rt__qubit_release_array__impl(QirArray *qubit_array)
 {
-    std::vector<QubitIdType> *qubit_array_ptr =
-        reinterpret_cast<std::vector<QubitIdType> *>(qubit_array);
-    getQuantumDevicePtr()->ReleaseQubits(*qubit_array_ptr);
-    delete qubit_array_ptr;
+    QubitArray *qubit_array_ptr = QubitArray::fromQirArray(qubit_array);
+    getQuantumDevicePtr()->ReleaseQubits(qubit_array_ptr->toVector());
+    QubitArray::destroy(qubit_array_ptr);
     return 0;
 }
 
 void __catalyst__rt__qubit_release_array(QirArray *qubit_array)
 {
+    TraceScope scope(getTracer(), "qubit_release_array", "capi");
     timer::timer(__catalyst__rt__qubit_release_array__impl, "qubit_release_array",
                  /* add_endl */ true, qubit_array);
 }
@@ -480,7 +901,9 @@ void __catalyst__qis__Gradient_params(MemRefT_int64_1d *params, int64_t numResul
 
 void __catalyst__qis__GlobalPhase(double phi, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("GlobalPhase", {phi}, {}, MODIFIERS_ARGS(modifiers));
+    const double params[] = {phi};
+    getQuantumDevicePtr()->GateOperation(GateId::GlobalPhase, params, {},
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__SetState(MemRefT_CplxT_double_1d *data, uint64_t numQubits, ...)
@@ -501,22 +924,32 @@ void __catalyst__qis__SetState(MemRefT_CplxT_double_1d *data, uint64_t numQubits
     getQuantumDevicePtr()->SetState(data_view, wires);
 }
 
+void __catalyst__qis__PCPhase_array(double theta, double dim, const Modifiers *modifiers,
+                                    int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+    RT_ASSERT(dim >= 0 && dim == static_cast<int64_t>(dim));
+
+    InlineBuffer<QubitIdType> wires(numQubits);
+    _copy_wires(qubits, wires);
+
+    const double params[] = {theta, dim};
+    getQuantumDevicePtr()->GateOperation(GateId::PCPhase, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
+}
+
 void __catalyst__qis__PCPhase(double theta, double dim, const Modifiers *modifiers,
                               int64_t numQubits, ...)
 {
     RT_ASSERT(numQubits >= 0);
-    RT_ASSERT(dim >= 0 && dim == static_cast<int64_t>(dim));
 
     va_list args;
     va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
-    }
+    InlineBuffer<QUBIT *> qubits(numQubits);
+    _collect_qubits(args, qubits);
     va_end(args);
 
-    getQuantumDevicePtr()->NamedOperation("PCPhase", {theta, dim}, wires,
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    __catalyst__qis__PCPhase_array(theta, dim, modifiers, numQubits, qubits.data());
 }
 
 void __catalyst__qis__SetBasisState(MemRefT_int8_1d *data, uint64_t numQubits, ...)
@@ -540,127 +973,177 @@ void __catalyst__qis__SetBasisState(MemRefT_int8_1d *data, uint64_t numQubits, .
     getQuantumDevicePtr()->SetBasisState(data_view, wires);
 }
 
+void __catalyst__qis__SetSparseState(MemRefT_int64_1d *indices, MemRefT_CplxT_double_1d *amplitudes,
+                                     uint64_t numQubits, ...)
+{
+    RT_ASSERT(numQubits > 0);
+    RT_FAIL_IF(indices->sizes[0] != amplitudes->sizes[0],
+               "The sparse state must have one amplitude per basis state index.");
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires(numQubits);
+    for (uint64_t i = 0; i < numQubits; i++) {
+        wires[i] = va_arg(args, QubitIdType);
+    }
+    va_end(args);
+
+    // Only the non-zero amplitudes are copied, contiguously, from the strided buffers
+    const size_t num_amplitudes = indices->sizes[0];
+    std::vector<int64_t> index_data(num_amplitudes);
+    std::vector<std::complex<double>> amplitude_data(num_amplitudes);
+    for (size_t i = 0; i < num_amplitudes; i++) {
+        index_data[i] = indices->data_aligned[indices->offset + i * indices->strides[0]];
+        const CplxT_double &amplitude =
+            amplitudes->data_aligned[amplitudes->offset + i * amplitudes->strides[0]];
+        amplitude_data[i] = {amplitude.real, amplitude.imag};
+        RT_FAIL_IF(index_data[i] < 0 ||
+                       (numQubits < 64 && static_cast<uint64_t>(index_data[i]) >> numQubits),
+                   "Invalid basis state index of the sparse state.");
+    }
+
+    getQuantumDevicePtr()->SetSparseState(index_data, amplitude_data, wires);
+}
+
+void __catalyst__qis__SetBasisStateIndex(uint64_t index, uint64_t numQubits, ...)
+{
+    RT_ASSERT(numQubits > 0);
+    RT_FAIL_IF(numQubits > 64, "A packed basis state supports at most 64 wires.");
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires(numQubits);
+    for (uint64_t i = 0; i < numQubits; i++) {
+        wires[i] = va_arg(args, QubitIdType);
+    }
+    va_end(args);
+    std::unordered_set<QubitIdType> wire_set(wires.begin(), wires.end());
+    RT_FAIL_IF(wire_set.size() != numQubits, "Wires must be unique");
+
+    getQuantumDevicePtr()->SetBasisStateIndex(index, wires);
+}
+
 void __catalyst__qis__Identity(const Modifiers *modifiers, int64_t numQubits, ...)
 {
     RT_ASSERT(numQubits >= 0);
     va_list args;
     va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
+    InlineBuffer<QubitIdType> wires(numQubits);
     for (int64_t i = 0; i < numQubits; i++) {
         wires[i] = va_arg(args, QubitIdType);
     }
     va_end(args);
 
-    getQuantumDevicePtr()->NamedOperation("Identity", {}, wires,
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    getQuantumDevicePtr()->GateOperation(GateId::Identity, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__PauliX(QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("PauliX", {}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::PauliX, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__PauliY(QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("PauliY", {}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::PauliY, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__PauliZ(QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("PauliZ", {}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::PauliZ, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__Hadamard(QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("Hadamard", {}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::Hadamard, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__S(QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("S", {}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::S, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__T(QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("T", {}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::T, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__PhaseShift(double theta, QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation(
-        "PhaseShift", {theta}, {reinterpret_cast<QubitIdType>(qubit)}, MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::PhaseShift, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__RX(double theta, QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("RX", {theta}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::RX, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__RY(double theta, QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("RY", {theta}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::RY, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__RZ(double theta, QUBIT *qubit, const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("RZ", {theta}, {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::RZ, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__Rot(double phi, double theta, double omega, QUBIT *qubit,
                           const Modifiers *modifiers)
 {
-    getQuantumDevicePtr()->NamedOperation("Rot", {phi, theta, omega},
-                                          {reinterpret_cast<QubitIdType>(qubit)},
-                                          MODIFIERS_ARGS(modifiers));
+    const double params[] = {phi, theta, omega};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(qubit)};
+    getQuantumDevicePtr()->GateOperation(GateId::Rot, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__CNOT(QUBIT *control, QUBIT *target, const Modifiers *modifiers)
 {
     RT_FAIL_IF(control == target,
                "Invalid input for CNOT gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("CNOT", {},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::CNOT, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__CY(QUBIT *control, QUBIT *target, const Modifiers *modifiers)
 {
     RT_FAIL_IF(control == target,
                "Invalid input for CY gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("CY", {},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::CY, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__CZ(QUBIT *control, QUBIT *target, const Modifiers *modifiers)
 {
     RT_FAIL_IF(control == target,
                "Invalid input for CZ gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("CZ", {},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::CZ, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__SWAP(QUBIT *control, QUBIT *target, const Modifiers *modifiers)
 {
     RT_FAIL_IF(control == target,
                "Invalid input for SWAP gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("SWAP", {},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::SWAP, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__IsingXX(double theta, QUBIT *control, QUBIT *target,
@@ -669,10 +1152,11 @@ void __catalyst__qis__IsingXX(double theta, QUBIT *control, QUBIT *target,
     RT_FAIL_IF(
         control == target,
         "Invalid input for IsingXX gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("IsingXX", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::IsingXX, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__IsingYY(double theta, QUBIT *control, QUBIT *target,
@@ -681,10 +1165,11 @@ void __catalyst__qis__IsingYY(double theta, QUBIT *control, QUBIT *target,
     RT_FAIL_IF(
         control == target,
         "Invalid input for IsingYY gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("IsingYY", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::IsingYY, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__IsingXY(double theta, QUBIT *control, QUBIT *target,
@@ -693,10 +1178,11 @@ void __catalyst__qis__IsingXY(double theta, QUBIT *control, QUBIT *target,
     RT_FAIL_IF(
         control == target,
         "Invalid input for IsingXY gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("IsingXY", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::IsingXY, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__IsingZZ(double theta, QUBIT *control, QUBIT *target,
@@ -705,10 +1191,11 @@ void __catalyst__qis__IsingZZ(double theta, QUBIT *control, QUBIT *target,
     RT_FAIL_IF(
         control == target,
         "Invalid input for IsingZZ gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("IsingZZ", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::IsingZZ, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__SingleExcitation(double phi, QUBIT *wire0, QUBIT *wire1,
@@ -716,10 +1203,11 @@ void __catalyst__qis__SingleExcitation(double phi, QUBIT *wire0, QUBIT *wire1,
 {
     RT_FAIL_IF(wire0 == wire1,
                "Invalid input for SingleExcitation gate. All two qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation(
-        "SingleExcitation", {phi},
-        {reinterpret_cast<QubitIdType>(wire0), reinterpret_cast<QubitIdType>(wire1)},
-        MODIFIERS_ARGS(modifiers));
+    const double params[] = {phi};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(wire0),
+                                 reinterpret_cast<QubitIdType>(wire1)};
+    getQuantumDevicePtr()->GateOperation(GateId::SingleExcitation, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__DoubleExcitation(double phi, QUBIT *wire0, QUBIT *wire1, QUBIT *wire2,
@@ -729,11 +1217,13 @@ void __catalyst__qis__DoubleExcitation(double phi, QUBIT *wire0, QUBIT *wire1, Q
         (wire0 == wire1 || wire0 == wire2 || wire0 == wire3 || wire1 == wire2 || wire1 == wire3 ||
          wire2 == wire3),
         "Invalid input for DoubleExcitation gate. All four qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation(
-        "DoubleExcitation", {phi},
-        {reinterpret_cast<QubitIdType>(wire0), reinterpret_cast<QubitIdType>(wire1),
-         reinterpret_cast<QubitIdType>(wire2), reinterpret_cast<QubitIdType>(wire3)},
-        MODIFIERS_ARGS(modifiers));
+    const double params[] = {phi};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(wire0),
+                                 reinterpret_cast<QubitIdType>(wire1),
+                                 reinterpret_cast<QubitIdType>(wire2),
+                                 reinterpret_cast<QubitIdType>(wire3)};
+    getQuantumDevicePtr()->GateOperation(GateId::DoubleExcitation, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__ControlledPhaseShift(double theta, QUBIT *control, QUBIT *target,
@@ -741,50 +1231,51 @@ void __catalyst__qis__ControlledPhaseShift(double theta, QUBIT *control, QUBIT *
 {
     RT_FAIL_IF(control == target, "Invalid input for ControlledPhaseShift gate. Control and target "
                                   "qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("ControlledPhaseShift", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::ControlledPhaseShift, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__CRX(double theta, QUBIT *control, QUBIT *target, const Modifiers *modifiers)
 {
     RT_FAIL_IF(control == target,
                "Invalid input for CRX gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("CRX", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::CRX, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__CRY(double theta, QUBIT *control, QUBIT *target, const Modifiers *modifiers)
 {
     RT_FAIL_IF(control == target,
                "Invalid input for CRY gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("CRY", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::CRY, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__CRZ(double theta, QUBIT *control, QUBIT *target, const Modifiers *modifiers)
 {
     RT_FAIL_IF(control == target,
                "Invalid input for CRZ gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("CRZ", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::CRZ, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__MS(double theta, QUBIT *control, QUBIT *target, const Modifiers *modifiers)
 {
     RT_FAIL_IF(control == target,
                "Invalid input for MS gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("MS", {theta},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {theta};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::MS, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__CRot(double phi, double theta, double omega, QUBIT *control, QUBIT *target,
@@ -792,32 +1283,43 @@ void __catalyst__qis__CRot(double phi, double theta, double omega, QUBIT *contro
 {
     RT_FAIL_IF(control == target,
                "Invalid input for CRot gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("CRot", {phi, theta, omega},
-                                          {/* control = */ reinterpret_cast<QubitIdType>(control),
-                                           /* target = */ reinterpret_cast<QubitIdType>(target)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const double params[] = {phi, theta, omega};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(target)};
+    getQuantumDevicePtr()->GateOperation(GateId::CRot, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__CSWAP(QUBIT *control, QUBIT *aswap, QUBIT *bswap, const Modifiers *modifiers)
 {
     RT_FAIL_IF((control == aswap || aswap == bswap || control == bswap),
                "Invalid input for CSWAP gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("CSWAP", {},
-                                          {reinterpret_cast<QubitIdType>(control),
-                                           reinterpret_cast<QubitIdType>(aswap),
-                                           reinterpret_cast<QubitIdType>(bswap)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(control),
+                                 reinterpret_cast<QubitIdType>(aswap),
+                                 reinterpret_cast<QubitIdType>(bswap)};
+    getQuantumDevicePtr()->GateOperation(GateId::CSWAP, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__Toffoli(QUBIT *wire0, QUBIT *wire1, QUBIT *wire2, const Modifiers *modifiers)
 {
     RT_FAIL_IF((wire0 == wire1 || wire1 == wire2 || wire0 == wire2),
                "Invalid input for Toffoli gate. All three qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation("Toffoli", {},
-                                          {reinterpret_cast<QubitIdType>(wire0),
-                                           reinterpret_cast<QubitIdType>(wire1),
-                                           reinterpret_cast<QubitIdType>(wire2)},
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(wire0),
+                                 reinterpret_cast<QubitIdType>(wire1),
+                                 reinterpret_cast<QubitIdType>(wire2)};
+    getQuantumDevicePtr()->GateOperation(GateId::Toffoli, {}, wires, MODIFIERS_SPANS(modifiers));
+}
+
+void __catalyst__qis__MultiRZ_array(double theta, const Modifiers *modifiers, int64_t numQubits,
+                                    QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    InlineBuffer<QubitIdType> wires(numQubits);
+    _copy_wires(qubits, wires);
+
+    const double params[] = {theta};
+    getQuantumDevicePtr()->GateOperation(GateId::MultiRZ, params, wires,
+                                         MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__MultiRZ(double theta, const Modifiers *modifiers, int64_t numQubits, ...)
@@ -826,52 +1328,73 @@ void __catalyst__qis__MultiRZ(double theta, const Modifiers *modifiers, int64_t
 
     va_list args;
     va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
-    }
+    InlineBuffer<QUBIT *> qubits(numQubits);
+    _collect_qubits(args, qubits);
     va_end(args);
 
-    getQuantumDevicePtr()->NamedOperation("MultiRZ", {theta}, wires,
-                                          /* modifiers */ MODIFIERS_ARGS(modifiers));
+    __catalyst__qis__MultiRZ_array(theta, modifiers, numQubits, qubits.data());
 }
 
 void __catalyst__qis__ISWAP(QUBIT *wire0, QUBIT *wire1, const Modifiers *modifiers)
 {
     RT_FAIL_IF(wire0 == wire1,
                "Invalid input for ISWAP gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation(
-        "ISWAP", {}, {reinterpret_cast<QubitIdType>(wire0), reinterpret_cast<QubitIdType>(wire1)},
-        MODIFIERS_ARGS(modifiers));
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(wire0),
+                                 reinterpret_cast<QubitIdType>(wire1)};
+    getQuantumDevicePtr()->GateOperation(GateId::ISWAP, {}, wires, MODIFIERS_SPANS(modifiers));
 }
 
 void __catalyst__qis__PSWAP(double phi, QUBIT *wire0, QUBIT *wire1, const Modifiers *modifiers)
 {
     RT_FAIL_IF(wire0 == wire1,
                "Invalid input for PSWAP gate. Control and target qubit operands must be distinct.");
-    getQuantumDevicePtr()->NamedOperation(
-        "PSWAP", {phi},
-        {reinterpret_cast<QubitIdType>(wire0), reinterpret_cast<QubitIdType>(wire1)},
-        MODIFIERS_ARGS(modifiers));
+    const double params[] = {phi};
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(wire0),
+                                 reinterpret_cast<QubitIdType>(wire1)};
+    getQuantumDevicePtr()->GateOperation(GateId::PSWAP, params, wires, MODIFIERS_SPANS(modifiers));
 }
 
-void __catalyst__qis__PauliRot(const char *pauliStr, double theta, const Modifiers *modifiers,
-                               bool cond, int64_t numQubits, ...)
+void __catalyst__qis__ApplyBatch(int64_t numGates, const BatchedGate *gates, int64_t numParams,
+                                 const double *params, int64_t numWires, QUBIT **wires)
 {
-    RT_ASSERT(numQubits >= 0);
+    RT_ASSERT(numGates >= 0 && numParams >= 0 && numWires >= 0);
 
-    // convert chat* to string
-    std::string pauliStr_(pauliStr);
-    RT_FAIL_IF(static_cast<size_t>(numQubits) != pauliStr_.size(),
-               "The length of the pauli string must be equal to the number of wires.");
+    int64_t expectedParams = 0;
+    int64_t expectedWires = 0;
+    for (int64_t i = 0; i < numGates; i++) {
+        RT_FAIL_IF(gates[i].opcode < 0 ||
+                       gates[i].opcode >= static_cast<int64_t>(GateId::NumGates),
+                   "Invalid gate opcode in gate batch.");
+        RT_FAIL_IF(gates[i].num_params < 0 || gates[i].num_wires < 0,
+                   "Invalid operand count in gate batch.");
+        expectedParams += gates[i].num_params;
+        expectedWires += gates[i].num_wires;
+    }
+    RT_FAIL_IF(expectedParams != numParams || expectedWires != numWires,
+               "The gate batch operand counts do not match the size of its buffers.");
 
-    va_list args;
-    va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
+    InlineBuffer<QubitIdType, 32> wireIds(numWires);
+    for (int64_t i = 0; i < numWires; i++) {
+        wireIds[i] = reinterpret_cast<QubitIdType>(wires[i]);
     }
-    va_end(args);
+
+    getQuantumDevicePtr()->ApplyOperations({gates, static_cast<size_t>(numGates)},
+                                           {params, static_cast<size_t>(numParams)}, wireIds);
+}
+
+void __catalyst__qis__PauliRot_array(const char *pauliStr, double theta,
+                                     const Modifiers *modifiers, bool cond, int64_t numQubits,
+                                     QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    // convert chat* to string
+    std::string pauliStr_(pauliStr);
+    RT_FAIL_IF(static_cast<size_t>(numQubits) != pauliStr_.size(),
+               "The length of the pauli string must be equal to the number of wires.");
+
+    std::vector<QubitIdType> wires(numQubits);
+    _copy_wires(qubits, wires);
 
     if (!cond) {
         return;
@@ -881,33 +1404,50 @@ void __catalyst__qis__PauliRot(const char *pauliStr, double theta, const Modifie
                                           /* modifiers */ MODIFIERS_ARGS(modifiers), {pauliStr_});
 }
 
-static void _qubitUnitary_impl(MemRefT_CplxT_double_2d *matrix, int64_t numQubits,
-                               std::vector<std::complex<double>> &coeffs,
-                               std::vector<QubitIdType> &wires, va_list *args)
+void __catalyst__qis__PauliRot(const char *pauliStr, double theta, const Modifiers *modifiers,
+                               bool cond, int64_t numQubits, ...)
 {
-    const size_t num_rows = matrix->sizes[0];
-    const size_t num_col = matrix->sizes[1];
-    const size_t expected_size = std::pow(2, numQubits);
+    RT_ASSERT(numQubits >= 0);
 
-    if (num_rows != expected_size || num_col != expected_size) {
-        RT_FAIL("Invalid given QubitUnitary matrix; "
-                "The size of the matrix must be pow(2, numWires) * pow(2, numWires).");
-    }
+    va_list args;
+    va_start(args, numQubits);
+    InlineBuffer<QUBIT *> qubits(numQubits);
+    _collect_qubits(args, qubits);
+    va_end(args);
 
-    wires.reserve(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires.push_back(va_arg(*args, QubitIdType));
-    }
+    __catalyst__qis__PauliRot_array(pauliStr, theta, modifiers, cond, numQubits, qubits.data());
+}
 
-    const size_t matrix_size = num_rows * num_col;
-    coeffs.reserve(matrix_size);
-    for (size_t i = 0; i < matrix_size; i++) {
-        coeffs.emplace_back(matrix->data_aligned[i].real, matrix->data_aligned[i].imag);
+void __catalyst__qis__PackedPauliRot_array(const uint64_t *pauliMasks, double theta,
+                                           const Modifiers *modifiers, bool cond,
+                                           int64_t numQubits, QUBIT **qubits)
+{
+    RT_ASSERT(numQubits >= 0);
+    RT_FAIL_IF(pauliMasks == nullptr, "Invalid (null) packed pauli word provided.");
+
+    if (!cond) {
+        return;
     }
+
+    InlineBuffer<QubitIdType> wires(numQubits);
+    _copy_wires(qubits, wires);
+
+    const size_t numWords = (static_cast<size_t>(numQubits) + 63) / 64;
+    getQuantumDevicePtr()->PackedPauliRot({pauliMasks, 2 * numWords}, theta, wires,
+                                          MODIFIERS_SPANS(modifiers));
 }
 
-void __catalyst__qis__QubitUnitary(MemRefT_CplxT_double_2d *matrix, const Modifiers *modifiers,
-                                   int64_t numQubits, /*qubits*/...)
+static auto _matrix_view(MemRefT_CplxT_double_2d *matrix) -> DataView<std::complex<double>, 2>
+{
+    // CplxT_double is layout-compatible with std::complex<double>
+    return DataView<std::complex<double>, 2>(
+        reinterpret_cast<std::complex<double> *>(matrix->data_aligned), matrix->offset,
+        matrix->sizes, matrix->strides);
+}
+
+void __catalyst__qis__QubitUnitary_array(MemRefT_CplxT_double_2d *matrix,
+                                         const Modifiers *modifiers, int64_t numQubits,
+                                         QUBIT **qubits)
 {
     RT_ASSERT(numQubits >= 0);
 
@@ -919,19 +1459,48 @@ void __catalyst__qis__QubitUnitary(MemRefT_CplxT_double_2d *matrix, const Modifi
         RT_FAIL("Invalid number of wires");
     }
 
+    const size_t num_rows = matrix->sizes[0];
+    const size_t num_col = matrix->sizes[1];
+    const size_t expected_size = std::pow(2, numQubits);
+
+    if (num_rows != expected_size || num_col != expected_size) {
+        RT_FAIL("Invalid given QubitUnitary matrix; "
+                "The size of the matrix must be pow(2, numWires) * pow(2, numWires).");
+    }
+
+    InlineBuffer<QubitIdType> wires(numQubits);
+    _copy_wires(qubits, wires);
+
+    auto matrix_view = _matrix_view(matrix);
+    getQuantumDevicePtr()->MatrixOperationView(matrix_view, wires, MODIFIERS_SPANS(modifiers));
+}
+
+void __catalyst__qis__QubitUnitary(MemRefT_CplxT_double_2d *matrix, const Modifiers *modifiers,
+                                   int64_t numQubits, /*qubits*/...)
+{
+    RT_ASSERT(numQubits >= 0);
+
     va_list args;
-    std::vector<std::complex<double>> coeffs;
-    std::vector<QubitIdType> wires;
     va_start(args, numQubits);
-    _qubitUnitary_impl(matrix, numQubits, coeffs, wires, &args);
+    InlineBuffer<QUBIT *> qubits(numQubits);
+    _collect_qubits(args, qubits);
     va_end(args);
-    return getQuantumDevicePtr()->MatrixOperation(coeffs, wires, MODIFIERS_ARGS(modifiers));
+
+    __catalyst__qis__QubitUnitary_array(matrix, modifiers, numQubits, qubits.data());
 }
 
 ObsIdType __catalyst__qis__NamedObs(int64_t obsId, QUBIT *wire)
 {
-    return getQuantumDevicePtr()->Observable(static_cast<ObsId>(obsId), {},
-                                             {reinterpret_cast<QubitIdType>(wire)});
+    const QubitIdType wires[] = {reinterpret_cast<QubitIdType>(wire)};
+    const auto id = static_cast<ObsId>(obsId);
+    if (!HamiltonianEstimator::isPauli(id)) {
+        return getQuantumDevicePtr()->NamedObservableView(id, wires);
+    }
+
+    const ObsIdType key = createPauliObservable(
+        [&] { return getQuantumDevicePtr()->NamedObservableView(id, wires); });
+    getHamiltonianEstimator().recordNamed(key, id, wires[0]);
+    return key;
 }
 
 ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *matrix, int64_t numQubits, ...)
@@ -953,7 +1522,7 @@ ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *matrix, int64_t
 
     va_list args;
     va_start(args, numQubits);
-    std::vector<QubitIdType> wires(numQubits);
+    InlineBuffer<QubitIdType> wires(numQubits);
     for (int64_t i = 0; i < numQubits; i++) {
         wires[i] = va_arg(args, QubitIdType);
     }
@@ -963,14 +1532,8 @@ ObsIdType __catalyst__qis__HermitianObs(MemRefT_CplxT_double_2d *matrix, int64_t
         RT_FAIL("Invalid number of wires");
     }
 
-    const size_t matrix_size = num_rows * num_col;
-    std::vector<std::complex<double>> coeffs;
-    coeffs.reserve(matrix_size);
-    for (size_t i = 0; i < matrix_size; i++) {
-        coeffs.emplace_back(matrix->data_aligned[i].real, matrix->data_aligned[i].imag);
-    }
-
-    return getQuantumDevicePtr()->Observable(ObsId::Hermitian, coeffs, wires);
+    auto matrix_view = _matrix_view(matrix);
+    return getQuantumDevicePtr()->HermitianObservableView(matrix_view, wires);
 }
 
 ObsIdType __catalyst__qis__TensorObs(int64_t numObs, /*obsKeys*/...)
@@ -981,14 +1544,22 @@ ObsIdType __catalyst__qis__TensorObs(int64_t numObs, /*obsKeys*/...)
 
     va_list args;
     va_start(args, numObs);
-    std::vector<ObsIdType> obsKeys;
-    obsKeys.reserve(numObs);
+    InlineBuffer<ObsIdType> obsKeys(numObs);
     for (int64_t i = 0; i < numObs; i++) {
-        obsKeys.push_back(va_arg(args, ObsIdType));
+        obsKeys[i] = va_arg(args, ObsIdType);
     }
     va_end(args);
 
-    return getQuantumDevicePtr()->TensorObservable(obsKeys);
+    HamiltonianEstimator &estimator = getHamiltonianEstimator();
+    if (!estimator.arePauliWords(obsKeys)) {
+        return getQuantumDevicePtr()->TensorObservableView(obsKeys);
+    }
+
+    const ObsIdType key =
+        createPauliObservable([&] { return getQuantumDevicePtr()->TensorObservableView(obsKeys); });
+    RT_FAIL_IF(!estimator.recordTensor(key, obsKeys) && HamiltonianEstimator::isRuntimeKey(key),
+               "Invalid tensor product of Pauli words acting on the same qubits");
+    return key;
 }
 
 ObsIdType __catalyst__qis__HamiltonianObs(MemRefT_double_1d *coeffs, int64_t numObs,
@@ -1010,19 +1581,27 @@ ObsIdType __catalyst__qis__HamiltonianObs(MemRefT_double_1d *coeffs, int64_t num
 
     va_list args;
     va_start(args, numObs);
-    std::vector<ObsIdType> obsKeys;
-    obsKeys.reserve(numObs);
+    InlineBuffer<ObsIdType> obsKeys(numObs);
     for (int64_t i = 0; i < numObs; i++) {
-        obsKeys.push_back(va_arg(args, ObsIdType));
+        obsKeys[i] = va_arg(args, ObsIdType);
     }
     va_end(args);
 
-    std::vector<double> coeffs_vec(coeffs->data_aligned, coeffs->data_aligned + coeffs_size);
-    return getQuantumDevicePtr()->HamiltonianObservable(coeffs_vec, obsKeys);
+    const std::span<const double> coeffs_view(coeffs->data_aligned, coeffs_size);
+    HamiltonianEstimator &estimator = getHamiltonianEstimator();
+    if (!estimator.arePauliWords(obsKeys)) {
+        return getQuantumDevicePtr()->HamiltonianObservableView(coeffs_view, obsKeys);
+    }
+
+    const ObsIdType key = createPauliObservable(
+        [&] { return getQuantumDevicePtr()->HamiltonianObservableView(coeffs_view, obsKeys); });
+    estimator.recordSum(key, coeffs_view, obsKeys);
+    return key;
 }
 
 RESULT *__catalyst__qis__Measure(QUBIT *wire, int32_t postselect)
 {
+    TraceScope scope(getTracer(), "Measure", "capi");
     std::optional<int32_t> postselectOpt{postselect};
 
     // Any value different to 0 or 1 denotes absence of postselect, and it is hence turned into
@@ -1034,9 +1613,44 @@ RESULT *__catalyst__qis__Measure(QUBIT *wire, int32_t postselect)
     return getQuantumDevicePtr()->Measure(reinterpret_cast<QubitIdType>(wire), postselectOpt);
 }
 
+// Like __catalyst__qis__Measure, but returns the outcome itself rather than a pointer to it.
+bool __catalyst__qis__MeasureBit(QUBIT *wire, int32_t postselect)
+{
+    return *__catalyst__qis__Measure(wire, postselect);
+}
+
+// Measure `num_qubits` qubits whose measurements do not depend on each other's outcome, and pack
+// the outcomes into `bits`, with the outcome of `wires[i]` in bit `i % 64` of word `i / 64`. The
+// unused bits of the last word are cleared.
+void __catalyst__qis__MeasureBits(int64_t num_qubits, QUBIT **wires, const int32_t *postselects,
+                                  uint64_t *bits)
+{
+    TraceScope scope(getTracer(), "MeasureBits", "capi");
+    RT_ASSERT(num_qubits >= 0);
+    const size_t n = static_cast<size_t>(num_qubits);
+
+    std::vector<QubitIdType> wireIds(n);
+    std::vector<std::optional<int32_t>> postselectOpts(n);
+    for (size_t i = 0; i < n; i++) {
+        wireIds[i] = reinterpret_cast<QubitIdType>(wires[i]);
+        if (postselects[i] == 0 || postselects[i] == 1) {
+            postselectOpts[i] = postselects[i];
+        }
+    }
+
+    std::vector<Result> results(n);
+    getQuantumDevicePtr()->MeasureBatch(wireIds, postselectOpts, results);
+
+    std::fill_n(bits, (n + 63) / 64, 0);
+    for (size_t i = 0; i < n; i++) {
+        bits[i / 64] |= static_cast<uint64_t>(*results[i]) << (i % 64);
+    }
+}
+
 RESULT *__catalyst__qis__PauliMeasure(const char *pauliStr, bool negated, const char *pauliStrAlt,
                                       bool negatedAlt, bool selectSwitch, int64_t numQubits, ...)
 {
+    TraceScope scope(getTracer(), "PauliMeasure", "capi");
     RT_ASSERT(numQubits >= 0);
 
     // convert chat* to string
@@ -1069,14 +1683,15 @@ RESULT *__catalyst__qis__PauliMeasure(const char *pauliStr, bool negated, const
     return res;
 }
 
-double __catalyst__qis__Expval(ObsIdType obsKey) { return getQuantumDevicePtr()->Expval(obsKey); }
-
-double __catalyst__qis__Variance(ObsIdType obsKey) { return getQuantumDevicePtr()->Var(obsKey); }
-
-void __catalyst__qis__State(MemRefT_CplxT_double_1d *result, int64_t numQubits, ...)
+RESULT *__catalyst__qis__PackedPauliMeasure(const uint64_t *pauliMasks, bool negated,
+                                            const uint64_t *pauliMasksAlt, bool negatedAlt,
+                                            bool selectSwitch, int64_t numQubits, ...)
 {
+    TraceScope scope(getTracer(), "PauliMeasure", "capi");
     RT_ASSERT(numQubits >= 0);
-    MemRefT<std::complex<double>, 1> *result_p = (MemRefT<std::complex<double>, 1> *)result;
+
+    const uint64_t *masks = selectSwitch ? pauliMasks : pauliMasksAlt;
+    RT_FAIL_IF(masks == nullptr, "Invalid (null) packed pauli word provided.");
 
     va_list args;
     va_start(args, numQubits);
@@ -1086,6 +1701,72 @@ void __catalyst__qis__State(MemRefT_CplxT_double_1d *result, int64_t numQubits,
     }
     va_end(args);
 
+    const size_t numWords = (static_cast<size_t>(numQubits) + 63) / 64;
+    RESULT *res = getQuantumDevicePtr()->PackedPauliMeasure({masks, 2 * numWords}, wires);
+    if (selectSwitch ? negated : negatedAlt) {
+        // Can't assume the result is writable, so flip using our constants.
+        res = *res ? __catalyst__rt__result_get_zero() : __catalyst__rt__result_get_one();
+    }
+
+    return res;
+}
+
+double __catalyst__qis__Expval(ObsIdType obsKey)
+{
+    TraceScope scope(getTracer(), "Expval", "capi");
+    return measureObservable(obsKey, false, [&] { return getQuantumDevicePtr()->Expval(obsKey); });
+}
+
+double __catalyst__qis__Variance(ObsIdType obsKey)
+{
+    TraceScope scope(getTracer(), "Variance", "capi");
+    return measureObservable(obsKey, true, [&] { return getQuantumDevicePtr()->Var(obsKey); });
+}
+
+void __catalyst__qis__ExpvalVar(double *result, ObsIdType obsKey)
+{
+    TraceScope scope(getTracer(), "ExpvalVar", "capi");
+    if (isDeviceObservable(obsKey)) {
+        std::tie(result[0], result[1]) = getQuantumDevicePtr()->ExpvalVar(obsKey);
+        return;
+    }
+    result[0] = __catalyst__qis__Expval(obsKey);
+    result[1] = __catalyst__qis__Variance(obsKey);
+}
+
+void __catalyst__qis__Expvals(double *result, int64_t numObs, /*obsKeys*/...)
+{
+    TraceScope scope(getTracer(), "Expvals", "capi");
+    RT_ASSERT(numObs >= 0);
+
+    va_list args;
+    va_start(args, numObs);
+    InlineBuffer<ObsIdType> obsKeys(numObs);
+    for (int64_t i = 0; i < numObs; i++) {
+        obsKeys[i] = va_arg(args, ObsIdType);
+    }
+    va_end(args);
+
+    const std::span<const ObsIdType> keys = obsKeys;
+    if (std::all_of(keys.begin(), keys.end(), isDeviceObservable)) {
+        getQuantumDevicePtr()->Expvals(keys, std::span<double>(result, keys.size()));
+        return;
+    }
+    for (size_t i = 0; i < keys.size(); i++) {
+        result[i] = __catalyst__qis__Expval(keys[i]);
+    }
+}
+
+void __catalyst__qis__State_array(MemRefT_CplxT_double_1d *result, int64_t numQubits,
+                                  QUBIT **qubits)
+{
+    TraceScope scope(getTracer(), "State", "capi");
+    RT_ASSERT(numQubits >= 0);
+    MemRefT<std::complex<double>, 1> *result_p = (MemRefT<std::complex<double>, 1> *)result;
+
+    std::vector<QubitIdType> wires(numQubits);
+    _copy_wires(qubits, wires);
+
     DataView<std::complex<double>, 1> view(result_p->data_aligned, result_p->offset,
                                            result_p->sizes, result_p->strides);
 
@@ -1097,8 +1778,47 @@ void __catalyst__qis__State(MemRefT_CplxT_double_1d *result, int64_t numQubits,
     }
 }
 
-void __catalyst__qis__Probs(MemRefT_double_1d *result, int64_t numQubits, ...)
+void __catalyst__qis__State(MemRefT_CplxT_double_1d *result, int64_t numQubits, ...)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    va_list args;
+    va_start(args, numQubits);
+    InlineBuffer<QUBIT *> qubits(numQubits);
+    _collect_qubits(args, qubits);
+    va_end(args);
+
+    __catalyst__qis__State_array(result, numQubits, qubits.data());
+}
+
+/**
+ * Point `result` to the state vector stored by the active device, without copying it.
+ *
+ * The memref is borrowed: it must not be freed or written to, and it is only valid until the next
+ * operation on the device. Returns false, leaving `result` unchanged, if the device does not lend
+ * its storage, in which case the state is to be read with `__catalyst__qis__State`.
+ */
+bool __catalyst__qis__StateView(MemRefT_CplxT_double_1d *result)
 {
+    const size_t num_wires = getQuantumDevicePtr()->GetNumQubits();
+    std::span<const std::complex<double>> state = getQuantumDevicePtr()->GetStateView();
+    if (state.empty()) {
+        return false;
+    }
+    RT_FAIL_IF(state.size() != (1UL << num_wires), "Invalid size for the borrowed state vector");
+
+    auto *data = reinterpret_cast<CplxT_double *>(const_cast<std::complex<double> *>(state.data()));
+    result->data_allocated = data;
+    result->data_aligned = data;
+    result->offset = 0;
+    result->sizes[0] = state.size();
+    result->strides[0] = 1;
+    return true;
+}
+
+void __catalyst__qis__Probs_array(MemRefT_double_1d *result, int64_t numQubits, QUBIT **qubits)
+{
+    TraceScope scope(getTracer(), "Probs", "capi");
     RT_ASSERT(numQubits >= 0);
     std::string error_msg = "return tensor must have length equal to 2^(number of qubits)";
     if (numQubits != 0) {
@@ -1107,13 +1827,8 @@ void __catalyst__qis__Probs(MemRefT_double_1d *result, int64_t numQubits, ...)
 
     MemRefT<double, 1> *result_p = (MemRefT<double, 1> *)result;
 
-    va_list args;
-    va_start(args, numQubits);
     std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
-    }
-    va_end(args);
+    _copy_wires(qubits, wires);
 
     DataView<double, 1> view(result_p->data_aligned, result_p->offset, result_p->sizes,
                              result_p->strides);
@@ -1126,9 +1841,23 @@ void __catalyst__qis__Probs(MemRefT_double_1d *result, int64_t numQubits, ...)
     }
 }
 
-void __catalyst__qis__Sample(MemRefT_double_2d *result, int64_t numQubits, ...)
+void __catalyst__qis__Probs(MemRefT_double_1d *result, int64_t numQubits, ...)
 {
     RT_ASSERT(numQubits >= 0);
+
+    va_list args;
+    va_start(args, numQubits);
+    InlineBuffer<QUBIT *> qubits(numQubits);
+    _collect_qubits(args, qubits);
+    va_end(args);
+
+    __catalyst__qis__Probs_array(result, numQubits, qubits.data());
+}
+
+void __catalyst__qis__Sample_array(MemRefT_double_2d *result, int64_t numQubits, QUBIT **qubits)
+{
+    TraceScope scope(getTracer(), "Sample", "capi");
+    RT_ASSERT(numQubits >= 0);
     std::string error_msg = "return tensor must have 2D shape equal to (number of shots, "
                             "number of qubits in observable)";
     if (numQubits != 0) {
@@ -1138,13 +1867,8 @@ void __catalyst__qis__Sample(MemRefT_double_2d *result, int64_t numQubits, ...)
     }
     MemRefT<double, 2> *result_p = (MemRefT<double, 2> *)result;
 
-    va_list args;
-    va_start(args, numQubits);
     std::vector<QubitIdType> wires(numQubits);
-    for (int64_t i = 0; i < numQubits; i++) {
-        wires[i] = va_arg(args, QubitIdType);
-    }
-    va_end(args);
+    _copy_wires(qubits, wires);
 
     DataView<double, 2> view(result_p->data_aligned, result_p->offset, result_p->sizes,
                              result_p->strides);
@@ -1157,17 +1881,70 @@ void __catalyst__qis__Sample(MemRefT_double_2d *result, int64_t numQubits, ...)
     }
 }
 
-void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *result, int64_t numQubits, ...)
+void __catalyst__qis__Sample(MemRefT_double_2d *result, int64_t numQubits, ...)
 {
     RT_ASSERT(numQubits >= 0);
-    RT_ASSERT(result->first.sizes[0] == result->second.sizes[0]);
-    std::string error_msg = "number of eigenvalues or counts did not match observable";
-    if (numQubits != 0) {
-        RT_FAIL_IF(result->first.sizes[0] != 1u << numQubits, error_msg.c_str());
+
+    va_list args;
+    va_start(args, numQubits);
+    InlineBuffer<QUBIT *> qubits(numQubits);
+    _collect_qubits(args, qubits);
+    va_end(args);
+
+    __catalyst__qis__Sample_array(result, numQubits, qubits.data());
+}
+
+void __catalyst__qis__SampleChunked(SampleChunkCallback callback, void *context,
+                                    int64_t chunkShots, int64_t numQubits, ...)
+{
+    TraceScope scope(getTracer(), "SampleChunked", "capi");
+    RT_ASSERT(numQubits >= 0);
+    RT_FAIL_IF(callback == nullptr, "Invalid sample chunk callback");
+    RT_FAIL_IF(chunkShots <= 0, "The number of shots per sample chunk must be positive");
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires(numQubits);
+    for (int64_t i = 0; i < numQubits; i++) {
+        wires[i] = va_arg(args, QubitIdType);
     }
+    va_end(args);
 
-    MemRefT<double, 1> *result_eigvals_p = (MemRefT<double, 1> *)&result->first;
-    MemRefT<int64_t, 1> *result_counts_p = (MemRefT<int64_t, 1> *)&result->second;
+    const int64_t numWires =
+        wires.empty() ? static_cast<int64_t>(getQuantumDevicePtr()->GetNumQubits()) : numQubits;
+    getQuantumDevicePtr()->SampleChunked(
+        wires, static_cast<size_t>(chunkShots), [&](DataView<double, 2> &chunk, size_t shots) {
+            callback(context, chunk.data(), static_cast<int64_t>(shots), numWires);
+        });
+}
+
+void __catalyst__qis__PackedSample(MemRefT_int64_2d *result, int64_t numQubits, ...)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    va_list args;
+    va_start(args, numQubits);
+    std::vector<QubitIdType> wires(numQubits);
+    for (int64_t i = 0; i < numQubits; i++) {
+        wires[i] = va_arg(args, QubitIdType);
+    }
+    va_end(args);
+
+    const size_t numWires = wires.empty() ? getQuantumDevicePtr()->GetNumQubits() : wires.size();
+    RT_FAIL_IF(result->sizes[0] != getQuantumDevicePtr()->GetDeviceShots() ||
+                   result->sizes[1] != (numWires + 63) / 64,
+               "return tensor must have 2D shape equal to (number of shots, number of 64-bit "
+               "words per shot)");
+
+    // The packed words are carried as i64 by the compiler and read as unsigned bit fields here.
+    DataView<uint64_t, 2> view(reinterpret_cast<uint64_t *>(result->data_aligned), result->offset,
+                               result->sizes, result->strides);
+    getQuantumDevicePtr()->PackedSample(view, wires);
+}
+
+int64_t __catalyst__qis__SubmitSample(int64_t numQubits, ...)
+{
+    RT_ASSERT(numQubits >= 0);
 
     va_list args;
     va_start(args, numQubits);
@@ -1177,6 +1954,39 @@ void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *result, int64_t numQ
     }
     va_end(args);
 
+    return CTX->addPendingJob(getQuantumDevicePtr()->SubmitSample(wires));
+}
+
+void __catalyst__qis__AwaitSample(MemRefT_double_2d *result, int64_t job)
+{
+    const std::vector<double> samples = CTX->takePendingJob(job).get();
+    RT_FAIL_IF(result->sizes[0] * result->sizes[1] != samples.size(),
+               "return tensor must have 2D shape equal to (number of shots, "
+               "number of qubits in observable)");
+
+    MemRefT<double, 2> *result_p = (MemRefT<double, 2> *)result;
+    DataView<double, 2> view(result_p->data_aligned, result_p->offset, result_p->sizes,
+                             result_p->strides);
+    view.copy_from(samples.begin());
+}
+
+void __catalyst__qis__Counts_array(PairT_MemRefT_double_int64_1d *result, int64_t numQubits,
+                                   QUBIT **qubits)
+{
+    TraceScope scope(getTracer(), "Counts", "capi");
+    RT_ASSERT(numQubits >= 0);
+    RT_ASSERT(result->first.sizes[0] == result->second.sizes[0]);
+    std::string error_msg = "number of eigenvalues or counts did not match observable";
+    if (numQubits != 0) {
+        RT_FAIL_IF(result->first.sizes[0] != 1u << numQubits, error_msg.c_str());
+    }
+
+    MemRefT<double, 1> *result_eigvals_p = (MemRefT<double, 1> *)&result->first;
+    MemRefT<int64_t, 1> *result_counts_p = (MemRefT<int64_t, 1> *)&result->second;
+
+    std::vector<QubitIdType> wires(numQubits);
+    _copy_wires(qubits, wires);
+
     DataView<double, 1> eigvals_view(result_eigvals_p->data_aligned, result_eigvals_p->offset,
                                      result_eigvals_p->sizes, result_eigvals_p->strides);
     DataView<int64_t, 1> counts_view(result_counts_p->data_aligned, result_counts_p->offset,
@@ -1190,48 +2000,59 @@ void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *result, int64_t numQ
     }
 }
 
+void __catalyst__qis__Counts(PairT_MemRefT_double_int64_1d *result, int64_t numQubits, ...)
+{
+    RT_ASSERT(numQubits >= 0);
+
+    va_list args;
+    va_start(args, numQubits);
+    InlineBuffer<QUBIT *> qubits(numQubits);
+    _collect_qubits(args, qubits);
+    va_end(args);
+
+    __catalyst__qis__Counts_array(result, numQubits, qubits.data());
+}
+
 int64_t __catalyst__rt__array_get_size_1d(QirArray *ptr)
 {
-    std::vector<QubitIdType> *qubit_vector_ptr = reinterpret_cast<std::vector<QubitIdType> *>(ptr);
-    return qubit_vector_ptr->size();
+    return QubitArray::fromQirArray(ptr)->getSize();
 }
 
 int8_t *__catalyst__rt__array_get_element_ptr_1d(QirArray *ptr, int64_t idx)
 {
-    std::vector<QubitIdType> *qubit_vector_ptr = reinterpret_cast<std::vector<QubitIdType> *>(ptr);
+    QubitArray *qubit_array = QubitArray::fromQirArray(ptr);
 
     RT_ASSERT(idx >= 0);
-    std::string error_msg = "The qubit register does not contain the requested wire: ";
-    error_msg += std::to_string(idx);
 
-    if (static_cast<size_t>(idx) >= qubit_vector_ptr->size()) {
+    if (static_cast<size_t>(idx) >= qubit_array->getSize()) {
         if (!RTD_PTR->getQubitManagementMode()) {
+            std::string error_msg = "The qubit register does not contain the requested wire: ";
+            error_msg += std::to_string(idx);
             RT_FAIL(error_msg.c_str());
         }
         else {
-            autoQubitManagementAllocate(qubit_vector_ptr, idx);
+            autoQubitManagementAllocate(qubit_array, idx);
         }
     }
 
-    QubitIdType *data = qubit_vector_ptr->data();
-    return (int8_t *)&data[idx];
+    return (int8_t *)&qubit_array->getData()[idx];
 }
 
 void __catalyst__rt__array_update_element_1d(QirArray *ptr, int64_t idx, QUBIT *qubit)
 {
     RT_ASSERT(getQuantumDevicePtr() != nullptr);
     RT_ASSERT(CTX->getMemoryManager() != nullptr);
-    std::vector<QubitIdType> *qubit_vector_ptr = reinterpret_cast<std::vector<QubitIdType> *>(ptr);
+    QubitArray *qubit_array = QubitArray::fromQirArray(ptr);
 
     RT_ASSERT(idx >= 0);
 
-    if (static_cast<size_t>(idx) >= qubit_vector_ptr->size()) {
+    if (static_cast<size_t>(idx) >= qubit_array->getSize()) {
         std::string error_msg = "The qubit register does not contain the requested wire: ";
         error_msg += std::to_string(idx);
         RT_FAIL(error_msg.c_str());
     }
 
-    QubitIdType *data = qubit_vector_ptr->data();
+    QubitIdType *data = qubit_array->getData();
     const QubitIdType qubit_id = reinterpret_cast<QubitIdType>(qubit);
     const QubitIdType current_qubit_id = data[idx];
 
@@ -1272,4 +2093,152 @@ RESULT *__catalyst__mbqc__measure_in_basis(QUBIT *wire, uint32_t plane, double a
 
     return getQuantumDevicePtr()->Measure(reinterpret_cast<QubitIdType>(wire), postselectOpt);
 }
+
+// Like __catalyst__mbqc__measure_in_basis, for `num_qubits` measurements that do not depend on
+// each other's outcome. The planes and angles are likewise ignored.
+void __catalyst__mbqc__measure_in_basis_array(int64_t num_qubits, QUBIT **wires,
+                                              [[maybe_unused]] const uint32_t *planes,
+                                              [[maybe_unused]] const double *angles,
+                                              const int32_t *postselects, RESULT **results)
+{
+    RT_ASSERT(num_qubits >= 0);
+    const size_t n = static_cast<size_t>(num_qubits);
+
+    std::vector<QubitIdType> wireIds(n);
+    std::vector<std::optional<int32_t>> postselectOpts(n);
+    for (size_t i = 0; i < n; i++) {
+        wireIds[i] = reinterpret_cast<QubitIdType>(wires[i]);
+        if (postselects[i] == 0 || postselects[i] == 1) {
+            postselectOpts[i] = postselects[i];
+        }
+    }
+
+    getQuantumDevicePtr()->MeasureBatch(wireIds, postselectOpts, std::span<Result>(results, n));
+}
+
+// -------------------------------------------------------------------------- //
+// Pauli Frame Runtime CAPI
+// -------------------------------------------------------------------------- //
+
+// The Pauli records are tracked by the runtime itself, so that Pauli gates and the frame updates
+// of Clifford gates never reach the device. Records are returned to compiled code as a byte with
+// the X-parity bit in bit 0 and the Z-parity bit in bit 1.
+
+void __catalyst__pf__init(QUBIT *qubit)
+{
+    const auto wire = reinterpret_cast<QubitIdType>(qubit);
+    getPauliFrame().init({&wire, 1});
+}
+
+void __catalyst__pf__init_qreg(QirArray *qreg)
+{
+    getPauliFrame().init(QubitArray::fromQirArray(qreg)->getIds());
+}
+
+void __catalyst__pf__set(QUBIT *qubit, bool x_parity, bool z_parity)
+{
+    const auto wire = reinterpret_cast<QubitIdType>(qubit);
+    getPauliFrame().set({&wire, 1}, x_parity, z_parity);
+}
+
+void __catalyst__pf__update(QUBIT *qubit, bool x_parity, bool z_parity)
+{
+    const auto wire = reinterpret_cast<QubitIdType>(qubit);
+    getPauliFrame().update({&wire, 1}, x_parity, z_parity);
+}
+
+// The second qubit is only used by two-qubit gates. Qubit pointers hold qubit IDs, so a null
+// pointer is the qubit of ID 0, and the number of qubits is passed explicitly.
+void __catalyst__pf__update_with_clifford(uint32_t gate, int64_t numQubits, QUBIT *qubit,
+                                          QUBIT *other)
+{
+    RT_FAIL_IF(numQubits < 1 || numQubits > 2, "Invalid number of qubits for a Clifford gate");
+
+    const std::array<QubitIdType, 2> wires = {reinterpret_cast<QubitIdType>(qubit),
+                                              reinterpret_cast<QubitIdType>(other)};
+    getPauliFrame().applyClifford(static_cast<CliffordGate>(gate),
+                                  {wires.data(), static_cast<size_t>(numQubits)});
+}
+
+uint8_t __catalyst__pf__read(QUBIT *qubit)
+{
+    return encodePauliRecord(getPauliFrame().read(reinterpret_cast<QubitIdType>(qubit)));
+}
+
+uint8_t __catalyst__pf__flush(QUBIT *qubit)
+{
+    return encodePauliRecord(getPauliFrame().flush(reinterpret_cast<QubitIdType>(qubit)));
+}
+
+bool __catalyst__pf__correct_measurement(bool mres, QUBIT *qubit)
+{
+    return getPauliFrame().correctMeasurement(reinterpret_cast<QubitIdType>(qubit), mres);
+}
+
+// -------------------------------------------------------------------------- //
+// QEC Decoding Runtime CAPI
+// -------------------------------------------------------------------------- //
+
+// Syndromes are decoded by the decoders of the active device, which are returned to compiled code
+// as keys. Syndrome rounds are bit-packed, with check `i` at bit `i % 64` of word `i / 64` of the
+// round, and the corrections of a round are the indices of the codeblock qubits to correct,
+// padded with -1.
+
+int64_t __catalyst__qecp__decoder_create(const void *row_idx, int64_t row_idx_size,
+                                         const void *col_ptr, int64_t col_ptr_size,
+                                         int64_t bit_width)
+{
+    return getDecoders().addTannerGraph(readIntegers(row_idx, row_idx_size, bit_width),
+                                        readIntegers(col_ptr, col_ptr_size, bit_width));
+}
+
+int64_t __catalyst__qecp__decoder_register(SyndromeDecoderCallback callback, void *context,
+                                           int64_t max_corrections)
+{
+    RT_FAIL_IF(max_corrections < 0, "Invalid maximum number of corrections");
+    return getDecoders().add(std::make_unique<CallbackDecoder>(
+        callback, context, static_cast<size_t>(max_corrections)));
+}
+
+void __catalyst__qecp__decoder_push(int64_t decoder, const uint64_t *rounds, int64_t num_checks,
+                                    int64_t num_rounds)
+{
+    RT_FAIL_IF(num_checks < 0 || num_rounds < 0, "Invalid size for the syndrome rounds");
+    const size_t num_words = static_cast<size_t>(num_checks + 63) / 64;
+    getDecoders().get(decoder).push({rounds, num_words * static_cast<size_t>(num_rounds)},
+                                    static_cast<size_t>(num_checks),
+                                    static_cast<size_t>(num_rounds));
+}
+
+int64_t __catalyst__qecp__decoder_pull(int64_t decoder, int64_t *corrections, int64_t size)
+{
+    RT_FAIL_IF(size < 0, "Invalid size for the corrections");
+    return static_cast<int64_t>(
+        getDecoders().get(decoder).pull({corrections, static_cast<size_t>(size)}));
+}
+
+// Decodes a single round given as one byte per check, e.g. the measurement results of the
+// auxiliary qubits of the checks, and writes its first `num_corrections` corrections.
+void __catalyst__qecp__decode_esm(int64_t decoder, const bool *esm, int64_t num_checks,
+                                  int64_t *corrections, int64_t num_corrections)
+{
+    RT_FAIL_IF(num_checks < 0 || num_corrections < 0, "Invalid size for the syndrome decoding");
+    const size_t checks = static_cast<size_t>(num_checks);
+    InlineBuffer<uint64_t> syndrome((checks + 63) / 64);
+    std::fill_n(syndrome.data(), syndrome.size(), 0);
+    for (size_t check = 0; check < checks; check++) {
+        syndrome[check / 64] |= static_cast<uint64_t>(esm[check]) << (check % 64);
+    }
+
+    DecoderStream &stream = getDecoders().get(decoder);
+    RT_FAIL_IF(stream.getNumPending() != 0,
+               "The corrections of the syndrome decoder were not pulled");
+    stream.push(syndrome, checks, 1);
+    InlineBuffer<int64_t> decoded(stream.getMaxCorrections());
+    stream.pull({decoded.data(), decoded.size()});
+
+    std::fill_n(corrections, num_corrections, -1);
+    std::copy_n(decoded.data(), std::min(decoded.size(), static_cast<size_t>(num_corrections)),
+                corrections);
+}
 }
@@ -0,0 +1,355 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "QuantumDevice.hpp"
+
+namespace Catalyst::Runtime {
+
+/**
+ * A device decorator that rejects a one-shot execution as soon as one of its postselected
+ * measurements fails, instead of simulating the rest of the shot only to discard it.
+ *
+ * Postselected measurements are sampled by the device without postselection, as on hardware. If
+ * the outcome differs from the postselected value, the shot is rejected: the remaining gates and
+ * measurements of the shot are skipped and measurements return 0. Measurement processes are still
+ * forwarded to the device, so that the caller gets well-formed results, which it is expected to
+ * discard after checking `isRejected`. The rejection is cleared by `startShot`.
+ */
+class ShotRejectionDevice final : public QuantumDevice {
+  private:
+    std::unique_ptr<QuantumDevice> device;
+    bool enabled{false};
+    bool rejected{false};
+    RESULT skipped_result{false};
+
+  public:
+    explicit ShotRejectionDevice(std::unique_ptr<QuantumDevice> device) : device(std::move(device))
+    {
+    }
+
+    void setEnabled(bool _enabled) noexcept { enabled = _enabled; }
+
+    void startShot() noexcept { rejected = false; }
+
+    [[nodiscard]] auto isRejected() const noexcept -> bool { return rejected; }
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> override
+    {
+        return device->AllocateQubits(num_qubits);
+    }
+
+    void AllocateQubitsInPlace(std::span<QubitIdType> ids) override
+    {
+        device->AllocateQubitsInPlace(ids);
+    }
+
+    void ReleaseQubits(const std::vector<QubitIdType> &qubits) override
+    {
+        device->ReleaseQubits(qubits);
+    }
+
+    auto GetNumQubits() const -> size_t override { return device->GetNumQubits(); }
+
+    auto AllocateQubit() -> QubitIdType override { return device->AllocateQubit(); }
+
+    void ReleaseQubit(QubitIdType qubit) override { device->ReleaseQubit(qubit); }
+
+    void SetDeviceShots(size_t shots) override { device->SetDeviceShots(shots); }
+
+    auto GetDeviceShots() const -> size_t override { return device->GetDeviceShots(); }
+
+    void SetDevicePRNG(std::mt19937 *gen) override { device->SetDevicePRNG(gen); }
+
+    void SetDeviceStreamPRNG(const PhiloxEngine &engine) override
+    {
+        device->SetDeviceStreamPRNG(engine);
+    }
+
+    void NamedOperation(const std::string &name, const std::vector<double> &params,
+                        const std::vector<QubitIdType> &wires, bool inverse,
+                        const std::vector<QubitIdType> &controlled_wires,
+                        const std::vector<bool> &controlled_values,
+                        const std::vector<std::string> &optional_params) override
+    {
+        if (!rejected) {
+            device->NamedOperation(name, params, wires, inverse, controlled_wires,
+                                   controlled_values, optional_params);
+        }
+    }
+
+    void GateOperation(GateId id, std::span<const double> params,
+                       std::span<const QubitIdType> wires, bool inverse,
+                       std::span<const QubitIdType> controlled_wires,
+                       std::span<const bool> controlled_values) override
+    {
+        if (!rejected) {
+            device->GateOperation(id, params, wires, inverse, controlled_wires, controlled_values);
+        }
+    }
+
+    void PackedPauliRot(std::span<const uint64_t> pauli_masks, double theta,
+                        std::span<const QubitIdType> wires, bool inverse,
+                        std::span<const QubitIdType> controlled_wires,
+                        std::span<const bool> controlled_values) override
+    {
+        if (!rejected) {
+            device->PackedPauliRot(pauli_masks, theta, wires, inverse, controlled_wires,
+                                   controlled_values);
+        }
+    }
+
+    void ApplyOperations(std::span<const BatchedGate> gates, std::span<const double> params,
+                         std::span<const QubitIdType> wires) override
+    {
+        if (!rejected) {
+            device->ApplyOperations(gates, params, wires);
+        }
+    }
+
+    auto Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result override
+    {
+        if (rejected) {
+            skipped_result = false;
+            return &skipped_result;
+        }
+        if (!enabled || !postselect) {
+            return device->Measure(wire, postselect);
+        }
+
+        Result result = device->Measure(wire, std::nullopt);
+        rejected = static_cast<int32_t>(*result) != *postselect;
+        return result;
+    }
+
+    void MeasureBatch(std::span<const QubitIdType> wires,
+                      std::span<const std::optional<int32_t>> postselects,
+                      std::span<Result> results) override
+    {
+        if (!enabled) {
+            device->MeasureBatch(wires, postselects, results);
+            return;
+        }
+        for (size_t i = 0; i < wires.size(); i++) {
+            results[i] = Measure(wires[i], postselects[i]);
+        }
+    }
+
+    void MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                         const std::vector<QubitIdType> &wires, bool inverse,
+                         const std::vector<QubitIdType> &controlled_wires,
+                         const std::vector<bool> &controlled_values) override
+    {
+        if (!rejected) {
+            device->MatrixOperation(matrix, wires, inverse, controlled_wires, controlled_values);
+        }
+    }
+
+    void MatrixOperationView(DataView<std::complex<double>, 2> &matrix,
+                             std::span<const QubitIdType> wires, bool inverse,
+                             std::span<const QubitIdType> controlled_wires,
+                             std::span<const bool> controlled_values) override
+    {
+        if (!rejected) {
+            device->MatrixOperationView(matrix, wires, inverse, controlled_wires,
+                                        controlled_values);
+        }
+    }
+
+    void SetBasisState(DataView<int8_t, 1> &n, std::vector<QubitIdType> &wires) override
+    {
+        if (!rejected) {
+            device->SetBasisState(n, wires);
+        }
+    }
+
+    void SetState(DataView<std::complex<double>, 1> &state,
+                  std::vector<QubitIdType> &wires) override
+    {
+        if (!rejected) {
+            device->SetState(state, wires);
+        }
+    }
+
+    void SetBasisStateIndex(uint64_t index, std::vector<QubitIdType> &wires) override
+    {
+        if (!rejected) {
+            device->SetBasisStateIndex(index, wires);
+        }
+    }
+
+    void SetSparseState(std::span<const int64_t> indices,
+                        std::span<const std::complex<double>> amplitudes,
+                        std::vector<QubitIdType> &wires) override
+    {
+        if (!rejected) {
+            device->SetSparseState(indices, amplitudes, wires);
+        }
+    }
+
+    auto Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
+                    const std::vector<QubitIdType> &wires) -> ObsIdType override
+    {
+        return device->Observable(id, matrix, wires);
+    }
+
+    auto HermitianObservableView(DataView<std::complex<double>, 2> &matrix,
+                                 std::span<const QubitIdType> wires) -> ObsIdType override
+    {
+        return device->HermitianObservableView(matrix, wires);
+    }
+
+    auto TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType override
+    {
+        return device->TensorObservable(obs);
+    }
+
+    auto HamiltonianObservable(const std::vector<double> &coeffs, const std::vector<ObsIdType> &obs)
+        -> ObsIdType override
+    {
+        return device->HamiltonianObservable(coeffs, obs);
+    }
+
+    auto NamedObservableView(ObsId id, std::span<const QubitIdType> wires) -> ObsIdType override
+    {
+        return device->NamedObservableView(id, wires);
+    }
+
+    auto TensorObservableView(std::span<const ObsIdType> obs) -> ObsIdType override
+    {
+        return device->TensorObservableView(obs);
+    }
+
+    auto HamiltonianObservableView(std::span<const double> coeffs, std::span<const ObsIdType> obs)
+        -> ObsIdType override
+    {
+        return device->HamiltonianObservableView(coeffs, obs);
+    }
+
+    void Sample(DataView<double, 2> &samples) override { device->Sample(samples); }
+
+    void PartialSample(DataView<double, 2> &samples, const std::vector<QubitIdType> &wires) override
+    {
+        device->PartialSample(samples, wires);
+    }
+
+    void SampleChunked(const std::vector<QubitIdType> &wires, size_t chunk_shots,
+                       const std::function<void(DataView<double, 2> &, size_t)> &callback) override
+    {
+        device->SampleChunked(wires, chunk_shots, callback);
+    }
+
+    void PackedSample(DataView<uint64_t, 2> &samples,
+                      const std::vector<QubitIdType> &wires) override
+    {
+        device->PackedSample(samples, wires);
+    }
+
+    auto SubmitSample(const std::vector<QubitIdType> &wires)
+        -> std::future<std::vector<double>> override
+    {
+        return device->SubmitSample(wires);
+    }
+
+    void Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts) override
+    {
+        device->Counts(eigvals, counts);
+    }
+
+    void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                       const std::vector<QubitIdType> &wires) override
+    {
+        device->PartialCounts(eigvals, counts, wires);
+    }
+
+    void Probs(DataView<double, 1> &probs) override { device->Probs(probs); }
+
+    void PartialProbs(DataView<double, 1> &probs, const std::vector<QubitIdType> &wires) override
+    {
+        device->PartialProbs(probs, wires);
+    }
+
+    auto Expval(ObsIdType obsKey) -> double override { return device->Expval(obsKey); }
+
+    auto Var(ObsIdType obsKey) -> double override { return device->Var(obsKey); }
+
+    auto ExpvalVar(ObsIdType obsKey) -> std::pair<double, double> override
+    {
+        return device->ExpvalVar(obsKey);
+    }
+
+    void Expvals(std::span<const ObsIdType> obsKeys, std::span<double> expvals) override
+    {
+        device->Expvals(obsKeys, expvals);
+    }
+
+    void State(DataView<std::complex<double>, 1> &state) override { device->State(state); }
+
+    auto GetStateView() const -> std::span<const std::complex<double>> override
+    {
+        return device->GetStateView();
+    }
+
+    auto PauliMeasure(const std::string &pauli_word, const std::vector<QubitIdType> &wires)
+        -> Result override
+    {
+        if (rejected) {
+            skipped_result = false;
+            return &skipped_result;
+        }
+        return device->PauliMeasure(pauli_word, wires);
+    }
+
+    auto PackedPauliMeasure(std::span<const uint64_t> pauli_masks,
+                            const std::vector<QubitIdType> &wires) -> Result override
+    {
+        if (rejected) {
+            skipped_result = false;
+            return &skipped_result;
+        }
+        return device->PackedPauliMeasure(pauli_masks, wires);
+    }
+
+    void Gradient(std::vector<DataView<double, 1>> &gradients,
+                  const std::vector<size_t> &trainParams) override
+    {
+        device->Gradient(gradients, trainParams);
+    }
+
+    void StartTapeRecording() override { device->StartTapeRecording(); }
+
+    void StopTapeRecording() override { device->StopTapeRecording(); }
+
+    void SetTapeCheckpointInterval(size_t interval) override
+    {
+        device->SetTapeCheckpointInterval(interval);
+    }
+
+    void StartBatch(size_t batch_size) override { device->StartBatch(batch_size); }
+
+    void EndBatch() override { device->EndBatch(); }
+};
+
+} // namespace Catalyst::Runtime
@@ -0,0 +1,290 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+#include "Types.h"
+
+namespace Catalyst::Runtime {
+
+/**
+ * A decoder of the error-syndrome measurements (ESM) of a QEC code.
+ *
+ * Syndromes are bit-packed, with check `i` of a round at bit `i % 64` of word `i / 64`. The
+ * corrections of a round are the indices in the codeblock of the qubits to correct, padded with
+ * -1 up to the maximum number of corrections of the decoder.
+ */
+class SyndromeDecoder {
+  public:
+    SyndromeDecoder() = default;
+    virtual ~SyndromeDecoder() = default;
+
+    SyndromeDecoder(const SyndromeDecoder &) = delete;
+    SyndromeDecoder &operator=(const SyndromeDecoder &) = delete;
+    SyndromeDecoder(SyndromeDecoder &&) = delete;
+    SyndromeDecoder &operator=(SyndromeDecoder &&) = delete;
+
+    [[nodiscard]] virtual auto getMaxCorrections() const -> size_t = 0;
+
+    /**
+     * @brief Decode one round of `num_checks` syndrome bits into `corrections`, of size
+     * `getMaxCorrections()`.
+     */
+    virtual void decode(std::span<const uint64_t> syndrome, size_t num_checks,
+                        std::span<int64_t> corrections) = 0;
+};
+
+/**
+ * The default decoder of a CSS code, given the Tanner graph of its X or Z checks, which corrects
+ * the errors on a single data qubit.
+ *
+ * The Tanner graph is the adjacency matrix in CSC form of the data qubits followed by the
+ * auxiliary qubits of the checks, so that the data qubits of a code with `num_checks` checks are
+ * the first `num_vertices - num_checks` columns. The syndrome of each data qubit is tabulated on
+ * the first round, after which decoding a round is a single table lookup when the syndrome fits
+ * in a word, or a scan of the packed syndromes of the data qubits otherwise.
+ */
+class TannerGraphDecoder final : public SyndromeDecoder {
+  private:
+    std::vector<int64_t> row_idx;
+    std::vector<int64_t> col_ptr;
+
+    size_t num_checks{0};
+    size_t num_words{0};
+    // The packed syndrome of each data qubit, `num_words` words per qubit
+    std::vector<uint64_t> qubit_syndromes;
+    // The data qubit of each single-word syndrome
+    std::unordered_map<uint64_t, int64_t> qubit_lookup;
+
+    void tabulate(size_t checks)
+    {
+        const size_t num_vertices = col_ptr.empty() ? 0 : col_ptr.size() - 1;
+        RT_FAIL_IF(checks > num_vertices, "The syndrome is larger than the Tanner graph");
+        const size_t num_data = num_vertices - checks;
+
+        num_checks = checks;
+        num_words = (checks + 63) / 64;
+        qubit_syndromes.assign(num_data * num_words, 0);
+        qubit_lookup.clear();
+        for (size_t qubit = 0; qubit < num_data; qubit++) {
+            for (int64_t k = col_ptr[qubit]; k < col_ptr[qubit + 1]; k++) {
+                const int64_t row = row_idx[static_cast<size_t>(k)];
+                RT_FAIL_IF(row < static_cast<int64_t>(num_data),
+                           "The data qubits of the Tanner graph must only neighbour checks");
+                const size_t check = static_cast<size_t>(row) - num_data;
+                qubit_syndromes[qubit * num_words + check / 64] |= uint64_t{1} << (check % 64);
+            }
+            if (num_words == 1) {
+                qubit_lookup.try_emplace(qubit_syndromes[qubit], static_cast<int64_t>(qubit));
+            }
+        }
+    }
+
+  public:
+    TannerGraphDecoder(std::vector<int64_t> row_idx, std::vector<int64_t> col_ptr)
+        : row_idx(std::move(row_idx)), col_ptr(std::move(col_ptr))
+    {
+    }
+
+    [[nodiscard]] auto isGraph(std::span<const int64_t> rows,
+                               std::span<const int64_t> cols) const -> bool
+    {
+        return std::ranges::equal(rows, row_idx) && std::ranges::equal(cols, col_ptr);
+    }
+
+    [[nodiscard]] auto getMaxCorrections() const -> size_t override { return 1; }
+
+    void decode(std::span<const uint64_t> syndrome, size_t checks,
+                std::span<int64_t> corrections) override
+    {
+        if (checks != num_checks || qubit_syndromes.empty()) {
+            tabulate(checks);
+        }
+
+        corrections[0] = -1;
+        if (std::ranges::all_of(syndrome, [](uint64_t word) { return word == 0; })) {
+            return;
+        }
+        if (num_words == 1) {
+            if (auto it = qubit_lookup.find(syndrome[0]); it != qubit_lookup.end()) {
+                corrections[0] = it->second;
+            }
+            return;
+        }
+        const size_t num_data = qubit_syndromes.size() / num_words;
+        for (size_t qubit = 0; qubit < num_data; qubit++) {
+            if (std::ranges::equal(syndrome,
+                                   std::span(qubit_syndromes).subspan(qubit * num_words,
+                                                                      num_words))) {
+                corrections[0] = static_cast<int64_t>(qubit);
+                return;
+            }
+        }
+    }
+};
+
+/**
+ * A decoder implemented outside of the runtime, e.g. next to the control system of a device,
+ * which is called through a C function pointer.
+ */
+class CallbackDecoder final : public SyndromeDecoder {
+  private:
+    SyndromeDecoderCallback callback;
+    void *context;
+    size_t max_corrections;
+
+  public:
+    CallbackDecoder(SyndromeDecoderCallback callback, void *context, size_t max_corrections)
+        : callback(callback), context(context), max_corrections(max_corrections)
+    {
+        RT_FAIL_IF(!callback, "Invalid syndrome decoder callback");
+    }
+
+    [[nodiscard]] auto getMaxCorrections() const -> size_t override { return max_corrections; }
+
+    void decode(std::span<const uint64_t> syndrome, size_t num_checks,
+                std::span<int64_t> corrections) override
+    {
+        std::fill(corrections.begin(), corrections.end(), -1);
+        callback(context, syndrome.data(), static_cast<int64_t>(num_checks), corrections.data());
+    }
+};
+
+/**
+ * A stream of syndrome rounds through a decoder.
+ *
+ * Rounds are pushed in bit-packed batches and decoded as soon as they arrive, so that the
+ * corrections of a round are ready one decoding latency after its syndrome. The corrections wait
+ * in a ring buffer of a fixed number of rounds until they are pulled, and the stream fails
+ * instead of growing if they are not pulled in time. No memory is allocated after the first
+ * round.
+ */
+class DecoderStream final {
+  private:
+    std::unique_ptr<SyndromeDecoder> decoder;
+    size_t max_corrections;
+
+    std::vector<int64_t> corrections;
+    size_t head{0};
+    size_t size{0};
+
+  public:
+    static constexpr size_t capacity = 64;
+
+    explicit DecoderStream(std::unique_ptr<SyndromeDecoder> decoder)
+        : decoder(std::move(decoder)), max_corrections(this->decoder->getMaxCorrections()),
+          corrections(capacity * max_corrections)
+    {
+    }
+
+    [[nodiscard]] auto getDecoder() const -> const SyndromeDecoder & { return *decoder; }
+
+    [[nodiscard]] auto getMaxCorrections() const -> size_t { return max_corrections; }
+
+    [[nodiscard]] auto getNumPending() const -> size_t { return size; }
+
+    /**
+     * @brief Decode `num_rounds` rounds of `num_checks` syndrome bits, each packed into
+     * `ceil(num_checks / 64)` consecutive words of `rounds`.
+     */
+    void push(std::span<const uint64_t> rounds, size_t num_checks, size_t num_rounds)
+    {
+        const size_t num_words = (num_checks + 63) / 64;
+        RT_FAIL_IF(rounds.size() < num_rounds * num_words, "Invalid size for the syndrome rounds");
+        RT_FAIL_IF(size + num_rounds > capacity,
+                   "The corrections of the syndrome decoder were not pulled in time");
+        for (size_t round = 0; round < num_rounds; round++) {
+            const size_t slot = (head + size) % capacity;
+            decoder->decode(rounds.subspan(round * num_words, num_words), num_checks,
+                            std::span(corrections).subspan(slot * max_corrections,
+                                                           max_corrections));
+            size++;
+        }
+    }
+
+    /**
+     * @brief Move the corrections of the oldest decoded rounds to `out`, `getMaxCorrections()`
+     * entries per round, for as many rounds as `out` can hold.
+     *
+     * @return The number of rounds whose corrections were pulled.
+     */
+    auto pull(std::span<int64_t> out) -> size_t
+    {
+        const size_t num_rounds = max_corrections == 0
+                                      ? size
+                                      : std::min(size, out.size() / max_corrections);
+        for (size_t round = 0; round < num_rounds; round++) {
+            auto slot = std::span(corrections).subspan(head * max_corrections, max_corrections);
+            std::copy(slot.begin(), slot.end(), out.begin() + round * max_corrections);
+            head = (head + 1) % capacity;
+        }
+        size -= num_rounds;
+        return num_rounds;
+    }
+};
+
+/**
+ * The syndrome decoders of a device, under the keys that are returned to the program.
+ */
+class DecoderRegistry final {
+  private:
+    std::vector<std::unique_ptr<DecoderStream>> streams;
+
+  public:
+    /**
+     * @brief Forget all decoders, whose keys are only valid in one execution.
+     */
+    void reset() noexcept { streams.clear(); }
+
+    auto add(std::unique_ptr<SyndromeDecoder> decoder) -> int64_t
+    {
+        streams.push_back(std::make_unique<DecoderStream>(std::move(decoder)));
+        return static_cast<int64_t>(streams.size() - 1);
+    }
+
+    /**
+     * @brief Get the key of the default decoder of a Tanner graph in CSC form. The decoder of
+     * an identical graph is reused, so that its syndrome table is only built once.
+     */
+    auto addTannerGraph(std::vector<int64_t> row_idx, std::vector<int64_t> col_ptr) -> int64_t
+    {
+        for (size_t key = 0; key < streams.size(); key++) {
+            const SyndromeDecoder &decoder = streams[key]->getDecoder();
+            const auto *graph = dynamic_cast<const TannerGraphDecoder *>(&decoder);
+            if (graph && graph->isGraph(row_idx, col_ptr)) {
+                return static_cast<int64_t>(key);
+            }
+        }
+        return add(std::make_unique<TannerGraphDecoder>(std::move(row_idx), std::move(col_ptr)));
+    }
+
+    [[nodiscard]] auto get(int64_t key) -> DecoderStream &
+    {
+        RT_FAIL_IF(key < 0 || static_cast<size_t>(key) >= streams.size(),
+                   "Invalid syndrome decoder");
+        return *streams[static_cast<size_t>(key)];
+    }
+};
+
+} // namespace Catalyst::Runtime
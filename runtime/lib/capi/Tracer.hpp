@@ -0,0 +1,588 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include "Exception.hpp"
+#include "QuantumDevice.hpp"
+
+namespace Catalyst::Runtime {
+
+/**
+ * @brief Read the cycle counter of the CPU, or a monotonic clock in nanoseconds on the
+ * architectures without a user-space counter.
+ */
+inline auto readCycleCounter() -> uint64_t
+{
+#if defined(__x86_64__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+/**
+ * A traced call, whose name and details point to static strings.
+ */
+struct TraceEvent {
+    const char *name;
+    const char *category;
+    std::string_view detail;
+    uint64_t start;
+    uint64_t end;
+};
+
+/**
+ * The ring buffer of the events of a thread, which overwrites its oldest events once full. It is
+ * only written by its thread, without synchronization.
+ */
+class TraceBuffer final {
+  private:
+    std::vector<TraceEvent> events;
+    size_t next{0};
+    size_t thread_index;
+
+  public:
+    TraceBuffer(size_t capacity, size_t thread_index)
+        : events(capacity), thread_index(thread_index)
+    {
+    }
+
+    void push(const TraceEvent &event) noexcept
+    {
+        events[next % events.size()] = event;
+        next++;
+    }
+
+    [[nodiscard]] auto getThreadIndex() const -> size_t { return thread_index; }
+
+    [[nodiscard]] auto getNumDropped() const -> size_t
+    {
+        return next > events.size() ? next - events.size() : 0;
+    }
+
+    template <typename Fn> void forEach(Fn &&fn) const
+    {
+        for (size_t i = getNumDropped(); i < next; i++) {
+            fn(events[i % events.size()]);
+        }
+    }
+};
+
+/**
+ * @brief The opt-in tracer of the runtime, which records the C-API calls and the calls to the
+ * quantum devices with cycle counter timestamps, and writes them in the Chrome trace event format
+ * that Perfetto and `chrome://tracing` load.
+ *
+ * It is enabled by setting `CATALYST_RUNTIME_TRACE` to the path of the trace file, which is
+ * written when the runtime is finalized. Each thread records into its own ring buffer of
+ * `CATALYST_RUNTIME_TRACE_EVENTS` events, 65536 by default, so that tracing neither locks nor
+ * allocates once a thread has recorded its first event. Without the variable there is no tracer,
+ * and each traced C-API call only checks for a null pointer.
+ */
+class Tracer final {
+  private:
+    std::string path;
+    size_t capacity;
+    std::vector<std::unique_ptr<TraceBuffer>> buffers;
+    std::mutex buffers_mu; // To protect buffers
+
+    // Calibration of the cycle counter against the steady clock
+    uint64_t start_ticks;
+    std::chrono::steady_clock::time_point start_time;
+
+    // Identifies this tracer in the thread-local caches, which may outlive it
+    uint64_t session;
+
+    auto registerThread() -> TraceBuffer *
+    {
+        std::lock_guard<std::mutex> lock(buffers_mu);
+        buffers.push_back(std::make_unique<TraceBuffer>(capacity, buffers.size()));
+        return buffers.back().get();
+    }
+
+  public:
+    Tracer(std::string path, size_t capacity)
+        : path(std::move(path)), capacity(capacity), start_ticks(readCycleCounter()),
+          start_time(std::chrono::steady_clock::now()), session(start_ticks)
+    {
+    }
+
+    /**
+     * @brief Get the ring buffer of the calling thread.
+     */
+    [[nodiscard]] auto getThreadBuffer() -> TraceBuffer *
+    {
+        thread_local struct {
+            uint64_t session;
+            TraceBuffer *buffer;
+        } cache{0, nullptr};
+        if (cache.session != session || !cache.buffer) {
+            cache = {session, registerThread()};
+        }
+        return cache.buffer;
+    }
+
+    /**
+     * @brief Write the events of all threads as a Chrome trace, with timestamps in microseconds
+     * since the creation of the tracer. Other threads must not record events concurrently.
+     *
+     * @param other_data Additional members of the metadata of the trace, as JSON.
+     */
+    void write(std::string_view other_data = {})
+    {
+        const double elapsed_us = std::chrono::duration<double, std::micro>(
+                                      std::chrono::steady_clock::now() - start_time)
+                                      .count();
+        const uint64_t elapsed_ticks = readCycleCounter() - start_ticks;
+        const double ticks_per_us = elapsed_us > 0 ? elapsed_ticks / elapsed_us : 1.0;
+        auto to_us = [&](uint64_t ticks) { return (ticks - start_ticks) / ticks_per_us; };
+
+        std::ofstream os(path);
+        RT_FAIL_IF(!os.is_open(), "Unable to open the runtime trace file");
+
+        std::lock_guard<std::mutex> lock(buffers_mu);
+        size_t dropped = 0;
+        bool first = true;
+        char line[64];
+        os << "{\"traceEvents\": [";
+        for (const auto &buffer : buffers) {
+            dropped += buffer->getNumDropped();
+            buffer->forEach([&](const TraceEvent &event) {
+                os << (first ? "\n" : ",\n") << "{\"name\": \"" << event.name << "\", \"cat\": \""
+                   << event.category << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": "
+                   << buffer->getThreadIndex();
+                std::snprintf(line, sizeof(line), ", \"ts\": %.3f, \"dur\": %.3f",
+                              to_us(event.start), (event.end - event.start) / ticks_per_us);
+                os << line;
+                if (!event.detail.empty()) {
+                    os << ", \"args\": {\"detail\": \"" << event.detail << "\"}";
+                }
+                os << "}";
+                first = false;
+            });
+        }
+        os << "\n], \"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped_events\": " << dropped
+           << (other_data.empty() ? "" : ", ") << other_data << "}}\n";
+    }
+};
+
+/**
+ * @brief Record the scope of a call as a trace event, if `tracer` is not null.
+ */
+class TraceScope final {
+  private:
+    TraceBuffer *buffer;
+    const char *name;
+    const char *category;
+    std::string_view detail;
+    uint64_t start;
+
+  public:
+    TraceScope(Tracer *tracer, const char *name, const char *category,
+               std::string_view detail = {})
+        : buffer(tracer ? tracer->getThreadBuffer() : nullptr), name(name), category(category),
+          detail(detail), start(buffer ? readCycleCounter() : 0)
+    {
+    }
+
+    ~TraceScope()
+    {
+        if (buffer) {
+            buffer->push({name, category, detail, start, readCycleCounter()});
+        }
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+    TraceScope(TraceScope &&) = delete;
+    TraceScope &operator=(TraceScope &&) = delete;
+};
+
+/**
+ * @brief A quantum device that records each call to the device it wraps, except for the cheap
+ * accessors of its configuration.
+ */
+class TracingDevice final : public QuantumDevice {
+  private:
+    std::unique_ptr<QuantumDevice> device;
+    Tracer &tracer;
+
+  public:
+    TracingDevice(std::unique_ptr<QuantumDevice> device, Tracer &tracer)
+        : device(std::move(device)), tracer(tracer)
+    {
+    }
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> override
+    {
+        TraceScope scope(&tracer, "AllocateQubits", "device");
+        return device->AllocateQubits(num_qubits);
+    }
+
+    void AllocateQubitsInPlace(std::span<QubitIdType> ids) override
+    {
+        TraceScope scope(&tracer, "AllocateQubitsInPlace", "device");
+        device->AllocateQubitsInPlace(ids);
+    }
+
+    void ReleaseQubits(const std::vector<QubitIdType> &qubits) override
+    {
+        TraceScope scope(&tracer, "ReleaseQubits", "device");
+        device->ReleaseQubits(qubits);
+    }
+
+    auto GetNumQubits() const -> size_t override { return device->GetNumQubits(); }
+
+    auto AllocateQubit() -> QubitIdType override
+    {
+        TraceScope scope(&tracer, "AllocateQubit", "device");
+        return device->AllocateQubit();
+    }
+
+    void ReleaseQubit(QubitIdType qubit) override
+    {
+        TraceScope scope(&tracer, "ReleaseQubit", "device");
+        device->ReleaseQubit(qubit);
+    }
+
+    void SetDeviceShots(size_t shots) override
+    {
+        TraceScope scope(&tracer, "SetDeviceShots", "device");
+        device->SetDeviceShots(shots);
+    }
+
+    auto GetDeviceShots() const -> size_t override { return device->GetDeviceShots(); }
+
+    void SetDevicePRNG(std::mt19937 *gen) override
+    {
+        TraceScope scope(&tracer, "SetDevicePRNG", "device");
+        device->SetDevicePRNG(gen);
+    }
+
+    void SetDeviceStreamPRNG(const PhiloxEngine &engine) override
+    {
+        TraceScope scope(&tracer, "SetDeviceStreamPRNG", "device");
+        device->SetDeviceStreamPRNG(engine);
+    }
+
+    void NamedOperation(const std::string &name, const std::vector<double> &params,
+                        const std::vector<QubitIdType> &wires, bool inverse,
+                        const std::vector<QubitIdType> &controlled_wires,
+                        const std::vector<bool> &controlled_values,
+                        const std::vector<std::string> &optional_params) override
+    {
+        TraceScope scope(&tracer, "NamedOperation", "device");
+        device->NamedOperation(name, params, wires, inverse, controlled_wires, controlled_values,
+                               optional_params);
+    }
+
+    void GateOperation(GateId id, std::span<const double> params,
+                       std::span<const QubitIdType> wires, bool inverse,
+                       std::span<const QubitIdType> controlled_wires,
+                       std::span<const bool> controlled_values) override
+    {
+        TraceScope scope(&tracer, "GateOperation", "device", getGateName(id));
+        device->GateOperation(id, params, wires, inverse, controlled_wires, controlled_values);
+    }
+
+    void PackedPauliRot(std::span<const uint64_t> pauli_masks, double theta,
+                        std::span<const QubitIdType> wires, bool inverse,
+                        std::span<const QubitIdType> controlled_wires,
+                        std::span<const bool> controlled_values) override
+    {
+        TraceScope scope(&tracer, "PackedPauliRot", "device");
+        device->PackedPauliRot(pauli_masks, theta, wires, inverse, controlled_wires,
+                               controlled_values);
+    }
+
+    void ApplyOperations(std::span<const BatchedGate> gates, std::span<const double> params,
+                         std::span<const QubitIdType> wires) override
+    {
+        TraceScope scope(&tracer, "ApplyOperations", "device");
+        device->ApplyOperations(gates, params, wires);
+    }
+
+    auto Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result override
+    {
+        TraceScope scope(&tracer, "Measure", "device");
+        return device->Measure(wire, postselect);
+    }
+
+    void MeasureBatch(std::span<const QubitIdType> wires,
+                      std::span<const std::optional<int32_t>> postselects,
+                      std::span<Result> results) override
+    {
+        TraceScope scope(&tracer, "MeasureBatch", "device");
+        device->MeasureBatch(wires, postselects, results);
+    }
+
+    void MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                         const std::vector<QubitIdType> &wires, bool inverse,
+                         const std::vector<QubitIdType> &controlled_wires,
+                         const std::vector<bool> &controlled_values) override
+    {
+        TraceScope scope(&tracer, "MatrixOperation", "device");
+        device->MatrixOperation(matrix, wires, inverse, controlled_wires, controlled_values);
+    }
+
+    void MatrixOperationView(DataView<std::complex<double>, 2> &matrix,
+                             std::span<const QubitIdType> wires, bool inverse,
+                             std::span<const QubitIdType> controlled_wires,
+                             std::span<const bool> controlled_values) override
+    {
+        TraceScope scope(&tracer, "MatrixOperationView", "device");
+        device->MatrixOperationView(matrix, wires, inverse, controlled_wires, controlled_values);
+    }
+
+    void SetBasisState(DataView<int8_t, 1> &n, std::vector<QubitIdType> &wires) override
+    {
+        TraceScope scope(&tracer, "SetBasisState", "device");
+        device->SetBasisState(n, wires);
+    }
+
+    void SetState(DataView<std::complex<double>, 1> &state,
+                  std::vector<QubitIdType> &wires) override
+    {
+        TraceScope scope(&tracer, "SetState", "device");
+        device->SetState(state, wires);
+    }
+
+    void SetBasisStateIndex(uint64_t index, std::vector<QubitIdType> &wires) override
+    {
+        TraceScope scope(&tracer, "SetBasisStateIndex", "device");
+        device->SetBasisStateIndex(index, wires);
+    }
+
+    void SetSparseState(std::span<const int64_t> indices,
+                        std::span<const std::complex<double>> amplitudes,
+                        std::vector<QubitIdType> &wires) override
+    {
+        TraceScope scope(&tracer, "SetSparseState", "device");
+        device->SetSparseState(indices, amplitudes, wires);
+    }
+
+    auto Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
+                    const std::vector<QubitIdType> &wires) -> ObsIdType override
+    {
+        TraceScope scope(&tracer, "Observable", "device");
+        return device->Observable(id, matrix, wires);
+    }
+
+    auto HermitianObservableView(DataView<std::complex<double>, 2> &matrix,
+                                 std::span<const QubitIdType> wires) -> ObsIdType override
+    {
+        TraceScope scope(&tracer, "HermitianObservableView", "device");
+        return device->HermitianObservableView(matrix, wires);
+    }
+
+    auto TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType override
+    {
+        TraceScope scope(&tracer, "TensorObservable", "device");
+        return device->TensorObservable(obs);
+    }
+
+    auto HamiltonianObservable(const std::vector<double> &coeffs, const std::vector<ObsIdType> &obs)
+        -> ObsIdType override
+    {
+        TraceScope scope(&tracer, "HamiltonianObservable", "device");
+        return device->HamiltonianObservable(coeffs, obs);
+    }
+
+    auto NamedObservableView(ObsId id, std::span<const QubitIdType> wires) -> ObsIdType override
+    {
+        TraceScope scope(&tracer, "NamedObservableView", "device");
+        return device->NamedObservableView(id, wires);
+    }
+
+    auto TensorObservableView(std::span<const ObsIdType> obs) -> ObsIdType override
+    {
+        TraceScope scope(&tracer, "TensorObservableView", "device");
+        return device->TensorObservableView(obs);
+    }
+
+    auto HamiltonianObservableView(std::span<const double> coeffs, std::span<const ObsIdType> obs)
+        -> ObsIdType override
+    {
+        TraceScope scope(&tracer, "HamiltonianObservableView", "device");
+        return device->HamiltonianObservableView(coeffs, obs);
+    }
+
+    void Sample(DataView<double, 2> &samples) override
+    {
+        TraceScope scope(&tracer, "Sample", "device");
+        device->Sample(samples);
+    }
+
+    void PartialSample(DataView<double, 2> &samples, const std::vector<QubitIdType> &wires) override
+    {
+        TraceScope scope(&tracer, "PartialSample", "device");
+        device->PartialSample(samples, wires);
+    }
+
+    void SampleChunked(const std::vector<QubitIdType> &wires, size_t chunk_shots,
+                       const std::function<void(DataView<double, 2> &, size_t)> &callback) override
+    {
+        TraceScope scope(&tracer, "SampleChunked", "device");
+        device->SampleChunked(wires, chunk_shots, callback);
+    }
+
+    void PackedSample(DataView<uint64_t, 2> &samples,
+                      const std::vector<QubitIdType> &wires) override
+    {
+        TraceScope scope(&tracer, "PackedSample", "device");
+        device->PackedSample(samples, wires);
+    }
+
+    auto SubmitSample(const std::vector<QubitIdType> &wires)
+        -> std::future<std::vector<double>> override
+    {
+        TraceScope scope(&tracer, "SubmitSample", "device");
+        return device->SubmitSample(wires);
+    }
+
+    void Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts) override
+    {
+        TraceScope scope(&tracer, "Counts", "device");
+        device->Counts(eigvals, counts);
+    }
+
+    void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                       const std::vector<QubitIdType> &wires) override
+    {
+        TraceScope scope(&tracer, "PartialCounts", "device");
+        device->PartialCounts(eigvals, counts, wires);
+    }
+
+    void Probs(DataView<double, 1> &probs) override
+    {
+        TraceScope scope(&tracer, "Probs", "device");
+        device->Probs(probs);
+    }
+
+    void PartialProbs(DataView<double, 1> &probs, const std::vector<QubitIdType> &wires) override
+    {
+        TraceScope scope(&tracer, "PartialProbs", "device");
+        device->PartialProbs(probs, wires);
+    }
+
+    auto Expval(ObsIdType obsKey) -> double override
+    {
+        TraceScope scope(&tracer, "Expval", "device");
+        return device->Expval(obsKey);
+    }
+
+    auto Var(ObsIdType obsKey) -> double override
+    {
+        TraceScope scope(&tracer, "Var", "device");
+        return device->Var(obsKey);
+    }
+
+    auto ExpvalVar(ObsIdType obsKey) -> std::pair<double, double> override
+    {
+        TraceScope scope(&tracer, "ExpvalVar", "device");
+        return device->ExpvalVar(obsKey);
+    }
+
+    void Expvals(std::span<const ObsIdType> obsKeys, std::span<double> expvals) override
+    {
+        TraceScope scope(&tracer, "Expvals", "device");
+        device->Expvals(obsKeys, expvals);
+    }
+
+    void State(DataView<std::complex<double>, 1> &state) override
+    {
+        TraceScope scope(&tracer, "State", "device");
+        device->State(state);
+    }
+
+    auto GetStateView() const -> std::span<const std::complex<double>> override
+    {
+        return device->GetStateView();
+    }
+
+    auto PauliMeasure(const std::string &pauli_word, const std::vector<QubitIdType> &wires)
+        -> Result override
+    {
+        TraceScope scope(&tracer, "PauliMeasure", "device");
+        return device->PauliMeasure(pauli_word, wires);
+    }
+
+    auto PackedPauliMeasure(std::span<const uint64_t> pauli_masks,
+                            const std::vector<QubitIdType> &wires) -> Result override
+    {
+        TraceScope scope(&tracer, "PackedPauliMeasure", "device");
+        return device->PackedPauliMeasure(pauli_masks, wires);
+    }
+
+    void Gradient(std::vector<DataView<double, 1>> &gradients,
+                  const std::vector<size_t> &trainParams) override
+    {
+        TraceScope scope(&tracer, "Gradient", "device");
+        device->Gradient(gradients, trainParams);
+    }
+
+    void StartTapeRecording() override
+    {
+        TraceScope scope(&tracer, "StartTapeRecording", "device");
+        device->StartTapeRecording();
+    }
+
+    void StopTapeRecording() override
+    {
+        TraceScope scope(&tracer, "StopTapeRecording", "device");
+        device->StopTapeRecording();
+    }
+
+    void SetTapeCheckpointInterval(size_t interval) override
+    {
+        TraceScope scope(&tracer, "SetTapeCheckpointInterval", "device");
+        device->SetTapeCheckpointInterval(interval);
+    }
+
+    void StartBatch(size_t batch_size) override
+    {
+        TraceScope scope(&tracer, "StartBatch", "device");
+        device->StartBatch(batch_size);
+    }
+
+    void EndBatch() override
+    {
+        TraceScope scope(&tracer, "EndBatch", "device");
+        device->EndBatch();
+    }
+};
+
+} // namespace Catalyst::Runtime
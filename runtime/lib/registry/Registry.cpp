@@ -12,10 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cstdarg>
 #include <cstdint>
+#include <cstring>
 #include <dlfcn.h>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "nanobind/nanobind.h"
 #include "nanobind/stl/string.h"
@@ -32,6 +39,14 @@ namespace nb = nanobind;
 // https://pybind11.readthedocs.io/en/stable/advanced/misc.html#common-sources-of-global-interpreter-lock-errors
 std::unordered_map<int64_t, nb::callable> *references;
 
+// Native callbacks are C function pointers, called with the ranked memref descriptors of their
+// arguments and of the result buffers allocated by the compiler, which they write to directly.
+// They are dispatched without the GIL, so that async QNodes calling back do not serialize. The
+// mutex only guards the map against registrations from Python.
+using NativeCallback = void (*)(int64_t argc, void **args, int64_t retc, void **results);
+std::unordered_map<int64_t, NativeCallback> *nativeCallbacks;
+std::shared_mutex nativeCallbacksMutex;
+
 std::string libmlirpath;
 
 struct UnrankedMemrefType {
@@ -39,8 +54,17 @@ struct UnrankedMemrefType {
     void *descriptor;
 };
 
+// The ranked memref descriptor pointed to by an unranked memref. It is followed by the sizes, and
+// then the strides, of each dimension.
+struct RankedMemrefHeader {
+    char *allocated;
+    char *aligned;
+    int64_t offset;
+};
+
 class LibraryManager {
     void *_handle;
+    void (*_memrefCopy)(int64_t, void *, void *);
 
   public:
     LibraryManager(std::string path)
@@ -49,6 +73,13 @@ class LibraryManager {
         if (!this->_handle) {
             throw nb::value_error(dlerror());
         }
+
+        void *f_ptr = dlsym(this->_handle, "memrefCopy");
+        if (!f_ptr) {
+            throw nb::value_error(dlerror());
+        }
+        typedef void (*memrefCopy_t)(int64_t, void *, void *);
+        this->_memrefCopy = (memrefCopy_t)(f_ptr);
     }
 
     ~LibraryManager()
@@ -60,14 +91,7 @@ class LibraryManager {
 
     void operator()(long elementSize, UnrankedMemrefType *src, UnrankedMemrefType *dst)
     {
-        void *f_ptr = dlsym(this->_handle, "memrefCopy");
-        if (!f_ptr) {
-            throw nb::value_error(dlerror());
-        }
-        typedef void (*memrefCopy_t)(int64_t, void *, void *);
-        void (*memrefCopy)(int64_t, void *, void *);
-        memrefCopy = (memrefCopy_t)(f_ptr);
-        return memrefCopy(elementSize, src, dst);
+        return this->_memrefCopy(elementSize, src, dst);
     }
 };
 
@@ -84,73 +108,210 @@ inline const char *ext()
 
 std::string library_name(std::string name) { return name + ext(); }
 
-void convertResult(nb::handle tuple)
+// The library is loaded on the first strided copy, and only reloaded if its location changes.
+std::unique_ptr<LibraryManager> memrefCopyLibrary;
+std::string memrefCopyLibraryPath;
+
+LibraryManager &getMemrefCopy()
+{
+    std::string libpath = libmlirpath + library_name("/libmlir_c_runner_utils");
+    if (!memrefCopyLibrary || memrefCopyLibraryPath != libpath) {
+        memrefCopyLibrary = std::make_unique<LibraryManager>(libpath);
+        memrefCopyLibraryPath = libpath;
+    }
+    return *memrefCopyLibrary;
+}
+
+// Return the address of the first element of a memref if its elements are laid out contiguously
+// in row-major order, and nullptr otherwise. The number of elements is stored in `numElements`.
+char *getContiguousData(long elementSize, const UnrankedMemrefType &memref, int64_t &numElements)
 {
-    nb::object unrankedMemrefPtrSizeTuple = tuple.attr("__getitem__")(0);
+    auto *header = static_cast<RankedMemrefHeader *>(memref.descriptor);
+    const int64_t *sizes = reinterpret_cast<const int64_t *>(header + 1);
+    const int64_t *strides = sizes + memref.rank;
 
-    nb::object unranked_memref = unrankedMemrefPtrSizeTuple.attr("__getitem__")(0);
-    nb::object element_size = unrankedMemrefPtrSizeTuple.attr("__getitem__")(1);
+    numElements = 1;
+    bool contiguous = true;
+    for (int64_t dim = memref.rank - 1; dim >= 0; dim--) {
+        // The stride of a dimension of size 1 is irrelevant
+        contiguous &= sizes[dim] == 1 || strides[dim] == numElements;
+        numElements *= sizes[dim];
+    }
+    if (!contiguous && numElements != 0) {
+        return nullptr;
+    }
+    return header->aligned + header->offset * elementSize;
+}
+
+void copyResult(long elementSize, UnrankedMemrefType *src, UnrankedMemrefType *dst)
+{
+    // Results that are contiguous, as NumPy and JAX arrays usually are, are copied in one go.
+    // A result that already is the destination buffer needs no copy at all, and memmove handles
+    // partial overlaps.
+    int64_t numElements = 0;
+    char *srcData = getContiguousData(elementSize, *src, numElements);
+    char *dstData = getContiguousData(elementSize, *dst, numElements);
+    if (srcData && dstData) {
+        if (srcData != dstData && numElements > 0) {
+            std::memmove(dstData, srcData, numElements * elementSize);
+        }
+        return;
+    }
+
+    getMemrefCopy()(elementSize, src, dst);
+}
+
+void convertResult(nb::handle result, nb::handle dest)
+{
+    nb::object unranked_memref = result.attr("__getitem__")(0);
+    nb::object element_size = result.attr("__getitem__")(1);
     nb::object unranked_memref_ptr_int = unranked_memref.attr("value");
 
     void *unranked_memref_ptr = reinterpret_cast<void *>(nb::cast<long>(unranked_memref_ptr_int));
     long e_size = nb::cast<long>(element_size);
 
-    nb::object dest = tuple.attr("__getitem__")(1);
-
     long destAsLong = nb::cast<long>(dest);
     void *destAsPtr = (void *)(destAsLong);
 
     UnrankedMemrefType *src = (UnrankedMemrefType *)unranked_memref_ptr;
     UnrankedMemrefType destMemref = {src->rank, destAsPtr};
 
-    std::string libpath = libmlirpath + library_name("/libmlir_c_runner_utils");
-    LibraryManager memrefCopy(libpath);
-    memrefCopy(e_size, src, &destMemref);
+    copyResult(e_size, src, &destMemref);
 }
 
 void convertResults(nb::list results, nb::list allocated)
 {
-    auto builtins = nb::module_::import_("builtins");
-    auto zip = builtins.attr("zip");
-    for (nb::handle obj : zip(results, allocated)) {
-        convertResult(obj);
+    size_t count = std::min(nb::len(results), nb::len(allocated));
+    for (size_t i = 0; i < count; i++) {
+        nb::object result = results[i];
+        nb::object dest = allocated[i];
+        convertResult(result, dest);
     }
 }
 
-extern "C" {
-[[gnu::visibility("default")]] void callbackCall(int64_t identifier, int64_t count, int64_t retc,
-                                                 va_list args)
+NativeCallback lookupNativeCallback(int64_t identifier)
+{
+    std::shared_lock<std::shared_mutex> nativeLock(nativeCallbacksMutex);
+    auto nativeIt = nativeCallbacks->find(identifier);
+    return nativeIt != nativeCallbacks->end() ? nativeIt->second : nullptr;
+}
+
+nb::callable &lookupCallback(int64_t identifier)
 {
-    nb::gil_scoped_acquire lock;
     auto it = references->find(identifier);
     if (it == references->end()) {
         throw std::invalid_argument("Callback called with invalid identifier");
     }
-    auto lambda = it->second;
+    return it->second;
+}
 
+// Call a Python callback with the memref descriptors of its arguments, and copy its results into
+// those of the buffers allocated by the compiler. The GIL must be held.
+void callPython(nb::callable &lambda, const std::vector<void *> &args,
+                const std::vector<void *> &results)
+{
     nb::list flat_args;
-    for (int i = 0; i < count; i++) {
-        int64_t ptr = va_arg(args, int64_t);
-        flat_args.append(ptr);
+    for (void *arg : args) {
+        flat_args.append(reinterpret_cast<int64_t>(arg));
     }
 
     nb::list flat_results = nb::list(lambda(flat_args));
 
     // We have a flat list of return values.
     // These returns **may** be array views to
-    // the very same memrefs that we passed as inputs.
-    // As a first prototype, let's copy these values.
-    // I think it is best to always copy them because
-    // of aliasing. Let's just copy them to guarantee
-    // no aliasing issues. We can revisit this as an optimization
-    // and allowing these to alias.
+    // the very same memrefs that we passed as inputs,
+    // so they are always copied into the buffers allocated by the compiler,
+    // unless they already are those buffers.
     nb::list flat_returns_allocated_compiler;
-    for (int i = 0; i < retc; i++) {
-        int64_t ptr = va_arg(args, int64_t);
-        flat_returns_allocated_compiler.append(ptr);
+    for (void *result : results) {
+        flat_returns_allocated_compiler.append(reinterpret_cast<int64_t>(result));
     }
     convertResults(flat_results, flat_returns_allocated_compiler);
 }
+
+std::vector<void *> readPointers(int64_t count, va_list args)
+{
+    std::vector<void *> pointers(count);
+    for (int i = 0; i < count; i++) {
+        pointers[i] = reinterpret_cast<void *>(va_arg(args, int64_t));
+    }
+    return pointers;
+}
+
+// The descriptor of the `index`-th slice along the leading dimension of a memref of rank `rank`,
+// in the layout of a ranked memref descriptor of rank `rank - 1`.
+std::vector<int64_t> sliceDescriptor(const int64_t *stacked, int64_t rank, int64_t index)
+{
+    const int64_t *sizes = stacked + 3;
+    const int64_t *strides = sizes + rank;
+    std::vector<int64_t> slice = {stacked[0], stacked[1], stacked[2] + index * strides[0]};
+    slice.insert(slice.end(), sizes + 1, sizes + rank);
+    slice.insert(slice.end(), strides + 1, strides + rank);
+    return slice;
+}
+
+extern "C" {
+[[gnu::visibility("default")]] void callbackCall(int64_t identifier, int64_t count, int64_t retc,
+                                                 va_list args)
+{
+    // The arguments are read in one go, as va_list may be passed by value
+    std::vector<void *> pointers = readPointers(count + retc, args);
+    std::vector<void *> flat_args(pointers.begin(), pointers.begin() + count);
+    std::vector<void *> flat_results(pointers.begin() + count, pointers.end());
+
+    if (NativeCallback native = lookupNativeCallback(identifier)) {
+        native(count, flat_args.data(), retc, flat_results.data());
+        return;
+    }
+
+    nb::gil_scoped_acquire lock;
+    callPython(lookupCallback(identifier), flat_args, flat_results);
+}
+
+// Call a callback once for each slice along the leading dimension of its stacked arguments and
+// results, whose ranks are given by `ranks`. Python callbacks are called under a single
+// acquisition of the GIL.
+[[gnu::visibility("default")]] void batchedCallbackCall(int64_t identifier, int64_t count,
+                                                        int64_t retc, const int64_t *ranks,
+                                                        va_list args)
+{
+    std::vector<void *> stacked = readPointers(count + retc, args);
+    if (stacked.empty()) {
+        return;
+    }
+    const int64_t batchSize = static_cast<const int64_t *>(stacked[0])[3];
+
+    std::vector<std::vector<int64_t>> slices(stacked.size());
+    std::vector<void *> flat_args(count);
+    std::vector<void *> flat_results(retc);
+    auto sliceAt = [&](int64_t index) {
+        for (size_t i = 0; i < stacked.size(); i++) {
+            slices[i] = sliceDescriptor(static_cast<const int64_t *>(stacked[i]), ranks[i], index);
+            void *slice = slices[i].data();
+            if (static_cast<int64_t>(i) < count) {
+                flat_args[i] = slice;
+            }
+            else {
+                flat_results[i - count] = slice;
+            }
+        }
+    };
+
+    if (NativeCallback native = lookupNativeCallback(identifier)) {
+        for (int64_t index = 0; index < batchSize; index++) {
+            sliceAt(index);
+            native(count, flat_args.data(), retc, flat_results.data());
+        }
+        return;
+    }
+
+    nb::gil_scoped_acquire lock;
+    nb::callable &lambda = lookupCallback(identifier);
+    for (int64_t index = 0; index < batchSize; index++) {
+        sliceAt(index);
+        callPython(lambda, flat_args, flat_results);
+    }
+}
 }
 
 void setMLIRLibPath(std::string path) { libmlirpath = path; }
@@ -167,12 +328,27 @@ auto registerImpl(nb::callable f)
     return id;
 }
 
+auto registerNativeImpl(int64_t address, nb::callable owner)
+{
+    // The address of the function is its identifier. The Python object owning the function, e.g. a
+    // ctypes function pointer, is kept alive for as long as the function may be called.
+    references->insert({address, owner});
+    std::unique_lock<std::shared_mutex> nativeLock(nativeCallbacksMutex);
+    nativeCallbacks->insert({address, reinterpret_cast<NativeCallback>(address)});
+    return address;
+}
+
 NB_MODULE(catalyst_callback_registry, m)
 {
     if (references == nullptr) {
         references = new std::unordered_map<int64_t, nb::callable>();
     }
+    if (nativeCallbacks == nullptr) {
+        nativeCallbacks = new std::unordered_map<int64_t, NativeCallback>();
+    }
     m.doc() = "Callbacks";
     m.def("register", &registerImpl, "Call a python function registered in a map.");
+    m.def("register_native", &registerNativeImpl,
+          "Call a C function registered in a map, without acquiring the GIL.");
     m.def("set_mlir_lib_path", &setMLIRLibPath, "Set location of mlir's libraries.");
 }
@@ -0,0 +1,293 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Bench_RuntimeCAPI.cpp
+ * Microbenchmarks of the runtime C-API overhead against null.qubit, whose operations are no-ops,
+ * so that the measured times are those of the runtime itself rather than of a simulator.
+ */
+
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "CacheManager.hpp"
+#include "MemRefUtils.hpp"
+#include "RSDecomp.hpp"
+#include "RuntimeCAPI.h"
+#include "TestUtils.hpp"
+#include "Types.h"
+
+using namespace RSDecomp::RossSelinger;
+
+namespace {
+
+constexpr int64_t num_qubits = 8;
+constexpr size_t shots = 1000;
+
+void initNullQubit(size_t num_shots, const std::string &kwargs = "")
+{
+    const auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", kwargs};
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), num_shots,
+                                /*auto_qubit_management=*/false);
+}
+
+/**
+ * @brief Initialize the runtime with a null.qubit device and a register of `num_qubits` qubits,
+ *        which are released with the device at the end of the scope.
+ */
+struct NullQubitBenchFixture {
+    QirArray *reg;
+    std::vector<QUBIT *> qubits;
+
+    explicit NullQubitBenchFixture(size_t num_shots = shots, const std::string &kwargs = "")
+    {
+        __catalyst__rt__initialize(nullptr);
+        initNullQubit(num_shots, kwargs);
+        reg = __catalyst__rt__qubit_allocate_array(num_qubits);
+        for (int64_t i = 0; i < num_qubits; i++) {
+            qubits.push_back(*(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(reg, i));
+        }
+    }
+
+    ~NullQubitBenchFixture()
+    {
+        __catalyst__rt__qubit_release_array(reg);
+        __catalyst__rt__device_release();
+        __catalyst__rt__finalize();
+    }
+};
+
+} // namespace
+
+TEST_CASE("Benchmark gate dispatch", "[Benchmark]")
+{
+    NullQubitBenchFixture fixture;
+    QUBIT *q0 = fixture.qubits[0];
+    QUBIT *q1 = fixture.qubits[1];
+
+    BENCHMARK("Hadamard") { __catalyst__qis__Hadamard(q0, NO_MODIFIERS); };
+    BENCHMARK("RX") { __catalyst__qis__RX(0.5, q0, NO_MODIFIERS); };
+    BENCHMARK("CNOT") { __catalyst__qis__CNOT(q0, q1, NO_MODIFIERS); };
+
+    // The controlled wires are read as an array of qubit ids, i.e. of the values of the pointers
+    bool control_value = true;
+    Modifiers modifiers{true, 1, reinterpret_cast<QUBIT *>(&q1), &control_value};
+    BENCHMARK("Controlled adjoint RX") { __catalyst__qis__RX(0.5, q0, &modifiers); };
+}
+
+TEST_CASE("Benchmark the reference gate throughput", "[Benchmark]")
+{
+    // In its throughput mode, null.qubit does no work per gate, so that the number of gates over
+    // the mean time of these benchmarks is the maximum throughput of the runtime ABI, in gates per
+    // second, against which the overhead of the runtime is optimized.
+    NullQubitBenchFixture fixture(shots, "{'throughput': True}");
+    constexpr size_t num_gates = 64;
+
+    BENCHMARK("64 Hadamard gates")
+    {
+        for (size_t i = 0; i < num_gates; i++) {
+            __catalyst__qis__Hadamard(fixture.qubits[i % num_qubits], NO_MODIFIERS);
+        }
+    };
+    BENCHMARK("64 RX gates")
+    {
+        for (size_t i = 0; i < num_gates; i++) {
+            __catalyst__qis__RX(0.5, fixture.qubits[i % num_qubits], NO_MODIFIERS);
+        }
+    };
+
+    const std::vector<BatchedGate> gates(num_gates, {static_cast<int64_t>(GateId::RX), 0, 1, 1});
+    const std::vector<double> params(num_gates, 0.5);
+    std::vector<QUBIT *> wires(num_gates);
+    for (size_t i = 0; i < num_gates; i++) {
+        wires[i] = fixture.qubits[i % num_qubits];
+    }
+    BENCHMARK("A batch of 64 RX gates")
+    {
+        __catalyst__qis__ApplyBatch(num_gates, gates.data(), num_gates, params.data(), num_gates,
+                                    wires.data());
+    };
+}
+
+TEST_CASE("Benchmark qubit allocation", "[Benchmark]")
+{
+    __catalyst__rt__initialize(nullptr);
+    initNullQubit(0);
+
+    BENCHMARK("Allocate and release a qubit")
+    {
+        QUBIT *qubit = __catalyst__rt__qubit_allocate();
+        __catalyst__rt__qubit_release(qubit);
+    };
+    BENCHMARK("Allocate and release a register of 8 qubits")
+    {
+        QirArray *reg = __catalyst__rt__qubit_allocate_array(num_qubits);
+        __catalyst__rt__qubit_release_array(reg);
+    };
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Benchmark measurement processes", "[Benchmark]")
+{
+    NullQubitBenchFixture fixture;
+    QUBIT **qubits = fixture.qubits.data();
+    constexpr size_t n = num_qubits;
+
+    std::vector<double> samples(shots * n);
+    MemRefT_double_2d sample_result = {samples.data(), samples.data(), 0, {shots, n}, {n, 1}};
+    BENCHMARK("Sample of 1000 shots") { __catalyst__qis__Sample_array(&sample_result, n, qubits); };
+
+    constexpr size_t num_states = 1 << n;
+    std::vector<double> eigvals(num_states);
+    std::vector<int64_t> counts(num_states);
+    PairT_MemRefT_double_int64_1d counts_result = {
+        {eigvals.data(), eigvals.data(), 0, {num_states}, {1}},
+        {counts.data(), counts.data(), 0, {num_states}, {1}}};
+    BENCHMARK("Counts of 1000 shots") { __catalyst__qis__Counts_array(&counts_result, n, qubits); };
+
+    std::vector<double> probs(num_states);
+    MemRefT_double_1d probs_result = {probs.data(), probs.data(), 0, {num_states}, {1}};
+    BENCHMARK("Probs") { __catalyst__qis__Probs_array(&probs_result, n, qubits); };
+}
+
+TEST_CASE("Benchmark synthetic measurement processes", "[Benchmark]")
+{
+    // The synthetic outcomes of null.qubit spread the counts over all basis states, and alternate
+    // the mid-circuit measurements, so that the post-processing of the measurements is not only
+    // benchmarked on all-zero outcomes.
+    NullQubitBenchFixture fixture(shots, "{'synthetic_measurements': 'uniform'}");
+    QUBIT **qubits = fixture.qubits.data();
+    constexpr size_t n = num_qubits;
+
+    std::vector<double> samples(shots * n);
+    MemRefT_double_2d sample_result = {samples.data(), samples.data(), 0, {shots, n}, {n, 1}};
+    BENCHMARK("Sample of 1000 shots") { __catalyst__qis__Sample_array(&sample_result, n, qubits); };
+
+    constexpr size_t num_states = 1 << n;
+    std::vector<double> eigvals(num_states);
+    std::vector<int64_t> counts(num_states);
+    PairT_MemRefT_double_int64_1d counts_result = {
+        {eigvals.data(), eigvals.data(), 0, {num_states}, {1}},
+        {counts.data(), counts.data(), 0, {num_states}, {1}}};
+    BENCHMARK("Counts of 1000 shots") { __catalyst__qis__Counts_array(&counts_result, n, qubits); };
+
+    BENCHMARK("Mid-circuit measurement") { return __catalyst__qis__Measure(qubits[0], -1); };
+}
+
+TEST_CASE("Benchmark device initialization", "[Benchmark]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    BENCHMARK("Initialize and release null.qubit")
+    {
+        initNullQubit(0);
+        __catalyst__rt__device_release();
+    };
+
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Benchmark tape recording", "[Benchmark]")
+{
+    constexpr size_t num_ops = 1'000'000;
+    const std::vector<double> params{0.5};
+    const std::vector<size_t> wires{0, 1};
+
+    BENCHMARK("Record 10^6 gates")
+    {
+        Catalyst::Runtime::CacheManager<std::complex<double>> cache;
+        for (size_t i = 0; i < num_ops; i++) {
+            cache.addOperation("CRX", params, wires, false);
+        }
+        return cache.getNumOperations();
+    };
+    BENCHMARK("Record 10^6 gates into a reserved tape")
+    {
+        Catalyst::Runtime::CacheManager<std::complex<double>> cache;
+        cache.Reserve(num_ops, num_ops, 2 * num_ops);
+        for (size_t i = 0; i < num_ops; i++) {
+            cache.addOperation("CRX", params, wires, false);
+        }
+        return cache.getNumOperations();
+    };
+}
+
+TEST_CASE("Benchmark memory allocation from concurrent threads", "[Benchmark]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    // Each thread allocates and frees its own buffers, so that the time only grows with the
+    // number of threads where they contend for the memory manager
+    constexpr size_t num_allocations = 1000;
+    for (size_t num_threads : {1, 2, 4, 8, 16, 32, 64}) {
+        BENCHMARK("Allocate and free 1000 buffers on each of " + std::to_string(num_threads) +
+                  " threads")
+        {
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < num_threads; t++) {
+                threads.emplace_back([]() {
+                    std::array<void *, num_allocations> ptrs;
+                    for (auto &ptr : ptrs) {
+                        ptr = _mlir_memref_to_llvm_alloc(8);
+                    }
+                    for (void *ptr : ptrs) {
+                        _mlir_memref_to_llvm_free(ptr);
+                    }
+                });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+        };
+    }
+
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Benchmark RSDecomp entry points", "[Benchmark]")
+{
+    constexpr double angle = 0.3;
+    constexpr double epsilon = 1e-4;
+
+    BENCHMARK("Decompose an uncached angle")
+    {
+        clear_ross_caches();
+        return rs_decomposition_get_size(angle, epsilon, false);
+    };
+
+    rs_decomposition_get_size(angle, epsilon, false);
+    BENCHMARK("Decompose a cached angle")
+    {
+        return rs_decomposition_get_size(angle, epsilon, false);
+    };
+
+    std::vector<double> angles{0.1, 0.2, 0.3, 0.4, 0.5};
+    BENCHMARK("Solve a batch of uncached angles")
+    {
+        clear_ross_caches();
+        rs_decomposition_solve_batch(angles.data(), angles.data(), 0, angles.size(), 1, epsilon,
+                                     false);
+    };
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <complex>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
+
+#include "CacheManager.hpp"
+
+using namespace Catalyst::Runtime;
+using namespace Catch::Matchers;
+
+TEST_CASE("Test CacheManager records operations into a flat tape", "[CacheManager]")
+{
+    CacheManager<std::complex<double>> cache;
+
+    const std::vector<double> params{0.1, 0.2};
+    const std::vector<size_t> wires{0, 1};
+    const std::vector<std::complex<double>> matrix{{1, 0}, {0, 0}, {0, 0}, {1, 0}};
+    const std::vector<size_t> ctrl_wires{2};
+    const std::vector<bool> ctrl_values{true};
+
+    cache.addOperation("Hadamard", {}, std::vector<size_t>{0}, false);
+    cache.addOperation("IsingXY", params, wires, true, {}, ctrl_wires, ctrl_values);
+    cache.addOperation("QubitUnitary", {}, std::vector<size_t>{1}, false, matrix);
+    cache.addObservable(3, MeasurementsT::Expval);
+
+    CHECK(cache.getNumOperations() == 3);
+    CHECK(cache.getNumObservables() == 1);
+    CHECK(cache.getNumGates() == 4);
+    CHECK(cache.getNumParams() == 2);
+    CHECK(cache.getOperationsNames() ==
+          std::vector<std::string>{"Hadamard", "IsingXY", "QubitUnitary"});
+    CHECK(cache.getOperationsInverses() == std::vector<bool>{false, true, false});
+
+    CHECK(cache.getOperationParameters(0).empty());
+    CHECK(cache.getOperationWires(0)[0] == 0);
+
+    auto p1 = cache.getOperationParameters(1);
+    CHECK(std::vector<double>(p1.begin(), p1.end()) == params);
+    auto w1 = cache.getOperationWires(1);
+    CHECK(std::vector<size_t>(w1.begin(), w1.end()) == wires);
+    auto c1 = cache.getOperationControlledWires(1);
+    CHECK(std::vector<size_t>(c1.begin(), c1.end()) == ctrl_wires);
+    CHECK(cache.getOperationControlledValues(1) == ctrl_values);
+    CHECK(cache.getOperationMatrix(1).empty());
+
+    auto m2 = cache.getOperationMatrix(2);
+    CHECK(std::vector<std::complex<double>>(m2.begin(), m2.end()) == matrix);
+    CHECK(cache.getOperationControlledValues(2).empty());
+
+    REQUIRE_THROWS_WITH(cache.getOperationWires(3),
+                        ContainsSubstring("Invalid cached operation index"));
+
+    cache.Reset();
+    CHECK(cache.getNumGates() == 0);
+    CHECK(cache.getNumParams() == 0);
+
+    cache.addOperation("RX", std::vector<double>{0.3}, std::vector<size_t>{4}, false);
+    CHECK(cache.getOperationParameters(0)[0] == 0.3);
+    CHECK(cache.getOperationWires(0)[0] == 4);
+}
+
+TEST_CASE("Test CacheManager records a reserved tape without reallocating", "[CacheManager]")
+{
+    constexpr size_t num_ops = 10'000;
+
+    const std::vector<double> params{0.5};
+    const std::vector<size_t> wires{0, 1};
+
+    CacheManager<std::complex<double>> cache;
+    cache.Reserve(num_ops, num_ops, 2 * num_ops);
+
+    cache.addOperation("CRX", params, wires, false);
+    const double *params_data = cache.getOperationParameters(0).data();
+    const size_t *wires_data = cache.getOperationWires(0).data();
+
+    for (size_t i = 1; i < num_ops; i++) {
+        cache.addOperation("CRX", params, wires, false);
+    }
+
+    CHECK(cache.getNumOperations() == num_ops);
+    CHECK(cache.getNumParams() == num_ops);
+    CHECK(cache.getOperationWires(num_ops - 1)[1] == 1);
+    CHECK(cache.getOperationParameters(0).data() == params_data);
+    CHECK(cache.getOperationWires(0).data() == wires_data);
+
+    // The reserved buffers are kept across resets.
+    cache.Reset();
+    for (size_t i = 0; i < num_ops; i++) {
+        cache.addOperation("CRX", params, wires, false);
+    }
+    CHECK(cache.getNumOperations() == num_ops);
+    CHECK(cache.getOperationParameters(0).data() == params_data);
+    CHECK(cache.getOperationWires(0).data() == wires_data);
+}
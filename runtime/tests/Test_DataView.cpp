@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cstdio>
+#include <vector>
 
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
@@ -187,3 +188,61 @@ TEST_CASE("DataView Size - 0 first axis", "[DataView]")
 
     CHECK(view.size() == 0);
 }
+
+TEST_CASE("DataView contiguity", "[DataView]")
+{
+    int data_aligned[12] = {0};
+    size_t offset = 0;
+
+    size_t row_major_sizes[2] = {3, 4};
+    size_t row_major_strides[2] = {4, 1};
+    DataView<int, 2> row_major(data_aligned, offset, row_major_sizes, row_major_strides);
+    CHECK(row_major.is_contiguous());
+    CHECK(row_major.data() == data_aligned);
+
+    size_t col_major_strides[2] = {1, 3};
+    DataView<int, 2> col_major(data_aligned, offset, row_major_sizes, col_major_strides);
+    CHECK_FALSE(col_major.is_contiguous());
+
+    // A unit axis may have any stride
+    size_t unit_sizes[2] = {1, 4};
+    size_t unit_strides[2] = {0, 1};
+    DataView<int, 2> unit(data_aligned, 2, unit_sizes, unit_strides);
+    CHECK(unit.is_contiguous());
+    CHECK(unit.data() == data_aligned + 2);
+
+    DataView<int, 2> empty(nullptr, 0, nullptr, nullptr);
+    CHECK(empty.data() == nullptr);
+}
+
+TEST_CASE("DataView fill and copy_from - contiguous", "[DataView]")
+{
+    std::vector<double> buffer(6, -1.0);
+    size_t sizes[2] = {2, 3};
+    size_t strides[2] = {3, 1};
+    DataView<double, 2> view(buffer.data(), 0, sizes, strides);
+
+    view.fill(0.5);
+    CHECK(buffer == std::vector<double>(6, 0.5));
+
+    const std::vector<size_t> source = {0, 1, 2, 3, 4, 5};
+    view.copy_from(source.begin());
+    CHECK(buffer == std::vector<double>{0, 1, 2, 3, 4, 5});
+}
+
+TEST_CASE("DataView fill and copy_from - strided", "[DataView]")
+{
+    std::vector<int> buffer(8, -1);
+    size_t sizes[2] = {2, 2};
+    size_t strides[2] = {4, 2};
+    DataView<int, 2> view(buffer.data(), 1, sizes, strides);
+    REQUIRE_FALSE(view.is_contiguous());
+
+    view.fill(7);
+    CHECK(buffer == std::vector<int>{-1, 7, -1, 7, -1, 7, -1, 7});
+
+    const int source[] = {1, 2, 3, 4};
+    view.copy_from(source);
+    CHECK(buffer == std::vector<int>{-1, 1, -1, 2, -1, 3, -1, 4});
+    CHECK(view(1, 0) == 3);
+}
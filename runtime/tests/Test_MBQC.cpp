@@ -45,3 +45,34 @@ TEST_CASE("Test __catalyst__mbqc__measure_in_basis, device=null.qubit", "[MBQC]"
     __catalyst__rt__device_release();
     __catalyst__rt__finalize();
 }
+
+TEST_CASE("Test __catalyst__mbqc__measure_in_basis_array, device=null.qubit", "[MBQC]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"null.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    const size_t num_qubits = 3;
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(num_qubits);
+
+    QUBIT *wires[num_qubits];
+    for (size_t i = 0; i < num_qubits; i++) {
+        wires[i] = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, i);
+    }
+    const uint32_t planes[num_qubits] = {0U, 1U, 2U};
+    const double angles[num_qubits] = {0.0, 0.5, 1.0};
+    const int32_t postselects[num_qubits] = {-1, 0, -1};
+    RESULT *results[num_qubits] = {nullptr, nullptr, nullptr};
+
+    __catalyst__mbqc__measure_in_basis_array(num_qubits, wires, planes, angles, postselects,
+                                             results);
+
+    for (size_t i = 0; i < num_qubits; i++) {
+        REQUIRE(results[i] != nullptr);
+        CHECK(*results[i] == false); // For null.qubit, measurement result is always 0 (false)
+    }
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
@@ -0,0 +1,206 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <complex>
+#include <memory>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "MeasurementTree.hpp"
+#include "QuantumDevice.hpp"
+#include "QubitManager.hpp"
+#include "RuntimeCAPI.h"
+
+using namespace Catalyst::Runtime;
+
+// -------------------------------------------------------------------------- //
+// Measurement Tree Runtime Tests
+// -------------------------------------------------------------------------- //
+
+namespace {
+
+/**
+ * A device that counts the gates, state snapshots and restores, lends a fixed state vector, and
+ * returns random measurement outcomes. Its qubit manager, as those of the simulators, does not reuse the IDs of released
+ * qubits, so that each shot allocates new qubit IDs.
+ */
+struct CountingDevice final : public QuantumDevice {
+    size_t num_gates{0};
+    size_t num_snapshots{0};
+    size_t num_restores{0};
+    size_t num_qubits{0};
+    bool outcome{false};
+    std::vector<std::complex<double>> storage{1.0, 0.0};
+    std::mt19937 gen{42};
+    QubitManager<QubitIdType, size_t> qubit_manager{};
+
+    auto AllocateQubits(size_t count) -> std::vector<QubitIdType> override
+    {
+        std::vector<QubitIdType> ids = qubit_manager.AllocateRange(num_qubits, count);
+        num_qubits += count;
+        return ids;
+    }
+
+    void ReleaseQubits(const std::vector<QubitIdType> &qubits) override
+    {
+        for (QubitIdType qubit : qubits) {
+            qubit_manager.Release(qubit);
+        }
+        num_qubits -= qubits.size();
+    }
+
+    auto GetNumQubits() const -> size_t override { return num_qubits; }
+
+    void SetDeviceShots(size_t) override {}
+
+    auto GetDeviceShots() const -> size_t override { return 1; }
+
+    void NamedOperation(const std::string &, const std::vector<double> &,
+                        const std::vector<QubitIdType> &, bool, const std::vector<QubitIdType> &,
+                        const std::vector<bool> &, const std::vector<std::string> &) override
+    {
+        num_gates++;
+    }
+
+    auto Measure(QubitIdType, std::optional<int32_t>) -> Result override
+    {
+        outcome = gen() % 2;
+        return &outcome;
+    }
+
+    void State(DataView<std::complex<double>, 1> &) override { num_snapshots++; }
+
+    auto GetStateView() const -> std::span<const std::complex<double>> override
+    {
+        return storage;
+    }
+
+    void SetState(DataView<std::complex<double>, 1> &, std::vector<QubitIdType> &) override
+    {
+        num_restores++;
+    }
+};
+
+void runShot(QuantumDevice &device, double angle)
+{
+    std::vector<QubitIdType> qubits = device.AllocateQubits(2);
+    for (size_t i = 0; i < 10; i++) {
+        device.NamedOperation("RX", {angle}, {qubits[0]}, false);
+    }
+    device.Measure(qubits[0], std::nullopt);
+    for (size_t i = 0; i < 10; i++) {
+        device.NamedOperation("RY", {angle}, {qubits[1]}, false);
+    }
+    device.Measure(qubits[1], std::nullopt);
+    device.ReleaseQubits(qubits);
+}
+
+} // namespace
+
+TEST_CASE("Test the measurement tree simulates each execution prefix once", "[MeasurementTree]")
+{
+    auto counting_device = std::make_unique<CountingDevice>();
+    CountingDevice *counts = counting_device.get();
+    MeasurementTreeDevice device(std::move(counting_device));
+
+    device.setEnabled(true, 1);
+    for (size_t shot = 0; shot < 100; shot++) {
+        runShot(device, 0.5);
+    }
+
+    // The gates before the first measurement, and after it on both of its branches, although the
+    // qubits of each shot have new IDs
+    CHECK(counts->num_gates == 30);
+    CHECK(counts->num_snapshots == 3);
+    CHECK(counts->num_restores == 2 * 100 - 3);
+
+    // Other gate parameters lead to another prefix
+    runShot(device, 0.7);
+    CHECK(counts->num_gates >= 40);
+    CHECK(counts->num_snapshots >= 4);
+}
+
+TEST_CASE("Test the measurement tree is reset between epochs and when disabled",
+          "[MeasurementTree]")
+{
+    auto counting_device = std::make_unique<CountingDevice>();
+    CountingDevice *counts = counting_device.get();
+    MeasurementTreeDevice device(std::move(counting_device));
+
+    device.setEnabled(true, 1);
+    runShot(device, 0.5);
+    const size_t num_snapshots = counts->num_snapshots;
+
+    device.setEnabled(true, 2);
+    runShot(device, 0.5);
+    CHECK(counts->num_snapshots == 2 * num_snapshots);
+
+    device.setEnabled(false, 3);
+    const size_t num_gates = counts->num_gates;
+    runShot(device, 0.5);
+    CHECK(counts->num_gates == num_gates + 20);
+    CHECK(counts->num_snapshots == 2 * num_snapshots);
+}
+
+TEST_CASE("Test the measurement tree lends the device state only when it is up to date",
+          "[MeasurementTree]")
+{
+    auto counting_device = std::make_unique<CountingDevice>();
+    const std::complex<double> *storage = counting_device->storage.data();
+    MeasurementTreeDevice tree(std::move(counting_device));
+    QuantumDevice &device = tree;
+
+    tree.setEnabled(true, 1);
+    std::vector<QubitIdType> qubits = device.AllocateQubits(1);
+    CHECK(device.GetStateView().data() == storage);
+
+    // The gate is pending, so the lent state would be out of date
+    device.NamedOperation("RX", {0.5}, {qubits[0]}, false);
+    CHECK(device.GetStateView().empty());
+
+    // Reading the state applies the pending gate
+    std::vector<std::complex<double>> buffer(2);
+    DataView<std::complex<double>, 1> view(buffer);
+    device.State(view);
+    CHECK(device.GetStateView().data() == storage);
+    CHECK(device.GetStateView().size() == 2);
+
+    device.ReleaseQubits(qubits);
+}
+
+TEST_CASE("Test __catalyst__rt__toggle_measurement_tree, device=null.qubit", "[MeasurementTree]")
+{
+    __catalyst__rt__initialize(nullptr);
+    __catalyst__rt__toggle_measurement_tree(true);
+
+    const std::string rtd_name{"null.qubit"};
+    for (size_t shot = 0; shot < 3; shot++) {
+        __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 1, false);
+        QUBIT *qubit = __catalyst__rt__qubit_allocate();
+        __catalyst__qis__Hadamard(qubit, nullptr);
+        RESULT *result = __catalyst__qis__Measure(qubit, -1);
+        CHECK(*result == false);
+        CHECK(__catalyst__qis__Expval(__catalyst__qis__NamedObs(ObsId::PauliZ, qubit)) == 0.0);
+        __catalyst__rt__qubit_release(qubit);
+        __catalyst__rt__device_release();
+    }
+
+    __catalyst__rt__toggle_measurement_tree(false);
+    __catalyst__rt__finalize();
+}
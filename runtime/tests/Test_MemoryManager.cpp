@@ -0,0 +1,154 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
+
+#include "ExecutionContext.hpp"
+#include "MemRefUtils.hpp"
+#include "RuntimeCAPI.h"
+
+using namespace Catch::Matchers;
+using namespace Catalyst::Runtime;
+
+TEST_CASE("Test MemoryManager insert, contains and erase", "[MemoryManager]")
+{
+    MemoryManager manager;
+
+    void *ptr = malloc(16);
+    CHECK_FALSE(manager.contains(ptr));
+
+    manager.insert(ptr);
+    CHECK(manager.contains(ptr));
+
+    CHECK(manager.erase(ptr));
+    CHECK_FALSE(manager.contains(ptr));
+    CHECK_FALSE(manager.erase(ptr));
+
+    free(ptr);
+
+    // Tracked allocations are released together with the manager
+    manager.insert(malloc(16));
+    manager.insert(malloc(32));
+}
+
+TEST_CASE("Test MemoryManager current and peak bytes", "[MemoryManager]")
+{
+    MemoryManager manager;
+    MemoryUsage device_usage;
+
+    void *a = malloc(16);
+    void *b = malloc(32);
+    manager.insert(a, 16);
+    manager.insert(b, 32, &device_usage);
+    CHECK(manager.getUsage().getCurrent() == 48);
+    CHECK(device_usage.getCurrent() == 32);
+
+    CHECK(manager.erase(b));
+    CHECK(manager.getUsage().getCurrent() == 16);
+    CHECK(manager.getUsage().getPeak() == 48);
+    CHECK(device_usage.getCurrent() == 0);
+    CHECK(device_usage.getPeak() == 32);
+
+    // Erasing an untracked buffer does not change the accounting
+    CHECK_FALSE(manager.erase(b));
+    CHECK(manager.getUsage().getCurrent() == 16);
+    free(b);
+}
+
+TEST_CASE("Test the memory limit and queries of the runtime", "[MemoryManager]")
+{
+    setenv("CATALYST_RUNTIME_MEMORY_LIMIT", "1024", 1);
+    __catalyst__rt__initialize(nullptr);
+    unsetenv("CATALYST_RUNTIME_MEMORY_LIMIT");
+
+    const std::string rtd_name{"null.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    void *ptr = _mlir_memref_to_llvm_alloc(512);
+    CHECK(__catalyst__rt__memory_current_bytes() == 512);
+    _mlir_memref_to_llvm_free(ptr);
+    CHECK(__catalyst__rt__memory_current_bytes() == 0);
+
+    ptr = _mlir_memref_to_llvm_alloc(600);
+    REQUIRE_THROWS_WITH(_mlir_memref_to_llvm_alloc(600),
+                        ContainsSubstring("exceeds the memory limit of the execution"));
+    CHECK(__catalyst__rt__memory_peak_bytes() == 600);
+    CHECK(__catalyst__rt__device_memory_peak_bytes() == 600);
+    _mlir_memref_to_llvm_free(ptr);
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+
+    // The peak of the finalized execution remains available
+    CHECK(__catalyst__rt__memory_current_bytes() == 0);
+    CHECK(__catalyst__rt__memory_peak_bytes() == 600);
+}
+
+TEST_CASE("Test runtime memory allocation from concurrent threads", "[MemoryManager]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    constexpr size_t num_allocations = 2000;
+
+    for (size_t num_threads : {1, 2, 4, 8, 16, 32, 64}) {
+        std::vector<std::thread> threads;
+        std::vector<int> results(num_threads, 0);
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t t = 0; t < num_threads; t++) {
+            threads.emplace_back([&results, t]() {
+                std::vector<void *> ptrs(num_allocations);
+                for (auto &ptr : ptrs) {
+                    ptr = _mlir_memref_to_llvm_alloc(8);
+                }
+
+                // Free half of the buffers and transfer the other half out of the runtime
+                bool success = true;
+                for (size_t i = 0; i < num_allocations; i++) {
+                    if (i % 2 == 0) {
+                        _mlir_memref_to_llvm_free(ptrs[i]);
+                    }
+                    else {
+                        // A buffer that was not transferred is still freed by the runtime
+                        const bool transferred = _mlir_memory_transfer(ptrs[i]);
+                        const bool transferred_again = _mlir_memory_transfer(ptrs[i]);
+                        if (transferred) {
+                            free(ptrs[i]);
+                        }
+                        success = success && transferred && !transferred_again;
+                    }
+                }
+                results[t] = success;
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        const std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - start;
+        INFO("threads: " << num_threads << ", time per allocation: "
+                         << elapsed.count() / (num_threads * num_allocations) << "us");
+        CHECK(std::find(results.begin(), results.end(), 0) == results.end());
+    }
+
+    __catalyst__rt__finalize();
+}
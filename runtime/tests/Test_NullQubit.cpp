@@ -12,9 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <future>
+#include <numeric>
+#include <sstream>
+#include <thread>
 
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
@@ -23,6 +30,7 @@
 #include "ExecutionContext.hpp"
 #include "NullQubit.hpp"
 #include "QuantumDevice.hpp"
+#include "QubitArray.hpp"
 #include "QubitManager.hpp"
 #include "RuntimeCAPI.h"
 #include "TestUtils.hpp"
@@ -90,6 +98,121 @@ TEST_CASE("Test __catalyst__rt__device_init registering device=null.qubit", "[Nu
     __catalyst__rt__finalize();
 }
 
+TEST_CASE("Test device pool reuses released devices", "[NullQubit]")
+{
+    std::unique_ptr<ExecutionContext> driver = std::make_unique<ExecutionContext>();
+
+    RTDevice *first = driver->getOrCreateDevice("null.qubit").get();
+    driver->deactivateDevice(first);
+
+    // Equivalent specifications map to the same pooled device
+    RTDevice *second = driver->getOrCreateDevice("librtd_null_qubit" + get_dylib_ext(), "NullQubit",
+                                                 "", false)
+                           .get();
+    CHECK(second == first);
+    CHECK(second->getDeviceStatus() == RTDeviceStatus::Active);
+
+    // An active device is never handed out twice
+    RTDevice *third = driver->getOrCreateDevice("null.qubit").get();
+    CHECK(third != first);
+
+    RTDevice *other = driver->getOrCreateDevice("null.qubit", "", "{'shots': 10}").get();
+    CHECK(other != first);
+    CHECK(other != third);
+
+    driver->deactivateDevice(second);
+    driver->deactivateDevice(second);
+    driver->deactivateDevice(third);
+    CHECK(driver->getOrCreateDevice("null.qubit").get() == third);
+
+    const auto stats = driver->getDevicePoolStats();
+    CHECK(stats.created == 3);
+    CHECK(stats.reused == 2);
+    CHECK(stats.released == 3);
+}
+
+TEST_CASE("Test the NUMA topology of the host", "[NullQubit]")
+{
+    CHECK(NumaTopology::parseCpuList("0-3,8,10-11") ==
+          std::vector<size_t>{0, 1, 2, 3, 8, 10, 11});
+    CHECK(NumaTopology::parseCpuList("5") == std::vector<size_t>{5});
+
+    const NumaTopology &topology = NumaTopology::getInstance();
+    const int node = topology.getCurrentNode();
+    CHECK(node < static_cast<int>(topology.getNumNodes()));
+    if (topology.getNumNodes() == 0) {
+        CHECK(node == -1);
+    }
+}
+
+TEST_CASE("Test the device pool limits the number of instances per device", "[NullQubit]")
+{
+    ExecutionContext driver;
+    driver.setMaxDevicesPerKey(1);
+
+    RTDevice *first = driver.getOrCreateDevice("null.qubit").get();
+
+    // Other configurations are limited separately
+    RTDevice *other = driver.getOrCreateDevice("null.qubit", "", "{'shots': 10}").get();
+    CHECK(other != first);
+
+    std::atomic<RTDevice *> second{nullptr};
+    std::thread worker([&]() { second = driver.getOrCreateDevice("null.qubit").get(); });
+
+    // The request waits for the only instance to be released instead of creating a new one
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(second == nullptr);
+    driver.deactivateDevice(first);
+    worker.join();
+
+    CHECK(second == first);
+    const auto stats = driver.getDevicePoolStats();
+    CHECK(stats.created == 2);
+    CHECK(stats.waited == 1);
+}
+
+TEST_CASE("Test async regions run on the runtime executor", "[NullQubit]")
+{
+    __catalyst__rt__async_configure(2, false, 0);
+
+    constexpr size_t num_tasks = 64;
+    std::atomic<size_t> num_done{0};
+    auto task = [](void *counter) { static_cast<std::atomic<size_t> *>(counter)->fetch_add(1); };
+    for (size_t i = 0; i < num_tasks; i++) {
+        __catalyst__rt__async_execute(&num_done, task);
+    }
+
+    // Reconfiguring drains the queue of scheduled tasks first
+    CHECK(AsyncExecutor::getInstance().getNumWorkers() == 2);
+    __catalyst__rt__async_configure(0, false, 0);
+    CHECK(num_done == num_tasks);
+    CHECK(AsyncExecutor::getInstance().getNumWorkers() == 0);
+
+    REQUIRE_THROWS_WITH(__catalyst__rt__async_configure(-1, false, 0),
+                        ContainsSubstring("Invalid number of async workers"));
+}
+
+TEST_CASE("Test device libraries are loaded once per process", "[NullQubit]")
+{
+    // Make sure the library is resident before taking the baseline
+    {
+        ExecutionContext driver;
+        REQUIRE(driver.getOrCreateDevice("null.qubit")->getQuantumDevicePtr() != nullptr);
+    }
+    const auto [loads, lookups] = DeviceLibraryCache::getInstance().getStats();
+
+    for (size_t i = 0; i < 4; i++) {
+        std::unique_ptr<ExecutionContext> driver = std::make_unique<ExecutionContext>();
+        auto device = driver->getOrCreateDevice("null.qubit");
+        REQUIRE(device->getQuantumDevicePtr() != nullptr);
+        driver->deactivateDevice(device.get());
+    }
+
+    const auto stats = DeviceLibraryCache::getInstance().getStats();
+    CHECK(stats.first == loads);
+    CHECK(stats.second == lookups);
+}
+
 TEST_CASE("Test runtime device kwargs parsing", "[NullQubit]")
 {
     std::unique_ptr<NullQubit> sim0 = std::make_unique<NullQubit>("{foo : bar}");
@@ -141,6 +264,52 @@ TEST_CASE("Test automatic qubit management", "[NullQubit]")
     __catalyst__rt__finalize();
 }
 
+TEST_CASE("Test automatic qubit management grows an allocated register", "[NullQubit]")
+{
+    const auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+    __catalyst__rt__initialize(nullptr);
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), 0,
+                                /*auto_qubit_management=*/true);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+    CHECK(__catalyst__rt__array_get_size_1d(qs) == 2);
+
+    // Grow twice, past the inline storage of the register
+    __catalyst__rt__array_get_element_ptr_1d(qs, 4);
+    CHECK(__catalyst__rt__array_get_size_1d(qs) == 5);
+    QUBIT **target = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 20);
+    CHECK(reinterpret_cast<QubitIdType>(*target) == 20);
+    CHECK(__catalyst__rt__num_qubits() == 21);
+
+    std::vector<QubitIdType> expected(21);
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(QubitArray::fromQirArray(qs)->toVector() == expected);
+
+    __catalyst__rt__qubit_release_array(qs);
+    CHECK(__catalyst__rt__num_qubits() == 0);
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test allocation of a large qubit register", "[NullQubit]")
+{
+    constexpr size_t num_qubits = 1 << 16;
+    NullQubit device("{}");
+
+    QubitArray *reg = QubitArray::create(num_qubits);
+    device.AllocateQubitsInPlace(reg->getIds());
+    CHECK(device.GetNumQubits() == num_qubits);
+    CHECK(reg->getData()[0] == 0);
+    CHECK(reg->getData()[num_qubits - 1] == num_qubits - 1);
+
+    device.ReleaseQubits(reg->toVector());
+    CHECK(device.GetNumQubits() == 0);
+    QubitArray::destroy(reg);
+}
+
 TEST_CASE("Test NullQubit qubit allocation is successful.", "[NullQubit]")
 {
     std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>();
@@ -175,9 +344,9 @@ TEST_CASE("Test a NullQubit circuit with num_qubits=2 ", "[NullQubit]")
     sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
 
     auto &&[num_ops, num_obs, num_params, op_names, obs_keys] = sim->CacheManagerInfo();
-    CHECK((num_ops == 0 && num_obs == 0));
+    CHECK((num_ops == 2 && num_obs == 0));
     CHECK(num_params == 0);
-    CHECK(op_names.empty());
+    CHECK(op_names == std::vector<std::string>{"PauliX", "CNOT"});
     CHECK(obs_keys.empty());
 }
 
@@ -204,10 +373,13 @@ TEST_CASE("Test a NullQubit circuit with num_qubits=4", "[NullQubit]")
     sim->NamedOperation("CRZ", {0.789}, {Qs[0], Qs[3]}, false);
     sim->StopTapeRecording();
 
+    // Operations applied after the recording stopped are not cached
+    sim->NamedOperation("Hadamard", {}, {Qs[1]}, false);
+
     auto &&[num_ops, num_obs, num_params, op_names, obs_keys] = sim->CacheManagerInfo();
-    CHECK((num_ops == 0 && num_obs == 0));
-    CHECK(num_params == 0);
-    CHECK(op_names.empty());
+    CHECK((num_ops == 4 && num_obs == 0));
+    CHECK(num_params == 3);
+    CHECK(op_names == std::vector<std::string>{"Hadamard", "CRX", "CRY", "CRZ"});
     CHECK(obs_keys.empty());
 }
 
@@ -240,11 +412,11 @@ TEST_CASE("Test a NullQubit circuit with num_qubits=4 and observables", "[NullQu
     sim->Expval(t);
 
     auto &&[num_ops, num_obs, num_params, op_names, obs_keys] = sim->CacheManagerInfo();
-    CHECK(num_ops == 0);
-    CHECK(num_obs == 0);
+    CHECK(num_ops == 4);
+    CHECK(num_obs == 4);
     CHECK(num_params == 0);
-    CHECK(op_names.empty());
-    CHECK(obs_keys.empty());
+    CHECK(op_names == std::vector<std::string>{"PauliX", "PauliY", "Hadamard", "PauliZ"});
+    CHECK(obs_keys == std::vector<ObsIdType>{h, px, pz, t});
 }
 
 TEST_CASE("Test a NullQubit circuit with num_qubits=1 that performs a measurement", "[NullQubit]")
@@ -263,20 +435,165 @@ TEST_CASE("Test a NullQubit circuit with num_qubits=1 that performs a measuremen
     auto m = sim->Measure(Qs[0], {} /*postselect*/);
 
     auto &&[num_ops, num_obs, num_params, op_names, obs_keys] = sim->CacheManagerInfo();
-    CHECK(num_ops == 0);
+    CHECK(num_ops == 1);
     CHECK(num_obs == 0);
     CHECK(num_params == 0);
-    CHECK(op_names.empty());
+    CHECK(op_names == std::vector<std::string>{"Hadamard"});
     CHECK(obs_keys.empty());
     CHECK(*m == false); // Measurement of NullQubit should always return 0 (false)
 }
 
+TEST_CASE("Test NullQubit tape recording of opcode, batched and matrix operations", "[NullQubit]")
+{
+    std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(2);
+
+    sim->StartTapeRecording();
+    const std::vector<double> angle{0.5};
+    sim->GateOperation(GateId::RX, angle, std::span<const QubitIdType>{Qs.data(), 1});
+
+    const std::vector<BatchedGate> gates{{static_cast<int64_t>(GateId::RY), 0, 1, 1},
+                                         {static_cast<int64_t>(GateId::CNOT), 0, 0, 2}};
+    const std::vector<double> params{0.25};
+    const std::vector<QubitIdType> wires{Qs[1], Qs[0], Qs[1]};
+    sim->ApplyOperations(gates, params, wires);
+
+    std::vector<std::complex<double>> matrix{1, 0, 0, 1};
+    sim->MatrixOperation(matrix, {Qs[0]}, false);
+    sim->StopTapeRecording();
+
+    auto &&[num_ops, num_obs, num_params, op_names, obs_keys] = sim->CacheManagerInfo();
+    CHECK(num_ops == 4);
+    CHECK(num_obs == 0);
+    CHECK(num_params == 2);
+    CHECK(op_names == std::vector<std::string>{"RX", "RY", "CNOT", "QubitUnitary"});
+
+    // Re-activating an active recorder or stopping a stopped one fails
+    sim->StartTapeRecording();
+    REQUIRE_THROWS_WITH(sim->StartTapeRecording(),
+                        ContainsSubstring("Cannot re-activate the cache manager"));
+    sim->StopTapeRecording();
+    REQUIRE_THROWS_WITH(sim->StopTapeRecording(),
+                        ContainsSubstring("Cannot stop an already stopped cache manager"));
+}
+
+TEST_CASE("Test NullQubit adjoint-method Gradient", "[NullQubit][Gradient]")
+{
+    std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(2);
+
+    sim->StartTapeRecording();
+    sim->NamedOperation("RX", {0.1}, {Qs[0]}, false);
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
+    sim->NamedOperation("RZ", {0.2}, {Qs[1]}, false);
+    sim->NamedOperation("Rot", {0.3, 0.4, 0.5}, {Qs[0]}, false);
+
+    ObsIdType pz = sim->Observable(ObsId::PauliZ, {}, {Qs[0]});
+    ObsIdType px = sim->Observable(ObsId::PauliX, {}, {Qs[1]});
+    sim->Expval(pz);
+    sim->Expval(px);
+    sim->StopTapeRecording();
+
+    std::vector<double> buffer0(5, 1.0);
+    std::vector<double> buffer1(5, 1.0);
+    std::vector<DataView<double, 1>> gradients{DataView<double, 1>(buffer0),
+                                               DataView<double, 1>(buffer1)};
+
+    SECTION("All parameters are trainable")
+    {
+        sim->Gradient(gradients, {});
+
+        CHECK(buffer0 == std::vector<double>(5, 0.0));
+        CHECK(buffer1 == std::vector<double>(5, 0.0));
+
+        // 4 operations x 2 states + 5 generators, for each of the 2 observables
+        CHECK(sim->GetNumAdjointGateApplications() == 26);
+    }
+
+    SECTION("Only some parameters are trainable")
+    {
+        std::vector<double> buffer2(2, 1.0);
+        std::vector<double> buffer3(2, 1.0);
+        std::vector<DataView<double, 1>> partial_gradients{DataView<double, 1>(buffer2),
+                                                           DataView<double, 1>(buffer3)};
+        sim->Gradient(partial_gradients, {0, 3});
+
+        CHECK(buffer2 == std::vector<double>(2, 0.0));
+        CHECK(buffer3 == std::vector<double>(2, 0.0));
+        CHECK(sim->GetNumAdjointGateApplications() == 20);
+    }
+
+    SECTION("Invalid gradients")
+    {
+        std::vector<DataView<double, 1>> too_few{DataView<double, 1>(buffer0)};
+        REQUIRE_THROWS_WITH(sim->Gradient(too_few, {}),
+                            ContainsSubstring("Invalid number of pre-allocated gradients"));
+        REQUIRE_THROWS_WITH(sim->Gradient(gradients, {0, 1}),
+                            ContainsSubstring("Invalid size of the gradient"));
+        REQUIRE_THROWS_WITH(sim->Gradient(gradients, {5}),
+                            ContainsSubstring("Invalid trainable parameter"));
+    }
+}
+
+TEST_CASE("Test NullQubit checkpointed adjoint-method Gradient", "[NullQubit][Gradient]")
+{
+    std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>();
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(2);
+
+    sim->SetTapeCheckpointInterval(2);
+    sim->StartTapeRecording();
+    sim->NamedOperation("RX", {0.1}, {Qs[0]}, false);
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
+    sim->NamedOperation("RZ", {0.2}, {Qs[1]}, false);
+    sim->NamedOperation("RY", {0.3}, {Qs[0]}, false);
+    sim->NamedOperation("Hadamard", {}, {Qs[1]}, false);
+    sim->Expval(sim->Observable(ObsId::PauliZ, {}, {Qs[0]}));
+    sim->StopTapeRecording();
+
+    // One checkpoint before operations 0, 2 and 4
+    CHECK(sim->GetNumTapeCheckpoints() == 3);
+
+    std::vector<double> buffer(3, 1.0);
+    std::vector<DataView<double, 1>> gradients{DataView<double, 1>(buffer)};
+    sim->Gradient(gradients, {});
+
+    CHECK(buffer == std::vector<double>(3, 0.0));
+    // Each segment is recomputed forward and uncomputed on the bra state, plus 3 generators
+    CHECK(sim->GetNumAdjointGateApplications() == 13);
+}
+
+TEST_CASE_METHOD(NullQubitRuntimeFixture, "Test __catalyst__rt__set_tape_checkpoint_interval",
+                 "[NullQubit][Gradient]")
+{
+    REQUIRE_THROWS_WITH(__catalyst__rt__set_tape_checkpoint_interval(-1),
+                        ContainsSubstring("Invalid tape checkpoint interval"));
+
+    constexpr size_t num_ops = 9;
+    std::vector<double> buffer(num_ops, 1.0);
+    MemRefT_double_1d result = {buffer.data(), buffer.data(), 0, {num_ops}, {1}};
+
+    __catalyst__rt__set_tape_checkpoint_interval(4);
+    QUBIT *q0 = __catalyst__rt__qubit_allocate();
+    __catalyst__rt__toggle_recorder(/* activate_cm */ true);
+    for (size_t i = 0; i < num_ops; i++) {
+        __catalyst__qis__RX(0.1 * i, q0, NO_MODIFIERS);
+    }
+    __catalyst__qis__Expval(__catalyst__qis__NamedObs(ObsId::PauliZ, q0));
+    __catalyst__rt__toggle_recorder(/* activate_cm */ false);
+    __catalyst__rt__set_tape_checkpoint_interval(0);
+
+    __catalyst__qis__Gradient(1, &result);
+    CHECK(buffer == std::vector<double>(num_ops, 0.0));
+
+    __catalyst__rt__qubit_release(q0);
+}
+
 TEST_CASE_METHOD(NullQubitRuntimeFixture, "Test null qubit circuit with pauli measurement succeeds",
                  "[NullQubit]")
 {
     QirArray *reg = __catalyst__rt__qubit_allocate_array(3);
 
-    auto reg_vec = *reinterpret_cast<std::vector<QubitIdType> *>(reg);
+    auto reg_vec = QubitArray::fromQirArray(reg)->toVector();
 
     RESULT *m = __catalyst__qis__PauliMeasure("XYZ", false, nullptr, false, true, 3, reg_vec[0],
                                               reg_vec[1], reg_vec[2]);
@@ -330,6 +647,56 @@ TEST_CASE("Test __catalyst__qis__Sample with num_qubits=2 and PartialSample call
     __catalyst__rt__finalize();
 }
 
+TEST_CASE("Test __catalyst__qis__SampleChunked", "[CoreQIS]")
+{
+    constexpr size_t shots = 10;
+    const auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+    __catalyst__rt__initialize(nullptr);
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), shots, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(3);
+    QUBIT **q1 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+    struct ChunkStats {
+        std::vector<int64_t> shots;
+        int64_t num_qubits{0};
+        double sum{0.0};
+    };
+    SampleChunkCallback reduce = [](void *context, const double *samples, int64_t numShots,
+                                    int64_t numQubits) {
+        auto *stats = static_cast<ChunkStats *>(context);
+        stats->shots.push_back(numShots);
+        stats->num_qubits = numQubits;
+        for (int64_t i = 0; i < numShots * numQubits; i++) {
+            stats->sum += samples[i];
+        }
+    };
+
+    ChunkStats all;
+    __catalyst__qis__SampleChunked(reduce, &all, 4, 0);
+    CHECK(all.shots == std::vector<int64_t>{4, 4, 2});
+    CHECK(all.num_qubits == 3);
+
+    ChunkStats partial;
+    __catalyst__qis__SampleChunked(reduce, &partial, 16, 1, *q1);
+    CHECK(partial.shots == std::vector<int64_t>{10});
+    CHECK(partial.num_qubits == 1);
+
+    // The device shots are restored after streaming
+    std::vector<double> buffer(shots);
+    MemRefT_double_2d result = {buffer.data(), buffer.data(), 0, {shots, 1}, {1, 1}};
+    REQUIRE_NOTHROW(__catalyst__qis__Sample(&result, 1, *q1));
+
+    REQUIRE_THROWS_WITH(__catalyst__qis__SampleChunked(reduce, &all, 0, 0),
+                        ContainsSubstring("must be positive"));
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
 TEST_CASE("Test NullQubit state vector - 0 qubits", "[NullQubit]")
 {
     std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>();
@@ -492,12 +859,81 @@ TEST_CASE("Test allocation of multiple registers", "[NullQubit]")
     CHECK(sim->GetNumQubits() == 3);
 }
 
+TEST_CASE("Test FlatQubitManager reuses released device slots", "[NullQubit]")
+{
+    FlatQubitManager<QubitIdType, size_t> qm{};
+
+    auto ids = qm.AllocateRange(3);
+    CHECK(ids == std::vector<QubitIdType>{0, 1, 2});
+    CHECK(qm.getDeviceIds(ids) == std::vector<size_t>{0, 1, 2});
+
+    qm.Release(1);
+    CHECK_FALSE(qm.isValidQubitId(1));
+    CHECK(qm.isValidQubitId(std::vector<QubitIdType>{0, 2}));
+    CHECK(qm.getAllQubitIds() == std::vector<QubitIdType>{0, 2});
+    CHECK(qm.getDeviceId(2) == 2);
+    REQUIRE_THROWS_WITH(qm.getDeviceId(1), ContainsSubstring("Invalid device qubit index"));
+    REQUIRE_THROWS_WITH(qm.Release(1), ContainsSubstring("Invalid simulator qubit index"));
+    REQUIRE_THROWS_WITH(qm.getSimulatorId(1), ContainsSubstring("Invalid simulator qubit index"));
+
+    // Simulator IDs are never reused, while the released device slot is
+    QubitIdType q = qm.Allocate();
+    CHECK(q == 3);
+    CHECK(qm.getDeviceId(q) == 1);
+    CHECK(qm.getSimulatorId(1) == q);
+    CHECK(qm.getNumQubits() == 3);
+
+    for (QubitIdType id : qm.getAllQubitIds()) {
+        qm.Release(id);
+    }
+    CHECK(qm.getNumQubits() == 0);
+    CHECK(qm.getAllQubitIds().empty());
+
+    q = qm.Allocate();
+    CHECK(q == 4);
+    CHECK(qm.getDeviceId(q) == 0);
+
+    qm.ReleaseAll();
+    CHECK_FALSE(qm.isValidQubitId(q));
+    CHECK(qm.AllocateRange(2) == std::vector<QubitIdType>{5, 6});
+}
+
+TEST_CASE("Test FlatQubitManager slots stay bounded around a long-lived qubit", "[NullQubit]")
+{
+    FlatQubitManager<QubitIdType, size_t> qm{};
+
+    const QubitIdType kept = qm.Allocate();
+    for (size_t i = 0; i < 10'000; i++) {
+        auto ids = qm.AllocateRange(2);
+        qm.Release(ids[0]);
+        qm.Release(ids[1]);
+        CHECK(qm.getNumSlots() <= 64);
+    }
+
+    // The long-lived qubit is still valid, and the released ones are not
+    CHECK(qm.getNumQubits() == 1);
+    CHECK(qm.getDeviceId(kept) == 0);
+    CHECK(qm.getAllQubitIds() == std::vector<QubitIdType>{kept});
+    CHECK_FALSE(qm.isValidQubitId(1));
+
+    QubitIdType q = qm.Allocate();
+    CHECK(q == 20'001);
+    CHECK(qm.getDeviceId(q) == 1);
+    CHECK(qm.getAllQubitIds() == std::vector<QubitIdType>{kept, q});
+
+    qm.Release(kept);
+    CHECK_FALSE(qm.isValidQubitId(kept));
+    REQUIRE_THROWS_WITH(qm.Release(kept), ContainsSubstring("Invalid simulator qubit index"));
+    CHECK(qm.getAllQubitIds() == std::vector<QubitIdType>{q});
+    CHECK(qm.getSimulatorId(qm.getDeviceId(q)) == q);
+}
+
 TEST_CASE_METHOD(NullQubitRuntimeFixture, "Test insertion of qubit into register", "[NullQubit]")
 {
     // Allocate register with three qubits, [0, 1, 2]
     QirArray *reg = __catalyst__rt__qubit_allocate_array(3);
 
-    auto reg_vec_before = *reinterpret_cast<std::vector<QubitIdType> *>(reg);
+    auto reg_vec_before = QubitArray::fromQirArray(reg)->toVector();
 
     CHECK(reg_vec_before[0] == 0);
     CHECK(reg_vec_before[1] == 1);
@@ -515,7 +951,7 @@ TEST_CASE_METHOD(NullQubitRuntimeFixture, "Test insertion of qubit into register
     // Afterwards, `reg` should be [0, 3, 2]
     __catalyst__rt__array_update_element_1d(reg, 1, reinterpret_cast<QUBIT *>(q));
 
-    auto reg_vec_after = *reinterpret_cast<std::vector<QubitIdType> *>(reg);
+    auto reg_vec_after = QubitArray::fromQirArray(reg)->toVector();
 
     CHECK(reg_vec_after[0] == 0);
     CHECK(reg_vec_after[1] == 3);
@@ -529,11 +965,11 @@ TEST_CASE_METHOD(NullQubitRuntimeFixture,
     QirArray *reg1 = __catalyst__rt__qubit_allocate_array(1); // [0]
     QirArray *reg2 = __catalyst__rt__qubit_allocate_array(2); // [1, 2]
 
-    auto reg1_vec = *reinterpret_cast<std::vector<QubitIdType> *>(reg1);
+    auto reg1_vec = QubitArray::fromQirArray(reg1)->toVector();
 
     CHECK(reg1_vec[0] == 0);
 
-    auto reg2_vec = *reinterpret_cast<std::vector<QubitIdType> *>(reg2);
+    auto reg2_vec = QubitArray::fromQirArray(reg2)->toVector();
 
     CHECK(reg2_vec[0] == 1);
     CHECK(reg2_vec[1] == 2);
@@ -550,7 +986,7 @@ TEST_CASE_METHOD(NullQubitRuntimeFixture,
     // Insert qubit 2 into position 0 of reg1
     __catalyst__rt__array_update_element_1d(reg1, 0, *q2);
 
-    auto reg1_vec_after = *reinterpret_cast<std::vector<QubitIdType> *>(reg1);
+    auto reg1_vec_after = QubitArray::fromQirArray(reg1)->toVector();
 
     CHECK(reg1_vec_after[0] == 2);
 }
@@ -563,7 +999,7 @@ TEST_CASE_METHOD(
     // Allocate register with three qubits, [0, 1, 2]
     QirArray *reg = __catalyst__rt__qubit_allocate_array(3);
 
-    auto reg_vec_before = *reinterpret_cast<std::vector<QubitIdType> *>(reg);
+    auto reg_vec_before = QubitArray::fromQirArray(reg)->toVector();
 
     // Allocate an individual qubit; internally it has ID 3
     QUBIT *q = __catalyst__rt__qubit_allocate();
@@ -613,6 +1049,490 @@ TEST_CASE("Gate PCPhase num_qubits=3", "[NullQubit]")
     CHECK_THAT(view(0).imag(), WithinRel(0.0, 1e-5));
 }
 
+TEST_CASE("Test gate opcode names", "[NullQubit]")
+{
+    CHECK(getGateName(GateId::Identity) == "Identity");
+    CHECK(getGateName(GateId::CNOT) == "CNOT");
+    CHECK(getGateName(GateId::ControlledPhaseShift) == "ControlledPhaseShift");
+    CHECK(getGateName(GateId::PSWAP) == "PSWAP");
+    CHECK(getGateName(GateId::NumGates).empty());
+}
+
+TEST_CASE("Gate opcode dispatch num_qubits=3", "[NullQubit]")
+{
+    std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>();
+
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(3);
+
+    const double params[] = {0.123};
+    const QubitIdType wires[] = {Qs[0], Qs[1]};
+    const QubitIdType ctrl_wires[] = {Qs[2]};
+    const bool ctrl_values[] = {true};
+
+    sim->GateOperation(GateId::Hadamard, {}, std::span<const QubitIdType>(wires, 1));
+    sim->GateOperation(GateId::CRX, params, wires, true);
+    sim->GateOperation(GateId::IsingXX, params, wires, false, ctrl_wires, ctrl_values);
+
+    std::vector<std::complex<double>> state(1U << sim->GetNumQubits());
+    DataView<std::complex<double>, 1> view(state);
+    sim->State(view);
+
+    CHECK(view.size() == 8);
+    CHECK_THAT(view(0).real(), WithinRel(1.0, 1e-5));
+    CHECK_THAT(view(0).imag(), WithinRel(0.0, 1e-5));
+}
+
+TEST_CASE_METHOD(NullQubitRuntimeFixture,
+                 "Test variadic gates and observables beyond the inline buffer capacity",
+                 "[NullQubit]")
+{
+    constexpr int64_t n = 12;
+    QirArray *reg = __catalyst__rt__qubit_allocate_array(n);
+
+    std::vector<QUBIT *> Qs(n);
+    for (int64_t i = 0; i < n; i++) {
+        Qs[i] = *reinterpret_cast<QUBIT **>(__catalyst__rt__array_get_element_ptr_1d(reg, i));
+    }
+
+    __catalyst__qis__Identity(NO_MODIFIERS, 2, Qs[0], Qs[1]);
+    __catalyst__qis__MultiRZ(0.5, NO_MODIFIERS, n, Qs[0], Qs[1], Qs[2], Qs[3], Qs[4], Qs[5],
+                             Qs[6], Qs[7], Qs[8], Qs[9], Qs[10], Qs[11]);
+
+    std::vector<ObsIdType> obs(n);
+    for (int64_t i = 0; i < n; i++) {
+        obs[i] = __catalyst__qis__NamedObs(ObsId::PauliZ, Qs[i]);
+    }
+    ObsIdType tp = __catalyst__qis__TensorObs(n, obs[0], obs[1], obs[2], obs[3], obs[4], obs[5],
+                                              obs[6], obs[7], obs[8], obs[9], obs[10], obs[11]);
+
+    double coeffs_data[] = {0.1, 0.2};
+    MemRefT_double_1d coeffs = {coeffs_data, coeffs_data, 0, {2}, {1}};
+    ObsIdType ham = __catalyst__qis__HamiltonianObs(&coeffs, 2, obs[0], tp);
+
+    CHECK(__catalyst__qis__Expval(ham) == 0.0);
+
+    __catalyst__rt__qubit_release_array(reg);
+}
+
+TEST_CASE("Gate batch dispatch num_qubits=2", "[NullQubit]")
+{
+    std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>();
+
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(2);
+
+    const BatchedGate gates[] = {
+        {static_cast<int64_t>(GateId::Hadamard), 0, 0, 1},
+        {static_cast<int64_t>(GateId::CNOT), 1, 0, 2},
+        {static_cast<int64_t>(GateId::Rot), 0, 3, 1},
+    };
+    const double params[] = {0.1, 0.2, 0.3};
+    const QubitIdType wires[] = {Qs[0], Qs[0], Qs[1], Qs[1]};
+    sim->ApplyOperations(gates, params, wires);
+
+    std::vector<std::complex<double>> state(1U << sim->GetNumQubits());
+    DataView<std::complex<double>, 1> view(state);
+    sim->State(view);
+
+    CHECK(view.size() == 4);
+    CHECK_THAT(view(0).real(), WithinRel(1.0, 1e-5));
+}
+
+/**
+ * @brief A minimal device that only implements the required `QuantumDevice` methods and records
+ *        the arguments of the vector-based entry points, to test the default implementations of
+ *        the view-based ones.
+ */
+struct RecordingDevice final : public QuantumDevice {
+    std::vector<std::string> gate_names;
+    std::vector<std::complex<double>> matrix;
+    std::vector<int8_t> basis_state;
+    std::vector<QubitIdType> wires;
+    size_t shots{0};
+    size_t sample_offset{0};
+    size_t num_qubits{0};
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> override
+    {
+        std::vector<QubitIdType> ids(num_qubits);
+        for (size_t i = 0; i < num_qubits; i++) {
+            ids[i] = static_cast<QubitIdType>(i);
+        }
+        return ids;
+    }
+    void ReleaseQubits(const std::vector<QubitIdType> &) override {}
+    [[nodiscard]] auto GetNumQubits() const -> size_t override { return num_qubits; }
+    void SetDeviceShots(size_t _shots) override { shots = _shots; }
+    [[nodiscard]] auto GetDeviceShots() const -> size_t override { return shots; }
+    auto Measure(QubitIdType, std::optional<int32_t>) -> Result override { return nullptr; }
+
+    // Sample `j` of shot `i` is set when `(i + j) % 3 == 0`, for packed sampling tests
+    void PartialSample(DataView<double, 2> &samples,
+                       const std::vector<QubitIdType> &_wires) override
+    {
+        size_t idx = 0;
+        for (auto it = samples.begin(); it != samples.end(); ++it, ++idx) {
+            const size_t shot = sample_offset + idx / _wires.size();
+            *it = static_cast<double>((shot + idx % _wires.size()) % 3 == 0);
+        }
+        sample_offset += samples.size() / _wires.size();
+    }
+
+    void NamedOperation(const std::string &name, const std::vector<double> &,
+                        const std::vector<QubitIdType> &, bool, const std::vector<QubitIdType> &,
+                        const std::vector<bool> &, const std::vector<std::string> &) override
+    {
+        gate_names.push_back(name);
+    }
+    void MatrixOperation(const std::vector<std::complex<double>> &_matrix,
+                         const std::vector<QubitIdType> &_wires, bool,
+                         const std::vector<QubitIdType> &, const std::vector<bool> &) override
+    {
+        matrix = _matrix;
+        wires = _wires;
+    }
+    auto Observable(ObsId, const std::vector<std::complex<double>> &_matrix,
+                    const std::vector<QubitIdType> &_wires) -> ObsIdType override
+    {
+        matrix = _matrix;
+        wires = _wires;
+        return 42;
+    }
+    void SetState(DataView<std::complex<double>, 1> &state,
+                  std::vector<QubitIdType> &_wires) override
+    {
+        matrix.assign(state.begin(), state.end());
+        wires = _wires;
+    }
+    void SetBasisState(DataView<int8_t, 1> &n, std::vector<QubitIdType> &_wires) override
+    {
+        basis_state.assign(n.begin(), n.end());
+        wires = _wires;
+    }
+
+    // Basis state `i` has weight `i`, with qubit `q` at position `q`
+    void Probs(DataView<double, 1> &probs) override
+    {
+        std::iota(probs.begin(), probs.end(), 0.0);
+    }
+    auto GetQubitPositions(const std::vector<QubitIdType> &_wires) -> std::vector<size_t> override
+    {
+        return {_wires.begin(), _wires.end()};
+    }
+};
+
+TEST_CASE("Test default view-based device methods", "[NullQubit]")
+{
+    RecordingDevice device;
+
+    SECTION("ApplyOperations")
+    {
+        const BatchedGate gates[] = {
+            {static_cast<int64_t>(GateId::Hadamard), 0, 0, 1},
+            {static_cast<int64_t>(GateId::CRX), 1, 1, 2},
+        };
+        const double params[] = {0.1};
+        const QubitIdType wires[] = {0, 0, 1};
+        device.ApplyOperations(gates, params, wires);
+
+        CHECK(device.gate_names == std::vector<std::string>{"Hadamard", "CRX"});
+    }
+
+    // The column-major buffer {1, 3, 2, 4} is the row-major matrix {{1, 2}, {3, 4}}
+    std::vector<std::complex<double>> buffer = {{1, 0}, {3, 0}, {2, 0}, {4, 0}};
+    const size_t sizes[] = {2, 2};
+    const size_t strides[] = {1, 2};
+    DataView<std::complex<double>, 2> view(buffer.data(), 0, sizes, strides);
+    const std::vector<std::complex<double>> expected = {{1, 0}, {2, 0}, {3, 0}, {4, 0}};
+    const QubitIdType wires[] = {1};
+
+    SECTION("MatrixOperationView")
+    {
+        device.MatrixOperationView(view, wires);
+        CHECK(device.matrix == expected);
+        CHECK(device.wires == std::vector<QubitIdType>{1});
+    }
+
+    SECTION("HermitianObservableView")
+    {
+        CHECK(device.HermitianObservableView(view, wires) == 42);
+        CHECK(device.matrix == expected);
+        CHECK(device.wires == std::vector<QubitIdType>{1});
+    }
+
+    std::vector<QubitIdType> state_wires = {2, 0, 1};
+
+    SECTION("SetSparseState")
+    {
+        const int64_t indices[] = {6, 1};
+        const std::complex<double> amplitudes[] = {{0.6, 0}, {0, 0.8}};
+        device.SetSparseState(indices, amplitudes, state_wires);
+
+        std::vector<std::complex<double>> state(8);
+        state[1] = {0, 0.8};
+        state[6] = {0.6, 0};
+        CHECK(device.matrix == state);
+        CHECK(device.wires == state_wires);
+    }
+
+    SECTION("SetBasisStateIndex")
+    {
+        // The first wire is the most significant bit
+        device.SetBasisStateIndex(0b110, state_wires);
+        CHECK(device.basis_state == std::vector<int8_t>{1, 1, 0});
+        CHECK(device.wires == state_wires);
+    }
+}
+
+TEST_CASE("Test default marginal probabilities", "[NullQubit]")
+{
+    RecordingDevice device;
+
+    // Consecutive and permuted qubits, on the calling thread and on several threads
+    for (size_t num_qubits : {3, 20}) {
+        for (const auto &wires : {std::vector<QubitIdType>{1, 2}, std::vector<QubitIdType>{2, 0}}) {
+            device.num_qubits = num_qubits;
+            std::vector<double> expected(4, 0);
+            for (size_t i = 0; i < (size_t{1} << num_qubits); i++) {
+                size_t marginal = 0;
+                for (QubitIdType wire : wires) {
+                    marginal = (marginal << 1) | ((i >> (num_qubits - 1 - wire)) & 1);
+                }
+                expected[marginal] += static_cast<double>(i);
+            }
+
+            std::vector<double> buffer(4);
+            DataView<double, 1> probs(buffer);
+            device.PartialProbs(probs, wires);
+            CHECK(buffer == expected);
+        }
+    }
+}
+
+TEST_CASE("Test default PackedSample packs chunked samples", "[NullQubit]")
+{
+    constexpr size_t shots = 1500;
+    constexpr size_t num_wires = 70;
+
+    RecordingDevice device;
+    device.SetDeviceShots(shots);
+    std::vector<QubitIdType> wires = device.AllocateQubits(num_wires);
+
+    std::vector<uint64_t> buffer(shots * 2, ~uint64_t{0});
+    const size_t sizes[2] = {shots, 2};
+    const size_t strides[2] = {2, 1};
+    DataView<uint64_t, 2> view(buffer.data(), 0, sizes, strides);
+    device.PackedSample(view, wires);
+
+    bool matches = true;
+    for (size_t i = 0; i < shots; i++) {
+        for (size_t j = 0; j < num_wires; j++) {
+            const bool bit = (view(i, j / 64) >> (j % 64)) & 1;
+            matches = matches && (bit == ((i + j) % 3 == 0));
+        }
+        // Padding bits of the last word are cleared
+        matches = matches && (view(i, 1) >> (num_wires - 64)) == 0;
+    }
+    CHECK(matches);
+    CHECK(device.sample_offset == shots);
+    CHECK(device.GetDeviceShots() == shots);
+}
+
+TEST_CASE("Test default PartialCounts accumulates chunked samples", "[NullQubit]")
+{
+    RecordingDevice device;
+    device.SetDeviceShots(3000);
+    std::vector<QubitIdType> wires = device.AllocateQubits(3);
+
+    std::vector<double> eigvals(8);
+    std::vector<int64_t> counts(8, -1);
+    DataView<double, 1> eigvals_view(eigvals);
+    DataView<int64_t, 1> counts_view(counts);
+    device.PartialCounts(eigvals_view, counts_view, wires);
+
+    // Shots cycle through the basis states 0b100, 0b001 and 0b010
+    CHECK(eigvals == std::vector<double>{0, 1, 2, 3, 4, 5, 6, 7});
+    CHECK(counts == std::vector<int64_t>{0, 1000, 1000, 0, 1000, 0, 0, 0});
+    CHECK(device.GetDeviceShots() == 3000);
+
+    std::vector<int64_t> short_counts(4);
+    DataView<int64_t, 1> short_view(short_counts);
+    REQUIRE_THROWS_WITH(device.PartialCounts(eigvals_view, short_view, wires),
+                        ContainsSubstring("Invalid size for the pre-allocated counts"));
+}
+
+TEST_CASE("Test __catalyst__qis__PackedSample", "[CoreQIS]")
+{
+    constexpr size_t shots = 4;
+    const auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+    __catalyst__rt__initialize(nullptr);
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), shots, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(65);
+    QUBIT **q0 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+
+    std::vector<int64_t> buffer(shots * 2, -1);
+    MemRefT_int64_2d result = {buffer.data(), buffer.data(), 0, {shots, 2}, {2, 1}};
+    __catalyst__qis__PackedSample(&result, 0);
+    CHECK(std::all_of(buffer.begin(), buffer.end(), [](int64_t word) { return word == 0; }));
+
+    MemRefT_int64_2d partial = {buffer.data(), buffer.data(), 0, {shots, 1}, {1, 1}};
+    REQUIRE_NOTHROW(__catalyst__qis__PackedSample(&partial, 1, *q0));
+    REQUIRE_THROWS_WITH(__catalyst__qis__PackedSample(&result, 1, *q0),
+                        ContainsSubstring("number of 64-bit words per shot"));
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test default SubmitSample returns the samples of the submitted circuit", "[NullQubit]")
+{
+    constexpr size_t shots = 6;
+
+    RecordingDevice device;
+    device.SetDeviceShots(shots);
+    std::vector<QubitIdType> wires = device.AllocateQubits(3);
+
+    std::future<std::vector<double>> job = device.SubmitSample({wires[1], wires[2]});
+    // The device may be reconfigured before the result is awaited
+    device.SetDeviceShots(1);
+
+    const std::vector<double> samples = job.get();
+    REQUIRE(samples.size() == shots * 2);
+    for (size_t i = 0; i < shots; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            CHECK(samples[i * 2 + j] == ((i + j) % 3 == 0 ? 1.0 : 0.0));
+        }
+    }
+}
+
+TEST_CASE("Test __catalyst__qis__SubmitSample and AwaitSample", "[CoreQIS]")
+{
+    constexpr size_t shots = 4;
+    const auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+    __catalyst__rt__initialize(nullptr);
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), shots, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+    QUBIT **q0 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+
+    // Several jobs can be pending at the same time
+    const int64_t all_job = __catalyst__qis__SubmitSample(0);
+    const int64_t partial_job = __catalyst__qis__SubmitSample(1, *q0);
+    CHECK(all_job != partial_job);
+
+    std::vector<double> buffer(shots * 2, -1.0);
+    MemRefT_double_2d partial = {buffer.data(), buffer.data(), 0, {shots, 1}, {1, 1}};
+    __catalyst__qis__AwaitSample(&partial, partial_job);
+    CHECK(std::all_of(buffer.begin(), buffer.begin() + shots, [](double s) { return s == 0.0; }));
+
+    MemRefT_double_2d result = {buffer.data(), buffer.data(), 0, {shots, 2}, {2, 1}};
+    __catalyst__qis__AwaitSample(&result, all_job);
+    CHECK(std::all_of(buffer.begin(), buffer.end(), [](double s) { return s == 0.0; }));
+
+    REQUIRE_THROWS_WITH(__catalyst__qis__AwaitSample(&result, all_job),
+                        ContainsSubstring("Invalid or already awaited job id"));
+    const int64_t mismatched_job = __catalyst__qis__SubmitSample(1, *q0);
+    REQUIRE_THROWS_WITH(__catalyst__qis__AwaitSample(&result, mismatched_job),
+                        ContainsSubstring("return tensor must have 2D shape"));
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE_METHOD(NullQubitRuntimeFixture, "Test __catalyst__qis__QubitUnitary and HermitianObs",
+                 "[NullQubit]")
+{
+    QirArray *reg = __catalyst__rt__qubit_allocate_array(1);
+    QUBIT *q = *reinterpret_cast<QUBIT **>(__catalyst__rt__array_get_element_ptr_1d(reg, 0));
+
+    CplxT_double data[] = {{0, 0}, {1, 0}, {1, 0}, {0, 0}};
+    MemRefT_CplxT_double_2d matrix = {data, data, 0, {2, 2}, {2, 1}};
+
+    __catalyst__qis__QubitUnitary(&matrix, NO_MODIFIERS, 1, q);
+    CHECK(__catalyst__qis__HermitianObs(&matrix, 1, q) == 0);
+
+    MemRefT_CplxT_double_2d invalid = {data, data, 0, {1, 4}, {4, 1}};
+    REQUIRE_THROWS_WITH(__catalyst__qis__QubitUnitary(&invalid, NO_MODIFIERS, 1, q),
+                        ContainsSubstring("Invalid given QubitUnitary matrix"));
+    REQUIRE_THROWS_WITH(__catalyst__qis__HermitianObs(&invalid, 1, q),
+                        ContainsSubstring("Invalid given Hermitian matrix"));
+
+    __catalyst__rt__qubit_release_array(reg);
+}
+
+TEST_CASE_METHOD(NullQubitRuntimeFixture, "Test __catalyst__qis__ApplyBatch", "[NullQubit]")
+{
+    QirArray *reg = __catalyst__rt__qubit_allocate_array(2);
+    QUBIT *wires[] = {
+        *reinterpret_cast<QUBIT **>(__catalyst__rt__array_get_element_ptr_1d(reg, 0)),
+        *reinterpret_cast<QUBIT **>(__catalyst__rt__array_get_element_ptr_1d(reg, 0)),
+        *reinterpret_cast<QUBIT **>(__catalyst__rt__array_get_element_ptr_1d(reg, 1)),
+    };
+
+    const BatchedGate gates[] = {
+        {static_cast<int64_t>(GateId::RX), 0, 1, 1},
+        {static_cast<int64_t>(GateId::CNOT), 0, 0, 2},
+    };
+    const double params[] = {0.5};
+
+    __catalyst__qis__ApplyBatch(2, gates, 1, params, 3, wires);
+    __catalyst__qis__ApplyBatch(0, nullptr, 0, nullptr, 0, nullptr);
+
+    REQUIRE_THROWS_WITH(__catalyst__qis__ApplyBatch(2, gates, 1, params, 2, wires),
+                        ContainsSubstring("operand counts do not match"));
+
+    const BatchedGate invalid[] = {{static_cast<int64_t>(GateId::NumGates), 0, 0, 0}};
+    REQUIRE_THROWS_WITH(__catalyst__qis__ApplyBatch(1, invalid, 0, nullptr, 0, nullptr),
+                        ContainsSubstring("Invalid gate opcode"));
+
+    __catalyst__rt__qubit_release_array(reg);
+}
+
+TEST_CASE_METHOD(NullQubitRuntimeFixture, "Test array variants of the variadic C-API",
+                 "[NullQubit]")
+{
+    constexpr int64_t n = 12;
+    QirArray *reg = __catalyst__rt__qubit_allocate_array(n);
+
+    std::vector<QUBIT *> Qs(n);
+    for (int64_t i = 0; i < n; i++) {
+        Qs[i] = *reinterpret_cast<QUBIT **>(__catalyst__rt__array_get_element_ptr_1d(reg, i));
+    }
+
+    __catalyst__qis__MultiRZ_array(0.5, NO_MODIFIERS, n, Qs.data());
+    __catalyst__qis__PCPhase_array(0.5, 2, NO_MODIFIERS, n, Qs.data());
+    __catalyst__qis__PauliRot_array("XYZ", 0.5, NO_MODIFIERS, true, 3, Qs.data());
+    REQUIRE_THROWS_WITH(
+        __catalyst__qis__PauliRot_array("XY", 0.5, NO_MODIFIERS, true, 3, Qs.data()),
+        ContainsSubstring("length of the pauli string"));
+
+    CplxT_double data[] = {{0, 0}, {1, 0}, {1, 0}, {0, 0}};
+    MemRefT_CplxT_double_2d matrix = {data, data, 0, {2, 2}, {2, 1}};
+    __catalyst__qis__QubitUnitary_array(&matrix, NO_MODIFIERS, 1, Qs.data());
+
+    std::vector<double> probs(4);
+    MemRefT_double_1d probs_result = {probs.data(), probs.data(), 0, {4}, {1}};
+    __catalyst__qis__Probs_array(&probs_result, 2, Qs.data());
+    CHECK(probs[0] == 1.0);
+
+    std::vector<std::complex<double>> state(1U << n);
+    MemRefT_CplxT_double_1d state_result = {reinterpret_cast<CplxT_double *>(state.data()),
+                                            reinterpret_cast<CplxT_double *>(state.data()),
+                                            0,
+                                            {state.size()},
+                                            {1}};
+    __catalyst__qis__State_array(&state_result, 0, nullptr);
+    CHECK(state[0] == std::complex<double>{1.0, 0.0});
+
+    __catalyst__rt__qubit_release_array(reg);
+}
+
 TEST_CASE("Test __catalyst__qis__Gradient_params Op=[Hadamard,RZ,RY,RZ,S,T,ParamShift], "
           "Obs=[X]",
           "[Gradient]")
@@ -719,6 +1639,37 @@ TEST_CASE("Test __catalyst__rt__print_state", "[NullQubit]")
     __catalyst__rt__finalize();
 }
 
+TEST_CASE("Test __catalyst__qis__StateView", "[NullQubit]")
+{
+    __catalyst__rt__initialize(nullptr);
+    auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), 0, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+
+    // The null device has no state-vector storage to lend
+    CHECK(NullQubit().GetStateView().empty());
+
+    std::vector<std::complex<double>> buffer(4);
+    MemRefT_CplxT_double_1d result = {reinterpret_cast<CplxT_double *>(buffer.data()),
+                                      reinterpret_cast<CplxT_double *>(buffer.data()),
+                                      0,
+                                      {buffer.size()},
+                                      {1}};
+    CHECK_FALSE(__catalyst__qis__StateView(&result));
+    CHECK(result.data_aligned == reinterpret_cast<CplxT_double *>(buffer.data()));
+
+    // Read the state with a copy instead
+    __catalyst__qis__State(&result, 0);
+    CHECK(buffer[0] == std::complex<double>{1.0, 0.0});
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
 TEST_CASE("Test NullQubit measurement processes with num_qubits=0", "[NullQubit]")
 {
     std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>();
@@ -925,6 +1876,127 @@ TEST_CASE("Test NullQubit device shots methods", "[NullQubit]")
     }
 }
 
+TEST_CASE("Test NullQubit synthetic measurements", "[NullQubit]")
+{
+    constexpr size_t shots = 4;
+    constexpr size_t num_qubits = 2;
+    std::vector<double> samples(shots * num_qubits);
+    const size_t sizes[2] = {shots, num_qubits};
+    const size_t strides[2] = {num_qubits, 1};
+    DataView<double, 2> samples_view(samples.data(), 0, sizes, strides);
+    std::vector<double> eigvals(4);
+    DataView<double, 1> eigvals_view(eigvals);
+    std::vector<int64_t> counts(4);
+    DataView<int64_t, 1> counts_view(counts);
+    std::vector<double> probs(4);
+    DataView<double, 1> probs_view(probs);
+
+    SECTION("Uniform")
+    {
+        auto sim = std::make_unique<NullQubit>("{'synthetic_measurements':'uniform'}");
+        sim->SetDeviceShots(shots);
+        auto Qs = sim->AllocateQubits(num_qubits);
+
+        // Each shot is the next basis state, with the first qubit as the most significant bit
+        sim->Sample(samples_view);
+        CHECK(samples == std::vector<double>{0, 0, 0, 1, 1, 0, 1, 1});
+        sim->Counts(eigvals_view, counts_view);
+        CHECK(eigvals == std::vector<double>{0, 1, 2, 3});
+        CHECK(counts == std::vector<int64_t>{1, 1, 1, 1});
+        sim->Probs(probs_view);
+        CHECK(probs == std::vector<double>{0.25, 0.25, 0.25, 0.25});
+
+        CHECK(*sim->Measure(Qs[0], std::nullopt) == false);
+        CHECK(*sim->Measure(Qs[0], std::nullopt) == true);
+    }
+
+    SECTION("Bitstrings")
+    {
+        auto sim = std::make_unique<NullQubit>(
+            "{'synthetic_measurements':'bitstrings', 'synthetic_bitstrings':'10;11;10'}");
+        sim->SetDeviceShots(shots);
+        auto Qs = sim->AllocateQubits(num_qubits);
+
+        sim->Sample(samples_view);
+        CHECK(samples == std::vector<double>{1, 0, 1, 1, 1, 0, 1, 0});
+        sim->Probs(probs_view);
+        CHECK_THAT(probs_view(2), WithinAbs(2.0 / 3, 1e-5));
+        CHECK_THAT(probs_view(3), WithinAbs(1.0 / 3, 1e-5));
+
+        std::vector<bool> outcomes;
+        for (size_t i = 0; i < 4; i++) {
+            outcomes.push_back(*sim->Measure(Qs[0], std::nullopt));
+        }
+        CHECK(outcomes == std::vector<bool>{true, false, true, true});
+    }
+
+    SECTION("Random")
+    {
+        const std::string kwargs = "{'synthetic_measurements':'random', 'synthetic_seed':'42'}";
+        std::vector<double> other_samples(samples.size());
+        DataView<double, 2> other_view(other_samples.data(), 0, sizes, strides);
+        for (auto *view : {&samples_view, &other_view}) {
+            auto sim = std::make_unique<NullQubit>(kwargs);
+            sim->SetDeviceShots(shots);
+            sim->AllocateQubits(num_qubits);
+            sim->Sample(*view);
+        }
+
+        // The same seed reproduces the same samples
+        CHECK(samples == other_samples);
+        CHECK(std::all_of(samples.begin(), samples.end(),
+                          [](double bit) { return bit == 0.0 || bit == 1.0; }));
+    }
+
+    REQUIRE_THROWS_WITH(std::make_unique<NullQubit>("{'synthetic_measurements':'gaussian'}"),
+                        ContainsSubstring("Invalid synthetic measurement distribution"));
+    REQUIRE_THROWS_WITH(std::make_unique<NullQubit>("{'synthetic_measurements':'bitstrings'}"),
+                        ContainsSubstring("bitstrings"));
+}
+
+TEST_CASE("Test NullQubit throughput mode", "[NullQubit]")
+{
+    std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>("{'throughput':True}");
+    CHECK(sim->IsThroughputMode() == true);
+    CHECK(sim->IsTrackingResources() == false);
+
+    // Qubits are numbered without a qubit manager, and releases are not validated
+    std::vector<QubitIdType> Qs(3);
+    sim->AllocateQubitsInPlace(Qs);
+    CHECK(Qs == std::vector<QubitIdType>{0, 1, 2});
+    CHECK(sim->AllocateQubit() == 3);
+    sim->ReleaseQubit(42);
+    CHECK(sim->GetNumQubits() == 3);
+
+    // Recorded operations keep the qubit ids as device ids
+    sim->StartTapeRecording();
+    const double params[] = {0.5};
+    const QubitIdType wires[] = {Qs[2]};
+    sim->GateOperation(GateId::RX, params, wires);
+    sim->StopTapeRecording();
+    auto &&[num_ops, num_obs, num_params, op_names, obs_keys] = sim->CacheManagerInfo();
+    CHECK(num_ops == 1);
+    CHECK(op_names == std::vector<std::string>{"RX"});
+
+    std::vector<Result> results(2, nullptr);
+    const std::vector<std::optional<int32_t>> postselects(2);
+    sim->MeasureBatch(std::span<const QubitIdType>(Qs).first(2), postselects, results);
+    CHECK((*results[0] == false && *results[1] == false));
+
+    sim->SetDeviceShots(10);
+    size_t num_shots = 0;
+    sim->SampleChunked({}, 4, [&](DataView<double, 2> &chunk, size_t chunk_shots) {
+        CHECK(chunk.size() == chunk_shots * sim->GetNumQubits());
+        CHECK(std::all_of(chunk.begin(), chunk.end(), [](double bit) { return bit == 0.0; }));
+        num_shots += chunk_shots;
+    });
+    CHECK(num_shots == 10);
+
+    REQUIRE_THROWS_WITH(
+        std::make_unique<NullQubit>("{'throughput':True, 'track_resources':True}"),
+        ContainsSubstring("Resource tracking is not supported in the throughput mode"));
+}
+
 TEST_CASE("Test NullQubit device resource tracking integration", "[NullQubit]")
 {
     // The name of the file where the resource usage data is stored
@@ -1121,3 +2193,179 @@ TEST_CASE("Test NullQubit device resource tracking integration", "[NullQubit]")
 
     std::remove(RESOURCES_FILENAME.c_str()); // Remove the file automatically created by the device
 }
+
+TEST_CASE("Test NullQubit device cost estimation", "[NullQubit]")
+{
+    // The name of the file where the resource usage data is stored
+    const std::string RESOURCES_FILENAME = "__pennylane_resources_cost_data.json";
+
+    std::unique_ptr<NullQubit> sim = std::make_unique<NullQubit>(
+        "{'track_resources':True, 'resources_filename':'" + RESOURCES_FILENAME +
+        "', 'gate_durations':'Hadamard=20;CNOT=200', 'default_gate_duration':10}");
+    sim->SetDeviceShots(10);
+
+    const ResourceTracker &tracker = sim->GetResourceTracker();
+    CHECK(tracker.GetEstimateCost() == true);
+
+    std::vector<QubitIdType> Qs = sim->AllocateQubits(2);
+    sim->NamedOperation("Hadamard", {}, {Qs[0]}, false);
+    sim->NamedOperation("CNOT", {}, {Qs[0], Qs[1]}, false);
+    sim->NamedOperation("RZ", {0.1}, {Qs[1]}, false);
+
+    CHECK(tracker.GetEstimatedDuration() == 230);
+    CHECK(tracker.GetEstimatedTotalDuration() == 2300);
+    CHECK(tracker.GetStateVectorBytes() == 64);
+
+    sim->ReleaseQubits(Qs);
+    sim.reset(); // Destroy the device to trigger writing the resource data
+
+    std::ifstream resource_file_r(RESOURCES_FILENAME);
+    REQUIRE(resource_file_r.is_open());
+    std::stringstream full_json;
+    full_json << resource_file_r.rdbuf();
+    resource_file_r.close();
+    std::remove(RESOURCES_FILENAME.c_str());
+
+    CHECK(full_json.str().find("\"shots\": 10") != std::string::npos);
+    CHECK(full_json.str().find("\"estimated_duration\": 230") != std::string::npos);
+    CHECK(full_json.str().find("\"estimated_total_duration\": 2300") != std::string::npos);
+    CHECK(full_json.str().find("\"state_vector_bytes\": 64") != std::string::npos);
+}
+
+TEST_CASE("Test the runtime trace of the C-API and device calls", "[CoreQIS]")
+{
+    const std::string trace_filename = "__runtime_trace.json";
+    setenv("CATALYST_RUNTIME_TRACE", trace_filename.c_str(), 1);
+    __catalyst__rt__initialize(nullptr);
+    unsetenv("CATALYST_RUNTIME_TRACE");
+
+    const auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), 10,
+                                /*auto_qubit_management=*/false);
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+    QUBIT **target = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    __catalyst__qis__Hadamard(*target, NO_MODIFIERS);
+
+    std::vector<double> buffer(10 * 2);
+    MemRefT_double_2d result = {buffer.data(), buffer.data(), 0, {10, 2}, {2, 1}};
+    __catalyst__qis__Sample(&result, 0);
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize(); // Write the trace
+
+    std::ifstream trace_file(trace_filename);
+    REQUIRE(trace_file.is_open());
+    std::stringstream trace;
+    trace << trace_file.rdbuf();
+    trace_file.close();
+    std::remove(trace_filename.c_str());
+
+    CHECK(trace.str().find("\"traceEvents\"") != std::string::npos);
+    CHECK(trace.str().find("\"name\": \"device_init\", \"cat\": \"capi\"") != std::string::npos);
+    CHECK(trace.str().find("\"name\": \"GateOperation\", \"cat\": \"device\"") !=
+          std::string::npos);
+    CHECK(trace.str().find("\"detail\": \"Hadamard\"") != std::string::npos);
+    CHECK(trace.str().find("\"name\": \"Sample\", \"cat\": \"capi\"") != std::string::npos);
+    CHECK(trace.str().find("\"name\": \"Sample\", \"cat\": \"device\"") != std::string::npos);
+    CHECK(trace.str().find("\"dropped_events\": 0") != std::string::npos);
+}
+
+TEST_CASE("Test the performance counters of compiled functions", "[CoreQIS]")
+{
+    const std::string counters_filename = "__perf_counters.json";
+    static const char entry_point[] = "jit_circuit";
+    static const char qnode[] = "circuit";
+
+    __catalyst__rt__perf_counters_begin(entry_point);
+    for (size_t i = 0; i < 2; i++) {
+        __catalyst__rt__perf_counters_begin(qnode);
+        __catalyst__rt__initialize(nullptr);
+        const auto [rtd_lib, rtd_name, rtd_kwargs] =
+            std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+        __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                    (int8_t *)rtd_kwargs.c_str(), 0,
+                                    /*auto_qubit_management=*/false);
+        __catalyst__rt__device_release();
+        __catalyst__rt__finalize();
+        __catalyst__rt__perf_counters_end(qnode);
+    }
+    __catalyst__rt__perf_counters_end(entry_point);
+    __catalyst__rt__perf_counters_write(counters_filename.c_str());
+
+    std::ifstream counters_file(counters_filename);
+    REQUIRE(counters_file.is_open());
+    std::stringstream counters;
+    counters << counters_file.rdbuf();
+    counters_file.close();
+    std::remove(counters_filename.c_str());
+
+    CHECK(counters.str().find("\"traceEvents\"") != std::string::npos);
+    CHECK(counters.str().find("\"name\": \"circuit\", \"cat\": \"kernel\"") != std::string::npos);
+    CHECK(counters.str().find("\"name\": \"jit_circuit\", \"cat\": \"kernel\"") !=
+          std::string::npos);
+    CHECK(counters.str().find("\"args\": {\"calls\": 2, \"cycles\"") != std::string::npos);
+    CHECK(counters.str().find("\"args\": {\"calls\": 1, \"cycles\"") != std::string::npos);
+    CHECK(counters.str().find("\"perf_counters\": ") != std::string::npos);
+}
+
+TEST_CASE("Test a batch of executions in one device session", "[CoreQIS]")
+{
+    __catalyst__rt__initialize(nullptr);
+    const auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), 0, /*auto_qubit_management=*/false);
+
+    constexpr int64_t batch_size = 3;
+    __catalyst__rt__device_start_batch(batch_size);
+    for (int64_t i = 0; i < batch_size; i++) {
+        QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+        QUBIT **target = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+        __catalyst__qis__RX(0.1 * static_cast<double>(i), *target, NO_MODIFIERS);
+        CHECK(__catalyst__qis__Expval(__catalyst__qis__NamedObs(ObsId::PauliZ, *target)) == 0.0);
+        __catalyst__rt__qubit_release_array(qs);
+    }
+    __catalyst__rt__device_end_batch();
+
+    __catalyst__rt__device_release();
+    REQUIRE_THROWS_WITH(__catalyst__rt__device_start_batch(batch_size),
+                        ContainsSubstring("Cannot start a batch without an active device"));
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test a device initialized while another one is active", "[CoreQIS]")
+{
+    __catalyst__rt__initialize(nullptr);
+    const auto [rtd_lib, rtd_name, rtd_kwargs] =
+        std::array<std::string, 3>{"null.qubit", "null_qubit", ""};
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), 0, /*auto_qubit_management=*/false);
+    QirArray *outer = __catalyst__rt__qubit_allocate_array(3);
+    CHECK(__catalyst__rt__num_qubits() == 3);
+
+    // The nested device suspends the outer device until it is released
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), (int8_t *)rtd_name.c_str(),
+                                (int8_t *)rtd_kwargs.c_str(), 0, /*auto_qubit_management=*/true);
+    CHECK(__catalyst__rt__num_qubits() == 0);
+    QirArray *inner = __catalyst__rt__qubit_allocate_array(1);
+    CHECK(__catalyst__rt__num_qubits() == 1);
+
+    // The outer device was not released, so it cannot be initialized again
+    REQUIRE_THROWS_WITH(__catalyst__rt__device_init((int8_t *)rtd_lib.c_str(),
+                                                    (int8_t *)rtd_name.c_str(),
+                                                    (int8_t *)rtd_kwargs.c_str(), 0,
+                                                    /*auto_qubit_management=*/false),
+                        ContainsSubstring("Cannot re-initialize an ACTIVE device"));
+    CHECK(__catalyst__rt__num_qubits() == 1);
+
+    __catalyst__rt__qubit_release_array(inner);
+    __catalyst__rt__device_release();
+
+    CHECK(__catalyst__rt__num_qubits() == 3);
+    __catalyst__rt__qubit_release_array(outer);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
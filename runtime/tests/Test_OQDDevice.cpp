@@ -14,6 +14,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <thread>
 
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_string.hpp"
@@ -21,10 +22,12 @@
 
 #include "OQDDevice.hpp"
 #include "OQDRuntimeCAPI.h"
+#include "OQDSpecCache.hpp"
 #include "RuntimeCAPI.h"
 
 using namespace Catch::Matchers;
 using namespace Catalyst::Runtime::Device;
+using namespace Catalyst::Runtime::OQD;
 
 using json = nlohmann::json;
 
@@ -958,3 +961,99 @@ TEST_CASE("Test OpenAPL Program generation", "[oqd]")
 
     std::filesystem::remove("__openapl__output.json");
 }
+
+TEST_CASE("Test the OQDDevice releases pulses once written", "[oqd]")
+{
+    auto device = OQDDevice(R"({shots : 100}ION:{"transitions":[{"label":"l0->l1"}]})");
+    std::vector<QubitIdType> wires = device.AllocateQubits(1);
+    QUBIT *qubit = reinterpret_cast<QUBIT *>(wires[0]);
+
+    Beam beam = {0, 1.5, -2.0, {1, 0, 0}, {0, 1, 0}};
+    Pulse *first = __catalyst__oqd__measure_pulse(qubit, 1.0, 0.0, &beam);
+    __catalyst__oqd__ParallelProtocol(&first, 1);
+
+    // The storage of the written pulse is reused, and no longer marked as a measurement
+    Pulse *second = __catalyst__oqd__pulse(qubit, 2.0, 0.5, &beam);
+    CHECK(second == first);
+    CHECK(second->duration == 2.0);
+    __catalyst__oqd__ParallelProtocol(&second, 1);
+
+    device.ReleaseQubits(wires);
+
+    json observed = json::parse(std::ifstream("__openapl__output.json"));
+    const auto &sequence = observed["protocol"]["sequence"];
+    REQUIRE(sequence.size() == 2);
+    CHECK(sequence[0]["sequence"][0]["class_"] == "MeasurePulse");
+    CHECK(sequence[1]["sequence"][0]["class_"] == "Pulse");
+    CHECK(sequence[1]["sequence"][0]["duration"] == 2.0);
+
+    std::filesystem::remove("__openapl__output.json");
+}
+
+TEST_CASE("Test OpenAPL Program generation from concurrent devices", "[oqd]")
+{
+    const std::string ion = R"({"transitions":[{"label":"l0->l1"}]})";
+    constexpr size_t num_devices = 4;
+    constexpr size_t num_protocols = 100;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_devices; t++) {
+        threads.emplace_back([&ion, t]() {
+            auto file_name = "__openapl__output" + std::to_string(t) + ".json";
+            auto device = OQDDevice("{shots : 100, openapl_file_name : " + file_name + "}ION:" +
+                                    ion);
+            std::vector<QubitIdType> wires = device.AllocateQubits(1);
+            QUBIT *qubit = reinterpret_cast<QUBIT *>(wires[0]);
+
+            Beam beam = {0, 1.5, -2.0, {1, 0, 0}, {0, 1, 0}};
+            const double phase = static_cast<double>(t);
+            for (size_t i = 0; i < num_protocols; i++) {
+                Pulse *pulses[] = {__catalyst__oqd__pulse(qubit, 1.0, phase, &beam),
+                                   __catalyst__oqd__measure_pulse(qubit, 0.5, 0.0, &beam)};
+                __catalyst__oqd__ParallelProtocol(pulses, 2);
+            }
+            device.ReleaseQubits(wires);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < num_devices; t++) {
+        auto file_name = "__openapl__output" + std::to_string(t) + ".json";
+        json observed = json::parse(std::ifstream(file_name));
+
+        CHECK(observed["system"]["ions"].size() == 1);
+        const auto &sequence = observed["protocol"]["sequence"];
+        REQUIRE(sequence.size() == num_protocols);
+        for (const auto &protocol : sequence) {
+            CHECK(protocol["class_"] == "ParallelProtocol");
+            CHECK(protocol["sequence"][0]["class_"] == "Pulse");
+            CHECK(protocol["sequence"][0]["beam"]["phase"]["value"] == static_cast<double>(t));
+            CHECK(protocol["sequence"][1]["class_"] == "MeasurePulse");
+            CHECK(protocol["sequence"][1]["beam"]["transition"]["label"] == "l0->l1");
+        }
+        std::filesystem::remove(file_name);
+    }
+
+    REQUIRE_THROWS_WITH(__catalyst__oqd__ParallelProtocol(nullptr, 0),
+                        ContainsSubstring("No active OpenAPL program"));
+}
+
+TEST_CASE("Test the OQD specifications are parsed once per content", "[oqd]")
+{
+    OQDSpecCache cache;
+    const std::string ion = R"({"name": "Yb171", "transitions": [{"label": "l0->l1"}]})";
+
+    auto spec = cache.get(ion);
+    CHECK(spec->serialised == R"({"name":"Yb171","transitions":[{"label":"l0->l1"}]})");
+    REQUIRE(spec->transitions.size() == 1);
+    CHECK(spec->transitions[0] == R"({"label":"l0->l1"})");
+
+    CHECK(cache.get(std::string(ion)) == spec);
+    CHECK(cache.get(R"({"class_": "Phonon"})") != spec);
+    CHECK(cache.size() == 2);
+
+    REQUIRE_THROWS(cache.get("{"));
+    CHECK(cache.size() == 2);
+}
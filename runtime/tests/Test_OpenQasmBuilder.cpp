@@ -390,8 +390,8 @@ TEMPLATE_TEST_CASE("Test OpenQasmBuilder with dumping the circuit header", "[ope
     builder.Register(RegisterType::Qubit, "qubits2", 3);
 
     REQUIRE_THROWS_WITH(builder.toOpenQasm(),
-                        ContainsSubstring("[Function:toOpenQasm] Error in Catalyst Runtime: Invalid"
-                                          " number of quantum registers"));
+                        ContainsSubstring("[Function:toOpenQasmTemplate] Error in Catalyst "
+                                          "Runtime: Invalid number of quantum registers"));
 }
 
 TEMPLATE_TEST_CASE("Test OpenQasmBuilder with invalid number of measurement results registers",
@@ -411,8 +411,9 @@ TEMPLATE_TEST_CASE("Test OpenQasmBuilder with invalid number of measurement resu
 
     // Check edge cases
     REQUIRE_THROWS_WITH(builder.toOpenQasm(),
-                        ContainsSubstring("[Function:toOpenQasm] Error in Catalyst Runtime: Invalid"
-                                          " number of measurement results registers"));
+                        ContainsSubstring("[Function:toOpenQasmTemplate] Error in Catalyst "
+                                          "Runtime: Invalid number of measurement results "
+                                          "registers"));
 
     REQUIRE_THROWS_WITH(
         builder.Register(static_cast<RegisterType>(3), "qubits", 5),
@@ -546,3 +547,56 @@ TEMPLATE_TEST_CASE("Test OpenQasmBuilder with custom instructions", "[openqasm]"
               toqasm + state_pragma_str);
     }
 }
+
+TEST_CASE("Test QasmProgramTemplate", "[openqasm]")
+{
+    QasmProgramTemplate program(4);
+    program.append("rx(");
+    program.appendParam();
+    program.append(", ");
+    program.appendParam();
+    program.append(") q[0];\n");
+
+    CHECK(program.getNumParams() == 2);
+    CHECK(program.getText() == "rx(, ) q[0];\n");
+    CHECK(program.bind({0.123456, 2}) == "rx(0.1235, 2) q[0];\n");
+    CHECK(program.bind({-1e-7, 1234567}) == "rx(-1e-07, 1.235e+06) q[0];\n");
+
+    REQUIRE_THROWS_WITH(program.bind({0.1}),
+                        ContainsSubstring("Invalid number of parameters for the program template"));
+}
+
+TEMPLATE_TEST_CASE("Test OpenQasmBuilder with re-binding the circuit parameters", "[openqasm]",
+                   OpenQasmBuilder, BraketBuilder)
+{
+    auto build = [](double theta, double phi, size_t wire) {
+        auto builder = TestType();
+        builder.Register(RegisterType::Qubit, "q", 2);
+        builder.Gate("RX", {theta}, {}, {wire}, false);
+        builder.Gate("CNOT", {}, {}, {0, 1}, false);
+        builder.Gate("PhaseShift", {phi}, {}, {1}, false);
+        return builder;
+    };
+
+    auto builder = build(0.1, 0.2, 0);
+    auto program = builder.toOpenQasmTemplate();
+    CHECK(program.getNumParams() == 2);
+    CHECK(builder.getParams() == std::vector<double>{0.1, 0.2});
+    CHECK(program.bind(builder.getParams()) == builder.toOpenQasm());
+
+    // Circuits that only differ in their parameter values share the same template
+    auto other = build(1.5, -3.14159265, 0);
+    CHECK(other.getStructureHash() == builder.getStructureHash());
+    REQUIRE(other.hasSameStructure(builder));
+    CHECK(program.bind(other.getParams()) == other.toOpenQasm());
+
+    CHECK(build(0.1, 0.2, 1).getStructureHash() != builder.getStructureHash());
+    CHECK_FALSE(build(0.1, 0.2, 1).hasSameStructure(builder));
+
+    auto copy = builder.clone();
+    CHECK(copy->hasSameStructure(builder));
+    CHECK(copy->toOpenQasm() == builder.toOpenQasm());
+    copy->Gate("PauliX", {}, {}, {0}, false);
+    CHECK(copy->getStructureHash() != builder.getStructureHash());
+    CHECK_FALSE(copy->hasSameStructure(builder));
+}
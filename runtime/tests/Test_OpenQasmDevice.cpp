@@ -54,6 +54,10 @@ TEST_CASE("Test OpenQasmRunner base class", "[openqasm]")
                         ContainsSubstring("[Function:Sample] Error in Catalyst Runtime: "
                                           "Not implemented method"));
 
+    REQUIRE_THROWS_WITH(runner.SampleBatch({}, "", 0, 0),
+                        ContainsSubstring("[Function:SampleBatch] Error in Catalyst Runtime: "
+                                          "Not implemented method"));
+
     REQUIRE_THROWS_WITH(runner.Expval("", "", 0),
                         ContainsSubstring("[Function:Expval] Error in Catalyst Runtime: "
                                           "Not implemented method"));
@@ -62,6 +66,10 @@ TEST_CASE("Test OpenQasmRunner base class", "[openqasm]")
                         ContainsSubstring("[Function:Var] Error in Catalyst Runtime: "
                                           "Not implemented method"));
 
+    REQUIRE_THROWS_WITH(runner.Results("", "", 0),
+                        ContainsSubstring("[Function:Results] Error in Catalyst Runtime: "
+                                          "Not implemented method"));
+
     REQUIRE_THROWS_WITH(runner.State("", "", 0, 0),
                         ContainsSubstring("[Function:State] Error in Catalyst Runtime: "
                                           "Not implemented method"));
@@ -113,6 +121,15 @@ TEST_CASE("Test BraketRunner", "[openqasm]")
                 (sample == 0 || sample == 1)); // Each sample should be 0 or 1 for a 2-qubit state
         }
     }
+
+    SECTION("Test BraketRunner::SampleBatch()")
+    {
+        auto &&samples = runner.SampleBatch({circuit, circuit, circuit}, "default", 100, 2);
+        CHECK(samples.size() == 600); // Expecting 3 * 100 * 2 = 600 samples
+        for (const auto &sample : samples) {
+            REQUIRE((sample == 0 || sample == 1));
+        }
+    }
 }
 
 TEST_CASE("Test BraketRunner Expval and Var", "[openqasm]")
@@ -158,6 +175,22 @@ TEST_CASE("Test BraketRunner Expval and Var", "[openqasm]")
         CHECK((var >= 0.0 && var <= 1.0));
     }
 
+    SECTION("Test BraketRunner::Results()")
+    {
+        // Compute the expectation value and the probabilities in a single task
+        auto &&circuit_results =
+            builder.toOpenQasmWithCustomInstructions("#pragma braket result expectation y(q[0])\n"
+                                                     "#pragma braket result probability q[0:1]\n");
+
+        auto &&results = runner.Results(circuit_results, "default", 0);
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].size() == 1);
+        CHECK_THAT(results[0][0], WithinAbs(-0.4794255386, 1e-5));
+        CHECK(results[1].size() == 4);
+        CHECK_THAT(results[1][0] + results[1][1] + results[1][2] + results[1][3],
+                   WithinAbs(1.0, 1e-5));
+    }
+
     SECTION("Test BraketRunner::Var() with no measurement process")
     {
         // Cannot compute variance if no measurement process is defined
@@ -168,6 +201,199 @@ TEST_CASE("Test BraketRunner Expval and Var", "[openqasm]")
     }
 }
 
+TEST_CASE("Test NativeRunner", "[openqasm]")
+{
+    OpenQasm::BraketBuilder builder{};
+
+    builder.Register(OpenQasm::RegisterType::Qubit, "q", 2);
+
+    builder.Gate("RX", {0.5}, {}, {0}, false);
+    builder.Gate("Hadamard", {}, {}, {1}, false);
+    builder.Gate("CNOT", {}, {}, {0, 1}, false);
+
+    OpenQasm::NativeRunner runner{};
+
+    SECTION("Test NativeRunner::Probs()")
+    {
+        auto &&probs = runner.Probs(builder.toOpenQasm(), "default", 0, 2);
+        REQUIRE(probs.size() == 4);
+        const double p0 = std::cos(0.25) * std::cos(0.25) / 2;
+        CHECK_THAT(probs[0], WithinAbs(p0, 1e-5));
+        CHECK_THAT(probs[1], WithinAbs(p0, 1e-5));
+        CHECK_THAT(probs[2], WithinAbs(0.5 - p0, 1e-5));
+        CHECK_THAT(probs[3], WithinAbs(0.5 - p0, 1e-5));
+
+        auto &&sampled_probs = runner.Probs(builder.toOpenQasm(), "default", 100, 2);
+        CHECK_THAT(sampled_probs[0] + sampled_probs[1] + sampled_probs[2] + sampled_probs[3],
+                   WithinAbs(1.0, 1e-5));
+    }
+
+    SECTION("Test NativeRunner::Sample() and NativeRunner::SampleBatch()")
+    {
+        auto &&samples = runner.Sample(builder.toOpenQasm(), "default", 100, 2);
+        CHECK(samples.size() == 200);
+        for (const auto &sample : samples) {
+            REQUIRE((sample == 0 || sample == 1));
+        }
+
+        auto &&batch = runner.SampleBatch({builder.toOpenQasm(), builder.toOpenQasm()},
+                                          "braket_sv", 100, 2);
+        CHECK(batch.size() == 400);
+    }
+
+    SECTION("Test NativeRunner::Expval(), NativeRunner::Var() and NativeRunner::Results()")
+    {
+        auto &&expval = runner.Expval(
+            builder.toOpenQasmWithCustomInstructions("#pragma braket result expectation y(q[0])"),
+            "default", 0);
+        CHECK_THAT(expval, WithinAbs(-0.4794255386, 1e-5));
+
+        auto &&var = runner.Var(
+            builder.toOpenQasmWithCustomInstructions("#pragma braket result variance y(q[0])"),
+            "default", 0);
+        CHECK_THAT(var, WithinAbs(1.0 - 0.4794255386 * 0.4794255386, 1e-5));
+
+        auto &&results = runner.Results(
+            builder.toOpenQasmWithCustomInstructions(
+                "#pragma braket result expectation z(q[0]) @ hermitian([[0, 1+0im], [1+0im, 0]]) "
+                "q[1]\n"
+                "#pragma braket result probability q[0:1]\n"),
+            "default", 0);
+        REQUIRE(results.size() == 2);
+        CHECK_THAT(results[0][0], WithinAbs(std::cos(0.5), 1e-5));
+        CHECK(results[1].size() == 4);
+        CHECK_THAT(results[1][0] + results[1][1] + results[1][2] + results[1][3],
+                   WithinAbs(1.0, 1e-5));
+
+        REQUIRE_THROWS_WITH(runner.Expval(builder.toOpenQasmWithCustomInstructions(""), "default",
+                                          0),
+                            ContainsSubstring("Unable to compute expectation value"));
+    }
+
+    SECTION("Test NativeRunner::State() with a unitary matrix")
+    {
+        builder.Gate({0, 1, 1, 0}, {1}, false);
+        auto &&state = runner.State(builder.toOpenQasmWithCustomInstructions(
+                                        "#pragma braket result state_vector"),
+                                    "default", 0, 2);
+        REQUIRE(state.size() == 4);
+        CHECK_THAT(std::abs(state[0]), WithinAbs(std::cos(0.25) / std::sqrt(2), 1e-5));
+        CHECK_THAT(std::abs(state[1]), WithinAbs(std::cos(0.25) / std::sqrt(2), 1e-5));
+        CHECK_THAT(std::abs(state[2]), WithinAbs(std::sin(0.25) / std::sqrt(2), 1e-5));
+        CHECK_THAT(std::abs(state[3]), WithinAbs(std::sin(0.25) / std::sqrt(2), 1e-5));
+    }
+
+    SECTION("Test NativeRunner with unsupported programs")
+    {
+        REQUIRE_THROWS_WITH(runner.Probs(builder.toOpenQasm(), "braket_dm", 0, 2),
+                            ContainsSubstring("Only the state vector simulator is supported"));
+        REQUIRE_THROWS_WITH(
+            runner.Probs("OPENQASM 3.0;\nqubit[1] q;\nfoo q[0];\n", "default", 0, 1),
+            ContainsSubstring("Unsupported gate for the native OpenQasm runner"));
+        REQUIRE_THROWS_WITH(
+            runner.Probs("OPENQASM 3.0;\nqubit[1] q;\nx r[0];\n", "default", 0, 1),
+            ContainsSubstring("Unknown qubit register"));
+    }
+}
+
+TEST_CASE("Test measurement processes with the native OpenQasm runner", "[openqasm]")
+{
+    constexpr size_t shots{1000};
+    std::unique_ptr<OpenQasmDevice> device = std::make_unique<OpenQasmDevice>(
+        "{device_type : braket.local.qubit, backend : default, runner : native}");
+    device->SetDeviceShots(shots);
+
+    constexpr size_t n{2};
+    constexpr size_t size{1UL << n};
+    auto wires = device->AllocateQubits(n);
+
+    device->NamedOperation("Hadamard", {}, {wires[0]}, false);
+    device->NamedOperation("CNOT", {}, {wires[0], wires[1]}, false);
+
+    SECTION("Samples")
+    {
+        std::vector<double> samples(shots * n);
+        MemRefT<double, 2> buffer{samples.data(), samples.data(), 0, {shots, n}, {n, 1}};
+        DataView<double, 2> view(buffer.data_aligned, buffer.offset, buffer.sizes, buffer.strides);
+        device->Sample(view);
+
+        for (size_t i = 0; i < shots; i++) {
+            CHECK((samples[2 * i] == 0.0 || samples[2 * i] == 1.0));
+            CHECK(samples[2 * i] == samples[2 * i + 1]);
+        }
+    }
+
+    SECTION("SubmitSample")
+    {
+        // The first circuit runs in the background while the next ones are built and queued
+        auto bell_job = device->SubmitSample({});
+        device->NamedOperation("PauliX", {}, {wires[1]}, false);
+        auto flipped_job = device->SubmitSample({});
+        auto partial_job = device->SubmitSample(std::vector<QubitIdType>{wires[1]});
+
+        auto &&bell_samples = bell_job.get();
+        auto &&flipped_samples = flipped_job.get();
+        auto &&partial_samples = partial_job.get();
+        REQUIRE(bell_samples.size() == shots * n);
+        REQUIRE(flipped_samples.size() == shots * n);
+        REQUIRE(partial_samples.size() == shots);
+        for (size_t i = 0; i < shots; i++) {
+            CHECK(bell_samples[2 * i] == bell_samples[2 * i + 1]);
+            CHECK(flipped_samples[2 * i] != flipped_samples[2 * i + 1]);
+            CHECK((partial_samples[i] == 0.0 || partial_samples[i] == 1.0));
+        }
+    }
+
+    SECTION("Counts")
+    {
+        std::vector<double> eigvals(size);
+        std::vector<int64_t> counts(size);
+        DataView<double, 1> eview(eigvals);
+        DataView<int64_t, 1> cview(counts);
+        device->Counts(eview, cview);
+
+        CHECK(counts[1] == 0);
+        CHECK(counts[2] == 0);
+        CHECK(counts[0] + counts[3] == static_cast<int64_t>(shots));
+    }
+
+    SECTION("Probs and PartialProbs")
+    {
+        device->SetDeviceShots(0); // to get deterministic results
+        std::vector<double> probs(size);
+        DataView<double, 1> view(probs);
+        device->Probs(view);
+        CHECK_THAT(probs[0], WithinAbs(0.5, 1e-5));
+        CHECK_THAT(probs[3], WithinAbs(0.5, 1e-5));
+
+        std::vector<double> partial_probs(2);
+        DataView<double, 1> partial_view(partial_probs);
+        device->PartialProbs(partial_view, std::vector<QubitIdType>{1});
+        CHECK_THAT(partial_probs[0], WithinAbs(0.5, 1e-5));
+        CHECK_THAT(partial_probs[1], WithinAbs(0.5, 1e-5));
+    }
+
+    SECTION("Expval and Var(x(0) @ h(1))")
+    {
+        device->SetDeviceShots(0); // to get deterministic results
+        auto obs_x = device->Observable(ObsId::PauliX, {}, std::vector<QubitIdType>{0});
+        auto obs_h = device->Observable(ObsId::Hadamard, {}, std::vector<QubitIdType>{1});
+        auto obs = device->TensorObservable({obs_x, obs_h});
+        CHECK_THAT(device->Expval(obs), WithinAbs(0.7071067812, 1e-5));
+        CHECK_THAT(device->Var(obs), WithinAbs(0.5, 1e-5));
+    }
+
+    SECTION("State")
+    {
+        device->SetDeviceShots(0);
+        std::vector<std::complex<double>> state(size);
+        DataView<std::complex<double>, 1> view(state);
+        device->State(view);
+        CHECK_THAT(state[0].real(), WithinAbs(1 / std::sqrt(2), 1e-5));
+        CHECK_THAT(state[3].real(), WithinAbs(1 / std::sqrt(2), 1e-5));
+    }
+}
+
 TEST_CASE("Test the OpenQasmDevice constructor", "[openqasm]")
 {
     SECTION("Common")
@@ -176,8 +402,8 @@ TEST_CASE("Test the OpenQasmDevice constructor", "[openqasm]")
         CHECK(device.GetNumQubits() == 0);
 
         REQUIRE_THROWS_WITH(device.Circuit(),
-                            ContainsSubstring("[Function:toOpenQasm] Error in Catalyst Runtime: "
-                                              "Invalid number of quantum register"));
+                            ContainsSubstring("[Function:toOpenQasmTemplate] Error in Catalyst "
+                                              "Runtime: Invalid number of quantum register"));
     }
 
     SECTION("Braket SV1")
@@ -186,11 +412,55 @@ TEST_CASE("Test the OpenQasmDevice constructor", "[openqasm]")
         CHECK(device.GetNumQubits() == 0);
 
         REQUIRE_THROWS_WITH(device.Circuit(),
-                            ContainsSubstring("[Function:toOpenQasm] Error in Catalyst Runtime: "
-                                              "Invalid number of quantum register"));
+                            ContainsSubstring("[Function:toOpenQasmTemplate] Error in Catalyst "
+                                              "Runtime: Invalid number of quantum register"));
+    }
+
+    SECTION("Native runner")
+    {
+        REQUIRE_THROWS_WITH(OpenQasmDevice("{runner : native}"),
+                            ContainsSubstring("The native OpenQasm runner only supports"));
     }
 }
 
+TEST_CASE("Test OpenQasmObsManager interning observables", "[openqasm]")
+{
+    OpenQasm::OpenQasmObsManager obs_manager{};
+
+    auto x0 = obs_manager.createNamedObs(ObsId::PauliX, {0});
+    auto z1 = obs_manager.createNamedObs(ObsId::PauliZ, {1});
+    CHECK(obs_manager.createNamedObs(ObsId::PauliX, {0}) == x0);
+    CHECK(obs_manager.createNamedObs(ObsId::PauliX, {1}) != x0);
+    CHECK(obs_manager.createNamedObs(ObsId::PauliZ, {0}) != x0);
+
+    std::vector<std::complex<double>> matrix{{1, 0}, {0, 0}, {0, 0}, {-1, 0}};
+    auto h0 = obs_manager.createHermitianObs(matrix, {0});
+    CHECK(obs_manager.createHermitianObs(matrix, {0}) == h0);
+    matrix[3] = {1, 0};
+    CHECK(obs_manager.createHermitianObs(matrix, {0}) != h0);
+
+    auto tp = obs_manager.createTensorProdObs({x0, z1});
+    CHECK(obs_manager.createTensorProdObs({x0, z1}) == tp);
+    CHECK(obs_manager.createTensorProdObs({z1, x0}) != tp);
+
+    auto ham = obs_manager.createHamiltonianObs({0.5, 0.2}, {tp, h0});
+    CHECK(obs_manager.createHamiltonianObs({0.5, 0.2}, {tp, h0}) == ham);
+    CHECK(obs_manager.createHamiltonianObs({0.5, 0.3}, {tp, h0}) != ham);
+
+    // Repeated construction does not grow the storage
+    const size_t num_observables = obs_manager.numObservables();
+    for (size_t i = 0; i < 10; i++) {
+        auto x = obs_manager.createNamedObs(ObsId::PauliX, {0});
+        auto z = obs_manager.createNamedObs(ObsId::PauliZ, {1});
+        CHECK(obs_manager.createTensorProdObs({x, z}) == tp);
+    }
+    CHECK(obs_manager.numObservables() == num_observables);
+
+    obs_manager.clear();
+    CHECK(obs_manager.numObservables() == 0);
+    CHECK(obs_manager.createNamedObs(ObsId::PauliZ, {1}) == 0);
+}
+
 TEST_CASE("Test qubits allocation OpenQasmDevice", "[openqasm]")
 {
     std::unique_ptr<OpenQasmDevice> device = std::make_unique<OpenQasmDevice>("{}");
@@ -324,6 +594,22 @@ TEST_CASE("Test measurement processes, the bell pair circuit with BuilderType::B
         }
     }
 
+    SECTION("SubmitSample")
+    {
+        // The second submission is sent with the first one, or in a batch of its own if the first
+        // one has already started
+        auto all_job = device->SubmitSample({});
+        auto partial_job = device->SubmitSample(std::vector<QubitIdType>{0});
+
+        auto &&partial_samples = partial_job.get();
+        auto &&all_samples = all_job.get();
+        CHECK(partial_samples.size() == shots);
+        CHECK(all_samples.size() == shots * n);
+        for (auto sample : all_samples) {
+            CHECK((sample == 0.0 || sample == 1.0));
+        }
+    }
+
     SECTION("Counts")
     {
         std::vector<double> eigvals(size);
@@ -546,6 +832,23 @@ TEST_CASE("Test measurement processes, a simple circuit with BuilderType::Braket
         CHECK_THAT(var, WithinAbs(0.5, 1e-5));
     }
 
+    SECTION("Expval and Var of the same circuit")
+    {
+        device->SetDeviceShots(0); // to get deterministic results
+        auto obs_h = device->Observable(ObsId::Hadamard, {}, std::vector<QubitIdType>{1});
+        auto obs_z = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{0});
+
+        CHECK_THAT(device->Expval(obs_h), WithinAbs(-0.7071067812, 1e-5));
+        CHECK_THAT(device->Var(obs_h), WithinAbs(0.5, 1e-5));
+        CHECK_THAT(device->Expval(obs_z), WithinAbs(-1.0, 1e-5));
+
+        // Measurements after new gates are computed from the new circuit
+        device->NamedOperation("PauliX", {}, {wires[0]}, false);
+        CHECK_THAT(device->Var(obs_h), WithinAbs(0.5, 1e-5));
+        CHECK_THAT(device->Expval(obs_z), WithinAbs(1.0, 1e-5));
+        CHECK_THAT(device->Expval(obs_h), WithinAbs(-0.7071067812, 1e-5));
+    }
+
     SECTION("Var(hermitian(1))")
     {
         device->SetDeviceShots(0); // to get deterministic results
@@ -0,0 +1,160 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
+
+#include "RuntimeCAPI.h"
+
+using Catch::Matchers::ContainsSubstring;
+
+// -------------------------------------------------------------------------- //
+// Pauli Frame Runtime Tests
+// -------------------------------------------------------------------------- //
+
+// Pauli records are encoded with the X-parity bit in bit 0 and the Z-parity bit in bit 1
+constexpr uint8_t PAULI_I = 0;
+constexpr uint8_t PAULI_X = 1;
+constexpr uint8_t PAULI_Z = 2;
+constexpr uint8_t PAULI_Y = 3;
+
+// The values of the `CliffordGate` enum of the `pauli_frame` dialect
+constexpr uint32_t CLIFFORD_HADAMARD = 0;
+constexpr uint32_t CLIFFORD_S = 1;
+constexpr uint32_t CLIFFORD_CNOT = 2;
+
+TEST_CASE("Test Pauli frame updates through Clifford gates, device=null.qubit", "[PauliFrame]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"null.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+    QUBIT *q0 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    QUBIT *q1 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+    __catalyst__pf__init_qreg(qs);
+    CHECK(__catalyst__pf__read(q0) == PAULI_I);
+    CHECK(__catalyst__pf__read(q1) == PAULI_I);
+
+    // H X H = Z, and S X S^dagger = Y
+    __catalyst__pf__update(q0, true, false);
+    __catalyst__pf__update_with_clifford(CLIFFORD_HADAMARD, 1, q0, nullptr);
+    CHECK(__catalyst__pf__read(q0) == PAULI_Z);
+    __catalyst__pf__update_with_clifford(CLIFFORD_HADAMARD, 1, q0, nullptr);
+    __catalyst__pf__update_with_clifford(CLIFFORD_S, 1, q0, nullptr);
+    CHECK(__catalyst__pf__read(q0) == PAULI_Y);
+
+    // X on the control spreads to the target, and Z on the target spreads to the control
+    __catalyst__pf__set(q0, true, false);
+    __catalyst__pf__set(q1, false, true);
+    __catalyst__pf__update_with_clifford(CLIFFORD_CNOT, 2, q0, q1);
+    CHECK(__catalyst__pf__read(q0) == PAULI_Y);
+    CHECK(__catalyst__pf__read(q1) == PAULI_Y);
+
+    // The target may be the qubit of ID 0, whose pointer is null
+    REQUIRE(reinterpret_cast<QubitIdType>(q0) == 0);
+    __catalyst__pf__set(q0, false, false);
+    __catalyst__pf__set(q1, true, false);
+    __catalyst__pf__update_with_clifford(CLIFFORD_CNOT, 2, q1, q0);
+    CHECK(__catalyst__pf__read(q0) == PAULI_X);
+    CHECK(__catalyst__pf__read(q1) == PAULI_X);
+    __catalyst__pf__set(q0, true, true);
+    __catalyst__pf__set(q1, true, true);
+    REQUIRE_THROWS_WITH(__catalyst__pf__update_with_clifford(CLIFFORD_CNOT, 3, q1, q0),
+                        ContainsSubstring("Invalid number of qubits"));
+
+    // Only the X component of a record flips a computational basis measurement
+    CHECK(__catalyst__pf__correct_measurement(false, q0) == true);
+    __catalyst__pf__update(q0, true, false);
+    CHECK(__catalyst__pf__read(q0) == PAULI_Z);
+    CHECK(__catalyst__pf__correct_measurement(false, q0) == false);
+
+    // Flushing returns the record and resets it
+    CHECK(__catalyst__pf__flush(q1) == PAULI_Y);
+    CHECK(__catalyst__pf__read(q1) == PAULI_I);
+
+    __catalyst__pf__init(q0);
+    CHECK(__catalyst__pf__read(q0) == PAULI_I);
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test Pauli frame of a large register, device=null.qubit", "[PauliFrame]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"null.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    // Records span several words of the bit sets
+    const size_t num_qubits = 200;
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(num_qubits);
+    auto getQubit = [&](size_t idx) {
+        return *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, idx);
+    };
+
+    __catalyst__pf__init_qreg(qs);
+    for (size_t i = 0; i < num_qubits; i++) {
+        if (i % 3 == 0) {
+            __catalyst__pf__update(getQubit(i), true, false);
+        }
+    }
+    for (size_t i = 0; i + 1 < num_qubits; i++) {
+        __catalyst__pf__update_with_clifford(CLIFFORD_CNOT, 2, getQubit(i), getQubit(i + 1));
+    }
+
+    // A chain of CNOTs accumulates the X parity of all the preceding qubits
+    bool parity = false;
+    for (size_t i = 0; i < num_qubits; i++) {
+        parity ^= (i % 3 == 0);
+        CHECK(__catalyst__pf__read(getQubit(i)) == (parity ? PAULI_X : PAULI_I));
+    }
+
+    __catalyst__pf__init_qreg(qs);
+    for (size_t i = 0; i < num_qubits; i++) {
+        CHECK(__catalyst__pf__read(getQubit(i)) == PAULI_I);
+    }
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test Pauli frame is reset on device release, device=null.qubit", "[PauliFrame]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"null.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(1);
+    QUBIT *q0 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    __catalyst__pf__update(q0, true, true);
+    CHECK(__catalyst__pf__read(q0) == PAULI_Y);
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+
+    // The pooled device is reused with an empty frame
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+    qs = __catalyst__rt__qubit_allocate_array(1);
+    q0 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    CHECK(__catalyst__pf__read(q0) == PAULI_I);
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+
+    __catalyst__rt__finalize();
+}
@@ -0,0 +1,124 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <string>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
+
+#include "ExecutionContext.hpp"
+#include "Philox.hpp"
+#include "RuntimeCAPI.h"
+
+using namespace Catalyst::Runtime;
+using Catch::Matchers::ContainsSubstring;
+
+TEST_CASE("Test Philox4x32-10 known answer vectors", "[Philox]")
+{
+    // Reference values from the Random123 distribution
+    using Block = PhiloxEngine::Block;
+
+    CHECK(PhiloxEngine::generate(0, {0, 0, 0, 0}) ==
+          Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+    CHECK(PhiloxEngine::generate(0xffffffffffffffffULL,
+                                 {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}) ==
+          Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+    CHECK(PhiloxEngine::generate(0x299f31d0a4093822ULL,
+                                 {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}) ==
+          Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Test PhiloxEngine discard matches sequential draws", "[Philox]")
+{
+    for (unsigned long long skip : {0ULL, 1ULL, 3ULL, 4ULL, 5ULL, 17ULL, 1000ULL}) {
+        PhiloxEngine sequential(42, 7);
+        PhiloxEngine jumped(42, 7);
+
+        // Start from a partially consumed block
+        sequential();
+        jumped();
+
+        for (unsigned long long i = 0; i < skip; i++) {
+            sequential();
+        }
+        jumped.discard(skip);
+
+        CHECK(sequential == jumped);
+        for (size_t i = 0; i < 9; i++) {
+            CHECK(sequential() == jumped());
+        }
+    }
+}
+
+TEST_CASE("Test PhiloxEngine split streams", "[Philox]")
+{
+    PhiloxEngine root(1234);
+
+    // Splitting does not depend on how far the parent has advanced
+    const PhiloxEngine child = root.split(3);
+    root.discard(100);
+    CHECK(root.split(3) == child);
+
+    PhiloxEngine a = root.split(0);
+    PhiloxEngine b = root.split(1);
+    CHECK_FALSE(a == b);
+
+    size_t num_equal = 0;
+    for (size_t i = 0; i < 64; i++) {
+        num_equal += a() == b();
+    }
+    CHECK(num_equal < 2);
+
+    // Streams are usable with the standard distributions
+    PhiloxEngine gen = PhiloxEngine(1234).split(3);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    for (size_t i = 0; i < 1000; i++) {
+        const double x = dist(gen);
+        CHECK((x >= 0.0 && x < 1.0));
+    }
+}
+
+TEST_CASE("Test random streams of the execution context", "[Philox]")
+{
+    uint32_t seed = 37;
+    ExecutionContext seeded(&seed);
+    ExecutionContext seeded_again(&seed);
+    ExecutionContext unseeded;
+
+    REQUIRE(seeded.getPRNGStream(5).has_value());
+    CHECK(*seeded.getPRNGStream(5) == *seeded_again.getPRNGStream(5));
+    CHECK_FALSE(*seeded.getPRNGStream(5) == *seeded.getPRNGStream(6));
+    CHECK_FALSE(unseeded.getPRNGStream(5).has_value());
+}
+
+TEST_CASE("Test __catalyst__rt__set_prng_stream", "[Philox]")
+{
+    uint32_t seed = 37;
+    __catalyst__rt__initialize(&seed);
+
+    REQUIRE_THROWS_WITH(__catalyst__rt__set_prng_stream(0),
+                        ContainsSubstring("without an active device"));
+
+    const std::string rtd_lib = "null.qubit";
+    __catalyst__rt__device_init((int8_t *)rtd_lib.c_str(), nullptr, nullptr, 0, false);
+
+    __catalyst__rt__set_prng_stream(0);
+    __catalyst__rt__set_prng_stream(12);
+    REQUIRE_THROWS_WITH(__catalyst__rt__set_prng_stream(-1),
+                        ContainsSubstring("Invalid random stream id"));
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
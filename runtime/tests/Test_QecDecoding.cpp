@@ -0,0 +1,139 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "RuntimeCAPI.h"
+
+// -------------------------------------------------------------------------- //
+// QEC Decoding Runtime Tests
+// -------------------------------------------------------------------------- //
+
+// The Tanner graph of a repetition code with three data qubits and two checks, where check `i`
+// acts on data qubits `i` and `i + 1`, in CSC form
+const std::array<int32_t, 8> REP_ROW_IDX = {3, 3, 4, 4, 0, 1, 1, 2};
+const std::array<int32_t, 6> REP_COL_PTR = {0, 1, 3, 4, 6, 8};
+
+TEST_CASE("Test decoding syndrome rounds of a repetition code, device=null.qubit", "[QecDecoding]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"null.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    const int64_t decoder = __catalyst__qecp__decoder_create(
+        REP_ROW_IDX.data(), REP_ROW_IDX.size(), REP_COL_PTR.data(), REP_COL_PTR.size(), 32);
+
+    // The same Tanner graph reuses the same decoder
+    CHECK(__catalyst__qecp__decoder_create(REP_ROW_IDX.data(), REP_ROW_IDX.size(),
+                                           REP_COL_PTR.data(), REP_COL_PTR.size(), 32) == decoder);
+
+    // Rounds are decoded when they are pushed, and pulled in the same order
+    const std::array<uint64_t, 4> rounds = {0b01, 0b11, 0b10, 0b00};
+    __catalyst__qecp__decoder_push(decoder, rounds.data(), 2, 4);
+    std::array<int64_t, 3> corrections{};
+    CHECK(__catalyst__qecp__decoder_pull(decoder, corrections.data(), corrections.size()) == 3);
+    const std::array<int64_t, 3> expected = {0, 1, 2};
+    CHECK(corrections == expected);
+    CHECK(__catalyst__qecp__decoder_pull(decoder, corrections.data(), corrections.size()) == 1);
+    CHECK(corrections[0] == -1);
+    CHECK(__catalyst__qecp__decoder_pull(decoder, corrections.data(), corrections.size()) == 0);
+
+    // A single round of measurement results, padded with -1 up to the size of the result
+    const std::array<bool, 2> esm = {true, true};
+    std::array<int64_t, 2> err_idx{};
+    __catalyst__qecp__decode_esm(decoder, esm.data(), esm.size(), err_idx.data(), err_idx.size());
+    const std::array<int64_t, 2> expected_err_idx = {1, -1};
+    CHECK(err_idx == expected_err_idx);
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test syndrome rounds of more than 64 checks, device=null.qubit", "[QecDecoding]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"null.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    // A repetition code with 71 data qubits and 70 checks
+    constexpr int64_t num_data = 71;
+    constexpr int64_t num_checks = 70;
+    std::vector<std::vector<int64_t>> neighbours(num_data + num_checks);
+    for (int64_t check = 0; check < num_checks; check++) {
+        for (int64_t qubit : {check, check + 1}) {
+            neighbours[qubit].push_back(num_data + check);
+            neighbours[num_data + check].push_back(qubit);
+        }
+    }
+    std::vector<int64_t> row_idx;
+    std::vector<int64_t> col_ptr = {0};
+    for (auto &rows : neighbours) {
+        std::sort(rows.begin(), rows.end());
+        row_idx.insert(row_idx.end(), rows.begin(), rows.end());
+        col_ptr.push_back(static_cast<int64_t>(row_idx.size()));
+    }
+    const int64_t decoder = __catalyst__qecp__decoder_create(row_idx.data(), row_idx.size(),
+                                                             col_ptr.data(), col_ptr.size(), 64);
+
+    // An error on qubit 64 is detected by the checks 63 and 64, across the two words of the round
+    const std::array<uint64_t, 2> round = {uint64_t{1} << 63, 1};
+    __catalyst__qecp__decoder_push(decoder, round.data(), num_checks, 1);
+    int64_t correction = 0;
+    CHECK(__catalyst__qecp__decoder_pull(decoder, &correction, 1) == 1);
+    CHECK(correction == 64);
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test registered syndrome decoders, device=null.qubit", "[QecDecoding]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"null.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    // Corrects every qubit whose check is set
+    int64_t num_calls = 0;
+    auto decode = [](void *context, const uint64_t *syndrome, int64_t num_checks,
+                     int64_t *corrections) {
+        (*static_cast<int64_t *>(context))++;
+        for (int64_t check = 0; check < num_checks; check++) {
+            if ((syndrome[0] >> check) & 1) {
+                *corrections++ = check;
+            }
+        }
+    };
+    const int64_t decoder = __catalyst__qecp__decoder_register(decode, &num_calls, 3);
+
+    const std::array<uint64_t, 2> rounds = {0b101, 0b010};
+    __catalyst__qecp__decoder_push(decoder, rounds.data(), 3, 2);
+    CHECK(num_calls == 2);
+
+    std::array<int64_t, 6> corrections{};
+    CHECK(__catalyst__qecp__decoder_pull(decoder, corrections.data(), corrections.size()) == 2);
+    const std::array<int64_t, 6> expected = {0, 2, -1, 1, -1, -1};
+    CHECK(corrections == expected);
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
@@ -23,6 +23,7 @@
 #include "catch2/matchers/catch_matchers_string.hpp"
 
 #include "CliffordData.hpp"
+#include "GridsynthTable.hpp"
 #include "RSDecomp.hpp"
 
 using namespace Catch::Matchers;
@@ -256,6 +257,183 @@ TEST_CASE("Test C-API Wrapper (Memref Interface)", "[RSDecomp][Ross Selinger]")
     CHECK(static_cast<PPRGateType>(buffer_ppr[0]) == PPRGateType::Z8);
 }
 
+TEST_CASE("Test C-API batched solving (Memref Interface)", "[RSDecomp][Ross Selinger]")
+{
+    const double epsilon = 1e-4;
+    const bool ppr_basis = GENERATE(false, true);
+    CAPTURE(ppr_basis);
+
+    // Interleave the angles with padding to simulate a strided memref, with repeated angles
+    std::vector<double> angles;
+    for (int i = 0; i < 24; i++) {
+        angles.push_back(-3.0 + 0.25 * (i % 20));
+        angles.push_back(0.0);
+    }
+    const size_t num_angles = angles.size() / 2;
+    rs_decomposition_solve_batch(nullptr, angles.data(), 0, num_angles, 2, epsilon, ppr_basis);
+
+    for (size_t i = 0; i < num_angles; i++) {
+        const double angle = angles[2 * i];
+        CAPTURE(angle);
+
+        const size_t size = rs_decomposition_get_size(angle, epsilon, ppr_basis);
+        std::vector<size_t> buffer(size);
+        rs_decomposition_get_gates(nullptr, buffer.data(), 0, size, 1, angle, epsilon, ppr_basis);
+        const double phase = rs_decomposition_get_phase(angle, epsilon, ppr_basis);
+
+        if (ppr_basis) {
+            const auto &[gates, expected_phase] = eval_ross_algorithm_ppr(angle, epsilon);
+            REQUIRE(buffer.size() == gates.size());
+            for (size_t j = 0; j < gates.size(); j++) {
+                CHECK(static_cast<PPRGateType>(buffer[j]) == gates[j]);
+            }
+            CHECK(phase == expected_phase);
+        }
+        else {
+            std::vector<GateType> gates;
+            for (size_t gate : buffer) {
+                gates.push_back(static_cast<GateType>(gate));
+            }
+            auto result_matrix = matrix_from_decomp_result(gates);
+
+            std::complex<double> phase_factor = {std::cos(phase), -std::sin(phase)};
+            std::vector<std::complex<double>> global_phase_matrix = {phase_factor, 0.0, 0.0,
+                                                                     phase_factor};
+            result_matrix = multiply_matrices(global_phase_matrix, result_matrix);
+
+            std::complex<double> z = {std::cos(angle / 2.0), -std::sin(angle / 2.0)};
+            double residue_norm = std::norm(result_matrix[0] - z) + std::norm(result_matrix[2]);
+            CHECK(std::sqrt(residue_norm) <= epsilon);
+        }
+    }
+}
+
+TEST_CASE("Test batched solving on several threads", "[RSDecomp][Ross Selinger]")
+{
+    const double epsilon = 1e-3;
+    const bool ppr_basis = GENERATE(false, true);
+    CAPTURE(ppr_basis);
+
+    std::vector<double> angles;
+    for (int i = 0; i < 32; i++) {
+        angles.push_back(0.1 + 0.37 * i);
+    }
+    solve_ross_algorithm_batch(angles, epsilon, ppr_basis, /* num_threads */ 4);
+
+    for (double angle : angles) {
+        CAPTURE(angle);
+        if (ppr_basis) {
+            const auto [gates, phase] = eval_ross_algorithm_ppr(angle, epsilon);
+            CHECK_FALSE(gates.empty());
+        }
+        else {
+            const auto [gates, phase] = eval_ross_algorithm(angle, epsilon);
+            auto result_matrix = matrix_from_decomp_result(gates);
+
+            std::complex<double> phase_factor = {std::cos(phase), -std::sin(phase)};
+            std::vector<std::complex<double>> global_phase_matrix = {phase_factor, 0.0, 0.0,
+                                                                     phase_factor};
+            result_matrix = multiply_matrices(global_phase_matrix, result_matrix);
+
+            std::complex<double> z = {std::cos(angle / 2.0), -std::sin(angle / 2.0)};
+            double residue_norm = std::norm(result_matrix[0] - z) + std::norm(result_matrix[2]);
+            CHECK(std::sqrt(residue_norm) <= epsilon);
+        }
+    }
+}
+
+TEST_CASE("Test decomposition result cache", "[RSDecomp][Ross Selinger]")
+{
+    const double angle = 0.731;
+    const double epsilon = 1e-3;
+    clear_ross_caches();
+
+    SECTION("Standard basis")
+    {
+        size_t size = rs_decomposition_get_size(angle, epsilon, false);
+        std::vector<size_t> gates(size);
+        rs_decomposition_get_gates(gates.data(), gates.data(), 0, size, 1, angle, epsilon, false);
+        (void)rs_decomposition_get_phase(angle, epsilon, false);
+
+        // The angle is solved once, and its decomposition is read from the cache afterwards
+        const RossCacheStats stats = get_ross_cache_stats(false);
+        CHECK(stats.misses == 1);
+        CHECK(stats.hits == 2);
+        CHECK(stats.size == 1);
+    }
+
+    SECTION("PPR basis reuses the standard basis decomposition")
+    {
+        const auto [std_gates, std_phase] = eval_ross_algorithm(angle, epsilon);
+        const auto [ppr_gates, ppr_phase] = eval_ross_algorithm_ppr(angle, epsilon);
+        (void)rs_decomposition_get_size(angle, epsilon, true);
+
+        const auto [expected_gates, phase_update] = HST_to_PPR(std_gates);
+        CHECK(ppr_gates == expected_gates);
+        CHECK(ppr_phase == std_phase + phase_update);
+
+        const RossCacheStats std_stats = get_ross_cache_stats(false);
+        CHECK(std_stats.misses == 1);
+        CHECK(std_stats.hits == 1);
+
+        const RossCacheStats ppr_stats = get_ross_cache_stats(true);
+        CHECK(ppr_stats.misses == 1);
+        CHECK(ppr_stats.hits == 1);
+    }
+
+    clear_ross_caches();
+    CHECK(get_ross_cache_stats(false).size == 0);
+    CHECK(get_ross_cache_stats(true).size == 0);
+}
+
+TEST_CASE("Test precomputed gridsynth table", "[RSDecomp][Ross Selinger]")
+{
+    using namespace RSDecomp::GridsynthTable;
+    clear_ross_caches();
+
+    for (const Entry &entry : ENTRIES) {
+        const double angle = entry_angle(entry);
+        CAPTURE(entry.multiple, entry.log2_denominator, entry.epsilon);
+
+        // The entries are the decompositions found by a search, rather than by a table lookup
+        const auto [gates, phase] = compute_clifford_T_decomposition(angle, entry.epsilon);
+        REQUIRE(gates.size() == entry.gates.size());
+        for (size_t i = 0; i < gates.size(); i++) {
+            CHECK(static_cast<size_t>(gates[i]) == decode_gate(entry.gates[i], false));
+        }
+        CHECK(phase == entry.phase);
+
+        // The runtime returns the entries
+        const auto [table_gates, table_phase] = eval_ross_algorithm(angle, entry.epsilon);
+        CHECK(table_gates == gates);
+        CHECK(table_phase == phase);
+
+        // The entries are valid decompositions at their precision
+        auto result_matrix = matrix_from_decomp_result(gates);
+        std::complex<double> phase_factor = {std::cos(phase), -std::sin(phase)};
+        std::vector<std::complex<double>> global_phase_matrix = {phase_factor, 0.0, 0.0,
+                                                                 phase_factor};
+        result_matrix = multiply_matrices(global_phase_matrix, result_matrix);
+
+        std::complex<double> z = {std::cos(angle / 2.0), -std::sin(angle / 2.0)};
+        double residue_norm = std::norm(result_matrix[0] - z) + std::norm(result_matrix[2]);
+        CHECK(std::sqrt(residue_norm) <= entry.epsilon);
+
+        // The PPR entries are the conversions of the Clifford+T ones
+        const auto [ppr_gates, ppr_phase] = eval_ross_algorithm_ppr(angle, entry.epsilon);
+        const auto [expected_ppr_gates, phase_update] = HST_to_PPR(gates);
+        CHECK(ppr_gates == expected_ppr_gates);
+        CHECK_THAT(ppr_phase, WithinAbs(phase + phase_update, 1e-12));
+    }
+
+    // Other angles and precisions are not in the table
+    CHECK_FALSE(lookup(M_PI / 8.0 + 1e-12, 1e-4, false).has_value());
+    CHECK_FALSE(lookup(M_PI / 8.0, 2e-4, false).has_value());
+    CHECK(lookup(M_PI / 8.0, 1e-4, true).has_value());
+
+    clear_ross_caches();
+}
+
 TEST_CASE("rs_decomposition_get_size emits warning for epsilon < 1e-6", "[RSDecomp][Warning]")
 {
     const double theta = 0.5;
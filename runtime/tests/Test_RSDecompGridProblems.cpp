@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <set>
+
 #include "catch2/catch_test_macros.hpp"
+#include "catch2/generators/catch_generators.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 
 #include "GridProblems.hpp"
@@ -64,6 +67,39 @@ TEST_CASE("Test one dimensional grid problem", "[RSDecomp][GridProblems]")
     }
 }
 
+TEST_CASE("Test one dimensional grid problem across batches", "[RSDecomp][GridProblems]")
+{
+    // Intervals wide enough for the candidates to span several batches, checked against a
+    // brute-force enumeration of the grid points. The bounds avoid exact grid points, which
+    // may be lost to the rounding of the scaled intervals.
+    auto [x0, x1, y0, y1] = GENERATE(table<double, double, double, double>({
+        {0.1, 100.3, 0.2, 99.7},
+        {-3.5, 0.2, -250.0, 180.0},
+        {-120.0, -80.0, 40.0, 95.5},
+    }));
+    CAPTURE(x0, x1, y0, y1);
+
+    std::set<std::pair<long, long>> expected;
+    const long b_bound = static_cast<long>((std::max(x1, y1) - std::min(x0, y0)) / M_SQRT2) + 1;
+    for (long b = -b_bound; b <= b_bound; b++) {
+        for (long a = static_cast<long>(std::floor(x0 - b * M_SQRT2));
+             a <= static_cast<long>(std::ceil(x1 - b * M_SQRT2)); a++) {
+            const double alpha = a + b * M_SQRT2;
+            const double beta = a - b * M_SQRT2;
+            if (x0 <= alpha && alpha <= x1 && y0 <= beta && beta <= y1) {
+                expected.emplace(a, b);
+            }
+        }
+    }
+    REQUIRE(expected.size() > 64);
+
+    std::set<std::pair<long, long>> found;
+    for (const ZSqrtTwo &sol : one_dim_problem_solution_iterator(x0, x1, y0, y1)) {
+        CHECK(found.emplace(static_cast<long>(sol.a), static_cast<long>(sol.b)).second);
+    }
+    CHECK(found == expected);
+}
+
 struct UprightProblemParams {
     bbox bbox1;
     bbox bbox2;
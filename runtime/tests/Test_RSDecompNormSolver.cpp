@@ -52,6 +52,24 @@ TEST_CASE("Test Integer Factorization", "[RSDecomp][NormSolver]")
     }
 }
 
+TEST_CASE("Test Integer Factorization of large numbers", "[RSDecomp][NormSolver]")
+{
+    // Products of two primes, factored with native integers below 2^63 and with multiprecision
+    // integers above
+    auto [p, q] = GENERATE(table<INT_TYPE, INT_TYPE>({
+        {1000003, 1000033},
+        {2147483647, 2147483629},
+        {4294967291, 4294967279},
+        {INT_TYPE("1000000000039"), INT_TYPE("1000000000061")},
+    }));
+    const INT_TYPE num = p * q;
+    CAPTURE(num);
+
+    std::optional<INT_TYPE> result = integer_factorize(num);
+    REQUIRE(result.has_value());
+    CHECK((result.value() == p || result.value() == q));
+}
+
 TEST_CASE("Test Factorize Prime ZSqrtTwo", "[RSDecomp][NormSolver]")
 {
     auto [num, valid_values] = GENERATE(table<INT_TYPE, std::vector<ZSqrtTwo>>({
@@ -115,6 +115,34 @@ TEST_CASE("Test ZOmega class", "[RSDecomp][Rings]")
     CHECK((z1 - ZOmega(2, 2, 2, 0)).to_sqrt_two() == ZSqrtTwo(4, 1));
 }
 
+TEST_CASE("Test ring arithmetic across the fixed-width boundary", "[RSDecomp][Rings]")
+{
+    // Coefficients around the bounds of the fixed-width fast path, where products and norms are
+    // computed in native integers below the bounds and in multiprecision integers above them
+    const INT_TYPE bound = GENERATE(INT_TYPE(1) << 14, INT_TYPE(1) << 30, INT_TYPE(1) << 62,
+                                    INT_TYPE(1) << 63, INT_TYPE(1) << 100);
+    const INT_TYPE offset = GENERATE(-1, 0, 1);
+    CAPTURE(bound, offset);
+
+    const INT_TYPE x = bound + offset;
+    const INT_TYPE y = -x + 3;
+
+    ZSqrtTwo s1(x, y);
+    ZSqrtTwo s2(y, -x);
+    CHECK((s1 * s2) == ZSqrtTwo(x * y - 2 * y * x, -x * x + y * y));
+    CHECK(s1.norm() == x * x - 2 * y * y);
+
+    ZOmega z1(x, y, -x, 7);
+    ZOmega z2(y, x, 5, -y);
+    CHECK((z1 + z2) == ZOmega(x + y, y + x, -x + 5, 7 - y));
+    CHECK((z1 * z2) == ZOmega(x * -y + y * 5 + -x * x + 7 * y, y * -y + -x * 5 + 7 * x - x * y,
+                              -x * -y + 7 * 5 - x * x - y * y, 7 * -y - x * 5 - y * x + x * y));
+
+    const INT_TYPE first = x * x + y * y + x * x + 49;
+    const INT_TYPE second = x * y - y * x - x * 7 - 7 * x;
+    CHECK(z1.norm4() == first * first - 2 * second * second);
+}
+
 TEST_CASE("Test DyadicMatrix class", "[RSDecomp][Rings]")
 {
     ZOmega z1 = ZOmega(1, 2, 3, 4);
@@ -177,6 +177,31 @@ TEST_CASE("LRU Cache Edge Cases", "[LRUCache]")
     }
 }
 
+TEST_CASE("LRU Cache hit and miss counters", "[LRUCache]")
+{
+    lru_cache<int, int, 2> cache;
+    CHECK(cache.hits() == 0);
+    CHECK(cache.misses() == 0);
+
+    CHECK(cache.get(1) == std::nullopt);
+    cache.put(1, 10);
+    CHECK(cache.get(1) == 10);
+    CHECK(cache.get(1) == 10);
+    CHECK(cache.hits() == 2);
+    CHECK(cache.misses() == 1);
+
+    // Evicted items miss again
+    cache.put(2, 20);
+    cache.put(3, 30);
+    CHECK(cache.get(1) == std::nullopt);
+    CHECK(cache.hits() == 2);
+    CHECK(cache.misses() == 2);
+
+    cache.clear();
+    CHECK(cache.hits() == 0);
+    CHECK(cache.misses() == 0);
+}
+
 TEST_CASE("LRU Cache Complex Types", "[LRUCache]")
 {
     using KeyType = std::pair<int, int>;
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <fstream>
+#include <limits>
 
 #include "catch2/catch_test_macros.hpp"
 
@@ -496,3 +497,128 @@ TEST_CASE("Test Resource Tracker Measurements", "[resourcetracking]")
 
     CHECK(tracker.GetNumMeasurements("NonExistentMeasurement") == 0); // should not exist
 }
+
+TEST_CASE("Test Resource Tracker Cost Estimation", "[resourcetracking]")
+{
+    ResourceTracker tracker;
+    CHECK(tracker.GetEstimateCost() == false);
+    CHECK(tracker.GetEstimatedDuration() == 0);
+
+    tracker.SetGateDurations("PauliX=10;CNOT=100;C(S)=40");
+    tracker.SetDefaultGateDuration(5);
+    tracker.SetShots(100);
+    CHECK(tracker.GetEstimateCost() == true);
+
+    CHECK(tracker.GetGateDuration("PauliX") == 10);
+    CHECK(tracker.GetGateDuration("Adjoint(PauliX)", "PauliX") == 10);
+    CHECK(tracker.GetGateDuration("C(S)", "S") == 40);
+    CHECK(tracker.GetGateDuration("S") == 5);
+
+    for (size_t i = 0; i < 3; i++) {
+        tracker.AllocateQubit(i);
+    }
+
+    tracker.NamedOperation("PauliX", false, {0});  // wire 0 ends at 10
+    tracker.NamedOperation("PauliX", true, {1});   // wire 1 ends at 10
+    tracker.NamedOperation("CNOT", false, {0, 1}); // wires 0, 1 end at 110
+    tracker.NamedOperation("S", false, {2}, {1});  // wires 1, 2 end at 150
+    tracker.NamedOperation("T", false, {0});       // wire 0 ends at 115
+
+    CHECK(tracker.GetNumGates() == 5);
+    CHECK(tracker.GetEstimatedDuration() == 150);
+    CHECK(tracker.GetEstimatedTotalDuration() == 15000);
+    CHECK(tracker.GetStateVectorBytes() == 128);
+
+    // Released qubits still count towards the critical path
+    tracker.ReleaseQubit(1);
+    tracker.ReleaseQubit(2);
+    CHECK(tracker.GetEstimatedDuration() == 150);
+
+    // Analytic executions cost a single shot
+    tracker.SetShots(0);
+    CHECK(tracker.GetEstimatedTotalDuration() == 150);
+
+    tracker.Reset();
+    CHECK(tracker.GetEstimatedDuration() == 0);
+    CHECK(tracker.GetEstimateCost() == true);
+    CHECK(tracker.GetGateDuration("CNOT") == 100);
+
+    CHECK_THROWS(tracker.SetGateDurations("RX"));
+    CHECK_THROWS(tracker.SetGateDurations("RX=fast"));
+    CHECK_THROWS(tracker.SetGateDurations("RX=-1"));
+    CHECK_THROWS(tracker.SetGateDurations("=1"));
+
+    tracker.AllocateQubit(0);
+    CHECK_THROWS(tracker.SetEstimateCost(false));
+}
+
+TEST_CASE("Test Resource Tracker state vector size limit", "[resourcetracking]")
+{
+    ResourceTracker tracker;
+
+    // The state vector of 59 wires is the largest whose size in bytes fits in std::size_t
+    for (size_t i = 0; i < 59; i++) {
+        tracker.AllocateQubit(i);
+    }
+    CHECK(tracker.GetStateVectorBytes() == std::size_t{1} << 63);
+
+    // Larger state vectors saturate
+    tracker.AllocateQubit(59);
+    CHECK(tracker.GetStateVectorBytes() == std::numeric_limits<std::size_t>::max());
+}
+
+TEST_CASE("Test Resource Tracker Gate Opcodes", "[resourcetracking]")
+{
+    ResourceTracker tracker;
+    tracker.SetComputeDepth(true);
+    for (size_t i = 0; i < 6; i++) {
+        tracker.AllocateQubit(i);
+    }
+
+    const std::vector<QubitIdType> target{0};
+    const std::vector<QubitIdType> one_control{1};
+    const std::vector<QubitIdType> many_controls{1, 2, 3, 4, 5};
+
+    // Opcodes are recorded under the same names as named operations, including variants that
+    // have too many controls to be cached
+    for (size_t i = 0; i < 3; i++) {
+        tracker.GateOperation(GateId::RX, false, target);
+        tracker.GateOperation(GateId::RX, true, target, one_control);
+        tracker.GateOperation(GateId::S, false, target, many_controls);
+    }
+    tracker.NamedOperation("RX", false, {0});
+
+    CHECK(tracker.GetNumGates() == 10);
+    CHECK(tracker.GetNumGates("RX") == 4);
+    CHECK(tracker.GetNumGates("C(Adjoint(RX))") == 3);
+    CHECK(tracker.GetNumGates("5C(S)") == 3);
+    CHECK(tracker.GetNumGatesBySize(1) == 4);
+    CHECK(tracker.GetNumGatesBySize(2) == 3);
+    CHECK(tracker.GetNumGatesBySize(6) == 3);
+    CHECK(tracker.GetDepth() == 10);
+
+    const std::vector<QubitIdType> unallocated{7};
+    CHECK_THROWS(tracker.GateOperation(GateId::Hadamard, false, unallocated));
+    CHECK(tracker.GetNumGates() == 10);
+
+    // Interned gates are kept across resets, but are no longer counted
+    tracker.Reset();
+    CHECK(tracker.GetNumGates() == 0);
+    CHECK(tracker.GetNumGates("RX") == 0);
+    CHECK(tracker.GetNumGatesBySize(6) == 0);
+
+    tracker.AllocateQubit(0);
+    tracker.GateOperation(GateId::RX, false, target);
+    CHECK(tracker.GetNumGates("RX") == 1);
+    CHECK(tracker.GetDepth() == 1);
+
+    FILE *resources_file = tmpfile();
+    tracker.PrintResourceUsageToFile(resources_file);
+    rewind(resources_file);
+    char buffer[1024] = {};
+    size_t bytes_read = fread(buffer, 1, sizeof(buffer) - 1, resources_file);
+    fclose(resources_file);
+    std::string json(buffer, bytes_read);
+    CHECK(json.find("\"RX\": 1") != std::string::npos);
+    CHECK(json.find("C(Adjoint(RX))") == std::string::npos);
+}
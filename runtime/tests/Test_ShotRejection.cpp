@@ -0,0 +1,138 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "QuantumDevice.hpp"
+#include "RuntimeCAPI.h"
+#include "ShotRejection.hpp"
+
+using namespace Catalyst::Runtime;
+
+// -------------------------------------------------------------------------- //
+// Shot Rejection Runtime Tests
+// -------------------------------------------------------------------------- //
+
+namespace {
+
+/**
+ * A device that counts the gates and measurements, and measures the outcome `outcome` unless
+ * the measurement is postselected.
+ */
+struct CountingDevice final : public QuantumDevice {
+    size_t num_gates{0};
+    size_t num_measurements{0};
+    bool outcome{false};
+    bool result{false};
+
+    auto AllocateQubits(size_t count) -> std::vector<QubitIdType> override
+    {
+        return std::vector<QubitIdType>(count, 0);
+    }
+
+    void ReleaseQubits(const std::vector<QubitIdType> &) override {}
+
+    auto GetNumQubits() const -> size_t override { return 1; }
+
+    void SetDeviceShots(size_t) override {}
+
+    auto GetDeviceShots() const -> size_t override { return 1; }
+
+    void NamedOperation(const std::string &, const std::vector<double> &,
+                        const std::vector<QubitIdType> &, bool, const std::vector<QubitIdType> &,
+                        const std::vector<bool> &, const std::vector<std::string> &) override
+    {
+        num_gates++;
+    }
+
+    auto Measure(QubitIdType, std::optional<int32_t> postselect) -> Result override
+    {
+        num_measurements++;
+        result = postselect ? *postselect : outcome;
+        return &result;
+    }
+};
+
+void runShot(QuantumDevice &device)
+{
+    device.NamedOperation("Hadamard", {}, {0}, false);
+    device.Measure(0, 1);
+    device.NamedOperation("RX", {0.5}, {0}, false);
+    device.Measure(0, std::nullopt);
+}
+
+} // namespace
+
+TEST_CASE("Test a failed postselection skips the rest of the shot", "[ShotRejection]")
+{
+    auto counting_device = std::make_unique<CountingDevice>();
+    CountingDevice *counts = counting_device.get();
+    ShotRejectionDevice device(std::move(counting_device));
+
+    device.setEnabled(true);
+    device.startShot();
+    counts->outcome = false;
+    runShot(device);
+    CHECK(device.isRejected());
+    CHECK(counts->num_gates == 1);
+    CHECK(counts->num_measurements == 1);
+
+    device.startShot();
+    counts->outcome = true;
+    runShot(device);
+    CHECK(!device.isRejected());
+    CHECK(counts->num_gates == 3);
+    CHECK(counts->num_measurements == 3);
+}
+
+TEST_CASE("Test postselection is forwarded while rejection is disabled", "[ShotRejection]")
+{
+    auto counting_device = std::make_unique<CountingDevice>();
+    CountingDevice *counts = counting_device.get();
+    ShotRejectionDevice device(std::move(counting_device));
+
+    counts->outcome = false;
+    CHECK(*device.Measure(0, 1) == true);
+    runShot(device);
+    CHECK(!device.isRejected());
+    CHECK(counts->num_gates == 2);
+}
+
+TEST_CASE("Test __catalyst__rt__shot_acceptance_rate, device=null.qubit", "[ShotRejection]")
+{
+    __catalyst__rt__initialize(nullptr);
+    __catalyst__rt__toggle_shot_rejection(true);
+
+    // The null device always measures 0
+    const std::string rtd_name{"null.qubit"};
+    for (int32_t postselect : {0, 1, 1, 0}) {
+        __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 1, false);
+        QUBIT *qubit = __catalyst__rt__qubit_allocate();
+        __catalyst__qis__Hadamard(qubit, nullptr);
+        __catalyst__qis__Measure(qubit, postselect);
+        __catalyst__rt__qubit_release(qubit);
+        __catalyst__rt__device_release();
+        CHECK(__catalyst__rt__shot_accepted() == (postselect == 0));
+    }
+    CHECK(__catalyst__rt__shot_acceptance_rate() == 0.5);
+
+    __catalyst__rt__toggle_shot_rejection(false);
+    CHECK(__catalyst__rt__shot_accepted());
+    __catalyst__rt__finalize();
+}
@@ -0,0 +1,351 @@
+// Copyright 2026 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_string.hpp"
+
+#include "QuantumDevice.hpp"
+#include "RuntimeCAPI.h"
+#include "StabilizerQubit.hpp"
+#include "Types.h"
+
+using namespace Catch::Matchers;
+
+using namespace Catalyst::Runtime;
+using namespace Catalyst::Runtime::Devices;
+
+static auto getValue(Result result) -> bool { return *result; }
+
+TEST_CASE("Test deterministic and random measurements of a Bell state", "[StabilizerQubit]")
+{
+    auto device = std::make_unique<StabilizerQubit>("{seed : 42}");
+    auto wires = device->AllocateQubits(2);
+    device->NamedOperation("Hadamard", {}, {wires[0]});
+    device->NamedOperation("CNOT", {}, {wires[0], wires[1]});
+
+    // The Bell state is stabilized by XX, -YY and ZZ
+    CHECK(getValue(device->PauliMeasure("XX", wires)) == false);
+    CHECK(getValue(device->PauliMeasure("YY", wires)) == true);
+    CHECK(getValue(device->PauliMeasure("ZZ", wires)) == false);
+
+    // Measuring one qubit collapses the other onto the same outcome
+    const bool outcome = getValue(device->Measure(wires[0], std::nullopt));
+    CHECK(getValue(device->Measure(wires[1], std::nullopt)) == outcome);
+    CHECK(getValue(device->Measure(wires[0], std::nullopt)) == outcome);
+
+    // A random outcome can be postselected, an impossible one cannot
+    device->NamedOperation("Hadamard", {}, {wires[0]});
+    CHECK(getValue(device->Measure(wires[0], 1)) == true);
+    CHECK_THROWS_WITH(device->Measure(wires[0], 0), ContainsSubstring(
+                                                        "Postselection failed"));
+
+    device->ReleaseQubits(wires);
+}
+
+TEST_CASE("Test Clifford rotations", "[StabilizerQubit]")
+{
+    auto device = std::make_unique<StabilizerQubit>();
+    auto wires = device->AllocateQubits(2);
+
+    // H then RZ(pi/2) prepares the +1 eigenstate of Y, like H then S
+    device->NamedOperation("Hadamard", {}, {wires[0]});
+    device->NamedOperation("RZ", {M_PI / 2}, {wires[0]});
+    CHECK(getValue(device->PauliMeasure("Y", {wires[0]})) == false);
+    device->NamedOperation("S", {}, {wires[0]}, true);
+    CHECK(getValue(device->PauliMeasure("X", {wires[0]})) == false);
+
+    // A half turn about XZ flips both the Z of the first qubit and the X of the second
+    device->NamedOperation("Hadamard", {}, {wires[1]});
+    device->NamedOperation("PauliRot", {M_PI}, wires, false, {}, {}, {"XZ"});
+    CHECK(getValue(device->PauliMeasure("X", {wires[0]})) == false);
+    CHECK(getValue(device->PauliMeasure("X", {wires[1]})) == true);
+
+    // The adjoint undoes a quarter turn
+    device->NamedOperation("IsingXX", {M_PI / 2}, wires);
+    device->NamedOperation("IsingXX", {M_PI / 2}, wires, true);
+    CHECK(getValue(device->PauliMeasure("XX", wires)) == true);
+
+    CHECK_THROWS_WITH(device->NamedOperation("RZ", {0.3}, {wires[0]}),
+                      ContainsSubstring("multiples of pi/2"));
+    CHECK_THROWS_WITH(device->NamedOperation("T", {}, {wires[0]}),
+                      ContainsSubstring("non-Clifford"));
+
+    device->ReleaseQubits(wires);
+}
+
+TEST_CASE("Test sampling a GHZ state", "[StabilizerQubit]")
+{
+    auto device = std::make_unique<StabilizerQubit>("{seed : 7}");
+    const size_t num_qubits = 130;
+    const size_t shots = 100;
+    auto wires = device->AllocateQubits(num_qubits);
+    device->SetDeviceShots(shots);
+
+    device->NamedOperation("Hadamard", {}, {wires[0]});
+    for (size_t i = 0; i + 1 < num_qubits; i++) {
+        device->NamedOperation("CNOT", {}, {wires[i], wires[i + 1]});
+    }
+    // Flip every other qubit, so that the outcomes alternate within each shot
+    for (size_t i = 1; i < num_qubits; i += 2) {
+        device->NamedOperation("PauliX", {}, {wires[i]});
+    }
+
+    std::vector<double> buffer(shots * num_qubits);
+    const size_t sizes[2] = {shots, num_qubits};
+    const size_t strides[2] = {num_qubits, 1};
+    DataView<double, 2> samples(buffer.data(), 0, sizes, strides);
+    device->Sample(samples);
+
+    size_t num_ones = 0;
+    for (size_t s = 0; s < shots; s++) {
+        const double first = samples(s, 0);
+        num_ones += first == 1.0;
+        for (size_t i = 0; i < num_qubits; i++) {
+            CHECK(samples(s, i) == (i % 2 ? 1.0 - first : first));
+        }
+    }
+    CHECK(num_ones > 0);
+    CHECK(num_ones < shots);
+
+    // Packed samples of a subset of the qubits, which spans two words per shot
+    const std::vector<QubitIdType> subset(wires.begin(), wires.begin() + 70);
+    std::vector<uint64_t> packed_buffer(shots * 2);
+    const size_t packed_sizes[2] = {shots, 2};
+    const size_t packed_strides[2] = {2, 1};
+    DataView<uint64_t, 2> packed(packed_buffer.data(), 0, packed_sizes, packed_strides);
+    device->PackedSample(packed, subset);
+    for (size_t s = 0; s < shots; s++) {
+        const uint64_t alternating = 0xAAAAAAAAAAAAAAAA;
+        const bool first = packed(s, 0) & 1;
+        CHECK(packed(s, 0) == (first ? ~alternating : alternating));
+        CHECK(packed(s, 1) == ((first ? ~alternating : alternating) & 0x3F));
+    }
+
+    // Sampling does not collapse the state
+    CHECK(getValue(device->PauliMeasure("ZZ", {wires[0], wires[2]})) == false);
+    CHECK(getValue(device->PauliMeasure("XX", {wires[0], wires[1]})) == false);
+
+    device->ReleaseQubits(wires);
+}
+
+TEST_CASE("Test reallocated qubits are reset", "[StabilizerQubit]")
+{
+    auto device = std::make_unique<StabilizerQubit>();
+    auto wires = device->AllocateQubits(2);
+    device->NamedOperation("PauliX", {}, {wires[1]});
+    device->ReleaseQubit(wires[1]);
+    CHECK(device->GetNumQubits() == 1);
+
+    auto wire = device->AllocateQubit();
+    CHECK(device->GetNumQubits() == 2);
+    CHECK(getValue(device->Measure(wire, std::nullopt)) == false);
+
+    device->ReleaseQubits({wires[0], wire});
+    CHECK(device->GetNumQubits() == 0);
+}
+
+TEST_CASE("Test Pauli measurements through the runtime, device=stabilizer.qubit",
+          "[StabilizerQubit]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"stabilizer.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(3);
+    QUBIT *q0 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    QUBIT *q1 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+    QUBIT *q2 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 2);
+
+    // Measuring XXX on |000> is random, after which XXX and ZZI are deterministic
+    const bool outcome = *__catalyst__qis__PauliMeasure("XXX", false, nullptr, false, true, 3, q0, q1, q2);
+    CHECK(*__catalyst__qis__PauliMeasure("XXX", false, nullptr, false, true, 3, q0, q1, q2) == outcome);
+    CHECK(*__catalyst__qis__PauliMeasure("ZZ", false, nullptr, false, true, 2, q0, q1) == false);
+
+    __catalyst__qis__PauliRot("ZZ", M_PI / 2, nullptr, true, 2, q1, q2);
+    __catalyst__qis__PauliRot("ZZ", M_PI / 2, nullptr, true, 2, q1, q2);
+    CHECK(*__catalyst__qis__PauliMeasure("XXX", false, nullptr, false, true, 3, q0, q1, q2) == outcome);
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test packed Pauli words through the runtime, device=stabilizer.qubit",
+          "[StabilizerQubit]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"stabilizer.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(3);
+    QUBIT *q0 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    QUBIT *q1 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+    QUBIT *q2 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 2);
+
+    // The X masks then the Z masks, e.g. XXX is {0b111, 0}, ZZ is {0, 0b11} and YY is {0b11, 0b11}
+    const uint64_t xxx[] = {7, 0};
+    const uint64_t zz[] = {0, 3};
+    const uint64_t yy[] = {3, 3};
+
+    const bool outcome = *__catalyst__qis__PackedPauliMeasure(xxx, false, nullptr, false, true, 3, q0, q1, q2);
+    CHECK(*__catalyst__qis__PauliMeasure("XXX", false, nullptr, false, true, 3, q0, q1, q2) == outcome);
+    CHECK(*__catalyst__qis__PackedPauliMeasure(zz, false, nullptr, false, true, 2, q0, q1) == false);
+    CHECK(*__catalyst__qis__PackedPauliMeasure(zz, true, nullptr, false, true, 2, q0, q1) == true);
+
+    // A Y word only agrees with its string form if the X and Z bits are combined
+    const bool yy_outcome = *__catalyst__qis__PackedPauliMeasure(yy, false, nullptr, false, true, 2, q1, q2);
+    CHECK(*__catalyst__qis__PauliMeasure("YY", false, nullptr, false, true, 2, q1, q2) == yy_outcome);
+
+    QUBIT *wires[] = {q1, q2};
+    __catalyst__qis__PackedPauliRot_array(zz, M_PI, nullptr, true, 2, wires);
+    CHECK(*__catalyst__qis__PauliMeasure("YY", false, nullptr, false, true, 2, q1, q2) == yy_outcome);
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test measurement outcomes as bits through the runtime, device=stabilizer.qubit",
+          "[StabilizerQubit]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"stabilizer.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    // Flip every third qubit, over more qubits than fit in a single word
+    const size_t num_qubits = 70;
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(num_qubits);
+    std::vector<QUBIT *> wires(num_qubits);
+    for (size_t i = 0; i < num_qubits; i++) {
+        wires[i] = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, i);
+        if (i % 3 == 0) {
+            __catalyst__qis__PauliX(wires[i], nullptr);
+        }
+    }
+
+    CHECK(__catalyst__qis__MeasureBit(wires[0], -1) == true);
+    CHECK(__catalyst__qis__MeasureBit(wires[1], -1) == false);
+
+    const std::vector<int32_t> postselects(num_qubits, -1);
+    uint64_t bits[2] = {~0ULL, ~0ULL};
+    __catalyst__qis__MeasureBits(num_qubits, wires.data(), postselects.data(), bits);
+    for (size_t i = 0; i < num_qubits; i++) {
+        CHECK(((bits[i / 64] >> (i % 64)) & 1) == (i % 3 == 0));
+    }
+    CHECK((bits[1] >> (num_qubits - 64)) == 0);
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test Hamiltonian expectation values estimated from samples, device=stabilizer.qubit",
+          "[StabilizerQubit]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"stabilizer.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 1000, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+    QUBIT *q0 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    QUBIT *q1 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+    // The Bell state (|00> + |11>) / sqrt(2) has deterministic XX, YY and ZZ
+    __catalyst__qis__Hadamard(q0, nullptr);
+    __catalyst__qis__CNOT(q0, q1, nullptr);
+
+    auto obs = [](ObsId id, QUBIT *wire) {
+        return __catalyst__qis__NamedObs(static_cast<int64_t>(id), wire);
+    };
+    const ObsIdType xx =
+        __catalyst__qis__TensorObs(2, obs(ObsId::PauliX, q0), obs(ObsId::PauliX, q1));
+    const ObsIdType yy =
+        __catalyst__qis__TensorObs(2, obs(ObsId::PauliY, q0), obs(ObsId::PauliY, q1));
+    const ObsIdType zz =
+        __catalyst__qis__TensorObs(2, obs(ObsId::PauliZ, q0), obs(ObsId::PauliZ, q1));
+    const ObsIdType z0 = obs(ObsId::PauliZ, q0);
+    const ObsIdType id = obs(ObsId::Identity, q0);
+
+    // The three non-commuting groups are sampled in turn, each leaving the state unchanged
+    double coeffs_data[4] = {2, 3, -1, 0.5};
+    MemRefT_double_1d coeffs = {coeffs_data, coeffs_data, 0, {4}, {1}};
+    const ObsIdType hamiltonian = __catalyst__qis__HamiltonianObs(&coeffs, 4, xx, zz, yy, id);
+    CHECK(__catalyst__qis__Expval(hamiltonian) == 6.5);
+    CHECK(__catalyst__qis__Expval(hamiltonian) == 6.5);
+    CHECK(__catalyst__qis__Expval(yy) == -1);
+
+    CHECK(__catalyst__qis__Variance(zz) == 0);
+    const double var = __catalyst__qis__Variance(z0);
+    CHECK(var > 0.9);
+    CHECK(var <= 1);
+    REQUIRE_THROWS_WITH(__catalyst__qis__Variance(hamiltonian),
+                        ContainsSubstring("non-commuting Pauli words is not supported"));
+    REQUIRE_THROWS_WITH(__catalyst__qis__TensorObs(2, z0, xx),
+                        ContainsSubstring("Pauli words acting on the same qubits"));
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test joint expectation values and variances, device=stabilizer.qubit",
+          "[StabilizerQubit]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"stabilizer.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 1000, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+    QUBIT *q0 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    QUBIT *q1 = *(QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+    __catalyst__qis__Hadamard(q0, nullptr);
+    __catalyst__qis__CNOT(q0, q1, nullptr);
+
+    auto obs = [](ObsId id, QUBIT *wire) {
+        return __catalyst__qis__NamedObs(static_cast<int64_t>(id), wire);
+    };
+    const ObsIdType xx =
+        __catalyst__qis__TensorObs(2, obs(ObsId::PauliX, q0), obs(ObsId::PauliX, q1));
+    const ObsIdType yy =
+        __catalyst__qis__TensorObs(2, obs(ObsId::PauliY, q0), obs(ObsId::PauliY, q1));
+    const ObsIdType zz =
+        __catalyst__qis__TensorObs(2, obs(ObsId::PauliZ, q0), obs(ObsId::PauliZ, q1));
+
+    // The observables that the device doesn't support fall back to the estimator one by one
+    double moments[2];
+    __catalyst__qis__ExpvalVar(moments, zz);
+    CHECK(moments[0] == 1);
+    CHECK(moments[1] == 0);
+
+    double expvals[3];
+    __catalyst__qis__Expvals(expvals, 3, xx, yy, zz);
+    CHECK(expvals[0] == 1);
+    CHECK(expvals[1] == -1);
+    CHECK(expvals[2] == 1);
+
+    __catalyst__rt__qubit_release_array(qs);
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}